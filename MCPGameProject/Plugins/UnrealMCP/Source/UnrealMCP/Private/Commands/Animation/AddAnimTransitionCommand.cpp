@@ -56,6 +56,7 @@ FString FAddAnimTransitionCommand::Execute(const FString& Parameters)
     }
 
     JsonObject->TryGetStringField(TEXT("condition_variable"), Params.ConditionVariableName);
+    JsonObject->TryGetBoolField(TEXT("negate_condition"), Params.bNegateCondition);
 
     FString Error;
     if (!Service.AddStateTransition(AnimBlueprint, StateMachineName, Params, Error))
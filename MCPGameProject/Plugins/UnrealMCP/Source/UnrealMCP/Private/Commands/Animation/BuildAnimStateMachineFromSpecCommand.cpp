@@ -0,0 +1,168 @@
+#include "Commands/Animation/BuildAnimStateMachineFromSpecCommand.h"
+#include "Animation/AnimBlueprint.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Horizontal spacing of states the spec gives no position */
+    constexpr double DefaultStateSpacing = 300.0;
+
+    /** Object entries of an optional array field */
+    TArray<TSharedPtr<FJsonObject>> GetStateMachineSpecObjects(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* FieldName)
+    {
+        TArray<TSharedPtr<FJsonObject>> Objects;
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (JsonObject->TryGetArrayField(FieldName, Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                const TSharedPtr<FJsonObject>* Object;
+                if (Value.IsValid() && Value->TryGetObject(Object))
+                {
+                    Objects.Add(*Object);
+                }
+            }
+        }
+        return Objects;
+    }
+}
+
+FBuildAnimStateMachineFromSpecCommand::FBuildAnimStateMachineFromSpecCommand(IAnimationBlueprintService& InService)
+    : Service(InService)
+{
+}
+
+FString FBuildAnimStateMachineFromSpecCommand::Execute(const FString& Parameters)
+{
+    FString AnimBlueprintName;
+    FAnimStateMachineSpecParams Spec;
+    FString Error;
+    if (!ParseParameters(Parameters, AnimBlueprintName, Spec, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    if (!Spec.IsValid(Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    UAnimBlueprint* AnimBlueprint = Service.FindAnimBlueprint(AnimBlueprintName);
+    if (!AnimBlueprint)
+    {
+        return CreateErrorResponse(FString::Printf(TEXT("Animation Blueprint '%s' not found"), *AnimBlueprintName));
+    }
+
+    TSharedPtr<FJsonObject> Report;
+    if (!Service.BuildStateMachineFromSpec(AnimBlueprint, Spec, Report, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    const int32 FailedCount = static_cast<int32>(Report->GetNumberField(TEXT("failed_count")));
+    bool bCompiled = true;
+    Report->TryGetBoolField(TEXT("compiled"), bCompiled);
+
+    // Success means every element was added and the blueprint compiled, if asked to
+    Report->SetBoolField(TEXT("success"), FailedCount == 0 && bCompiled);
+    Report->SetStringField(TEXT("message"), FString::Printf(TEXT("Built state machine '%s': %d element(s), %d failed"),
+        *Spec.StateMachineName, static_cast<int32>(Report->GetNumberField(TEXT("element_count"))), FailedCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBuildAnimStateMachineFromSpecCommand::GetCommandName() const
+{
+    return TEXT("build_anim_state_machine_from_spec");
+}
+
+bool FBuildAnimStateMachineFromSpecCommand::ValidateParams(const FString& Parameters) const
+{
+    FString AnimBlueprintName;
+    FAnimStateMachineSpecParams Spec;
+    FString Error;
+    return ParseParameters(Parameters, AnimBlueprintName, Spec, Error) && Spec.IsValid(Error);
+}
+
+bool FBuildAnimStateMachineFromSpecCommand::ParseParameters(const FString& JsonString, FString& OutAnimBlueprintName, FAnimStateMachineSpecParams& OutSpec, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("anim_blueprint_name"), OutAnimBlueprintName))
+    {
+        OutError = TEXT("Missing required 'anim_blueprint_name' parameter");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("state_machine_name"), OutSpec.StateMachineName))
+    {
+        OutError = TEXT("Missing required 'state_machine_name' parameter");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("entry_state"), OutSpec.EntryStateName);
+    JsonObject->TryGetBoolField(TEXT("connect_to_output_pose"), OutSpec.bConnectToOutputPose);
+    JsonObject->TryGetBoolField(TEXT("compile"), OutSpec.bCompile);
+
+    // Same fields as add_anim_state; states without a position are laid out in a row
+    for (const TSharedPtr<FJsonObject>& StateObj : GetStateMachineSpecObjects(JsonObject, TEXT("states")))
+    {
+        FAnimStateParams& State = OutSpec.States.AddDefaulted_GetRef();
+        StateObj->TryGetStringField(TEXT("state_name"), State.StateName);
+        StateObj->TryGetStringField(TEXT("animation_asset_path"), State.AnimationAssetPath);
+        StateObj->TryGetBoolField(TEXT("is_default_state"), State.bIsDefaultState);
+
+        double PosX, PosY;
+        if (StateObj->TryGetNumberField(TEXT("node_position_x"), PosX) &&
+            StateObj->TryGetNumberField(TEXT("node_position_y"), PosY))
+        {
+            State.NodePosition = FVector2D(PosX, PosY);
+        }
+        else
+        {
+            State.NodePosition = FVector2D(DefaultStateSpacing * OutSpec.States.Num(), 0.0);
+        }
+    }
+
+    // Same fields as add_anim_transition
+    for (const TSharedPtr<FJsonObject>& TransitionObj : GetStateMachineSpecObjects(JsonObject, TEXT("transitions")))
+    {
+        FAnimTransitionParams& Transition = OutSpec.Transitions.AddDefaulted_GetRef();
+        TransitionObj->TryGetStringField(TEXT("from_state"), Transition.FromStateName);
+        TransitionObj->TryGetStringField(TEXT("to_state"), Transition.ToStateName);
+        TransitionObj->TryGetStringField(TEXT("transition_rule_type"), Transition.TransitionRuleType);
+        TransitionObj->TryGetStringField(TEXT("condition_variable"), Transition.ConditionVariableName);
+        TransitionObj->TryGetBoolField(TEXT("negate_condition"), Transition.bNegateCondition);
+
+        double BlendDuration = 0.2;
+        if (TransitionObj->TryGetNumberField(TEXT("blend_duration"), BlendDuration))
+        {
+            Transition.BlendDuration = static_cast<float>(BlendDuration);
+        }
+    }
+
+    return true;
+}
+
+FString FBuildAnimStateMachineFromSpecCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
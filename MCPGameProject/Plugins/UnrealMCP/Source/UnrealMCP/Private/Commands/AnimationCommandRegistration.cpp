@@ -9,6 +9,7 @@
 #include "Commands/Animation/GetAnimBlueprintMetadataCommand.h"
 #include "Commands/Animation/ConfigureAnimSlotCommand.h"
 #include "Commands/Animation/ConnectAnimGraphNodesCommand.h"
+#include "Commands/Animation/BuildAnimStateMachineFromSpecCommand.h"
 #include "Services/AnimationBlueprintService.h"
 
 // Static member definition
@@ -31,6 +32,7 @@ void FAnimationCommandRegistration::RegisterAllAnimationCommands()
     RegisterGetAnimBlueprintMetadataCommand();
     RegisterConfigureAnimSlotCommand();
     RegisterConnectAnimGraphNodesCommand();
+    RegisterBuildAnimStateMachineFromSpecCommand();
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationCommandRegistration::RegisterAllAnimationCommands: Registered %d Animation commands"),
         RegisteredCommandNames.Num());
@@ -59,75 +61,58 @@ void FAnimationCommandRegistration::UnregisterAllAnimationCommands()
 
 void FAnimationCommandRegistration::RegisterCreateAnimationBlueprintCommand()
 {
-    TSharedPtr<FCreateAnimationBlueprintCommand> Command = MakeShared<FCreateAnimationBlueprintCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_animation_blueprint"), []() { return MakeShared<FCreateAnimationBlueprintCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterLinkAnimationLayerCommand()
 {
-    TSharedPtr<FLinkAnimationLayerCommand> Command = MakeShared<FLinkAnimationLayerCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("link_animation_layer"), []() { return MakeShared<FLinkAnimationLayerCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterCreateAnimStateMachineCommand()
 {
-    TSharedPtr<FCreateAnimStateMachineCommand> Command = MakeShared<FCreateAnimStateMachineCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_anim_state_machine"), []() { return MakeShared<FCreateAnimStateMachineCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterAddAnimStateCommand()
 {
-    TSharedPtr<FAddAnimStateCommand> Command = MakeShared<FAddAnimStateCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_anim_state"), []() { return MakeShared<FAddAnimStateCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterAddAnimTransitionCommand()
 {
-    TSharedPtr<FAddAnimTransitionCommand> Command = MakeShared<FAddAnimTransitionCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_anim_transition"), []() { return MakeShared<FAddAnimTransitionCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterAddAnimVariableCommand()
 {
-    TSharedPtr<FAddAnimVariableCommand> Command = MakeShared<FAddAnimVariableCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_anim_variable"), []() { return MakeShared<FAddAnimVariableCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterGetAnimBlueprintMetadataCommand()
 {
-    TSharedPtr<FGetAnimBlueprintMetadataCommand> Command = MakeShared<FGetAnimBlueprintMetadataCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_anim_blueprint_metadata"), []() { return MakeShared<FGetAnimBlueprintMetadataCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterConfigureAnimSlotCommand()
 {
-    TSharedPtr<FConfigureAnimSlotCommand> Command = MakeShared<FConfigureAnimSlotCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("configure_anim_slot"), []() { return MakeShared<FConfigureAnimSlotCommand>(FAnimationBlueprintService::Get()); });
 }
 
 void FAnimationCommandRegistration::RegisterConnectAnimGraphNodesCommand()
 {
-    TSharedPtr<FConnectAnimGraphNodesCommand> Command = MakeShared<FConnectAnimGraphNodesCommand>(FAnimationBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("connect_anim_graph_nodes"), []() { return MakeShared<FConnectAnimGraphNodesCommand>(FAnimationBlueprintService::Get()); });
 }
 
-void FAnimationCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FAnimationCommandRegistration::RegisterBuildAnimStateMachineFromSpecCommand()
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FAnimationCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FAnimationCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
+    RegisterAndTrackCommand(TEXT("build_anim_state_machine_from_spec"), []() { return MakeShared<FBuildAnimStateMachineFromSpecCommand>(FAnimationBlueprintService::Get()); });
+}
 
+void FAnimationCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
+{
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FAnimationCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
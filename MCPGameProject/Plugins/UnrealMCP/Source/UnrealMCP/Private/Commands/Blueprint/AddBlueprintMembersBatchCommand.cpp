@@ -0,0 +1,206 @@
+#include "Commands/Blueprint/AddBlueprintMembersBatchCommand.h"
+#include "Commands/Blueprint/AddBlueprintVariableCommand.h"
+#include "Commands/Blueprint/AddComponentToBlueprintCommand.h"
+#include "Commands/Blueprint/CreateCustomBlueprintFunctionCommand.h"
+#include "Services/ComponentService.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "MCPBatchEditScope.h"
+
+namespace
+{
+    const TCHAR* MemberArrayFields[] = { TEXT("components"), TEXT("variables"), TEXT("functions") };
+
+    /** @return The entries of an optional array field; empty if it is missing */
+    const TArray<TSharedPtr<FJsonValue>>& GetMemberArray(const TSharedRef<FJsonObject>& Params, const TCHAR* FieldName)
+    {
+        static const TArray<TSharedPtr<FJsonValue>> Empty;
+        const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+        return Params->TryGetArrayField(FieldName, Array) ? *Array : Empty;
+    }
+
+    /** Counts results and collects them for one section of the response */
+    struct FMemberResults
+    {
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        int32 Succeeded = 0;
+        int32 Failed = 0;
+
+        void Add(const FString& Name, bool bSuccess, const FString& Error)
+        {
+            TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("name"), Name);
+            Entry->SetBoolField(TEXT("success"), bSuccess);
+            if (bSuccess)
+            {
+                Succeeded++;
+            }
+            else
+            {
+                Entry->SetStringField(TEXT("error"), Error);
+                Failed++;
+            }
+            Entries.Add(MakeShared<FJsonValueObject>(Entry));
+        }
+    };
+}
+
+FAddBlueprintMembersBatchCommand::FAddBlueprintMembersBatchCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FAddBlueprintMembersBatchCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FAddBlueprintMembersBatchCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        Response.SetError(TEXT("Missing required 'blueprint_name', or 'components', 'variables' and 'functions' are all empty"));
+        return;
+    }
+
+    const FString BlueprintName = Params->GetStringField(TEXT("blueprint_name"));
+    UBlueprint* Blueprint = BlueprintService.FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        Response.SetError(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return;
+    }
+
+    bool bAllOrNothing = false;
+    Params->TryGetBoolField(TEXT("all_or_nothing"), bAllOrNothing);
+
+    FMemberResults ComponentResults;
+    FMemberResults VariableResults;
+    FMemberResults FunctionResults;
+    bool bRolledBack = false;
+    {
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Add Blueprint Members: %s"), *Blueprint->GetName())));
+
+        // Components first, so variables and functions are checked against their names
+        for (const TSharedPtr<FJsonValue>& Value : GetMemberArray(Params, TEXT("components")))
+        {
+            const TSharedPtr<FJsonObject> ComponentObj = Value.IsValid() ? Value->AsObject() : nullptr;
+            FComponentCreationParams ComponentParams;
+            FString Error;
+            const bool bAdded = ComponentObj.IsValid()
+                && FAddComponentToBlueprintCommand::ParseComponentParams(ComponentObj.ToSharedRef(), ComponentParams, Error)
+                && ComponentParams.IsValid(Error)
+                && FComponentService::Get().AddComponentToBlueprint(Blueprint, ComponentParams, Error, true);
+            if (!ComponentObj.IsValid())
+            {
+                Error = TEXT("Component entry is not an object");
+            }
+            ComponentResults.Add(ComponentParams.ComponentName, bAdded, Error.IsEmpty() ? TEXT("Failed to add component to blueprint") : Error);
+        }
+
+        for (const TSharedPtr<FJsonValue>& Value : GetMemberArray(Params, TEXT("variables")))
+        {
+            const TSharedPtr<FJsonObject> VariableObj = Value.IsValid() ? Value->AsObject() : nullptr;
+            FString VariableName;
+            FString VariableType;
+            FString Error;
+            bool bAdded = false;
+            if (!VariableObj.IsValid() || !VariableObj->TryGetStringField(TEXT("variable_name"), VariableName)
+                || !VariableObj->TryGetStringField(TEXT("variable_type"), VariableType))
+            {
+                Error = TEXT("Missing 'variable_name' or 'variable_type'");
+            }
+            else
+            {
+                bool bIsExposed = false;
+                VariableObj->TryGetBoolField(TEXT("is_exposed"), bIsExposed);
+
+                FEdGraphPinType PinType;
+                bAdded = FAddBlueprintVariableCommand::ResolveVariableType(VariableType, PinType, Error)
+                    && FAddBlueprintVariableCommand::AddVariable(Blueprint, VariableName, PinType, bIsExposed, true, Error);
+            }
+            VariableResults.Add(VariableName, bAdded, Error);
+        }
+
+        for (const TSharedPtr<FJsonValue>& Value : GetMemberArray(Params, TEXT("functions")))
+        {
+            const TSharedPtr<FJsonObject> FunctionObj = Value.IsValid() ? Value->AsObject() : nullptr;
+            FString FunctionName;
+            FString Error;
+            bool bAdded = false;
+            if (!FunctionObj.IsValid())
+            {
+                Error = TEXT("Function entry is not an object");
+            }
+            else
+            {
+                FunctionObj->TryGetStringField(TEXT("function_name"), FunctionName);
+                bAdded = FCreateCustomBlueprintFunctionCommand::CreateFunction(Blueprint, FunctionObj.ToSharedRef(), true, Error);
+            }
+            FunctionResults.Add(FunctionName, bAdded, Error);
+        }
+
+        const int32 Succeeded = ComponentResults.Succeeded + VariableResults.Succeeded + FunctionResults.Succeeded;
+        const int32 Failed = ComponentResults.Failed + VariableResults.Failed + FunctionResults.Failed;
+        if (bAllOrNothing && Failed > 0)
+        {
+            // Undoing the transaction restores the Blueprint as it was before the batch
+            FMCPBatchEditScope::RequestRollback();
+            bRolledBack = Succeeded > 0;
+        }
+        else if (Succeeded > 0)
+        {
+            // The one skeleton regeneration for every addition above
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+            if (ComponentResults.Succeeded > 0 || FunctionResults.Succeeded > 0)
+            {
+                FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
+            }
+            FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
+        }
+    }
+
+    const int32 Succeeded = ComponentResults.Succeeded + VariableResults.Succeeded + FunctionResults.Succeeded;
+    const int32 Failed = ComponentResults.Failed + VariableResults.Failed + FunctionResults.Failed;
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
+    ResponseObj->SetArrayField(TEXT("components"), ComponentResults.Entries);
+    ResponseObj->SetArrayField(TEXT("variables"), VariableResults.Entries);
+    ResponseObj->SetArrayField(TEXT("functions"), FunctionResults.Entries);
+    ResponseObj->SetNumberField(TEXT("succeeded"), Succeeded);
+    ResponseObj->SetNumberField(TEXT("failed"), Failed);
+    ResponseObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+    ResponseObj->SetBoolField(TEXT("success"), Failed == 0);
+    Response.SetResult(ResponseObj);
+}
+
+FString FAddBlueprintMembersBatchCommand::GetCommandName() const
+{
+    return TEXT("add_blueprint_members_batch");
+}
+
+bool FAddBlueprintMembersBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FAddBlueprintMembersBatchCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) || BlueprintName.IsEmpty())
+    {
+        return false;
+    }
+
+    for (const TCHAR* FieldName : MemberArrayFields)
+    {
+        if (GetMemberArray(Params, FieldName).Num() > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -19,6 +19,7 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/GameModeBase.h"
+#include "MCPBatchEditScope.h"
 
 FAddBlueprintVariableCommand::FAddBlueprintVariableCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -68,8 +69,27 @@ FString FAddBlueprintVariableCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
 
-    // Create variable based on type
     FEdGraphPinType PinType;
+    FString Error;
+    if (!ResolveVariableType(VariableType, PinType, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    if (!AddVariable(Blueprint, VariableName, PinType, IsExposed, false, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AddBlueprintVariable: Successfully created variable '%s' in Blueprint '%s'"),
+        *VariableName, *BlueprintName);
+
+    return CreateSuccessResponse(BlueprintName, VariableName, VariableType, IsExposed);
+}
+
+bool FAddBlueprintVariableCommand::ResolveVariableType(const FString& VariableType, FEdGraphPinType& OutResolvedType, FString& OutError)
+{
+    FEdGraphPinType& PinType = OutResolvedType;
     bool bTypeResolved = false;
 
     auto SetPinTypeForCategory = [&](auto Category, UObject* SubCategoryObject = nullptr) {
@@ -112,7 +132,8 @@ FString FAddBlueprintVariableCommand::Execute(const FString& Parameters)
 
         if (CommaPos == INDEX_NONE)
         {
-            return CreateErrorResponse(FString::Printf(TEXT("Invalid Map type format: %s. Expected Map<KeyType, ValueType>"), *VariableType));
+            OutError = FString::Printf(TEXT("Invalid Map type format: %s. Expected Map<KeyType, ValueType>"), *VariableType);
+            return false;
         }
 
         FString KeyTypeStr = InnerTypes.Left(CommaPos).TrimStartAndEnd();
@@ -121,7 +142,7 @@ FString FAddBlueprintVariableCommand::Execute(const FString& Parameters)
         UE_LOG(LogTemp, Display, TEXT("AddBlueprintVariable: Parsing Map - KeyType='%s', ValueType='%s'"), *KeyTypeStr, *ValueTypeStr);
 
         // Helper lambda to resolve a type string to FEdGraphPinType
-        auto ResolveTypeString = [this](const FString& TypeString, FEdGraphPinType& OutPinType) -> bool
+        auto ResolveTypeString = [](const FString& TypeString, FEdGraphPinType& OutPinType) -> bool
         {
             if (TypeString.Equals(TEXT("Name"), ESearchCase::IgnoreCase)) {
                 OutPinType.PinCategory = UEdGraphSchema_K2::PC_Name;
@@ -187,14 +208,16 @@ FString FAddBlueprintVariableCommand::Execute(const FString& Parameters)
         FEdGraphPinType KeyPinType;
         if (!ResolveTypeString(KeyTypeStr, KeyPinType))
         {
-            return CreateErrorResponse(FString::Printf(TEXT("Could not resolve Map key type: %s"), *KeyTypeStr));
+            OutError = FString::Printf(TEXT("Could not resolve Map key type: %s"), *KeyTypeStr);
+            return false;
         }
 
         // Resolve value type
         FEdGraphPinType ValuePinType;
         if (!ResolveTypeString(ValueTypeStr, ValuePinType))
         {
-            return CreateErrorResponse(FString::Printf(TEXT("Could not resolve Map value type: %s"), *ValueTypeStr));
+            OutError = FString::Printf(TEXT("Could not resolve Map value type: %s"), *ValueTypeStr);
+            return false;
         }
 
         // Set up the Map type
@@ -375,84 +398,90 @@ FString FAddBlueprintVariableCommand::Execute(const FString& Parameters)
     }
 
     if (!bTypeResolved) {
-        return CreateErrorResponse(FString::Printf(TEXT("Could not resolve variable type: %s"), *VariableType));
+        OutError = FString::Printf(TEXT("Could not resolve variable type: %s"), *VariableType);
+        return false;
     }
 
-    // Debug: Log the resolved pin type
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Blueprint='%s', Variable='%s', RequestedType='%s'"),
-        *BlueprintName, *VariableName, *VariableType);
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Resolved PinCategory='%s', PinSubCategory='%s', SubCategoryObject='%s'"),
+    UE_LOG(LogTemp, Verbose, TEXT("AddBlueprintVariable: Resolved '%s' to PinCategory='%s', PinSubCategory='%s', SubCategoryObject='%s'"),
+        *VariableType,
         *PinType.PinCategory.ToString(),
         *PinType.PinSubCategory.ToString(),
         PinType.PinSubCategoryObject.IsValid() ? *PinType.PinSubCategoryObject->GetName() : TEXT("None"));
+    return true;
+}
 
-    // Check if variable already exists
-    for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+bool FAddBlueprintVariableCommand::AddVariable(UBlueprint* Blueprint, const FString& VariableName, const FEdGraphPinType& PinType, bool bIsExposed,
+    bool bDeferStructuralUpdate, FString& OutError)
+{
+    const FName VarName(*VariableName);
+    if (FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VarName) != INDEX_NONE)
     {
-        if (Variable.VarName == FName(*VariableName))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Variable '%s' already exists in Blueprint '%s'"),
-                *VariableName, *BlueprintName);
-            return CreateErrorResponse(FString::Printf(TEXT("Variable '%s' already exists in Blueprint '%s'"),
-                *VariableName, *BlueprintName));
-        }
+        OutError = FString::Printf(TEXT("Variable '%s' already exists in Blueprint '%s'"), *VariableName, *Blueprint->GetName());
+        return false;
     }
 
-    // Debug: Log variable count before
-    int32 VarCountBefore = Blueprint->NewVariables.Num();
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Variable count before AddMemberVariable: %d"), VarCountBefore);
-
-    // Create the variable
-    FBlueprintEditorUtils::AddMemberVariable(Blueprint, FName(*VariableName), PinType);
-
-    // Debug: Log variable count after
-    int32 VarCountAfter = Blueprint->NewVariables.Num();
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Variable count after AddMemberVariable: %d"), VarCountAfter);
-
-    // Set variable properties
-    FBPVariableDescription* NewVar = nullptr;
-    for (FBPVariableDescription& Variable : Blueprint->NewVariables)
+    if (!bDeferStructuralUpdate)
     {
-        if (Variable.VarName == FName(*VariableName))
+        if (!FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, PinType))
         {
-            NewVar = &Variable;
-            break;
+            OutError = FString::Printf(TEXT("Failed to create variable '%s' in Blueprint '%s'; the name may be taken by an inherited variable or component"),
+                *VariableName, *Blueprint->GetName());
+            return false;
         }
     }
-
-    if (!NewVar)
+    else
     {
-        // Debug: List all variables to see what's there
-        UE_LOG(LogTemp, Error, TEXT("AddBlueprintVariable: Failed to find newly created variable '%s'. Existing variables:"), *VariableName);
-        for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+        // What AddMemberVariable does, minus marking the Blueprint structurally modified: the
+        // caller does that once for all the variables it adds
+        TSet<FName> ExistingNames;
+        FBlueprintEditorUtils::GetClassVariableList(Blueprint, ExistingNames);
+        if (VarName.IsNone() || ExistingNames.Contains(VarName))
         {
-            UE_LOG(LogTemp, Error, TEXT("  - '%s' (Type: %s)"),
-                *Variable.VarName.ToString(),
-                *Variable.VarType.PinCategory.ToString());
+            OutError = FString::Printf(TEXT("Failed to create variable '%s' in Blueprint '%s'; the name may be taken by an inherited variable or component"),
+                *VariableName, *Blueprint->GetName());
+            return false;
         }
-        return CreateErrorResponse(FString::Printf(TEXT("Failed to create variable '%s' in Blueprint '%s'. AddMemberVariable may have failed silently."),
-            *VariableName, *BlueprintName));
+
+        Blueprint->Modify();
+        FBPVariableDescription NewVariable;
+        NewVariable.VarName = VarName;
+        NewVariable.VarGuid = FGuid::NewGuid();
+        NewVariable.FriendlyName = FName::NameToDisplayString(VariableName, PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean);
+        NewVariable.VarType = PinType;
+        NewVariable.VarType.bIsConst = false;
+        NewVariable.VarType.bIsWeakPointer = false;
+        NewVariable.VarType.bIsReference = false;
+        NewVariable.PropertyFlags |= (CPF_Edit | CPF_BlueprintVisible | CPF_DisableEditOnInstance);
+        NewVariable.ReplicationCondition = COND_None;
+        NewVariable.Category = UEdGraphSchema_K2::VR_DefaultCategory;
+        NewVariable.SetMetaData(TEXT("MultiLine"), TEXT("true"));
+        Blueprint->NewVariables.Add(NewVariable);
+        FBlueprintEditorUtils::ValidateBlueprintChildVariables(Blueprint, VarName);
+    }
+
+    const int32 VariableIndex = FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VarName);
+    if (VariableIndex == INDEX_NONE)
+    {
+        OutError = FString::Printf(TEXT("Failed to create variable '%s' in Blueprint '%s'. AddMemberVariable may have failed silently."),
+            *VariableName, *Blueprint->GetName());
+        return false;
     }
 
     // Set Instance Editable (the "eye" icon in Blueprint editor)
     // By default, AddMemberVariable sets: CPF_Edit | CPF_BlueprintVisible | CPF_DisableEditOnInstance
     // CPF_DisableEditOnInstance means "NOT Instance Editable" (eye closed)
     // To make Instance Editable: REMOVE CPF_DisableEditOnInstance
-    // To make NOT Instance Editable: KEEP CPF_DisableEditOnInstance (already set by default)
-    if (IsExposed)
+    if (bIsExposed)
     {
-        // Remove the disable flag to enable instance editing (open eye)
-        NewVar->PropertyFlags &= ~CPF_DisableEditOnInstance;
+        Blueprint->NewVariables[VariableIndex].PropertyFlags &= ~CPF_DisableEditOnInstance;
     }
-    // else: CPF_DisableEditOnInstance is already set by AddMemberVariable, so eye stays closed
-
-    // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariable: Successfully created variable '%s' in Blueprint '%s'"),
-        *VariableName, *BlueprintName);
 
-    return CreateSuccessResponse(BlueprintName, VariableName, VariableType, IsExposed);
+    if (!bDeferStructuralUpdate)
+    {
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
+    }
+    return true;
+}
 }
 
 FString FAddBlueprintVariableCommand::GetCommandName() const
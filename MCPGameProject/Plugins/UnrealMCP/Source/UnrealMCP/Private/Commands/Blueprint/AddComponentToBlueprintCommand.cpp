@@ -4,7 +4,6 @@
 #include "Serialization/JsonWriter.h"
 #include "Engine/Blueprint.h"
 #include "Services/ComponentService.h"
-#include "Services/ComponentService.h"
 
 FAddComponentToBlueprintCommand::FAddComponentToBlueprintCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -85,6 +84,11 @@ bool FAddComponentToBlueprintCommand::ParseParameters(const FString& JsonString,
         return false;
     }
     
+    return ParseComponentParams(JsonObject.ToSharedRef(), OutParams, OutError);
+}
+
+bool FAddComponentToBlueprintCommand::ParseComponentParams(const TSharedRef<FJsonObject>& JsonObject, FComponentCreationParams& OutParams, FString& OutError)
+{
     // Parse required component_name parameter
     if (!JsonObject->TryGetStringField(TEXT("component_name"), OutParams.ComponentName))
     {
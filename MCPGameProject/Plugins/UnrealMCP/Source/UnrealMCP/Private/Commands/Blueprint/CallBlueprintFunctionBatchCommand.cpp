@@ -0,0 +1,342 @@
+#include "Commands/Blueprint/CallBlueprintFunctionBatchCommand.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "JsonObjectConverter.h"
+#include "Services/ActorIndex.h"
+#include "UObject/Class.h"
+#include "UObject/StructOnScope.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** @return The actor class a name or path stands for, or nullptr */
+    UClass* FindActorClass(const FString& ClassName)
+    {
+        UClass* ActorClass = nullptr;
+        if (ClassName.StartsWith(TEXT("/")))
+        {
+            ActorClass = LoadObject<UClass>(nullptr, *ClassName);
+        }
+        else
+        {
+            ActorClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+            if (!ActorClass)
+            {
+                ActorClass = FindFirstObject<UClass>(*(TEXT("A") + ClassName), EFindFirstObjectOptions::NativeFirst);
+            }
+        }
+        return ActorClass && ActorClass->IsChildOf(AActor::StaticClass()) ? ActorClass : nullptr;
+    }
+
+    /** @return Whether a parameter is passed in rather than only returned */
+    bool IsInputParam(const FProperty* Property)
+    {
+        return Property->HasAnyPropertyFlags(CPF_Parm)
+            && !Property->HasAnyPropertyFlags(CPF_ReturnParm)
+            && (!Property->HasAnyPropertyFlags(CPF_OutParm) || Property->HasAnyPropertyFlags(CPF_ReferenceParm));
+    }
+
+    /** @return Whether a parameter comes back from the call */
+    bool IsOutputParam(const FProperty* Property)
+    {
+        return Property->HasAnyPropertyFlags(CPF_ReturnParm)
+            || (Property->HasAnyPropertyFlags(CPF_OutParm) && !Property->HasAnyPropertyFlags(CPF_ConstParm));
+    }
+
+    /**
+     * Fill a function's parameter frame from the request
+     * @return false with OutError set if a parameter is unknown or has the wrong type
+     */
+    bool BuildParameterFrame(UFunction* Function, const TSharedRef<FJsonObject>& Params, uint8* Frame, FString& OutError)
+    {
+        TSet<const FProperty*> SetByName;
+        const TSharedPtr<FJsonObject>* NamedParams = nullptr;
+        if (Params->TryGetObjectField(TEXT("params"), NamedParams))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Param : (*NamedParams)->Values)
+            {
+                FProperty* Property = FindFProperty<FProperty>(Function, *Param.Key);
+                if (!Property || !IsInputParam(Property))
+                {
+                    OutError = FString::Printf(TEXT("Function '%s' has no parameter '%s'"), *Function->GetName(), *Param.Key);
+                    return false;
+                }
+                if (!FJsonObjectConverter::JsonValueToUProperty(Param.Value, Property, Property->ContainerPtrToValuePtr<void>(Frame), 0, 0))
+                {
+                    OutError = FString::Printf(TEXT("Cannot convert the value of parameter '%s' to %s"), *Param.Key, *Property->GetCPPType());
+                    return false;
+                }
+                SetByName.Add(Property);
+            }
+        }
+
+        // Positional strings fill the string parameters not set by name, in declaration order
+        const TArray<TSharedPtr<FJsonValue>>* StringParams = nullptr;
+        if (Params->TryGetArrayField(TEXT("string_params"), StringParams))
+        {
+            int32 StringParamIndex = 0;
+            for (TFieldIterator<FProperty> It(Function); It && StringParamIndex < StringParams->Num(); ++It)
+            {
+                FStrProperty* StrProperty = CastField<FStrProperty>(*It);
+                if (StrProperty && IsInputParam(StrProperty) && !SetByName.Contains(StrProperty))
+                {
+                    FString Value;
+                    (*StringParams)[StringParamIndex++]->TryGetString(Value);
+                    StrProperty->SetPropertyValue_InContainer(Frame, Value);
+                }
+            }
+        }
+        return true;
+    }
+
+    /** @return The function's outputs in a frame after a call, by parameter name */
+    TSharedRef<FJsonObject> ReadOutputs(UFunction* Function, const uint8* Frame)
+    {
+        TSharedRef<FJsonObject> Outputs = MakeShared<FJsonObject>();
+        for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+        {
+            if (IsOutputParam(*It))
+            {
+                TSharedPtr<FJsonValue> Value = FJsonObjectConverter::UPropertyToJsonValue(*It, It->ContainerPtrToValuePtr<void>(Frame));
+                Outputs->SetField(It->GetName(), Value.IsValid() ? Value : MakeShared<FJsonValueNull>());
+            }
+        }
+        return Outputs;
+    }
+}
+
+FCallBlueprintFunctionBatchCommand::FCallBlueprintFunctionBatchCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FCallBlueprintFunctionBatchCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FCallBlueprintFunctionBatchCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        Response.SetError(TEXT("Missing required 'function_name', or none of 'target_names', 'tag' and 'class_name' given"));
+        return;
+    }
+
+    const FString FunctionName = Params->GetStringField(TEXT("function_name"));
+    FString WorldName = TEXT("auto");
+    Params->TryGetStringField(TEXT("world"), WorldName);
+    bool bIncludeOutputs = false;
+    Params->TryGetBoolField(TEXT("include_return_values"), bIncludeOutputs);
+
+    UWorld* PlayWorld = GEditor ? GEditor->PlayWorld.Get() : nullptr;
+    UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    UWorld* World = nullptr;
+    if (WorldName.Equals(TEXT("pie"), ESearchCase::IgnoreCase))
+    {
+        World = PlayWorld;
+    }
+    else if (WorldName.Equals(TEXT("editor"), ESearchCase::IgnoreCase))
+    {
+        World = EditorWorld;
+    }
+    else
+    {
+        World = PlayWorld ? PlayWorld : EditorWorld;
+    }
+    if (!World)
+    {
+        Response.SetError(WorldName.Equals(TEXT("pie"), ESearchCase::IgnoreCase) ? TEXT("No play-in-editor session is running") : TEXT("No valid editor world"));
+        return;
+    }
+
+    // Targets from the actor index; an actor matched several ways is called once
+    FActorIndex& Index = FActorIndex::Get();
+    TArray<AActor*> Targets;
+    TSet<AActor*> SeenTargets;
+    TArray<TSharedPtr<FJsonValue>> MissingTargets;
+    auto AddTarget = [&Targets, &SeenTargets](AActor* Actor)
+    {
+        bool bAlreadySeen = false;
+        SeenTargets.Add(Actor, &bAlreadySeen);
+        if (!bAlreadySeen)
+        {
+            Targets.Add(Actor);
+        }
+    };
+
+    const TArray<TSharedPtr<FJsonValue>>* TargetNames = nullptr;
+    if (Params->TryGetArrayField(TEXT("target_names"), TargetNames))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *TargetNames)
+        {
+            FString TargetName;
+            if (!Value.IsValid() || !Value->TryGetString(TargetName))
+            {
+                continue;
+            }
+            AActor* Actor = Index.FindActorByName(World, TargetName);
+            if (!Actor)
+            {
+                Actor = Index.FindActorByLabel(World, TargetName);
+            }
+            if (Actor)
+            {
+                AddTarget(Actor);
+            }
+            else
+            {
+                MissingTargets.Add(MakeShared<FJsonValueString>(TargetName));
+            }
+        }
+    }
+
+    FString Tag;
+    if (Params->TryGetStringField(TEXT("tag"), Tag) && !Tag.IsEmpty())
+    {
+        TArray<AActor*> TaggedActors;
+        Index.FindActorsWithTag(World, FName(*Tag), TaggedActors);
+        for (AActor* Actor : TaggedActors)
+        {
+            AddTarget(Actor);
+        }
+    }
+
+    FString ClassName;
+    if (Params->TryGetStringField(TEXT("class_name"), ClassName) && !ClassName.IsEmpty())
+    {
+        UClass* ActorClass = FindActorClass(ClassName);
+        if (!ActorClass)
+        {
+            Response.SetError(FString::Printf(TEXT("Actor class not found: %s"), *ClassName));
+            return;
+        }
+        TArray<AActor*> ClassActors;
+        Index.FindActorsOfClass(World, ActorClass, ClassActors);
+        for (AActor* Actor : ClassActors)
+        {
+            AddTarget(Actor);
+        }
+    }
+
+    // The first target class with the function fixes the signature the parameters are built for
+    UFunction* Function = nullptr;
+    for (AActor* Target : Targets)
+    {
+        Function = Target->GetClass()->FindFunctionByName(*FunctionName);
+        if (Function)
+        {
+            break;
+        }
+    }
+    if (!Targets.IsEmpty() && !Function)
+    {
+        Response.SetError(FString::Printf(TEXT("Function '%s' not found on any target"), *FunctionName));
+        return;
+    }
+    if (Function && !Function->HasAnyFunctionFlags(FUNC_BlueprintCallable))
+    {
+        Response.SetError(FString::Printf(TEXT("Function '%s' is not BlueprintCallable"), *FunctionName));
+        return;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 Called = 0;
+    int32 Failed = 0;
+    if (Function)
+    {
+        FStructOnScope TemplateFrame(Function);
+        FString ParamError;
+        if (!BuildParameterFrame(Function, Params, TemplateFrame.GetStructMemory(), ParamError))
+        {
+            Response.SetError(ParamError);
+            return;
+        }
+
+        // Function each target class calls, resolved once per class; nullptr if it cannot take the frame
+        TMap<const UClass*, UFunction*> FunctionsByClass;
+        FunctionsByClass.Add(Function->GetOwnerClass(), Function);
+
+        for (AActor* Target : Targets)
+        {
+            TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetStringField(TEXT("target"), Target->GetName());
+
+            const UClass* TargetClass = Target->GetClass();
+            UFunction** CachedFunction = FunctionsByClass.Find(TargetClass);
+            if (!CachedFunction)
+            {
+                UFunction* TargetFunction = TargetClass->FindFunctionByName(*FunctionName);
+                if (TargetFunction && TargetFunction != Function && !TargetFunction->IsSignatureCompatibleWith(Function))
+                {
+                    TargetFunction = nullptr;
+                }
+                CachedFunction = &FunctionsByClass.Add(TargetClass, TargetFunction);
+            }
+
+            if (!*CachedFunction)
+            {
+                Result->SetBoolField(TEXT("success"), false);
+                Result->SetStringField(TEXT("error"), FString::Printf(TEXT("Class '%s' has no compatible '%s'"), *TargetClass->GetName(), *FunctionName));
+                Failed++;
+            }
+            else
+            {
+                // A fresh copy of the template, since the call may write to any parameter
+                FStructOnScope CallFrame(Function);
+                for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+                {
+                    It->CopyCompleteValue_InContainer(CallFrame.GetStructMemory(), TemplateFrame.GetStructMemory());
+                }
+                Target->ProcessEvent(*CachedFunction, CallFrame.GetStructMemory());
+
+                Result->SetBoolField(TEXT("success"), true);
+                if (bIncludeOutputs)
+                {
+                    Result->SetObjectField(TEXT("return_value"), ReadOutputs(Function, CallFrame.GetStructMemory()));
+                }
+                Called++;
+            }
+            Results.Add(MakeShared<FJsonValueObject>(Result));
+        }
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("function_name"), FunctionName);
+    ResponseObj->SetStringField(TEXT("world"), World == PlayWorld ? TEXT("pie") : TEXT("editor"));
+    ResponseObj->SetArrayField(TEXT("results"), Results);
+    ResponseObj->SetArrayField(TEXT("missing_targets"), MissingTargets);
+    ResponseObj->SetNumberField(TEXT("called"), Called);
+    ResponseObj->SetNumberField(TEXT("failed"), Failed);
+    ResponseObj->SetBoolField(TEXT("success"), Failed == 0 && MissingTargets.IsEmpty());
+    Response.SetResult(ResponseObj);
+}
+
+FString FCallBlueprintFunctionBatchCommand::GetCommandName() const
+{
+    return TEXT("call_blueprint_function_batch");
+}
+
+bool FCallBlueprintFunctionBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FCallBlueprintFunctionBatchCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString FunctionName;
+    if (!Params->TryGetStringField(TEXT("function_name"), FunctionName) || FunctionName.IsEmpty())
+    {
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* TargetNames = nullptr;
+    FString Tag;
+    FString ClassName;
+    return (Params->TryGetArrayField(TEXT("target_names"), TargetNames) && TargetNames->Num() > 0)
+        || (Params->TryGetStringField(TEXT("tag"), Tag) && !Tag.IsEmpty())
+        || (Params->TryGetStringField(TEXT("class_name"), ClassName) && !ClassName.IsEmpty());
+}
@@ -7,7 +7,7 @@
 #include "GameFramework/Actor.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Class.h"
-#include "EngineUtils.h"
+#include "Services/ActorIndex.h"
 
 FCallBlueprintFunctionCommand::FCallBlueprintFunctionCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -57,15 +57,7 @@ FString FCallBlueprintFunctionCommand::Execute(const FString& Parameters)
     
     if (World)
     {
-        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
-        {
-            AActor* Actor = *ActorItr;
-            if (Actor && Actor->GetName() == Params.TargetName)
-            {
-                TargetObject = Actor;
-                break;
-            }
-        }
+        TargetObject = FActorIndex::Get().FindActorByName(World, Params.TargetName);
     }
     
     // If not found as actor, try to find it as any UObject
@@ -9,6 +9,8 @@
 #include "EdGraph/EdGraphNode.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
+#include "MCPCompileQueue.h"
+#include "Services/BlueprintCompileResultCache.h"
 
 FCompileBlueprintCommand::FCompileBlueprintCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -20,13 +22,22 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
     UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand::Execute called with parameters: %s"), *Parameters);
     
     FString BlueprintName;
+    bool bForce = false;
+    bool bSkeletonOnly = false;
     FString ParseError;
     
-    if (!ParseParameters(Parameters, BlueprintName, ParseError))
+    if (!ParseParameters(Parameters, BlueprintName, bForce, bSkeletonOnly, ParseError))
     {
         UE_LOG(LogTemp, Error, TEXT("CompileBlueprintCommand: Parameter parsing failed: %s"), *ParseError);
         return CreateErrorResponse(ParseError);
     }
+
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (FMCPCompileQueue::Get().TryDefer(GetCommandName(), BlueprintName, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
     
     // Find the blueprint
     UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand: Looking for blueprint: %s"), *BlueprintName);
@@ -37,9 +48,38 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
     }
     
+    // Nothing has changed since the last compile here, so compiling again would report the same
+    if (!bForce && !bSkeletonOnly)
+    {
+        if (const FBlueprintCompileResultCache::FResult* CachedResult = FBlueprintCompileResultCache::Get().Find(Blueprint))
+        {
+            UE_LOG(LogTemp, Log, TEXT("CompileBlueprintCommand: Blueprint '%s' unchanged since its last compile, not compiling"), *BlueprintName);
+            return CreateSuccessResponse(BlueprintName, CachedResult->CompilationTime, CachedResult->StatusMessage, CachedResult->Warnings, true);
+        }
+    }
+    
     // Record compilation start time
     double StartTime = FPlatformTime::Seconds();
     
+    if (bSkeletonOnly)
+    {
+        TArray<FString> SkeletonErrors;
+        TArray<FString> SkeletonWarnings;
+        const bool bSkeletonCompiled = BlueprintService.CompileBlueprintSkeleton(Blueprint, SkeletonErrors, SkeletonWarnings);
+        const float SkeletonTime = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+        
+        // A full compile's result no longer describes the regenerated skeleton
+        FBlueprintCompileResultCache::Get().Invalidate(Blueprint);
+        
+        if (!bSkeletonCompiled)
+        {
+            return CreateErrorResponse(TEXT("Blueprint skeleton compilation failed"), SkeletonErrors);
+        }
+        return CreateSuccessResponse(BlueprintName, SkeletonTime,
+            SkeletonWarnings.Num() > 0 ? TEXT("skeleton compiled with warnings") : TEXT("skeleton compiled successfully"),
+            SkeletonWarnings, false, true);
+    }
+    
     // Compile the blueprint using the service
     UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand: Starting compilation of blueprint: %s"), *BlueprintName);
     FString CompilationError;
@@ -68,6 +108,7 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
             UE_LOG(LogTemp, Warning, TEXT("CompileBlueprintCommand: Error %d: %s"), i, *DetailedErrors[i]);
         }
         
+        FBlueprintCompileResultCache::Get().Invalidate(Blueprint);
         return CreateErrorResponse(TEXT("Blueprint compilation failed"), DetailedErrors);
     }
     
@@ -81,6 +122,13 @@ FString FCompileBlueprintCommand::Execute(const FString& Parameters)
         Warnings.Add(CompilationError);
     }
     
+    FBlueprintCompileResultCache::FResult Result;
+    Result.Status = Blueprint->Status;
+    Result.StatusMessage = StatusMessage;
+    Result.Warnings = Warnings;
+    Result.CompilationTime = CompilationTime;
+    FBlueprintCompileResultCache::Get().Store(Blueprint, Result);
+    
     return CreateSuccessResponse(BlueprintName, CompilationTime, StatusMessage, Warnings);
 }
 
@@ -92,12 +140,14 @@ FString FCompileBlueprintCommand::GetCommandName() const
 bool FCompileBlueprintCommand::ValidateParams(const FString& Parameters) const
 {
     FString BlueprintName;
+    bool bForce = false;
+    bool bSkeletonOnly = false;
     FString ParseError;
     
-    return ParseParameters(Parameters, BlueprintName, ParseError);
+    return ParseParameters(Parameters, BlueprintName, bForce, bSkeletonOnly, ParseError);
 }
 
-bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, FString& OutError) const
+bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, bool& bOutForce, bool& bOutSkeletonOnly, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -115,16 +165,27 @@ bool FCompileBlueprintCommand::ParseParameters(const FString& JsonString, FStrin
         return false;
     }
     
+    JsonObject->TryGetBoolField(TEXT("force"), bOutForce);
+    JsonObject->TryGetBoolField(TEXT("skeleton_only"), bOutSkeletonOnly);
+    
     return true;
 }
 
-FString FCompileBlueprintCommand::CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status, const TArray<FString>& Warnings) const
+FString FCompileBlueprintCommand::CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status, const TArray<FString>& Warnings, bool bCached, bool bSkeletonOnly) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("blueprint_name"), BlueprintName);
     ResponseObj->SetNumberField(TEXT("compilation_time_seconds"), CompilationTime);
     ResponseObj->SetStringField(TEXT("status"), Status);
+    if (bCached)
+    {
+        ResponseObj->SetBoolField(TEXT("cached"), true);
+    }
+    if (bSkeletonOnly)
+    {
+        ResponseObj->SetBoolField(TEXT("skeleton_only"), true);
+    }
     
     // Add warnings if any
     if (Warnings.Num() > 0)
@@ -0,0 +1,219 @@
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "BlueprintCompilationManager.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/TokenizedMessage.h"
+#include "MCPErrorHandler.h"
+
+FCompileBlueprintsCommand::FCompileBlueprintsCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FCompileBlueprintsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FCompileBlueprintsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray;
+    if (!Params->TryGetArrayField(TEXT("blueprint_names"), NamesArray) || NamesArray->Num() == 0)
+    {
+        FMCPError ParseError = FMCPErrorHandler::CreateInvalidParametersError(TEXT("Missing required 'blueprint_names' array parameter"));
+        FMCPErrorHandler::LogError(ParseError);
+        Response.SetError(ParseError);
+        return;
+    }
+
+    TArray<UBlueprint*> Blueprints;
+    TArray<TSharedPtr<FJsonValue>> NotFound;
+    for (const TSharedPtr<FJsonValue>& NameValue : *NamesArray)
+    {
+        const FString BlueprintName = NameValue->AsString();
+        UBlueprint* Blueprint = BlueprintService.FindBlueprint(BlueprintName);
+        if (!Blueprint)
+        {
+            NotFound.Add(MakeShared<FJsonValueString>(BlueprintName));
+            continue;
+        }
+        Blueprints.AddUnique(Blueprint);
+    }
+
+    const TArray<UBlueprint*> Order = SortByDependencies(Blueprints);
+
+    // One queue flush compiles the whole set and reinstances once
+    const double StartTime = FPlatformTime::Seconds();
+    for (UBlueprint* Blueprint : Order)
+    {
+        FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+    }
+    FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    const double CompilationTime = FPlatformTime::Seconds() - StartTime;
+
+    TArray<TSharedPtr<FJsonValue>> OrderArray;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    int32 SuccessCount = 0;
+    for (UBlueprint* Blueprint : Order)
+    {
+        OrderArray.Add(MakeShared<FJsonValueString>(Blueprint->GetName()));
+
+        bool bSucceeded = true;
+        ResultsArray.Add(MakeShared<FJsonValueObject>(MakeResult(Blueprint, bSucceeded)));
+        if (bSucceeded)
+        {
+            SuccessCount++;
+        }
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("order"), OrderArray);
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetArrayField(TEXT("not_found"), NotFound);
+    ResponseObj->SetNumberField(TEXT("total"), Order.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SuccessCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Order.Num() - SuccessCount);
+    ResponseObj->SetNumberField(TEXT("compilation_time_seconds"), CompilationTime);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FCompileBlueprintsCommand::GetCommandName() const
+{
+    return TEXT("compile_blueprints");
+}
+
+bool FCompileBlueprintsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FCompileBlueprintsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray;
+    return Params->TryGetArrayField(TEXT("blueprint_names"), NamesArray) && NamesArray->Num() > 0;
+}
+
+TArray<UBlueprint*> FCompileBlueprintsCommand::SortByDependencies(const TArray<UBlueprint*>& Blueprints)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    TMap<FName, int32> PackageToIndex;
+    for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+    {
+        PackageToIndex.Add(Blueprints[Index]->GetPackage()->GetFName(), Index);
+    }
+
+    // Edges from each Blueprint to the Blueprints of the set it depends on
+    TArray<TArray<int32>> Dependencies;
+    Dependencies.SetNum(Blueprints.Num());
+    for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+    {
+        UBlueprint* Blueprint = Blueprints[Index];
+
+        TArray<FName> PackageDependencies;
+        AssetRegistry.GetDependencies(Blueprint->GetPackage()->GetFName(), PackageDependencies);
+        if (Blueprint->ParentClass && Blueprint->ParentClass->ClassGeneratedBy)
+        {
+            PackageDependencies.Add(Blueprint->ParentClass->ClassGeneratedBy->GetPackage()->GetFName());
+        }
+
+        for (const FName& PackageName : PackageDependencies)
+        {
+            const int32* DependencyIndex = PackageToIndex.Find(PackageName);
+            if (DependencyIndex && *DependencyIndex != Index)
+            {
+                Dependencies[Index].AddUnique(*DependencyIndex);
+            }
+        }
+    }
+
+    // Depth-first post-order; a Blueprint reached again while on the stack is a cycle and is
+    // simply not waited for
+    TArray<UBlueprint*> Order;
+    Order.Reserve(Blueprints.Num());
+    TArray<uint8> State;
+    State.SetNumZeroed(Blueprints.Num());
+
+    TFunction<void(int32)> Visit = [&](int32 Index)
+    {
+        if (State[Index] != 0)
+        {
+            return;
+        }
+        State[Index] = 1;
+        for (int32 Dependency : Dependencies[Index])
+        {
+            Visit(Dependency);
+        }
+        State[Index] = 2;
+        Order.Add(Blueprints[Index]);
+    };
+
+    for (int32 Index = 0; Index < Blueprints.Num(); ++Index)
+    {
+        Visit(Index);
+    }
+    return Order;
+}
+
+TSharedRef<FJsonObject> FCompileBlueprintsCommand::MakeResult(UBlueprint* Blueprint, bool& bOutSucceeded)
+{
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    TArray<TSharedPtr<FJsonValue>> Warnings;
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || !Node->bHasCompilerMessage)
+            {
+                continue;
+            }
+
+            const FString Message = FString::Printf(TEXT("%s in graph '%s': %s"),
+                *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Graph->GetName(), *Node->ErrorMsg);
+            if (Node->ErrorType <= EMessageSeverity::Error)
+            {
+                Errors.Add(MakeShared<FJsonValueString>(Message));
+            }
+            else
+            {
+                Warnings.Add(MakeShared<FJsonValueString>(Message));
+            }
+        }
+    }
+
+    bOutSucceeded = Blueprint->Status != BS_Error && Errors.Num() == 0;
+
+    TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+    ResultObj->SetBoolField(TEXT("success"), bOutSucceeded);
+    if (!bOutSucceeded)
+    {
+        ResultObj->SetStringField(TEXT("status"), TEXT("error"));
+        if (Errors.Num() == 0)
+        {
+            Errors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("Blueprint '%s' is in error state"), *Blueprint->GetName())));
+        }
+        ResultObj->SetArrayField(TEXT("compilation_errors"), Errors);
+    }
+    else
+    {
+        ResultObj->SetStringField(TEXT("status"), Warnings.Num() > 0 || Blueprint->Status == BS_UpToDateWithWarnings
+            ? TEXT("compiled with warnings") : TEXT("compiled successfully"));
+    }
+    if (Warnings.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("warnings"), Warnings);
+    }
+    return ResultObj;
+}
@@ -10,6 +10,7 @@
 #include "Engine/UserDefinedStruct.h"
 #include "UObject/StructOnScope.h"
 #include "Services/BlueprintService.h"
+#include "MCPBatchEditScope.h"
 
 FCreateCustomBlueprintFunctionCommand::FCreateCustomBlueprintFunctionCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -44,6 +45,24 @@ FString FCreateCustomBlueprintFunctionCommand::Execute(const FString& Parameters
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
     }
     
+    FString Error;
+    if (!CreateFunction(Blueprint, JsonObject.ToSharedRef(), false, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+    
+    return CreateSuccessResponse(BlueprintName, FunctionName);
+}
+
+bool FCreateCustomBlueprintFunctionCommand::CreateFunction(UBlueprint* Blueprint, const TSharedRef<FJsonObject>& JsonObject, bool bDeferStructuralUpdate, FString& OutError)
+{
+    FString FunctionName;
+    if (!JsonObject->TryGetStringField(TEXT("function_name"), FunctionName) || FunctionName.IsEmpty())
+    {
+        OutError = TEXT("Missing 'function_name' parameter");
+        return false;
+    }
+    
     // Get optional parameters
     bool bIsPure = false;
     JsonObject->TryGetBoolField(TEXT("is_pure"), bIsPure);
@@ -64,7 +83,8 @@ FString FCreateCustomBlueprintFunctionCommand::Execute(const FString& Parameters
 
     if (ExistingGraph)
     {
-        return CreateErrorResponse(FString::Printf(TEXT("Function '%s' already exists in Blueprint '%s'"), *FunctionName, *BlueprintName));
+        OutError = FString::Printf(TEXT("Function '%s' already exists in Blueprint '%s'"), *FunctionName, *Blueprint->GetName());
+        return false;
     }
 
     // CRITICAL: Check if a function with this name is defined by any implemented interface
@@ -80,10 +100,11 @@ FString FCreateCustomBlueprintFunctionCommand::Execute(const FString& Parameters
                 UFunction* InterfaceFunc = *FuncIt;
                 if (InterfaceFunc && InterfaceFunc->GetName() == FunctionName)
                 {
-                    return CreateErrorResponse(FString::Printf(
+                    OutError = FString::Printf(
                         TEXT("Cannot create function '%s' - a function with this name is already defined by interface '%s'. Use the interface's function graph instead."),
                         *FunctionName,
-                        *InterfaceDesc.Interface->GetName()));
+                        *InterfaceDesc.Interface->GetName());
+                    return false;
                 }
             }
         }
@@ -99,7 +120,8 @@ FString FCreateCustomBlueprintFunctionCommand::Execute(const FString& Parameters
     
     if (!FuncGraph)
     {
-        return CreateErrorResponse(TEXT("Failed to create function graph"));
+        OutError = TEXT("Failed to create function graph");
+        return false;
     }
     
     // Use the proper method to add a user-defined function (like the Blueprint editor does)
@@ -258,18 +280,23 @@ FString FCreateCustomBlueprintFunctionCommand::Execute(const FString& Parameters
     EntryNode->ReconstructNode();
     
     // Force refresh the graph
-    FuncGraph->NotifyGraphChanged();
+    FMCPBatchEditScope::NotifyGraphChanged(FuncGraph);
     
     // CRITICAL: Reconstruct and refresh the function to ensure proper setup
     EntryNode->ReconstructNode();
     
+    if (bDeferStructuralUpdate)
+    {
+        return true;
+    }
+    
     // Force the Blueprint to recognize this as a user-defined function
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
     
     // Refresh the Blueprint to ensure the function is properly integrated
     FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
     
-    return CreateSuccessResponse(BlueprintName, FunctionName);
+    return true;
 }
 
 FString FCreateCustomBlueprintFunctionCommand::GetCommandName() const
@@ -5,6 +5,7 @@
 #include "Serialization/JsonWriter.h"
 #include "Engine/Blueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "MCPBatchEditScope.h"
 
 FDeleteBlueprintVariableCommand::FDeleteBlueprintVariableCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -63,7 +64,7 @@ FString FDeleteBlueprintVariableCommand::Execute(const FString& Parameters)
     FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, VarFName);
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     UE_LOG(LogTemp, Log, TEXT("DeleteBlueprintVariable: Successfully deleted variable '%s' from Blueprint '%s'"),
         *VariableName, *BlueprintName);
@@ -0,0 +1,113 @@
+#include "Commands/Blueprint/GetBlueprintChangesSinceCommand.h"
+#include "Services/BlueprintChangeJournal.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Engine/Blueprint.h"
+
+FGetBlueprintChangesSinceCommand::FGetBlueprintChangesSinceCommand(IBlueprintService& InBlueprintService)
+    : BlueprintService(InBlueprintService)
+{
+}
+
+FString FGetBlueprintChangesSinceCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FString BlueprintName;
+    if (!JsonObject->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    int32 SinceRevision = 0;
+    JsonObject->TryGetNumberField(TEXT("since_revision"), SinceRevision);
+
+    UBlueprint* Blueprint = BlueprintService.FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+    }
+
+    TArray<FBlueprintChangeJournal::FChange> Changes;
+    int32 Revision = 0;
+    bool bTruncated = false;
+    FBlueprintChangeJournal::Get().GetChangesSince(Blueprint, SinceRevision, Changes, Revision, bTruncated);
+
+    TArray<TSharedPtr<FJsonValue>> ChangesArray;
+    for (const FBlueprintChangeJournal::FChange& Change : Changes)
+    {
+        TSharedPtr<FJsonObject> ChangeObj = MakeShared<FJsonObject>();
+        ChangeObj->SetNumberField(TEXT("revision"), Change.Revision);
+        ChangeObj->SetStringField(TEXT("source"), Change.Source);
+        ChangeObj->SetStringField(TEXT("action"), Change.Action);
+        ChangeObj->SetStringField(TEXT("type"), Change.Type);
+        ChangeObj->SetStringField(TEXT("id"), Change.Id);
+        ChangeObj->SetStringField(TEXT("name"), Change.Name);
+        if (!Change.Graph.IsEmpty())
+        {
+            ChangeObj->SetStringField(TEXT("graph"), Change.Graph);
+        }
+        if (Change.Changed.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> ChangedArray;
+            for (const FString& Field : Change.Changed)
+            {
+                ChangedArray.Add(MakeShared<FJsonValueString>(Field));
+            }
+            ChangeObj->SetArrayField(TEXT("changed"), ChangedArray);
+        }
+        ChangesArray.Add(MakeShared<FJsonValueObject>(ChangeObj));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+    ResponseObj->SetNumberField(TEXT("since_revision"), SinceRevision);
+    ResponseObj->SetNumberField(TEXT("revision"), Revision);
+    ResponseObj->SetBoolField(TEXT("truncated"), bTruncated);
+    ResponseObj->SetArrayField(TEXT("changes"), ChangesArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FGetBlueprintChangesSinceCommand::GetCommandName() const
+{
+    return TEXT("get_blueprint_changes_since");
+}
+
+bool FGetBlueprintChangesSinceCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    return JsonObject->HasField(TEXT("blueprint_name"));
+}
+
+FString FGetBlueprintChangesSinceCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
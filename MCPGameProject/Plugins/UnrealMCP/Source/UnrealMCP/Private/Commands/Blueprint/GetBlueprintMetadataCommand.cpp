@@ -14,11 +14,11 @@ FGetBlueprintMetadataCommand::FGetBlueprintMetadataCommand(IBlueprintService& In
 FString FGetBlueprintMetadataCommand::Execute(const FString& Parameters)
 {
     FString BlueprintName;
-    TArray<FString> Fields;
+    FMetadataFieldSelection Selection;
     FGraphNodesFilter Filter;
     FString ParseError;
 
-    if (!ParseParameters(Parameters, BlueprintName, Fields, Filter, ParseError))
+    if (!ParseParameters(Parameters, BlueprintName, Selection, Filter, ParseError))
     {
         return CreateErrorResponse(ParseError);
     }
@@ -29,8 +29,8 @@ FString FGetBlueprintMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Blueprint '%s' not found"), *BlueprintName));
     }
 
-    TSharedPtr<FJsonObject> Metadata = BuildMetadata(Blueprint, Fields, Filter);
-    return CreateSuccessResponse(Metadata);
+    TSharedPtr<FJsonObject> Metadata = BuildMetadata(Blueprint, Selection, Filter);
+    return CreateSuccessResponse(Metadata, Selection);
 }
 
 FString FGetBlueprintMetadataCommand::GetCommandName() const
@@ -55,7 +55,7 @@ bool FGetBlueprintMetadataCommand::ValidateParams(const FString& Parameters) con
     return JsonObject->TryGetStringField(TEXT("blueprint_name"), BlueprintName);
 }
 
-bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, TArray<FString>& OutFields, FGraphNodesFilter& OutFilter, FString& OutError) const
+bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FString& OutBlueprintName, FMetadataFieldSelection& OutSelection, FGraphNodesFilter& OutFilter, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -76,10 +76,12 @@ bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FS
     const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
     if (JsonObject->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray->Num() > 0)
     {
+        TArray<FString> Fields;
         for (const TSharedPtr<FJsonValue>& Value : *FieldsArray)
         {
-            OutFields.Add(Value->AsString());
+            Fields.Add(Value->AsString());
         }
+        ResolveFields(Fields, OutSelection);
     }
     else
     {
@@ -87,11 +89,33 @@ bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FS
         return false;
     }
 
+    if (OutSelection.Sections.Num() == 0)
+    {
+        TArray<FString> SectionNames;
+        for (const FMetadataSectionInfo& Section : FBlueprintMetadataBuilderService::GetSections())
+        {
+            SectionNames.Add(Section.Name);
+        }
+        OutError = FString::Printf(TEXT("No known field in 'fields' (%s). Valid fields: %s, or \"*\""),
+            *FString::Join(OutSelection.UnknownFields, TEXT(", ")), *FString::Join(SectionNames, TEXT(", ")));
+        return false;
+    }
+
     // Parse optional filters for graph_nodes field
     JsonObject->TryGetStringField(TEXT("graph_name"), OutFilter.GraphName);
     JsonObject->TryGetStringField(TEXT("node_type"), OutFilter.NodeType);
     JsonObject->TryGetStringField(TEXT("event_type"), OutFilter.EventType);
     JsonObject->TryGetStringField(TEXT("component_name"), OutFilter.ComponentName);
+    JsonObject->TryGetStringField(TEXT("cursor"), OutFilter.Cursor);
+    JsonObject->TryGetBoolField(TEXT("compact_pins"), OutFilter.bCompactPins);
+    JsonObject->TryGetStringField(TEXT("if_graph_hash"), OutFilter.IfGraphHash);
+
+    // Parse max_nodes (default: every node)
+    if (JsonObject->TryGetNumberField(TEXT("max_nodes"), OutFilter.MaxNodes) && OutFilter.MaxNodes < 0)
+    {
+        OutError = TEXT("max_nodes must be 0 (no limit) or positive");
+        return false;
+    }
 
     // Parse detail_level (default: flow)
     FString DetailLevelStr;
@@ -115,14 +139,14 @@ bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FS
     // else keep default (Flow)
 
     // Validate: graph_nodes requires graph_name to be specified
-    if (OutFields.Contains(TEXT("graph_nodes")) && OutFilter.GraphName.IsEmpty())
+    if (OutSelection.Sections.Contains(TEXT("graph_nodes")) && OutFilter.GraphName.IsEmpty())
     {
         OutError = TEXT("When requesting 'graph_nodes' field, 'graph_name' parameter is required to limit response size");
         return false;
     }
 
     // Validate: component_properties requires component_name to be specified
-    if (OutFields.Contains(TEXT("component_properties")) && OutFilter.ComponentName.IsEmpty())
+    if (OutSelection.Sections.Contains(TEXT("component_properties")) && OutFilter.ComponentName.IsEmpty())
     {
         OutError = TEXT("When requesting 'component_properties' field, 'component_name' parameter is required");
         return false;
@@ -131,6 +155,64 @@ bool FGetBlueprintMetadataCommand::ParseParameters(const FString& JsonString, FS
     return true;
 }
 
+void FGetBlueprintMetadataCommand::ResolveFields(const TArray<FString>& Fields, FMetadataFieldSelection& OutSelection)
+{
+    bool bAllSections = false;
+    TSet<FString> WholeSections;
+
+    for (const FString& Field : Fields)
+    {
+        if (Field == TEXT("*"))
+        {
+            bAllSections = true;
+            continue;
+        }
+
+        FString SectionName = Field;
+        FString Key;
+        Field.Split(TEXT("."), &SectionName, &Key);
+
+        const FMetadataSectionInfo* Section = FBlueprintMetadataBuilderService::FindSection(SectionName);
+        if (!Section)
+        {
+            OutSelection.UnknownFields.Add(Field);
+            continue;
+        }
+
+        OutSelection.Sections.AddUnique(Section->Name);
+        if (Key.IsEmpty())
+        {
+            WholeSections.Add(Section->Name);
+        }
+        else
+        {
+            OutSelection.Projections.FindOrAdd(Section->Name).AddUnique(Key);
+        }
+    }
+
+    if (bAllSections)
+    {
+        for (const FMetadataSectionInfo& Section : FBlueprintMetadataBuilderService::GetSections())
+        {
+            if (Section.Cost != EMetadataSectionCost::Expensive)
+            {
+                OutSelection.Sections.AddUnique(Section.Name);
+                WholeSections.Add(Section.Name);
+            }
+            else if (!OutSelection.Sections.Contains(Section.Name))
+            {
+                OutSelection.OmittedSections.Add(Section.Name);
+            }
+        }
+    }
+
+    // A section also requested whole keeps every key
+    for (const FString& SectionName : WholeSections)
+    {
+        OutSelection.Projections.Remove(SectionName);
+    }
+}
+
 UBlueprint* FGetBlueprintMetadataCommand::FindBlueprint(const FString& BlueprintName) const
 {
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -164,76 +246,100 @@ UBlueprint* FGetBlueprintMetadataCommand::FindBlueprint(const FString& Blueprint
     return nullptr;
 }
 
-TSharedPtr<FJsonObject> FGetBlueprintMetadataCommand::BuildMetadata(UBlueprint* Blueprint, const TArray<FString>& Fields, const FGraphNodesFilter& Filter) const
+TSharedPtr<FJsonObject> FGetBlueprintMetadataCommand::BuildMetadata(UBlueprint* Blueprint, const FMetadataFieldSelection& Selection, const FGraphNodesFilter& Filter) const
 {
     TSharedPtr<FJsonObject> Metadata = MakeShared<FJsonObject>();
 
-    if (ShouldIncludeField(TEXT("parent_class"), Fields))
+    if (ShouldIncludeField(TEXT("parent_class"), Selection))
     {
         Metadata->SetObjectField(TEXT("parent_class"), MetadataBuilder.BuildParentClassInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("interfaces"), Fields))
+    if (ShouldIncludeField(TEXT("interfaces"), Selection))
     {
         Metadata->SetObjectField(TEXT("interfaces"), MetadataBuilder.BuildInterfacesInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("variables"), Fields))
+    if (ShouldIncludeField(TEXT("variables"), Selection))
     {
         Metadata->SetObjectField(TEXT("variables"), MetadataBuilder.BuildVariablesInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("functions"), Fields))
+    if (ShouldIncludeField(TEXT("functions"), Selection))
     {
         Metadata->SetObjectField(TEXT("functions"), MetadataBuilder.BuildFunctionsInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("components"), Fields))
+    if (ShouldIncludeField(TEXT("components"), Selection))
     {
         Metadata->SetObjectField(TEXT("components"), MetadataBuilder.BuildComponentsInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("component_properties"), Fields))
+    if (ShouldIncludeField(TEXT("component_properties"), Selection))
     {
         Metadata->SetObjectField(TEXT("component_properties"), MetadataBuilder.BuildComponentPropertiesInfo(Blueprint, Filter.ComponentName));
     }
-    if (ShouldIncludeField(TEXT("graphs"), Fields))
+    if (ShouldIncludeField(TEXT("graphs"), Selection))
     {
         Metadata->SetObjectField(TEXT("graphs"), MetadataBuilder.BuildGraphsInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("status"), Fields))
+    if (ShouldIncludeField(TEXT("status"), Selection))
     {
         Metadata->SetObjectField(TEXT("status"), MetadataBuilder.BuildStatusInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("metadata"), Fields))
+    if (ShouldIncludeField(TEXT("metadata"), Selection))
     {
         Metadata->SetObjectField(TEXT("metadata"), MetadataBuilder.BuildMetadataInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("timelines"), Fields))
+    if (ShouldIncludeField(TEXT("timelines"), Selection))
     {
         Metadata->SetObjectField(TEXT("timelines"), MetadataBuilder.BuildTimelinesInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("asset_info"), Fields))
+    if (ShouldIncludeField(TEXT("asset_info"), Selection))
     {
         Metadata->SetObjectField(TEXT("asset_info"), MetadataBuilder.BuildAssetInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("orphaned_nodes"), Fields))
+    if (ShouldIncludeField(TEXT("orphaned_nodes"), Selection))
     {
         Metadata->SetObjectField(TEXT("orphaned_nodes"), MetadataBuilder.BuildOrphanedNodesInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("graph_warnings"), Fields))
+    if (ShouldIncludeField(TEXT("graph_warnings"), Selection))
     {
         Metadata->SetObjectField(TEXT("graph_warnings"), MetadataBuilder.BuildGraphWarningsInfo(Blueprint));
     }
-    if (ShouldIncludeField(TEXT("graph_nodes"), Fields))
+    if (ShouldIncludeField(TEXT("graph_nodes"), Selection))
     {
         Metadata->SetObjectField(TEXT("graph_nodes"), MetadataBuilder.BuildGraphNodesInfo(Blueprint, Filter));
     }
 
+    for (const TPair<FString, TArray<FString>>& Projection : Selection.Projections)
+    {
+        const TSharedPtr<FJsonObject>* Section = nullptr;
+        if (Metadata->TryGetObjectField(Projection.Key, Section))
+        {
+            FBlueprintMetadataBuilderService::ProjectSection(*Section, Projection.Value);
+        }
+    }
+
     return Metadata;
 }
 
-FString FGetBlueprintMetadataCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const
+FString FGetBlueprintMetadataCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata, const FMetadataFieldSelection& Selection) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
 
+    auto SetStringArray = [&ResponseObj](const TCHAR* FieldName, const TArray<FString>& Values)
+    {
+        if (Values.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> ValuesArray;
+            for (const FString& Value : Values)
+            {
+                ValuesArray.Add(MakeShared<FJsonValueString>(Value));
+            }
+            ResponseObj->SetArrayField(FieldName, ValuesArray);
+        }
+    };
+    SetStringArray(TEXT("omitted_sections"), Selection.OmittedSections);
+    SetStringArray(TEXT("unknown_fields"), Selection.UnknownFields);
+
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
     FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
@@ -254,13 +360,7 @@ FString FGetBlueprintMetadataCommand::CreateErrorResponse(const FString& ErrorMe
     return OutputString;
 }
 
-bool FGetBlueprintMetadataCommand::ShouldIncludeField(const FString& FieldName, const TArray<FString>& RequestedFields) const
+bool FGetBlueprintMetadataCommand::ShouldIncludeField(const FString& FieldName, const FMetadataFieldSelection& Selection) const
 {
-    // If "*" is in the list, include all fields
-    if (RequestedFields.Contains(TEXT("*")))
-    {
-        return true;
-    }
-
-    return RequestedFields.Contains(FieldName);
+    return Selection.Sections.Contains(FieldName);
 }
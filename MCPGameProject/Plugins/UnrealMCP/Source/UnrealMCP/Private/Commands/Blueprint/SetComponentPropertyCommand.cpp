@@ -8,8 +8,7 @@
 #include "Engine/SCS_Node.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/Actor.h"
-#include "SubobjectDataSubsystem.h"
-#include "SubobjectData.h"
+#include "Services/BlueprintComponentLookupCache.h"
 #include "Engine/Engine.h"
 #include "MCPLogging.h"
 
@@ -155,64 +154,8 @@ bool FSetComponentPropertyCommand::SetComponentProperties(UBlueprint* Blueprint,
                                                          TMap<FString, FString>& OutFailedProperties,
                                                          TArray<FString>& OutAvailableProperties) const
 {
-    // Use USubobjectDataSubsystem to find component (UE 5.7+ API)
-    USubobjectDataSubsystem* SubobjectSubsystem = GEngine->GetEngineSubsystem<USubobjectDataSubsystem>();
-    if (!SubobjectSubsystem)
-    {
-        OutFailedProperties.Add(TEXT("subsystem"), TEXT("Failed to get SubobjectDataSubsystem"));
-        UE_LOG(LogUnrealMCP, Error, TEXT("Failed to get SubobjectDataSubsystem"));
-        return false;
-    }
-
-    // Gather all subobjects for this Blueprint
-    TArray<FSubobjectDataHandle> SubobjectHandles;
-    SubobjectSubsystem->K2_GatherSubobjectDataForBlueprint(Blueprint, SubobjectHandles);
-    
-    UE_LOG(LogUnrealMCP, Warning, TEXT("=== SetComponentProperty DEBUG ==="));
-    UE_LOG(LogUnrealMCP, Warning, TEXT("Looking for component '%s' in Blueprint '%s', found %d subobjects"), 
-        *ComponentName, *Blueprint->GetName(), SubobjectHandles.Num());
-
-    // Find the component by name
-    UObject* ComponentTemplate = nullptr;
-    for (const FSubobjectDataHandle& Handle : SubobjectHandles)
-    {
-        const FSubobjectData* Data = Handle.GetData();
-        if (Data)
-        {
-            FName VarName = Data->GetVariableName();
-            UObject* Obj = const_cast<UObject*>(Data->GetObject());
-            UE_LOG(LogUnrealMCP, Warning, TEXT("  Subobject: Name='%s', Class='%s'"), 
-                *VarName.ToString(), 
-                Obj ? *Obj->GetClass()->GetName() : TEXT("NULL"));
-            
-            if (VarName == FName(*ComponentName))
-            {
-                ComponentTemplate = Obj;
-                UE_LOG(LogUnrealMCP, Warning, TEXT("  âœ“ FOUND MATCH: '%s'"), *ComponentName);
-                break;
-            }
-        }
-    }
-    
-    // If not found in subobjects, check inherited components on CDO
-    if (!ComponentTemplate)
-    {
-        UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
-        AActor* DefaultActor = Cast<AActor>(DefaultObject);
-        if (DefaultActor)
-        {
-            TArray<UActorComponent*> AllComponents;
-            DefaultActor->GetComponents(AllComponents);
-            for (UActorComponent* Comp : AllComponents)
-            {
-                if (Comp && Comp->GetName() == ComponentName)
-                {
-                    ComponentTemplate = Comp;
-                    break;
-                }
-            }
-        }
-    }
+    // Construction script nodes first, then inherited and native components
+    UObject* ComponentTemplate = FBlueprintComponentLookupCache::Get().FindTemplate(Blueprint, ComponentName);
     
     if (!ComponentTemplate)
     {
@@ -256,16 +199,6 @@ bool FSetComponentPropertyCommand::SetComponentProperties(UBlueprint* Blueprint,
         }
     }
 
-    // Build list of available properties once for error reporting
-    for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
-    {
-        FProperty* Prop = *PropIt;
-        if (Prop && (Prop->HasAnyPropertyFlags(CPF_Edit) || Prop->HasAnyPropertyFlags(CPF_BlueprintVisible)))
-        {
-            OutAvailableProperties.Add(Prop->GetName());
-        }
-    }
-    
     // Iterate through all properties to set
     TArray<FString> PropertyNames;
     Properties->Values.GetKeys(PropertyNames);
@@ -301,9 +234,8 @@ bool FSetComponentPropertyCommand::SetComponentProperties(UBlueprint* Blueprint,
 
         bool bIsCollisionProperty = CollisionProperties.Contains(PropertyName);
 
-        // Find the property on the component (unless it's a collision property)
-        FProperty* Property = FindFProperty<FProperty>(ComponentTemplate->GetClass(), *PropertyName);
-        if (!Property && !bIsCollisionProperty)
+        // Find the property on the component (unless it's a collision property); resolved once per class
+        if (!bIsCollisionProperty && !FPropertyService::Get().HasProperty(ComponentTemplate, PropertyName))
         {
             FString ErrorMsg = FString::Printf(
                 TEXT("Property '%s' not found on component '%s' (Class: %s)"),
@@ -336,6 +268,19 @@ bool FSetComponentPropertyCommand::SetComponentProperties(UBlueprint* Blueprint,
             UE_LOG(LogUnrealMCP, Warning, TEXT("  âœ— %s"), *ErrorMsg);
         }
     }
+
+    // List the available properties for error reporting only when something failed
+    if (OutFailedProperties.Num() > 0)
+    {
+        for (TFieldIterator<FProperty> PropIt(ComponentTemplate->GetClass()); PropIt; ++PropIt)
+        {
+            FProperty* Prop = *PropIt;
+            if (Prop && (Prop->HasAnyPropertyFlags(CPF_Edit) || Prop->HasAnyPropertyFlags(CPF_BlueprintVisible)))
+            {
+                OutAvailableProperties.Add(Prop->GetName());
+            }
+        }
+    }
     
     return OutSuccessProperties.Num() > 0;
 }
@@ -451,25 +396,10 @@ bool FSetComponentPropertyCommand::BindComponentEvents(UBlueprint* Blueprint, co
 
     if (!ComponentClass)
     {
-        // Try to find it from subobjects
-        USubobjectDataSubsystem* SubobjectSubsystem = GEngine->GetEngineSubsystem<USubobjectDataSubsystem>();
-        if (SubobjectSubsystem)
+        // Not compiled into the class yet; take it from the component template
+        if (const UActorComponent* ComponentTemplate = FBlueprintComponentLookupCache::Get().FindTemplate(Blueprint, ComponentName))
         {
-            TArray<FSubobjectDataHandle> SubobjectHandles;
-            SubobjectSubsystem->K2_GatherSubobjectDataForBlueprint(Blueprint, SubobjectHandles);
-            for (const FSubobjectDataHandle& Handle : SubobjectHandles)
-            {
-                const FSubobjectData* Data = Handle.GetData();
-                if (Data && Data->GetVariableName() == FName(*ComponentName))
-                {
-                    const UObject* Obj = Data->GetObject();
-                    if (Obj)
-                    {
-                        ComponentClass = Obj->GetClass();
-                        break;
-                    }
-                }
-            }
+            ComponentClass = ComponentTemplate->GetClass();
         }
     }
 
@@ -1,23 +1,9 @@
 #include "Commands/BlueprintAction/FindInBlueprintsCommand.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonReader.h"
-#include "Serialization/JsonWriter.h"
 #include "Engine/Blueprint.h"
-#include "WidgetBlueprint.h"
-#include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphNode.h"
-#include "K2Node_Event.h"
-#include "K2Node_CustomEvent.h"
-#include "K2Node_CallFunction.h"
-#include "K2Node_VariableGet.h"
-#include "K2Node_VariableSet.h"
-#include "K2Node_FunctionEntry.h"
-#include "EdGraphSchema_K2.h"
-#include "AssetRegistry/AssetRegistryModule.h"
+#include "MCPAsyncAssetLoader.h"
 #include "Services/AssetDiscoveryService.h"
-#include "Utils/GraphUtils.h"
 
 FFindInBlueprintsCommand::FFindInBlueprintsCommand(TSharedPtr<IBlueprintActionService> InBlueprintActionService)
 	: BlueprintActionService(InBlueprintActionService)
@@ -25,6 +11,11 @@ FFindInBlueprintsCommand::FFindInBlueprintsCommand(TSharedPtr<IBlueprintActionSe
 }
 
 FString FFindInBlueprintsCommand::Execute(const FString& Parameters)
+{
+	return ExecuteFromString(Parameters);
+}
+
+void FFindInBlueprintsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
 {
 	FString SearchQuery;
 	EBlueprintSearchType SearchType;
@@ -33,36 +24,61 @@ FString FFindInBlueprintsCommand::Execute(const FString& Parameters)
 	bool bCaseSensitive;
 	FString ParseError;
 
-	if (!ParseParameters(Parameters, SearchQuery, SearchType, Path, MaxResults, bCaseSensitive, ParseError))
+	if (!ParseParameters(Params, SearchQuery, SearchType, Path, MaxResults, bCaseSensitive, ParseError))
 	{
-		return CreateErrorResponse(ParseError);
+		Response.SetError(ParseError);
+		return;
 	}
 
 	// Find all blueprints in the specified path
 	TArray<FString> BlueprintPaths = FAssetDiscoveryService::Get().FindBlueprints(TEXT(""), Path);
 
-	TArray<FBlueprintSearchMatch> AllMatches;
+	TArray<TSharedPtr<FJsonValue>> MatchesArray;
+	TArray<TSharedPtr<FJsonValue>> GroupedArray;
+	int32 MatchCount = 0;
 	int32 BlueprintsSearched = 0;
+	int32 BlueprintsLoaded = 0;
 
+	// Search what is indexed or loaded first; the blueprints that have to be loaded are searched after
+	TArray<FSoftObjectPath> UnindexedPaths;
 	for (const FString& BPPath : BlueprintPaths)
 	{
-		// Load the blueprint
-		UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BPPath);
-		if (!Blueprint)
+		if (MatchCount >= MaxResults)
+		{
+			break;
+		}
+
+		const FBlueprintSearchIndex::FPackageEntry* Entry = FBlueprintSearchIndex::Get().FindWithoutLoading(BPPath);
+		if (!Entry)
 		{
+			UnindexedPaths.Emplace(BPPath);
 			continue;
 		}
 
 		BlueprintsSearched++;
 
-		// Search this blueprint
-		SearchBlueprint(Blueprint, SearchQuery, SearchType, bCaseSensitive, AllMatches, MaxResults);
+		// Search this blueprint for no more than the matches still wanted
+		MatchCount += SearchBlueprint(*Entry, SearchQuery, SearchType, bCaseSensitive, MaxResults - MatchCount, MatchesArray, GroupedArray);
+	}
 
-		// Stop if we have enough results
-		if (AllMatches.Num() >= MaxResults)
-		{
-			break;
-		}
+	// Stop as soon as we have enough results; the remaining blueprints are not loaded
+	if (MatchCount < MaxResults && UnindexedPaths.Num() > 0)
+	{
+		const FMCPAsyncAssetLoader::FStats LoadStats = FMCPAsyncAssetLoader::LoadEach(UnindexedPaths,
+			[&](int32 Index, UObject* Asset)
+			{
+				UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+				if (!Blueprint)
+				{
+					return true;
+				}
+
+				BlueprintsSearched++;
+				const FBlueprintSearchIndex::FPackageEntry& Entry = FBlueprintSearchIndex::Get().FindOrIndex(Blueprint);
+				MatchCount += SearchBlueprint(Entry, SearchQuery, SearchType, bCaseSensitive, MaxResults - MatchCount, MatchesArray, GroupedArray);
+				return MatchCount < MaxResults;
+			});
+		BlueprintsLoaded = LoadStats.Loaded;
 	}
 
 	// Convert search type to string for response
@@ -77,7 +93,17 @@ FString FFindInBlueprintsCommand::Execute(const FString& Parameters)
 		default: SearchTypeStr = TEXT("all"); break;
 	}
 
-	return CreateSuccessResponse(AllMatches, SearchQuery, SearchTypeStr, BlueprintsSearched);
+	TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+	ResponseObj->SetBoolField(TEXT("success"), true);
+	ResponseObj->SetStringField(TEXT("search_query"), SearchQuery);
+	ResponseObj->SetStringField(TEXT("search_type"), SearchTypeStr);
+	ResponseObj->SetNumberField(TEXT("blueprints_searched"), BlueprintsSearched);
+	ResponseObj->SetNumberField(TEXT("blueprints_loaded"), BlueprintsLoaded);
+	ResponseObj->SetNumberField(TEXT("match_count"), MatchCount);
+	ResponseObj->SetBoolField(TEXT("truncated"), MatchCount >= MaxResults);
+	ResponseObj->SetArrayField(TEXT("matches"), MatchesArray);
+	ResponseObj->SetArrayField(TEXT("by_blueprint"), GroupedArray);
+	Response.SetResult(ResponseObj);
 }
 
 FString FFindInBlueprintsCommand::GetCommandName() const
@@ -87,21 +113,18 @@ FString FFindInBlueprintsCommand::GetCommandName() const
 
 bool FFindInBlueprintsCommand::ValidateParams(const FString& Parameters) const
 {
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-	{
-		return false;
-	}
+	return ValidateParamsFromString(Parameters);
+}
 
+bool FFindInBlueprintsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
 	// Check required parameter
 	FString SearchQuery;
-	return JsonObject->TryGetStringField(TEXT("search_query"), SearchQuery) && !SearchQuery.IsEmpty();
+	return Params->TryGetStringField(TEXT("search_query"), SearchQuery) && !SearchQuery.IsEmpty();
 }
 
 bool FFindInBlueprintsCommand::ParseParameters(
-	const FString& Parameters,
+	const TSharedRef<FJsonObject>& Params,
 	FString& OutSearchQuery,
 	EBlueprintSearchType& OutSearchType,
 	FString& OutPath,
@@ -109,17 +132,8 @@ bool FFindInBlueprintsCommand::ParseParameters(
 	bool& OutCaseSensitive,
 	FString& OutError) const
 {
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-	{
-		OutError = TEXT("Invalid JSON parameters");
-		return false;
-	}
-
 	// Parse required parameter
-	OutSearchQuery = JsonObject->GetStringField(TEXT("search_query"));
+	Params->TryGetStringField(TEXT("search_query"), OutSearchQuery);
 	if (OutSearchQuery.IsEmpty())
 	{
 		OutError = TEXT("search_query is required and cannot be empty");
@@ -127,24 +141,19 @@ bool FFindInBlueprintsCommand::ParseParameters(
 	}
 
 	// Parse optional parameters
-	FString SearchTypeStr = JsonObject->GetStringField(TEXT("search_type"));
+	FString SearchTypeStr;
+	Params->TryGetStringField(TEXT("search_type"), SearchTypeStr);
 	OutSearchType = ParseSearchType(SearchTypeStr);
 
-	OutPath = JsonObject->GetStringField(TEXT("path"));
+	Params->TryGetStringField(TEXT("path"), OutPath);
 	if (OutPath.IsEmpty())
 	{
 		OutPath = TEXT("/Game");
 	}
 
 	// Parse max_results with default value
-	if (JsonObject->HasField(TEXT("max_results")))
-	{
-		OutMaxResults = JsonObject->GetIntegerField(TEXT("max_results"));
-	}
-	else
-	{
-		OutMaxResults = 50; // Default value
-	}
+	OutMaxResults = 50;
+	Params->TryGetNumberField(TEXT("max_results"), OutMaxResults);
 
 	// Validate max_results
 	if (OutMaxResults <= 0 || OutMaxResults > 500)
@@ -155,10 +164,7 @@ bool FFindInBlueprintsCommand::ParseParameters(
 
 	// Parse case_sensitive with default false
 	OutCaseSensitive = false;
-	if (JsonObject->HasField(TEXT("case_sensitive")))
-	{
-		OutCaseSensitive = JsonObject->GetBoolField(TEXT("case_sensitive"));
-	}
+	Params->TryGetBoolField(TEXT("case_sensitive"), OutCaseSensitive);
 
 	return true;
 }
@@ -193,285 +199,95 @@ EBlueprintSearchType FFindInBlueprintsCommand::ParseSearchType(const FString& Ty
 	return EBlueprintSearchType::All;
 }
 
-void FFindInBlueprintsCommand::SearchBlueprint(
-	UBlueprint* Blueprint,
+int32 FFindInBlueprintsCommand::SearchBlueprint(
+	const FBlueprintSearchIndex::FPackageEntry& Entry,
 	const FString& SearchQuery,
 	EBlueprintSearchType SearchType,
 	bool bCaseSensitive,
-	TArray<FBlueprintSearchMatch>& OutMatches,
-	int32 MaxResults) const
+	int32 MaxMatches,
+	TArray<TSharedPtr<FJsonValue>>& OutMatches,
+	TArray<TSharedPtr<FJsonValue>>& OutGroups) const
 {
-	if (!Blueprint)
-	{
-		return;
-	}
-
-	// Collect all graphs
-	TArray<UEdGraph*> AllGraphs;
-	Blueprint->GetAllGraphs(AllGraphs);
+	const ESearchCase::Type SearchCase = bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
+	TArray<TSharedPtr<FJsonValue>> NodeMatches;
 
-	for (UEdGraph* Graph : AllGraphs)
+	for (const FBlueprintSearchIndex::FNode& Node : Entry.Nodes)
 	{
-		if (!Graph)
+		// Check max results
+		if (NodeMatches.Num() >= MaxMatches)
 		{
-			continue;
-		}
-
-		for (UEdGraphNode* Node : Graph->Nodes)
-		{
-			if (!Node)
-			{
-				continue;
-			}
-
-			// Check max results
-			if (OutMatches.Num() >= MaxResults)
-			{
-				return;
-			}
-
-			FString MatchContext;
-			if (MatchesSearchCriteria(Node, SearchQuery, SearchType, bCaseSensitive, MatchContext))
-			{
-				FBlueprintSearchMatch Match;
-				Match.BlueprintPath = Blueprint->GetPathName();
-				Match.BlueprintName = Blueprint->GetName();
-				Match.GraphName = Graph->GetName();
-				Match.NodeId = FGraphUtils::GetReliableNodeId(Node);
-				Match.NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-				Match.NodeClass = Node->GetClass()->GetName();
-				Match.MatchContext = MatchContext;
-
-				OutMatches.Add(Match);
-			}
+			break;
 		}
-	}
-}
 
-bool FFindInBlueprintsCommand::MatchesSearchCriteria(
-	UEdGraphNode* Node,
-	const FString& SearchQuery,
-	EBlueprintSearchType SearchType,
-	bool bCaseSensitive,
-	FString& OutMatchContext) const
-{
-	if (!Node)
-	{
-		return false;
-	}
-
-	// First check if node type matches the filter
-	if (!MatchesNodeTypeFilter(Node, SearchType))
-	{
-		return false;
-	}
-
-	// Get searchable strings from the node
-	TArray<FString> SearchableStrings;
-
-	// Node title
-	FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-	SearchableStrings.Add(NodeTitle);
-
-	// Full title
-	FString FullTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
-	if (FullTitle != NodeTitle)
-	{
-		SearchableStrings.Add(FullTitle);
-	}
-
-	// For function calls, get the function name
-	if (UK2Node_CallFunction* CallFunc = Cast<UK2Node_CallFunction>(Node))
-	{
-		FName FuncName = CallFunc->FunctionReference.GetMemberName();
-		if (!FuncName.IsNone())
+		if (!MatchesNodeTypeFilter(Node.Kinds, SearchType))
 		{
-			SearchableStrings.Add(FuncName.ToString());
+			continue;
 		}
-	}
 
-	// For variable nodes, get the variable name
-	if (UK2Node_VariableGet* VarGet = Cast<UK2Node_VariableGet>(Node))
-	{
-		FName VarName = VarGet->VariableReference.GetMemberName();
-		if (!VarName.IsNone())
+		const FString* MatchedString = Node.SearchableStrings.FindByPredicate([&SearchQuery, SearchCase](const FString& Searchable)
 		{
-			SearchableStrings.Add(VarName.ToString());
-		}
-	}
-	else if (UK2Node_VariableSet* VarSet = Cast<UK2Node_VariableSet>(Node))
-	{
-		FName VarName = VarSet->VariableReference.GetMemberName();
-		if (!VarName.IsNone())
+			return Searchable.Contains(SearchQuery, SearchCase);
+		});
+		if (!MatchedString)
 		{
-			SearchableStrings.Add(VarName.ToString());
-		}
-	}
-
-	// For events, get the event name
-	if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
-	{
-		FName EventName = EventNode->GetFunctionName();
-		if (!EventName.IsNone())
-		{
-			SearchableStrings.Add(EventName.ToString());
+			continue;
 		}
-	}
 
-	// For custom events, get the custom event name
-	if (UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
-	{
-		FString CustomEventName = CustomEvent->CustomFunctionName.ToString();
-		if (!CustomEventName.IsEmpty())
-		{
-			SearchableStrings.Add(CustomEventName);
-		}
-	}
+		const FString& GraphName = Entry.GraphNames[Node.GraphIndex];
+		const FString& NodeTitle = Node.SearchableStrings[0];
 
-	// Check comment nodes
-	if (Node->GetClass()->GetName().Contains(TEXT("Comment")))
-	{
-		FString CommentText = Node->NodeComment;
-		if (!CommentText.IsEmpty())
-		{
-			SearchableStrings.Add(CommentText);
-		}
+		TSharedPtr<FJsonObject> MatchObj = MakeShared<FJsonObject>();
+		MatchObj->SetStringField(TEXT("blueprint_path"), Entry.BlueprintPath);
+		MatchObj->SetStringField(TEXT("blueprint_name"), Entry.BlueprintName);
+		MatchObj->SetStringField(TEXT("graph_name"), GraphName);
+		MatchObj->SetStringField(TEXT("node_id"), Node.NodeId);
+		MatchObj->SetStringField(TEXT("node_title"), NodeTitle);
+		MatchObj->SetStringField(TEXT("node_class"), Node.NodeClass);
+		MatchObj->SetStringField(TEXT("match_context"), *MatchedString);
+		OutMatches.Add(MakeShared<FJsonValueObject>(MatchObj));
+
+		TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+		NodeObj->SetStringField(TEXT("graph"), GraphName);
+		NodeObj->SetStringField(TEXT("node_id"), Node.NodeId);
+		NodeObj->SetStringField(TEXT("title"), NodeTitle);
+		NodeObj->SetStringField(TEXT("context"), *MatchedString);
+		NodeMatches.Add(MakeShared<FJsonValueObject>(NodeObj));
 	}
 
-	// Search through all strings
-	ESearchCase::Type SearchCase = bCaseSensitive ? ESearchCase::CaseSensitive : ESearchCase::IgnoreCase;
-
-	for (const FString& Searchable : SearchableStrings)
+	// Group results by blueprint for easier consumption
+	if (NodeMatches.Num() > 0)
 	{
-		if (Searchable.Contains(SearchQuery, SearchCase))
-		{
-			OutMatchContext = Searchable;
-			return true;
-		}
+		TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
+		GroupObj->SetStringField(TEXT("blueprint_name"), Entry.BlueprintName);
+		GroupObj->SetStringField(TEXT("blueprint_path"), Entry.BlueprintPath);
+		GroupObj->SetNumberField(TEXT("match_count"), NodeMatches.Num());
+		GroupObj->SetArrayField(TEXT("nodes"), NodeMatches);
+		OutGroups.Add(MakeShared<FJsonValueObject>(GroupObj));
 	}
 
-	return false;
+	return NodeMatches.Num();
 }
 
-bool FFindInBlueprintsCommand::MatchesNodeTypeFilter(UEdGraphNode* Node, EBlueprintSearchType SearchType) const
+bool FFindInBlueprintsCommand::MatchesNodeTypeFilter(EBlueprintSearchNodeKind Kinds, EBlueprintSearchType SearchType) const
 {
-	if (SearchType == EBlueprintSearchType::All)
-	{
-		return true;
-	}
-
-	FString NodeClassName = Node->GetClass()->GetName();
-
 	switch (SearchType)
 	{
 		case EBlueprintSearchType::Function:
-			return Node->IsA<UK2Node_CallFunction>() ||
-				   Node->IsA<UK2Node_FunctionEntry>() ||
-				   NodeClassName.Contains(TEXT("CallFunction"));
+			return EnumHasAnyFlags(Kinds, EBlueprintSearchNodeKind::Function);
 
 		case EBlueprintSearchType::Variable:
-			return Node->IsA<UK2Node_VariableGet>() ||
-				   Node->IsA<UK2Node_VariableSet>() ||
-				   NodeClassName.Contains(TEXT("Variable"));
+			return EnumHasAnyFlags(Kinds, EBlueprintSearchNodeKind::Variable);
 
 		case EBlueprintSearchType::Event:
-			return Node->IsA<UK2Node_Event>();
+			return EnumHasAnyFlags(Kinds, EBlueprintSearchNodeKind::Event);
 
 		case EBlueprintSearchType::Custom:
-			return Node->IsA<UK2Node_CustomEvent>();
+			return EnumHasAnyFlags(Kinds, EBlueprintSearchNodeKind::CustomEvent);
 
 		case EBlueprintSearchType::Comment:
-			return NodeClassName.Contains(TEXT("Comment"));
+			return EnumHasAnyFlags(Kinds, EBlueprintSearchNodeKind::Comment);
 
 		default:
 			return true;
 	}
 }
-
-FString FFindInBlueprintsCommand::CreateErrorResponse(const FString& ErrorMessage) const
-{
-	TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
-	ResponseObj->SetBoolField(TEXT("success"), false);
-	ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
-
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-
-	return OutputString;
-}
-
-FString FFindInBlueprintsCommand::CreateSuccessResponse(
-	const TArray<FBlueprintSearchMatch>& Matches,
-	const FString& SearchQuery,
-	const FString& SearchType,
-	int32 BlueprintsSearched) const
-{
-	TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
-	ResponseObj->SetBoolField(TEXT("success"), true);
-	ResponseObj->SetStringField(TEXT("search_query"), SearchQuery);
-	ResponseObj->SetStringField(TEXT("search_type"), SearchType);
-	ResponseObj->SetNumberField(TEXT("blueprints_searched"), BlueprintsSearched);
-	ResponseObj->SetNumberField(TEXT("match_count"), Matches.Num());
-
-	// Build matches array
-	TArray<TSharedPtr<FJsonValue>> MatchesArray;
-	for (const FBlueprintSearchMatch& Match : Matches)
-	{
-		TSharedPtr<FJsonObject> MatchObj = MakeShared<FJsonObject>();
-		MatchObj->SetStringField(TEXT("blueprint_path"), Match.BlueprintPath);
-		MatchObj->SetStringField(TEXT("blueprint_name"), Match.BlueprintName);
-		MatchObj->SetStringField(TEXT("graph_name"), Match.GraphName);
-		MatchObj->SetStringField(TEXT("node_id"), Match.NodeId);
-		MatchObj->SetStringField(TEXT("node_title"), Match.NodeTitle);
-		MatchObj->SetStringField(TEXT("node_class"), Match.NodeClass);
-		MatchObj->SetStringField(TEXT("match_context"), Match.MatchContext);
-
-		MatchesArray.Add(MakeShared<FJsonValueObject>(MatchObj));
-	}
-
-	ResponseObj->SetArrayField(TEXT("matches"), MatchesArray);
-
-	// Group results by blueprint for easier consumption
-	TMap<FString, TArray<const FBlueprintSearchMatch*>> ByBlueprint;
-	for (const FBlueprintSearchMatch& Match : Matches)
-	{
-		ByBlueprint.FindOrAdd(Match.BlueprintName).Add(&Match);
-	}
-
-	TArray<TSharedPtr<FJsonValue>> GroupedArray;
-	for (const auto& Pair : ByBlueprint)
-	{
-		TSharedPtr<FJsonObject> GroupObj = MakeShared<FJsonObject>();
-		GroupObj->SetStringField(TEXT("blueprint_name"), Pair.Key);
-		GroupObj->SetNumberField(TEXT("match_count"), Pair.Value.Num());
-
-		if (Pair.Value.Num() > 0)
-		{
-			GroupObj->SetStringField(TEXT("blueprint_path"), Pair.Value[0]->BlueprintPath);
-		}
-
-		TArray<TSharedPtr<FJsonValue>> NodeMatches;
-		for (const FBlueprintSearchMatch* Match : Pair.Value)
-		{
-			TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
-			NodeObj->SetStringField(TEXT("graph"), Match->GraphName);
-			NodeObj->SetStringField(TEXT("node_id"), Match->NodeId);
-			NodeObj->SetStringField(TEXT("title"), Match->NodeTitle);
-			NodeObj->SetStringField(TEXT("context"), Match->MatchContext);
-
-			NodeMatches.Add(MakeShared<FJsonValueObject>(NodeObj));
-		}
-		GroupObj->SetArrayField(TEXT("nodes"), NodeMatches);
-
-		GroupedArray.Add(MakeShared<FJsonValueObject>(GroupObj));
-	}
-
-	ResponseObj->SetArrayField(TEXT("by_blueprint"), GroupedArray);
-
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-
-	return OutputString;
-}
@@ -32,6 +32,22 @@ FString FGetNodePinInfoCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Failed to parse JSON parameters"));
     }
 
+    // A batch of lookups shares one scan of the loaded Blueprints
+    const TArray<TSharedPtr<FJsonValue>>* QueryValues = nullptr;
+    if (ParamsObj->TryGetArrayField(TEXT("queries"), QueryValues))
+    {
+        TArray<FNodePinQuery> Queries;
+        for (const TSharedPtr<FJsonValue>& QueryValue : *QueryValues)
+        {
+            const TSharedPtr<FJsonObject> QueryObj = QueryValue->AsObject();
+            FNodePinQuery& Query = Queries.AddDefaulted_GetRef();
+            Query.NodeName = QueryObj->GetStringField(TEXT("node_name"));
+            Query.PinName = QueryObj->GetStringField(TEXT("pin_name"));
+            QueryObj->TryGetStringField(TEXT("class_name"), Query.ClassName);
+        }
+        return BlueprintActionService->GetNodePinInfoBatch(Queries);
+    }
+
     FString NodeName = ParamsObj->GetStringField(TEXT("node_name"));
     FString PinName = ParamsObj->GetStringField(TEXT("pin_name"));
     FString ClassName = ParamsObj->HasField(TEXT("class_name")) ? ParamsObj->GetStringField(TEXT("class_name")) : TEXT("");
@@ -63,6 +79,30 @@ bool FGetNodePinInfoCommand::ValidateParams(const FString& Parameters) const
         return false;
     }
 
+    const TArray<TSharedPtr<FJsonValue>>* QueryValues = nullptr;
+    if (ParamsObj->TryGetArrayField(TEXT("queries"), QueryValues))
+    {
+        if (QueryValues->Num() == 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("GetNodePinInfoCommand: 'queries' is empty"));
+            return false;
+        }
+        for (const TSharedPtr<FJsonValue>& QueryValue : *QueryValues)
+        {
+            const TSharedPtr<FJsonObject>* QueryObj = nullptr;
+            FString QueryNodeName;
+            FString QueryPinName;
+            if (!QueryValue.IsValid() || !QueryValue->TryGetObject(QueryObj) ||
+                !(*QueryObj)->TryGetStringField(TEXT("node_name"), QueryNodeName) || QueryNodeName.IsEmpty() ||
+                !(*QueryObj)->TryGetStringField(TEXT("pin_name"), QueryPinName) || QueryPinName.IsEmpty())
+            {
+                UE_LOG(LogTemp, Error, TEXT("GetNodePinInfoCommand: Every query needs a non-empty 'node_name' and 'pin_name'"));
+                return false;
+            }
+        }
+        return true;
+    }
+
     // Validate required fields
     if (!ParamsObj->HasField(TEXT("node_name")) || ParamsObj->GetStringField(TEXT("node_name")).IsEmpty())
     {
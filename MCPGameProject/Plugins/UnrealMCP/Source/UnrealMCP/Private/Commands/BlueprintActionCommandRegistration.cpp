@@ -9,7 +9,7 @@
 #include "Services/IBlueprintActionService.h"
 
 // Static member definition
-TArray<TSharedPtr<IUnrealMCPCommand>> FBlueprintActionCommandRegistration::RegisteredCommands;
+TArray<FString> FBlueprintActionCommandRegistration::RegisteredCommandNames;
 
 void FBlueprintActionCommandRegistration::RegisterCommands(FUnrealMCPCommandRegistry& Registry, TSharedPtr<IBlueprintActionService> BlueprintActionService)
 {
@@ -22,30 +22,24 @@ void FBlueprintActionCommandRegistration::RegisterCommands(FUnrealMCPCommandRegi
     UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::RegisterCommands: Registering Blueprint Action commands"));
 
     // Register GetActionsForClass command
-    TSharedPtr<IUnrealMCPCommand> GetActionsForClassCommand = MakeShared<FGetActionsForClassCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(GetActionsForClassCommand);
+    RegisterAndTrackCommand(TEXT("get_actions_for_class"), [BlueprintActionService]() { return MakeShared<FGetActionsForClassCommand>(BlueprintActionService); });
 
     // Register GetActionsForClassHierarchy command
-    TSharedPtr<IUnrealMCPCommand> GetActionsForClassHierarchyCommand = MakeShared<FGetActionsForClassHierarchyCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(GetActionsForClassHierarchyCommand);
+    RegisterAndTrackCommand(TEXT("get_actions_for_class_hierarchy"), [BlueprintActionService]() { return MakeShared<FGetActionsForClassHierarchyCommand>(BlueprintActionService); });
 
     // Register GetActionsForPin command
-    TSharedPtr<IUnrealMCPCommand> GetActionsForPinCommand = MakeShared<FGetActionsForPinCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(GetActionsForPinCommand);
+    RegisterAndTrackCommand(TEXT("get_actions_for_pin"), [BlueprintActionService]() { return MakeShared<FGetActionsForPinCommand>(BlueprintActionService); });
 
     // Register SearchBlueprintActions command
-    TSharedPtr<IUnrealMCPCommand> SearchBlueprintActionsCommand = MakeShared<FSearchBlueprintActionsCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(SearchBlueprintActionsCommand);
+    RegisterAndTrackCommand(TEXT("search_blueprint_actions"), [BlueprintActionService]() { return MakeShared<FSearchBlueprintActionsCommand>(BlueprintActionService); });
 
     // Register GetNodePinInfo command
-    TSharedPtr<IUnrealMCPCommand> GetNodePinInfoCommand = MakeShared<FGetNodePinInfoCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(GetNodePinInfoCommand);
+    RegisterAndTrackCommand(TEXT("get_node_pin_info"), [BlueprintActionService]() { return MakeShared<FGetNodePinInfoCommand>(BlueprintActionService); });
 
     // Register FindInBlueprints command
-    TSharedPtr<IUnrealMCPCommand> FindInBlueprintsCommand = MakeShared<FFindInBlueprintsCommand>(BlueprintActionService);
-    RegisterAndTrackCommand(FindInBlueprintsCommand);
+    RegisterAndTrackCommand(TEXT("find_in_blueprints"), [BlueprintActionService]() { return MakeShared<FFindInBlueprintsCommand>(BlueprintActionService); });
 
-    UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::RegisterCommands: Successfully registered %d Blueprint Action commands"), RegisteredCommands.Num());
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::RegisterCommands: Successfully registered %d Blueprint Action commands"), RegisteredCommandNames.Num());
 }
 
 void FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands()
@@ -55,44 +49,34 @@ void FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands()
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
     
     int32 UnregisteredCount = 0;
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
+        if (Registry.UnregisterCommand(CommandName))
         {
-            FString CommandName = Command->GetCommandName();
-            if (Registry.UnregisterCommand(CommandName))
-            {
-                UnregisteredCount++;
-                UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands: Unregistered command: %s"), *CommandName);
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands: Failed to unregister command: %s"), *CommandName);
-            }
+            UnregisteredCount++;
+            UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands: Unregistered command: %s"), *CommandName);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands: Failed to unregister command: %s"), *CommandName);
         }
     }
     
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands: Unregistered %d Blueprint Action commands"), UnregisteredCount);
 }
 
-void FBlueprintActionCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FBlueprintActionCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintActionCommandRegistration::RegisterAndTrackCommand: Command is null"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("FBlueprintActionCommandRegistration::RegisterAndTrackCommand: Successfully registered command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("FBlueprintActionCommandRegistration::RegisterAndTrackCommand: Successfully registered command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintActionCommandRegistration::RegisterAndTrackCommand: Failed to register command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Error, TEXT("FBlueprintActionCommandRegistration::RegisterAndTrackCommand: Failed to register command: %s"), *CommandName);
     }
 }
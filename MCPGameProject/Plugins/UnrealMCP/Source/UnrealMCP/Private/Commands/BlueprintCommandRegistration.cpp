@@ -5,17 +5,21 @@
 #include "Commands/Blueprint/AddBlueprintVariableCommand.h"
 #include "Commands/Blueprint/SetComponentPropertyCommand.h"
 #include "Commands/Blueprint/CompileBlueprintCommand.h"
+#include "Commands/Blueprint/CompileBlueprintsCommand.h"
 #include "Commands/Blueprint/SetPhysicsPropertiesCommand.h"
 #include "Commands/Blueprint/SetBlueprintPropertyCommand.h"
 #include "Commands/Blueprint/SetStaticMeshPropertiesCommand.h"
 #include "Commands/Blueprint/SetPawnPropertiesCommand.h"
 #include "Commands/Blueprint/CallBlueprintFunctionCommand.h"
+#include "Commands/Blueprint/CallBlueprintFunctionBatchCommand.h"
 #include "Commands/Blueprint/CreateBlueprintInterfaceCommand.h"
 #include "Commands/Blueprint/AddInterfaceToBlueprintCommand.h"
 #include "Commands/Blueprint/CreateCustomBlueprintFunctionCommand.h"
+#include "Commands/Blueprint/AddBlueprintMembersBatchCommand.h"
 #include "Commands/Blueprint/GetBlueprintMetadataCommand.h"
 #include "Commands/Blueprint/ModifyBlueprintFunctionPropertiesCommand.h"
 #include "Commands/Blueprint/DeleteBlueprintVariableCommand.h"
+#include "Commands/Blueprint/GetBlueprintChangesSinceCommand.h"
 #include "Services/BlueprintService.h"
 
 // Static member definition
@@ -34,17 +38,21 @@ void FBlueprintCommandRegistration::RegisterAllBlueprintCommands()
     RegisterAddBlueprintVariableCommand();
     RegisterSetComponentPropertyCommand();
     RegisterCompileBlueprintCommand();
+    RegisterCompileBlueprintsCommand();
     RegisterSetPhysicsPropertiesCommand();
     RegisterSetBlueprintPropertyCommand();
     RegisterSetStaticMeshPropertiesCommand();
     RegisterSetPawnPropertiesCommand();
     RegisterCallBlueprintFunctionCommand();
+    RegisterCallBlueprintFunctionBatchCommand();
     RegisterCreateBlueprintInterfaceCommand();
     RegisterAddInterfaceToBlueprintCommand();
     RegisterCreateCustomBlueprintFunctionCommand();
+    RegisterAddBlueprintMembersBatchCommand();
     RegisterGetBlueprintMetadataCommand();
     RegisterModifyBlueprintFunctionPropertiesCommand();
     RegisterDeleteBlueprintVariableCommand();
+    RegisterGetBlueprintChangesSinceCommand();
 
     UE_LOG(LogTemp, Log, TEXT("FBlueprintCommandRegistration::RegisterAllBlueprintCommands: Registered %d Blueprint commands"),
         RegisteredCommandNames.Num());
@@ -73,117 +81,108 @@ void FBlueprintCommandRegistration::UnregisterAllBlueprintCommands()
 
 void FBlueprintCommandRegistration::RegisterCreateBlueprintCommand()
 {
-    TSharedPtr<FCreateBlueprintCommand> Command = MakeShared<FCreateBlueprintCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_blueprint"), []() { return MakeShared<FCreateBlueprintCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterAddComponentToBlueprintCommand()
 {
-    TSharedPtr<FAddComponentToBlueprintCommand> Command = MakeShared<FAddComponentToBlueprintCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_component_to_blueprint"), []() { return MakeShared<FAddComponentToBlueprintCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterSetComponentPropertyCommand()
 {
-    TSharedPtr<FSetComponentPropertyCommand> Command = MakeShared<FSetComponentPropertyCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("modify_blueprint_component_properties"), []() { return MakeShared<FSetComponentPropertyCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterCompileBlueprintCommand()
 {
-    TSharedPtr<FCompileBlueprintCommand> Command = MakeShared<FCompileBlueprintCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("compile_blueprint"), []() { return MakeShared<FCompileBlueprintCommand>(FBlueprintService::Get()); });
+}
+
+void FBlueprintCommandRegistration::RegisterCompileBlueprintsCommand()
+{
+    RegisterAndTrackCommand(TEXT("compile_blueprints"), []() { return MakeShared<FCompileBlueprintsCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterSetPhysicsPropertiesCommand()
 {
-    TSharedPtr<FSetPhysicsPropertiesCommand> Command = MakeShared<FSetPhysicsPropertiesCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_physics_properties"), []() { return MakeShared<FSetPhysicsPropertiesCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterSetBlueprintPropertyCommand()
 {
-    TSharedPtr<FSetBlueprintPropertyCommand> Command = MakeShared<FSetBlueprintPropertyCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_blueprint_property"), []() { return MakeShared<FSetBlueprintPropertyCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterSetStaticMeshPropertiesCommand()
 {
-    TSharedPtr<FSetStaticMeshPropertiesCommand> Command = MakeShared<FSetStaticMeshPropertiesCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_static_mesh_properties"), []() { return MakeShared<FSetStaticMeshPropertiesCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterSetPawnPropertiesCommand()
 {
-    TSharedPtr<FSetPawnPropertiesCommand> Command = MakeShared<FSetPawnPropertiesCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_pawn_properties"), []() { return MakeShared<FSetPawnPropertiesCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterAddBlueprintVariableCommand()
 {
-    TSharedPtr<FAddBlueprintVariableCommand> Command = MakeShared<FAddBlueprintVariableCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_blueprint_variable"), []() { return MakeShared<FAddBlueprintVariableCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterCallBlueprintFunctionCommand()
 {
-    TSharedPtr<FCallBlueprintFunctionCommand> Command = MakeShared<FCallBlueprintFunctionCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("call_blueprint_function"), []() { return MakeShared<FCallBlueprintFunctionCommand>(FBlueprintService::Get()); });
+}
+
+void FBlueprintCommandRegistration::RegisterCallBlueprintFunctionBatchCommand()
+{
+    RegisterAndTrackCommand(TEXT("call_blueprint_function_batch"), []() { return MakeShared<FCallBlueprintFunctionBatchCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterCreateBlueprintInterfaceCommand()
 {
-    TSharedPtr<FCreateBlueprintInterfaceCommand> Command = MakeShared<FCreateBlueprintInterfaceCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_blueprint_interface"), []() { return MakeShared<FCreateBlueprintInterfaceCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterAddInterfaceToBlueprintCommand()
 {
-    TSharedPtr<FAddInterfaceToBlueprintCommand> Command = MakeShared<FAddInterfaceToBlueprintCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_interface_to_blueprint"), []() { return MakeShared<FAddInterfaceToBlueprintCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterCreateCustomBlueprintFunctionCommand()
 {
-    TSharedPtr<FCreateCustomBlueprintFunctionCommand> Command = MakeShared<FCreateCustomBlueprintFunctionCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_custom_blueprint_function"), []() { return MakeShared<FCreateCustomBlueprintFunctionCommand>(FBlueprintService::Get()); });
+}
+
+void FBlueprintCommandRegistration::RegisterAddBlueprintMembersBatchCommand()
+{
+    RegisterAndTrackCommand(TEXT("add_blueprint_members_batch"), []() { return MakeShared<FAddBlueprintMembersBatchCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterGetBlueprintMetadataCommand()
 {
-    TSharedPtr<FGetBlueprintMetadataCommand> Command = MakeShared<FGetBlueprintMetadataCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_blueprint_metadata"), []() { return MakeShared<FGetBlueprintMetadataCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterModifyBlueprintFunctionPropertiesCommand()
 {
-    TSharedPtr<FModifyBlueprintFunctionPropertiesCommand> Command = MakeShared<FModifyBlueprintFunctionPropertiesCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("modify_blueprint_function_properties"), []() { return MakeShared<FModifyBlueprintFunctionPropertiesCommand>(FBlueprintService::Get()); });
 }
 
 void FBlueprintCommandRegistration::RegisterDeleteBlueprintVariableCommand()
 {
-    TSharedPtr<FDeleteBlueprintVariableCommand> Command = MakeShared<FDeleteBlueprintVariableCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("delete_blueprint_variable"), []() { return MakeShared<FDeleteBlueprintVariableCommand>(FBlueprintService::Get()); });
 }
 
-void FBlueprintCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FBlueprintCommandRegistration::RegisterGetBlueprintChangesSinceCommand()
+{
+    RegisterAndTrackCommand(TEXT("get_blueprint_changes_since"), []() { return MakeShared<FGetBlueprintChangesSinceCommand>(FBlueprintService::Get()); });
+}
+
+void FBlueprintCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-    
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
@@ -0,0 +1,291 @@
+#include "Commands/BlueprintNode/BuildBlueprintGraphCommand.h"
+#include "Services/BlueprintNodeCreationService.h"
+#include "Services/IBlueprintNodeService.h"
+#include "Services/BlueprintNode/BlueprintNodeConnectionService.h"
+#include "Services/NodeLayout/NodeLayoutService.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Utils/GraphUtils.h"
+#include "MCPBatchEditScope.h"
+#include "MCPErrorHandler.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+
+namespace
+{
+    /** Horizontal spacing of nodes given without a position */
+    constexpr int32 DefaultNodeSpacing = 300;
+
+    FString SerializeJson(const TSharedRef<FJsonObject>& Object)
+    {
+        FString Output;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+        FJsonSerializer::Serialize(Object, Writer);
+        return Output;
+    }
+}
+
+FString FBuildBlueprintGraphCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FBuildBlueprintGraphCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString BlueprintName;
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) || BlueprintName.IsEmpty()
+        || !Params->TryGetArrayField(TEXT("nodes"), NodesArray) || NodesArray->Num() == 0)
+    {
+        FMCPError ParseError = FMCPErrorHandler::CreateInvalidParametersError(TEXT("Missing required 'blueprint_name' or 'nodes' parameter"));
+        FMCPErrorHandler::LogError(ParseError);
+        Response.SetError(ParseError);
+        return;
+    }
+
+    FString TargetGraph = TEXT("EventGraph");
+    Params->TryGetStringField(TEXT("target_graph"), TargetGraph);
+    // Laying out the EventGraph would move the nodes already in it, so it is opt-in there
+    bool bAutoArrange = !TargetGraph.Equals(TEXT("EventGraph"), ESearchCase::IgnoreCase);
+    Params->TryGetBoolField(TEXT("auto_arrange"), bAutoArrange);
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateInvalidParametersError(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+
+    // Validate the spec before touching the graph
+    TSet<FString> SpecIds;
+    for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
+    {
+        const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+        FString Id;
+        FString Action;
+        if (!NodeValue->TryGetObject(NodeObj) || !(*NodeObj)->TryGetStringField(TEXT("id"), Id) || Id.IsEmpty()
+            || !(*NodeObj)->TryGetStringField(TEXT("action"), Action) || Action.IsEmpty())
+        {
+            FMCPError SpecError = FMCPErrorHandler::CreateInvalidParametersError(TEXT("Every node needs an 'id' and an 'action'"));
+            FMCPErrorHandler::LogError(SpecError);
+            Response.SetError(SpecError);
+            return;
+        }
+        if (SpecIds.Contains(Id))
+        {
+            FMCPError SpecError = FMCPErrorHandler::CreateInvalidParametersError(FString::Printf(TEXT("Duplicate node id '%s'"), *Id));
+            FMCPErrorHandler::LogError(SpecError);
+            Response.SetError(SpecError);
+            return;
+        }
+        SpecIds.Add(Id);
+    }
+
+    // One undo entry and one graph notification for the whole build
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Build Graph (%d nodes)"), NodesArray->Num())));
+
+    FBlueprintNodeCreationService CreationService;
+    TMap<FString, FString> NodeIdsBySpecId;
+    // Created nodes the spec gave no position, for placing when the graph is not laid out as a whole
+    TSet<FString> UnpositionedNodeIds;
+    TArray<TSharedPtr<FJsonValue>> NodeResults;
+    int32 FailedCount = 0;
+
+    for (int32 Index = 0; Index < NodesArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject> NodeObj = (*NodesArray)[Index]->AsObject();
+        const FString Id = NodeObj->GetStringField(TEXT("id"));
+        const FString Action = NodeObj->GetStringField(TEXT("action"));
+        FString ClassName;
+        NodeObj->TryGetStringField(TEXT("class_name"), ClassName);
+
+        FString Position = FString::Printf(TEXT("[%d, %d]"), Index * DefaultNodeSpacing, 0);
+        const TArray<TSharedPtr<FJsonValue>>* PositionArray = nullptr;
+        const bool bHasPosition = NodeObj->TryGetArrayField(TEXT("position"), PositionArray) && PositionArray->Num() >= 2;
+        if (bHasPosition)
+        {
+            Position = FString::Printf(TEXT("[%d, %d]"), FMath::RoundToInt((*PositionArray)[0]->AsNumber()), FMath::RoundToInt((*PositionArray)[1]->AsNumber()));
+        }
+
+        TSharedRef<FJsonObject> NodeParams = MakeShared<FJsonObject>();
+        const TSharedPtr<FJsonObject>* ExtraParams = nullptr;
+        if (NodeObj->TryGetObjectField(TEXT("params"), ExtraParams))
+        {
+            NodeParams->Values = (*ExtraParams)->Values;
+        }
+        NodeParams->SetStringField(TEXT("target_graph"), TargetGraph);
+
+        const FString CreateResult = CreationService.CreateNodeByActionName(Blueprint->GetName(), Action, ClassName, Position, SerializeJson(NodeParams));
+
+        TSharedPtr<FJsonObject> CreateResultObj;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CreateResult);
+        FJsonSerializer::Deserialize(Reader, CreateResultObj);
+
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("id"), Id);
+
+        FString NodeId;
+        if (CreateResultObj.IsValid() && CreateResultObj->GetBoolField(TEXT("success")) && CreateResultObj->TryGetStringField(TEXT("node_id"), NodeId))
+        {
+            NodeIdsBySpecId.Add(Id, NodeId);
+            if (!bHasPosition)
+            {
+                UnpositionedNodeIds.Add(NodeId);
+            }
+            Entry->SetBoolField(TEXT("success"), true);
+            Entry->SetStringField(TEXT("node_id"), NodeId);
+            Entry->SetStringField(TEXT("node_title"), CreateResultObj->GetStringField(TEXT("node_title")));
+            Entry->SetStringField(TEXT("node_type"), CreateResultObj->GetStringField(TEXT("node_type")));
+            FString Warning;
+            if (CreateResultObj->TryGetStringField(TEXT("warning"), Warning) && !Warning.IsEmpty())
+            {
+                Entry->SetStringField(TEXT("warning"), Warning);
+            }
+        }
+        else
+        {
+            FString Error = TEXT("Node creation failed");
+            if (CreateResultObj.IsValid())
+            {
+                CreateResultObj->TryGetStringField(TEXT("error"), Error);
+            }
+            Entry->SetBoolField(TEXT("success"), false);
+            Entry->SetStringField(TEXT("error"), Error);
+            FailedCount++;
+        }
+        NodeResults.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    // Wire after every node exists, so connections may be listed in any order
+    TArray<FBlueprintNodeConnectionParams> Connections;
+    TArray<TSharedPtr<FJsonObject>> ConnectionEntries;
+    TArray<TSharedPtr<FJsonValue>> ConnectionResults;
+    const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("connections"), ConnectionsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& ConnectionValue : *ConnectionsArray)
+        {
+            const TSharedPtr<FJsonObject> ConnectionObj = ConnectionValue->AsObject();
+            if (!ConnectionObj.IsValid())
+            {
+                continue;
+            }
+
+            const FString Source = ConnectionObj->GetStringField(TEXT("source"));
+            const FString Target = ConnectionObj->GetStringField(TEXT("target"));
+
+            TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("source"), Source);
+            Entry->SetStringField(TEXT("target"), Target);
+
+            // A spec id whose node failed has no node to wire
+            if ((SpecIds.Contains(Source) && !NodeIdsBySpecId.Contains(Source)) || (SpecIds.Contains(Target) && !NodeIdsBySpecId.Contains(Target)))
+            {
+                Entry->SetBoolField(TEXT("success"), false);
+                Entry->SetStringField(TEXT("error"), TEXT("Node was not created"));
+                ConnectionResults.Add(MakeShared<FJsonValueObject>(Entry));
+                FailedCount++;
+                continue;
+            }
+
+            FBlueprintNodeConnectionParams Connection;
+            const FString* SourceNodeId = NodeIdsBySpecId.Find(Source);
+            const FString* TargetNodeId = NodeIdsBySpecId.Find(Target);
+            Connection.SourceNodeId = SourceNodeId ? *SourceNodeId : Source;
+            Connection.TargetNodeId = TargetNodeId ? *TargetNodeId : Target;
+            Connection.SourcePin = ConnectionObj->GetStringField(TEXT("source_pin"));
+            Connection.TargetPin = ConnectionObj->GetStringField(TEXT("target_pin"));
+            Connections.Add(Connection);
+            ConnectionEntries.Add(Entry);
+        }
+    }
+
+    int32 ConnectionsMade = 0;
+    if (Connections.Num() > 0)
+    {
+        TArray<FConnectionResultInfo> Results;
+        FBlueprintNodeConnectionService::Get().ConnectBlueprintNodesEnhanced(Blueprint, Connections, TargetGraph, Results);
+        for (int32 Index = 0; Index < ConnectionEntries.Num(); ++Index)
+        {
+            const bool bConnected = Results.IsValidIndex(Index) && Results[Index].bSuccess;
+            ConnectionEntries[Index]->SetBoolField(TEXT("success"), bConnected);
+            if (bConnected)
+            {
+                ConnectionsMade++;
+            }
+            else
+            {
+                ConnectionEntries[Index]->SetStringField(TEXT("error"), Results.IsValidIndex(Index) ? Results[Index].ErrorMessage : TEXT("Connection failed"));
+                FailedCount++;
+            }
+            ConnectionResults.Add(MakeShared<FJsonValueObject>(ConnectionEntries[Index]));
+        }
+    }
+
+    int32 ArrangedCount = 0;
+    UEdGraph* Graph = FindGraph(Blueprint, TargetGraph);
+    if (Graph && bAutoArrange)
+    {
+        FNodeLayoutService::AutoArrangeNodes(Graph, ArrangedCount);
+    }
+    else if (Graph && UnpositionedNodeIds.Num() > 0)
+    {
+        // Place the new nodes next to what they were wired to, leaving the existing layout alone
+        TArray<UEdGraphNode*> NewNodes;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && UnpositionedNodeIds.Contains(FGraphUtils::GetReliableNodeId(Node)))
+            {
+                NewNodes.Add(Node);
+            }
+        }
+        FNodeLayoutService::ArrangeNewNodes(Graph, NewNodes, ArrangedCount);
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("nodes"), NodeResults);
+    ResponseObj->SetArrayField(TEXT("connections"), ConnectionResults);
+    ResponseObj->SetNumberField(TEXT("nodes_created"), NodeIdsBySpecId.Num());
+    ResponseObj->SetNumberField(TEXT("connections_made"), ConnectionsMade);
+    ResponseObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResponseObj->SetNumberField(TEXT("arranged_count"), ArrangedCount);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FBuildBlueprintGraphCommand::GetCommandName() const
+{
+    return TEXT("build_blueprint_graph");
+}
+
+bool FBuildBlueprintGraphCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FBuildBlueprintGraphCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString BlueprintName;
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+    return Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) && !BlueprintName.IsEmpty()
+        && Params->TryGetArrayField(TEXT("nodes"), NodesArray) && NodesArray->Num() > 0;
+}
+
+UEdGraph* FBuildBlueprintGraphCommand::FindGraph(UBlueprint* Blueprint, const FString& GraphName)
+{
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (Graph && Graph->GetName().Equals(GraphName, ESearchCase::IgnoreCase))
+        {
+            return Graph;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,298 @@
+#include "Commands/BlueprintNode/GraphSnippetCommand.h"
+#include "Services/BlueprintNode/GraphSnippetService.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Utils/GraphUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+
+namespace
+{
+    UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& GraphName)
+    {
+        TArray<UEdGraph*> AllGraphs;
+        Blueprint->GetAllGraphs(AllGraphs);
+        for (UEdGraph* Graph : AllGraphs)
+        {
+            if (Graph && Graph->GetName().Equals(GraphName, ESearchCase::IgnoreCase))
+            {
+                return Graph;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Resolve the Blueprint and graph_name of a request, or set the error */
+    UEdGraph* ResolveGraph(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+    {
+        const FString BlueprintName = Params->GetStringField(TEXT("blueprint_name"));
+        UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+        if (!Blueprint)
+        {
+            Response.SetError(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+            return nullptr;
+        }
+
+        FString GraphName;
+        if (!Params->TryGetStringField(TEXT("graph_name"), GraphName) || GraphName.IsEmpty())
+        {
+            GraphName = TEXT("EventGraph");
+        }
+        UEdGraph* Graph = FindGraph(Blueprint, GraphName);
+        if (!Graph)
+        {
+            Response.SetError(FString::Printf(TEXT("Graph '%s' not found in Blueprint '%s'"), *GraphName, *BlueprintName));
+        }
+        return Graph;
+    }
+
+    TSharedRef<FJsonObject> SnippetToJson(const FGraphSnippet& Snippet)
+    {
+        TArray<TSharedPtr<FJsonValue>> NodeValues;
+        for (const FGraphSnippet::FNode& Node : Snippet.Nodes)
+        {
+            TSharedRef<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("key"), Node.Key);
+            NodeObj->SetStringField(TEXT("title"), Node.Title);
+            NodeObj->SetStringField(TEXT("class"), Node.Class);
+            NodeValues.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+
+        TSharedRef<FJsonObject> SnippetObj = MakeShared<FJsonObject>();
+        SnippetObj->SetStringField(TEXT("name"), Snippet.Name);
+        SnippetObj->SetStringField(TEXT("description"), Snippet.Description);
+        SnippetObj->SetStringField(TEXT("schema"), Snippet.SchemaClass);
+        SnippetObj->SetArrayField(TEXT("nodes"), NodeValues);
+        return SnippetObj;
+    }
+}
+
+FString FGraphSnippetCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGraphSnippetCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    switch (Mode)
+    {
+    case EMode::Save:
+        ExecuteSave(Params, Response);
+        break;
+    case EMode::Paste:
+        ExecutePaste(Params, Response);
+        break;
+    case EMode::List:
+        ExecuteList(Response);
+        break;
+    }
+}
+
+void FGraphSnippetCommand::ExecuteSave(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) const
+{
+    if (!ValidateParams(Params))
+    {
+        Response.SetError(TEXT("Missing required 'blueprint_name', 'snippet_name' or 'node_ids' parameter"));
+        return;
+    }
+
+    UEdGraph* Graph = ResolveGraph(Params, Response);
+    if (!Graph)
+    {
+        return;
+    }
+
+    TMap<FString, UEdGraphNode*> NodesById;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            NodesById.Add(FGraphUtils::GetReliableNodeId(Node), Node);
+        }
+    }
+
+    TArray<UEdGraphNode*> Nodes;
+    for (const TSharedPtr<FJsonValue>& IdValue : Params->GetArrayField(TEXT("node_ids")))
+    {
+        const FString NodeId = IdValue->AsString();
+        UEdGraphNode* Node = NodesById.FindRef(NodeId);
+        if (!Node)
+        {
+            Response.SetError(FString::Printf(TEXT("Node '%s' not found in graph '%s'"), *NodeId, *Graph->GetName()));
+            return;
+        }
+        Nodes.Add(Node);
+    }
+
+    TArray<FString> Keys;
+    const TArray<TSharedPtr<FJsonValue>>* KeyValues = nullptr;
+    if (Params->TryGetArrayField(TEXT("keys"), KeyValues))
+    {
+        for (const TSharedPtr<FJsonValue>& KeyValue : *KeyValues)
+        {
+            Keys.Add(KeyValue->AsString());
+        }
+    }
+
+    FString Description;
+    Params->TryGetStringField(TEXT("description"), Description);
+    bool bOverwrite = false;
+    Params->TryGetBoolField(TEXT("overwrite"), bOverwrite);
+
+    FString Error;
+    const FGraphSnippet* Snippet = FGraphSnippetService::Get().SaveSnippet(
+        Graph, Nodes, Keys, Params->GetStringField(TEXT("snippet_name")), Description, bOverwrite, Error);
+    if (!Snippet)
+    {
+        Response.SetError(Error);
+        return;
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetObjectField(TEXT("snippet"), SnippetToJson(*Snippet));
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+void FGraphSnippetCommand::ExecutePaste(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) const
+{
+    if (!ValidateParams(Params))
+    {
+        Response.SetError(TEXT("Missing required 'blueprint_name' or 'snippet_name' parameter"));
+        return;
+    }
+
+    const FString SnippetName = Params->GetStringField(TEXT("snippet_name"));
+    const FGraphSnippet* Snippet = FGraphSnippetService::Get().FindSnippet(SnippetName);
+    if (!Snippet)
+    {
+        Response.SetError(FString::Printf(TEXT("Snippet not found: %s"), *SnippetName));
+        return;
+    }
+
+    UEdGraph* Graph = ResolveGraph(Params, Response);
+    if (!Graph)
+    {
+        return;
+    }
+
+    FIntPoint Position(0, 0);
+    const TArray<TSharedPtr<FJsonValue>>* PositionArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("position"), PositionArray) && PositionArray->Num() >= 2)
+    {
+        Position.X = FMath::RoundToInt((*PositionArray)[0]->AsNumber());
+        Position.Y = FMath::RoundToInt((*PositionArray)[1]->AsNumber());
+    }
+
+    TMap<FString, FGraphSnippetNodeOverride> Overrides;
+    const TSharedPtr<FJsonObject>* OverridesObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("overrides"), OverridesObj))
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*OverridesObj)->Values)
+        {
+            const TSharedPtr<FJsonObject> OverrideObj = Pair.Value->AsObject();
+            if (!OverrideObj.IsValid())
+            {
+                continue;
+            }
+
+            FGraphSnippetNodeOverride& Override = Overrides.Add(Pair.Key);
+            OverrideObj->TryGetStringField(TEXT("variable"), Override.Variable);
+            const TSharedPtr<FJsonObject>* PinsObj = nullptr;
+            if (OverrideObj->TryGetObjectField(TEXT("pins"), PinsObj))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& PinPair : (*PinsObj)->Values)
+                {
+                    Override.PinValues.Add(PinPair.Key, PinPair.Value->AsString());
+                }
+            }
+        }
+    }
+
+    TArray<FPastedSnippetNode> PastedNodes;
+    TArray<FString> Warnings;
+    FString Error;
+    if (!FGraphSnippetService::Get().PasteSnippet(Graph, *Snippet, Position, Overrides, PastedNodes, Warnings, Error))
+    {
+        Response.SetError(Error);
+        return;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> NodeValues;
+    for (const FPastedSnippetNode& Pasted : PastedNodes)
+    {
+        TSharedRef<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("key"), Pasted.Key);
+        NodeObj->SetStringField(TEXT("node_id"), FGraphUtils::GetReliableNodeId(Pasted.Node));
+        NodeObj->SetStringField(TEXT("title"), Pasted.Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+        NodeValues.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> WarningValues;
+    for (const FString& Warning : Warnings)
+    {
+        WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("nodes"), NodeValues);
+    if (WarningValues.Num() > 0)
+    {
+        ResponseObj->SetArrayField(TEXT("warnings"), WarningValues);
+    }
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+void FGraphSnippetCommand::ExecuteList(FMCPResponseWriter& Response) const
+{
+    TArray<TSharedPtr<FJsonValue>> SnippetValues;
+    for (const FGraphSnippet* Snippet : FGraphSnippetService::Get().GetSnippets())
+    {
+        SnippetValues.Add(MakeShared<FJsonValueObject>(SnippetToJson(*Snippet)));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("snippets"), SnippetValues);
+    ResponseObj->SetNumberField(TEXT("count"), SnippetValues.Num());
+    Response.SetResult(ResponseObj);
+}
+
+FString FGraphSnippetCommand::GetCommandName() const
+{
+    switch (Mode)
+    {
+    case EMode::Save:
+        return TEXT("save_graph_snippet");
+    case EMode::Paste:
+        return TEXT("paste_graph_snippet");
+    default:
+        return TEXT("list_graph_snippets");
+    }
+}
+
+bool FGraphSnippetCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGraphSnippetCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    if (Mode == EMode::List)
+    {
+        return true;
+    }
+
+    FString BlueprintName, SnippetName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) || BlueprintName.IsEmpty()
+        || !Params->TryGetStringField(TEXT("snippet_name"), SnippetName) || SnippetName.IsEmpty())
+    {
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NodeIds = nullptr;
+    return Mode != EMode::Save || (Params->TryGetArrayField(TEXT("node_ids"), NodeIds) && NodeIds->Num() > 0);
+}
@@ -0,0 +1,129 @@
+#include "Commands/BlueprintNode/PinsBatchCommand.h"
+#include "Services/IBlueprintNodeService.h"
+#include "Services/BlueprintNode/BlueprintNodeConnectionService.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Engine/Blueprint.h"
+
+FString FPinsBatchCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FPinsBatchCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString BlueprintName;
+    const TArray<TSharedPtr<FJsonValue>>* WiresArray = nullptr;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) || BlueprintName.IsEmpty()
+        || !Params->TryGetArrayField(TEXT("wires"), WiresArray) || WiresArray->Num() == 0)
+    {
+        Response.SetError(TEXT("Missing required 'blueprint_name' or 'wires' parameter"));
+        return;
+    }
+
+    FString TargetGraph;
+    if (!Params->TryGetStringField(TEXT("target_graph"), TargetGraph) || TargetGraph.IsEmpty())
+    {
+        TargetGraph = TEXT("EventGraph");
+    }
+
+    bool bAllOrNothing = false;
+    Params->TryGetBoolField(TEXT("all_or_nothing"), bAllOrNothing);
+
+    // Malformed entries become failed wires, so results stay aligned with the request
+    TArray<FBlueprintNodeConnectionParams> Wires;
+    Wires.Reserve(WiresArray->Num());
+    for (const TSharedPtr<FJsonValue>& WireValue : *WiresArray)
+    {
+        FBlueprintNodeConnectionParams& Wire = Wires.AddDefaulted_GetRef();
+        if (const TSharedPtr<FJsonObject> WireObj = WireValue->AsObject())
+        {
+            WireObj->TryGetStringField(TEXT("source_node_id"), Wire.SourceNodeId);
+            WireObj->TryGetStringField(TEXT("source_pin"), Wire.SourcePin);
+            WireObj->TryGetStringField(TEXT("target_node_id"), Wire.TargetNodeId);
+            WireObj->TryGetStringField(TEXT("target_pin"), Wire.TargetPin);
+        }
+    }
+
+    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+    if (!Blueprint)
+    {
+        Response.SetError(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+        return;
+    }
+
+    TArray<FConnectionResultInfo> Results;
+    FString Error;
+    FBlueprintNodeConnectionService& ConnectionService = FBlueprintNodeConnectionService::Get();
+    const bool bAllSucceeded = Mode == EMode::Connect
+        ? ConnectionService.ConnectPinsBatch(Blueprint, TargetGraph, Wires, bAllOrNothing, Results, Error)
+        : ConnectionService.DisconnectPinsBatch(Blueprint, TargetGraph, Wires, bAllOrNothing, Results, Error);
+    if (!Error.IsEmpty())
+    {
+        Response.SetError(Error);
+        return;
+    }
+
+    int32 Succeeded = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    TArray<TSharedPtr<FJsonValue>> AutoInsertedArray;
+    for (int32 Index = 0; Index < Results.Num(); ++Index)
+    {
+        const FConnectionResultInfo& Result = Results[Index];
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("source_node_id"), Wires[Index].SourceNodeId);
+        Entry->SetStringField(TEXT("source_pin"), Wires[Index].SourcePin);
+        Entry->SetStringField(TEXT("target_node_id"), Wires[Index].TargetNodeId);
+        Entry->SetStringField(TEXT("target_pin"), Wires[Index].TargetPin);
+        Entry->SetBoolField(TEXT("success"), Result.bSuccess);
+        if (Result.bSuccess)
+        {
+            Succeeded++;
+        }
+        else
+        {
+            Entry->SetStringField(TEXT("error"), Result.ErrorMessage);
+        }
+
+        for (const FAutoInsertedNodeInfo& AutoNode : Result.AutoInsertedNodes)
+        {
+            TSharedRef<FJsonObject> AutoNodeObj = MakeShared<FJsonObject>();
+            AutoNodeObj->SetStringField(TEXT("node_id"), AutoNode.NodeId);
+            AutoNodeObj->SetStringField(TEXT("title"), AutoNode.NodeTitle);
+            AutoNodeObj->SetStringField(TEXT("type"), AutoNode.NodeType);
+            AutoInsertedArray.Add(MakeShared<FJsonValueObject>(AutoNodeObj));
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("succeeded"), Succeeded);
+    ResponseObj->SetNumberField(TEXT("failed"), Results.Num() - Succeeded);
+    if (AutoInsertedArray.Num() > 0)
+    {
+        ResponseObj->SetArrayField(TEXT("auto_inserted_nodes"), AutoInsertedArray);
+    }
+    ResponseObj->SetBoolField(TEXT("success"), bAllSucceeded);
+    Response.SetResult(ResponseObj);
+}
+
+FString FPinsBatchCommand::GetCommandName() const
+{
+    return Mode == EMode::Connect ? TEXT("connect_pins_batch") : TEXT("disconnect_pins_batch");
+}
+
+bool FPinsBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FPinsBatchCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString BlueprintName;
+    const TArray<TSharedPtr<FJsonValue>>* WiresArray = nullptr;
+    return Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName) && !BlueprintName.IsEmpty()
+        && Params->TryGetArrayField(TEXT("wires"), WiresArray) && WiresArray->Num() > 0;
+}
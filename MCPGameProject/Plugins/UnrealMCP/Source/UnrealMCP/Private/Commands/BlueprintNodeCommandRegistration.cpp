@@ -10,6 +10,9 @@
 #include "Commands/BlueprintNode/AddBlueprintFunctionNodeCommand.h"
 #include "Commands/BlueprintNode/AddBlueprintCustomEventNodeCommand.h"
 #include "Commands/BlueprintNode/CreateNodeByActionNameCommand.h"
+#include "Commands/BlueprintNode/BuildBlueprintGraphCommand.h"
+#include "Commands/BlueprintNode/PinsBatchCommand.h"
+#include "Commands/BlueprintNode/GraphSnippetCommand.h"
 // #include "Commands/BlueprintNode/AddEnhancedInputActionNodeCommand.h"  // REMOVED: Use create_node_by_action_name instead
 #include "Services/BlueprintNodeService.h"
 #include "Services/BlueprintActionService.h"
@@ -35,6 +38,9 @@ void FBlueprintNodeCommandRegistration::RegisterAllBlueprintNodeCommands()
     RegisterAddBlueprintFunctionNodeCommand();
     RegisterAddBlueprintCustomEventNodeCommand();
     RegisterCreateNodeByActionNameCommand();
+    RegisterBuildBlueprintGraphCommand();
+    RegisterPinsBatchCommands();
+    RegisterGraphSnippetCommands();
     // RegisterAddEnhancedInputActionNodeCommand(); // REMOVED: Use create_node_by_action_name instead
     
     UE_LOG(LogTemp, Log, TEXT("FBlueprintNodeCommandRegistration::RegisterAllBlueprintNodeCommands: Registered %d Blueprint Node commands"), 
@@ -64,10 +70,12 @@ void FBlueprintNodeCommandRegistration::UnregisterAllBlueprintNodeCommands()
 
 void FBlueprintNodeCommandRegistration::RegisterConnectBlueprintNodesCommand()
 {
-    // Use the singleton instance wrapped in a shared pointer
-    TSharedPtr<IBlueprintNodeService> Service = TSharedPtr<IBlueprintNodeService>(&FBlueprintNodeService::Get(), [](IBlueprintNodeService*){});
-    TSharedPtr<FConnectBlueprintNodesCommand> Command = MakeShared<FConnectBlueprintNodesCommand>(Service);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("connect_blueprint_nodes"), []()
+    {
+        // Use the singleton instance wrapped in a shared pointer
+        TSharedPtr<IBlueprintNodeService> Service = TSharedPtr<IBlueprintNodeService>(&FBlueprintNodeService::Get(), [](IBlueprintNodeService*){});
+        return MakeShared<FConnectBlueprintNodesCommand>(Service);
+    });
 }
 
 // REMOVED: Input Action nodes now created via Blueprint Action system
@@ -83,40 +91,55 @@ void FBlueprintNodeCommandRegistration::RegisterConnectBlueprintNodesCommand()
 
 void FBlueprintNodeCommandRegistration::RegisterAddBlueprintVariableCommand()
 {
-    TSharedPtr<FAddBlueprintVariableNodeCommand> Command = MakeShared<FAddBlueprintVariableNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_blueprint_variable_node"), []() { return MakeShared<FAddBlueprintVariableNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FBlueprintNodeCommandRegistration::RegisterGetVariableInfoCommand()
 {
-    TSharedPtr<FGetVariableInfoCommand> Command = MakeShared<FGetVariableInfoCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_variable_info"), []() { return MakeShared<FGetVariableInfoCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FBlueprintNodeCommandRegistration::RegisterAddBlueprintEventNodeCommand()
 {
-    TSharedPtr<FAddBlueprintEventNodeCommand> Command = MakeShared<FAddBlueprintEventNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_blueprint_event_node"), []() { return MakeShared<FAddBlueprintEventNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FBlueprintNodeCommandRegistration::RegisterAddBlueprintFunctionNodeCommand()
 {
-    TSharedPtr<FAddBlueprintFunctionNodeCommand> Command = MakeShared<FAddBlueprintFunctionNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_blueprint_function_node"), []() { return MakeShared<FAddBlueprintFunctionNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FBlueprintNodeCommandRegistration::RegisterAddBlueprintCustomEventNodeCommand()
 {
-    TSharedPtr<FAddBlueprintCustomEventNodeCommand> Command = MakeShared<FAddBlueprintCustomEventNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_blueprint_custom_event_node"), []() { return MakeShared<FAddBlueprintCustomEventNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FBlueprintNodeCommandRegistration::RegisterCreateNodeByActionNameCommand()
 {
-    // Create a new instance of the Blueprint Action Service
-    TSharedPtr<IBlueprintActionService> ActionService = MakeShared<FBlueprintActionService>();
-    TSharedPtr<FCreateNodeByActionNameCommand> Command = MakeShared<FCreateNodeByActionNameCommand>(ActionService);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_node_by_action_name"), []()
+    {
+        // Create a new instance of the Blueprint Action Service
+        TSharedPtr<IBlueprintActionService> ActionService = MakeShared<FBlueprintActionService>();
+        return MakeShared<FCreateNodeByActionNameCommand>(ActionService);
+    });
+}
+
+void FBlueprintNodeCommandRegistration::RegisterBuildBlueprintGraphCommand()
+{
+    RegisterAndTrackCommand(TEXT("build_blueprint_graph"), []() { return MakeShared<FBuildBlueprintGraphCommand>(); });
+}
+
+void FBlueprintNodeCommandRegistration::RegisterPinsBatchCommands()
+{
+    RegisterAndTrackCommand(TEXT("connect_pins_batch"), []() { return MakeShared<FPinsBatchCommand>(FPinsBatchCommand::EMode::Connect); });
+    RegisterAndTrackCommand(TEXT("disconnect_pins_batch"), []() { return MakeShared<FPinsBatchCommand>(FPinsBatchCommand::EMode::Disconnect); });
+}
+
+void FBlueprintNodeCommandRegistration::RegisterGraphSnippetCommands()
+{
+    RegisterAndTrackCommand(TEXT("save_graph_snippet"), []() { return MakeShared<FGraphSnippetCommand>(FGraphSnippetCommand::EMode::Save); });
+    RegisterAndTrackCommand(TEXT("paste_graph_snippet"), []() { return MakeShared<FGraphSnippetCommand>(FGraphSnippetCommand::EMode::Paste); });
+    RegisterAndTrackCommand(TEXT("list_graph_snippets"), []() { return MakeShared<FGraphSnippetCommand>(FGraphSnippetCommand::EMode::List); });
 }
 
 // REMOVED: Enhanced Input Action nodes now created via Blueprint Action system
@@ -126,23 +149,10 @@ void FBlueprintNodeCommandRegistration::RegisterCreateNodeByActionNameCommand()
 //     RegisterAndTrackCommand(Command);
 // }
 
-void FBlueprintNodeCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FBlueprintNodeCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintNodeCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-    
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FBlueprintNodeCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FBlueprintNodeCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
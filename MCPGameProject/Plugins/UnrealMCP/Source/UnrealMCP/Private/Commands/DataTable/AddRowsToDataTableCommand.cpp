@@ -11,15 +11,21 @@ FAddRowsToDataTableCommand::FAddRowsToDataTableCommand(IDataTableService& InData
 }
 
 FString FAddRowsToDataTableCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FAddRowsToDataTableCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
 {
     // First validate parameters using the validation framework
-    if (!ValidateParams(Parameters))
+    if (!ValidateParams(Params))
     {
         FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
             TEXT("Parameter validation failed for add_rows_to_datatable command")
         );
         FMCPErrorHandler::LogError(ValidationError);
-        return CreateErrorResponse(TEXT("Invalid parameters for command 'add_rows_to_datatable'"));
+        Response.SetError(TEXT("Invalid parameters for command 'add_rows_to_datatable'"));
+        return;
     }
     
     // Parse parameters
@@ -27,15 +33,19 @@ FString FAddRowsToDataTableCommand::Execute(const FString& Parameters)
     TArray<FDataTableRowParams> Rows;
     FString ParseError;
     
-    if (!ParseParameters(Parameters, DataTablePath, Rows, ParseError))
+    if (!ParseParameters(Params, DataTablePath, Rows, ParseError))
     {
         FMCPError ParseErrorObj = FMCPErrorHandler::CreateInvalidParametersError(
             FString::Printf(TEXT("Failed to parse parameters: %s"), *ParseError)
         );
         FMCPErrorHandler::LogError(ParseErrorObj);
-        return CreateErrorResponse(ParseError);
+        Response.SetError(ParseError);
+        return;
     }
     
+    bool bBulk = false;
+    Params->TryGetBoolField(TEXT("bulk"), bBulk);
+    
     // Find the DataTable
     UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
     if (!DataTable)
@@ -44,13 +54,16 @@ FString FAddRowsToDataTableCommand::Execute(const FString& Parameters)
             FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
         );
         FMCPErrorHandler::LogError(NotFoundError);
-        return CreateErrorResponse(FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath));
+        Response.SetError(FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath));
+        return;
     }
     
     // Add rows using the service
     TArray<FString> AddedRows;
     TArray<FString> FailedRows;
-    bool bSuccess = DataTableService.AddRowsToDataTable(DataTable, Rows, AddedRows, FailedRows);
+    bool bSuccess = bBulk
+        ? DataTableService.ImportRowsToDataTable(DataTable, Rows, AddedRows, FailedRows)
+        : DataTableService.AddRowsToDataTable(DataTable, Rows, AddedRows, FailedRows);
     
     if (!bSuccess && AddedRows.Num() == 0)
     {
@@ -58,14 +71,15 @@ FString FAddRowsToDataTableCommand::Execute(const FString& Parameters)
             TEXT("Failed to add any rows to DataTable")
         );
         FMCPErrorHandler::LogError(ExecutionError);
-        return CreateErrorResponse(TEXT("Failed to add any rows"));
+        Response.SetError(TEXT("Failed to add any rows"));
+        return;
     }
     
     // Log successful operation
     UE_LOG(LogTemp, Log, TEXT("MCP DataTable: Successfully added %d rows to DataTable '%s'"), 
            AddedRows.Num(), *DataTablePath);
     
-    return CreateSuccessResponse(AddedRows, FailedRows);
+    Response.SetResult(CreateSuccessResponse(AddedRows, FailedRows, bBulk));
 }
 
 FString FAddRowsToDataTableCommand::GetCommandName() const
@@ -75,25 +89,21 @@ FString FAddRowsToDataTableCommand::GetCommandName() const
 
 bool FAddRowsToDataTableCommand::ValidateParams(const FString& Parameters) const
 {
-    // Parse JSON parameters
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-    {
-        return false;
-    }
-    
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FAddRowsToDataTableCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
     // Basic parameter validation - datatable_path is required
     FString DataTablePath;
-    if (!JsonObject->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
+    if (!Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
     {
         return false;
     }
     
     // Rows parameter is required and must be an array
     const TArray<TSharedPtr<FJsonValue>>* RowsArray;
-    if (!JsonObject->TryGetArrayField(TEXT("rows"), RowsArray))
+    if (!Params->TryGetArrayField(TEXT("rows"), RowsArray))
     {
         return false;
     }
@@ -101,27 +111,22 @@ bool FAddRowsToDataTableCommand::ValidateParams(const FString& Parameters) const
     // Validate each row object structure
     for (const TSharedPtr<FJsonValue>& RowValue : *RowsArray)
     {
-        TSharedPtr<FJsonObject> RowObj = RowValue->AsObject();
-        if (!RowObj.IsValid())
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!RowValue.IsValid() || !RowValue->TryGetObject(RowObj))
         {
             return false;
         }
         
         // Validate row_name field
         FString RowName;
-        if (!RowObj->TryGetStringField(TEXT("row_name"), RowName) || RowName.IsEmpty())
+        if (!(*RowObj)->TryGetStringField(TEXT("row_name"), RowName) || RowName.IsEmpty())
         {
             return false;
         }
         
         // Validate row_data field
-        if (!RowObj->HasField(TEXT("row_data")))
-        {
-            return false;
-        }
-        
-        TSharedPtr<FJsonObject> RowData = RowObj->GetObjectField(TEXT("row_data"));
-        if (!RowData.IsValid())
+        const TSharedPtr<FJsonObject>* RowData = nullptr;
+        if (!(*RowObj)->TryGetObjectField(TEXT("row_data"), RowData))
         {
             return false;
         }
@@ -130,80 +135,65 @@ bool FAddRowsToDataTableCommand::ValidateParams(const FString& Parameters) const
     return true;
 }
 
-bool FAddRowsToDataTableCommand::ParseParameters(const FString& JsonString, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const
+bool FAddRowsToDataTableCommand::ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const
 {
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-    {
-        OutError = TEXT("Invalid JSON parameters");
-        return false;
-    }
-    
     // Parse required datatable_path parameter
-    if (!JsonObject->TryGetStringField(TEXT("datatable_path"), OutDataTablePath))
+    if (!Params->TryGetStringField(TEXT("datatable_path"), OutDataTablePath))
     {
         OutError = TEXT("Missing required 'datatable_path' parameter");
         return false;
     }
     
     // Parse required rows parameter
-    if (!JsonObject->HasField(TEXT("rows")))
+    const TArray<TSharedPtr<FJsonValue>>* RowsArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("rows"), RowsArray))
     {
         OutError = TEXT("Missing required 'rows' parameter");
         return false;
     }
     
-    TArray<TSharedPtr<FJsonValue>> RowsArray = JsonObject->GetArrayField(TEXT("rows"));
-    OutRows.Empty();
+    OutRows.Empty(RowsArray->Num());
     
-    for (const TSharedPtr<FJsonValue>& RowValue : RowsArray)
+    for (const TSharedPtr<FJsonValue>& RowValue : *RowsArray)
     {
-        TSharedPtr<FJsonObject> RowObj = RowValue->AsObject();
-        if (!RowObj.IsValid())
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!RowValue.IsValid() || !RowValue->TryGetObject(RowObj))
         {
             OutError = TEXT("Invalid row object in rows array");
             return false;
         }
         
-        FDataTableRowParams RowParams;
+        FDataTableRowParams& RowParams = OutRows.AddDefaulted_GetRef();
         
         // Parse row_name
-        if (!RowObj->TryGetStringField(TEXT("row_name"), RowParams.RowName))
+        if (!(*RowObj)->TryGetStringField(TEXT("row_name"), RowParams.RowName))
         {
             OutError = TEXT("Missing 'row_name' in row object");
             return false;
         }
         
-        // Parse row_data
-        if (!RowObj->HasField(TEXT("row_data")))
+        // Parse row_data; the row data objects are shared with the request, not copied
+        const TSharedPtr<FJsonObject>* RowData = nullptr;
+        if (!(*RowObj)->TryGetObjectField(TEXT("row_data"), RowData) || !RowData->IsValid())
         {
             OutError = TEXT("Missing 'row_data' in row object");
             return false;
         }
-        
-        RowParams.RowData = RowObj->GetObjectField(TEXT("row_data"));
-        if (!RowParams.RowData.IsValid())
-        {
-            OutError = TEXT("Invalid 'row_data' in row object");
-            return false;
-        }
-        
-        OutRows.Add(RowParams);
+        RowParams.RowData = *RowData;
     }
     
     return true;
 }
 
-FString FAddRowsToDataTableCommand::CreateSuccessResponse(const TArray<FString>& AddedRows, const TArray<FString>& FailedRows) const
+TSharedRef<FJsonObject> FAddRowsToDataTableCommand::CreateSuccessResponse(const TArray<FString>& AddedRows, const TArray<FString>& FailedRows, bool bBulk) const
 {
-    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("command"), GetCommandName());
     
     // Add successfully added rows
     TArray<TSharedPtr<FJsonValue>> AddedRowsJson;
+    AddedRowsJson.Reserve(AddedRows.Num());
     for (const FString& RowName : AddedRows)
     {
         AddedRowsJson.Add(MakeShared<FJsonValueString>(RowName));
@@ -224,16 +214,12 @@ FString FAddRowsToDataTableCommand::CreateSuccessResponse(const TArray<FString>&
     // Add metadata
     TSharedPtr<FJsonObject> Metadata = MakeShared<FJsonObject>();
     Metadata->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
-    Metadata->SetStringField(TEXT("operation"), TEXT("add_rows"));
+    Metadata->SetStringField(TEXT("operation"), bBulk ? TEXT("bulk_import_rows") : TEXT("add_rows"));
     Metadata->SetNumberField(TEXT("added_count"), AddedRows.Num());
     Metadata->SetNumberField(TEXT("failed_count"), FailedRows.Num());
     ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
     
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-    
-    return OutputString;
+    return ResponseObj;
 }
 
 FString FAddRowsToDataTableCommand::CreateErrorResponse(const FString& ErrorMessage) const
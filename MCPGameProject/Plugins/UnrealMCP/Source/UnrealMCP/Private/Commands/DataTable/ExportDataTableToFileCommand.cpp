@@ -0,0 +1,107 @@
+#include "Commands/DataTable/ExportDataTableToFileCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "MCPErrorHandler.h"
+
+FExportDataTableToFileCommand::FExportDataTableToFileCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FExportDataTableToFileCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FExportDataTableToFileCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for export_datatable_to_file command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString DataTablePath = Params->GetStringField(TEXT("datatable_path"));
+    
+    FDataTableFileExportParams ExportParams;
+    ExportParams.FilePath = Params->GetStringField(TEXT("file_path"));
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+        {
+            ExportParams.Fields.Add(FieldValue->AsString());
+        }
+    }
+    
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> Report;
+    FString ExportError;
+    if (!DataTableService.ExportDataTableToFile(DataTable, ExportParams, Report, ExportError))
+    {
+        FMCPError ExecutionError = FMCPErrorHandler::CreateExecutionFailedError(ExportError);
+        FMCPErrorHandler::LogError(ExecutionError);
+        Response.SetError(ExecutionError);
+        return;
+    }
+    
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("datatable_path"), DataTable->GetPathName());
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Report->Values)
+    {
+        ResponseObj->SetField(Field.Key, Field.Value);
+    }
+    Response.SetResult(ResponseObj);
+}
+
+FString FExportDataTableToFileCommand::GetCommandName() const
+{
+    return TEXT("export_datatable_to_file");
+}
+
+bool FExportDataTableToFileCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FExportDataTableToFileCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString DataTablePath;
+    FString FilePath;
+    if (!Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty()
+        || !Params->TryGetStringField(TEXT("file_path"), FilePath) || FilePath.IsEmpty())
+    {
+        return false;
+    }
+    
+    // fields is optional, but if provided must be an array of strings
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+        {
+            if (!FieldValue.IsValid() || FieldValue->Type != EJson::String)
+            {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
@@ -0,0 +1,108 @@
+#include "Commands/DataTable/GetCompositeDataTableStackCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "MCPErrorHandler.h"
+
+FGetCompositeDataTableStackCommand::FGetCompositeDataTableStackCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FGetCompositeDataTableStackCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetCompositeDataTableStackCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for get_composite_datatable_stack command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString DataTablePath = Params->GetStringField(TEXT("datatable_path"));
+    
+    FDataTableRowQuery Query;
+    const TArray<TSharedPtr<FJsonValue>>* RowNamesArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("row_names"), RowNamesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& RowNameValue : *RowNamesArray)
+        {
+            Query.RowNames.Add(RowNameValue->AsString());
+        }
+    }
+    Params->TryGetNumberField(TEXT("offset"), Query.Offset);
+    Params->TryGetNumberField(TEXT("limit"), Query.Limit);
+    
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> StackData;
+    FString StackError;
+    if (!DataTableService.GetCompositeDataTableStack(DataTable, Query, StackData, StackError))
+    {
+        FMCPError StackErrorObj = FMCPErrorHandler::CreateInvalidParametersError(StackError);
+        FMCPErrorHandler::LogError(StackErrorObj);
+        Response.SetError(StackErrorObj);
+        return;
+    }
+    
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("datatable_path"), DataTable->GetPathName());
+    ResponseObj->Values.Append(StackData->Values);
+    Response.SetResult(ResponseObj);
+}
+
+FString FGetCompositeDataTableStackCommand::GetCommandName() const
+{
+    return TEXT("get_composite_datatable_stack");
+}
+
+bool FGetCompositeDataTableStackCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetCompositeDataTableStackCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString DataTablePath;
+    if (!Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
+    {
+        return false;
+    }
+    
+    if (Params->HasField(TEXT("row_names")))
+    {
+        const TArray<TSharedPtr<FJsonValue>>* RowNamesArray = nullptr;
+        if (!Params->TryGetArrayField(TEXT("row_names"), RowNamesArray))
+        {
+            return false;
+        }
+        for (const TSharedPtr<FJsonValue>& RowNameValue : *RowNamesArray)
+        {
+            if (!RowNameValue.IsValid() || RowNameValue->Type != EJson::String)
+            {
+                return false;
+            }
+        }
+    }
+    
+    double Number = 0.0;
+    return !(Params->TryGetNumberField(TEXT("offset"), Number) && Number < 0.0)
+        && !(Params->TryGetNumberField(TEXT("limit"), Number) && Number < 0.0);
+}
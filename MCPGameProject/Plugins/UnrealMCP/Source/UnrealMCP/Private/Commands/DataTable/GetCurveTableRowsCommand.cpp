@@ -0,0 +1,108 @@
+#include "Commands/DataTable/GetCurveTableRowsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/CurveTable.h"
+#include "MCPErrorHandler.h"
+
+FGetCurveTableRowsCommand::FGetCurveTableRowsCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FGetCurveTableRowsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetCurveTableRowsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for get_curve_table_rows command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString CurveTablePath = Params->GetStringField(TEXT("curve_table_path"));
+    
+    FDataTableRowQuery Query;
+    const TArray<TSharedPtr<FJsonValue>>* RowNamesArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("row_names"), RowNamesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& RowNameValue : *RowNamesArray)
+        {
+            Query.RowNames.Add(RowNameValue->AsString());
+        }
+    }
+    Params->TryGetNumberField(TEXT("offset"), Query.Offset);
+    Params->TryGetNumberField(TEXT("limit"), Query.Limit);
+    
+    UCurveTable* CurveTable = DataTableService.FindCurveTable(CurveTablePath);
+    if (!CurveTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("CurveTable not found: %s"), *CurveTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> RowsData;
+    FString QueryError;
+    if (!DataTableService.QueryCurveTableRows(CurveTable, Query, RowsData, QueryError))
+    {
+        FMCPError QueryErrorObj = FMCPErrorHandler::CreateInvalidParametersError(QueryError);
+        FMCPErrorHandler::LogError(QueryErrorObj);
+        Response.SetError(QueryErrorObj);
+        return;
+    }
+    
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("curve_table_path"), CurveTable->GetPathName());
+    ResponseObj->Values.Append(RowsData->Values);
+    Response.SetResult(ResponseObj);
+}
+
+FString FGetCurveTableRowsCommand::GetCommandName() const
+{
+    return TEXT("get_curve_table_rows");
+}
+
+bool FGetCurveTableRowsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetCurveTableRowsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString CurveTablePath;
+    if (!Params->TryGetStringField(TEXT("curve_table_path"), CurveTablePath) || CurveTablePath.IsEmpty())
+    {
+        return false;
+    }
+    
+    if (Params->HasField(TEXT("row_names")))
+    {
+        const TArray<TSharedPtr<FJsonValue>>* RowNamesArray = nullptr;
+        if (!Params->TryGetArrayField(TEXT("row_names"), RowNamesArray))
+        {
+            return false;
+        }
+        for (const TSharedPtr<FJsonValue>& RowNameValue : *RowNamesArray)
+        {
+            if (!RowNameValue.IsValid() || RowNameValue->Type != EJson::String)
+            {
+                return false;
+            }
+        }
+    }
+    
+    double Number = 0.0;
+    return !(Params->TryGetNumberField(TEXT("offset"), Number) && Number < 0.0)
+        && !(Params->TryGetNumberField(TEXT("limit"), Number) && Number < 0.0);
+}
@@ -0,0 +1,96 @@
+#include "Commands/DataTable/GetDataTableFingerprintCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "MCPErrorHandler.h"
+#include "Services/DataTableFingerprintIndex.h"
+
+FGetDataTableFingerprintCommand::FGetDataTableFingerprintCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FGetDataTableFingerprintCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetDataTableFingerprintCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for get_datatable_fingerprint command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString DataTablePath = Params->GetStringField(TEXT("datatable_path"));
+    bool bIncludeRows = false;
+    Params->TryGetBoolField(TEXT("include_rows"), bIncludeRows);
+    FString KnownRoot;
+    Params->TryGetStringField(TEXT("known_root"), KnownRoot);
+    
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    bool bWasCached = false;
+    const TSharedRef<const FDataTableFingerprintIndex::FFingerprint> Fingerprint = FDataTableFingerprintIndex::Get().GetFingerprint(DataTable, bWasCached);
+    const FString RootHash = FDataTableFingerprintIndex::HashToString(Fingerprint->RootHash);
+    
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("datatable_path"), DataTable->GetPathName());
+    ResponseObj->SetStringField(TEXT("root_hash"), RootHash);
+    ResponseObj->SetNumberField(TEXT("row_count"), Fingerprint->RowHashes.Num());
+    ResponseObj->SetBoolField(TEXT("cached"), bWasCached);
+    
+    // A client that already holds this root needs nothing else
+    const bool bChanged = KnownRoot.IsEmpty() || !KnownRoot.Equals(RootHash, ESearchCase::IgnoreCase);
+    if (!KnownRoot.IsEmpty())
+    {
+        ResponseObj->SetBoolField(TEXT("changed"), bChanged);
+    }
+    
+    if (bIncludeRows && bChanged)
+    {
+        TArray<TSharedPtr<FJsonValue>> RowsArray;
+        RowsArray.Reserve(Fingerprint->RowHashes.Num());
+        for (const TPair<FName, uint64>& RowHash : Fingerprint->RowHashes)
+        {
+            TSharedPtr<FJsonObject> RowObj = MakeShared<FJsonObject>();
+            RowObj->SetStringField(TEXT("row_name"), RowHash.Key.ToString());
+            RowObj->SetStringField(TEXT("hash"), FDataTableFingerprintIndex::HashToString(RowHash.Value));
+            RowsArray.Add(MakeShared<FJsonValueObject>(RowObj));
+        }
+        ResponseObj->SetArrayField(TEXT("rows"), RowsArray);
+    }
+    
+    Response.SetResult(ResponseObj);
+}
+
+FString FGetDataTableFingerprintCommand::GetCommandName() const
+{
+    return TEXT("get_datatable_fingerprint");
+}
+
+bool FGetDataTableFingerprintCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetDataTableFingerprintCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString DataTablePath;
+    return Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) && !DataTablePath.IsEmpty();
+}
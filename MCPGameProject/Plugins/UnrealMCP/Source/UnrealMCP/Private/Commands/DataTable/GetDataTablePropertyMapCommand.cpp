@@ -19,18 +19,11 @@ FString FGetDataTablePropertyMapCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(ParseError);
     }
     
-    // Find the DataTable
-    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
-    if (!DataTable)
-    {
-        return CreateErrorResponse(FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath));
-    }
-    
-    // Get property map using the service
-    TSharedPtr<FJsonObject> PropertyMap = DataTableService.GetDataTablePropertyMap(DataTable);
+    // Get property map using the service; the table is only loaded when the asset registry does not know its row struct
+    TSharedPtr<FJsonObject> PropertyMap = DataTableService.GetDataTablePropertyMap(DataTablePath);
     if (!PropertyMap.IsValid())
     {
-        return CreateErrorResponse(TEXT("Failed to get DataTable property map"));
+        return CreateErrorResponse(FString::Printf(TEXT("DataTable not found or has no row struct: %s"), *DataTablePath));
     }
     
     return CreateSuccessResponse(PropertyMap);
@@ -11,29 +11,36 @@ FGetDataTableRowsCommand::FGetDataTableRowsCommand(IDataTableService& InDataTabl
 }
 
 FString FGetDataTableRowsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetDataTableRowsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
 {
     // First validate parameters using the validation framework
-    if (!ValidateParams(Parameters))
+    if (!ValidateParams(Params))
     {
         FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
             TEXT("Parameter validation failed for get_datatable_rows command")
         );
         FMCPErrorHandler::LogError(ValidationError);
-        return FMCPErrorHandler::CreateStructuredErrorResponse(ValidationError);
+        Response.SetError(ValidationError);
+        return;
     }
     
     // Parse parameters
     FString DataTablePath;
-    TArray<FString> RowNames;
+    FDataTableRowQuery Query;
     FString ParseError;
     
-    if (!ParseParameters(Parameters, DataTablePath, RowNames, ParseError))
+    if (!ParseParameters(Params, DataTablePath, Query, ParseError))
     {
         FMCPError ParseErrorObj = FMCPErrorHandler::CreateInvalidParametersError(
             FString::Printf(TEXT("Failed to parse parameters: %s"), *ParseError)
         );
         FMCPErrorHandler::LogError(ParseErrorObj);
-        return FMCPErrorHandler::CreateStructuredErrorResponse(ParseErrorObj);
+        Response.SetError(ParseErrorObj);
+        return;
     }
     
     // Find the DataTable
@@ -44,25 +51,28 @@ FString FGetDataTableRowsCommand::Execute(const FString& Parameters)
             FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
         );
         FMCPErrorHandler::LogError(NotFoundError);
-        return FMCPErrorHandler::CreateStructuredErrorResponse(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
     }
     
-    // Get rows using the service
-    TSharedPtr<FJsonObject> RowsData = DataTableService.GetDataTableRows(DataTable, RowNames);
-    if (!RowsData.IsValid())
+    // Get one page of rows using the service
+    TSharedPtr<FJsonObject> RowsData;
+    FString QueryError;
+    if (!DataTableService.QueryDataTableRows(DataTable, Query, RowsData, QueryError))
     {
-        FMCPError ExecutionError = FMCPErrorHandler::CreateExecutionFailedError(
-            TEXT("Failed to get DataTable rows from service")
+        FMCPError ExecutionError = FMCPErrorHandler::CreateInvalidParametersError(
+            FString::Printf(TEXT("Failed to get DataTable rows: %s"), *QueryError)
         );
         FMCPErrorHandler::LogError(ExecutionError);
-        return FMCPErrorHandler::CreateStructuredErrorResponse(ExecutionError);
+        Response.SetError(ExecutionError);
+        return;
     }
     
     // Log successful operation
     UE_LOG(LogTemp, Log, TEXT("MCP DataTable: Successfully retrieved %d rows from DataTable '%s'"), 
            RowsData->GetArrayField(TEXT("rows")).Num(), *DataTablePath);
     
-    return CreateSuccessResponse(RowsData);
+    Response.SetResult(CreateSuccessResponse(RowsData));
 }
 
 FString FGetDataTableRowsCommand::GetCommandName() const
@@ -72,31 +82,27 @@ FString FGetDataTableRowsCommand::GetCommandName() const
 
 bool FGetDataTableRowsCommand::ValidateParams(const FString& Parameters) const
 {
-    // Parse JSON parameters
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
-    {
-        return false;
-    }
-    
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetDataTableRowsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
     // Basic parameter validation
     FString DataTablePath;
-    if (!JsonObject->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
+    if (!Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
     {
         return false;
     }
     
     // Additional validation - row_names is optional, but if provided must be valid array
-    if (JsonObject->HasField(TEXT("row_names")))
+    if (Params->HasField(TEXT("row_names")))
     {
         // Check if the field is null (which is valid)
-        TSharedPtr<FJsonValue> RowNamesValue = JsonObject->TryGetField(TEXT("row_names"));
+        TSharedPtr<FJsonValue> RowNamesValue = Params->TryGetField(TEXT("row_names"));
         if (RowNamesValue.IsValid() && RowNamesValue->Type != EJson::Null)
         {
             const TArray<TSharedPtr<FJsonValue>>* RowNamesArray;
-            if (!JsonObject->TryGetArrayField(TEXT("row_names"), RowNamesArray))
+            if (!Params->TryGetArrayField(TEXT("row_names"), RowNamesArray))
             {
                 return false;
             }
@@ -112,50 +118,102 @@ bool FGetDataTableRowsCommand::ValidateParams(const FString& Parameters) const
         }
     }
     
-    return true;
-}
-
-bool FGetDataTableRowsCommand::ParseParameters(const FString& JsonString, FString& OutDataTablePath, TArray<FString>& OutRowNames, FString& OutError) const
-{
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-    
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    // Paging, projection and filters are optional
+    double Number = 0.0;
+    if ((Params->TryGetNumberField(TEXT("offset"), Number) && Number < 0.0)
+        || (Params->TryGetNumberField(TEXT("limit"), Number) && Number < 0.0))
     {
-        OutError = TEXT("Invalid JSON parameters");
         return false;
     }
     
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+        {
+            if (!FieldValue.IsValid() || FieldValue->Type != EJson::String)
+            {
+                return false;
+            }
+        }
+    }
+    
+    const TArray<TSharedPtr<FJsonValue>>* FiltersArray;
+    if (Params->TryGetArrayField(TEXT("filters"), FiltersArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FilterValue : *FiltersArray)
+        {
+            const TSharedPtr<FJsonObject>* FilterObj;
+            if (!FilterValue.IsValid() || !FilterValue->TryGetObject(FilterObj) || !(*FilterObj)->HasField(TEXT("field")))
+            {
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+bool FGetDataTableRowsCommand::ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, FDataTableRowQuery& OutQuery, FString& OutError) const
+{
     // Parse required datatable_path parameter
-    if (!JsonObject->TryGetStringField(TEXT("datatable_path"), OutDataTablePath))
+    if (!Params->TryGetStringField(TEXT("datatable_path"), OutDataTablePath))
     {
         OutError = TEXT("Missing required 'datatable_path' parameter");
         return false;
     }
     
     // Parse optional row_names parameter
-    OutRowNames.Empty();
-    if (JsonObject->HasField(TEXT("row_names")))
+    OutQuery.RowNames.Empty();
+    if (Params->HasField(TEXT("row_names")))
     {
         // Check if the field is null (which means get all rows)
-        TSharedPtr<FJsonValue> RowNamesValue = JsonObject->TryGetField(TEXT("row_names"));
+        TSharedPtr<FJsonValue> RowNamesValue = Params->TryGetField(TEXT("row_names"));
         if (RowNamesValue.IsValid() && RowNamesValue->Type != EJson::Null)
         {
-            TArray<TSharedPtr<FJsonValue>> RowNamesArray = JsonObject->GetArrayField(TEXT("row_names"));
+            const TArray<TSharedPtr<FJsonValue>>& RowNamesArray = Params->GetArrayField(TEXT("row_names"));
             for (const TSharedPtr<FJsonValue>& RowNameValue : RowNamesArray)
             {
-                OutRowNames.Add(RowNameValue->AsString());
+                OutQuery.RowNames.Add(RowNameValue->AsString());
             }
         }
-        // If row_names is null, OutRowNames remains empty, which means get all rows
+        // If row_names is null, RowNames remains empty, which means get all rows
     }
     
-    return true;
+    // Parse optional paging parameters
+    Params->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    Params->TryGetNumberField(TEXT("limit"), OutQuery.Limit);
+    
+    // Parse optional field projection
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray;
+    if (Params->TryGetArrayField(TEXT("fields"), FieldsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FieldValue : *FieldsArray)
+        {
+            OutQuery.Fields.Add(FieldValue->AsString());
+        }
+    }
+    
+    // Parse optional filters: {"field": ..., "op": ..., "value": ...}
+    const TArray<TSharedPtr<FJsonValue>>* FiltersArray;
+    if (Params->TryGetArrayField(TEXT("filters"), FiltersArray))
+    {
+        for (const TSharedPtr<FJsonValue>& FilterValue : *FiltersArray)
+        {
+            const TSharedPtr<FJsonObject>& FilterObj = FilterValue->AsObject();
+            FDataTableRowFilter& Filter = OutQuery.Filters.AddDefaulted_GetRef();
+            FilterObj->TryGetStringField(TEXT("field"), Filter.Field);
+            FilterObj->TryGetStringField(TEXT("op"), Filter.Operator);
+            Filter.Value = FilterObj->TryGetField(TEXT("value"));
+        }
+    }
+    
+    return OutQuery.IsValid(OutError);
 }
 
-FString FGetDataTableRowsCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& RowsData) const
+TSharedRef<FJsonObject> FGetDataTableRowsCommand::CreateSuccessResponse(const TSharedPtr<FJsonObject>& RowsData) const
 {
-    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("command"), GetCommandName());
     
@@ -167,13 +225,18 @@ FString FGetDataTableRowsCommand::CreateSuccessResponse(const TSharedPtr<FJsonOb
     Metadata->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
     Metadata->SetStringField(TEXT("operation"), TEXT("get_rows"));
     Metadata->SetNumberField(TEXT("row_count"), RowsData->GetArrayField(TEXT("rows")).Num());
+    Metadata->SetNumberField(TEXT("total_rows"), RowsData->GetNumberField(TEXT("total_rows")));
+    Metadata->SetNumberField(TEXT("matched_count"), RowsData->GetNumberField(TEXT("matched_count")));
+    Metadata->SetNumberField(TEXT("offset"), RowsData->GetNumberField(TEXT("offset")));
+    Metadata->SetBoolField(TEXT("has_more"), RowsData->GetBoolField(TEXT("has_more")));
+    int32 NextOffset = 0;
+    if (RowsData->TryGetNumberField(TEXT("next_offset"), NextOffset))
+    {
+        Metadata->SetNumberField(TEXT("next_offset"), NextOffset);
+    }
     ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
     
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
-    
-    return OutputString;
+    return ResponseObj;
 }
 
 FString FGetDataTableRowsCommand::CreateErrorResponse(const FString& ErrorMessage) const
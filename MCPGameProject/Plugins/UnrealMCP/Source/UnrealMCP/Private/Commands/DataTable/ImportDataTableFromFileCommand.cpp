@@ -0,0 +1,97 @@
+#include "Commands/DataTable/ImportDataTableFromFileCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "MCPErrorHandler.h"
+
+FImportDataTableFromFileCommand::FImportDataTableFromFileCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FImportDataTableFromFileCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FImportDataTableFromFileCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for import_datatable_from_file command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString DataTablePath = Params->GetStringField(TEXT("datatable_path"));
+    
+    FDataTableFileImportParams ImportParams;
+    ImportParams.FilePath = Params->GetStringField(TEXT("file_path"));
+    Params->TryGetStringField(TEXT("format"), ImportParams.Format);
+    ImportParams.Format = ImportParams.Format.ToLower();
+    Params->TryGetNumberField(TEXT("max_reported_failures"), ImportParams.MaxReportedFailures);
+    
+    FString ValidationMessage;
+    if (!ImportParams.IsValid(ValidationMessage))
+    {
+        Response.SetError(FMCPErrorHandler::CreateInvalidParametersError(ValidationMessage));
+        return;
+    }
+    
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> Report;
+    FString ImportError;
+    const bool bImported = DataTableService.ImportRowsFromFile(DataTable, ImportParams, Report, ImportError);
+    if (!bImported && !Report.IsValid())
+    {
+        FMCPError ExecutionError = FMCPErrorHandler::CreateExecutionFailedError(ImportError);
+        FMCPErrorHandler::LogError(ExecutionError);
+        Response.SetError(ExecutionError);
+        return;
+    }
+    
+    // A read error part way through still reports the rows imported before it
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), bImported);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("datatable_path"), DataTable->GetPathName());
+    if (!bImported)
+    {
+        ResponseObj->SetStringField(TEXT("error"), ImportError);
+    }
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Report->Values)
+    {
+        ResponseObj->SetField(Field.Key, Field.Value);
+    }
+    Response.SetResult(ResponseObj);
+}
+
+FString FImportDataTableFromFileCommand::GetCommandName() const
+{
+    return TEXT("import_datatable_from_file");
+}
+
+bool FImportDataTableFromFileCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FImportDataTableFromFileCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString DataTablePath;
+    FString FilePath;
+    return Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) && !DataTablePath.IsEmpty()
+        && Params->TryGetStringField(TEXT("file_path"), FilePath) && !FilePath.IsEmpty();
+}
@@ -0,0 +1,199 @@
+#include "Commands/DataTable/UpsertDataTableRowsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/DataTable.h"
+#include "MCPErrorHandler.h"
+
+FUpsertDataTableRowsCommand::FUpsertDataTableRowsCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FUpsertDataTableRowsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FUpsertDataTableRowsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for upsert_datatable_rows command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    // Parse parameters
+    FString DataTablePath;
+    TArray<FDataTableRowParams> Rows;
+    FString ParseError;
+    
+    if (!ParseParameters(Params, DataTablePath, Rows, ParseError))
+    {
+        FMCPError ParseErrorObj = FMCPErrorHandler::CreateInvalidParametersError(
+            FString::Printf(TEXT("Failed to parse parameters: %s"), *ParseError)
+        );
+        FMCPErrorHandler::LogError(ParseErrorObj);
+        Response.SetError(ParseErrorObj);
+        return;
+    }
+    
+    // Find the DataTable
+    UDataTable* DataTable = DataTableService.FindDataTable(DataTablePath);
+    if (!DataTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("DataTable not found: %s"), *DataTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    FDataTableUpsertResult Result;
+    DataTableService.UpsertRowsInDataTable(DataTable, Rows, Result);
+    
+    if (Rows.Num() > 0 && Result.FailedRows.Num() == Rows.Num())
+    {
+        FMCPError ExecutionError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("Failed to upsert any rows: %s"), *Result.FailedRows[0])
+        );
+        FMCPErrorHandler::LogError(ExecutionError);
+        Response.SetError(ExecutionError);
+        return;
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("MCP DataTable: Upserted rows into DataTable '%s': %d added, %d updated, %d unchanged"),
+           *DataTablePath, Result.AddedRows.Num(), Result.UpdatedRows.Num(), Result.UnchangedRows.Num());
+    
+    Response.SetResult(CreateSuccessResponse(Result));
+}
+
+FString FUpsertDataTableRowsCommand::GetCommandName() const
+{
+    return TEXT("upsert_datatable_rows");
+}
+
+bool FUpsertDataTableRowsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FUpsertDataTableRowsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString DataTablePath;
+    if (!Params->TryGetStringField(TEXT("datatable_path"), DataTablePath) || DataTablePath.IsEmpty())
+    {
+        return false;
+    }
+    
+    const TArray<TSharedPtr<FJsonValue>>* RowsArray;
+    if (!Params->TryGetArrayField(TEXT("rows"), RowsArray))
+    {
+        return false;
+    }
+    
+    for (const TSharedPtr<FJsonValue>& RowValue : *RowsArray)
+    {
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!RowValue.IsValid() || !RowValue->TryGetObject(RowObj))
+        {
+            return false;
+        }
+        
+        FString RowName;
+        const TSharedPtr<FJsonObject>* RowData = nullptr;
+        if (!(*RowObj)->TryGetStringField(TEXT("row_name"), RowName) || RowName.IsEmpty()
+            || !(*RowObj)->TryGetObjectField(TEXT("row_data"), RowData))
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+bool FUpsertDataTableRowsCommand::ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const
+{
+    if (!Params->TryGetStringField(TEXT("datatable_path"), OutDataTablePath))
+    {
+        OutError = TEXT("Missing required 'datatable_path' parameter");
+        return false;
+    }
+    
+    const TArray<TSharedPtr<FJsonValue>>* RowsArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("rows"), RowsArray))
+    {
+        OutError = TEXT("Missing required 'rows' parameter");
+        return false;
+    }
+    
+    OutRows.Empty(RowsArray->Num());
+    
+    for (const TSharedPtr<FJsonValue>& RowValue : *RowsArray)
+    {
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!RowValue.IsValid() || !RowValue->TryGetObject(RowObj))
+        {
+            OutError = TEXT("Invalid row object in rows array");
+            return false;
+        }
+        
+        FDataTableRowParams& RowParams = OutRows.AddDefaulted_GetRef();
+        if (!(*RowObj)->TryGetStringField(TEXT("row_name"), RowParams.RowName))
+        {
+            OutError = TEXT("Missing 'row_name' in row object");
+            return false;
+        }
+        
+        // The row data objects are shared with the request, not copied
+        const TSharedPtr<FJsonObject>* RowData = nullptr;
+        if (!(*RowObj)->TryGetObjectField(TEXT("row_data"), RowData) || !RowData->IsValid())
+        {
+            OutError = TEXT("Missing 'row_data' in row object");
+            return false;
+        }
+        RowParams.RowData = *RowData;
+    }
+    
+    return true;
+}
+
+TSharedRef<FJsonObject> FUpsertDataTableRowsCommand::CreateSuccessResponse(const FDataTableUpsertResult& Result) const
+{
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    
+    auto ToJsonArray = [](const TArray<FString>& Names)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Names.Num());
+        for (const FString& Name : Names)
+        {
+            Values.Add(MakeShared<FJsonValueString>(Name));
+        }
+        return Values;
+    };
+    
+    ResponseObj->SetArrayField(TEXT("added_rows"), ToJsonArray(Result.AddedRows));
+    ResponseObj->SetArrayField(TEXT("updated_rows"), ToJsonArray(Result.UpdatedRows));
+    if (Result.FailedRows.Num() > 0)
+    {
+        ResponseObj->SetArrayField(TEXT("failed_rows"), ToJsonArray(Result.FailedRows));
+    }
+    
+    TSharedPtr<FJsonObject> Metadata = MakeShared<FJsonObject>();
+    Metadata->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Metadata->SetStringField(TEXT("operation"), TEXT("upsert_rows"));
+    Metadata->SetNumberField(TEXT("added_count"), Result.AddedRows.Num());
+    Metadata->SetNumberField(TEXT("updated_count"), Result.UpdatedRows.Num());
+    Metadata->SetNumberField(TEXT("unchanged_count"), Result.UnchangedRows.Num());
+    Metadata->SetNumberField(TEXT("failed_count"), Result.FailedRows.Num());
+    Metadata->SetNumberField(TEXT("changed_field_count"), Result.ChangedFieldCount);
+    ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
+    
+    return ResponseObj;
+}
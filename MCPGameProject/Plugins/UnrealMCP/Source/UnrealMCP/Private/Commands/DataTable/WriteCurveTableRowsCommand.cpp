@@ -0,0 +1,168 @@
+#include "Commands/DataTable/WriteCurveTableRowsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Engine/CurveTable.h"
+#include "MCPErrorHandler.h"
+
+FWriteCurveTableRowsCommand::FWriteCurveTableRowsCommand(IDataTableService& InDataTableService)
+    : DataTableService(InDataTableService)
+{
+}
+
+FString FWriteCurveTableRowsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FWriteCurveTableRowsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    if (!ValidateParams(Params))
+    {
+        FMCPError ValidationError = FMCPErrorHandler::CreateValidationFailedError(
+            TEXT("Parameter validation failed for write_curve_table_rows command")
+        );
+        FMCPErrorHandler::LogError(ValidationError);
+        Response.SetError(ValidationError);
+        return;
+    }
+    
+    const FString CurveTablePath = Params->GetStringField(TEXT("curve_table_path"));
+    
+    TArray<FCurveTableRowParams> Rows;
+    FString ParseError;
+    if (!ParseRows(Params, Rows, ParseError))
+    {
+        FMCPError ParseErrorObj = FMCPErrorHandler::CreateInvalidParametersError(
+            FString::Printf(TEXT("Failed to parse parameters: %s"), *ParseError)
+        );
+        FMCPErrorHandler::LogError(ParseErrorObj);
+        Response.SetError(ParseErrorObj);
+        return;
+    }
+    
+    UCurveTable* CurveTable = DataTableService.FindCurveTable(CurveTablePath);
+    if (!CurveTable)
+    {
+        FMCPError NotFoundError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("CurveTable not found: %s"), *CurveTablePath)
+        );
+        FMCPErrorHandler::LogError(NotFoundError);
+        Response.SetError(NotFoundError);
+        return;
+    }
+    
+    FDataTableUpsertResult Result;
+    DataTableService.WriteCurveTableRows(CurveTable, Rows, Result);
+    
+    if (Rows.Num() > 0 && Result.FailedRows.Num() == Rows.Num())
+    {
+        FMCPError ExecutionError = FMCPErrorHandler::CreateExecutionFailedError(
+            FString::Printf(TEXT("Failed to write any rows: %s"), *Result.FailedRows[0])
+        );
+        FMCPErrorHandler::LogError(ExecutionError);
+        Response.SetError(ExecutionError);
+        return;
+    }
+    
+    auto ToJsonArray = [](const TArray<FString>& Names)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Names.Num());
+        for (const FString& Name : Names)
+        {
+            Values.Add(MakeShared<FJsonValueString>(Name));
+        }
+        return Values;
+    };
+    
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("command"), GetCommandName());
+    ResponseObj->SetStringField(TEXT("curve_table_path"), CurveTable->GetPathName());
+    ResponseObj->SetArrayField(TEXT("added_rows"), ToJsonArray(Result.AddedRows));
+    ResponseObj->SetArrayField(TEXT("updated_rows"), ToJsonArray(Result.UpdatedRows));
+    if (Result.FailedRows.Num() > 0)
+    {
+        ResponseObj->SetArrayField(TEXT("failed_rows"), ToJsonArray(Result.FailedRows));
+    }
+    
+    TSharedPtr<FJsonObject> Metadata = MakeShared<FJsonObject>();
+    Metadata->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Metadata->SetStringField(TEXT("operation"), TEXT("write_curve_rows"));
+    Metadata->SetNumberField(TEXT("added_count"), Result.AddedRows.Num());
+    Metadata->SetNumberField(TEXT("updated_count"), Result.UpdatedRows.Num());
+    Metadata->SetNumberField(TEXT("unchanged_count"), Result.UnchangedRows.Num());
+    Metadata->SetNumberField(TEXT("failed_count"), Result.FailedRows.Num());
+    Metadata->SetNumberField(TEXT("written_key_count"), Result.ChangedFieldCount);
+    ResponseObj->SetObjectField(TEXT("metadata"), Metadata);
+    
+    Response.SetResult(ResponseObj);
+}
+
+FString FWriteCurveTableRowsCommand::GetCommandName() const
+{
+    return TEXT("write_curve_table_rows");
+}
+
+bool FWriteCurveTableRowsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FWriteCurveTableRowsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    FString CurveTablePath;
+    const TArray<TSharedPtr<FJsonValue>>* RowsArray = nullptr;
+    return Params->TryGetStringField(TEXT("curve_table_path"), CurveTablePath) && !CurveTablePath.IsEmpty()
+        && Params->TryGetArrayField(TEXT("rows"), RowsArray);
+}
+
+bool FWriteCurveTableRowsCommand::ParseRows(const TSharedRef<FJsonObject>& Params, TArray<FCurveTableRowParams>& OutRows, FString& OutError) const
+{
+    const TArray<TSharedPtr<FJsonValue>>& RowsArray = Params->GetArrayField(TEXT("rows"));
+    OutRows.Empty(RowsArray.Num());
+    
+    auto ParseNumbers = [](const TSharedPtr<FJsonObject>& RowObj, const TCHAR* FieldName, TArray<float>& OutNumbers)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Numbers = nullptr;
+        if (!RowObj->TryGetArrayField(FieldName, Numbers))
+        {
+            return false;
+        }
+        OutNumbers.Reserve(Numbers->Num());
+        for (const TSharedPtr<FJsonValue>& Number : *Numbers)
+        {
+            double Value = 0.0;
+            if (!Number.IsValid() || !Number->TryGetNumber(Value))
+            {
+                return false;
+            }
+            OutNumbers.Add(static_cast<float>(Value));
+        }
+        return true;
+    };
+    
+    for (const TSharedPtr<FJsonValue>& RowValue : RowsArray)
+    {
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!RowValue.IsValid() || !RowValue->TryGetObject(RowObj))
+        {
+            OutError = TEXT("Invalid row object in rows array");
+            return false;
+        }
+        
+        FCurveTableRowParams& Row = OutRows.AddDefaulted_GetRef();
+        if (!(*RowObj)->TryGetStringField(TEXT("row_name"), Row.RowName))
+        {
+            OutError = TEXT("Missing 'row_name' in row object");
+            return false;
+        }
+        if (!ParseNumbers(*RowObj, TEXT("times"), Row.Times) || !ParseNumbers(*RowObj, TEXT("values"), Row.Values))
+        {
+            OutError = FString::Printf(TEXT("Row '%s' needs 'times' and 'values' arrays of numbers"), *Row.RowName);
+            return false;
+        }
+        (*RowObj)->TryGetStringField(TEXT("interp_mode"), Row.InterpMode);
+    }
+    
+    return true;
+}
@@ -11,8 +11,15 @@
 #include "Commands/DataTable/DeleteDataTableRowsCommand.h"
 #include "Commands/DataTable/GetDataTableRowNamesCommand.h"
 #include "Commands/DataTable/GetDataTablePropertyMapCommand.h"
+#include "Commands/DataTable/ImportDataTableFromFileCommand.h"
+#include "Commands/DataTable/ExportDataTableToFileCommand.h"
+#include "Commands/DataTable/UpsertDataTableRowsCommand.h"
+#include "Commands/DataTable/GetDataTableFingerprintCommand.h"
+#include "Commands/DataTable/GetCompositeDataTableStackCommand.h"
+#include "Commands/DataTable/GetCurveTableRowsCommand.h"
+#include "Commands/DataTable/WriteCurveTableRowsCommand.h"
 
-TArray<TSharedPtr<IUnrealMCPCommand>> FDataTableCommandRegistration::RegisteredCommands;
+TArray<FString> FDataTableCommandRegistration::RegisteredCommandNames;
 
 void FDataTableCommandRegistration::RegisterAllCommands()
 {
@@ -21,19 +28,23 @@ void FDataTableCommandRegistration::RegisterAllCommands()
     // Create shared pointer to the DataTable service for the new architecture
     TSharedPtr<IDataTableService> DataTableServicePtr = MakeShared<FDataTableService>();
     
-    // Get reference to the service for old architecture commands
-    IDataTableService& DataTableServiceRef = *DataTableServicePtr;
-    
     // Register DataTable manipulation commands (mixed old/new architecture)
-    RegisterAndTrackCommand(MakeShared<FCreateDataTableCommand>(DataTableServiceRef));
-    RegisterAndTrackCommand(MakeShared<FAddRowsToDataTableCommand>(DataTableServiceRef));
-    RegisterAndTrackCommand(MakeShared<FGetDataTableRowsCommand>(DataTableServiceRef));
-    RegisterAndTrackCommand(MakeShared<FUpdateRowsInDataTableCommand>(DataTableServiceRef));
-    RegisterAndTrackCommand(MakeShared<FDeleteDataTableRowsCommand>(DataTableServicePtr)); // NEW ARCHITECTURE
-    RegisterAndTrackCommand(MakeShared<FGetDataTableRowNamesCommand>(DataTableServiceRef));
-    RegisterAndTrackCommand(MakeShared<FGetDataTablePropertyMapCommand>(DataTableServiceRef));
+    RegisterAndTrackCommand(TEXT("create_datatable"), [DataTableServicePtr]() { return MakeShared<FCreateDataTableCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("add_rows_to_datatable"), [DataTableServicePtr]() { return MakeShared<FAddRowsToDataTableCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("get_datatable_rows"), [DataTableServicePtr]() { return MakeShared<FGetDataTableRowsCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("update_rows_in_datatable"), [DataTableServicePtr]() { return MakeShared<FUpdateRowsInDataTableCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("delete_datatable_rows"), [DataTableServicePtr]() { return MakeShared<FDeleteDataTableRowsCommand>(DataTableServicePtr); }); // NEW ARCHITECTURE
+    RegisterAndTrackCommand(TEXT("get_datatable_row_names"), [DataTableServicePtr]() { return MakeShared<FGetDataTableRowNamesCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("get_datatable_property_map"), [DataTableServicePtr]() { return MakeShared<FGetDataTablePropertyMapCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("import_datatable_from_file"), [DataTableServicePtr]() { return MakeShared<FImportDataTableFromFileCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("export_datatable_to_file"), [DataTableServicePtr]() { return MakeShared<FExportDataTableToFileCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("upsert_datatable_rows"), [DataTableServicePtr]() { return MakeShared<FUpsertDataTableRowsCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("get_datatable_fingerprint"), [DataTableServicePtr]() { return MakeShared<FGetDataTableFingerprintCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("get_composite_datatable_stack"), [DataTableServicePtr]() { return MakeShared<FGetCompositeDataTableStackCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("get_curve_table_rows"), [DataTableServicePtr]() { return MakeShared<FGetCurveTableRowsCommand>(*DataTableServicePtr); });
+    RegisterAndTrackCommand(TEXT("write_curve_table_rows"), [DataTableServicePtr]() { return MakeShared<FWriteCurveTableRowsCommand>(*DataTableServicePtr); });
     
-    UE_LOG(LogTemp, Log, TEXT("Registered %d DataTable commands"), RegisteredCommands.Num());
+    UE_LOG(LogTemp, Log, TEXT("Registered %d DataTable commands"), RegisteredCommandNames.Num());
 }
 
 void FDataTableCommandRegistration::UnregisterAllCommands()
@@ -42,35 +53,26 @@ void FDataTableCommandRegistration::UnregisterAllCommands()
     
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
     
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
-        {
-            Registry.UnregisterCommand(Command->GetCommandName());
-        }
+        Registry.UnregisterCommand(CommandName);
     }
     
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     UE_LOG(LogTemp, Log, TEXT("Unregistered all DataTable commands"));
 }
 
-void FDataTableCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FDataTableCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("Attempted to register invalid DataTable command"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    
-    if (Registry.RegisterCommand(Command))
+
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("Registered DataTable command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("Registered DataTable command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to register DataTable command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Error, TEXT("Failed to register DataTable command: %s"), *CommandName);
     }
 }
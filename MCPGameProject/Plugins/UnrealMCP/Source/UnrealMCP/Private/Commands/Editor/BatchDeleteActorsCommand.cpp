@@ -12,9 +12,10 @@ FBatchDeleteActorsCommand::FBatchDeleteActorsCommand(IEditorService& InEditorSer
 FString FBatchDeleteActorsCommand::Execute(const FString& Parameters)
 {
     TArray<FString> ActorNames;
+    bool bCollectGarbage = false;
     FString Error;
 
-    if (!ParseParameters(Parameters, ActorNames, Error))
+    if (!ParseParameters(Parameters, ActorNames, bCollectGarbage, Error))
     {
         return CreateErrorResponse(Error);
     }
@@ -24,30 +25,22 @@ FString FBatchDeleteActorsCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("No actor names provided"));
     }
 
+    // All actors go to the editor in one delete and one undo transaction
+    TArray<FString> Errors;
+    EditorService.DeleteActors(ActorNames, bCollectGarbage, Errors);
+
     TArray<TSharedPtr<FJsonObject>> Results;
+    Results.Reserve(ActorNames.Num());
     int32 SuccessCount = 0;
     int32 FailedCount = 0;
 
-    for (const FString& ActorName : ActorNames)
+    for (int32 NameIndex = 0; NameIndex < ActorNames.Num(); ++NameIndex)
     {
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-        ResultObj->SetStringField(TEXT("name"), ActorName);
-
-        // Check if actor exists
-        AActor* Actor = EditorService.FindActorByName(ActorName);
-        if (!Actor)
-        {
-            ResultObj->SetBoolField(TEXT("success"), false);
-            ResultObj->SetBoolField(TEXT("deleted"), false);
-            ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Actor not found: %s"), *ActorName));
-            FailedCount++;
-            Results.Add(ResultObj);
-            continue;
-        }
+        ResultObj->SetStringField(TEXT("name"), ActorNames[NameIndex]);
 
-        // Attempt deletion
-        FString DeleteError;
-        if (EditorService.DeleteActor(ActorName, DeleteError))
+        const FString& DeleteError = Errors[NameIndex];
+        if (DeleteError.IsEmpty())
         {
             ResultObj->SetBoolField(TEXT("success"), true);
             ResultObj->SetBoolField(TEXT("deleted"), true);
@@ -75,11 +68,12 @@ FString FBatchDeleteActorsCommand::GetCommandName() const
 bool FBatchDeleteActorsCommand::ValidateParams(const FString& Parameters) const
 {
     TArray<FString> ActorNames;
+    bool bCollectGarbage = false;
     FString Error;
-    return ParseParameters(Parameters, ActorNames, Error);
+    return ParseParameters(Parameters, ActorNames, bCollectGarbage, Error);
 }
 
-bool FBatchDeleteActorsCommand::ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames, FString& OutError) const
+bool FBatchDeleteActorsCommand::ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames, bool& bOutCollectGarbage, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -108,6 +102,9 @@ bool FBatchDeleteActorsCommand::ParseParameters(const FString& JsonString, TArra
         }
     }
 
+    // Optional: reclaim the deleted actors with one full collection on the next tick
+    JsonObject->TryGetBoolField(TEXT("collect_garbage"), bOutCollectGarbage);
+
     return true;
 }
 
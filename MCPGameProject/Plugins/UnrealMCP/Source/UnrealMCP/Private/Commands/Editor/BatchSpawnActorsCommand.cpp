@@ -1,5 +1,6 @@
 #include "Commands/Editor/BatchSpawnActorsCommand.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "GameFramework/Actor.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -12,9 +13,10 @@ FBatchSpawnActorsCommand::FBatchSpawnActorsCommand(IEditorService& InEditorServi
 FString FBatchSpawnActorsCommand::Execute(const FString& Parameters)
 {
     TArray<TSharedPtr<FJsonObject>> ActorConfigs;
+    FBatchSpawnOptions Options;
     FString Error;
 
-    if (!ParseParameters(Parameters, ActorConfigs, Error))
+    if (!ParseParameters(Parameters, ActorConfigs, Options, Error))
     {
         return CreateErrorResponse(Error);
     }
@@ -25,12 +27,29 @@ FString FBatchSpawnActorsCommand::Execute(const FString& Parameters)
     }
 
     TArray<TSharedPtr<FJsonObject>> Results;
+    Results.Reserve(ActorConfigs.Num());
     int32 SuccessCount = 0;
     int32 FailedCount = 0;
 
+    // Configs that parsed, with the result each one fills in
+    TArray<FActorSpawnParams> SpawnParamsList;
+    TArray<TSharedPtr<FJsonObject>> SpawnResults;
+
+    // Static meshes placed as instances, grouped by mesh
+    struct FInstanceResult
+    {
+        TSharedPtr<FJsonObject> Result;
+        int32 GroupIndex;
+        int32 InstanceIndex;
+    };
+    TArray<FInstancedMeshGroup> InstanceGroups;
+    TMap<FString, int32> GroupIndexByMesh;
+    TArray<FInstanceResult> InstanceResults;
+
     for (const TSharedPtr<FJsonObject>& ActorConfig : ActorConfigs)
     {
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        Results.Add(ResultObj);
 
         // Get actor name for result tracking
         FString ActorName;
@@ -45,29 +64,89 @@ FString FBatchSpawnActorsCommand::Execute(const FString& Parameters)
             ResultObj->SetBoolField(TEXT("success"), false);
             ResultObj->SetStringField(TEXT("error"), ParseError);
             FailedCount++;
-            Results.Add(ResultObj);
             continue;
         }
 
-        // Attempt to spawn the actor
-        FString SpawnError;
-        AActor* SpawnedActor = EditorService.SpawnActor(SpawnParams, SpawnError);
-        if (SpawnedActor)
+        if (!Options.Instancing.IsEmpty() && SpawnParams.Type == TEXT("StaticMeshActor") && !SpawnParams.MeshPath.IsEmpty())
+        {
+            int32& GroupIndex = GroupIndexByMesh.FindOrAdd(SpawnParams.MeshPath, INDEX_NONE);
+            if (GroupIndex == INDEX_NONE)
+            {
+                GroupIndex = InstanceGroups.Num();
+                InstanceGroups.AddDefaulted_GetRef().MeshPath = SpawnParams.MeshPath;
+            }
+            InstanceResults.Add({ ResultObj, GroupIndex, InstanceGroups[GroupIndex].Transforms.Num() });
+            InstanceGroups[GroupIndex].Transforms.Add(FTransform(SpawnParams.Rotation, SpawnParams.Location, SpawnParams.Scale));
+            continue;
+        }
+
+        SpawnParamsList.Add(MoveTemp(SpawnParams));
+        SpawnResults.Add(ResultObj);
+    }
+
+    if (InstanceGroups.Num() > 0)
+    {
+        TArray<FString> ComponentNames;
+        FString InstanceError;
+        const AActor* InstancedActor = EditorService.SpawnInstancedMeshActor(Options.InstancedActorName, InstanceGroups,
+            Options.Instancing == TEXT("hism"), ComponentNames, InstanceError);
+        for (const FInstanceResult& Instance : InstanceResults)
+        {
+            Instance.Result->SetBoolField(TEXT("success"), InstancedActor != nullptr);
+            if (InstancedActor)
+            {
+                Instance.Result->SetStringField(TEXT("instanced_in"), Options.InstancedActorName);
+                Instance.Result->SetStringField(TEXT("component"), ComponentNames[Instance.GroupIndex]);
+                Instance.Result->SetNumberField(TEXT("instance_index"), Instance.InstanceIndex);
+                SuccessCount++;
+            }
+            else
+            {
+                Instance.Result->SetStringField(TEXT("error"), InstanceError);
+                FailedCount++;
+            }
+        }
+    }
+
+    TArray<AActor*> SpawnedActors;
+    TArray<FString> SpawnErrors;
+    if (Options.bDeferred)
+    {
+        SpawnedActors = EditorService.SpawnActorsDeferred(SpawnParamsList, SpawnErrors);
+    }
+    else
+    {
+        SpawnedActors.Reserve(SpawnParamsList.Num());
+        SpawnErrors.SetNum(SpawnParamsList.Num());
+        for (int32 Index = 0; Index < SpawnParamsList.Num(); ++Index)
+        {
+            SpawnedActors.Add(EditorService.SpawnActor(SpawnParamsList[Index], SpawnErrors[Index]));
+        }
+    }
+
+    for (int32 Index = 0; Index < SpawnParamsList.Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>& ResultObj = SpawnResults[Index];
+        if (AActor* SpawnedActor = SpawnedActors[Index])
         {
             ResultObj->SetBoolField(TEXT("success"), true);
-            // Include actor details in response
-            TSharedPtr<FJsonObject> ActorJson = FUnrealMCPCommonUtils::ActorToJsonObject(SpawnedActor, true);
-            ResultObj->SetObjectField(TEXT("actor"), ActorJson);
+            if (Options.bIncludeDetails)
+            {
+                // Include actor details in response
+                ResultObj->SetObjectField(TEXT("actor"), FUnrealMCPCommonUtils::ActorToJsonObject(SpawnedActor, true));
+            }
+            else
+            {
+                ResultObj->SetStringField(TEXT("path"), SpawnedActor->GetPathName());
+            }
             SuccessCount++;
         }
         else
         {
             ResultObj->SetBoolField(TEXT("success"), false);
-            ResultObj->SetStringField(TEXT("error"), SpawnError);
+            ResultObj->SetStringField(TEXT("error"), SpawnErrors[Index]);
             FailedCount++;
         }
-
-        Results.Add(ResultObj);
     }
 
     return CreateSuccessResponse(Results, ActorConfigs.Num(), SuccessCount, FailedCount);
@@ -81,11 +160,12 @@ FString FBatchSpawnActorsCommand::GetCommandName() const
 bool FBatchSpawnActorsCommand::ValidateParams(const FString& Parameters) const
 {
     TArray<TSharedPtr<FJsonObject>> ActorConfigs;
+    FBatchSpawnOptions Options;
     FString Error;
-    return ParseParameters(Parameters, ActorConfigs, Error);
+    return ParseParameters(Parameters, ActorConfigs, Options, Error);
 }
 
-bool FBatchSpawnActorsCommand::ParseParameters(const FString& JsonString, TArray<TSharedPtr<FJsonObject>>& OutActorConfigs, FString& OutError) const
+bool FBatchSpawnActorsCommand::ParseParameters(const FString& JsonString, TArray<TSharedPtr<FJsonObject>>& OutActorConfigs, FBatchSpawnOptions& OutOptions, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -113,6 +193,31 @@ bool FBatchSpawnActorsCommand::ParseParameters(const FString& JsonString, TArray
         }
     }
 
+    // Deferred batches are meant for large layouts, so full actor details are opt-in there
+    JsonObject->TryGetBoolField(TEXT("deferred"), OutOptions.bDeferred);
+    OutOptions.bIncludeDetails = !OutOptions.bDeferred;
+    JsonObject->TryGetBoolField(TEXT("include_details"), OutOptions.bIncludeDetails);
+
+    if (JsonObject->TryGetStringField(TEXT("instancing"), OutOptions.Instancing))
+    {
+        OutOptions.Instancing = OutOptions.Instancing.ToLower();
+        if (OutOptions.Instancing == TEXT("none"))
+        {
+            OutOptions.Instancing.Reset();
+        }
+        else if (!OutOptions.Instancing.IsEmpty() && OutOptions.Instancing != TEXT("ism") && OutOptions.Instancing != TEXT("hism"))
+        {
+            OutError = FString::Printf(TEXT("Invalid instancing '%s'; expected 'ism' or 'hism'"), *OutOptions.Instancing);
+            return false;
+        }
+    }
+    JsonObject->TryGetStringField(TEXT("instanced_actor_name"), OutOptions.InstancedActorName);
+    if (!OutOptions.Instancing.IsEmpty() && OutOptions.InstancedActorName.IsEmpty())
+    {
+        OutError = TEXT("'instanced_actor_name' must not be empty");
+        return false;
+    }
+
     return true;
 }
 
@@ -0,0 +1,126 @@
+#include "Commands/Editor/ConvertActorsToInstancesCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "GameFramework/Actor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FConvertActorsToInstancesCommand::FConvertActorsToInstancesCommand(IEditorService& InEditorService)
+    : EditorService(InEditorService)
+{
+}
+
+FString FConvertActorsToInstancesCommand::Execute(const FString& Parameters)
+{
+    FConvertParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<FString> Converted;
+    TArray<FString> Skipped;
+    AActor* InstancedActor = EditorService.ConvertActorsToInstances(Params.ActorNames, Params.InstancedActorName,
+        Params.bHierarchical, Params.bDeleteSourceActors, Converted, Skipped, Error);
+    if (!InstancedActor)
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    auto ToJsonArray = [](const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShared<FJsonValueString>(String));
+        }
+        return Values;
+    };
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetObjectField(TEXT("instanced_actor"), FUnrealMCPCommonUtils::ActorToJsonObject(InstancedActor, true));
+    ResponseObj->SetArrayField(TEXT("converted"), ToJsonArray(Converted));
+    ResponseObj->SetArrayField(TEXT("skipped"), ToJsonArray(Skipped));
+    ResponseObj->SetBoolField(TEXT("source_actors_deleted"), Params.bDeleteSourceActors);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FConvertActorsToInstancesCommand::GetCommandName() const
+{
+    return TEXT("convert_actors_to_instances");
+}
+
+bool FConvertActorsToInstancesCommand::ValidateParams(const FString& Parameters) const
+{
+    FConvertParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FConvertActorsToInstancesCommand::ParseParameters(const FString& JsonString, FConvertParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray;
+    if (!JsonObject->TryGetArrayField(TEXT("actor_names"), NamesArray))
+    {
+        OutError = TEXT("Missing 'actor_names' array parameter");
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Value : *NamesArray)
+    {
+        FString Name;
+        if (Value.IsValid() && Value->TryGetString(Name))
+        {
+            OutParams.ActorNames.Add(Name);
+        }
+    }
+
+    if (OutParams.ActorNames.Num() == 0)
+    {
+        OutError = TEXT("No actor names provided");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("instanced_actor_name"), OutParams.InstancedActorName);
+    if (OutParams.InstancedActorName.IsEmpty())
+    {
+        OutError = TEXT("'instanced_actor_name' must not be empty");
+        return false;
+    }
+
+    JsonObject->TryGetBoolField(TEXT("hierarchical"), OutParams.bHierarchical);
+    JsonObject->TryGetBoolField(TEXT("delete_source_actors"), OutParams.bDeleteSourceActors);
+
+    return true;
+}
+
+FString FConvertActorsToInstancesCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -0,0 +1,340 @@
+#include "Commands/Editor/ExecuteBatchCommand.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "MCPErrorHandler.h"
+#include "MCPBatchOperationHandler.h"
+#include "MCPBatchReferences.h"
+#include "UObject/StrongObjectPtr.h"
+
+FString FExecuteBatchCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FExecuteBatchCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    TArray<FOperation> Operations;
+    TArray<int32> Order;
+    FString ParseError;
+    if (!ParseOperations(Params, Operations, Order, ParseError))
+    {
+        FMCPError ParseErrorObj = FMCPErrorHandler::CreateInvalidParametersError(ParseError);
+        FMCPErrorHandler::LogError(ParseErrorObj);
+        Response.SetError(ParseErrorObj);
+        return;
+    }
+
+    bool bStopOnFailure = false;
+    Params->TryGetBoolField(TEXT("stop_on_failure"), bStopOnFailure);
+    bool bRollbackOnFailure = false;
+    Params->TryGetBoolField(TEXT("rollback_on_failure"), bRollbackOnFailure);
+
+    TStrongObjectPtr<UMCPBatchOperationHandler> Handler(NewObject<UMCPBatchOperationHandler>());
+    Handler->Initialize(GetCommandName());
+    Handler->SetStopOnFirstFailure(bStopOnFailure);
+
+    // Execution order is kept around every game-thread operation, while a run of thread-safe
+    // operations between two of them shares a wave and goes out to worker threads together
+    const FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    const FString* LastGameThreadId = nullptr;
+    TArray<FString> WorkerIdsSinceLast;
+    for (int32 Index : Order)
+    {
+        const FOperation& Operation = Operations[Index];
+        FMCPBatchOperation BatchOperation(Operation.Id, Operation.Command, FString());
+        BatchOperation.Params = Operation.Params;
+        BatchOperation.bContinueOnFailure = !bStopOnFailure;
+        for (int32 Dependency : Operation.Dependencies)
+        {
+            BatchOperation.Dependencies.Add(Operations[Dependency].Id);
+        }
+
+        const EMCPThreadAffinity Affinity = Registry.GetCommandThreadAffinity(Operation.Command);
+        const bool bOnWorker = Affinity != EMCPThreadAffinity::GameThreadRequired && Affinity != EMCPThreadAffinity::WaitsOnGameThread;
+        if (bOnWorker || WorkerIdsSinceLast.Num() == 0)
+        {
+            if (LastGameThreadId)
+            {
+                BatchOperation.RunAfter.Add(*LastGameThreadId);
+            }
+        }
+        else
+        {
+            BatchOperation.RunAfter = MoveTemp(WorkerIdsSinceLast);
+            WorkerIdsSinceLast.Reset();
+        }
+        if (bOnWorker)
+        {
+            WorkerIdsSinceLast.Add(Operation.Id);
+        }
+        else
+        {
+            LastGameThreadId = &Operation.Id;
+        }
+        Handler->AddOperation(BatchOperation);
+    }
+
+    // With rollback, the handler undoes the batch before its deferred compiles and saves run
+    bool bRolledBack = false;
+    if (bRollbackOnFailure)
+    {
+        bRolledBack = !Handler->ExecuteBatchWithRollback();
+    }
+    else
+    {
+        Handler->ExecuteBatch();
+    }
+
+    const TArray<FMCPBatchOperationResult> BatchResults = Handler->GetResults();
+    TMap<FString, const FMCPBatchOperationResult*> ResultsById;
+    for (const FMCPBatchOperationResult& Result : BatchResults)
+    {
+        ResultsById.Add(Result.Operation.OperationId, &Result);
+    }
+
+    // Report in list order, whatever order the dependencies forced
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Operations.Num());
+    int32 SuccessCount = 0;
+    int32 FailedCount = 0;
+    int32 SkippedCount = 0;
+    for (const FOperation& Operation : Operations)
+    {
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("id"), Operation.Id);
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Entry));
+
+        const FMCPBatchOperationResult* const* Found = ResultsById.Find(Operation.Id);
+        const FMCPBatchOperationResult* Result = Found ? *Found : nullptr;
+        Entry->SetBoolField(TEXT("success"), Result && Result->bSuccess);
+
+        if (!Result || Result->bSkipped)
+        {
+            // The handler leaves out the operations it never reached
+            FString SkipReason = bStopOnFailure
+                ? TEXT("Not run: an earlier operation failed and stop_on_failure is set")
+                : TEXT("Not run: the batch was cancelled");
+            for (int32 Dependency : Operation.Dependencies)
+            {
+                const FMCPBatchOperationResult* const* DependencyResult = ResultsById.Find(Operations[Dependency].Id);
+                if (Result && !(DependencyResult && (*DependencyResult)->bSuccess))
+                {
+                    SkipReason = FString::Printf(TEXT("Dependency '%s' did not succeed"), *Operations[Dependency].Id);
+                    break;
+                }
+            }
+            Entry->SetBoolField(TEXT("skipped"), true);
+            Entry->SetStringField(TEXT("error"), SkipReason);
+            SkippedCount++;
+            continue;
+        }
+
+        if (Result->bSuccess)
+        {
+            Entry->SetObjectField(TEXT("result"), Result->ResultObject);
+            SuccessCount++;
+            continue;
+        }
+
+        // Failures before the command ran (an unresolved reference) have only the handler's message
+        TSharedPtr<FJsonValue> ErrorValue = Result->ResultObject.IsValid() ? Result->ResultObject->TryGetField(TEXT("error")) : nullptr;
+        if (ErrorValue.IsValid())
+        {
+            Entry->SetField(TEXT("error"), ErrorValue);
+        }
+        else if (!Result->ResultObject.IsValid() && !Result->ResultData.IsEmpty())
+        {
+            Entry->SetStringField(TEXT("error"), Result->ResultData);
+        }
+        else
+        {
+            Entry->SetStringField(TEXT("error"), FString::Printf(TEXT("Command '%s' failed"), *Operation.Command));
+        }
+        FailedCount++;
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Operations.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SuccessCount);
+    ResponseObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResponseObj->SetNumberField(TEXT("skipped"), SkippedCount);
+    ResponseObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FExecuteBatchCommand::GetCommandName() const
+{
+    return TEXT("execute_batch");
+}
+
+bool FExecuteBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FExecuteBatchCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    TArray<FOperation> Operations;
+    TArray<int32> Order;
+    FString Error;
+    return ParseOperations(Params, Operations, Order, Error);
+}
+
+bool FExecuteBatchCommand::ParseOperations(const TSharedRef<FJsonObject>& Params, TArray<FOperation>& OutOperations, TArray<int32>& OutOrder, FString& OutError) const
+{
+    const TArray<TSharedPtr<FJsonValue>>* OperationsArray;
+    if (!Params->TryGetArrayField(TEXT("operations"), OperationsArray))
+    {
+        OutError = TEXT("Missing 'operations' array parameter");
+        return false;
+    }
+    if (OperationsArray->Num() == 0)
+    {
+        OutError = TEXT("No operations provided");
+        return false;
+    }
+    if (OperationsArray->Num() > MaxOperations)
+    {
+        OutError = FString::Printf(TEXT("Too many operations: %d (at most %d per batch)"), OperationsArray->Num(), MaxOperations);
+        return false;
+    }
+
+    const FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    TMap<FString, int32> IdToIndex;
+    TSet<FString> OperationIds;
+    OutOperations.Reset(OperationsArray->Num());
+
+    for (int32 Index = 0; Index < OperationsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* OperationObj;
+        if (!(*OperationsArray)[Index]->TryGetObject(OperationObj))
+        {
+            OutError = FString::Printf(TEXT("Operation %d is not an object"), Index);
+            return false;
+        }
+
+        FOperation& Operation = OutOperations.AddDefaulted_GetRef();
+        if (!(*OperationObj)->TryGetStringField(TEXT("id"), Operation.Id))
+        {
+            Operation.Id = FString::Printf(TEXT("op%d"), Index);
+        }
+        if (Operation.Id.IsEmpty() || Operation.Id.Contains(TEXT(".")) || Operation.Id.StartsWith(TEXT("$")))
+        {
+            OutError = FString::Printf(TEXT("Operation %d has an invalid id '%s' (must be non-empty, without '.' or a leading '$')"), Index, *Operation.Id);
+            return false;
+        }
+        if (IdToIndex.Contains(Operation.Id))
+        {
+            OutError = FString::Printf(TEXT("Duplicate operation id '%s'"), *Operation.Id);
+            return false;
+        }
+        IdToIndex.Add(Operation.Id, Index);
+        OperationIds.Add(Operation.Id);
+
+        if (!(*OperationObj)->TryGetStringField(TEXT("command"), Operation.Command))
+        {
+            OutError = FString::Printf(TEXT("Operation '%s' is missing 'command'"), *Operation.Id);
+            return false;
+        }
+        if (Operation.Command == GetCommandName())
+        {
+            OutError = FString::Printf(TEXT("Operation '%s': execute_batch cannot be nested"), *Operation.Id);
+            return false;
+        }
+        if (!Registry.IsCommandRegistered(Operation.Command))
+        {
+            OutError = FString::Printf(TEXT("Operation '%s': unknown command '%s'"), *Operation.Id, *Operation.Command);
+            return false;
+        }
+
+        const TSharedPtr<FJsonObject>* OperationParams;
+        Operation.Params = (*OperationObj)->TryGetObjectField(TEXT("params"), OperationParams) ? *OperationParams : MakeShared<FJsonObject>();
+    }
+
+    // Dependencies are resolved once every id is known, so an operation may wait for a later one
+    for (int32 Index = 0; Index < OperationsArray->Num(); ++Index)
+    {
+        FOperation& Operation = OutOperations[Index];
+        const TSharedPtr<FJsonObject>& OperationObj = (*OperationsArray)[Index]->AsObject();
+
+        const TArray<TSharedPtr<FJsonValue>>* DependsOn;
+        if (OperationObj->TryGetArrayField(TEXT("depends_on"), DependsOn))
+        {
+            for (const TSharedPtr<FJsonValue>& DependencyValue : *DependsOn)
+            {
+                const FString DependencyId = DependencyValue->AsString();
+                const int32* DependencyIndex = IdToIndex.Find(DependencyId);
+                if (!DependencyIndex)
+                {
+                    OutError = FString::Printf(TEXT("Operation '%s' depends on unknown operation '%s'"), *Operation.Id, *DependencyId);
+                    return false;
+                }
+                Operation.Dependencies.AddUnique(*DependencyIndex);
+            }
+        }
+        TArray<FString> ReferencedIds;
+        FMCPBatchReferences::Collect(MakeShared<FJsonValueObject>(Operation.Params), OperationIds, ReferencedIds);
+        for (const FString& ReferencedId : ReferencedIds)
+        {
+            Operation.Dependencies.AddUnique(IdToIndex.FindChecked(ReferencedId));
+        }
+
+        if (Operation.Dependencies.Contains(Index))
+        {
+            OutError = FString::Printf(TEXT("Operation '%s' depends on itself"), *Operation.Id);
+            return false;
+        }
+    }
+
+    // Topological order that keeps list order wherever the dependencies allow it
+    TArray<int32> PendingDependencies;
+    TArray<TArray<int32>> Dependents;
+    PendingDependencies.SetNumZeroed(OutOperations.Num());
+    Dependents.SetNum(OutOperations.Num());
+    TArray<int32> Ready;
+    for (int32 Index = 0; Index < OutOperations.Num(); ++Index)
+    {
+        PendingDependencies[Index] = OutOperations[Index].Dependencies.Num();
+        for (int32 Dependency : OutOperations[Index].Dependencies)
+        {
+            Dependents[Dependency].Add(Index);
+        }
+        if (PendingDependencies[Index] == 0)
+        {
+            Ready.HeapPush(Index);
+        }
+    }
+
+    OutOrder.Reset(OutOperations.Num());
+    while (Ready.Num() > 0)
+    {
+        int32 Index;
+        Ready.HeapPop(Index, EAllowShrinking::No);
+        OutOrder.Add(Index);
+        for (int32 Dependent : Dependents[Index])
+        {
+            if (--PendingDependencies[Dependent] == 0)
+            {
+                Ready.HeapPush(Dependent);
+            }
+        }
+    }
+
+    if (OutOrder.Num() < OutOperations.Num())
+    {
+        for (int32 Index = 0; Index < OutOperations.Num(); ++Index)
+        {
+            if (PendingDependencies[Index] > 0)
+            {
+                OutError = FString::Printf(TEXT("Operation '%s' is part of a dependency cycle"), *OutOperations[Index].Id);
+                break;
+            }
+        }
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,46 @@
+#include "Commands/Editor/FlushSavesCommand.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "MCPSaveQueue.h"
+
+FString FFlushSavesCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FFlushSavesCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    TArray<FString> FailedPackages;
+    const int32 QueuedCount = FMCPSaveQueue::Get().Flush(&FailedPackages);
+
+    TArray<TSharedPtr<FJsonValue>> FailedArray;
+    for (const FString& PackageName : FailedPackages)
+    {
+        FailedArray.Add(MakeShared<FJsonValueString>(PackageName));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetNumberField(TEXT("saved"), QueuedCount - FailedPackages.Num());
+    ResponseObj->SetArrayField(TEXT("failed_packages"), FailedArray);
+    ResponseObj->SetBoolField(TEXT("success"), FailedPackages.Num() == 0);
+    if (FailedPackages.Num() > 0)
+    {
+        ResponseObj->SetStringField(TEXT("error"), FString::Printf(TEXT("%d queued packages could not be saved"), FailedPackages.Num()));
+    }
+    Response.SetResult(ResponseObj);
+}
+
+FString FFlushSavesCommand::GetCommandName() const
+{
+    return TEXT("flush_saves");
+}
+
+bool FFlushSavesCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FFlushSavesCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
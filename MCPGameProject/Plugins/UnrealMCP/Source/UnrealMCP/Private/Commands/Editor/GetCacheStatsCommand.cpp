@@ -0,0 +1,50 @@
+#include "Commands/Editor/GetCacheStatsCommand.h"
+#include "Dom/JsonObject.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+FString FGetCacheStatsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetCacheStatsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString NameFilter;
+    Params->TryGetStringField(TEXT("name"), NameFilter);
+
+    bool bTrim = false;
+    Params->TryGetBoolField(TEXT("trim"), bTrim);
+    if (bTrim)
+    {
+        FMCPCacheBudget::Get().TrimAll();
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = FMCPCacheStatsRegistry::Get().MakeReport(NameFilter);
+    ResponseObj->SetObjectField(TEXT("memory_budget"), FMCPCacheBudget::Get().MakeReport());
+
+    bool bReset = false;
+    Params->TryGetBoolField(TEXT("reset"), bReset);
+    if (bReset)
+    {
+        ResponseObj->SetNumberField(TEXT("reset_sources"), FMCPCacheStatsRegistry::Get().ResetStats(NameFilter));
+    }
+
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FGetCacheStatsCommand::GetCommandName() const
+{
+    return TEXT("get_cache_stats");
+}
+
+bool FGetCacheStatsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetCacheStatsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
@@ -1,9 +1,101 @@
 #include "Commands/Editor/GetLevelMetadataCommand.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "GameFramework/Actor.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
+namespace
+{
+    enum EActorField : uint32
+    {
+        ActorField_Name = 1 << 0,
+        ActorField_Class = 1 << 1,
+        ActorField_Location = 1 << 2,
+        ActorField_Rotation = 1 << 3,
+        ActorField_Scale = 1 << 4,
+        ActorField_Label = 1 << 5,
+        ActorField_Path = 1 << 6,
+        ActorField_Folder = 1 << 7,
+        ActorField_Tags = 1 << 8,
+    };
+
+    /** The fields get_level_metadata always returned */
+    constexpr uint32 DefaultActorFields = ActorField_Name | ActorField_Class | ActorField_Location | ActorField_Rotation | ActorField_Scale;
+
+    /** @return The field's bit, or 0 if the name is unknown */
+    uint32 ActorFieldFromName(const FString& FieldName)
+    {
+        static const TMap<FString, uint32> Fields = {
+            { TEXT("name"), ActorField_Name },
+            { TEXT("class"), ActorField_Class },
+            { TEXT("location"), ActorField_Location },
+            { TEXT("rotation"), ActorField_Rotation },
+            { TEXT("scale"), ActorField_Scale },
+            { TEXT("label"), ActorField_Label },
+            { TEXT("path"), ActorField_Path },
+            { TEXT("folder"), ActorField_Folder },
+            { TEXT("tags"), ActorField_Tags },
+        };
+        const uint32* Field = Fields.Find(FieldName.ToLower());
+        return Field ? *Field : 0;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> VectorToJson(const FVector& Vector)
+    {
+        return { MakeShared<FJsonValueNumber>(Vector.X), MakeShared<FJsonValueNumber>(Vector.Y), MakeShared<FJsonValueNumber>(Vector.Z) };
+    }
+
+    /** Serialize only the requested fields of an actor */
+    TSharedPtr<FJsonObject> ActorToProjectedJson(AActor* Actor, uint32 FieldMask)
+    {
+        TSharedPtr<FJsonObject> ActorObject = MakeShared<FJsonObject>();
+        if (FieldMask & ActorField_Name)
+        {
+            ActorObject->SetStringField(TEXT("name"), Actor->GetName());
+        }
+        if (FieldMask & ActorField_Class)
+        {
+            ActorObject->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
+        }
+        if (FieldMask & ActorField_Location)
+        {
+            ActorObject->SetArrayField(TEXT("location"), VectorToJson(Actor->GetActorLocation()));
+        }
+        if (FieldMask & ActorField_Rotation)
+        {
+            const FRotator Rotation = Actor->GetActorRotation();
+            ActorObject->SetArrayField(TEXT("rotation"), VectorToJson(FVector(Rotation.Pitch, Rotation.Yaw, Rotation.Roll)));
+        }
+        if (FieldMask & ActorField_Scale)
+        {
+            ActorObject->SetArrayField(TEXT("scale"), VectorToJson(Actor->GetActorScale3D()));
+        }
+        if (FieldMask & ActorField_Label)
+        {
+            ActorObject->SetStringField(TEXT("label"), Actor->GetActorLabel());
+        }
+        if (FieldMask & ActorField_Path)
+        {
+            ActorObject->SetStringField(TEXT("path"), Actor->GetPathName());
+        }
+        if (FieldMask & ActorField_Folder)
+        {
+            ActorObject->SetStringField(TEXT("folder"), Actor->GetFolderPath().ToString());
+        }
+        if (FieldMask & ActorField_Tags)
+        {
+            TArray<TSharedPtr<FJsonValue>> TagsArray;
+            for (const FName& Tag : Actor->Tags)
+            {
+                TagsArray.Add(MakeShared<FJsonValueString>(Tag.ToString()));
+            }
+            ActorObject->SetArrayField(TEXT("tags"), TagsArray);
+        }
+        return ActorObject;
+    }
+}
+
 FGetLevelMetadataCommand::FGetLevelMetadataCommand(IEditorService& InEditorService)
     : EditorService(InEditorService)
 {
@@ -24,7 +116,10 @@ bool FGetLevelMetadataCommand::ValidateParams(const FString& Parameters) const
         return false;
     }
 
-    return true; // No strictly required parameters
+    // No strictly required parameters, but filters and paging must be well formed
+    FActorListOptions Options;
+    FString Error;
+    return ParseActorListOptions(JsonObject, Options, Error);
 }
 
 FString FGetLevelMetadataCommand::Execute(const FString& Parameters)
@@ -35,16 +130,16 @@ FString FGetLevelMetadataCommand::Execute(const FString& Parameters)
 
     if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
     {
-        TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid JSON parameters"));
-        FString OutputString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-        FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-        return OutputString;
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
     }
 
     // Extract parameters
-    FString ActorFilter;
-    JsonObject->TryGetStringField(TEXT("actor_filter"), ActorFilter);
+    FActorListOptions ActorListOptions;
+    FString Error;
+    if (!ParseActorListOptions(JsonObject, ActorListOptions, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
 
     // Get fields array
     const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
@@ -71,7 +166,11 @@ FString FGetLevelMetadataCommand::Execute(const FString& Parameters)
     // Add requested fields
     if (bIncludeAll || IsFieldRequested(FieldsArray, TEXT("actors")))
     {
-        TSharedPtr<FJsonObject> ActorsInfo = BuildActorsInfo(ActorFilter);
+        TSharedPtr<FJsonObject> ActorsInfo = BuildActorsInfo(ActorListOptions, Error);
+        if (!ActorsInfo.IsValid())
+        {
+            return CreateErrorResponse(Error);
+        }
         ResponseObj->SetObjectField(TEXT("actors"), ActorsInfo);
     }
 
@@ -99,38 +198,219 @@ bool FGetLevelMetadataCommand::IsFieldRequested(const TArray<TSharedPtr<FJsonVal
     return false;
 }
 
-TSharedPtr<FJsonObject> FGetLevelMetadataCommand::BuildActorsInfo(const FString& ActorFilter) const
+bool FGetLevelMetadataCommand::ParseActorListOptions(const TSharedPtr<FJsonObject>& JsonObject, FActorListOptions& OutOptions, FString& OutError) const
 {
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    FActorListFilter& Filter = OutOptions.Filter;
+    JsonObject->TryGetStringField(TEXT("actor_filter"), Filter.NamePattern);
+    JsonObject->TryGetStringField(TEXT("class_filter"), Filter.ClassName);
+    JsonObject->TryGetStringField(TEXT("tag_filter"), Filter.Tag);
+    JsonObject->TryGetStringField(TEXT("folder_filter"), Filter.Folder);
+    if (!ParseSpatialQuery(JsonObject, Filter.Region, OutError))
+    {
+        return false;
+    }
 
-    TArray<AActor*> Actors;
+    OutOptions.FieldMask = DefaultActorFields;
+    const TArray<TSharedPtr<FJsonValue>>* ActorFieldsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("actor_fields"), ActorFieldsArray) && ActorFieldsArray->Num() > 0)
+    {
+        OutOptions.FieldMask = 0;
+        for (const TSharedPtr<FJsonValue>& FieldValue : *ActorFieldsArray)
+        {
+            const FString FieldName = FieldValue.IsValid() ? FieldValue->AsString() : FString();
+            const uint32 Field = ActorFieldFromName(FieldName);
+            if (Field == 0)
+            {
+                OutError = FString::Printf(TEXT("Unknown actor field '%s'; expected name, class, location, rotation, scale, label, path, folder or tags"), *FieldName);
+                return false;
+            }
+            OutOptions.FieldMask |= Field;
+        }
+    }
+
+    JsonObject->TryGetNumberField(TEXT("limit"), OutOptions.Limit);
+    JsonObject->TryGetStringField(TEXT("cursor"), OutOptions.Cursor);
+    if (OutOptions.Limit < 0)
+    {
+        OutError = TEXT("limit must not be negative");
+        return false;
+    }
 
-    if (ActorFilter.IsEmpty())
+    const bool bNearest = Filter.Region.IsSet() && Filter.Region->Shape == EActorSpatialShape::Nearest;
+    if (bNearest && !OutOptions.Cursor.IsEmpty())
     {
-        // Get all actors
-        Actors = EditorService.GetActorsInLevel();
+        OutError = TEXT("Nearest queries are ordered by distance and cannot be paged; raise the count instead");
+        return false;
+    }
+    return true;
+}
+
+bool FGetLevelMetadataCommand::ParseSpatialQuery(const TSharedPtr<FJsonObject>& JsonObject, TOptional<FActorSpatialQuery>& OutQuery, FString& OutError) const
+{
+    const TSharedPtr<FJsonObject>* SpatialObj = nullptr;
+    if (!JsonObject->TryGetObjectField(TEXT("spatial"), SpatialObj))
+    {
+        return true;
+    }
+
+    const TSharedPtr<FJsonObject>& Spatial = *SpatialObj;
+    FActorSpatialQuery& Query = OutQuery.Emplace();
+    FString Shape;
+    Spatial->TryGetStringField(TEXT("shape"), Shape);
+
+    auto RequireVector = [&](const TCHAR* FieldName, FVector& OutVector)
+    {
+        if (!Spatial->HasField(FieldName))
+        {
+            OutError = FString::Printf(TEXT("Spatial shape '%s' requires '%s'"), *Shape, FieldName);
+            return false;
+        }
+        OutVector = FUnrealMCPCommonUtils::GetVectorFromJson(Spatial, FieldName);
+        return true;
+    };
+
+    if (Shape.Equals(TEXT("box"), ESearchCase::IgnoreCase))
+    {
+        Query.Shape = EActorSpatialShape::Box;
+        if (!RequireVector(TEXT("min"), Query.Min) || !RequireVector(TEXT("max"), Query.Max))
+        {
+            return false;
+        }
+    }
+    else if (Shape.Equals(TEXT("sphere"), ESearchCase::IgnoreCase))
+    {
+        Query.Shape = EActorSpatialShape::Sphere;
+        if (!RequireVector(TEXT("center"), Query.Center))
+        {
+            return false;
+        }
+        Spatial->TryGetNumberField(TEXT("radius"), Query.Radius);
+    }
+    else if (Shape.Equals(TEXT("frustum"), ESearchCase::IgnoreCase))
+    {
+        Query.Shape = EActorSpatialShape::Frustum;
+        if (!RequireVector(TEXT("origin"), Query.Origin))
+        {
+            return false;
+        }
+        if (Spatial->HasField(TEXT("rotation")))
+        {
+            Query.Rotation = FUnrealMCPCommonUtils::GetRotatorFromJson(Spatial, TEXT("rotation"));
+        }
+        double Number = 0.0;
+        if (Spatial->TryGetNumberField(TEXT("fov"), Number))
+        {
+            Query.FOV = static_cast<float>(Number);
+        }
+        if (Spatial->TryGetNumberField(TEXT("aspect_ratio"), Number))
+        {
+            Query.AspectRatio = static_cast<float>(Number);
+        }
+        if (Spatial->TryGetNumberField(TEXT("near_distance"), Number))
+        {
+            Query.NearDistance = static_cast<float>(Number);
+        }
+        if (Spatial->TryGetNumberField(TEXT("far_distance"), Number))
+        {
+            Query.FarDistance = static_cast<float>(Number);
+        }
+    }
+    else if (Shape.Equals(TEXT("nearest"), ESearchCase::IgnoreCase))
+    {
+        Query.Shape = EActorSpatialShape::Nearest;
+        if (!RequireVector(TEXT("point"), Query.Center))
+        {
+            return false;
+        }
+        Spatial->TryGetNumberField(TEXT("count"), Query.Count);
+        Spatial->TryGetNumberField(TEXT("max_distance"), Query.Radius);
     }
     else
     {
-        // Get actors matching filter pattern
-        Actors = EditorService.FindActorsByName(ActorFilter);
+        OutError = FString::Printf(TEXT("Unknown spatial shape '%s'; expected box, sphere, frustum or nearest"), *Shape);
+        return false;
     }
 
+    return Query.IsValid(OutError);
+}
+
+TSharedPtr<FJsonObject> FGetLevelMetadataCommand::BuildActorsInfo(const FActorListOptions& Options, FString& OutError) const
+{
+    TArray<AActor*> Actors;
+    TArray<double> Distances;
+    if (!EditorService.FindActors(Options.Filter, Actors, Distances, OutError))
+    {
+        return nullptr;
+    }
+
+    // Pages are ordered by path, which is unique and stable while actors come and go between pages
+    const bool bPaged = Options.Limit > 0 || !Options.Cursor.IsEmpty();
+    TArray<TPair<FString, int32>> Order;
+    Order.Reserve(Actors.Num());
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        if (Actors[Index])
+        {
+            Order.Emplace(bPaged ? Actors[Index]->GetPathName() : FString(), Index);
+        }
+    }
+    if (bPaged && Distances.Num() == 0)
+    {
+        Order.Sort([](const TPair<FString, int32>& A, const TPair<FString, int32>& B)
+        {
+            return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+        });
+    }
+
+    int32 First = 0;
+    if (!Options.Cursor.IsEmpty())
+    {
+        while (First < Order.Num() && Order[First].Key.Compare(Options.Cursor, ESearchCase::CaseSensitive) <= 0)
+        {
+            ++First;
+        }
+    }
+    const int32 Last = Options.Limit > 0 ? FMath::Min(Order.Num(), First + Options.Limit) : Order.Num();
+
     TArray<TSharedPtr<FJsonValue>> ActorArray;
-    for (AActor* Actor : Actors)
+    ActorArray.Reserve(Last - First);
+    for (int32 OrderIndex = First; OrderIndex < Last; ++OrderIndex)
     {
-        if (Actor)
+        const int32 Index = Order[OrderIndex].Value;
+        TSharedPtr<FJsonObject> ActorObj = ActorToProjectedJson(Actors[Index], Options.FieldMask);
+        if (Distances.IsValidIndex(Index))
         {
-            ActorArray.Add(FUnrealMCPCommonUtils::ActorToJson(Actor));
+            ActorObj->SetNumberField(TEXT("distance"), Distances[Index]);
         }
+        ActorArray.Add(MakeShared<FJsonValueObject>(ActorObj));
     }
 
-    if (!ActorFilter.IsEmpty())
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    if (!Options.Filter.NamePattern.IsEmpty())
     {
-        Result->SetStringField(TEXT("filter"), ActorFilter);
+        Result->SetStringField(TEXT("filter"), Options.Filter.NamePattern);
     }
     Result->SetNumberField(TEXT("count"), ActorArray.Num());
+    Result->SetNumberField(TEXT("total"), Order.Num());
     Result->SetArrayField(TEXT("items"), ActorArray);
+    if (bPaged)
+    {
+        const bool bHasMore = Last < Order.Num();
+        Result->SetBoolField(TEXT("has_more"), bHasMore);
+        if (bHasMore && Last > First && Distances.Num() == 0)
+        {
+            Result->SetStringField(TEXT("next_cursor"), Order[Last - 1].Key);
+        }
+    }
 
     return Result;
 }
+
+FString FGetLevelMetadataCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
+    return OutputString;
+}
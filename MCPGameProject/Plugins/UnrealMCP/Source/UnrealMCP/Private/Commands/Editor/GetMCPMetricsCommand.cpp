@@ -0,0 +1,58 @@
+#include "Commands/Editor/GetMCPMetricsCommand.h"
+#include "Dom/JsonObject.h"
+#include "MCPMetrics.h"
+
+FString FGetMCPMetricsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FGetMCPMetricsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString Format = TEXT("json");
+    Params->TryGetStringField(TEXT("format"), Format);
+    if (Format != TEXT("json") && Format != TEXT("prometheus"))
+    {
+        Response.SetError(FString::Printf(TEXT("Unknown format '%s': use \"json\" or \"prometheus\""), *Format));
+        return;
+    }
+
+    FString CommandFilter;
+    Params->TryGetStringField(TEXT("command"), CommandFilter);
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    if (Format == TEXT("prometheus"))
+    {
+        ResponseObj->SetStringField(TEXT("format"), Format);
+        ResponseObj->SetStringField(TEXT("text"), FMCPMetrics::Get().MakePrometheusText());
+    }
+    else
+    {
+        ResponseObj = FMCPMetrics::Get().MakeSnapshot(CommandFilter);
+    }
+
+    bool bReset = false;
+    Params->TryGetBoolField(TEXT("reset"), bReset);
+    if (bReset)
+    {
+        FMCPMetrics::Get().Reset();
+    }
+
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FGetMCPMetricsCommand::GetCommandName() const
+{
+    return TEXT("get_mcp_metrics");
+}
+
+bool FGetMCPMetricsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FGetMCPMetricsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
@@ -0,0 +1,60 @@
+#include "Commands/Editor/RecordRequestsCommand.h"
+#include "Dom/JsonObject.h"
+#include "MCPRequestRecording.h"
+
+FString FRecordRequestsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FRecordRequestsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString Action = TEXT("status");
+    Params->TryGetStringField(TEXT("action"), Action);
+
+    FMCPRequestRecorder& Recorder = FMCPRequestRecorder::Get();
+    if (Action == TEXT("start"))
+    {
+        FString Path;
+        Params->TryGetStringField(TEXT("path"), Path);
+        FString RecordingPath;
+        FString Error;
+        if (!Recorder.Start(Path, RecordingPath, Error))
+        {
+            Response.SetError(Error);
+            return;
+        }
+    }
+    else if (Action == TEXT("stop"))
+    {
+        if (!Recorder.Stop())
+        {
+            Response.SetError(TEXT("No recording is running"));
+            return;
+        }
+    }
+    else if (Action != TEXT("status"))
+    {
+        Response.SetError(FString::Printf(TEXT("Unknown action '%s': use \"start\", \"stop\" or \"status\""), *Action));
+        return;
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = Recorder.MakeStatus();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FRecordRequestsCommand::GetCommandName() const
+{
+    return TEXT("record_requests");
+}
+
+bool FRecordRequestsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FRecordRequestsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
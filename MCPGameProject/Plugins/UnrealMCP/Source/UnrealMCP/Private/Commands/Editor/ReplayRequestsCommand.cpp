@@ -0,0 +1,73 @@
+#include "Commands/Editor/ReplayRequestsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "MCPRequestRecording.h"
+#include "UnrealMCPBridge.h"
+
+FString FReplayRequestsCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FReplayRequestsCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    FString Action = TEXT("status");
+    Params->TryGetStringField(TEXT("action"), Action);
+
+    FMCPRequestReplayer& Replayer = FMCPRequestReplayer::Get();
+    if (Action == TEXT("start"))
+    {
+        FString Path;
+        if (!Params->TryGetStringField(TEXT("path"), Path) || Path.IsEmpty())
+        {
+            Response.SetError(TEXT("Missing 'path' parameter"));
+            return;
+        }
+
+        double Speed = 1.0;
+        Params->TryGetNumberField(TEXT("speed"), Speed);
+        int32 MaxRequests = 0;
+        Params->TryGetNumberField(TEXT("max_requests"), MaxRequests);
+        if (Speed < 0.0 || MaxRequests < 0)
+        {
+            Response.SetError(TEXT("'speed' and 'max_requests' must not be negative"));
+            return;
+        }
+
+        UUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UUnrealMCPBridge>() : nullptr;
+        FString Error;
+        if (!Replayer.Start(Bridge, Path, Speed, MaxRequests, Error))
+        {
+            Response.SetError(Error);
+            return;
+        }
+    }
+    else if (Action == TEXT("stop"))
+    {
+        Replayer.Stop();
+    }
+    else if (Action != TEXT("status"))
+    {
+        Response.SetError(FString::Printf(TEXT("Unknown action '%s': use \"start\", \"stop\" or \"status\""), *Action));
+        return;
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = Replayer.MakeStatus();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FReplayRequestsCommand::GetCommandName() const
+{
+    return TEXT("replay_requests");
+}
+
+bool FReplayRequestsCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FReplayRequestsCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
@@ -0,0 +1,142 @@
+#include "Commands/Editor/SetActorPropertiesBatchCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FSetActorPropertiesBatchCommand::FSetActorPropertiesBatchCommand(IEditorService& InEditorService)
+    : EditorService(InEditorService)
+{
+}
+
+FString FSetActorPropertiesBatchCommand::Execute(const FString& Parameters)
+{
+    TArray<FActorPropertyUpdate> Updates;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Updates, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    if (Updates.Num() == 0)
+    {
+        return CreateErrorResponse(TEXT("No property updates provided"));
+    }
+
+    TArray<FString> Errors;
+    EditorService.SetActorProperties(Updates, Errors);
+    return CreateSuccessResponse(Updates, Errors);
+}
+
+FString FSetActorPropertiesBatchCommand::GetCommandName() const
+{
+    return TEXT("set_actor_properties_batch");
+}
+
+bool FSetActorPropertiesBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    TArray<FActorPropertyUpdate> Updates;
+    FString Error;
+    return ParseParameters(Parameters, Updates, Error);
+}
+
+bool FSetActorPropertiesBatchCommand::ParseParameters(const FString& JsonString, TArray<FActorPropertyUpdate>& OutUpdates, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* UpdatesArray;
+    if (!JsonObject->TryGetArrayField(TEXT("updates"), UpdatesArray))
+    {
+        OutError = TEXT("Missing 'updates' array parameter");
+        return false;
+    }
+
+    OutUpdates.Reserve(UpdatesArray->Num());
+    for (int32 UpdateIndex = 0; UpdateIndex < UpdatesArray->Num(); ++UpdateIndex)
+    {
+        const TSharedPtr<FJsonObject>* UpdateObj = nullptr;
+        if (!(*UpdatesArray)[UpdateIndex].IsValid() || !(*UpdatesArray)[UpdateIndex]->TryGetObject(UpdateObj))
+        {
+            OutError = FString::Printf(TEXT("updates[%d] must be an object"), UpdateIndex);
+            return false;
+        }
+
+        FActorPropertyUpdate& Update = OutUpdates.AddDefaulted_GetRef();
+        if (!(*UpdateObj)->TryGetStringField(TEXT("name"), Update.ActorName) || Update.ActorName.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("updates[%d] is missing 'name'"), UpdateIndex);
+            return false;
+        }
+
+        const TSharedPtr<FJsonObject>* PropertiesObj = nullptr;
+        if (!(*UpdateObj)->TryGetObjectField(TEXT("properties"), PropertiesObj) || (*PropertiesObj)->Values.Num() == 0)
+        {
+            OutError = FString::Printf(TEXT("updates[%d] is missing a non-empty 'properties' object"), UpdateIndex);
+            return false;
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*PropertiesObj)->Values)
+        {
+            Update.Properties.Emplace(Property.Key, Property.Value);
+        }
+    }
+
+    return true;
+}
+
+FString FSetActorPropertiesBatchCommand::CreateSuccessResponse(const TArray<FActorPropertyUpdate>& Updates, const TArray<FString>& Errors) const
+{
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Updates.Num());
+    int32 SuccessCount = 0;
+    for (int32 UpdateIndex = 0; UpdateIndex < Updates.Num(); ++UpdateIndex)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Updates[UpdateIndex].ActorName);
+
+        const FString& Error = Errors.IsValidIndex(UpdateIndex) ? Errors[UpdateIndex] : FString();
+        ResultObj->SetBoolField(TEXT("success"), Error.IsEmpty());
+        if (Error.IsEmpty())
+        {
+            SuccessCount++;
+        }
+        else
+        {
+            ResultObj->SetStringField(TEXT("error"), Error);
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Updates.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SuccessCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Updates.Num() - SuccessCount);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FSetActorPropertiesBatchCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
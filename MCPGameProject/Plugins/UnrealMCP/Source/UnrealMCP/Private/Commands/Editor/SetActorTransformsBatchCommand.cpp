@@ -0,0 +1,149 @@
+#include "Commands/Editor/SetActorTransformsBatchCommand.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FSetActorTransformsBatchCommand::FSetActorTransformsBatchCommand(IEditorService& InEditorService)
+    : EditorService(InEditorService)
+{
+}
+
+FString FSetActorTransformsBatchCommand::Execute(const FString& Parameters)
+{
+    TArray<FActorTransformUpdate> Updates;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Updates, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    if (Updates.Num() == 0)
+    {
+        return CreateErrorResponse(TEXT("No transform updates provided"));
+    }
+
+    TArray<FString> Errors;
+    EditorService.SetActorTransforms(Updates, Errors);
+    return CreateSuccessResponse(Updates, Errors);
+}
+
+FString FSetActorTransformsBatchCommand::GetCommandName() const
+{
+    return TEXT("set_actor_transforms_batch");
+}
+
+bool FSetActorTransformsBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    TArray<FActorTransformUpdate> Updates;
+    FString Error;
+    return ParseParameters(Parameters, Updates, Error);
+}
+
+bool FSetActorTransformsBatchCommand::ParseParameters(const FString& JsonString, TArray<FActorTransformUpdate>& OutUpdates, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* UpdatesArray;
+    if (!JsonObject->TryGetArrayField(TEXT("updates"), UpdatesArray))
+    {
+        OutError = TEXT("Missing 'updates' array parameter");
+        return false;
+    }
+
+    OutUpdates.Reserve(UpdatesArray->Num());
+    for (int32 UpdateIndex = 0; UpdateIndex < UpdatesArray->Num(); ++UpdateIndex)
+    {
+        const TSharedPtr<FJsonObject>* UpdateObj = nullptr;
+        if (!(*UpdatesArray)[UpdateIndex].IsValid() || !(*UpdatesArray)[UpdateIndex]->TryGetObject(UpdateObj))
+        {
+            OutError = FString::Printf(TEXT("updates[%d] must be an object"), UpdateIndex);
+            return false;
+        }
+
+        FActorTransformUpdate& Update = OutUpdates.AddDefaulted_GetRef();
+        if (!(*UpdateObj)->TryGetStringField(TEXT("name"), Update.ActorName) || Update.ActorName.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("updates[%d] is missing 'name'"), UpdateIndex);
+            return false;
+        }
+
+        if ((*UpdateObj)->HasField(TEXT("location")))
+        {
+            Update.Location = FUnrealMCPCommonUtils::GetVectorFromJson(*UpdateObj, TEXT("location"));
+        }
+        if ((*UpdateObj)->HasField(TEXT("rotation")))
+        {
+            Update.Rotation = FUnrealMCPCommonUtils::GetRotatorFromJson(*UpdateObj, TEXT("rotation"));
+        }
+        if ((*UpdateObj)->HasField(TEXT("scale")))
+        {
+            Update.Scale = FUnrealMCPCommonUtils::GetVectorFromJson(*UpdateObj, TEXT("scale"));
+        }
+        if (!Update.Location.IsSet() && !Update.Rotation.IsSet() && !Update.Scale.IsSet())
+        {
+            OutError = FString::Printf(TEXT("updates[%d] sets none of location, rotation or scale"), UpdateIndex);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FString FSetActorTransformsBatchCommand::CreateSuccessResponse(const TArray<FActorTransformUpdate>& Updates, const TArray<FString>& Errors) const
+{
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Updates.Num());
+    int32 SuccessCount = 0;
+    for (int32 UpdateIndex = 0; UpdateIndex < Updates.Num(); ++UpdateIndex)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("name"), Updates[UpdateIndex].ActorName);
+
+        const FString& Error = Errors.IsValidIndex(UpdateIndex) ? Errors[UpdateIndex] : FString();
+        ResultObj->SetBoolField(TEXT("success"), Error.IsEmpty());
+        if (Error.IsEmpty())
+        {
+            SuccessCount++;
+        }
+        else
+        {
+            ResultObj->SetStringField(TEXT("error"), Error);
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Updates.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SuccessCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Updates.Num() - SuccessCount);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FSetActorTransformsBatchCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -0,0 +1,107 @@
+#include "Commands/Editor/WaitForCompileCommand.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "MCPCompileQueue.h"
+#include "MCPErrorHandler.h"
+
+FString FWaitForCompileCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FWaitForCompileCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    TArray<int64> Tickets;
+    if (!ParseTickets(Params, Tickets))
+    {
+        FMCPError ParseError = FMCPErrorHandler::CreateInvalidParametersError(TEXT("Missing 'ticket' or 'tickets' parameter"));
+        FMCPErrorHandler::LogError(ParseError);
+        Response.SetError(ParseError);
+        return;
+    }
+
+    bool bWait = true;
+    Params->TryGetBoolField(TEXT("wait"), bWait);
+
+    FMCPCompileQueue& CompileQueue = FMCPCompileQueue::Get();
+    TArray<TSharedPtr<FJsonValue>> TicketArray;
+    for (int64 Ticket : Tickets)
+    {
+        if (bWait)
+        {
+            CompileQueue.Complete(Ticket);
+        }
+
+        TSharedPtr<FJsonObject> TicketObj = MakeShared<FJsonObject>();
+        TicketObj->SetNumberField(TEXT("ticket"), Ticket);
+
+        FString CompileResponse;
+        switch (CompileQueue.GetState(Ticket, CompileResponse))
+        {
+        case FMCPCompileQueue::ETicketState::Finished:
+        {
+            TicketObj->SetStringField(TEXT("state"), TEXT("finished"));
+            TSharedPtr<FJsonObject> ResultObj;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CompileResponse);
+            if (FJsonSerializer::Deserialize(Reader, ResultObj) && ResultObj.IsValid())
+            {
+                TicketObj->SetObjectField(TEXT("result"), ResultObj);
+            }
+            break;
+        }
+        case FMCPCompileQueue::ETicketState::Pending:
+            TicketObj->SetStringField(TEXT("state"), TEXT("pending"));
+            break;
+        default:
+            TicketObj->SetStringField(TEXT("state"), TEXT("unknown"));
+            break;
+        }
+        TicketArray.Add(MakeShared<FJsonValueObject>(TicketObj));
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("tickets"), TicketArray);
+    ResponseObj->SetNumberField(TEXT("pending_compiles"), CompileQueue.GetPendingCount());
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    Response.SetResult(ResponseObj);
+}
+
+FString FWaitForCompileCommand::GetCommandName() const
+{
+    return TEXT("wait_for_compile");
+}
+
+bool FWaitForCompileCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FWaitForCompileCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    TArray<int64> Tickets;
+    return ParseTickets(Params, Tickets);
+}
+
+bool FWaitForCompileCommand::ParseTickets(const TSharedRef<FJsonObject>& Params, TArray<int64>& OutTickets) const
+{
+    int64 Ticket = 0;
+    if (Params->TryGetNumberField(TEXT("ticket"), Ticket))
+    {
+        OutTickets.Add(Ticket);
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* TicketArray;
+    if (Params->TryGetArrayField(TEXT("tickets"), TicketArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *TicketArray)
+        {
+            if (Value->TryGetNumber(Ticket))
+            {
+                OutTickets.Add(Ticket);
+            }
+        }
+    }
+
+    return OutTickets.Num() > 0;
+}
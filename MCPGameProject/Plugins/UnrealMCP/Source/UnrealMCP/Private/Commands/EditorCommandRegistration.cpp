@@ -9,35 +9,64 @@
 #include "Commands/Editor/SetActorTransformCommand.h"
 #include "Commands/Editor/GetActorPropertiesCommand.h"
 #include "Commands/Editor/SetActorPropertyCommand.h"
+#include "Commands/Editor/SetActorTransformsBatchCommand.h"
+#include "Commands/Editor/SetActorPropertiesBatchCommand.h"
 #include "Commands/Editor/SetLightPropertyCommand.h"
 #include "Commands/Editor/GetLevelMetadataCommand.h"
 #include "Commands/Editor/BatchDeleteActorsCommand.h"
 #include "Commands/Editor/BatchSpawnActorsCommand.h"
+#include "Commands/Editor/ConvertActorsToInstancesCommand.h"
+#include "Commands/Editor/ExecuteBatchCommand.h"
+#include "Commands/Editor/WaitForCompileCommand.h"
+#include "Commands/Editor/FlushSavesCommand.h"
+#include "Commands/Editor/GetMCPMetricsCommand.h"
+#include "Commands/Editor/GetCacheStatsCommand.h"
+#include "Commands/Editor/RecordRequestsCommand.h"
+#include "Commands/Editor/ReplayRequestsCommand.h"
 
-TArray<TSharedPtr<IUnrealMCPCommand>> FEditorCommandRegistration::RegisteredCommands;
+TArray<FString> FEditorCommandRegistration::RegisteredCommandNames;
 
 void FEditorCommandRegistration::RegisterAllCommands()
 {
     UE_LOG(LogTemp, Log, TEXT("Registering Editor commands..."));
     
-    // Get the editor service instance
-    IEditorService& EditorService = FEditorService::Get();
-    
     // Register actor manipulation commands
-    RegisterAndTrackCommand(MakeShared<FSpawnActorCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FDeleteActorCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FSpawnBlueprintActorCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FSetActorTransformCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FGetActorPropertiesCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FSetActorPropertyCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FSetLightPropertyCommand>(EditorService));
+    RegisterAndTrackCommand(TEXT("spawn_actor"), []() { return MakeShared<FSpawnActorCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("delete_actor"), []() { return MakeShared<FDeleteActorCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("spawn_blueprint_actor"), []() { return MakeShared<FSpawnBlueprintActorCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_actor_transform"), []() { return MakeShared<FSetActorTransformCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_actor_properties"), []() { return MakeShared<FGetActorPropertiesCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_actor_property"), []() { return MakeShared<FSetActorPropertyCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_light_property"), []() { return MakeShared<FSetLightPropertyCommand>(FEditorService::Get()); });
 
     // Register consolidated metadata command (replaces get_actors_in_level, find_actors_by_name)
-    RegisterAndTrackCommand(MakeShared<FGetLevelMetadataCommand>(EditorService));
+    RegisterAndTrackCommand(TEXT("get_level_metadata"), []() { return MakeShared<FGetLevelMetadataCommand>(FEditorService::Get()); });
 
     // Register batch operations
-    RegisterAndTrackCommand(MakeShared<FBatchDeleteActorsCommand>(EditorService));
-    RegisterAndTrackCommand(MakeShared<FBatchSpawnActorsCommand>(EditorService));
+    RegisterAndTrackCommand(TEXT("batch_delete_actors"), []() { return MakeShared<FBatchDeleteActorsCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("batch_spawn_actors"), []() { return MakeShared<FBatchSpawnActorsCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("convert_actors_to_instances"), []() { return MakeShared<FConvertActorsToInstancesCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_actor_transforms_batch"), []() { return MakeShared<FSetActorTransformsBatchCommand>(FEditorService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_actor_properties_batch"), []() { return MakeShared<FSetActorPropertiesBatchCommand>(FEditorService::Get()); });
+
+    // Register the generic batch envelope (runs any other registered commands in one request)
+    RegisterAndTrackCommand(TEXT("execute_batch"), []() { return MakeShared<FExecuteBatchCommand>(); });
+
+    // Register the deferred compile results command (compile_* commands called with "deferred": true)
+    RegisterAndTrackCommand(TEXT("wait_for_compile"), []() { return MakeShared<FWaitForCompileCommand>(); });
+
+    // Register the queued package save flush (see FMCPSaveQueue)
+    RegisterAndTrackCommand(TEXT("flush_saves"), []() { return MakeShared<FFlushSavesCommand>(); });
+
+    // Register the server metrics report (see FMCPMetrics)
+    RegisterAndTrackCommand(TEXT("get_mcp_metrics"), []() { return MakeShared<FGetMCPMetricsCommand>(); });
+
+    // Register the cache, pool and index statistics report (see FMCPCacheStatsRegistry)
+    RegisterAndTrackCommand(TEXT("get_cache_stats"), []() { return MakeShared<FGetCacheStatsCommand>(); });
+
+    // Register request recording and replay (see FMCPRequestRecorder, FMCPRequestReplayer)
+    RegisterAndTrackCommand(TEXT("record_requests"), []() { return MakeShared<FRecordRequestsCommand>(); });
+    RegisterAndTrackCommand(TEXT("replay_requests"), []() { return MakeShared<FReplayRequestsCommand>(); });
 
     // Note: Additional editor commands are handled by legacy command system
     // and will be migrated to the new architecture in future iterations:
@@ -52,7 +81,7 @@ void FEditorCommandRegistration::RegisterAllCommands()
     // RegisterAndTrackCommand(MakeShared<FFindBlueprintsCommand>(EditorService));
     // RegisterAndTrackCommand(MakeShared<FFindDataTablesCommand>(EditorService));
     
-    UE_LOG(LogTemp, Log, TEXT("Registered %d Editor commands"), RegisteredCommands.Num());
+    UE_LOG(LogTemp, Log, TEXT("Registered %d Editor commands"), RegisteredCommandNames.Num());
 }
 
 void FEditorCommandRegistration::UnregisterAllCommands()
@@ -61,35 +90,26 @@ void FEditorCommandRegistration::UnregisterAllCommands()
     
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
     
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
-        {
-            Registry.UnregisterCommand(Command->GetCommandName());
-        }
+        Registry.UnregisterCommand(CommandName);
     }
     
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     UE_LOG(LogTemp, Log, TEXT("Unregistered all Editor commands"));
 }
 
-void FEditorCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FEditorCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("Attempted to register invalid Editor command"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    
-    if (Registry.RegisterCommand(Command))
+
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("Registered Editor command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("Registered Editor command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to register Editor command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Error, TEXT("Failed to register Editor command: %s"), *CommandName);
     }
 }
@@ -1,6 +1,7 @@
 #include "Commands/GraphManipulation/AutoArrangeNodesCommand.h"
 #include "Services/NodeLayout/NodeLayoutService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Utils/GraphUtils.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -66,6 +67,39 @@ FString FAutoArrangeNodesCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("Graph not found: %s in Blueprint %s"), *GraphName, *BlueprintName));
     }
 
+    // Parse node_ids (optional): only these nodes are placed, the rest of the graph stays put
+    const TArray<TSharedPtr<FJsonValue>>* NodeIdsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("node_ids"), NodeIdsArray) && NodeIdsArray->Num() > 0)
+    {
+        TMap<FString, UEdGraphNode*> NodesById;
+        for (UEdGraphNode* Node : TargetGraph->Nodes)
+        {
+            if (Node)
+            {
+                NodesById.Add(FGraphUtils::GetReliableNodeId(Node), Node);
+            }
+        }
+
+        TArray<UEdGraphNode*> NewNodes;
+        for (const TSharedPtr<FJsonValue>& NodeIdValue : *NodeIdsArray)
+        {
+            const FString NodeId = NodeIdValue->AsString();
+            UEdGraphNode** Node = NodesById.Find(NodeId);
+            if (!Node)
+            {
+                return CreateErrorResponse(FString::Printf(TEXT("Node not found: %s in graph %s"), *NodeId, *GraphName));
+            }
+            NewNodes.AddUnique(*Node);
+        }
+
+        int32 ArrangedCount = 0;
+        if (!FNodeLayoutService::ArrangeNewNodes(TargetGraph, NewNodes, ArrangedCount))
+        {
+            return CreateErrorResponse(TEXT("Failed to arrange nodes"));
+        }
+        return CreateSuccessResponse(BlueprintName, GraphName, ArrangedCount);
+    }
+
     // Auto-arrange nodes
     int32 ArrangedCount = 0;
     if (!FNodeLayoutService::AutoArrangeNodes(TargetGraph, ArrangedCount))
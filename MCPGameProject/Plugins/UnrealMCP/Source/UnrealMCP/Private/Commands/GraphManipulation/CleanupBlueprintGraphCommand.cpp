@@ -7,9 +7,9 @@
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "K2Node_CallFunction.h"
-#include "K2Node_FunctionResult.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "ScopedTransaction.h"
+#include "MCPBatchEditScope.h"
 
 FCleanupBlueprintGraphCommand::FCleanupBlueprintGraphCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -166,75 +166,12 @@ FString FCleanupBlueprintGraphCommand::ExecuteOrphansCleanup(UBlueprint* Bluepri
 
     for (UEdGraph* Graph : GraphsToProcess)
     {
-        TArray<FString> OrphanedNodeIds;
-        if (!FGraphUtils::DetectOrphanedNodes(Graph, OrphanedNodeIds))
-        {
-            continue;
-        }
-
-        // Build node ID to node map
-        TMap<FString, UEdGraphNode*> NodeIdMap;
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (Node)
-            {
-                NodeIdMap.Add(FGraphUtils::GetReliableNodeId(Node), Node);
-            }
-        }
-
-        // Delete each orphaned node
-        for (const FString& NodeId : OrphanedNodeIds)
-        {
-            UEdGraphNode** NodePtr = NodeIdMap.Find(NodeId);
-            if (!NodePtr || !*NodePtr)
-            {
-                continue;
-            }
-
-            UEdGraphNode* Node = *NodePtr;
-
-            // Skip auto-generated Return Nodes at (0,0)
-            UK2Node_FunctionResult* ResultNode = Cast<UK2Node_FunctionResult>(Node);
-            if (ResultNode && Node->NodePosX == 0 && Node->NodePosY == 0)
-            {
-                bool bHasConnections = false;
-                for (UEdGraphPin* Pin : Node->Pins)
-                {
-                    if (Pin && Pin->LinkedTo.Num() > 0)
-                    {
-                        bHasConnections = true;
-                        break;
-                    }
-                }
-                if (!bHasConnections)
-                {
-                    continue;
-                }
-            }
-
-            FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-            FString FullTitle = FString::Printf(TEXT("%s [%s]"), *NodeTitle, *Graph->GetName());
-
-            Graph->Modify();
-            Node->Modify();
-
-            for (UEdGraphPin* Pin : Node->Pins)
-            {
-                if (Pin)
-                {
-                    Pin->BreakAllPinLinks();
-                }
-            }
-
-            Graph->RemoveNode(Node);
-            DeletedNodeTitles.Add(FullTitle);
-            TotalDeleted++;
-        }
+        TotalDeleted += FGraphUtils::DeleteOrphanedNodes(Graph, true, DeletedNodeTitles);
     }
 
     if (TotalDeleted > 0)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     }
 
     return CreateSuccessResponse(Blueprint->GetName(), TEXT("orphans"), TotalDeleted, 0, DeletedNodeTitles, SkippedGraphs);
@@ -355,7 +292,7 @@ FString FCleanupBlueprintGraphCommand::ExecutePrintStringsCleanup(UBlueprint* Bl
 
     if (TotalDeleted > 0)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     }
 
     return CreateSuccessResponse(Blueprint->GetName(), TEXT("print_strings"), TotalDeleted, TotalRewired,
@@ -5,10 +5,9 @@
 #include "Serialization/JsonSerializer.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphNode.h"
-#include "K2Node_FunctionResult.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "ScopedTransaction.h"
+#include "MCPBatchEditScope.h"
 
 FDeleteOrphanedNodesCommand::FDeleteOrphanedNodesCommand(IBlueprintService& InBlueprintService)
     : BlueprintService(InBlueprintService)
@@ -86,90 +85,13 @@ FString FDeleteOrphanedNodesCommand::Execute(const FString& Parameters)
 
     for (UEdGraph* Graph : GraphsToProcess)
     {
-        TArray<FString> OrphanedNodeIds;
-        if (!FGraphUtils::DetectOrphanedNodes(Graph, OrphanedNodeIds))
-        {
-            continue;
-        }
-
-        // Build node ID to node map
-        TMap<FString, UEdGraphNode*> NodeIdMap;
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (Node)
-            {
-                NodeIdMap.Add(FGraphUtils::GetReliableNodeId(Node), Node);
-            }
-        }
-
-        // Delete each orphaned node
-        for (const FString& NodeId : OrphanedNodeIds)
-        {
-            UEdGraphNode** NodePtr = NodeIdMap.Find(NodeId);
-            if (!NodePtr || !*NodePtr)
-            {
-                continue;
-            }
-
-            UEdGraphNode* Node = *NodePtr;
-
-            // Optionally skip auto-generated Return Nodes at (0,0)
-            if (bExcludeReturnNodes)
-            {
-                UK2Node_FunctionResult* ResultNode = Cast<UK2Node_FunctionResult>(Node);
-                if (ResultNode && Node->NodePosX == 0 && Node->NodePosY == 0)
-                {
-                    // Check if it has no connections (truly unused)
-                    bool bHasConnections = false;
-                    for (UEdGraphPin* Pin : Node->Pins)
-                    {
-                        if (Pin && Pin->LinkedTo.Num() > 0)
-                        {
-                            bHasConnections = true;
-                            break;
-                        }
-                    }
-
-                    if (!bHasConnections)
-                    {
-                        UE_LOG(LogTemp, Display, TEXT("DeleteOrphanedNodes: Skipping auto-generated Return Node at (0,0) in graph '%s'"),
-                            *Graph->GetName());
-                        continue;
-                    }
-                }
-            }
-
-            // Get node title for logging
-            FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-            FString FullTitle = FString::Printf(TEXT("%s [%s]"), *NodeTitle, *Graph->GetName());
-
-            // Mark graph and node as modified for undo support
-            Graph->Modify();
-            Node->Modify();
-
-            // Disconnect all pins before removing
-            for (UEdGraphPin* Pin : Node->Pins)
-            {
-                if (Pin)
-                {
-                    Pin->BreakAllPinLinks();
-                }
-            }
-
-            // Remove the node
-            Graph->RemoveNode(Node);
-            DeletedNodeTitles.Add(FullTitle);
-            TotalDeleted++;
-
-            UE_LOG(LogTemp, Display, TEXT("DeleteOrphanedNodes: Deleted '%s' from graph '%s'"),
-                *NodeTitle, *Graph->GetName());
-        }
+        TotalDeleted += FGraphUtils::DeleteOrphanedNodes(Graph, bExcludeReturnNodes, DeletedNodeTitles);
     }
 
     // Mark blueprint as modified if we deleted anything
     if (TotalDeleted > 0)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     }
 
     return CreateSuccessResponse(BlueprintName, TotalDeleted, DeletedNodeTitles, SkippedGraphs);
@@ -12,6 +12,7 @@
 #include "K2Node_CallFunction.h"
 #include "EdGraphSchema_K2.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "MCPBatchEditScope.h"
 
 FString FSetNodePinValueCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
@@ -359,7 +360,7 @@ FString FSetNodePinValueCommand::Execute(const FString& Parameters)
 
     // Mark blueprint as modified
     Blueprint->Modify();
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Create success response
     TSharedPtr<FJsonObject> ResponseObj = MakeShareable(new FJsonObject());
@@ -56,63 +56,43 @@ void FGraphManipulationCommandRegistration::UnregisterAllGraphManipulationComman
 
 void FGraphManipulationCommandRegistration::RegisterDisconnectNodeCommand()
 {
-    TSharedPtr<FDisconnectNodeCommand> Command = MakeShared<FDisconnectNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("disconnect_node"), []() { return MakeShared<FDisconnectNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterDeleteNodeCommand()
 {
-    TSharedPtr<FDeleteNodeCommand> Command = MakeShared<FDeleteNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("delete_node"), []() { return MakeShared<FDeleteNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterReplaceNodeCommand()
 {
-    TSharedPtr<FReplaceNodeCommand> Command = MakeShared<FReplaceNodeCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("replace_node"), []() { return MakeShared<FReplaceNodeCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterSetNodePinValueCommand()
 {
-    TSharedPtr<FSetNodePinValueCommand> Command = MakeShared<FSetNodePinValueCommand>(FBlueprintNodeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_node_pin_value"), []() { return MakeShared<FSetNodePinValueCommand>(FBlueprintNodeService::Get()); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterAutoArrangeNodesCommand()
 {
-    TSharedPtr<FAutoArrangeNodesCommand> Command = MakeShared<FAutoArrangeNodesCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("auto_arrange_nodes"), []() { return MakeShared<FAutoArrangeNodesCommand>(); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterDeleteOrphanedNodesCommand()
 {
-    TSharedPtr<FDeleteOrphanedNodesCommand> Command = MakeShared<FDeleteOrphanedNodesCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("delete_orphaned_nodes"), []() { return MakeShared<FDeleteOrphanedNodesCommand>(FBlueprintService::Get()); });
 }
 
 void FGraphManipulationCommandRegistration::RegisterCleanupBlueprintGraphCommand()
 {
-    TSharedPtr<FCleanupBlueprintGraphCommand> Command = MakeShared<FCleanupBlueprintGraphCommand>(FBlueprintService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("cleanup_blueprint_graph"), []() { return MakeShared<FCleanupBlueprintGraphCommand>(FBlueprintService::Get()); });
 }
 
-void FGraphManipulationCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FGraphManipulationCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FGraphManipulationCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-    
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FGraphManipulationCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
-    
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FGraphManipulationCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
@@ -0,0 +1,58 @@
+#include "Commands/IUnrealMCPCommand.h"
+#include "MCPTrace.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+void IUnrealMCPCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    Response.SetSerializedResult(Execute(SerializeParams(Params)));
+}
+
+bool IUnrealMCPCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return ValidateParams(SerializeParams(Params));
+}
+
+FString IUnrealMCPCommand::ExecuteFromString(const FString& Parameters)
+{
+    FMCPResponseWriter Response;
+    TSharedPtr<FJsonObject> Params = ParseParams(Parameters);
+    if (Params.IsValid())
+    {
+        Execute(Params.ToSharedRef(), Response);
+    }
+    else
+    {
+        Response.SetError(TEXT("Invalid JSON parameters"));
+    }
+    return Response.GetSerializedResult();
+}
+
+bool IUnrealMCPCommand::ValidateParamsFromString(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> Params = ParseParams(Parameters);
+    return Params.IsValid() && ValidateParams(Params.ToSharedRef());
+}
+
+FString IUnrealMCPCommand::SerializeParams(const TSharedRef<FJsonObject>& Params)
+{
+    MCP_TRACE_SCOPE("MCP::SerializeParams");
+    FString ParamsString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
+    FJsonSerializer::Serialize(Params, Writer);
+    return ParamsString;
+}
+
+TSharedPtr<FJsonObject> IUnrealMCPCommand::ParseParams(const FString& Parameters)
+{
+    MCP_TRACE_SCOPE("MCP::ParseParams");
+    TSharedPtr<FJsonObject> Params;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, Params))
+    {
+        return nullptr;
+    }
+    return Params;
+}
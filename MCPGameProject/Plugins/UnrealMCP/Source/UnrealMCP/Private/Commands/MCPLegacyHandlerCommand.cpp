@@ -0,0 +1,59 @@
+#include "Commands/MCPLegacyHandlerCommand.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Dom/JsonObject.h"
+
+FMCPLegacyHandlerCommand::FMCPLegacyHandlerCommand(const FString& InCommandName, FHandler InHandler)
+    : CommandName(InCommandName)
+    , Handler(MoveTemp(InHandler))
+{
+}
+
+TArray<TSharedPtr<IUnrealMCPCommand>> FMCPLegacyHandlerCommand::RegisterHandler(const TArray<FString>& CommandNames, const FHandler& Handler)
+{
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    
+    TArray<TSharedPtr<IUnrealMCPCommand>> Registered;
+    for (const FString& Name : CommandNames)
+    {
+        // Dedicated command classes take precedence, as they did over the bridge's fallback lists
+        TSharedPtr<IUnrealMCPCommand> Command = MakeShared<FMCPLegacyHandlerCommand>(Name, Handler);
+        if (Registry.RegisterCommand(Command, false))
+        {
+            Registered.Add(Command);
+        }
+    }
+    return Registered;
+}
+
+FString FMCPLegacyHandlerCommand::Execute(const FString& Parameters)
+{
+    return ExecuteFromString(Parameters);
+}
+
+void FMCPLegacyHandlerCommand::Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    TSharedPtr<FJsonObject> Result = Handler(CommandName, Params);
+    if (Result.IsValid())
+    {
+        Response.SetResult(Result.ToSharedRef());
+    }
+    else
+    {
+        Response.SetError(FString::Printf(TEXT("Command '%s' returned no result"), *CommandName));
+    }
+}
+
+FString FMCPLegacyHandlerCommand::GetCommandName() const
+{
+    return CommandName;
+}
+
+bool FMCPLegacyHandlerCommand::ValidateParams(const FString& Parameters) const
+{
+    return ValidateParamsFromString(Parameters);
+}
+
+bool FMCPLegacyHandlerCommand::ValidateParams(const TSharedRef<FJsonObject>& Params) const
+{
+    return true;
+}
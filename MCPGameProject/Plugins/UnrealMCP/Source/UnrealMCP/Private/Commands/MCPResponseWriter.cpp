@@ -0,0 +1,88 @@
+#include "Commands/MCPResponseWriter.h"
+#include "MCPErrorHandler.h"
+#include "MCPTrace.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Services/ObjectPoolManager.h"
+#include "Utils/JsonUtils.h"
+
+FMCPResponseWriter::FMCPResponseWriter()
+    : bHasSerializedResult(false)
+    , bHasPlainError(false)
+{
+}
+
+void FMCPResponseWriter::SetResult(const TSharedRef<FJsonObject>& Result)
+{
+    ResultObject = Result;
+    SerializedResult.Reset();
+    bHasSerializedResult = false;
+    PlainError.Reset();
+    bHasPlainError = false;
+}
+
+void FMCPResponseWriter::SetSerializedResult(const FString& ResultJson)
+{
+    ResultObject.Reset();
+    SerializedResult = ResultJson;
+    bHasSerializedResult = true;
+    PlainError.Reset();
+    bHasPlainError = false;
+}
+
+void FMCPResponseWriter::SetError(const FString& Message)
+{
+    // Built into an object only if someone asks for one
+    ResultObject.Reset();
+    SerializedResult.Reset();
+    bHasSerializedResult = false;
+    PlainError = Message;
+    bHasPlainError = true;
+}
+
+void FMCPResponseWriter::SetError(const FMCPError& Error)
+{
+    SetResult(FMCPErrorHandler::CreateStructuredErrorObject(Error));
+}
+
+TSharedPtr<FJsonObject> FMCPResponseWriter::GetResultObject()
+{
+    if (!ResultObject.IsValid() && bHasPlainError)
+    {
+        ResultObject = MakeShared<FJsonObject>();
+        ResultObject->SetBoolField(TEXT("success"), false);
+        ResultObject->SetStringField(TEXT("error"), PlainError);
+    }
+    else if (!ResultObject.IsValid() && bHasSerializedResult)
+    {
+        MCP_TRACE_SCOPE("MCP::ParseResult");
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SerializedResult);
+        FJsonSerializer::Deserialize(Reader, ResultObject);
+    }
+    return ResultObject;
+}
+
+FString FMCPResponseWriter::GetSerializedResult()
+{
+    if (!bHasSerializedResult && bHasPlainError)
+    {
+        SerializedResult = TEXT("{\"success\":false,\"error\":");
+        FJsonUtils::AppendJsonString(SerializedResult, PlainError);
+        SerializedResult.AppendChar(TEXT('}'));
+        bHasSerializedResult = true;
+        return SerializedResult;
+    }
+
+    if (!bHasSerializedResult && ResultObject.IsValid())
+    {
+        MCP_TRACE_SCOPE("MCP::SerializeResult");
+        FScopedPooledStringBuffer SerializeBuffer;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SerializeBuffer.Get());
+        FJsonSerializer::Serialize(ResultObject.ToSharedRef(), Writer);
+        SerializedResult = SerializeBuffer.Get();
+        bHasSerializedResult = true;
+    }
+    return SerializedResult;
+}
@@ -9,6 +9,59 @@ FBatchSetMaterialParamsCommand::FBatchSetMaterialParamsCommand(IMaterialService&
 {
 }
 
+namespace
+{
+    /** Parameter maps arrive as JSON objects, or as JSON strings from older clients */
+    bool TryGetParamsObject(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* FieldName, TSharedPtr<FJsonObject>& OutObject)
+    {
+        const TSharedPtr<FJsonObject>* Object = nullptr;
+        if (JsonObject->TryGetObjectField(FieldName, Object))
+        {
+            OutObject = *Object;
+            return true;
+        }
+
+        FString ObjectString;
+        if (JsonObject->TryGetStringField(FieldName, ObjectString))
+        {
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ObjectString);
+            return FJsonSerializer::Deserialize(Reader, OutObject) && OutObject.IsValid();
+        }
+        return false;
+    }
+
+    bool TryGetColor(const TSharedPtr<FJsonValue>& Value, FLinearColor& OutColor)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* ColorArray;
+        if (!Value.IsValid() || !Value->TryGetArray(ColorArray) || ColorArray->Num() < 3)
+        {
+            return false;
+        }
+        OutColor.R = static_cast<float>((*ColorArray)[0]->AsNumber());
+        OutColor.G = static_cast<float>((*ColorArray)[1]->AsNumber());
+        OutColor.B = static_cast<float>((*ColorArray)[2]->AsNumber());
+        OutColor.A = ColorArray->Num() >= 4 ? static_cast<float>((*ColorArray)[3]->AsNumber()) : 1.0f;
+        return true;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonStrings(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShared<FJsonValueString>(String));
+        }
+        return Values;
+    }
+
+    bool IsMultiInstanceRequest(const TSharedPtr<FJsonObject>& JsonObject)
+    {
+        return JsonObject->HasField(TEXT("material_instances")) || JsonObject->HasField(TEXT("folder"))
+            || JsonObject->HasField(TEXT("parent_material"));
+    }
+}
+
 FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
 {
     TSharedPtr<FJsonObject> JsonObject;
@@ -19,6 +72,41 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Invalid JSON parameters"));
     }
 
+    FMaterialInstanceParameterBatch Batch;
+    TSharedPtr<FJsonObject> ScalarParamsObj;
+    if (TryGetParamsObject(JsonObject, TEXT("scalar_params"), ScalarParamsObj))
+    {
+        for (const auto& Pair : ScalarParamsObj->Values)
+        {
+            Batch.ScalarParams.Add(Pair.Key, static_cast<float>(Pair.Value->AsNumber()));
+        }
+    }
+    TSharedPtr<FJsonObject> VectorParamsObj;
+    if (TryGetParamsObject(JsonObject, TEXT("vector_params"), VectorParamsObj))
+    {
+        for (const auto& Pair : VectorParamsObj->Values)
+        {
+            FLinearColor Color;
+            if (TryGetColor(Pair.Value, Color))
+            {
+                Batch.VectorParams.Add(Pair.Key, Color);
+            }
+        }
+    }
+    TSharedPtr<FJsonObject> TextureParamsObj;
+    if (TryGetParamsObject(JsonObject, TEXT("texture_params"), TextureParamsObj))
+    {
+        for (const auto& Pair : TextureParamsObj->Values)
+        {
+            Batch.TextureParams.Add(Pair.Key, Pair.Value->AsString());
+        }
+    }
+
+    if (IsMultiInstanceRequest(JsonObject))
+    {
+        return ExecuteForInstances(JsonObject, Batch);
+    }
+
     FString MaterialPath;
     if (!JsonObject->TryGetStringField(TEXT("material_instance"), MaterialPath))
     {
@@ -30,58 +118,127 @@ FString FBatchSetMaterialParamsCommand::Execute(const FString& Parameters)
     TArray<FString> SetTextureParams;
     FString Error;
 
-    // Process scalar parameters
-    const TSharedPtr<FJsonObject>* ScalarParamsObj;
-    if (JsonObject->TryGetObjectField(TEXT("scalar_params"), ScalarParamsObj))
+    for (const TPair<FString, float>& Param : Batch.ScalarParams)
     {
-        for (const auto& Pair : (*ScalarParamsObj)->Values)
+        if (MaterialService.SetScalarParameter(MaterialPath, Param.Key, Param.Value, Error))
         {
-            float Value = static_cast<float>(Pair.Value->AsNumber());
-            if (MaterialService.SetScalarParameter(MaterialPath, Pair.Key, Value, Error))
-            {
-                SetScalarParams.Add(Pair.Key);
-            }
+            SetScalarParams.Add(Param.Key);
+        }
+    }
+    for (const TPair<FString, FLinearColor>& Param : Batch.VectorParams)
+    {
+        if (MaterialService.SetVectorParameter(MaterialPath, Param.Key, Param.Value, Error))
+        {
+            SetVectorParams.Add(Param.Key);
+        }
+    }
+    for (const TPair<FString, FString>& Param : Batch.TextureParams)
+    {
+        if (MaterialService.SetTextureParameter(MaterialPath, Param.Key, Param.Value, Error))
+        {
+            SetTextureParams.Add(Param.Key);
         }
     }
 
-    // Process vector parameters
-    const TSharedPtr<FJsonObject>* VectorParamsObj;
-    if (JsonObject->TryGetObjectField(TEXT("vector_params"), VectorParamsObj))
+    return CreateSuccessResponse(MaterialPath, SetScalarParams, SetVectorParams, SetTextureParams);
+}
+
+FString FBatchSetMaterialParamsCommand::ExecuteForInstances(const TSharedPtr<FJsonObject>& JsonObject, const FMaterialInstanceParameterBatch& Batch) const
+{
+    if (Batch.IsEmpty())
+    {
+        return CreateErrorResponse(TEXT("No parameters to set"));
+    }
+
+    // Explicit paths and a folder/parent filter add up
+    TArray<FString> InstancePaths;
+    const TArray<TSharedPtr<FJsonValue>>* InstancesArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("material_instances"), InstancesArray))
     {
-        for (const auto& Pair : (*VectorParamsObj)->Values)
+        for (const TSharedPtr<FJsonValue>& Value : *InstancesArray)
         {
-            const TArray<TSharedPtr<FJsonValue>>* ColorArray;
-            if (Pair.Value->TryGetArray(ColorArray) && ColorArray->Num() >= 3)
+            FString InstancePath;
+            if (Value.IsValid() && Value->TryGetString(InstancePath) && !InstancePath.IsEmpty())
             {
-                FLinearColor Color;
-                Color.R = static_cast<float>((*ColorArray)[0]->AsNumber());
-                Color.G = static_cast<float>((*ColorArray)[1]->AsNumber());
-                Color.B = static_cast<float>((*ColorArray)[2]->AsNumber());
-                Color.A = ColorArray->Num() >= 4 ? static_cast<float>((*ColorArray)[3]->AsNumber()) : 1.0f;
-
-                if (MaterialService.SetVectorParameter(MaterialPath, Pair.Key, Color, Error))
-                {
-                    SetVectorParams.Add(Pair.Key);
-                }
+                InstancePaths.AddUnique(InstancePath);
             }
         }
     }
 
-    // Process texture parameters
-    const TSharedPtr<FJsonObject>* TextureParamsObj;
-    if (JsonObject->TryGetObjectField(TEXT("texture_params"), TextureParamsObj))
+    FString Folder;
+    FString ParentMaterial;
+    JsonObject->TryGetStringField(TEXT("folder"), Folder);
+    JsonObject->TryGetStringField(TEXT("parent_material"), ParentMaterial);
+    if (!Folder.IsEmpty() || !ParentMaterial.IsEmpty())
+    {
+        bool bRecursive = true;
+        JsonObject->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+        TArray<FString> FoundPaths;
+        FString Error;
+        if (!MaterialService.FindMaterialInstances(Folder, ParentMaterial, bRecursive, FoundPaths, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+        for (const FString& FoundPath : FoundPaths)
+        {
+            InstancePaths.AddUnique(FoundPath);
+        }
+    }
+
+    if (InstancePaths.Num() == 0)
+    {
+        return CreateErrorResponse(TEXT("No material instances matched"));
+    }
+
+    bool bSave = true;
+    JsonObject->TryGetBoolField(TEXT("save"), bSave);
+
+    TArray<FMaterialInstanceParameterResult> Results;
+    FString Error;
+    const int32 UpdatedCount = MaterialService.SetMaterialInstanceParameters(InstancePaths, Batch, bSave, Results, Error);
+    if (UpdatedCount == INDEX_NONE)
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Results.Num());
+    for (const FMaterialInstanceParameterResult& Result : Results)
     {
-        for (const auto& Pair : (*TextureParamsObj)->Values)
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("material_instance"), Result.InstancePath);
+        ResultObj->SetBoolField(TEXT("success"), Result.Error.IsEmpty());
+        if (!Result.Error.IsEmpty())
         {
-            FString TexturePath = Pair.Value->AsString();
-            if (MaterialService.SetTextureParameter(MaterialPath, Pair.Key, TexturePath, Error))
+            ResultObj->SetStringField(TEXT("error"), Result.Error);
+        }
+        else
+        {
+            ResultObj->SetArrayField(TEXT("scalar"), ToJsonStrings(Result.SetScalarParams));
+            ResultObj->SetArrayField(TEXT("vector"), ToJsonStrings(Result.SetVectorParams));
+            ResultObj->SetArrayField(TEXT("texture"), ToJsonStrings(Result.SetTextureParams));
+            if (Result.MissingParams.Num() > 0)
             {
-                SetTextureParams.Add(Pair.Key);
+                ResultObj->SetArrayField(TEXT("missing"), ToJsonStrings(Result.MissingParams));
             }
         }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
     }
 
-    return CreateSuccessResponse(MaterialPath, SetScalarParams, SetVectorParams, SetTextureParams);
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), UpdatedCount == InstancePaths.Num());
+    ResponseObj->SetNumberField(TEXT("instance_count"), InstancePaths.Num());
+    ResponseObj->SetNumberField(TEXT("updated_count"), UpdatedCount);
+    ResponseObj->SetBoolField(TEXT("saved"), bSave);
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Updated %d of %d material instances"), UpdatedCount, InstancePaths.Num()));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
 }
 
 bool FBatchSetMaterialParamsCommand::ValidateParams(const FString& Parameters) const
@@ -95,7 +252,7 @@ bool FBatchSetMaterialParamsCommand::ValidateParams(const FString& Parameters) c
     }
 
     FString MaterialPath;
-    return JsonObject->TryGetStringField(TEXT("material_instance"), MaterialPath);
+    return JsonObject->TryGetStringField(TEXT("material_instance"), MaterialPath) || IsMultiInstanceRequest(JsonObject);
 }
 
 FString FBatchSetMaterialParamsCommand::CreateSuccessResponse(const FString& MaterialPath, const TArray<FString>& ScalarParams, const TArray<FString>& VectorParams, const TArray<FString>& TextureParams) const
@@ -0,0 +1,73 @@
+#include "Commands/Material/BeginMaterialEditSessionCommand.h"
+#include "Services/MaterialExpressionService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBeginMaterialEditSessionCommand::FBeginMaterialEditSessionCommand()
+{
+}
+
+FString FBeginMaterialEditSessionCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FString MaterialPath;
+    if (!JsonObject->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    FString Error;
+    if (!FMaterialExpressionService::Get().BeginEditSession(MaterialPath, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("material_path"), MaterialPath);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FBeginMaterialEditSessionCommand::GetCommandName() const
+{
+    return TEXT("begin_material_edit_session");
+}
+
+bool FBeginMaterialEditSessionCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    return JsonObject->HasField(TEXT("material_path"));
+}
+
+FString FBeginMaterialEditSessionCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -0,0 +1,70 @@
+#include "Commands/Material/BuildMaterialGraphCommand.h"
+#include "Services/MaterialExpressionService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBuildMaterialGraphCommand::FBuildMaterialGraphCommand()
+{
+}
+
+FString FBuildMaterialGraphCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FMaterialGraphBuildSpec Spec;
+    FString Error;
+    if (!FMaterialGraphBuildSpec::FromJson(JsonObject, Spec, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> Result;
+    if (!FMaterialExpressionService::Get().BuildMaterialGraph(Spec, Result, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FBuildMaterialGraphCommand::GetCommandName() const
+{
+    return TEXT("build_material_graph");
+}
+
+bool FBuildMaterialGraphCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    return JsonObject->HasField(TEXT("material_path")) && JsonObject->HasField(TEXT("expressions"));
+}
+
+FString FBuildMaterialGraphCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
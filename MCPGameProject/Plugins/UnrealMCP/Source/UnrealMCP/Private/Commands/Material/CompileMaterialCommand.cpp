@@ -3,6 +3,7 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "MCPCompileQueue.h"
 
 FCompileMaterialCommand::FCompileMaterialCommand()
 {
@@ -24,9 +25,22 @@ FString FCompileMaterialCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
     }
 
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (FMCPCompileQueue::Get().TryDefer(GetCommandName(), MaterialPath, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
+
+    // "async": true answers with a job id at once; get_material_compile_status reports the outcome
+    bool bAsync = false;
+    JsonObject->TryGetBoolField(TEXT("async"), bAsync);
+
     TSharedPtr<FJsonObject> Result;
     FString Error;
-    bool bSuccess = FMaterialExpressionService::Get().CompileMaterial(MaterialPath, Result, Error);
+    bool bSuccess = bAsync
+        ? FMaterialExpressionService::Get().StartCompileMaterial(MaterialPath, Result, Error)
+        : FMaterialExpressionService::Get().CompileMaterial(MaterialPath, Result, Error);
 
     if (!bSuccess)
     {
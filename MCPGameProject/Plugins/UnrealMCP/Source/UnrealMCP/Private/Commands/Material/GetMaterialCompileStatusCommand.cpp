@@ -0,0 +1,72 @@
+#include "Commands/Material/GetMaterialCompileStatusCommand.h"
+#include "Services/MaterialExpressionService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGetMaterialCompileStatusCommand::FGetMaterialCompileStatusCommand()
+{
+}
+
+FString FGetMaterialCompileStatusCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    double JobId = 0.0;
+    if (!JsonObject->TryGetNumberField(TEXT("job_id"), JobId))
+    {
+        return CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FJsonObject> Result;
+    FString Error;
+    bool bSuccess = FMaterialExpressionService::Get().GetCompileJobStatus(static_cast<int64>(JobId), Result, Error);
+
+    if (!bSuccess)
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+FString FGetMaterialCompileStatusCommand::GetCommandName() const
+{
+    return TEXT("get_material_compile_status");
+}
+
+bool FGetMaterialCompileStatusCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    return JsonObject->HasField(TEXT("job_id"));
+}
+
+FString FGetMaterialCompileStatusCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -27,45 +27,50 @@
 #include "Commands/Material/DeleteMaterialExpressionCommand.h"
 #include "Commands/Material/SetMaterialExpressionPropertyCommand.h"
 #include "Commands/Material/CompileMaterialCommand.h"
+#include "Commands/Material/BeginMaterialEditSessionCommand.h"
+#include "Commands/Material/EndMaterialEditSessionCommand.h"
+#include "Commands/Material/BuildMaterialGraphCommand.h"
+#include "Commands/Material/GetMaterialCompileStatusCommand.h"
 #include "Commands/Material/SearchMaterialPaletteCommand.h"
 
-TArray<TSharedPtr<IUnrealMCPCommand>> FMaterialCommandRegistration::RegisteredCommands;
+TArray<FString> FMaterialCommandRegistration::RegisteredCommandNames;
 
 void FMaterialCommandRegistration::RegisterAllCommands()
 {
     UE_LOG(LogTemp, Log, TEXT("Registering Material commands..."));
 
-    // Get the material service instance
-    IMaterialService& MaterialService = FMaterialService::Get();
-
     // Register material manipulation commands
-    RegisterAndTrackCommand(MakeShared<FCreateMaterialCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FCreateMaterialInstanceCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FGetMaterialMetadataCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FSetMaterialParameterCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FGetMaterialParameterCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FApplyMaterialToActorCommand>(MaterialService));
+    RegisterAndTrackCommand(TEXT("create_material"), []() { return MakeShared<FCreateMaterialCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("create_material_instance"), []() { return MakeShared<FCreateMaterialInstanceCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_material_metadata"), []() { return MakeShared<FGetMaterialMetadataCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_material_parameter"), []() { return MakeShared<FSetMaterialParameterCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_material_parameter"), []() { return MakeShared<FGetMaterialParameterCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("apply_material_to_actor"), []() { return MakeShared<FApplyMaterialToActorCommand>(FMaterialService::Get()); });
 
     // Register Python MCP-compatible parameter commands
-    RegisterAndTrackCommand(MakeShared<FSetMaterialScalarParamCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FSetMaterialVectorParamCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FSetMaterialTextureParamCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FDuplicateMaterialInstanceCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FBatchSetMaterialParamsCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FGetMaterialInstanceMetadataCommand>(MaterialService));
-    RegisterAndTrackCommand(MakeShared<FGetMaterialParametersCommand>(MaterialService));
+    RegisterAndTrackCommand(TEXT("set_material_scalar_param"), []() { return MakeShared<FSetMaterialScalarParamCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_material_vector_param"), []() { return MakeShared<FSetMaterialVectorParamCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_material_texture_param"), []() { return MakeShared<FSetMaterialTextureParamCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("duplicate_material_instance"), []() { return MakeShared<FDuplicateMaterialInstanceCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("batch_set_material_params"), []() { return MakeShared<FBatchSetMaterialParamsCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_material_instance_metadata"), []() { return MakeShared<FGetMaterialInstanceMetadataCommand>(FMaterialService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_material_parameters"), []() { return MakeShared<FGetMaterialParametersCommand>(FMaterialService::Get()); });
 
     // Register material expression commands
-    RegisterAndTrackCommand(MakeShared<FAddMaterialExpressionCommand>());
-    RegisterAndTrackCommand(MakeShared<FConnectMaterialExpressionsCommand>());
-    RegisterAndTrackCommand(MakeShared<FConnectExpressionToMaterialOutputCommand>());
-    RegisterAndTrackCommand(MakeShared<FGetMaterialExpressionMetadataCommand>());
-    RegisterAndTrackCommand(MakeShared<FDeleteMaterialExpressionCommand>());
-    RegisterAndTrackCommand(MakeShared<FSetMaterialExpressionPropertyCommand>());
-    RegisterAndTrackCommand(MakeShared<FCompileMaterialCommand>());
-    RegisterAndTrackCommand(MakeShared<FSearchMaterialPaletteCommand>());
-
-    UE_LOG(LogTemp, Log, TEXT("Registered %d Material commands"), RegisteredCommands.Num());
+    RegisterAndTrackCommand(TEXT("add_material_expression"), []() { return MakeShared<FAddMaterialExpressionCommand>(); });
+    RegisterAndTrackCommand(TEXT("connect_material_expressions"), []() { return MakeShared<FConnectMaterialExpressionsCommand>(); });
+    RegisterAndTrackCommand(TEXT("connect_expression_to_material_output"), []() { return MakeShared<FConnectExpressionToMaterialOutputCommand>(); });
+    RegisterAndTrackCommand(TEXT("get_material_expression_metadata"), []() { return MakeShared<FGetMaterialExpressionMetadataCommand>(); });
+    RegisterAndTrackCommand(TEXT("delete_material_expression"), []() { return MakeShared<FDeleteMaterialExpressionCommand>(); });
+    RegisterAndTrackCommand(TEXT("set_material_expression_property"), []() { return MakeShared<FSetMaterialExpressionPropertyCommand>(); });
+    RegisterAndTrackCommand(TEXT("compile_material"), []() { return MakeShared<FCompileMaterialCommand>(); });
+    RegisterAndTrackCommand(TEXT("begin_material_edit_session"), []() { return MakeShared<FBeginMaterialEditSessionCommand>(); });
+    RegisterAndTrackCommand(TEXT("end_material_edit_session"), []() { return MakeShared<FEndMaterialEditSessionCommand>(); });
+    RegisterAndTrackCommand(TEXT("build_material_graph"), []() { return MakeShared<FBuildMaterialGraphCommand>(); });
+    RegisterAndTrackCommand(TEXT("get_material_compile_status"), []() { return MakeShared<FGetMaterialCompileStatusCommand>(); });
+    RegisterAndTrackCommand(TEXT("search_material_palette"), []() { return MakeShared<FSearchMaterialPaletteCommand>(); });
+
+    UE_LOG(LogTemp, Log, TEXT("Registered %d Material commands"), RegisteredCommandNames.Num());
 }
 
 void FMaterialCommandRegistration::UnregisterAllCommands()
@@ -74,35 +79,26 @@ void FMaterialCommandRegistration::UnregisterAllCommands()
 
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
 
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
-        {
-            Registry.UnregisterCommand(Command->GetCommandName());
-        }
+        Registry.UnregisterCommand(CommandName);
     }
 
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     UE_LOG(LogTemp, Log, TEXT("Unregistered all Material commands"));
 }
 
-void FMaterialCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FMaterialCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("Attempted to register invalid Material command"));
-        return;
-    }
-
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
 
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("Registered Material command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("Registered Material command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to register Material command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Error, TEXT("Failed to register Material command: %s"), *CommandName);
     }
 }
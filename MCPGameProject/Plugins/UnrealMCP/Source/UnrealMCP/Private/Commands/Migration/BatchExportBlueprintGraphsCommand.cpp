@@ -0,0 +1,239 @@
+#include "Commands/Migration/BatchExportBlueprintGraphsCommand.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "MCPAsyncAssetLoader.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMigrationBatchExport, Log, All);
+
+namespace
+{
+    /** Outcome of one asset; written by the asset's file write, read after every write finished */
+    struct FAssetExportResult
+    {
+        FString BlueprintPath;
+        FString FilePath;
+        FString Error;
+        int32 GraphCount = 0;
+        int32 NodeCount = 0;
+    };
+}
+
+FString FBatchExportBlueprintGraphsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FString FolderPath;
+    if (!JsonObject->TryGetStringField(TEXT("folder_path"), FolderPath) || FolderPath.IsEmpty())
+    {
+        return CreateErrorResponse(TEXT("Missing 'folder_path' parameter"));
+    }
+    FolderPath.RemoveFromEnd(TEXT("/"));
+
+    bool bRecursive = true;
+    JsonObject->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+    bool bIncludeComponents = true;
+    JsonObject->TryGetBoolField(TEXT("include_components"), bIncludeComponents);
+
+    bool bCompress = false;
+    JsonObject->TryGetBoolField(TEXT("compress"), bCompress);
+
+    // Every Blueprint kind (widget, animation, ...) in the folder
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    Filter.PackagePaths.Add(FName(*FolderPath));
+    Filter.bRecursivePaths = bRecursive;
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FString RunDirectory = FString::Printf(TEXT("bulk_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    // Sized once, so the writes can fill in their own slots
+    TArray<FAssetExportResult> Results;
+    Results.SetNum(Assets.Num());
+    TArray<TFuture<void>> PendingWrites;
+
+    TArray<FSoftObjectPath> AssetPaths;
+    AssetPaths.Reserve(Assets.Num());
+    for (const FAssetData& Asset : Assets)
+    {
+        AssetPaths.Add(Asset.GetSoftObjectPath());
+    }
+
+    // Each Blueprint is snapshotted as soon as it has loaded, while the loader keeps working on the others
+    const FMCPAsyncAssetLoader::FStats LoadStats = FMCPAsyncAssetLoader::LoadEach(AssetPaths, [&](int32 Index, UObject* Asset)
+    {
+        FAssetExportResult& Result = Results[Index];
+        Result.BlueprintPath = Assets[Index].GetObjectPathString();
+
+        UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+        if (!Blueprint)
+        {
+            Result.Error = TEXT("Failed to load Blueprint");
+            return true;
+        }
+
+        FBlueprintGraphExportWriter::FBlueprintSnapshot Snapshot;
+        FBlueprintGraphExportWriter::CaptureBlueprint(Blueprint, bIncludeComponents, Snapshot);
+
+        TArray<UEdGraph*> AllGraphs;
+        Blueprint->GetAllGraphs(AllGraphs);
+        for (UEdGraph* Graph : AllGraphs)
+        {
+            if (Graph)
+            {
+                FBlueprintGraphExportWriter::FGraphSnapshot& GraphSnapshot = Snapshot.Graphs.AddDefaulted_GetRef();
+                FBlueprintGraphExportWriter::CaptureGraph(Graph, GraphSnapshot);
+                Result.NodeCount += GraphSnapshot.Nodes.Num();
+            }
+        }
+        Result.GraphCount = Snapshot.Graphs.Num();
+
+        // Only so many snapshots are kept waiting for their write
+        if (PendingWrites.Num() >= MaxPendingWrites)
+        {
+            PendingWrites[0].Wait();
+            PendingWrites.RemoveAt(0);
+        }
+
+        // Mirror the package path, so assets with the same name in different folders do not collide
+        const FString FileName = FPaths::Combine(RunDirectory, Assets[Index].PackageName.ToString().RightChop(1) + TEXT(".json"));
+        PendingWrites.Add(Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), FileName, bCompress, &Result]()
+        {
+            FBlueprintGraphExportWriter ExportWriter;
+            if (ExportWriter.Open(FileName, bCompress))
+            {
+                FBlueprintGraphExportWriter::WriteBlueprint(*ExportWriter.GetJsonWriter(), Snapshot);
+                Result.FilePath = ExportWriter.Close();
+            }
+            if (Result.FilePath.IsEmpty())
+            {
+                Result.Error = TEXT("Failed to write export file");
+            }
+        }));
+        return true;
+    });
+
+    for (TFuture<void>& Write : PendingWrites)
+    {
+        Write.Wait();
+    }
+
+    const bool bCancelled = LoadStats.bStopped;
+    if (bCancelled)
+    {
+        UE_LOG(LogMigrationBatchExport, Warning, TEXT("BatchExportBlueprintGraphs: Cancelled after %d of %d asset(s)"),
+            LoadStats.AlreadyLoaded + LoadStats.Loaded + LoadStats.Failed, Assets.Num());
+    }
+
+    // Manifest of every asset found, in package order
+    int32 ExportedCount = 0;
+    int32 FailedCount = 0;
+    TArray<TSharedPtr<FJsonValue>> AssetsArray;
+    for (const FAssetExportResult& Result : Results)
+    {
+        if (Result.BlueprintPath.IsEmpty())
+        {
+            // Not reached before the cancellation
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> AssetJson = MakeShared<FJsonObject>();
+        AssetJson->SetStringField(TEXT("blueprint_path"), Result.BlueprintPath);
+        if (Result.Error.IsEmpty())
+        {
+            AssetJson->SetStringField(TEXT("file_path"), Result.FilePath);
+            AssetJson->SetNumberField(TEXT("graph_count"), Result.GraphCount);
+            AssetJson->SetNumberField(TEXT("node_count"), Result.NodeCount);
+            ExportedCount++;
+        }
+        else
+        {
+            AssetJson->SetStringField(TEXT("error"), Result.Error);
+            FailedCount++;
+        }
+        AssetsArray.Add(MakeShared<FJsonValueObject>(AssetJson));
+    }
+
+    TSharedRef<FJsonObject> ManifestJson = MakeShared<FJsonObject>();
+    ManifestJson->SetStringField(TEXT("folder_path"), FolderPath);
+    ManifestJson->SetBoolField(TEXT("recursive"), bRecursive);
+    ManifestJson->SetStringField(TEXT("export_time"), FDateTime::Now().ToString());
+    ManifestJson->SetNumberField(TEXT("asset_count"), Assets.Num());
+    ManifestJson->SetNumberField(TEXT("exported_count"), ExportedCount);
+    ManifestJson->SetNumberField(TEXT("failed_count"), FailedCount);
+    ManifestJson->SetBoolField(TEXT("cancelled"), bCancelled);
+    ManifestJson->SetArrayField(TEXT("assets"), AssetsArray);
+
+    const FString ManifestPath = FBlueprintGraphExportWriter::WriteJsonFile(FPaths::Combine(RunDirectory, TEXT("manifest.json")), ManifestJson);
+    if (ManifestPath.IsEmpty())
+    {
+        return CreateErrorResponse(TEXT("Failed to write export manifest"));
+    }
+
+    UE_LOG(LogMigrationBatchExport, Log, TEXT("BatchExportBlueprintGraphs: Exported %d of %d Blueprint(s) from %s in %.1f s (%d failed)"),
+        ExportedCount, Assets.Num(), *FolderPath, FPlatformTime::Seconds() - StartTime, FailedCount);
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("output_directory"), FPaths::GetPath(ManifestPath));
+    ResponseObj->SetStringField(TEXT("manifest_path"), ManifestPath);
+    ResponseObj->SetNumberField(TEXT("asset_count"), Assets.Num());
+    ResponseObj->SetNumberField(TEXT("exported_count"), ExportedCount);
+    ResponseObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResponseObj->SetBoolField(TEXT("cancelled"), bCancelled);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool FBatchExportBlueprintGraphsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString FolderPath;
+    return JsonObject->TryGetStringField(TEXT("folder_path"), FolderPath) && !FolderPath.IsEmpty();
+}
+
+FString FBatchExportBlueprintGraphsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -0,0 +1,623 @@
+#include "Commands/Migration/BlueprintGraphDiff.h"
+#include "DiffUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/PackagePath.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+    using FPinSnapshot = FBlueprintGraphExportWriter::FPinSnapshot;
+    using FNodeSnapshot = FBlueprintGraphExportWriter::FNodeSnapshot;
+    using FGraphSnapshot = FBlueprintGraphExportWriter::FGraphSnapshot;
+
+    /** node_type and the fields the export writes for some node types */
+    const TCHAR* const TypeFieldNames[] =
+    {
+        TEXT("node_type"), TEXT("function_name"), TEXT("function_class"), TEXT("function_class_path"),
+        TEXT("event_name"), TEXT("event_class"), TEXT("variable_name"), TEXT("action_name"), TEXT("macro_name")
+    };
+
+    /** Hash input; every string is followed by its length, so adjacent fields cannot run together */
+    class FDigestBuilder
+    {
+    public:
+        void Add(const FString& Value)
+        {
+            Builder.Update(*Value, Value.Len() * sizeof(TCHAR));
+            Add(Value.Len());
+        }
+
+        void Add(int32 Value)
+        {
+            Builder.Update(&Value, sizeof(Value));
+        }
+
+        void Add(bool bValue)
+        {
+            const uint8 Byte = bValue ? 1 : 0;
+            Builder.Update(&Byte, sizeof(Byte));
+        }
+
+        uint64 Finalize() const
+        {
+            return Builder.Finalize().Hash;
+        }
+
+    private:
+        FXxHash64Builder Builder;
+    };
+
+    /** A node reduced to the hashes of the parts a diff reports on */
+    struct FNodeDigest
+    {
+        const FNodeSnapshot* Node = nullptr;
+        uint64 Header = 0;      // Class, title and node type fields
+        uint64 Position = 0;
+        uint64 Comment = 0;
+        uint64 Pins = 0;        // Names, directions and types
+        uint64 Defaults = 0;
+    };
+
+    struct FLink
+    {
+        FString FromNode;
+        FString FromPin;
+        FString ToNode;
+        FString ToPin;
+    };
+
+    /** One side of a graph: nodes by GUID and links by "from|pin|to|pin" */
+    struct FGraphIndex
+    {
+        TMap<FString, FNodeDigest> Nodes;
+        TMap<FString, FLink> Links;
+    };
+
+    /** Pins in the order the export writes them: inputs, then outputs, each in pin order */
+    template <typename VisitorType>
+    void ForEachPinInExportOrder(const FNodeSnapshot& Node, VisitorType&& Visit)
+    {
+        for (const bool bInputs : { true, false })
+        {
+            for (const FPinSnapshot& Pin : Node.Pins)
+            {
+                if (Pin.bIsInput == bInputs)
+                {
+                    Visit(Pin);
+                }
+            }
+        }
+    }
+
+    FNodeDigest DigestNode(const FNodeSnapshot& Node)
+    {
+        FNodeDigest Digest;
+        Digest.Node = &Node;
+
+        FDigestBuilder Header;
+        Header.Add(Node.Class);
+        Header.Add(Node.Title);
+        // Type fields are written in a per-type order; sorting makes the hash independent of it
+        TArray<TPair<FString, FString>> TypeFields = Node.TypeFields;
+        TypeFields.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B) { return A.Key < B.Key; });
+        for (const TPair<FString, FString>& Field : TypeFields)
+        {
+            Header.Add(Field.Key);
+            Header.Add(Field.Value);
+        }
+        Header.Add(Node.bIsPure.IsSet());
+        Header.Add(Node.bIsPure.Get(false));
+        Digest.Header = Header.Finalize();
+
+        FDigestBuilder Position;
+        Position.Add(Node.PosX);
+        Position.Add(Node.PosY);
+        Digest.Position = Position.Finalize();
+
+        FDigestBuilder Comment;
+        Comment.Add(Node.Comment);
+        Comment.Add(Node.bCommentBubbleVisible);
+        Digest.Comment = Comment.Finalize();
+
+        FDigestBuilder Pins;
+        FDigestBuilder Defaults;
+        ForEachPinInExportOrder(Node, [&Pins, &Defaults](const FPinSnapshot& Pin)
+        {
+            Pins.Add(Pin.Name);
+            Pins.Add(Pin.bIsInput);
+            Pins.Add(Pin.Category);
+            Pins.Add(Pin.SubCategory);
+            Pins.Add(Pin.bIsArray);
+            Pins.Add(Pin.bIsReference);
+            Pins.Add(Pin.bIsConst);
+
+            Defaults.Add(Pin.Name);
+            Defaults.Add(Pin.DefaultValue);
+            Defaults.Add(Pin.DefaultObject);
+            Defaults.Add(Pin.DefaultText);
+        });
+        Digest.Pins = Pins.Finalize();
+        Digest.Defaults = Defaults.Finalize();
+        return Digest;
+    }
+
+    void IndexGraph(const FGraphSnapshot& Graph, FGraphIndex& OutIndex)
+    {
+        OutIndex.Nodes.Reserve(Graph.Nodes.Num());
+        for (const FNodeSnapshot& Node : Graph.Nodes)
+        {
+            // Pasted nodes can share a GUID; keep each of them apart
+            FString Key = Node.Guid;
+            for (int32 Duplicate = 2; OutIndex.Nodes.Contains(Key); ++Duplicate)
+            {
+                Key = FString::Printf(TEXT("%s#%d"), *Node.Guid, Duplicate);
+            }
+            OutIndex.Nodes.Add(Key, DigestNode(Node));
+
+            // Every link is listed on both of its pins; take it from the output side only
+            for (const FPinSnapshot& Pin : Node.Pins)
+            {
+                if (Pin.bIsInput)
+                {
+                    continue;
+                }
+                for (const TPair<FString, FString>& Connection : Pin.Connections)
+                {
+                    FLink Link{ Node.Guid, Pin.Name, Connection.Key, Connection.Value };
+                    OutIndex.Links.Add(FString::Printf(TEXT("%s|%s|%s|%s"), *Link.FromNode, *Link.FromPin, *Link.ToNode, *Link.ToPin), MoveTemp(Link));
+                }
+            }
+        }
+    }
+
+    TSharedPtr<FJsonValue> MakeNodeValue(const FNodeSnapshot& Node)
+    {
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("guid"), Node.Guid);
+        NodeObj->SetStringField(TEXT("class"), Node.Class);
+        NodeObj->SetStringField(TEXT("title"), Node.Title);
+        return MakeShared<FJsonValueObject>(NodeObj);
+    }
+
+    TSharedPtr<FJsonValue> MakeLinkValue(const FLink& Link)
+    {
+        TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
+        LinkObj->SetStringField(TEXT("from_node"), Link.FromNode);
+        LinkObj->SetStringField(TEXT("from_pin"), Link.FromPin);
+        LinkObj->SetStringField(TEXT("to_node"), Link.ToNode);
+        LinkObj->SetStringField(TEXT("to_pin"), Link.ToPin);
+        return MakeShared<FJsonValueObject>(LinkObj);
+    }
+
+    /** Decompress a .json.gz export: one gzip member per chunk the writer flushed */
+    bool GunzipMembers(const TArray<uint8>& Compressed, TArray<uint8>& OutBytes)
+    {
+        z_stream Stream = {};
+        if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
+        {
+            return false;
+        }
+
+        Stream.next_in = const_cast<Bytef*>(Compressed.GetData());
+        Stream.avail_in = static_cast<uInt>(Compressed.Num());
+
+        TArray<uint8> Buffer;
+        Buffer.SetNumUninitialized(FBlueprintGraphExportWriter::ChunkBytes);
+        bool bSucceeded = false;
+        while (true)
+        {
+            Stream.next_out = Buffer.GetData();
+            Stream.avail_out = static_cast<uInt>(Buffer.Num());
+            const int Result = inflate(&Stream, Z_NO_FLUSH);
+            OutBytes.Append(Buffer.GetData(), Buffer.Num() - static_cast<int32>(Stream.avail_out));
+
+            if (Result == Z_STREAM_END)
+            {
+                if (Stream.avail_in == 0)
+                {
+                    bSucceeded = true;
+                    break;
+                }
+                // The next member starts right after this one
+                inflateReset(&Stream);
+            }
+            else if (Result != Z_OK)
+            {
+                break;
+            }
+        }
+
+        inflateEnd(&Stream);
+        return bSucceeded;
+    }
+
+    bool ReadPin(const FJsonObject& PinJson, FPinSnapshot& OutPin)
+    {
+        if (!PinJson.TryGetStringField(TEXT("name"), OutPin.Name))
+        {
+            return false;
+        }
+        FString Direction;
+        PinJson.TryGetStringField(TEXT("direction"), Direction);
+        OutPin.bIsInput = Direction != TEXT("Output");
+        PinJson.TryGetStringField(TEXT("category"), OutPin.Category);
+        PinJson.TryGetStringField(TEXT("subcategory"), OutPin.SubCategory);
+        PinJson.TryGetBoolField(TEXT("is_array"), OutPin.bIsArray);
+        PinJson.TryGetBoolField(TEXT("is_reference"), OutPin.bIsReference);
+        PinJson.TryGetBoolField(TEXT("is_const"), OutPin.bIsConst);
+        PinJson.TryGetStringField(TEXT("default_value"), OutPin.DefaultValue);
+        PinJson.TryGetStringField(TEXT("default_object"), OutPin.DefaultObject);
+        PinJson.TryGetStringField(TEXT("default_text"), OutPin.DefaultText);
+
+        const TArray<TSharedPtr<FJsonValue>>* Connections = nullptr;
+        if (PinJson.TryGetArrayField(TEXT("connections"), Connections))
+        {
+            for (const TSharedPtr<FJsonValue>& ConnectionValue : *Connections)
+            {
+                const TSharedPtr<FJsonObject>* Connection = nullptr;
+                FString NodeGuid;
+                FString PinName;
+                if (ConnectionValue->TryGetObject(Connection) &&
+                    (*Connection)->TryGetStringField(TEXT("node_guid"), NodeGuid) &&
+                    (*Connection)->TryGetStringField(TEXT("pin_name"), PinName))
+                {
+                    OutPin.Connections.Emplace(MoveTemp(NodeGuid), MoveTemp(PinName));
+                }
+            }
+        }
+        return true;
+    }
+
+    bool ReadNode(const FJsonObject& NodeJson, FNodeSnapshot& OutNode)
+    {
+        if (!NodeJson.TryGetStringField(TEXT("guid"), OutNode.Guid))
+        {
+            return false;
+        }
+        NodeJson.TryGetStringField(TEXT("class"), OutNode.Class);
+        NodeJson.TryGetStringField(TEXT("title"), OutNode.Title);
+        NodeJson.TryGetNumberField(TEXT("pos_x"), OutNode.PosX);
+        NodeJson.TryGetNumberField(TEXT("pos_y"), OutNode.PosY);
+        NodeJson.TryGetStringField(TEXT("comment"), OutNode.Comment);
+        NodeJson.TryGetBoolField(TEXT("comment_bubble_visible"), OutNode.bCommentBubbleVisible);
+
+        for (const TCHAR* FieldName : TypeFieldNames)
+        {
+            FString Value;
+            if (NodeJson.TryGetStringField(FieldName, Value))
+            {
+                OutNode.TypeFields.Emplace(FieldName, MoveTemp(Value));
+            }
+        }
+        bool bIsPure = false;
+        if (NodeJson.TryGetBoolField(TEXT("is_pure"), bIsPure))
+        {
+            OutNode.bIsPure = bIsPure;
+        }
+
+        for (const TCHAR* PinsField : { TEXT("input_pins"), TEXT("output_pins") })
+        {
+            const TArray<TSharedPtr<FJsonValue>>* Pins = nullptr;
+            if (!NodeJson.TryGetArrayField(PinsField, Pins))
+            {
+                continue;
+            }
+            for (const TSharedPtr<FJsonValue>& PinValue : *Pins)
+            {
+                const TSharedPtr<FJsonObject>* PinJson = nullptr;
+                FPinSnapshot Pin;
+                if (PinValue->TryGetObject(PinJson) && ReadPin(**PinJson, Pin))
+                {
+                    OutNode.Pins.Add(MoveTemp(Pin));
+                }
+            }
+        }
+        return true;
+    }
+}
+
+bool FBlueprintGraphDiff::ReadExport(const FString& FilePath, FBlueprintSnapshot& OutBlueprint, FString& OutError)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+    {
+        OutError = FString::Printf(TEXT("Cannot read export file: %s"), *FilePath);
+        return false;
+    }
+
+    if (FilePath.EndsWith(TEXT(".gz")))
+    {
+        TArray<uint8> Decompressed;
+        if (!GunzipMembers(Bytes, Decompressed))
+        {
+            OutError = FString::Printf(TEXT("Export file is not valid gzip: %s"), *FilePath);
+            return false;
+        }
+        Bytes = MoveTemp(Decompressed);
+    }
+
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+    const FString Text(Converted.Length(), Converted.Get());
+    Bytes.Empty();
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+    const TArray<TSharedPtr<FJsonValue>>* Graphs = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("graphs"), Graphs))
+    {
+        OutError = FString::Printf(TEXT("Not a Blueprint graph export: %s"), *FilePath);
+        return false;
+    }
+
+    Root->TryGetStringField(TEXT("blueprint_name"), OutBlueprint.Name);
+    Root->TryGetStringField(TEXT("blueprint_path"), OutBlueprint.Path);
+    Root->TryGetStringField(TEXT("parent_class"), OutBlueprint.ParentClass);
+    Root->TryGetStringField(TEXT("parent_class_path"), OutBlueprint.ParentClassPath);
+
+    OutBlueprint.Graphs.Reset(Graphs->Num());
+    for (const TSharedPtr<FJsonValue>& GraphValue : *Graphs)
+    {
+        const TSharedPtr<FJsonObject>* GraphJson = nullptr;
+        if (!GraphValue->TryGetObject(GraphJson))
+        {
+            continue;
+        }
+
+        FGraphSnapshot& Graph = OutBlueprint.Graphs.AddDefaulted_GetRef();
+        (*GraphJson)->TryGetStringField(TEXT("name"), Graph.Name);
+        (*GraphJson)->TryGetStringField(TEXT("class"), Graph.Class);
+
+        const TArray<TSharedPtr<FJsonValue>>* Nodes = nullptr;
+        if ((*GraphJson)->TryGetArrayField(TEXT("nodes"), Nodes))
+        {
+            Graph.Nodes.Reserve(Nodes->Num());
+            for (const TSharedPtr<FJsonValue>& NodeValue : *Nodes)
+            {
+                const TSharedPtr<FJsonObject>* NodeJson = nullptr;
+                FNodeSnapshot Node;
+                if (NodeValue->TryGetObject(NodeJson) && ReadNode(**NodeJson, Node))
+                {
+                    Graph.Nodes.Add(MoveTemp(Node));
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool FBlueprintGraphDiff::CaptureSavedBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutBlueprint, FString& OutError)
+{
+    check(IsInGameThread());
+
+    const FString PackageName = Blueprint->GetOutermost()->GetName();
+    FPackagePath PackagePath;
+    if (!FPackagePath::TryFromPackageName(PackageName, PackagePath) || !FPackageName::DoesPackageExist(PackagePath, &PackagePath))
+    {
+        OutError = FString::Printf(TEXT("'%s' has not been saved yet"), *PackageName);
+        return false;
+    }
+
+    // Load a copy under a temporary name, as the editor's diff tools do, so the loaded package is left alone
+    const FString PackageFile = PackagePath.GetLocalFullPath();
+    const FString TempFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Diff"),
+        FString::Printf(TEXT("%s_%s%s"), *FPackageName::GetShortName(PackageName), *FGuid::NewGuid().ToString(), *FPaths::GetExtension(PackageFile, true)));
+    if (IFileManager::Get().Copy(*TempFile, *PackageFile) != COPY_OK)
+    {
+        OutError = FString::Printf(TEXT("Cannot copy %s"), *PackageFile);
+        return false;
+    }
+
+    bool bCaptured = false;
+    if (UPackage* TempPackage = DiffUtils::LoadPackageForDiff(FPackagePath::FromLocalPath(TempFile), PackagePath))
+    {
+        if (UBlueprint* SavedBlueprint = FindObject<UBlueprint>(TempPackage, *Blueprint->GetName()))
+        {
+            CaptureBlueprint(SavedBlueprint, OutBlueprint);
+            OutBlueprint.Path = Blueprint->GetPathName();
+            bCaptured = true;
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Saved package %s holds no Blueprint named %s"), *PackageName, *Blueprint->GetName());
+        }
+        // Release the file so the copy can go
+        ResetLoaders(TempPackage);
+    }
+    else
+    {
+        OutError = FString::Printf(TEXT("Cannot load the saved package %s"), *PackageName);
+    }
+
+    IFileManager::Get().Delete(*TempFile, false, true, true);
+    return bCaptured;
+}
+
+void FBlueprintGraphDiff::CaptureBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutBlueprint)
+{
+    FBlueprintGraphExportWriter::CaptureBlueprint(Blueprint, false, OutBlueprint);
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    OutBlueprint.Graphs.Reset(AllGraphs.Num());
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (Graph)
+        {
+            FBlueprintGraphExportWriter::CaptureGraph(Graph, OutBlueprint.Graphs.AddDefaulted_GetRef());
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FBlueprintGraphDiff::Diff(const FBlueprintSnapshot& Baseline, const FBlueprintSnapshot& Current, const FOptions& Options)
+{
+    auto Matches = [&Options](const FGraphSnapshot& Graph)
+    {
+        return Options.GraphName.IsEmpty() || Graph.Name.Contains(Options.GraphName);
+    };
+
+    TMap<FString, const FGraphSnapshot*> BaselineGraphs;
+    for (const FGraphSnapshot& Graph : Baseline.Graphs)
+    {
+        if (Matches(Graph))
+        {
+            BaselineGraphs.Add(Graph.Name, &Graph);
+        }
+    }
+
+    // Graphs in the current order, then the removed ones in baseline order
+    TArray<TPair<const FGraphSnapshot*, const FGraphSnapshot*>> GraphPairs;
+    TSet<FString> PairedNames;
+    for (const FGraphSnapshot& Graph : Current.Graphs)
+    {
+        if (Matches(Graph))
+        {
+            const FGraphSnapshot* const* BaselineGraph = BaselineGraphs.Find(Graph.Name);
+            GraphPairs.Emplace(BaselineGraph ? *BaselineGraph : nullptr, &Graph);
+            PairedNames.Add(Graph.Name);
+        }
+    }
+    for (const FGraphSnapshot& Graph : Baseline.Graphs)
+    {
+        if (Matches(Graph) && !PairedNames.Contains(Graph.Name))
+        {
+            GraphPairs.Emplace(&Graph, nullptr);
+        }
+    }
+
+    int32 AddedNodeCount = 0;
+    int32 RemovedNodeCount = 0;
+    int32 ModifiedNodeCount = 0;
+    int32 AddedLinkCount = 0;
+    int32 RemovedLinkCount = 0;
+    int32 UnchangedGraphCount = 0;
+    TArray<TSharedPtr<FJsonValue>> GraphsList;
+
+    for (const TPair<const FGraphSnapshot*, const FGraphSnapshot*>& Pair : GraphPairs)
+    {
+        FGraphIndex Before;
+        FGraphIndex After;
+        if (Pair.Key)
+        {
+            IndexGraph(*Pair.Key, Before);
+        }
+        if (Pair.Value)
+        {
+            IndexGraph(*Pair.Value, After);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> AddedNodes;
+        TArray<TSharedPtr<FJsonValue>> RemovedNodes;
+        TArray<TSharedPtr<FJsonValue>> ModifiedNodes;
+        for (const TPair<FString, FNodeDigest>& Node : After.Nodes)
+        {
+            const FNodeDigest* Previous = Before.Nodes.Find(Node.Key);
+            if (!Previous)
+            {
+                AddedNodes.Add(MakeNodeValue(*Node.Value.Node));
+                continue;
+            }
+
+            TArray<TSharedPtr<FJsonValue>> Changes;
+            auto NoteChange = [&Changes](bool bChanged, const TCHAR* Part)
+            {
+                if (bChanged)
+                {
+                    Changes.Add(MakeShared<FJsonValueString>(Part));
+                }
+            };
+            NoteChange(Previous->Header != Node.Value.Header, TEXT("header"));
+            NoteChange(!Options.bIgnorePositions && Previous->Position != Node.Value.Position, TEXT("position"));
+            NoteChange(Previous->Comment != Node.Value.Comment, TEXT("comment"));
+            NoteChange(Previous->Pins != Node.Value.Pins, TEXT("pins"));
+            NoteChange(Previous->Defaults != Node.Value.Defaults, TEXT("defaults"));
+            if (Changes.Num() > 0)
+            {
+                TSharedPtr<FJsonValue> NodeValue = MakeNodeValue(*Node.Value.Node);
+                NodeValue->AsObject()->SetArrayField(TEXT("changes"), Changes);
+                if (Previous->Node->Title != Node.Value.Node->Title)
+                {
+                    NodeValue->AsObject()->SetStringField(TEXT("previous_title"), Previous->Node->Title);
+                }
+                ModifiedNodes.Add(NodeValue);
+            }
+        }
+        for (const TPair<FString, FNodeDigest>& Node : Before.Nodes)
+        {
+            if (!After.Nodes.Contains(Node.Key))
+            {
+                RemovedNodes.Add(MakeNodeValue(*Node.Value.Node));
+            }
+        }
+
+        TArray<TSharedPtr<FJsonValue>> AddedLinks;
+        TArray<TSharedPtr<FJsonValue>> RemovedLinks;
+        for (const TPair<FString, FLink>& Link : After.Links)
+        {
+            if (!Before.Links.Contains(Link.Key))
+            {
+                AddedLinks.Add(MakeLinkValue(Link.Value));
+            }
+        }
+        for (const TPair<FString, FLink>& Link : Before.Links)
+        {
+            if (!After.Links.Contains(Link.Key))
+            {
+                RemovedLinks.Add(MakeLinkValue(Link.Value));
+            }
+        }
+
+        const bool bChanged = !Pair.Key || !Pair.Value || AddedNodes.Num() > 0 || RemovedNodes.Num() > 0 ||
+            ModifiedNodes.Num() > 0 || AddedLinks.Num() > 0 || RemovedLinks.Num() > 0;
+        if (!bChanged)
+        {
+            ++UnchangedGraphCount;
+            continue;
+        }
+
+        AddedNodeCount += AddedNodes.Num();
+        RemovedNodeCount += RemovedNodes.Num();
+        ModifiedNodeCount += ModifiedNodes.Num();
+        AddedLinkCount += AddedLinks.Num();
+        RemovedLinkCount += RemovedLinks.Num();
+
+        TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+        GraphObj->SetStringField(TEXT("name"), Pair.Value ? Pair.Value->Name : Pair.Key->Name);
+        GraphObj->SetStringField(TEXT("status"), !Pair.Key ? TEXT("added") : !Pair.Value ? TEXT("removed") : TEXT("modified"));
+        GraphObj->SetArrayField(TEXT("added_nodes"), AddedNodes);
+        GraphObj->SetArrayField(TEXT("removed_nodes"), RemovedNodes);
+        GraphObj->SetArrayField(TEXT("modified_nodes"), ModifiedNodes);
+        GraphObj->SetArrayField(TEXT("added_links"), AddedLinks);
+        GraphObj->SetArrayField(TEXT("removed_links"), RemovedLinks);
+        GraphsList.Add(MakeShared<FJsonValueObject>(GraphObj));
+    }
+
+    TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+    Summary->SetNumberField(TEXT("changed_graphs"), GraphsList.Num());
+    Summary->SetNumberField(TEXT("unchanged_graphs"), UnchangedGraphCount);
+    Summary->SetNumberField(TEXT("added_nodes"), AddedNodeCount);
+    Summary->SetNumberField(TEXT("removed_nodes"), RemovedNodeCount);
+    Summary->SetNumberField(TEXT("modified_nodes"), ModifiedNodeCount);
+    Summary->SetNumberField(TEXT("added_links"), AddedLinkCount);
+    Summary->SetNumberField(TEXT("removed_links"), RemovedLinkCount);
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetBoolField(TEXT("identical"), GraphsList.Num() == 0);
+    Result->SetArrayField(TEXT("graphs"), GraphsList);
+    Result->SetObjectField(TEXT("summary"), Summary);
+    return Result;
+}
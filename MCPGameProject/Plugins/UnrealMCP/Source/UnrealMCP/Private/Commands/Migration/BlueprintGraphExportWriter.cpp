@@ -0,0 +1,536 @@
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_Event.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_Self.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "K2Node_MacroInstance.h"
+#include "Misc/Compression.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "MCPLogging.h"
+
+/** Buffers what the JSON writer emits and writes it to the file a chunk at a time */
+class FBlueprintGraphExportWriter::FChunkedFileArchive : public FArchive
+{
+public:
+    FChunkedFileArchive(TUniquePtr<FArchive> InFile, bool bInCompress)
+        : File(MoveTemp(InFile))
+        , bCompress(bInCompress)
+    {
+        SetIsSaving(true);
+        Pending.Reserve(ChunkBytes);
+    }
+
+    virtual void Serialize(void* Data, int64 Num) override
+    {
+        const uint8* Bytes = static_cast<const uint8*>(Data);
+        while (Num > 0)
+        {
+            const int32 Count = static_cast<int32>(FMath::Min<int64>(Num, ChunkBytes - Pending.Num()));
+            Pending.Append(Bytes, Count);
+            Bytes += Count;
+            Num -= Count;
+            if (Pending.Num() == ChunkBytes)
+            {
+                FlushChunk();
+            }
+        }
+    }
+
+    virtual FString GetArchiveName() const override { return TEXT("FBlueprintGraphExportWriter"); }
+
+    /** Write the last chunk and close the file; @return true if every byte reached the file */
+    bool Finish()
+    {
+        FlushChunk();
+        const bool bClosed = File->Close();
+        const bool bWritten = bClosed && !IsError() && !File->IsError();
+        File.Reset();
+        return bWritten;
+    }
+
+private:
+    void FlushChunk()
+    {
+        if (Pending.Num() > 0 && !IsError())
+        {
+            if (bCompress)
+            {
+                int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Pending.Num());
+                Compressed.SetNumUninitialized(CompressedSize, EAllowShrinking::No);
+                if (FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Pending.GetData(), Pending.Num()))
+                {
+                    File->Serialize(Compressed.GetData(), CompressedSize);
+                }
+                else
+                {
+                    SetError();
+                }
+            }
+            else
+            {
+                File->Serialize(Pending.GetData(), Pending.Num());
+            }
+
+            if (File->IsError())
+            {
+                SetError();
+            }
+        }
+        Pending.Reset();
+    }
+
+    TUniquePtr<FArchive> File;
+    bool bCompress;
+    TArray<uint8> Pending;
+    TArray<uint8> Compressed;
+};
+
+FBlueprintGraphExportWriter::FBlueprintGraphExportWriter() = default;
+
+FBlueprintGraphExportWriter::~FBlueprintGraphExportWriter()
+{
+    if (Archive)
+    {
+        Close();
+    }
+}
+
+bool FBlueprintGraphExportWriter::Open(const FString& FileName, bool bCompress)
+{
+    check(!Archive);
+
+    FilePath = FPaths::Combine(GetExportDirectory(), bCompress ? FileName + TEXT(".gz") : FileName);
+    TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!File)
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("FBlueprintGraphExportWriter: Failed to create %s"), *FilePath);
+        FilePath.Reset();
+        return false;
+    }
+
+    Archive = MakeUnique<FChunkedFileArchive>(MoveTemp(File), bCompress);
+    JsonWriter = TJsonWriterFactory<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>::Create(Archive.Get());
+    return true;
+}
+
+FString FBlueprintGraphExportWriter::Close()
+{
+    if (!Archive)
+    {
+        return FString();
+    }
+
+    JsonWriter->Close();
+    JsonWriter.Reset();
+    const bool bWritten = Archive->Finish();
+    const int64 FileSize = bWritten ? IFileManager::Get().FileSize(*FilePath) : 0;
+    Archive.Reset();
+
+    if (!bWritten)
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("FBlueprintGraphExportWriter: Failed to write %s"), *FilePath);
+        IFileManager::Get().Delete(*FilePath);
+        return FString();
+    }
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("FBlueprintGraphExportWriter: Wrote %s (%lld bytes)"), *FilePath, FileSize);
+    return FilePath;
+}
+
+FString FBlueprintGraphExportWriter::WriteJsonFile(const FString& FileName, const TSharedRef<FJsonObject>& Content, bool bCompress)
+{
+    FBlueprintGraphExportWriter ExportWriter;
+    if (!ExportWriter.Open(FileName, bCompress))
+    {
+        return FString();
+    }
+
+    FJsonSerializer::Serialize(Content, ExportWriter.GetJsonWriter(), false);
+    return ExportWriter.Close();
+}
+
+FString FBlueprintGraphExportWriter::GetExportDirectory()
+{
+    FString ExportDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Exports"));
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.DirectoryExists(*ExportDir))
+    {
+        PlatformFile.CreateDirectoryTree(*ExportDir);
+    }
+
+    return ExportDir;
+}
+
+void FBlueprintGraphExportWriter::CapturePin(UEdGraphPin* Pin, FPinSnapshot& OutPin)
+{
+    OutPin.Name = Pin->PinName.ToString();
+    OutPin.bIsInput = Pin->Direction == EGPD_Input;
+    OutPin.Category = Pin->PinType.PinCategory.ToString();
+    OutPin.SubCategory = Pin->PinType.PinSubCategoryObject.IsValid() ? Pin->PinType.PinSubCategoryObject->GetName() : FString();
+    OutPin.bIsArray = Pin->PinType.IsArray();
+    OutPin.bIsReference = Pin->PinType.bIsReference;
+    OutPin.bIsConst = Pin->PinType.bIsConst;
+    OutPin.DefaultValue = Pin->DefaultValue;
+    OutPin.DefaultObject = Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString();
+    OutPin.DefaultText = Pin->DefaultTextValue.IsEmpty() ? FString() : Pin->DefaultTextValue.ToString();
+
+    OutPin.Connections.Reset(Pin->LinkedTo.Num());
+    for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+    {
+        if (LinkedPin && LinkedPin->GetOwningNode())
+        {
+            OutPin.Connections.Emplace(LinkedPin->GetOwningNode()->NodeGuid.ToString(), LinkedPin->PinName.ToString());
+        }
+    }
+}
+
+void FBlueprintGraphExportWriter::CaptureNode(UEdGraphNode* Node, FNodeSnapshot& OutNode)
+{
+    OutNode.Guid = Node->NodeGuid.ToString();
+    OutNode.Class = Node->GetClass()->GetName();
+    OutNode.Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+    OutNode.PosX = Node->NodePosX;
+    OutNode.PosY = Node->NodePosY;
+    OutNode.Comment = Node->NodeComment;
+    OutNode.bCommentBubbleVisible = Node->bCommentBubbleVisible;
+    OutNode.TypeFields.Reset();
+    OutNode.bIsPure.Reset();
+
+    auto AddField = [&OutNode](const TCHAR* Name, const FString& Value)
+    {
+        OutNode.TypeFields.Emplace(Name, Value);
+    };
+
+    // Handle specific node types
+    if (UK2Node_CallFunction* CallFuncNode = Cast<UK2Node_CallFunction>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("CallFunction"));
+
+        if (UFunction* Function = CallFuncNode->GetTargetFunction())
+        {
+            AddField(TEXT("function_name"), Function->GetName());
+            if (Function->GetOwnerClass())
+            {
+                AddField(TEXT("function_class"), Function->GetOwnerClass()->GetName());
+                AddField(TEXT("function_class_path"), Function->GetOwnerClass()->GetPathName());
+            }
+        }
+
+        OutNode.bIsPure = CallFuncNode->IsNodePure();
+    }
+    else if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("Event"));
+        AddField(TEXT("event_name"), EventNode->EventReference.GetMemberName().ToString());
+
+        if (EventNode->EventReference.GetMemberParentClass())
+        {
+            AddField(TEXT("event_class"), EventNode->EventReference.GetMemberParentClass()->GetName());
+        }
+    }
+    else if (UK2Node_VariableGet* VarGetNode = Cast<UK2Node_VariableGet>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("VariableGet"));
+        AddField(TEXT("variable_name"), VarGetNode->VariableReference.GetMemberName().ToString());
+    }
+    else if (UK2Node_VariableSet* VarSetNode = Cast<UK2Node_VariableSet>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("VariableSet"));
+        AddField(TEXT("variable_name"), VarSetNode->VariableReference.GetMemberName().ToString());
+    }
+    else if (UK2Node_InputAction* InputNode = Cast<UK2Node_InputAction>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("InputAction"));
+        AddField(TEXT("action_name"), InputNode->InputActionName.ToString());
+    }
+    else if (Cast<UK2Node_Self>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("Self"));
+    }
+    else if (Cast<UK2Node_FunctionEntry>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("FunctionEntry"));
+    }
+    else if (Cast<UK2Node_FunctionResult>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("FunctionResult"));
+    }
+    else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+    {
+        AddField(TEXT("node_type"), TEXT("MacroInstance"));
+        if (MacroNode->GetMacroGraph())
+        {
+            AddField(TEXT("macro_name"), MacroNode->GetMacroGraph()->GetName());
+        }
+    }
+    else
+    {
+        AddField(TEXT("node_type"), TEXT("Other"));
+    }
+
+    OutNode.Pins.Reset(Node->Pins.Num());
+    for (UEdGraphPin* Pin : Node->Pins)
+    {
+        if (Pin)
+        {
+            CapturePin(Pin, OutNode.Pins.AddDefaulted_GetRef());
+        }
+    }
+}
+
+void FBlueprintGraphExportWriter::CaptureGraph(UEdGraph* Graph, FGraphSnapshot& OutGraph)
+{
+    OutGraph.Name = Graph->GetName();
+    OutGraph.Class = Graph->GetClass()->GetName();
+    OutGraph.Nodes.Reset(Graph->Nodes.Num());
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            CaptureNode(Node, OutGraph.Nodes.AddDefaulted_GetRef());
+        }
+    }
+}
+
+void FBlueprintGraphExportWriter::CaptureBlueprint(UBlueprint* Blueprint, bool bIncludeComponents, FBlueprintSnapshot& OutBlueprint)
+{
+    OutBlueprint.Name = Blueprint->GetName();
+    OutBlueprint.Path = Blueprint->GetPathName();
+    OutBlueprint.ParentClass = Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : FString();
+    OutBlueprint.ParentClassPath = Blueprint->ParentClass ? Blueprint->ParentClass->GetPathName() : FString();
+
+    OutBlueprint.Components.Reset();
+    if (bIncludeComponents && Blueprint->SimpleConstructionScript)
+    {
+        TArray<FComponentSnapshot>& Components = OutBlueprint.Components.Emplace();
+        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+        {
+            if (Node && Node->ComponentTemplate)
+            {
+                FComponentSnapshot& Component = Components.AddDefaulted_GetRef();
+                Component.Name = Node->GetVariableName().ToString();
+                Component.Class = Node->ComponentTemplate->GetClass()->GetName();
+                if (Node->ParentComponentOrVariableName != NAME_None)
+                {
+                    Component.Parent = Node->ParentComponentOrVariableName.ToString();
+                }
+            }
+        }
+    }
+
+    OutBlueprint.Variables.Reset(Blueprint->NewVariables.Num());
+    for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+    {
+        FVariableSnapshot& Variable = OutBlueprint.Variables.AddDefaulted_GetRef();
+        Variable.Name = Var.VarName.ToString();
+        Variable.Type = Var.VarType.PinCategory.ToString();
+        Variable.SubType = Var.VarType.PinSubCategoryObject.IsValid() ? Var.VarType.PinSubCategoryObject->GetName() : FString();
+        Variable.bIsExposed = (Var.PropertyFlags & CPF_Edit) != 0;
+    }
+}
+
+void FBlueprintGraphExportWriter::WritePin(FJsonWriter& Writer, const FPinSnapshot& Pin)
+{
+    Writer.WriteObjectStart();
+
+    Writer.WriteValue(TEXT("name"), Pin.Name);
+    Writer.WriteValue(TEXT("direction"), Pin.bIsInput ? TEXT("Input") : TEXT("Output"));
+    Writer.WriteValue(TEXT("category"), Pin.Category);
+
+    if (!Pin.SubCategory.IsEmpty())
+    {
+        Writer.WriteValue(TEXT("subcategory"), Pin.SubCategory);
+    }
+
+    Writer.WriteValue(TEXT("is_array"), Pin.bIsArray);
+    Writer.WriteValue(TEXT("is_reference"), Pin.bIsReference);
+    Writer.WriteValue(TEXT("is_const"), Pin.bIsConst);
+
+    if (!Pin.DefaultValue.IsEmpty())
+    {
+        Writer.WriteValue(TEXT("default_value"), Pin.DefaultValue);
+    }
+
+    if (!Pin.DefaultObject.IsEmpty())
+    {
+        Writer.WriteValue(TEXT("default_object"), Pin.DefaultObject);
+    }
+
+    if (!Pin.DefaultText.IsEmpty())
+    {
+        Writer.WriteValue(TEXT("default_text"), Pin.DefaultText);
+    }
+
+    if (Pin.Connections.Num() > 0)
+    {
+        Writer.WriteArrayStart(TEXT("connections"));
+        for (const TPair<FString, FString>& Connection : Pin.Connections)
+        {
+            Writer.WriteObjectStart();
+            Writer.WriteValue(TEXT("node_guid"), Connection.Key);
+            Writer.WriteValue(TEXT("pin_name"), Connection.Value);
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+    }
+
+    Writer.WriteObjectEnd();
+}
+
+void FBlueprintGraphExportWriter::WriteNode(FJsonWriter& Writer, const FNodeSnapshot& Node)
+{
+    Writer.WriteObjectStart();
+
+    Writer.WriteValue(TEXT("guid"), Node.Guid);
+    Writer.WriteValue(TEXT("class"), Node.Class);
+    Writer.WriteValue(TEXT("title"), Node.Title);
+    Writer.WriteValue(TEXT("pos_x"), Node.PosX);
+    Writer.WriteValue(TEXT("pos_y"), Node.PosY);
+    Writer.WriteValue(TEXT("comment"), Node.Comment);
+    Writer.WriteValue(TEXT("comment_bubble_visible"), Node.bCommentBubbleVisible);
+
+    for (const TPair<FString, FString>& Field : Node.TypeFields)
+    {
+        Writer.WriteValue(Field.Key, Field.Value);
+    }
+    if (Node.bIsPure.IsSet())
+    {
+        Writer.WriteValue(TEXT("is_pure"), Node.bIsPure.GetValue());
+    }
+
+    // Inputs first, then outputs, each in pin order
+    for (const bool bInputs : { true, false })
+    {
+        Writer.WriteArrayStart(bInputs ? TEXT("input_pins") : TEXT("output_pins"));
+        for (const FPinSnapshot& Pin : Node.Pins)
+        {
+            if (Pin.bIsInput == bInputs)
+            {
+                WritePin(Writer, Pin);
+            }
+        }
+        Writer.WriteArrayEnd();
+    }
+
+    Writer.WriteObjectEnd();
+}
+
+void FBlueprintGraphExportWriter::WriteGraphFields(FJsonWriter& Writer, const FGraphSnapshot& Graph)
+{
+    Writer.WriteValue(TEXT("name"), Graph.Name);
+    Writer.WriteValue(TEXT("class"), Graph.Class);
+    Writer.WriteValue(TEXT("node_count"), Graph.Nodes.Num());
+
+    Writer.WriteArrayStart(TEXT("nodes"));
+    for (const FNodeSnapshot& Node : Graph.Nodes)
+    {
+        WriteNode(Writer, Node);
+    }
+    Writer.WriteArrayEnd();
+}
+
+void FBlueprintGraphExportWriter::WriteGraphFields(FJsonWriter& Writer, UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return;
+    }
+
+    Writer.WriteValue(TEXT("name"), Graph->GetName());
+    Writer.WriteValue(TEXT("class"), Graph->GetClass()->GetName());
+    Writer.WriteValue(TEXT("node_count"), Graph->Nodes.Num());
+
+    // One node's copy is reused for every node
+    FNodeSnapshot Snapshot;
+    Writer.WriteArrayStart(TEXT("nodes"));
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node)
+        {
+            CaptureNode(Node, Snapshot);
+            WriteNode(Writer, Snapshot);
+        }
+    }
+    Writer.WriteArrayEnd();
+}
+
+void FBlueprintGraphExportWriter::WriteBlueprint(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint)
+{
+    WriteBlueprintStart(Writer, Blueprint);
+    for (const FGraphSnapshot& Graph : Blueprint.Graphs)
+    {
+        Writer.WriteObjectStart();
+        WriteGraphFields(Writer, Graph);
+        Writer.WriteObjectEnd();
+    }
+    WriteBlueprintEnd(Writer, Blueprint);
+}
+
+void FBlueprintGraphExportWriter::WriteBlueprintStart(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint)
+{
+    Writer.WriteObjectStart();
+    Writer.WriteValue(TEXT("blueprint_name"), Blueprint.Name);
+    Writer.WriteValue(TEXT("blueprint_path"), Blueprint.Path);
+
+    if (!Blueprint.ParentClass.IsEmpty())
+    {
+        Writer.WriteValue(TEXT("parent_class"), Blueprint.ParentClass);
+        Writer.WriteValue(TEXT("parent_class_path"), Blueprint.ParentClassPath);
+    }
+
+    Writer.WriteArrayStart(TEXT("graphs"));
+}
+
+void FBlueprintGraphExportWriter::WriteBlueprintEnd(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint)
+{
+    Writer.WriteArrayEnd();
+
+    if (Blueprint.Components.IsSet())
+    {
+        Writer.WriteArrayStart(TEXT("components"));
+        for (const FComponentSnapshot& Component : Blueprint.Components.GetValue())
+        {
+            Writer.WriteObjectStart();
+            Writer.WriteValue(TEXT("name"), Component.Name);
+            Writer.WriteValue(TEXT("class"), Component.Class);
+            if (!Component.Parent.IsEmpty())
+            {
+                Writer.WriteValue(TEXT("parent"), Component.Parent);
+            }
+            Writer.WriteObjectEnd();
+        }
+        Writer.WriteArrayEnd();
+    }
+
+    Writer.WriteArrayStart(TEXT("variables"));
+    for (const FVariableSnapshot& Variable : Blueprint.Variables)
+    {
+        Writer.WriteObjectStart();
+        Writer.WriteValue(TEXT("name"), Variable.Name);
+        Writer.WriteValue(TEXT("type"), Variable.Type);
+        if (!Variable.SubType.IsEmpty())
+        {
+            Writer.WriteValue(TEXT("subtype"), Variable.SubType);
+        }
+        Writer.WriteValue(TEXT("is_exposed"), Variable.bIsExposed);
+        Writer.WriteObjectEnd();
+    }
+    Writer.WriteArrayEnd();
+
+    Writer.WriteObjectEnd();
+}
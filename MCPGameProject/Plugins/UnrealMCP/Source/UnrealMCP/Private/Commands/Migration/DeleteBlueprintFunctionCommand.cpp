@@ -1,25 +1,13 @@
 #include "Commands/Migration/DeleteBlueprintFunctionCommand.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphNode.h"
-#include "EdGraph/EdGraphPin.h"
-#include "K2Node_CallFunction.h"
-#include "K2Node_Event.h"
-#include "K2Node_VariableGet.h"
-#include "K2Node_VariableSet.h"
-#include "K2Node_InputAction.h"
-#include "K2Node_Self.h"
-#include "K2Node_FunctionEntry.h"
-#include "K2Node_FunctionResult.h"
-#include "K2Node_MacroInstance.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-#include "HAL/PlatformFileManager.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Services/AssetDiscoveryService.h"
+#include "MCPBatchEditScope.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMigrationDelete, Log, All);
 
@@ -100,18 +88,26 @@ FString FDeleteBlueprintFunctionCommand::Execute(const FString& Parameters)
     FString BackupPath;
     if (bBackup)
     {
-        TSharedPtr<FJsonObject> BackupJson = MakeShared<FJsonObject>();
-        BackupJson->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
-        BackupJson->SetStringField(TEXT("function_name"), FunctionName);
-        BackupJson->SetStringField(TEXT("backup_time"), FDateTime::Now().ToString());
-        BackupJson->SetObjectField(TEXT("graph_data"), SerializeGraph(GraphToDelete, true));
-
         FString FileName = FString::Printf(TEXT("backup_func_%s_%s_%s.json"),
             *Blueprint->GetName(),
             *FunctionName,
             *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
 
-        BackupPath = WriteJsonToTempFile(FileName, BackupJson);
+        // The graph is streamed to the file rather than built up as JSON first
+        FBlueprintGraphExportWriter BackupWriter;
+        if (BackupWriter.Open(FileName))
+        {
+            FBlueprintGraphExportWriter::FJsonWriter& Writer = *BackupWriter.GetJsonWriter();
+            Writer.WriteObjectStart();
+            Writer.WriteValue(TEXT("blueprint_path"), Blueprint->GetPathName());
+            Writer.WriteValue(TEXT("function_name"), FunctionName);
+            Writer.WriteValue(TEXT("backup_time"), FDateTime::Now().ToString());
+            Writer.WriteObjectStart(TEXT("graph_data"));
+            FBlueprintGraphExportWriter::WriteGraphFields(Writer, GraphToDelete);
+            Writer.WriteObjectEnd();
+            Writer.WriteObjectEnd();
+            BackupPath = BackupWriter.Close();
+        }
     }
 
     // Get node count before deletion for reporting
@@ -122,7 +118,7 @@ FString FDeleteBlueprintFunctionCommand::Execute(const FString& Parameters)
     FBlueprintEditorUtils::RemoveGraph(Blueprint, GraphToDelete);
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Build result
     TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
@@ -163,143 +159,6 @@ bool FDeleteBlueprintFunctionCommand::ValidateParams(const FString& Parameters)
         && JsonObject->TryGetStringField(TEXT("function_name"), FunctionName) && !FunctionName.IsEmpty();
 }
 
-FString FDeleteBlueprintFunctionCommand::GetExportDirectory()
-{
-    FString ExportDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Exports"));
-
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (!PlatformFile.DirectoryExists(*ExportDir))
-    {
-        PlatformFile.CreateDirectoryTree(*ExportDir);
-    }
-
-    return ExportDir;
-}
-
-FString FDeleteBlueprintFunctionCommand::WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent)
-{
-    FString ExportDir = GetExportDirectory();
-    FString FilePath = FPaths::Combine(ExportDir, FileName);
-
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(JsonContent.ToSharedRef(), Writer);
-
-    if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
-    {
-        UE_LOG(LogMigrationDelete, Log, TEXT("Wrote backup file: %s"), *FilePath);
-        return FilePath;
-    }
-
-    UE_LOG(LogMigrationDelete, Error, TEXT("Failed to write backup file: %s"), *FilePath);
-    return FString();
-}
-
-TSharedPtr<FJsonObject> FDeleteBlueprintFunctionCommand::SerializePin(UEdGraphPin* Pin, bool bIncludeConnections)
-{
-    if (!Pin)
-    {
-        return nullptr;
-    }
-
-    TSharedPtr<FJsonObject> PinJson = MakeShared<FJsonObject>();
-
-    PinJson->SetStringField(TEXT("name"), Pin->PinName.ToString());
-    PinJson->SetStringField(TEXT("direction"), Pin->Direction == EGPD_Input ? TEXT("Input") : TEXT("Output"));
-    PinJson->SetStringField(TEXT("category"), Pin->PinType.PinCategory.ToString());
-
-    if (Pin->PinType.PinSubCategoryObject.IsValid())
-    {
-        PinJson->SetStringField(TEXT("subcategory"), Pin->PinType.PinSubCategoryObject->GetName());
-    }
-
-    if (!Pin->DefaultValue.IsEmpty())
-    {
-        PinJson->SetStringField(TEXT("default_value"), Pin->DefaultValue);
-    }
-
-    if (bIncludeConnections && Pin->LinkedTo.Num() > 0)
-    {
-        TArray<TSharedPtr<FJsonValue>> ConnectionsArray;
-        for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-        {
-            if (LinkedPin && LinkedPin->GetOwningNode())
-            {
-                TSharedPtr<FJsonObject> ConnectionJson = MakeShared<FJsonObject>();
-                ConnectionJson->SetStringField(TEXT("node_guid"), LinkedPin->GetOwningNode()->NodeGuid.ToString());
-                ConnectionJson->SetStringField(TEXT("pin_name"), LinkedPin->PinName.ToString());
-                ConnectionsArray.Add(MakeShared<FJsonValueObject>(ConnectionJson));
-            }
-        }
-        PinJson->SetArrayField(TEXT("connections"), ConnectionsArray);
-    }
-
-    return PinJson;
-}
-
-TSharedPtr<FJsonObject> FDeleteBlueprintFunctionCommand::SerializeNode(UEdGraphNode* Node)
-{
-    if (!Node)
-    {
-        return nullptr;
-    }
-
-    TSharedPtr<FJsonObject> NodeJson = MakeShared<FJsonObject>();
-
-    NodeJson->SetStringField(TEXT("guid"), Node->NodeGuid.ToString());
-    NodeJson->SetStringField(TEXT("class"), Node->GetClass()->GetName());
-    NodeJson->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
-    NodeJson->SetNumberField(TEXT("pos_x"), Node->NodePosX);
-    NodeJson->SetNumberField(TEXT("pos_y"), Node->NodePosY);
-
-    // Serialize pins
-    TArray<TSharedPtr<FJsonValue>> PinsArray;
-    for (UEdGraphPin* Pin : Node->Pins)
-    {
-        if (Pin)
-        {
-            TSharedPtr<FJsonObject> PinJson = SerializePin(Pin, true);
-            if (PinJson.IsValid())
-            {
-                PinsArray.Add(MakeShared<FJsonValueObject>(PinJson));
-            }
-        }
-    }
-    NodeJson->SetArrayField(TEXT("pins"), PinsArray);
-
-    return NodeJson;
-}
-
-TSharedPtr<FJsonObject> FDeleteBlueprintFunctionCommand::SerializeGraph(UEdGraph* Graph, bool bIncludeDefaults)
-{
-    if (!Graph)
-    {
-        return nullptr;
-    }
-
-    TSharedPtr<FJsonObject> GraphJson = MakeShared<FJsonObject>();
-
-    GraphJson->SetStringField(TEXT("name"), Graph->GetName());
-    GraphJson->SetStringField(TEXT("class"), Graph->GetClass()->GetName());
-    GraphJson->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
-
-    TArray<TSharedPtr<FJsonValue>> NodesArray;
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        if (Node)
-        {
-            TSharedPtr<FJsonObject> NodeJson = SerializeNode(Node);
-            if (NodeJson.IsValid())
-            {
-                NodesArray.Add(MakeShared<FJsonValueObject>(NodeJson));
-            }
-        }
-    }
-    GraphJson->SetArrayField(TEXT("nodes"), NodesArray);
-
-    return GraphJson;
-}
-
 FString FDeleteBlueprintFunctionCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
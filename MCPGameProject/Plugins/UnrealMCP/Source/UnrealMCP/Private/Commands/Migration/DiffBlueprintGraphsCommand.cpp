@@ -0,0 +1,112 @@
+#include "Commands/Migration/DiffBlueprintGraphsCommand.h"
+#include "Commands/Migration/BlueprintGraphDiff.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
+#include "Engine/Blueprint.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Services/AssetDiscoveryService.h"
+
+FString FDiffBlueprintGraphsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FString BlueprintPath;
+    if (!JsonObject->TryGetStringField(TEXT("blueprint_path"), BlueprintPath))
+    {
+        return CreateErrorResponse(TEXT("Missing 'blueprint_path' parameter"));
+    }
+
+    // Try to load Blueprint by path or name
+    UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *BlueprintPath);
+    if (!Blueprint)
+    {
+        TArray<FString> FoundBlueprints = FAssetDiscoveryService::Get().FindBlueprints(BlueprintPath);
+        if (FoundBlueprints.Num() > 0)
+        {
+            Blueprint = LoadObject<UBlueprint>(nullptr, *FoundBlueprints[0]);
+        }
+    }
+
+    if (!Blueprint)
+    {
+        return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintPath));
+    }
+
+    FBlueprintGraphDiff::FOptions Options;
+    JsonObject->TryGetStringField(TEXT("graph_name"), Options.GraphName);
+    JsonObject->TryGetBoolField(TEXT("ignore_positions"), Options.bIgnorePositions);
+
+    FString ExportPath;
+    JsonObject->TryGetStringField(TEXT("export_path"), ExportPath);
+
+    FBlueprintGraphDiff::FBlueprintSnapshot Baseline;
+    FString Error;
+    if (!ExportPath.IsEmpty())
+    {
+        if (FPaths::IsRelative(ExportPath))
+        {
+            ExportPath = FPaths::Combine(FBlueprintGraphExportWriter::GetExportDirectory(), ExportPath);
+        }
+        if (!FBlueprintGraphDiff::ReadExport(ExportPath, Baseline, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+    }
+    else if (!FBlueprintGraphDiff::CaptureSavedBlueprint(Blueprint, Baseline, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FBlueprintGraphDiff::FBlueprintSnapshot Current;
+    FBlueprintGraphDiff::CaptureBlueprint(Blueprint, Current);
+
+    TSharedPtr<FJsonObject> ResponseObj = FBlueprintGraphDiff::Diff(Baseline, Current, Options);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetStringField(TEXT("blueprint_path"), Blueprint->GetPathName());
+    ResponseObj->SetStringField(TEXT("baseline"), ExportPath.IsEmpty() ? TEXT("saved_package") : TEXT("export"));
+    if (!ExportPath.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("export_path"), ExportPath);
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool FDiffBlueprintGraphsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString BlueprintPath;
+    return JsonObject->TryGetStringField(TEXT("blueprint_path"), BlueprintPath) && !BlueprintPath.IsEmpty();
+}
+
+FString FDiffBlueprintGraphsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -1,14 +1,12 @@
 #include "Commands/Migration/FindBlueprintReferencesCommand.h"
 #include "Engine/Blueprint.h"
-#include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphNode.h"
-#include "K2Node_CallFunction.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Services/AssetDiscoveryService.h"
+#include "Services/BlueprintCallSiteIndex.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMigrationReferences, Log, All);
 
@@ -83,43 +81,28 @@ FString FFindBlueprintReferencesCommand::Execute(const FString& Parameters)
         TSharedPtr<FJsonObject> RefJson = MakeShared<FJsonObject>();
         RefJson->SetStringField(TEXT("referencer_path"), RefPath);
 
-        // Try to get more details about how it's referenced
-        UBlueprint* ReferencerBP = LoadObject<UBlueprint>(nullptr, *RefPath);
-        if (ReferencerBP)
+        // Call sites come from the index, so referencers scanned by an earlier lookup are not loaded again
+        if (const FBlueprintCallSiteIndex::FPackageCallSites* CallSites = FBlueprintCallSiteIndex::Get().FindPackage(RefId.PackageName))
         {
-            RefJson->SetStringField(TEXT("referencer_name"), ReferencerBP->GetName());
+            RefJson->SetStringField(TEXT("referencer_name"), CallSites->BlueprintName);
             RefJson->SetStringField(TEXT("type"), TEXT("Blueprint"));
 
-            // If looking for function references, scan the graphs
+            // If looking for function references, list the matching call nodes
             if (!TargetFunction.IsEmpty())
             {
                 TArray<TSharedPtr<FJsonValue>> LocationsArray;
 
-                TArray<UEdGraph*> AllGraphs;
-                ReferencerBP->GetAllGraphs(AllGraphs);
-
-                for (UEdGraph* Graph : AllGraphs)
+                for (const FBlueprintCallSiteIndex::FCallSite& Site : CallSites->CallSites)
                 {
-                    if (!Graph) continue;
-
-                    for (UEdGraphNode* Node : Graph->Nodes)
+                    if (Site.FunctionName == TargetFunction)
                     {
-                        if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
-                        {
-                            if (UFunction* Function = CallNode->GetTargetFunction())
-                            {
-                                if (Function->GetName() == TargetFunction)
-                                {
-                                    TSharedPtr<FJsonObject> LocJson = MakeShared<FJsonObject>();
-                                    LocJson->SetStringField(TEXT("graph"), Graph->GetName());
-                                    LocJson->SetStringField(TEXT("node_guid"), Node->NodeGuid.ToString());
-                                    LocJson->SetStringField(TEXT("node_title"), Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
-                                    LocJson->SetNumberField(TEXT("pos_x"), Node->NodePosX);
-                                    LocJson->SetNumberField(TEXT("pos_y"), Node->NodePosY);
-                                    LocationsArray.Add(MakeShared<FJsonValueObject>(LocJson));
-                                }
-                            }
-                        }
+                        TSharedPtr<FJsonObject> LocJson = MakeShared<FJsonObject>();
+                        LocJson->SetStringField(TEXT("graph"), Site.GraphName);
+                        LocJson->SetStringField(TEXT("node_guid"), Site.NodeGuid.ToString());
+                        LocJson->SetStringField(TEXT("node_title"), Site.NodeTitle);
+                        LocJson->SetNumberField(TEXT("pos_x"), Site.PosX);
+                        LocJson->SetNumberField(TEXT("pos_y"), Site.PosY);
+                        LocationsArray.Add(MakeShared<FJsonValueObject>(LocJson));
                     }
                 }
 
@@ -1,14 +1,12 @@
 #include "Commands/Migration/GetBlueprintDependenciesCommand.h"
 #include "Engine/Blueprint.h"
-#include "EdGraph/EdGraph.h"
-#include "EdGraph/EdGraphNode.h"
-#include "K2Node_CallFunction.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/IAssetRegistry.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Services/AssetDiscoveryService.h"
+#include "Services/BlueprintCallSiteIndex.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMigrationDependencies, Log, All);
 
@@ -100,32 +98,19 @@ FString FGetBlueprintDependenciesCommand::Execute(const FString& Parameters)
         }
     }
 
-    // Analyze function calls in graphs
-    TArray<UEdGraph*> AllGraphs;
-    Blueprint->GetAllGraphs(AllGraphs);
-
-    for (UEdGraph* Graph : AllGraphs)
+    // Count function calls from the Blueprint's indexed call sites
+    const FBlueprintCallSiteIndex::FPackageCallSites& CallSites = FBlueprintCallSiteIndex::Get().FindBlueprint(Blueprint);
+    for (const FBlueprintCallSiteIndex::FCallSite& Site : CallSites.CallSites)
     {
-        if (!Graph) continue;
+        FString FunctionKey = FString::Printf(TEXT("%s::%s"),
+            Site.OwnerClassName.IsEmpty() ? TEXT("Unknown") : *Site.OwnerClassName,
+            *Site.FunctionName);
 
-        for (UEdGraphNode* Node : Graph->Nodes)
+        if (bIncludeEngineClasses || !FunctionKey.StartsWith(TEXT("U")) || Site.OwnerClassPath.IsEmpty() ||
+            !Site.OwnerClassPath.StartsWith(TEXT("/Script/Engine")))
         {
-            if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
-            {
-                if (UFunction* Function = CallNode->GetTargetFunction())
-                {
-                    FString FunctionKey = FString::Printf(TEXT("%s::%s"),
-                        Function->GetOwnerClass() ? *Function->GetOwnerClass()->GetName() : TEXT("Unknown"),
-                        *Function->GetName());
-
-                    if (bIncludeEngineClasses || !FunctionKey.StartsWith(TEXT("U")) || !Function->GetOwnerClass() ||
-                        !Function->GetOwnerClass()->GetPathName().StartsWith(TEXT("/Script/Engine")))
-                    {
-                        int32& Count = FunctionCalls.FindOrAdd(FunctionKey);
-                        Count++;
-                    }
-                }
-            }
+            int32& Count = FunctionCalls.FindOrAdd(FunctionKey);
+            Count++;
         }
     }
 
@@ -1,12 +1,14 @@
 #include "Commands/Migration/MigrationCommandRegistration.h"
 #include "Commands/UnrealMCPCommandRegistry.h"
 #include "Commands/Migration/ExportBlueprintGraphCommand.h"
+#include "Commands/Migration/BatchExportBlueprintGraphsCommand.h"
 #include "Commands/Migration/GetBlueprintDependenciesCommand.h"
 #include "Commands/Migration/FindBlueprintReferencesCommand.h"
 #include "Commands/Migration/RedirectFunctionCallCommand.h"
 #include "Commands/Migration/DeleteBlueprintFunctionCommand.h"
 #include "Commands/Migration/SetBlueprintParentClassCommand.h"
 #include "Commands/Migration/GetBlueprintFunctionsCommand.h"
+#include "Commands/Migration/DiffBlueprintGraphsCommand.h"
 
 // Static member definition
 TArray<FString> FMigrationCommandRegistration::RegisteredCommandNames;
@@ -20,12 +22,14 @@ void FMigrationCommandRegistration::RegisterAllMigrationCommands()
 
     // Register individual commands
     RegisterExportBlueprintGraphCommand();
+    RegisterBatchExportBlueprintGraphsCommand();
     RegisterGetBlueprintDependenciesCommand();
     RegisterFindBlueprintReferencesCommand();
     RegisterRedirectFunctionCallCommand();
     RegisterDeleteBlueprintFunctionCommand();
     RegisterSetBlueprintParentClassCommand();
     RegisterGetBlueprintFunctionsCommand();
+    RegisterDiffBlueprintGraphsCommand();
 
     UE_LOG(LogTemp, Log, TEXT("FMigrationCommandRegistration::RegisterAllMigrationCommands: Registered %d Migration commands"),
         RegisteredCommandNames.Num());
@@ -54,63 +58,53 @@ void FMigrationCommandRegistration::UnregisterAllMigrationCommands()
 
 void FMigrationCommandRegistration::RegisterExportBlueprintGraphCommand()
 {
-    TSharedPtr<FExportBlueprintGraphCommand> Command = MakeShared<FExportBlueprintGraphCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("export_blueprint_graph"), []() { return MakeShared<FExportBlueprintGraphCommand>(); });
+}
+
+void FMigrationCommandRegistration::RegisterBatchExportBlueprintGraphsCommand()
+{
+    RegisterAndTrackCommand(TEXT("batch_export_blueprint_graphs"), []() { return MakeShared<FBatchExportBlueprintGraphsCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterGetBlueprintDependenciesCommand()
 {
-    TSharedPtr<FGetBlueprintDependenciesCommand> Command = MakeShared<FGetBlueprintDependenciesCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_blueprint_dependencies"), []() { return MakeShared<FGetBlueprintDependenciesCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterFindBlueprintReferencesCommand()
 {
-    TSharedPtr<FFindBlueprintReferencesCommand> Command = MakeShared<FFindBlueprintReferencesCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("find_blueprint_references"), []() { return MakeShared<FFindBlueprintReferencesCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterRedirectFunctionCallCommand()
 {
-    TSharedPtr<FRedirectFunctionCallCommand> Command = MakeShared<FRedirectFunctionCallCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("redirect_function_call"), []() { return MakeShared<FRedirectFunctionCallCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterDeleteBlueprintFunctionCommand()
 {
-    TSharedPtr<FDeleteBlueprintFunctionCommand> Command = MakeShared<FDeleteBlueprintFunctionCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("delete_blueprint_function"), []() { return MakeShared<FDeleteBlueprintFunctionCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterSetBlueprintParentClassCommand()
 {
-    TSharedPtr<FSetBlueprintParentClassCommand> Command = MakeShared<FSetBlueprintParentClassCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_blueprint_parent_class"), []() { return MakeShared<FSetBlueprintParentClassCommand>(); });
 }
 
 void FMigrationCommandRegistration::RegisterGetBlueprintFunctionsCommand()
 {
-    TSharedPtr<FGetBlueprintFunctionsCommand> Command = MakeShared<FGetBlueprintFunctionsCommand>();
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_blueprint_functions"), []() { return MakeShared<FGetBlueprintFunctionsCommand>(); });
 }
 
-void FMigrationCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FMigrationCommandRegistration::RegisterDiffBlueprintGraphsCommand()
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FMigrationCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FMigrationCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
+    RegisterAndTrackCommand(TEXT("diff_blueprint_graphs"), []() { return MakeShared<FDiffBlueprintGraphsCommand>(); });
+}
 
+void FMigrationCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
+{
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FMigrationCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
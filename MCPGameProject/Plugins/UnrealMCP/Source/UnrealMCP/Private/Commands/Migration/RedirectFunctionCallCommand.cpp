@@ -1,18 +1,15 @@
 #include "Commands/Migration/RedirectFunctionCallCommand.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
 #include "K2Node_CallFunction.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-#include "HAL/PlatformFileManager.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Services/AssetDiscoveryService.h"
-
-DEFINE_LOG_CATEGORY_STATIC(LogMigrationRedirect, Log, All);
+#include "MCPBatchEditScope.h"
 
 FString FRedirectFunctionCallCommand::Execute(const FString& Parameters)
 {
@@ -166,7 +163,7 @@ FString FRedirectFunctionCallCommand::Execute(const FString& Parameters)
         BackupJson->SetStringField(TEXT("backup_time"), FDateTime::Now().ToString());
         BackupJson->SetArrayField(TEXT("original_state"), ChangesArray);
 
-        BackupPath = WriteJsonToTempFile(FileName, BackupJson);
+        BackupPath = FBlueprintGraphExportWriter::WriteJsonFile(FileName, BackupJson.ToSharedRef());
         ResultJson->SetStringField(TEXT("backup_path"), BackupPath);
     }
 
@@ -180,7 +177,7 @@ FString FRedirectFunctionCallCommand::Execute(const FString& Parameters)
     }
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(SourceBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(SourceBlueprint);
 
     ResultJson->SetNumberField(TEXT("nodes_redirected"), RedirectedCount);
     ResultJson->SetStringField(TEXT("message"), FString::Printf(TEXT("Successfully redirected %d function calls"), RedirectedCount));
@@ -210,38 +207,6 @@ bool FRedirectFunctionCallCommand::ValidateParams(const FString& Parameters) con
         && JsonObject->TryGetStringField(TEXT("target_function"), TargetFunction) && !TargetFunction.IsEmpty();
 }
 
-FString FRedirectFunctionCallCommand::GetExportDirectory()
-{
-    FString ExportDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Exports"));
-
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (!PlatformFile.DirectoryExists(*ExportDir))
-    {
-        PlatformFile.CreateDirectoryTree(*ExportDir);
-    }
-
-    return ExportDir;
-}
-
-FString FRedirectFunctionCallCommand::WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent)
-{
-    FString ExportDir = GetExportDirectory();
-    FString FilePath = FPaths::Combine(ExportDir, FileName);
-
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(JsonContent.ToSharedRef(), Writer);
-
-    if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
-    {
-        UE_LOG(LogMigrationRedirect, Log, TEXT("Wrote backup file: %s"), *FilePath);
-        return FilePath;
-    }
-
-    UE_LOG(LogMigrationRedirect, Error, TEXT("Failed to write backup file: %s"), *FilePath);
-    return FString();
-}
-
 FString FRedirectFunctionCallCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -1,13 +1,12 @@
 #include "Commands/Migration/SetBlueprintParentClassCommand.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
 #include "Engine/Blueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Misc/FileHelper.h"
-#include "Misc/Paths.h"
-#include "HAL/PlatformFileManager.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Services/AssetDiscoveryService.h"
+#include "MCPBatchEditScope.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMigrationReparent, Log, All);
 
@@ -105,7 +104,7 @@ FString FSetBlueprintParentClassCommand::Execute(const FString& Parameters)
             *Blueprint->GetName(),
             *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
 
-        BackupPath = WriteJsonToTempFile(FileName, BackupJson);
+        BackupPath = FBlueprintGraphExportWriter::WriteJsonFile(FileName, BackupJson.ToSharedRef());
     }
 
     // Reparent the Blueprint
@@ -114,7 +113,7 @@ FString FSetBlueprintParentClassCommand::Execute(const FString& Parameters)
 
     // Refresh the Blueprint
     FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Build result
     TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
@@ -156,38 +155,6 @@ bool FSetBlueprintParentClassCommand::ValidateParams(const FString& Parameters)
         && JsonObject->TryGetStringField(TEXT("new_parent_class"), NewParentClass) && !NewParentClass.IsEmpty();
 }
 
-FString FSetBlueprintParentClassCommand::GetExportDirectory()
-{
-    FString ExportDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Exports"));
-
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-    if (!PlatformFile.DirectoryExists(*ExportDir))
-    {
-        PlatformFile.CreateDirectoryTree(*ExportDir);
-    }
-
-    return ExportDir;
-}
-
-FString FSetBlueprintParentClassCommand::WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent)
-{
-    FString ExportDir = GetExportDirectory();
-    FString FilePath = FPaths::Combine(ExportDir, FileName);
-
-    FString JsonString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-    FJsonSerializer::Serialize(JsonContent.ToSharedRef(), Writer);
-
-    if (FFileHelper::SaveStringToFile(JsonString, *FilePath))
-    {
-        UE_LOG(LogMigrationReparent, Log, TEXT("Wrote backup file: %s"), *FilePath);
-        return FilePath;
-    }
-
-    UE_LOG(LogMigrationReparent, Error, TEXT("Failed to write backup file: %s"), *FilePath);
-    return FString();
-}
-
 FString FSetBlueprintParentClassCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
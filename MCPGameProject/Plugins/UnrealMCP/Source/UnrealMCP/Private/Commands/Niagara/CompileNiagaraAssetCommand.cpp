@@ -2,6 +2,7 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "MCPCompileQueue.h"
 
 FCompileNiagaraAssetCommand::FCompileNiagaraAssetCommand(INiagaraService& InNiagaraService)
     : NiagaraService(InNiagaraService)
@@ -18,6 +19,23 @@ FString FCompileNiagaraAssetCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(Error);
     }
 
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (FMCPCompileQueue::Get().TryDefer(GetCommandName(), Params.AssetPath, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
+
+    if (Params.bAsync)
+    {
+        int64 JobId = 0;
+        if (!NiagaraService.StartCompileAsync(Params.AssetPath, JobId, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+        return CreateAsyncResponse(Params.AssetPath, JobId);
+    }
+
     bool bSuccess = NiagaraService.CompileAsset(Params.AssetPath, Error);
 
     if (!bSuccess)
@@ -64,6 +82,8 @@ bool FCompileNiagaraAssetCommand::ParseParameters(const FString& JsonString, FCo
         return false;
     }
 
+    JsonObject->TryGetBoolField(TEXT("async"), OutParams.bAsync);
+
     return true;
 }
 
@@ -88,6 +108,22 @@ FString FCompileNiagaraAssetCommand::CreateSuccessResponse(const FString& Warnin
     return OutputString;
 }
 
+FString FCompileNiagaraAssetCommand::CreateAsyncResponse(const FString& AssetPath, int64 JobId) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetBoolField(TEXT("async"), true);
+    ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    ResponseObj->SetStringField(TEXT("asset_path"), AssetPath);
+    ResponseObj->SetStringField(TEXT("message"), TEXT("Compile started; poll get_compile_status with job_id for progress and the result"));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
 FString FCompileNiagaraAssetCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
@@ -25,6 +25,27 @@ FString FCompileNiagaraSystemCommand::Execute(const FString& Parameters)
     }
 
     FString Error;
+    bool bAsync = false;
+    if (JsonObject->TryGetBoolField(TEXT("async"), bAsync) && bAsync)
+    {
+        int64 JobId = 0;
+        if (!NiagaraService.StartCompileAsync(SystemPath, JobId, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+
+        TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+        ResponseObj->SetBoolField(TEXT("success"), true);
+        ResponseObj->SetBoolField(TEXT("async"), true);
+        ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+        ResponseObj->SetStringField(TEXT("system"), SystemPath);
+
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+        return OutputString;
+    }
+
     if (!NiagaraService.CompileAsset(SystemPath, Error))
     {
         return CreateErrorResponse(Error);
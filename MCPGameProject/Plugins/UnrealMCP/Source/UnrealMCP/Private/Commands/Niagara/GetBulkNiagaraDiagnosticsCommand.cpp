@@ -0,0 +1,72 @@
+#include "Commands/Niagara/GetBulkNiagaraDiagnosticsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGetBulkNiagaraDiagnosticsCommand::FGetBulkNiagaraDiagnosticsCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+}
+
+FString FGetBulkNiagaraDiagnosticsCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    int64 JobId = 0;
+    if (!JsonObject->TryGetNumberField(TEXT("job_id"), JobId))
+    {
+        return CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    int32 Cursor = 0;
+    JsonObject->TryGetNumberField(TEXT("cursor"), Cursor);
+    int32 MaxResults = 100;
+    JsonObject->TryGetNumberField(TEXT("max_results"), MaxResults);
+
+    TSharedPtr<FJsonObject> Status;
+    FString Error;
+    if (!NiagaraService.GetBulkDiagnostics(JobId, Cursor, MaxResults, Status, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    // Systems with errors are still a successful poll; each result carries its own state
+    Status->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Status.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FGetBulkNiagaraDiagnosticsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    int64 JobId = 0;
+    return JsonObject->TryGetNumberField(TEXT("job_id"), JobId);
+}
+
+FString FGetBulkNiagaraDiagnosticsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
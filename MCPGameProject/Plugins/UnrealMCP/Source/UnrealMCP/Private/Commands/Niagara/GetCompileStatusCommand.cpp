@@ -0,0 +1,67 @@
+#include "Commands/Niagara/GetCompileStatusCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGetCompileStatusCommand::FGetCompileStatusCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+}
+
+FString FGetCompileStatusCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    int64 JobId = 0;
+    if (!JsonObject->TryGetNumberField(TEXT("job_id"), JobId))
+    {
+        return CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FJsonObject> Status;
+    FString Error;
+    if (!NiagaraService.GetCompileStatus(JobId, Status, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    // A failed compile is still a successful poll; "state" tells the two apart
+    Status->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Status.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FGetCompileStatusCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    int64 JobId = 0;
+    return JsonObject->TryGetNumberField(TEXT("job_id"), JobId);
+}
+
+FString FGetCompileStatusCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -11,14 +11,15 @@ FGetModuleInputsCommand::FGetModuleInputsCommand(INiagaraService& InNiagaraServi
 FString FGetModuleInputsCommand::Execute(const FString& Parameters)
 {
     FString SystemPath, EmitterName, ModuleName, Stage, Error;
+    ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes;
 
-    if (!ParseParameters(Parameters, SystemPath, EmitterName, ModuleName, Stage, Error))
+    if (!ParseParameters(Parameters, SystemPath, EmitterName, ModuleName, Stage, CurveFormat, Error))
     {
         return CreateErrorResponse(Error);
     }
 
     TSharedPtr<FJsonObject> InputsResult;
-    if (!NiagaraService.GetModuleInputs(SystemPath, EmitterName, ModuleName, Stage, InputsResult))
+    if (!NiagaraService.GetModuleInputs(SystemPath, EmitterName, ModuleName, Stage, InputsResult, CurveFormat))
     {
         FString ErrorMsg = InputsResult.IsValid() ? InputsResult->GetStringField(TEXT("error")) : TEXT("Unknown error");
         return CreateErrorResponse(ErrorMsg);
@@ -40,11 +41,12 @@ FString FGetModuleInputsCommand::GetCommandName() const
 bool FGetModuleInputsCommand::ValidateParams(const FString& Parameters) const
 {
     FString SystemPath, EmitterName, ModuleName, Stage, Error;
-    return ParseParameters(Parameters, SystemPath, EmitterName, ModuleName, Stage, Error);
+    ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes;
+    return ParseParameters(Parameters, SystemPath, EmitterName, ModuleName, Stage, CurveFormat, Error);
 }
 
 bool FGetModuleInputsCommand::ParseParameters(const FString& JsonString, FString& OutSystemPath, FString& OutEmitterName,
-                                              FString& OutModuleName, FString& OutStage, FString& OutError) const
+                                              FString& OutModuleName, FString& OutStage, ENiagaraCurveDataFormat& OutCurveFormat, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -79,6 +81,14 @@ bool FGetModuleInputsCommand::ParseParameters(const FString& JsonString, FString
         return false;
     }
 
+    FString CurveFormat;
+    if (JsonObject->TryGetStringField(TEXT("curve_format"), CurveFormat)
+        && !ParseNiagaraCurveDataFormat(CurveFormat, OutCurveFormat))
+    {
+        OutError = FString::Printf(TEXT("Invalid curve_format '%s'. Valid formats: keyframes, arrays, base64"), *CurveFormat);
+        return false;
+    }
+
     return true;
 }
 
@@ -0,0 +1,98 @@
+#include "Commands/Niagara/GetNiagaraSystemSnapshotCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FGetNiagaraSystemSnapshotCommand::FGetNiagaraSystemSnapshotCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+}
+
+FString FGetNiagaraSystemSnapshotCommand::Execute(const FString& Parameters)
+{
+    FSnapshotParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> Snapshot;
+    const TArray<FString>* FieldsPtr = Params.Fields.Num() > 0 ? &Params.Fields : nullptr;
+    if (!NiagaraService.GetSystemSnapshot(Params.SystemPath, FieldsPtr, Params.EmitterName, Snapshot, Error, Params.CurveFormat))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    // The snapshot object already has success set, serialize it
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Snapshot.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+bool FGetNiagaraSystemSnapshotCommand::ValidateParams(const FString& Parameters) const
+{
+    FSnapshotParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FGetNiagaraSystemSnapshotCommand::ParseParameters(const FString& JsonString, FSnapshotParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("system_path"), OutParams.SystemPath) || OutParams.SystemPath.IsEmpty())
+    {
+        OutError = TEXT("system_path is required");
+        return false;
+    }
+
+    // Parse optional fields array
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *FieldsArray)
+        {
+            FString FieldName;
+            if (Value->TryGetString(FieldName))
+            {
+                OutParams.Fields.Add(FieldName);
+            }
+        }
+    }
+
+    JsonObject->TryGetStringField(TEXT("emitter_name"), OutParams.EmitterName);
+
+    FString CurveFormat;
+    if (JsonObject->TryGetStringField(TEXT("curve_format"), CurveFormat)
+        && !ParseNiagaraCurveDataFormat(CurveFormat, OutParams.CurveFormat))
+    {
+        OutError = FString::Printf(TEXT("Invalid curve_format '%s'. Valid formats: keyframes, arrays, base64"), *CurveFormat);
+        return false;
+    }
+
+    return true;
+}
+
+FString FGetNiagaraSystemSnapshotCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+
+    return OutputString;
+}
@@ -0,0 +1,437 @@
+#include "Commands/Niagara/InstantiateNiagaraSystemFromSpecCommand.h"
+#include "Commands/Niagara/CreateNiagaraSystemCommand.h"
+#include "Commands/Niagara/AddNiagaraParameterCommand.h"
+#include "Commands/Niagara/AddEmitterToSystemCommand.h"
+#include "Commands/Niagara/SetEmitterEnabledCommand.h"
+#include "Commands/Niagara/AddRendererCommand.h"
+#include "Commands/Niagara/SetRendererPropertyCommand.h"
+#include "Commands/Niagara/AddModuleToEmitterCommand.h"
+#include "Commands/Niagara/SetModuleInputsBatchCommand.h"
+#include "Commands/Niagara/AddDataInterfaceCommand.h"
+#include "Commands/Niagara/SetDataInterfacePropertyCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+
+namespace
+{
+    /** Copy of a spec entry, with the fields the step command expects added to it */
+    TSharedPtr<FJsonObject> MakeStepParams(const TSharedPtr<FJsonObject>& Entry)
+    {
+        TSharedPtr<FJsonObject> StepParams = MakeShared<FJsonObject>();
+        if (Entry.IsValid())
+        {
+            StepParams->Values = Entry->Values;
+        }
+        return StepParams;
+    }
+
+    /** String field of a spec entry, empty if it is missing */
+    FString GetSpecString(const TSharedPtr<FJsonObject>& Entry, const FString& Field)
+    {
+        FString Value;
+        Entry->TryGetStringField(Field, Value);
+        return Value;
+    }
+
+    /** Objects of an optional array field of a spec entry; false if an element is not an object */
+    bool GetSpecObjects(const TSharedPtr<FJsonObject>& Entry, const FString& Field, TArray<TSharedPtr<FJsonObject>>& OutObjects, FString& OutError)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (!Entry->TryGetArrayField(Field, Values))
+        {
+            return true;
+        }
+
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (!Value.IsValid() || !Value->TryGetObject(Object) || !Object->IsValid())
+            {
+                OutError = FString::Printf(TEXT("Every entry of '%s' must be an object"), *Field);
+                return false;
+            }
+            OutObjects.Add(*Object);
+        }
+        return true;
+    }
+}
+
+FInstantiateNiagaraSystemFromSpecCommand::FInstantiateNiagaraSystemFromSpecCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+    , CreateSystemCommand(MakeShared<FCreateNiagaraSystemCommand>(InNiagaraService))
+    , AddParameterCommand(MakeShared<FAddNiagaraParameterCommand>(InNiagaraService))
+    , AddEmitterCommand(MakeShared<FAddEmitterToSystemCommand>(InNiagaraService))
+    , SetEmitterEnabledCommand(MakeShared<FSetEmitterEnabledCommand>(InNiagaraService))
+    , AddRendererCommand(MakeShared<FAddRendererCommand>(InNiagaraService))
+    , SetRendererPropertyCommand(MakeShared<FSetRendererPropertyCommand>(InNiagaraService))
+    , AddModuleCommand(MakeShared<FAddModuleToEmitterCommand>(InNiagaraService))
+    , SetModuleInputsCommand(MakeShared<FSetModuleInputsBatchCommand>(InNiagaraService))
+    , AddDataInterfaceCommand(MakeShared<FAddDataInterfaceCommand>(InNiagaraService))
+    , SetDataInterfacePropertyCommand(MakeShared<FSetDataInterfacePropertyCommand>(InNiagaraService))
+{
+}
+
+FString FInstantiateNiagaraSystemFromSpecCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    FString Error;
+    if (!JsonObject->HasField(TEXT("name")))
+    {
+        return CreateErrorResponse(TEXT("Missing 'name' parameter"));
+    }
+
+    // Reject a malformed spec before anything is created
+    TArray<TSharedPtr<FJsonObject>> ParameterSpecs;
+    TArray<TSharedPtr<FJsonObject>> EmitterSpecs;
+    if (!GetSpecObjects(JsonObject, TEXT("parameters"), ParameterSpecs, Error)
+        || !GetSpecObjects(JsonObject, TEXT("emitters"), EmitterSpecs, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    bool bAllOrNothing = false;
+    JsonObject->TryGetBoolField(TEXT("all_or_nothing"), bAllOrNothing);
+
+    bool bSave = true;
+    JsonObject->TryGetBoolField(TEXT("save"), bSave);
+
+    const FString SystemName = GetSpecString(JsonObject, TEXT("name"));
+
+    TArray<TSharedPtr<FJsonValue>> StepsArray;
+    TArray<TSharedPtr<FJsonValue>> EmitterNamesArray;
+    FString SystemPath;
+    bool bRolledBack = false;
+
+    {
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Instantiate Niagara System %s"), *SystemName)));
+
+        // The system itself; "name", "path" and "template" are create_niagara_system's
+        TSharedPtr<FJsonObject> CreateParams = MakeShared<FJsonObject>();
+        for (const TCHAR* Field : { TEXT("name"), TEXT("path"), TEXT("folder_path"), TEXT("template") })
+        {
+            if (JsonObject->HasField(Field))
+            {
+                CreateParams->SetField(Field, JsonObject->TryGetField(Field));
+            }
+        }
+
+        TSharedPtr<FJsonObject> StepResult;
+        bool bSucceeded = RunStep(*CreateSystemCommand, CreateParams, FString::Printf(TEXT("system '%s'"), *SystemName), StepsArray, StepResult, Error);
+        if (bSucceeded)
+        {
+            SystemPath = StepResult->GetStringField(TEXT("system_path"));
+        }
+
+        for (int32 Index = 0; bSucceeded && Index < ParameterSpecs.Num(); ++Index)
+        {
+            TSharedPtr<FJsonObject> StepParams = MakeStepParams(ParameterSpecs[Index]);
+            StepParams->SetStringField(TEXT("system_path"), SystemPath);
+            bSucceeded = RunStep(*AddParameterCommand, StepParams,
+                FString::Printf(TEXT("parameter '%s'"), *GetSpecString(StepParams, TEXT("parameter_name"))), StepsArray, StepResult, Error);
+        }
+
+        for (int32 Index = 0; bSucceeded && Index < EmitterSpecs.Num(); ++Index)
+        {
+            FString EmitterName;
+            bSucceeded = AddEmitterFromSpec(SystemPath, EmitterSpecs[Index], StepsArray, EmitterName, Error);
+            if (!EmitterName.IsEmpty())
+            {
+                EmitterNamesArray.Add(MakeShared<FJsonValueString>(EmitterName));
+            }
+        }
+
+        if (!bSucceeded && bAllOrNothing && !SystemPath.IsEmpty())
+        {
+            // Undoes every step after the system was created when the scope closes
+            FMCPBatchEditScope::RequestRollback();
+            bRolledBack = true;
+        }
+
+        // One compile when the scope closes, shared with the compiles the steps queued; the save
+        // is queued behind it
+        UNiagaraSystem* System = SystemPath.IsEmpty() ? nullptr : NiagaraService.FindSystem(SystemPath);
+        if (System && !bRolledBack)
+        {
+            NiagaraService.RequestRecompile(System);
+            if (bSave)
+            {
+                FMCPSaveQueue::Get().SaveOrEnqueue(System);
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), Error.IsEmpty());
+    if (!Error.IsEmpty())
+    {
+        ResponseObj->SetStringField(TEXT("error"), Error);
+    }
+    ResponseObj->SetStringField(TEXT("system_path"), SystemPath);
+    ResponseObj->SetArrayField(TEXT("emitters"), EmitterNamesArray);
+    ResponseObj->SetArrayField(TEXT("steps"), StepsArray);
+    ResponseObj->SetNumberField(TEXT("step_count"), StepsArray.Num());
+    ResponseObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FInstantiateNiagaraSystemFromSpecCommand::AddEmitterFromSpec(const FString& SystemPath, const TSharedPtr<FJsonObject>& EmitterSpec,
+                                                                  TArray<TSharedPtr<FJsonValue>>& OutSteps, FString& OutEmitterName, FString& OutError) const
+{
+    TArray<TSharedPtr<FJsonObject>> RendererSpecs;
+    TArray<TSharedPtr<FJsonObject>> ModuleSpecs;
+    TArray<TSharedPtr<FJsonObject>> DataInterfaceSpecs;
+    if (!GetSpecObjects(EmitterSpec, TEXT("renderers"), RendererSpecs, OutError)
+        || !GetSpecObjects(EmitterSpec, TEXT("modules"), ModuleSpecs, OutError)
+        || !GetSpecObjects(EmitterSpec, TEXT("data_interfaces"), DataInterfaceSpecs, OutError))
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> StepParams = MakeShared<FJsonObject>();
+    StepParams->SetStringField(TEXT("system_path"), SystemPath);
+    for (const TCHAR* Field : { TEXT("emitter_path"), TEXT("emitter_name") })
+    {
+        if (EmitterSpec->HasField(Field))
+        {
+            StepParams->SetField(Field, EmitterSpec->TryGetField(Field));
+        }
+    }
+
+    const FString EmitterPath = GetSpecString(EmitterSpec, TEXT("emitter_path"));
+
+    TSharedPtr<FJsonObject> StepResult;
+    if (!RunStep(*AddEmitterCommand, StepParams, FString::Printf(TEXT("emitter '%s'"), *EmitterPath), OutSteps, StepResult, OutError))
+    {
+        return false;
+    }
+    OutEmitterName = StepResult->GetStringField(TEXT("emitter_name"));
+    const FString EmitterLabel = FString::Printf(TEXT("emitter '%s'"), *OutEmitterName);
+
+    bool bEnabled = true;
+    if (EmitterSpec->TryGetBoolField(TEXT("enabled"), bEnabled) && !bEnabled)
+    {
+        StepParams = MakeShared<FJsonObject>();
+        StepParams->SetStringField(TEXT("system_path"), SystemPath);
+        StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+        StepParams->SetBoolField(TEXT("enabled"), false);
+        if (!RunStep(*SetEmitterEnabledCommand, StepParams, FString::Printf(TEXT("disable %s"), *EmitterLabel), OutSteps, StepResult, OutError))
+        {
+            return false;
+        }
+    }
+
+    // Renderers before modules: modules such as SubUVAnimation link to the emitter's sprite renderer when added
+    for (const TSharedPtr<FJsonObject>& RendererSpec : RendererSpecs)
+    {
+        StepParams = MakeStepParams(RendererSpec);
+        StepParams->RemoveField(TEXT("properties"));
+        StepParams->SetStringField(TEXT("system_path"), SystemPath);
+        StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+        if (!RunStep(*AddRendererCommand, StepParams,
+            FString::Printf(TEXT("%s renderer on %s"), *GetSpecString(StepParams, TEXT("renderer_type")), *EmitterLabel), OutSteps, StepResult, OutError))
+        {
+            return false;
+        }
+        const FString RendererName = StepResult->GetStringField(TEXT("renderer_id"));
+
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (RendererSpec->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+            {
+                StepParams = MakeShared<FJsonObject>();
+                StepParams->SetStringField(TEXT("system_path"), SystemPath);
+                StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+                StepParams->SetStringField(TEXT("renderer_name"), RendererName);
+                StepParams->SetStringField(TEXT("property_name"), Property.Key);
+                StepParams->SetField(TEXT("property_value"), Property.Value);
+                if (!RunStep(*SetRendererPropertyCommand, StepParams,
+                    FString::Printf(TEXT("%s.%s"), *RendererName, *Property.Key), OutSteps, StepResult, OutError))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    for (const TSharedPtr<FJsonObject>& ModuleSpec : ModuleSpecs)
+    {
+        StepParams = MakeStepParams(ModuleSpec);
+        StepParams->RemoveField(TEXT("inputs"));
+        StepParams->RemoveField(TEXT("module_name"));
+        StepParams->SetStringField(TEXT("system_path"), SystemPath);
+        StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+
+        const FString Stage = GetSpecString(ModuleSpec, TEXT("stage"));
+
+        // Modules are found by their script's name unless the spec names them
+        FString ModuleName = GetSpecString(ModuleSpec, TEXT("module_name"));
+        if (ModuleName.IsEmpty())
+        {
+            ModuleName = FPaths::GetBaseFilename(GetSpecString(ModuleSpec, TEXT("module_path")));
+        }
+
+        if (!RunStep(*AddModuleCommand, StepParams, FString::Printf(TEXT("module '%s' in %s %s"), *ModuleName, *EmitterLabel, *Stage), OutSteps, StepResult, OutError))
+        {
+            return false;
+        }
+
+        TArray<TSharedPtr<FJsonObject>> InputSpecs;
+        if (!GetSpecObjects(ModuleSpec, TEXT("inputs"), InputSpecs, OutError))
+        {
+            return false;
+        }
+        if (InputSpecs.Num() == 0)
+        {
+            continue;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> InputsArray;
+        for (const TSharedPtr<FJsonObject>& InputSpec : InputSpecs)
+        {
+            TSharedPtr<FJsonObject> InputParams = MakeStepParams(InputSpec);
+            if (!InputParams->HasField(TEXT("module_name")))
+            {
+                InputParams->SetStringField(TEXT("module_name"), ModuleName);
+            }
+            InputsArray.Add(MakeShared<FJsonValueObject>(InputParams));
+        }
+
+        StepParams = MakeShared<FJsonObject>();
+        StepParams->SetStringField(TEXT("system_path"), SystemPath);
+        StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+        StepParams->SetStringField(TEXT("stage"), Stage);
+        StepParams->SetArrayField(TEXT("inputs"), InputsArray);
+        if (!RunStep(*SetModuleInputsCommand, StepParams, FString::Printf(TEXT("inputs of module '%s'"), *ModuleName), OutSteps, StepResult, OutError))
+        {
+            return false;
+        }
+    }
+
+    for (const TSharedPtr<FJsonObject>& DataInterfaceSpec : DataInterfaceSpecs)
+    {
+        StepParams = MakeStepParams(DataInterfaceSpec);
+        StepParams->RemoveField(TEXT("properties"));
+        StepParams->SetStringField(TEXT("system_path"), SystemPath);
+        StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+        if (!RunStep(*AddDataInterfaceCommand, StepParams,
+            FString::Printf(TEXT("%s data interface on %s"), *GetSpecString(StepParams, TEXT("interface_type")), *EmitterLabel), OutSteps, StepResult, OutError))
+        {
+            return false;
+        }
+        const FString InterfaceName = StepResult->GetStringField(TEXT("interface_id"));
+
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (DataInterfaceSpec->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*Properties)->Values)
+            {
+                StepParams = MakeShared<FJsonObject>();
+                StepParams->SetStringField(TEXT("system_path"), SystemPath);
+                StepParams->SetStringField(TEXT("emitter_name"), OutEmitterName);
+                StepParams->SetStringField(TEXT("interface_name"), InterfaceName);
+                StepParams->SetStringField(TEXT("property_name"), Property.Key);
+                StepParams->SetField(TEXT("property_value"), Property.Value);
+                if (!RunStep(*SetDataInterfacePropertyCommand, StepParams,
+                    FString::Printf(TEXT("%s.%s"), *InterfaceName, *Property.Key), OutSteps, StepResult, OutError))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool FInstantiateNiagaraSystemFromSpecCommand::RunStep(IUnrealMCPCommand& Command, const TSharedPtr<FJsonObject>& StepParams, const FString& Label,
+                                                       TArray<TSharedPtr<FJsonValue>>& OutSteps, TSharedPtr<FJsonObject>& OutResult, FString& OutError) const
+{
+    FString StepString;
+    TSharedRef<TJsonWriter<>> StepWriter = TJsonWriterFactory<>::Create(&StepString);
+    FJsonSerializer::Serialize(StepParams.ToSharedRef(), StepWriter);
+
+    FString StepError;
+    TSharedRef<TJsonReader<>> ResultReader = TJsonReaderFactory<>::Create(Command.Execute(StepString));
+    if (!FJsonSerializer::Deserialize(ResultReader, OutResult) || !OutResult.IsValid())
+    {
+        StepError = TEXT("Invalid response from step command");
+    }
+    else if (!OutResult->GetBoolField(TEXT("success")))
+    {
+        // set_module_inputs_batch reports failed inputs per entry rather than as one error
+        if (!OutResult->TryGetStringField(TEXT("error"), StepError))
+        {
+            StepError = TEXT("Step failed");
+            const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+            if (OutResult->TryGetArrayField(TEXT("results"), Results))
+            {
+                for (const TSharedPtr<FJsonValue>& Entry : *Results)
+                {
+                    const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+                    if (Entry->TryGetObject(EntryObj) && (*EntryObj)->TryGetStringField(TEXT("error"), StepError))
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        OutResult->RemoveField(TEXT("success"));
+    }
+
+    TSharedPtr<FJsonObject> StepObj = MakeShared<FJsonObject>();
+    StepObj->SetStringField(TEXT("command"), Command.GetCommandName());
+    StepObj->SetStringField(TEXT("step"), Label);
+    StepObj->SetBoolField(TEXT("success"), StepError.IsEmpty());
+    if (!StepError.IsEmpty())
+    {
+        StepObj->SetStringField(TEXT("error"), StepError);
+        OutError = FString::Printf(TEXT("Failed to add %s: %s"), *Label, *StepError);
+    }
+    OutSteps.Add(MakeShared<FJsonValueObject>(StepObj));
+
+    return StepError.IsEmpty();
+}
+
+bool FInstantiateNiagaraSystemFromSpecCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString Name;
+    return JsonObject->TryGetStringField(TEXT("name"), Name) && !Name.IsEmpty();
+}
+
+FString FInstantiateNiagaraSystemFromSpecCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
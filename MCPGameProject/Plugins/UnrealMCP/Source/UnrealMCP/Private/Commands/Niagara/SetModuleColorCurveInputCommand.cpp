@@ -1,4 +1,5 @@
 #include "Commands/Niagara/SetModuleColorCurveInputCommand.h"
+#include "Utils/JsonUtils.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -82,11 +83,37 @@ bool FSetModuleColorCurveInputCommand::ParseParameters(const FString& JsonString
         return false;
     }
 
+    // Packed keys: "times" and interleaved RGBA "colors", each a number array or a base64 float32 buffer
+    if (!JsonObject->HasField(TEXT("keyframes")) && JsonObject->HasField(TEXT("times")))
+    {
+        TArray<float> Times;
+        TArray<float> Colors;
+        if (!FJsonUtils::GetPackedFloatArrayFromJson(JsonObject, TEXT("times"), Times, OutError)
+            || !FJsonUtils::GetPackedFloatArrayFromJson(JsonObject, TEXT("colors"), Colors, OutError))
+        {
+            return false;
+        }
+        if (Colors.Num() != Times.Num() * 4)
+        {
+            OutError = FString::Printf(TEXT("'colors' needs 4 values (RGBA) per entry of 'times': expected %d, got %d"),
+                Times.Num() * 4, Colors.Num());
+            return false;
+        }
+
+        OutParams.Keyframes.Reserve(Times.Num());
+        for (int32 Index = 0; Index < Times.Num(); ++Index)
+        {
+            const float* Color = &Colors[Index * 4];
+            OutParams.Keyframes.Emplace(Times[Index], Color[0], Color[1], Color[2], Color[3]);
+        }
+        return OutParams.IsValid(OutError);
+    }
+
     // Parse keyframes array
     const TArray<TSharedPtr<FJsonValue>>* KeyframesArray = nullptr;
     if (!JsonObject->TryGetArrayField(TEXT("keyframes"), KeyframesArray))
     {
-        OutError = TEXT("Missing 'keyframes' array parameter");
+        OutError = TEXT("Missing 'keyframes' array parameter (or packed 'times' and 'colors')");
         return false;
     }
 
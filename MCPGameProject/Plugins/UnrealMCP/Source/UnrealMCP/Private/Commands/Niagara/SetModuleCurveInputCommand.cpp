@@ -1,4 +1,5 @@
 #include "Commands/Niagara/SetModuleCurveInputCommand.h"
+#include "Utils/JsonUtils.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -82,11 +83,35 @@ bool FSetModuleCurveInputCommand::ParseParameters(const FString& JsonString, FNi
         return false;
     }
 
+    // Packed keys: parallel "times" and "values", each a number array or a base64 float32 buffer
+    if (!JsonObject->HasField(TEXT("keyframes")) && JsonObject->HasField(TEXT("times")))
+    {
+        TArray<float> Times;
+        TArray<float> Values;
+        if (!FJsonUtils::GetPackedFloatArrayFromJson(JsonObject, TEXT("times"), Times, OutError)
+            || !FJsonUtils::GetPackedFloatArrayFromJson(JsonObject, TEXT("values"), Values, OutError))
+        {
+            return false;
+        }
+        if (Times.Num() != Values.Num())
+        {
+            OutError = FString::Printf(TEXT("'times' has %d entries but 'values' has %d"), Times.Num(), Values.Num());
+            return false;
+        }
+
+        OutParams.Keyframes.Reserve(Times.Num());
+        for (int32 Index = 0; Index < Times.Num(); ++Index)
+        {
+            OutParams.Keyframes.Emplace(Times[Index], Values[Index]);
+        }
+        return OutParams.IsValid(OutError);
+    }
+
     // Parse keyframes array
     const TArray<TSharedPtr<FJsonValue>>* KeyframesArray = nullptr;
     if (!JsonObject->TryGetArrayField(TEXT("keyframes"), KeyframesArray))
     {
-        OutError = TEXT("Missing 'keyframes' array parameter");
+        OutError = TEXT("Missing 'keyframes' array parameter (or packed 'times' and 'values')");
         return false;
     }
 
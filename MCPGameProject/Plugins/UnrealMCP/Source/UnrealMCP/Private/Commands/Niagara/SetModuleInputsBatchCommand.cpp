@@ -0,0 +1,201 @@
+#include "Commands/Niagara/SetModuleInputsBatchCommand.h"
+#include "Commands/Niagara/SetModuleInputCommand.h"
+#include "Commands/Niagara/SetModuleCurveInputCommand.h"
+#include "Commands/Niagara/SetModuleColorCurveInputCommand.h"
+#include "Commands/Niagara/SetModuleRandomInputCommand.h"
+#include "Commands/Niagara/SetModuleLinkedInputCommand.h"
+#include "Commands/Niagara/SetModuleStaticSwitchCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "MCPBatchEditScope.h"
+
+namespace
+{
+    /** Batch-level fields an entry inherits when it does not set them itself */
+    const TCHAR* const SharedEntryFields[] = { TEXT("system_path"), TEXT("emitter_name"), TEXT("stage") };
+}
+
+FSetModuleInputsBatchCommand::FSetModuleInputsBatchCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+    InputCommands.Add(TEXT("value"), MakeShared<FSetModuleInputCommand>(InNiagaraService));
+    InputCommands.Add(TEXT("curve"), MakeShared<FSetModuleCurveInputCommand>(InNiagaraService));
+    InputCommands.Add(TEXT("color_curve"), MakeShared<FSetModuleColorCurveInputCommand>(InNiagaraService));
+    InputCommands.Add(TEXT("random"), MakeShared<FSetModuleRandomInputCommand>(InNiagaraService));
+    InputCommands.Add(TEXT("linked"), MakeShared<FSetModuleLinkedInputCommand>(InNiagaraService));
+    InputCommands.Add(TEXT("static_switch"), MakeShared<FSetModuleStaticSwitchCommand>(InNiagaraService));
+}
+
+FString FSetModuleInputsBatchCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Invalid JSON parameters"));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* InputsArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("inputs"), InputsArray))
+    {
+        return CreateErrorResponse(TEXT("Missing 'inputs' array parameter"));
+    }
+
+    bool bAllOrNothing = false;
+    JsonObject->TryGetBoolField(TEXT("all_or_nothing"), bAllOrNothing);
+
+    bool bCompile = true;
+    JsonObject->TryGetBoolField(TEXT("compile"), bCompile);
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    TArray<FString> TouchedSystemPaths;
+    int32 SucceededCount = 0;
+    int32 FailedCount = 0;
+    bool bRolledBack = false;
+
+    {
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Set Niagara Module Inputs (%d)"), InputsArray->Num())));
+
+        for (int32 Index = 0; Index < InputsArray->Num(); ++Index)
+        {
+            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+            ResultObj->SetNumberField(TEXT("index"), Index);
+
+            const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+            FString Error;
+            if (!(*InputsArray)[Index]->TryGetObject(EntryObj) || !EntryObj->IsValid())
+            {
+                Error = TEXT("Entry is not an object");
+            }
+
+            FString Type = TEXT("value");
+            TSharedPtr<FJsonObject> EntryParams = MakeShared<FJsonObject>();
+            if (Error.IsEmpty())
+            {
+                (*EntryObj)->TryGetStringField(TEXT("type"), Type);
+                ResultObj->SetStringField(TEXT("type"), Type);
+
+                EntryParams->Values = (*EntryObj)->Values;
+                EntryParams->RemoveField(TEXT("type"));
+                for (const TCHAR* Field : SharedEntryFields)
+                {
+                    if (!EntryParams->HasField(Field) && JsonObject->HasField(Field))
+                    {
+                        EntryParams->SetField(Field, JsonObject->TryGetField(Field));
+                    }
+                }
+            }
+
+            const TSharedRef<IUnrealMCPCommand>* InputCommand = Error.IsEmpty() ? InputCommands.Find(Type) : nullptr;
+            if (Error.IsEmpty() && !InputCommand)
+            {
+                Error = FString::Printf(TEXT("Unknown input type '%s' (expected value, curve, color_curve, random, linked or static_switch)"), *Type);
+            }
+
+            if (Error.IsEmpty())
+            {
+                FString EntryString;
+                TSharedRef<TJsonWriter<>> EntryWriter = TJsonWriterFactory<>::Create(&EntryString);
+                FJsonSerializer::Serialize(EntryParams.ToSharedRef(), EntryWriter);
+
+                TSharedPtr<FJsonObject> EntryResult;
+                TSharedRef<TJsonReader<>> ResultReader = TJsonReaderFactory<>::Create((*InputCommand)->Execute(EntryString));
+                if (!FJsonSerializer::Deserialize(ResultReader, EntryResult) || !EntryResult.IsValid())
+                {
+                    Error = TEXT("Invalid response from input command");
+                }
+                else if (!EntryResult->GetBoolField(TEXT("success")))
+                {
+                    Error = EntryResult->GetStringField(TEXT("error"));
+                }
+                else
+                {
+                    EntryResult->RemoveField(TEXT("success"));
+                    ResultObj->SetObjectField(TEXT("result"), EntryResult);
+                    TouchedSystemPaths.AddUnique(EntryParams->GetStringField(TEXT("system_path")));
+                }
+            }
+
+            ResultObj->SetBoolField(TEXT("success"), Error.IsEmpty());
+            if (!Error.IsEmpty())
+            {
+                ResultObj->SetStringField(TEXT("error"), Error);
+            }
+            ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+
+            if (Error.IsEmpty())
+            {
+                SucceededCount++;
+                continue;
+            }
+
+            FailedCount++;
+            if (bAllOrNothing)
+            {
+                // Undoes every input already set when the scope closes
+                FMCPBatchEditScope::RequestRollback();
+                bRolledBack = true;
+                break;
+            }
+        }
+
+        // One compile per touched system when the scope closes, shared with the compiles the input commands queued
+        if (bCompile && !bRolledBack)
+        {
+            for (const FString& SystemPath : TouchedSystemPaths)
+            {
+                NiagaraService.RequestRecompile(NiagaraService.FindSystem(SystemPath));
+            }
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> CompiledArray;
+    if (bCompile && !bRolledBack)
+    {
+        for (const FString& SystemPath : TouchedSystemPaths)
+        {
+            CompiledArray.Add(MakeShared<FJsonValueString>(SystemPath));
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), FailedCount == 0);
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResponseObj->SetNumberField(TEXT("failed"), FailedCount);
+    ResponseObj->SetBoolField(TEXT("rolled_back"), bRolledBack);
+    ResponseObj->SetArrayField(TEXT("compiled_systems"), CompiledArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FSetModuleInputsBatchCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* InputsArray = nullptr;
+    return JsonObject->TryGetArrayField(TEXT("inputs"), InputsArray);
+}
+
+FString FSetModuleInputsBatchCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -0,0 +1,127 @@
+#include "Commands/Niagara/SetNiagaraComponentParametersCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "MCPBatchEditScope.h"
+
+FSetNiagaraComponentParametersCommand::FSetNiagaraComponentParametersCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+}
+
+FString FSetNiagaraComponentParametersCommand::Execute(const FString& Parameters)
+{
+    FNiagaraComponentParametersParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> Result;
+    {
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Set Niagara Component Parameters (%d)"), Params.Parameters.Num())));
+        if (!NiagaraService.SetComponentParameters(Params, Result, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FSetNiagaraComponentParametersCommand::ValidateParams(const FString& Parameters) const
+{
+    FNiagaraComponentParametersParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FSetNiagaraComponentParametersCommand::ParseParameters(const FString& JsonString, FNiagaraComponentParametersParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    // Targets
+    JsonObject->TryGetStringArrayField(TEXT("actors"), OutParams.ActorNames);
+    JsonObject->TryGetStringField(TEXT("tag"), OutParams.Tag);
+    JsonObject->TryGetStringField(TEXT("class"), OutParams.ClassName);
+
+    // Parameters: {"SpawnRate": 200, "Tint": [1, 0.5, 0], "Enabled": true, "Offset": "0,0,100"}
+    const TSharedPtr<FJsonObject>* ParametersObj = nullptr;
+    if (!JsonObject->TryGetObjectField(TEXT("parameters"), ParametersObj))
+    {
+        OutError = TEXT("Missing 'parameters' object parameter");
+        return false;
+    }
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*ParametersObj)->Values)
+    {
+        FNiagaraComponentParameterValue& Value = OutParams.Parameters.AddDefaulted_GetRef();
+        Value.Name = Pair.Key;
+
+        const TSharedPtr<FJsonValue>& JsonValue = Pair.Value;
+        bool bValid = JsonValue.IsValid();
+        if (bValid && JsonValue->Type == EJson::Number)
+        {
+            Value.Components.Add(JsonValue->AsNumber());
+        }
+        else if (bValid && JsonValue->Type == EJson::Boolean)
+        {
+            Value.Components.Add(JsonValue->AsBool() ? 1.0 : 0.0);
+        }
+        else if (bValid && JsonValue->Type == EJson::Array)
+        {
+            for (const TSharedPtr<FJsonValue>& Element : JsonValue->AsArray())
+            {
+                double Number = 0.0;
+                bValid &= Element.IsValid() && Element->TryGetNumber(Number);
+                Value.Components.Add(Number);
+            }
+        }
+        else if (bValid && JsonValue->Type == EJson::String)
+        {
+            TArray<FString> Parts;
+            JsonValue->AsString().ParseIntoArray(Parts, TEXT(","));
+            for (const FString& Part : Parts)
+            {
+                bValid &= Part.TrimStartAndEnd().IsNumeric();
+                Value.Components.Add(FCString::Atod(*Part.TrimStartAndEnd()));
+            }
+        }
+        else
+        {
+            bValid = false;
+        }
+
+        if (!bValid || Value.Components.Num() == 0)
+        {
+            OutError = FString::Printf(TEXT("Parameter '%s' must be a number, boolean, number array or comma-separated numbers"), *Pair.Key);
+            return false;
+        }
+    }
+
+    return OutParams.IsValid(OutError);
+}
+
+FString FSetNiagaraComponentParametersCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -0,0 +1,95 @@
+#include "Commands/Niagara/StartBulkNiagaraDiagnosticsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FStartBulkNiagaraDiagnosticsCommand::FStartBulkNiagaraDiagnosticsCommand(INiagaraService& InNiagaraService)
+    : NiagaraService(InNiagaraService)
+{
+}
+
+FString FStartBulkNiagaraDiagnosticsCommand::Execute(const FString& Parameters)
+{
+    FBulkDiagnosticsParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int64 JobId = 0;
+    int32 SystemCount = 0;
+    if (!NiagaraService.StartBulkDiagnostics(Params.SystemPaths, Params.PackagePath, Params.bCompile, Params.MaxInFlight, JobId, SystemCount, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    ResponseObj->SetNumberField(TEXT("systems_total"), SystemCount);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Checking %d Niagara System(s); read the results with get_bulk_niagara_diagnostics"), SystemCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FStartBulkNiagaraDiagnosticsCommand::ValidateParams(const FString& Parameters) const
+{
+    FBulkDiagnosticsParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FStartBulkNiagaraDiagnosticsCommand::ParseParameters(const FString& JsonString, FBulkDiagnosticsParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* SystemsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("systems"), SystemsArray) && SystemsArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *SystemsArray)
+        {
+            FString SystemPath;
+            if (Value->TryGetString(SystemPath) && !SystemPath.IsEmpty())
+            {
+                OutParams.SystemPaths.Add(SystemPath);
+            }
+        }
+    }
+
+    JsonObject->TryGetStringField(TEXT("path"), OutParams.PackagePath);
+
+    if (OutParams.SystemPaths.Num() == 0 && OutParams.PackagePath.IsEmpty())
+    {
+        OutError = TEXT("Either 'systems' or 'path' is required");
+        return false;
+    }
+
+    JsonObject->TryGetBoolField(TEXT("compile"), OutParams.bCompile);
+    JsonObject->TryGetNumberField(TEXT("max_in_flight"), OutParams.MaxInFlight);
+
+    return true;
+}
+
+FString FStartBulkNiagaraDiagnosticsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetBoolField(TEXT("success"), false);
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -13,6 +13,7 @@
 #include "Commands/Niagara/GetEmitterPropertiesCommand.h"
 #include "Commands/Niagara/GetNiagaraMetadataCommand.h"
 #include "Commands/Niagara/CompileNiagaraAssetCommand.h"
+#include "Commands/Niagara/GetCompileStatusCommand.h"
 
 // Feature 2: Module System
 #include "Commands/Niagara/SearchNiagaraModulesCommand.h"
@@ -24,9 +25,14 @@
 #include "Commands/Niagara/SetModuleRandomInputCommand.h"
 #include "Commands/Niagara/SetModuleLinkedInputCommand.h"
 #include "Commands/Niagara/SetModuleStaticSwitchCommand.h"
+#include "Commands/Niagara/SetModuleInputsBatchCommand.h"
+#include "Commands/Niagara/InstantiateNiagaraSystemFromSpecCommand.h"
 #include "Commands/Niagara/GetNiagaraDiagnosticsCommand.h"
+#include "Commands/Niagara/StartBulkNiagaraDiagnosticsCommand.h"
+#include "Commands/Niagara/GetBulkNiagaraDiagnosticsCommand.h"
 #include "Commands/Niagara/GetModuleInputsCommand.h"
 #include "Commands/Niagara/GetEmitterModulesCommand.h"
+#include "Commands/Niagara/GetNiagaraSystemSnapshotCommand.h"
 #include "Commands/Niagara/RemoveModuleFromEmitterCommand.h"
 
 // Feature 3: Parameters
@@ -53,68 +59,73 @@
 
 // Feature 6: Level Integration
 #include "Commands/Niagara/SpawnNiagaraActorCommand.h"
+#include "Commands/Niagara/SetNiagaraComponentParametersCommand.h"
 
-TArray<TSharedPtr<IUnrealMCPCommand>> FNiagaraCommandRegistration::RegisteredCommands;
+TArray<FString> FNiagaraCommandRegistration::RegisteredCommandNames;
 
 void FNiagaraCommandRegistration::RegisterAllCommands()
 {
     UE_LOG(LogTemp, Log, TEXT("Registering Niagara commands..."));
 
-    // Get the Niagara service instance
-    INiagaraService& NiagaraService = FNiagaraService::Get();
-
     // Register Feature 1: Core Asset Management commands
-    RegisterAndTrackCommand(MakeShared<FCreateNiagaraSystemCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FCreateNiagaraEmitterCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FAddEmitterToSystemCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetEmitterEnabledCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FRemoveEmitterFromSystemCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetEmitterPropertyCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetEmitterPropertiesCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetNiagaraMetadataCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FCompileNiagaraAssetCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("create_niagara_system"), []() { return MakeShared<FCreateNiagaraSystemCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("create_niagara_emitter"), []() { return MakeShared<FCreateNiagaraEmitterCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_emitter_to_system"), []() { return MakeShared<FAddEmitterToSystemCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_emitter_enabled"), []() { return MakeShared<FSetEmitterEnabledCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("remove_emitter_from_system"), []() { return MakeShared<FRemoveEmitterFromSystemCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_emitter_property"), []() { return MakeShared<FSetEmitterPropertyCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_emitter_properties"), []() { return MakeShared<FGetEmitterPropertiesCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_niagara_metadata"), []() { return MakeShared<FGetNiagaraMetadataCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("compile_niagara_asset"), []() { return MakeShared<FCompileNiagaraAssetCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_compile_status"), []() { return MakeShared<FGetCompileStatusCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("instantiate_niagara_system_from_spec"), []() { return MakeShared<FInstantiateNiagaraSystemFromSpecCommand>(FNiagaraService::Get()); });
 
     // Register Feature 2: Module System commands
-    RegisterAndTrackCommand(MakeShared<FSearchNiagaraModulesCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FAddModuleToEmitterCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleInputCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FMoveModuleCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleCurveInputCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleColorCurveInputCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleRandomInputCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleLinkedInputCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetModuleStaticSwitchCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetModuleInputsCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetEmitterModulesCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FRemoveModuleFromEmitterCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetNiagaraDiagnosticsCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("search_niagara_modules"), []() { return MakeShared<FSearchNiagaraModulesCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_module_to_emitter"), []() { return MakeShared<FAddModuleToEmitterCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_input"), []() { return MakeShared<FSetModuleInputCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("move_module"), []() { return MakeShared<FMoveModuleCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_curve_input"), []() { return MakeShared<FSetModuleCurveInputCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_color_curve_input"), []() { return MakeShared<FSetModuleColorCurveInputCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_random_input"), []() { return MakeShared<FSetModuleRandomInputCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_linked_input"), []() { return MakeShared<FSetModuleLinkedInputCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_static_switch"), []() { return MakeShared<FSetModuleStaticSwitchCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_module_inputs_batch"), []() { return MakeShared<FSetModuleInputsBatchCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_module_inputs"), []() { return MakeShared<FGetModuleInputsCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_emitter_modules"), []() { return MakeShared<FGetEmitterModulesCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_niagara_system_snapshot"), []() { return MakeShared<FGetNiagaraSystemSnapshotCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("remove_module_from_emitter"), []() { return MakeShared<FRemoveModuleFromEmitterCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_niagara_diagnostics"), []() { return MakeShared<FGetNiagaraDiagnosticsCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("start_bulk_niagara_diagnostics"), []() { return MakeShared<FStartBulkNiagaraDiagnosticsCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_bulk_niagara_diagnostics"), []() { return MakeShared<FGetBulkNiagaraDiagnosticsCommand>(FNiagaraService::Get()); });
 
     // Register Feature 3: Parameter commands
-    RegisterAndTrackCommand(MakeShared<FAddNiagaraParameterCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetNiagaraParameterCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("add_niagara_parameter"), []() { return MakeShared<FAddNiagaraParameterCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_niagara_parameter"), []() { return MakeShared<FSetNiagaraParameterCommand>(FNiagaraService::Get()); });
 
     // Register Python MCP-compatible typed parameter commands
-    RegisterAndTrackCommand(MakeShared<FSetNiagaraFloatParamCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetNiagaraVectorParamCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetNiagaraColorParamCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetNiagaraParametersCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetNiagaraSystemMetadataCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FCompileNiagaraSystemCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FDuplicateNiagaraSystemCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("set_niagara_float_param"), []() { return MakeShared<FSetNiagaraFloatParamCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_niagara_vector_param"), []() { return MakeShared<FSetNiagaraVectorParamCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_niagara_color_param"), []() { return MakeShared<FSetNiagaraColorParamCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_niagara_parameters"), []() { return MakeShared<FGetNiagaraParametersCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_niagara_system_metadata"), []() { return MakeShared<FGetNiagaraSystemMetadataCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("compile_niagara_system"), []() { return MakeShared<FCompileNiagaraSystemCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("duplicate_niagara_system"), []() { return MakeShared<FDuplicateNiagaraSystemCommand>(FNiagaraService::Get()); });
 
     // Register Feature 4: Data Interface commands
-    RegisterAndTrackCommand(MakeShared<FAddDataInterfaceCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetDataInterfacePropertyCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("add_data_interface"), []() { return MakeShared<FAddDataInterfaceCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_data_interface_property"), []() { return MakeShared<FSetDataInterfacePropertyCommand>(FNiagaraService::Get()); });
 
     // Register Feature 5: Renderer commands
-    RegisterAndTrackCommand(MakeShared<FAddRendererCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FSetRendererPropertyCommand>(NiagaraService));
-    RegisterAndTrackCommand(MakeShared<FGetRendererPropertiesCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("add_renderer"), []() { return MakeShared<FAddRendererCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_renderer_property"), []() { return MakeShared<FSetRendererPropertyCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_renderer_properties"), []() { return MakeShared<FGetRendererPropertiesCommand>(FNiagaraService::Get()); });
 
     // Register Feature 6: Level Integration commands
-    RegisterAndTrackCommand(MakeShared<FSpawnNiagaraActorCommand>(NiagaraService));
+    RegisterAndTrackCommand(TEXT("spawn_niagara_actor"), []() { return MakeShared<FSpawnNiagaraActorCommand>(FNiagaraService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_niagara_component_parameters"), []() { return MakeShared<FSetNiagaraComponentParametersCommand>(FNiagaraService::Get()); });
 
-    UE_LOG(LogTemp, Log, TEXT("Registered %d Niagara commands"), RegisteredCommands.Num());
+    UE_LOG(LogTemp, Log, TEXT("Registered %d Niagara commands"), RegisteredCommandNames.Num());
 }
 
 void FNiagaraCommandRegistration::UnregisterAllCommands()
@@ -123,35 +134,26 @@ void FNiagaraCommandRegistration::UnregisterAllCommands()
 
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
 
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
-        {
-            Registry.UnregisterCommand(Command->GetCommandName());
-        }
+        Registry.UnregisterCommand(CommandName);
     }
 
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     UE_LOG(LogTemp, Log, TEXT("Unregistered all Niagara commands"));
 }
 
-void FNiagaraCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FNiagaraCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("Attempted to register invalid Niagara command"));
-        return;
-    }
-
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
 
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("Registered Niagara command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("Registered Niagara command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to register Niagara command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Error, TEXT("Failed to register Niagara command: %s"), *CommandName);
     }
 }
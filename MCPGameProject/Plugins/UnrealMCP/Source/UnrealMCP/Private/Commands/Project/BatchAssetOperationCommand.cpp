@@ -0,0 +1,173 @@
+#include "Commands/Project/BatchAssetOperationCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBatchAssetOperationCommand::FBatchAssetOperationCommand(TSharedPtr<IProjectService> InProjectService)
+    : ProjectService(InProjectService)
+{
+}
+
+bool FBatchAssetOperationCommand::ValidateParams(const FString& Parameters) const
+{
+    FParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+FString FBatchAssetOperationCommand::Execute(const FString& Parameters)
+{
+    FParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<FAssetBatchResult> Results;
+    int32 FixedRedirectors = 0;
+    bool bRan = false;
+    if (Params.Operation == TEXT("move") || Params.Operation == TEXT("rename"))
+    {
+        bRan = ProjectService->RenameAssets(Params.Assets, Params.bFixupRedirectors, Results, FixedRedirectors, Error);
+    }
+    else if (Params.Operation == TEXT("duplicate"))
+    {
+        bRan = ProjectService->DuplicateAssets(Params.Assets, Results, Error);
+    }
+    else
+    {
+        TArray<FString> AssetPaths;
+        AssetPaths.Reserve(Params.Assets.Num());
+        for (const FAssetBatchEntry& Asset : Params.Assets)
+        {
+            AssetPaths.Add(Asset.AssetPath);
+        }
+        bRan = ProjectService->DeleteAssets(AssetPaths, Results, Error);
+    }
+
+    if (!bRan)
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int32 SucceededCount = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Results.Num());
+    for (const FAssetBatchResult& Result : Results)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("asset_path"), Result.AssetPath);
+        if (!Result.NewAssetPath.IsEmpty())
+        {
+            ResultObj->SetStringField(TEXT("new_asset_path"), Result.NewAssetPath);
+        }
+        ResultObj->SetBoolField(TEXT("success"), Result.bSuccess);
+        if (!Result.bSuccess)
+        {
+            ResultObj->SetStringField(TEXT("error"), Result.Error);
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+        SucceededCount += Result.bSuccess ? 1 : 0;
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("operation"), Params.Operation);
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Results.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Results.Num() - SucceededCount);
+    if (Params.Operation == TEXT("move") || Params.Operation == TEXT("rename"))
+    {
+        ResponseObj->SetNumberField(TEXT("redirectors_fixed"), FixedRedirectors);
+    }
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FBatchAssetOperationCommand::ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("operation"), OutParams.Operation);
+    OutParams.Operation.ToLowerInline();
+    if (OutParams.Operation != TEXT("move") && OutParams.Operation != TEXT("rename")
+        && OutParams.Operation != TEXT("duplicate") && OutParams.Operation != TEXT("delete"))
+    {
+        OutError = TEXT("'operation' must be one of: move, rename, duplicate, delete");
+        return false;
+    }
+
+    FString DefaultFolder;
+    JsonObject->TryGetStringField(TEXT("destination_folder"), DefaultFolder);
+
+    const TArray<TSharedPtr<FJsonValue>>* AssetsArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("assets"), AssetsArray) || AssetsArray->Num() == 0)
+    {
+        OutError = TEXT("Missing 'assets' parameter: a non-empty array of asset paths or objects");
+        return false;
+    }
+
+    for (int32 Index = 0; Index < AssetsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonValue>& Value = (*AssetsArray)[Index];
+        FAssetBatchEntry Entry;
+        const TSharedPtr<FJsonObject>* AssetObj = nullptr;
+        if (Value.IsValid() && Value->TryGetObject(AssetObj))
+        {
+            (*AssetObj)->TryGetStringField(TEXT("asset_path"), Entry.AssetPath);
+            (*AssetObj)->TryGetStringField(TEXT("destination_folder"), Entry.DestinationFolder);
+            (*AssetObj)->TryGetStringField(TEXT("new_name"), Entry.NewName);
+        }
+        else if (Value.IsValid())
+        {
+            Value->TryGetString(Entry.AssetPath);
+        }
+
+        if (Entry.AssetPath.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("assets[%d] must be an asset path or an object with 'asset_path'"), Index);
+            return false;
+        }
+        if (Entry.DestinationFolder.IsEmpty())
+        {
+            Entry.DestinationFolder = DefaultFolder;
+        }
+        if (OutParams.Operation == TEXT("rename") && Entry.NewName.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("assets[%d] needs 'new_name' to rename"), Index);
+            return false;
+        }
+        if (OutParams.Operation == TEXT("move") && Entry.DestinationFolder.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("assets[%d] needs a 'destination_folder' to move to"), Index);
+            return false;
+        }
+        OutParams.Assets.Add(MoveTemp(Entry));
+    }
+
+    JsonObject->TryGetBoolField(TEXT("fixup_redirectors"), OutParams.bFixupRedirectors);
+    return true;
+}
+
+FString FBatchAssetOperationCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -0,0 +1,130 @@
+#include "Commands/Project/BatchCreateDataAssetsCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBatchCreateDataAssetsCommand::FBatchCreateDataAssetsCommand(TSharedPtr<IProjectService> InProjectService)
+    : ProjectService(InProjectService)
+{
+}
+
+bool FBatchCreateDataAssetsCommand::ValidateParams(const FString& Parameters) const
+{
+    FBulkDataAssetParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+FString FBatchCreateDataAssetsCommand::Execute(const FString& Parameters)
+{
+    FBulkDataAssetParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FBulkDataAssetResult Result;
+    if (!ProjectService->CreateDataAssets(Params, Result, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> RowsArray;
+    RowsArray.Reserve(Result.Rows.Num());
+    for (const TSharedPtr<FJsonObject>& Row : Result.Rows)
+    {
+        RowsArray.Add(MakeShared<FJsonValueObject>(Row));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> UnsavedArray;
+    for (const FString& Package : Result.UnsavedPackages)
+    {
+        UnsavedArray.Add(MakeShared<FJsonValueString>(Package));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("asset_class"), Params.AssetClass);
+    ResponseObj->SetArrayField(TEXT("rows"), RowsArray);
+    ResponseObj->SetNumberField(TEXT("created"), Result.CreatedCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Result.FailedCount);
+    ResponseObj->SetNumberField(TEXT("property_errors"), Result.PropertyErrorCount);
+    ResponseObj->SetArrayField(TEXT("unsaved_packages"), UnsavedArray);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FBatchCreateDataAssetsCommand::ParseParameters(const FString& Parameters, FBulkDataAssetParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("asset_class"), OutParams.AssetClass) || OutParams.AssetClass.IsEmpty())
+    {
+        OutError = TEXT("Missing 'asset_class' parameter");
+        return false;
+    }
+
+    FString FolderPath;
+    if (JsonObject->TryGetStringField(TEXT("folder_path"), FolderPath) && !FolderPath.IsEmpty())
+    {
+        OutParams.FolderPath = FolderPath;
+    }
+    JsonObject->TryGetBoolField(TEXT("save"), OutParams.bSave);
+    JsonObject->TryGetBoolField(TEXT("parallel_save"), OutParams.bParallelSave);
+
+    const TArray<TSharedPtr<FJsonValue>>* RowsArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("rows"), RowsArray) || RowsArray->Num() == 0)
+    {
+        OutError = TEXT("Missing 'rows' parameter: a non-empty array of {name, folder_path, properties} objects");
+        return false;
+    }
+
+    OutParams.Rows.Reserve(RowsArray->Num());
+    for (int32 Index = 0; Index < RowsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* RowObj = nullptr;
+        if (!(*RowsArray)[Index].IsValid() || !(*RowsArray)[Index]->TryGetObject(RowObj))
+        {
+            OutError = FString::Printf(TEXT("rows[%d] must be an object"), Index);
+            return false;
+        }
+
+        FBulkDataAssetRow Row;
+        (*RowObj)->TryGetStringField(TEXT("name"), Row.Name);
+        (*RowObj)->TryGetStringField(TEXT("folder_path"), Row.FolderPath);
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if ((*RowObj)->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            Row.Properties = *Properties;
+        }
+        if (Row.Name.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("rows[%d] is missing 'name'"), Index);
+            return false;
+        }
+        OutParams.Rows.Add(MoveTemp(Row));
+    }
+    return true;
+}
+
+FString FBatchCreateDataAssetsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
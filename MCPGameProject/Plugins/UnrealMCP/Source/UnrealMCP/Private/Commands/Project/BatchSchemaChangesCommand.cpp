@@ -0,0 +1,142 @@
+#include "Commands/Project/BatchSchemaChangesCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FBatchSchemaChangesCommand::FBatchSchemaChangesCommand(TSharedPtr<IProjectService> InProjectService)
+    : ProjectService(InProjectService)
+{
+}
+
+bool FBatchSchemaChangesCommand::ValidateParams(const FString& Parameters) const
+{
+    FParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+FString FBatchSchemaChangesCommand::Execute(const FString& Parameters)
+{
+    FParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FString AssetKind;
+    TArray<FSchemaChangeResult> Results;
+    const bool bApplied = ProjectService->ApplySchemaChanges(Params.AssetPath, Params.Changes, AssetKind, Results, Error);
+    if (!bApplied && Results.Num() == 0)
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int32 SucceededCount = 0;
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    ResultsArray.Reserve(Results.Num());
+    for (const FSchemaChangeResult& Result : Results)
+    {
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("operation"), Result.Operation);
+        ResultObj->SetStringField(TEXT("name"), Result.Name);
+        ResultObj->SetBoolField(TEXT("success"), Result.bSuccess);
+        if (!Result.bSuccess)
+        {
+            ResultObj->SetStringField(TEXT("error"), Result.Error);
+        }
+        ResultsArray.Add(MakeShared<FJsonValueObject>(ResultObj));
+        SucceededCount += Result.bSuccess ? 1 : 0;
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetStringField(TEXT("asset_path"), Params.AssetPath);
+    ResponseObj->SetStringField(TEXT("asset_kind"), AssetKind);
+    ResponseObj->SetArrayField(TEXT("results"), ResultsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Results.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Results.Num() - SucceededCount);
+    ResponseObj->SetBoolField(TEXT("success"), bApplied);
+    if (!bApplied)
+    {
+        ResponseObj->SetStringField(TEXT("error"), Error);
+    }
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FBatchSchemaChangesCommand::ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("asset_path"), OutParams.AssetPath) || OutParams.AssetPath.IsEmpty())
+    {
+        OutError = TEXT("Missing 'asset_path' parameter");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ChangesArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("changes"), ChangesArray) || ChangesArray->Num() == 0)
+    {
+        OutError = TEXT("Missing 'changes' parameter: a non-empty array of change objects");
+        return false;
+    }
+
+    for (int32 Index = 0; Index < ChangesArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* ChangeObj = nullptr;
+        if (!(*ChangesArray)[Index].IsValid() || !(*ChangesArray)[Index]->TryGetObject(ChangeObj))
+        {
+            OutError = FString::Printf(TEXT("changes[%d] must be an object"), Index);
+            return false;
+        }
+
+        FSchemaChange Change;
+        (*ChangeObj)->TryGetStringField(TEXT("operation"), Change.Operation);
+        (*ChangeObj)->TryGetStringField(TEXT("name"), Change.Name);
+        (*ChangeObj)->TryGetStringField(TEXT("new_name"), Change.NewName);
+        (*ChangeObj)->TryGetStringField(TEXT("type"), Change.Type);
+        (*ChangeObj)->TryGetStringField(TEXT("description"), Change.Description);
+        Change.Operation.ToLowerInline();
+
+        if (Change.Operation != TEXT("add") && Change.Operation != TEXT("remove") && Change.Operation != TEXT("rename")
+            && Change.Operation != TEXT("set_type") && Change.Operation != TEXT("set_description"))
+        {
+            OutError = FString::Printf(TEXT("changes[%d]: 'operation' must be one of: add, remove, rename, set_type, set_description"), Index);
+            return false;
+        }
+        if (Change.Name.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("changes[%d] needs a 'name'"), Index);
+            return false;
+        }
+        if (Change.Operation == TEXT("rename") && Change.NewName.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("changes[%d] needs 'new_name' to rename"), Index);
+            return false;
+        }
+        OutParams.Changes.Add(MoveTemp(Change));
+    }
+    return true;
+}
+
+FString FBatchSchemaChangesCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -1,22 +1,29 @@
 #include "Commands/Project/CaptureViewportScreenshotCommand.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "MCPViewportCapture.h"
+#include "MCPAttachments.h"
+#include "Async/Async.h"
 #include "LevelEditor.h"
 #include "SLevelViewport.h"
-#include "EditorViewportClient.h"
 #include "Slate/SceneViewport.h"
 #include "UnrealClient.h"
-#include "ImageUtils.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
 
 bool FCaptureViewportScreenshotCommand::ValidateParams(const FString& Parameters) const
 {
-	// No required parameters - output_path is optional
-	return true;
+	// No required parameters, but the image options must be well formed
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		return Parameters.IsEmpty();
+	}
+
+	FMCPImageEncodeOptions Options;
+	FString Error;
+	return FMCPImageEncodeOptions::FromJson(JsonObject, Options, Error);
 }
 
 FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
@@ -26,11 +33,20 @@ FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
 	FJsonSerializer::Deserialize(Reader, JsonObject);
 
-	// Get optional output path
+	// Get optional output path, image options and whether to inline the image
 	FString OutputPath;
+	bool bReturnBase64 = false;
+	FMCPImageEncodeOptions Options;
 	if (JsonObject.IsValid())
 	{
 		JsonObject->TryGetStringField(TEXT("output_path"), OutputPath);
+		JsonObject->TryGetBoolField(TEXT("return_base64"), bReturnBase64);
+
+		FString OptionsError;
+		if (!FMCPImageEncodeOptions::FromJson(JsonObject, Options, OptionsError))
+		{
+			return CreateErrorResponse(OptionsError);
+		}
 	}
 
 	// If no path specified, use default in Saved/Screenshots
@@ -48,126 +64,112 @@ FString FCaptureViewportScreenshotCommand::Execute(const FString& Parameters)
 
 		// Generate timestamped filename
 		FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
-		OutputPath = FPaths::Combine(ScreenshotsDir, FString::Printf(TEXT("Viewport_%s.png"), *Timestamp));
+		OutputPath = FPaths::Combine(ScreenshotsDir, FString::Printf(TEXT("Viewport_%s.%s"), *Timestamp, Options.GetExtension()));
 	}
 
 	// Make sure path is absolute
 	OutputPath = FPaths::ConvertRelativePathToFull(OutputPath);
 
-	// Get the level editor module
-	FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
-
-	// Get the first level editor viewport
-	TSharedPtr<IAssetViewport> ActiveViewport = LevelEditorModule.GetFirstActiveViewport();
-
-	if (!ActiveViewport.IsValid())
+	FMCPViewportCaptureResult Result;
+	if (IsInGameThread())
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No active viewport found"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		// Nothing would tick the readback while this thread waits for it
+		FString Error;
+		FViewport* Viewport = FindActiveViewport(Error);
+		if (!Viewport)
+		{
+			return CreateErrorResponse(Error);
+		}
+		Result = FMCPViewportCapture::CaptureToFileBlocking(Viewport, OutputPath, Options);
 	}
-
-	// Get the scene viewport (which is an FViewport)
-	FViewport* Viewport = ActiveViewport->GetSharedActiveViewport().Get();
-	if (!Viewport)
+	else
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Could not access scene viewport"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		TSharedRef<TPromise<FMCPViewportCaptureResult>> Promise = MakeShared<TPromise<FMCPViewportCaptureResult>>();
+		TFuture<FMCPViewportCaptureResult> Future = Promise->GetFuture();
+		AsyncTask(ENamedThreads::GameThread, [Promise, OutputPath, Options]()
+		{
+			FMCPViewportCaptureResult LookupResult;
+			FViewport* Viewport = FindActiveViewport(LookupResult.Error);
+			if (!Viewport)
+			{
+				Promise->SetValue(LookupResult);
+				return;
+			}
+			FMCPViewportCapture::CaptureToFile(Viewport, OutputPath, Options, [Promise](const FMCPViewportCaptureResult& CaptureResult)
+			{
+				Promise->SetValue(CaptureResult);
+			});
+		});
+
+		if (!Future.WaitFor(FTimespan::FromSeconds(CaptureTimeoutSeconds)))
+		{
+			return CreateErrorResponse(TEXT("Timed out waiting for the viewport capture"));
+		}
+		Result = Future.Get();
 	}
 
-	// Get viewport size
-	FIntPoint ViewportSize = Viewport->GetSizeXY();
-	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+	if (!Result.bSuccess)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Invalid viewport size"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		return CreateErrorResponse(Result.Error);
 	}
 
-	// Use UE's proper screenshot function - this handles all the render target magic correctly
-	TArray<FColor> Bitmap;
-	if (!GetViewportScreenShot(Viewport, Bitmap))
+	// Create success response
+	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
+	ResponseData->SetBoolField(TEXT("success"), true);
+	ResponseData->SetStringField(TEXT("file_path"), OutputPath);
+	ResponseData->SetNumberField(TEXT("width"), Result.Size.X);
+	ResponseData->SetNumberField(TEXT("height"), Result.Size.Y);
+	ResponseData->SetStringField(TEXT("format"), Options.GetExtension());
+	ResponseData->SetNumberField(TEXT("image_size_bytes"), static_cast<double>(Result.EncodedData.Num()));
+	if (bReturnBase64)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to capture viewport screenshot"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		// Sent as raw bytes to clients that read attachments, as base64 to the rest
+		ResponseData->SetField(TEXT("image_base64"), FMCPAttachments::MakeReference(MoveTemp(Result.EncodedData)));
 	}
+	ResponseData->SetStringField(TEXT("message"), FString::Printf(TEXT("Screenshot saved to: %s"), *OutputPath));
 
-	// Compress to PNG
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-
-	if (!ImageWrapper.IsValid())
-	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create image wrapper"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
-	}
+	// Convert response to JSON string; condensed, the form attachment references are found in
+	FString OutputString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
+	FJsonSerializer::Serialize(ResponseData.ToSharedRef(), Writer);
+	return OutputString;
+}
 
-	// Convert FColor array to raw bytes with forced opaque alpha
-	TArray<uint8> RawData;
-	RawData.SetNum(Bitmap.Num() * 4);
-	for (int32 i = 0; i < Bitmap.Num(); i++)
-	{
-		RawData[i * 4 + 0] = Bitmap[i].B;
-		RawData[i * 4 + 1] = Bitmap[i].G;
-		RawData[i * 4 + 2] = Bitmap[i].R;
-		RawData[i * 4 + 3] = 255;  // Force fully opaque
-	}
+FViewport* FCaptureViewportScreenshotCommand::FindActiveViewport(FString& OutError)
+{
+	check(IsInGameThread());
 
-	if (!ImageWrapper->SetRaw(RawData.GetData(), RawData.Num(), ViewportSize.X, ViewportSize.Y, ERGBFormat::BGRA, 8))
+	// Get the first level editor viewport
+	FLevelEditorModule& LevelEditorModule = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
+	TSharedPtr<IAssetViewport> ActiveViewport = LevelEditorModule.GetFirstActiveViewport();
+	if (!ActiveViewport.IsValid())
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to set raw image data"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("No active viewport found");
+		return nullptr;
 	}
 
-	// Get compressed PNG data
-	TArray64<uint8> CompressedData = ImageWrapper->GetCompressed(100);
-	if (CompressedData.Num() == 0)
+	// Get the scene viewport (which is an FViewport)
+	FViewport* Viewport = ActiveViewport->GetSharedActiveViewport().Get();
+	if (!Viewport)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to compress image to PNG"));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("Could not access scene viewport");
+		return nullptr;
 	}
 
-	// Save to file
-	if (!FFileHelper::SaveArrayToFile(CompressedData, *OutputPath))
+	const FIntPoint ViewportSize = Viewport->GetSizeXY();
+	if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
 	{
-		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(
-			FString::Printf(TEXT("Failed to save screenshot to: %s"), *OutputPath));
-		FString OutputString;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
-		return OutputString;
+		OutError = TEXT("Invalid viewport size");
+		return nullptr;
 	}
+	return Viewport;
+}
 
-	// Create success response
-	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
-	ResponseData->SetBoolField(TEXT("success"), true);
-	ResponseData->SetStringField(TEXT("file_path"), OutputPath);
-	ResponseData->SetNumberField(TEXT("width"), ViewportSize.X);
-	ResponseData->SetNumberField(TEXT("height"), ViewportSize.Y);
-	ResponseData->SetStringField(TEXT("message"), FString::Printf(TEXT("Screenshot saved to: %s"), *OutputPath));
-
-	// Convert response to JSON string
+FString FCaptureViewportScreenshotCommand::CreateErrorResponse(const FString& ErrorMessage)
+{
+	TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(ErrorMessage);
 	FString OutputString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(ResponseData.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
 	return OutputString;
 }
@@ -0,0 +1,185 @@
+#include "Commands/Project/CreateInputSetupCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    void ReadInstanceSpecs(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName, TArray<TSharedPtr<FJsonValue>>& OutSpecs)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Specs = nullptr;
+        if (Object->TryGetArrayField(FieldName, Specs))
+        {
+            OutSpecs = *Specs;
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonArray(const TArray<TSharedPtr<FJsonObject>>& Objects)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Objects.Num());
+        for (const TSharedPtr<FJsonObject>& Object : Objects)
+        {
+            Values.Add(MakeShared<FJsonValueObject>(Object));
+        }
+        return Values;
+    }
+}
+
+FCreateInputSetupCommand::FCreateInputSetupCommand(TSharedPtr<IProjectService> InProjectService)
+    : ProjectService(InProjectService)
+{
+}
+
+bool FCreateInputSetupCommand::ValidateParams(const FString& Parameters) const
+{
+    FInputSetupParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+FString FCreateInputSetupCommand::Execute(const FString& Parameters)
+{
+    FInputSetupParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    FInputSetupResult Result;
+    if (!ProjectService->CreateInputSetup(Params, Result, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> UnsavedArray;
+    for (const FString& Package : Result.UnsavedPackages)
+    {
+        UnsavedArray.Add(MakeShared<FJsonValueString>(Package));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("actions"), ToJsonArray(Result.Actions));
+    ResponseObj->SetArrayField(TEXT("contexts"), ToJsonArray(Result.Contexts));
+    ResponseObj->SetNumberField(TEXT("created"), Result.CreatedCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Result.FailedCount);
+    ResponseObj->SetNumberField(TEXT("mappings_added"), Result.MappingCount);
+    ResponseObj->SetArrayField(TEXT("unsaved_packages"), UnsavedArray);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FCreateInputSetupCommand::ParseParameters(const FString& Parameters, FInputSetupParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("action_path"), OutParams.ActionPath);
+    JsonObject->TryGetStringField(TEXT("context_path"), OutParams.ContextPath);
+    JsonObject->TryGetBoolField(TEXT("save"), OutParams.bSave);
+
+    const TArray<TSharedPtr<FJsonValue>>* ActionsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("actions"), ActionsArray))
+    {
+        for (int32 Index = 0; Index < ActionsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* ActionObj = nullptr;
+            if (!(*ActionsArray)[Index].IsValid() || !(*ActionsArray)[Index]->TryGetObject(ActionObj))
+            {
+                OutError = FString::Printf(TEXT("actions[%d] must be an object"), Index);
+                return false;
+            }
+
+            FInputSetupAction Action;
+            (*ActionObj)->TryGetStringField(TEXT("name"), Action.Name);
+            (*ActionObj)->TryGetStringField(TEXT("path"), Action.Path);
+            (*ActionObj)->TryGetStringField(TEXT("value_type"), Action.ValueType);
+            (*ActionObj)->TryGetStringField(TEXT("description"), Action.Description);
+            ReadInstanceSpecs(*ActionObj, TEXT("modifiers"), Action.Modifiers);
+            ReadInstanceSpecs(*ActionObj, TEXT("triggers"), Action.Triggers);
+            if (Action.Name.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("actions[%d] is missing 'name'"), Index);
+                return false;
+            }
+            OutParams.Actions.Add(MoveTemp(Action));
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ContextsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("contexts"), ContextsArray))
+    {
+        for (int32 Index = 0; Index < ContextsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* ContextObj = nullptr;
+            if (!(*ContextsArray)[Index].IsValid() || !(*ContextsArray)[Index]->TryGetObject(ContextObj))
+            {
+                OutError = FString::Printf(TEXT("contexts[%d] must be an object"), Index);
+                return false;
+            }
+
+            FInputSetupContext Context;
+            (*ContextObj)->TryGetStringField(TEXT("name"), Context.Name);
+            (*ContextObj)->TryGetStringField(TEXT("path"), Context.Path);
+            (*ContextObj)->TryGetStringField(TEXT("description"), Context.Description);
+            if (Context.Name.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("contexts[%d] is missing 'name'"), Index);
+                return false;
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* MappingsArray = nullptr;
+            if ((*ContextObj)->TryGetArrayField(TEXT("mappings"), MappingsArray))
+            {
+                for (int32 MappingIndex = 0; MappingIndex < MappingsArray->Num(); ++MappingIndex)
+                {
+                    const TSharedPtr<FJsonObject>* MappingObj = nullptr;
+                    FInputSetupMapping Mapping;
+                    if ((*MappingsArray)[MappingIndex].IsValid() && (*MappingsArray)[MappingIndex]->TryGetObject(MappingObj))
+                    {
+                        (*MappingObj)->TryGetStringField(TEXT("action"), Mapping.Action);
+                        (*MappingObj)->TryGetStringField(TEXT("key"), Mapping.Key);
+                        ReadInstanceSpecs(*MappingObj, TEXT("modifiers"), Mapping.Modifiers);
+                        ReadInstanceSpecs(*MappingObj, TEXT("triggers"), Mapping.Triggers);
+                    }
+                    if (Mapping.Action.IsEmpty() || Mapping.Key.IsEmpty())
+                    {
+                        OutError = FString::Printf(TEXT("contexts[%d].mappings[%d] needs 'action' and 'key'"), Index, MappingIndex);
+                        return false;
+                    }
+                    Context.Mappings.Add(MoveTemp(Mapping));
+                }
+            }
+            OutParams.Contexts.Add(MoveTemp(Context));
+        }
+    }
+
+    if (OutParams.Actions.Num() == 0 && OutParams.Contexts.Num() == 0)
+    {
+        OutError = TEXT("Missing 'actions' or 'contexts': the setup must create at least one asset");
+        return false;
+    }
+    return true;
+}
+
+FString FCreateInputSetupCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -1,5 +1,6 @@
 #include "Commands/Project/SearchAssetsCommand.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/AssetSearchIndex.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Texture2D.h"
 #include "Materials/Material.h"
@@ -53,7 +54,7 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 	if (!ValidateParams(Parameters))
 	{
 		TSharedPtr<FJsonObject> ErrorResponse = FUnrealMCPCommonUtils::CreateErrorResponse(
-			TEXT("At least one parameter required. Accepts: search_query/pattern (string), asset_type/asset_class (string), path/folder (string), max_results (int). Valid asset_type values: Texture, Material, MaterialInstance, StaticMesh, SkeletalMesh, Sound, Blueprint, WidgetBlueprint, DataTable, Animation, NiagaraSystem"));
+			TEXT("At least one parameter required. Accepts: search_query/pattern (string), asset_type/asset_class (string), path/folder (string), max_results (int), offset (int). Valid asset_type values: Texture, Material, MaterialInstance, StaticMesh, SkeletalMesh, Sound, Blueprint, WidgetBlueprint, DataTable, Animation, NiagaraSystem"));
 		FString OutputString;
 		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
 		FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
@@ -66,6 +67,8 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 	{
 		JsonObject->TryGetStringField(TEXT("pattern"), SearchQuery);
 	}
+	// Names are matched by fragment; wildcards from glob-style patterns add nothing
+	SearchQuery.ReplaceInline(TEXT("*"), TEXT(""));
 
 	FString AssetType;
 	if (!JsonObject->TryGetStringField(TEXT("asset_type"), AssetType))
@@ -83,15 +86,11 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 	JsonObject->TryGetNumberField(TEXT("max_results"), MaxResults);
 	MaxResults = FMath::Clamp(MaxResults, 1, 500);
 
-	// Get asset registry
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	int32 Offset = 0;
+	JsonObject->TryGetNumberField(TEXT("offset"), Offset);
+	Offset = FMath::Max(Offset, 0);
 
-	// Build filter
-	FARFilter Filter;
-	Filter.PackagePaths.Add(FName(*SearchPath));
-	Filter.bRecursivePaths = true;
-	Filter.bRecursiveClasses = true;
+	TArray<FTopLevelAssetPath> ClassPaths;
 
 	// Add class filter if asset_type specified
 	if (!AssetType.IsEmpty())
@@ -156,7 +155,7 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 
 		if (FilterClass)
 		{
-			Filter.ClassPaths.Add(FilterClass->GetClassPathName());
+			ClassPaths.Add(FilterClass->GetClassPathName());
 		}
 		else
 		{
@@ -170,42 +169,73 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 			}
 			if (FoundClass)
 			{
-				Filter.ClassPaths.Add(FoundClass->GetClassPathName());
+				ClassPaths.Add(FoundClass->GetClassPathName());
 			}
 		}
 	}
 
-	// Query asset registry
-	TArray<FAssetData> AssetDataList;
-	AssetRegistry.GetAssets(Filter, AssetDataList);
-
-	// Filter by name and build results
 	TArray<TSharedPtr<FJsonValue>> AssetsArray;
-	int32 MatchCount = 0;
+	auto AddAssetInfo = [&AssetsArray](const FString& Name, const FString& ObjectPath, const FString& PackagePath, const FString& ClassName)
+	{
+		TSharedPtr<FJsonObject> AssetInfo = MakeShared<FJsonObject>();
+		AssetInfo->SetStringField(TEXT("name"), Name);
+		AssetInfo->SetStringField(TEXT("path"), ObjectPath);
+		AssetInfo->SetStringField(TEXT("package_path"), PackagePath);
+		AssetInfo->SetStringField(TEXT("class_name"), ClassName);
+		AssetsArray.Add(MakeShared<FJsonValueObject>(AssetInfo));
+	};
+
+	// The name index answers for /Game once built; otherwise scan the asset registry
+	FAssetSearchIndex::FQuery Query;
+	Query.NameFilter = SearchQuery;
+	Query.ClassPaths = ClassPaths;
+	Query.PackagePath = SearchPath;
+	Query.Offset = Offset;
+	Query.Limit = MaxResults;
 
-	for (const FAssetData& AssetData : AssetDataList)
+	TArray<FAssetSearchIndex::FEntry> Matches;
+	int32 TotalMatches = 0;
+	int32 TotalScanned = INDEX_NONE;
+	if (FAssetSearchIndex::Get().Search(Query, Matches, TotalMatches))
 	{
-		if (MatchCount >= MaxResults)
+		for (const FAssetSearchIndex::FEntry& Match : Matches)
 		{
-			break;
+			AddAssetInfo(Match.AssetName.ToString(), Match.ObjectPath.ToString(), Match.PackagePath.ToString(), Match.ClassPath.GetAssetName().ToString());
 		}
+	}
+	else
+	{
+		// This runs off the game thread, where modules must not be loaded
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+		FARFilter Filter;
+		Filter.PackagePaths.Add(FName(*SearchPath));
+		Filter.bRecursivePaths = true;
+		Filter.bRecursiveClasses = true;
+		Filter.ClassPaths = ClassPaths;
 
-		FString AssetName = AssetData.AssetName.ToString();
+		TArray<FAssetData> AssetDataList;
+		AssetRegistry.GetAssets(Filter, AssetDataList);
+		TotalScanned = AssetDataList.Num();
 
-		// Case-insensitive name match (contains)
-		if (AssetName.Contains(SearchQuery, ESearchCase::IgnoreCase))
+		for (const FAssetData& AssetData : AssetDataList)
 		{
-			TSharedPtr<FJsonObject> AssetInfo = MakeShared<FJsonObject>();
-			AssetInfo->SetStringField(TEXT("name"), AssetName);
-			AssetInfo->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
-			AssetInfo->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
-			AssetInfo->SetStringField(TEXT("class_name"), AssetData.AssetClassPath.GetAssetName().ToString());
-
-			AssetsArray.Add(MakeShared<FJsonValueObject>(AssetInfo));
-			MatchCount++;
+			FString AssetName = AssetData.AssetName.ToString();
+
+			// Case-insensitive name match (contains)
+			if (AssetName.Contains(SearchQuery, ESearchCase::IgnoreCase))
+			{
+				if (TotalMatches >= Offset && AssetsArray.Num() < MaxResults)
+				{
+					AddAssetInfo(AssetName, AssetData.GetObjectPathString(), AssetData.PackagePath.ToString(), AssetData.AssetClassPath.GetAssetName().ToString());
+				}
+				TotalMatches++;
+			}
 		}
 	}
 
+	const bool bHasMore = Offset + AssetsArray.Num() < TotalMatches;
+
 	// Create success response
 	TSharedPtr<FJsonObject> ResponseData = MakeShared<FJsonObject>();
 	ResponseData->SetBoolField(TEXT("success"), true);
@@ -213,12 +243,18 @@ FString FSearchAssetsCommand::Execute(const FString& Parameters)
 	ResponseData->SetStringField(TEXT("asset_type"), AssetType.IsEmpty() ? TEXT("all") : AssetType);
 	ResponseData->SetStringField(TEXT("path"), SearchPath);
 	ResponseData->SetNumberField(TEXT("count"), AssetsArray.Num());
-	ResponseData->SetNumberField(TEXT("total_scanned"), AssetDataList.Num());
+	ResponseData->SetNumberField(TEXT("total_matches"), TotalMatches);
+	ResponseData->SetNumberField(TEXT("offset"), Offset);
+	ResponseData->SetBoolField(TEXT("has_more"), bHasMore);
+	if (TotalScanned != INDEX_NONE)
+	{
+		ResponseData->SetNumberField(TEXT("total_scanned"), TotalScanned);
+	}
 	ResponseData->SetArrayField(TEXT("assets"), AssetsArray);
 
-	if (AssetsArray.Num() >= MaxResults)
+	if (bHasMore)
 	{
-		ResponseData->SetStringField(TEXT("note"), FString::Printf(TEXT("Results limited to %d. Use more specific query or increase max_results."), MaxResults));
+		ResponseData->SetStringField(TEXT("note"), FString::Printf(TEXT("Showing %d of %d matches. Repeat with offset=%d for the next page, or use a more specific query."), AssetsArray.Num(), TotalMatches, Offset + AssetsArray.Num()));
 	}
 
 	// Convert response to JSON string
@@ -0,0 +1,231 @@
+#include "Commands/Project/SetPropertyOnObjectsCommand.h"
+#include "Services/PropertyService.h"
+#include "Services/ComponentService.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+#include "Engine/Blueprint.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+bool FSetPropertyOnObjectsCommand::ValidateParams(const FString& Parameters) const
+{
+    FParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+FString FSetPropertyOnObjectsCommand::Execute(const FString& Parameters)
+{
+    FParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    /** One requested object, in request order: assets first, then components */
+    struct FTarget
+    {
+        FString Kind;
+        FString Name;
+        UObject* Object = nullptr;
+        /** Blueprint owning a component template */
+        UBlueprint* Blueprint = nullptr;
+        FString Error;
+    };
+
+    TArray<FTarget> Targets;
+    Targets.Reserve(Params.AssetPaths.Num() + Params.Components.Num());
+
+    int32 SucceededCount = 0;
+    {
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Set %s on %d objects"),
+            *Params.PropertyName, Params.AssetPaths.Num() + Params.Components.Num())));
+
+        for (const FString& AssetPath : Params.AssetPaths)
+        {
+            FTarget& Target = Targets.AddDefaulted_GetRef();
+            Target.Kind = TEXT("asset");
+            Target.Name = AssetPath;
+
+            // "/Game/Data/DA_Goblin" names the asset "/Game/Data/DA_Goblin.DA_Goblin"
+            const FString ObjectPath = AssetPath.Contains(TEXT("."))
+                ? AssetPath
+                : AssetPath + TEXT(".") + FPaths::GetBaseFilename(AssetPath);
+            Target.Object = LoadObject<UObject>(nullptr, *ObjectPath);
+            if (!Target.Object)
+            {
+                Target.Error = FString::Printf(TEXT("Failed to load asset: %s"), *AssetPath);
+            }
+        }
+
+        TMap<FString, UBlueprint*> Blueprints;
+        for (const FComponentTarget& Component : Params.Components)
+        {
+            FTarget& Target = Targets.AddDefaulted_GetRef();
+            Target.Kind = TEXT("component");
+            Target.Name = FString::Printf(TEXT("%s.%s"), *Component.BlueprintName, *Component.ComponentName);
+
+            UBlueprint** FoundBlueprint = Blueprints.Find(Component.BlueprintName);
+            Target.Blueprint = FoundBlueprint
+                ? *FoundBlueprint
+                : Blueprints.Add(Component.BlueprintName, FUnrealMCPCommonUtils::FindBlueprint(Component.BlueprintName));
+            if (!Target.Blueprint)
+            {
+                Target.Error = FString::Printf(TEXT("Blueprint not found: %s"), *Component.BlueprintName);
+                continue;
+            }
+
+            Target.Object = FComponentService::Get().FindComponentInBlueprint(Target.Blueprint, Component.ComponentName);
+            if (!Target.Object)
+            {
+                Target.Error = FString::Printf(TEXT("Component not found: %s"), *Component.ComponentName);
+            }
+        }
+
+        TArray<UObject*> Objects;
+        TArray<int32> ObjectTargets;
+        for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+        {
+            if (Targets[TargetIndex].Object)
+            {
+                Objects.Add(Targets[TargetIndex].Object);
+                ObjectTargets.Add(TargetIndex);
+            }
+        }
+
+        TArray<FString> Errors;
+        FPropertyService::Get().SetPropertyOnObjects(Objects, Params.PropertyName, Params.PropertyValue, Errors);
+
+        for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+        {
+            FTarget& Target = Targets[ObjectTargets[ObjectIndex]];
+            if (!Errors[ObjectIndex].IsEmpty())
+            {
+                Target.Error = Errors[ObjectIndex];
+                continue;
+            }
+
+            ++SucceededCount;
+            // Deferred to once per blueprint and once per package by the scope
+            UObject* Asset = Target.Object;
+            if (Target.Blueprint)
+            {
+                FMCPBatchEditScope::MarkBlueprintAsModified(Target.Blueprint);
+                Asset = Target.Blueprint;
+            }
+            if (!Params.bSave || !FMCPSaveQueue::Get().Enqueue(Asset))
+            {
+                Asset->MarkPackageDirty();
+            }
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> TargetsArray;
+    TargetsArray.Reserve(Targets.Num());
+    for (const FTarget& Target : Targets)
+    {
+        TSharedPtr<FJsonObject> TargetObj = MakeShared<FJsonObject>();
+        TargetObj->SetStringField(TEXT("kind"), Target.Kind);
+        TargetObj->SetStringField(TEXT("name"), Target.Name);
+        TargetObj->SetBoolField(TEXT("success"), Target.Error.IsEmpty());
+        if (!Target.Error.IsEmpty())
+        {
+            TargetObj->SetStringField(TEXT("error"), Target.Error);
+        }
+        TargetsArray.Add(MakeShared<FJsonValueObject>(TargetObj));
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetArrayField(TEXT("targets"), TargetsArray);
+    ResponseObj->SetNumberField(TEXT("total"), Targets.Num());
+    ResponseObj->SetNumberField(TEXT("succeeded"), SucceededCount);
+    ResponseObj->SetNumberField(TEXT("failed"), Targets.Num() - SucceededCount);
+    ResponseObj->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+bool FSetPropertyOnObjectsCommand::ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    if (!JsonObject->TryGetStringField(TEXT("property_name"), OutParams.PropertyName) || OutParams.PropertyName.IsEmpty())
+    {
+        OutError = TEXT("Missing 'property_name' parameter");
+        return false;
+    }
+
+    OutParams.PropertyValue = JsonObject->TryGetField(TEXT("property_value"));
+    if (!OutParams.PropertyValue.IsValid())
+    {
+        OutError = TEXT("Missing 'property_value' parameter");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* AssetPathsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("asset_paths"), AssetPathsArray))
+    {
+        for (int32 Index = 0; Index < AssetPathsArray->Num(); ++Index)
+        {
+            FString AssetPath;
+            if (!(*AssetPathsArray)[Index].IsValid() || !(*AssetPathsArray)[Index]->TryGetString(AssetPath) || AssetPath.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("asset_paths[%d] must be a non-empty string"), Index);
+                return false;
+            }
+            OutParams.AssetPaths.Add(AssetPath);
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ComponentsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("components"), ComponentsArray))
+    {
+        for (int32 Index = 0; Index < ComponentsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* ComponentObj = nullptr;
+            FComponentTarget Component;
+            if (!(*ComponentsArray)[Index].IsValid() || !(*ComponentsArray)[Index]->TryGetObject(ComponentObj)
+                || !(*ComponentObj)->TryGetStringField(TEXT("blueprint_name"), Component.BlueprintName) || Component.BlueprintName.IsEmpty()
+                || !(*ComponentObj)->TryGetStringField(TEXT("component_name"), Component.ComponentName) || Component.ComponentName.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("components[%d] must be an object with 'blueprint_name' and 'component_name'"), Index);
+                return false;
+            }
+            OutParams.Components.Add(MoveTemp(Component));
+        }
+    }
+
+    if (OutParams.AssetPaths.Num() == 0 && OutParams.Components.Num() == 0)
+    {
+        OutError = TEXT("No targets given: pass 'asset_paths' and/or 'components'");
+        return false;
+    }
+
+    JsonObject->TryGetBoolField(TEXT("save"), OutParams.bSave);
+    return true;
+}
+
+FString FSetPropertyOnObjectsCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+    ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+    ErrorObj->SetBoolField(TEXT("success"), false);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ErrorObj.ToSharedRef(), Writer);
+    return OutputString;
+}
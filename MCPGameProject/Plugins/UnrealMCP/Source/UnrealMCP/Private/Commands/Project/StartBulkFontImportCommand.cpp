@@ -0,0 +1,113 @@
+#include "Commands/Project/StartBulkFontImportCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FStartBulkFontImportCommand::FStartBulkFontImportCommand(TSharedPtr<IProjectService> InProjectService)
+    : ProjectService(InProjectService)
+{
+}
+
+FString FStartBulkFontImportCommand::Execute(const FString& Parameters)
+{
+    FBulkFontImportParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int64 JobId = 0;
+    int32 FontCount = 0;
+    if (!ProjectService->StartBulkFontImport(Params, JobId, FontCount, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    ResponseObj->SetNumberField(TEXT("fonts_total"), FontCount);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Creating %d font(s); read the progress with get_bulk_font_import"), FontCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FStartBulkFontImportCommand::GetCommandName() const
+{
+    return TEXT("start_bulk_font_import");
+}
+
+bool FStartBulkFontImportCommand::ValidateParams(const FString& Parameters) const
+{
+    FBulkFontImportParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FStartBulkFontImportCommand::ParseParameters(const FString& JsonString, FBulkFontImportParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> ParamsObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+    {
+        OutError = TEXT("Failed to parse parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* FontsArray = nullptr;
+    if (ParamsObj->TryGetArrayField(TEXT("fonts"), FontsArray) && FontsArray)
+    {
+        for (int32 Index = 0; Index < FontsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* FontObj = nullptr;
+            if (!(*FontsArray)[Index].IsValid() || !(*FontsArray)[Index]->TryGetObject(FontObj))
+            {
+                OutError = FString::Printf(TEXT("fonts[%d] must be an object"), Index);
+                return false;
+            }
+
+            // Same fields as create_font; "offline" is the only atlas-based source kept in bulk
+            FBulkFontImportEntry& Font = OutParams.Fonts.AddDefaulted_GetRef();
+            (*FontObj)->TryGetStringField(TEXT("font_name"), Font.FontName);
+            Font.SourceType = TEXT("ttf");
+            (*FontObj)->TryGetStringField(TEXT("source_type"), Font.SourceType);
+            (*FontObj)->TryGetStringField(TEXT("path"), Font.Path);
+            (*FontObj)->TryGetStringField(TEXT("ttf_file_path"), Font.TTFFilePath);
+            (*FontObj)->TryGetStringField(TEXT("atlas_texture"), Font.AtlasTexturePath);
+            (*FontObj)->TryGetStringField(TEXT("metrics_file"), Font.MetricsFilePath);
+
+            const TSharedPtr<FJsonObject>* MetricsObj = nullptr;
+            if ((*FontObj)->TryGetObjectField(TEXT("font_metrics"), MetricsObj))
+            {
+                Font.FontMetrics = *MetricsObj;
+            }
+        }
+    }
+
+    ParamsObj->TryGetStringField(TEXT("path"), OutParams.Path);
+    if (OutParams.Path.IsEmpty())
+    {
+        OutParams.Path = TEXT("/Game/Fonts");
+    }
+    ParamsObj->TryGetBoolField(TEXT("save"), OutParams.bSave);
+    ParamsObj->TryGetNumberField(TEXT("max_in_flight"), OutParams.MaxInFlight);
+
+    return OutParams.IsValid(OutError);
+}
+
+FString FStartBulkFontImportCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -9,6 +9,7 @@
 #include "Commands/Project/CreateEnhancedInputActionCommand.h"
 #include "Commands/Project/CreateInputMappingContextCommand.h"
 #include "Commands/Project/AddMappingToContextCommand.h"
+#include "Commands/Project/CreateInputSetupCommand.h"
 #include "Commands/Project/UpdateStructCommand.h"
 #include "Commands/Project/GetProjectMetadataCommand.h"
 #include "Commands/Project/GetStructPinNamesCommand.h"
@@ -20,11 +21,17 @@
 #include "Commands/Project/CreateOfflineFontCommand.h"
 #include "Commands/Project/GetFontMetadataCommand.h"
 #include "Commands/Project/CreateFontCommand.h"
+#include "Commands/Project/StartBulkFontImportCommand.h"
+#include "Commands/Project/GetBulkFontImportCommand.h"
 #include "Commands/Project/CreateDataAssetCommand.h"
 #include "Commands/Project/SetDataAssetPropertyCommand.h"
 #include "Commands/Project/GetDataAssetMetadataCommand.h"
+#include "Commands/Project/BatchCreateDataAssetsCommand.h"
+#include "Commands/Project/SetPropertyOnObjectsCommand.h"
 #include "Commands/Project/RenameAssetCommand.h"
 #include "Commands/Project/MoveAssetCommand.h"
+#include "Commands/Project/BatchAssetOperationCommand.h"
+#include "Commands/Project/BatchSchemaChangesCommand.h"
 #include "Commands/Project/SearchAssetsCommand.h"
 #include "Commands/Project/CaptureViewportScreenshotCommand.h"
 #include "Services/IProjectService.h"
@@ -38,63 +45,76 @@ void FProjectCommandRegistration::RegisterCommands(FUnrealMCPCommandRegistry& Re
     }
 
     // Register input mapping command
-    Registry.RegisterCommand(MakeShared<FCreateInputMappingCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_input_mapping"), [ProjectService]() { return MakeShared<FCreateInputMappingCommand>(ProjectService); });
     
     // Register folder command
-    Registry.RegisterCommand(MakeShared<FCreateFolderCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_folder"), [ProjectService]() { return MakeShared<FCreateFolderCommand>(ProjectService); });
     
     // Register struct command
-    Registry.RegisterCommand(MakeShared<FCreateStructCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_struct"), [ProjectService]() { return MakeShared<FCreateStructCommand>(ProjectService); });
 
     // Register enum command
-    Registry.RegisterCommand(MakeShared<FUpdateEnumCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FCreateEnumCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("update_enum"), [ProjectService]() { return MakeShared<FUpdateEnumCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("create_enum"), [ProjectService]() { return MakeShared<FCreateEnumCommand>(ProjectService); });
 
     // Register get project directory command
-    Registry.RegisterCommand(MakeShared<FGetProjectDirCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("get_project_dir"), [ProjectService]() { return MakeShared<FGetProjectDirCommand>(ProjectService); });
     
     // Register Enhanced Input commands
-    Registry.RegisterCommand(MakeShared<FCreateEnhancedInputActionCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FCreateInputMappingContextCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FAddMappingToContextCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_enhanced_input_action"), [ProjectService]() { return MakeShared<FCreateEnhancedInputActionCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("create_input_mapping_context"), [ProjectService]() { return MakeShared<FCreateInputMappingContextCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("add_mapping_to_context"), [ProjectService]() { return MakeShared<FAddMappingToContextCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("create_input_setup"), [ProjectService]() { return MakeShared<FCreateInputSetupCommand>(ProjectService); });
 
     // Register struct commands
-    Registry.RegisterCommand(MakeShared<FUpdateStructCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("update_struct"), [ProjectService]() { return MakeShared<FUpdateStructCommand>(ProjectService); });
 
     // Register consolidated metadata command (replaces list_input_actions, list_input_mapping_contexts, show_struct_variables, list_folder_contents)
-    Registry.RegisterCommand(MakeShared<FGetProjectMetadataCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("get_project_metadata"), [ProjectService]() { return MakeShared<FGetProjectMetadataCommand>(ProjectService); });
 
     // Register struct pin names command for discovering struct field/pin names
-    Registry.RegisterCommand(MakeShared<FGetStructPinNamesCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("get_struct_pin_names"), [ProjectService]() { return MakeShared<FGetStructPinNamesCommand>(ProjectService); });
 
     // Register asset management commands
-    Registry.RegisterCommand(MakeShared<FDuplicateAssetCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FDeleteAssetCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("duplicate_asset"), [ProjectService]() { return MakeShared<FDuplicateAssetCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("delete_asset"), [ProjectService]() { return MakeShared<FDeleteAssetCommand>(ProjectService); });
 
     // Register viewport screenshot command
-    Registry.RegisterCommand(MakeShared<FCaptureViewportScreenshotCommand>());
+    Registry.RegisterLazyCommand(TEXT("capture_viewport_screenshot"), []() { return MakeShared<FCaptureViewportScreenshotCommand>(); });
 
     // Register unified font command (recommended - consolidates all font creation methods)
-    Registry.RegisterCommand(MakeShared<FCreateFontCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_font"), [ProjectService]() { return MakeShared<FCreateFontCommand>(ProjectService); });
 
     // Register legacy font face commands (TTF-based) - kept for backwards compatibility
-    Registry.RegisterCommand(MakeShared<FCreateFontFaceCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FSetFontFacePropertiesCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FGetFontFaceMetadataCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_font_face"), [ProjectService]() { return MakeShared<FCreateFontFaceCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("set_font_face_properties"), [ProjectService]() { return MakeShared<FSetFontFacePropertiesCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("get_font_face_metadata"), [ProjectService]() { return MakeShared<FGetFontFaceMetadataCommand>(ProjectService); });
 
     // Register legacy offline font commands (SDF atlas-based) - kept for backwards compatibility
-    Registry.RegisterCommand(MakeShared<FCreateOfflineFontCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FGetFontMetadataCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_offline_font"), [ProjectService]() { return MakeShared<FCreateOfflineFontCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("get_font_metadata"), [ProjectService]() { return MakeShared<FGetFontMetadataCommand>(ProjectService); });
+
+    // Register bulk font import commands (many fonts per run, files read on worker threads)
+    Registry.RegisterLazyCommand(TEXT("start_bulk_font_import"), [ProjectService]() { return MakeShared<FStartBulkFontImportCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("get_bulk_font_import"), [ProjectService]() { return MakeShared<FGetBulkFontImportCommand>(ProjectService); });
 
     // Register DataAsset commands
-    Registry.RegisterCommand(MakeShared<FCreateDataAssetCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FSetDataAssetPropertyCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FGetDataAssetMetadataCommand>(ProjectService));
+    Registry.RegisterLazyCommand(TEXT("create_data_asset"), [ProjectService]() { return MakeShared<FCreateDataAssetCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("set_data_asset_property"), [ProjectService]() { return MakeShared<FSetDataAssetPropertyCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("get_data_asset_metadata"), [ProjectService]() { return MakeShared<FGetDataAssetMetadataCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("batch_create_data_assets"), [ProjectService]() { return MakeShared<FBatchCreateDataAssetsCommand>(ProjectService); });
+
+    // Register bulk property command (one property on many assets and component templates)
+    Registry.RegisterLazyCommand(TEXT("set_property_on_objects"), []() { return MakeShared<FSetPropertyOnObjectsCommand>(); });
 
     // Register Asset Management commands
-    Registry.RegisterCommand(MakeShared<FRenameAssetCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FMoveAssetCommand>(ProjectService));
-    Registry.RegisterCommand(MakeShared<FSearchAssetsCommand>());
+    Registry.RegisterLazyCommand(TEXT("rename_asset"), [ProjectService]() { return MakeShared<FRenameAssetCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("move_asset"), [ProjectService]() { return MakeShared<FMoveAssetCommand>(ProjectService); });
+
+    // Register batch asset command (move/rename/duplicate/delete many assets in one call)
+    Registry.RegisterLazyCommand(TEXT("batch_asset_operation"), [ProjectService]() { return MakeShared<FBatchAssetOperationCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("batch_schema_changes"), [ProjectService]() { return MakeShared<FBatchSchemaChangesCommand>(ProjectService); });
+    Registry.RegisterLazyCommand(TEXT("search_assets"), []() { return MakeShared<FSearchAssetsCommand>(); });
 
     UE_LOG(LogTemp, Log, TEXT("Registered project commands successfully"));
 }
@@ -0,0 +1,173 @@
+#include "Commands/Sound/BuildMetaSoundFromSpecCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Object entries of an optional array field */
+    TArray<TSharedPtr<FJsonObject>> GetMetaSoundSpecObjects(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* FieldName)
+    {
+        TArray<TSharedPtr<FJsonObject>> Objects;
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (JsonObject->TryGetArrayField(FieldName, Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                const TSharedPtr<FJsonObject>* Object;
+                if (Value.IsValid() && Value->TryGetObject(Object))
+                {
+                    Objects.Add(*Object);
+                }
+            }
+        }
+        return Objects;
+    }
+
+    /** The single-step command's name field, or "name" */
+    FString GetMetaSoundSpecName(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* CommandFieldName)
+    {
+        FString Name;
+        if (!JsonObject->TryGetStringField(CommandFieldName, Name))
+        {
+            JsonObject->TryGetStringField(TEXT("name"), Name);
+        }
+        return Name;
+    }
+}
+
+FBuildMetaSoundFromSpecCommand::FBuildMetaSoundFromSpecCommand(ISoundService& InSoundService)
+    : SoundService(InSoundService)
+{
+}
+
+FString FBuildMetaSoundFromSpecCommand::Execute(const FString& Parameters)
+{
+    FBuildMetaSoundFromSpecParams Params;
+    FString ParseError;
+
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return CreateErrorResponse(ParseError);
+    }
+
+    FString ValidationError;
+    if (!Params.IsValid(ValidationError))
+    {
+        return CreateErrorResponse(ValidationError);
+    }
+
+    TSharedPtr<FJsonObject> Report;
+    FString BuildError;
+    if (!SoundService.BuildMetaSoundFromSpec(Params, Report, BuildError))
+    {
+        return CreateErrorResponse(BuildError.IsEmpty() ? TEXT("Failed to build MetaSound") : BuildError);
+    }
+
+    const int32 FailedCount = static_cast<int32>(Report->GetNumberField(TEXT("failed_count")));
+    bool bCompiled = true;
+    Report->TryGetBoolField(TEXT("compiled"), bCompiled);
+
+    // Success means every element was added and, if requested, the graph compiled
+    Report->SetBoolField(TEXT("success"), FailedCount == 0 && bCompiled);
+    Report->SetStringField(TEXT("message"), FString::Printf(TEXT("Built MetaSound '%s': %d element(s), %d failed%s"),
+        *Report->GetStringField(TEXT("metasound_path")), static_cast<int32>(Report->GetNumberField(TEXT("element_count"))),
+        FailedCount, bCompiled ? TEXT("") : TEXT(", compile failed")));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBuildMetaSoundFromSpecCommand::GetCommandName() const
+{
+    return TEXT("build_metasound_from_spec");
+}
+
+bool FBuildMetaSoundFromSpecCommand::ValidateParams(const FString& Parameters) const
+{
+    FBuildMetaSoundFromSpecParams Params;
+    FString ParseError;
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return false;
+    }
+    FString ValidationError;
+    return Params.IsValid(ValidationError);
+}
+
+bool FBuildMetaSoundFromSpecCommand::ParseParameters(const FString& JsonString, FBuildMetaSoundFromSpecParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    // Either an existing MetaSound, or create_metasound_source's fields for a new one
+    JsonObject->TryGetStringField(TEXT("metasound_path"), OutParams.MetaSoundPath);
+    JsonObject->TryGetStringField(TEXT("asset_name"), OutParams.Creation.AssetName);
+    JsonObject->TryGetStringField(TEXT("folder_path"), OutParams.Creation.FolderPath);
+    JsonObject->TryGetStringField(TEXT("output_format"), OutParams.Creation.OutputFormat);
+    JsonObject->TryGetBoolField(TEXT("is_one_shot"), OutParams.Creation.bIsOneShot);
+    JsonObject->TryGetBoolField(TEXT("compile"), OutParams.bCompile);
+
+    for (const TSharedPtr<FJsonObject>& InputObj : GetMetaSoundSpecObjects(JsonObject, TEXT("inputs")))
+    {
+        FMetaSoundInputParams& Input = OutParams.Inputs.AddDefaulted_GetRef();
+        Input.InputName = GetMetaSoundSpecName(InputObj, TEXT("input_name"));
+        InputObj->TryGetStringField(TEXT("data_type"), Input.DataType);
+        // Numbers and booleans read as their text, which add_metasound_input converts back
+        InputObj->TryGetStringField(TEXT("default_value"), Input.DefaultValue);
+    }
+
+    for (const TSharedPtr<FJsonObject>& OutputObj : GetMetaSoundSpecObjects(JsonObject, TEXT("outputs")))
+    {
+        FMetaSoundOutputParams& Output = OutParams.Outputs.AddDefaulted_GetRef();
+        Output.OutputName = GetMetaSoundSpecName(OutputObj, TEXT("output_name"));
+        OutputObj->TryGetStringField(TEXT("data_type"), Output.DataType);
+    }
+
+    for (const TSharedPtr<FJsonObject>& NodeObj : GetMetaSoundSpecObjects(JsonObject, TEXT("nodes")))
+    {
+        FMetaSoundSpecNode& SpecNode = OutParams.Nodes.AddDefaulted_GetRef();
+        NodeObj->TryGetStringField(TEXT("key"), SpecNode.Key);
+        NodeObj->TryGetStringField(TEXT("node_class_name"), SpecNode.Node.NodeClassName);
+        NodeObj->TryGetStringField(TEXT("node_namespace"), SpecNode.Node.NodeNamespace);
+        NodeObj->TryGetStringField(TEXT("node_variant"), SpecNode.Node.NodeVariant);
+        NodeObj->TryGetNumberField(TEXT("pos_x"), SpecNode.Node.PosX);
+        NodeObj->TryGetNumberField(TEXT("pos_y"), SpecNode.Node.PosY);
+
+        const TSharedPtr<FJsonObject>* InputDefaults;
+        if (NodeObj->TryGetObjectField(TEXT("inputs"), InputDefaults))
+        {
+            SpecNode.InputDefaults = *InputDefaults;
+        }
+    }
+
+    for (const TSharedPtr<FJsonObject>& EdgeObj : GetMetaSoundSpecObjects(JsonObject, TEXT("edges")))
+    {
+        FMetaSoundSpecEdge& Edge = OutParams.Edges.AddDefaulted_GetRef();
+        EdgeObj->TryGetStringField(TEXT("from_node"), Edge.FromNode);
+        EdgeObj->TryGetStringField(TEXT("from_pin"), Edge.FromPin);
+        EdgeObj->TryGetStringField(TEXT("to_node"), Edge.ToNode);
+        EdgeObj->TryGetStringField(TEXT("to_pin"), Edge.ToPin);
+    }
+
+    return true;
+}
+
+FString FBuildMetaSoundFromSpecCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
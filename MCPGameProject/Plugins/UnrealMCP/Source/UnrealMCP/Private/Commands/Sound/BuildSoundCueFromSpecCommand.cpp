@@ -0,0 +1,140 @@
+#include "Commands/Sound/BuildSoundCueFromSpecCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Object entries of an optional array field */
+    TArray<TSharedPtr<FJsonObject>> GetSoundCueSpecObjects(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* FieldName)
+    {
+        TArray<TSharedPtr<FJsonObject>> Objects;
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (JsonObject->TryGetArrayField(FieldName, Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                const TSharedPtr<FJsonObject>* Object;
+                if (Value.IsValid() && Value->TryGetObject(Object))
+                {
+                    Objects.Add(*Object);
+                }
+            }
+        }
+        return Objects;
+    }
+}
+
+FBuildSoundCueFromSpecCommand::FBuildSoundCueFromSpecCommand(ISoundService& InSoundService)
+    : SoundService(InSoundService)
+{
+}
+
+FString FBuildSoundCueFromSpecCommand::Execute(const FString& Parameters)
+{
+    FBuildSoundCueFromSpecParams Params;
+    FString ParseError;
+
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return CreateErrorResponse(ParseError);
+    }
+
+    FString ValidationError;
+    if (!Params.IsValid(ValidationError))
+    {
+        return CreateErrorResponse(ValidationError);
+    }
+
+    TSharedPtr<FJsonObject> Report;
+    FString BuildError;
+    if (!SoundService.BuildSoundCueFromSpec(Params, Report, BuildError))
+    {
+        return CreateErrorResponse(BuildError.IsEmpty() ? TEXT("Failed to build Sound Cue") : BuildError);
+    }
+
+    const int32 FailedCount = static_cast<int32>(Report->GetNumberField(TEXT("failed_count")));
+
+    // Success means every element was added
+    Report->SetBoolField(TEXT("success"), FailedCount == 0);
+    Report->SetStringField(TEXT("message"), FString::Printf(TEXT("Built Sound Cue '%s': %d element(s), %d failed"),
+        *Report->GetStringField(TEXT("sound_cue_path")), static_cast<int32>(Report->GetNumberField(TEXT("element_count"))), FailedCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBuildSoundCueFromSpecCommand::GetCommandName() const
+{
+    return TEXT("build_sound_cue_from_spec");
+}
+
+bool FBuildSoundCueFromSpecCommand::ValidateParams(const FString& Parameters) const
+{
+    FBuildSoundCueFromSpecParams Params;
+    FString ParseError;
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return false;
+    }
+    FString ValidationError;
+    return Params.IsValid(ValidationError);
+}
+
+bool FBuildSoundCueFromSpecCommand::ParseParameters(const FString& JsonString, FBuildSoundCueFromSpecParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    // Either an existing Sound Cue, or create_sound_cue's fields for a new one
+    JsonObject->TryGetStringField(TEXT("sound_cue_path"), OutParams.SoundCuePath);
+    JsonObject->TryGetStringField(TEXT("asset_name"), OutParams.Creation.AssetName);
+    JsonObject->TryGetStringField(TEXT("folder_path"), OutParams.Creation.FolderPath);
+    JsonObject->TryGetStringField(TEXT("initial_sound_wave"), OutParams.Creation.InitialSoundWavePath);
+    JsonObject->TryGetBoolField(TEXT("compile"), OutParams.bCompile);
+
+    for (const TSharedPtr<FJsonObject>& NodeObj : GetSoundCueSpecObjects(JsonObject, TEXT("nodes")))
+    {
+        FSoundCueSpecNode& SpecNode = OutParams.Nodes.AddDefaulted_GetRef();
+        NodeObj->TryGetStringField(TEXT("key"), SpecNode.Key);
+        NodeObj->TryGetStringField(TEXT("node_type"), SpecNode.NodeType);
+        NodeObj->TryGetStringField(TEXT("sound_wave_path"), SpecNode.SoundWavePath);
+        NodeObj->TryGetNumberField(TEXT("pos_x"), SpecNode.PosX);
+        NodeObj->TryGetNumberField(TEXT("pos_y"), SpecNode.PosY);
+
+        const TSharedPtr<FJsonObject>* Properties;
+        if (NodeObj->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            SpecNode.Properties = *Properties;
+        }
+    }
+
+    for (const TSharedPtr<FJsonObject>& ConnectionObj : GetSoundCueSpecObjects(JsonObject, TEXT("connections")))
+    {
+        FSoundCueSpecConnection& Connection = OutParams.Connections.AddDefaulted_GetRef();
+        ConnectionObj->TryGetStringField(TEXT("source_node"), Connection.SourceNode);
+        ConnectionObj->TryGetStringField(TEXT("target_node"), Connection.TargetNode);
+        ConnectionObj->TryGetNumberField(TEXT("target_pin_index"), Connection.TargetPinIndex);
+    }
+
+    return true;
+}
+
+FString FBuildSoundCueFromSpecCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
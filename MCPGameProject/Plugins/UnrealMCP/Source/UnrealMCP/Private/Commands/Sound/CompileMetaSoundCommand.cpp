@@ -3,6 +3,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
+#include "MCPCompileQueue.h"
 
 FCompileMetaSoundCommand::FCompileMetaSoundCommand(ISoundService& InSoundService)
     : SoundService(InSoundService)
@@ -28,6 +29,13 @@ FString FCompileMetaSoundCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(Error);
     }
 
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (FMCPCompileQueue::Get().TryDefer(GetCommandName(), MetaSoundPath, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
+
     if (!SoundService.CompileMetaSound(MetaSoundPath, Error))
     {
         return CreateErrorResponse(Error);
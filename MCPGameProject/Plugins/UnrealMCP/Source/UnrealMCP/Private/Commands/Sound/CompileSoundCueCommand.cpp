@@ -3,6 +3,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
+#include "MCPCompileQueue.h"
 
 FCompileSoundCueCommand::FCompileSoundCueCommand(ISoundService& InSoundService)
     : SoundService(InSoundService)
@@ -28,6 +29,13 @@ FString FCompileSoundCueCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(Error);
     }
 
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (FMCPCompileQueue::Get().TryDefer(GetCommandName(), SoundCuePath, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
+
     if (!SoundService.CompileSoundCue(SoundCuePath, Error))
     {
         return CreateErrorResponse(Error);
@@ -3,6 +3,7 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 
 FGetSoundWaveMetadataCommand::FGetSoundWaveMetadataCommand(ISoundService& InSoundService)
     : SoundService(InSoundService)
@@ -16,28 +17,57 @@ FString FGetSoundWaveMetadataCommand::GetCommandName() const
 
 bool FGetSoundWaveMetadataCommand::ValidateParams(const FString& Parameters) const
 {
-    FString SoundWavePath, Error;
-    return ParseParameters(Parameters, SoundWavePath, Error);
+    FParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
 }
 
 FString FGetSoundWaveMetadataCommand::Execute(const FString& Parameters)
 {
-    FString SoundWavePath, Error;
-    if (!ParseParameters(Parameters, SoundWavePath, Error))
+    FParams Params;
+    FString Error;
+    if (!ParseParameters(Parameters, Params, Error))
     {
         return CreateErrorResponse(Error);
     }
 
-    TSharedPtr<FJsonObject> Metadata;
-    if (!SoundService.GetSoundWaveMetadata(SoundWavePath, Metadata, Error))
+    if (!Params.bBatch)
     {
-        return CreateErrorResponse(Error);
+        TSharedPtr<FJsonObject> Metadata;
+        if (!SoundService.GetSoundWaveMetadata(Params.SoundWavePaths[0], Params.bAllowLoad, Params.bIncludeEnvelope, Metadata, Error))
+        {
+            return CreateErrorResponse(Error);
+        }
+        return CreateSuccessResponse(Metadata);
+    }
+
+    // One missing wave does not fail the others
+    TArray<TSharedPtr<FJsonValue>> Entries;
+    Entries.Reserve(Params.SoundWavePaths.Num());
+    int32 FoundCount = 0;
+    for (const FString& SoundWavePath : Params.SoundWavePaths)
+    {
+        TSharedPtr<FJsonObject> Metadata;
+        FString WaveError;
+        if (SoundService.GetSoundWaveMetadata(SoundWavePath, Params.bAllowLoad, Params.bIncludeEnvelope, Metadata, WaveError))
+        {
+            Metadata->SetBoolField(TEXT("success"), true);
+            ++FoundCount;
+        }
+        else
+        {
+            Metadata = MakeShared<FJsonObject>();
+            Metadata->SetStringField(TEXT("path"), SoundWavePath);
+            Metadata->SetBoolField(TEXT("success"), false);
+            Metadata->SetStringField(TEXT("error"), WaveError);
+        }
+        Entries.Add(MakeShared<FJsonValueObject>(Metadata));
     }
 
-    return CreateSuccessResponse(Metadata);
+    return CreateBatchResponse(Entries, FoundCount);
 }
 
-bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FString& OutSoundWavePath, FString& OutError) const
+bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FParams& OutParams, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -48,11 +78,39 @@ bool FGetSoundWaveMetadataCommand::ParseParameters(const FString& JsonString, FS
         return false;
     }
 
-    if (!JsonObject->TryGetStringField(TEXT("sound_wave_path"), OutSoundWavePath) || OutSoundWavePath.IsEmpty())
+    const TArray<TSharedPtr<FJsonValue>>* PathValues = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("sound_wave_paths"), PathValues))
     {
-        OutError = TEXT("Missing required parameter: sound_wave_path");
-        return false;
+        OutParams.bBatch = true;
+        for (const TSharedPtr<FJsonValue>& PathValue : *PathValues)
+        {
+            FString SoundWavePath;
+            if (!PathValue.IsValid() || !PathValue->TryGetString(SoundWavePath) || SoundWavePath.IsEmpty())
+            {
+                OutError = TEXT("sound_wave_paths must hold non-empty strings");
+                return false;
+            }
+            OutParams.SoundWavePaths.Add(SoundWavePath);
+        }
+        if (OutParams.SoundWavePaths.Num() == 0)
+        {
+            OutError = TEXT("sound_wave_paths is empty");
+            return false;
+        }
     }
+    else
+    {
+        FString SoundWavePath;
+        if (!JsonObject->TryGetStringField(TEXT("sound_wave_path"), SoundWavePath) || SoundWavePath.IsEmpty())
+        {
+            OutError = TEXT("Missing required parameter: sound_wave_path");
+            return false;
+        }
+        OutParams.SoundWavePaths.Add(SoundWavePath);
+    }
+
+    JsonObject->TryGetBoolField(TEXT("allow_load"), OutParams.bAllowLoad);
+    JsonObject->TryGetBoolField(TEXT("include_envelope"), OutParams.bIncludeEnvelope);
 
     return true;
 }
@@ -78,6 +136,21 @@ FString FGetSoundWaveMetadataCommand::CreateSuccessResponse(const TSharedPtr<FJs
     return OutputString;
 }
 
+FString FGetSoundWaveMetadataCommand::CreateBatchResponse(const TArray<TSharedPtr<FJsonValue>>& Entries, int32 FoundCount) const
+{
+    TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
+    Response->SetBoolField(TEXT("success"), true);
+    Response->SetNumberField(TEXT("requested_count"), Entries.Num());
+    Response->SetNumberField(TEXT("found_count"), FoundCount);
+    Response->SetArrayField(TEXT("sound_waves"), Entries);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
 FString FGetSoundWaveMetadataCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
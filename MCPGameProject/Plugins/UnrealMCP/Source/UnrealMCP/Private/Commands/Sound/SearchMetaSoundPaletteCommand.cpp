@@ -16,30 +16,31 @@ FString FSearchMetaSoundPaletteCommand::GetCommandName() const
 
 bool FSearchMetaSoundPaletteCommand::ValidateParams(const FString& Parameters) const
 {
-    FString SearchQuery, Error;
-    int32 MaxResults;
-    return ParseParameters(Parameters, SearchQuery, MaxResults, Error);
+    FMetaSoundPaletteQuery Query;
+    FString Error;
+    return ParseParameters(Parameters, Query, Error);
 }
 
 FString FSearchMetaSoundPaletteCommand::Execute(const FString& Parameters)
 {
-    FString SearchQuery, Error;
-    int32 MaxResults;
-    if (!ParseParameters(Parameters, SearchQuery, MaxResults, Error))
+    FMetaSoundPaletteQuery Query;
+    FString Error;
+    if (!ParseParameters(Parameters, Query, Error))
     {
         return CreateErrorResponse(Error);
     }
 
     TArray<TSharedPtr<FJsonObject>> Results;
-    if (!SoundService.SearchMetaSoundPalette(SearchQuery, MaxResults, Results, Error))
+    int32 TotalCount = 0;
+    if (!SoundService.SearchMetaSoundPalette(Query, Results, TotalCount, Error))
     {
         return CreateErrorResponse(Error);
     }
 
-    return CreateSuccessResponse(Results);
+    return CreateSuccessResponse(Query, Results, TotalCount);
 }
 
-bool FSearchMetaSoundPaletteCommand::ParseParameters(const FString& JsonString, FString& OutSearchQuery, int32& OutMaxResults, FString& OutError) const
+bool FSearchMetaSoundPaletteCommand::ParseParameters(const FString& JsonString, FMetaSoundPaletteQuery& OutQuery, FString& OutError) const
 {
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
@@ -51,23 +52,53 @@ bool FSearchMetaSoundPaletteCommand::ParseParameters(const FString& JsonString,
     }
 
     // Search query is optional (empty = list all)
-    if (!JsonObject->TryGetStringField(TEXT("search_query"), OutSearchQuery))
-    {
-        OutSearchQuery = TEXT("");
-    }
+    JsonObject->TryGetStringField(TEXT("search_query"), OutQuery.SearchQuery);
 
-    // Max results is optional (default 50)
-    double TempMaxResults;
-    OutMaxResults = JsonObject->TryGetNumberField(TEXT("max_results"), TempMaxResults) ? static_cast<int32>(TempMaxResults) : 50;
+    // Max results (default 50) and offset are optional
+    JsonObject->TryGetNumberField(TEXT("max_results"), OutQuery.MaxResults);
+    JsonObject->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    OutQuery.Offset = FMath::Max(OutQuery.Offset, 0);
+
+    // Type filters: an array of data type names, or one comma-separated string
+    auto ParseTypes = [&JsonObject](const TCHAR* FieldName, TArray<FString>& OutTypes)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* TypeValues;
+        FString TypeList;
+        if (JsonObject->TryGetArrayField(FieldName, TypeValues))
+        {
+            for (const TSharedPtr<FJsonValue>& TypeValue : *TypeValues)
+            {
+                FString Type;
+                if (TypeValue.IsValid() && TypeValue->TryGetString(Type) && !Type.TrimStartAndEnd().IsEmpty())
+                {
+                    OutTypes.Add(Type.TrimStartAndEnd());
+                }
+            }
+        }
+        else if (JsonObject->TryGetStringField(FieldName, TypeList))
+        {
+            TypeList.ParseIntoArray(OutTypes, TEXT(","));
+            for (FString& Type : OutTypes)
+            {
+                Type.TrimStartAndEndInline();
+            }
+            OutTypes.RemoveAll([](const FString& Type) { return Type.IsEmpty(); });
+        }
+    };
+    ParseTypes(TEXT("input_types"), OutQuery.InputTypes);
+    ParseTypes(TEXT("output_types"), OutQuery.OutputTypes);
 
     return true;
 }
 
-FString FSearchMetaSoundPaletteCommand::CreateSuccessResponse(const TArray<TSharedPtr<FJsonObject>>& Results) const
+FString FSearchMetaSoundPaletteCommand::CreateSuccessResponse(const FMetaSoundPaletteQuery& Query, const TArray<TSharedPtr<FJsonObject>>& Results, int32 TotalCount) const
 {
     TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
     Response->SetBoolField(TEXT("success"), true);
     Response->SetNumberField(TEXT("count"), Results.Num());
+    Response->SetNumberField(TEXT("total_count"), TotalCount);
+    Response->SetNumberField(TEXT("offset"), Query.Offset);
+    Response->SetBoolField(TEXT("has_more"), Query.Offset + Results.Num() < TotalCount);
 
     TArray<TSharedPtr<FJsonValue>> ResultsArray;
     for (const TSharedPtr<FJsonObject>& Result : Results)
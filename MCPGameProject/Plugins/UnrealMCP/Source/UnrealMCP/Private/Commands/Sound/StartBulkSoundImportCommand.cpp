@@ -0,0 +1,101 @@
+#include "Commands/Sound/StartBulkSoundImportCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FStartBulkSoundImportCommand::FStartBulkSoundImportCommand(ISoundService& InSoundService)
+    : SoundService(InSoundService)
+{
+}
+
+FString FStartBulkSoundImportCommand::Execute(const FString& Parameters)
+{
+    FBulkSoundImportParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int64 JobId = 0;
+    int32 FileCount = 0;
+    if (!SoundService.StartBulkSoundImport(Params, JobId, FileCount, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    ResponseObj->SetNumberField(TEXT("files_total"), FileCount);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Importing %d audio file(s); read the progress with get_bulk_sound_import"), FileCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FStartBulkSoundImportCommand::GetCommandName() const
+{
+    return TEXT("start_bulk_sound_import");
+}
+
+bool FStartBulkSoundImportCommand::ValidateParams(const FString& Parameters) const
+{
+    FBulkSoundImportParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FStartBulkSoundImportCommand::ParseParameters(const FString& JsonString, FBulkSoundImportParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> ParamsObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+    {
+        OutError = TEXT("Failed to parse parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* FilesArray = nullptr;
+    if (ParamsObj->TryGetArrayField(TEXT("source_file_paths"), FilesArray) && FilesArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *FilesArray)
+        {
+            FString SourceFilePath;
+            if (Value->TryGetString(SourceFilePath) && !SourceFilePath.IsEmpty())
+            {
+                OutParams.SourceFilePaths.Add(SourceFilePath);
+            }
+        }
+    }
+
+    ParamsObj->TryGetStringField(TEXT("source_directory"), OutParams.SourceDirectory);
+    ParamsObj->TryGetBoolField(TEXT("recursive"), OutParams.bRecursive);
+    ParamsObj->TryGetStringField(TEXT("folder_path"), OutParams.FolderPath);
+    if (OutParams.FolderPath.IsEmpty())
+    {
+        OutParams.FolderPath = TEXT("/Game/Audio");
+    }
+    ParamsObj->TryGetStringField(TEXT("asset_prefix"), OutParams.AssetPrefix);
+    ParamsObj->TryGetBoolField(TEXT("replace_existing"), OutParams.bReplaceExisting);
+    ParamsObj->TryGetBoolField(TEXT("save"), OutParams.bSave);
+    ParamsObj->TryGetNumberField(TEXT("batch_size"), OutParams.BatchSize);
+    ParamsObj->TryGetNumberField(TEXT("max_in_flight"), OutParams.MaxInFlight);
+
+    return OutParams.IsValid(OutError);
+}
+
+FString FStartBulkSoundImportCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -7,6 +7,8 @@
 #include "Commands/Sound/GetSoundWaveMetadataCommand.h"
 #include "Commands/Sound/SpawnAmbientSoundCommand.h"
 #include "Commands/Sound/CreateSoundAttenuationCommand.h"
+#include "Commands/Sound/StartBulkSoundImportCommand.h"
+#include "Commands/Sound/GetBulkSoundImportCommand.h"
 
 // Include Phase 2 Sound Cue command headers
 #include "Commands/Sound/CreateSoundCueCommand.h"
@@ -16,6 +18,7 @@
 #include "Commands/Sound/SetSoundCueNodePropertyCommand.h"
 #include "Commands/Sound/RemoveSoundCueNodeCommand.h"
 #include "Commands/Sound/CompileSoundCueCommand.h"
+#include "Commands/Sound/BuildSoundCueFromSpecCommand.h"
 
 // Include Phase 3 MetaSound command headers
 #include "Commands/Sound/CreateMetaSoundSourceCommand.h"
@@ -27,79 +30,73 @@
 #include "Commands/Sound/AddMetaSoundOutputCommand.h"
 #include "Commands/Sound/CompileMetaSoundCommand.h"
 #include "Commands/Sound/SearchMetaSoundPaletteCommand.h"
+#include "Commands/Sound/BuildMetaSoundFromSpecCommand.h"
 
-TArray<TSharedPtr<IUnrealMCPCommand>> FSoundCommandRegistration::RegisteredCommands;
+TArray<FString> FSoundCommandRegistration::RegisteredCommandNames;
 
 void FSoundCommandRegistration::RegisterAllCommands()
 {
     UE_LOG(LogTemp, Log, TEXT("Registering Sound commands..."));
 
-    // Get the Sound service instance
-    ISoundService& SoundService = FSoundService::Get();
-
     // Register Phase 1: Sound Wave and Audio Component commands
-    RegisterAndTrackCommand(MakeShared<FImportSoundFileCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FGetSoundWaveMetadataCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FSpawnAmbientSoundCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FCreateSoundAttenuationCommand>(SoundService));
+    RegisterAndTrackCommand(TEXT("import_sound_file"), []() { return MakeShared<FImportSoundFileCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("start_bulk_sound_import"), []() { return MakeShared<FStartBulkSoundImportCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_bulk_sound_import"), []() { return MakeShared<FGetBulkSoundImportCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_sound_wave_metadata"), []() { return MakeShared<FGetSoundWaveMetadataCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("spawn_ambient_sound"), []() { return MakeShared<FSpawnAmbientSoundCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("create_sound_attenuation"), []() { return MakeShared<FCreateSoundAttenuationCommand>(FSoundService::Get()); });
 
     // Register Phase 2: Sound Cue commands
-    RegisterAndTrackCommand(MakeShared<FCreateSoundCueCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FGetSoundCueMetadataCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FAddSoundCueNodeCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FConnectSoundCueNodesCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FSetSoundCueNodePropertyCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FRemoveSoundCueNodeCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FCompileSoundCueCommand>(SoundService));
+    RegisterAndTrackCommand(TEXT("create_sound_cue"), []() { return MakeShared<FCreateSoundCueCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_sound_cue_metadata"), []() { return MakeShared<FGetSoundCueMetadataCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_sound_cue_node"), []() { return MakeShared<FAddSoundCueNodeCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("connect_sound_cue_nodes"), []() { return MakeShared<FConnectSoundCueNodesCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_sound_cue_node_property"), []() { return MakeShared<FSetSoundCueNodePropertyCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("remove_sound_cue_node"), []() { return MakeShared<FRemoveSoundCueNodeCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("compile_sound_cue"), []() { return MakeShared<FCompileSoundCueCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("build_sound_cue_from_spec"), []() { return MakeShared<FBuildSoundCueFromSpecCommand>(FSoundService::Get()); });
 
     // Register Phase 3: MetaSound commands
-    RegisterAndTrackCommand(MakeShared<FCreateMetaSoundSourceCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FGetMetaSoundMetadataCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FAddMetaSoundNodeCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FConnectMetaSoundNodesCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FSetMetaSoundInputCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FAddMetaSoundInputCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FAddMetaSoundOutputCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FCompileMetaSoundCommand>(SoundService));
-    RegisterAndTrackCommand(MakeShared<FSearchMetaSoundPaletteCommand>(SoundService));
+    RegisterAndTrackCommand(TEXT("create_metasound_source"), []() { return MakeShared<FCreateMetaSoundSourceCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("get_metasound_metadata"), []() { return MakeShared<FGetMetaSoundMetadataCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_metasound_node"), []() { return MakeShared<FAddMetaSoundNodeCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("connect_metasound_nodes"), []() { return MakeShared<FConnectMetaSoundNodesCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("set_metasound_input"), []() { return MakeShared<FSetMetaSoundInputCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_metasound_input"), []() { return MakeShared<FAddMetaSoundInputCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("add_metasound_output"), []() { return MakeShared<FAddMetaSoundOutputCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("compile_metasound"), []() { return MakeShared<FCompileMetaSoundCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("search_metasound_palette"), []() { return MakeShared<FSearchMetaSoundPaletteCommand>(FSoundService::Get()); });
+    RegisterAndTrackCommand(TEXT("build_metasound_from_spec"), []() { return MakeShared<FBuildMetaSoundFromSpecCommand>(FSoundService::Get()); });
 
     // TODO: Register Phase 4 Music System commands
 
-    UE_LOG(LogTemp, Log, TEXT("Registered %d Sound commands"), RegisteredCommands.Num());
+    UE_LOG(LogTemp, Log, TEXT("Registered %d Sound commands"), RegisteredCommandNames.Num());
 }
 
 void FSoundCommandRegistration::UnregisterAllCommands()
 {
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
 
-    for (const TSharedPtr<IUnrealMCPCommand>& Command : RegisteredCommands)
+    for (const FString& CommandName : RegisteredCommandNames)
     {
-        if (Command.IsValid())
-        {
-            Registry.UnregisterCommand(Command->GetCommandName());
-        }
+        Registry.UnregisterCommand(CommandName);
     }
 
-    RegisteredCommands.Empty();
+    RegisteredCommandNames.Empty();
     UE_LOG(LogTemp, Log, TEXT("Unregistered all Sound commands"));
 }
 
-void FSoundCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FSoundCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Warning, TEXT("Attempted to register invalid Sound command"));
-        return;
-    }
-
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
-        RegisteredCommands.Add(Command);
-        UE_LOG(LogTemp, Log, TEXT("Registered Sound command: %s"), *Command->GetCommandName());
+        RegisteredCommandNames.Add(CommandName);
+        UE_LOG(LogTemp, Verbose, TEXT("Registered Sound command: %s"), *CommandName);
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("Failed to register Sound command: %s"), *Command->GetCommandName());
+        UE_LOG(LogTemp, Warning, TEXT("Failed to register Sound command: %s"), *CommandName);
     }
 }
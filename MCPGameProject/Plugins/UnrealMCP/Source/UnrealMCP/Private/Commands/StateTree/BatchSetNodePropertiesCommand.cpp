@@ -0,0 +1,126 @@
+#include "Commands/StateTree/BatchSetNodePropertiesCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FBatchSetNodePropertiesCommand::FBatchSetNodePropertiesCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FBatchSetNodePropertiesCommand::Execute(const FString& Parameters)
+{
+    FBatchSetNodePropertiesParams Params;
+    FString ParseError;
+
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return CreateErrorResponse(ParseError);
+    }
+
+    FString ValidationError;
+    if (!Params.IsValid(ValidationError))
+    {
+        return CreateErrorResponse(ValidationError);
+    }
+
+    TSharedPtr<FJsonObject> Report;
+    FString Error;
+    if (!Service.BatchSetNodeProperties(Params, Report, Error))
+    {
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to set node properties") : Error);
+    }
+
+    const int32 FailedCount = static_cast<int32>(Report->GetNumberField(TEXT("failed_count")));
+
+    // Success means every property of every edit was set
+    Report->SetBoolField(TEXT("success"), FailedCount == 0);
+    Report->SetStringField(TEXT("message"), FString::Printf(TEXT("Set %d propert(ies) over %d edit(s), %d edit(s) failed"),
+        static_cast<int32>(Report->GetNumberField(TEXT("property_count"))), Params.Edits.Num(), FailedCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBatchSetNodePropertiesCommand::GetCommandName() const
+{
+    return TEXT("batch_set_node_properties");
+}
+
+bool FBatchSetNodePropertiesCommand::ValidateParams(const FString& Parameters) const
+{
+    FBatchSetNodePropertiesParams Params;
+    FString ParseError;
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return false;
+    }
+    FString ValidationError;
+    return Params.IsValid(ValidationError);
+}
+
+bool FBatchSetNodePropertiesCommand::ParseParameters(const FString& JsonString, FBatchSetNodePropertiesParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("state_tree_path"), OutParams.StateTreePath);
+
+    const TArray<TSharedPtr<FJsonValue>>* EditsArray = nullptr;
+    if (!JsonObject->TryGetArrayField(TEXT("edits"), EditsArray) || !EditsArray)
+    {
+        OutError = TEXT("Missing required 'edits' array");
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Value : *EditsArray)
+    {
+        const TSharedPtr<FJsonObject>* EditObj = nullptr;
+        if (!Value.IsValid() || !Value->TryGetObject(EditObj))
+        {
+            OutError = TEXT("Each edit must be an object");
+            return false;
+        }
+
+        FNodePropertyEdit& Edit = OutParams.Edits.AddDefaulted_GetRef();
+        (*EditObj)->TryGetStringField(TEXT("node_type"), Edit.NodeType);
+        (*EditObj)->TryGetStringField(TEXT("state_name"), Edit.StateName);
+        (*EditObj)->TryGetStringField(TEXT("node"), Edit.NodeName);
+
+        // The single-node commands' index names are accepted alongside node_index
+        if (!(*EditObj)->TryGetNumberField(TEXT("node_index"), Edit.NodeIndex)
+            && !(*EditObj)->TryGetNumberField(TEXT("task_index"), Edit.NodeIndex))
+        {
+            (*EditObj)->TryGetNumberField(TEXT("evaluator_index"), Edit.NodeIndex);
+        }
+
+        const TSharedPtr<FJsonObject>* Properties = nullptr;
+        if (!(*EditObj)->TryGetObjectField(TEXT("properties"), Properties))
+        {
+            OutError = FString::Printf(TEXT("Edit %d is missing its 'properties' object"), OutParams.Edits.Num() - 1);
+            return false;
+        }
+        Edit.Properties = *Properties;
+    }
+
+    return true;
+}
+
+FString FBatchSetNodePropertiesCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
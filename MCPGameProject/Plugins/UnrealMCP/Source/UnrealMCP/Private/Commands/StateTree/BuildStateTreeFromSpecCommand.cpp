@@ -0,0 +1,227 @@
+#include "Commands/StateTree/BuildStateTreeFromSpecCommand.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Object entries of an optional array field */
+    TArray<TSharedPtr<FJsonObject>> GetStateTreeSpecObjects(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* FieldName)
+    {
+        TArray<TSharedPtr<FJsonObject>> Objects;
+        const TArray<TSharedPtr<FJsonValue>>* Values;
+        if (JsonObject->TryGetArrayField(FieldName, Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                const TSharedPtr<FJsonObject>* Object;
+                if (Value.IsValid() && Value->TryGetObject(Object))
+                {
+                    Objects.Add(*Object);
+                }
+            }
+        }
+        return Objects;
+    }
+
+    /** "properties", or the single-step command's own field name for them */
+    TSharedPtr<FJsonObject> GetStateTreeSpecProperties(const TSharedPtr<FJsonObject>& JsonObject, const TCHAR* CommandFieldName)
+    {
+        const TSharedPtr<FJsonObject>* Properties;
+        if (JsonObject->TryGetObjectField(TEXT("properties"), Properties) || JsonObject->TryGetObjectField(CommandFieldName, Properties))
+        {
+            return *Properties;
+        }
+        return nullptr;
+    }
+}
+
+FBuildStateTreeFromSpecCommand::FBuildStateTreeFromSpecCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FBuildStateTreeFromSpecCommand::Execute(const FString& Parameters)
+{
+    FBuildStateTreeFromSpecParams Params;
+    FString ParseError;
+
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return CreateErrorResponse(ParseError);
+    }
+
+    FString ValidationError;
+    if (!Params.IsValid(ValidationError))
+    {
+        return CreateErrorResponse(ValidationError);
+    }
+
+    TSharedPtr<FJsonObject> Report;
+    FString BuildError;
+    if (!Service.BuildStateTreeFromSpec(Params, Report, BuildError))
+    {
+        return CreateErrorResponse(BuildError.IsEmpty() ? TEXT("Failed to build StateTree") : BuildError);
+    }
+
+    const int32 FailedCount = static_cast<int32>(Report->GetNumberField(TEXT("failed_count")));
+    bool bCompiled = true;
+    Report->TryGetBoolField(TEXT("compiled"), bCompiled);
+
+    // Success means every element was added and, if requested, the tree compiled
+    Report->SetBoolField(TEXT("success"), FailedCount == 0 && bCompiled);
+    Report->SetStringField(TEXT("message"), FString::Printf(TEXT("Built StateTree '%s': %d element(s), %d failed%s"),
+        *Report->GetStringField(TEXT("state_tree_path")), static_cast<int32>(Report->GetNumberField(TEXT("element_count"))),
+        FailedCount, bCompiled ? TEXT("") : TEXT(", compile failed")));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Report.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FBuildStateTreeFromSpecCommand::GetCommandName() const
+{
+    return TEXT("build_state_tree_from_spec");
+}
+
+bool FBuildStateTreeFromSpecCommand::ValidateParams(const FString& Parameters) const
+{
+    FBuildStateTreeFromSpecParams Params;
+    FString ParseError;
+    if (!ParseParameters(Parameters, Params, ParseError))
+    {
+        return false;
+    }
+    FString ValidationError;
+    return Params.IsValid(ValidationError);
+}
+
+bool FBuildStateTreeFromSpecCommand::ParseParameters(const FString& JsonString, FBuildStateTreeFromSpecParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    // Either an existing tree, or create_state_tree's fields for a new one
+    JsonObject->TryGetStringField(TEXT("state_tree_path"), OutParams.StateTreePath);
+    JsonObject->TryGetStringField(TEXT("name"), OutParams.Creation.Name);
+    JsonObject->TryGetStringField(TEXT("path"), OutParams.Creation.FolderPath);
+    JsonObject->TryGetStringField(TEXT("schema_class"), OutParams.Creation.SchemaClass);
+    JsonObject->TryGetBoolField(TEXT("compile"), OutParams.bCompile);
+
+    for (const TSharedPtr<FJsonObject>& StateObj : GetStateTreeSpecObjects(JsonObject, TEXT("states")))
+    {
+        ParseState(StateObj, FString(), OutParams.States);
+    }
+
+    for (const TSharedPtr<FJsonObject>& EvaluatorObj : GetStateTreeSpecObjects(JsonObject, TEXT("evaluators")))
+    {
+        FAddEvaluatorParams& Evaluator = OutParams.Evaluators.AddDefaulted_GetRef();
+        EvaluatorObj->TryGetStringField(TEXT("evaluator_struct_path"), Evaluator.EvaluatorStructPath);
+        EvaluatorObj->TryGetStringField(TEXT("evaluator_name"), Evaluator.EvaluatorName);
+        Evaluator.EvaluatorProperties = GetStateTreeSpecProperties(EvaluatorObj, TEXT("evaluator_properties"));
+    }
+
+    for (const TSharedPtr<FJsonObject>& TaskObj : GetStateTreeSpecObjects(JsonObject, TEXT("global_tasks")))
+    {
+        FAddGlobalTaskParams& Task = OutParams.GlobalTasks.AddDefaulted_GetRef();
+        TaskObj->TryGetStringField(TEXT("task_struct_path"), Task.TaskStructPath);
+        TaskObj->TryGetStringField(TEXT("task_name"), Task.TaskName);
+        Task.TaskProperties = GetStateTreeSpecProperties(TaskObj, TEXT("task_properties"));
+    }
+
+    for (const TSharedPtr<FJsonObject>& BindingObj : GetStateTreeSpecObjects(JsonObject, TEXT("bindings")))
+    {
+        FBindPropertyParams& Binding = OutParams.Bindings.AddDefaulted_GetRef();
+        BindingObj->TryGetStringField(TEXT("source_node_name"), Binding.SourceNodeName);
+        BindingObj->TryGetStringField(TEXT("source_property_name"), Binding.SourcePropertyName);
+        BindingObj->TryGetStringField(TEXT("target_node_name"), Binding.TargetNodeName);
+        BindingObj->TryGetStringField(TEXT("target_property_name"), Binding.TargetPropertyName);
+        BindingObj->TryGetNumberField(TEXT("task_index"), Binding.TaskIndex);
+        BindingObj->TryGetNumberField(TEXT("transition_index"), Binding.TransitionIndex);
+        BindingObj->TryGetNumberField(TEXT("condition_index"), Binding.ConditionIndex);
+    }
+
+    return true;
+}
+
+void FBuildStateTreeFromSpecCommand::ParseState(const TSharedPtr<FJsonObject>& StateObj, const FString& ParentStateName, TArray<FStateTreeSpecState>& OutStates) const
+{
+    FStateTreeSpecState SpecState;
+    FAddStateParams& State = SpecState.State;
+    if (!StateObj->TryGetStringField(TEXT("state_name"), State.StateName))
+    {
+        StateObj->TryGetStringField(TEXT("name"), State.StateName);
+    }
+    State.ParentStateName = ParentStateName;
+    StateObj->TryGetStringField(TEXT("parent_state_name"), State.ParentStateName);
+    StateObj->TryGetStringField(TEXT("state_type"), State.StateType);
+    StateObj->TryGetStringField(TEXT("selection_behavior"), State.SelectionBehavior);
+    StateObj->TryGetBoolField(TEXT("enabled"), State.bEnabled);
+
+    for (const TSharedPtr<FJsonObject>& TaskObj : GetStateTreeSpecObjects(StateObj, TEXT("tasks")))
+    {
+        FAddTaskParams& Task = SpecState.Tasks.AddDefaulted_GetRef();
+        TaskObj->TryGetStringField(TEXT("task_struct_path"), Task.TaskStructPath);
+        TaskObj->TryGetStringField(TEXT("task_name"), Task.TaskName);
+        Task.TaskProperties = GetStateTreeSpecProperties(TaskObj, TEXT("task_properties"));
+    }
+
+    for (const TSharedPtr<FJsonObject>& ConditionObj : GetStateTreeSpecObjects(StateObj, TEXT("enter_conditions")))
+    {
+        FAddEnterConditionParams& Condition = SpecState.EnterConditions.AddDefaulted_GetRef();
+        ConditionObj->TryGetStringField(TEXT("condition_struct_path"), Condition.ConditionStructPath);
+        Condition.ConditionProperties = GetStateTreeSpecProperties(ConditionObj, TEXT("condition_properties"));
+    }
+
+    for (const TSharedPtr<FJsonObject>& TransitionObj : GetStateTreeSpecObjects(StateObj, TEXT("transitions")))
+    {
+        FStateTreeSpecTransition& SpecTransition = SpecState.Transitions.AddDefaulted_GetRef();
+        FAddTransitionParams& Transition = SpecTransition.Transition;
+        TransitionObj->TryGetStringField(TEXT("trigger"), Transition.Trigger);
+        TransitionObj->TryGetStringField(TEXT("target_state_name"), Transition.TargetStateName);
+        TransitionObj->TryGetStringField(TEXT("transition_type"), Transition.TransitionType);
+        TransitionObj->TryGetStringField(TEXT("event_tag"), Transition.EventTag);
+        TransitionObj->TryGetStringField(TEXT("priority"), Transition.Priority);
+        TransitionObj->TryGetBoolField(TEXT("delay_transition"), Transition.bDelayTransition);
+
+        double DelayDuration = 0.0;
+        if (TransitionObj->TryGetNumberField(TEXT("delay_duration"), DelayDuration))
+        {
+            Transition.DelayDuration = static_cast<float>(DelayDuration);
+        }
+
+        for (const TSharedPtr<FJsonObject>& ConditionObj : GetStateTreeSpecObjects(TransitionObj, TEXT("conditions")))
+        {
+            FAddConditionParams& Condition = SpecTransition.Conditions.AddDefaulted_GetRef();
+            ConditionObj->TryGetStringField(TEXT("condition_struct_path"), Condition.ConditionStructPath);
+            ConditionObj->TryGetStringField(TEXT("combine_mode"), Condition.CombineMode);
+            Condition.ConditionProperties = GetStateTreeSpecProperties(ConditionObj, TEXT("condition_properties"));
+        }
+    }
+
+    const FString StateName = State.StateName;
+    OutStates.Add(MoveTemp(SpecState));
+
+    for (const TSharedPtr<FJsonObject>& ChildObj : GetStateTreeSpecObjects(StateObj, TEXT("children")))
+    {
+        ParseState(ChildObj, StateName, OutStates);
+    }
+}
+
+FString FBuildStateTreeFromSpecCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
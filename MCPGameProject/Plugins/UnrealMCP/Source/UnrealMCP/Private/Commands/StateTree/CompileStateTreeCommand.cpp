@@ -2,6 +2,7 @@
 #include "StateTree.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
+#include "MCPCompileQueue.h"
 
 FCompileStateTreeCommand::FCompileStateTreeCommand(IStateTreeService& InService)
     : Service(InService)
@@ -24,19 +25,46 @@ FString FCompileStateTreeCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(TEXT("Missing required 'state_tree_path' parameter"));
     }
 
+    bool bValidateOnly = false;
+    JsonObject->TryGetBoolField(TEXT("validate_only"), bValidateOnly);
+
+    bool bForce = false;
+    JsonObject->TryGetBoolField(TEXT("force"), bForce);
+
+    // Queued instead of compiled when the client asked for "deferred": true
+    FString DeferredResponse;
+    if (!bValidateOnly && FMCPCompileQueue::Get().TryDefer(GetCommandName(), StateTreePath, Parameters, DeferredResponse))
+    {
+        return DeferredResponse;
+    }
+
     UStateTree* StateTree = Service.FindStateTree(StateTreePath);
     if (!StateTree)
     {
         return CreateErrorResponse(FString::Printf(TEXT("StateTree not found: '%s'"), *StateTreePath));
     }
 
+    // Checked before compiling so the response can tell a skipped compile from a real one
+    const bool bUpToDate = Service.IsStateTreeCompileUpToDate(StateTree);
+
+    if (bValidateOnly)
+    {
+        TArray<FString> Messages;
+        FString ValidationError;
+        if (!Service.ValidateStateTree(StateTree, Messages, ValidationError))
+        {
+            return CreateErrorResponse(ValidationError.IsEmpty() ? TEXT("Validation failed") : ValidationError);
+        }
+        return CreateSuccessResponse(StateTree->GetName(), true, bUpToDate, Messages);
+    }
+
     FString CompileError;
-    if (!Service.CompileStateTree(StateTree, CompileError))
+    if (!Service.CompileStateTree(StateTree, CompileError, bForce))
     {
         return CreateErrorResponse(CompileError.IsEmpty() ? TEXT("Compilation failed") : CompileError);
     }
 
-    return CreateSuccessResponse(StateTree->GetName());
+    return CreateSuccessResponse(StateTree->GetName(), false, bUpToDate && !bForce, TArray<FString>());
 }
 
 FString FCompileStateTreeCommand::GetCommandName() const
@@ -58,12 +86,32 @@ bool FCompileStateTreeCommand::ValidateParams(const FString& Parameters) const
     return JsonObject->TryGetStringField(TEXT("state_tree_path"), StateTreePath);
 }
 
-FString FCompileStateTreeCommand::CreateSuccessResponse(const FString& StateTreeName) const
+FString FCompileStateTreeCommand::CreateSuccessResponse(const FString& StateTreeName, bool bValidateOnly, bool bUpToDate, const TArray<FString>& Messages) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetStringField(TEXT("state_tree_name"), StateTreeName);
-    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("StateTree '%s' compiled successfully"), *StateTreeName));
+    ResponseObj->SetBoolField(TEXT("validate_only"), bValidateOnly);
+    ResponseObj->SetBoolField(TEXT("up_to_date"), bUpToDate);
+
+    if (bValidateOnly)
+    {
+        TArray<TSharedPtr<FJsonValue>> MessageValues;
+        for (const FString& Message : Messages)
+        {
+            MessageValues.Add(MakeShared<FJsonValueString>(Message));
+        }
+        ResponseObj->SetArrayField(TEXT("messages"), MessageValues);
+        ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("StateTree '%s' is valid"), *StateTreeName));
+    }
+    else if (bUpToDate)
+    {
+        ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("StateTree '%s' is unchanged since its last compile; compile skipped"), *StateTreeName));
+    }
+    else
+    {
+        ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("StateTree '%s' compiled successfully"), *StateTreeName));
+    }
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
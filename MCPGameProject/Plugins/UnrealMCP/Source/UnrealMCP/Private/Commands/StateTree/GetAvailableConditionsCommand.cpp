@@ -9,10 +9,18 @@ FGetAvailableConditionsCommand::FGetAvailableConditionsCommand(IStateTreeService
 
 FString FGetAvailableConditionsCommand::Execute(const FString& Parameters)
 {
+    FStateTreeNodeTypeQuery Query;
+    FString Error;
+    if (!ParseParameters(Parameters, Query, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
     TArray<TPair<FString, FString>> Conditions;
-    if (!Service.GetAvailableConditionTypes(Conditions))
+    int32 TotalCount = 0;
+    if (!Service.QueryNodeTypes(EStateTreeNodeKind::Condition, false, Query, Conditions, TotalCount, Error))
     {
-        return CreateErrorResponse(TEXT("Failed to retrieve available condition types"));
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to retrieve available condition types") : Error);
     }
 
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -28,6 +36,9 @@ FString FGetAvailableConditionsCommand::Execute(const FString& Parameters)
     }
     ResponseObj->SetArrayField(TEXT("conditions"), ConditionsArray);
     ResponseObj->SetNumberField(TEXT("count"), Conditions.Num());
+    ResponseObj->SetNumberField(TEXT("total_count"), TotalCount);
+    ResponseObj->SetNumberField(TEXT("offset"), Query.Offset);
+    ResponseObj->SetBoolField(TEXT("has_more"), Query.Offset + Conditions.Num() < TotalCount);
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -46,6 +57,32 @@ bool FGetAvailableConditionsCommand::ValidateParams(const FString& Parameters) c
     return true;
 }
 
+bool FGetAvailableConditionsCommand::ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const
+{
+    // Every parameter is optional; callers without any send nothing
+    if (JsonString.TrimStartAndEnd().IsEmpty())
+    {
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("filter"), OutQuery.Filter);
+    JsonObject->TryGetStringField(TEXT("schema_class"), OutQuery.SchemaClass);
+    JsonObject->TryGetStringField(TEXT("state_tree_path"), OutQuery.StateTreePath);
+    JsonObject->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    JsonObject->TryGetNumberField(TEXT("limit"), OutQuery.Limit);
+    OutQuery.Offset = FMath::Max(OutQuery.Offset, 0);
+    OutQuery.Limit = FMath::Max(OutQuery.Limit, 0);
+    return true;
+}
+
 FString FGetAvailableConditionsCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -9,10 +9,18 @@ FGetAvailableEvaluatorsCommand::FGetAvailableEvaluatorsCommand(IStateTreeService
 
 FString FGetAvailableEvaluatorsCommand::Execute(const FString& Parameters)
 {
+    FStateTreeNodeTypeQuery Query;
+    FString Error;
+    if (!ParseParameters(Parameters, Query, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
     TArray<TPair<FString, FString>> Evaluators;
-    if (!Service.GetAvailableEvaluatorTypes(Evaluators))
+    int32 TotalCount = 0;
+    if (!Service.QueryNodeTypes(EStateTreeNodeKind::Evaluator, false, Query, Evaluators, TotalCount, Error))
     {
-        return CreateErrorResponse(TEXT("Failed to retrieve available evaluator types"));
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to retrieve available evaluator types") : Error);
     }
 
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -28,6 +36,9 @@ FString FGetAvailableEvaluatorsCommand::Execute(const FString& Parameters)
     }
     ResponseObj->SetArrayField(TEXT("evaluators"), EvaluatorsArray);
     ResponseObj->SetNumberField(TEXT("count"), Evaluators.Num());
+    ResponseObj->SetNumberField(TEXT("total_count"), TotalCount);
+    ResponseObj->SetNumberField(TEXT("offset"), Query.Offset);
+    ResponseObj->SetBoolField(TEXT("has_more"), Query.Offset + Evaluators.Num() < TotalCount);
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -46,6 +57,32 @@ bool FGetAvailableEvaluatorsCommand::ValidateParams(const FString& Parameters) c
     return true;
 }
 
+bool FGetAvailableEvaluatorsCommand::ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const
+{
+    // Every parameter is optional; callers without any send nothing
+    if (JsonString.TrimStartAndEnd().IsEmpty())
+    {
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("filter"), OutQuery.Filter);
+    JsonObject->TryGetStringField(TEXT("schema_class"), OutQuery.SchemaClass);
+    JsonObject->TryGetStringField(TEXT("state_tree_path"), OutQuery.StateTreePath);
+    JsonObject->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    JsonObject->TryGetNumberField(TEXT("limit"), OutQuery.Limit);
+    OutQuery.Offset = FMath::Max(OutQuery.Offset, 0);
+    OutQuery.Limit = FMath::Max(OutQuery.Limit, 0);
+    return true;
+}
+
 FString FGetAvailableEvaluatorsCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
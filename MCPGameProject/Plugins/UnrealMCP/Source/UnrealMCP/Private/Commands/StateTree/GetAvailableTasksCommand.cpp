@@ -9,10 +9,18 @@ FGetAvailableTasksCommand::FGetAvailableTasksCommand(IStateTreeService& InServic
 
 FString FGetAvailableTasksCommand::Execute(const FString& Parameters)
 {
+    FStateTreeNodeTypeQuery Query;
+    FString Error;
+    if (!ParseParameters(Parameters, Query, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
     TArray<TPair<FString, FString>> Tasks;
-    if (!Service.GetAvailableTaskTypes(Tasks))
+    int32 TotalCount = 0;
+    if (!Service.QueryNodeTypes(EStateTreeNodeKind::Task, false, Query, Tasks, TotalCount, Error))
     {
-        return CreateErrorResponse(TEXT("Failed to retrieve available task types"));
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to retrieve available task types") : Error);
     }
 
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -28,6 +36,9 @@ FString FGetAvailableTasksCommand::Execute(const FString& Parameters)
     }
     ResponseObj->SetArrayField(TEXT("tasks"), TasksArray);
     ResponseObj->SetNumberField(TEXT("count"), Tasks.Num());
+    ResponseObj->SetNumberField(TEXT("total_count"), TotalCount);
+    ResponseObj->SetNumberField(TEXT("offset"), Query.Offset);
+    ResponseObj->SetBoolField(TEXT("has_more"), Query.Offset + Tasks.Num() < TotalCount);
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
@@ -46,6 +57,32 @@ bool FGetAvailableTasksCommand::ValidateParams(const FString& Parameters) const
     return true;
 }
 
+bool FGetAvailableTasksCommand::ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const
+{
+    // Every parameter is optional; callers without any send nothing
+    if (JsonString.TrimStartAndEnd().IsEmpty())
+    {
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("filter"), OutQuery.Filter);
+    JsonObject->TryGetStringField(TEXT("schema_class"), OutQuery.SchemaClass);
+    JsonObject->TryGetStringField(TEXT("state_tree_path"), OutQuery.StateTreePath);
+    JsonObject->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    JsonObject->TryGetNumberField(TEXT("limit"), OutQuery.Limit);
+    OutQuery.Offset = FMath::Max(OutQuery.Offset, 0);
+    OutQuery.Limit = FMath::Max(OutQuery.Limit, 0);
+    return true;
+}
+
 FString FGetAvailableTasksCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
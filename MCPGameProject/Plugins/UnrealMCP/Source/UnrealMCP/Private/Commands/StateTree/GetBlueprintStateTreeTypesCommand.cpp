@@ -10,12 +10,46 @@ FGetBlueprintStateTreeTypesCommand::FGetBlueprintStateTreeTypesCommand(IStateTre
 
 FString FGetBlueprintStateTreeTypesCommand::Execute(const FString& Parameters)
 {
-    TSharedPtr<FJsonObject> Types;
-    if (!Service.GetBlueprintStateTreeTypes(Types))
+    FStateTreeNodeTypeQuery Query;
+    FString Error;
+    if (!ParseParameters(Parameters, Query, Error))
     {
-        return CreateErrorResponse(TEXT("Failed to get Blueprint StateTree types"));
+        return CreateErrorResponse(Error);
     }
 
+    TSharedPtr<FJsonObject> Types = MakeShared<FJsonObject>();
+    TSharedPtr<FJsonObject> TotalCounts = MakeShared<FJsonObject>();
+    bool bHasMore = false;
+
+    const TPair<EStateTreeNodeKind, const TCHAR*> Categories[] = {
+        { EStateTreeNodeKind::Task, TEXT("tasks") },
+        { EStateTreeNodeKind::Condition, TEXT("conditions") },
+        { EStateTreeNodeKind::Evaluator, TEXT("evaluators") }
+    };
+    for (const TPair<EStateTreeNodeKind, const TCHAR*>& Category : Categories)
+    {
+        TArray<TPair<FString, FString>> CategoryTypes;
+        int32 TotalCount = 0;
+        if (!Service.QueryNodeTypes(Category.Key, true, Query, CategoryTypes, TotalCount, Error))
+        {
+            return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to get Blueprint StateTree types") : Error);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> TypesArray;
+        for (const TPair<FString, FString>& Type : CategoryTypes)
+        {
+            TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
+            TypeObj->SetStringField(TEXT("path"), Type.Key);
+            TypeObj->SetStringField(TEXT("name"), Type.Value);
+            TypesArray.Add(MakeShared<FJsonValueObject>(TypeObj));
+        }
+        Types->SetArrayField(FString(TEXT("blueprint_")) + Category.Value, TypesArray);
+        TotalCounts->SetNumberField(Category.Value, TotalCount);
+        bHasMore |= Query.Offset + CategoryTypes.Num() < TotalCount;
+    }
+    Types->SetObjectField(TEXT("total_counts"), TotalCounts);
+    Types->SetBoolField(TEXT("has_more"), bHasMore);
+
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetObjectField(TEXT("data"), Types);
@@ -37,6 +71,30 @@ bool FGetBlueprintStateTreeTypesCommand::ValidateParams(const FString& Parameter
     return true;
 }
 
+bool FGetBlueprintStateTreeTypesCommand::ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const
+{
+    // Every parameter is optional; callers without any send nothing
+    if (JsonString.TrimStartAndEnd().IsEmpty())
+    {
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        OutError = TEXT("Invalid JSON parameters");
+        return false;
+    }
+
+    JsonObject->TryGetStringField(TEXT("filter"), OutQuery.Filter);
+    JsonObject->TryGetNumberField(TEXT("offset"), OutQuery.Offset);
+    JsonObject->TryGetNumberField(TEXT("limit"), OutQuery.Limit);
+    OutQuery.Offset = FMath::Max(OutQuery.Offset, 0);
+    OutQuery.Limit = FMath::Max(OutQuery.Limit, 0);
+    return true;
+}
+
 FString FGetBlueprintStateTreeTypesCommand::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
@@ -0,0 +1,75 @@
+#include "Commands/StateTree/GetBulkStateTreeBindingValidationCommand.h"
+#include "Services/IStateTreeService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FGetBulkStateTreeBindingValidationCommand::FGetBulkStateTreeBindingValidationCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FGetBulkStateTreeBindingValidationCommand::Execute(const FString& Parameters)
+{
+    TSharedPtr<FJsonObject> ParamsObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+    {
+        return CreateErrorResponse(TEXT("Failed to parse parameters"));
+    }
+
+    int64 JobId = 0;
+    if (!ParamsObj->TryGetNumberField(TEXT("job_id"), JobId))
+    {
+        return CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    int32 Cursor = 0;
+    ParamsObj->TryGetNumberField(TEXT("cursor"), Cursor);
+    int32 MaxResults = 100;
+    ParamsObj->TryGetNumberField(TEXT("max_results"), MaxResults);
+
+    TSharedPtr<FJsonObject> Status;
+    FString Error;
+    if (!Service.GetBulkBindingValidation(JobId, Cursor, MaxResults, Status, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    // Trees with binding errors are still a successful poll; each result carries its own state
+    Status->SetBoolField(TEXT("success"), true);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Status.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FGetBulkStateTreeBindingValidationCommand::GetCommandName() const
+{
+    return TEXT("get_bulk_state_tree_binding_validation");
+}
+
+bool FGetBulkStateTreeBindingValidationCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> ParamsObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+    {
+        return false;
+    }
+
+    int64 JobId = 0;
+    return ParamsObj->TryGetNumberField(TEXT("job_id"), JobId);
+}
+
+FString FGetBulkStateTreeBindingValidationCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
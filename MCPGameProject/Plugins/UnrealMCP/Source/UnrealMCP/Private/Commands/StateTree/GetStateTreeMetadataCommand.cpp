@@ -30,10 +30,28 @@ FString FGetStateTreeMetadataCommand::Execute(const FString& Parameters)
         return CreateErrorResponse(FString::Printf(TEXT("StateTree not found: '%s'"), *StateTreePath));
     }
 
+    FStateTreeMetadataQuery Query;
+    JsonObject->TryGetStringField(TEXT("state_name"), Query.StateName);
+    JsonObject->TryGetNumberField(TEXT("max_depth"), Query.MaxDepth);
+    JsonObject->TryGetNumberField(TEXT("since_revision"), Query.SinceRevision);
+    const TArray<TSharedPtr<FJsonValue>>* FieldsArray = nullptr;
+    if (JsonObject->TryGetArrayField(TEXT("fields"), FieldsArray) && FieldsArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *FieldsArray)
+        {
+            FString Field;
+            if (Value->TryGetString(Field) && !Field.IsEmpty())
+            {
+                Query.Fields.Add(Field);
+            }
+        }
+    }
+
     TSharedPtr<FJsonObject> MetadataObj;
-    if (!Service.GetStateTreeMetadata(StateTree, MetadataObj))
+    FString Error;
+    if (!Service.GetStateTreeMetadata(StateTree, Query, MetadataObj, Error))
     {
-        return CreateErrorResponse(TEXT("Failed to retrieve metadata"));
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to retrieve metadata") : Error);
     }
 
     // Wrap in success response
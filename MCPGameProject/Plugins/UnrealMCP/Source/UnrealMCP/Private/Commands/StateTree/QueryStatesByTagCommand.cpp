@@ -21,6 +21,7 @@ FString FQueryStatesByTagCommand::Execute(const FString& Parameters)
     Params.StateTreePath = ParamsObj->GetStringField(TEXT("state_tree_path"));
     Params.GameplayTag = ParamsObj->GetStringField(TEXT("gameplay_tag"));
     ParamsObj->TryGetBoolField(TEXT("exact_match"), Params.bExactMatch);
+    ParamsObj->TryGetBoolField(TEXT("include_linked"), Params.bIncludeLinked);
 
     FString ValidationError;
     if (!Params.IsValid(ValidationError))
@@ -29,7 +30,8 @@ FString FQueryStatesByTagCommand::Execute(const FString& Parameters)
     }
 
     TArray<FString> States;
-    if (!Service.QueryStatesByTag(Params, States))
+    TArray<FLinkedStateTagMatch> LinkedStates;
+    if (!Service.QueryStatesByTag(Params, States, LinkedStates))
     {
         return CreateErrorResponse(TEXT("Failed to query states by tag"));
     }
@@ -40,10 +42,25 @@ FString FQueryStatesByTagCommand::Execute(const FString& Parameters)
         StatesArray.Add(MakeShared<FJsonValueString>(StateName));
     }
 
+    TArray<TSharedPtr<FJsonValue>> LinkedStatesArray;
+    for (const FLinkedStateTagMatch& LinkedState : LinkedStates)
+    {
+        TSharedPtr<FJsonObject> LinkedStateObj = MakeShared<FJsonObject>();
+        LinkedStateObj->SetStringField(TEXT("state_tree_path"), LinkedState.StateTreePath);
+        LinkedStateObj->SetStringField(TEXT("state_name"), LinkedState.StateName);
+        LinkedStateObj->SetStringField(TEXT("state_id"), LinkedState.StateId);
+        LinkedStatesArray.Add(MakeShared<FJsonValueObject>(LinkedStateObj));
+    }
+
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
     ResponseObj->SetBoolField(TEXT("success"), true);
     ResponseObj->SetArrayField(TEXT("states"), StatesArray);
     ResponseObj->SetNumberField(TEXT("count"), States.Num());
+    if (Params.bIncludeLinked)
+    {
+        ResponseObj->SetArrayField(TEXT("linked_states"), LinkedStatesArray);
+        ResponseObj->SetNumberField(TEXT("linked_count"), LinkedStates.Num());
+    }
 
     FString OutputString;
     TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
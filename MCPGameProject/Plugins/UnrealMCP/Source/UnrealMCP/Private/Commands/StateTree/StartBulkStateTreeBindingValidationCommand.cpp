@@ -0,0 +1,99 @@
+#include "Commands/StateTree/StartBulkStateTreeBindingValidationCommand.h"
+#include "Services/IStateTreeService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FStartBulkStateTreeBindingValidationCommand::FStartBulkStateTreeBindingValidationCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FStartBulkStateTreeBindingValidationCommand::Execute(const FString& Parameters)
+{
+    FBulkBindingValidationParams Params;
+    FString Error;
+
+    if (!ParseParameters(Parameters, Params, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    int64 JobId = 0;
+    int32 TreeCount = 0;
+    if (!Service.StartBulkBindingValidation(Params.StateTreePaths, Params.PackagePath, Params.MaxInFlight, JobId, TreeCount, Error))
+    {
+        return CreateErrorResponse(Error);
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    ResponseObj->SetNumberField(TEXT("trees_total"), TreeCount);
+    ResponseObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Validating the bindings of %d StateTree(s); read the results with get_bulk_state_tree_binding_validation"), TreeCount));
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FStartBulkStateTreeBindingValidationCommand::GetCommandName() const
+{
+    return TEXT("start_bulk_state_tree_binding_validation");
+}
+
+bool FStartBulkStateTreeBindingValidationCommand::ValidateParams(const FString& Parameters) const
+{
+    FBulkBindingValidationParams Params;
+    FString Error;
+    return ParseParameters(Parameters, Params, Error);
+}
+
+bool FStartBulkStateTreeBindingValidationCommand::ParseParameters(const FString& JsonString, FBulkBindingValidationParams& OutParams, FString& OutError) const
+{
+    TSharedPtr<FJsonObject> ParamsObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+    if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+    {
+        OutError = TEXT("Failed to parse parameters");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* StateTreesArray = nullptr;
+    if (ParamsObj->TryGetArrayField(TEXT("state_trees"), StateTreesArray) && StateTreesArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *StateTreesArray)
+        {
+            FString StateTreePath;
+            if (Value->TryGetString(StateTreePath) && !StateTreePath.IsEmpty())
+            {
+                OutParams.StateTreePaths.Add(StateTreePath);
+            }
+        }
+    }
+
+    ParamsObj->TryGetStringField(TEXT("path"), OutParams.PackagePath);
+
+    if (OutParams.StateTreePaths.Num() == 0 && OutParams.PackagePath.IsEmpty())
+    {
+        OutError = TEXT("Either 'state_trees' or 'path' is required");
+        return false;
+    }
+
+    ParamsObj->TryGetNumberField(TEXT("max_in_flight"), OutParams.MaxInFlight);
+
+    return true;
+}
+
+FString FStartBulkStateTreeBindingValidationCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
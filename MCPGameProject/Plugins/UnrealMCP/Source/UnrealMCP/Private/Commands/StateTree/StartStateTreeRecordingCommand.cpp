@@ -0,0 +1,67 @@
+#include "Commands/StateTree/StartStateTreeRecordingCommand.h"
+#include "Services/IStateTreeService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FStartStateTreeRecordingCommand::FStartStateTreeRecordingCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FStartStateTreeRecordingCommand::Execute(const FString& Parameters)
+{
+    FString StateTreePath;
+    int32 Capacity = 0;
+
+    // Every parameter is optional; callers without any send nothing
+    if (!Parameters.TrimStartAndEnd().IsEmpty())
+    {
+        TSharedPtr<FJsonObject> ParamsObj;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+        if (!FJsonSerializer::Deserialize(Reader, ParamsObj) || !ParamsObj.IsValid())
+        {
+            return CreateErrorResponse(TEXT("Failed to parse parameters"));
+        }
+        ParamsObj->TryGetStringField(TEXT("state_tree_path"), StateTreePath);
+        ParamsObj->TryGetNumberField(TEXT("capacity"), Capacity);
+    }
+
+    FString Error;
+    if (!Service.StartStateTreeRecording(StateTreePath, Capacity, Error))
+    {
+        return CreateErrorResponse(Error.IsEmpty() ? TEXT("Failed to start StateTree recording") : Error);
+    }
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetBoolField(TEXT("recording"), true);
+    ResponseObj->SetStringField(TEXT("state_tree_path"), StateTreePath);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FStartStateTreeRecordingCommand::GetCommandName() const
+{
+    return TEXT("start_state_tree_recording");
+}
+
+bool FStartStateTreeRecordingCommand::ValidateParams(const FString& Parameters) const
+{
+    // No required parameters
+    return true;
+}
+
+FString FStartStateTreeRecordingCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
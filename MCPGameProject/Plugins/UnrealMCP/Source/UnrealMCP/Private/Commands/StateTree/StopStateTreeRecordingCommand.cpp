@@ -0,0 +1,47 @@
+#include "Commands/StateTree/StopStateTreeRecordingCommand.h"
+#include "Services/IStateTreeService.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+
+FStopStateTreeRecordingCommand::FStopStateTreeRecordingCommand(IStateTreeService& InService)
+    : Service(InService)
+{
+}
+
+FString FStopStateTreeRecordingCommand::Execute(const FString& Parameters)
+{
+    const bool bWasRecording = Service.StopStateTreeRecording();
+
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetBoolField(TEXT("recording"), false);
+    ResponseObj->SetBoolField(TEXT("was_recording"), bWasRecording);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+FString FStopStateTreeRecordingCommand::GetCommandName() const
+{
+    return TEXT("stop_state_tree_recording");
+}
+
+bool FStopStateTreeRecordingCommand::ValidateParams(const FString& Parameters) const
+{
+    // No required parameters
+    return true;
+}
+
+FString FStopStateTreeRecordingCommand::CreateErrorResponse(const FString& ErrorMessage) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), ErrorMessage);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResponseObj.ToSharedRef(), Writer);
+    return OutputString;
+}
@@ -89,10 +89,16 @@
 // Section 15 - Batch Operations Commands
 #include "Commands/StateTree/BatchAddStatesCommand.h"
 #include "Commands/StateTree/BatchAddTransitionsCommand.h"
+#include "Commands/StateTree/BuildStateTreeFromSpecCommand.h"
+#include "Commands/StateTree/BatchSetNodePropertiesCommand.h"
 
 // Section 16 - Validation and Debugging Commands
 #include "Commands/StateTree/ValidateAllBindingsCommand.h"
+#include "Commands/StateTree/StartBulkStateTreeBindingValidationCommand.h"
+#include "Commands/StateTree/GetBulkStateTreeBindingValidationCommand.h"
 #include "Commands/StateTree/GetStateExecutionHistoryCommand.h"
+#include "Commands/StateTree/StartStateTreeRecordingCommand.h"
+#include "Commands/StateTree/StopStateTreeRecordingCommand.h"
 
 // Static member definition
 TArray<FString> FStateTreeCommandRegistration::RegisteredCommandNames;
@@ -191,10 +197,16 @@ void FStateTreeCommandRegistration::RegisterAllStateTreeCommands()
     // Section 15 - Batch Operations Commands
     RegisterBatchAddStatesCommand();
     RegisterBatchAddTransitionsCommand();
+    RegisterBuildStateTreeFromSpecCommand();
+    RegisterBatchSetNodePropertiesCommand();
 
     // Section 16 - Validation and Debugging Commands
     RegisterValidateAllBindingsCommand();
+    RegisterStartBulkStateTreeBindingValidationCommand();
+    RegisterGetBulkStateTreeBindingValidationCommand();
     RegisterGetStateExecutionHistoryCommand();
+    RegisterStartStateTreeRecordingCommand();
+    RegisterStopStateTreeRecordingCommand();
 
     UE_LOG(LogTemp, Log, TEXT("FStateTreeCommandRegistration::RegisterAllStateTreeCommands: Registered %d StateTree commands"),
         RegisteredCommandNames.Num());
@@ -225,381 +237,344 @@ void FStateTreeCommandRegistration::UnregisterAllStateTreeCommands()
 
 void FStateTreeCommandRegistration::RegisterCreateStateTreeCommand()
 {
-    TSharedPtr<FCreateStateTreeCommand> Command = MakeShared<FCreateStateTreeCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_state_tree"), []() { return MakeShared<FCreateStateTreeCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterAddStateCommand()
 {
-    TSharedPtr<FAddStateCommand> Command = MakeShared<FAddStateCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_state"), []() { return MakeShared<FAddStateCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterAddTransitionCommand()
 {
-    TSharedPtr<FAddTransitionCommand> Command = MakeShared<FAddTransitionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_transition"), []() { return MakeShared<FAddTransitionCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterAddTaskToStateCommand()
 {
-    TSharedPtr<FAddTaskToStateCommand> Command = MakeShared<FAddTaskToStateCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_task_to_state"), []() { return MakeShared<FAddTaskToStateCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterCompileStateTreeCommand()
 {
-    TSharedPtr<FCompileStateTreeCommand> Command = MakeShared<FCompileStateTreeCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("compile_state_tree"), []() { return MakeShared<FCompileStateTreeCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetStateTreeMetadataCommand()
 {
-    TSharedPtr<FGetStateTreeMetadataCommand> Command = MakeShared<FGetStateTreeMetadataCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_state_tree_metadata"), []() { return MakeShared<FGetStateTreeMetadataCommand>(FStateTreeService::Get()); });
 }
 
 // Tier 2 - Advanced Commands
 
 void FStateTreeCommandRegistration::RegisterAddConditionToTransitionCommand()
 {
-    TSharedPtr<FAddConditionToTransitionCommand> Command = MakeShared<FAddConditionToTransitionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_condition_to_transition"), []() { return MakeShared<FAddConditionToTransitionCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterAddEnterConditionCommand()
 {
-    TSharedPtr<FAddEnterConditionCommand> Command = MakeShared<FAddEnterConditionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_enter_condition"), []() { return MakeShared<FAddEnterConditionCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterAddEvaluatorCommand()
 {
-    TSharedPtr<FAddEvaluatorCommand> Command = MakeShared<FAddEvaluatorCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_evaluator"), []() { return MakeShared<FAddEvaluatorCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetStateParametersCommand()
 {
-    TSharedPtr<FSetStateParametersCommand> Command = MakeShared<FSetStateParametersCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_state_parameters"), []() { return MakeShared<FSetStateParametersCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveStateCommand()
 {
-    TSharedPtr<FRemoveStateCommand> Command = MakeShared<FRemoveStateCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_state"), []() { return MakeShared<FRemoveStateCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveTransitionCommand()
 {
-    TSharedPtr<FRemoveTransitionCommand> Command = MakeShared<FRemoveTransitionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_transition"), []() { return MakeShared<FRemoveTransitionCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterDuplicateStateTreeCommand()
 {
-    TSharedPtr<FDuplicateStateTreeCommand> Command = MakeShared<FDuplicateStateTreeCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("duplicate_state_tree"), []() { return MakeShared<FDuplicateStateTreeCommand>(FStateTreeService::Get()); });
 }
 
 // Tier 3 - Introspection Commands
 
 void FStateTreeCommandRegistration::RegisterGetStateTreeDiagnosticsCommand()
 {
-    TSharedPtr<FGetStateTreeDiagnosticsCommand> Command = MakeShared<FGetStateTreeDiagnosticsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_state_tree_diagnostics"), []() { return MakeShared<FGetStateTreeDiagnosticsCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetAvailableTasksCommand()
 {
-    TSharedPtr<FGetAvailableTasksCommand> Command = MakeShared<FGetAvailableTasksCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_available_tasks"), []() { return MakeShared<FGetAvailableTasksCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetAvailableConditionsCommand()
 {
-    TSharedPtr<FGetAvailableConditionsCommand> Command = MakeShared<FGetAvailableConditionsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_available_conditions"), []() { return MakeShared<FGetAvailableConditionsCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetAvailableEvaluatorsCommand()
 {
-    TSharedPtr<FGetAvailableEvaluatorsCommand> Command = MakeShared<FGetAvailableEvaluatorsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_available_evaluators"), []() { return MakeShared<FGetAvailableEvaluatorsCommand>(FStateTreeService::Get()); });
 }
 
 // Section 1 - Property Binding Commands
 
 void FStateTreeCommandRegistration::RegisterBindPropertyCommand()
 {
-    TSharedPtr<FBindPropertyCommand> Command = MakeShared<FBindPropertyCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("bind_state_tree_property"), []() { return MakeShared<FBindPropertyCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveBindingCommand()
 {
-    TSharedPtr<FRemoveBindingCommand> Command = MakeShared<FRemoveBindingCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_state_tree_binding"), []() { return MakeShared<FRemoveBindingCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetNodeBindableInputsCommand()
 {
-    TSharedPtr<FGetNodeBindableInputsCommand> Command = MakeShared<FGetNodeBindableInputsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_node_bindable_inputs"), []() { return MakeShared<FGetNodeBindableInputsCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetNodeExposedOutputsCommand()
 {
-    TSharedPtr<FGetNodeExposedOutputsCommand> Command = MakeShared<FGetNodeExposedOutputsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_node_exposed_outputs"), []() { return MakeShared<FGetNodeExposedOutputsCommand>(FStateTreeService::Get()); });
 }
 
 // Section 2 - Schema/Context Configuration Commands
 
 void FStateTreeCommandRegistration::RegisterGetSchemaContextPropertiesCommand()
 {
-    TSharedPtr<FGetSchemaContextPropertiesCommand> Command = MakeShared<FGetSchemaContextPropertiesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_schema_context_properties"), []() { return MakeShared<FGetSchemaContextPropertiesCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetContextRequirementsCommand()
 {
-    TSharedPtr<FSetContextRequirementsCommand> Command = MakeShared<FSetContextRequirementsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_context_requirements"), []() { return MakeShared<FSetContextRequirementsCommand>(FStateTreeService::Get()); });
 }
 
 // Section 3 - Blueprint Type Support
 
 void FStateTreeCommandRegistration::RegisterGetBlueprintStateTreeTypesCommand()
 {
-    TSharedPtr<FGetBlueprintStateTreeTypesCommand> Command = MakeShared<FGetBlueprintStateTreeTypesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_blueprint_state_tree_types"), []() { return MakeShared<FGetBlueprintStateTreeTypesCommand>(FStateTreeService::Get()); });
 }
 
 // Section 4 - Global Tasks Commands
 
 void FStateTreeCommandRegistration::RegisterAddGlobalTaskCommand()
 {
-    TSharedPtr<FAddGlobalTaskCommand> Command = MakeShared<FAddGlobalTaskCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_global_task"), []() { return MakeShared<FAddGlobalTaskCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveGlobalTaskCommand()
 {
-    TSharedPtr<FRemoveGlobalTaskCommand> Command = MakeShared<FRemoveGlobalTaskCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_global_task"), []() { return MakeShared<FRemoveGlobalTaskCommand>(FStateTreeService::Get()); });
 }
 
 // Section 5 - State Completion Configuration Commands
 
 void FStateTreeCommandRegistration::RegisterSetStateCompletionModeCommand()
 {
-    TSharedPtr<FSetStateCompletionModeCommand> Command = MakeShared<FSetStateCompletionModeCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_state_completion_mode"), []() { return MakeShared<FSetStateCompletionModeCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetTaskRequiredCommand()
 {
-    TSharedPtr<FSetTaskRequiredCommand> Command = MakeShared<FSetTaskRequiredCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_task_required"), []() { return MakeShared<FSetTaskRequiredCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetLinkedStateAssetCommand()
 {
-    TSharedPtr<FSetLinkedStateAssetCommand> Command = MakeShared<FSetLinkedStateAssetCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_linked_state_asset"), []() { return MakeShared<FSetLinkedStateAssetCommand>(FStateTreeService::Get()); });
 }
 
 // Section 6 - Quest Persistence Commands
 
 void FStateTreeCommandRegistration::RegisterConfigureStatePersistenceCommand()
 {
-    TSharedPtr<FConfigureStatePersistenceCommand> Command = MakeShared<FConfigureStatePersistenceCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("configure_state_persistence"), []() { return MakeShared<FConfigureStatePersistenceCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetPersistentStateDataCommand()
 {
-    TSharedPtr<FGetPersistentStateDataCommand> Command = MakeShared<FGetPersistentStateDataCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_persistent_state_data"), []() { return MakeShared<FGetPersistentStateDataCommand>(FStateTreeService::Get()); });
 }
 
 // Section 7 - Gameplay Tag Integration Commands
 
 void FStateTreeCommandRegistration::RegisterAddGameplayTagToStateCommand()
 {
-    TSharedPtr<FAddGameplayTagToStateCommand> Command = MakeShared<FAddGameplayTagToStateCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_gameplay_tag_to_state"), []() { return MakeShared<FAddGameplayTagToStateCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterQueryStatesByTagCommand()
 {
-    TSharedPtr<FQueryStatesByTagCommand> Command = MakeShared<FQueryStatesByTagCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("query_states_by_tag"), []() { return MakeShared<FQueryStatesByTagCommand>(FStateTreeService::Get()); });
 }
 
 // Section 8 - Runtime Inspection Commands
 
 void FStateTreeCommandRegistration::RegisterGetActiveStateTreeStatusCommand()
 {
-    TSharedPtr<FGetActiveStateTreeStatusCommand> Command = MakeShared<FGetActiveStateTreeStatusCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_active_state_tree_status"), []() { return MakeShared<FGetActiveStateTreeStatusCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetCurrentActiveStatesCommand()
 {
-    TSharedPtr<FGetCurrentActiveStatesCommand> Command = MakeShared<FGetCurrentActiveStatesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_current_active_states"), []() { return MakeShared<FGetCurrentActiveStatesCommand>(FStateTreeService::Get()); });
 }
 
 // Section 9 - Utility AI Consideration
 
 void FStateTreeCommandRegistration::RegisterAddConsiderationCommand()
 {
-    TSharedPtr<FAddConsiderationCommand> Command = MakeShared<FAddConsiderationCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_consideration"), []() { return MakeShared<FAddConsiderationCommand>(FStateTreeService::Get()); });
 }
 
 // Section 10 - Task/Evaluator Modification Commands
 
 void FStateTreeCommandRegistration::RegisterRemoveTaskFromStateCommand()
 {
-    TSharedPtr<FRemoveTaskFromStateCommand> Command = MakeShared<FRemoveTaskFromStateCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_task_from_state"), []() { return MakeShared<FRemoveTaskFromStateCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetTaskPropertiesCommand()
 {
-    TSharedPtr<FSetTaskPropertiesCommand> Command = MakeShared<FSetTaskPropertiesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_task_properties"), []() { return MakeShared<FSetTaskPropertiesCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveEvaluatorCommand()
 {
-    TSharedPtr<FRemoveEvaluatorCommand> Command = MakeShared<FRemoveEvaluatorCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_evaluator"), []() { return MakeShared<FRemoveEvaluatorCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetEvaluatorPropertiesCommand()
 {
-    TSharedPtr<FSetEvaluatorPropertiesCommand> Command = MakeShared<FSetEvaluatorPropertiesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_evaluator_properties"), []() { return MakeShared<FSetEvaluatorPropertiesCommand>(FStateTreeService::Get()); });
 }
 
 // Section 11 - Condition Removal Commands
 
 void FStateTreeCommandRegistration::RegisterRemoveConditionFromTransitionCommand()
 {
-    TSharedPtr<FRemoveConditionFromTransitionCommand> Command = MakeShared<FRemoveConditionFromTransitionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_condition_from_transition"), []() { return MakeShared<FRemoveConditionFromTransitionCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterRemoveEnterConditionCommand()
 {
-    TSharedPtr<FRemoveEnterConditionCommand> Command = MakeShared<FRemoveEnterConditionCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_enter_condition"), []() { return MakeShared<FRemoveEnterConditionCommand>(FStateTreeService::Get()); });
 }
 
 // Section 12 - Transition Inspection/Modification Commands
 
 void FStateTreeCommandRegistration::RegisterGetTransitionInfoCommand()
 {
-    TSharedPtr<FGetTransitionInfoCommand> Command = MakeShared<FGetTransitionInfoCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_transition_info"), []() { return MakeShared<FGetTransitionInfoCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetTransitionPropertiesCommand()
 {
-    TSharedPtr<FSetTransitionPropertiesCommand> Command = MakeShared<FSetTransitionPropertiesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_transition_properties"), []() { return MakeShared<FSetTransitionPropertiesCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetTransitionConditionsCommand()
 {
-    TSharedPtr<FGetTransitionConditionsCommand> Command = MakeShared<FGetTransitionConditionsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_transition_conditions"), []() { return MakeShared<FGetTransitionConditionsCommand>(FStateTreeService::Get()); });
 }
 
 // Section 13 - State Event Handler Commands
 
 void FStateTreeCommandRegistration::RegisterAddStateEventHandlerCommand()
 {
-    TSharedPtr<FAddStateEventHandlerCommand> Command = MakeShared<FAddStateEventHandlerCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_state_event_handler"), []() { return MakeShared<FAddStateEventHandlerCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterConfigureStateNotificationsCommand()
 {
-    TSharedPtr<FConfigureStateNotificationsCommand> Command = MakeShared<FConfigureStateNotificationsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("configure_state_notifications"), []() { return MakeShared<FConfigureStateNotificationsCommand>(FStateTreeService::Get()); });
 }
 
 // Section 14 - Linked State Configuration Commands
 
 void FStateTreeCommandRegistration::RegisterGetLinkedStateInfoCommand()
 {
-    TSharedPtr<FGetLinkedStateInfoCommand> Command = MakeShared<FGetLinkedStateInfoCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_linked_state_info"), []() { return MakeShared<FGetLinkedStateInfoCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetLinkedStateParametersCommand()
 {
-    TSharedPtr<FSetLinkedStateParametersCommand> Command = MakeShared<FSetLinkedStateParametersCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_linked_state_parameters"), []() { return MakeShared<FSetLinkedStateParametersCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterSetStateSelectionWeightCommand()
 {
-    TSharedPtr<FSetStateSelectionWeightCommand> Command = MakeShared<FSetStateSelectionWeightCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_state_selection_weight"), []() { return MakeShared<FSetStateSelectionWeightCommand>(FStateTreeService::Get()); });
 }
 
 // Section 15 - Batch Operations Commands
 
 void FStateTreeCommandRegistration::RegisterBatchAddStatesCommand()
 {
-    TSharedPtr<FBatchAddStatesCommand> Command = MakeShared<FBatchAddStatesCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("batch_add_states"), []() { return MakeShared<FBatchAddStatesCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterBatchAddTransitionsCommand()
 {
-    TSharedPtr<FBatchAddTransitionsCommand> Command = MakeShared<FBatchAddTransitionsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("batch_add_transitions"), []() { return MakeShared<FBatchAddTransitionsCommand>(FStateTreeService::Get()); });
+}
+
+void FStateTreeCommandRegistration::RegisterBuildStateTreeFromSpecCommand()
+{
+    RegisterAndTrackCommand(TEXT("build_state_tree_from_spec"), []() { return MakeShared<FBuildStateTreeFromSpecCommand>(FStateTreeService::Get()); });
+}
+
+void FStateTreeCommandRegistration::RegisterBatchSetNodePropertiesCommand()
+{
+    RegisterAndTrackCommand(TEXT("batch_set_node_properties"), []() { return MakeShared<FBatchSetNodePropertiesCommand>(FStateTreeService::Get()); });
 }
 
 // Section 16 - Validation and Debugging Commands
 
 void FStateTreeCommandRegistration::RegisterValidateAllBindingsCommand()
 {
-    TSharedPtr<FValidateAllBindingsCommand> Command = MakeShared<FValidateAllBindingsCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("validate_all_bindings"), []() { return MakeShared<FValidateAllBindingsCommand>(FStateTreeService::Get()); });
+}
+
+void FStateTreeCommandRegistration::RegisterStartBulkStateTreeBindingValidationCommand()
+{
+    RegisterAndTrackCommand(TEXT("start_bulk_state_tree_binding_validation"), []() { return MakeShared<FStartBulkStateTreeBindingValidationCommand>(FStateTreeService::Get()); });
+}
+
+void FStateTreeCommandRegistration::RegisterGetBulkStateTreeBindingValidationCommand()
+{
+    RegisterAndTrackCommand(TEXT("get_bulk_state_tree_binding_validation"), []() { return MakeShared<FGetBulkStateTreeBindingValidationCommand>(FStateTreeService::Get()); });
 }
 
 void FStateTreeCommandRegistration::RegisterGetStateExecutionHistoryCommand()
 {
-    TSharedPtr<FGetStateExecutionHistoryCommand> Command = MakeShared<FGetStateExecutionHistoryCommand>(FStateTreeService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_state_execution_history"), []() { return MakeShared<FGetStateExecutionHistoryCommand>(FStateTreeService::Get()); });
 }
 
-void FStateTreeCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FStateTreeCommandRegistration::RegisterStartStateTreeRecordingCommand()
 {
-    if (!Command.IsValid())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FStateTreeCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
+    RegisterAndTrackCommand(TEXT("start_state_tree_recording"), []() { return MakeShared<FStartStateTreeRecordingCommand>(FStateTreeService::Get()); });
+}
 
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
-    {
-        UE_LOG(LogTemp, Error, TEXT("FStateTreeCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
+void FStateTreeCommandRegistration::RegisterStopStateTreeRecordingCommand()
+{
+    RegisterAndTrackCommand(TEXT("stop_state_tree_recording"), []() { return MakeShared<FStopStateTreeRecordingCommand>(FStateTreeService::Get()); });
+}
 
+void FStateTreeCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
+{
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FStateTreeCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
@@ -0,0 +1,144 @@
+#include "Commands/UMG/BatchUpdateWidgetsCommand.h"
+#include "Services/UMG/IUMGService.h"
+#include "MCPErrorHandler.h"
+#include "MCPError.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+FBatchUpdateWidgetsCommand::FBatchUpdateWidgetsCommand(TSharedPtr<IUMGService> InUMGService)
+    : UMGService(InUMGService)
+{
+}
+
+FString FBatchUpdateWidgetsCommand::Execute(const FString& Parameters)
+{
+    // Parse JSON parameters
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        FMCPError Error = FMCPErrorHandler::CreateValidationFailedError(TEXT("Invalid JSON parameters"));
+        TSharedPtr<FJsonObject> ErrorResponse = CreateErrorResponse(Error);
+
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
+        return OutputString;
+    }
+
+    // Use internal execution with JSON objects
+    TSharedPtr<FJsonObject> Response = ExecuteInternal(JsonObject);
+
+    // Convert response back to string
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FBatchUpdateWidgetsCommand::ExecuteInternal(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!UMGService.IsValid())
+    {
+        FMCPError Error = FMCPErrorHandler::CreateInternalError(TEXT("UMG Service is not available"));
+        return CreateErrorResponse(Error);
+    }
+
+    // Validate parameters
+    FString ValidationError;
+    if (!ValidateParamsInternal(Params, ValidationError))
+    {
+        FMCPError Error = FMCPErrorHandler::CreateValidationFailedError(ValidationError);
+        return CreateErrorResponse(Error);
+    }
+
+    // Extract parameters
+    FString WidgetName = Params->GetStringField(TEXT("widget_name"));
+    TArray<TSharedPtr<FJsonObject>> Updates;
+    for (const TSharedPtr<FJsonValue>& UpdateValue : Params->GetArrayField(TEXT("updates")))
+    {
+        Updates.Add(UpdateValue->AsObject());
+    }
+
+    // Use the UMG service to apply every update at once
+    TSharedPtr<FJsonObject> Result;
+    FString UpdateError;
+    if (!UMGService->UpdateWidgets(WidgetName, Updates, Result, UpdateError))
+    {
+        FString ErrorMessage = FString::Printf(TEXT("Failed to update widgets in '%s': %s"), *WidgetName, *UpdateError);
+        FMCPError Error = FMCPErrorHandler::CreateExecutionFailedError(ErrorMessage);
+        return CreateErrorResponse(Error);
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    return Result;
+}
+
+FString FBatchUpdateWidgetsCommand::GetCommandName() const
+{
+    return TEXT("batch_update_widgets");
+}
+
+bool FBatchUpdateWidgetsCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString ValidationError;
+    return ValidateParamsInternal(JsonObject, ValidationError);
+}
+
+bool FBatchUpdateWidgetsCommand::ValidateParamsInternal(const TSharedPtr<FJsonObject>& Params, FString& OutError) const
+{
+    FString WidgetName;
+    if (!Params->TryGetStringField(TEXT("widget_name"), WidgetName) || WidgetName.IsEmpty())
+    {
+        OutError = TEXT("Missing or empty 'widget_name' parameter");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Updates = nullptr;
+    if (!Params->TryGetArrayField(TEXT("updates"), Updates) || Updates->Num() == 0)
+    {
+        OutError = TEXT("Missing or empty 'updates' array parameter");
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& UpdateValue : *Updates)
+    {
+        const TSharedPtr<FJsonObject>* Update = nullptr;
+        if (!UpdateValue.IsValid() || !UpdateValue->TryGetObject(Update))
+        {
+            OutError = TEXT("Every entry of 'updates' must be an object");
+            return false;
+        }
+
+        FString ComponentName;
+        if (!(*Update)->TryGetStringField(TEXT("component_name"), ComponentName) || ComponentName.IsEmpty())
+        {
+            OutError = TEXT("Every entry of 'updates' needs a 'component_name'");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TSharedPtr<FJsonObject> FBatchUpdateWidgetsCommand::CreateErrorResponse(const FMCPError& Error) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), Error.ErrorMessage);
+    ResponseObj->SetStringField(TEXT("error_details"), Error.ErrorDetails);
+    ResponseObj->SetNumberField(TEXT("error_code"), Error.ErrorCode);
+
+    return ResponseObj;
+}
@@ -0,0 +1,125 @@
+#include "Commands/UMG/BuildWidgetTreeCommand.h"
+#include "Services/UMG/IUMGService.h"
+#include "MCPErrorHandler.h"
+#include "MCPError.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+
+FBuildWidgetTreeCommand::FBuildWidgetTreeCommand(TSharedPtr<IUMGService> InUMGService)
+    : UMGService(InUMGService)
+{
+}
+
+FString FBuildWidgetTreeCommand::Execute(const FString& Parameters)
+{
+    // Parse JSON parameters
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        FMCPError Error = FMCPErrorHandler::CreateValidationFailedError(TEXT("Invalid JSON parameters"));
+        TSharedPtr<FJsonObject> ErrorResponse = CreateErrorResponse(Error);
+
+        FString OutputString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+        FJsonSerializer::Serialize(ErrorResponse.ToSharedRef(), Writer);
+        return OutputString;
+    }
+
+    // Use internal execution with JSON objects
+    TSharedPtr<FJsonObject> Response = ExecuteInternal(JsonObject);
+
+    // Convert response back to string
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
+    return OutputString;
+}
+
+TSharedPtr<FJsonObject> FBuildWidgetTreeCommand::ExecuteInternal(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!UMGService.IsValid())
+    {
+        FMCPError Error = FMCPErrorHandler::CreateInternalError(TEXT("UMG Service is not available"));
+        return CreateErrorResponse(Error);
+    }
+
+    // Validate parameters
+    FString ValidationError;
+    if (!ValidateParamsInternal(Params, ValidationError))
+    {
+        FMCPError Error = FMCPErrorHandler::CreateValidationFailedError(ValidationError);
+        return CreateErrorResponse(Error);
+    }
+
+    // Extract parameters
+    FString WidgetName = Params->GetStringField(TEXT("widget_name"));
+    FString ParentName;
+    Params->TryGetStringField(TEXT("parent_name"), ParentName);
+    TSharedPtr<FJsonObject> TreeSpec = Params->GetObjectField(TEXT("root"));
+
+    // Use the UMG service to build the tree
+    TSharedPtr<FJsonObject> Result;
+    FString BuildError;
+    if (!UMGService->BuildWidgetTree(WidgetName, ParentName, TreeSpec, Result, BuildError))
+    {
+        FString ErrorMessage = FString::Printf(TEXT("Failed to build widget tree in '%s': %s"), *WidgetName, *BuildError);
+        FMCPError Error = FMCPErrorHandler::CreateExecutionFailedError(ErrorMessage);
+        return CreateErrorResponse(Error);
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    return Result;
+}
+
+FString FBuildWidgetTreeCommand::GetCommandName() const
+{
+    return TEXT("build_widget_tree");
+}
+
+bool FBuildWidgetTreeCommand::ValidateParams(const FString& Parameters) const
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        return false;
+    }
+
+    FString ValidationError;
+    return ValidateParamsInternal(JsonObject, ValidationError);
+}
+
+bool FBuildWidgetTreeCommand::ValidateParamsInternal(const TSharedPtr<FJsonObject>& Params, FString& OutError) const
+{
+    FString WidgetName;
+    if (!Params->TryGetStringField(TEXT("widget_name"), WidgetName) || WidgetName.IsEmpty())
+    {
+        OutError = TEXT("Missing or empty 'widget_name' parameter");
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* TreeSpec = nullptr;
+    if (!Params->TryGetObjectField(TEXT("root"), TreeSpec))
+    {
+        OutError = TEXT("Missing or invalid 'root' widget spec parameter");
+        return false;
+    }
+
+    return true;
+}
+
+TSharedPtr<FJsonObject> FBuildWidgetTreeCommand::CreateErrorResponse(const FMCPError& Error) const
+{
+    TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), false);
+    ResponseObj->SetStringField(TEXT("error"), Error.ErrorMessage);
+    ResponseObj->SetStringField(TEXT("error_details"), Error.ErrorDetails);
+    ResponseObj->SetNumberField(TEXT("error_code"), Error.ErrorCode);
+
+    return ResponseObj;
+}
@@ -2,6 +2,7 @@
 #include "Services/UMG/IUMGService.h"
 #include "MCPErrorHandler.h"
 #include "MCPError.h"
+#include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -64,12 +65,45 @@ TSharedPtr<FJsonObject> FCaptureWidgetScreenshotCommand::ExecuteInternal(const T
 
 	// Delegate to service layer
 	TSharedPtr<FJsonObject> ScreenshotData;
-	bool bSuccess = UMGService->CaptureWidgetScreenshot(
-		ScreenshotParams.WidgetName,
-		ScreenshotParams.Width,
-		ScreenshotParams.Height,
-		ScreenshotParams.Format,
-		ScreenshotData);
+	bool bSuccess = false;
+	if (IsInGameThread())
+	{
+		// Nothing would tick the readback while this thread waits for it
+		bSuccess = UMGService->CaptureWidgetScreenshot(
+			ScreenshotParams.WidgetName,
+			ScreenshotParams.Width,
+			ScreenshotParams.Height,
+			ScreenshotParams.ImageOptions,
+			ScreenshotData);
+	}
+	else
+	{
+		TSharedRef<TPromise<TSharedPtr<FJsonObject>>> Promise = MakeShared<TPromise<TSharedPtr<FJsonObject>>>();
+		TFuture<TSharedPtr<FJsonObject>> Future = Promise->GetFuture();
+		TSharedPtr<IUMGService> Service = UMGService;
+		AsyncTask(ENamedThreads::GameThread, [Service, ScreenshotParams, Promise]()
+		{
+			Service->CaptureWidgetScreenshotAsync(
+				ScreenshotParams.WidgetName,
+				ScreenshotParams.Width,
+				ScreenshotParams.Height,
+				ScreenshotParams.ImageOptions,
+				[Promise](TSharedPtr<FJsonObject> CapturedData)
+				{
+					Promise->SetValue(CapturedData);
+				});
+		});
+
+		if (!Future.WaitFor(FTimespan::FromSeconds(CaptureTimeoutSeconds)))
+		{
+			FMCPError Error = FMCPErrorHandler::CreateExecutionFailedError(
+				FString::Printf(TEXT("Timed out capturing screenshot for widget '%s'"),
+					*ScreenshotParams.WidgetName));
+			return CreateErrorResponse(Error);
+		}
+		ScreenshotData = Future.Get();
+		bSuccess = ScreenshotData.IsValid();
+	}
 
 	if (!bSuccess || !ScreenshotData.IsValid())
 	{
@@ -148,18 +182,9 @@ bool FCaptureWidgetScreenshotCommand::ValidateParamsInternal(const TSharedPtr<FJ
 		}
 	}
 
-	// Validate format if provided
-	if (Params->HasField(TEXT("format")))
-	{
-		FString Format = Params->GetStringField(TEXT("format"));
-		if (Format != TEXT("png") && Format != TEXT("jpg") && Format != TEXT("jpeg"))
-		{
-			OutError = TEXT("format must be 'png', 'jpg', or 'jpeg'");
-			return false;
-		}
-	}
-
-	return true;
+	// Validate format, quality, scale and region if provided
+	FMCPImageEncodeOptions ImageOptions;
+	return FMCPImageEncodeOptions::FromJson(Params, ImageOptions, OutError);
 }
 
 // JSON Utility Methods
@@ -191,8 +216,9 @@ FString FCaptureWidgetScreenshotCommand::SerializeJsonResponse(const TSharedPtr<
 		return TEXT("{}");
 	}
 
+	// Condensed, the form attachment references are found in
 	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutputString);
 	FJsonSerializer::Serialize(Response.ToSharedRef(), Writer);
 	return OutputString;
 }
@@ -220,8 +246,13 @@ bool FCaptureWidgetScreenshotCommand::ExtractWidgetScreenshotParameters(const TS
 	// Extract height (optional, default 600)
 	OutParams.Height = Params->HasField(TEXT("height")) ? (int32)Params->GetNumberField(TEXT("height")) : 600;
 
-	// Extract format (optional, default "png")
-	OutParams.Format = Params->HasField(TEXT("format")) ? Params->GetStringField(TEXT("format")) : TEXT("png");
+	// Extract format, quality, scale and region (optional, default full-size PNG)
+	FString OptionsError;
+	if (!FMCPImageEncodeOptions::FromJson(Params, OutParams.ImageOptions, OptionsError))
+	{
+		UE_LOG(LogCaptureWidgetScreenshotCommand, Error, TEXT("Invalid image options: %s"), *OptionsError);
+		return false;
+	}
 
 	return true;
 }
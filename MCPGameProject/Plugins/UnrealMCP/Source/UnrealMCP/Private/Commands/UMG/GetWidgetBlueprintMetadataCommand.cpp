@@ -10,6 +10,25 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogGetWidgetBlueprintMetadata, Log, All);
 
+namespace
+{
+	const TCHAR* const MetadataSections[] =
+	{
+		TEXT("components"), TEXT("layout"), TEXT("dimensions"), TEXT("hierarchy"), TEXT("bindings"),
+		TEXT("events"), TEXT("variables"), TEXT("functions"), TEXT("orphaned_nodes"), TEXT("graph_warnings")
+	};
+
+	/** Sections "*" leaves out because they instantiate the widget; returned only when named */
+	const TCHAR* const OnDemandSections[] =
+	{
+		TEXT("measured_layout")
+	};
+
+	constexpr int32 DefaultMeasureWidth = 800;
+	constexpr int32 DefaultMeasureHeight = 600;
+	constexpr int32 MaxMeasureSize = 8192;
+}
+
 FGetWidgetBlueprintMetadataCommand::FGetWidgetBlueprintMetadataCommand(TSharedPtr<IUMGService> InUMGService)
 	: UMGService(InUMGService)
 	, MetadataBuilder(InUMGService)
@@ -94,6 +113,23 @@ bool FGetWidgetBlueprintMetadataCommand::ValidateParamsInternal(const TSharedPtr
 		return false;
 	}
 
+	double Depth = 0.0;
+	if (Params->TryGetNumberField(TEXT("depth"), Depth) && Depth < 0.0)
+	{
+		OutError = TEXT("depth cannot be negative");
+		return false;
+	}
+
+	for (const TCHAR* SizeField : { TEXT("width"), TEXT("height") })
+	{
+		double Size = 0.0;
+		if (Params->TryGetNumberField(SizeField, Size) && (Size < 1.0 || Size > MaxMeasureSize))
+		{
+			OutError = FString::Printf(TEXT("%s must be between 1 and %d"), SizeField, MaxMeasureSize);
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -125,6 +161,29 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 		RequestedFields.Add(TEXT("*"));
 	}
 
+	TMap<FString, TArray<FString>> Projections;
+	TArray<FString> UnknownFields;
+	{
+		TArray<FString> Sections;
+		ResolveFields(RequestedFields, Sections, Projections, UnknownFields);
+		if (Sections.Num() == 0)
+		{
+			return CreateErrorResponse(FString::Printf(TEXT("No valid fields requested: %s. Available fields: %s, %s, *"),
+				*FString::Join(UnknownFields, TEXT(", ")), *FString::Join(MetadataSections, TEXT(", ")),
+				*FString::Join(OnDemandSections, TEXT(", "))));
+		}
+		RequestedFields = MoveTemp(Sections);
+	}
+
+	// Optional subtree for the tree sections
+	FWidgetTreeQuery TreeQuery;
+	Params->TryGetStringField(TEXT("root_widget"), TreeQuery.RootWidget);
+	int32 Depth = INDEX_NONE;
+	if (Params->TryGetNumberField(TEXT("depth"), Depth))
+	{
+		TreeQuery.MaxDepth = Depth;
+	}
+
 	// Optional container name for dimensions
 	FString ContainerName = TEXT("CanvasPanel_0");
 	if (Params->HasField(TEXT("container_name")))
@@ -132,6 +191,12 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 		ContainerName = Params->GetStringField(TEXT("container_name"));
 	}
 
+	// Optional layout size for measured_layout
+	int32 MeasureWidth = DefaultMeasureWidth;
+	int32 MeasureHeight = DefaultMeasureHeight;
+	Params->TryGetNumberField(TEXT("width"), MeasureWidth);
+	Params->TryGetNumberField(TEXT("height"), MeasureHeight);
+
 	// Find the widget blueprint with retry mechanism
 	TArray<FString> AttemptedPaths;
 	UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprintWithRetry(WidgetName, AttemptedPaths);
@@ -147,6 +212,11 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 		return CreateErrorResponse(FString::Printf(TEXT("Widget blueprint '%s' has no widget tree"), *WidgetName));
 	}
 
+	if (!TreeQuery.RootWidget.IsEmpty() && !MetadataBuilder.FindQueryRoot(WidgetBlueprint, TreeQuery))
+	{
+		return CreateErrorResponse(FString::Printf(TEXT("Widget '%s' not found in widget blueprint '%s'"), *TreeQuery.RootWidget, *WidgetName));
+	}
+
 	// Build metadata response
 	TSharedPtr<FJsonObject> MetadataObj = MakeShared<FJsonObject>();
 	MetadataObj->SetStringField(TEXT("widget_name"), WidgetName);
@@ -161,7 +231,7 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 	// Build requested sections using MetadataBuilder
 	if (ShouldIncludeField(RequestedFields, TEXT("components")))
 	{
-		TSharedPtr<FJsonObject> ComponentsInfo = MetadataBuilder.BuildComponentsInfo(WidgetBlueprint);
+		TSharedPtr<FJsonObject> ComponentsInfo = MetadataBuilder.BuildComponentsInfo(WidgetBlueprint, TreeQuery);
 		if (ComponentsInfo.IsValid())
 		{
 			MetadataObj->SetObjectField(TEXT("components"), ComponentsInfo);
@@ -170,13 +240,22 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 
 	if (ShouldIncludeField(RequestedFields, TEXT("layout")))
 	{
-		TSharedPtr<FJsonObject> LayoutInfo = MetadataBuilder.BuildLayoutInfo(WidgetBlueprint);
+		TSharedPtr<FJsonObject> LayoutInfo = MetadataBuilder.BuildLayoutInfo(WidgetBlueprint, TreeQuery);
 		if (LayoutInfo.IsValid())
 		{
 			MetadataObj->SetObjectField(TEXT("layout"), LayoutInfo);
 		}
 	}
 
+	if (RequestedFields.Contains(TEXT("measured_layout")))
+	{
+		TSharedPtr<FJsonObject> MeasuredInfo = MetadataBuilder.BuildMeasuredLayoutInfo(WidgetBlueprint, MeasureWidth, MeasureHeight, TreeQuery);
+		if (MeasuredInfo.IsValid())
+		{
+			MetadataObj->SetObjectField(TEXT("measured_layout"), MeasuredInfo);
+		}
+	}
+
 	if (ShouldIncludeField(RequestedFields, TEXT("dimensions")))
 	{
 		TSharedPtr<FJsonObject> DimensionsInfo = MetadataBuilder.BuildDimensionsInfo(WidgetBlueprint, ContainerName);
@@ -188,7 +267,7 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 
 	if (ShouldIncludeField(RequestedFields, TEXT("hierarchy")))
 	{
-		TSharedPtr<FJsonObject> HierarchyInfo = MetadataBuilder.BuildHierarchyInfo(WidgetBlueprint);
+		TSharedPtr<FJsonObject> HierarchyInfo = MetadataBuilder.BuildHierarchyInfo(WidgetBlueprint, TreeQuery);
 		if (HierarchyInfo.IsValid())
 		{
 			MetadataObj->SetObjectField(TEXT("hierarchy"), HierarchyInfo);
@@ -197,7 +276,7 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 
 	if (ShouldIncludeField(RequestedFields, TEXT("bindings")))
 	{
-		TSharedPtr<FJsonObject> BindingsInfo = MetadataBuilder.BuildBindingsInfo(WidgetBlueprint);
+		TSharedPtr<FJsonObject> BindingsInfo = MetadataBuilder.BuildBindingsInfo(WidgetBlueprint, TreeQuery);
 		if (BindingsInfo.IsValid())
 		{
 			MetadataObj->SetObjectField(TEXT("bindings"), BindingsInfo);
@@ -249,9 +328,81 @@ TSharedPtr<FJsonObject> FGetWidgetBlueprintMetadataCommand::ExecuteInternal(cons
 		}
 	}
 
+	for (const TPair<FString, TArray<FString>>& Projection : Projections)
+	{
+		const TSharedPtr<FJsonObject>* Section = nullptr;
+		if (MetadataObj->TryGetObjectField(Projection.Key, Section))
+		{
+			FWidgetMetadataBuilderService::ProjectSection(*Section, Projection.Value);
+		}
+	}
+
+	if (UnknownFields.Num() > 0)
+	{
+		TArray<TSharedPtr<FJsonValue>> UnknownArray;
+		for (const FString& Field : UnknownFields)
+		{
+			UnknownArray.Add(MakeShared<FJsonValueString>(Field));
+		}
+		MetadataObj->SetArrayField(TEXT("unknown_fields"), UnknownArray);
+	}
+
 	return CreateSuccessResponse(MetadataObj);
 }
 
+void FGetWidgetBlueprintMetadataCommand::ResolveFields(const TArray<FString>& Fields, TArray<FString>& OutSections, TMap<FString, TArray<FString>>& OutProjections, TArray<FString>& OutUnknownFields)
+{
+	TSet<FString> WholeSections;
+
+	for (const FString& Field : Fields)
+	{
+		if (Field == TEXT("*"))
+		{
+			OutSections.AddUnique(Field);
+			for (const TCHAR* Section : MetadataSections)
+			{
+				WholeSections.Add(Section);
+			}
+			continue;
+		}
+
+		FString SectionName = Field;
+		FString Key;
+		Field.Split(TEXT("."), &SectionName, &Key);
+
+		bool bKnownSection = false;
+		for (const TCHAR* Section : MetadataSections)
+		{
+			bKnownSection |= SectionName == Section;
+		}
+		for (const TCHAR* Section : OnDemandSections)
+		{
+			bKnownSection |= SectionName == Section;
+		}
+		if (!bKnownSection)
+		{
+			OutUnknownFields.Add(Field);
+			continue;
+		}
+
+		OutSections.AddUnique(SectionName);
+		if (Key.IsEmpty())
+		{
+			WholeSections.Add(SectionName);
+		}
+		else
+		{
+			OutProjections.FindOrAdd(SectionName).AddUnique(Key);
+		}
+	}
+
+	// A section also requested whole keeps every key
+	for (const FString& SectionName : WholeSections)
+	{
+		OutProjections.Remove(SectionName);
+	}
+}
+
 UWidgetBlueprint* FGetWidgetBlueprintMetadataCommand::FindWidgetBlueprintWithRetry(const FString& WidgetName, TArray<FString>& OutAttemptedPaths) const
 {
 	// Maximum number of retry attempts
@@ -14,6 +14,8 @@
 #include "Commands/UMG/ReorderWidgetChildrenCommand.h"
 #include "Commands/UMG/SetWidgetDesignSizeCommand.h"
 #include "Commands/UMG/SetWidgetParentClassCommand.h"
+#include "Commands/UMG/BuildWidgetTreeCommand.h"
+#include "Commands/UMG/BatchUpdateWidgetsCommand.h"
 #include "Services/UMG/UMGService.h"
 
 // Static member definition
@@ -41,6 +43,8 @@ void FUMGCommandRegistration::RegisterAllUMGCommands()
     RegisterReorderWidgetChildrenCommand();
     RegisterSetWidgetDesignSizeCommand();
     RegisterSetWidgetParentClassCommand();
+    RegisterBuildWidgetTreeCommand();
+    RegisterBatchUpdateWidgetsCommand();
 
     // TODO: Register remaining 22 UMG commands when their classes are implemented
     // For now, we'll register the core commands that exist
@@ -72,56 +76,67 @@ void FUMGCommandRegistration::UnregisterAllUMGCommands()
 
 void FUMGCommandRegistration::RegisterCreateWidgetBlueprintCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FCreateWidgetBlueprintCommand> Command = MakeShared<FCreateWidgetBlueprintCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_umg_widget_blueprint"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FCreateWidgetBlueprintCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterBindWidgetEventCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FBindWidgetEventCommand> Command = MakeShared<FBindWidgetEventCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("bind_widget_component_event"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FBindWidgetEventCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterAddWidgetComponentCommand()
 {
-    TSharedPtr<FAddWidgetComponentCommand> Command = MakeShared<FAddWidgetComponentCommand>(FUMGService::Get());
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_widget_component_to_widget"), []() { return MakeShared<FAddWidgetComponentCommand>(FUMGService::Get()); });
 }
 
 void FUMGCommandRegistration::RegisterSetWidgetPropertyCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FSetWidgetPropertyCommand> Command = MakeShared<FSetWidgetPropertyCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_widget_component_property"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FSetWidgetPropertyCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterSetTextBlockBindingCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FSetTextBlockBindingCommand> Command = MakeShared<FSetTextBlockBindingCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_text_block_widget_component_binding"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FSetTextBlockBindingCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterSetWidgetPlacementCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FSetWidgetPlacementCommand> Command = MakeShared<FSetWidgetPlacementCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_widget_component_placement"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FSetWidgetPlacementCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterGetWidgetBlueprintMetadataCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FGetWidgetBlueprintMetadataCommand> Command = MakeShared<FGetWidgetBlueprintMetadataCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("get_widget_blueprint_metadata"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FGetWidgetBlueprintMetadataCommand>(UMGServicePtr);
+    });
 }
 
 // Widget-specific add commands - placeholders
@@ -229,77 +244,98 @@ void FUMGCommandRegistration::RegisterAddSpacerCommand()
 
 void FUMGCommandRegistration::RegisterAddChildWidgetCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FAddChildWidgetCommand> Command = MakeShared<FAddChildWidgetCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("add_child_widget_component_to_parent"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FAddChildWidgetCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterCaptureWidgetScreenshotCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FCaptureWidgetScreenshotCommand> Command = MakeShared<FCaptureWidgetScreenshotCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("capture_widget_screenshot"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FCaptureWidgetScreenshotCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterCreateWidgetInputHandlerCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FCreateWidgetInputHandlerCommand> Command = MakeShared<FCreateWidgetInputHandlerCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("create_widget_input_handler"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FCreateWidgetInputHandlerCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterRemoveWidgetFunctionGraphCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FRemoveWidgetFunctionGraphCommand> Command = MakeShared<FRemoveWidgetFunctionGraphCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("remove_widget_function_graph"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FRemoveWidgetFunctionGraphCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterReorderWidgetChildrenCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FReorderWidgetChildrenCommand> Command = MakeShared<FReorderWidgetChildrenCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("reorder_widget_children"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FReorderWidgetChildrenCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterSetWidgetDesignSizeCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FSetWidgetDesignSizeCommand> Command = MakeShared<FSetWidgetDesignSizeCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_widget_design_size_mode"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FSetWidgetDesignSizeCommand>(UMGServicePtr);
+    });
 }
 
 void FUMGCommandRegistration::RegisterSetWidgetParentClassCommand()
 {
-    // Create shared pointer to the UMG service singleton for the new architecture
-    TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
-    TSharedPtr<FSetWidgetParentClassCommand> Command = MakeShared<FSetWidgetParentClassCommand>(UMGServicePtr);
-    RegisterAndTrackCommand(Command);
+    RegisterAndTrackCommand(TEXT("set_widget_parent_class"), []()
+    {
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FSetWidgetParentClassCommand>(UMGServicePtr);
+    });
 }
 
-void FUMGCommandRegistration::RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command)
+void FUMGCommandRegistration::RegisterBuildWidgetTreeCommand()
 {
-    if (!Command.IsValid())
+    RegisterAndTrackCommand(TEXT("build_widget_tree"), []()
     {
-        UE_LOG(LogTemp, Error, TEXT("FUMGCommandRegistration::RegisterAndTrackCommand: Invalid command"));
-        return;
-    }
-    
-    FString CommandName = Command->GetCommandName();
-    if (CommandName.IsEmpty())
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FBuildWidgetTreeCommand>(UMGServicePtr);
+    });
+}
+
+void FUMGCommandRegistration::RegisterBatchUpdateWidgetsCommand()
+{
+    RegisterAndTrackCommand(TEXT("batch_update_widgets"), []()
     {
-        UE_LOG(LogTemp, Error, TEXT("FUMGCommandRegistration::RegisterAndTrackCommand: Command has empty name"));
-        return;
-    }
-    
+        // Create shared pointer to the UMG service singleton for the new architecture
+        TSharedPtr<IUMGService> UMGServicePtr(&FUMGService::Get(), [](IUMGService*){});
+        return MakeShared<FBatchUpdateWidgetsCommand>(UMGServicePtr);
+    });
+}
+
+void FUMGCommandRegistration::RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory)
+{
     FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    if (Registry.RegisterCommand(Command))
+    if (Registry.RegisterLazyCommand(CommandName, MoveTemp(Factory)))
     {
         RegisteredCommandNames.Add(CommandName);
         UE_LOG(LogTemp, Verbose, TEXT("FUMGCommandRegistration::RegisterAndTrackCommand: Registered and tracked command '%s'"), *CommandName);
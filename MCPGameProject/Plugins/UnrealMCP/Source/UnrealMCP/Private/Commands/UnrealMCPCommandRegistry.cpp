@@ -1,4 +1,5 @@
 #include "Commands/UnrealMCPCommandRegistry.h"
+#include "MCPTrace.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -9,7 +10,20 @@ FUnrealMCPCommandRegistry& FUnrealMCPCommandRegistry::Get()
     return Instance;
 }
 
-bool FUnrealMCPCommandRegistry::RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command)
+FUnrealMCPCommandRegistry::FUnrealMCPCommandRegistry()
+    : BatchUpdateDepth(0)
+{
+    FSnapshot* EmptySnapshot = new FSnapshot();
+    EmptySnapshot->AllCommandsHelp = BuildAllCommandsHelp(EmptySnapshot->SortedCommandNames);
+    CurrentSnapshot = EmptySnapshot;
+}
+
+FUnrealMCPCommandRegistry::~FUnrealMCPCommandRegistry()
+{
+    delete CurrentSnapshot.Load();
+}
+
+bool FUnrealMCPCommandRegistry::RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command, bool bReplaceExisting)
 {
     if (!Command.IsValid())
     {
@@ -24,16 +38,52 @@ bool FUnrealMCPCommandRegistry::RegisterCommand(TSharedPtr<IUnrealMCPCommand> Co
         return false;
     }
     
+    TSharedRef<FCommandEntry> Entry = MakeShared<FCommandEntry>();
+    Entry->CommandName = MoveTemp(CommandName);
+    Entry->Command = MoveTemp(Command);
+    Entry->bConstructed = true;
+    return AddEntry(Entry, bReplaceExisting);
+}
+
+bool FUnrealMCPCommandRegistry::RegisterLazyCommand(const FString& CommandName, FMCPCommandFactory Factory, bool bReplaceExisting)
+{
+    if (!Factory)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::RegisterLazyCommand: Invalid factory for command '%s'"), *CommandName);
+        return false;
+    }
+    
+    if (CommandName.IsEmpty())
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::RegisterLazyCommand: Empty command name"));
+        return false;
+    }
+    
+    TSharedRef<FCommandEntry> Entry = MakeShared<FCommandEntry>();
+    Entry->CommandName = CommandName;
+    Entry->Factory = MoveTemp(Factory);
+    return AddEntry(Entry, bReplaceExisting);
+}
+
+bool FUnrealMCPCommandRegistry::AddEntry(const TSharedRef<FCommandEntry>& Entry, bool bReplaceExisting)
+{
+    const FName CommandKey(*Entry->CommandName);
+    
     FScopeLock Lock(&RegistryLock);
     
     // Check if command is already registered
-    if (RegisteredCommands.Contains(CommandName))
+    if (RegisteredCommands.Contains(CommandKey))
     {
-        UE_LOG(LogTemp, Warning, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Command '%s' is already registered, replacing"), *CommandName);
+        if (!bReplaceExisting)
+        {
+            return false;
+        }
+        UE_LOG(LogTemp, Warning, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Command '%s' is already registered, replacing"), *Entry->CommandName);
     }
     
-    RegisteredCommands.Add(CommandName, Command);
-    UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Successfully registered command '%s'"), *CommandName);
+    RegisteredCommands.Add(CommandKey, Entry);
+    PublishSnapshot();
+    UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::RegisterCommand: Successfully registered command '%s'"), *Entry->CommandName);
     
     return true;
 }
@@ -46,11 +96,14 @@ bool FUnrealMCPCommandRegistry::UnregisterCommand(const FString& CommandName)
         return false;
     }
     
+    const FName CommandKey = FindCommandKey(CommandName);
+    
     FScopeLock Lock(&RegistryLock);
     
-    int32 RemovedCount = RegisteredCommands.Remove(CommandName);
+    int32 RemovedCount = CommandKey.IsNone() ? 0 : RegisteredCommands.Remove(CommandKey);
     if (RemovedCount > 0)
     {
+        PublishSnapshot();
         UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::UnregisterCommand: Successfully unregistered command '%s'"), *CommandName);
         return true;
     }
@@ -61,6 +114,64 @@ bool FUnrealMCPCommandRegistry::UnregisterCommand(const FString& CommandName)
     }
 }
 
+FName FUnrealMCPCommandRegistry::FindCommandKey(const FString& CommandName)
+{
+    // FNAME_Find never grows the global name table, so arbitrary client input cannot pollute it
+    return FName(*CommandName, FNAME_Find);
+}
+
+TSharedPtr<IUnrealMCPCommand> FUnrealMCPCommandRegistry::FindCommand(const FString& CommandName, bool bConstruct) const
+{
+    const FName CommandKey = FindCommandKey(CommandName);
+    if (CommandKey.IsNone())
+    {
+        return nullptr;
+    }
+    
+    const TSharedRef<FCommandEntry>* EntryPtr = CurrentSnapshot.Load()->Commands.Find(CommandKey);
+    if (!EntryPtr)
+    {
+        return nullptr;
+    }
+    
+    FCommandEntry& Entry = EntryPtr->Get();
+    if (!Entry.bConstructed)
+    {
+        if (!bConstruct)
+        {
+            return nullptr;
+        }
+        ConstructCommand(Entry);
+    }
+    return Entry.Command;
+}
+
+void FUnrealMCPCommandRegistry::ConstructCommand(FCommandEntry& Entry) const
+{
+    FScopeLock Lock(&ConstructionLock);
+    if (Entry.bConstructed)
+    {
+        return;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    TSharedPtr<IUnrealMCPCommand> Command = Entry.Factory();
+    if (!Command.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry: Factory for command '%s' returned no command"), *Entry.CommandName);
+    }
+    else if (Command->GetCommandName() != Entry.CommandName)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry: Command registered as '%s' reports its name as '%s'"),
+            *Entry.CommandName, *Command->GetCommandName());
+    }
+    
+    Entry.Command = MoveTemp(Command);
+    Entry.bConstructed = true;
+    UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry: Constructed command '%s' on first use in %.2f ms"),
+        *Entry.CommandName, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
 FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, const FString& Parameters)
 {
     if (CommandName.IsEmpty())
@@ -68,15 +179,10 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
         return CreateErrorResponse(TEXT("Empty command name"));
     }
     
-    TSharedPtr<IUnrealMCPCommand> Command;
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName);
+    if (!Command.IsValid())
     {
-        FScopeLock Lock(&RegistryLock);
-        TSharedPtr<IUnrealMCPCommand>* CommandPtr = RegisteredCommands.Find(CommandName);
-        if (!CommandPtr || !CommandPtr->IsValid())
-        {
-            return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
-        }
-        Command = *CommandPtr;
+        return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
     }
     
     // Validate parameters before execution
@@ -88,6 +194,7 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
     // Execute the command
     try
     {
+        MCP_TRACE_SCOPE_TEXT(*CommandName);
         FString Result = Command->Execute(Parameters);
         UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: Successfully executed command '%s'"), *CommandName);
         return Result;
@@ -106,23 +213,72 @@ FString FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, co
     }
 }
 
+bool FUnrealMCPCommandRegistry::ExecuteCommand(const FString& CommandName, const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response)
+{
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName);
+    if (!Command.IsValid())
+    {
+        Response.SetError(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
+        return false;
+    }
+    
+    // Validate parameters before execution
+    if (!Command->ValidateParams(Params))
+    {
+        Response.SetError(FString::Printf(TEXT("Invalid parameters for command '%s'"), *CommandName));
+        return true;
+    }
+    
+    // Execute the command; string-based commands are adapted by IUnrealMCPCommand
+    try
+    {
+        MCP_TRACE_SCOPE_TEXT(*CommandName);
+        Command->Execute(Params, Response);
+        UE_LOG(LogTemp, Verbose, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: Successfully executed command '%s'"), *CommandName);
+    }
+    catch (const std::exception& e)
+    {
+        FString ErrorMessage = FString::Printf(TEXT("Exception during command execution: %s"), ANSI_TO_TCHAR(e.what()));
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: %s"), *ErrorMessage);
+        Response.SetError(ErrorMessage);
+    }
+    catch (...)
+    {
+        FString ErrorMessage = TEXT("Unknown exception during command execution");
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::ExecuteCommand: %s"), *ErrorMessage);
+        Response.SetError(ErrorMessage);
+    }
+    return true;
+}
+
 bool FUnrealMCPCommandRegistry::IsCommandRegistered(const FString& CommandName) const
 {
-    FScopeLock Lock(&RegistryLock);
-    return RegisteredCommands.Contains(CommandName);
+    const FName CommandKey = FindCommandKey(CommandName);
+    return !CommandKey.IsNone() && CurrentSnapshot.Load()->Commands.Contains(CommandKey);
+}
+
+EMCPThreadAffinity FUnrealMCPCommandRegistry::GetCommandThreadAffinity(const FString& CommandName) const
+{
+    // Off the game thread, a command not constructed yet is sent to the game thread to be constructed there
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName, IsInGameThread());
+    return Command.IsValid() ? Command->GetThreadAffinity() : EMCPThreadAffinity::GameThreadRequired;
+}
+
+bool FUnrealMCPCommandRegistry::IsCommandReadOnly(const FString& CommandName) const
+{
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName, IsInGameThread());
+    return Command.IsValid() && Command->IsReadOnly();
+}
+
+bool FUnrealMCPCommandRegistry::IsCommandResultCacheable(const FString& CommandName) const
+{
+    TSharedPtr<IUnrealMCPCommand> Command = FindCommand(CommandName, IsInGameThread());
+    return Command.IsValid() && Command->IsReadOnly() && Command->IsResultCacheable();
 }
 
 TArray<FString> FUnrealMCPCommandRegistry::GetRegisteredCommandNames() const
 {
-    FScopeLock Lock(&RegistryLock);
-    
-    TArray<FString> CommandNames;
-    RegisteredCommands.GetKeys(CommandNames);
-    
-    // Sort alphabetically for consistent output
-    CommandNames.Sort();
-    
-    return CommandNames;
+    return CurrentSnapshot.Load()->SortedCommandNames;
 }
 
 FString FUnrealMCPCommandRegistry::GetCommandHelp(const FString& CommandName) const
@@ -132,10 +288,7 @@ FString FUnrealMCPCommandRegistry::GetCommandHelp(const FString& CommandName) co
         return CreateErrorResponse(TEXT("Empty command name"));
     }
     
-    FScopeLock Lock(&RegistryLock);
-    
-    const TSharedPtr<IUnrealMCPCommand>* CommandPtr = RegisteredCommands.Find(CommandName);
-    if (!CommandPtr || !CommandPtr->IsValid())
+    if (!IsCommandRegistered(CommandName))
     {
         return CreateErrorResponse(FString::Printf(TEXT("Command '%s' not found"), *CommandName));
     }
@@ -163,19 +316,28 @@ FString FUnrealMCPCommandRegistry::GetCommandHelp(const FString& CommandName) co
 
 FString FUnrealMCPCommandRegistry::GetAllCommandsHelp() const
 {
-    FScopeLock Lock(&RegistryLock);
-    
+    return CurrentSnapshot.Load()->AllCommandsHelp;
+}
+
+int32 FUnrealMCPCommandRegistry::GetConstructedCommandCount() const
+{
+    int32 ConstructedCount = 0;
+    for (const TPair<FName, TSharedRef<FCommandEntry>>& Pair : CurrentSnapshot.Load()->Commands)
+    {
+        ConstructedCount += Pair.Value->bConstructed ? 1 : 0;
+    }
+    return ConstructedCount;
+}
+
+FString FUnrealMCPCommandRegistry::BuildAllCommandsHelp(const TArray<FString>& CommandNames)
+{
     TSharedPtr<FJsonObject> HelpObj = MakeShared<FJsonObject>();
     HelpObj->SetBoolField(TEXT("success"), true);
-    HelpObj->SetNumberField(TEXT("command_count"), RegisteredCommands.Num());
+    HelpObj->SetNumberField(TEXT("command_count"), CommandNames.Num());
     
     // Create array of command information
     TArray<TSharedPtr<FJsonValue>> CommandsArray;
     
-    TArray<FString> CommandNames;
-    RegisteredCommands.GetKeys(CommandNames);
-    CommandNames.Sort();
-    
     for (const FString& CommandName : CommandNames)
     {
         TSharedPtr<FJsonObject> CommandInfo = MakeShared<FJsonObject>();
@@ -202,10 +364,57 @@ void FUnrealMCPCommandRegistry::ClearRegistry()
     
     int32 ClearedCount = RegisteredCommands.Num();
     RegisteredCommands.Empty();
+    PublishSnapshot();
     
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPCommandRegistry::ClearRegistry: Cleared %d registered commands"), ClearedCount);
 }
 
+void FUnrealMCPCommandRegistry::BeginBatchUpdate()
+{
+    FScopeLock Lock(&RegistryLock);
+    ++BatchUpdateDepth;
+}
+
+void FUnrealMCPCommandRegistry::EndBatchUpdate()
+{
+    FScopeLock Lock(&RegistryLock);
+    if (BatchUpdateDepth <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUnrealMCPCommandRegistry::EndBatchUpdate: No batch update in progress"));
+        return;
+    }
+    
+    if (--BatchUpdateDepth == 0)
+    {
+        PublishSnapshot();
+    }
+}
+
+void FUnrealMCPCommandRegistry::PublishSnapshot()
+{
+    if (BatchUpdateDepth > 0)
+    {
+        return;
+    }
+    
+    FSnapshot* NewSnapshot = new FSnapshot();
+    NewSnapshot->Commands = RegisteredCommands;
+    
+    // Report the names as the commands spell them; an FName keeps the casing it was first created with
+    NewSnapshot->SortedCommandNames.Reserve(RegisteredCommands.Num());
+    for (const TPair<FName, TSharedRef<FCommandEntry>>& Pair : RegisteredCommands)
+    {
+        NewSnapshot->SortedCommandNames.Add(Pair.Value->CommandName);
+    }
+    
+    // Sort alphabetically for consistent output
+    NewSnapshot->SortedCommandNames.Sort();
+    NewSnapshot->AllCommandsHelp = BuildAllCommandsHelp(NewSnapshot->SortedCommandNames);
+    
+    // Readers may still hold the old snapshot, so it is retired rather than freed
+    RetiredSnapshots.Emplace(CurrentSnapshot.Exchange(NewSnapshot));
+}
+
 FString FUnrealMCPCommandRegistry::CreateErrorResponse(const FString& ErrorMessage) const
 {
     TSharedPtr<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
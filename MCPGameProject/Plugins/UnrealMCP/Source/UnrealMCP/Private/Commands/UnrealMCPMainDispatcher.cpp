@@ -14,6 +14,8 @@
 #include "Commands/StateTreeCommandRegistration.h"
 #include "Commands/SoundCommandRegistration.h"
 #include "Commands/Migration/MigrationCommandRegistration.h"
+#include "Commands/MCPLegacyHandlerCommand.h"
+#include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommandsHandler.h"
 #include "Services/BlueprintActionService.h"
 // Legacy adapter removed
 #include "Services/BlueprintService.h"
@@ -134,9 +136,36 @@ void FUnrealMCPMainDispatcher::RegisterAllCommands()
     // Register Migration commands (Blueprint-to-C++ migration tools)
     FMigrationCommandRegistration::RegisterAllMigrationCommands();
 
+    // Legacy handlers last: they only fill names no command class has claimed
+    RegisterLegacyHandlerCommands();
+
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::RegisterAllCommands: All command types registered"));
 }
 
+void FUnrealMCPMainDispatcher::RegisterLegacyHandlerCommands()
+{
+    // The editor, blueprint, blueprint node, project and UMG handler classes forward every command
+    // back to this dispatcher, so registering them would only loop; the blueprint action handler
+    // still has its own implementations
+    BlueprintActionHandler = MakeShared<FUnrealMCPBlueprintActionCommandsHandler>();
+    
+    TSharedPtr<FUnrealMCPBlueprintActionCommandsHandler> Handler = BlueprintActionHandler;
+    LegacyHandlerCommands = FMCPLegacyHandlerCommand::RegisterHandler(
+        {
+            TEXT("get_actions_for_pin"),
+            TEXT("get_actions_for_class"),
+            TEXT("get_actions_for_class_hierarchy"),
+            TEXT("get_node_pin_info"),
+            TEXT("create_node_by_action_name")
+        },
+        [Handler](const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+        {
+            return Handler->HandleCommand(CommandType, Params);
+        });
+    
+    UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::RegisterLegacyHandlerCommands: Registered %d legacy handler commands"), LegacyHandlerCommands.Num());
+}
+
 void FUnrealMCPMainDispatcher::Initialize()
 {
     if (bIsInitialized)
@@ -149,12 +178,18 @@ void FUnrealMCPMainDispatcher::Initialize()
     
     // Legacy adapter removed
     
-    // Register all command types
+    // Register all command types, publishing the registry once at the end; most are only
+    // constructed when first used
+    const double StartTime = FPlatformTime::Seconds();
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    Registry.BeginBatchUpdate();
     RegisterAllCommands();
+    Registry.EndBatchUpdate();
     
     bIsInitialized = true;
     
-    UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::Initialize: Command dispatcher initialized successfully"));
+    UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::Initialize: Registered %d commands (%d constructed) in %.1f ms"),
+        Registry.GetRegisteredCommandNames().Num(), Registry.GetConstructedCommandCount(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 void FUnrealMCPMainDispatcher::Shutdown()
@@ -168,6 +203,7 @@ void FUnrealMCPMainDispatcher::Shutdown()
     UE_LOG(LogTemp, Log, TEXT("FUnrealMCPMainDispatcher::Shutdown: Shutting down command dispatcher"));
     
     // Unregister all command types
+    FUnrealMCPCommandRegistry::Get().BeginBatchUpdate();
     FBlueprintCommandRegistration::UnregisterAllBlueprintCommands();
     FBlueprintNodeCommandRegistration::UnregisterAllBlueprintNodeCommands();
     FBlueprintActionCommandRegistration::UnregisterAllBlueprintActionCommands();
@@ -179,9 +215,16 @@ void FUnrealMCPMainDispatcher::Shutdown()
     FAnimationCommandRegistration::UnregisterAllAnimationCommands();
     FStateTreeCommandRegistration::UnregisterAllStateTreeCommands();
     FMigrationCommandRegistration::UnregisterAllMigrationCommands();
+    for (const TSharedPtr<IUnrealMCPCommand>& Command : LegacyHandlerCommands)
+    {
+        FUnrealMCPCommandRegistry::Get().UnregisterCommand(Command->GetCommandName());
+    }
+    LegacyHandlerCommands.Empty();
+    BlueprintActionHandler.Reset();
 
     // Clear the entire registry
     FUnrealMCPCommandRegistry::Get().ClearRegistry();
+    FUnrealMCPCommandRegistry::Get().EndBatchUpdate();
     
     bIsInitialized = false;
     
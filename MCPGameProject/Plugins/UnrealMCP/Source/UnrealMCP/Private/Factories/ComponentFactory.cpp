@@ -26,7 +26,10 @@
 #include "Components/TimelineComponent.h"
 #include "NiagaraComponent.h"
 #include "Engine/Blueprint.h"
-#include "Misc/Paths.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectHash.h"
 #include "Engine/Engine.h"
 
 FComponentFactory& FComponentFactory::Get()
@@ -51,6 +54,7 @@ void FComponentFactory::RegisterComponentType(const FString& TypeName, UClass* C
 
     FScopeLock Lock(&ComponentMapLock);
     ComponentTypeMap.Add(TypeName, ComponentClass);
+    ResolvedClasses.Remove(TypeName);
     
     UE_LOG(LogTemp, Log, TEXT("FComponentFactory: Registered component type '%s' -> '%s'"), *TypeName, *ComponentClass->GetName());
 }
@@ -68,99 +72,277 @@ UClass* FComponentFactory::GetComponentClass(const FString& TypeName) const
 
     if (UClass* const* FoundClass = ComponentTypeMap.Find(TypeName))
     {
+        CacheCounters.RecordHit();
         return *FoundClass;
     }
 
-    // If not found in registry, try to load as Blueprint component
-    // Support both short names (BP_MyComponent) and full paths (/Game/Path/BP_MyComponent)
-    UClass* LoadedClass = nullptr;
+    if (const TWeakObjectPtr<UClass>* ResolvedClass = ResolvedClasses.Find(TypeName))
+    {
+        if (UClass* Class = ResolvedClass->Get())
+        {
+            CacheCounters.RecordHit();
+            return Class;
+        }
+        ResolvedClasses.Remove(TypeName);
+        CacheCounters.RecordInvalidation();
+    }
+
+    CacheCounters.RecordMiss();
+    UClass* ComponentClass = ResolveComponentClass(TypeName);
+    if (ComponentClass && !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FComponentFactory::GetComponentClass: Class '%s' is not an ActorComponent"), 
+               *ComponentClass->GetName());
+        return nullptr;
+    }
     
-    if (TypeName.StartsWith(TEXT("/Game/")) || TypeName.StartsWith(TEXT("/Script/")))
+    if (!ComponentClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FComponentFactory::GetComponentClass: Component type '%s' not found"), *TypeName);
+        return nullptr;
+    }
+    
+    UE_LOG(LogTemp, Verbose, TEXT("FComponentFactory::GetComponentClass: Resolved component type '%s' to '%s'"), 
+           *TypeName, *ComponentClass->GetPathName());
+    ResolvedClasses.Add(TypeName, ComponentClass);
+    return ComponentClass;
+}
+
+void FComponentFactory::Initialize()
+{
+    check(IsInGameThread());
     {
-        // Full path provided - try to load as Blueprint class
-        FString ClassPath = TypeName;
-        if (!ClassPath.EndsWith(TEXT("_C")))
+        FScopeLock Lock(&ComponentMapLock);
+        if (bInitialized)
         {
-            // Add _C suffix for generated Blueprint class
-            FString BaseName = FPaths::GetBaseFilename(TypeName);
-            ClassPath = FString::Printf(TEXT("%s.%s_C"), *TypeName, *BaseName);
+            return;
         }
-        
-        LoadedClass = LoadObject<UClass>(nullptr, *ClassPath);
-        
-        if (!LoadedClass)
+
+        ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FComponentFactory::HandleModulesChanged);
+        if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
         {
-            // Try loading as Blueprint asset
-            UObject* Asset = LoadObject<UObject>(nullptr, *TypeName);
-            if (UBlueprint* BP = Cast<UBlueprint>(Asset))
-            {
-                LoadedClass = BP->GeneratedClass;
-            }
+            AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FComponentFactory::HandleAssetChanged);
+            AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FComponentFactory::HandleAssetChanged);
+            AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FComponentFactory::HandleAssetRenamed);
         }
+        bInitialized = true;
     }
-    else
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("component_class_registry"), TEXT("cache"), CacheCounters,
+        [this]()
+        {
+            FScopeLock StatsLock(&ComponentMapLock);
+            return static_cast<int64>(ComponentTypeMap.Num() + ResolvedClasses.Num());
+        });
+}
+
+void FComponentFactory::Shutdown()
+{
+    check(IsInGameThread());
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("component_class_registry"));
+
+    FScopeLock Lock(&ComponentMapLock);
+    if (!bInitialized)
     {
-        // Short name provided - search for Blueprint component
-        // Fix: Ensure TypeName doesn't already start with /Game/ or Game/
-        FString CleanTypeName = TypeName;
-        if (CleanTypeName.StartsWith(TEXT("/Game/")))
+        return;
+    }
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    ModulesChangedHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    bInitialized = false;
+
+    NativeClasses.Empty();
+    BlueprintClasses.Empty();
+    BlueprintClassesByPackage.Empty();
+    ResolvedClasses.Empty();
+    bNativeIndexBuilt = false;
+    bBlueprintIndexBuilt = false;
+}
+
+UClass* FComponentFactory::ResolveComponentClass(const FString& TypeName) const
+{
+    // Object and package paths name one class; nothing else is tried for them
+    if (TypeName.StartsWith(TEXT("/")))
+    {
+        return LoadComponentClassByPath(TypeName);
+    }
+
+    const FString* Alias = TypeAliases.Find(TypeName);
+    const FString ClassName = Alias ? *Alias : TypeName;
+    if (UClass* const* FoundClass = ComponentTypeMap.Find(ClassName))
+    {
+        return *FoundClass;
+    }
+
+    EnsureNativeIndex();
+    TArray<FString, TInlineAllocator<3>> NativeNames = { ClassName };
+    if (ClassName.Len() > 1 && ClassName[0] == TEXT('U') && FChar::IsUpper(ClassName[1]))
+    {
+        NativeNames.Add(ClassName.RightChop(1));
+    }
+    if (!ClassName.EndsWith(TEXT("Component")))
+    {
+        NativeNames.Add(ClassName + TEXT("Component"));
+    }
+    for (const FString& NativeName : NativeNames)
+    {
+        if (const TWeakObjectPtr<UClass>* NativeClass = NativeClasses.Find(FName(*NativeName)))
         {
-            // Already a full path - extract just the asset name
-            CleanTypeName = FPaths::GetBaseFilename(TypeName);
+            if (UClass* Class = NativeClass->Get())
+            {
+                return Class;
+            }
         }
-        else if (CleanTypeName.StartsWith(TEXT("Game/")))
+    }
+
+    EnsureBlueprintIndex();
+    FString AssetName = ClassName;
+    AssetName.RemoveFromEnd(TEXT("_C"));
+    if (const FSoftObjectPath* ClassPath = BlueprintClasses.Find(FName(*AssetName)))
+    {
+        UClass* Class = Cast<UClass>(ClassPath->ResolveObject());
+        if (!Class && IsInGameThread())
         {
-            // Has Game/ prefix without leading slash - extract asset name
-            CleanTypeName = FPaths::GetBaseFilename(TypeName);
+            Class = Cast<UClass>(ClassPath->TryLoad());
         }
-        
-        // Try common component paths
-        TArray<FString> SearchPaths = {
-            FString::Printf(TEXT("/Game/Blueprints/%s"), *CleanTypeName),
-            FString::Printf(TEXT("/Game/Components/%s"), *CleanTypeName),
-            FString::Printf(TEXT("/Game/%s"), *CleanTypeName)
-        };
-        
-        for (const FString& SearchPath : SearchPaths)
+        return Class;
+    }
+    return nullptr;
+}
+
+UClass* FComponentFactory::LoadComponentClassByPath(const FString& Path) const
+{
+    const FString ObjectPath = FPackageName::ExportTextPathToObjectPath(Path);
+    const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+
+    // A Blueprint's package or asset path stands for its generated class
+    if (!ObjectPath.EndsWith(TEXT("_C")))
+    {
+        EnsureBlueprintIndex();
+        if (const FSoftObjectPath* ClassPath = BlueprintClassesByPackage.Find(FName(*PackageName)))
         {
-            FString ClassPath = FString::Printf(TEXT("%s.%s_C"), *SearchPath, *CleanTypeName);
-            LoadedClass = LoadObject<UClass>(nullptr, *ClassPath);
-            
-            if (!LoadedClass)
+            UClass* Class = Cast<UClass>(ClassPath->ResolveObject());
+            if (!Class && IsInGameThread())
             {
-                UObject* Asset = LoadObject<UObject>(nullptr, *SearchPath);
-                if (UBlueprint* BP = Cast<UBlueprint>(Asset))
-                {
-                    LoadedClass = BP->GeneratedClass;
-                }
-            }
-            
-            if (LoadedClass)
-            {
-                break;
+                Class = Cast<UClass>(ClassPath->TryLoad());
             }
+            return Class;
         }
     }
-    
-    // Validate that loaded class is an ActorComponent
-    if (LoadedClass && LoadedClass->IsChildOf(UActorComponent::StaticClass()))
+
+    if (!ObjectPath.Contains(TEXT(".")))
     {
-        UE_LOG(LogTemp, Log, TEXT("FComponentFactory::GetComponentClass: Loaded Blueprint component class '%s' for type '%s'"), 
-               *LoadedClass->GetName(), *TypeName);
-        return LoadedClass;
+        return nullptr;
     }
-    
-    if (LoadedClass)
+    UObject* Object = FindObject<UObject>(nullptr, *ObjectPath);
+    if (!Object && IsInGameThread() && !ObjectPath.StartsWith(TEXT("/Script/")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentFactory::GetComponentClass: Loaded class '%s' is not an ActorComponent"), 
-               *LoadedClass->GetName());
+        Object = LoadObject<UObject>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn);
     }
-    else
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
     {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentFactory::GetComponentClass: Component type '%s' not found"), *TypeName);
+        return Blueprint->GeneratedClass;
     }
-    
-    return nullptr;
+    return Cast<UClass>(Object);
+}
+
+void FComponentFactory::EnsureNativeIndex() const
+{
+    if (bNativeIndexBuilt)
+    {
+        return;
+    }
+
+    NativeClasses.Reset();
+    TArray<UClass*> ComponentClasses;
+    GetDerivedClasses(UActorComponent::StaticClass(), ComponentClasses, true);
+    ComponentClasses.Add(UActorComponent::StaticClass());
+    for (UClass* Class : ComponentClasses)
+    {
+        if (Class && Class->IsNative() && !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+        {
+            NativeClasses.Add(Class->GetFName(), Class);
+        }
+    }
+    bNativeIndexBuilt = true;
+    UE_LOG(LogTemp, Verbose, TEXT("FComponentFactory: Indexed %d native component classes"), NativeClasses.Num());
+}
+
+void FComponentFactory::EnsureBlueprintIndex() const
+{
+    if (bBlueprintIndexBuilt)
+    {
+        return;
+    }
+
+    BlueprintClasses.Reset();
+    BlueprintClassesByPackage.Reset();
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    TArray<FAssetData> Blueprints;
+    AssetRegistry->GetAssets(Filter, Blueprints);
+
+    for (const FAssetData& AssetData : Blueprints)
+    {
+        // The native ancestor tells a component Blueprint apart without loading it
+        const FString NativeParentPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+        const UClass* NativeParent = NativeParentPath.IsEmpty() ? nullptr
+            : FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+        if (!NativeParent || !NativeParent->IsChildOf(UActorComponent::StaticClass()))
+        {
+            continue;
+        }
+
+        const FString GeneratedClassPath = AssetData.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+        const FSoftObjectPath ClassPath = GeneratedClassPath.IsEmpty()
+            ? FSoftObjectPath(AssetData.GetObjectPathString() + TEXT("_C"))
+            : FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath));
+        BlueprintClasses.Add(AssetData.AssetName, ClassPath);
+        BlueprintClassesByPackage.Add(AssetData.PackageName, ClassPath);
+    }
+
+    // Assets found before the initial scan completes are not all of them; index again next time
+    bBlueprintIndexBuilt = !AssetRegistry->IsLoadingAssets();
+    UE_LOG(LogTemp, Verbose, TEXT("FComponentFactory: Indexed %d Blueprint component classes"), BlueprintClasses.Num());
+}
+
+void FComponentFactory::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    FScopeLock Lock(&ComponentMapLock);
+    bNativeIndexBuilt = false;
+}
+
+void FComponentFactory::HandleAssetChanged(const FAssetData& AssetData)
+{
+    FScopeLock Lock(&ComponentMapLock);
+    if (bBlueprintIndexBuilt && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        bBlueprintIndexBuilt = false;
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FComponentFactory::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    HandleAssetChanged(AssetData);
 }
 
 TArray<FString> FComponentFactory::GetAvailableTypes() const
@@ -238,6 +420,21 @@ void FComponentFactory::InitializeDefaultTypes()
     RegisterComponentType(TEXT("TimelineComponent"), UTimelineComponent::StaticClass());
     RegisterComponentType(TEXT("InputComponent"), UInputComponent::StaticClass());
 
+    // Short names agents use for the common types; other short names resolve by adding "Component"
+    TypeAliases.Add(TEXT("StaticMesh"), TEXT("StaticMeshComponent"));
+    TypeAliases.Add(TEXT("SkeletalMesh"), TEXT("SkeletalMeshComponent"));
+    TypeAliases.Add(TEXT("PointLight"), TEXT("PointLightComponent"));
+    TypeAliases.Add(TEXT("SpotLight"), TEXT("SpotLightComponent"));
+    TypeAliases.Add(TEXT("DirectionalLight"), TEXT("DirectionalLightComponent"));
+    TypeAliases.Add(TEXT("Box"), TEXT("BoxComponent"));
+    TypeAliases.Add(TEXT("Sphere"), TEXT("SphereComponent"));
+    TypeAliases.Add(TEXT("Capsule"), TEXT("CapsuleComponent"));
+    TypeAliases.Add(TEXT("Camera"), TEXT("CameraComponent"));
+    TypeAliases.Add(TEXT("Audio"), TEXT("AudioComponent"));
+    TypeAliases.Add(TEXT("Scene"), TEXT("SceneComponent"));
+    TypeAliases.Add(TEXT("Billboard"), TEXT("BillboardComponent"));
+    TypeAliases.Add(TEXT("Widget"), TEXT("WidgetComponent"));
+
     bDefaultTypesInitialized = true;
     
     UE_LOG(LogTemp, Log, TEXT("FComponentFactory: Initialized %d default component types"), ComponentTypeMap.Num());
@@ -0,0 +1,109 @@
+#include "MCPAdmissionController.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarMCPMaxInFlightCommands(
+    TEXT("mcp.MaxInFlightCommands"),
+    256,
+    TEXT("Most MCP commands in flight across all clients; further requests are answered with a busy error. 0 disables the limit."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMCPMaxInFlightCommandsPerClient(
+    TEXT("mcp.MaxInFlightCommandsPerClient"),
+    64,
+    TEXT("Most MCP commands one client may have in flight; further requests are answered with a busy error. 0 disables the limit."),
+    ECVF_Default);
+
+namespace
+{
+    /** Bounds of the suggested retry delay */
+    constexpr int32 MinRetryAfterMs = 10;
+    constexpr int32 MaxRetryAfterMs = 5000;
+
+    /** Weight of the latest command in the duration average */
+    constexpr double DurationSmoothing = 0.1;
+}
+
+FMCPAdmissionController::FMCPAdmissionController()
+    : TotalInFlight(0)
+    , AverageDurationSeconds(0.0)
+{
+}
+
+bool FMCPAdmissionController::TryAdmit(uint32 ClientId, int32& OutRetryAfterMs)
+{
+    const int32 MaxTotal = CVarMCPMaxInFlightCommands.GetValueOnAnyThread();
+    const int32 MaxPerClient = CVarMCPMaxInFlightCommandsPerClient.GetValueOnAnyThread();
+
+    FScopeLock ScopeLock(&Lock);
+
+    const int32 ClientInFlight = ClientId != 0 ? InFlightPerClient.FindRef(ClientId) : 0;
+    if (MaxTotal > 0 && TotalInFlight >= MaxTotal)
+    {
+        OutRetryAfterMs = EstimateRetryAfterMs(TotalInFlight - MaxTotal + 1, TotalInFlight);
+        return false;
+    }
+    if (ClientId != 0 && MaxPerClient > 0 && ClientInFlight >= MaxPerClient)
+    {
+        OutRetryAfterMs = EstimateRetryAfterMs(ClientInFlight - MaxPerClient + 1, ClientInFlight);
+        return false;
+    }
+
+    ++TotalInFlight;
+    if (ClientId != 0)
+    {
+        InFlightPerClient.Add(ClientId, ClientInFlight + 1);
+    }
+    OutRetryAfterMs = 0;
+    return true;
+}
+
+void FMCPAdmissionController::Release(uint32 ClientId, double DurationSeconds)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    --TotalInFlight;
+    if (ClientId != 0)
+    {
+        int32& ClientInFlight = InFlightPerClient.FindOrAdd(ClientId);
+        if (--ClientInFlight <= 0)
+        {
+            InFlightPerClient.Remove(ClientId);
+        }
+    }
+
+    AverageDurationSeconds = AverageDurationSeconds > 0.0
+        ? FMath::Lerp(AverageDurationSeconds, DurationSeconds, DurationSmoothing)
+        : DurationSeconds;
+}
+
+int32 FMCPAdmissionController::GetInFlightCount() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return TotalInFlight;
+}
+
+int32 FMCPAdmissionController::GetInFlightCount(uint32 ClientId) const
+{
+    FScopeLock ScopeLock(&Lock);
+    return InFlightPerClient.FindRef(ClientId);
+}
+
+int32 FMCPAdmissionController::EstimateRetryAfterMs(int32 ExcessCommands, int32 InFlightCommands) const
+{
+    // Commands finish roughly in turn, so with N in flight one completes about every 1/N of the
+    // time a command spends in flight; the client may send again once enough have completed
+    const double EstimateMs = AverageDurationSeconds * 1000.0 * FMath::Max(ExcessCommands, 1) / FMath::Max(InFlightCommands, 1);
+    return FMath::Clamp(FMath::CeilToInt(EstimateMs), MinRetryAfterMs, MaxRetryAfterMs);
+}
+
+TSharedRef<FJsonObject> FMCPAdmissionController::MakeBusyResponse(int32 RetryAfterMs)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Server busy, retry after %d ms"), RetryAfterMs));
+    ResponseJson->SetBoolField(TEXT("busy"), true);
+    ResponseJson->SetNumberField(TEXT("retry_after_ms"), RetryAfterMs);
+    return ResponseJson;
+}
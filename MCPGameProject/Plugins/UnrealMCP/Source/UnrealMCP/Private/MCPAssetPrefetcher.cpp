@@ -0,0 +1,449 @@
+#include "MCPAssetPrefetcher.h"
+#include "MCPLogging.h"
+#include "Services/AssetDiscoveryService.h"
+#include "Services/BlueprintService.h"
+#include "Services/GraphFingerprintCache.h"
+#include "Services/GraphReachabilityCache.h"
+#include "Services/BlueprintAction/BlueprintPinCompatibilityIndex.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Package.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<bool> CVarMCPPredictivePrefetch(
+    TEXT("mcp.PredictivePrefetch"),
+    true,
+    TEXT("Load the assets MCP clients usually ask for next while no commands are waiting"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMCPPrefetchIntervalSeconds(
+    TEXT("mcp.PrefetchIntervalSeconds"),
+    0.25f,
+    TEXT("Seconds between MCP asset prefetches; one asset is loaded or warmed per interval while no commands are waiting"),
+    ECVF_Default);
+
+namespace
+{
+    /** Bumped when the saved transitions change meaning */
+    constexpr int32 PersistentStateVersion = 1;
+
+    /** Params naming the asset a command works on, in the order they are looked for */
+    const TCHAR* const AssetKeyFields[] = {
+        TEXT("blueprint_name"),
+        TEXT("anim_blueprint_name"),
+        TEXT("blueprint_path"),
+        TEXT("asset_path"),
+    };
+}
+
+FMCPAssetPrefetcher& FMCPAssetPrefetcher::Get()
+{
+    static FMCPAssetPrefetcher Instance;
+    return Instance;
+}
+
+void FMCPAssetPrefetcher::Initialize(TFunction<bool()> InCanPrefetch)
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    const int32 LoadedCount = LoadPersistentState();
+    UE_LOG(LogUnrealMCP, Log, TEXT("FMCPAssetPrefetcher: Restored transitions from %d assets of past sessions"), LoadedCount);
+
+    CanPrefetch = MoveTemp(InCanPrefetch);
+    const float Interval = FMath::Max(0.0f, CVarMCPPrefetchIntervalSeconds.GetValueOnGameThread());
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPAssetPrefetcher::Tick), Interval);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("asset_prefetch"), TEXT("cache"),
+        [this](FMCPCacheStatsRegistry::FStats& OutStats)
+        {
+            OutStats.Hits = CacheCounters.Hits;
+            OutStats.Misses = CacheCounters.Misses;
+            TSharedPtr<FJsonObject> Details = MakeShared<FJsonObject>();
+            Details->SetNumberField(TEXT("packages_requested"), static_cast<double>(PackagesRequested));
+            Details->SetNumberField(TEXT("packages_loaded"), static_cast<double>(PackagesLoaded));
+            Details->SetNumberField(TEXT("warms"), static_cast<double>(Warms));
+            FScopeLock ScopeLock(&Lock);
+            OutStats.Entries = Transitions.Num();
+            Details->SetNumberField(TEXT("pending"), PendingPrefetches.Num() + PendingWarms.Num());
+            OutStats.Details = Details;
+        },
+        [this]()
+        {
+            CacheCounters.Reset();
+            PackagesRequested = 0;
+            PackagesLoaded = 0;
+            Warms = 0;
+        });
+}
+
+void FMCPAssetPrefetcher::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+    CanPrefetch = nullptr;
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("asset_prefetch"));
+
+    FScopeLock ScopeLock(&Lock);
+    if (bDirty)
+    {
+        SavePersistentState();
+    }
+    Transitions.Empty();
+    LastKey.Empty();
+    PendingPrefetches.Empty();
+    PendingWarms.Empty();
+    Prefetched.Empty();
+    bDirty = false;
+}
+
+FString FMCPAssetPrefetcher::GetAssetKey(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Value;
+    if (Params.IsValid())
+    {
+        for (const TCHAR* Field : AssetKeyFields)
+        {
+            if (Params->TryGetStringField(Field, Value) && !Value.IsEmpty())
+            {
+                // "/Game/BP_Door", "/Game/BP_Door.BP_Door" and "/Game/BP_Door.uasset" are one asset
+                return Value.StartsWith(TEXT("/")) ? FPackageName::ObjectPathToPackageName(Value) : Value;
+            }
+        }
+    }
+    return FString();
+}
+
+void FMCPAssetPrefetcher::RecordAccess(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    const FString Key = GetAssetKey(Params);
+    FScopeLock ScopeLock(&Lock);
+    if (Key.IsEmpty() || Key == LastKey)
+    {
+        return;
+    }
+
+    if (Prefetched.Remove(Key) > 0)
+    {
+        CacheCounters.RecordHit();
+    }
+    else
+    {
+        CacheCounters.RecordMiss();
+    }
+
+    if (!LastKey.IsEmpty())
+    {
+        AddTransition(LastKey, Key);
+    }
+    LastKey = Key;
+
+    // Predictions for the previous asset are stale now
+    PendingPrefetches.Reset();
+    if (const TArray<FSuccessor>* Successors = Transitions.Find(Key))
+    {
+        for (const FSuccessor& Successor : *Successors)
+        {
+            if (PendingPrefetches.Num() >= MaxPrefetchesPerAccess || Successor.Count < MinTransitionCount)
+            {
+                break;
+            }
+            if (!Prefetched.Contains(Successor.Key))
+            {
+                PendingPrefetches.Add(Successor.Key);
+            }
+        }
+    }
+    if (PendingWarms.Num() >= MaxPrefetched)
+    {
+        PendingWarms.RemoveAt(0);
+    }
+    PendingWarms.AddUnique(Key);
+}
+
+void FMCPAssetPrefetcher::AddTransition(const FString& From, const FString& To)
+{
+    TArray<FSuccessor>* Successors = Transitions.Find(From);
+    if (!Successors)
+    {
+        if (Transitions.Num() >= MaxSources)
+        {
+            return;
+        }
+        Successors = &Transitions.Add(From);
+    }
+    bDirty = true;
+
+    // Kept sorted by count, most seen first
+    int32 Index = Successors->IndexOfByPredicate([&To](const FSuccessor& Successor) { return Successor.Key == To; });
+    if (Index == INDEX_NONE)
+    {
+        if (Successors->Num() >= MaxSuccessors)
+        {
+            Successors->Pop(EAllowShrinking::No);
+        }
+        Index = Successors->Add({ To, 0 });
+    }
+
+    (*Successors)[Index].Count++;
+    while (Index > 0 && (*Successors)[Index - 1].Count < (*Successors)[Index].Count)
+    {
+        Successors->Swap(Index - 1, Index);
+        Index--;
+    }
+}
+
+bool FMCPAssetPrefetcher::Tick(float DeltaTime)
+{
+    if (!CVarMCPPredictivePrefetch.GetValueOnGameThread() || (CanPrefetch && !CanPrefetch()))
+    {
+        return true;
+    }
+
+    // Warm what is loaded before loading more
+    FString Key;
+    bool bWarm = false;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (PendingWarms.Num() > 0)
+        {
+            Key = PendingWarms[0];
+            PendingWarms.RemoveAt(0);
+            bWarm = true;
+        }
+        else if (PendingPrefetches.Num() > 0)
+        {
+            Key = PendingPrefetches[0];
+            PendingPrefetches.RemoveAt(0);
+        }
+    }
+
+    if (Key.IsEmpty())
+    {
+        return true;
+    }
+    if (bWarm)
+    {
+        Warm(Key);
+    }
+    else
+    {
+        Prefetch(Key);
+    }
+    return true;
+}
+
+bool FMCPAssetPrefetcher::ResolveKey(const FString& Key, FSoftObjectPath& OutPath)
+{
+    if (Key.StartsWith(TEXT("/")))
+    {
+        OutPath = FSoftObjectPath(Key + TEXT(".") + FPackageName::GetShortName(Key));
+        return true;
+    }
+    return FAssetDiscoveryService::Get().ResolveAssetPath(Key, UBlueprint::StaticClass(), OutPath)
+        == FAssetDiscoveryService::EAssetResolution::Found;
+}
+
+void FMCPAssetPrefetcher::Prefetch(const FString& Key)
+{
+    FSoftObjectPath Path;
+    if (!ResolveKey(Key, Path))
+    {
+        return;
+    }
+
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (Prefetched.Num() >= MaxPrefetched)
+        {
+            Prefetched.RemoveAt(0);
+        }
+        Prefetched.AddUnique(Key);
+    }
+
+    const FString PackageName = Path.GetLongPackageName();
+    if (FindPackage(nullptr, *PackageName))
+    {
+        Warm(Key);
+        return;
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("FMCPAssetPrefetcher: Prefetching '%s'"), *PackageName);
+    PackagesRequested++;
+    LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda(
+        [this, Key](const FName& LoadedName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+        {
+            if (!bInitialized || Result != EAsyncLoadingResult::Succeeded || !LoadedPackage)
+            {
+                return;
+            }
+            PackagesLoaded++;
+            FScopeLock ScopeLock(&Lock);
+            PendingWarms.AddUnique(Key);
+        }));
+}
+
+void FMCPAssetPrefetcher::Warm(const FString& Key)
+{
+    // Only what is loaded; a Blueprint that is not would be loaded synchronously by the lookups below
+    FSoftObjectPath Path;
+    if (!ResolveKey(Key, Path))
+    {
+        return;
+    }
+    UBlueprint* Blueprint = Cast<UBlueprint>(Path.ResolveObject());
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    Warms++;
+    FBlueprintService::Get().FindBlueprint(Key);
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (Graph)
+        {
+            FGraphFingerprintCache::Get().GetFingerprint(Graph);
+            FGraphReachabilityCache::Get().Analyze(Graph);
+        }
+    }
+
+    if (Blueprint->ParentClass)
+    {
+        TArray<const FBlueprintPinCompatibilityIndex::FEntry*> Matches;
+        FBlueprintPinCompatibilityIndex::Get().Find(TEXT("object"), Blueprint->ParentClass, FString(), 1, Matches);
+    }
+}
+
+FString FMCPAssetPrefetcher::GetPersistentStatePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("AccessPatterns.json"));
+}
+
+int32 FMCPAssetPrefetcher::LoadPersistentState()
+{
+    FString InputString;
+    if (!FFileHelper::LoadFileToString(InputString, *GetPersistentStatePath()))
+    {
+        return 0;
+    }
+
+    TSharedPtr<FJsonObject> RootObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    const TArray<TSharedPtr<FJsonValue>>* SourceValues = nullptr;
+    int32 Version = 0;
+    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()
+        || !RootObj->TryGetNumberField(TEXT("version"), Version) || Version != PersistentStateVersion
+        || !RootObj->TryGetArrayField(TEXT("transitions"), SourceValues))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FMCPAssetPrefetcher: Ignoring unreadable or outdated '%s'"), *GetPersistentStatePath());
+        return 0;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    for (const TSharedPtr<FJsonValue>& SourceValue : *SourceValues)
+    {
+        const TSharedPtr<FJsonObject>* SourceObj = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* SuccessorValues = nullptr;
+        FString From;
+        if (Transitions.Num() >= MaxSources || !SourceValue.IsValid() || !SourceValue->TryGetObject(SourceObj)
+            || !(*SourceObj)->TryGetStringField(TEXT("from"), From)
+            || !(*SourceObj)->TryGetArrayField(TEXT("to"), SuccessorValues))
+        {
+            continue;
+        }
+
+        TArray<FSuccessor> Successors;
+        for (const TSharedPtr<FJsonValue>& SuccessorValue : *SuccessorValues)
+        {
+            const TSharedPtr<FJsonObject>* SuccessorObj = nullptr;
+            FSuccessor Successor;
+            if (Successors.Num() < MaxSuccessors && SuccessorValue.IsValid() && SuccessorValue->TryGetObject(SuccessorObj)
+                && (*SuccessorObj)->TryGetStringField(TEXT("asset"), Successor.Key)
+                && (*SuccessorObj)->TryGetNumberField(TEXT("count"), Successor.Count))
+            {
+                // Halved every session, so a pattern that stopped repeating is forgotten
+                Successor.Count /= 2;
+                if (Successor.Count > 0)
+                {
+                    Successors.Add(MoveTemp(Successor));
+                }
+            }
+        }
+
+        if (Successors.Num() > 0)
+        {
+            Successors.Sort([](const FSuccessor& A, const FSuccessor& B) { return A.Count > B.Count; });
+            Transitions.Add(From, MoveTemp(Successors));
+        }
+    }
+    return Transitions.Num();
+}
+
+void FMCPAssetPrefetcher::SavePersistentState() const
+{
+    TArray<TSharedPtr<FJsonValue>> SourceValues;
+    SourceValues.Reserve(Transitions.Num());
+    for (const TPair<FString, TArray<FSuccessor>>& Pair : Transitions)
+    {
+        TArray<TSharedPtr<FJsonValue>> SuccessorValues;
+        for (const FSuccessor& Successor : Pair.Value)
+        {
+            TSharedPtr<FJsonObject> SuccessorObj = MakeShared<FJsonObject>();
+            SuccessorObj->SetStringField(TEXT("asset"), Successor.Key);
+            SuccessorObj->SetNumberField(TEXT("count"), Successor.Count);
+            SuccessorValues.Add(MakeShared<FJsonValueObject>(SuccessorObj));
+        }
+
+        TSharedPtr<FJsonObject> SourceObj = MakeShared<FJsonObject>();
+        SourceObj->SetStringField(TEXT("from"), Pair.Key);
+        SourceObj->SetArrayField(TEXT("to"), SuccessorValues);
+        SourceValues.Add(MakeShared<FJsonValueObject>(SourceObj));
+    }
+
+    TSharedPtr<FJsonObject> RootObj = MakeShared<FJsonObject>();
+    RootObj->SetNumberField(TEXT("version"), PersistentStateVersion);
+    RootObj->SetArrayField(TEXT("transitions"), SourceValues);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObj.ToSharedRef(), Writer);
+
+    const FString StatePath = GetPersistentStatePath();
+    if (!FFileHelper::SaveStringToFile(OutputString, *StatePath))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FMCPAssetPrefetcher: Could not write '%s'"), *StatePath);
+        return;
+    }
+    UE_LOG(LogUnrealMCP, Log, TEXT("FMCPAssetPrefetcher: Saved transitions from %d assets"), SourceValues.Num());
+}
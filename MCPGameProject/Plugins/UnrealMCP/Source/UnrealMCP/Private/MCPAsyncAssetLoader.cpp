@@ -0,0 +1,143 @@
+#include "MCPAsyncAssetLoader.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "MCPCancellation.h"
+#include "MCPLogging.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectGlobals.h"
+
+static TAutoConsoleVariable<int32> CVarMCPAsyncLoadMaxInFlight(
+    TEXT("mcp.AsyncLoadMaxInFlight"),
+    16,
+    TEXT("Packages an MCP command that processes many assets keeps loading at once"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMCPAsyncLoadMinFreeMemoryMB(
+    TEXT("mcp.AsyncLoadMinFreeMemoryMB"),
+    2048,
+    TEXT("Available physical memory, in MB, below which an MCP command that processes many assets collects garbage between assets; 0 never collects"),
+    ECVF_Default);
+
+namespace
+{
+    /** Loads that landed and are not handed over yet; shared with the load callbacks, which may outlive LoadEach */
+    struct FLandedLoads
+    {
+        /** Index of the asset and whether its package loaded */
+        TArray<TPair<int32, bool>> Landed;
+    };
+
+    bool IsLowOnMemory()
+    {
+        const int64 MinFreeBytes = static_cast<int64>(CVarMCPAsyncLoadMinFreeMemoryMB.GetValueOnGameThread()) * 1024 * 1024;
+        return MinFreeBytes > 0 && static_cast<int64>(FPlatformMemory::GetStats().AvailablePhysical) < MinFreeBytes;
+    }
+}
+
+FMCPAsyncAssetLoader::FStats FMCPAsyncAssetLoader::LoadEach(const TArray<FSoftObjectPath>& Paths, FOnAssetLoaded OnLoaded, int32 MaxInFlight)
+{
+    check(IsInGameThread());
+
+    FStats Stats;
+    const int32 InFlightLimit = FMath::Max(1, MaxInFlight > 0 ? MaxInFlight : CVarMCPAsyncLoadMaxInFlight.GetValueOnGameThread());
+    int32 HandedOverSinceCheck = 0;
+
+    // Returns false once loading should stop
+    auto HandOver = [&](int32 Index, UObject* Asset)
+    {
+        if (!OnLoaded(Index, Asset))
+        {
+            Stats.bStopped = true;
+            return false;
+        }
+
+        if (++HandedOverSinceCheck >= AssetsBetweenCollections)
+        {
+            HandedOverSinceCheck = 0;
+            if (IsLowOnMemory() && !IsGarbageCollecting())
+            {
+                CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+                Stats.GarbageCollections++;
+            }
+        }
+        return true;
+    };
+
+    // Loaded assets need no request
+    TArray<int32> ToLoad;
+    for (int32 Index = 0; Index < Paths.Num(); ++Index)
+    {
+        if (UObject* Asset = Paths[Index].ResolveObject())
+        {
+            Stats.AlreadyLoaded++;
+            if (!HandOver(Index, Asset))
+            {
+                return Stats;
+            }
+        }
+        else
+        {
+            ToLoad.Add(Index);
+        }
+    }
+
+    TSharedRef<FLandedLoads> Loads = MakeShared<FLandedLoads>();
+    int32 NextToLoad = 0;
+    int32 InFlight = 0;
+    while (NextToLoad < ToLoad.Num() || InFlight > 0)
+    {
+        if (FMCPCancellationToken::IsCurrentRequestCancelled())
+        {
+            Stats.bStopped = true;
+            break;
+        }
+
+        while (NextToLoad < ToLoad.Num() && InFlight < InFlightLimit)
+        {
+            const int32 Index = ToLoad[NextToLoad++];
+            InFlight++;
+            Stats.Requested++;
+            LoadPackageAsync(Paths[Index].GetLongPackageName(), FLoadPackageAsyncDelegate::CreateLambda(
+                [Loads, Index](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+                {
+                    Loads->Landed.Emplace(Index, Result == EAsyncLoadingResult::Succeeded);
+                }));
+        }
+
+        // Completion callbacks run on this thread while the loader is pumped
+        if (Loads->Landed.Num() == 0)
+        {
+            ProcessAsyncLoadingUntilComplete([&Loads]() { return Loads->Landed.Num() > 0; }, WaitSliceSeconds);
+        }
+
+        TArray<TPair<int32, bool>> Landed = MoveTemp(Loads->Landed);
+        Loads->Landed.Reset();
+        for (int32 LandedIndex = 0; LandedIndex < Landed.Num(); ++LandedIndex)
+        {
+            InFlight--;
+            const int32 Index = Landed[LandedIndex].Key;
+            UObject* Asset = Landed[LandedIndex].Value ? Paths[Index].ResolveObject() : nullptr;
+            if (Asset)
+            {
+                Stats.Loaded++;
+            }
+            else
+            {
+                Stats.Failed++;
+                UE_LOG(LogUnrealMCP, Verbose, TEXT("FMCPAsyncAssetLoader: Could not load '%s'"), *Paths[Index].ToString());
+            }
+
+            if (!HandOver(Index, Asset))
+            {
+                return Stats;
+            }
+        }
+    }
+
+    if (Stats.GarbageCollections > 0)
+    {
+        UE_LOG(LogUnrealMCP, Log, TEXT("FMCPAsyncAssetLoader: Collected garbage %d time(s) while loading %d asset(s), memory was low"),
+            Stats.GarbageCollections, Stats.Requested);
+    }
+    return Stats;
+}
@@ -0,0 +1,204 @@
+#include "MCPAttachments.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Base64.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    /** Condensed JSON text of a reference around its id: {"$attachment":"<id>"} */
+    const FStringView ReferencePrefix = TEXTVIEW("{\"$attachment\":\"");
+    const FStringView ReferenceSuffix = TEXTVIEW("\"}");
+
+    /** Ids are "att-" and a number; anything longer is not a reference */
+    constexpr int32 MaxIdLength = 32;
+
+    struct FHeldAttachment
+    {
+        TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Data;
+        double AddedTime = 0.0;
+    };
+
+    struct FAttachmentStore
+    {
+        FCriticalSection Lock;
+        TMap<FString, FHeldAttachment> Held;
+        int64 HeldBytes = 0;
+        uint64 NextId = 0;
+    };
+
+    FAttachmentStore& GetStore()
+    {
+        static FAttachmentStore Store;
+        return Store;
+    }
+
+    /** Drop expired attachments, then the oldest ones until IncomingBytes fit; under the store lock */
+    void Prune(FAttachmentStore& Store, double Now, int64 IncomingBytes)
+    {
+        for (auto It = Store.Held.CreateIterator(); It; ++It)
+        {
+            if (Now - It->Value.AddedTime >= FMCPAttachments::LifetimeSeconds)
+            {
+                Store.HeldBytes -= It->Value.Data->Num();
+                It.RemoveCurrent();
+            }
+        }
+
+        while (Store.Held.Num() > 0 && Store.HeldBytes + IncomingBytes > FMCPAttachments::MaxHeldBytes)
+        {
+            const TPair<FString, FHeldAttachment>* Oldest = nullptr;
+            for (const TPair<FString, FHeldAttachment>& Pair : Store.Held)
+            {
+                if (!Oldest || Pair.Value.AddedTime < Oldest->Value.AddedTime)
+                {
+                    Oldest = &Pair;
+                }
+            }
+            Store.HeldBytes -= Oldest->Value.Data->Num();
+            const FString OldestId = Oldest->Key;
+            Store.Held.Remove(OldestId);
+        }
+    }
+
+    /** Call Visit(Start, End, Id) for every reference in the text, in order; [Start, End) is the whole reference */
+    template <typename VisitorType>
+    void ForEachReference(const FString& Response, VisitorType&& Visit)
+    {
+        const FStringView Text(Response);
+        int32 SearchFrom = 0;
+        while (SearchFrom < Text.Len())
+        {
+            const int32 Start = Text.Find(ReferencePrefix, SearchFrom);
+            if (Start == INDEX_NONE)
+            {
+                return;
+            }
+            const int32 IdStart = Start + ReferencePrefix.Len();
+            const FStringView Rest = Text.RightChop(IdStart);
+            const int32 IdLength = Rest.Left(MaxIdLength + ReferenceSuffix.Len()).Find(ReferenceSuffix);
+            if (IdLength <= 0)
+            {
+                SearchFrom = IdStart;
+                continue;
+            }
+            const int32 End = IdStart + IdLength + ReferenceSuffix.Len();
+            Visit(Start, End, Rest.Left(IdLength));
+            SearchFrom = End;
+        }
+    }
+
+    /** @return The held bytes of an attachment, or nullptr once they were dropped */
+    TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> FindData(FAttachmentStore& Store, FStringView Id)
+    {
+        const FHeldAttachment* Held = Store.Held.Find(FString(Id));
+        return Held ? Held->Data : nullptr;
+    }
+}
+
+TSharedRef<FJsonValue> FMCPAttachments::MakeReference(TArray64<uint8>&& Data)
+{
+    FHeldAttachment Attachment;
+    Attachment.Data = MakeShared<const TArray64<uint8>, ESPMode::ThreadSafe>(MoveTemp(Data));
+    Attachment.AddedTime = FPlatformTime::Seconds();
+    const int64 NumBytes = Attachment.Data->Num();
+
+    FString Id;
+    {
+        FAttachmentStore& Store = GetStore();
+        FScopeLock Lock(&Store.Lock);
+        Prune(Store, Attachment.AddedTime, NumBytes);
+        Id = FString::Printf(TEXT("att-%llu"), ++Store.NextId);
+        Store.Held.Add(Id, MoveTemp(Attachment));
+        Store.HeldBytes += NumBytes;
+    }
+
+    TSharedRef<FJsonObject> Reference = MakeShared<FJsonObject>();
+    Reference->SetStringField(TEXT("$attachment"), Id);
+    return MakeShared<FJsonValueObject>(Reference);
+}
+
+bool FMCPAttachments::HasReferences(const FString& Response)
+{
+    return FStringView(Response).Find(ReferencePrefix) != INDEX_NONE;
+}
+
+bool FMCPAttachments::FindReferences(const FString& Response, TArray<FMCPAttachment>& OutAttachments)
+{
+    OutAttachments.Reset();
+    bool bAllHeld = true;
+
+    FAttachmentStore& Store = GetStore();
+    FScopeLock Lock(&Store.Lock);
+    ForEachReference(Response, [&](int32 Start, int32 End, FStringView Id)
+    {
+        if (OutAttachments.ContainsByPredicate([Id](const FMCPAttachment& Listed) { return FStringView(Listed.Id) == Id; }))
+        {
+            return;
+        }
+        TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Data = FindData(Store, Id);
+        if (!Data.IsValid())
+        {
+            bAllHeld = false;
+            return;
+        }
+        FMCPAttachment& Attachment = OutAttachments.AddDefaulted_GetRef();
+        Attachment.Id = FString(Id);
+        Attachment.Data = MoveTemp(Data);
+    });
+    return bAllHeld;
+}
+
+bool FMCPAttachments::InlineReferences(FString& Response)
+{
+    struct FFoundReference
+    {
+        int32 Start;
+        int32 End;
+        TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Data;
+    };
+
+    // Take the bytes first, so nothing is encoded under the lock
+    TArray<FFoundReference> References;
+    {
+        FAttachmentStore& Store = GetStore();
+        FScopeLock Lock(&Store.Lock);
+        ForEachReference(Response, [&](int32 Start, int32 End, FStringView Id)
+        {
+            References.Add({Start, End, FindData(Store, Id)});
+        });
+    }
+    if (References.Num() == 0)
+    {
+        return false;
+    }
+
+    FString Inlined;
+    int64 InlinedSize = Response.Len();
+    for (const FFoundReference& Reference : References)
+    {
+        InlinedSize += Reference.Data.IsValid() ? FBase64::GetEncodedDataSize(static_cast<uint32>(Reference.Data->Num())) + 2 : 4;
+    }
+    Inlined.Reserve(static_cast<int32>(FMath::Min<int64>(InlinedSize, MAX_int32)));
+
+    int32 Copied = 0;
+    for (const FFoundReference& Reference : References)
+    {
+        Inlined.AppendChars(*Response + Copied, Reference.Start - Copied);
+        if (Reference.Data.IsValid())
+        {
+            Inlined.AppendChar(TEXT('"'));
+            Inlined.Append(FBase64::Encode(Reference.Data->GetData(), static_cast<uint32>(Reference.Data->Num())));
+            Inlined.AppendChar(TEXT('"'));
+        }
+        else
+        {
+            Inlined.Append(TEXT("null"));
+        }
+        Copied = Reference.End;
+    }
+    Inlined.AppendChars(*Response + Copied, Response.Len() - Copied);
+    Response = MoveTemp(Inlined);
+    return true;
+}
@@ -0,0 +1,204 @@
+#include "MCPBatchEditScope.h"
+#include "MCPCompileQueue.h"
+#include "MCPSaveQueue.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Editor/Transactor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "MCPLogging.h"
+#include "ScopedTransaction.h"
+#include "Services/BlueprintChangeJournal.h"
+#include "Services/GraphFingerprintCache.h"
+#include "Services/GraphReachabilityCache.h"
+#include "Services/BlueprintCompileResultCache.h"
+#include "Services/BlueprintComponentLookupCache.h"
+#include "Services/UMG/WidgetValidationCache.h"
+
+namespace
+{
+    struct FDeferredNotification
+    {
+        TWeakObjectPtr<UObject> Asset;
+        TFunction<void()> Notification;
+    };
+
+    /** Open scopes; only touched on the game thread */
+    int32 ScopeDepth = 0;
+
+    /** Whether the outermost scope undoes its transaction when it closes */
+    bool bRollbackRequested = false;
+
+    TArray<TWeakObjectPtr<UBlueprint>> ModifiedBlueprints;
+    TSet<const UObject*> ModifiedBlueprintSet;
+    TArray<TWeakObjectPtr<UEdGraph>> ChangedGraphs;
+    TSet<const UObject*> ChangedGraphSet;
+    TArray<FDeferredNotification> DeferredNotifications;
+    TSet<TPair<const UObject*, FName>> DeferredNotificationKeys;
+}
+
+FMCPBatchEditScope::FMCPBatchEditScope(const FText& Description)
+{
+    check(IsInGameThread());
+    if (ScopeDepth++ == 0)
+    {
+        bRollbackRequested = false;
+        if (GEditor && GEditor->Trans)
+        {
+            PreviousTransactionId = GEditor->Trans->GetUndoContext(false).TransactionId;
+        }
+        Transaction = MakeUnique<FScopedTransaction>(Description);
+    }
+}
+
+FMCPBatchEditScope::~FMCPBatchEditScope()
+{
+    check(IsInGameThread());
+    if (--ScopeDepth == 0)
+    {
+        Flush();
+        Transaction.Reset();
+
+        if (bRollbackRequested)
+        {
+            bRollbackRequested = false;
+            UndoTransaction();
+        }
+
+        // Compiles deferred during the batch run once, outside its transaction, and the packages
+        // the batch saved are written after them
+        FMCPCompileQueue::Get().Flush();
+        FMCPSaveQueue::Get().Flush();
+    }
+}
+
+bool FMCPBatchEditScope::IsActive()
+{
+    return ScopeDepth > 0 && IsInGameThread();
+}
+
+void FMCPBatchEditScope::MarkBlueprintAsModified(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+    FBlueprintChangeJournal::Get().NoteModified(Blueprint);
+    FGraphFingerprintCache::Get().Invalidate(Blueprint);
+    FGraphReachabilityCache::Get().Invalidate(Blueprint);
+    FBlueprintCompileResultCache::Get().Invalidate(Blueprint);
+    FBlueprintComponentLookupCache::Get().Invalidate(Blueprint);
+    FWidgetValidationCache::Get().Invalidate(Blueprint);
+    if (!IsActive())
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        return;
+    }
+    if (!ModifiedBlueprintSet.Contains(Blueprint))
+    {
+        ModifiedBlueprintSet.Add(Blueprint);
+        ModifiedBlueprints.Add(Blueprint);
+    }
+}
+
+void FMCPBatchEditScope::NotifyGraphChanged(UEdGraph* Graph)
+{
+    if (!Graph)
+    {
+        return;
+    }
+    // The notification may be deferred past reads made later in the batch
+    FGraphFingerprintCache::Get().Invalidate(Graph);
+    if (!IsActive())
+    {
+        Graph->NotifyGraphChanged();
+        return;
+    }
+    if (!ChangedGraphSet.Contains(Graph))
+    {
+        ChangedGraphSet.Add(Graph);
+        ChangedGraphs.Add(Graph);
+    }
+}
+
+void FMCPBatchEditScope::Defer(UObject* Asset, FName Kind, TFunction<void()> Notification)
+{
+    if (!IsActive())
+    {
+        Notification();
+        return;
+    }
+
+    const TPair<const UObject*, FName> Key(Asset, Kind);
+    if (!DeferredNotificationKeys.Contains(Key))
+    {
+        DeferredNotificationKeys.Add(Key);
+        DeferredNotifications.Add(FDeferredNotification{ Asset, MoveTemp(Notification) });
+    }
+}
+
+void FMCPBatchEditScope::RequestRollback()
+{
+    if (IsActive())
+    {
+        bRollbackRequested = true;
+    }
+}
+
+void FMCPBatchEditScope::UndoTransaction() const
+{
+    if (!GEditor || !GEditor->Trans)
+    {
+        return;
+    }
+
+    // A batch that modified nothing leaves no transaction behind; never undo an earlier one
+    if (GEditor->Trans->GetUndoContext(false).TransactionId == PreviousTransactionId)
+    {
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("Batch rollback: nothing was recorded"));
+        return;
+    }
+
+    if (!GEditor->UndoTransaction(false))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("Batch rollback: undoing the batch transaction failed"));
+    }
+}
+
+void FMCPBatchEditScope::Flush()
+{
+    // Take the lists first: the scope is already closed, so anything a notification triggers runs immediately
+    TArray<TWeakObjectPtr<UEdGraph>> Graphs = MoveTemp(ChangedGraphs);
+    TArray<TWeakObjectPtr<UBlueprint>> Blueprints = MoveTemp(ModifiedBlueprints);
+    TArray<FDeferredNotification> Notifications = MoveTemp(DeferredNotifications);
+    ChangedGraphs.Reset();
+    ModifiedBlueprints.Reset();
+    DeferredNotifications.Reset();
+    ChangedGraphSet.Reset();
+    ModifiedBlueprintSet.Reset();
+    DeferredNotificationKeys.Reset();
+
+    for (const TWeakObjectPtr<UEdGraph>& Graph : Graphs)
+    {
+        if (Graph.IsValid())
+        {
+            Graph->NotifyGraphChanged();
+        }
+    }
+
+    for (const TWeakObjectPtr<UBlueprint>& Blueprint : Blueprints)
+    {
+        if (Blueprint.IsValid())
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint.Get());
+        }
+    }
+
+    for (FDeferredNotification& Deferred : Notifications)
+    {
+        if (Deferred.Asset.IsValid())
+        {
+            Deferred.Notification();
+        }
+    }
+}
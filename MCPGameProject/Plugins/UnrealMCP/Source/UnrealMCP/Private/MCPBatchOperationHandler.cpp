@@ -3,15 +3,24 @@
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Misc/Guid.h"
-#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
 #include "Logging/LogMacros.h"
+#include "UObject/GarbageCollection.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Commands/MCPResponseWriter.h"
+#include "MCPCancellation.h"
+#include "MCPAttachments.h"
+#include "MCPBatchEditScope.h"
+#include "MCPBatchReferences.h"
+#include "UnrealMCPSettings.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogMCPBatchOperations, Log, All);
 
 UMCPBatchOperationHandler::UMCPBatchOperationHandler()
     : BatchContext(nullptr)
     , bStopOnFirstFailure(false)
-    , MaxParallelOperations(4)
+    , MaxParallelOperations(FMath::Max(1, UUnrealMCPSettings::Get()->MaxParallelBatchOperations))
     , bBatchExecuted(false)
 {
     BatchContext = NewObject<UMCPOperationContext>(this, TEXT("BatchContext"));
@@ -99,6 +108,23 @@ bool UMCPBatchOperationHandler::ExecuteBatch()
         return true;
     }
     
+    // Parse string parameters once, and make each operation depend on the ones it refers to
+    TSet<FString> OperationIds;
+    for (const FMCPBatchOperation& Operation : Operations)
+    {
+        OperationIds.Add(Operation.OperationId);
+    }
+    for (FMCPBatchOperation& Operation : Operations)
+    {
+        Operation.Params = GetParamsObject(Operation);
+        TArray<FString> ReferencedIds;
+        FMCPBatchReferences::Collect(MakeShared<FJsonValueObject>(Operation.Params), OperationIds, ReferencedIds);
+        for (const FString& ReferencedId : ReferencedIds)
+        {
+            Operation.Dependencies.AddUnique(ReferencedId);
+        }
+    }
+    
     // Validate dependencies
     if (!ValidateDependencies())
     {
@@ -112,56 +138,238 @@ bool UMCPBatchOperationHandler::ExecuteBatch()
         return false;
     }
     
+    // Game-thread commands run inline on the calling thread
+    check(IsInGameThread());
+    
     // Sort operations by priority and dependencies
     SortOperationsByPriorityAndDependencies();
     
     bBatchExecuted = true;
+    
+    // One undo entry and one round of editor notifications for the whole batch
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Batch (%d operations)"), Operations.Num())));
+    
     bool bOverallSuccess = true;
+    bool bStopped = false;
+    WaveStats.Empty();
+    SucceededOperationIds.Empty();
+    Results.Reserve(Results.Num() + Operations.Num());
     
     UE_LOG(LogMCPBatchOperations, Log, TEXT("Starting batch execution with %d operations"), Operations.Num());
     
-    // Execute operations
-    for (const FMCPBatchOperation& Operation : Operations)
+    // Dependency graph by index: how many dependencies each operation still waits on, which
+    // operations need it to succeed, and which only wait for it to finish
+    const int32 NumOperations = Operations.Num();
+    TMap<FString, int32> IndexById;
+    for (int32 Index = 0; Index < NumOperations; ++Index)
+    {
+        IndexById.Add(Operations[Index].OperationId, Index);
+    }
+    
+    const TMap<FString, TArray<FString>> DependencyGraph = FMCPBatchOperationUtils::CreateDependencyGraph(Operations);
+    TArray<int32> PendingDependencies;
+    PendingDependencies.SetNumZeroed(NumOperations);
+    TArray<TArray<int32>> Dependents;
+    Dependents.SetNum(NumOperations);
+    TArray<TArray<int32>> Followers;
+    Followers.SetNum(NumOperations);
+    TArray<bool> bFinished;
+    bFinished.SetNumZeroed(NumOperations);
+    TArray<FOperationOutcome> Outcomes;
+    Outcomes.SetNum(NumOperations);
+    TArray<TSharedPtr<FJsonObject>> ResolvedParams;
+    ResolvedParams.SetNum(NumOperations);
+    TMap<FString, TSharedPtr<FJsonObject>> ResultsById;
+    TArray<int32> Ready;
+    
+    auto ReleaseFollowers = [&](int32 FinishedIndex)
+    {
+        for (int32 FollowerIndex : Followers[FinishedIndex])
+        {
+            if (--PendingDependencies[FollowerIndex] == 0 && !bFinished[FollowerIndex])
+            {
+                Ready.Add(FollowerIndex);
+            }
+        }
+    };
+    
+    // Operations that can never run, because a dependency failed, was skipped or isn't in the batch
+    auto SkipOperation = [&](int32 SkippedIndex)
     {
-        // Check if dependencies are satisfied
-        if (!AreDependenciesSatisfied(Operation))
-        {
-            FMCPBatchOperationResult FailedResult;
-            FailedResult.Operation = Operation;
-            FailedResult.bSuccess = false;
-            FailedResult.ResultData = TEXT("Dependencies not satisfied");
-            FailedResult.OperationContext = NewObject<UMCPOperationContext>(this);
-            FailedResult.OperationContext->Initialize(Operation.OperationType, Operation.OperationId);
-            FailedResult.OperationContext->AddError(
-                FMCPError(EMCPErrorType::ExecutionFailed, 0, TEXT("Operation dependencies not satisfied")),
-                EMCPErrorSeverity::Error
-            );
-            
-            Results.Add(FailedResult);
+        TArray<int32> Stack = { SkippedIndex };
+        while (Stack.Num() > 0)
+        {
+            const int32 Index = Stack.Pop(EAllowShrinking::No);
+            if (bFinished[Index])
+            {
+                continue;
+            }
+            bFinished[Index] = true;
+            Results.Add(MakeDependencyFailedResult(Operations[Index]));
             bOverallSuccess = false;
             
-            if (bStopOnFirstFailure && !Operation.bContinueOnFailure)
+            if (bStopOnFirstFailure && !Operations[Index].bContinueOnFailure)
+            {
+                bStopped = true;
+            }
+            Stack.Append(Dependents[Index]);
+            ReleaseFollowers(Index);
+        }
+    };
+    
+    TArray<int32> MissingDependencies;
+    for (int32 Index = 0; Index < NumOperations; ++Index)
+    {
+        for (const FString& DependencyId : DependencyGraph.FindChecked(Operations[Index].OperationId))
+        {
+            if (const int32* DependencyIndex = IndexById.Find(DependencyId))
             {
-                break;
+                ++PendingDependencies[Index];
+                Dependents[*DependencyIndex].Add(Index);
             }
+            else
+            {
+                MissingDependencies.AddUnique(Index);
+            }
+        }
+        
+        // Operations to wait for that aren't in the batch have nothing to wait for
+        for (const FString& PredecessorId : Operations[Index].RunAfter)
+        {
+            if (const int32* PredecessorIndex = IndexById.Find(PredecessorId))
+            {
+                ++PendingDependencies[Index];
+                Followers[*PredecessorIndex].Add(Index);
+            }
+        }
+    }
+    
+    // Operations are sorted by priority, so collecting ready ones in index order keeps that order
+    for (int32 Index = 0; Index < NumOperations; ++Index)
+    {
+        if (PendingDependencies[Index] == 0)
+        {
+            Ready.Add(Index);
+        }
+    }
+    for (int32 Index : MissingDependencies)
+    {
+        SkipOperation(Index);
+    }
+    Ready.Sort();
+    
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    while (Ready.Num() > 0 && !bStopped)
+    {
+        if (FMCPCancellationToken::IsCurrentRequestCancelled())
+        {
+            UE_LOG(LogMCPBatchOperations, Warning, TEXT("Batch cancelled before wave %d"), WaveStats.Num() + 1);
+            bOverallSuccess = false;
+            break;
+        }
+        
+        const double WaveStartTime = FPlatformTime::Seconds();
+        TArray<int32> Wave = MoveTemp(Ready);
+        Ready.Reset();
+        
+        // Skipped after they became ready, along with a failed dependency
+        Wave.RemoveAll([&bFinished](int32 Index) { return bFinished[Index]; });
+        if (Wave.Num() == 0)
+        {
             continue;
         }
         
-        // Execute the operation
-        FMCPBatchOperationResult Result = ExecuteSingleOperation(Operation);
-        Results.Add(Result);
+        TArray<int32> WorkerOperations;
+        TArray<int32> GameThreadOperations;
+        for (int32 Index : Wave)
+        {
+            // A reference that doesn't match its result fails the operation without running it
+            FString ResolveError;
+            const TSharedPtr<FJsonValue> Resolved = FMCPBatchReferences::Resolve(MakeShared<FJsonValueObject>(Operations[Index].Params), OperationIds, ResultsById, ResolveError);
+            if (!Resolved.IsValid())
+            {
+                Outcomes[Index].ResultData = ResolveError;
+                continue;
+            }
+            ResolvedParams[Index] = Resolved->AsObject();
+            
+            // Commands that wait on the game thread would never finish while it waits on the workers
+            const EMCPThreadAffinity Affinity = Registry.GetCommandThreadAffinity(Operations[Index].OperationType);
+            const bool bNeedsGameThread = Affinity == EMCPThreadAffinity::GameThreadRequired || Affinity == EMCPThreadAffinity::WaitsOnGameThread;
+            (bNeedsGameThread ? GameThreadOperations : WorkerOperations).Add(Index);
+        }
         
-        if (!Result.bSuccess)
+        // Thread-safe commands go out to workers first so they overlap the game-thread commands below.
+        // Each worker takes every NumWorkers-th operation and writes only its own outcome slots
+        const int32 NumWorkers = FMath::Min(MaxParallelOperations, WorkerOperations.Num());
+        TArray<TFuture<void>> WorkerTasks;
+        for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
         {
-            bOverallSuccess = false;
+            WorkerTasks.Add(Async(EAsyncExecution::TaskGraph, [this, &WorkerOperations, &ResolvedParams, &Outcomes, WorkerIndex, NumWorkers]()
+            {
+                // Commands may touch UObjects, so keep garbage collection from overlapping them
+                FGCScopeGuard GCGuard;
+                for (int32 Slot = WorkerIndex; Slot < WorkerOperations.Num(); Slot += NumWorkers)
+                {
+                    const int32 Index = WorkerOperations[Slot];
+                    Outcomes[Index] = RunOperation(Operations[Index], ResolvedParams[Index].ToSharedRef());
+                }
+            }));
+        }
+        
+        for (int32 Index : GameThreadOperations)
+        {
+            Outcomes[Index] = RunOperation(Operations[Index], ResolvedParams[Index].ToSharedRef());
+        }
+        
+        for (TFuture<void>& Task : WorkerTasks)
+        {
+            Task.Wait();
+        }
+        
+        // Record the wave in priority order and release the operations waiting on it
+        for (int32 Index : Wave)
+        {
+            const FMCPBatchOperation& Operation = Operations[Index];
+            bFinished[Index] = true;
+            Results.Add(MakeResult(Operation, Outcomes[Index]));
+            ReleaseFollowers(Index);
+            
+            if (Outcomes[Index].bSuccess)
+            {
+                SucceededOperationIds.Add(Operation.OperationId);
+                ResultsById.Add(Operation.OperationId, Outcomes[Index].ResultObject);
+                for (int32 DependentIndex : Dependents[Index])
+                {
+                    if (--PendingDependencies[DependentIndex] == 0 && !bFinished[DependentIndex])
+                    {
+                        Ready.Add(DependentIndex);
+                    }
+                }
+                continue;
+            }
             
+            bOverallSuccess = false;
             if (bStopOnFirstFailure && !Operation.bContinueOnFailure)
             {
                 UE_LOG(LogMCPBatchOperations, Warning, TEXT("Stopping batch execution due to failure in operation: %s"), 
                        *Operation.OperationId);
-                break;
+                bStopped = true;
+            }
+            for (int32 DependentIndex : Dependents[Index])
+            {
+                SkipOperation(DependentIndex);
             }
         }
+        Ready.Sort();
+        
+        FMCPBatchWaveStats& Stats = WaveStats.AddDefaulted_GetRef();
+        Stats.OperationCount = Wave.Num();
+        Stats.WorkerOperationCount = WorkerOperations.Num();
+        Stats.Duration = FPlatformTime::Seconds() - WaveStartTime;
+        
+        UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Wave %d: %d operations (%d on workers) in %.3f seconds"), 
+               WaveStats.Num(), Stats.OperationCount, Stats.WorkerOperationCount, Stats.Duration);
     }
     
     if (BatchContext)
@@ -190,6 +398,9 @@ bool UMCPBatchOperationHandler::ExecuteBatch()
 
 bool UMCPBatchOperationHandler::ExecuteBatchWithRollback()
 {
+    // Outer scope so the batch's transaction is still open when it fails, and can be undone
+    // before its deferred compiles and saves run
+    FMCPBatchEditScope RollbackScope(FText::FromString(FString::Printf(TEXT("MCP Batch (%d operations)"), Operations.Num())));
     bool bSuccess = ExecuteBatch();
     
     if (!bSuccess)
@@ -261,10 +472,7 @@ FString UMCPBatchOperationHandler::CreateBatchResponse() const
         ResultObject->SetStringField(TEXT("resultData"), Result.ResultData);
         ResultObject->SetNumberField(TEXT("executionTime"), Result.ExecutionTime);
         
-        if (Result.OperationContext)
-        {
-            ResultObject->SetStringField(TEXT("operationContext"), Result.OperationContext->CreateResponse());
-        }
+        ResultObject->SetStringField(TEXT("operationContext"), Result.OperationContext.CreateResponse());
         
         ResultsArray.Add(MakeShareable(new FJsonValueObject(ResultObject)));
     }
@@ -331,6 +539,17 @@ FString UMCPBatchOperationHandler::GetBatchStatistics() const
         StatsObject->SetNumberField(TEXT("maxExecutionTime"), MaxExecutionTime);
     }
     
+    TArray<TSharedPtr<FJsonValue>> WavesArray;
+    for (const FMCPBatchWaveStats& Wave : WaveStats)
+    {
+        TSharedPtr<FJsonObject> WaveObject = MakeShareable(new FJsonObject);
+        WaveObject->SetNumberField(TEXT("operations"), Wave.OperationCount);
+        WaveObject->SetNumberField(TEXT("workerOperations"), Wave.WorkerOperationCount);
+        WaveObject->SetNumberField(TEXT("duration"), Wave.Duration);
+        WavesArray.Add(MakeShareable(new FJsonValueObject(WaveObject)));
+    }
+    StatsObject->SetArrayField(TEXT("waves"), WavesArray);
+    
     if (BatchContext)
     {
         StatsObject->SetNumberField(TEXT("batchDuration"), BatchContext->GetOperationDuration());
@@ -347,6 +566,8 @@ void UMCPBatchOperationHandler::Clear()
 {
     Operations.Empty();
     Results.Empty();
+    WaveStats.Empty();
+    SucceededOperationIds.Empty();
     bBatchExecuted = false;
     
     if (BatchContext)
@@ -367,8 +588,9 @@ void UMCPBatchOperationHandler::SetMaxParallelOperations(int32 MaxParallel)
 
 void UMCPBatchOperationHandler::SortOperationsByPriorityAndDependencies()
 {
-    // Priority-based sorting - topological sorting for dependencies would be a future enhancement
-    Operations.Sort([](const FMCPBatchOperation& A, const FMCPBatchOperation& B) {
+    // Priority order within each wave; ExecuteBatch orders by dependencies. Stable so equal
+    // priorities keep the order they were added in
+    Operations.StableSort([](const FMCPBatchOperation& A, const FMCPBatchOperation& B) {
         return A.Priority > B.Priority;
     });
 }
@@ -377,17 +599,7 @@ bool UMCPBatchOperationHandler::AreDependenciesSatisfied(const FMCPBatchOperatio
 {
     for (const FString& DependencyId : Operation.Dependencies)
     {
-        bool bDependencyFound = false;
-        for (const FMCPBatchOperationResult& Result : Results)
-        {
-            if (Result.Operation.OperationId == DependencyId && Result.bSuccess)
-            {
-                bDependencyFound = true;
-                break;
-            }
-        }
-        
-        if (!bDependencyFound)
+        if (!SucceededOperationIds.Contains(DependencyId))
         {
             return false;
         }
@@ -398,51 +610,121 @@ bool UMCPBatchOperationHandler::AreDependenciesSatisfied(const FMCPBatchOperatio
 
 FMCPBatchOperationResult UMCPBatchOperationHandler::ExecuteSingleOperation(const FMCPBatchOperation& Operation)
 {
-    FMCPBatchOperationResult Result;
-    Result.Operation = Operation;
-    Result.OperationContext = NewObject<UMCPOperationContext>(this);
-    Result.OperationContext->Initialize(Operation.OperationType, Operation.OperationId);
+    return MakeResult(Operation, RunOperation(Operation, GetParamsObject(Operation)));
+}
+
+TSharedRef<FJsonObject> UMCPBatchOperationHandler::GetParamsObject(const FMCPBatchOperation& Operation)
+{
+    if (Operation.Params.IsValid())
+    {
+        return Operation.Params.ToSharedRef();
+    }
     
-    FDateTime StartTime = FDateTime::Now();
+    // Parameters were validated when the operation was added
+    TSharedPtr<FJsonObject> Params;
+    if (!Operation.Parameters.IsEmpty())
+    {
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Operation.Parameters);
+        FJsonSerializer::Deserialize(Reader, Params);
+    }
+    return Params.IsValid() ? Params.ToSharedRef() : MakeShared<FJsonObject>();
+}
+
+UMCPBatchOperationHandler::FOperationOutcome UMCPBatchOperationHandler::RunOperation(const FMCPBatchOperation& Operation, const TSharedRef<FJsonObject>& Params)
+{
+    FOperationOutcome Outcome;
+    const double StartTime = FPlatformTime::Seconds();
     
-    // Operation execution is delegated to the command registry system
-    // This is a placeholder for future batch operation integration
     UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Executing operation: %s [%s]"), 
            *Operation.OperationType, *Operation.OperationId);
     
-    // Simulate operation execution
-    Result.bSuccess = true;
-    Result.ResultData = FString::Printf(TEXT("Operation %s completed successfully"), *Operation.OperationId);
+    FMCPResponseWriter Response;
+    if (!FUnrealMCPCommandRegistry::Get().ExecuteCommand(Operation.OperationType, Params, Response))
+    {
+        Outcome.ResultData = FString::Printf(TEXT("Unknown command: %s"), *Operation.OperationType);
+    }
+    else
+    {
+        // Same convention as the bridge: a result without "success" counts as successful
+        Outcome.ResultObject = Response.GetResultObject();
+        Outcome.bSuccess = Outcome.ResultObject.IsValid();
+        if (Outcome.bSuccess && Outcome.ResultObject->HasField(TEXT("success")))
+        {
+            Outcome.bSuccess = Outcome.ResultObject->GetBoolField(TEXT("success"));
+        }
+        Outcome.ResultData = Response.GetSerializedResult();
+        
+        // The result is embedded as a string, where attachment references can't be found any more
+        FMCPAttachments::InlineReferences(Outcome.ResultData);
+    }
     
-    Result.OperationContext->AddInfo(TEXT("Operation executed"), TEXT("Placeholder execution"));
-    Result.OperationContext->CompleteOperation();
+    Outcome.ExecutionTime = FPlatformTime::Seconds() - StartTime;
+    return Outcome;
+}
+
+FMCPBatchOperationResult UMCPBatchOperationHandler::MakeResult(const FMCPBatchOperation& Operation, const FOperationOutcome& Outcome)
+{
+    FMCPBatchOperationResult Result;
+    Result.Operation = Operation;
+    Result.bSuccess = Outcome.bSuccess;
+    Result.ResultData = Outcome.ResultData;
+    Result.ResultObject = Outcome.ResultObject;
+    Result.ExecutionTime = Outcome.ExecutionTime;
+    Result.OperationContext.Initialize(Operation.OperationType, Operation.OperationId);
     
-    FDateTime EndTime = FDateTime::Now();
-    Result.ExecutionTime = (EndTime - StartTime).GetTotalSeconds();
+    if (Outcome.bSuccess)
+    {
+        Result.OperationContext.AddInfo(TEXT("Operation executed"));
+    }
+    else
+    {
+        Result.OperationContext.AddError(
+            FMCPError(EMCPErrorType::ExecutionFailed, 0, TEXT("Operation failed"), Outcome.ResultData),
+            EMCPErrorSeverity::Error
+        );
+    }
+    Result.OperationContext.CompleteOperation();
     
     return Result;
 }
 
-void UMCPBatchOperationHandler::RollbackOperations()
+FMCPBatchOperationResult UMCPBatchOperationHandler::MakeDependencyFailedResult(const FMCPBatchOperation& Operation)
 {
-    UE_LOG(LogMCPBatchOperations, Warning, TEXT("Starting rollback of %d operations"), Results.Num());
+    FMCPBatchOperationResult Result;
+    Result.Operation = Operation;
+    Result.bSuccess = false;
+    Result.bSkipped = true;
+    Result.ResultData = TEXT("Dependencies not satisfied");
+    Result.OperationContext.Initialize(Operation.OperationType, Operation.OperationId);
+    Result.OperationContext.AddError(
+        FMCPError(EMCPErrorType::ExecutionFailed, 0, TEXT("Operation dependencies not satisfied")),
+        EMCPErrorSeverity::Error
+    );
     
-    // Rollback in reverse order
-    for (int32 i = Results.Num() - 1; i >= 0; --i)
+    return Result;
+}
+
+void UMCPBatchOperationHandler::RollbackOperations()
+{
+    int32 SucceededCount = 0;
+    for (const FMCPBatchOperationResult& Result : Results)
     {
-        const FMCPBatchOperationResult& Result = Results[i];
         if (Result.bSuccess)
         {
-            // Rollback logic would be operation-specific and is a future enhancement
-            UE_LOG(LogMCPBatchOperations, Verbose, TEXT("Rolling back operation: %s"), 
-                   *Result.Operation.OperationId);
+            SucceededCount++;
         }
     }
     
+    UE_LOG(LogMCPBatchOperations, Warning, TEXT("Starting rollback of %d operations"), SucceededCount);
+    
+    // The whole batch is one transaction; undoing it restores every object it modified, whichever
+    // operations modified them, without per-command inverse logic
+    FMCPBatchEditScope::RequestRollback();
+    
     if (BatchContext)
     {
         BatchContext->AddInfo(TEXT("Rollback completed"), 
-                            FString::Printf(TEXT("Rolled back %d operations"), Results.Num()));
+                            FString::Printf(TEXT("Rolled back %d operations"), SucceededCount));
     }
 }
 
@@ -573,7 +855,12 @@ TMap<FString, TArray<FString>> FMCPBatchOperationUtils::CreateDependencyGraph(co
 
 bool FMCPBatchOperationUtils::HasCircularDependencies(const TArray<FMCPBatchOperation>& Operations)
 {
+    // Waiting for an operation to finish can deadlock as well as waiting for it to succeed
     TMap<FString, TArray<FString>> DependencyGraph = CreateDependencyGraph(Operations);
+    for (const FMCPBatchOperation& Operation : Operations)
+    {
+        DependencyGraph.FindChecked(Operation.OperationId).Append(Operation.RunAfter);
+    }
     TSet<FString> Visited;
     TSet<FString> RecursionStack;
     
@@ -0,0 +1,151 @@
+#include "MCPBatchReferences.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+void FMCPBatchReferences::Collect(const TSharedPtr<FJsonValue>& Value, const TSet<FString>& OperationIds, TArray<FString>& OutIds)
+{
+    if (!Value.IsValid())
+    {
+        return;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+    {
+        FString Id;
+        TArray<FString> Path;
+        if (Parse(Value->AsString(), OperationIds, Id, Path))
+        {
+            OutIds.AddUnique(Id);
+        }
+        break;
+    }
+    case EJson::Array:
+        for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+        {
+            Collect(Element, OperationIds, OutIds);
+        }
+        break;
+    case EJson::Object:
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
+        {
+            Collect(Field.Value, OperationIds, OutIds);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+TSharedPtr<FJsonValue> FMCPBatchReferences::Resolve(const TSharedPtr<FJsonValue>& Value, const TSet<FString>& OperationIds, const TMap<FString, TSharedPtr<FJsonObject>>& Results, FString& OutError)
+{
+    if (!Value.IsValid())
+    {
+        return Value;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::String:
+    {
+        const FString& Text = Value->AsString();
+        if (Text.StartsWith(TEXT("$$")))
+        {
+            return MakeShared<FJsonValueString>(Text.RightChop(1));
+        }
+
+        FString Id;
+        TArray<FString> Path;
+        if (!Parse(Text, OperationIds, Id, Path))
+        {
+            return Value;
+        }
+
+        // Operations wait for the ones they reference, so only a failed one has no result
+        const TSharedPtr<FJsonObject>* Result = Results.Find(Id);
+        if (!Result || !Result->IsValid())
+        {
+            OutError = FString::Printf(TEXT("Reference '%s' names an operation without a result"), *Text);
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonValue> Current = MakeShared<FJsonValueObject>(*Result);
+        for (const FString& Segment : Path)
+        {
+            TSharedPtr<FJsonValue> Next;
+            if (Current->Type == EJson::Object)
+            {
+                Next = Current->AsObject()->TryGetField(Segment);
+            }
+            else if (Current->Type == EJson::Array)
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Current->AsArray();
+                int32 ElementIndex = INDEX_NONE;
+                if (Segment.IsNumeric() && LexTryParseString(ElementIndex, *Segment) && Elements.IsValidIndex(ElementIndex))
+                {
+                    Next = Elements[ElementIndex];
+                }
+            }
+            if (!Next.IsValid())
+            {
+                OutError = FString::Printf(TEXT("Reference '%s' does not match the result of its operation"), *Text);
+                return nullptr;
+            }
+            Current = Next;
+        }
+        return Current;
+    }
+    case EJson::Array:
+    {
+        TArray<TSharedPtr<FJsonValue>> Elements;
+        Elements.Reserve(Value->AsArray().Num());
+        for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+        {
+            TSharedPtr<FJsonValue> Resolved = Resolve(Element, OperationIds, Results, OutError);
+            if (!Resolved.IsValid())
+            {
+                return nullptr;
+            }
+            Elements.Add(Resolved);
+        }
+        return MakeShared<FJsonValueArray>(Elements);
+    }
+    case EJson::Object:
+    {
+        TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Value->AsObject()->Values)
+        {
+            TSharedPtr<FJsonValue> Resolved = Resolve(Field.Value, OperationIds, Results, OutError);
+            if (!Resolved.IsValid())
+            {
+                return nullptr;
+            }
+            Object->SetField(Field.Key, Resolved);
+        }
+        return MakeShared<FJsonValueObject>(Object);
+    }
+    default:
+        return Value;
+    }
+}
+
+bool FMCPBatchReferences::Parse(const FString& Text, const TSet<FString>& OperationIds, FString& OutId, TArray<FString>& OutPath)
+{
+    if (!Text.StartsWith(TEXT("$")) || Text.StartsWith(TEXT("$$")))
+    {
+        return false;
+    }
+
+    TArray<FString> Segments;
+    Text.RightChop(1).ParseIntoArray(Segments, TEXT("."), false);
+    if (Segments.Num() == 0 || !OperationIds.Contains(Segments[0]))
+    {
+        return false;
+    }
+
+    OutId = Segments[0];
+    Segments.RemoveAt(0);
+    OutPath = MoveTemp(Segments);
+    return true;
+}
@@ -0,0 +1,202 @@
+#include "MCPCacheBudget.h"
+#include "MCPLogging.h"
+#include "UnrealMCPSettings.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+TAtomic<uint64> FMCPCacheBudget::UseCounter { 0 };
+
+FMCPCacheBudget& FMCPCacheBudget::Get()
+{
+    static FMCPCacheBudget Instance;
+    return Instance;
+}
+
+void FMCPCacheBudget::Initialize()
+{
+    check(IsInGameThread());
+    if (!MemoryTrimHandle.IsValid())
+    {
+        MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddRaw(this, &FMCPCacheBudget::HandleMemoryTrim);
+    }
+}
+
+void FMCPCacheBudget::Shutdown()
+{
+    check(IsInGameThread());
+    FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+    MemoryTrimHandle.Reset();
+}
+
+void FMCPCacheBudget::Register(const FString& Name, IMCPBudgetedCache& Cache)
+{
+    FScopeLock ScopeLock(&Lock);
+    Caches.Add(Name, &Cache);
+}
+
+void FMCPCacheBudget::Unregister(const FString& Name)
+{
+    FScopeLock ScopeLock(&Lock);
+    Caches.Remove(Name);
+}
+
+int64 FMCPCacheBudget::GetBudgetBytes()
+{
+    return FMath::Max(UUnrealMCPSettings::Get()->CacheMemoryBudgetMB, 0) * 1024ll * 1024ll;
+}
+
+int64 FMCPCacheBudget::GetUsedBytes() const
+{
+    FScopeLock ScopeLock(&Lock);
+    int64 UsedBytes = 0;
+    for (const TPair<FString, IMCPBudgetedCache*>& Pair : Caches)
+    {
+        UsedBytes += Pair.Value->GetUsedBytes();
+    }
+    return UsedBytes;
+}
+
+void FMCPCacheBudget::EnforceBudget()
+{
+    check(IsInGameThread());
+
+    // One read per cache; entries are only collected when there is something to evict
+    const int64 UsedBytes = GetUsedBytes();
+    if (UsedBytes <= 0)
+    {
+        return;
+    }
+
+    // Dropping what can be recomputed beats the editor paging or running out, but while memory
+    // stays low the caches refill between commands, so they are emptied at most once per interval
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastLowMemoryCheckTime >= LowMemoryCheckIntervalSeconds)
+    {
+        LastLowMemoryCheckTime = Now;
+        if (FPlatformMemory::GetStats().AvailablePhysical < LowMemoryBytes
+            && Now - LastLowMemoryTrimTime >= LowMemoryTrimIntervalSeconds)
+        {
+            LastLowMemoryTrimTime = Now;
+            UE_LOG(LogUnrealMCP, Log, TEXT("FMCPCacheBudget: Low on physical memory, evicting every cache entry"));
+            TrimAll();
+            return;
+        }
+    }
+
+    const int64 BudgetBytes = GetBudgetBytes();
+    if (BudgetBytes > 0 && UsedBytes > BudgetBytes)
+    {
+        EvictDownTo(BudgetBytes);
+    }
+}
+
+void FMCPCacheBudget::TrimAll()
+{
+    check(IsInGameThread());
+    ++Trims;
+    EvictDownTo(0);
+}
+
+void FMCPCacheBudget::EvictDownTo(int64 TargetBytes)
+{
+    TArray<TPair<FString, IMCPBudgetedCache*>> CachesCopy;
+    {
+        // Caches are called outside the lock, so one may register or unregister another
+        FScopeLock ScopeLock(&Lock);
+        CachesCopy.Reserve(Caches.Num());
+        for (const TPair<FString, IMCPBudgetedCache*>& Pair : Caches)
+        {
+            CachesCopy.Add(Pair);
+        }
+    }
+
+    TArray<FMCPCacheUse> Uses;
+    for (const TPair<FString, IMCPBudgetedCache*>& Pair : CachesCopy)
+    {
+        Pair.Value->GetCacheUses(Uses);
+    }
+
+    int64 UsedBytes = 0;
+    for (const FMCPCacheUse& Use : Uses)
+    {
+        UsedBytes += Use.Bytes;
+    }
+    if (UsedBytes <= TargetBytes || Uses.Num() == 0)
+    {
+        return;
+    }
+
+    // The oldest entries of all caches together, up to the first stamp that leaves them under target
+    uint64 Cutoff = MAX_uint64;
+    int32 EvictedCount = Uses.Num();
+    if (TargetBytes > 0)
+    {
+        Uses.Sort([](const FMCPCacheUse& A, const FMCPCacheUse& B) { return A.LastUse < B.LastUse; });
+        int64 RemainingBytes = UsedBytes;
+        EvictedCount = 0;
+        while (EvictedCount < Uses.Num() && RemainingBytes > TargetBytes)
+        {
+            RemainingBytes -= Uses[EvictedCount++].Bytes;
+        }
+        Cutoff = EvictedCount < Uses.Num() ? Uses[EvictedCount - 1].LastUse + 1 : MAX_uint64;
+    }
+
+    int64 FreedBytes = 0;
+    for (const TPair<FString, IMCPBudgetedCache*>& Pair : CachesCopy)
+    {
+        FreedBytes += Pair.Value->EvictUsedBefore(Cutoff);
+    }
+
+    EvictedEntries += EvictedCount;
+    EvictedBytes += FreedBytes;
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("FMCPCacheBudget: Evicted %d cache entries (%lld bytes), %lld bytes left"),
+        EvictedCount, FreedBytes, UsedBytes - FreedBytes);
+}
+
+TSharedRef<FJsonObject> FMCPCacheBudget::MakeReport() const
+{
+    check(IsInGameThread());
+
+    TArray<FString> Names;
+    TMap<FString, IMCPBudgetedCache*> CachesCopy;
+    {
+        FScopeLock ScopeLock(&Lock);
+        CachesCopy = Caches;
+    }
+    CachesCopy.GetKeys(Names);
+    Names.Sort();
+
+    int64 UsedBytes = 0;
+    TSharedRef<FJsonObject> CachesJson = MakeShared<FJsonObject>();
+    for (const FString& Name : Names)
+    {
+        const int64 CacheBytes = CachesCopy[Name]->GetUsedBytes();
+        UsedBytes += CacheBytes;
+        CachesJson->SetNumberField(Name, static_cast<double>(CacheBytes));
+    }
+
+    TSharedRef<FJsonObject> ReportJson = MakeShared<FJsonObject>();
+    ReportJson->SetNumberField(TEXT("budget_bytes"), static_cast<double>(GetBudgetBytes()));
+    ReportJson->SetNumberField(TEXT("used_bytes"), static_cast<double>(UsedBytes));
+    ReportJson->SetNumberField(TEXT("evicted_entries"), static_cast<double>(EvictedEntries));
+    ReportJson->SetNumberField(TEXT("evicted_bytes"), static_cast<double>(EvictedBytes));
+    ReportJson->SetNumberField(TEXT("trims"), Trims);
+    ReportJson->SetObjectField(TEXT("caches"), CachesJson);
+    return ReportJson;
+}
+
+void FMCPCacheBudget::HandleMemoryTrim()
+{
+    // Platforms may ask from the thread that noticed the pressure
+    if (IsInGameThread())
+    {
+        UE_LOG(LogUnrealMCP, Log, TEXT("FMCPCacheBudget: Memory trim requested, evicting every cache entry"));
+        TrimAll();
+        return;
+    }
+    AsyncTask(ENamedThreads::GameThread, [this]() { HandleMemoryTrim(); });
+}
@@ -0,0 +1,126 @@
+#include "MCPCacheStats.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/ScopeLock.h"
+
+FMCPCacheStatsRegistry& FMCPCacheStatsRegistry::Get()
+{
+    static FMCPCacheStatsRegistry Instance;
+    return Instance;
+}
+
+void FMCPCacheStatsRegistry::Register(const FString& Name, const TCHAR* Kind, FGetStats GetStats, FResetStats ResetStats)
+{
+    FScopeLock ScopeLock(&Lock);
+    Sources.Add(Name, FSource{ Kind, MoveTemp(GetStats), MoveTemp(ResetStats) });
+}
+
+void FMCPCacheStatsRegistry::Register(const FString& Name, const TCHAR* Kind, FMCPCacheCounters& Counters, TFunction<int64()> GetEntries)
+{
+    Register(Name, Kind,
+        [&Counters, GetEntries = MoveTemp(GetEntries)](FStats& OutStats)
+        {
+            OutStats.Hits = Counters.Hits.Load();
+            OutStats.Misses = Counters.Misses.Load();
+            OutStats.Invalidations = Counters.Invalidations.Load();
+            OutStats.Entries = GetEntries ? GetEntries() : -1;
+        },
+        [&Counters]() { Counters.Reset(); });
+}
+
+void FMCPCacheStatsRegistry::Unregister(const FString& Name)
+{
+    FScopeLock ScopeLock(&Lock);
+    Sources.Remove(Name);
+}
+
+TSharedRef<FJsonObject> FMCPCacheStatsRegistry::MakeReport(const FString& NameFilter) const
+{
+    check(IsInGameThread());
+
+    TArray<FString> Names;
+    TMap<FString, FSource> SourcesCopy;
+    {
+        // Sources are called outside the lock, so one may register or unregister another
+        FScopeLock ScopeLock(&Lock);
+        SourcesCopy = Sources;
+    }
+    SourcesCopy.GetKeys(Names);
+    Names.Sort();
+
+    int64 TotalHits = 0;
+    int64 TotalMisses = 0;
+    TArray<TSharedPtr<FJsonValue>> SourcesJson;
+    for (const FString& Name : Names)
+    {
+        if (!NameFilter.IsEmpty() && !Name.Contains(NameFilter))
+        {
+            continue;
+        }
+
+        const FSource& Source = SourcesCopy[Name];
+        FStats Stats;
+        Source.GetStats(Stats);
+        TotalHits += Stats.Hits;
+        TotalMisses += Stats.Misses;
+
+        const int64 Requests = Stats.Hits + Stats.Misses;
+        TSharedPtr<FJsonObject> SourceJson = MakeShared<FJsonObject>();
+        SourceJson->SetStringField(TEXT("name"), Name);
+        SourceJson->SetStringField(TEXT("kind"), Source.Kind);
+        SourceJson->SetNumberField(TEXT("hits"), static_cast<double>(Stats.Hits));
+        SourceJson->SetNumberField(TEXT("misses"), static_cast<double>(Stats.Misses));
+        SourceJson->SetNumberField(TEXT("requests"), static_cast<double>(Requests));
+        SourceJson->SetNumberField(TEXT("hit_ratio"), Requests > 0 ? static_cast<double>(Stats.Hits) / static_cast<double>(Requests) : 0.0);
+        if (Stats.Invalidations >= 0)
+        {
+            SourceJson->SetNumberField(TEXT("invalidations"), static_cast<double>(Stats.Invalidations));
+        }
+        if (Stats.Entries >= 0)
+        {
+            SourceJson->SetNumberField(TEXT("entries"), static_cast<double>(Stats.Entries));
+        }
+        if (Stats.Details.IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Stats.Details->Values)
+            {
+                SourceJson->SetField(Field.Key, Field.Value);
+            }
+        }
+        SourcesJson.Add(MakeShared<FJsonValueObject>(SourceJson));
+    }
+
+    const int64 TotalRequests = TotalHits + TotalMisses;
+    TSharedPtr<FJsonObject> TotalsJson = MakeShared<FJsonObject>();
+    TotalsJson->SetNumberField(TEXT("hits"), static_cast<double>(TotalHits));
+    TotalsJson->SetNumberField(TEXT("misses"), static_cast<double>(TotalMisses));
+    TotalsJson->SetNumberField(TEXT("requests"), static_cast<double>(TotalRequests));
+    TotalsJson->SetNumberField(TEXT("hit_ratio"), TotalRequests > 0 ? static_cast<double>(TotalHits) / static_cast<double>(TotalRequests) : 0.0);
+
+    TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+    Report->SetArrayField(TEXT("sources"), SourcesJson);
+    Report->SetObjectField(TEXT("totals"), TotalsJson);
+    return Report;
+}
+
+int32 FMCPCacheStatsRegistry::ResetStats(const FString& NameFilter)
+{
+    check(IsInGameThread());
+
+    TMap<FString, FSource> SourcesCopy;
+    {
+        FScopeLock ScopeLock(&Lock);
+        SourcesCopy = Sources;
+    }
+
+    int32 ResetCount = 0;
+    for (const TPair<FString, FSource>& Entry : SourcesCopy)
+    {
+        if (NameFilter.IsEmpty() || Entry.Key.Contains(NameFilter))
+        {
+            Entry.Value.ResetStats();
+            ++ResetCount;
+        }
+    }
+    return ResetCount;
+}
@@ -0,0 +1,58 @@
+#include "MCPCancellation.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+
+// Token of the request executing on this thread; commands run one at a time per thread
+static thread_local const FMCPCancellationToken* MCPCurrentCancellationToken = nullptr;
+
+FMCPCancellationToken::FMCPCancellationToken(int64 DeadlineMs)
+    : DeadlineSeconds(DeadlineMs > 0 ? FPlatformTime::Seconds() + DeadlineMs / 1000.0 : 0.0)
+    , bCancelled(false)
+{
+}
+
+void FMCPCancellationToken::Cancel()
+{
+    bCancelled = true;
+}
+
+bool FMCPCancellationToken::IsCancelled() const
+{
+    return bCancelled || (HasDeadline() && FPlatformTime::Seconds() >= DeadlineSeconds);
+}
+
+double FMCPCancellationToken::GetRemainingSeconds() const
+{
+    return HasDeadline() ? DeadlineSeconds - FPlatformTime::Seconds() : MAX_dbl;
+}
+
+FString FMCPCancellationToken::GetReason() const
+{
+    // A deadline that passed wins, so a worker that cancels on expiry still reports the deadline
+    return HasDeadline() && FPlatformTime::Seconds() >= DeadlineSeconds ? TEXT("Request deadline exceeded") : TEXT("Request cancelled");
+}
+
+TSharedRef<FJsonObject> FMCPCancellationToken::MakeErrorResponse() const
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), GetReason());
+    ResponseJson->SetBoolField(TEXT("cancelled"), true);
+    return ResponseJson;
+}
+
+bool FMCPCancellationToken::IsCurrentRequestCancelled()
+{
+    return MCPCurrentCancellationToken && MCPCurrentCancellationToken->IsCancelled();
+}
+
+FMCPCancellationScope::FMCPCancellationScope(const FMCPCancellationTokenPtr& Token)
+    : PreviousToken(MCPCurrentCancellationToken)
+{
+    MCPCurrentCancellationToken = Token.Get();
+}
+
+FMCPCancellationScope::~FMCPCancellationScope()
+{
+    MCPCurrentCancellationToken = PreviousToken;
+}
@@ -0,0 +1,454 @@
+#include "MCPCborCodec.h"
+#include "Dom/JsonValue.h"
+#include "Containers/StringConv.h"
+
+namespace MCPCbor
+{
+    // Major types (high three bits of the initial byte)
+    constexpr uint8 CborUnsigned = 0;
+    constexpr uint8 CborNegative = 1;
+    constexpr uint8 CborTextString = 3;
+    constexpr uint8 CborArray = 4;
+    constexpr uint8 CborMap = 5;
+    constexpr uint8 CborSimple = 7;
+
+    // Simple values and float markers of major type 7
+    constexpr uint8 CborFalse = 20;
+    constexpr uint8 CborTrue = 21;
+    constexpr uint8 CborNull = 22;
+    constexpr uint8 CborHalf = 25;
+    constexpr uint8 CborSingle = 26;
+    constexpr uint8 CborDouble = 27;
+
+    // Largest magnitude up to which every integer is exactly representable as a double
+    constexpr double MaxExactInteger = 9007199254740992.0;
+
+    void WriteHead(TArray<uint8>& Out, uint8 MajorType, uint64 Value)
+    {
+        const uint8 Major = static_cast<uint8>(MajorType << 5);
+        if (Value < 24)
+        {
+            Out.Add(Major | static_cast<uint8>(Value));
+        }
+        else if (Value <= 0xFF)
+        {
+            Out.Add(Major | 24);
+            Out.Add(static_cast<uint8>(Value));
+        }
+        else if (Value <= 0xFFFF)
+        {
+            Out.Add(Major | 25);
+            Out.Add(static_cast<uint8>(Value >> 8));
+            Out.Add(static_cast<uint8>(Value));
+        }
+        else if (Value <= 0xFFFFFFFFull)
+        {
+            Out.Add(Major | 26);
+            for (int32 Shift = 24; Shift >= 0; Shift -= 8)
+            {
+                Out.Add(static_cast<uint8>(Value >> Shift));
+            }
+        }
+        else
+        {
+            Out.Add(Major | 27);
+            for (int32 Shift = 56; Shift >= 0; Shift -= 8)
+            {
+                Out.Add(static_cast<uint8>(Value >> Shift));
+            }
+        }
+    }
+
+    void WriteString(TArray<uint8>& Out, const FString& Value)
+    {
+        FTCHARToUTF8 Converted(*Value, Value.Len());
+        WriteHead(Out, CborTextString, static_cast<uint64>(Converted.Length()));
+        Out.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+    }
+
+    void WriteNumber(TArray<uint8>& Out, double Value)
+    {
+        // Integral values go out as integers, which is what makes CBOR compact for ids, counts and indices
+        if (FMath::IsFinite(Value) && FMath::Abs(Value) <= MaxExactInteger && FMath::FloorToDouble(Value) == Value)
+        {
+            if (Value >= 0.0)
+            {
+                WriteHead(Out, CborUnsigned, static_cast<uint64>(Value));
+            }
+            else
+            {
+                WriteHead(Out, CborNegative, static_cast<uint64>(-1.0 - Value));
+            }
+            return;
+        }
+
+        uint64 Bits = 0;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        Out.Add(static_cast<uint8>((CborSimple << 5) | CborDouble));
+        for (int32 Shift = 56; Shift >= 0; Shift -= 8)
+        {
+            Out.Add(static_cast<uint8>(Bits >> Shift));
+        }
+    }
+
+    void WriteValue(TArray<uint8>& Out, const TSharedPtr<FJsonValue>& Value);
+
+    void WriteObject(TArray<uint8>& Out, const TSharedPtr<FJsonObject>& Object)
+    {
+        if (!Object.IsValid())
+        {
+            Out.Add(static_cast<uint8>((CborSimple << 5) | CborNull));
+            return;
+        }
+
+        WriteHead(Out, CborMap, static_cast<uint64>(Object->Values.Num()));
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values)
+        {
+            WriteString(Out, Pair.Key);
+            WriteValue(Out, Pair.Value);
+        }
+    }
+
+    void WriteValue(TArray<uint8>& Out, const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid())
+        {
+            Out.Add(static_cast<uint8>((CborSimple << 5) | CborNull));
+            return;
+        }
+
+        switch (Value->Type)
+        {
+            case EJson::String:
+                WriteString(Out, Value->AsString());
+                break;
+            case EJson::Number:
+                WriteNumber(Out, Value->AsNumber());
+                break;
+            case EJson::Boolean:
+                Out.Add(static_cast<uint8>((CborSimple << 5) | (Value->AsBool() ? CborTrue : CborFalse)));
+                break;
+            case EJson::Array:
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Items = Value->AsArray();
+                WriteHead(Out, CborArray, static_cast<uint64>(Items.Num()));
+                for (const TSharedPtr<FJsonValue>& Item : Items)
+                {
+                    WriteValue(Out, Item);
+                }
+                break;
+            }
+            case EJson::Object:
+                WriteObject(Out, Value->AsObject());
+                break;
+            default:
+                Out.Add(static_cast<uint8>((CborSimple << 5) | CborNull));
+                break;
+        }
+    }
+
+    /** Recursive-descent reader over a CBOR buffer */
+    class FReader
+    {
+    public:
+        FReader(const uint8* InData, int32 InNum)
+            : Data(InData)
+            , Num(InNum)
+            , Offset(0)
+        {
+        }
+
+        bool IsAtEnd() const { return Offset == Num; }
+
+        const FString& GetError() const { return Error; }
+
+        TSharedPtr<FJsonValue> ReadValue(int32 Depth)
+        {
+            if (Depth > FMCPCborCodec::MaxDepth)
+            {
+                return Fail(TEXT("document nested too deeply"));
+            }
+
+            uint8 MajorType = 0;
+            uint8 Additional = 0;
+            uint64 Argument = 0;
+            if (!ReadHead(MajorType, Additional, Argument))
+            {
+                return nullptr;
+            }
+
+            switch (MajorType)
+            {
+                case CborUnsigned:
+                    return MakeShared<FJsonValueNumber>(static_cast<double>(Argument));
+                case CborNegative:
+                    return MakeShared<FJsonValueNumber>(-1.0 - static_cast<double>(Argument));
+                case CborTextString:
+                {
+                    FString Text;
+                    if (!ReadText(Argument, Text))
+                    {
+                        return nullptr;
+                    }
+                    return MakeShared<FJsonValueString>(Text);
+                }
+                case CborArray:
+                {
+                    if (Argument > static_cast<uint64>(Num - Offset))
+                    {
+                        return Fail(TEXT("array length exceeds document size"));
+                    }
+                    TArray<TSharedPtr<FJsonValue>> Items;
+                    Items.Reserve(static_cast<int32>(Argument));
+                    for (uint64 Index = 0; Index < Argument; ++Index)
+                    {
+                        TSharedPtr<FJsonValue> Item = ReadValue(Depth + 1);
+                        if (!Item.IsValid())
+                        {
+                            return nullptr;
+                        }
+                        Items.Add(Item);
+                    }
+                    return MakeShared<FJsonValueArray>(Items);
+                }
+                case CborMap:
+                {
+                    TSharedPtr<FJsonObject> Object = ReadMapBody(Argument, Depth);
+                    return Object.IsValid() ? MakeShared<FJsonValueObject>(Object) : nullptr;
+                }
+                case CborSimple:
+                    return ReadSimple(Additional, Argument);
+                default:
+                    return Fail(FString::Printf(TEXT("unsupported major type %u"), MajorType));
+            }
+        }
+
+        TSharedPtr<FJsonObject> ReadTopLevelMap()
+        {
+            uint8 MajorType = 0;
+            uint8 Additional = 0;
+            uint64 Argument = 0;
+            if (!ReadHead(MajorType, Additional, Argument))
+            {
+                return nullptr;
+            }
+            if (MajorType != CborMap)
+            {
+                Fail(TEXT("top-level item is not a map"));
+                return nullptr;
+            }
+            return ReadMapBody(Argument, 0);
+        }
+
+    private:
+        TSharedPtr<FJsonValue> Fail(const FString& Message)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = FString::Printf(TEXT("Invalid CBOR at byte %d: %s"), Offset, *Message);
+            }
+            return nullptr;
+        }
+
+        bool ReadHead(uint8& OutMajorType, uint8& OutAdditional, uint64& OutArgument)
+        {
+            if (Offset >= Num)
+            {
+                Fail(TEXT("unexpected end of document"));
+                return false;
+            }
+
+            const uint8 Initial = Data[Offset++];
+            OutMajorType = Initial >> 5;
+            OutAdditional = Initial & 0x1F;
+
+            int32 ArgumentBytes = 0;
+            if (OutAdditional < 24)
+            {
+                OutArgument = OutAdditional;
+                return true;
+            }
+            switch (OutAdditional)
+            {
+                case 24: ArgumentBytes = 1; break;
+                case 25: ArgumentBytes = 2; break;
+                case 26: ArgumentBytes = 4; break;
+                case 27: ArgumentBytes = 8; break;
+                default:
+                    Fail(TEXT("indefinite-length or reserved item"));
+                    return false;
+            }
+
+            if (Num - Offset < ArgumentBytes)
+            {
+                Fail(TEXT("truncated item header"));
+                return false;
+            }
+
+            OutArgument = 0;
+            for (int32 Index = 0; Index < ArgumentBytes; ++Index)
+            {
+                OutArgument = (OutArgument << 8) | Data[Offset++];
+            }
+            return true;
+        }
+
+        bool ReadText(uint64 Length, FString& OutText)
+        {
+            if (Length > static_cast<uint64>(Num - Offset))
+            {
+                Fail(TEXT("string length exceeds document size"));
+                return false;
+            }
+
+            const int32 ByteCount = static_cast<int32>(Length);
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Offset), ByteCount);
+            OutText = FString(Converted.Length(), Converted.Get());
+            Offset += ByteCount;
+            return true;
+        }
+
+        TSharedPtr<FJsonObject> ReadMapBody(uint64 Count, int32 Depth)
+        {
+            // Every entry needs at least two bytes, which bounds bogus counts before reserving anything
+            if (Count > static_cast<uint64>(Num - Offset) / 2)
+            {
+                Fail(TEXT("map size exceeds document size"));
+                return nullptr;
+            }
+
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            for (uint64 Index = 0; Index < Count; ++Index)
+            {
+                uint8 KeyMajor = 0;
+                uint8 KeyAdditional = 0;
+                uint64 KeyLength = 0;
+                if (!ReadHead(KeyMajor, KeyAdditional, KeyLength))
+                {
+                    return nullptr;
+                }
+                if (KeyMajor != CborTextString)
+                {
+                    Fail(TEXT("map key is not a text string"));
+                    return nullptr;
+                }
+
+                FString Key;
+                if (!ReadText(KeyLength, Key))
+                {
+                    return nullptr;
+                }
+
+                TSharedPtr<FJsonValue> Value = ReadValue(Depth + 1);
+                if (!Value.IsValid())
+                {
+                    return nullptr;
+                }
+                Object->SetField(Key, Value);
+            }
+            return Object;
+        }
+
+        TSharedPtr<FJsonValue> ReadSimple(uint8 Additional, uint64 Argument)
+        {
+            switch (Additional)
+            {
+                case CborFalse:
+                    return MakeShared<FJsonValueBoolean>(false);
+                case CborTrue:
+                    return MakeShared<FJsonValueBoolean>(true);
+                case CborNull:
+                    return MakeShared<FJsonValueNull>();
+                case CborHalf:
+                {
+                    // IEEE 754 half precision, as in RFC 8949 appendix D
+                    const int32 Exponent = static_cast<int32>((Argument >> 10) & 0x1F);
+                    const int32 Mantissa = static_cast<int32>(Argument & 0x3FF);
+                    double Value = 0.0;
+                    if (Exponent == 0)
+                    {
+                        Value = FMath::Pow(2.0, -24.0) * Mantissa;
+                    }
+                    else if (Exponent != 31)
+                    {
+                        Value = FMath::Pow(2.0, static_cast<double>(Exponent - 25)) * (Mantissa + 1024);
+                    }
+                    else
+                    {
+                        return Fail(TEXT("non-finite number"));
+                    }
+                    return MakeShared<FJsonValueNumber>((Argument & 0x8000) ? -Value : Value);
+                }
+                case CborSingle:
+                {
+                    const uint32 Bits = static_cast<uint32>(Argument);
+                    float Value = 0.0f;
+                    FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+                    return MakeShared<FJsonValueNumber>(static_cast<double>(Value));
+                }
+                case CborDouble:
+                {
+                    double Value = 0.0;
+                    FMemory::Memcpy(&Value, &Argument, sizeof(Value));
+                    return MakeShared<FJsonValueNumber>(Value);
+                }
+                default:
+                    return Fail(FString::Printf(TEXT("unsupported simple value %u"), Additional));
+            }
+        }
+
+        const uint8* Data;
+        int32 Num;
+        int32 Offset;
+        FString Error;
+    };
+}
+
+void FMCPCborCodec::Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes)
+{
+    OutBytes.Reset();
+    MCPCbor::WriteObject(OutBytes, Object);
+}
+
+TSharedPtr<FJsonObject> FMCPCborCodec::Decode(const uint8* Data, int32 NumBytes, FString& OutError)
+{
+    if (!Data || NumBytes <= 0)
+    {
+        OutError = TEXT("Empty CBOR document");
+        return nullptr;
+    }
+
+    MCPCbor::FReader Reader(Data, NumBytes);
+    TSharedPtr<FJsonObject> Object = Reader.ReadTopLevelMap();
+    if (!Object.IsValid())
+    {
+        OutError = Reader.GetError();
+        return nullptr;
+    }
+    if (!Reader.IsAtEnd())
+    {
+        OutError = TEXT("Trailing bytes after CBOR document");
+        return nullptr;
+    }
+    return Object;
+}
+
+const TCHAR* FMCPCborCodec::GetEncodingName(EMCPPayloadEncoding Encoding)
+{
+    return Encoding == EMCPPayloadEncoding::Cbor ? TEXT("cbor") : TEXT("json");
+}
+
+bool FMCPCborCodec::ParseEncodingName(const FString& Name, EMCPPayloadEncoding& OutEncoding)
+{
+    if (Name.Equals(TEXT("cbor"), ESearchCase::IgnoreCase))
+    {
+        OutEncoding = EMCPPayloadEncoding::Cbor;
+        return true;
+    }
+    if (Name.Equals(TEXT("json"), ESearchCase::IgnoreCase))
+    {
+        OutEncoding = EMCPPayloadEncoding::Json;
+        return true;
+    }
+    return false;
+}
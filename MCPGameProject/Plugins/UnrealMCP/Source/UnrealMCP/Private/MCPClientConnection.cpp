@@ -0,0 +1,923 @@
+#include "MCPClientConnection.h"
+#include "UnrealMCPBridge.h"
+#include "MCPMessageFraming.h"
+#include "MCPResponseStream.h"
+#include "MCPCborCodec.h"
+#include "MCPAttachments.h"
+#include "MCPCancellation.h"
+#include "MCPCommandScheduler.h"
+#include "MCPLevelEvents.h"
+#include "MCPMetrics.h"
+#include "MCPTrace.h"
+#include "MCPMemory.h"
+#include "MCPLogging.h"
+#include "UnrealMCPSettings.h"
+#include "HAL/RunnableThread.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Event.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+
+/**
+ * State shared between a connection worker and its in-flight pipelined requests
+ *
+ * Pipelined responses are sent from background tasks once their command finishes, which
+ * may be after the worker itself has exited (e.g. when the server is stopped), so
+ * everything they touch lives here rather than on the connection.
+ */
+struct FMCPConnectionSharedState
+{
+    FMCPConnectionSharedState(uint32 InConnectionId)
+        : ConnectionId(InConnectionId)
+        , InFlightRequests(0)
+        , bSendFailed(false)
+        , RequestCompletedEvent(FPlatformProcess::GetSynchEventFromPool(false))
+    {
+    }
+
+    ~FMCPConnectionSharedState()
+    {
+        FPlatformProcess::ReturnSynchEventToPool(RequestCompletedEvent);
+    }
+
+    uint32 ConnectionId;
+
+    /** Serializes whole-message sends so responses completing concurrently never interleave */
+    FCriticalSection SendLock;
+
+    /** UTF-8 slice buffer reused by every response on this connection; under SendLock */
+    TArray<uint8> SendScratch;
+
+    /** Pipelined requests dispatched but not yet answered; updated under CompletionLock */
+    int32 InFlightRequests;
+    FCriticalSection CompletionLock;
+
+    /** Cancellation tokens of in-flight pipelined requests by serialized id; under CompletionLock */
+    TMap<FString, FMCPCancellationTokenPtr> PendingRequests;
+
+    /** Set when a send fails; the stream is then in an unknown state and the connection closes */
+    TAtomic<bool> bSendFailed;
+
+    /** Triggered whenever a pipelined request completes */
+    FEvent* RequestCompletedEvent;
+};
+
+namespace
+{
+    /**
+     * Encode and send one response on the transport
+     * @param CommandType - Command the response answers, to record the send in FMCPMetrics; empty for connection-level messages
+     * @return true if all bytes were sent
+     */
+    bool SendResponseOnTransport(FMCPConnectionSharedState& State, IMCPTransport& Client, const FString& Response, const FMCPWireFormat& Wire,
+                                 const FString& CommandType = FString())
+    {
+        MCP_TRACE_SCOPE("MCP::SendResponse");
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Sending response (%d characters)"), State.ConnectionId, Response.Len());
+        
+        // Attached bytes go out after the message when the client reads attachment frames, and in
+        // place of their references as base64 otherwise
+        TArray<FMCPAttachment> Attachments;
+        FString InlinedResponse;
+        const FString* Message = &Response;
+        if (FMCPAttachments::HasReferences(Response))
+        {
+            if (!Wire.bAttachments || !FMCPAttachments::FindReferences(Response, Attachments))
+            {
+                Attachments.Reset();
+                InlinedResponse = Response;
+                FMCPAttachments::InlineReferences(InlinedResponse);
+                Message = &InlinedResponse;
+            }
+        }
+        
+        // Binary clients get the response transcoded off the game thread; commands still produce JSON text
+        TArray<uint8> EncodedPayload;
+        if (Wire.Encoding == EMCPPayloadEncoding::Cbor)
+        {
+            TSharedPtr<FJsonObject> ResponseObject;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(*Message);
+            if (!FJsonSerializer::Deserialize(Reader, ResponseObject) || !ResponseObject.IsValid())
+            {
+                UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Response is not a JSON object, cannot encode as CBOR"), State.ConnectionId);
+                ResponseObject = MakeShared<FJsonObject>();
+                ResponseObject->SetStringField(TEXT("status"), TEXT("error"));
+                ResponseObject->SetStringField(TEXT("error"), TEXT("Failed to encode response"));
+            }
+            FMCPCborCodec::Encode(ResponseObject.ToSharedRef(), EncodedPayload);
+        }
+        
+        // Stream the response in the request's wire format; text is encoded slice by slice, so no
+        // full UTF-8 copy is made, and partial sends on a full socket buffer are resumed
+        double SendStartTime = FPlatformTime::Seconds();
+        FMCPResponseStream Stream(Client, Wire.Framing, Wire.bCompress, &State.SendScratch);
+        bool bSendSuccess = false;
+        {
+            FScopeLock Lock(&State.SendLock);
+            if (Attachments.Num() > 0)
+            {
+                bSendSuccess = Wire.Encoding == EMCPPayloadEncoding::Cbor
+                    ? Stream.SendPayload(EncodedPayload.GetData(), EncodedPayload.Num(), Attachments)
+                    : Stream.SendMessage(*Message, Attachments);
+            }
+            else
+            {
+                bSendSuccess = Wire.Encoding == EMCPPayloadEncoding::Cbor
+                    ? Stream.SendPayload(EncodedPayload.GetData(), EncodedPayload.Num())
+                    : Stream.SendMessage(*Message);
+            }
+        }
+        double SendDuration = FPlatformTime::Seconds() - SendStartTime;
+        
+        if (!CommandType.IsEmpty())
+        {
+            FMCPMetrics::Get().RecordSend(CommandType, SendDuration, Stream.GetBytesSent(), bSendSuccess);
+        }
+        
+        if (!bSendSuccess)
+        {
+            UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Failed to send response. Error: %s, Sent: %lld bytes, Duration: %.3f seconds"), State.ConnectionId,
+                   *Stream.GetLastError(), Stream.GetBytesSent(), SendDuration);
+            State.bSendFailed = true;
+            return false;
+        }
+        
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Response sent successfully - %lld bytes in %.3f seconds"), State.ConnectionId, Stream.GetBytesSent(), SendDuration);
+        return true;
+    }
+
+    /** Serialize a response object to condensed JSON text */
+    FString SerializeResponseObject(const TSharedRef<FJsonObject>& ResponseJson)
+    {
+        FString Response;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Response);
+        FJsonSerializer::Serialize(ResponseJson, Writer);
+        return Response;
+    }
+
+    /**
+     * Serialize a request id ("id" field of the envelope) to its JSON text
+     * @return JSON text of the id, or an empty string for ids that aren't strings or numbers
+     */
+    FString SerializeRequestId(const TSharedPtr<FJsonValue>& IdValue)
+    {
+        if (!IdValue.IsValid() || (IdValue->Type != EJson::String && IdValue->Type != EJson::Number))
+        {
+            return FString();
+        }
+
+        // Serialize through a one-field object so strings are escaped exactly like the response body
+        TSharedRef<FJsonObject> Wrapper = MakeShared<FJsonObject>();
+        Wrapper->SetField(TEXT("id"), IdValue);
+        FString WrapperString;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&WrapperString);
+        FJsonSerializer::Serialize(Wrapper, Writer);
+
+        // {"id":<value>} -> <value>
+        const int32 Prefix = 6;
+        return WrapperString.Len() > Prefix + 1 ? WrapperString.Mid(Prefix, WrapperString.Len() - Prefix - 1) : FString();
+    }
+
+    /**
+     * Insert "id" as the first field of a serialized response object without re-parsing it
+     */
+    FString TagResponseWithId(const FString& Response, const FString& RequestIdJson)
+    {
+        if (RequestIdJson.IsEmpty() || !Response.StartsWith(TEXT("{")))
+        {
+            return Response;
+        }
+
+        // Build the tagged copy in a single allocation; responses can be megabytes
+        const bool bEmptyObject = Response.Len() > 1 && Response[1] == TEXT('}');
+        FString Tagged;
+        Tagged.Reserve(Response.Len() + RequestIdJson.Len() + 7);
+        Tagged += TEXT("{\"id\":");
+        Tagged += RequestIdJson;
+        if (!bEmptyObject)
+        {
+            Tagged.AppendChar(TEXT(','));
+        }
+        Tagged.AppendChars(*Response + 1, Response.Len() - 1);
+        return Tagged;
+    }
+}
+
+FMCPClientConnection::FMCPClientConnection(UUnrealMCPBridge* InBridge, FMCPTransportPtr InTransport, uint32 InConnectionId, FEvent* InFinishedEvent)
+    : Bridge(InBridge)
+    , Transport(InTransport)
+    , ConnectionId(InConnectionId)
+    , FinishedEvent(InFinishedEvent)
+    , SharedState(MakeShared<FMCPConnectionSharedState, ESPMode::ThreadSafe>(InConnectionId))
+    , PayloadEncoding(EMCPPayloadEncoding::Json)
+    , bCompressionEnabled(false)
+    , bAttachmentsEnabled(false)
+    , LevelEventFraming(EMCPFrameFormat::LengthPrefixed)
+    , Thread(nullptr)
+    , bRunning(true)
+    , bFinished(false)
+{
+}
+
+FMCPClientConnection::~FMCPClientConnection()
+{
+    StopAndWait();
+}
+
+bool FMCPClientConnection::Start()
+{
+    Thread = FRunnableThread::Create(this, *FString::Printf(TEXT("UnrealMCPConnection_%u"), ConnectionId), 0, TPri_Normal);
+    if (!Thread)
+    {
+        bFinished = true;
+        return false;
+    }
+    return true;
+}
+
+void FMCPClientConnection::StopAndWait()
+{
+    Stop();
+    if (Thread)
+    {
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+}
+
+uint32 FMCPClientConnection::Run()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Transport);
+    if (Transport.IsValid())
+    {
+        Transport->Configure();
+        UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Serving %s"), ConnectionId, *Transport->GetPeerDescription());
+        HandleClientConnection(Transport);
+        Unsubscribe();
+        WaitForPipelinedRequests();
+        
+        // Whatever is still queued can no longer be answered; don't let it occupy the game thread
+        CancelPipelinedRequests();
+        Transport->Close();
+    }
+    
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Connection handler finished"), ConnectionId);
+    bFinished = true;
+    
+    // Wake the accept thread in case it is waiting for a free worker slot
+    if (FinishedEvent)
+    {
+        FinishedEvent->Trigger();
+    }
+    return 0;
+}
+
+void FMCPClientConnection::Stop()
+{
+    bRunning = false;
+}
+
+void FMCPClientConnection::WaitForPipelinedRequests()
+{
+    // Let responses still in flight reach a client that is waiting for them. When the server is
+    // stopping, don't wait - the shared state keeps late completions safe after the worker exits
+    while (bRunning && !SharedState->bSendFailed)
+    {
+        {
+            FScopeLock Lock(&SharedState->CompletionLock);
+            if (SharedState->InFlightRequests == 0)
+            {
+                return;
+            }
+        }
+        SharedState->RequestCompletedEvent->Wait(FTimespan::FromSeconds(StopCheckIntervalSeconds));
+    }
+}
+
+void FMCPClientConnection::CancelPipelinedRequests()
+{
+    FScopeLock Lock(&SharedState->CompletionLock);
+    for (const TPair<FString, FMCPCancellationTokenPtr>& Pending : SharedState->PendingRequests)
+    {
+        Pending.Value->Cancel();
+    }
+    if (SharedState->PendingRequests.Num() > 0)
+    {
+        UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Cancelled %d unanswered pipelined request(s)"), ConnectionId, SharedState->PendingRequests.Num());
+    }
+}
+
+void FMCPClientConnection::HandleClientConnection(FMCPTransportPtr InClient)
+{
+    if (!InClient.IsValid())
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Invalid client transport passed to HandleClientConnection"), ConnectionId);
+        return;
+    }
+
+    // Size of each socket read - messages larger than this are reassembled by FMCPMessageFramer
+    TArray<uint8> RecvBuffer;
+    RecvBuffer.SetNumUninitialized(UUnrealMCPSettings::Get()->GetSocketBufferSize());
+    FMCPMessageFramer Framer;
+    TArray<uint8> Payload;
+    int32 RequestsServed = 0;
+    double ConnectionStartTime = FPlatformTime::Seconds();
+    double LastActivityTime = ConnectionStartTime;
+    
+    while (bRunning)
+    {
+        if (SharedState->bSendFailed)
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Closing connection after failed send"), ConnectionId);
+            InClient->Close();
+            break;
+        }
+        
+        // The first request gets the classic receive timeout; afterwards the connection is
+        // kept open for further requests until it has been idle for IdleTimeoutSeconds.
+        // A subscribed client is listening for events, so it is never idle
+        const double TimeoutSeconds = RequestsServed == 0 ? FirstRequestTimeoutSeconds : IdleTimeoutSeconds;
+        double IdleTime = FPlatformTime::Seconds() - LastActivityTime;
+        if (!LevelEvents.IsValid() && IdleTime > TimeoutSeconds)
+        {
+            UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Connection idle for %.1f seconds after %d request(s), closing"), ConnectionId, IdleTime, RequestsServed);
+            InClient->Close();
+            break;
+        }
+        
+        SendLevelEvents(InClient);
+        
+        // Block until the client sends data (or hangs up) instead of polling; the wait is sliced so
+        // Stop(), the idle timeout and the event interval are still honoured promptly
+        const double WaitSeconds = LevelEvents.IsValid()
+            ? FMath::Min(LevelEvents->GetMinIntervalSeconds(), StopCheckIntervalSeconds)
+            : FMath::Min(TimeoutSeconds - IdleTime, StopCheckIntervalSeconds);
+        if (!InClient->WaitForRead(FTimespan::FromSeconds(FMath::Max(WaitSeconds, 0.0))))
+        {
+            if (InClient->IsConnectionLost())
+            {
+                UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Client connection dropped after %d request(s)"), ConnectionId, RequestsServed);
+                break;
+            }
+            continue;
+        }
+        
+        int32 BytesRead = 0;
+        EMCPIoResult RecvResult = InClient->Recv(RecvBuffer.GetData(), RecvBuffer.Num(), BytesRead);
+        
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Recv result - Success: %s, BytesRead: %d"), ConnectionId, 
+               RecvResult == EMCPIoResult::Ok ? TEXT("Yes") : TEXT("No"), BytesRead);
+        
+        if (RecvResult == EMCPIoResult::Closed)
+        {
+            double ConnectionDuration = FPlatformTime::Seconds() - ConnectionStartTime;
+            UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Client disconnected after %d request(s) in %.3f seconds"), ConnectionId, 
+                   RequestsServed, ConnectionDuration);
+            break;
+        }
+        
+        // Spurious wake-ups and interrupted reads aren't real errors for non-blocking transports
+        if (RecvResult == EMCPIoResult::WouldBlock)
+        {
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Transient receive error, continuing..."), ConnectionId);
+            continue;
+        }
+        
+        if (RecvResult == EMCPIoResult::Ok)
+        {
+            Framer.Append(RecvBuffer.GetData(), BytesRead);
+            LastActivityTime = FPlatformTime::Seconds();
+            
+            // Serve every complete message now in the buffer; partial data waits for the next read
+            bool bCloseConnection = false;
+            while (!bCloseConnection)
+            {
+                EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+                FString FrameError;
+                EMCPFrameResult FrameResult = Framer.TryExtractMessage(Payload, Format, FrameError);
+                
+                if (FrameResult == EMCPFrameResult::NeedMoreData)
+                {
+                    break;
+                }
+                
+                if (FrameResult == EMCPFrameResult::Error)
+                {
+                    UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Framing error: %s"), ConnectionId, *FrameError);
+                    InClient->Close();
+                    bCloseConnection = true;
+                    break;
+                }
+                
+                const FMCPWireFormat Wire = GetWireFormat(Format);
+                
+                bool bKeepAlive = false;
+                if (!ProcessMessage(InClient, Payload, Wire, bKeepAlive))
+                {
+                    // Close and break on protocol error - don't hang waiting for more data
+                    InClient->Close();
+                    UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Connection closed due to protocol error"), ConnectionId);
+                    bCloseConnection = true;
+                    break;
+                }
+                
+                RequestsServed++;
+                LastActivityTime = FPlatformTime::Seconds();
+                
+                if (!bKeepAlive)
+                {
+                    // Single request-response model - close connection after response
+                    InClient->CloseGracefully();
+                    UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Connection closed after response"), ConnectionId);
+                    bCloseConnection = true;
+                }
+            }
+            
+            if (bCloseConnection)
+            {
+                break;
+            }
+        }
+        else
+        {
+            UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Client disconnected after %d request(s): %s"), ConnectionId, 
+                   RequestsServed, *InClient->GetLastErrorDescription());
+            break;
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FMCPClientConnection::DecodeMessage(const TArray<uint8>& Payload, const FMCPWireFormat& Wire) const
+{
+    MCP_TRACE_SCOPE("MCP::DecodeMessage");
+    LLM_SCOPE_BYTAG(UnrealMCP_Json);
+    TSharedPtr<FJsonObject> JsonObject;
+    double ParseStartTime = FPlatformTime::Seconds();
+    
+    if (Wire.Encoding == EMCPPayloadEncoding::Cbor)
+    {
+        FString DecodeError;
+        JsonObject = FMCPCborCodec::Decode(Payload.GetData(), Payload.Num(), DecodeError);
+        if (!JsonObject.IsValid())
+        {
+            UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Failed to decode %d byte CBOR message: %s"), ConnectionId, Payload.Num(), *DecodeError);
+            return nullptr;
+        }
+        
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Received CBOR message of %d bytes, decoded in %.3f seconds"), ConnectionId,
+               Payload.Num(), FPlatformTime::Seconds() - ParseStartTime);
+        return JsonObject;
+    }
+    
+    // The payload is only converted to TCHAR for logging
+    UE_LOG_MCP_PAYLOAD(Verbose, TEXT("MCPClientConnection %u: Received %s message of %d bytes: %s"), ConnectionId,
+           Wire.Framing == EMCPFrameFormat::LengthPrefixed ? TEXT("framed") : TEXT("raw"), Payload.Num(),
+           *FMCPLogPayload::Truncate(FMCPMessageFramer::PayloadToString(Payload)));
+    
+    // Parse JSON straight from the UTF-8 bytes; only string values are converted, as they are read
+    TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(FMCPMessageFramer::PayloadToView(Payload));
+    bool bParseSuccess = FJsonSerializer::Deserialize(Reader, JsonObject);
+    double ParseDuration = FPlatformTime::Seconds() - ParseStartTime;
+    
+    if (!bParseSuccess || !JsonObject.IsValid())
+    {
+        const FString Message = FMCPMessageFramer::PayloadToString(Payload);
+        UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Failed to parse JSON in %.3f seconds. Raw data: %s"), ConnectionId, ParseDuration, *FMCPLogPayload::Truncate(Message));
+        
+        // Try to identify the issue
+        if (Message.IsEmpty())
+        {
+            UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Received empty string"), ConnectionId);
+        }
+        else if (!Message.StartsWith(TEXT("{")))
+        {
+            UE_LOG(LogUnrealMCP, Error, TEXT("MCPClientConnection %u: Data doesn't start with '{' - not valid JSON"), ConnectionId);
+        }
+        return nullptr;
+    }
+    
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: JSON parsed successfully in %.3f seconds"), ConnectionId, ParseDuration);
+    return JsonObject;
+}
+
+bool FMCPClientConnection::ProcessMessage(FMCPTransportPtr Client, const TArray<uint8>& Payload, const FMCPWireFormat& Wire, bool& bOutKeepAlive)
+{
+    bOutKeepAlive = false;
+    
+    TSharedPtr<FJsonObject> JsonObject = DecodeMessage(Payload, Wire);
+    if (!JsonObject.IsValid())
+    {
+        return false;
+    }
+    
+    // Get command type
+    FString CommandType;
+    if (!JsonObject->TryGetStringField(TEXT("type"), CommandType))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Missing 'type' field in command JSON"), ConnectionId);
+        
+        // Log available fields for debugging
+        TArray<FString> FieldNames;
+        JsonObject->Values.GetKeys(FieldNames);
+        FString FieldList = FString::Join(FieldNames, TEXT(", "));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Available fields: %s"), ConnectionId, *FieldList);
+        return false;
+    }
+    
+    // Clients opt into persistent connections per request
+    JsonObject->TryGetBoolField(TEXT("keep_alive"), bOutKeepAlive);
+    
+    const FString RequestIdJson = SerializeRequestId(JsonObject->TryGetField(TEXT("id")));
+    
+    // Optional time budget from receipt; a request still queued when it runs out is never run
+    int64 DeadlineMs = 0;
+    double DeadlineValue = 0.0;
+    if (JsonObject->TryGetNumberField(TEXT("deadline_ms"), DeadlineValue) && DeadlineValue > 0.0)
+    {
+        DeadlineMs = static_cast<int64>(DeadlineValue);
+    }
+    
+    // Optional scheduling class; without one the bridge picks it from the command
+    TOptional<EMCPCommandPriority> Priority;
+    FString PriorityName;
+    if (JsonObject->TryGetStringField(TEXT("priority"), PriorityName))
+    {
+        EMCPCommandPriority ParsedPriority;
+        if (FMCPCommandScheduler::ParsePriority(PriorityName, ParsedPriority))
+        {
+            Priority = ParsedPriority;
+        }
+        else
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Ignoring unknown priority '%s'"), ConnectionId, *PriorityName);
+        }
+    }
+    
+    // The handshake is answered by the connection itself - it configures the wire, not the editor
+    if (CommandType == TEXT("handshake"))
+    {
+        const TSharedPtr<FJsonObject>* HandshakeParams = nullptr;
+        JsonObject->TryGetObjectField(TEXT("params"), HandshakeParams);
+        HandleHandshake(Client, HandshakeParams ? *HandshakeParams : nullptr, Wire, RequestIdJson);
+        return true;
+    }
+    
+    // Cancellation targets this connection's own pipelined requests, so it is answered here too
+    if (CommandType == TEXT("cancel"))
+    {
+        const TSharedPtr<FJsonObject>* CancelParams = nullptr;
+        JsonObject->TryGetObjectField(TEXT("params"), CancelParams);
+        HandleCancel(Client, CancelParams ? *CancelParams : nullptr, Wire, RequestIdJson);
+        return true;
+    }
+    
+    // Subscriptions push from this connection's worker, so they are answered here as well
+    if (CommandType == TEXT("subscribe") || CommandType == TEXT("unsubscribe"))
+    {
+        const TSharedPtr<FJsonObject>* SubscriptionParams = nullptr;
+        JsonObject->TryGetObjectField(TEXT("params"), SubscriptionParams);
+        HandleSubscription(Client, CommandType == TEXT("subscribe"), SubscriptionParams ? *SubscriptionParams : nullptr, Wire, RequestIdJson, bOutKeepAlive);
+        return true;
+    }
+    
+    FMCPMetrics::Get().RecordRequest(CommandType, Payload.Num());
+    MCP_TRACE_BOOKMARK(TEXT("MCP %s %s"), *CommandType, *RequestIdJson);
+    
+    // Params are optional - commands without parameters receive an empty object
+    TSharedPtr<FJsonObject> Params;
+    const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+    if (JsonObject->TryGetObjectField(TEXT("params"), ParamsObject) && ParamsObject && ParamsObject->IsValid())
+    {
+        Params = *ParamsObject;
+    }
+    else
+    {
+        Params = MakeShared<FJsonObject>();
+    }
+    
+    // Requests tagged with an "id" on a keep-alive connection are pipelined: the command is queued
+    // and the next request read right away, and the response (tagged with the same id) is sent as
+    // soon as the command finishes, possibly ahead of responses to earlier requests
+    if (!RequestIdJson.IsEmpty() && bOutKeepAlive)
+    {
+        DispatchPipelinedRequest(Client, CommandType, Params, Wire, RequestIdJson, DeadlineMs, Priority);
+        return true;
+    }
+    
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Executing command: %s"), ConnectionId, *CommandType);
+    
+    // Execute command with timing
+    double ExecuteStartTime = FPlatformTime::Seconds();
+    FMCPCancellationTokenPtr CancellationToken = MakeShared<FMCPCancellationToken, ESPMode::ThreadSafe>(DeadlineMs);
+    TFuture<FString> Future = Bridge->ExecuteCommandAsync(CommandType, Params, CancellationToken, ConnectionId, Priority);
+    
+    // Wait in slices rather than blocking on the game thread outright, so an expired deadline answers
+    // the client right away and a stopping server (which holds the game thread) isn't deadlocked
+    while (!Future.WaitFor(FTimespan::FromSeconds(FMath::Clamp(CancellationToken->GetRemainingSeconds(), 0.0, StopCheckIntervalSeconds))))
+    {
+        if (!bRunning)
+        {
+            CancellationToken->Cancel();
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Server stopping, abandoning command %s"), ConnectionId, *CommandType);
+            return false;
+        }
+        if (CancellationToken->IsCancelled())
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPClientConnection %u: Command %s exceeded its %lld ms deadline"), ConnectionId, *CommandType, DeadlineMs);
+            break;
+        }
+    }
+    FString Response = Future.IsReady() ? Future.Get() : SerializeResponseObject(CancellationToken->MakeErrorResponse());
+    double ExecuteDuration = FPlatformTime::Seconds() - ExecuteStartTime;
+    
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Command executed in %.3f seconds"), ConnectionId, ExecuteDuration);
+    
+    UE_LOG_MCP_PAYLOAD(Verbose, TEXT("MCPClientConnection %u: Response: %s"), ConnectionId, *FMCPLogPayload::Truncate(Response));
+    
+    // A failed send leaves the stream in an unknown state, so it always closes the connection
+    if (!SendResponseOnTransport(*SharedState, *Client, TagResponseWithId(Response, RequestIdJson), Wire, CommandType))
+    {
+        bOutKeepAlive = false;
+    }
+    return true;
+}
+
+void FMCPClientConnection::HandleHandshake(FMCPTransportPtr Client, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson)
+{
+    // The client lists the encodings it accepts in order of preference; the first one we support wins.
+    // Binary encodings need length-prefixed framing, since raw JSON is delimited by scanning text
+    EMCPPayloadEncoding Selected = EMCPPayloadEncoding::Json;
+    const TArray<TSharedPtr<FJsonValue>>* Requested = nullptr;
+    if (Params.IsValid() && Params->TryGetArrayField(TEXT("encodings"), Requested))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Requested)
+        {
+            EMCPPayloadEncoding Candidate;
+            if (Value.IsValid() && Value->Type == EJson::String && FMCPCborCodec::ParseEncodingName(Value->AsString(), Candidate)
+                && (Candidate == EMCPPayloadEncoding::Json || Wire.Framing == EMCPFrameFormat::LengthPrefixed))
+            {
+                Selected = Candidate;
+                break;
+            }
+        }
+    }
+    
+    // Compressed frames carry a flag in the length header, so they also need length-prefixed framing
+    bool bCompress = false;
+    const TArray<TSharedPtr<FJsonValue>>* RequestedCompression = nullptr;
+    if (Wire.Framing == EMCPFrameFormat::LengthPrefixed && Params.IsValid() && Params->TryGetArrayField(TEXT("compression"), RequestedCompression))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *RequestedCompression)
+        {
+            if (Value.IsValid() && Value->Type == EJson::String && Value->AsString().Equals(TEXT("zlib"), ESearchCase::IgnoreCase))
+            {
+                bCompress = true;
+                break;
+            }
+        }
+    }
+    
+    // Attachment frames are flagged in the length header as well
+    bool bAttachments = false;
+    if (Wire.Framing == EMCPFrameFormat::LengthPrefixed && Params.IsValid())
+    {
+        Params->TryGetBoolField(TEXT("attachments"), bAttachments);
+    }
+    
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("encoding"), FMCPCborCodec::GetEncodingName(Selected));
+    Result->SetStringField(TEXT("compression"), bCompress ? TEXT("zlib") : TEXT("none"));
+    Result->SetBoolField(TEXT("attachments"), bAttachments);
+    Result->SetNumberField(TEXT("compression_threshold"), FMCPMessageFramer::CompressionThreshold);
+    TArray<TSharedPtr<FJsonValue>> Supported;
+    Supported.Add(MakeShared<FJsonValueString>(FMCPCborCodec::GetEncodingName(EMCPPayloadEncoding::Json)));
+    Supported.Add(MakeShared<FJsonValueString>(FMCPCborCodec::GetEncodingName(EMCPPayloadEncoding::Cbor)));
+    Result->SetArrayField(TEXT("encodings"), Supported);
+    
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+    ResponseJson->SetObjectField(TEXT("result"), Result);
+    
+    // The handshake response still uses the old encoding; the new one applies from the next message on
+    SendResponse(Client, TagResponseWithId(SerializeResponseObject(ResponseJson), RequestIdJson), Wire);
+    PayloadEncoding = Selected;
+    bCompressionEnabled = bCompress;
+    bAttachmentsEnabled = bAttachments;
+    
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Handshake selected %s encoding, compression %s, attachments %s"), ConnectionId,
+           FMCPCborCodec::GetEncodingName(Selected), bCompress ? TEXT("zlib") : TEXT("off"), bAttachments ? TEXT("on") : TEXT("off"));
+}
+
+void FMCPClientConnection::HandleCancel(FMCPTransportPtr Client, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson)
+{
+    const FString TargetIdJson = Params.IsValid() ? SerializeRequestId(Params->TryGetField(TEXT("id"))) : FString();
+    
+    // The target's own response (a "cancelled" error, or its result if it already finished) still follows
+    bool bFound = false;
+    if (!TargetIdJson.IsEmpty())
+    {
+        FScopeLock Lock(&SharedState->CompletionLock);
+        if (const FMCPCancellationTokenPtr* Token = SharedState->PendingRequests.Find(TargetIdJson))
+        {
+            (*Token)->Cancel();
+            bFound = true;
+        }
+    }
+    
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Cancel request for id %s: %s"), ConnectionId,
+           TargetIdJson.IsEmpty() ? TEXT("(missing)") : *TargetIdJson, bFound ? TEXT("cancelled") : TEXT("not in flight"));
+    
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    if (TargetIdJson.IsEmpty())
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), TEXT("Missing 'id' of the request to cancel"));
+    }
+    else
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetBoolField(TEXT("found"), bFound);
+        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+        ResponseJson->SetObjectField(TEXT("result"), Result);
+    }
+    SendResponse(Client, TagResponseWithId(SerializeResponseObject(ResponseJson), RequestIdJson), Wire);
+}
+
+void FMCPClientConnection::HandleSubscription(FMCPTransportPtr Client, bool bSubscribe, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson, bool bKeepAlive)
+{
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    auto SendError = [&](const FString& Error)
+    {
+        ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+        ResponseJson->SetStringField(TEXT("error"), Error);
+        SendResponse(Client, TagResponseWithId(SerializeResponseObject(ResponseJson), RequestIdJson), Wire);
+    };
+    
+    FString Topic = TEXT("level_actors");
+    if (Params.IsValid())
+    {
+        Params->TryGetStringField(TEXT("topic"), Topic);
+    }
+    if (Topic != TEXT("level_actors"))
+    {
+        SendError(FString::Printf(TEXT("Unknown topic '%s'; supported: level_actors"), *Topic));
+        return;
+    }
+    
+    if (!bSubscribe)
+    {
+        const bool bWasSubscribed = LevelEvents.IsValid();
+        Unsubscribe();
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("topic"), Topic);
+        Result->SetBoolField(TEXT("was_subscribed"), bWasSubscribed);
+        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+        ResponseJson->SetObjectField(TEXT("result"), Result);
+        SendResponse(Client, TagResponseWithId(SerializeResponseObject(ResponseJson), RequestIdJson), Wire);
+        return;
+    }
+    
+    // Events arrive between responses, so only a connection that stays open can receive them
+    if (!bKeepAlive)
+    {
+        SendError(TEXT("subscribe needs a keep-alive connection (\"keep_alive\": true)"));
+        return;
+    }
+    
+    double IntervalMs = FMCPLevelEvents::DefaultMinIntervalMs;
+    if (Params.IsValid())
+    {
+        Params->TryGetNumberField(TEXT("min_interval_ms"), IntervalMs);
+    }
+    IntervalMs = FMath::Clamp(IntervalMs, FMCPLevelEvents::MinAllowedIntervalMs, FMCPLevelEvents::MaxAllowedIntervalMs);
+    
+    // Subscribing again replaces the interval; changes recorded so far are dropped with the old subscription
+    Unsubscribe();
+    LevelEvents = FMCPLevelEvents::Get().Subscribe(IntervalMs / 1000.0);
+    LevelEventFraming = Wire.Framing;
+    
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("topic"), Topic);
+    Result->SetNumberField(TEXT("min_interval_ms"), IntervalMs);
+    Result->SetNumberField(TEXT("max_pending_changes"), FMCPLevelEventSubscription::MaxPendingChanges);
+    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+    ResponseJson->SetObjectField(TEXT("result"), Result);
+    SendResponse(Client, TagResponseWithId(SerializeResponseObject(ResponseJson), RequestIdJson), Wire);
+    
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPClientConnection %u: Subscribed to %s every %.0f ms"), ConnectionId, *Topic, IntervalMs);
+}
+
+void FMCPClientConnection::SendLevelEvents(const FMCPTransportPtr& Client)
+{
+    if (!LevelEvents.IsValid())
+    {
+        return;
+    }
+    
+    TSharedPtr<FJsonObject> Event = LevelEvents->TakeEvent(FPlatformTime::Seconds());
+    if (Event.IsValid())
+    {
+        SendResponse(Client, SerializeResponseObject(Event.ToSharedRef()), GetWireFormat(LevelEventFraming));
+    }
+}
+
+void FMCPClientConnection::Unsubscribe()
+{
+    if (LevelEvents.IsValid())
+    {
+        FMCPLevelEvents::Get().Unsubscribe(LevelEvents);
+        LevelEvents.Reset();
+    }
+}
+
+FMCPWireFormat FMCPClientConnection::GetWireFormat(EMCPFrameFormat Framing) const
+{
+    // The negotiated encoding only applies to framed messages; raw JSON is always text
+    FMCPWireFormat Wire;
+    Wire.Framing = Framing;
+    Wire.Encoding = Framing == EMCPFrameFormat::LengthPrefixed ? PayloadEncoding : EMCPPayloadEncoding::Json;
+    Wire.bCompress = Framing == EMCPFrameFormat::LengthPrefixed && bCompressionEnabled;
+    Wire.bAttachments = Framing == EMCPFrameFormat::LengthPrefixed && bAttachmentsEnabled;
+    return Wire;
+}
+
+void FMCPClientConnection::DispatchPipelinedRequest(FMCPTransportPtr Client, const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson, int64 DeadlineMs, TOptional<EMCPCommandPriority> Priority)
+{
+    TSharedPtr<FMCPConnectionSharedState, ESPMode::ThreadSafe> State = SharedState;
+    FMCPCancellationTokenPtr CancellationToken = MakeShared<FMCPCancellationToken, ESPMode::ThreadSafe>(DeadlineMs);
+    
+    // Bound how much a single client can queue up; stop reading until a request completes
+    bool bSlotReserved = false;
+    while (bRunning && !bSlotReserved)
+    {
+        {
+            FScopeLock Lock(&State->CompletionLock);
+            if (State->InFlightRequests < MaxPipelinedRequests)
+            {
+                ++State->InFlightRequests;
+                State->PendingRequests.Add(RequestIdJson, CancellationToken);
+                bSlotReserved = true;
+                break;
+            }
+        }
+        State->RequestCompletedEvent->Wait(FTimespan::FromSeconds(StopCheckIntervalSeconds));
+    }
+    if (!bSlotReserved)
+    {
+        return;
+    }
+    
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Queued pipelined command %s (id %s)"), ConnectionId, *CommandType, *RequestIdJson);
+    
+    const double ExecuteStartTime = FPlatformTime::Seconds();
+    auto Complete = [State, Client, CommandType, Wire, RequestIdJson, CancellationToken, ExecuteStartTime](const FString& Response)
+    {
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("MCPClientConnection %u: Pipelined command %s (id %s) completed in %.3f seconds"), State->ConnectionId,
+               *CommandType, *RequestIdJson, FPlatformTime::Seconds() - ExecuteStartTime);
+        
+        if (!State->bSendFailed)
+        {
+            SendResponseOnTransport(*State, *Client, TagResponseWithId(Response, RequestIdJson), Wire, CommandType);
+        }
+        
+        FScopeLock Lock(&State->CompletionLock);
+        --State->InFlightRequests;
+        
+        // A client may reuse an id once its response arrived; only drop our own entry
+        const FMCPCancellationTokenPtr* Pending = State->PendingRequests.Find(RequestIdJson);
+        if (Pending && *Pending == CancellationToken)
+        {
+            State->PendingRequests.Remove(RequestIdJson);
+        }
+        State->RequestCompletedEvent->Trigger();
+    };
+    
+    // Health checks and cached responses are ready at once; send them from here rather than
+    // waiting for a free worker
+    TFuture<FString> Future = Bridge->ExecuteCommandAsync(CommandType, Params, CancellationToken, ConnectionId, Priority);
+    if (Future.IsReady())
+    {
+        Complete(Future.Get());
+        return;
+    }
+    Future.Next([Complete](const FString& Response)
+    {
+        // The continuation runs on the game thread; encode and send on a background thread instead
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Complete, Response]()
+        {
+            Complete(Response);
+        });
+    });
+}
+
+bool FMCPClientConnection::SendResponse(const FMCPTransportPtr& Client, const FString& Response, const FMCPWireFormat& Wire)
+{
+    return SendResponseOnTransport(*SharedState, *Client, Response, Wire);
+}
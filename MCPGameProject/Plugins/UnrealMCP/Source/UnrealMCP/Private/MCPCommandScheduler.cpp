@@ -0,0 +1,150 @@
+#include "MCPCommandScheduler.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<float> CVarMCPFrameBudgetMs(
+    TEXT("mcp.FrameBudgetMs"),
+    8.0f,
+    TEXT("Milliseconds per frame the MCP command scheduler may spend running queued commands on the game thread. At least one command runs each frame."),
+    ECVF_Default);
+
+FMCPCommandScheduler::FMCPCommandScheduler()
+    : QueuedCount(0)
+{
+    for (int32& Index : NextClientIndex)
+    {
+        Index = 0;
+    }
+}
+
+FMCPCommandScheduler::~FMCPCommandScheduler()
+{
+    Stop();
+}
+
+void FMCPCommandScheduler::Start()
+{
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPCommandScheduler::Tick));
+    }
+}
+
+void FMCPCommandScheduler::Stop()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // Callers are waiting on promises the work fulfils; by now their requests are cancelled,
+    // so this mostly answers them with "cancelled" errors
+    TUniqueFunction<void()> Work;
+    while (Dequeue(Work))
+    {
+        Work();
+    }
+}
+
+void FMCPCommandScheduler::Enqueue(uint32 ClientId, EMCPCommandPriority Priority, TUniqueFunction<void()> Work)
+{
+    FScopeLock Lock(&QueueLock);
+
+    TArray<FClientQueue>& ClassQueues = Queues[(int32)Priority];
+    FClientQueue* ClientQueue = ClassQueues.FindByPredicate([ClientId](const FClientQueue& Queue) { return Queue.ClientId == ClientId; });
+    if (!ClientQueue)
+    {
+        // A client that had nothing queued joins at the end of the turn order
+        ClientQueue = &ClassQueues.AddDefaulted_GetRef();
+        ClientQueue->ClientId = ClientId;
+    }
+    ClientQueue->Work.Add(MoveTemp(Work));
+    ++QueuedCount;
+}
+
+int32 FMCPCommandScheduler::GetQueuedCount() const
+{
+    FScopeLock Lock(&QueueLock);
+    return QueuedCount;
+}
+
+double FMCPCommandScheduler::GetSecondsSinceLastTick() const
+{
+    const uint64 TickCycles = LastTickCycles.Load();
+    return TickCycles > 0 ? FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - TickCycles) : -1.0;
+}
+
+bool FMCPCommandScheduler::Dequeue(TUniqueFunction<void()>& OutWork)
+{
+    FScopeLock Lock(&QueueLock);
+
+    for (int32 ClassIndex = 0; ClassIndex < (int32)EMCPCommandPriority::Num; ++ClassIndex)
+    {
+        TArray<FClientQueue>& ClassQueues = Queues[ClassIndex];
+        if (ClassQueues.Num() == 0)
+        {
+            continue;
+        }
+
+        const int32 ClientIndex = NextClientIndex[ClassIndex] % ClassQueues.Num();
+        FClientQueue& ClientQueue = ClassQueues[ClientIndex];
+        OutWork = MoveTemp(ClientQueue.Work[0]);
+        ClientQueue.Work.RemoveAt(0);
+        --QueuedCount;
+
+        if (ClientQueue.Work.Num() == 0)
+        {
+            // The following client moves into this slot and keeps the turn
+            ClassQueues.RemoveAt(ClientIndex);
+            NextClientIndex[ClassIndex] = ClientIndex;
+        }
+        else
+        {
+            NextClientIndex[ClassIndex] = ClientIndex + 1;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool FMCPCommandScheduler::Tick(float DeltaTime)
+{
+    const double BudgetSeconds = FMath::Max(CVarMCPFrameBudgetMs.GetValueOnGameThread(), 0.0f) / 1000.0;
+    const double StartTime = FPlatformTime::Seconds();
+    LastTickCycles = FPlatformTime::Cycles64();
+
+    TUniqueFunction<void()> Work;
+    while (Dequeue(Work))
+    {
+        Work();
+        Work.Reset();
+
+        if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+    }
+    return true;
+}
+
+EMCPCommandPriority FMCPCommandScheduler::GetDefaultPriority(const FString& CommandType)
+{
+    return CommandType.StartsWith(TEXT("batch_")) ? EMCPCommandPriority::Bulk : EMCPCommandPriority::Interactive;
+}
+
+bool FMCPCommandScheduler::ParsePriority(const FString& Value, EMCPCommandPriority& OutPriority)
+{
+    if (Value.Equals(TEXT("interactive"), ESearchCase::IgnoreCase))
+    {
+        OutPriority = EMCPCommandPriority::Interactive;
+        return true;
+    }
+    if (Value.Equals(TEXT("bulk"), ESearchCase::IgnoreCase))
+    {
+        OutPriority = EMCPCommandPriority::Bulk;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,183 @@
+#include "MCPCompileQueue.h"
+#include "Commands/UnrealMCPCommandRegistry.h"
+#include "Commands/MCPResponseWriter.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "MCPBatchEditScope.h"
+#include "MCPLogging.h"
+#include "MCPTrace.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<float> CVarMCPCompileIdleSeconds(
+    TEXT("mcp.CompileIdleSeconds"),
+    2.0f,
+    TEXT("Seconds without a new deferred compile request for an asset before its queued compile runs"),
+    ECVF_Default);
+
+FMCPCompileQueue& FMCPCompileQueue::Get()
+{
+    static FMCPCompileQueue Instance;
+    return Instance;
+}
+
+bool FMCPCompileQueue::TryDefer(const FString& CommandName, const FString& AssetKey, const FString& Parameters, FString& OutResponse)
+{
+    check(IsInGameThread());
+
+    TSharedPtr<FJsonObject> Params;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Parameters);
+    bool bDeferred = false;
+    if (!FJsonSerializer::Deserialize(Reader, Params) || !Params.IsValid()
+        || !Params->TryGetBoolField(TEXT("deferred"), bDeferred) || !bDeferred)
+    {
+        return false;
+    }
+    Params->RemoveField(TEXT("deferred"));
+
+    // Later requests for the same asset share the queued compile, with their own parameters
+    const FString Key = CommandName + TEXT("|") + AssetKey;
+    FPendingCompile* Compile = Pending.Find(Key);
+    if (!Compile)
+    {
+        Compile = &Pending.Add(Key, FPendingCompile{ NextTicket++, CommandName, nullptr, 0.0 });
+    }
+    Compile->Params = Params;
+    Compile->LastRequestTime = FPlatformTime::Seconds();
+
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPCompileQueue::Tick), 0.1f);
+    }
+
+    TSharedRef<FJsonObject> ResponseObj = MakeShared<FJsonObject>();
+    ResponseObj->SetBoolField(TEXT("success"), true);
+    ResponseObj->SetBoolField(TEXT("deferred"), true);
+    ResponseObj->SetNumberField(TEXT("ticket"), Compile->Ticket);
+    ResponseObj->SetNumberField(TEXT("pending_compiles"), Pending.Num());
+
+    OutResponse.Reset();
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutResponse);
+    FJsonSerializer::Serialize(ResponseObj, Writer);
+    return true;
+}
+
+FMCPCompileQueue::ETicketState FMCPCompileQueue::Complete(int64 Ticket)
+{
+    check(IsInGameThread());
+
+    for (const TPair<FString, FPendingCompile>& Entry : Pending)
+    {
+        if (Entry.Value.Ticket == Ticket)
+        {
+            const FString Key = Entry.Key;
+            Run(Key);
+            return ETicketState::Finished;
+        }
+    }
+    return Finished.Contains(Ticket) ? ETicketState::Finished : ETicketState::Unknown;
+}
+
+FMCPCompileQueue::ETicketState FMCPCompileQueue::GetState(int64 Ticket, FString& OutResponse) const
+{
+    if (const FString* Response = Finished.Find(Ticket))
+    {
+        OutResponse = *Response;
+        return ETicketState::Finished;
+    }
+    for (const TPair<FString, FPendingCompile>& Entry : Pending)
+    {
+        if (Entry.Value.Ticket == Ticket)
+        {
+            return ETicketState::Pending;
+        }
+    }
+    return ETicketState::Unknown;
+}
+
+void FMCPCompileQueue::Flush()
+{
+    check(IsInGameThread());
+
+    // Compiles may queue more work; run until nothing is left, in request order
+    while (Pending.Num() > 0)
+    {
+        FString FirstKey;
+        int64 FirstTicket = MAX_int64;
+        for (const TPair<FString, FPendingCompile>& Entry : Pending)
+        {
+            if (Entry.Value.Ticket < FirstTicket)
+            {
+                FirstTicket = Entry.Value.Ticket;
+                FirstKey = Entry.Key;
+            }
+        }
+        Run(FirstKey);
+    }
+}
+
+void FMCPCompileQueue::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+    Pending.Empty();
+    Finished.Empty();
+    FinishedOrder.Empty();
+}
+
+bool FMCPCompileQueue::Tick(float DeltaTime)
+{
+    // A batch scope flushes the queue itself when it closes
+    if (!FMCPBatchEditScope::IsActive())
+    {
+        const double IdleBefore = FPlatformTime::Seconds() - CVarMCPCompileIdleSeconds.GetValueOnGameThread();
+        TArray<FString> IdleKeys;
+        for (const TPair<FString, FPendingCompile>& Entry : Pending)
+        {
+            if (Entry.Value.LastRequestTime <= IdleBefore)
+            {
+                IdleKeys.Add(Entry.Key);
+            }
+        }
+        for (const FString& Key : IdleKeys)
+        {
+            Run(Key);
+        }
+    }
+
+    if (Pending.Num() == 0)
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void FMCPCompileQueue::Run(const FString& Key)
+{
+    MCP_TRACE_SCOPE("MCP::DeferredCompile");
+    FPendingCompile Compile;
+    if (!Pending.RemoveAndCopyValue(Key, Compile))
+    {
+        return;
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Running deferred %s for ticket %lld"), *Compile.CommandName, Compile.Ticket);
+
+    FMCPResponseWriter Response;
+    if (!FUnrealMCPCommandRegistry::Get().ExecuteCommand(Compile.CommandName, Compile.Params.ToSharedRef(), Response))
+    {
+        Response.SetError(FString::Printf(TEXT("Command '%s' is no longer registered"), *Compile.CommandName));
+    }
+
+    Finished.Add(Compile.Ticket, Response.GetSerializedResult());
+    FinishedOrder.Add(Compile.Ticket);
+    if (FinishedOrder.Num() > MaxFinishedTickets)
+    {
+        Finished.Remove(FinishedOrder[0]);
+        FinishedOrder.RemoveAt(0);
+    }
+}
@@ -11,7 +11,7 @@ FMCPError FMCPErrorHandler::CreateInvalidParametersError(const FString& Details)
 {
     return FMCPError(
         EMCPErrorType::InvalidParameters,
-        GetNextErrorCode(EMCPErrorType::InvalidParameters),
+        GetErrorCode(EMCPErrorType::InvalidParameters),
         TEXT("Invalid parameters provided"),
         Details
     );
@@ -21,7 +21,7 @@ FMCPError FMCPErrorHandler::CreateCommandNotFoundError(const FString& CommandNam
 {
     return FMCPError(
         EMCPErrorType::CommandNotFound,
-        GetNextErrorCode(EMCPErrorType::CommandNotFound),
+        GetErrorCode(EMCPErrorType::CommandNotFound),
         FString::Printf(TEXT("Command '%s' not found"), *CommandName),
         FString::Printf(TEXT("The requested command '%s' is not registered in the command registry"), *CommandName)
     );
@@ -31,7 +31,7 @@ FMCPError FMCPErrorHandler::CreateExecutionFailedError(const FString& Details)
 {
     return FMCPError(
         EMCPErrorType::ExecutionFailed,
-        GetNextErrorCode(EMCPErrorType::ExecutionFailed),
+        GetErrorCode(EMCPErrorType::ExecutionFailed),
         TEXT("Command execution failed"),
         Details
     );
@@ -41,7 +41,7 @@ FMCPError FMCPErrorHandler::CreateValidationFailedError(const FString& Details)
 {
     return FMCPError(
         EMCPErrorType::ValidationFailed,
-        GetNextErrorCode(EMCPErrorType::ValidationFailed),
+        GetErrorCode(EMCPErrorType::ValidationFailed),
         TEXT("Parameter validation failed"),
         Details
     );
@@ -51,7 +51,7 @@ FMCPError FMCPErrorHandler::CreateInternalError(const FString& Details)
 {
     return FMCPError(
         EMCPErrorType::InternalError,
-        GetNextErrorCode(EMCPErrorType::InternalError),
+        GetErrorCode(EMCPErrorType::InternalError),
         TEXT("Internal system error"),
         Details
     );
@@ -61,33 +61,29 @@ void FMCPErrorHandler::LogError(const FMCPError& Error, const FLogCategoryBase*
 {
     const FLogCategoryBase* Category = LogCategory ? LogCategory : &LogUnrealMCP;
     
-    FString LogMessage = FString::Printf(
-        TEXT("MCP Error [%d:%d] %s - %s"),
-        static_cast<int32>(Error.ErrorType),
-        Error.ErrorCode,
-        *Error.ErrorMessage,
-        *Error.ErrorDetails
-    );
+    // Formatted by UE_LOG, so nothing is formatted when the verbosity is suppressed
+#define MCP_LOG_ERROR(Verbosity) \
+    UE_LOG(LogUnrealMCP, Verbosity, TEXT("MCP Error [%d:%d] %s - %s"), static_cast<int32>(Error.ErrorType), Error.ErrorCode, *Error.ErrorMessage, *Error.ErrorDetails)
     
     switch (Error.ErrorType)
     {
         case EMCPErrorType::InvalidParameters:
         case EMCPErrorType::ValidationFailed:
-            UE_LOG(LogUnrealMCP, Warning, TEXT("%s"), *LogMessage);
-            break;
         case EMCPErrorType::CommandNotFound:
-            UE_LOG(LogUnrealMCP, Warning, TEXT("%s"), *LogMessage);
+            MCP_LOG_ERROR(Warning);
             break;
         case EMCPErrorType::ExecutionFailed:
         case EMCPErrorType::InternalError:
         case EMCPErrorType::NetworkError:
         case EMCPErrorType::TimeoutError:
-            UE_LOG(LogUnrealMCP, Error, TEXT("%s"), *LogMessage);
+            MCP_LOG_ERROR(Error);
             break;
         default:
-            UE_LOG(LogUnrealMCP, Log, TEXT("%s"), *LogMessage);
+            MCP_LOG_ERROR(Log);
             break;
     }
+    
+#undef MCP_LOG_ERROR
 }
 
 void FMCPErrorHandler::HandleError(const FMCPError& Error, bool bShouldCrash)
@@ -100,14 +96,11 @@ void FMCPErrorHandler::HandleError(const FMCPError& Error, bool bShouldCrash)
     }
 }
 
-int32 FMCPErrorHandler::GetNextErrorCode(EMCPErrorType ErrorType)
+int32 FMCPErrorHandler::GetErrorCode(EMCPErrorType ErrorType)
 {
-    static TMap<EMCPErrorType, int32> ErrorCodeCounters;
-    
-    int32 BaseCode = static_cast<int32>(ErrorType) * 1000;
-    int32& Counter = ErrorCodeCounters.FindOrAdd(ErrorType, 0);
-    
-    return BaseCode + (++Counter);
+    // Fixed per type, so clients can match on the code; a running counter also raced between the
+    // threads batch operations run on
+    return static_cast<int32>(ErrorType) * 1000 + 1;
 }
 
 // Enhanced error handling methods implementation
@@ -174,7 +167,18 @@ FString FMCPErrorHandler::CreateStructuredErrorResponse(const FMCPError& Error,
                                                       const FString& RequestId, 
                                                       const TMap<FString, FString>& AdditionalContext)
 {
-    TSharedPtr<FJsonObject> ResponseObject = MakeShareable(new FJsonObject);
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(CreateStructuredErrorObject(Error, RequestId, AdditionalContext), Writer);
+    
+    return OutputString;
+}
+
+TSharedRef<FJsonObject> FMCPErrorHandler::CreateStructuredErrorObject(const FMCPError& Error, 
+                                                                    const FString& RequestId, 
+                                                                    const TMap<FString, FString>& AdditionalContext)
+{
+    TSharedRef<FJsonObject> ResponseObject = MakeShared<FJsonObject>();
     
     ResponseObject->SetBoolField(TEXT("success"), false);
     ResponseObject->SetStringField(TEXT("requestId"), RequestId);
@@ -201,11 +205,7 @@ FString FMCPErrorHandler::CreateStructuredErrorResponse(const FMCPError& Error,
     
     ResponseObject->SetObjectField(TEXT("error"), ErrorObject);
     
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResponseObject.ToSharedRef(), Writer);
-    
-    return OutputString;
+    return ResponseObject;
 }
 
 FString FMCPErrorHandler::CreateAggregatedErrorResponse(const TArray<FMCPError>& Errors, 
@@ -266,6 +266,15 @@ void FMCPErrorHandler::LogEnhancedError(const FMCPEnhancedError& Error, const FL
 {
     const FLogCategoryBase* Category = LogCategory ? LogCategory : &LogUnrealMCP;
     
+    // The message is assembled in pieces, so check the verbosity before building it
+    const ELogVerbosity::Type Verbosity = Error.Severity == EMCPErrorSeverity::Info ? ELogVerbosity::Log
+        : Error.Severity == EMCPErrorSeverity::Warning ? ELogVerbosity::Warning
+        : ELogVerbosity::Error;
+    if (LogUnrealMCP.IsSuppressed(Verbosity))
+    {
+        return;
+    }
+    
     FString LogMessage = FString::Printf(
         TEXT("Enhanced MCP Error [%d:%d] %s - %s"),
         static_cast<int32>(Error.BaseError.ErrorType),
@@ -0,0 +1,189 @@
+#include "MCPImageEncoding.h"
+#include "Dom/JsonValue.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "ImageUtils.h"
+#include "Modules/ModuleManager.h"
+
+bool FMCPImageEncodeOptions::FromJson(const TSharedPtr<FJsonObject>& Params, FMCPImageEncodeOptions& OutOptions, FString& OutError)
+{
+    if (!Params.IsValid())
+    {
+        return true;
+    }
+
+    FString FormatName;
+    if (Params->TryGetStringField(TEXT("format"), FormatName))
+    {
+        FormatName = FormatName.ToLower();
+        if (FormatName == TEXT("png"))
+        {
+            OutOptions.Format = EMCPImageFormat::PNG;
+        }
+        else if (FormatName == TEXT("jpg") || FormatName == TEXT("jpeg"))
+        {
+            OutOptions.Format = EMCPImageFormat::JPEG;
+        }
+        else
+        {
+            OutError = TEXT("format must be 'png', 'jpg', or 'jpeg'");
+            return false;
+        }
+    }
+
+    double Quality = 0.0;
+    if (Params->TryGetNumberField(TEXT("quality"), Quality))
+    {
+        if (Quality < 1.0 || Quality > 100.0)
+        {
+            OutError = TEXT("quality must be between 1 and 100");
+            return false;
+        }
+        OutOptions.Quality = FMath::RoundToInt32(Quality);
+    }
+
+    double Scale = 0.0;
+    if (Params->TryGetNumberField(TEXT("scale"), Scale))
+    {
+        if (Scale <= 0.0 || Scale > 1.0)
+        {
+            OutError = TEXT("scale must be greater than 0 and at most 1");
+            return false;
+        }
+        OutOptions.Scale = static_cast<float>(Scale);
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* RegionArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("region"), RegionArray))
+    {
+        if (RegionArray->Num() != 4)
+        {
+            OutError = TEXT("region must be [x, y, width, height]");
+            return false;
+        }
+        int32 Values[4];
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            double Value = 0.0;
+            if (!(*RegionArray)[Index].IsValid() || !(*RegionArray)[Index]->TryGetNumber(Value))
+            {
+                OutError = TEXT("region must be [x, y, width, height]");
+                return false;
+            }
+            Values[Index] = FMath::FloorToInt32(Value);
+        }
+        if (Values[0] < 0 || Values[1] < 0 || Values[2] <= 0 || Values[3] <= 0)
+        {
+            OutError = TEXT("region needs a non-negative origin and a positive size");
+            return false;
+        }
+        OutOptions.Region = FIntRect(Values[0], Values[1], Values[0] + Values[2], Values[1] + Values[3]);
+    }
+
+    return true;
+}
+
+const TCHAR* FMCPImageEncodeOptions::GetExtension() const
+{
+    return Format == EMCPImageFormat::JPEG ? TEXT("jpg") : TEXT("png");
+}
+
+bool FMCPImageEncoding::ResolveRegion(const FIntRect& Region, const FIntPoint& ImageSize, FIntRect& OutRegion, FString& OutError)
+{
+    const FIntRect Full(FIntPoint::ZeroValue, ImageSize);
+    if (Region.IsEmpty())
+    {
+        OutRegion = Full;
+        return !Full.IsEmpty();
+    }
+
+    OutRegion = Region;
+    OutRegion.Clip(Full);
+    if (OutRegion.IsEmpty())
+    {
+        OutError = FString::Printf(TEXT("region [%d, %d, %d, %d] lies outside the %dx%d image"),
+            Region.Min.X, Region.Min.Y, Region.Width(), Region.Height(), ImageSize.X, ImageSize.Y);
+        return false;
+    }
+    return true;
+}
+
+FIntPoint FMCPImageEncoding::GetScaledSize(const FIntPoint& SourceSize, float Scale)
+{
+    return FIntPoint(
+        FMath::Max(1, FMath::RoundToInt32(SourceSize.X * Scale)),
+        FMath::Max(1, FMath::RoundToInt32(SourceSize.Y * Scale)));
+}
+
+void FMCPImageEncoding::Crop(TArray<FColor>& Pixels, FIntPoint& Size, const FIntRect& Region)
+{
+    if (Region.Min == FIntPoint::ZeroValue && Region.Size() == Size)
+    {
+        return;
+    }
+
+    const FIntPoint NewSize = Region.Size();
+    TArray<FColor> Cropped;
+    Cropped.SetNumUninitialized(NewSize.X * NewSize.Y);
+    for (int32 Y = 0; Y < NewSize.Y; ++Y)
+    {
+        FMemory::Memcpy(
+            Cropped.GetData() + Y * NewSize.X,
+            Pixels.GetData() + (Region.Min.Y + Y) * Size.X + Region.Min.X,
+            NewSize.X * sizeof(FColor));
+    }
+    Pixels = MoveTemp(Cropped);
+    Size = NewSize;
+}
+
+void FMCPImageEncoding::Resize(TArray<FColor>& Pixels, FIntPoint& Size, const FIntPoint& NewSize)
+{
+    if (NewSize == Size)
+    {
+        return;
+    }
+
+    TArray<FColor> Resized;
+    Resized.SetNumUninitialized(NewSize.X * NewSize.Y);
+    FImageUtils::ImageResize(Size.X, Size.Y, TArrayView64<const FColor>(Pixels.GetData(), Pixels.Num()),
+        NewSize.X, NewSize.Y, TArrayView64<FColor>(Resized.GetData(), Resized.Num()), false, true);
+    Pixels = MoveTemp(Resized);
+    Size = NewSize;
+}
+
+bool FMCPImageEncoding::Encode(TArray<FColor>& Pixels, const FIntPoint& Size, const FMCPImageEncodeOptions& Options, TArray64<uint8>& OutData, FString& OutError)
+{
+    // Workers can not load modules; the capture entry points load it on the game thread
+    IImageWrapperModule* ImageWrapperModule = IsInGameThread()
+        ? &FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"))
+        : FModuleManager::GetModulePtr<IImageWrapperModule>(FName("ImageWrapper"));
+    TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule
+        ? ImageWrapperModule->CreateImageWrapper(Options.Format == EMCPImageFormat::JPEG ? EImageFormat::JPEG : EImageFormat::PNG)
+        : nullptr;
+    if (!ImageWrapper.IsValid())
+    {
+        OutError = TEXT("Failed to create image wrapper");
+        return false;
+    }
+
+    // Render targets leave alpha undefined; force it opaque
+    for (FColor& Pixel : Pixels)
+    {
+        Pixel.A = 255;
+    }
+
+    if (!ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Size.X, Size.Y, ERGBFormat::BGRA, 8))
+    {
+        OutError = TEXT("Failed to set raw image data");
+        return false;
+    }
+
+    // PNG takes the default zlib level: a higher one costs far more time than it saves bytes
+    OutData = ImageWrapper->GetCompressed(Options.Format == EMCPImageFormat::JPEG ? Options.Quality : 0);
+    if (OutData.Num() == 0)
+    {
+        OutError = FString::Printf(TEXT("Failed to compress image to %s"), Options.GetExtension());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,306 @@
+#include "MCPLevelEvents.h"
+#include "MCPLogging.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Editor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    TArray<TSharedPtr<FJsonValue>> MakeVectorArray(double X, double Y, double Z)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(3);
+        Values.Add(MakeShared<FJsonValueNumber>(X));
+        Values.Add(MakeShared<FJsonValueNumber>(Y));
+        Values.Add(MakeShared<FJsonValueNumber>(Z));
+        return Values;
+    }
+
+    /** Same fields as get_level_metadata reports, so a mirror can take entries from either */
+    TSharedPtr<FJsonValue> MakeActorEntry(const FString& ActorName, const FMCPLevelEventSubscription::FActorChange& Change)
+    {
+        const FVector Location = Change.Transform.GetLocation();
+        const FRotator Rotation = Change.Transform.Rotator();
+        const FVector Scale = Change.Transform.GetScale3D();
+
+        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), ActorName);
+        Entry->SetStringField(TEXT("label"), Change.Label);
+        Entry->SetStringField(TEXT("class"), Change.ClassName);
+        Entry->SetArrayField(TEXT("location"), MakeVectorArray(Location.X, Location.Y, Location.Z));
+        Entry->SetArrayField(TEXT("rotation"), MakeVectorArray(Rotation.Pitch, Rotation.Yaw, Rotation.Roll));
+        Entry->SetArrayField(TEXT("scale"), MakeVectorArray(Scale.X, Scale.Y, Scale.Z));
+        return MakeShared<FJsonValueObject>(Entry);
+    }
+}
+
+FMCPLevelEventSubscription::FMCPLevelEventSubscription(double InMinIntervalSeconds)
+    : MinIntervalSeconds(InMinIntervalSeconds)
+{
+}
+
+TSharedPtr<FJsonObject> FMCPLevelEventSubscription::TakeEvent(double Now)
+{
+    // Take the changes under the lock and build the message outside it, so the game thread never waits on JSON
+    TMap<FString, FActorChange> Changes;
+    bool bResync = false;
+    int64 Sequence = 0;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if ((!bResyncPending && PendingChanges.Num() == 0) || Now - LastEventTime < MinIntervalSeconds)
+        {
+            return nullptr;
+        }
+        Changes = MoveTemp(PendingChanges);
+        PendingChanges.Reset();
+        bResync = bResyncPending;
+        bResyncPending = false;
+        Sequence = NextSequence++;
+        LastEventTime = Now;
+    }
+
+    TSharedPtr<FJsonObject> Event = MakeShared<FJsonObject>();
+    Event->SetStringField(TEXT("type"), TEXT("event"));
+    Event->SetStringField(TEXT("topic"), TEXT("level_actors"));
+    Event->SetNumberField(TEXT("seq"), static_cast<double>(Sequence));
+    if (bResync)
+    {
+        Event->SetBoolField(TEXT("resync"), true);
+        return Event;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Added;
+    TArray<TSharedPtr<FJsonValue>> Updated;
+    TArray<TSharedPtr<FJsonValue>> Removed;
+    for (const TPair<FString, FActorChange>& Change : Changes)
+    {
+        switch (Change.Value.Kind)
+        {
+        case EChangeKind::Added:
+            Added.Add(MakeActorEntry(Change.Key, Change.Value));
+            break;
+        case EChangeKind::Updated:
+            Updated.Add(MakeActorEntry(Change.Key, Change.Value));
+            break;
+        case EChangeKind::Removed:
+            Removed.Add(MakeShared<FJsonValueString>(Change.Key));
+            break;
+        }
+    }
+    Event->SetArrayField(TEXT("added"), Added);
+    Event->SetArrayField(TEXT("updated"), Updated);
+    Event->SetArrayField(TEXT("removed"), Removed);
+    return Event;
+}
+
+void FMCPLevelEventSubscription::AddChange(const FString& ActorName, const FActorChange& Change)
+{
+    // Until the client has re-read the level, single changes tell it nothing
+    if (bResyncPending)
+    {
+        return;
+    }
+
+    FActorChange* Existing = PendingChanges.Find(ActorName);
+    if (!Existing)
+    {
+        if (PendingChanges.Num() >= MaxPendingChanges)
+        {
+            RequestResync();
+            return;
+        }
+        PendingChanges.Add(ActorName, Change);
+        return;
+    }
+
+    switch (Change.Kind)
+    {
+    case EChangeKind::Removed:
+        // The client never saw an actor that came and went between two events
+        if (Existing->Kind == EChangeKind::Added)
+        {
+            PendingChanges.Remove(ActorName);
+        }
+        else
+        {
+            Existing->Kind = EChangeKind::Removed;
+        }
+        break;
+    case EChangeKind::Added:
+        // A name reused after a removal; clients treat an add of a known name as a replacement
+        *Existing = Change;
+        break;
+    case EChangeKind::Updated:
+        if (Existing->Kind != EChangeKind::Removed)
+        {
+            const EChangeKind Kind = Existing->Kind;
+            *Existing = Change;
+            Existing->Kind = Kind;
+        }
+        break;
+    }
+}
+
+void FMCPLevelEventSubscription::RequestResync()
+{
+    PendingChanges.Empty();
+    bResyncPending = true;
+}
+
+FMCPLevelEvents& FMCPLevelEvents::Get()
+{
+    static FMCPLevelEvents Instance;
+    return Instance;
+}
+
+void FMCPLevelEvents::Initialize()
+{
+    check(IsInGameThread());
+    if (!GEngine || ActorAddedHandle.IsValid())
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FMCPLevelEvents::HandleActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FMCPLevelEvents::HandleActorDeleted);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FMCPLevelEvents::HandleActorMoved);
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FMCPLevelEvents::HandleActorLabelChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPLevelEvents::HandleUndoRedo);
+    MapChangeHandle = FEditorDelegates::MapChange.AddRaw(this, &FMCPLevelEvents::HandleMapChange);
+}
+
+void FMCPLevelEvents::Shutdown()
+{
+    check(IsInGameThread());
+    if (ActorAddedHandle.IsValid())
+    {
+        if (GEngine)
+        {
+            GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+            GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+            GEngine->OnActorMoved().Remove(ActorMovedHandle);
+        }
+        FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+        FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+        FEditorDelegates::MapChange.Remove(MapChangeHandle);
+
+        ActorAddedHandle.Reset();
+        ActorDeletedHandle.Reset();
+        ActorMovedHandle.Reset();
+        ActorLabelChangedHandle.Reset();
+        UndoRedoHandle.Reset();
+        MapChangeHandle.Reset();
+    }
+
+    FScopeLock ScopeLock(&SubscriptionsLock);
+    Subscriptions.Empty();
+    SubscriptionCount = 0;
+}
+
+FMCPLevelEventSubscriptionPtr FMCPLevelEvents::Subscribe(double MinIntervalSeconds)
+{
+    FMCPLevelEventSubscriptionPtr Subscription = MakeShared<FMCPLevelEventSubscription, ESPMode::ThreadSafe>(MinIntervalSeconds);
+
+    FScopeLock ScopeLock(&SubscriptionsLock);
+    Subscriptions.Add(Subscription);
+    SubscriptionCount = Subscriptions.Num();
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCP level events: %d subscriber(s)"), Subscriptions.Num());
+    return Subscription;
+}
+
+void FMCPLevelEvents::Unsubscribe(const FMCPLevelEventSubscriptionPtr& Subscription)
+{
+    FScopeLock ScopeLock(&SubscriptionsLock);
+    if (Subscriptions.Remove(Subscription) > 0)
+    {
+        SubscriptionCount = Subscriptions.Num();
+        UE_LOG(LogUnrealMCP, Display, TEXT("MCP level events: %d subscriber(s)"), Subscriptions.Num());
+    }
+}
+
+bool FMCPLevelEvents::IsReportedActor(const AActor* Actor)
+{
+    if (!Actor || Actor->HasAnyFlags(RF_Transient | RF_ClassDefaultObject))
+    {
+        return false;
+    }
+    const UWorld* World = Actor->GetWorld();
+    return GEditor && World && World == GEditor->GetEditorWorldContext().World();
+}
+
+void FMCPLevelEvents::RecordChange(AActor* Actor, FMCPLevelEventSubscription::EChangeKind Kind)
+{
+    if (SubscriptionCount == 0 || !IsReportedActor(Actor))
+    {
+        return;
+    }
+
+    // Read the actor once here, on the game thread; the connections serialize it later on their own
+    FMCPLevelEventSubscription::FActorChange Change;
+    Change.Kind = Kind;
+    if (Kind != FMCPLevelEventSubscription::EChangeKind::Removed)
+    {
+        Change.Label = Actor->GetActorLabel();
+        Change.ClassName = Actor->GetClass()->GetName();
+        Change.Transform = Actor->GetActorTransform();
+    }
+    const FString ActorName = Actor->GetName();
+
+    FScopeLock ScopeLock(&SubscriptionsLock);
+    for (const FMCPLevelEventSubscriptionPtr& Subscription : Subscriptions)
+    {
+        FScopeLock SubscriptionLock(&Subscription->Lock);
+        Subscription->AddChange(ActorName, Change);
+    }
+}
+
+void FMCPLevelEvents::RequestResync()
+{
+    if (SubscriptionCount == 0)
+    {
+        return;
+    }
+
+    FScopeLock ScopeLock(&SubscriptionsLock);
+    for (const FMCPLevelEventSubscriptionPtr& Subscription : Subscriptions)
+    {
+        FScopeLock SubscriptionLock(&Subscription->Lock);
+        Subscription->RequestResync();
+    }
+}
+
+void FMCPLevelEvents::HandleActorAdded(AActor* Actor)
+{
+    RecordChange(Actor, FMCPLevelEventSubscription::EChangeKind::Added);
+}
+
+void FMCPLevelEvents::HandleActorDeleted(AActor* Actor)
+{
+    RecordChange(Actor, FMCPLevelEventSubscription::EChangeKind::Removed);
+}
+
+void FMCPLevelEvents::HandleActorMoved(AActor* Actor)
+{
+    RecordChange(Actor, FMCPLevelEventSubscription::EChangeKind::Updated);
+}
+
+void FMCPLevelEvents::HandleActorLabelChanged(AActor* Actor)
+{
+    RecordChange(Actor, FMCPLevelEventSubscription::EChangeKind::Updated);
+}
+
+void FMCPLevelEvents::HandleUndoRedo()
+{
+    // Undo restores and removes actors without add/delete notifications
+    RequestResync();
+}
+
+void FMCPLevelEvents::HandleMapChange(uint32 MapChangeFlags)
+{
+    RequestResync();
+}
@@ -0,0 +1,254 @@
+#include "MCPLocalTransport.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// Not supported on Windows, where every client uses TCP
+#if !PLATFORM_WINDOWS
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+typedef int FMCPRawSocket;
+#define MCP_INVALID_SOCKET (-1)
+#define MCP_WOULD_BLOCK(Error) ((Error) == EAGAIN || (Error) == EWOULDBLOCK || (Error) == EINTR)
+
+static int32 MCPLastSocketError() { return errno; }
+static void MCPCloseSocket(FMCPRawSocket Socket) { close(Socket); }
+static int MCPPoll(pollfd* Fds, int Count, int TimeoutMs) { return poll(Fds, Count, TimeoutMs); }
+static bool MCPSetNonBlocking(FMCPRawSocket Socket) { const int Flags = fcntl(Socket, F_GETFL, 0); return Flags >= 0 && fcntl(Socket, F_SETFL, Flags | O_NONBLOCK) == 0; }
+#define MCP_SHUT_WRITE SHUT_WR
+// A client vanishing mid-send must produce an error, not SIGPIPE
+#if PLATFORM_MAC
+#define MCP_SEND_FLAGS 0
+#else
+#define MCP_SEND_FLAGS MSG_NOSIGNAL
+#endif
+
+static FMCPRawSocket ToRaw(FMCPLocalTransport::FNativeHandle Handle) { return static_cast<FMCPRawSocket>(Handle); }
+static FMCPLocalTransport::FNativeHandle FromRaw(FMCPRawSocket Socket) { return static_cast<FMCPLocalTransport::FNativeHandle>(Socket); }
+
+/** @return poll() result for one socket: >0 ready, 0 timeout, <0 error */
+static int32 MCPPollOne(FMCPRawSocket Socket, short Events, const FTimespan& WaitTime, short& OutRevents)
+{
+    pollfd Fd;
+    Fd.fd = Socket;
+    Fd.events = Events;
+    Fd.revents = 0;
+    const int32 Result = MCPPoll(&Fd, 1, FMath::Max(0, static_cast<int32>(WaitTime.GetTotalMilliseconds())));
+    OutRevents = Fd.revents;
+    return Result;
+}
+
+FMCPLocalTransport::FMCPLocalTransport(FNativeHandle InHandle)
+    : Handle(InHandle)
+    , LastError(0)
+    , bConnectionLost(false)
+{
+}
+
+FMCPLocalTransport::~FMCPLocalTransport()
+{
+    Close();
+}
+
+void FMCPLocalTransport::Configure()
+{
+    const bool bNonBlockingResult = MCPSetNonBlocking(ToRaw(Handle));
+#if PLATFORM_MAC
+    // macOS has no MSG_NOSIGNAL; suppress SIGPIPE on the socket instead
+    int NoSigPipe = 1;
+    setsockopt(ToRaw(Handle), SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+    UE_LOG(LogTemp, Display, TEXT("MCPLocalTransport: Local client connected, non-blocking: %s"), bNonBlockingResult ? TEXT("Success") : TEXT("Failed"));
+}
+
+bool FMCPLocalTransport::WaitForRead(const FTimespan& WaitTime)
+{
+    short Revents = 0;
+    const int32 Result = MCPPollOne(ToRaw(Handle), POLLIN, WaitTime, Revents);
+    if (Result < 0 || (Revents & (POLLERR | POLLNVAL)))
+    {
+        bConnectionLost = true;
+    }
+    // Hang-ups report readable so the following Recv sees the close
+    return Result > 0;
+}
+
+bool FMCPLocalTransport::WaitForWrite(const FTimespan& WaitTime)
+{
+    short Revents = 0;
+    const int32 Result = MCPPollOne(ToRaw(Handle), POLLOUT, WaitTime, Revents);
+    if (Result < 0 || (Revents & (POLLERR | POLLHUP | POLLNVAL)))
+    {
+        bConnectionLost = true;
+    }
+    return Result > 0;
+}
+
+EMCPIoResult FMCPLocalTransport::Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead)
+{
+    OutBytesRead = 0;
+    const auto Result = recv(ToRaw(Handle), reinterpret_cast<char*>(Data), BufferSize, 0);
+    if (Result > 0)
+    {
+        OutBytesRead = static_cast<int32>(Result);
+        return EMCPIoResult::Ok;
+    }
+    return Result == 0 ? EMCPIoResult::Closed : TranslateLastError();
+}
+
+EMCPIoResult FMCPLocalTransport::Send(const uint8* Data, int32 Count, int32& OutBytesSent)
+{
+    OutBytesSent = 0;
+    const auto Result = send(ToRaw(Handle), reinterpret_cast<const char*>(Data), Count, MCP_SEND_FLAGS);
+    if (Result >= 0)
+    {
+        OutBytesSent = static_cast<int32>(Result);
+        return OutBytesSent > 0 ? EMCPIoResult::Ok : EMCPIoResult::WouldBlock;
+    }
+    return TranslateLastError();
+}
+
+EMCPIoResult FMCPLocalTransport::TranslateLastError()
+{
+    const int32 Error = MCPLastSocketError();
+    if (MCP_WOULD_BLOCK(Error))
+    {
+        return EMCPIoResult::WouldBlock;
+    }
+    LastError = Error;
+    bConnectionLost = true;
+    return EMCPIoResult::Error;
+}
+
+bool FMCPLocalTransport::IsConnectionLost()
+{
+    return bConnectionLost;
+}
+
+void FMCPLocalTransport::CloseGracefully()
+{
+    // Local sockets deliver buffered data before the close, so no linger delay is needed
+    if (ToRaw(Handle) != MCP_INVALID_SOCKET)
+    {
+        shutdown(ToRaw(Handle), MCP_SHUT_WRITE);
+    }
+    Close();
+}
+
+void FMCPLocalTransport::Close()
+{
+    if (ToRaw(Handle) != MCP_INVALID_SOCKET)
+    {
+        MCPCloseSocket(ToRaw(Handle));
+        Handle = FromRaw(MCP_INVALID_SOCKET);
+    }
+}
+
+FString FMCPLocalTransport::GetLastErrorDescription() const
+{
+    return LastError == 0 ? FString(TEXT("Graceful disconnection (no error)")) : FString::Printf(TEXT("Local socket error %d"), LastError);
+}
+
+FString FMCPLocalTransport::GetPeerDescription() const
+{
+    return TEXT("local socket");
+}
+
+FMCPLocalListener::FMCPLocalListener(FMCPLocalTransport::FNativeHandle InHandle, const FString& InPath)
+    : Handle(InHandle)
+    , Path(InPath)
+{
+}
+
+FMCPLocalListener::~FMCPLocalListener()
+{
+    if (ToRaw(Handle) != MCP_INVALID_SOCKET)
+    {
+        MCPCloseSocket(ToRaw(Handle));
+    }
+    IFileManager::Get().Delete(*Path, false, true, true);
+}
+
+TSharedPtr<FMCPLocalListener> FMCPLocalListener::Create(const FString& Path, int32 Backlog)
+{
+    sockaddr_un Address;
+    FMemory::Memzero(Address);
+    Address.sun_family = AF_UNIX;
+
+    FTCHARToUTF8 Utf8Path(*Path);
+    if (Utf8Path.Length() >= static_cast<int32>(sizeof(Address.sun_path)))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPLocalListener: Socket path too long (%d bytes): %s"), Utf8Path.Length(), *Path);
+        return nullptr;
+    }
+    FMemory::Memcpy(Address.sun_path, Utf8Path.Get(), Utf8Path.Length());
+
+    const FMCPRawSocket Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (Socket == MCP_INVALID_SOCKET)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPLocalListener: Unix domain sockets are not available (error %d)"), MCPLastSocketError());
+        return nullptr;
+    }
+
+    // A socket file left behind by a previous editor session would make bind fail
+    IFileManager::Get().Delete(*Path, false, true, true);
+
+    if (bind(Socket, reinterpret_cast<const sockaddr*>(&Address), sizeof(Address)) != 0 || listen(Socket, Backlog) != 0 || !MCPSetNonBlocking(Socket))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPLocalListener: Failed to listen on %s (error %d)"), *Path, MCPLastSocketError());
+        MCPCloseSocket(Socket);
+        return nullptr;
+    }
+
+    // Only the user running the editor may connect
+    chmod(Utf8Path.Get(), S_IRUSR | S_IWUSR);
+
+    return MakeShareable(new FMCPLocalListener(FromRaw(Socket), Path));
+}
+
+FString FMCPLocalListener::GetDefaultPath(uint16 Port)
+{
+    const FString Override = FPlatformMisc::GetEnvironmentVariable(TEXT("UNREAL_MCP_SOCKET_PATH"));
+    if (!Override.IsEmpty())
+    {
+        return Override;
+    }
+    return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPlatformProcess::UserTempDir(), FString::Printf(TEXT("unreal-mcp-%d.sock"), Port)));
+}
+
+FMCPTransportPtr FMCPLocalListener::WaitAndAccept(const FTimespan& WaitTime)
+{
+    short Revents = 0;
+    if (MCPPollOne(ToRaw(Handle), POLLIN, WaitTime, Revents) <= 0)
+    {
+        return nullptr;
+    }
+
+    const FMCPRawSocket Client = accept(ToRaw(Handle), nullptr, nullptr);
+    if (Client == MCP_INVALID_SOCKET)
+    {
+        const int32 Error = MCPLastSocketError();
+        if (!MCP_WOULD_BLOCK(Error))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("MCPLocalListener: Failed to accept local client (error %d)"), Error);
+        }
+        return nullptr;
+    }
+    return MakeShared<FMCPLocalTransport, ESPMode::ThreadSafe>(FromRaw(Client));
+}
+
+FString FMCPLocalListener::GetDescription() const
+{
+    return FString::Printf(TEXT("local socket %s"), *Path);
+}
+
+#endif // !PLATFORM_WINDOWS
@@ -1,8 +1,141 @@
 #include "MCPLogging.h"
 #include "MCPParameterValidator.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/StringBuilder.h"
 
 // Define the log category
 DEFINE_LOG_CATEGORY(LogUnrealMCP);
+DEFINE_LOG_CATEGORY(LogMCPPerformance);
+
+static TAutoConsoleVariable<int32> CVarMCPLogPayloadMaxChars(
+    TEXT("mcp.LogPayloadMaxChars"),
+    512,
+    TEXT("Characters of a request or response payload written to the log; the rest is cut."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMCPLogPayloadSampleRate(
+    TEXT("mcp.LogPayloadSampleRate"),
+    1,
+    TEXT("Log one in this many payloads (1 logs every payload, 0 none). Payloads are logged at Verbose on LogUnrealMCP."),
+    ECVF_Default);
+
+FString FMCPLogPayload::Truncate(const FString& Payload)
+{
+    const int32 MaxChars = FMath::Max(CVarMCPLogPayloadMaxChars.GetValueOnAnyThread(), 0);
+    if (Payload.Len() <= MaxChars)
+    {
+        return Payload;
+    }
+    return FString::Printf(TEXT("%s... (%d characters)"), *Payload.Left(MaxChars), Payload.Len());
+}
+
+bool FMCPLogPayload::ShouldSample()
+{
+    static TAtomic<uint32> PayloadCounter(0);
+
+    const int32 SampleRate = CVarMCPLogPayloadSampleRate.GetValueOnAnyThread();
+    if (SampleRate <= 0)
+    {
+        return false;
+    }
+    return (PayloadCounter++ % static_cast<uint32>(SampleRate)) == 0;
+}
+
+void FMCPPerformanceLog::AddMetadata(const TCHAR* Key, const FString& Value)
+{
+    if (Metadata.Num() >= MaxMetadata)
+    {
+        ++DroppedMetadataCount;
+        return;
+    }
+    FMetadataEntry& Entry = Metadata.AddDefaulted_GetRef();
+    Entry.Key = Key;
+    Entry.Text = Value;
+}
+
+void FMCPPerformanceLog::AddMetadata(const TCHAR* Key, double Value)
+{
+    if (Metadata.Num() >= MaxMetadata)
+    {
+        ++DroppedMetadataCount;
+        return;
+    }
+    FMetadataEntry& Entry = Metadata.AddDefaulted_GetRef();
+    Entry.Key = Key;
+    Entry.Number = Value;
+    Entry.bIsNumber = true;
+}
+
+FString FMCPPerformanceLog::ToString() const
+{
+    TStringBuilder<256> Builder;
+    Builder.Appendf(TEXT("Operation: %s [%s] Duration: %.3fs"), *OperationName, *OperationId, GetDurationSeconds());
+    if (Metadata.Num() > 0)
+    {
+        Builder.Append(TEXT(" ("));
+        for (int32 Index = 0; Index < Metadata.Num(); ++Index)
+        {
+            const FMetadataEntry& Entry = Metadata[Index];
+            if (Index > 0)
+            {
+                Builder.Append(TEXT(", "));
+            }
+            Builder.Append(Entry.Key);
+            Builder.AppendChar(TEXT('='));
+            if (Entry.bIsNumber)
+            {
+                Builder.Appendf(TEXT("%g"), Entry.Number);
+            }
+            else
+            {
+                Builder.Append(Entry.Text);
+            }
+        }
+        if (DroppedMetadataCount > 0)
+        {
+            Builder.Appendf(TEXT(", +%d more"), DroppedMetadataCount);
+        }
+        Builder.AppendChar(TEXT(')'));
+    }
+    return Builder.ToString();
+}
+
+FMCPScopedOperationLogger::FMCPScopedOperationLogger(const FString& OperationName, const FString& OperationId)
+    : PerformanceLog(OperationName, OperationId)
+    , bOperationSuccess(true)
+{
+}
+
+FMCPScopedOperationLogger::~FMCPScopedOperationLogger()
+{
+    PerformanceLog.Complete();
+    if (UE_LOG_ACTIVE(LogMCPPerformance, Verbose))
+    {
+        UE_LOG(LogMCPPerformance, Verbose, TEXT("[PERF] %s %s%s%s"), *PerformanceLog.ToString(),
+            bOperationSuccess ? TEXT("succeeded") : TEXT("failed"),
+            ResultSummary.IsEmpty() ? TEXT("") : TEXT(": "), *ResultSummary);
+    }
+}
+
+void FMCPScopedOperationLogger::SetSuccess(bool bSuccess)
+{
+    bOperationSuccess = bSuccess;
+}
+
+void FMCPScopedOperationLogger::SetResultSummary(const FString& Summary)
+{
+    ResultSummary = Summary;
+}
+
+void FMCPScopedOperationLogger::AddMetadata(const TCHAR* Key, const FString& Value)
+{
+    PerformanceLog.AddMetadata(Key, Value);
+}
+
+void FMCPScopedOperationLogger::AddMetadata(const TCHAR* Key, double Value)
+{
+    PerformanceLog.AddMetadata(Key, Value);
+}
 
 // Stub implementations for FMCPLogger
 void FMCPLogger::Initialize(bool bEnableDebugLogging, const FString& LogFilePath)
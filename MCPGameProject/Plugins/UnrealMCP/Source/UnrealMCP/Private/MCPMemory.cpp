@@ -0,0 +1,37 @@
+#include "MCPMemory.h"
+
+LLM_DEFINE_TAG(UnrealMCP);
+LLM_DEFINE_TAG(UnrealMCP_Transport);
+LLM_DEFINE_TAG(UnrealMCP_Json);
+LLM_DEFINE_TAG(UnrealMCP_Caches);
+LLM_DEFINE_TAG(UnrealMCP_ObjectPools);
+LLM_DEFINE_TAG(UnrealMCP_Commands);
+
+bool MCPMemory::GetTagAmounts(TArray<TPair<FString, int64>>& OutAmounts)
+{
+    OutAmounts.Reset();
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    if (!FLowLevelMemTracker::IsEnabled())
+    {
+        return false;
+    }
+
+    // Unique names of the tags above; parents include their children
+    static const TCHAR* const TagNames[] =
+    {
+        TEXT("UnrealMCP"),
+        TEXT("UnrealMCP/Transport"),
+        TEXT("UnrealMCP/Json"),
+        TEXT("UnrealMCP/Caches"),
+        TEXT("UnrealMCP/ObjectPools"),
+        TEXT("UnrealMCP/Commands"),
+    };
+    for (const TCHAR* TagName : TagNames)
+    {
+        OutAmounts.Emplace(TagName, FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, FName(TagName), ELLMTagSet::None));
+    }
+    return true;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,275 @@
+#include "MCPMessageFraming.h"
+#include "Containers/StringConv.h"
+#include "Misc/Compression.h"
+
+// Compact the receive buffer once this many consumed bytes have accumulated at its front
+static constexpr int32 MCPFramerCompactThreshold = 64 * 1024;
+
+FMCPMessageFramer::FMCPMessageFramer()
+    : ReadOffset(0)
+    , ScanOffset(0)
+    , BraceDepth(0)
+    , bInString(false)
+    , bEscaped(false)
+    , bSeenRawJson(false)
+{
+}
+
+void FMCPMessageFramer::Append(const uint8* Data, int32 NumBytes)
+{
+    if (!Data || NumBytes <= 0)
+    {
+        return;
+    }
+
+    // Reclaim consumed space before growing so long-lived keep-alive connections don't creep
+    if (ReadOffset > 0 && (ReadOffset >= MCPFramerCompactThreshold || ReadOffset == Buffer.Num()))
+    {
+        Buffer.RemoveAt(0, ReadOffset, EAllowShrinking::No);
+        ReadOffset = 0;
+    }
+
+    Buffer.Append(Data, NumBytes);
+}
+
+void FMCPMessageFramer::Reset()
+{
+    Buffer.Reset();
+    ReadOffset = 0;
+    ScanOffset = 0;
+    BraceDepth = 0;
+    bInString = false;
+    bEscaped = false;
+    bSeenRawJson = false;
+}
+
+EMCPFrameResult FMCPMessageFramer::TryExtractMessage(TArray<uint8>& OutPayload, EMCPFrameFormat& OutFormat, FString& OutError)
+{
+    OutFormat = EMCPFrameFormat::Unknown;
+
+    // Whitespace may only appear between messages of the raw JSON format; a scan in progress owns it,
+    // and before the first raw message such a byte is the start of a length header
+    if (ScanOffset == 0 && bSeenRawJson)
+    {
+        SkipWhitespace();
+    }
+
+    if (GetBufferedBytes() == 0)
+    {
+        return EMCPFrameResult::NeedMoreData;
+    }
+
+    if (Buffer[ReadOffset] == '{')
+    {
+        OutFormat = EMCPFrameFormat::RawJson;
+        return ExtractRawJson(OutPayload, OutError);
+    }
+
+    OutFormat = EMCPFrameFormat::LengthPrefixed;
+    return ExtractLengthPrefixed(OutPayload, OutError);
+}
+
+void FMCPMessageFramer::SkipWhitespace()
+{
+    while (ReadOffset < Buffer.Num())
+    {
+        const uint8 Byte = Buffer[ReadOffset];
+        if (Byte != ' ' && Byte != '\t' && Byte != '\r' && Byte != '\n')
+        {
+            break;
+        }
+        ++ReadOffset;
+    }
+}
+
+EMCPFrameResult FMCPMessageFramer::ExtractLengthPrefixed(TArray<uint8>& OutPayload, FString& OutError)
+{
+    if (GetBufferedBytes() < HeaderSize)
+    {
+        return EMCPFrameResult::NeedMoreData;
+    }
+
+    const uint8* Header = Buffer.GetData() + ReadOffset;
+    const uint32 RawHeader = (uint32(Header[0]) << 24) | (uint32(Header[1]) << 16) | (uint32(Header[2]) << 8) | uint32(Header[3]);
+    const bool bCompressed = (RawHeader & CompressedFlag) != 0;
+    const uint32 PayloadSize = RawHeader & ~CompressedFlag;
+
+    if (PayloadSize == 0 || PayloadSize > MaxFrameSize)
+    {
+        OutError = FString::Printf(TEXT("Invalid frame length %u (max %u bytes)"), PayloadSize, MaxFrameSize);
+        return EMCPFrameResult::Error;
+    }
+
+    if (GetBufferedBytes() < HeaderSize + static_cast<int32>(PayloadSize))
+    {
+        // Reserve the full frame up front so the buffer grows once instead of per chunk
+        Buffer.Reserve(ReadOffset + HeaderSize + static_cast<int32>(PayloadSize));
+        return EMCPFrameResult::NeedMoreData;
+    }
+
+    ReadOffset += HeaderSize;
+    if (bCompressed)
+    {
+        return DecompressInto(static_cast<int32>(PayloadSize), OutPayload, OutError) ? EMCPFrameResult::Complete : EMCPFrameResult::Error;
+    }
+    ConsumeInto(static_cast<int32>(PayloadSize), OutPayload);
+    return EMCPFrameResult::Complete;
+}
+
+bool FMCPMessageFramer::DecompressInto(int32 NumBytes, TArray<uint8>& OutPayload, FString& OutError)
+{
+    const uint8* Body = Buffer.GetData() + ReadOffset;
+    ReadOffset += NumBytes;
+
+    if (NumBytes <= HeaderSize)
+    {
+        OutError = TEXT("Compressed frame is too short");
+        return false;
+    }
+
+    const uint32 OriginalSize = (uint32(Body[0]) << 24) | (uint32(Body[1]) << 16) | (uint32(Body[2]) << 8) | uint32(Body[3]);
+    if (OriginalSize == 0 || OriginalSize > MaxFrameSize)
+    {
+        OutError = FString::Printf(TEXT("Invalid uncompressed frame length %u (max %u bytes)"), OriginalSize, MaxFrameSize);
+        return false;
+    }
+
+    OutPayload.SetNumUninitialized(static_cast<int32>(OriginalSize), EAllowShrinking::No);
+    if (!FCompression::UncompressMemory(NAME_Zlib, OutPayload.GetData(), static_cast<int32>(OriginalSize), Body + HeaderSize, NumBytes - HeaderSize))
+    {
+        OutError = TEXT("Failed to decompress frame");
+        return false;
+    }
+    return true;
+}
+
+EMCPFrameResult FMCPMessageFramer::ExtractRawJson(TArray<uint8>& OutPayload, FString& OutError)
+{
+    const int32 Available = GetBufferedBytes();
+    const uint8* Data = Buffer.GetData() + ReadOffset;
+
+    // Resume scanning where the previous call stopped so fragmented payloads are scanned once
+    for (; ScanOffset < Available; ++ScanOffset)
+    {
+        const uint8 Byte = Data[ScanOffset];
+
+        if (bInString)
+        {
+            if (bEscaped)
+            {
+                bEscaped = false;
+            }
+            else if (Byte == '\\')
+            {
+                bEscaped = true;
+            }
+            else if (Byte == '"')
+            {
+                bInString = false;
+            }
+            continue;
+        }
+
+        if (Byte == '"')
+        {
+            bInString = true;
+        }
+        else if (Byte == '{' || Byte == '[')
+        {
+            ++BraceDepth;
+        }
+        else if (Byte == '}' || Byte == ']')
+        {
+            if (--BraceDepth == 0)
+            {
+                const int32 MessageSize = ScanOffset + 1;
+                ScanOffset = 0;
+                bSeenRawJson = true;
+                ConsumeInto(MessageSize, OutPayload);
+                return EMCPFrameResult::Complete;
+            }
+        }
+    }
+
+    if (static_cast<uint32>(Available) > MaxFrameSize)
+    {
+        OutError = FString::Printf(TEXT("Unterminated JSON message exceeds %u bytes"), MaxFrameSize);
+        return EMCPFrameResult::Error;
+    }
+
+    return EMCPFrameResult::NeedMoreData;
+}
+
+void FMCPMessageFramer::ConsumeInto(int32 NumBytes, TArray<uint8>& OutPayload)
+{
+    OutPayload.Reset(NumBytes);
+    OutPayload.Append(Buffer.GetData() + ReadOffset, NumBytes);
+    ReadOffset += NumBytes;
+
+    BraceDepth = 0;
+    bInString = false;
+    bEscaped = false;
+}
+
+bool FMCPMessageFramer::CompressPayload(const uint8* Payload, int32 PayloadSize, TArray<uint8>& OutBody)
+{
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, PayloadSize);
+    OutBody.SetNumUninitialized(HeaderSize + CompressedSize, EAllowShrinking::No);
+
+    if (!FCompression::CompressMemory(NAME_Zlib, OutBody.GetData() + HeaderSize, CompressedSize, Payload, PayloadSize))
+    {
+        return false;
+    }
+
+    // Incompressible data (e.g. already-compressed images) is cheaper to send as-is
+    if (HeaderSize + CompressedSize >= PayloadSize)
+    {
+        return false;
+    }
+
+    uint8 SizeBytes[HeaderSize];
+    WriteHeader(static_cast<uint32>(PayloadSize), false, SizeBytes);
+    FMemory::Memcpy(OutBody.GetData(), SizeBytes, HeaderSize);
+    OutBody.SetNum(HeaderSize + CompressedSize, EAllowShrinking::No);
+    return true;
+}
+
+void FMCPMessageFramer::WriteHeader(uint32 PayloadSize, bool bCompressed, uint8 (&OutHeader)[HeaderSize])
+{
+    WriteHeaderWithFlags(PayloadSize, bCompressed ? CompressedFlag : 0u, OutHeader);
+}
+
+void FMCPMessageFramer::WriteHeaderWithFlags(uint32 PayloadSize, uint32 Flags, uint8 (&OutHeader)[HeaderSize])
+{
+    const uint32 Value = PayloadSize | Flags;
+    OutHeader[0] = static_cast<uint8>((Value >> 24) & 0xFF);
+    OutHeader[1] = static_cast<uint8>((Value >> 16) & 0xFF);
+    OutHeader[2] = static_cast<uint8>((Value >> 8) & 0xFF);
+    OutHeader[3] = static_cast<uint8>(Value & 0xFF);
+}
+
+void FMCPMessageFramer::EncodeMessage(const uint8* Payload, int32 PayloadSize, EMCPFrameFormat Format, TArray<uint8>& OutBytes)
+{
+    OutBytes.Reset();
+
+    if (Format == EMCPFrameFormat::LengthPrefixed)
+    {
+        OutBytes.Reserve(HeaderSize + PayloadSize);
+        uint8 Header[HeaderSize];
+        WriteHeader(static_cast<uint32>(PayloadSize), false, Header);
+        OutBytes.Append(Header, HeaderSize);
+    }
+
+    OutBytes.Append(Payload, PayloadSize);
+}
+
+FString FMCPMessageFramer::PayloadToString(const TArray<uint8>& Payload)
+{
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Payload.GetData()), Payload.Num());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+FUtf8StringView FMCPMessageFramer::PayloadToView(const TArray<uint8>& Payload)
+{
+    return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Payload.GetData()), Payload.Num());
+}
@@ -0,0 +1,398 @@
+#include "MCPMetrics.h"
+#include "MCPLogging.h"
+#include "MCPMemory.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HttpServerModule.h"
+#include "HttpServerResponse.h"
+#include "HttpPath.h"
+#include "IHttpRouter.h"
+#include "Misc/ScopeLock.h"
+
+static TAutoConsoleVariable<int32> CVarMCPMetricsPort(
+    TEXT("mcp.MetricsPort"),
+    0,
+    TEXT("Port on which MCP command metrics are served in the Prometheus text format at /metrics. Read at startup; 0 disables the endpoint."),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<bool> CVarMCPMemoryAccounting(
+    TEXT("mcp.MemoryAccounting"),
+    true,
+    TEXT("Sample the process's physical memory use around every MCP command and attribute its growth to the command."),
+    ECVF_Default);
+
+namespace
+{
+    /** Percentiles reported for every stage */
+    const double ReportedPercentiles[] = { 0.5, 0.9, 0.99 };
+
+    /** Escape a Prometheus label value */
+    FString EscapeLabel(const FString& Value)
+    {
+        return Value.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\"")).Replace(TEXT("\n"), TEXT("\\n"));
+    }
+}
+
+// ============================================================================
+// FLatencyHistogram
+// ============================================================================
+
+int32 FMCPMetrics::FLatencyHistogram::GetBucketIndex(uint64 Microseconds)
+{
+    // The first SubBucketCount buckets hold one microsecond each; above that every power of two
+    // is split into SubBucketCount equal buckets
+    if (Microseconds < SubBucketCount)
+    {
+        return static_cast<int32>(Microseconds);
+    }
+    const int32 Magnitude = static_cast<int32>(FMath::FloorLog2_64(Microseconds));
+    if (Magnitude > MaxMagnitudeBits)
+    {
+        return BucketCount - 1;
+    }
+    const int32 Shift = Magnitude - SubBucketBits;
+    const int32 SubBucket = static_cast<int32>((Microseconds >> Shift) & (SubBucketCount - 1));
+    return SubBucketCount * (Shift + 1) + SubBucket;
+}
+
+uint64 FMCPMetrics::FLatencyHistogram::GetBucketUpperBound(int32 BucketIndex)
+{
+    if (BucketIndex < SubBucketCount)
+    {
+        return static_cast<uint64>(BucketIndex);
+    }
+    const int32 Shift = BucketIndex / SubBucketCount - 1;
+    const uint64 Mantissa = SubBucketCount + BucketIndex % SubBucketCount;
+    return ((Mantissa + 1) << Shift) - 1;
+}
+
+void FMCPMetrics::FLatencyHistogram::Record(double Seconds)
+{
+    Seconds = FMath::Max(Seconds, 0.0);
+    if (Buckets.Num() == 0)
+    {
+        Buckets.SetNumZeroed(BucketCount);
+    }
+    ++Buckets[GetBucketIndex(static_cast<uint64>(Seconds * 1.0e6))];
+    ++Count;
+    SumSeconds += Seconds;
+    MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FMCPMetrics::FLatencyHistogram::GetPercentileSeconds(double Fraction) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Fraction, 0.0, 1.0) * Count)));
+    uint64 Seen = 0;
+    for (int32 Index = 0; Index < Buckets.Num(); ++Index)
+    {
+        Seen += Buckets[Index];
+        if (Seen >= Rank)
+        {
+            // A bucket's bound can exceed the largest duration actually seen
+            return FMath::Min(GetBucketUpperBound(Index) * 1.0e-6, MaxSeconds);
+        }
+    }
+    return MaxSeconds;
+}
+
+// ============================================================================
+// FMCPMetrics
+// ============================================================================
+
+FMCPMetrics& FMCPMetrics::Get()
+{
+    static FMCPMetrics Instance;
+    return Instance;
+}
+
+FMCPMetrics::FMCPMetrics()
+    : StartTime(FPlatformTime::Seconds())
+{
+}
+
+void FMCPMetrics::Initialize()
+{
+    check(IsInGameThread());
+
+    const int32 Port = CVarMCPMetricsPort.GetValueOnGameThread();
+    if (Port <= 0 || HttpRouter.IsValid())
+    {
+        return;
+    }
+
+    HttpRouter = FHttpServerModule::Get().GetHttpRouter(static_cast<uint32>(Port), /*bFailOnBindFailure=*/true);
+    if (!HttpRouter.IsValid())
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("MCPMetrics: Could not listen on port %d for /metrics"), Port);
+        return;
+    }
+
+    MetricsRouteHandle = HttpRouter->BindRoute(FHttpPath(TEXT("/metrics")), EHttpServerRequestVerbs::VERB_GET,
+        FHttpRequestHandler::CreateLambda([this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+        {
+            OnComplete(FHttpServerResponse::Create(MakePrometheusText(), TEXT("text/plain; version=0.0.4")));
+            return true;
+        }));
+    FHttpServerModule::Get().StartAllListeners();
+
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPMetrics: Serving Prometheus metrics at http://localhost:%d/metrics"), Port);
+}
+
+void FMCPMetrics::Shutdown()
+{
+    check(IsInGameThread());
+
+    if (HttpRouter.IsValid() && MetricsRouteHandle.IsValid())
+    {
+        HttpRouter->UnbindRoute(MetricsRouteHandle);
+    }
+    MetricsRouteHandle.Reset();
+    HttpRouter.Reset();
+}
+
+FMCPMetrics::FCommandMetrics& FMCPMetrics::FindOrAddCommand(const FString& CommandType)
+{
+    if (TUniquePtr<FCommandMetrics>* Existing = Commands.Find(CommandType))
+    {
+        return **Existing;
+    }
+    return *Commands.Add(CommandType, MakeUnique<FCommandMetrics>());
+}
+
+void FMCPMetrics::RecordRequest(const FString& CommandType, int64 BytesReceived)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandMetrics& Metrics = FindOrAddCommand(CommandType);
+    ++Metrics.Requests;
+    Metrics.BytesReceived += FMath::Max<int64>(BytesReceived, 0);
+}
+
+void FMCPMetrics::RecordExecution(const FString& CommandType, double QueueWaitSeconds, double ExecuteSeconds, double SerializeSeconds, bool bError)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandMetrics& Metrics = FindOrAddCommand(CommandType);
+    Metrics.Stages[static_cast<int32>(EStage::QueueWait)].Record(QueueWaitSeconds);
+    Metrics.Stages[static_cast<int32>(EStage::Execute)].Record(ExecuteSeconds);
+    Metrics.Stages[static_cast<int32>(EStage::Serialize)].Record(SerializeSeconds);
+    Metrics.Errors += bError ? 1 : 0;
+}
+
+int64 FMCPMetrics::SampleUsedMemory()
+{
+    return CVarMCPMemoryAccounting.GetValueOnAnyThread() ? static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) : -1;
+}
+
+void FMCPMetrics::RecordMemory(const FString& CommandType, int64 UsedBefore, int64 UsedAfter)
+{
+    if (UsedBefore < 0 || UsedAfter < 0)
+    {
+        return;
+    }
+
+    const int64 Delta = UsedAfter - UsedBefore;
+    FScopeLock ScopeLock(&Lock);
+    FCommandMetrics& Metrics = FindOrAddCommand(CommandType);
+    Metrics.MemoryNetBytes += Delta;
+    if (Delta > 0)
+    {
+        Metrics.MemoryGrowthBytes += Delta;
+        ++Metrics.MemoryGrowths;
+        Metrics.MaxMemoryGrowthBytes = FMath::Max<uint64>(Metrics.MaxMemoryGrowthBytes, Delta);
+    }
+}
+
+void FMCPMetrics::RecordCacheHit(const FString& CommandType)
+{
+    FScopeLock ScopeLock(&Lock);
+    ++FindOrAddCommand(CommandType).CacheHits;
+}
+
+void FMCPMetrics::RecordSend(const FString& CommandType, double SendSeconds, int64 BytesSent, bool bSucceeded)
+{
+    FScopeLock ScopeLock(&Lock);
+    FCommandMetrics& Metrics = FindOrAddCommand(CommandType);
+    Metrics.Stages[static_cast<int32>(EStage::Send)].Record(SendSeconds);
+    Metrics.BytesSent += FMath::Max<int64>(BytesSent, 0);
+    Metrics.SendFailures += bSucceeded ? 0 : 1;
+}
+
+void FMCPMetrics::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    Commands.Reset();
+    StartTime = FPlatformTime::Seconds();
+}
+
+const TCHAR* FMCPMetrics::GetStageName(EStage Stage)
+{
+    switch (Stage)
+    {
+    case EStage::QueueWait: return TEXT("queue_wait");
+    case EStage::Execute: return TEXT("execute");
+    case EStage::Serialize: return TEXT("serialize");
+    case EStage::Send: return TEXT("send");
+    default: return TEXT("unknown");
+    }
+}
+
+TSharedRef<FJsonObject> FMCPMetrics::MakeSnapshot(const FString& CommandFilter) const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TArray<const TPair<FString, TUniquePtr<FCommandMetrics>>*> Sorted;
+    for (const TPair<FString, TUniquePtr<FCommandMetrics>>& Pair : Commands)
+    {
+        if (CommandFilter.IsEmpty() || Pair.Key == CommandFilter)
+        {
+            Sorted.Add(&Pair);
+        }
+    }
+    Sorted.Sort([](const TPair<FString, TUniquePtr<FCommandMetrics>>& A, const TPair<FString, TUniquePtr<FCommandMetrics>>& B)
+    {
+        return A.Value->Requests != B.Value->Requests ? A.Value->Requests > B.Value->Requests : A.Key < B.Key;
+    });
+
+    TArray<TSharedPtr<FJsonValue>> CommandsArray;
+    for (const TPair<FString, TUniquePtr<FCommandMetrics>>* Pair : Sorted)
+    {
+        const FCommandMetrics& Metrics = *Pair->Value;
+
+        TSharedPtr<FJsonObject> CommandObj = MakeShared<FJsonObject>();
+        CommandObj->SetStringField(TEXT("command"), Pair->Key);
+        CommandObj->SetNumberField(TEXT("requests"), static_cast<double>(Metrics.Requests));
+        CommandObj->SetNumberField(TEXT("errors"), static_cast<double>(Metrics.Errors));
+        CommandObj->SetNumberField(TEXT("cache_hits"), static_cast<double>(Metrics.CacheHits));
+        CommandObj->SetNumberField(TEXT("send_failures"), static_cast<double>(Metrics.SendFailures));
+        CommandObj->SetNumberField(TEXT("bytes_received"), static_cast<double>(Metrics.BytesReceived));
+        CommandObj->SetNumberField(TEXT("bytes_sent"), static_cast<double>(Metrics.BytesSent));
+
+        TSharedPtr<FJsonObject> StagesObj = MakeShared<FJsonObject>();
+        for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EStage::Num); ++StageIndex)
+        {
+            const FLatencyHistogram& Histogram = Metrics.Stages[StageIndex];
+            if (Histogram.GetCount() == 0)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> StageObj = MakeShared<FJsonObject>();
+            StageObj->SetNumberField(TEXT("count"), static_cast<double>(Histogram.GetCount()));
+            StageObj->SetNumberField(TEXT("mean_ms"), Histogram.GetSumSeconds() * 1000.0 / Histogram.GetCount());
+            StageObj->SetNumberField(TEXT("p50_ms"), Histogram.GetPercentileSeconds(0.5) * 1000.0);
+            StageObj->SetNumberField(TEXT("p90_ms"), Histogram.GetPercentileSeconds(0.9) * 1000.0);
+            StageObj->SetNumberField(TEXT("p99_ms"), Histogram.GetPercentileSeconds(0.99) * 1000.0);
+            StageObj->SetNumberField(TEXT("max_ms"), Histogram.GetMaxSeconds() * 1000.0);
+            StagesObj->SetObjectField(GetStageName(static_cast<EStage>(StageIndex)), StageObj);
+        }
+        CommandObj->SetObjectField(TEXT("stages"), StagesObj);
+
+        TSharedPtr<FJsonObject> MemoryObj = MakeShared<FJsonObject>();
+        MemoryObj->SetNumberField(TEXT("net_bytes"), static_cast<double>(Metrics.MemoryNetBytes));
+        MemoryObj->SetNumberField(TEXT("growth_bytes"), static_cast<double>(Metrics.MemoryGrowthBytes));
+        MemoryObj->SetNumberField(TEXT("growths"), static_cast<double>(Metrics.MemoryGrowths));
+        MemoryObj->SetNumberField(TEXT("max_growth_bytes"), static_cast<double>(Metrics.MaxMemoryGrowthBytes));
+        CommandObj->SetObjectField(TEXT("memory"), MemoryObj);
+        CommandsArray.Add(MakeShared<FJsonValueObject>(CommandObj));
+    }
+
+    const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+    TSharedPtr<FJsonObject> MemoryObj = MakeShared<FJsonObject>();
+    MemoryObj->SetNumberField(TEXT("used_physical_bytes"), static_cast<double>(MemoryStats.UsedPhysical));
+    MemoryObj->SetNumberField(TEXT("peak_used_physical_bytes"), static_cast<double>(MemoryStats.PeakUsedPhysical));
+    MemoryObj->SetBoolField(TEXT("accounting_enabled"), CVarMCPMemoryAccounting.GetValueOnAnyThread());
+
+    TArray<TPair<FString, int64>> TagAmounts;
+    const bool bLLMEnabled = MCPMemory::GetTagAmounts(TagAmounts);
+    MemoryObj->SetBoolField(TEXT("llm_enabled"), bLLMEnabled);
+    if (bLLMEnabled)
+    {
+        TSharedPtr<FJsonObject> TagsObj = MakeShared<FJsonObject>();
+        for (const TPair<FString, int64>& Amount : TagAmounts)
+        {
+            TagsObj->SetNumberField(Amount.Key, static_cast<double>(Amount.Value));
+        }
+        MemoryObj->SetObjectField(TEXT("llm_tags"), TagsObj);
+    }
+
+    TSharedRef<FJsonObject> Snapshot = MakeShared<FJsonObject>();
+    Snapshot->SetNumberField(TEXT("uptime_seconds"), FPlatformTime::Seconds() - StartTime);
+    Snapshot->SetObjectField(TEXT("memory"), MemoryObj);
+    Snapshot->SetArrayField(TEXT("commands"), CommandsArray);
+    return Snapshot;
+}
+
+FString FMCPMetrics::MakePrometheusText() const
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TArray<FString> CommandNames;
+    Commands.GetKeys(CommandNames);
+    CommandNames.Sort();
+
+    FString Text;
+    Text.Reserve(256 + CommandNames.Num() * 2048);
+
+    Text += TEXT("# HELP mcp_command_duration_seconds Time MCP requests spent per stage: queue_wait, execute, serialize, send.\n");
+    Text += TEXT("# TYPE mcp_command_duration_seconds summary\n");
+    for (const FString& CommandName : CommandNames)
+    {
+        const FCommandMetrics& Metrics = *Commands.FindChecked(CommandName);
+        const FString Command = EscapeLabel(CommandName);
+        for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EStage::Num); ++StageIndex)
+        {
+            const FLatencyHistogram& Histogram = Metrics.Stages[StageIndex];
+            if (Histogram.GetCount() == 0)
+            {
+                continue;
+            }
+
+            const TCHAR* Stage = GetStageName(static_cast<EStage>(StageIndex));
+            for (double Percentile : ReportedPercentiles)
+            {
+                Text += FString::Printf(TEXT("mcp_command_duration_seconds{command=\"%s\",stage=\"%s\",quantile=\"%g\"} %.9g\n"),
+                    *Command, Stage, Percentile, Histogram.GetPercentileSeconds(Percentile));
+            }
+            Text += FString::Printf(TEXT("mcp_command_duration_seconds_sum{command=\"%s\",stage=\"%s\"} %.9g\n"), *Command, Stage, Histogram.GetSumSeconds());
+            Text += FString::Printf(TEXT("mcp_command_duration_seconds_count{command=\"%s\",stage=\"%s\"} %llu\n"), *Command, Stage, Histogram.GetCount());
+        }
+    }
+
+    auto AppendCounter = [&Text, &CommandNames, this](const TCHAR* Name, const TCHAR* Help, uint64 FCommandMetrics::* Counter)
+    {
+        Text += FString::Printf(TEXT("# HELP %s %s\n# TYPE %s counter\n"), Name, Help, Name);
+        for (const FString& CommandName : CommandNames)
+        {
+            Text += FString::Printf(TEXT("%s{command=\"%s\"} %llu\n"), Name, *EscapeLabel(CommandName), (*Commands.FindChecked(CommandName)).*Counter);
+        }
+    };
+    AppendCounter(TEXT("mcp_command_requests_total"), TEXT("Requests received per MCP command."), &FCommandMetrics::Requests);
+    AppendCounter(TEXT("mcp_command_errors_total"), TEXT("Error responses per MCP command."), &FCommandMetrics::Errors);
+    AppendCounter(TEXT("mcp_command_cache_hits_total"), TEXT("Requests answered from the response cache per MCP command."), &FCommandMetrics::CacheHits);
+    AppendCounter(TEXT("mcp_command_send_failures_total"), TEXT("Responses that failed to send per MCP command."), &FCommandMetrics::SendFailures);
+    AppendCounter(TEXT("mcp_command_received_bytes_total"), TEXT("Request bytes received per MCP command."), &FCommandMetrics::BytesReceived);
+    AppendCounter(TEXT("mcp_command_sent_bytes_total"), TEXT("Response bytes sent per MCP command."), &FCommandMetrics::BytesSent);
+    AppendCounter(TEXT("mcp_command_memory_growth_bytes_total"), TEXT("Physical memory growth while MCP commands ran, per command."), &FCommandMetrics::MemoryGrowthBytes);
+    AppendCounter(TEXT("mcp_command_memory_growths_total"), TEXT("MCP commands during which physical memory grew, per command."), &FCommandMetrics::MemoryGrowths);
+
+    Text += TEXT("# HELP mcp_process_used_physical_bytes Physical memory used by the editor process.\n# TYPE mcp_process_used_physical_bytes gauge\n");
+    Text += FString::Printf(TEXT("mcp_process_used_physical_bytes %llu\n"), static_cast<uint64>(FPlatformMemory::GetStats().UsedPhysical));
+
+    TArray<TPair<FString, int64>> TagAmounts;
+    if (MCPMemory::GetTagAmounts(TagAmounts))
+    {
+        Text += TEXT("# HELP mcp_llm_tag_bytes Bytes tracked by the Low Level Memory tracker under each UnrealMCP tag.\n# TYPE mcp_llm_tag_bytes gauge\n");
+        for (const TPair<FString, int64>& Amount : TagAmounts)
+        {
+            Text += FString::Printf(TEXT("mcp_llm_tag_bytes{tag=\"%s\"} %lld\n"), *EscapeLabel(Amount.Key), Amount.Value);
+        }
+    }
+
+    return Text;
+}
@@ -9,6 +9,33 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogMCPOperationContext, Log, All);
 
+namespace
+{
+    FString GenerateOperationId()
+    {
+        return FGuid::NewGuid().ToString();
+    }
+
+    FString SeverityToString(EMCPErrorSeverity Severity)
+    {
+        switch (Severity)
+        {
+            case EMCPErrorSeverity::Info:
+                return TEXT("INFO");
+            case EMCPErrorSeverity::Warning:
+                return TEXT("WARNING");
+            case EMCPErrorSeverity::Error:
+                return TEXT("ERROR");
+            case EMCPErrorSeverity::Critical:
+                return TEXT("CRITICAL");
+            case EMCPErrorSeverity::Fatal:
+                return TEXT("FATAL");
+            default:
+                return TEXT("UNKNOWN");
+        }
+    }
+}
+
 FString FMCPEnhancedError::ToJsonString() const
 {
     TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
@@ -100,7 +127,7 @@ FMCPEnhancedError FMCPEnhancedError::FromJsonString(const FString& JsonString)
     return Error;
 }
 
-UMCPOperationContext::UMCPOperationContext()
+FMCPOperationContext::FMCPOperationContext()
     : OperationName(TEXT(""))
     , OperationId(TEXT(""))
     , StartTime(FDateTime::Now())
@@ -109,7 +136,7 @@ UMCPOperationContext::UMCPOperationContext()
 {
 }
 
-void UMCPOperationContext::Initialize(const FString& InOperationName, const FString& InOperationId)
+void FMCPOperationContext::Initialize(const FString& InOperationName, const FString& InOperationId)
 {
     OperationName = InOperationName;
     OperationId = InOperationId.IsEmpty() ? GenerateOperationId() : InOperationId;
@@ -123,7 +150,7 @@ void UMCPOperationContext::Initialize(const FString& InOperationName, const FStr
     UE_LOG(LogMCPOperationContext, Verbose, TEXT("Initialized operation context: %s [%s]"), *OperationName, *OperationId);
 }
 
-void UMCPOperationContext::AddError(const FMCPError& Error, EMCPErrorSeverity Severity, const FString& SourceLocation)
+void FMCPOperationContext::AddError(const FMCPError& Error, EMCPErrorSeverity Severity, const FString& SourceLocation)
 {
     FMCPEnhancedError EnhancedError(Error, Severity);
     EnhancedError.SetSourceLocation(SourceLocation);
@@ -137,7 +164,7 @@ void UMCPOperationContext::AddError(const FMCPError& Error, EMCPErrorSeverity Se
     AddEnhancedError(EnhancedError);
 }
 
-void UMCPOperationContext::AddEnhancedError(const FMCPEnhancedError& Error)
+void FMCPOperationContext::AddEnhancedError(const FMCPEnhancedError& Error)
 {
     Errors.Add(Error);
     
@@ -168,24 +195,24 @@ void UMCPOperationContext::AddEnhancedError(const FMCPEnhancedError& Error)
     }
 }
 
-void UMCPOperationContext::AddWarning(const FString& Warning, const FString& Details, const FString& SourceLocation)
+void FMCPOperationContext::AddWarning(const FString& Warning, const FString& Details, const FString& SourceLocation)
 {
     FMCPError WarningError(EMCPErrorType::ValidationFailed, 0, Warning, Details);
     AddError(WarningError, EMCPErrorSeverity::Warning, SourceLocation);
 }
 
-void UMCPOperationContext::AddInfo(const FString& Info, const FString& Details)
+void FMCPOperationContext::AddInfo(const FString& Info, const FString& Details)
 {
     FMCPError InfoError(EMCPErrorType::None, 0, Info, Details);
     AddError(InfoError, EMCPErrorSeverity::Info);
 }
 
-void UMCPOperationContext::AddOperationContext(const FString& Key, const FString& Value)
+void FMCPOperationContext::AddOperationContext(const FString& Key, const FString& Value)
 {
     OperationContext.Add(Key, Value);
 }
 
-bool UMCPOperationContext::HasErrors() const
+bool FMCPOperationContext::HasErrors() const
 {
     for (const FMCPEnhancedError& Error : Errors)
     {
@@ -197,7 +224,7 @@ bool UMCPOperationContext::HasErrors() const
     return false;
 }
 
-bool UMCPOperationContext::HasWarnings() const
+bool FMCPOperationContext::HasWarnings() const
 {
     for (const FMCPEnhancedError& Error : Errors)
     {
@@ -209,7 +236,7 @@ bool UMCPOperationContext::HasWarnings() const
     return false;
 }
 
-int32 UMCPOperationContext::GetErrorCount(EMCPErrorSeverity Severity) const
+int32 FMCPOperationContext::GetErrorCount(EMCPErrorSeverity Severity) const
 {
     int32 Count = 0;
     for (const FMCPEnhancedError& Error : Errors)
@@ -222,7 +249,7 @@ int32 UMCPOperationContext::GetErrorCount(EMCPErrorSeverity Severity) const
     return Count;
 }
 
-TArray<FMCPEnhancedError> UMCPOperationContext::GetErrorsBySeverity(EMCPErrorSeverity Severity) const
+TArray<FMCPEnhancedError> FMCPOperationContext::GetErrorsBySeverity(EMCPErrorSeverity Severity) const
 {
     TArray<FMCPEnhancedError> FilteredErrors;
     for (const FMCPEnhancedError& Error : Errors)
@@ -235,7 +262,7 @@ TArray<FMCPEnhancedError> UMCPOperationContext::GetErrorsBySeverity(EMCPErrorSev
     return FilteredErrors;
 }
 
-FMCPEnhancedError UMCPOperationContext::GetMostSevereError() const
+FMCPEnhancedError FMCPOperationContext::GetMostSevereError() const
 {
     if (Errors.Num() == 0)
     {
@@ -254,7 +281,7 @@ FMCPEnhancedError UMCPOperationContext::GetMostSevereError() const
     return MostSevere;
 }
 
-FString UMCPOperationContext::CreateResponse(const FString& SuccessData, const FString& Metadata) const
+FString FMCPOperationContext::CreateResponse(const FString& SuccessData, const FString& Metadata) const
 {
     TSharedPtr<FJsonObject> ResponseObject = MakeShareable(new FJsonObject);
     
@@ -310,7 +337,7 @@ FString UMCPOperationContext::CreateResponse(const FString& SuccessData, const F
     return OutputString;
 }
 
-FString UMCPOperationContext::CreateErrorSummary() const
+FString FMCPOperationContext::CreateErrorSummary() const
 {
     if (Errors.Num() == 0)
     {
@@ -333,7 +360,7 @@ FString UMCPOperationContext::CreateErrorSummary() const
     return FString::Join(SummaryParts, TEXT(", "));
 }
 
-void UMCPOperationContext::Clear()
+void FMCPOperationContext::Clear()
 {
     Errors.Empty();
     OperationContext.Empty();
@@ -342,13 +369,13 @@ void UMCPOperationContext::Clear()
     EndTime = FDateTime::MinValue();
 }
 
-float UMCPOperationContext::GetOperationDuration() const
+float FMCPOperationContext::GetOperationDuration() const
 {
     FDateTime EndTimeToUse = bOperationCompleted ? EndTime : FDateTime::Now();
     return (EndTimeToUse - StartTime).GetTotalSeconds();
 }
 
-void UMCPOperationContext::CompleteOperation()
+void FMCPOperationContext::CompleteOperation()
 {
     if (!bOperationCompleted)
     {
@@ -361,7 +388,7 @@ void UMCPOperationContext::CompleteOperation()
     }
 }
 
-FString UMCPOperationContext::GetOperationStats() const
+FString FMCPOperationContext::GetOperationStats() const
 {
     TSharedPtr<FJsonObject> StatsObject = MakeShareable(new FJsonObject);
     
@@ -382,26 +409,91 @@ FString UMCPOperationContext::GetOperationStats() const
     return OutputString;
 }
 
-FString UMCPOperationContext::GenerateOperationId() const
+UMCPOperationContext::UMCPOperationContext()
 {
-    return FGuid::NewGuid().ToString();
 }
 
-FString UMCPOperationContext::SeverityToString(EMCPErrorSeverity Severity) const
+void UMCPOperationContext::Initialize(const FString& InOperationName, const FString& InOperationId)
 {
-    switch (Severity)
-    {
-        case EMCPErrorSeverity::Info:
-            return TEXT("INFO");
-        case EMCPErrorSeverity::Warning:
-            return TEXT("WARNING");
-        case EMCPErrorSeverity::Error:
-            return TEXT("ERROR");
-        case EMCPErrorSeverity::Critical:
-            return TEXT("CRITICAL");
-        case EMCPErrorSeverity::Fatal:
-            return TEXT("FATAL");
-        default:
-            return TEXT("UNKNOWN");
-    }
-}
\ No newline at end of file
+    Context.Initialize(InOperationName, InOperationId);
+}
+
+void UMCPOperationContext::AddError(const FMCPError& Error, EMCPErrorSeverity Severity, const FString& SourceLocation)
+{
+    Context.AddError(Error, Severity, SourceLocation);
+}
+
+void UMCPOperationContext::AddEnhancedError(const FMCPEnhancedError& Error)
+{
+    Context.AddEnhancedError(Error);
+}
+
+void UMCPOperationContext::AddWarning(const FString& Warning, const FString& Details, const FString& SourceLocation)
+{
+    Context.AddWarning(Warning, Details, SourceLocation);
+}
+
+void UMCPOperationContext::AddInfo(const FString& Info, const FString& Details)
+{
+    Context.AddInfo(Info, Details);
+}
+
+void UMCPOperationContext::AddOperationContext(const FString& Key, const FString& Value)
+{
+    Context.AddOperationContext(Key, Value);
+}
+
+bool UMCPOperationContext::HasErrors() const
+{
+    return Context.HasErrors();
+}
+
+bool UMCPOperationContext::HasWarnings() const
+{
+    return Context.HasWarnings();
+}
+
+int32 UMCPOperationContext::GetErrorCount(EMCPErrorSeverity Severity) const
+{
+    return Context.GetErrorCount(Severity);
+}
+
+TArray<FMCPEnhancedError> UMCPOperationContext::GetErrorsBySeverity(EMCPErrorSeverity Severity) const
+{
+    return Context.GetErrorsBySeverity(Severity);
+}
+
+FMCPEnhancedError UMCPOperationContext::GetMostSevereError() const
+{
+    return Context.GetMostSevereError();
+}
+
+FString UMCPOperationContext::CreateResponse(const FString& SuccessData, const FString& Metadata) const
+{
+    return Context.CreateResponse(SuccessData, Metadata);
+}
+
+FString UMCPOperationContext::CreateErrorSummary() const
+{
+    return Context.CreateErrorSummary();
+}
+
+void UMCPOperationContext::Clear()
+{
+    Context.Clear();
+}
+
+float UMCPOperationContext::GetOperationDuration() const
+{
+    return Context.GetOperationDuration();
+}
+
+void UMCPOperationContext::CompleteOperation()
+{
+    Context.CompleteOperation();
+}
+
+FString UMCPOperationContext::GetOperationStats() const
+{
+    return Context.GetOperationStats();
+}
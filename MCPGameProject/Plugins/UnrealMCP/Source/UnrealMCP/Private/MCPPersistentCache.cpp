@@ -0,0 +1,157 @@
+#include "MCPPersistentCache.h"
+#include "MCPLogging.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/App.h"
+#include "Misc/Crc.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Hash/CityHash.h"
+#include "Memory/MemoryView.h"
+
+namespace
+{
+    constexpr uint32 CacheFileMagic = 0x4D435043; // "MCPC"
+    constexpr uint32 CacheFileFormat = 1;
+
+    struct FCacheFileHeader
+    {
+        uint32 Magic = 0;
+        uint32 Format = 0;
+        uint32 Version = 0;
+        uint64 BuildKey = 0;
+        uint64 ContentKey = 0;
+        int64 PayloadSize = 0;
+        uint32 PayloadCrc = 0;
+
+        friend FArchive& operator<<(FArchive& Ar, FCacheFileHeader& Header)
+        {
+            return Ar << Header.Magic << Header.Format << Header.Version << Header.BuildKey
+                << Header.ContentKey << Header.PayloadSize << Header.PayloadCrc;
+        }
+    };
+
+    /** Bytes FCacheFileHeader takes in a file */
+    constexpr int64 CacheFileHeaderSize = 4 + 4 + 4 + 8 + 8 + 8 + 4;
+}
+
+FString FMCPPersistentCache::GetPath(const TCHAR* Name)
+{
+    return FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("UnrealMCP"), FString(Name) + TEXT(".bin"));
+}
+
+uint64 FMCPPersistentCache::GetEngineBuildKey()
+{
+    static const uint64 BuildKey = []()
+    {
+        // Version and changelist identify installed engines; the build date tells source builds apart
+        const FString BuildId = FString::Printf(TEXT("%s|%s|%s"), *FEngineVersion::Current().ToString(), FApp::GetBuildVersion(), *FApp::GetBuildDate());
+        const FTCHARToUTF8 BuildIdUtf8(*BuildId);
+        return CityHash64(BuildIdUtf8.Get(), BuildIdUtf8.Length());
+    }();
+    return BuildKey;
+}
+
+bool FMCPPersistentCache::Save(const TCHAR* Name, uint32 Version, uint64 ContentKey, TFunctionRef<void(FArchive&)> WritePayload)
+{
+    TArray<uint8> Bytes;
+    Bytes.SetNumZeroed(CacheFileHeaderSize);
+    {
+        FMemoryWriter Writer(Bytes);
+        Writer.Seek(CacheFileHeaderSize);
+        WritePayload(Writer);
+        if (Writer.IsError())
+        {
+            return false;
+        }
+    }
+
+    FCacheFileHeader Header;
+    Header.Magic = CacheFileMagic;
+    Header.Format = CacheFileFormat;
+    Header.Version = Version;
+    Header.BuildKey = GetEngineBuildKey();
+    Header.ContentKey = ContentKey;
+    Header.PayloadSize = Bytes.Num() - CacheFileHeaderSize;
+    Header.PayloadCrc = FCrc::MemCrc32(Bytes.GetData() + CacheFileHeaderSize, static_cast<int32>(Header.PayloadSize));
+    {
+        FMemoryWriter HeaderWriter(Bytes);
+        HeaderWriter << Header;
+    }
+
+    // Write next to the file and move it over, so a crash never leaves half a cache behind
+    const FString Path = GetPath(Name);
+    const FString TempPath = Path + TEXT(".tmp");
+    if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FMCPPersistentCache: Could not write '%s'"), *Path);
+        IFileManager::Get().Delete(*TempPath, false, false, true);
+        return false;
+    }
+    return true;
+}
+
+bool FMCPPersistentCache::Load(const TCHAR* Name, uint32 Version, uint64& OutContentKey, TFunctionRef<bool(FArchive&)> ReadPayload)
+{
+    OutContentKey = 0;
+    const FString Path = GetPath(Name);
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Path))
+    {
+        return false;
+    }
+
+    // Map the file rather than copying it; platforms without mapping read it into memory
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    TArray<uint8> FileBytes;
+    TConstArrayView<uint8> Bytes;
+    {
+        FOpenMappedResult OpenResult = PlatformFile.OpenMappedEx(*Path);
+        if (OpenResult.HasValue())
+        {
+            MappedFile = OpenResult.StealValue();
+            MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+        }
+    }
+    if (MappedRegion.IsValid())
+    {
+        Bytes = MakeArrayView(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+    }
+    else if (FFileHelper::LoadFileToArray(FileBytes, *Path, FILEREAD_Silent))
+    {
+        Bytes = FileBytes;
+    }
+    if (Bytes.Num() < CacheFileHeaderSize)
+    {
+        return false;
+    }
+
+    FMemoryReaderView Reader(MakeMemoryView(Bytes.GetData(), Bytes.Num()));
+    FCacheFileHeader Header;
+    Reader << Header;
+    if (Header.Magic != CacheFileMagic || Header.Format != CacheFileFormat || Header.Version != Version
+        || Header.BuildKey != GetEngineBuildKey())
+    {
+        UE_LOG(LogUnrealMCP, Log, TEXT("FMCPPersistentCache: Ignoring '%s' from another engine build or version"), *Path);
+        return false;
+    }
+    if (Header.PayloadSize != Bytes.Num() - CacheFileHeaderSize
+        || FCrc::MemCrc32(Bytes.GetData() + CacheFileHeaderSize, static_cast<int32>(Header.PayloadSize)) != Header.PayloadCrc)
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FMCPPersistentCache: Ignoring damaged '%s'"), *Path);
+        return false;
+    }
+
+    if (!ReadPayload(Reader) || Reader.IsError())
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FMCPPersistentCache: Ignoring unreadable '%s'"), *Path);
+        return false;
+    }
+    OutContentKey = Header.ContentKey;
+    return true;
+}
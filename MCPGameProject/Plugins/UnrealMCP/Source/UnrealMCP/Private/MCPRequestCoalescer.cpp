@@ -0,0 +1,97 @@
+#include "MCPRequestCoalescer.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    TSharedPtr<FJsonValue> MakeCanonicalValue(const TSharedPtr<FJsonValue>& Value);
+
+    // Copy of the object with its fields in sorted order, recursively; the serializer writes fields in
+    // insertion order, so equal objects then serialize identically
+    TSharedRef<FJsonObject> MakeCanonicalObject(const TSharedPtr<FJsonObject>& Object)
+    {
+        TSharedRef<FJsonObject> Canonical = MakeShared<FJsonObject>();
+        if (!Object.IsValid())
+        {
+            return Canonical;
+        }
+
+        TArray<FString> Keys;
+        Object->Values.GetKeys(Keys);
+        Keys.Sort();
+        for (const FString& Key : Keys)
+        {
+            Canonical->SetField(Key, MakeCanonicalValue(Object->Values[Key]));
+        }
+        return Canonical;
+    }
+
+    TSharedPtr<FJsonValue> MakeCanonicalValue(const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid())
+        {
+            return Value;
+        }
+
+        if (Value->Type == EJson::Object)
+        {
+            return MakeShared<FJsonValueObject>(MakeCanonicalObject(Value->AsObject()));
+        }
+
+        if (Value->Type == EJson::Array)
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+            {
+                Elements.Add(MakeCanonicalValue(Element));
+            }
+            return MakeShared<FJsonValueArray>(Elements);
+        }
+
+        return Value;
+    }
+}
+
+FString FMCPRequestCoalescer::MakeKey(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    FString Key = CommandType;
+    Key.AppendChar(TEXT('\n'));
+
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Key);
+    FJsonSerializer::Serialize(MakeCanonicalObject(Params), Writer);
+    return Key;
+}
+
+bool FMCPRequestCoalescer::Join(const FString& Key, const FMCPCancellationTokenPtr& CancellationToken, uint32 ClientId, TFuture<FString>& OutFuture)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TArray<FFollower>* Followers = InFlightRequests.Find(Key);
+    if (!Followers)
+    {
+        InFlightRequests.Add(Key);
+        return false;
+    }
+
+    FFollower& Follower = Followers->AddDefaulted_GetRef();
+    Follower.CancellationToken = CancellationToken;
+    Follower.ClientId = ClientId;
+    OutFuture = Follower.Promise.GetFuture();
+    return true;
+}
+
+TArray<FMCPRequestCoalescer::FFollower> FMCPRequestCoalescer::Complete(const FString& Key)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    TArray<FFollower> Followers;
+    if (TArray<FFollower>* InFlight = InFlightRequests.Find(Key))
+    {
+        Followers = MoveTemp(*InFlight);
+        InFlightRequests.Remove(Key);
+    }
+    return Followers;
+}
@@ -0,0 +1,414 @@
+#include "MCPRequestRecording.h"
+#include "MCPCancellation.h"
+#include "MCPCommandScheduler.h"
+#include "MCPLogging.h"
+#include "UnrealMCPBridge.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<bool> CVarMCPRecordRequests(
+    TEXT("mcp.RecordRequests"),
+    false,
+    TEXT("Record every MCP request into Saved/UnrealMCP/Recordings from startup, for replay_requests. Read at startup."),
+    ECVF_ReadOnly);
+
+namespace
+{
+    const TCHAR* const RecordingFormat = TEXT("unrealmcp-requests");
+    constexpr int32 RecordingVersion = 1;
+
+    /** The recording and replay commands would record or replay themselves */
+    bool IsRecordingCommand(const FString& CommandType)
+    {
+        return CommandType == TEXT("record_requests") || CommandType == TEXT("replay_requests");
+    }
+
+    FString ToCondensedJson(const TSharedRef<FJsonObject>& Object)
+    {
+        FString Text;
+        FJsonSerializer::Serialize(Object, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text));
+        return Text;
+    }
+}
+
+// ============================================================================
+// FMCPRequestRecorder
+// ============================================================================
+
+FMCPRequestRecorder& FMCPRequestRecorder::Get()
+{
+    static FMCPRequestRecorder Instance;
+    return Instance;
+}
+
+FString FMCPRequestRecorder::GetDefaultDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UnrealMCP") / TEXT("Recordings");
+}
+
+void FMCPRequestRecorder::Initialize()
+{
+    if (!CVarMCPRecordRequests.GetValueOnAnyThread())
+    {
+        return;
+    }
+
+    FString RecordingPath;
+    FString Error;
+    if (!Start(FString(), RecordingPath, Error))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("MCPRequestRecorder: %s"), *Error);
+    }
+}
+
+void FMCPRequestRecorder::Shutdown()
+{
+    Stop();
+}
+
+bool FMCPRequestRecorder::Start(const FString& InPath, FString& OutPath, FString& OutError)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (bRecording)
+    {
+        OutError = FString::Printf(TEXT("Already recording to %s"), *Path);
+        return false;
+    }
+
+    OutPath = InPath.IsEmpty()
+        ? GetDefaultDirectory() / FString::Printf(TEXT("Requests_%s.jsonl"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")))
+        : FPaths::ConvertRelativePathToFull(InPath);
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutPath), true);
+
+    Writer.Reset(IFileManager::Get().CreateFileWriter(*OutPath));
+    if (!Writer.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Cannot open %s for writing"), *OutPath);
+        return false;
+    }
+
+    TSharedRef<FJsonObject> Header = MakeShared<FJsonObject>();
+    Header->SetStringField(TEXT("format"), RecordingFormat);
+    Header->SetNumberField(TEXT("version"), RecordingVersion);
+    Header->SetStringField(TEXT("started"), FDateTime::UtcNow().ToIso8601());
+    FTCHARToUTF8 HeaderUtf8(*(ToCondensedJson(Header) + TEXT("\n")));
+    Writer->Serialize(const_cast<ANSICHAR*>(HeaderUtf8.Get()), HeaderUtf8.Length());
+    Writer->Flush();
+
+    Path = OutPath;
+    StartTime = FPlatformTime::Seconds();
+    RecordedCount = 0;
+    bRecording = true;
+
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPRequestRecorder: Recording requests to %s"), *Path);
+    return true;
+}
+
+bool FMCPRequestRecorder::Stop()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!bRecording)
+    {
+        return false;
+    }
+
+    bRecording = false;
+    Writer->Close();
+    Writer.Reset();
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPRequestRecorder: Recorded %lld request(s) to %s"), RecordedCount, *Path);
+    return true;
+}
+
+void FMCPRequestRecorder::Record(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, uint32 ClientId, TOptional<EMCPCommandPriority> Priority)
+{
+    if (!bRecording || (ClientId & FMCPRequestReplayer::ClientIdFlag) != 0 || IsRecordingCommand(CommandType))
+    {
+        return;
+    }
+
+    // Built outside the lock; only the append is serialized
+    TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+    Entry->SetNumberField(TEXT("t"), FPlatformTime::Seconds() - StartTime);
+    Entry->SetNumberField(TEXT("c"), ClientId);
+    Entry->SetStringField(TEXT("type"), CommandType);
+    if (Priority.IsSet())
+    {
+        Entry->SetStringField(TEXT("priority"), Priority.GetValue() == EMCPCommandPriority::Bulk ? TEXT("bulk") : TEXT("interactive"));
+    }
+    Entry->SetObjectField(TEXT("params"), Params.IsValid() ? Params : MakeShared<FJsonObject>());
+    FTCHARToUTF8 LineUtf8(*(ToCondensedJson(Entry) + TEXT("\n")));
+
+    FScopeLock ScopeLock(&Lock);
+    if (!bRecording)
+    {
+        return;
+    }
+    Writer->Serialize(const_cast<ANSICHAR*>(LineUtf8.Get()), LineUtf8.Length());
+    Writer->Flush();
+    RecordedCount++;
+}
+
+TSharedRef<FJsonObject> FMCPRequestRecorder::MakeStatus() const
+{
+    FScopeLock ScopeLock(&Lock);
+    TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
+    Status->SetBoolField(TEXT("recording"), bRecording);
+    Status->SetStringField(TEXT("path"), Path);
+    Status->SetNumberField(TEXT("requests"), static_cast<double>(RecordedCount));
+    Status->SetNumberField(TEXT("elapsed_seconds"), bRecording ? FPlatformTime::Seconds() - StartTime : 0.0);
+    return Status;
+}
+
+// ============================================================================
+// FMCPRequestReplayer
+// ============================================================================
+
+FMCPRequestReplayer& FMCPRequestReplayer::Get()
+{
+    static FMCPRequestReplayer Instance;
+    return Instance;
+}
+
+bool FMCPRequestReplayer::LoadRecording(const FString& InPath, TArray<FRecordedRequest>& OutRequests, FString& OutError)
+{
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *InPath))
+    {
+        OutError = FString::Printf(TEXT("Cannot read recording %s"), *InPath);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Header;
+    FString Format;
+    if (Lines.Num() == 0 || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Lines[0]), Header) || !Header.IsValid()
+        || !Header->TryGetStringField(TEXT("format"), Format) || Format != RecordingFormat)
+    {
+        OutError = FString::Printf(TEXT("%s is not a request recording"), *InPath);
+        return false;
+    }
+
+    for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        if (Lines[LineIndex].IsEmpty())
+        {
+            continue;
+        }
+
+        // A recording cut short by a crash may end in a partial line
+        TSharedPtr<FJsonObject> Entry;
+        FRecordedRequest Request;
+        const TSharedPtr<FJsonObject>* ParamsObj = nullptr;
+        if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Lines[LineIndex]), Entry) || !Entry.IsValid()
+            || !Entry->TryGetStringField(TEXT("type"), Request.CommandType) || !Entry->TryGetNumberField(TEXT("t"), Request.Time)
+            || !Entry->TryGetObjectField(TEXT("params"), ParamsObj))
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPRequestReplayer: Skipping unreadable line %d of %s"), LineIndex + 1, *InPath);
+            continue;
+        }
+
+        Entry->TryGetNumberField(TEXT("c"), Request.ClientId);
+        Request.Params = *ParamsObj;
+        FString PriorityName;
+        EMCPCommandPriority Priority;
+        if (Entry->TryGetStringField(TEXT("priority"), PriorityName) && FMCPCommandScheduler::ParsePriority(PriorityName, Priority))
+        {
+            Request.Priority = Priority;
+        }
+        OutRequests.Add(MoveTemp(Request));
+    }
+    return true;
+}
+
+bool FMCPRequestReplayer::Start(UUnrealMCPBridge* Bridge, const FString& InPath, double InSpeed, int32 MaxRequests, FString& OutError)
+{
+    if (!Bridge)
+    {
+        OutError = TEXT("The MCP bridge is not running");
+        return false;
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    if (State == TEXT("running"))
+    {
+        OutError = FString::Printf(TEXT("Already replaying %s"), *Path);
+        return false;
+    }
+
+    TArray<FRecordedRequest> Requests;
+    if (!LoadRecording(InPath, Requests, OutError))
+    {
+        return false;
+    }
+    if (MaxRequests > 0 && Requests.Num() > MaxRequests)
+    {
+        Requests.SetNum(MaxRequests);
+    }
+
+    State = TEXT("running");
+    Path = InPath;
+    Speed = FMath::Max(InSpeed, 0.0);
+    RequestsTotal = Requests.Num();
+    RequestsSent = 0;
+    Responses = 0;
+    Errors = 0;
+    BusyResponses = 0;
+    RecordedSeconds = Requests.Num() > 0 ? Requests.Last().Time - Requests[0].Time : 0.0;
+    StartTime = FPlatformTime::Seconds();
+    EndTime = 0.0;
+    Latency = FMCPMetrics::FLatencyHistogram();
+    bStopRequested = false;
+
+    ReplayTask = Async(EAsyncExecution::Thread, [this, Bridge, Requests = MoveTemp(Requests)]() mutable
+    {
+        Run(Bridge, MoveTemp(Requests));
+    });
+
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPRequestReplayer: Replaying %d request(s) from %s at speed %g"), RequestsTotal, *Path, Speed);
+    return true;
+}
+
+void FMCPRequestReplayer::Run(UUnrealMCPBridge* Bridge, TArray<FRecordedRequest> Requests)
+{
+    // One token for the whole replay, so stopping it also drops whatever it still has queued
+    FMCPCancellationTokenPtr CancellationToken = MakeShared<FMCPCancellationToken, ESPMode::ThreadSafe>();
+    TMap<uint32, TFuture<void>> LastResponses;
+    const double FirstTime = Requests.Num() > 0 ? Requests[0].Time : 0.0;
+    const double ReplayStart = FPlatformTime::Seconds();
+
+    // Poll in short waits so a stop request is seen promptly
+    auto WaitFor = [this](TFunctionRef<bool()> IsDone)
+    {
+        while (!IsDone())
+        {
+            if (bStopRequested)
+            {
+                return false;
+            }
+            FPlatformProcess::Sleep(0.005f);
+        }
+        return true;
+    };
+
+    for (FRecordedRequest& Request : Requests)
+    {
+        if (Speed > 0.0)
+        {
+            const double DueTime = ReplayStart + (Request.Time - FirstTime) / Speed;
+            if (!WaitFor([DueTime]() { return FPlatformTime::Seconds() >= DueTime; }))
+            {
+                break;
+            }
+        }
+
+        const uint32 ClientId = ClientIdFlag | Request.ClientId;
+        if (TFuture<void>* Previous = LastResponses.Find(ClientId))
+        {
+            if (!WaitFor([Previous]() { return Previous->IsReady(); }))
+            {
+                break;
+            }
+        }
+        if (bStopRequested)
+        {
+            break;
+        }
+
+        const double SentTime = FPlatformTime::Seconds();
+        LastResponses.Add(ClientId, Bridge->ExecuteCommandAsync(Request.CommandType, Request.Params, CancellationToken, ClientId, Request.Priority)
+            .Next([this, SentTime](const FString& Response)
+            {
+                RecordResponse(Response, FPlatformTime::Seconds() - SentTime);
+            }));
+
+        FScopeLock ScopeLock(&Lock);
+        RequestsSent++;
+    }
+
+    if (bStopRequested)
+    {
+        CancellationToken->Cancel();
+    }
+    else
+    {
+        for (TPair<uint32, TFuture<void>>& Pair : LastResponses)
+        {
+            TFuture<void>& Last = Pair.Value;
+            if (!WaitFor([&Last]() { return Last.IsReady(); }))
+            {
+                CancellationToken->Cancel();
+                break;
+            }
+        }
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    State = bStopRequested ? TEXT("stopped") : TEXT("finished");
+    EndTime = FPlatformTime::Seconds();
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPRequestReplayer: Replay of %s %s after %d of %d request(s) in %.1f s (recorded %.1f s), %d error(s)"),
+        *Path, *State, RequestsSent, RequestsTotal, EndTime - StartTime, RecordedSeconds, Errors);
+}
+
+void FMCPRequestReplayer::RecordResponse(const FString& Response, double LatencySeconds)
+{
+    // Envelopes are written by the bridge with "status" first, so the prefix tells the outcome
+    // without parsing what may be a large response
+    const bool bSuccess = Response.StartsWith(TEXT("{\"status\":\"success\""));
+    const bool bBusy = !bSuccess && Response.Contains(TEXT("\"busy\":true"));
+
+    FScopeLock ScopeLock(&Lock);
+    Responses++;
+    Errors += bSuccess ? 0 : 1;
+    BusyResponses += bBusy ? 1 : 0;
+    Latency.Record(LatencySeconds);
+}
+
+void FMCPRequestReplayer::Stop()
+{
+    bStopRequested = true;
+}
+
+void FMCPRequestReplayer::Shutdown()
+{
+    Stop();
+    if (ReplayTask.IsValid())
+    {
+        ReplayTask.Wait();
+        ReplayTask.Reset();
+    }
+}
+
+TSharedRef<FJsonObject> FMCPRequestReplayer::MakeStatus() const
+{
+    FScopeLock ScopeLock(&Lock);
+    TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
+    Status->SetStringField(TEXT("state"), State);
+    Status->SetStringField(TEXT("path"), Path);
+    Status->SetNumberField(TEXT("speed"), Speed);
+    Status->SetNumberField(TEXT("requests_total"), RequestsTotal);
+    Status->SetNumberField(TEXT("requests_sent"), RequestsSent);
+    Status->SetNumberField(TEXT("responses"), Responses);
+    Status->SetNumberField(TEXT("errors"), Errors);
+    Status->SetNumberField(TEXT("busy"), BusyResponses);
+    Status->SetNumberField(TEXT("recorded_seconds"), RecordedSeconds);
+    Status->SetNumberField(TEXT("elapsed_seconds"), StartTime > 0.0 ? (EndTime > 0.0 ? EndTime : FPlatformTime::Seconds()) - StartTime : 0.0);
+
+    TSharedPtr<FJsonObject> LatencyObj = MakeShared<FJsonObject>();
+    LatencyObj->SetNumberField(TEXT("count"), static_cast<double>(Latency.GetCount()));
+    LatencyObj->SetNumberField(TEXT("mean_ms"), Latency.GetCount() > 0 ? Latency.GetSumSeconds() * 1000.0 / Latency.GetCount() : 0.0);
+    LatencyObj->SetNumberField(TEXT("p50_ms"), Latency.GetPercentileSeconds(0.5) * 1000.0);
+    LatencyObj->SetNumberField(TEXT("p90_ms"), Latency.GetPercentileSeconds(0.9) * 1000.0);
+    LatencyObj->SetNumberField(TEXT("p99_ms"), Latency.GetPercentileSeconds(0.99) * 1000.0);
+    LatencyObj->SetNumberField(TEXT("max_ms"), Latency.GetMaxSeconds() * 1000.0);
+    Status->SetObjectField(TEXT("latency"), LatencyObj);
+    return Status;
+}
@@ -2,6 +2,7 @@
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "Services/ObjectPoolManager.h"
 
 FString FMCPResponse::ToJsonString() const
 {
@@ -22,11 +23,11 @@ FString FMCPResponse::ToJsonString() const
         JsonObject->SetObjectField(TEXT("error"), ErrorObject);
     }
     
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FScopedPooledStringBuffer OutputBuffer;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputBuffer.Get());
     FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
     
-    return OutputString;
+    return OutputBuffer.Get();
 }
 
 FMCPResponse FMCPResponse::FromJsonString(const FString& JsonString)
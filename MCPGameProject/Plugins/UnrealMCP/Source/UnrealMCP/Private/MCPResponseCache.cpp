@@ -0,0 +1,230 @@
+#include "MCPResponseCache.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "Editor.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "MCPMemory.h"
+#include "UnrealMCPSettings.h"
+
+FMCPResponseCache::FMCPResponseCache()
+    : MaxCachedChars(static_cast<int64>(FMath::Max(1, UUnrealMCPSettings::Get()->ResponseCacheSizeMB)) * 1024 * 1024 / sizeof(TCHAR))
+    , CachedChars(0)
+    , Generation(1)
+{
+}
+
+FMCPResponseCache::~FMCPResponseCache()
+{
+    UnregisterInvalidationHandlers();
+}
+
+void FMCPResponseCache::RegisterInvalidationHandlers()
+{
+    if (ObjectModifiedHandle.IsValid())
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FMCPResponseCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FMCPResponseCache::HandleObjectPropertyChanged);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FMCPResponseCache::HandlePackageSaved);
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FMCPResponseCache::HandleObjectsReplaced);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FMCPResponseCache::Invalidate);
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FMCPResponseCache::HandleAssetChanged);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FMCPResponseCache::HandleAssetChanged);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FMCPResponseCache::HandleAssetRenamed);
+    }
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("response_cache"), TEXT("cache"),
+        [this](FMCPCacheStatsRegistry::FStats& OutStats)
+        {
+            FScopeLock ScopeLock(&Lock);
+            OutStats.Hits = CacheCounters.Hits.Load();
+            OutStats.Misses = CacheCounters.Misses.Load();
+            OutStats.Invalidations = CacheCounters.Invalidations.Load();
+            OutStats.Entries = Entries.Num();
+            OutStats.Details = MakeShared<FJsonObject>();
+            OutStats.Details->SetNumberField(TEXT("cached_chars"), static_cast<double>(CachedChars));
+            OutStats.Details->SetNumberField(TEXT("max_cached_chars"), static_cast<double>(MaxCachedChars));
+            OutStats.Details->SetNumberField(TEXT("generation"), static_cast<double>(Generation.Load()));
+        },
+        [this]() { CacheCounters.Reset(); });
+    FMCPCacheBudget::Get().Register(TEXT("response_cache"), *this);
+}
+
+void FMCPResponseCache::UnregisterInvalidationHandlers()
+{
+    if (!ObjectModifiedHandle.IsValid())
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    PackageSavedHandle.Reset();
+    ObjectsReplacedHandle.Reset();
+    UndoRedoHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("response_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("response_cache"));
+}
+
+void FMCPResponseCache::Invalidate()
+{
+    FScopeLock ScopeLock(&Lock);
+    ++Generation;
+    if (Entries.Num() > 0)
+    {
+        Entries.Reset();
+        CachedChars = 0;
+        ResetUsedBytes();
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+bool FMCPResponseCache::Find(const FString& Key, FString& OutResponse) const
+{
+    FScopeLock ScopeLock(&Lock);
+    const FEntry* Entry = Entries.Find(Key);
+    if (!Entry || Entry->Generation != Generation.Load())
+    {
+        CacheCounters.RecordMiss();
+        return false;
+    }
+    CacheCounters.RecordHit();
+    Entry->LastUse = FMCPCacheBudget::NextUse();
+    OutResponse = Entry->Response;
+    return true;
+}
+
+void FMCPResponseCache::Store(const FString& Key, const FString& Response, uint64 ResponseGeneration)
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    FScopeLock ScopeLock(&Lock);
+
+    // Editor state changed while the command ran, so the response may already be stale
+    if (ResponseGeneration != Generation.Load() || Response.Len() > MaxCachedChars)
+    {
+        return;
+    }
+
+    if (const FEntry* Existing = Entries.Find(Key))
+    {
+        CachedChars -= Existing->Response.Len();
+        RemoveMapEntry(Entries, Key);
+    }
+    if (CachedChars + Response.Len() > MaxCachedChars)
+    {
+        EvictDownToChars(MaxCachedChars - Response.Len());
+    }
+
+    const int64 Bytes = sizeof(FEntry) + Key.GetAllocatedSize() + Response.GetAllocatedSize();
+    Entries.Add(Key, FEntry{ Response, ResponseGeneration, FMCPCacheBudget::NextUse(), Bytes });
+    CachedChars += Response.Len();
+    AddUsedBytes(Bytes);
+}
+
+void FMCPResponseCache::EvictDownToChars(int64 MaxChars)
+{
+    TArray<TPair<uint64, FString>> ByLastUse;
+    ByLastUse.Reserve(Entries.Num());
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        ByLastUse.Emplace(Pair.Value.LastUse, Pair.Key);
+    }
+    ByLastUse.Sort([](const TPair<uint64, FString>& A, const TPair<uint64, FString>& B) { return A.Key < B.Key; });
+
+    for (int32 Index = 0; Index < ByLastUse.Num() && CachedChars > MaxChars; ++Index)
+    {
+        if (const FEntry* Evicted = Entries.Find(ByLastUse[Index].Value))
+        {
+            CachedChars -= Evicted->Response.Len();
+            RemoveMapEntry(Entries, ByLastUse[Index].Value);
+        }
+    }
+}
+
+void FMCPResponseCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    FScopeLock ScopeLock(&Lock);
+    GetMapUses(Entries, OutUses);
+}
+
+int64 FMCPResponseCache::EvictUsedBefore(uint64 Stamp)
+{
+    FScopeLock ScopeLock(&Lock);
+    int64 Freed = 0;
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().LastUse < Stamp)
+        {
+            CachedChars -= It.Value().Response.Len();
+            Freed += It.Value().Bytes;
+            It.RemoveCurrent();
+        }
+    }
+    AddUsedBytes(-Freed);
+    return Freed;
+}
+
+void FMCPResponseCache::InvalidateForObject(const UObject* Object)
+{
+    // Selection sets, transactions and other transient helpers change constantly and are never
+    // part of an asset's metadata
+    if (Object && (Object->HasAnyFlags(RF_Transient) || Object->GetOutermost() == GetTransientPackage()))
+    {
+        return;
+    }
+    Invalidate();
+}
+
+void FMCPResponseCache::HandleObjectModified(UObject* Object)
+{
+    InvalidateForObject(Object);
+}
+
+void FMCPResponseCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    InvalidateForObject(Object);
+}
+
+void FMCPResponseCache::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    Invalidate();
+}
+
+void FMCPResponseCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+    Invalidate();
+}
+
+void FMCPResponseCache::HandleAssetChanged(const FAssetData& AssetData)
+{
+    Invalidate();
+}
+
+void FMCPResponseCache::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    Invalidate();
+}
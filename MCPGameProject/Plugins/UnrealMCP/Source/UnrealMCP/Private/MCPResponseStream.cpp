@@ -0,0 +1,206 @@
+#include "MCPResponseStream.h"
+#include "MCPAttachments.h"
+#include "MCPMessageFraming.h"
+#include "MCPTransport.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Timespan.h"
+
+FMCPResponseStream::FMCPResponseStream(IMCPTransport& InTransport, EMCPFrameFormat InFormat, bool bInCompress, TArray<uint8>* InScratch)
+    : Transport(InTransport)
+    , Format(InFormat)
+    , bCompress(bInCompress)
+    , Scratch(InScratch ? *InScratch : OwnedScratch)
+    , BytesSent(0)
+{
+}
+
+bool FMCPResponseStream::SendMessage(const FString& Message)
+{
+    const TCHAR* Chars = *Message;
+    const int32 NumChars = Message.Len();
+
+    if (Format == EMCPFrameFormat::LengthPrefixed)
+    {
+        // The header needs the UTF-8 size up front; measuring it doesn't allocate
+        const int64 PayloadSize = FPlatformString::ConvertedLength<UTF8CHAR>(Chars, NumChars);
+
+        // Compression works on the whole payload, so large compressible responses give up slicing
+        if (ShouldCompress(PayloadSize))
+        {
+            FTCHARToUTF8 UTF8Message(Chars, NumChars);
+            return SendPayload(reinterpret_cast<const uint8*>(UTF8Message.Get()), UTF8Message.Length());
+        }
+
+        if (!SendHeader(PayloadSize))
+        {
+            return false;
+        }
+    }
+
+    return SendText(Chars, NumChars);
+}
+
+bool FMCPResponseStream::SendMessage(const FString& Message, TConstArrayView<FMCPAttachment> Attachments)
+{
+    const TCHAR* Chars = *Message;
+    const int32 NumChars = Message.Len();
+    const int64 MessageSize = FPlatformString::ConvertedLength<UTF8CHAR>(Chars, NumChars);
+    return SendAttachmentsFrame(MessageSize, [this, Chars, NumChars]() { return SendText(Chars, NumChars); }, Attachments);
+}
+
+bool FMCPResponseStream::SendPayload(const uint8* Payload, int32 NumBytes, TConstArrayView<FMCPAttachment> Attachments)
+{
+    return SendAttachmentsFrame(NumBytes, [this, Payload, NumBytes]() { return SendAll(Payload, NumBytes); }, Attachments);
+}
+
+bool FMCPResponseStream::SendAttachmentsFrame(int64 MessageSize, TFunctionRef<bool()> SendMessageBody, TConstArrayView<FMCPAttachment> Attachments)
+{
+    if (Format != EMCPFrameFormat::LengthPrefixed)
+    {
+        LastError = TEXT("Attachments need length-prefixed framing");
+        return false;
+    }
+
+    // [uint32 message size][message] then [uint8 id length][id][uint32 data size][data] per attachment
+    int64 BodySize = FMCPMessageFramer::HeaderSize + MessageSize;
+    for (const FMCPAttachment& Attachment : Attachments)
+    {
+        BodySize += 1 + FTCHARToUTF8(*Attachment.Id, Attachment.Id.Len()).Length() + FMCPMessageFramer::HeaderSize + Attachment.Data->Num();
+    }
+
+    uint8 SizeBytes[FMCPMessageFramer::HeaderSize];
+    FMCPMessageFramer::WriteHeader(static_cast<uint32>(MessageSize), false, SizeBytes);
+    if (!SendHeader(BodySize, FMCPMessageFramer::AttachmentsFlag) || !SendAll(SizeBytes, FMCPMessageFramer::HeaderSize) || !SendMessageBody())
+    {
+        return false;
+    }
+
+    for (const FMCPAttachment& Attachment : Attachments)
+    {
+        const TArray64<uint8>& Data = *Attachment.Data;
+        const FTCHARToUTF8 Id(*Attachment.Id, Attachment.Id.Len());
+        const uint8 IdLength = static_cast<uint8>(Id.Length());
+        FMCPMessageFramer::WriteHeader(static_cast<uint32>(Data.Num()), false, SizeBytes);
+        if (!SendAll(&IdLength, 1)
+            || !SendAll(reinterpret_cast<const uint8*>(Id.Get()), IdLength)
+            || !SendAll(SizeBytes, FMCPMessageFramer::HeaderSize)
+            || !SendAll(Data.GetData(), static_cast<int32>(Data.Num())))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FMCPResponseStream::SendText(const TCHAR* Chars, int32 NumChars)
+{
+    Scratch.SetNumUninitialized(SliceChars * 4, EAllowShrinking::No);
+
+    int32 Offset = 0;
+    while (Offset < NumChars)
+    {
+        int32 SliceLen = FMath::Min(SliceChars, NumChars - Offset);
+
+        // Never split a UTF-16 surrogate pair across slices
+        if (sizeof(TCHAR) == 2 && Offset + SliceLen < NumChars && SliceLen > 1)
+        {
+            const uint32 Last = static_cast<uint32>(Chars[Offset + SliceLen - 1]);
+            if (Last >= 0xD800 && Last <= 0xDBFF)
+            {
+                --SliceLen;
+            }
+        }
+
+        UTF8CHAR* Dest = reinterpret_cast<UTF8CHAR*>(Scratch.GetData());
+        UTF8CHAR* End = FPlatformString::Convert(Dest, Scratch.Num(), Chars + Offset, SliceLen);
+        if (!End)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCPResponseStream: Failed to convert response slice at character %d"), Offset);
+            return false;
+        }
+
+        if (!SendAll(Scratch.GetData(), static_cast<int32>(End - Dest)))
+        {
+            return false;
+        }
+        Offset += SliceLen;
+    }
+
+    return true;
+}
+
+bool FMCPResponseStream::SendPayload(const uint8* Payload, int32 NumBytes)
+{
+    if (ShouldCompress(NumBytes))
+    {
+        TArray<uint8> CompressedBody;
+        if (FMCPMessageFramer::CompressPayload(Payload, NumBytes, CompressedBody))
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("MCPResponseStream: Compressed %d byte payload to %d bytes"), NumBytes, CompressedBody.Num());
+            return SendHeader(CompressedBody.Num(), FMCPMessageFramer::CompressedFlag) && SendAll(CompressedBody.GetData(), CompressedBody.Num());
+        }
+    }
+
+    return SendHeader(NumBytes) && SendAll(Payload, NumBytes);
+}
+
+bool FMCPResponseStream::ShouldCompress(int64 PayloadSize) const
+{
+    return bCompress && Format == EMCPFrameFormat::LengthPrefixed && PayloadSize >= FMCPMessageFramer::CompressionThreshold;
+}
+
+bool FMCPResponseStream::SendHeader(int64 PayloadSize, uint32 Flags)
+{
+    if (Format != EMCPFrameFormat::LengthPrefixed)
+    {
+        return true;
+    }
+
+    if (PayloadSize > FMCPMessageFramer::MaxFrameSize)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCPResponseStream: Response of %lld bytes exceeds the %u byte frame limit"), PayloadSize, FMCPMessageFramer::MaxFrameSize);
+        return false;
+    }
+
+    uint8 Header[FMCPMessageFramer::HeaderSize];
+    FMCPMessageFramer::WriteHeaderWithFlags(static_cast<uint32>(PayloadSize), Flags, Header);
+    return SendAll(Header, FMCPMessageFramer::HeaderSize);
+}
+
+bool FMCPResponseStream::SendAll(const uint8* Data, int32 NumBytes)
+{
+    int32 Remaining = NumBytes;
+    double LastProgressTime = FPlatformTime::Seconds();
+
+    while (Remaining > 0)
+    {
+        int32 Sent = 0;
+        const EMCPIoResult Result = Transport.Send(Data, Remaining, Sent);
+        if (Result == EMCPIoResult::Ok)
+        {
+            Data += Sent;
+            Remaining -= Sent;
+            BytesSent += Sent;
+            LastProgressTime = FPlatformTime::Seconds();
+            continue;
+        }
+
+        if (Result != EMCPIoResult::WouldBlock)
+        {
+            LastError = Transport.GetLastErrorDescription();
+            return false;
+        }
+
+        // Send buffer is full - block until the client has drained some of it
+        const double Stalled = FPlatformTime::Seconds() - LastProgressTime;
+        if (Stalled > SendTimeoutSeconds)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCPResponseStream: Send made no progress for %.1f seconds, %d bytes unsent"), Stalled, Remaining);
+            LastError = TEXT("Send timed out");
+            return false;
+        }
+        Transport.WaitForWrite(FTimespan::FromSeconds(FMath::Min(SendTimeoutSeconds - Stalled, 1.0)));
+    }
+
+    return true;
+}
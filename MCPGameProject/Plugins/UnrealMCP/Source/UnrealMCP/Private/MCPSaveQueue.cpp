@@ -0,0 +1,132 @@
+#include "MCPSaveQueue.h"
+#include "EditorAssetLibrary.h"
+#include "EditorLoadingAndSavingUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "MCPBatchEditScope.h"
+#include "MCPLogging.h"
+#include "MCPTrace.h"
+#include "UObject/Package.h"
+
+static TAutoConsoleVariable<float> CVarMCPSaveFlushDelaySeconds(
+    TEXT("mcp.SaveFlushDelaySeconds"),
+    1.0f,
+    TEXT("Seconds after the last modification before packages saved by MCP commands are written; 0 saves immediately outside batches"),
+    ECVF_Default);
+
+FMCPSaveQueue& FMCPSaveQueue::Get()
+{
+    static FMCPSaveQueue Instance;
+    return Instance;
+}
+
+bool FMCPSaveQueue::Enqueue(UObject* Asset)
+{
+    if (!Asset || !IsInGameThread())
+    {
+        return false;
+    }
+    if (!FMCPBatchEditScope::IsActive() && CVarMCPSaveFlushDelaySeconds.GetValueOnGameThread() <= 0.0f)
+    {
+        return false;
+    }
+
+    UPackage* Package = Asset->GetOutermost();
+    if (!Package)
+    {
+        return false;
+    }
+
+    // SavePackages only writes dirty packages
+    Package->MarkPackageDirty();
+    Pending.AddUnique(Package);
+    LastEnqueueTime = FPlatformTime::Seconds();
+
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPSaveQueue::Tick), 0.1f);
+    }
+    return true;
+}
+
+bool FMCPSaveQueue::SaveOrEnqueue(UObject* Asset)
+{
+    if (Enqueue(Asset))
+    {
+        return true;
+    }
+    return Asset && UEditorAssetLibrary::SaveLoadedAsset(Asset, false);
+}
+
+int32 FMCPSaveQueue::Flush(TArray<FString>* OutFailedPackages)
+{
+    check(IsInGameThread());
+    MCP_TRACE_SCOPE("MCP::FlushSaves");
+
+    TArray<TWeakObjectPtr<UPackage>> Queued = MoveTemp(Pending);
+    Pending.Reset();
+
+    TArray<UPackage*> Packages;
+    Packages.Reserve(Queued.Num());
+    for (const TWeakObjectPtr<UPackage>& Package : Queued)
+    {
+        if (Package.IsValid())
+        {
+            Packages.Add(Package.Get());
+        }
+    }
+    if (Packages.Num() == 0)
+    {
+        return Queued.Num();
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Saving %d queued packages"), Packages.Num());
+    if (!UEditorLoadingAndSavingUtils::SavePackages(Packages, true))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("Not every queued package could be saved"));
+    }
+
+    // SavePackages reports only overall success; a package still dirty was not written
+    if (OutFailedPackages)
+    {
+        for (UPackage* Package : Packages)
+        {
+            if (Package->IsDirty())
+            {
+                OutFailedPackages->Add(Package->GetName());
+            }
+        }
+    }
+    return Queued.Num();
+}
+
+void FMCPSaveQueue::Shutdown()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // Queued saves are edits the client already saw succeed; do not drop them
+    if (Pending.Num() > 0)
+    {
+        Flush();
+    }
+}
+
+bool FMCPSaveQueue::Tick(float DeltaTime)
+{
+    // A batch scope flushes the queue itself when it closes
+    if (!FMCPBatchEditScope::IsActive()
+        && FPlatformTime::Seconds() - LastEnqueueTime >= CVarMCPSaveFlushDelaySeconds.GetValueOnGameThread())
+    {
+        Flush();
+    }
+
+    if (Pending.Num() == 0)
+    {
+        TickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
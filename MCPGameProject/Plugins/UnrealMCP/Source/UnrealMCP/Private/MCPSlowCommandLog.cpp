@@ -0,0 +1,356 @@
+#include "MCPSlowCommandLog.h"
+#include "MCPLogging.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformStackWalk.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+static TAutoConsoleVariable<int32> CVarMCPSlowCommandThresholdMs(
+    TEXT("mcp.SlowCommandThresholdMs"),
+    250,
+    TEXT("Commands running longer than this many milliseconds are written to Saved/UnrealMCP/SlowCommands. Read at startup; 0 disables the log."),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarMCPSlowCommandSampleIntervalMs(
+    TEXT("mcp.SlowCommandSampleIntervalMs"),
+    5,
+    TEXT("Interval in milliseconds at which the stacks of long-running MCP commands are sampled."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMCPSlowCommandLogMaxKB(
+    TEXT("mcp.SlowCommandLogMaxKB"),
+    4096,
+    TEXT("Size in KB at which the slow command log rolls over to a new file."),
+    ECVF_Default);
+
+namespace
+{
+    /** Parameters longer than this are cut in the log */
+    constexpr int32 MaxParamChars = 2048;
+
+    /** Most frequent stacks written per command */
+    constexpr int32 MaxStacksPerRecord = 5;
+
+    TArray<TSharedPtr<FJsonValue>> SymbolizeFrames(const TArray<uint64>& Frames)
+    {
+        TArray<TSharedPtr<FJsonValue>> FrameValues;
+        FrameValues.Reserve(Frames.Num());
+        for (const uint64 ProgramCounter : Frames)
+        {
+            FProgramCounterSymbolInfo SymbolInfo;
+            FPlatformStackWalk::ProgramCounterToSymbolInfo(ProgramCounter, SymbolInfo);
+
+            FString Frame = SymbolInfo.FunctionName[0] != 0
+                ? FString(ANSI_TO_TCHAR(SymbolInfo.FunctionName))
+                : FString::Printf(TEXT("0x%016llx"), ProgramCounter);
+            if (SymbolInfo.Filename[0] != 0)
+            {
+                Frame += FString::Printf(TEXT(" [%s:%d]"), *FPaths::GetCleanFilename(ANSI_TO_TCHAR(SymbolInfo.Filename)), SymbolInfo.LineNumber);
+            }
+            FrameValues.Add(MakeShared<FJsonValueString>(Frame));
+        }
+        return FrameValues;
+    }
+}
+
+FMCPSlowCommandLog& FMCPSlowCommandLog::Get()
+{
+    static FMCPSlowCommandLog Instance;
+    return Instance;
+}
+
+FString FMCPSlowCommandLog::GetLogDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("UnrealMCP") / TEXT("SlowCommands");
+}
+
+void FMCPSlowCommandLog::Initialize()
+{
+    if (Thread || CVarMCPSlowCommandThresholdMs.GetValueOnAnyThread() <= 0)
+    {
+        return;
+    }
+
+    // Symbols are resolved on the sampler thread; loading them there on first use would stall the first record
+    FPlatformStackWalk::InitStackWalking();
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    bRunning = true;
+    Thread = FRunnableThread::Create(this, TEXT("UnrealMCPSlowCommandSampler"), 0, TPri_AboveNormal);
+    if (!Thread)
+    {
+        bRunning = false;
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+        return;
+    }
+    UE_LOG(LogUnrealMCP, Display, TEXT("MCPSlowCommandLog: Recording commands slower than %d ms to %s"),
+        CVarMCPSlowCommandThresholdMs.GetValueOnAnyThread(), *GetLogDirectory());
+}
+
+void FMCPSlowCommandLog::Shutdown()
+{
+    if (!Thread)
+    {
+        return;
+    }
+
+    Stop();
+    Thread->WaitForCompletion();
+    delete Thread;
+    Thread = nullptr;
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+
+    FScopeLock ScopeLock(&Lock);
+    ActiveExecutions.Reset();
+}
+
+FMCPSlowCommandLog::FExecutionId FMCPSlowCommandLog::BeginExecution()
+{
+    if (!bRunning)
+    {
+        return 0;
+    }
+
+    bool bWasIdle = false;
+    FExecutionId ExecutionId = 0;
+    {
+        FScopeLock ScopeLock(&Lock);
+        bWasIdle = ActiveExecutions.Num() == 0;
+        ExecutionId = NextExecutionId++;
+        FActiveExecution& Execution = ActiveExecutions.Add(ExecutionId);
+        Execution.ThreadId = FPlatformTLS::GetCurrentThreadId();
+        Execution.StartCycles = FPlatformTime::Cycles64();
+    }
+
+    // The sampler sleeps while nothing runs
+    if (bWasIdle)
+    {
+        WakeEvent->Trigger();
+    }
+    return ExecutionId;
+}
+
+void FMCPSlowCommandLog::EndExecution(FExecutionId ExecutionId, const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+                                      const FTimings& Timings, bool bError)
+{
+    if (ExecutionId == 0)
+    {
+        return;
+    }
+
+    FActiveExecution Execution;
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (!ActiveExecutions.RemoveAndCopyValue(ExecutionId, Execution))
+        {
+            return;
+        }
+    }
+
+    const double ThresholdSeconds = CVarMCPSlowCommandThresholdMs.GetValueOnAnyThread() / 1000.0;
+    if (Timings.ExecuteSeconds + Timings.SerializeSeconds < ThresholdSeconds || !bRunning)
+    {
+        return;
+    }
+
+    FSlowCommandRecord Record;
+    Record.CommandType = CommandType;
+    Record.bError = bError;
+    Record.Timings = Timings;
+    Record.ThresholdSeconds = ThresholdSeconds;
+    Record.Timestamp = FDateTime::UtcNow();
+    Record.SampleCount = Execution.SampleCount;
+    Execution.Stacks.GenerateValueArray(Record.Stacks);
+
+    if (Params.IsValid())
+    {
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Record.Params);
+        FJsonSerializer::Serialize(Params.ToSharedRef(), Writer);
+        if (Record.Params.Len() > MaxParamChars)
+        {
+            Record.Params.LeftInline(MaxParamChars);
+            Record.bParamsTruncated = true;
+        }
+    }
+
+    UE_LOG(LogUnrealMCP, Warning, TEXT("MCPSlowCommandLog: %s took %.1f ms (queued %.1f ms, executed %.1f ms, serialized %.1f ms)"),
+        *CommandType, (Timings.QueueWaitSeconds + Timings.ExecuteSeconds + Timings.SerializeSeconds) * 1000.0,
+        Timings.QueueWaitSeconds * 1000.0, Timings.ExecuteSeconds * 1000.0, Timings.SerializeSeconds * 1000.0);
+
+    PendingRecords.Enqueue(MoveTemp(Record));
+    WakeEvent->Trigger();
+}
+
+uint32 FMCPSlowCommandLog::Run()
+{
+    while (bRunning)
+    {
+        bool bAnyActive = false;
+        {
+            FScopeLock ScopeLock(&Lock);
+            bAnyActive = ActiveExecutions.Num() > 0;
+        }
+
+        if (bAnyActive)
+        {
+            SampleActiveExecutions();
+        }
+        WritePendingRecords();
+
+        // Idle until a command starts; BeginExecution and EndExecution wake the thread
+        const int32 IntervalMs = FMath::Max(CVarMCPSlowCommandSampleIntervalMs.GetValueOnAnyThread(), 1);
+        WakeEvent->Wait(bAnyActive ? IntervalMs : MAX_uint32);
+    }
+
+    WritePendingRecords();
+    return 0;
+}
+
+void FMCPSlowCommandLog::Stop()
+{
+    bRunning = false;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
+
+void FMCPSlowCommandLog::SampleActiveExecutions()
+{
+    // Commands shorter than a quarter of the threshold never have their thread interrupted
+    const uint64 SampleAfterCycles = static_cast<uint64>(
+        CVarMCPSlowCommandThresholdMs.GetValueOnAnyThread() / 4000.0 / FPlatformTime::GetSecondsPerCycle64());
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+
+    TArray<TPair<FExecutionId, uint32>, TInlineAllocator<8>> ToSample;
+    {
+        FScopeLock ScopeLock(&Lock);
+        for (const TPair<FExecutionId, FActiveExecution>& Pair : ActiveExecutions)
+        {
+            if (NowCycles - Pair.Value.StartCycles >= SampleAfterCycles)
+            {
+                ToSample.Emplace(Pair.Key, Pair.Value.ThreadId);
+            }
+        }
+    }
+
+    for (const TPair<FExecutionId, uint32>& Entry : ToSample)
+    {
+        // Captured without holding the lock or allocating, since the target thread is suspended meanwhile
+        uint64 Frames[MaxStackDepth];
+        const int32 Depth = FPlatformStackWalk::CaptureThreadStackBackTrace(Entry.Value, Frames, MaxStackDepth);
+        if (Depth <= 0)
+        {
+            continue;
+        }
+
+        const uint32 Hash = FCrc::MemCrc32(Frames, Depth * sizeof(uint64));
+        FScopeLock ScopeLock(&Lock);
+        FActiveExecution* Execution = ActiveExecutions.Find(Entry.Key);
+        if (!Execution)
+        {
+            continue;
+        }
+        Execution->SampleCount++;
+        FStackSample& Stack = Execution->Stacks.FindOrAdd(Hash);
+        if (Stack.Count++ == 0)
+        {
+            Stack.Frames.Append(Frames, Depth);
+        }
+    }
+}
+
+void FMCPSlowCommandLog::WritePendingRecords()
+{
+    if (PendingRecords.IsEmpty())
+    {
+        return;
+    }
+
+    const FString LogDirectory = GetLogDirectory();
+    const FString LogPath = LogDirectory / TEXT("SlowCommands.jsonl");
+    IFileManager::Get().MakeDirectory(*LogDirectory, true);
+
+    FSlowCommandRecord Record;
+    while (PendingRecords.Dequeue(Record))
+    {
+        Record.Stacks.Sort([](const FStackSample& A, const FStackSample& B) { return A.Count > B.Count; });
+
+        TArray<TSharedPtr<FJsonValue>> StacksArray;
+        for (int32 Index = 0; Index < FMath::Min(Record.Stacks.Num(), MaxStacksPerRecord); ++Index)
+        {
+            const FStackSample& Stack = Record.Stacks[Index];
+            TSharedPtr<FJsonObject> StackObj = MakeShared<FJsonObject>();
+            StackObj->SetNumberField(TEXT("samples"), Stack.Count);
+            StackObj->SetNumberField(TEXT("fraction"), Record.SampleCount > 0 ? static_cast<double>(Stack.Count) / Record.SampleCount : 0.0);
+            StackObj->SetArrayField(TEXT("frames"), SymbolizeFrames(Stack.Frames));
+            StacksArray.Add(MakeShared<FJsonValueObject>(StackObj));
+        }
+
+        const FTimings& Timings = Record.Timings;
+        TSharedRef<FJsonObject> RecordObj = MakeShared<FJsonObject>();
+        RecordObj->SetStringField(TEXT("timestamp"), Record.Timestamp.ToIso8601());
+        RecordObj->SetStringField(TEXT("command"), Record.CommandType);
+        RecordObj->SetBoolField(TEXT("error"), Record.bError);
+        RecordObj->SetNumberField(TEXT("threshold_ms"), Record.ThresholdSeconds * 1000.0);
+        RecordObj->SetNumberField(TEXT("total_ms"), (Timings.QueueWaitSeconds + Timings.ExecuteSeconds + Timings.SerializeSeconds) * 1000.0);
+        RecordObj->SetNumberField(TEXT("queue_wait_ms"), Timings.QueueWaitSeconds * 1000.0);
+        RecordObj->SetNumberField(TEXT("execute_ms"), Timings.ExecuteSeconds * 1000.0);
+        RecordObj->SetNumberField(TEXT("serialize_ms"), Timings.SerializeSeconds * 1000.0);
+        RecordObj->SetStringField(TEXT("params"), Record.Params);
+        RecordObj->SetBoolField(TEXT("params_truncated"), Record.bParamsTruncated);
+        RecordObj->SetNumberField(TEXT("stack_samples"), Record.SampleCount);
+        RecordObj->SetArrayField(TEXT("stacks"), StacksArray);
+
+        FString Line;
+        FJsonSerializer::Serialize(RecordObj, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line));
+        Line += TEXT("\n");
+
+        const int64 MaxBytes = static_cast<int64>(FMath::Max(CVarMCPSlowCommandLogMaxKB.GetValueOnAnyThread(), 1)) * 1024;
+        if (IFileManager::Get().FileSize(*LogPath) >= MaxBytes)
+        {
+            RollFiles(LogPath);
+        }
+        if (!FFileHelper::SaveStringToFile(Line, *LogPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                &IFileManager::Get(), FILEWRITE_Append))
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCPSlowCommandLog: Failed to write %s"), *LogPath);
+        }
+    }
+}
+
+void FMCPSlowCommandLog::RollFiles(const FString& LogPath) const
+{
+    const FString BasePath = FPaths::GetBaseFilename(LogPath, false);
+    const FString Extension = FPaths::GetExtension(LogPath, true);
+    auto RolledPath = [&BasePath, &Extension](int32 Index)
+    {
+        return FString::Printf(TEXT("%s.%d%s"), *BasePath, Index, *Extension);
+    };
+
+    IFileManager& FileManager = IFileManager::Get();
+    FileManager.Delete(*RolledPath(MaxRolledFiles), false, true, true);
+    for (int32 Index = MaxRolledFiles - 1; Index >= 1; --Index)
+    {
+        const FString From = RolledPath(Index);
+        if (FileManager.FileExists(*From))
+        {
+            FileManager.Move(*RolledPath(Index + 1), *From, true, true);
+        }
+    }
+    FileManager.Move(*RolledPath(1), *LogPath, true, true);
+}
@@ -0,0 +1,210 @@
+#include "MCPStartupWarmup.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "MCPLogging.h"
+
+static TAutoConsoleVariable<bool> CVarMCPWarmupGate(
+    TEXT("mcp.WarmupGate"),
+    true,
+    TEXT("Answer MCP commands other than ping with a warming_up error until the asset registry has finished its initial scan"),
+    ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMCPWarmupStepIntervalSeconds(
+    TEXT("mcp.WarmupStepIntervalSeconds"),
+    0.1f,
+    TEXT("Seconds between the MCP startup pre-warm steps; one step runs per interval while no commands are waiting"),
+    ECVF_Default);
+
+FMCPStartupWarmup::FMCPStartupWarmup(TFunction<bool()> InCanRunStep)
+    : CanRunStep(MoveTemp(InCanRunStep))
+    , bAssetScanComplete(false)
+    , EstimatedRemainingMs(DefaultEstimateMs)
+    , AssetsProcessed(0)
+    , AssetsTotal(0)
+{
+}
+
+FMCPStartupWarmup::~FMCPStartupWarmup()
+{
+    Stop();
+}
+
+void FMCPStartupWarmup::AddStep(const FString& Name, bool bNeedsAssetScan, TFunction<void()> Run)
+{
+    check(IsInGameThread());
+    FStep& Step = Steps.AddDefaulted_GetRef();
+    Step.Name = Name;
+    Step.bNeedsAssetScan = bNeedsAssetScan;
+    Step.Run = MoveTemp(Run);
+}
+
+void FMCPStartupWarmup::Start()
+{
+    check(IsInGameThread());
+    if (TickerHandle.IsValid())
+    {
+        return;
+    }
+
+    StartTime = FPlatformTime::Seconds();
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (AssetRegistry && AssetRegistry->IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistry->OnFilesLoaded().AddRaw(this, &FMCPStartupWarmup::HandleFilesLoaded);
+        FileLoadProgressHandle = AssetRegistry->OnFileLoadProgressUpdated().AddRaw(this, &FMCPStartupWarmup::HandleFileLoadProgress);
+        UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Warming up until the asset registry scan completes"));
+    }
+    else
+    {
+        FinishAssetScan();
+    }
+
+    const float Interval = FMath::Max(0.0f, CVarMCPWarmupStepIntervalSeconds.GetValueOnGameThread());
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMCPStartupWarmup::Tick), Interval);
+}
+
+void FMCPStartupWarmup::Stop()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    if (FilesLoadedHandle.IsValid() || FileLoadProgressHandle.IsValid())
+    {
+        if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+        {
+            AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+            AssetRegistry->OnFileLoadProgressUpdated().Remove(FileLoadProgressHandle);
+        }
+        FilesLoadedHandle.Reset();
+        FileLoadProgressHandle.Reset();
+    }
+    Steps.Reset();
+    NextStep = 0;
+}
+
+bool FMCPStartupWarmup::IsWarmingUp() const
+{
+    return !bAssetScanComplete && CVarMCPWarmupGate.GetValueOnAnyThread();
+}
+
+int32 FMCPStartupWarmup::GetEstimatedRemainingMs() const
+{
+    return bAssetScanComplete ? 0 : EstimatedRemainingMs.Load();
+}
+
+TSharedRef<FJsonObject> FMCPStartupWarmup::MakeWarmingUpResponse() const
+{
+    const int32 EtaMs = GetEstimatedRemainingMs();
+    const int32 RetryAfterMs = FMath::Clamp(EtaMs, 250, MaxRetryAfterMs);
+
+    TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+    ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
+    ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Editor is warming up, the asset registry scan should complete in about %d ms"), EtaMs));
+    ResponseJson->SetBoolField(TEXT("warming_up"), true);
+    ResponseJson->SetNumberField(TEXT("eta_ms"), EtaMs);
+    ResponseJson->SetNumberField(TEXT("retry_after_ms"), RetryAfterMs);
+    ResponseJson->SetNumberField(TEXT("assets_processed"), AssetsProcessed.Load());
+    ResponseJson->SetNumberField(TEXT("assets_total"), AssetsTotal.Load());
+    return ResponseJson;
+}
+
+bool FMCPStartupWarmup::Tick(float DeltaTime)
+{
+    // Covers a scan that completed without this seeing the broadcast
+    if (!bAssetScanComplete)
+    {
+        IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+        if (!AssetRegistry || !AssetRegistry->IsLoadingAssets())
+        {
+            FinishAssetScan();
+        }
+    }
+
+    if (NextStep >= Steps.Num())
+    {
+        if (!bAssetScanComplete)
+        {
+            return true;
+        }
+        UE_LOG(LogUnrealMCP, Log, TEXT("UnrealMCPBridge: Warm-up complete after %.1f s"), FPlatformTime::Seconds() - StartTime);
+        Steps.Reset();
+        NextStep = 0;
+        TickerHandle.Reset();
+        return false;
+    }
+
+    FStep& Step = Steps[NextStep];
+    if ((Step.bNeedsAssetScan && !bAssetScanComplete) || (CanRunStep && !CanRunStep()))
+    {
+        return true;
+    }
+
+    const double StepStartTime = FPlatformTime::Seconds();
+    Step.Run();
+    UE_LOG(LogUnrealMCP, Log, TEXT("UnrealMCPBridge: Pre-warmed %s in %.1f ms"), *Step.Name, (FPlatformTime::Seconds() - StepStartTime) * 1000.0);
+    NextStep++;
+    return true;
+}
+
+void FMCPStartupWarmup::FinishAssetScan()
+{
+    if (bAssetScanComplete)
+    {
+        return;
+    }
+
+    bAssetScanComplete = true;
+    EstimatedRemainingMs = 0;
+    if (StartTime > 0.0 && (FilesLoadedHandle.IsValid() || FileLoadProgressHandle.IsValid()))
+    {
+        UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Asset registry scan complete after %.1f s, accepting commands"), FPlatformTime::Seconds() - StartTime);
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry->OnFileLoadProgressUpdated().Remove(FileLoadProgressHandle);
+    }
+    FilesLoadedHandle.Reset();
+    FileLoadProgressHandle.Reset();
+}
+
+void FMCPStartupWarmup::HandleFilesLoaded()
+{
+    FinishAssetScan();
+}
+
+void FMCPStartupWarmup::HandleFileLoadProgress(const FFileLoadProgressUpdateData& ProgressData)
+{
+    AssetsProcessed = ProgressData.NumAssetsProcessedByAssetRegistry;
+    AssetsTotal = ProgressData.NumTotalAssets;
+
+    // While files are still being discovered the total keeps growing, so no rate holds yet
+    const double Now = FPlatformTime::Seconds();
+    if (ProgressData.bIsDiscoveringAssetFiles || ProgressData.NumTotalAssets <= 0)
+    {
+        return;
+    }
+    if (FirstProgressProcessed == INDEX_NONE)
+    {
+        FirstProgressTime = Now;
+        FirstProgressProcessed = ProgressData.NumAssetsProcessedByAssetRegistry;
+        return;
+    }
+
+    const int32 ProcessedSinceFirst = ProgressData.NumAssetsProcessedByAssetRegistry - FirstProgressProcessed;
+    const double Elapsed = Now - FirstProgressTime;
+    if (ProcessedSinceFirst <= 0 || Elapsed <= 0.0)
+    {
+        return;
+    }
+
+    const int32 Remaining = FMath::Max(0, ProgressData.NumTotalAssets - ProgressData.NumAssetsProcessedByAssetRegistry);
+    const double RemainingSeconds = Remaining * Elapsed / ProcessedSinceFirst;
+    EstimatedRemainingMs = static_cast<int32>(FMath::Min(RemainingSeconds * 1000.0, static_cast<double>(MAX_int32 / 2)));
+}
@@ -0,0 +1,3 @@
+#include "MCPTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(UnrealMCPChannel)
@@ -0,0 +1,170 @@
+#include "MCPTransport.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "HAL/PlatformProcess.h"
+#include "UnrealMCPSettings.h"
+
+FMCPSocketTransport::FMCPSocketTransport(TSharedPtr<FSocket> InSocket)
+    : Socket(InSocket)
+    , LastError(0)
+{
+}
+
+FMCPSocketTransport::~FMCPSocketTransport()
+{
+    Close();
+}
+
+void FMCPSocketTransport::Configure()
+{
+    // Log client connection details
+    TSharedRef<FInternetAddr> ClientAddr = ISocketSubsystem::Get()->CreateInternetAddr();
+    if (Socket->GetPeerAddress(*ClientAddr))
+    {
+        UE_LOG(LogTemp, Display, TEXT("MCPSocketTransport: Client connected from: %s"), *ClientAddr->ToString(true));
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPSocketTransport: Could not get client address"));
+    }
+    
+    // Set socket options to improve connection stability
+    bool bNoDelayResult = Socket->SetNoDelay(true);
+    UE_LOG(LogTemp, Display, TEXT("MCPSocketTransport: SetNoDelay result: %s"), bNoDelayResult ? TEXT("Success") : TEXT("Failed"));
+
+    // Enable linger to ensure data is sent before socket close (wait up to 2 seconds)
+    bool bLingerResult = Socket->SetLinger(true, 2);
+    UE_LOG(LogTemp, Display, TEXT("MCPSocketTransport: SetLinger result: %s"), bLingerResult ? TEXT("Success") : TEXT("Failed"));
+    
+    const int32 SocketBufferSize = UUnrealMCPSettings::Get()->GetSocketBufferSize();
+    int32 ActualSendBufferSize = 0;
+    int32 ActualReceiveBufferSize = 0;
+    
+    bool bSendBufferResult = Socket->SetSendBufferSize(SocketBufferSize, ActualSendBufferSize);
+    bool bReceiveBufferResult = Socket->SetReceiveBufferSize(SocketBufferSize, ActualReceiveBufferSize);
+    
+    UE_LOG(LogTemp, Display, TEXT("MCPSocketTransport: Buffer setup - SendBuffer: %s (requested: %d, actual: %d), ReceiveBuffer: %s (requested: %d, actual: %d)"),
+           bSendBufferResult ? TEXT("Success") : TEXT("Failed"), SocketBufferSize, ActualSendBufferSize,
+           bReceiveBufferResult ? TEXT("Success") : TEXT("Failed"), SocketBufferSize, ActualReceiveBufferSize);
+    
+    // Set socket to NON-BLOCKING mode to prevent indefinite hangs
+    bool bNonBlockingResult = Socket->SetNonBlocking(true);
+    UE_LOG(LogTemp, Display, TEXT("MCPSocketTransport: SetNonBlocking(true) result: %s"), bNonBlockingResult ? TEXT("Success") : TEXT("Failed"));
+}
+
+bool FMCPSocketTransport::WaitForRead(const FTimespan& WaitTime)
+{
+    return Socket->Wait(ESocketWaitConditions::WaitForRead, WaitTime);
+}
+
+bool FMCPSocketTransport::WaitForWrite(const FTimespan& WaitTime)
+{
+    return Socket->Wait(ESocketWaitConditions::WaitForWrite, WaitTime);
+}
+
+EMCPIoResult FMCPSocketTransport::Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead)
+{
+    OutBytesRead = 0;
+    if (Socket->Recv(Data, BufferSize, OutBytesRead))
+    {
+        return OutBytesRead > 0 ? EMCPIoResult::Ok : EMCPIoResult::Closed;
+    }
+    return TranslateLastError();
+}
+
+EMCPIoResult FMCPSocketTransport::Send(const uint8* Data, int32 Count, int32& OutBytesSent)
+{
+    OutBytesSent = 0;
+    if (Socket->Send(Data, Count, OutBytesSent))
+    {
+        return OutBytesSent > 0 ? EMCPIoResult::Ok : EMCPIoResult::WouldBlock;
+    }
+    return TranslateLastError();
+}
+
+EMCPIoResult FMCPSocketTransport::TranslateLastError()
+{
+    const int32 Error = (int32)ISocketSubsystem::Get()->GetLastErrorCode();
+    
+    // "Would block" and interrupted calls aren't real errors for non-blocking sockets
+    if (Error == SE_EWOULDBLOCK || Error == SE_EINTR)
+    {
+        return EMCPIoResult::WouldBlock;
+    }
+    
+    LastError = Error;
+    return Error == 0 ? EMCPIoResult::Closed : EMCPIoResult::Error;
+}
+
+bool FMCPSocketTransport::IsConnectionLost()
+{
+    return Socket->GetConnectionState() == SCS_ConnectionError;
+}
+
+void FMCPSocketTransport::CloseGracefully()
+{
+    // Graceful shutdown: signal we're done sending, then wait briefly for client to receive
+    // This prevents RST being sent before data is ACKed on Windows
+    Socket->Shutdown(ESocketShutdownMode::Write);
+    FPlatformProcess::Sleep(0.05f); // 50ms for client to read buffered data
+    Socket->Close();
+}
+
+void FMCPSocketTransport::Close()
+{
+    if (Socket.IsValid())
+    {
+        Socket->Close();
+    }
+}
+
+FString FMCPSocketTransport::GetLastErrorDescription() const
+{
+    // Map common error codes to descriptions
+    switch (LastError)
+    {
+        case 0: return TEXT("Graceful disconnection (no error)");
+        case SE_ECONNRESET: return TEXT("Connection reset by peer");
+        case SE_ECONNABORTED: return TEXT("Connection aborted");
+        case SE_ENETDOWN: return TEXT("Network is down");
+        case SE_ENETUNREACH: return TEXT("Network unreachable");
+        case SE_ENOTCONN: return TEXT("Socket not connected");
+        case SE_ESHUTDOWN: return TEXT("Socket shutdown");
+        case SE_ETIMEDOUT: return TEXT("Connection timed out");
+        default: return FString::Printf(TEXT("Unknown error code %d"), LastError);
+    }
+}
+
+FString FMCPSocketTransport::GetPeerDescription() const
+{
+    TSharedRef<FInternetAddr> PeerAddr = ISocketSubsystem::Get()->CreateInternetAddr();
+    return Socket->GetPeerAddress(*PeerAddr) ? PeerAddr->ToString(true) : FString(TEXT("unknown TCP peer"));
+}
+
+FMCPSocketListener::FMCPSocketListener(TSharedPtr<FSocket> InListenerSocket)
+    : ListenerSocket(InListenerSocket)
+{
+}
+
+FMCPTransportPtr FMCPSocketListener::WaitAndAccept(const FTimespan& WaitTime)
+{
+    // Block until a client connects instead of sleeping between polls
+    bool bPending = false;
+    if (!ListenerSocket->WaitForPendingConnection(bPending, WaitTime) || !bPending)
+    {
+        return nullptr;
+    }
+    
+    TSharedPtr<FSocket> ClientSocket = MakeShareable(ListenerSocket->Accept(TEXT("MCPClient")));
+    if (!ClientSocket.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCPSocketListener: Failed to accept client connection"));
+        return nullptr;
+    }
+    return MakeShared<FMCPSocketTransport, ESPMode::ThreadSafe>(ClientSocket);
+}
+
+FString FMCPSocketListener::GetDescription() const
+{
+    return FString::Printf(TEXT("TCP port %d"), ListenerSocket.IsValid() ? ListenerSocket->GetPortNo() : 0);
+}
@@ -0,0 +1,281 @@
+#include "MCPViewportCapture.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+#include "RHIGPUReadback.h"
+#include "UnrealClient.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include <atomic>
+
+namespace
+{
+    /** Seconds to wait for the GPU copy before giving up */
+    constexpr double ReadbackTimeoutSeconds = 10.0;
+
+    /** Shared by the game-thread ticker, the render commands and the encoding worker */
+    struct FCaptureState
+    {
+        TUniquePtr<FRHIGPUTextureReadback> Readback;
+
+        /** Viewport pixels to read back; Size is the region's size */
+        FIntRect Region;
+        FIntPoint Size = FIntPoint::ZeroValue;
+        FString FilePath;
+        FMCPImageEncodeOptions Options;
+        FMCPViewportCapture::FOnCaptured OnCaptured;
+        double StartTime = 0.0;
+
+        /** Set on the render thread once the copy is enqueued, or the error if it could not be */
+        EPixelFormat Format = PF_Unknown;
+        FString CopyError;
+        std::atomic<bool> bCopyEnqueued{ false };
+
+        std::atomic<bool> bPollInFlight{ false };
+        std::atomic<bool> bFinished{ false };
+
+        void Fail(const FString& Error)
+        {
+            FMCPViewportCaptureResult Result;
+            Result.Error = Error;
+            Result.FilePath = FilePath;
+            Result.Size = Size;
+            OnCaptured(Result);
+        }
+    };
+
+    /** Convert mapped readback rows to opaque 8-bit colors */
+    bool ConvertPixels(const uint8* Data, int32 RowPitchInPixels, EPixelFormat Format, const FIntPoint& Size, TArray<FColor>& OutPixels)
+    {
+        OutPixels.SetNumUninitialized(Size.X * Size.Y);
+        for (int32 Y = 0; Y < Size.Y; ++Y)
+        {
+            FColor* OutRow = OutPixels.GetData() + Y * Size.X;
+            switch (Format)
+            {
+            case PF_B8G8R8A8:
+                FMemory::Memcpy(OutRow, Data + int64(Y) * RowPitchInPixels * sizeof(FColor), Size.X * sizeof(FColor));
+                break;
+            case PF_R8G8B8A8:
+            {
+                const uint8* Row = Data + int64(Y) * RowPitchInPixels * 4;
+                for (int32 X = 0; X < Size.X; ++X)
+                {
+                    OutRow[X] = FColor(Row[X * 4 + 0], Row[X * 4 + 1], Row[X * 4 + 2], 255);
+                }
+                break;
+            }
+            case PF_A2B10G10R10:
+            {
+                const uint32* Row = reinterpret_cast<const uint32*>(Data) + int64(Y) * RowPitchInPixels;
+                for (int32 X = 0; X < Size.X; ++X)
+                {
+                    const uint32 Packed = Row[X];
+                    OutRow[X] = FColor((Packed & 0x3FF) >> 2, ((Packed >> 10) & 0x3FF) >> 2, ((Packed >> 20) & 0x3FF) >> 2, 255);
+                }
+                break;
+            }
+            case PF_FloatRGBA:
+            {
+                const FFloat16Color* Row = reinterpret_cast<const FFloat16Color*>(Data) + int64(Y) * RowPitchInPixels;
+                for (int32 X = 0; X < Size.X; ++X)
+                {
+                    OutRow[X] = FLinearColor(Row[X]).ToFColor(true);
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Map the finished readback; render thread */
+    void FinishReadback(const TSharedRef<FCaptureState>& State)
+    {
+        int32 RowPitchInPixels = 0;
+        const uint8* Data = static_cast<const uint8*>(State->Readback->Lock(RowPitchInPixels));
+        TArray<FColor> Pixels;
+        const bool bConverted = Data && ConvertPixels(Data, RowPitchInPixels, State->Format, State->Size, Pixels);
+        State->Readback->Unlock();
+
+        if (!bConverted)
+        {
+            State->Fail(FString::Printf(TEXT("Unsupported render target pixel format: %s"), GetPixelFormatString(State->Format)));
+            return;
+        }
+
+        // Scaling and compression take far longer than the copy; keep them off the render thread
+        Async(EAsyncExecution::ThreadPool, [State, Pixels = MoveTemp(Pixels)]() mutable
+        {
+            State->OnCaptured(FMCPViewportCapture::SaveImage(Pixels, State->Size, State->FilePath, State->Options));
+        });
+    }
+
+    /** Per-frame poll of a pending readback; game thread */
+    bool TickCapture(const TSharedRef<FCaptureState>& State)
+    {
+        if (State->bFinished || State->bPollInFlight)
+        {
+            return !State->bFinished;
+        }
+
+        if (FPlatformTime::Seconds() - State->StartTime > ReadbackTimeoutSeconds)
+        {
+            State->bFinished = true;
+            State->Fail(TEXT("Timed out waiting for the GPU readback"));
+            return false;
+        }
+
+        State->bPollInFlight = true;
+        ENQUEUE_RENDER_COMMAND(MCPPollViewportReadback)([State](FRHICommandListImmediate& RHICmdList)
+        {
+            if (!State->bCopyEnqueued)
+            {
+                State->bFinished = true;
+                State->Fail(State->CopyError);
+            }
+            else if (State->Readback->IsReady())
+            {
+                State->bFinished = true;
+                FinishReadback(State);
+            }
+            State->bPollInFlight = false;
+        });
+        return true;
+    }
+
+    /** Source texture of a capture; called on the render thread, returns null if there is none */
+    using FResolveTexture = TFunction<FRHITexture*()>;
+
+    /** Read back the region of a source and hand it to a worker for encoding; game thread */
+    void StartCapture(const TSharedRef<FCaptureState>& State, const FIntPoint& SourceSize, FResolveTexture ResolveTexture)
+    {
+        if (SourceSize.X <= 0 || SourceSize.Y <= 0)
+        {
+            State->Fail(TEXT("Invalid capture size"));
+            return;
+        }
+        FString RegionError;
+        if (!FMCPImageEncoding::ResolveRegion(State->Options.Region, SourceSize, State->Region, RegionError))
+        {
+            State->Fail(RegionError);
+            return;
+        }
+        State->Size = State->Region.Size();
+
+        // Workers must not be the first to load the module
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+        State->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("MCPViewportCapture"));
+        ENQUEUE_RENDER_COMMAND(MCPCopyToReadback)([State, ResolveTexture = MoveTemp(ResolveTexture)](FRHICommandListImmediate& RHICmdList)
+        {
+            FRHITexture* Texture = ResolveTexture();
+            if (!Texture)
+            {
+                State->CopyError = TEXT("No render target to read back");
+                return;
+            }
+
+            State->Format = Texture->GetFormat();
+            State->Readback->EnqueueCopy(RHICmdList, Texture, FIntVector(State->Region.Min.X, State->Region.Min.Y, 0), 0, FIntVector(State->Size.X, State->Size.Y, 1));
+            State->bCopyEnqueued = true;
+        });
+
+        FTSTicker::GetCoreTicker().AddTicker(TEXT("MCPViewportCapture"), 0.0f, [State](float)
+        {
+            return TickCapture(State);
+        });
+    }
+
+    TSharedRef<FCaptureState> MakeCaptureState(const FString& FilePath, const FMCPImageEncodeOptions& Options, FMCPViewportCapture::FOnCaptured OnCaptured)
+    {
+        TSharedRef<FCaptureState> State = MakeShared<FCaptureState>();
+        State->FilePath = FilePath;
+        State->Options = Options;
+        State->OnCaptured = MoveTemp(OnCaptured);
+        State->StartTime = FPlatformTime::Seconds();
+        return State;
+    }
+}
+
+void FMCPViewportCapture::CaptureToFile(FViewport* Viewport, const FString& FilePath, const FMCPImageEncodeOptions& Options, FOnCaptured OnCaptured)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FCaptureState> State = MakeCaptureState(FilePath, Options, MoveTemp(OnCaptured));
+    StartCapture(State, Viewport ? Viewport->GetSizeXY() : FIntPoint::ZeroValue, [Viewport]() -> FRHITexture*
+    {
+        FRHITexture* Texture = Viewport->GetRenderTargetTexture();
+        if (!Texture && Viewport->GetViewportRHI())
+        {
+            Texture = RHIGetViewportBackBuffer(Viewport->GetViewportRHI());
+        }
+        return Texture;
+    });
+}
+
+void FMCPViewportCapture::CaptureRenderTarget(UTextureRenderTarget2D* RenderTarget, const FMCPImageEncodeOptions& Options, FOnCaptured OnCaptured)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FCaptureState> State = MakeCaptureState(FString(), Options, MoveTemp(OnCaptured));
+    FTextureRenderTargetResource* Resource = RenderTarget ? RenderTarget->GameThread_GetRenderTargetResource() : nullptr;
+    StartCapture(State, Resource ? FIntPoint(RenderTarget->SizeX, RenderTarget->SizeY) : FIntPoint::ZeroValue, [Resource]() -> FRHITexture*
+    {
+        return Resource->GetRenderTargetTexture();
+    });
+}
+
+FMCPViewportCaptureResult FMCPViewportCapture::CaptureToFileBlocking(FViewport* Viewport, const FString& FilePath, const FMCPImageEncodeOptions& Options)
+{
+    check(IsInGameThread());
+
+    FMCPViewportCaptureResult Result;
+    Result.FilePath = FilePath;
+    const FIntPoint ViewportSize = Viewport ? Viewport->GetSizeXY() : FIntPoint::ZeroValue;
+    if (ViewportSize.X <= 0 || ViewportSize.Y <= 0)
+    {
+        Result.Error = TEXT("Invalid viewport size");
+        return Result;
+    }
+    FIntRect Region;
+    if (!FMCPImageEncoding::ResolveRegion(Options.Region, ViewportSize, Region, Result.Error))
+    {
+        return Result;
+    }
+
+    // Handles the render target details, at the cost of a rendering flush
+    TArray<FColor> Pixels;
+    if (!GetViewportScreenShot(Viewport, Pixels, Region))
+    {
+        Result.Error = TEXT("Failed to capture viewport screenshot");
+        return Result;
+    }
+    return SaveImage(Pixels, Region.Size(), FilePath, Options);
+}
+
+FMCPViewportCaptureResult FMCPViewportCapture::SaveImage(TArray<FColor>& Pixels, const FIntPoint& Size, const FString& FilePath, const FMCPImageEncodeOptions& Options)
+{
+    FMCPViewportCaptureResult Result;
+    Result.FilePath = FilePath;
+    Result.Size = Size;
+
+    FMCPImageEncoding::Resize(Pixels, Result.Size, FMCPImageEncoding::GetScaledSize(Size, Options.Scale));
+    if (!FMCPImageEncoding::Encode(Pixels, Result.Size, Options, Result.EncodedData, Result.Error))
+    {
+        return Result;
+    }
+
+    if (!FilePath.IsEmpty() && !FFileHelper::SaveArrayToFile(Result.EncodedData, *FilePath))
+    {
+        Result.Error = FString::Printf(TEXT("Failed to save screenshot to: %s"), *FilePath);
+        return Result;
+    }
+
+    Result.bSuccess = true;
+    return Result;
+}
@@ -0,0 +1,646 @@
+#include "Services/ActorIndex.h"
+#include "Editor.h"
+#include "ConvexVolume.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Number of cells in an inclusive cell range */
+    int64 CountCells(const FIntVector& Min, const FIntVector& Max)
+    {
+        return int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1) * int64(Max.Z - Min.Z + 1);
+    }
+}
+
+FActorIndex& FActorIndex::Get()
+{
+    static FActorIndex Instance;
+    return Instance;
+}
+
+void FActorIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (!GEngine || ActorAddedHandle.IsValid())
+    {
+        return;
+    }
+
+    ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FActorIndex::HandleActorAdded);
+    ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &FActorIndex::HandleActorDeleted);
+    ActorLabelChangedHandle = FCoreDelegates::OnActorLabelChanged.AddRaw(this, &FActorIndex::HandleActorLabelChanged);
+    ActorMovedHandle = GEngine->OnActorMoved().AddRaw(this, &FActorIndex::HandleActorMoved);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FActorIndex::HandleObjectPropertyChanged);
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FActorIndex::HandleObjectsReplaced);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FActorIndex::HandleUndoRedo);
+    WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FActorIndex::HandleWorldCleanup);
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("actor_index"), TEXT("index"), CacheCounters, [this]()
+    {
+        int64 Count = 0;
+        for (const TPair<TWeakObjectPtr<UWorld>, FWorldIndex>& Entry : WorldIndices)
+        {
+            Count += Entry.Value.Actors.Num();
+        }
+        return Count;
+    });
+}
+
+void FActorIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (ActorAddedHandle.IsValid())
+    {
+        if (GEngine)
+        {
+            GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+            GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+            GEngine->OnActorMoved().Remove(ActorMovedHandle);
+        }
+        FCoreDelegates::OnActorLabelChanged.Remove(ActorLabelChangedHandle);
+        FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+        FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+        FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+        FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+
+        ActorAddedHandle.Reset();
+        ActorDeletedHandle.Reset();
+        ActorLabelChangedHandle.Reset();
+        ActorMovedHandle.Reset();
+        ObjectPropertyChangedHandle.Reset();
+        ObjectsReplacedHandle.Reset();
+        UndoRedoHandle.Reset();
+        WorldCleanupHandle.Reset();
+        FMCPCacheStatsRegistry::Get().Unregister(TEXT("actor_index"));
+    }
+    WorldIndices.Empty();
+}
+
+AActor* FActorIndex::FindActorByName(UWorld* World, const FString& ActorName) const
+{
+    check(IsInGameThread());
+    if (!World || ActorName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    // A name that was never made into an FName cannot name an actor
+    const FName Name(*ActorName, FNAME_Find);
+    if (Name.IsNone())
+    {
+        return nullptr;
+    }
+
+    for (ULevel* Level : World->GetLevels())
+    {
+        if (!Level)
+        {
+            continue;
+        }
+        AActor* Actor = FindObjectFast<AActor>(Level, Name);
+        if (IsLiveActor(Actor))
+        {
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+AActor* FActorIndex::FindActorByLabel(UWorld* World, const FString& ActorLabel)
+{
+    check(IsInGameThread());
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    const FWorldIndex& Index = GetWorldIndex(World);
+    if (const TArray<TWeakObjectPtr<AActor>>* Actors = Index.ActorsByLabel.Find(ActorLabel.ToLower()))
+    {
+        for (const TWeakObjectPtr<AActor>& Actor : *Actors)
+        {
+            if (IsLiveActor(Actor.Get()) && Actor->GetActorLabel() == ActorLabel)
+            {
+                return Actor.Get();
+            }
+        }
+    }
+    return nullptr;
+}
+
+void FActorIndex::FindActorsOfClass(UWorld* World, const UClass* ActorClass, TArray<AActor*>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || !ActorClass)
+    {
+        return;
+    }
+
+    const FWorldIndex& Index = GetWorldIndex(World);
+    for (const TPair<const UClass*, TArray<TWeakObjectPtr<AActor>>>& Entry : Index.ActorsByClass)
+    {
+        if (!Entry.Key->IsChildOf(ActorClass))
+        {
+            continue;
+        }
+        for (const TWeakObjectPtr<AActor>& Actor : Entry.Value)
+        {
+            if (IsLiveActor(Actor.Get()))
+            {
+                OutActors.Add(Actor.Get());
+            }
+        }
+    }
+}
+
+void FActorIndex::FindActorsWithTag(UWorld* World, FName Tag, TArray<AActor*>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || Tag.IsNone())
+    {
+        return;
+    }
+
+    const FWorldIndex& Index = GetWorldIndex(World);
+    if (const TArray<TWeakObjectPtr<AActor>>* Actors = Index.ActorsByTag.Find(Tag))
+    {
+        for (const TWeakObjectPtr<AActor>& Actor : *Actors)
+        {
+            if (IsLiveActor(Actor.Get()) && Actor->ActorHasTag(Tag))
+            {
+                OutActors.Add(Actor.Get());
+            }
+        }
+    }
+}
+
+void FActorIndex::FindActorsInBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || !Box.IsValid)
+    {
+        return;
+    }
+
+    TArray<TPair<AActor*, FBox>> Matches;
+    QueryRegion(World, Box, [&Box](const FBox& Bounds) { return Bounds.Intersect(Box); }, Matches);
+    for (const TPair<AActor*, FBox>& Match : Matches)
+    {
+        OutActors.Add(Match.Key);
+    }
+}
+
+void FActorIndex::FindActorsInSphere(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || Radius < 0.0)
+    {
+        return;
+    }
+
+    const double RadiusSquared = Radius * Radius;
+    TArray<TPair<AActor*, FBox>> Matches;
+    QueryRegion(World, FBox(Center - FVector(Radius), Center + FVector(Radius)),
+        [&Center, RadiusSquared](const FBox& Bounds) { return FMath::SphereAABBIntersection(Center, RadiusSquared, Bounds); }, Matches);
+    for (const TPair<AActor*, FBox>& Match : Matches)
+    {
+        OutActors.Add(Match.Key);
+    }
+}
+
+void FActorIndex::FindActorsInVolume(UWorld* World, const FConvexVolume& Volume, const FBox& VolumeBounds, TArray<AActor*>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || !VolumeBounds.IsValid)
+    {
+        return;
+    }
+
+    TArray<TPair<AActor*, FBox>> Matches;
+    QueryRegion(World, VolumeBounds,
+        [&Volume](const FBox& Bounds) { return Volume.IntersectBox(Bounds.GetCenter(), Bounds.GetExtent()); }, Matches);
+    for (const TPair<AActor*, FBox>& Match : Matches)
+    {
+        OutActors.Add(Match.Key);
+    }
+}
+
+void FActorIndex::FindNearestActors(UWorld* World, const FVector& Point, int32 Count, double MaxDistance, TArray<TPair<AActor*, double>>& OutActors)
+{
+    check(IsInGameThread());
+    if (!World || Count <= 0)
+    {
+        return;
+    }
+
+    const FSpatialIndex& Spatial = GetSpatialIndex(World);
+    if (!Spatial.Extent.IsValid)
+    {
+        return;
+    }
+
+    // Beyond this radius the sphere holds every indexed bounds
+    const double ExtentLimit = FMath::Sqrt(Spatial.Extent.ComputeSquaredDistanceToPoint(Point)) + Spatial.Extent.GetSize().Size();
+    const double Limit = MaxDistance > 0.0 ? FMath::Min(MaxDistance, ExtentLimit) : ExtentLimit;
+
+    // Grow the search sphere until it holds Count actors: nothing outside it can be closer
+    TArray<TPair<AActor*, FBox>> Matches;
+    for (double Radius = SpatialCellSize; ; Radius *= 2.0)
+    {
+        const double SearchRadius = FMath::Min(Radius, Limit);
+        const double RadiusSquared = SearchRadius * SearchRadius;
+        Matches.Reset();
+        QueryRegion(World, FBox(Point - FVector(SearchRadius), Point + FVector(SearchRadius)),
+            [&Point, RadiusSquared](const FBox& Bounds) { return Bounds.ComputeSquaredDistanceToPoint(Point) <= RadiusSquared; }, Matches);
+        if (Matches.Num() >= Count || SearchRadius >= Limit)
+        {
+            break;
+        }
+    }
+
+    TArray<TPair<AActor*, double>> Sorted;
+    Sorted.Reserve(Matches.Num());
+    for (const TPair<AActor*, FBox>& Match : Matches)
+    {
+        Sorted.Emplace(Match.Key, FMath::Sqrt(Match.Value.ComputeSquaredDistanceToPoint(Point)));
+    }
+
+    // Actors containing the point are all at distance 0; the nearer pivot goes first
+    Sorted.Sort([&Point](const TPair<AActor*, double>& A, const TPair<AActor*, double>& B)
+    {
+        if (A.Value != B.Value)
+        {
+            return A.Value < B.Value;
+        }
+        return FVector::DistSquared(A.Key->GetActorLocation(), Point) < FVector::DistSquared(B.Key->GetActorLocation(), Point);
+    });
+    if (Sorted.Num() > Count)
+    {
+        Sorted.SetNum(Count);
+    }
+    OutActors.Append(MoveTemp(Sorted));
+}
+
+FActorIndex::FWorldIndex& FActorIndex::GetWorldIndex(UWorld* World)
+{
+    FWorldIndex* Index = WorldIndices.Find(World);
+    const int32 ActorSlotCount = CountActorSlots(World);
+    if (Index && Index->ActorSlotCount == ActorSlotCount)
+    {
+        CacheCounters.RecordHit();
+        return *Index;
+    }
+    CacheCounters.RecordMiss();
+
+    // Missing, or the levels changed behind the notifications' back
+    Index = &WorldIndices.Add(World);
+    for (ULevel* Level : World->GetLevels())
+    {
+        if (!Level)
+        {
+            continue;
+        }
+        for (AActor* Actor : Level->Actors)
+        {
+            if (IsLiveActor(Actor))
+            {
+                AddActor(*Index, Actor);
+            }
+        }
+    }
+    Index->ActorSlotCount = ActorSlotCount;
+    return *Index;
+}
+
+int32 FActorIndex::CountActorSlots(UWorld* World)
+{
+    int32 Count = 0;
+    for (ULevel* Level : World->GetLevels())
+    {
+        if (Level)
+        {
+            Count += Level->Actors.Num();
+        }
+    }
+    return Count;
+}
+
+FActorIndex::FSpatialIndex& FActorIndex::GetSpatialIndex(UWorld* World)
+{
+    FWorldIndex& Index = GetWorldIndex(World);
+    if (!Index.Spatial.bBuilt)
+    {
+        Index.Spatial.bBuilt = true;
+        for (const TPair<TWeakObjectPtr<AActor>, FIndexedActor>& Entry : Index.Actors)
+        {
+            if (IsLiveActor(Entry.Key.Get()))
+            {
+                AddActorBounds(Index.Spatial, Entry.Key.Get());
+            }
+        }
+    }
+    return Index.Spatial;
+}
+
+FBox FActorIndex::GetActorSpatialBounds(const AActor* Actor)
+{
+    const FBox Bounds = Actor->GetComponentsBoundingBox(true);
+    if (Bounds.IsValid)
+    {
+        return Bounds;
+    }
+    const FVector Location = Actor->GetActorLocation();
+    return FBox(Location, Location);
+}
+
+void FActorIndex::GetCellRange(const FBox& Box, FIntVector& OutMin, FIntVector& OutMax)
+{
+    // Clamped so that stray far-away bounds cannot overflow the cell coordinates
+    constexpr double MaxCellCoordinate = 1 << 20;
+    auto ToCell = [](double Coordinate)
+    {
+        return static_cast<int32>(FMath::Clamp(FMath::FloorToDouble(Coordinate / SpatialCellSize), -MaxCellCoordinate, MaxCellCoordinate));
+    };
+    OutMin = FIntVector(ToCell(Box.Min.X), ToCell(Box.Min.Y), ToCell(Box.Min.Z));
+    OutMax = FIntVector(ToCell(Box.Max.X), ToCell(Box.Max.Y), ToCell(Box.Max.Z));
+}
+
+void FActorIndex::AddActorBounds(FSpatialIndex& Spatial, AActor* Actor)
+{
+    const FBox Bounds = GetActorSpatialBounds(Actor);
+    const TWeakObjectPtr<AActor> ActorPtr(Actor);
+    Spatial.Bounds.Add(ActorPtr, Bounds);
+    Spatial.Extent += Bounds;
+
+    FIntVector Min, Max;
+    GetCellRange(Bounds, Min, Max);
+    if (CountCells(Min, Max) > MaxCellsPerActor)
+    {
+        Spatial.Oversized.Add(ActorPtr);
+        return;
+    }
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+            {
+                Spatial.Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(ActorPtr);
+            }
+        }
+    }
+}
+
+void FActorIndex::RemoveActorBounds(FSpatialIndex& Spatial, AActor* Actor)
+{
+    const TWeakObjectPtr<AActor> ActorPtr(Actor);
+    FBox Bounds;
+    if (!Spatial.Bounds.RemoveAndCopyValue(ActorPtr, Bounds))
+    {
+        return;
+    }
+
+    FIntVector Min, Max;
+    GetCellRange(Bounds, Min, Max);
+    if (CountCells(Min, Max) > MaxCellsPerActor)
+    {
+        Spatial.Oversized.RemoveSingleSwap(ActorPtr);
+        return;
+    }
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+            {
+                const FIntVector Cell(X, Y, Z);
+                if (TArray<TWeakObjectPtr<AActor>>* Actors = Spatial.Cells.Find(Cell))
+                {
+                    Actors->RemoveSingleSwap(ActorPtr);
+                    if (Actors->Num() == 0)
+                    {
+                        Spatial.Cells.Remove(Cell);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void FActorIndex::QueryRegion(UWorld* World, const FBox& Region, TFunctionRef<bool(const FBox&)> Overlaps, TArray<TPair<AActor*, FBox>>& OutMatches)
+{
+    const FSpatialIndex& Spatial = GetSpatialIndex(World);
+
+    // An actor spanning several cells is met once per cell
+    TSet<AActor*> Visited;
+    auto Visit = [&](const TWeakObjectPtr<AActor>& ActorPtr)
+    {
+        AActor* Actor = ActorPtr.Get();
+        bool bAlreadyVisited = false;
+        Visited.Add(Actor, &bAlreadyVisited);
+        if (bAlreadyVisited || !IsLiveActor(Actor))
+        {
+            return;
+        }
+        // Bounds are measured again, so an actor that moved since it was indexed is judged where it is
+        const FBox Bounds = GetActorSpatialBounds(Actor);
+        if (Overlaps(Bounds))
+        {
+            OutMatches.Emplace(Actor, Bounds);
+        }
+    };
+
+    for (const TWeakObjectPtr<AActor>& ActorPtr : Spatial.Oversized)
+    {
+        Visit(ActorPtr);
+    }
+
+    FIntVector Min, Max;
+    GetCellRange(Region, Min, Max);
+    if (CountCells(Min, Max) > Spatial.Cells.Num())
+    {
+        // A region larger than the occupied cells is cheaper to answer from the occupied cells
+        for (const TPair<FIntVector, TArray<TWeakObjectPtr<AActor>>>& Cell : Spatial.Cells)
+        {
+            const FIntVector& Key = Cell.Key;
+            if (Key.X >= Min.X && Key.X <= Max.X && Key.Y >= Min.Y && Key.Y <= Max.Y && Key.Z >= Min.Z && Key.Z <= Max.Z)
+            {
+                for (const TWeakObjectPtr<AActor>& ActorPtr : Cell.Value)
+                {
+                    Visit(ActorPtr);
+                }
+            }
+        }
+        return;
+    }
+
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+            {
+                if (const TArray<TWeakObjectPtr<AActor>>* Actors = Spatial.Cells.Find(FIntVector(X, Y, Z)))
+                {
+                    for (const TWeakObjectPtr<AActor>& ActorPtr : *Actors)
+                    {
+                        Visit(ActorPtr);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool FActorIndex::IsLiveActor(const AActor* Actor)
+{
+    return IsValid(Actor) && !Actor->IsActorBeingDestroyed();
+}
+
+void FActorIndex::AddActor(FWorldIndex& Index, AActor* Actor)
+{
+    FIndexedActor Indexed;
+    Indexed.Label = Actor->GetActorLabel().ToLower();
+    Indexed.Class = Actor->GetClass();
+    Indexed.Tags = Actor->Tags;
+
+    const TWeakObjectPtr<AActor> ActorPtr(Actor);
+    Index.ActorsByLabel.FindOrAdd(Indexed.Label).Add(ActorPtr);
+    Index.ActorsByClass.FindOrAdd(Indexed.Class).Add(ActorPtr);
+    for (const FName& Tag : Indexed.Tags)
+    {
+        Index.ActorsByTag.FindOrAdd(Tag).AddUnique(ActorPtr);
+    }
+    Index.Actors.Add(ActorPtr, MoveTemp(Indexed));
+
+    if (Index.Spatial.bBuilt)
+    {
+        AddActorBounds(Index.Spatial, Actor);
+    }
+}
+
+void FActorIndex::RemoveActor(FWorldIndex& Index, AActor* Actor)
+{
+    RemoveActorBounds(Index.Spatial, Actor);
+
+    const TWeakObjectPtr<AActor> ActorPtr(Actor);
+    FIndexedActor Indexed;
+    if (!Index.Actors.RemoveAndCopyValue(ActorPtr, Indexed))
+    {
+        return;
+    }
+
+    auto RemoveFrom = [&ActorPtr](auto& Map, const auto& Key)
+    {
+        if (auto* Actors = Map.Find(Key))
+        {
+            Actors->RemoveSingleSwap(ActorPtr);
+            if (Actors->Num() == 0)
+            {
+                Map.Remove(Key);
+            }
+        }
+    };
+
+    RemoveFrom(Index.ActorsByLabel, Indexed.Label);
+    RemoveFrom(Index.ActorsByClass, Indexed.Class);
+    for (const FName& Tag : Indexed.Tags)
+    {
+        RemoveFrom(Index.ActorsByTag, Tag);
+    }
+}
+
+FActorIndex::FWorldIndex* FActorIndex::FindIndexForActor(AActor* Actor)
+{
+    UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+    return World ? WorldIndices.Find(World) : nullptr;
+}
+
+void FActorIndex::HandleActorAdded(AActor* Actor)
+{
+    if (FWorldIndex* Index = FindIndexForActor(Actor))
+    {
+        RemoveActor(*Index, Actor);
+        AddActor(*Index, Actor);
+        Index->ActorSlotCount = CountActorSlots(Actor->GetWorld());
+    }
+}
+
+void FActorIndex::HandleActorDeleted(AActor* Actor)
+{
+    // Deleting only clears the actor's slot, so the slot count stays current
+    if (FWorldIndex* Index = FindIndexForActor(Actor))
+    {
+        RemoveActor(*Index, Actor);
+    }
+}
+
+void FActorIndex::ReindexActor(AActor* Actor)
+{
+    if (FWorldIndex* Index = FindIndexForActor(Actor))
+    {
+        if (Index->Actors.Contains(Actor))
+        {
+            RemoveActor(*Index, Actor);
+            AddActor(*Index, Actor);
+        }
+    }
+}
+
+void FActorIndex::HandleActorLabelChanged(AActor* Actor)
+{
+    ReindexActor(Actor);
+}
+
+void FActorIndex::HandleActorMoved(AActor* Actor)
+{
+    ReindexActor(Actor);
+}
+
+void FActorIndex::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event)
+{
+    AActor* Actor = Cast<AActor>(Object);
+    if (Actor && Event.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(AActor, Tags))
+    {
+        ReindexActor(Actor);
+        return;
+    }
+
+    // Transform, mesh and shape edits change bounds; they land on the actor or on one of its components
+    if (!Actor)
+    {
+        const USceneComponent* Component = Cast<USceneComponent>(Object);
+        Actor = Component ? Component->GetOwner() : nullptr;
+    }
+    FWorldIndex* Index = FindIndexForActor(Actor);
+    if (Index && Index->Spatial.bBuilt && Index->Spatial.Bounds.Contains(Actor))
+    {
+        RemoveActorBounds(Index->Spatial, Actor);
+        AddActorBounds(Index->Spatial, Actor);
+    }
+}
+
+void FActorIndex::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+    // Reinstanced actors are new objects of new classes
+    WorldIndices.Empty();
+    CacheCounters.RecordInvalidation();
+}
+
+void FActorIndex::HandleUndoRedo()
+{
+    // Undo brings deleted actors back without an OnLevelActorAdded
+    WorldIndices.Empty();
+    CacheCounters.RecordInvalidation();
+}
+
+void FActorIndex::HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+    WorldIndices.Remove(World);
+}
@@ -1,4 +1,5 @@
 #include "Services/AnimationBlueprintService.h"
+#include "MCPTrace.h"
 #include "Animation/AnimBlueprint.h"
 #include "Animation/AnimBlueprintGeneratedClass.h"
 #include "Animation/AnimInstance.h"
@@ -28,6 +29,7 @@
 #include "Serialization/JsonSerializer.h"
 #include "UObject/SavePackage.h"
 #include "EdGraph/EdGraph.h"
+#include "MCPBatchEditScope.h"
 
 // Singleton instance
 TUniquePtr<FAnimationBlueprintService> FAnimationBlueprintService::Instance;
@@ -50,6 +52,49 @@ bool FAnimBlueprintCreationParams::IsValid(FString& OutError) const
     return true;
 }
 
+bool FAnimStateMachineSpecParams::IsValid(FString& OutError) const
+{
+    if (StateMachineName.IsEmpty())
+    {
+        OutError = TEXT("State machine name cannot be empty");
+        return false;
+    }
+
+    if (States.Num() == 0 && Transitions.Num() == 0 && EntryStateName.IsEmpty() && !bConnectToOutputPose)
+    {
+        OutError = TEXT("Spec has no states, transitions, entry state or output pose connection");
+        return false;
+    }
+
+    TSet<FString> StateNames;
+    for (const FAnimStateParams& State : States)
+    {
+        if (State.StateName.IsEmpty())
+        {
+            OutError = TEXT("Every state needs a name");
+            return false;
+        }
+        bool bAlreadyInSpec = false;
+        StateNames.Add(State.StateName, &bAlreadyInSpec);
+        if (bAlreadyInSpec)
+        {
+            OutError = FString::Printf(TEXT("State '%s' appears more than once"), *State.StateName);
+            return false;
+        }
+    }
+
+    for (const FAnimTransitionParams& Transition : Transitions)
+    {
+        if (Transition.FromStateName.IsEmpty() || Transition.ToStateName.IsEmpty())
+        {
+            OutError = TEXT("Every transition needs from_state and to_state");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 FAnimationBlueprintService& FAnimationBlueprintService::Get()
 {
     if (!Instance.IsValid())
@@ -189,6 +234,7 @@ bool FAnimationBlueprintService::CompileAnimBlueprint(UAnimBlueprint* AnimBluepr
     }
 
     // Compile the blueprint
+    MCP_TRACE_SCOPE("MCP::CompileAnimBlueprint");
     FCompilerResultsLog Results;
     FKismetEditorUtilities::CompileBlueprint(AnimBlueprint, EBlueprintCompileOptions::None, &Results);
 
@@ -247,7 +293,7 @@ bool FAnimationBlueprintService::LinkAnimationLayer(UAnimBlueprint* AnimBlueprin
     AnimGraph->AddNode(LayerNode, false, false);
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::LinkAnimationLayer: Linked layer interface '%s'"), *Params.LayerInterfaceName);
     return true;
@@ -335,7 +381,7 @@ bool FAnimationBlueprintService::AddAnimVariable(UAnimBlueprint* AnimBlueprint,
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddAnimVariable: Added variable '%s' of type '%s'"), *VariableName, *VariableType);
     return true;
@@ -396,7 +442,7 @@ bool FAnimationBlueprintService::ConfigureAnimSlot(UAnimBlueprint* AnimBlueprint
     SlotNode->AllocateDefaultPins();
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::ConfigureAnimSlot: Configured slot '%s' in group '%s'"), *SlotName, *SlotGroupName);
     return true;
@@ -764,7 +810,7 @@ bool FAnimationBlueprintService::ConnectAnimGraphNodes(UAnimBlueprint* AnimBluep
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::ConnectAnimGraphNodes: Connected '%s.%s' to '%s.%s'"),
         *SourceNodeName, *SourcePinName,
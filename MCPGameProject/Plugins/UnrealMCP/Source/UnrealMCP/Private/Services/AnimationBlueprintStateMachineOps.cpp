@@ -8,12 +8,288 @@
 #include "AnimGraphNode_SequencePlayer.h"
 #include "AnimStateNode.h"
 #include "AnimStateTransitionNode.h"
+#include "AnimStateEntryNode.h"
 #include "AnimationGraph.h"
 #include "AnimationStateMachineGraph.h"
 #include "AnimationStateGraph.h"
 #include "AnimGraphNode_StateResult.h"
+#include "AnimGraphNode_TransitionResult.h"
+#include "AnimationTransitionGraph.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/KismetMathLibrary.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/Kismet2NameValidators.h"
+#include "MCPBatchEditScope.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    /** Bind an animation asset to a new state through a sequence player feeding its result node */
+    void BindStateAnimation(UAnimStateNode* StateNode, const FAnimStateParams& Params)
+    {
+        UAnimationStateGraph* StateGraph = Cast<UAnimationStateGraph>(StateNode->BoundGraph);
+        if (!StateGraph || !StateGraph->MyResultNode)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: State graph or result node not available for animation binding"));
+            return;
+        }
+
+        // Load the animation asset
+        UAnimationAsset* AnimAsset = LoadObject<UAnimationAsset>(nullptr, *Params.AnimationAssetPath);
+        if (!AnimAsset)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Could not load animation asset at '%s'"), *Params.AnimationAssetPath);
+            return;
+        }
+
+        // Create sequence player node using FGraphNodeCreator pattern
+        FGraphNodeCreator<UAnimGraphNode_SequencePlayer> SequencePlayerCreator(*StateGraph);
+        UAnimGraphNode_SequencePlayer* SequencePlayer = SequencePlayerCreator.CreateNode();
+        if (!SequencePlayer)
+        {
+            return;
+        }
+
+        // Set the animation asset
+        SequencePlayer->SetAnimationAsset(AnimAsset);
+
+        // Finalize the node creation
+        SequencePlayerCreator.Finalize();
+
+        // Position the sequence player to the left of the result node
+        SequencePlayer->NodePosX = StateGraph->MyResultNode->NodePosX - 400;
+        SequencePlayer->NodePosY = StateGraph->MyResultNode->NodePosY;
+
+        // Connect the sequence player's Pose output to the result node's Result input
+        UEdGraphPin* OutputPin = SequencePlayer->FindPin(TEXT("Pose"), EGPD_Output);
+        UEdGraphPin* InputPin = StateGraph->MyResultNode->FindPin(TEXT("Result"), EGPD_Input);
+
+        if (OutputPin && InputPin)
+        {
+            OutputPin->MakeLinkTo(InputPin);
+            UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Connected animation '%s' to state '%s'"),
+                *AnimAsset->GetName(), *Params.StateName);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Could not find pins to connect animation. OutputPin: %s, InputPin: %s"),
+                OutputPin ? TEXT("Found") : TEXT("Not Found"), InputPin ? TEXT("Found") : TEXT("Not Found"));
+        }
+    }
+
+    /** Make a state the one the state machine's entry node leads to */
+    void SetEntryState(UAnimationStateMachineGraph* StateMachineGraph, UAnimStateNode* StateNode)
+    {
+        UAnimStateEntryNode* EntryNode = StateMachineGraph->EntryNode;
+        UEdGraphPin* EntryPin = EntryNode ? EntryNode->GetOutputPin() : nullptr;
+        UEdGraphPin* StatePin = StateNode->GetInputPin();
+        if (!EntryPin || !StatePin)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService: Could not link the entry node to state '%s'"), *StateNode->GetStateName());
+            return;
+        }
+
+        // The entry node leads to a single state
+        EntryPin->BreakAllPinLinks();
+        EntryPin->MakeLinkTo(StatePin);
+    }
+
+    /** Create a state node in a state machine graph, with its animation and entry link */
+    UAnimStateNode* SpawnStateNode(UAnimationStateMachineGraph* StateMachineGraph, const FAnimStateParams& Params, FString& OutError)
+    {
+        // Create the state node (BoundGraph must be NULL for PostPlacedNewNode to work)
+        UAnimStateNode* StateNode = NewObject<UAnimStateNode>(StateMachineGraph, NAME_None, RF_Transactional);
+        if (!StateNode)
+        {
+            OutError = TEXT("Failed to create state node");
+            return nullptr;
+        }
+
+        // Set node position BEFORE adding to graph (affects layout)
+        StateNode->NodePosX = static_cast<int32>(Params.NodePosition.X);
+        StateNode->NodePosY = static_cast<int32>(Params.NodePosition.Y);
+
+        // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
+        StateMachineGraph->AddNode(StateNode, false, false);
+
+        // Let PostPlacedNewNode do its work - this will:
+        // 1. Create BoundGraph using CreateNewGraph
+        // 2. Rename with validator
+        // 3. Call CreateDefaultNodesForGraph (creates MyResultNode)
+        // 4. Add BoundGraph to SubGraphs
+        StateNode->PostPlacedNewNode();
+
+        // Rename the bound graph to our desired state name
+        if (!StateNode->BoundGraph)
+        {
+            OutError = TEXT("PostPlacedNewNode failed to create state BoundGraph");
+            return nullptr;
+        }
+        TSharedPtr<INameValidatorInterface> NameValidator = FNameValidatorFactory::MakeValidator(StateNode);
+        FBlueprintEditorUtils::RenameGraphWithSuggestion(StateNode->BoundGraph, NameValidator, Params.StateName);
+
+        // Allocate pins AFTER PostPlacedNewNode
+        StateNode->AllocateDefaultPins();
+
+        // If there's an animation asset path, load it and create a sequence player node
+        if (!Params.AnimationAssetPath.IsEmpty())
+        {
+            BindStateAnimation(StateNode, Params);
+        }
+
+        if (Params.bIsDefaultState)
+        {
+            SetEntryState(StateMachineGraph, StateNode);
+        }
+        return StateNode;
+    }
+
+    /**
+     * Make a transition's rule graph read a bool variable of the blueprint
+     * The variable getter, negated if asked, drives the result node's Can Enter Transition pin.
+     */
+    bool BindTransitionCondition(UAnimBlueprint* AnimBlueprint, UAnimStateTransitionNode* TransitionNode, const FAnimTransitionParams& Params, FString& OutError)
+    {
+        const FName VariableName(*Params.ConditionVariableName);
+        if (!FindFProperty<FBoolProperty>(AnimBlueprint->SkeletonGeneratedClass, VariableName))
+        {
+            OutError = FString::Printf(TEXT("Transition condition '%s' is not a bool variable of '%s'"), *Params.ConditionVariableName, *AnimBlueprint->GetName());
+            return false;
+        }
+
+        UAnimationTransitionGraph* TransitionGraph = Cast<UAnimationTransitionGraph>(TransitionNode->BoundGraph);
+        UAnimGraphNode_TransitionResult* ResultNode = TransitionGraph ? TransitionGraph->GetResultNode() : nullptr;
+        UEdGraphPin* ResultPin = ResultNode ? ResultNode->FindPin(TEXT("bCanEnterTransition"), EGPD_Input) : nullptr;
+        if (!ResultPin)
+        {
+            OutError = TEXT("Transition rule graph has no result node");
+            return false;
+        }
+
+        FGraphNodeCreator<UK2Node_VariableGet> GetterCreator(*TransitionGraph);
+        UK2Node_VariableGet* Getter = GetterCreator.CreateNode();
+        Getter->VariableReference.SetSelfMember(VariableName);
+        Getter->NodePosX = ResultNode->NodePosX - (Params.bNegateCondition ? 500 : 300);
+        Getter->NodePosY = ResultNode->NodePosY;
+        GetterCreator.Finalize();
+
+        UEdGraphPin* ConditionPin = Getter->GetValuePin();
+        if (Params.bNegateCondition && ConditionPin)
+        {
+            FGraphNodeCreator<UK2Node_CallFunction> NotCreator(*TransitionGraph);
+            UK2Node_CallFunction* NotNode = NotCreator.CreateNode();
+            NotNode->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Not_PreBool), UKismetMathLibrary::StaticClass());
+            NotNode->NodePosX = ResultNode->NodePosX - 250;
+            NotNode->NodePosY = ResultNode->NodePosY;
+            NotCreator.Finalize();
+
+            UEdGraphPin* NotInputPin = NotNode->FindPin(TEXT("A"), EGPD_Input);
+            if (NotInputPin)
+            {
+                ConditionPin->MakeLinkTo(NotInputPin);
+            }
+            ConditionPin = NotInputPin ? NotNode->GetReturnValuePin() : nullptr;
+        }
+
+        if (!ConditionPin || !TransitionGraph->GetSchema()->TryCreateConnection(ConditionPin, ResultPin))
+        {
+            OutError = FString::Printf(TEXT("Could not connect condition '%s' to the transition result"), *Params.ConditionVariableName);
+            return false;
+        }
+        return true;
+    }
+
+    /** Create a transition node between two states and set up its rule */
+    UAnimStateTransitionNode* SpawnTransitionNode(UAnimBlueprint* AnimBlueprint, UAnimationStateMachineGraph* StateMachineGraph, UAnimStateNode* FromState, UAnimStateNode* ToState, const FAnimTransitionParams& Params, FString& OutError)
+    {
+        // Create the transition node with RF_Transactional flag
+        UAnimStateTransitionNode* TransitionNode = NewObject<UAnimStateTransitionNode>(StateMachineGraph, NAME_None, RF_Transactional);
+        if (!TransitionNode)
+        {
+            OutError = TEXT("Failed to create transition node");
+            return nullptr;
+        }
+
+        // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
+        StateMachineGraph->AddNode(TransitionNode, false, false);
+
+        // Let PostPlacedNewNode create the BoundGraph (transition rule graph)
+        // This creates UAnimationTransitionGraph with proper schema and default nodes
+        TransitionNode->PostPlacedNewNode();
+
+        // Allocate pins AFTER PostPlacedNewNode
+        TransitionNode->AllocateDefaultPins();
+
+        // Set up the transition properties
+        TransitionNode->CrossfadeDuration = Params.BlendDuration;
+
+        // Handle transition rule type
+        FString RuleType = Params.TransitionRuleType.ToLower();
+
+        if (RuleType == TEXT("timeremaining"))
+        {
+            // TimeRemaining: Use automatic rule based on sequence player's remaining time
+            TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = true;
+            // Negative value means trigger 'CrossfadeDuration' seconds before the end
+            // so a standard blend would finish just as the asset player ends
+            TransitionNode->AutomaticRuleTriggerTime = -1.0f;
+            TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+            UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set TimeRemaining rule for transition"));
+        }
+        else if (RuleType == TEXT("inertialization"))
+        {
+            // Inertialization: Use inertialization blend mode
+            TransitionNode->LogicType = ETransitionLogicType::TLT_Inertialization;
+            TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+            UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set Inertialization rule for transition"));
+        }
+        else if (RuleType == TEXT("custom"))
+        {
+            // Custom: Use custom graph for transition logic
+            TransitionNode->LogicType = ETransitionLogicType::TLT_Custom;
+            TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+            UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set Custom rule for transition (requires manual graph setup)"));
+        }
+        else if (RuleType == TEXT("boolvariable") && !Params.ConditionVariableName.IsEmpty())
+        {
+            // BoolVariable: Standard blend, entered while the condition variable is true (or false if negated)
+            TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+            TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+            if (!BindTransitionCondition(AnimBlueprint, TransitionNode, Params, OutError))
+            {
+                // A half-built transition would compile into one that is never taken
+                TransitionNode->DestroyNode();
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Default: CrossfadeBlend (standard blend without automatic rule)
+            TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
+            TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
+        }
+
+        // Create connections between states through this transition
+        // This properly wires the pins: FromState -> TransitionNode -> ToState
+        TransitionNode->CreateConnections(FromState, ToState);
+        return TransitionNode;
+    }
+
+    void AddStateMachineSpecElement(TArray<TSharedPtr<FJsonValue>>& Elements, const TCHAR* Kind, const FString& Name, bool bSuccess, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Element = MakeShared<FJsonObject>();
+        Element->SetStringField(TEXT("kind"), Kind);
+        Element->SetStringField(TEXT("name"), Name);
+        Element->SetBoolField(TEXT("success"), bSuccess);
+        if (!bSuccess)
+        {
+            Element->SetStringField(TEXT("error"), Error);
+        }
+        Elements.Add(MakeShared<FJsonValueObject>(Element));
+    }
+}
 
 bool FAnimationBlueprintService::CreateStateMachine(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, FString& OutError)
 {
@@ -70,7 +346,7 @@ bool FAnimationBlueprintService::CreateStateMachine(UAnimBlueprint* AnimBlueprin
     }
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::CreateStateMachine: Created state machine '%s'"), *StateMachineName);
     return true;
@@ -94,102 +370,17 @@ bool FAnimationBlueprintService::AddStateToStateMachine(UAnimBlueprint* AnimBlue
 
     UAnimationStateMachineGraph* StateMachineGraph = StateMachineNode->EditorStateMachineGraph;
 
-    // Create the state node (BoundGraph must be NULL for PostPlacedNewNode to work)
-    UAnimStateNode* StateNode = NewObject<UAnimStateNode>(StateMachineGraph, NAME_None, RF_Transactional);
+    UAnimStateNode* StateNode = SpawnStateNode(StateMachineGraph, Params, OutError);
     if (!StateNode)
     {
-        OutError = TEXT("Failed to create state node");
         return false;
     }
 
-    // Set node position BEFORE adding to graph (affects layout)
-    StateNode->NodePosX = static_cast<int32>(Params.NodePosition.X);
-    StateNode->NodePosY = static_cast<int32>(Params.NodePosition.Y);
-
-    // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
-    StateMachineGraph->AddNode(StateNode, false, false);
-
-    // Let PostPlacedNewNode do its work - this will:
-    // 1. Create BoundGraph using CreateNewGraph
-    // 2. Rename with validator
-    // 3. Call CreateDefaultNodesForGraph (creates MyResultNode)
-    // 4. Add BoundGraph to SubGraphs
-    StateNode->PostPlacedNewNode();
-
-    // Rename the bound graph to our desired state name
-    if (StateNode->BoundGraph)
-    {
-        TSharedPtr<INameValidatorInterface> NameValidator = FNameValidatorFactory::MakeValidator(StateNode);
-        FBlueprintEditorUtils::RenameGraphWithSuggestion(StateNode->BoundGraph, NameValidator, Params.StateName);
-    }
-    else
-    {
-        OutError = TEXT("PostPlacedNewNode failed to create state BoundGraph");
-        return false;
-    }
-
-    // Allocate pins AFTER PostPlacedNewNode
-    StateNode->AllocateDefaultPins();
-
     // Notify the graph that it changed so positions are properly applied
-    StateMachineGraph->NotifyGraphChanged();
-
-    // If there's an animation asset path, load it and create a sequence player node
-    if (!Params.AnimationAssetPath.IsEmpty())
-    {
-        UAnimationStateGraph* StateGraph = Cast<UAnimationStateGraph>(StateNode->BoundGraph);
-        if (StateGraph && StateGraph->MyResultNode)
-        {
-            // Load the animation asset
-            UAnimationAsset* AnimAsset = LoadObject<UAnimationAsset>(nullptr, *Params.AnimationAssetPath);
-            if (AnimAsset)
-            {
-                // Create sequence player node using FGraphNodeCreator pattern
-                FGraphNodeCreator<UAnimGraphNode_SequencePlayer> SequencePlayerCreator(*StateGraph);
-                UAnimGraphNode_SequencePlayer* SequencePlayer = SequencePlayerCreator.CreateNode();
-
-                if (SequencePlayer)
-                {
-                    // Set the animation asset
-                    SequencePlayer->SetAnimationAsset(AnimAsset);
-
-                    // Finalize the node creation
-                    SequencePlayerCreator.Finalize();
-
-                    // Position the sequence player to the left of the result node
-                    SequencePlayer->NodePosX = StateGraph->MyResultNode->NodePosX - 400;
-                    SequencePlayer->NodePosY = StateGraph->MyResultNode->NodePosY;
-
-                    // Connect the sequence player's Pose output to the result node's Result input
-                    UEdGraphPin* OutputPin = SequencePlayer->FindPin(TEXT("Pose"), EGPD_Output);
-                    UEdGraphPin* InputPin = StateGraph->MyResultNode->FindPin(TEXT("Result"), EGPD_Input);
-
-                    if (OutputPin && InputPin)
-                    {
-                        OutputPin->MakeLinkTo(InputPin);
-                        UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Connected animation '%s' to state '%s'"),
-                            *AnimAsset->GetName(), *Params.StateName);
-                    }
-                    else
-                    {
-                        UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Could not find pins to connect animation. OutputPin: %s, InputPin: %s"),
-                            OutputPin ? TEXT("Found") : TEXT("Not Found"), InputPin ? TEXT("Found") : TEXT("Not Found"));
-                    }
-                }
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Could not load animation asset at '%s'"), *Params.AnimationAssetPath);
-            }
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateToStateMachine: State graph or result node not available for animation binding"));
-        }
-    }
+    FMCPBatchEditScope::NotifyGraphChanged(StateMachineGraph);
 
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateToStateMachine: Added state '%s' to state machine '%s' at position (%d, %d)"),
         *Params.StateName, *StateMachineName, StateNode->NodePosX, StateNode->NodePosY);
@@ -230,76 +421,13 @@ bool FAnimationBlueprintService::AddStateTransition(UAnimBlueprint* AnimBlueprin
         return false;
     }
 
-    // Create the transition node with RF_Transactional flag
-    UAnimStateTransitionNode* TransitionNode = NewObject<UAnimStateTransitionNode>(StateMachineGraph, NAME_None, RF_Transactional);
-    if (!TransitionNode)
+    if (!SpawnTransitionNode(AnimBlueprint, StateMachineGraph, FromState, ToState, Params, OutError))
     {
-        OutError = TEXT("Failed to create transition node");
         return false;
     }
 
-    // Add to graph FIRST (PostPlacedNewNode uses GetGraph())
-    StateMachineGraph->AddNode(TransitionNode, false, false);
-
-    // Let PostPlacedNewNode create the BoundGraph (transition rule graph)
-    // This creates UAnimationTransitionGraph with proper schema and default nodes
-    TransitionNode->PostPlacedNewNode();
-
-    // Allocate pins AFTER PostPlacedNewNode
-    TransitionNode->AllocateDefaultPins();
-
-    // Set up the transition properties
-    TransitionNode->CrossfadeDuration = Params.BlendDuration;
-
-    // Handle transition rule type
-    FString RuleType = Params.TransitionRuleType.ToLower();
-
-    if (RuleType == TEXT("timeremaining"))
-    {
-        // TimeRemaining: Use automatic rule based on sequence player's remaining time
-        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = true;
-        // Negative value means trigger 'CrossfadeDuration' seconds before the end
-        // so a standard blend would finish just as the asset player ends
-        TransitionNode->AutomaticRuleTriggerTime = -1.0f;
-        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
-        UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set TimeRemaining rule for transition"));
-    }
-    else if (RuleType == TEXT("inertialization"))
-    {
-        // Inertialization: Use inertialization blend mode
-        TransitionNode->LogicType = ETransitionLogicType::TLT_Inertialization;
-        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
-        UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set Inertialization rule for transition"));
-    }
-    else if (RuleType == TEXT("custom"))
-    {
-        // Custom: Use custom graph for transition logic
-        TransitionNode->LogicType = ETransitionLogicType::TLT_Custom;
-        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
-        UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Set Custom rule for transition (requires manual graph setup)"));
-    }
-    else if (RuleType == TEXT("boolvariable") && !Params.ConditionVariableName.IsEmpty())
-    {
-        // BoolVariable: Standard blend with a condition variable
-        // Note: The BoundGraph needs to be populated with the variable getter logic
-        // For now, we log that this requires manual setup or future implementation
-        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
-        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
-        UE_LOG(LogTemp, Warning, TEXT("FAnimationBlueprintService::AddStateTransition: BoolVariable rule set, but variable logic in BoundGraph requires manual setup. Variable: %s"), *Params.ConditionVariableName);
-    }
-    else
-    {
-        // Default: CrossfadeBlend (standard blend without automatic rule)
-        TransitionNode->LogicType = ETransitionLogicType::TLT_StandardBlend;
-        TransitionNode->bAutomaticRuleBasedOnSequencePlayerInState = false;
-    }
-
-    // Create connections between states through this transition
-    // This properly wires the pins: FromState -> TransitionNode -> ToState
-    TransitionNode->CreateConnections(FromState, ToState);
-
     // Mark the blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(AnimBlueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::AddStateTransition: Added transition from '%s' to '%s'"), *Params.FromStateName, *Params.ToStateName);
     return true;
@@ -330,3 +458,165 @@ bool FAnimationBlueprintService::GetStateMachineStates(UAnimBlueprint* AnimBluep
 
     return true;
 }
+
+bool FAnimationBlueprintService::BuildStateMachineFromSpec(UAnimBlueprint* AnimBlueprint, const FAnimStateMachineSpecParams& Spec, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+    if (!AnimBlueprint)
+    {
+        OutError = TEXT("Invalid Animation Blueprint");
+        return false;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Elements;
+    int32 FailedCount = 0;
+    bool bStateMachineCreated = false;
+    FString EntryState;
+
+    {
+        // One undo entry and one round of blueprint and graph notifications for the whole spec
+        FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Build State Machine %s"), *Spec.StateMachineName)));
+
+        UAnimGraphNode_StateMachine* StateMachineNode = FindStateMachineNode(AnimBlueprint, Spec.StateMachineName);
+        if (!StateMachineNode)
+        {
+            if (!CreateStateMachine(AnimBlueprint, Spec.StateMachineName, OutError))
+            {
+                return false;
+            }
+            StateMachineNode = FindStateMachineNode(AnimBlueprint, Spec.StateMachineName);
+            bStateMachineCreated = true;
+        }
+        if (!StateMachineNode || !StateMachineNode->EditorStateMachineGraph)
+        {
+            OutError = FString::Printf(TEXT("Could not find state machine '%s'"), *Spec.StateMachineName);
+            return false;
+        }
+
+        UAnimationStateMachineGraph* StateMachineGraph = StateMachineNode->EditorStateMachineGraph;
+        StateMachineGraph->Modify();
+
+        // States by name, read once; states the spec names that already exist are reused
+        TMap<FString, UAnimStateNode*> StatesByName;
+        for (UEdGraphNode* Node : StateMachineGraph->Nodes)
+        {
+            if (UAnimStateNode* StateNode = Cast<UAnimStateNode>(Node))
+            {
+                StatesByName.Add(StateNode->GetStateName(), StateNode);
+            }
+        }
+
+        for (const FAnimStateParams& StateParams : Spec.States)
+        {
+            if (StatesByName.Contains(StateParams.StateName))
+            {
+                AddStateMachineSpecElement(Elements, TEXT("state"), StateParams.StateName, true, FString());
+                continue;
+            }
+
+            // The entry is set once below, after every state exists
+            FAnimStateParams SpawnParams = StateParams;
+            SpawnParams.bIsDefaultState = false;
+
+            FString StateError;
+            UAnimStateNode* StateNode = SpawnStateNode(StateMachineGraph, SpawnParams, StateError);
+            if (!StateNode)
+            {
+                AddStateMachineSpecElement(Elements, TEXT("state"), StateParams.StateName, false, StateError);
+                ++FailedCount;
+                continue;
+            }
+            StatesByName.Add(StateParams.StateName, StateNode);
+            AddStateMachineSpecElement(Elements, TEXT("state"), StateParams.StateName, true, FString());
+        }
+
+        EntryState = Spec.EntryStateName;
+        if (EntryState.IsEmpty())
+        {
+            if (const FAnimStateParams* DefaultState = Spec.States.FindByPredicate([](const FAnimStateParams& State) { return State.bIsDefaultState; }))
+            {
+                EntryState = DefaultState->StateName;
+            }
+        }
+        if (!EntryState.IsEmpty())
+        {
+            if (UAnimStateNode** EntryNode = StatesByName.Find(EntryState))
+            {
+                SetEntryState(StateMachineGraph, *EntryNode);
+                AddStateMachineSpecElement(Elements, TEXT("entry"), EntryState, true, FString());
+            }
+            else
+            {
+                AddStateMachineSpecElement(Elements, TEXT("entry"), EntryState, false, FString::Printf(TEXT("Could not find entry state '%s'"), *EntryState));
+                ++FailedCount;
+            }
+        }
+
+        for (const FAnimTransitionParams& TransitionParams : Spec.Transitions)
+        {
+            const FString TransitionName = FString::Printf(TEXT("%s->%s"), *TransitionParams.FromStateName, *TransitionParams.ToStateName);
+            UAnimStateNode** FromState = StatesByName.Find(TransitionParams.FromStateName);
+            UAnimStateNode** ToState = StatesByName.Find(TransitionParams.ToStateName);
+
+            FString TransitionError;
+            if (!FromState)
+            {
+                TransitionError = FString::Printf(TEXT("Could not find source state '%s'"), *TransitionParams.FromStateName);
+            }
+            else if (!ToState)
+            {
+                TransitionError = FString::Printf(TEXT("Could not find destination state '%s'"), *TransitionParams.ToStateName);
+            }
+            else
+            {
+                SpawnTransitionNode(AnimBlueprint, StateMachineGraph, *FromState, *ToState, TransitionParams, TransitionError);
+            }
+
+            const bool bAdded = TransitionError.IsEmpty();
+            AddStateMachineSpecElement(Elements, TEXT("transition"), TransitionName, bAdded, TransitionError);
+            if (!bAdded)
+            {
+                ++FailedCount;
+            }
+        }
+
+        if (Spec.bConnectToOutputPose)
+        {
+            FString ConnectError;
+            const bool bConnected = ConnectAnimGraphNodes(AnimBlueprint, Spec.StateMachineName, FString(), TEXT("Pose"), TEXT("Result"), ConnectError);
+            AddStateMachineSpecElement(Elements, TEXT("output_pose"), Spec.StateMachineName, bConnected, ConnectError);
+            if (!bConnected)
+            {
+                ++FailedCount;
+            }
+        }
+
+        FMCPBatchEditScope::NotifyGraphChanged(StateMachineGraph);
+        FMCPBatchEditScope::MarkBlueprintAsModified(AnimBlueprint);
+    }
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("anim_blueprint"), AnimBlueprint->GetPathName());
+    OutReport->SetStringField(TEXT("state_machine_name"), Spec.StateMachineName);
+    OutReport->SetBoolField(TEXT("state_machine_created"), bStateMachineCreated);
+    OutReport->SetStringField(TEXT("entry_state"), EntryState);
+    OutReport->SetNumberField(TEXT("element_count"), Elements.Num());
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("elements"), Elements);
+
+    // Compiled once, after the scope above flushed its notifications
+    OutReport->SetBoolField(TEXT("compile_requested"), Spec.bCompile);
+    if (Spec.bCompile)
+    {
+        FString CompileError;
+        const bool bCompiled = CompileAnimBlueprint(AnimBlueprint, CompileError);
+        OutReport->SetBoolField(TEXT("compiled"), bCompiled);
+        if (!bCompiled)
+        {
+            OutReport->SetStringField(TEXT("compile_error"), CompileError);
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FAnimationBlueprintService::BuildStateMachineFromSpec: Built state machine '%s' with %d element(s), %d failed"),
+        *Spec.StateMachineName, Elements.Num(), FailedCount);
+    return true;
+}
@@ -0,0 +1,409 @@
+#include "Services/AssetDiscoveryService.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/Widget.h"
+#include "Components/PanelWidget.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/GameModeBase.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/DataAsset.h"
+
+UClass* FAssetDiscoveryService::ResolveObjectClass(const FString& ClassName)
+{
+    UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Resolving object class: %s"), *ClassName);
+    
+    // Try engine classes first
+    UClass* EngineClass = ResolveEngineClass(ClassName);
+    if (EngineClass)
+    {
+        return EngineClass;
+    }
+    
+    // Try UMG classes
+    UClass* UMGClass = ResolveUMGClass(ClassName);
+    if (UMGClass)
+    {
+        return UMGClass;
+    }
+    
+    // Blueprint classes given by short name come from the asset index; once it has answered, the
+    // guessed /Game paths and the registry scan below cannot find anything it did not
+    FString BlueprintName = ClassName;
+    BlueprintName.RemoveFromEnd(TEXT("_C"));
+    FSoftObjectPath BlueprintPath;
+    const EAssetResolution BlueprintResolution = ResolveAssetPath(BlueprintName, UBlueprint::StaticClass(), BlueprintPath);
+    if (BlueprintResolution == EAssetResolution::Found)
+    {
+        UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintPath.TryLoad());
+        if (Blueprint && Blueprint->GeneratedClass)
+        {
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found Blueprint class via asset index: %s -> %s"),
+                *ClassName, *Blueprint->GeneratedClass->GetName());
+            return Blueprint->GeneratedClass;
+        }
+    }
+    const bool bSearchGame = BlueprintResolution == EAssetResolution::Unknown;
+
+    // Try direct loading with various paths
+    TArray<FString> SearchPaths = {
+        ClassName,
+        BuildEnginePath(ClassName),
+        BuildCorePath(ClassName),
+        BuildUMGPath(ClassName)
+    };
+    if (bSearchGame)
+    {
+        SearchPaths.Add(BuildGamePath(ClassName));
+        SearchPaths.Add(BuildGamePath(FString::Printf(TEXT("Blueprints/%s"), *ClassName)));
+    }
+
+    // CRITICAL FIX: For Blueprint classes, also try appending the _C suffix
+    // Blueprint generated classes use format: /Game/Path/To/BP_Name.BP_Name_C
+    TArray<FString> BlueprintPaths;
+    for (const FString& SearchPath : SearchPaths)
+    {
+        // Only try Blueprint class format for /Game/ paths
+        if (SearchPath.StartsWith(TEXT("/Game/")))
+        {
+            FString AssetName = FPaths::GetBaseFilename(SearchPath);
+
+            // If the path doesn't already have the _C suffix, try adding it
+            if (!SearchPath.EndsWith(TEXT("_C")))
+            {
+                // Format: /Game/Path/To/BP_Name.BP_Name_C
+                BlueprintPaths.Add(FString::Printf(TEXT("%s.%s_C"), *SearchPath, *AssetName));
+            }
+        }
+    }
+
+    // Combine both search path lists
+    SearchPaths.Append(BlueprintPaths);
+
+    for (const FString& SearchPath : SearchPaths)
+    {
+        UClass* FoundClass = LoadObject<UClass>(nullptr, *SearchPath);
+        if (FoundClass)
+        {
+            UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found class via search path: %s -> %s"), *SearchPath, *FoundClass->GetName());
+            return FoundClass;
+        }
+    }
+
+    // Strategy: Use asset registry to find Blueprint by name
+    // This handles cases like "BP_DialogueComponent" without requiring full path
+    if (bSearchGame)
+    {
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+        TArray<FAssetData> AssetDataList;
+
+        FARFilter Filter;
+        Filter.PackagePaths.Add(TEXT("/Game"));
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+
+        AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+
+        FString SearchName = FPaths::GetBaseFilename(ClassName);
+
+        // First pass: exact match
+        for (const FAssetData& AssetData : AssetDataList)
+        {
+            if (AssetData.AssetName.ToString().Equals(SearchName, ESearchCase::IgnoreCase))
+            {
+                UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+                if (Blueprint && Blueprint->GeneratedClass)
+                {
+                    UE_LOG(LogTemp, Display, TEXT("AssetDiscoveryService: Found Blueprint class via asset registry: %s -> %s"),
+                        *SearchName, *Blueprint->GeneratedClass->GetName());
+                    return Blueprint->GeneratedClass;
+                }
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Could not resolve object class: %s"), *ClassName);
+    UE_LOG(LogTemp, Warning, TEXT("AssetDiscoveryService: Tried the following paths:"));
+    for (const FString& SearchPath : SearchPaths)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("  - %s"), *SearchPath);
+    }
+    return nullptr;
+}
+
+UClass* FAssetDiscoveryService::ResolveUMGClass(const FString& ClassName)
+{
+    if (ClassName.Equals(TEXT("UserWidget"), ESearchCase::IgnoreCase))
+    {
+        return UUserWidget::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("Widget"), ESearchCase::IgnoreCase))
+    {
+        return UWidget::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("PanelWidget"), ESearchCase::IgnoreCase))
+    {
+        return UPanelWidget::StaticClass();
+    }
+    
+    return nullptr;
+}
+
+UClass* FAssetDiscoveryService::ResolveEngineClass(const FString& ClassName)
+{
+    // Actor-derived classes
+    if (ClassName.Equals(TEXT("Actor"), ESearchCase::IgnoreCase))
+    {
+        return AActor::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("Pawn"), ESearchCase::IgnoreCase))
+    {
+        return APawn::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("Character"), ESearchCase::IgnoreCase))
+    {
+        return ACharacter::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("PlayerController"), ESearchCase::IgnoreCase))
+    {
+        return APlayerController::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("GameMode"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("GameModeBase"), ESearchCase::IgnoreCase))
+    {
+        return AGameModeBase::StaticClass();
+    }
+    // UObject-derived classes (non-Actor)
+    else if (ClassName.Equals(TEXT("Object"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("UObject"), ESearchCase::IgnoreCase))
+    {
+        return UObject::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("DataAsset"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("UDataAsset"), ESearchCase::IgnoreCase))
+    {
+        return UDataAsset::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("PrimaryDataAsset"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("UPrimaryDataAsset"), ESearchCase::IgnoreCase))
+    {
+        return UPrimaryDataAsset::StaticClass();
+    }
+    // Component classes
+    else if (ClassName.Equals(TEXT("ActorComponent"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("UActorComponent"), ESearchCase::IgnoreCase))
+    {
+        return UActorComponent::StaticClass();
+    }
+    else if (ClassName.Equals(TEXT("SceneComponent"), ESearchCase::IgnoreCase) ||
+             ClassName.Equals(TEXT("USceneComponent"), ESearchCase::IgnoreCase))
+    {
+        return USceneComponent::StaticClass();
+    }
+
+    return nullptr;
+}
+
+FString FAssetDiscoveryService::BuildGamePath(const FString& Path)
+{
+    FString CleanPath = Path;
+    
+    // Remove leading slash
+    if (CleanPath.StartsWith(TEXT("/")))
+    {
+        CleanPath = CleanPath.RightChop(1);
+    }
+    
+    // Fix: Check if already starts with Game/
+    if (CleanPath.StartsWith(TEXT("Game/"), ESearchCase::IgnoreCase))
+    {
+        // Already has Game/ prefix, just add leading slash
+        return FString::Printf(TEXT("/%s"), *CleanPath);
+    }
+    
+    return FString::Printf(TEXT("/Game/%s"), *CleanPath);
+}
+
+FString FAssetDiscoveryService::BuildEnginePath(const FString& Path)
+{
+    return FString::Printf(TEXT("/Script/Engine.%s"), *Path);
+}
+
+FString FAssetDiscoveryService::BuildCorePath(const FString& Path)
+{
+    return FString::Printf(TEXT("/Script/CoreUObject.%s"), *Path);
+}
+
+FString FAssetDiscoveryService::BuildUMGPath(const FString& Path)
+{
+    return FString::Printf(TEXT("/Script/UMG.%s"), *Path);
+}
+
+UClass* FAssetDiscoveryService::ResolveParentClassForBlueprint(const FString& ClassName, FString& OutErrorMessage)
+{
+    if (ClassName.IsEmpty())
+    {
+        OutErrorMessage = TEXT("Parent class name is empty");
+        return nullptr;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Resolving '%s'"), *ClassName);
+
+    // =========================================================================
+    // Strategy 1: Full path resolution (handles both /Script/ and /Game/)
+    // =========================================================================
+    if (ClassName.StartsWith(TEXT("/")))
+    {
+        if (ClassName.StartsWith(TEXT("/Script/")))
+        {
+            UClass* NativeClass = LoadClass<UObject>(nullptr, *ClassName);
+            if (NativeClass)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via /Script/ path: %s"), *NativeClass->GetName());
+                return NativeClass;
+            }
+        }
+        else if (ClassName.StartsWith(TEXT("/Game/")))
+        {
+            // Try loading as Blueprint asset
+            UBlueprint* Blueprint = LoadObject<UBlueprint>(nullptr, *ClassName);
+            if (Blueprint && Blueprint->GeneratedClass)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found Blueprint at %s -> %s"), *ClassName, *Blueprint->GeneratedClass->GetName());
+                return Blueprint->GeneratedClass;
+            }
+
+            // Try with _C suffix for generated class
+            FString AssetName = FPaths::GetBaseFilename(ClassName);
+            FString GeneratedClassPath = FString::Printf(TEXT("%s.%s_C"), *ClassName, *AssetName);
+            UClass* GeneratedClass = LoadClass<UObject>(nullptr, *GeneratedClassPath);
+            if (GeneratedClass)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via generated class path: %s"), *GeneratedClass->GetName());
+                return GeneratedClass;
+            }
+        }
+    }
+
+    // =========================================================================
+    // Strategy 2: FindFirstObject (works for loaded native classes)
+    // =========================================================================
+    UClass* FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::None);
+    if (FoundClass)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via FindFirstObject: %s"), *FoundClass->GetName());
+        return FoundClass;
+    }
+
+    // =========================================================================
+    // Strategy 3: Try with common prefixes (U and A)
+    // =========================================================================
+    FString NameWithU = ClassName.StartsWith(TEXT("U")) ? ClassName : TEXT("U") + ClassName;
+    FString NameWithA = ClassName.StartsWith(TEXT("A")) ? ClassName : TEXT("A") + ClassName;
+    FString NameWithoutPrefix = ClassName;
+    if (ClassName.Len() > 1 && (ClassName[0] == 'U' || ClassName[0] == 'A') && FChar::IsUpper(ClassName[1]))
+    {
+        NameWithoutPrefix = ClassName.RightChop(1);
+    }
+
+    TArray<FString> PrefixVariants = {NameWithU, NameWithA, NameWithoutPrefix};
+
+    for (const FString& Variant : PrefixVariants)
+    {
+        FoundClass = FindFirstObject<UClass>(*Variant, EFindFirstObjectOptions::None);
+        if (FoundClass)
+        {
+            UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via prefix variant '%s': %s"), *Variant, *FoundClass->GetName());
+            return FoundClass;
+        }
+    }
+
+    // =========================================================================
+    // Strategy 4: Engine class shortcuts (extends ResolveEngineClass)
+    // =========================================================================
+    UClass* EngineClass = ResolveEngineClass(ClassName);
+    if (EngineClass)
+    {
+        UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via engine class shortcut: %s"), *EngineClass->GetName());
+        return EngineClass;
+    }
+
+    // =========================================================================
+    // Strategy 5: Module path loading (CRITICAL: includes game module)
+    // =========================================================================
+    // Dynamically get the game module path from project name
+    FString GameModulePath = FString::Printf(TEXT("/Script/%s"), FApp::GetProjectName());
+
+    TArray<FString> ModulePaths = {
+        TEXT("/Script/Engine"),
+        TEXT("/Script/CoreUObject"),
+        TEXT("/Script/GameplayAbilities"),
+        TEXT("/Script/AIModule"),
+        TEXT("/Script/UMG"),
+        TEXT("/Script/Mover"),
+        GameModulePath,  // Game module - dynamically resolved from project name
+    };
+
+    for (const FString& ModulePath : ModulePaths)
+    {
+        for (const FString& Variant : PrefixVariants)
+        {
+            FString ClassPath = FString::Printf(TEXT("%s.%s"), *ModulePath, *Variant);
+            FoundClass = LoadClass<UObject>(nullptr, *ClassPath);
+            if (FoundClass)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via module path: %s"), *ClassPath);
+                return FoundClass;
+            }
+        }
+        // Also try the original class name
+        FString ClassPath = FString::Printf(TEXT("%s.%s"), *ModulePath, *ClassName);
+        FoundClass = LoadClass<UObject>(nullptr, *ClassPath);
+        if (FoundClass)
+        {
+            UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found via module path: %s"), *ClassPath);
+            return FoundClass;
+        }
+    }
+
+    // =========================================================================
+    // Strategy 6: Asset Registry search for Blueprint classes
+    // =========================================================================
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    TArray<FAssetData> BlueprintAssets;
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    Filter.bRecursivePaths = true;
+    Filter.PackagePaths.Add(TEXT("/Game"));
+
+    AssetRegistryModule.Get().GetAssets(Filter, BlueprintAssets);
+
+    FString SearchName = FPaths::GetBaseFilename(ClassName);
+
+    // First pass: exact match
+    for (const FAssetData& AssetData : BlueprintAssets)
+    {
+        if (AssetData.AssetName.ToString().Equals(SearchName, ESearchCase::IgnoreCase))
+        {
+            UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+            if (Blueprint && Blueprint->GeneratedClass)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ResolveParentClassForBlueprint: Found Blueprint via asset registry: %s -> %s"),
+                    *SearchName, *Blueprint->GeneratedClass->GetName());
+                return Blueprint->GeneratedClass;
+            }
+        }
+    }
+
+    // =========================================================================
+    // Resolution failed - return nullptr with descriptive error
+    // =========================================================================
+    OutErrorMessage = FString::Printf(TEXT("Could not resolve parent class: '%s'. Searched: FindFirstObject, prefix variants (U/A), engine shortcuts, module paths (/Script/Engine, %s, etc.), and asset registry."), *ClassName, *GameModulePath);
+    UE_LOG(LogTemp, Warning, TEXT("ResolveParentClassForBlueprint: %s"), *OutErrorMessage);
+    return nullptr;
+}
@@ -0,0 +1,156 @@
+#include "Services/AssetDiscoveryService.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "MCPMemory.h"
+
+FAssetDiscoveryService::EAssetResolution FAssetDiscoveryService::ResolveAssetPath(const FString& AssetName, const UClass* AssetClass, FSoftObjectPath& OutPath)
+{
+    if (!AssetClass || !IsInGameThread() || AssetName.Contains(TEXT("/")))
+    {
+        return EAssetResolution::Unknown;
+    }
+
+    FString Name = AssetName;
+    int32 DotIndex = INDEX_NONE;
+    if (Name.FindChar(TEXT('.'), DotIndex))
+    {
+        Name.LeftInline(DotIndex);
+    }
+    if (Name.IsEmpty())
+    {
+        return EAssetResolution::Unknown;
+    }
+
+    // An index built while the registry is still scanning would miss assets and answer wrongly
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry || AssetRegistry->IsLoadingAssets())
+    {
+        return EAssetResolution::Unknown;
+    }
+
+    const FTopLevelAssetPath ClassPath = AssetClass->GetClassPathName();
+    FAssetIndex* Index = AssetIndices.Find(ClassPath);
+    if (!Index)
+    {
+        Index = &BuildAssetIndex(*AssetRegistry, ClassPath);
+    }
+
+    const TArray<FSoftObjectPath>* Paths = Index->PathsByName.Find(Name.ToLower());
+    if (!Paths || Paths->Num() == 0)
+    {
+        return EAssetResolution::NotFound;
+    }
+
+    OutPath = (*Paths)[0];
+    for (const FSoftObjectPath& Path : *Paths)
+    {
+        if (Path.GetAssetName() == Name)
+        {
+            OutPath = Path;
+            break;
+        }
+    }
+    return EAssetResolution::Found;
+}
+
+void FAssetDiscoveryService::InvalidateAssetResolutionCache()
+{
+    AssetIndices.Empty();
+}
+
+void FAssetDiscoveryService::Shutdown()
+{
+    // The asset registry may already be gone during editor shutdown
+    if (AssetAddedHandle.IsValid())
+    {
+        if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+        {
+            AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+            AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+            AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+        }
+        AssetAddedHandle.Reset();
+        AssetRemovedHandle.Reset();
+        AssetRenamedHandle.Reset();
+    }
+    AssetIndices.Empty();
+}
+
+FAssetDiscoveryService::FAssetIndex& FAssetDiscoveryService::BuildAssetIndex(IAssetRegistry& AssetRegistry, const FTopLevelAssetPath& ClassPath)
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    if (!AssetAddedHandle.IsValid())
+    {
+        AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FAssetDiscoveryService::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FAssetDiscoveryService::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FAssetDiscoveryService::HandleAssetRenamed);
+    }
+
+    FAssetIndex& Index = AssetIndices.Add(ClassPath);
+    AssetRegistry.GetDerivedClassNames({ ClassPath }, {}, Index.ClassPaths);
+    Index.ClassPaths.Add(ClassPath);
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(ClassPath);
+    Filter.bRecursiveClasses = true;
+    Filter.PackagePaths.Add(TEXT("/Game"));
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetDataList;
+    AssetRegistry.GetAssets(Filter, AssetDataList);
+    for (const FAssetData& AssetData : AssetDataList)
+    {
+        Index.PathsByName.FindOrAdd(AssetData.AssetName.ToString().ToLower()).Add(AssetData.GetSoftObjectPath());
+    }
+
+    UE_LOG(LogTemp, Verbose, TEXT("AssetDiscoveryService: Indexed %d assets of class %s"), AssetDataList.Num(), *ClassPath.ToString());
+    return Index;
+}
+
+void FAssetDiscoveryService::AddToAssetIndices(const FAssetData& AssetData)
+{
+    if (!AssetData.PackageName.ToString().StartsWith(TEXT("/Game/")))
+    {
+        return;
+    }
+
+    const FString Key = AssetData.AssetName.ToString().ToLower();
+    for (TPair<FTopLevelAssetPath, FAssetIndex>& Entry : AssetIndices)
+    {
+        if (Entry.Value.ClassPaths.Contains(AssetData.AssetClassPath))
+        {
+            Entry.Value.PathsByName.FindOrAdd(Key).AddUnique(AssetData.GetSoftObjectPath());
+        }
+    }
+}
+
+void FAssetDiscoveryService::RemoveFromAssetIndices(const FSoftObjectPath& ObjectPath)
+{
+    const FString Key = ObjectPath.GetAssetName().ToLower();
+    for (TPair<FTopLevelAssetPath, FAssetIndex>& Entry : AssetIndices)
+    {
+        if (TArray<FSoftObjectPath>* Paths = Entry.Value.PathsByName.Find(Key))
+        {
+            Paths->Remove(ObjectPath);
+            if (Paths->Num() == 0)
+            {
+                Entry.Value.PathsByName.Remove(Key);
+            }
+        }
+    }
+}
+
+void FAssetDiscoveryService::HandleAssetAdded(const FAssetData& AssetData)
+{
+    AddToAssetIndices(AssetData);
+}
+
+void FAssetDiscoveryService::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    RemoveFromAssetIndices(AssetData.GetSoftObjectPath());
+}
+
+void FAssetDiscoveryService::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    RemoveFromAssetIndices(FSoftObjectPath(OldObjectPath));
+    AddToAssetIndices(AssetData);
+}
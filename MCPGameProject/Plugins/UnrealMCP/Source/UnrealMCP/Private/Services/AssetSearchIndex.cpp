@@ -0,0 +1,485 @@
+#include "Services/AssetSearchIndex.h"
+#include "Async/Async.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "MCPLogging.h"
+#include "Misc/ScopeRWLock.h"
+#include "MCPMemory.h"
+#include "MCPPersistentCache.h"
+#include "Hash/CityHash.h"
+#include "Serialization/Archive.h"
+
+namespace
+{
+    /** Whether a package path is /Game or a folder below it */
+    bool IsUnderGame(FName PackagePath)
+    {
+        const FString Path = PackagePath.ToString();
+        return Path.Equals(TEXT("/Game"), ESearchCase::IgnoreCase) || Path.StartsWith(TEXT("/Game/"), ESearchCase::IgnoreCase);
+    }
+}
+
+FAssetSearchIndex& FAssetSearchIndex::Get()
+{
+    static FAssetSearchIndex Instance;
+    return Instance;
+}
+
+void FAssetSearchIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FAssetSearchIndex::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FAssetSearchIndex::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FAssetSearchIndex::HandleAssetRenamed);
+        bInitialized = true;
+
+        FMCPCacheStatsRegistry::Get().Register(TEXT("asset_search_index"), TEXT("index"), CacheCounters, [this]()
+        {
+            FReadScopeLock ReadLock(IndexLock);
+            return Index.IsValid() ? static_cast<int64>(Index->SlotsByPath.Num()) : 0;
+        });
+
+        LoadPersistentState();
+    }
+}
+
+void FAssetSearchIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("asset_search_index"));
+
+    SavePersistentState();
+    FWriteScopeLock WriteLock(IndexLock);
+    Index.Reset();
+    bIndexRestored = false;
+}
+
+bool FAssetSearchIndex::Search(const FQuery& Query, TArray<FEntry>& OutMatches, int32& OutTotalMatches)
+{
+    OutMatches.Reset();
+    OutTotalMatches = 0;
+
+    FString Folder = Query.PackagePath;
+    Folder.RemoveFromEnd(TEXT("/"));
+    if (!Folder.Equals(TEXT("/Game"), ESearchCase::IgnoreCase) && !Folder.StartsWith(TEXT("/Game/"), ESearchCase::IgnoreCase))
+    {
+        return false;
+    }
+    const bool bWholeProject = Folder.Equals(TEXT("/Game"), ESearchCase::IgnoreCase);
+    const FString FolderPrefix = Folder + TEXT("/");
+
+    TSet<FTopLevelAssetPath> Classes;
+    if (Query.ClassPaths.Num() > 0)
+    {
+        Classes.Append(Query.ClassPaths);
+        IAssetRegistry* AssetRegistry = Query.bRecursiveClasses ? IAssetRegistry::Get() : nullptr;
+        if (AssetRegistry)
+        {
+            AssetRegistry->GetDerivedClassNames(Query.ClassPaths, TSet<FTopLevelAssetPath>(), Classes);
+        }
+    }
+
+    const FString Needle = Query.NameFilter.ToLower();
+    const int32 Offset = FMath::Max(Query.Offset, 0);
+    const int32 Limit = FMath::Max(Query.Limit, 0);
+
+    FReadScopeLock ReadLock(IndexLock);
+    if (!Index.IsValid())
+    {
+        CacheCounters.RecordMiss();
+        RequestBuild();
+        return false;
+    }
+    CacheCounters.RecordHit();
+    if (bIndexRestored)
+    {
+        // Check the restored index against the registry as soon as its scan is done
+        RequestBuild();
+    }
+
+    // Candidate slots, ascending: the rarest trigram's posting list, else the class partitions,
+    // else every slot
+    const TArray<int32>* Candidates = nullptr;
+    TArray<int32> ClassCandidates;
+    if (Needle.Len() >= 3)
+    {
+        for (int32 Start = 0; Start + 3 <= Needle.Len(); ++Start)
+        {
+            const TArray<int32>* Slots = Index->SlotsByTrigram.Find(MakeTrigram(Needle, Start));
+            if (!Slots)
+            {
+                return true;
+            }
+            if (!Candidates || Slots->Num() < Candidates->Num())
+            {
+                Candidates = Slots;
+            }
+        }
+    }
+    else if (Classes.Num() > 0)
+    {
+        for (const FTopLevelAssetPath& ClassPath : Classes)
+        {
+            if (const TArray<int32>* Slots = Index->SlotsByClass.Find(ClassPath))
+            {
+                ClassCandidates.Append(*Slots);
+            }
+        }
+        ClassCandidates.Sort();
+        Candidates = &ClassCandidates;
+    }
+
+    auto Visit = [&](int32 Slot)
+    {
+        const FEntry& Entry = Index->Entries[Slot];
+        if (Entry.ObjectPath.IsNull())
+        {
+            return;
+        }
+        if (Classes.Num() > 0 && !Classes.Contains(Entry.ClassPath))
+        {
+            return;
+        }
+        if (!Needle.IsEmpty() && !Index->LowerNames[Slot].Contains(Needle, ESearchCase::CaseSensitive))
+        {
+            return;
+        }
+        if (!bWholeProject)
+        {
+            const FString PackagePath = Entry.PackagePath.ToString();
+            if (!PackagePath.Equals(Folder, ESearchCase::IgnoreCase) && !PackagePath.StartsWith(FolderPrefix, ESearchCase::IgnoreCase))
+            {
+                return;
+            }
+        }
+
+        if (OutTotalMatches >= Offset && OutMatches.Num() < Limit)
+        {
+            OutMatches.Add(Entry);
+        }
+        ++OutTotalMatches;
+    };
+
+    if (Candidates)
+    {
+        for (int32 Slot : *Candidates)
+        {
+            Visit(Slot);
+        }
+    }
+    else
+    {
+        for (int32 Slot = 0; Slot < Index->Entries.Num(); ++Slot)
+        {
+            Visit(Slot);
+        }
+    }
+    return true;
+}
+
+bool FAssetSearchIndex::FindObjectPaths(const FString& NameFilter, const TArray<FTopLevelAssetPath>& ClassPaths, const FString& PackagePath, TArray<FString>& OutPaths)
+{
+    FQuery Query;
+    Query.NameFilter = NameFilter;
+    Query.ClassPaths = ClassPaths;
+    Query.bRecursiveClasses = false;
+    Query.PackagePath = PackagePath;
+
+    TArray<FEntry> Matches;
+    int32 TotalMatches = 0;
+    if (!Search(Query, Matches, TotalMatches))
+    {
+        return false;
+    }
+
+    OutPaths.Reserve(OutPaths.Num() + Matches.Num());
+    for (const FEntry& Match : Matches)
+    {
+        OutPaths.Add(Match.ObjectPath.ToString());
+    }
+    return true;
+}
+
+void FAssetSearchIndex::Prewarm()
+{
+    Build();
+}
+
+void FAssetSearchIndex::RequestBuild()
+{
+    if (!bBuildQueued.Exchange(true))
+    {
+        AsyncTask(ENamedThreads::GameThread, [this]()
+        {
+            Build();
+            bBuildQueued = false;
+        });
+    }
+}
+
+void FAssetSearchIndex::Build()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    check(IsInGameThread());
+
+    // Without the handlers the index would go stale; an unfinished scan would leave it incomplete
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!bInitialized || !AssetRegistry || AssetRegistry->IsLoadingAssets())
+    {
+        return;
+    }
+
+    {
+        FReadScopeLock ReadLock(IndexLock);
+        if (Index.IsValid() && !bIndexRestored)
+        {
+            return;
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(TEXT("/Game")));
+    Filter.bRecursivePaths = true;
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAssets(Filter, Assets);
+
+    if (bIndexRestored)
+    {
+        uint64 Sum = 0;
+        for (const FAssetData& AssetData : Assets)
+        {
+            Sum += HashAsset(AssetData.GetSoftObjectPath(), AssetData.AssetClassPath);
+        }
+        bIndexRestored = false;
+        if (FinishContentKey(Sum, Assets.Num()) == RestoredContentKey)
+        {
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("Asset search index: kept the last session's index, checked in %.1f ms"),
+                (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            return;
+        }
+        UE_LOG(LogUnrealMCP, Log, TEXT("Asset search index: project assets changed since the last session, rebuilding"));
+        CacheCounters.RecordInvalidation();
+    }
+
+    // The handlers run on the game thread too, so nothing changes between the query and the swap
+    TUniquePtr<FIndexData> NewIndex = MakeUnique<FIndexData>();
+    NewIndex->Entries.Reserve(Assets.Num());
+    NewIndex->LowerNames.Reserve(Assets.Num());
+    NewIndex->SlotsByPath.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        AddEntry(*NewIndex, AssetData);
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Asset search index: %d assets, %d trigrams in %.1f ms"),
+        NewIndex->Entries.Num(), NewIndex->SlotsByTrigram.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    FWriteScopeLock WriteLock(IndexLock);
+    Index = MoveTemp(NewIndex);
+}
+
+void FAssetSearchIndex::AddEntry(FIndexData& Data, const FAssetData& AssetData)
+{
+    AddEntry(Data, AssetData.GetSoftObjectPath(), AssetData.AssetName, AssetData.PackagePath, AssetData.AssetClassPath);
+}
+
+void FAssetSearchIndex::AddEntry(FIndexData& Data, const FSoftObjectPath& ObjectPath, FName AssetName, FName PackagePath, const FTopLevelAssetPath& ClassPath)
+{
+    if (ObjectPath.IsNull() || Data.SlotsByPath.Contains(ObjectPath))
+    {
+        return;
+    }
+
+    const int32 Slot = Data.Entries.Add(FEntry{ ObjectPath, AssetName, PackagePath, ClassPath });
+    const FString& LowerName = Data.LowerNames.Add_GetRef(AssetName.ToString().ToLower());
+    Data.SlotsByPath.Add(ObjectPath, Slot);
+    Data.SlotsByClass.FindOrAdd(ClassPath).Add(Slot);
+
+    // Slots only grow, so each posting list stays sorted; a repeated trigram is added once
+    for (int32 Start = 0; Start + 3 <= LowerName.Len(); ++Start)
+    {
+        TArray<int32>& Slots = Data.SlotsByTrigram.FindOrAdd(MakeTrigram(LowerName, Start));
+        if (Slots.Num() == 0 || Slots.Last() != Slot)
+        {
+            Slots.Add(Slot);
+        }
+    }
+}
+
+void FAssetSearchIndex::RemoveEntry(FIndexData& Data, const FSoftObjectPath& ObjectPath)
+{
+    int32 Slot = INDEX_NONE;
+    if (!Data.SlotsByPath.RemoveAndCopyValue(ObjectPath, Slot))
+    {
+        return;
+    }
+
+    // Posting lists keep the slot; searches skip it by its null path
+    Data.Entries[Slot] = FEntry();
+    Data.LowerNames[Slot].Empty();
+    ++Data.RemovedCount;
+}
+
+uint64 FAssetSearchIndex::MakeTrigram(const FString& Name, int32 Start)
+{
+    // 21 bits cover every Unicode code point
+    return (uint64(uint32(Name[Start]) & 0x1FFFFF) << 42)
+        | (uint64(uint32(Name[Start + 1]) & 0x1FFFFF) << 21)
+        | uint64(uint32(Name[Start + 2]) & 0x1FFFFF);
+}
+
+uint64 FAssetSearchIndex::HashAsset(const FSoftObjectPath& ObjectPath, const FTopLevelAssetPath& ClassPath)
+{
+    // Strings, not FNames: name indices differ between sessions
+    const FTCHARToUTF8 Key(*(ObjectPath.ToString() + TEXT("|") + ClassPath.ToString()));
+    return CityHash64(Key.Get(), Key.Length());
+}
+
+uint64 FAssetSearchIndex::FinishContentKey(uint64 Sum, int32 NumAssets)
+{
+    return Sum ^ (static_cast<uint64>(NumAssets) * 0x9E3779B97F4A7C15ull);
+}
+
+void FAssetSearchIndex::LoadPersistentState()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    TUniquePtr<FIndexData> RestoredIndex = MakeUnique<FIndexData>();
+    uint64 ContentKey = 0;
+    const bool bLoaded = FMCPPersistentCache::Load(TEXT("AssetSearchIndex"), PersistentCacheVersion, ContentKey, [&RestoredIndex](FArchive& Ar)
+    {
+        int32 NumEntries = 0;
+        Ar << NumEntries;
+        // Every entry takes at least four string lengths
+        if (NumEntries < 0 || NumEntries > (Ar.TotalSize() - Ar.Tell()) / 16)
+        {
+            return false;
+        }
+
+        RestoredIndex->Entries.Reserve(NumEntries);
+        RestoredIndex->LowerNames.Reserve(NumEntries);
+        RestoredIndex->SlotsByPath.Reserve(NumEntries);
+        FString ObjectPath, AssetName, PackagePath, ClassPath;
+        for (int32 EntryIndex = 0; EntryIndex < NumEntries && !Ar.IsError(); ++EntryIndex)
+        {
+            Ar << ObjectPath << AssetName << PackagePath << ClassPath;
+            FTopLevelAssetPath ClassAssetPath;
+            ClassAssetPath.TrySetPath(ClassPath);
+            AddEntry(*RestoredIndex, FSoftObjectPath(ObjectPath), FName(*AssetName), FName(*PackagePath), ClassAssetPath);
+        }
+        return !Ar.IsError();
+    });
+    if (!bLoaded)
+    {
+        return;
+    }
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("Asset search index: restored %d assets from the last session in %.1f ms"),
+        RestoredIndex->Entries.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    FWriteScopeLock WriteLock(IndexLock);
+    Index = MoveTemp(RestoredIndex);
+    RestoredContentKey = ContentKey;
+    bIndexRestored = true;
+}
+
+void FAssetSearchIndex::SavePersistentState()
+{
+    FReadScopeLock ReadLock(IndexLock);
+    if (!Index.IsValid() || bIndexRestored)
+    {
+        return;
+    }
+
+    uint64 Sum = 0;
+    int32 NumEntries = 0;
+    for (const FEntry& Entry : Index->Entries)
+    {
+        if (!Entry.ObjectPath.IsNull())
+        {
+            Sum += HashAsset(Entry.ObjectPath, Entry.ClassPath);
+            ++NumEntries;
+        }
+    }
+
+    FMCPPersistentCache::Save(TEXT("AssetSearchIndex"), PersistentCacheVersion, FinishContentKey(Sum, NumEntries), [this, NumEntries](FArchive& Ar)
+    {
+        int32 Count = NumEntries;
+        Ar << Count;
+        for (const FEntry& Entry : Index->Entries)
+        {
+            if (Entry.ObjectPath.IsNull())
+            {
+                continue;
+            }
+            FString ObjectPath = Entry.ObjectPath.ToString();
+            FString AssetName = Entry.AssetName.ToString();
+            FString PackagePath = Entry.PackagePath.ToString();
+            FString ClassPath = Entry.ClassPath.ToString();
+            Ar << ObjectPath << AssetName << PackagePath << ClassPath;
+        }
+    });
+}
+
+void FAssetSearchIndex::HandleAssetAdded(const FAssetData& AssetData)
+{
+    FWriteScopeLock WriteLock(IndexLock);
+    if (Index.IsValid() && IsUnderGame(AssetData.PackagePath))
+    {
+        AddEntry(*Index, AssetData);
+    }
+}
+
+void FAssetSearchIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    FWriteScopeLock WriteLock(IndexLock);
+    if (!Index.IsValid())
+    {
+        return;
+    }
+
+    RemoveEntry(*Index, AssetData.GetSoftObjectPath());
+    if (Index->RemovedCount > MaxRemovedSlots && Index->RemovedCount > Index->Entries.Num() / 2)
+    {
+        Index.Reset();
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FAssetSearchIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    FWriteScopeLock WriteLock(IndexLock);
+    if (!Index.IsValid())
+    {
+        return;
+    }
+
+    RemoveEntry(*Index, FSoftObjectPath(OldObjectPath));
+    if (IsUnderGame(AssetData.PackagePath))
+    {
+        AddEntry(*Index, AssetData);
+    }
+}
@@ -1,5 +1,16 @@
 #include "Services/Blueprint/BlueprintCacheService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
 
 // Blueprint Cache Implementation
 UBlueprint* FBlueprintCache::GetBlueprint(const FString& BlueprintName)
@@ -9,21 +20,27 @@ UBlueprint* FBlueprintCache::GetBlueprint(const FString& BlueprintName)
     // Update statistics
     UpdateStats(false); // Assume miss initially
 
-    if (TWeakObjectPtr<UBlueprint>* CachedPtr = CachedBlueprints.Find(BlueprintName))
+    if (FCachedBlueprint* Cached = CachedBlueprints.Find(BlueprintName))
     {
-        if (CachedPtr->IsValid())
+        if (Cached->Blueprint.IsValid())
         {
             // Update to hit since we found a valid entry
             CacheStats.CacheHits++;
             CacheStats.CacheMisses--;
 
+            if (FKnownPackage* Known = KnownPackages.Find(BlueprintName))
+            {
+                Known->LastUsed = FDateTime::UtcNow();
+            }
+
             UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Cache hit for blueprint '%s'"), *BlueprintName);
-            return CachedPtr->Get();
+            Cached->LastUse = FMCPCacheBudget::NextUse();
+            return Cached->Blueprint.Get();
         }
         else
         {
             // Remove invalid entry
-            CachedBlueprints.Remove(BlueprintName);
+            RemoveMapEntry(CachedBlueprints, BlueprintName);
             CacheStats.CachedCount = CachedBlueprints.Num();
             UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Removed invalid cache entry for blueprint '%s'"), *BlueprintName);
         }
@@ -40,15 +57,22 @@ void FBlueprintCache::CacheBlueprint(const FString& BlueprintName, UBlueprint* B
     }
 
     FScopeLock Lock(&CacheLock);
-    CachedBlueprints.Add(BlueprintName, Blueprint);
+    AddEntry(BlueprintName, Blueprint);
     CacheStats.CachedCount = CachedBlueprints.Num();
+
+    // Only blueprints saved as assets can be found again in a later session
+    const FString PackageName = Blueprint->GetPackage()->GetName();
+    if (FPackageName::IsValidLongPackageName(PackageName) && !PackageName.StartsWith(TEXT("/Temp/")))
+    {
+        KnownPackages.Add(BlueprintName, FKnownPackage{ PackageName, FDateTime::UtcNow() });
+    }
     UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Cached blueprint '%s'"), *BlueprintName);
 }
 
 void FBlueprintCache::InvalidateBlueprint(const FString& BlueprintName)
 {
     FScopeLock Lock(&CacheLock);
-    if (CachedBlueprints.Remove(BlueprintName) > 0)
+    if (RemoveMapEntry(CachedBlueprints, BlueprintName))
     {
         CacheStats.InvalidatedCount++;
         CacheStats.CachedCount = CachedBlueprints.Num();
@@ -61,6 +85,7 @@ void FBlueprintCache::ClearCache()
     FScopeLock Lock(&CacheLock);
     int32 ClearedCount = CachedBlueprints.Num();
     CachedBlueprints.Empty();
+    ResetUsedBytes();
     CacheStats.CachedCount = 0;
     UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Cleared %d cached blueprints"), ClearedCount);
 }
@@ -144,14 +169,237 @@ bool FBlueprintCache::IsCached(const FString& BlueprintName) const
 {
     FScopeLock Lock(&CacheLock);
 
-    if (const TWeakObjectPtr<UBlueprint>* CachedPtr = CachedBlueprints.Find(BlueprintName))
+    if (const FCachedBlueprint* Cached = CachedBlueprints.Find(BlueprintName))
     {
-        return CachedPtr->IsValid();
+        return Cached->Blueprint.IsValid();
     }
 
     return false;
 }
 
+FString FBlueprintCache::GetKnownPackage(const FString& BlueprintName) const
+{
+    FScopeLock Lock(&CacheLock);
+    const FKnownPackage* Known = KnownPackages.Find(BlueprintName);
+    return Known ? Known->PackageName : FString();
+}
+
+void FBlueprintCache::ForgetKnownPackage(const FString& BlueprintName)
+{
+    FScopeLock Lock(&CacheLock);
+    KnownPackages.Remove(BlueprintName);
+}
+
+void FBlueprintCache::WarmStart(int32 MaxPreloads)
+{
+    const int32 LoadedCount = LoadPersistentState();
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Restored %d known blueprint packages from the last session"), LoadedCount);
+    if (LoadedCount == 0 || MaxPreloads <= 0)
+    {
+        return;
+    }
+
+    // Blueprints may depend on game modules that load late in engine startup
+    if (GIsRunning)
+    {
+        PreloadRecentBlueprints(MaxPreloads);
+    }
+    else
+    {
+        FCoreDelegates::OnFEngineLoopInitComplete.AddLambda([this, MaxPreloads]()
+        {
+            PreloadRecentBlueprints(MaxPreloads);
+        });
+    }
+}
+
+void FBlueprintCache::SavePersistentState() const
+{
+    TArray<TPair<FString, FKnownPackage>> Entries;
+    {
+        FScopeLock Lock(&CacheLock);
+        for (const TPair<FString, FKnownPackage>& Entry : KnownPackages)
+        {
+            Entries.Add(Entry);
+        }
+    }
+
+    // Keep the most recently used entries
+    Entries.Sort([](const TPair<FString, FKnownPackage>& A, const TPair<FString, FKnownPackage>& B)
+    {
+        return A.Value.LastUsed > B.Value.LastUsed;
+    });
+
+    TArray<TSharedPtr<FJsonValue>> EntryValues;
+    for (const TPair<FString, FKnownPackage>& Entry : Entries)
+    {
+        if (EntryValues.Num() >= MaxPersistentEntries)
+        {
+            break;
+        }
+
+        // The package file's timestamp tells the next session whether the mapping still holds
+        FString PackageFilename;
+        if (!FPackageName::DoesPackageExist(Entry.Value.PackageName, &PackageFilename))
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("name"), Entry.Key);
+        EntryObj->SetStringField(TEXT("package"), Entry.Value.PackageName);
+        EntryObj->SetStringField(TEXT("last_used"), Entry.Value.LastUsed.ToIso8601());
+        EntryObj->SetStringField(TEXT("package_timestamp"), IFileManager::Get().GetTimeStamp(*PackageFilename).ToIso8601());
+        EntryValues.Add(MakeShared<FJsonValueObject>(EntryObj));
+    }
+
+    TSharedPtr<FJsonObject> RootObj = MakeShared<FJsonObject>();
+    RootObj->SetNumberField(TEXT("version"), 1);
+    RootObj->SetArrayField(TEXT("blueprints"), EntryValues);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObj.ToSharedRef(), Writer);
+
+    const FString StatePath = GetPersistentStatePath();
+    if (!FFileHelper::SaveStringToFile(OutputString, *StatePath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FBlueprintCache: Could not write '%s'"), *StatePath);
+        return;
+    }
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Saved %d known blueprint packages"), EntryValues.Num());
+}
+
+FString FBlueprintCache::GetPersistentStatePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("BlueprintCache.json"));
+}
+
+int32 FBlueprintCache::LoadPersistentState()
+{
+    FString InputString;
+    if (!FFileHelper::LoadFileToString(InputString, *GetPersistentStatePath()))
+    {
+        return 0;
+    }
+
+    TSharedPtr<FJsonObject> RootObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid() || !RootObj->TryGetArrayField(TEXT("blueprints"), EntryValues))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FBlueprintCache: Ignoring unreadable '%s'"), *GetPersistentStatePath());
+        return 0;
+    }
+
+    TMap<FString, FKnownPackage> LoadedPackages;
+    int32 StaleCount = 0;
+    for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValues)
+    {
+        const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+        if (!EntryValue.IsValid() || !EntryValue->TryGetObject(EntryObj))
+        {
+            continue;
+        }
+
+        FString Name, PackageName, LastUsedString, TimestampString;
+        FDateTime LastUsed, Timestamp;
+        if (!(*EntryObj)->TryGetStringField(TEXT("name"), Name)
+            || !(*EntryObj)->TryGetStringField(TEXT("package"), PackageName)
+            || !(*EntryObj)->TryGetStringField(TEXT("last_used"), LastUsedString)
+            || !(*EntryObj)->TryGetStringField(TEXT("package_timestamp"), TimestampString)
+            || !FDateTime::ParseIso8601(*LastUsedString, LastUsed)
+            || !FDateTime::ParseIso8601(*TimestampString, Timestamp))
+        {
+            continue;
+        }
+
+        // A package that moved, or changed outside the editor (e.g. a source control sync), may no longer hold the blueprint
+        FString PackageFilename;
+        if (!FPackageName::DoesPackageExist(PackageName, &PackageFilename)
+            || IFileManager::Get().GetTimeStamp(*PackageFilename) != Timestamp)
+        {
+            StaleCount++;
+            continue;
+        }
+
+        LoadedPackages.Add(Name, FKnownPackage{ PackageName, LastUsed });
+    }
+
+    if (StaleCount > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Dropped %d known blueprint packages that changed since the last session"), StaleCount);
+    }
+
+    FScopeLock Lock(&CacheLock);
+    for (TPair<FString, FKnownPackage>& Entry : LoadedPackages)
+    {
+        // Lookups made this session already are more current
+        if (!KnownPackages.Contains(Entry.Key))
+        {
+            KnownPackages.Add(Entry.Key, MoveTemp(Entry.Value));
+        }
+    }
+    return LoadedPackages.Num();
+}
+
+void FBlueprintCache::PreloadRecentBlueprints(int32 MaxPreloads)
+{
+    // Names by package, most recently used packages first
+    TMap<FString, TArray<FString>> NamesByPackage;
+    TArray<TPair<FString, FDateTime>> Packages;
+    {
+        FScopeLock Lock(&CacheLock);
+        for (const TPair<FString, FKnownPackage>& Entry : KnownPackages)
+        {
+            TArray<FString>* Names = NamesByPackage.Find(Entry.Value.PackageName);
+            if (!Names)
+            {
+                Names = &NamesByPackage.Add(Entry.Value.PackageName);
+                Packages.Add(TPair<FString, FDateTime>(Entry.Value.PackageName, Entry.Value.LastUsed));
+            }
+            Names->Add(Entry.Key);
+        }
+    }
+    Packages.Sort([](const TPair<FString, FDateTime>& A, const TPair<FString, FDateTime>& B)
+    {
+        return A.Value > B.Value;
+    });
+
+    int32 RequestedCount = 0;
+    for (const TPair<FString, FDateTime>& Package : Packages)
+    {
+        if (RequestedCount >= MaxPreloads)
+        {
+            break;
+        }
+        RequestedCount++;
+
+        TArray<FString> Names = NamesByPackage.FindChecked(Package.Key);
+        LoadPackageAsync(Package.Key, FLoadPackageAsyncDelegate::CreateLambda(
+            [this, Names](const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+            {
+                UBlueprint* Blueprint = (Result == EAsyncLoadingResult::Succeeded && LoadedPackage)
+                    ? FindObject<UBlueprint>(LoadedPackage, *FPackageName::GetShortName(PackageName))
+                    : nullptr;
+                if (!Blueprint)
+                {
+                    UE_LOG(LogTemp, Verbose, TEXT("FBlueprintCache: Preloading '%s' found no blueprint"), *PackageName.ToString());
+                    return;
+                }
+                // Preloading is not a use; the names keep their last-used time
+                FScopeLock Lock(&CacheLock);
+                for (const FString& Name : Names)
+                {
+                    AddEntry(Name, Blueprint);
+                }
+                CacheStats.CachedCount = CachedBlueprints.Num();
+            }));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintCache: Preloading %d recently used blueprints"), RequestedCount);
+}
+
 void FBlueprintCache::UpdateStats(bool bWasHit) const
 {
     // This method assumes the lock is already held
@@ -173,8 +421,9 @@ int32 FBlueprintCache::CleanupInvalidEntries()
 
     for (auto It = CachedBlueprints.CreateIterator(); It; ++It)
     {
-        if (!It.Value().IsValid())
+        if (!It.Value().Blueprint.IsValid())
         {
+            AddUsedBytes(-It.Value().Bytes);
             It.RemoveCurrent();
             CleanedCount++;
         }
@@ -188,3 +437,28 @@ int32 FBlueprintCache::CleanupInvalidEntries()
 
     return CleanedCount;
 }
+
+void FBlueprintCache::AddEntry(const FString& BlueprintName, UBlueprint* Blueprint)
+{
+    RemoveMapEntry(CachedBlueprints, BlueprintName);
+    FCachedBlueprint Entry;
+    Entry.Blueprint = Blueprint;
+    Entry.LastUse = FMCPCacheBudget::NextUse();
+    Entry.Bytes = sizeof(FCachedBlueprint) + BlueprintName.GetAllocatedSize();
+    AddUsedBytes(Entry.Bytes);
+    CachedBlueprints.Add(BlueprintName, MoveTemp(Entry));
+}
+
+void FBlueprintCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    FScopeLock Lock(&CacheLock);
+    GetMapUses(CachedBlueprints, OutUses);
+}
+
+int64 FBlueprintCache::EvictUsedBefore(uint64 Stamp)
+{
+    FScopeLock Lock(&CacheLock);
+    const int64 Freed = EvictMapUsedBefore(CachedBlueprints, Stamp);
+    CacheStats.CachedCount = CachedBlueprints.Num();
+    return Freed;
+}
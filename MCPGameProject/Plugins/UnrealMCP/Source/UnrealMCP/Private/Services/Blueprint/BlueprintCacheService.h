@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Blueprint.h"
+#include "MCPCacheBudget.h"
 
 /**
  * Cache statistics for monitoring performance
@@ -43,8 +44,17 @@ struct UNREALMCP_API FBlueprintCacheStats
 /**
  * Blueprint cache for performance optimization
  * Thread-safe caching of frequently accessed blueprints with statistics and warming
+ *
+ * Besides the loaded blueprints, the cache remembers which package each looked-up name resolved
+ * to and when it was last used. That mapping is saved to Saved/UnrealMCP/BlueprintCache.json and
+ * read back on the next editor launch, where entries whose package file changed or disappeared
+ * are dropped. The most recently used blueprints are then loaded asynchronously, so the first
+ * commands of a session neither search for them nor load them synchronously.
+ *
+ * Loaded blueprints are held weakly, so FMCPCacheBudget evicting one only forgets the name lookup;
+ * the name to package mapping is kept, so the next lookup loads it without searching.
  */
-class UNREALMCP_API FBlueprintCache
+class UNREALMCP_API FBlueprintCache : public IMCPBudgetedCache
 {
 public:
     /**
@@ -108,9 +118,80 @@ public:
      */
     bool IsCached(const FString& BlueprintName) const;
 
+    /**
+     * Get the package a name resolved to before, possibly in an earlier editor session
+     * @param BlueprintName - Name the blueprint was looked up by
+     * @return Long package name, or empty if the name is unknown
+     */
+    FString GetKnownPackage(const FString& BlueprintName) const;
+
+    /**
+     * Forget where a name resolved to (call when its package no longer holds the blueprint)
+     * @param BlueprintName - Name the blueprint was looked up by
+     */
+    void ForgetKnownPackage(const FString& BlueprintName);
+
+    /**
+     * Read the name to package mapping saved by the last session and load its most recently used
+     * blueprints asynchronously once the engine has finished starting
+     * @param MaxPreloads - Most blueprints to preload
+     */
+    void WarmStart(int32 MaxPreloads = DefaultMaxPreloads);
+
+    /**
+     * Save the name to package mapping for the next session
+     */
+    void SavePersistentState() const;
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+    /** Blueprints preloaded by default at warm start */
+    static constexpr int32 DefaultMaxPreloads = 32;
+
+    /** Most name to package entries kept across sessions */
+    static constexpr int32 MaxPersistentEntries = 256;
+
 private:
-    /** Map of blueprint names to weak object pointers */
-    TMap<FString, TWeakObjectPtr<UBlueprint>> CachedBlueprints;
+    /** Where a name resolved to, and when it was last used */
+    struct FKnownPackage
+    {
+        FString PackageName;
+        FDateTime LastUsed;
+    };
+
+    /** Map of blueprint names to the packages they resolved to */
+    TMap<FString, FKnownPackage> KnownPackages;
+
+    /** @return Path of the file the name to package mapping is saved to */
+    static FString GetPersistentStatePath();
+
+    /**
+     * Read the saved mapping, dropping entries whose package file changed since it was saved
+     * @return Number of entries read
+     */
+    int32 LoadPersistentState();
+
+    /**
+     * Start asynchronous loads for the most recently used known packages
+     * @param MaxPreloads - Most blueprints to preload
+     */
+    void PreloadRecentBlueprints(int32 MaxPreloads);
+
+    /** A looked-up blueprint */
+    struct FCachedBlueprint
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    /** Cache the blueprint under a name, used now, replacing any entry of that name; lock held */
+    void AddEntry(const FString& BlueprintName, UBlueprint* Blueprint);
+
+    /** Map of blueprint names to the blueprints they were found as */
+    TMap<FString, FCachedBlueprint> CachedBlueprints;
 
     /** Cache statistics for monitoring */
     mutable FBlueprintCacheStats CacheStats;
@@ -0,0 +1,282 @@
+#include "Services/Blueprint/BlueprintMetadataBuilderService.h"
+#include "Utils/GraphUtils.h"
+#include "Services/GraphFingerprintCache.h"
+#include "Engine/Blueprint.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+
+TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildGraphNodesInfo(UBlueprint* Blueprint, const FGraphNodesFilter& Filter) const
+{
+    TSharedPtr<FJsonObject> GraphNodesInfo = MakeShared<FJsonObject>();
+    TArray<TSharedPtr<FJsonValue>> GraphsList;
+
+    // Resume after the last node of the previous page
+    FString CursorGraph;
+    FGuid CursorGuid;
+    if (!Filter.Cursor.IsEmpty())
+    {
+        FString CursorGuidString;
+        if (!Filter.Cursor.Split(TEXT("|"), &CursorGraph, &CursorGuidString, ESearchCase::CaseSensitive, ESearchDir::FromEnd) ||
+            !FGuid::Parse(CursorGuidString, CursorGuid))
+        {
+            GraphNodesInfo->SetStringField(TEXT("error"), FString::Printf(TEXT("Invalid cursor '%s'"), *Filter.Cursor));
+            return GraphNodesInfo;
+        }
+    }
+    bool bCursorGraphReached = Filter.Cursor.IsEmpty();
+
+    int32 RemainingNodes = Filter.MaxNodes > 0 ? Filter.MaxNodes : MAX_int32;
+    bool bHasMore = false;
+    FString LastListedGraph;
+    FGuid LastListedGuid;
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (!Graph) continue;
+
+        if (!Filter.GraphName.IsEmpty() && Graph->GetName() != Filter.GraphName)
+        {
+            continue;
+        }
+
+        bool bResumeInGraph = false;
+        if (!bCursorGraphReached)
+        {
+            if (Graph->GetName() != CursorGraph)
+            {
+                continue;
+            }
+            bCursorGraphReached = true;
+            bResumeInGraph = true;
+        }
+
+        const FString GraphHash = FGraphFingerprintCache::ToString(FGraphFingerprintCache::Get().GetFingerprint(Graph));
+        if (!Filter.IfGraphHash.IsEmpty() && Filter.Cursor.IsEmpty() && GraphHash == Filter.IfGraphHash)
+        {
+            // The caller's copy of the nodes is still current
+            TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+            GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+            GraphObj->SetStringField(TEXT("graph_hash"), GraphHash);
+            GraphObj->SetBoolField(TEXT("unchanged"), true);
+            GraphsList.Add(MakeShared<FJsonValueObject>(GraphObj));
+            continue;
+        }
+
+        TArray<UEdGraphNode*> MatchingNodes;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node) continue;
+
+            if (!MatchesNodeTypeFilter(Node, Filter.NodeType)) continue;
+            if (!MatchesEventTypeFilter(Node, Filter.EventType)) continue;
+
+            MatchingNodes.Add(Node);
+        }
+        MatchingNodes.Sort([](const UEdGraphNode& A, const UEdGraphNode& B)
+        {
+            return A.NodeGuid < B.NodeGuid;
+        });
+
+        TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+        GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+        GraphObj->SetStringField(TEXT("graph_hash"), GraphHash);
+
+        TArray<TSharedPtr<FJsonValue>> NodesList;
+
+        for (UEdGraphNode* Node : MatchingNodes)
+        {
+            if (bResumeInGraph && !(CursorGuid < Node->NodeGuid))
+            {
+                continue;
+            }
+
+            if (RemainingNodes == 0)
+            {
+                // The page is full and this node starts the next one
+                bHasMore = true;
+                break;
+            }
+            --RemainingNodes;
+            LastListedGraph = Graph->GetName();
+            LastListedGuid = Node->NodeGuid;
+
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("id"), FGraphUtils::GetReliableNodeId(Node));
+            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+
+            if (Filter.DetailLevel != EGraphNodesDetailLevel::Summary)
+            {
+                TSharedPtr<FJsonObject> PinsObj = MakeShared<FJsonObject>();
+                TArray<TSharedPtr<FJsonValue>> CompactPinsList;
+
+                for (UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin) continue;
+
+                    bool bIsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+                    if (Filter.DetailLevel == EGraphNodesDetailLevel::Flow && !bIsExecPin)
+                    {
+                        continue;
+                    }
+
+                    FString PinName = Pin->PinName.ToString();
+
+                    if (Pin->LinkedTo.Num() > 0)
+                    {
+                        TArray<TSharedPtr<FJsonValue>> ConnectionsList;
+                        TArray<FString> CompactConnections;
+                        for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+                        {
+                            if (LinkedPin && LinkedPin->GetOwningNode())
+                            {
+                                UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
+                                if (Filter.bCompactPins)
+                                {
+                                    // The linked node's title is on its own entry
+                                    CompactConnections.Add(FString::Printf(TEXT("%s.%s"),
+                                        *FGraphUtils::GetReliableNodeId(LinkedNode),
+                                        *LinkedPin->PinName.ToString()));
+                                    continue;
+                                }
+                                FString CompactConn = FString::Printf(TEXT("%s|%s|%s"),
+                                    *FGraphUtils::GetReliableNodeId(LinkedNode),
+                                    *LinkedNode->GetNodeTitle(ENodeTitleType::ListView).ToString(),
+                                    *LinkedPin->PinName.ToString());
+                                ConnectionsList.Add(MakeShared<FJsonValueString>(CompactConn));
+                            }
+                        }
+                        if (Filter.bCompactPins)
+                        {
+                            CompactPinsList.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s%s%s"),
+                                *PinName, Pin->Direction == EGPD_Input ? TEXT("<-") : TEXT("->"),
+                                *FString::Join(CompactConnections, TEXT(",")))));
+                        }
+                        else
+                        {
+                            PinsObj->SetArrayField(PinName, ConnectionsList);
+                        }
+                    }
+                    else if (Pin->Direction == EGPD_Input && Filter.DetailLevel == EGraphNodesDetailLevel::Full)
+                    {
+                        FString DefaultValue = Pin->DefaultValue;
+                        if (DefaultValue.IsEmpty() && Pin->DefaultObject)
+                        {
+                            DefaultValue = Pin->DefaultObject->GetName();
+                        }
+                        if (DefaultValue.IsEmpty() && !Pin->DefaultTextValue.IsEmpty())
+                        {
+                            DefaultValue = Pin->DefaultTextValue.ToString();
+                        }
+                        if (!DefaultValue.IsEmpty())
+                        {
+                            if (Filter.bCompactPins)
+                            {
+                                CompactPinsList.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s=%s"), *PinName, *DefaultValue)));
+                            }
+                            else
+                            {
+                                PinsObj->SetStringField(PinName, DefaultValue);
+                            }
+                        }
+                    }
+                }
+
+                if (Filter.bCompactPins)
+                {
+                    NodeObj->SetArrayField(TEXT("pins"), CompactPinsList);
+                }
+                else
+                {
+                    NodeObj->SetObjectField(TEXT("pins"), PinsObj);
+                }
+            }
+
+            NodesList.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+
+        // A graph whose first listed node would start the next page belongs to that page
+        if (NodesList.Num() > 0 || !bHasMore)
+        {
+            GraphObj->SetArrayField(TEXT("nodes"), NodesList);
+            GraphObj->SetNumberField(TEXT("node_count"), NodesList.Num());
+            GraphObj->SetNumberField(TEXT("matching_node_count"), MatchingNodes.Num());
+            GraphsList.Add(MakeShared<FJsonValueObject>(GraphObj));
+        }
+
+        if (bHasMore)
+        {
+            break;
+        }
+    }
+
+    if (!bCursorGraphReached)
+    {
+        GraphNodesInfo->SetStringField(TEXT("error"), FString::Printf(TEXT("Graph '%s' of the cursor no longer exists"), *CursorGraph));
+        return GraphNodesInfo;
+    }
+
+    GraphNodesInfo->SetArrayField(TEXT("graphs"), GraphsList);
+    GraphNodesInfo->SetNumberField(TEXT("graph_count"), GraphsList.Num());
+    GraphNodesInfo->SetBoolField(TEXT("has_more"), bHasMore);
+    if (bHasMore)
+    {
+        GraphNodesInfo->SetStringField(TEXT("next_cursor"), FString::Printf(TEXT("%s|%s"), *LastListedGraph, *LastListedGuid.ToString()));
+    }
+
+    return GraphNodesInfo;
+}
+
+bool FBlueprintMetadataBuilderService::MatchesNodeTypeFilter(UEdGraphNode* Node, const FString& NodeType) const
+{
+    if (NodeType.IsEmpty()) return true;
+
+    FString NodeTypeLower = NodeType.ToLower();
+
+    if (NodeTypeLower == TEXT("event"))
+    {
+        return Node->IsA<UK2Node_Event>();
+    }
+    if (NodeTypeLower == TEXT("function"))
+    {
+        return Node->IsA<UK2Node_FunctionEntry>() || Node->GetClass()->GetName().Contains(TEXT("CallFunction"));
+    }
+    if (NodeTypeLower == TEXT("variable"))
+    {
+        FString ClassName = Node->GetClass()->GetName();
+        return ClassName.Contains(TEXT("VariableGet")) || ClassName.Contains(TEXT("VariableSet"));
+    }
+    if (NodeTypeLower == TEXT("comment"))
+    {
+        return Node->GetClass()->GetName().Contains(TEXT("Comment"));
+    }
+
+    return Node->GetClass()->GetName().Contains(NodeType);
+}
+
+bool FBlueprintMetadataBuilderService::MatchesEventTypeFilter(UEdGraphNode* Node, const FString& EventType) const
+{
+    if (EventType.IsEmpty()) return true;
+
+    UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+    if (!EventNode) return false;
+
+    FName EventFuncName = EventNode->GetFunctionName();
+    FString EventName = EventFuncName.ToString();
+
+    FString EventTypeLower = EventType.ToLower();
+
+    if (EventTypeLower == TEXT("beginplay")) return EventName.Contains(TEXT("BeginPlay"));
+    if (EventTypeLower == TEXT("tick")) return EventName.Contains(TEXT("Tick"));
+    if (EventTypeLower == TEXT("endplay")) return EventName.Contains(TEXT("EndPlay"));
+    if (EventTypeLower == TEXT("destroyed")) return EventName.Contains(TEXT("Destroyed"));
+    if (EventTypeLower == TEXT("constructed") || EventTypeLower == TEXT("construct"))
+    {
+        return EventName.Contains(TEXT("Construct"));
+    }
+
+    return EventName.Contains(EventType);
+}
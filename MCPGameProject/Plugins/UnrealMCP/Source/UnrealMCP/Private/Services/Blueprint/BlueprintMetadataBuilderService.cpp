@@ -1,6 +1,9 @@
 #include "Services/Blueprint/BlueprintMetadataBuilderService.h"
 #include "Services/IBlueprintService.h"
 #include "Utils/GraphUtils.h"
+#include "Services/GraphFingerprintCache.h"
+#include "Services/GraphReachabilityCache.h"
+#include "Services/BlueprintComponentLookupCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/SCS_Node.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -306,238 +309,223 @@ TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildComponentProperti
         return Result;
     }
 
-    // Get components from Simple Construction Script
-    if (Blueprint->SimpleConstructionScript)
+    // Construction script nodes, inherited nodes and native components, by name
+    FBlueprintComponentLookupCache::FComponent Component;
+    if (!FBlueprintComponentLookupCache::Get().Find(Blueprint, ComponentName, Component))
     {
-        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-        {
-            if (Node && Node->ComponentTemplate)
-            {
-                FString CurrentName = Node->GetVariableName().ToString();
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("Component '%s' not found in Blueprint"), *ComponentName));
+        return Result;
+    }
 
-                // Only process the requested component
-                if (!CurrentName.Equals(ComponentName, ESearchCase::IgnoreCase))
-                {
-                    continue;
-                }
-                TSharedPtr<FJsonObject> CompObj = MakeShared<FJsonObject>();
-                CompObj->SetStringField(TEXT("name"), Node->GetVariableName().ToString());
-                CompObj->SetStringField(TEXT("type"), Node->ComponentTemplate->GetClass()->GetName());
+    UActorComponent* ComponentTemplate = Component.Template;
+    const FString CurrentName = Component.Node ? Component.Node->GetVariableName().ToString() : ComponentTemplate->GetName();
 
-                // Extract properties from the component template
-                TSharedPtr<FJsonObject> PropertiesObj = MakeShared<FJsonObject>();
-                UActorComponent* ComponentTemplate = Node->ComponentTemplate;
-                UClass* ComponentClass = ComponentTemplate->GetClass();
+    // Extract properties from the component template
+    TSharedPtr<FJsonObject> PropertiesObj = MakeShared<FJsonObject>();
+    UClass* ComponentClass = ComponentTemplate->GetClass();
 
-                // Iterate through all blueprint-visible properties
-                for (TFieldIterator<FProperty> PropIt(ComponentClass); PropIt; ++PropIt)
-                {
-                    FProperty* Property = *PropIt;
-                    if (!Property) continue;
+    // Iterate through all blueprint-visible properties
+    for (TFieldIterator<FProperty> PropIt(ComponentClass); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        if (!Property) continue;
 
-                    // Only include editable/visible properties
-                    if (!Property->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
-                        continue;
+        // Only include editable/visible properties
+        if (!Property->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
+            continue;
 
-                    FString PropName = Property->GetName();
-                    void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ComponentTemplate);
+        FString PropName = Property->GetName();
+        void* ValuePtr = Property->ContainerPtrToValuePtr<void>(ComponentTemplate);
 
-                    // Handle different property types
-                    if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
-                    {
-                        bool Value = BoolProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetBoolField(PropName, Value);
-                    }
-                    else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
-                    {
-                        int32 Value = IntProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetNumberField(PropName, Value);
-                    }
-                    else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
-                    {
-                        float Value = FloatProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetNumberField(PropName, Value);
-                    }
-                    else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+        // Handle different property types
+        if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
+        {
+            bool Value = BoolProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetBoolField(PropName, Value);
+        }
+        else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
+        {
+            int32 Value = IntProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetNumberField(PropName, Value);
+        }
+        else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+        {
+            float Value = FloatProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetNumberField(PropName, Value);
+        }
+        else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
+        {
+            double Value = DoubleProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetNumberField(PropName, Value);
+        }
+        else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+        {
+            FString Value = StrProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetStringField(PropName, Value);
+        }
+        else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+        {
+            FName Value = NameProp->GetPropertyValue(ValuePtr);
+            PropertiesObj->SetStringField(PropName, Value.ToString());
+        }
+        else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+        {
+            UObject* ObjValue = ObjProp->GetPropertyValue(ValuePtr);
+            if (ObjValue)
+            {
+                PropertiesObj->SetStringField(PropName, ObjValue->GetPathName());
+            }
+            else
+            {
+                PropertiesObj->SetStringField(PropName, TEXT("None"));
+            }
+        }
+        else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+        {
+            FNumericProperty* UnderlyingProp = EnumProp->GetUnderlyingProperty();
+            int64 Value = UnderlyingProp->GetSignedIntPropertyValue(ValuePtr);
+            UEnum* Enum = EnumProp->GetEnum();
+            if (Enum)
+            {
+                PropertiesObj->SetStringField(PropName, Enum->GetNameStringByValue(Value));
+            }
+            else
+            {
+                PropertiesObj->SetNumberField(PropName, Value);
+            }
+        }
+        else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+        {
+            uint8 Value = ByteProp->GetPropertyValue(ValuePtr);
+            if (ByteProp->Enum)
+            {
+                PropertiesObj->SetStringField(PropName, ByteProp->Enum->GetNameStringByValue(Value));
+            }
+            else
+            {
+                PropertiesObj->SetNumberField(PropName, Value);
+            }
+        }
+        else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+        {
+            // Handle common struct types
+            if (StructProp->Struct == TBaseStructure<FVector>::Get())
+            {
+                FVector* VecValue = static_cast<FVector*>(ValuePtr);
+                TArray<TSharedPtr<FJsonValue>> VecArray;
+                VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->X));
+                VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->Y));
+                VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->Z));
+                PropertiesObj->SetArrayField(PropName, VecArray);
+            }
+            else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
+            {
+                FRotator* RotValue = static_cast<FRotator*>(ValuePtr);
+                TArray<TSharedPtr<FJsonValue>> RotArray;
+                RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Pitch));
+                RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Yaw));
+                RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Roll));
+                PropertiesObj->SetArrayField(PropName, RotArray);
+            }
+            else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
+            {
+                FLinearColor* ColorValue = static_cast<FLinearColor*>(ValuePtr);
+                TArray<TSharedPtr<FJsonValue>> ColorArray;
+                ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->R));
+                ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->G));
+                ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->B));
+                ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->A));
+                PropertiesObj->SetArrayField(PropName, ColorArray);
+            }
+            else if (StructProp->Struct == TBaseStructure<FVector2D>::Get())
+            {
+                FVector2D* Vec2DValue = static_cast<FVector2D*>(ValuePtr);
+                TArray<TSharedPtr<FJsonValue>> Vec2DArray;
+                Vec2DArray.Add(MakeShared<FJsonValueNumber>(Vec2DValue->X));
+                Vec2DArray.Add(MakeShared<FJsonValueNumber>(Vec2DValue->Y));
+                PropertiesObj->SetArrayField(PropName, Vec2DArray);
+            }
+            else if (StructProp->Struct->GetName() == TEXT("BodyInstance"))
+            {
+                // Expand BodyInstance to show key physics properties
+                TSharedPtr<FJsonObject> BodyObj = MakeShared<FJsonObject>();
+                UScriptStruct* BodyStruct = StructProp->Struct;
+
+                for (TFieldIterator<FProperty> BodyPropIt(BodyStruct); BodyPropIt; ++BodyPropIt)
+                {
+                    FProperty* BodyProp = *BodyPropIt;
+                    if (!BodyProp) continue;
+
+                    // Only include important physics properties
+                    FString BodyPropName = BodyProp->GetName();
+                    if (!BodyPropName.StartsWith(TEXT("b")) &&
+                        BodyPropName != TEXT("ObjectType") &&
+                        BodyPropName != TEXT("CollisionEnabled") &&
+                        BodyPropName != TEXT("MassInKgOverride") &&
+                        BodyPropName != TEXT("LinearDamping") &&
+                        BodyPropName != TEXT("AngularDamping") &&
+                        BodyPropName != TEXT("CollisionProfileName"))
                     {
-                        double Value = DoubleProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetNumberField(PropName, Value);
+                        continue;
                     }
-                    else if (FStrProperty* StrProp = CastField<FStrProperty>(Property))
+
+                    void* BodyValuePtr = BodyProp->ContainerPtrToValuePtr<void>(ValuePtr);
+
+                    if (FBoolProperty* BodyBoolProp = CastField<FBoolProperty>(BodyProp))
                     {
-                        FString Value = StrProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetStringField(PropName, Value);
+                        BodyObj->SetBoolField(BodyPropName, BodyBoolProp->GetPropertyValue(BodyValuePtr));
                     }
-                    else if (FNameProperty* NameProp = CastField<FNameProperty>(Property))
+                    else if (FFloatProperty* BodyFloatProp = CastField<FFloatProperty>(BodyProp))
                     {
-                        FName Value = NameProp->GetPropertyValue(ValuePtr);
-                        PropertiesObj->SetStringField(PropName, Value.ToString());
+                        BodyObj->SetNumberField(BodyPropName, BodyFloatProp->GetPropertyValue(BodyValuePtr));
                     }
-                    else if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Property))
+                    else if (FDoubleProperty* BodyDoubleProp = CastField<FDoubleProperty>(BodyProp))
                     {
-                        UObject* ObjValue = ObjProp->GetPropertyValue(ValuePtr);
-                        if (ObjValue)
-                        {
-                            PropertiesObj->SetStringField(PropName, ObjValue->GetPathName());
-                        }
-                        else
-                        {
-                            PropertiesObj->SetStringField(PropName, TEXT("None"));
-                        }
+                        BodyObj->SetNumberField(BodyPropName, BodyDoubleProp->GetPropertyValue(BodyValuePtr));
                     }
-                    else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
+                    else if (FByteProperty* BodyByteProp = CastField<FByteProperty>(BodyProp))
                     {
-                        FNumericProperty* UnderlyingProp = EnumProp->GetUnderlyingProperty();
-                        int64 Value = UnderlyingProp->GetSignedIntPropertyValue(ValuePtr);
-                        UEnum* Enum = EnumProp->GetEnum();
-                        if (Enum)
+                        uint8 ByteVal = BodyByteProp->GetPropertyValue(BodyValuePtr);
+                        if (BodyByteProp->Enum)
                         {
-                            PropertiesObj->SetStringField(PropName, Enum->GetNameStringByValue(Value));
+                            BodyObj->SetStringField(BodyPropName, BodyByteProp->Enum->GetNameStringByValue(ByteVal));
                         }
                         else
                         {
-                            PropertiesObj->SetNumberField(PropName, Value);
+                            BodyObj->SetNumberField(BodyPropName, ByteVal);
                         }
                     }
-                    else if (FByteProperty* ByteProp = CastField<FByteProperty>(Property))
+                    else if (FEnumProperty* BodyEnumProp = CastField<FEnumProperty>(BodyProp))
                     {
-                        uint8 Value = ByteProp->GetPropertyValue(ValuePtr);
-                        if (ByteProp->Enum)
-                        {
-                            PropertiesObj->SetStringField(PropName, ByteProp->Enum->GetNameStringByValue(Value));
-                        }
-                        else
+                        FNumericProperty* UnderlyingNumProp = BodyEnumProp->GetUnderlyingProperty();
+                        int64 EnumVal = UnderlyingNumProp->GetSignedIntPropertyValue(BodyValuePtr);
+                        UEnum* BodyEnum = BodyEnumProp->GetEnum();
+                        if (BodyEnum)
                         {
-                            PropertiesObj->SetNumberField(PropName, Value);
+                            BodyObj->SetStringField(BodyPropName, BodyEnum->GetNameStringByValue(EnumVal));
                         }
                     }
-                    else if (FStructProperty* StructProp = CastField<FStructProperty>(Property))
+                    else if (FNameProperty* BodyNameProp = CastField<FNameProperty>(BodyProp))
                     {
-                        // Handle common struct types
-                        if (StructProp->Struct == TBaseStructure<FVector>::Get())
-                        {
-                            FVector* VecValue = static_cast<FVector*>(ValuePtr);
-                            TArray<TSharedPtr<FJsonValue>> VecArray;
-                            VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->X));
-                            VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->Y));
-                            VecArray.Add(MakeShared<FJsonValueNumber>(VecValue->Z));
-                            PropertiesObj->SetArrayField(PropName, VecArray);
-                        }
-                        else if (StructProp->Struct == TBaseStructure<FRotator>::Get())
-                        {
-                            FRotator* RotValue = static_cast<FRotator*>(ValuePtr);
-                            TArray<TSharedPtr<FJsonValue>> RotArray;
-                            RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Pitch));
-                            RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Yaw));
-                            RotArray.Add(MakeShared<FJsonValueNumber>(RotValue->Roll));
-                            PropertiesObj->SetArrayField(PropName, RotArray);
-                        }
-                        else if (StructProp->Struct == TBaseStructure<FLinearColor>::Get())
-                        {
-                            FLinearColor* ColorValue = static_cast<FLinearColor*>(ValuePtr);
-                            TArray<TSharedPtr<FJsonValue>> ColorArray;
-                            ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->R));
-                            ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->G));
-                            ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->B));
-                            ColorArray.Add(MakeShared<FJsonValueNumber>(ColorValue->A));
-                            PropertiesObj->SetArrayField(PropName, ColorArray);
-                        }
-                        else if (StructProp->Struct == TBaseStructure<FVector2D>::Get())
-                        {
-                            FVector2D* Vec2DValue = static_cast<FVector2D*>(ValuePtr);
-                            TArray<TSharedPtr<FJsonValue>> Vec2DArray;
-                            Vec2DArray.Add(MakeShared<FJsonValueNumber>(Vec2DValue->X));
-                            Vec2DArray.Add(MakeShared<FJsonValueNumber>(Vec2DValue->Y));
-                            PropertiesObj->SetArrayField(PropName, Vec2DArray);
-                        }
-                        else if (StructProp->Struct->GetName() == TEXT("BodyInstance"))
-                        {
-                            // Expand BodyInstance to show key physics properties
-                            TSharedPtr<FJsonObject> BodyObj = MakeShared<FJsonObject>();
-                            UScriptStruct* BodyStruct = StructProp->Struct;
-
-                            for (TFieldIterator<FProperty> BodyPropIt(BodyStruct); BodyPropIt; ++BodyPropIt)
-                            {
-                                FProperty* BodyProp = *BodyPropIt;
-                                if (!BodyProp) continue;
-
-                                // Only include important physics properties
-                                FString BodyPropName = BodyProp->GetName();
-                                if (!BodyPropName.StartsWith(TEXT("b")) &&
-                                    BodyPropName != TEXT("ObjectType") &&
-                                    BodyPropName != TEXT("CollisionEnabled") &&
-                                    BodyPropName != TEXT("MassInKgOverride") &&
-                                    BodyPropName != TEXT("LinearDamping") &&
-                                    BodyPropName != TEXT("AngularDamping") &&
-                                    BodyPropName != TEXT("CollisionProfileName"))
-                                {
-                                    continue;
-                                }
-
-                                void* BodyValuePtr = BodyProp->ContainerPtrToValuePtr<void>(ValuePtr);
-
-                                if (FBoolProperty* BodyBoolProp = CastField<FBoolProperty>(BodyProp))
-                                {
-                                    BodyObj->SetBoolField(BodyPropName, BodyBoolProp->GetPropertyValue(BodyValuePtr));
-                                }
-                                else if (FFloatProperty* BodyFloatProp = CastField<FFloatProperty>(BodyProp))
-                                {
-                                    BodyObj->SetNumberField(BodyPropName, BodyFloatProp->GetPropertyValue(BodyValuePtr));
-                                }
-                                else if (FDoubleProperty* BodyDoubleProp = CastField<FDoubleProperty>(BodyProp))
-                                {
-                                    BodyObj->SetNumberField(BodyPropName, BodyDoubleProp->GetPropertyValue(BodyValuePtr));
-                                }
-                                else if (FByteProperty* BodyByteProp = CastField<FByteProperty>(BodyProp))
-                                {
-                                    uint8 ByteVal = BodyByteProp->GetPropertyValue(BodyValuePtr);
-                                    if (BodyByteProp->Enum)
-                                    {
-                                        BodyObj->SetStringField(BodyPropName, BodyByteProp->Enum->GetNameStringByValue(ByteVal));
-                                    }
-                                    else
-                                    {
-                                        BodyObj->SetNumberField(BodyPropName, ByteVal);
-                                    }
-                                }
-                                else if (FEnumProperty* BodyEnumProp = CastField<FEnumProperty>(BodyProp))
-                                {
-                                    FNumericProperty* UnderlyingNumProp = BodyEnumProp->GetUnderlyingProperty();
-                                    int64 EnumVal = UnderlyingNumProp->GetSignedIntPropertyValue(BodyValuePtr);
-                                    UEnum* BodyEnum = BodyEnumProp->GetEnum();
-                                    if (BodyEnum)
-                                    {
-                                        BodyObj->SetStringField(BodyPropName, BodyEnum->GetNameStringByValue(EnumVal));
-                                    }
-                                }
-                                else if (FNameProperty* BodyNameProp = CastField<FNameProperty>(BodyProp))
-                                {
-                                    FName NameVal = BodyNameProp->GetPropertyValue(BodyValuePtr);
-                                    BodyObj->SetStringField(BodyPropName, NameVal.ToString());
-                                }
-                            }
-
-                            PropertiesObj->SetObjectField(PropName, BodyObj);
-                        }
-                        else
-                        {
-                            // For other struct types, just indicate the type
-                            PropertiesObj->SetStringField(PropName, FString::Printf(TEXT("[Struct:%s]"), *StructProp->Struct->GetName()));
-                        }
+                        FName NameVal = BodyNameProp->GetPropertyValue(BodyValuePtr);
+                        BodyObj->SetStringField(BodyPropName, NameVal.ToString());
                     }
                 }
 
-                // Found the component - return its properties directly
-                Result->SetStringField(TEXT("name"), CurrentName);
-                Result->SetStringField(TEXT("type"), Node->ComponentTemplate->GetClass()->GetName());
-                Result->SetObjectField(TEXT("properties"), PropertiesObj);
-                return Result;
+                PropertiesObj->SetObjectField(PropName, BodyObj);
+            }
+            else
+            {
+                // For other struct types, just indicate the type
+                PropertiesObj->SetStringField(PropName, FString::Printf(TEXT("[Struct:%s]"), *StructProp->Struct->GetName()));
             }
         }
     }
 
-    // Component not found
-    Result->SetStringField(TEXT("error"), FString::Printf(TEXT("Component '%s' not found in Blueprint"), *ComponentName));
+    // Found the component - return its properties directly
+    Result->SetStringField(TEXT("name"), CurrentName);
+    Result->SetStringField(TEXT("type"), ComponentTemplate->GetClass()->GetName());
+    Result->SetObjectField(TEXT("properties"), PropertiesObj);
     return Result;
 }
 
@@ -555,6 +543,7 @@ TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildGraphsInfo(UBluep
         {
             TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
             GraphObj->SetStringField(TEXT("name"), Graph->GetName());
+            GraphObj->SetStringField(TEXT("graph_hash"), FGraphFingerprintCache::ToString(FGraphFingerprintCache::Get().GetFingerprint(Graph)));
             GraphObj->SetNumberField(TEXT("node_count"), Graph->Nodes.Num());
             GraphsList.Add(MakeShared<FJsonValueObject>(GraphObj));
         }
@@ -662,6 +651,8 @@ TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildOrphanedNodesInfo
 {
     TSharedPtr<FJsonObject> OrphanedInfo = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> OrphanedNodesList;
+    TArray<TSharedPtr<FJsonValue>> OrphanedPinsList;
+    int32 PureCount = 0;
 
     TArray<UEdGraph*> AllGraphs;
     Blueprint->GetAllGraphs(AllGraphs);
@@ -670,27 +661,53 @@ TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildOrphanedNodesInfo
     {
         if (!Graph) continue;
 
-        TArray<TSharedPtr<FJsonObject>> OrphanedNodes;
-        if (FGraphUtils::GetOrphanedNodesInfo(Graph, OrphanedNodes))
+        const FGraphReachabilityCache::FAnalysis& Analysis = FGraphReachabilityCache::Get().Analyze(Graph);
+        for (const FGraphReachabilityCache::FOrphanedNode& Orphan : Analysis.OrphanedNodes)
         {
-            for (const TSharedPtr<FJsonObject>& NodeInfo : OrphanedNodes)
+            UEdGraphNode* Node = Orphan.Node.Get();
+            if (!Node) continue;
+
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("id"), FGraphUtils::GetReliableNodeId(Node));
+            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
+            NodeObj->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+            NodeObj->SetNumberField(TEXT("pos_x"), Node->NodePosX);
+            NodeObj->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+            NodeObj->SetNumberField(TEXT("input_connections"), Orphan.InputConnections);
+            NodeObj->SetNumberField(TEXT("output_connections"), Orphan.OutputConnections);
+            NodeObj->SetBoolField(TEXT("pure"), Orphan.bPure);
+            OrphanedNodesList.Add(MakeShared<FJsonValueObject>(NodeObj));
+            PureCount += Orphan.bPure ? 1 : 0;
+        }
+
+        // Pins reconstruction kept because they were still linked, e.g. after a function lost a parameter
+        for (const FGraphReachabilityCache::FOrphanedPinNode& PinNode : Analysis.OrphanedPinNodes)
+        {
+            UEdGraphNode* Node = PinNode.Node.Get();
+            if (!Node) continue;
+
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("id"), FGraphUtils::GetReliableNodeId(Node));
+            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
+            TArray<TSharedPtr<FJsonValue>> PinNames;
+            for (const FString& PinName : PinNode.PinNames)
             {
-                TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
-                NodeObj->SetStringField(TEXT("id"), NodeInfo->GetStringField(TEXT("node_id")));
-                NodeObj->SetStringField(TEXT("title"), NodeInfo->GetStringField(TEXT("title")));
-                NodeObj->SetStringField(TEXT("graph"), Graph->GetName());
-                NodeObj->SetStringField(TEXT("class"), NodeInfo->GetStringField(TEXT("class")));
-                NodeObj->SetNumberField(TEXT("pos_x"), NodeInfo->GetNumberField(TEXT("pos_x")));
-                NodeObj->SetNumberField(TEXT("pos_y"), NodeInfo->GetNumberField(TEXT("pos_y")));
-                NodeObj->SetNumberField(TEXT("input_connections"), NodeInfo->GetNumberField(TEXT("input_connections")));
-                NodeObj->SetNumberField(TEXT("output_connections"), NodeInfo->GetNumberField(TEXT("output_connections")));
-                OrphanedNodesList.Add(MakeShared<FJsonValueObject>(NodeObj));
+                PinNames.Add(MakeShared<FJsonValueString>(PinName));
             }
+            NodeObj->SetArrayField(TEXT("pins"), PinNames);
+            OrphanedPinsList.Add(MakeShared<FJsonValueObject>(NodeObj));
         }
     }
 
     OrphanedInfo->SetArrayField(TEXT("nodes"), OrphanedNodesList);
     OrphanedInfo->SetNumberField(TEXT("count"), OrphanedNodesList.Num());
+    OrphanedInfo->SetNumberField(TEXT("pure_count"), PureCount);
+    if (OrphanedPinsList.Num() > 0)
+    {
+        OrphanedInfo->SetArrayField(TEXT("orphaned_pins"), OrphanedPinsList);
+    }
 
     return OrphanedInfo;
 }
@@ -756,107 +773,6 @@ TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildGraphWarningsInfo
     return WarningsInfo;
 }
 
-TSharedPtr<FJsonObject> FBlueprintMetadataBuilderService::BuildGraphNodesInfo(UBlueprint* Blueprint, const FGraphNodesFilter& Filter) const
-{
-    TSharedPtr<FJsonObject> GraphNodesInfo = MakeShared<FJsonObject>();
-    TArray<TSharedPtr<FJsonValue>> GraphsList;
-
-    TArray<UEdGraph*> AllGraphs;
-    Blueprint->GetAllGraphs(AllGraphs);
-
-    for (UEdGraph* Graph : AllGraphs)
-    {
-        if (!Graph) continue;
-
-        if (!Filter.GraphName.IsEmpty() && Graph->GetName() != Filter.GraphName)
-        {
-            continue;
-        }
-
-        TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
-        GraphObj->SetStringField(TEXT("name"), Graph->GetName());
-
-        TArray<TSharedPtr<FJsonValue>> NodesList;
-
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (!Node) continue;
-
-            if (!MatchesNodeTypeFilter(Node, Filter.NodeType)) continue;
-            if (!MatchesEventTypeFilter(Node, Filter.EventType)) continue;
-
-            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
-            NodeObj->SetStringField(TEXT("id"), FGraphUtils::GetReliableNodeId(Node));
-            NodeObj->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-
-            if (Filter.DetailLevel != EGraphNodesDetailLevel::Summary)
-            {
-                TSharedPtr<FJsonObject> PinsObj = MakeShared<FJsonObject>();
-
-                for (UEdGraphPin* Pin : Node->Pins)
-                {
-                    if (!Pin) continue;
-
-                    bool bIsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
-                    if (Filter.DetailLevel == EGraphNodesDetailLevel::Flow && !bIsExecPin)
-                    {
-                        continue;
-                    }
-
-                    FString PinName = Pin->PinName.ToString();
-
-                    if (Pin->LinkedTo.Num() > 0)
-                    {
-                        TArray<TSharedPtr<FJsonValue>> ConnectionsList;
-                        for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-                        {
-                            if (LinkedPin && LinkedPin->GetOwningNode())
-                            {
-                                UEdGraphNode* LinkedNode = LinkedPin->GetOwningNode();
-                                FString CompactConn = FString::Printf(TEXT("%s|%s|%s"),
-                                    *FGraphUtils::GetReliableNodeId(LinkedNode),
-                                    *LinkedNode->GetNodeTitle(ENodeTitleType::ListView).ToString(),
-                                    *LinkedPin->PinName.ToString());
-                                ConnectionsList.Add(MakeShared<FJsonValueString>(CompactConn));
-                            }
-                        }
-                        PinsObj->SetArrayField(PinName, ConnectionsList);
-                    }
-                    else if (Pin->Direction == EGPD_Input && Filter.DetailLevel == EGraphNodesDetailLevel::Full)
-                    {
-                        FString DefaultValue = Pin->DefaultValue;
-                        if (DefaultValue.IsEmpty() && Pin->DefaultObject)
-                        {
-                            DefaultValue = Pin->DefaultObject->GetName();
-                        }
-                        if (DefaultValue.IsEmpty() && !Pin->DefaultTextValue.IsEmpty())
-                        {
-                            DefaultValue = Pin->DefaultTextValue.ToString();
-                        }
-                        if (!DefaultValue.IsEmpty())
-                        {
-                            PinsObj->SetStringField(PinName, DefaultValue);
-                        }
-                    }
-                }
-
-                NodeObj->SetObjectField(TEXT("pins"), PinsObj);
-            }
-
-            NodesList.Add(MakeShared<FJsonValueObject>(NodeObj));
-        }
-
-        GraphObj->SetArrayField(TEXT("nodes"), NodesList);
-        GraphObj->SetNumberField(TEXT("node_count"), NodesList.Num());
-        GraphsList.Add(MakeShared<FJsonValueObject>(GraphObj));
-    }
-
-    GraphNodesInfo->SetArrayField(TEXT("graphs"), GraphsList);
-    GraphNodesInfo->SetNumberField(TEXT("graph_count"), GraphsList.Num());
-
-    return GraphNodesInfo;
-}
-
 FString FBlueprintMetadataBuilderService::GetPinTypeAsString(const FEdGraphPinType& PinType) const
 {
     if (PinType.PinCategory == UEdGraphSchema_K2::PC_Boolean) return TEXT("bool");
@@ -914,54 +830,3 @@ FString FBlueprintMetadataBuilderService::GetPinTypeAsString(const FEdGraphPinTy
 
     return PinType.PinCategory.ToString();
 }
-
-bool FBlueprintMetadataBuilderService::MatchesNodeTypeFilter(UEdGraphNode* Node, const FString& NodeType) const
-{
-    if (NodeType.IsEmpty()) return true;
-
-    FString NodeTypeLower = NodeType.ToLower();
-
-    if (NodeTypeLower == TEXT("event"))
-    {
-        return Node->IsA<UK2Node_Event>();
-    }
-    if (NodeTypeLower == TEXT("function"))
-    {
-        return Node->IsA<UK2Node_FunctionEntry>() || Node->GetClass()->GetName().Contains(TEXT("CallFunction"));
-    }
-    if (NodeTypeLower == TEXT("variable"))
-    {
-        FString ClassName = Node->GetClass()->GetName();
-        return ClassName.Contains(TEXT("VariableGet")) || ClassName.Contains(TEXT("VariableSet"));
-    }
-    if (NodeTypeLower == TEXT("comment"))
-    {
-        return Node->GetClass()->GetName().Contains(TEXT("Comment"));
-    }
-
-    return Node->GetClass()->GetName().Contains(NodeType);
-}
-
-bool FBlueprintMetadataBuilderService::MatchesEventTypeFilter(UEdGraphNode* Node, const FString& EventType) const
-{
-    if (EventType.IsEmpty()) return true;
-
-    UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-    if (!EventNode) return false;
-
-    FName EventFuncName = EventNode->GetFunctionName();
-    FString EventName = EventFuncName.ToString();
-
-    FString EventTypeLower = EventType.ToLower();
-
-    if (EventTypeLower == TEXT("beginplay")) return EventName.Contains(TEXT("BeginPlay"));
-    if (EventTypeLower == TEXT("tick")) return EventName.Contains(TEXT("Tick"));
-    if (EventTypeLower == TEXT("endplay")) return EventName.Contains(TEXT("EndPlay"));
-    if (EventTypeLower == TEXT("destroyed")) return EventName.Contains(TEXT("Destroyed"));
-    if (EventTypeLower == TEXT("constructed") || EventTypeLower == TEXT("construct"))
-    {
-        return EventName.Contains(TEXT("Construct"));
-    }
-
-    return EventName.Contains(EventType);
-}
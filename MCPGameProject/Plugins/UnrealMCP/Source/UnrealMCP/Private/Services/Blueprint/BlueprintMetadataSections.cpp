@@ -0,0 +1,100 @@
+#include "Services/Blueprint/BlueprintMetadataBuilderService.h"
+#include "Dom/JsonObject.h"
+
+TConstArrayView<FMetadataSectionInfo> FBlueprintMetadataBuilderService::GetSections()
+{
+    static const FMetadataSectionInfo Sections[] =
+    {
+        { TEXT("parent_class"), EMetadataSectionCost::Cheap },
+        { TEXT("interfaces"), EMetadataSectionCost::Moderate },
+        { TEXT("variables"), EMetadataSectionCost::Moderate },
+        { TEXT("functions"), EMetadataSectionCost::Moderate },
+        { TEXT("components"), EMetadataSectionCost::Cheap },
+        { TEXT("component_properties"), EMetadataSectionCost::Expensive },
+        { TEXT("graphs"), EMetadataSectionCost::Moderate },
+        { TEXT("status"), EMetadataSectionCost::Cheap },
+        { TEXT("metadata"), EMetadataSectionCost::Cheap },
+        { TEXT("timelines"), EMetadataSectionCost::Cheap },
+        { TEXT("asset_info"), EMetadataSectionCost::Cheap },
+        { TEXT("orphaned_nodes"), EMetadataSectionCost::Expensive },
+        { TEXT("graph_warnings"), EMetadataSectionCost::Expensive },
+        { TEXT("graph_nodes"), EMetadataSectionCost::Expensive },
+    };
+    return Sections;
+}
+
+const FMetadataSectionInfo* FBlueprintMetadataBuilderService::FindSection(const FString& SectionName)
+{
+    for (const FMetadataSectionInfo& Section : GetSections())
+    {
+        if (SectionName.Equals(Section.Name, ESearchCase::IgnoreCase))
+        {
+            return &Section;
+        }
+    }
+    return nullptr;
+}
+
+void FBlueprintMetadataBuilderService::ProjectSection(const TSharedPtr<FJsonObject>& Section, const TArray<FString>& Keys)
+{
+    if (!Section.IsValid() || Keys.Num() == 0)
+    {
+        return;
+    }
+
+    // Entries keep their nested entry lists (a graph's nodes), which are projected in turn
+    TFunction<void(const TSharedPtr<FJsonObject>&)> ProjectEntry;
+    ProjectEntry = [&Keys, &ProjectEntry](const TSharedPtr<FJsonObject>& Entry)
+    {
+        TArray<FString> EntryKeys;
+        Entry->Values.GetKeys(EntryKeys);
+        for (const FString& Key : EntryKeys)
+        {
+            const TSharedPtr<FJsonValue>& Value = Entry->Values[Key];
+            if (Value.IsValid() && Value->Type == EJson::Array)
+            {
+                for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+                {
+                    if (Element.IsValid() && Element->Type == EJson::Object)
+                    {
+                        ProjectEntry(Element->AsObject());
+                    }
+                }
+            }
+            else if (!Keys.Contains(Key))
+            {
+                Entry->RemoveField(Key);
+            }
+        }
+    };
+
+    bool bHasArrays = false;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Section->Values)
+    {
+        if (Field.Value.IsValid() && Field.Value->Type == EJson::Array)
+        {
+            bHasArrays = true;
+            for (const TSharedPtr<FJsonValue>& Element : Field.Value->AsArray())
+            {
+                if (Element.IsValid() && Element->Type == EJson::Object)
+                {
+                    ProjectEntry(Element->AsObject());
+                }
+            }
+        }
+    }
+
+    // Sections without entry lists (parent_class, status, ...) are projected on their own keys
+    if (!bHasArrays)
+    {
+        TArray<FString> SectionKeys;
+        Section->Values.GetKeys(SectionKeys);
+        for (const FString& Key : SectionKeys)
+        {
+            if (!Keys.Contains(Key))
+            {
+                Section->RemoveField(Key);
+            }
+        }
+    }
+}
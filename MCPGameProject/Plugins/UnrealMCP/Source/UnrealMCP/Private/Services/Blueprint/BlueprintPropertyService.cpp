@@ -13,6 +13,7 @@
 #include "Engine/Blueprint.h"
 #include "Engine/DataTable.h"
 #include "StructUtils/UserDefinedStruct.h"
+#include "MCPBatchEditScope.h"
 
 bool FBlueprintPropertyService::AddVariableToBlueprint(UBlueprint* Blueprint, const FString& VariableName, const FString& VariableType, bool bIsExposed, FBlueprintCache& Cache)
 {
@@ -133,7 +134,7 @@ bool FBlueprintPropertyService::AddVariableToBlueprint(UBlueprint* Blueprint, co
     FBlueprintEditorUtils::AddMemberVariable(Blueprint, NewVar.VarName, NewVar.VarType);
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Compile blueprint so the variable is immediately available on the CDO
     // This is necessary for set_blueprint_variable_value to work right after adding a variable
@@ -176,7 +177,7 @@ bool FBlueprintPropertyService::SetBlueprintProperty(UBlueprint* Blueprint, cons
     }
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Invalidate cache since blueprint was modified
     Cache.InvalidateBlueprint(Blueprint->GetName());
@@ -370,7 +371,7 @@ bool FBlueprintPropertyService::SetPawnProperties(UBlueprint* Blueprint, const T
     }
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Invalidate cache since blueprint was modified
     Cache.InvalidateBlueprint(Blueprint->GetName());
@@ -0,0 +1,490 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Services/BlueprintAction/BlueprintActionSearchIndex.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintNodeSpawner.h"
+#include "BlueprintFunctionNodeSpawner.h"
+#include "BlueprintEventNodeSpawner.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Algo/BinarySearch.h"
+#include "MCPLogging.h"
+#include "MCPMemory.h"
+
+namespace
+{
+    /** Removed slots tolerated before the index is rebuilt instead of patched */
+    constexpr int32 MaxRemovedSlots = 4096;
+
+    /** Queued database entries above which rebuilding beats patching */
+    constexpr int32 MaxPendingOwners = 512;
+
+    /**
+     * Describe a node spawner the way search_blueprint_actions reports it
+     * @return false for spawners that cannot be described
+     */
+    bool DescribeSpawner(UBlueprintNodeSpawner* NodeSpawner, FBlueprintActionSearchIndex::FEntry& OutEntry, FString& OutKeywords)
+    {
+        OutEntry.Category = TEXT("Unknown");
+
+        // Function spawners (KismetMathLibrary and other function libraries) describe their function
+        if (UBlueprintFunctionNodeSpawner* FunctionSpawner = Cast<UBlueprintFunctionNodeSpawner>(NodeSpawner))
+        {
+            UFunction const* Function = FunctionSpawner->GetFunction();
+            if (!Function)
+            {
+                return false;
+            }
+
+            OutEntry.Title = Function->GetDisplayNameText().ToString();
+            if (OutEntry.Title.IsEmpty())
+            {
+                OutEntry.Title = Function->GetName();
+            }
+            if (Function->HasMetaData(TEXT("Category")))
+            {
+                OutEntry.Category = Function->GetMetaData(TEXT("Category"));
+            }
+            OutEntry.Tooltip = Function->HasMetaData(TEXT("ToolTip")) ? Function->GetMetaData(TEXT("ToolTip")) : Function->GetToolTipText().ToString();
+            if (Function->HasMetaData(TEXT("Keywords")))
+            {
+                OutKeywords = Function->GetMetaData(TEXT("Keywords"));
+            }
+
+            OutEntry.FunctionName = Function->GetName();
+            OutEntry.ClassName = Function->GetOwnerClass()->GetName();
+            OutEntry.bHasClassName = true;
+            OutEntry.bIsMathFunction = Function->GetOwnerClass() == UKismetMathLibrary::StaticClass();
+            return true;
+        }
+
+        // Event spawners (Event Tick, Custom Events, ...) describe themselves in their menu signature
+        if (Cast<UBlueprintEventNodeSpawner>(NodeSpawner))
+        {
+            const FBlueprintActionUiSpec& MenuSignature = NodeSpawner->DefaultMenuSignature;
+            OutEntry.Title = MenuSignature.MenuName.ToString();
+            if (!MenuSignature.Category.IsEmpty())
+            {
+                OutEntry.Category = MenuSignature.Category.ToString();
+            }
+            OutEntry.Tooltip = MenuSignature.Tooltip.ToString();
+            OutKeywords = MenuSignature.Keywords.ToString();
+
+            // "Add Custom Event..." is created as CustomEvent
+            OutEntry.FunctionName = OutEntry.Title.Contains(TEXT("Add Custom Event")) ? FString(TEXT("CustomEvent")) : OutEntry.Title;
+            OutEntry.bHasClassName = true;
+            return true;
+        }
+
+        // Everything else through its template node
+        UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
+        if (!TemplateNode)
+        {
+            return false;
+        }
+
+        OutEntry.Title = TemplateNode->GetNodeTitle(ENodeTitleType::ListView).ToString();
+        OutEntry.Tooltip = TemplateNode->GetTooltipText().ToString();
+        OutKeywords = TemplateNode->GetKeywords().ToString();
+        OutEntry.FunctionName = OutEntry.Title;
+
+        if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
+        {
+            if (UFunction* Function = FunctionNode->GetTargetFunction())
+            {
+                OutEntry.FunctionName = Function->GetName();
+                OutEntry.ClassName = Function->GetOwnerClass()->GetName();
+                OutEntry.bHasClassName = true;
+                OutEntry.bIsMathFunction = Function->GetOwnerClass() == UKismetMathLibrary::StaticClass();
+            }
+            else
+            {
+                OutEntry.FunctionName.Empty();
+            }
+        }
+        return true;
+    }
+
+    /** @return 2 if a word equals the query word, 1 if one starts with it, else 0 */
+    int32 MatchWords(const TArray<FString>& Words, const FString& QueryWord)
+    {
+        int32 Best = 0;
+        for (const FString& Word : Words)
+        {
+            if (Word.Equals(QueryWord, ESearchCase::CaseSensitive))
+            {
+                return 2;
+            }
+            if (Word.StartsWith(QueryWord, ESearchCase::CaseSensitive))
+            {
+                Best = 1;
+            }
+        }
+        return Best;
+    }
+}
+
+FBlueprintActionSearchIndex& FBlueprintActionSearchIndex::Get()
+{
+    static FBlueprintActionSearchIndex Instance;
+    return Instance;
+}
+
+void FBlueprintActionSearchIndex::Shutdown()
+{
+    check(IsInGameThread());
+
+    // The handles are only set once the database exists, so this never creates it
+    if (EntryUpdatedHandle.IsValid())
+    {
+        FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+        Database.OnEntryUpdated().Remove(EntryUpdatedHandle);
+        Database.OnEntryRemoved().Remove(EntryRemovedHandle);
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+        EntryUpdatedHandle.Reset();
+        EntryRemovedHandle.Reset();
+        ReloadCompleteHandle.Reset();
+        FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_action_search_index"));
+    }
+
+    Entries.Empty();
+    SlotsByOwner.Empty();
+    SlotsByWord.Empty();
+    SortedWords.Empty();
+    PendingOwners.Empty();
+    RemovedCount = 0;
+    bBuilt = false;
+}
+
+void FBlueprintActionSearchIndex::Search(const FString& SearchQuery, const FString& CategoryFilter, int32 MaxResults, TArray<const FEntry*>& OutMatches)
+{
+    check(IsInGameThread());
+    OutMatches.Reset();
+    if (MaxResults <= 0)
+    {
+        return;
+    }
+
+    EnsureCurrent();
+
+    const FString LowerQuery = SearchQuery.ToLower();
+    const FString LowerCategory = CategoryFilter.ToLower();
+    TArray<FString> QueryWords;
+    SplitWords(SearchQuery, QueryWords);
+
+    auto MatchesCategory = [&LowerCategory](const FIndexedEntry& Indexed)
+    {
+        return LowerCategory.IsEmpty() || Indexed.LowerCategory.Contains(LowerCategory, ESearchCase::CaseSensitive);
+    };
+
+    // Word matches: the slots having every query word, walked from the rarest word's slots
+    TSet<int32> Included;
+    if (QueryWords.Num() > 0)
+    {
+        TArray<TSet<int32>> SlotsPerWord;
+        SlotsPerWord.SetNum(QueryWords.Num());
+        for (int32 WordIndex = 0; WordIndex < QueryWords.Num(); ++WordIndex)
+        {
+            FindSlotsWithPrefix(QueryWords[WordIndex], SlotsPerWord[WordIndex]);
+        }
+        SlotsPerWord.Sort([](const TSet<int32>& A, const TSet<int32>& B) { return A.Num() < B.Num(); });
+
+        TArray<TPair<int32, int32>> Ranked;
+        for (int32 Slot : SlotsPerWord[0])
+        {
+            bool bHasEveryWord = true;
+            for (int32 WordIndex = 1; WordIndex < SlotsPerWord.Num() && bHasEveryWord; ++WordIndex)
+            {
+                bHasEveryWord = SlotsPerWord[WordIndex].Contains(Slot);
+            }
+
+            const FIndexedEntry& Indexed = Entries[Slot];
+            if (!bHasEveryWord || !IsLive(Indexed) || !MatchesCategory(Indexed))
+            {
+                continue;
+            }
+            if (const int32 Score = ScoreEntry(Indexed, LowerQuery, QueryWords))
+            {
+                Ranked.Emplace(Score, Slot);
+            }
+        }
+
+        // Best score first, then the shorter title, then database order
+        Ranked.Sort([this](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+        {
+            if (A.Key != B.Key)
+            {
+                return A.Key > B.Key;
+            }
+            const int32 LenA = Entries[A.Value].Entry.Title.Len();
+            const int32 LenB = Entries[B.Value].Entry.Title.Len();
+            return LenA != LenB ? LenA < LenB : A.Value < B.Value;
+        });
+
+        for (int32 RankIndex = 0; RankIndex < Ranked.Num() && OutMatches.Num() < MaxResults; ++RankIndex)
+        {
+            OutMatches.Add(&Entries[Ranked[RankIndex].Value].Entry);
+            Included.Add(Ranked[RankIndex].Value);
+        }
+    }
+
+    // Substring matches the words miss: tooltips, the middle of words and operator symbols
+    for (int32 Slot = 0; Slot < Entries.Num() && OutMatches.Num() < MaxResults; ++Slot)
+    {
+        const FIndexedEntry& Indexed = Entries[Slot];
+        if (IsLive(Indexed) && !Included.Contains(Slot) && MatchesCategory(Indexed)
+            && Indexed.LowerText.Contains(LowerQuery, ESearchCase::CaseSensitive))
+        {
+            OutMatches.Add(&Indexed.Entry);
+        }
+    }
+}
+
+void FBlueprintActionSearchIndex::Prewarm()
+{
+    check(IsInGameThread());
+    if (!bBuilt)
+    {
+        Build();
+    }
+}
+
+void FBlueprintActionSearchIndex::EnsureCurrent()
+{
+    if (bBuilt && ((RemovedCount > MaxRemovedSlots && RemovedCount > Entries.Num() / 2) || PendingOwners.Num() > MaxPendingOwners))
+    {
+        bBuilt = false;
+        CacheCounters.RecordInvalidation();
+    }
+    if (!bBuilt)
+    {
+        CacheCounters.RecordMiss();
+        Build();
+        return;
+    }
+    CacheCounters.RecordHit();
+
+    for (const FObjectKey& Owner : PendingOwners)
+    {
+        RemoveOwner(Owner);
+        AddOwner(Owner);
+    }
+    PendingOwners.Reset();
+}
+
+void FBlueprintActionSearchIndex::Build()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    const double StartTime = FPlatformTime::Seconds();
+
+    Entries.Reset();
+    SlotsByOwner.Reset();
+    SlotsByWord.Reset();
+    PendingOwners.Reset();
+    RemovedCount = 0;
+
+    // Getting the database registers every action, so it is complete from here on
+    FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+    if (!EntryUpdatedHandle.IsValid())
+    {
+        EntryUpdatedHandle = Database.OnEntryUpdated().AddRaw(this, &FBlueprintActionSearchIndex::HandleEntryUpdated);
+        EntryRemovedHandle = Database.OnEntryRemoved().AddRaw(this, &FBlueprintActionSearchIndex::HandleEntryRemoved);
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FBlueprintActionSearchIndex::HandleReloadComplete);
+        FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_action_search_index"), TEXT("index"), CacheCounters,
+            [this]() { return static_cast<int64>(Entries.Num() - RemovedCount); });
+    }
+
+    for (auto Iterator(Database.GetAllActions().CreateConstIterator()); Iterator; ++Iterator)
+    {
+        AddOwner(Iterator.Key());
+    }
+    bBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("Blueprint action search index: %d actions, %d words in %.1f ms"),
+        Entries.Num(), SlotsByWord.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FBlueprintActionSearchIndex::AddOwner(const FObjectKey& Owner)
+{
+    if (const FBlueprintActionDatabase::FActionList* ActionList = FBlueprintActionDatabase::Get().GetAllActions().Find(Owner))
+    {
+        for (UBlueprintNodeSpawner* NodeSpawner : *ActionList)
+        {
+            if (NodeSpawner)
+            {
+                AddSpawner(Owner, NodeSpawner);
+            }
+        }
+    }
+}
+
+void FBlueprintActionSearchIndex::RemoveOwner(const FObjectKey& Owner)
+{
+    TArray<int32> Slots;
+    if (!SlotsByOwner.RemoveAndCopyValue(Owner, Slots))
+    {
+        return;
+    }
+
+    // Word slots keep pointing here; searches skip the slot for its missing spawner
+    for (int32 Slot : Slots)
+    {
+        Entries[Slot] = FIndexedEntry();
+        ++RemovedCount;
+    }
+}
+
+void FBlueprintActionSearchIndex::AddSpawner(const FObjectKey& Owner, UBlueprintNodeSpawner* Spawner)
+{
+    FIndexedEntry Indexed;
+    FString Keywords;
+    if (!DescribeSpawner(Spawner, Indexed.Entry, Keywords))
+    {
+        return;
+    }
+
+    Indexed.Entry.Spawner = Spawner;
+    Indexed.Owner = Owner;
+    Indexed.LowerTitle = Indexed.Entry.Title.ToLower();
+    Indexed.LowerCategory = Indexed.Entry.Category.ToLower();
+    Indexed.LowerText = FString::Join(TArray<FString>{ Indexed.LowerTitle, Indexed.LowerCategory, Indexed.Entry.Tooltip.ToLower(), Keywords.ToLower() }, TEXT("\n"));
+
+    SplitWords(Indexed.Entry.Title, Indexed.TitleWords);
+    SplitWords(Keywords, Indexed.KeywordWords);
+    SplitWords(Indexed.Entry.Category, Indexed.CategoryWords);
+    if (!Indexed.Entry.ClassName.IsEmpty())
+    {
+        SplitWords(Indexed.Entry.ClassName, Indexed.ClassWords);
+    }
+    else if (const UObject* OwnerObject = Owner.ResolveObjectPtr())
+    {
+        SplitWords(OwnerObject->GetName(), Indexed.ClassWords);
+    }
+
+    const int32 Slot = Entries.Num();
+    TSet<FString> Words;
+    Words.Append(Indexed.TitleWords);
+    Words.Append(Indexed.KeywordWords);
+    Words.Append(Indexed.CategoryWords);
+    Words.Append(Indexed.ClassWords);
+    for (const FString& Word : Words)
+    {
+        TArray<int32>* WordSlots = SlotsByWord.Find(Word);
+        if (!WordSlots)
+        {
+            WordSlots = &SlotsByWord.Add(Word);
+            bSortedWordsStale = true;
+        }
+        WordSlots->Add(Slot);
+    }
+
+    SlotsByOwner.FindOrAdd(Owner).Add(Slot);
+    Entries.Add(MoveTemp(Indexed));
+}
+
+void FBlueprintActionSearchIndex::FindSlotsWithPrefix(const FString& Prefix, TSet<int32>& OutSlots)
+{
+    if (bSortedWordsStale)
+    {
+        SlotsByWord.GenerateKeyArray(SortedWords);
+        SortedWords.Sort();
+        bSortedWordsStale = false;
+    }
+
+    // Words are lowercase, so FString's case-insensitive ordering keeps every prefix match together
+    for (int32 WordIndex = Algo::LowerBound(SortedWords, Prefix);
+        WordIndex < SortedWords.Num() && SortedWords[WordIndex].StartsWith(Prefix, ESearchCase::CaseSensitive);
+        ++WordIndex)
+    {
+        OutSlots.Append(SlotsByWord.FindChecked(SortedWords[WordIndex]));
+    }
+}
+
+int32 FBlueprintActionSearchIndex::ScoreEntry(const FIndexedEntry& Indexed, const FString& LowerQuery, const TArray<FString>& QueryWords)
+{
+    int32 Score = 0;
+    for (const FString& QueryWord : QueryWords)
+    {
+        // Title words count most, then keywords, category and the owning class
+        const int32 WordScore = FMath::Max(
+            FMath::Max(MatchWords(Indexed.TitleWords, QueryWord) * 8, MatchWords(Indexed.KeywordWords, QueryWord) * 4),
+            FMath::Max(MatchWords(Indexed.CategoryWords, QueryWord) * 2, MatchWords(Indexed.ClassWords, QueryWord)));
+        if (WordScore == 0)
+        {
+            return 0;
+        }
+        Score += WordScore;
+    }
+
+    if (Indexed.LowerTitle.Equals(LowerQuery, ESearchCase::CaseSensitive))
+    {
+        Score += 1000;
+    }
+    else if (Indexed.LowerTitle.StartsWith(LowerQuery, ESearchCase::CaseSensitive))
+    {
+        Score += 100;
+    }
+    return Score;
+}
+
+void FBlueprintActionSearchIndex::SplitWords(const FString& Text, TArray<FString>& OutWords)
+{
+    FString Word;
+    auto Flush = [&Word, &OutWords]()
+    {
+        if (!Word.IsEmpty())
+        {
+            OutWords.AddUnique(Word.ToLower());
+            Word.Reset();
+        }
+    };
+
+    for (int32 Index = 0; Index < Text.Len(); ++Index)
+    {
+        const TCHAR Ch = Text[Index];
+        if (!FChar::IsAlnum(Ch))
+        {
+            Flush();
+            continue;
+        }
+
+        // "GetActorLocation" -> get, actor, location; "HTTPRequest" -> http, request
+        if (FChar::IsUpper(Ch) && !Word.IsEmpty())
+        {
+            const TCHAR Previous = Text[Index - 1];
+            const bool bNextIsLower = Index + 1 < Text.Len() && FChar::IsLower(Text[Index + 1]);
+            if (FChar::IsLower(Previous) || (FChar::IsUpper(Previous) && bNextIsLower))
+            {
+                Flush();
+            }
+        }
+        Word.AppendChar(Ch);
+    }
+    Flush();
+}
+
+bool FBlueprintActionSearchIndex::IsLive(const FIndexedEntry& Indexed)
+{
+    return Indexed.Entry.Spawner.IsValid();
+}
+
+void FBlueprintActionSearchIndex::HandleEntryUpdated(UObject* ActionKey)
+{
+    if (bBuilt && ActionKey)
+    {
+        PendingOwners.Add(FObjectKey(ActionKey));
+    }
+}
+
+void FBlueprintActionSearchIndex::HandleEntryRemoved(UObject* ActionKey)
+{
+    // Re-adding a removed entry finds no actions for it, which leaves it removed
+    HandleEntryUpdated(ActionKey);
+}
+
+void FBlueprintActionSearchIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code replaces spawners and the functions they describe
+    bBuilt = false;
+    CacheCounters.RecordInvalidation();
+}
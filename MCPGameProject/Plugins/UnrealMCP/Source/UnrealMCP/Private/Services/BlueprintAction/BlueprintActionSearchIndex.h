@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class UBlueprintNodeSpawner;
+
+/**
+ * Inverted index over FBlueprintActionDatabase for search_blueprint_actions
+ *
+ * Each node spawner is described once (title, category, tooltip, keywords and the function and
+ * class names create_node_by_action_name needs) and its title, keywords, category and owning class
+ * are split into lowercase words, CamelCase included. A query is answered from the words first,
+ * ranked by where they matched, then topped up with the plain substring matches over title,
+ * category, tooltip and keywords that the database walk used to find.
+ *
+ * Built by the first search, after the database has registered its actions. Database entries
+ * refreshed or removed later are queued through OnEntryUpdated/OnEntryRemoved and re-described by
+ * the next search; a code reload drops the index.
+ *
+ * Game thread only.
+ */
+class FBlueprintActionSearchIndex
+{
+public:
+    /** A described node spawner */
+    struct FEntry
+    {
+        TWeakObjectPtr<UBlueprintNodeSpawner> Spawner;
+        FString Title;
+        FString Category;
+        FString Tooltip;
+        /** Name create_node_by_action_name takes; empty for none */
+        FString FunctionName;
+        FString ClassName;
+        bool bHasClassName = false;
+        bool bIsMathFunction = false;
+    };
+
+    static FBlueprintActionSearchIndex& Get();
+
+    /** Stop following the database and drop the index */
+    void Shutdown();
+
+    /** Build the index, and with it the action database, now rather than on the first search */
+    void Prewarm();
+
+    /**
+     * Find the best matching actions
+     * @param SearchQuery Free text; words match word prefixes, the whole query matches substrings
+     * @param CategoryFilter Case-insensitive substring of the category, or empty for all
+     * @param MaxResults Maximum number of results
+     * @param OutMatches Receives the matches, best first; valid until the next search
+     */
+    void Search(const FString& SearchQuery, const FString& CategoryFilter, int32 MaxResults, TArray<const FEntry*>& OutMatches);
+
+private:
+    FBlueprintActionSearchIndex() = default;
+
+    struct FIndexedEntry
+    {
+        FEntry Entry;
+        FObjectKey Owner;
+        FString LowerTitle;
+        FString LowerCategory;
+        /** Lowercase title, category, tooltip and keywords, for substring matches */
+        FString LowerText;
+        TArray<FString> TitleWords;
+        TArray<FString> KeywordWords;
+        TArray<FString> CategoryWords;
+        TArray<FString> ClassWords;
+    };
+
+    /** Build the index if missing and apply the queued database changes */
+    void EnsureCurrent();
+
+    void Build();
+    void AddOwner(const FObjectKey& Owner);
+    void RemoveOwner(const FObjectKey& Owner);
+    void AddSpawner(const FObjectKey& Owner, UBlueprintNodeSpawner* Spawner);
+
+    /** Slots whose words start with a query word */
+    void FindSlotsWithPrefix(const FString& Prefix, TSet<int32>& OutSlots);
+
+    /** @return How well an entry matches; 0 if some query word is missing */
+    static int32 ScoreEntry(const FIndexedEntry& Indexed, const FString& LowerQuery, const TArray<FString>& QueryWords);
+
+    /** Split text into lowercase words at non-alphanumerics and CamelCase boundaries */
+    static void SplitWords(const FString& Text, TArray<FString>& OutWords);
+
+    static bool IsLive(const FIndexedEntry& Indexed);
+
+    void HandleEntryUpdated(UObject* ActionKey);
+    void HandleEntryRemoved(UObject* ActionKey);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    /** Indexed slots are never reused; removed ones are left without a spawner */
+    TArray<FIndexedEntry> Entries;
+    TMap<FObjectKey, TArray<int32>> SlotsByOwner;
+    TMap<FString, TArray<int32>> SlotsByWord;
+    /** The keys of SlotsByWord in order, for prefix lookups; rebuilt when stale */
+    TArray<FString> SortedWords;
+    bool bSortedWordsStale = false;
+    int32 RemovedCount = 0;
+    bool bBuilt = false;
+    /** Searches that found the index current, or had to build it */
+    FMCPCacheCounters CacheCounters;
+
+    /** Database entries changed since the last search */
+    TSet<FObjectKey> PendingOwners;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
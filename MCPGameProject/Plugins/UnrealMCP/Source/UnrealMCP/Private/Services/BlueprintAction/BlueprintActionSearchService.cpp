@@ -1,7 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Services/BlueprintAction/BlueprintActionSearchService.h"
-#include "BlueprintActionDatabase.h"
+#include "Services/BlueprintAction/BlueprintActionSearchIndex.h"
 #include "BlueprintTypePromotion.h"
 #include "BlueprintNodeSpawner.h"
 #include "BlueprintFunctionNodeSpawner.h"
@@ -21,6 +21,7 @@
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "MCPLogging.h"
 
 // Utility to convert CamelCase function names to Title Case (e.g., "GetActorLocation" -> "Get Actor Location")
 static FString ConvertCamelCaseToTitleCase(const FString& InFunctionName)
@@ -58,11 +59,11 @@ static void AddBlueprintCustomFunctionActions(UBlueprint* Blueprint, const FStri
 {
     if (!Blueprint) 
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Blueprint is null"));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("AddBlueprintCustomFunctionActions: Blueprint is null"));
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Processing Blueprint '%s' with %d custom functions"), 
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintCustomFunctionActions: Processing Blueprint '%s' with %d custom functions"), 
            *Blueprint->GetName(), Blueprint->FunctionGraphs.Num());
     
     int32 AddedActions = 0;
@@ -76,11 +77,11 @@ static void AddBlueprintCustomFunctionActions(UBlueprint* Blueprint, const FStri
         
         FString FunctionName = FunctionGraph->GetName();
         
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Checking function '%s'"), *FunctionName);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintCustomFunctionActions: Checking function '%s'"), *FunctionName);
         
         if (!SearchFilter.IsEmpty() && !FunctionName.ToLower().Contains(SearchFilter.ToLower()))
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Function '%s' doesn't match search filter '%s'"), *FunctionName, *SearchFilter);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintCustomFunctionActions: Function '%s' doesn't match search filter '%s'"), *FunctionName, *SearchFilter);
             continue;
         }
         
@@ -144,10 +145,10 @@ static void AddBlueprintCustomFunctionActions(UBlueprint* Blueprint, const FStri
         
         OutActions.Add(MakeShared<FJsonValueObject>(FunctionObj));
         AddedActions++;
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Added custom function '%s'"), *FunctionName);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintCustomFunctionActions: Added custom function '%s'"), *FunctionName);
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintCustomFunctionActions: Added %d custom function actions total"), AddedActions);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintCustomFunctionActions: Added %d custom function actions total"), AddedActions);
 }
 
 // Helper: Add Blueprint-local variable getter/setter actions
@@ -155,11 +156,11 @@ static void AddBlueprintVariableActions(UBlueprint* Blueprint, const FString& Se
 {
     if (!Blueprint) 
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Blueprint is null"));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("AddBlueprintVariableActions: Blueprint is null"));
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Processing Blueprint '%s' with %d variables"), 
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Processing Blueprint '%s' with %d variables"), 
            *Blueprint->GetName(), Blueprint->NewVariables.Num());
     
     int32 AddedActions = 0;
@@ -168,11 +169,11 @@ static void AddBlueprintVariableActions(UBlueprint* Blueprint, const FString& Se
     {
         FString VarName = VarDesc.VarName.ToString();
         
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Checking variable '%s'"), *VarName);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Checking variable '%s'"), *VarName);
         
         if (!SearchFilter.IsEmpty() && !VarName.ToLower().Contains(SearchFilter.ToLower()))
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Variable '%s' doesn't match search filter '%s'"), *VarName, *SearchFilter);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Variable '%s' doesn't match search filter '%s'"), *VarName, *SearchFilter);
             continue;
         }
         
@@ -189,7 +190,7 @@ static void AddBlueprintVariableActions(UBlueprint* Blueprint, const FString& Se
             GetterObj->SetBoolField(TEXT("is_blueprint_variable"), true);
             OutActions.Add(MakeShared<FJsonValueObject>(GetterObj));
             AddedActions++;
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Added getter for '%s'"), *VarName);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Added getter for '%s'"), *VarName);
         }
         
         // Setter (if not const)
@@ -206,22 +207,22 @@ static void AddBlueprintVariableActions(UBlueprint* Blueprint, const FString& Se
             SetterObj->SetBoolField(TEXT("is_blueprint_variable"), true);
             OutActions.Add(MakeShared<FJsonValueObject>(SetterObj));
             AddedActions++;
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Added setter for '%s'"), *VarName);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Added setter for '%s'"), *VarName);
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Variable '%s' is const, skipping setter"), *VarName);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Variable '%s' is const, skipping setter"), *VarName);
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintVariableActions: Added %d actions total"), AddedActions);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintVariableActions: Added %d actions total"), AddedActions);
 }
 
 static void AddBlueprintComponentActions(UBlueprint* Blueprint, const FString& SearchFilter, TArray<TSharedPtr<FJsonValue>>& OutActions)
 {
     if (!Blueprint) 
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Blueprint is null"));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("AddBlueprintComponentActions: Blueprint is null"));
         return;
     }
     
@@ -229,11 +230,11 @@ static void AddBlueprintComponentActions(UBlueprint* Blueprint, const FString& S
     USimpleConstructionScript* SCS = Blueprint->SimpleConstructionScript;
     if (!SCS)
     {
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: No SimpleConstructionScript found"));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("AddBlueprintComponentActions: No SimpleConstructionScript found"));
         return;
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Processing Blueprint '%s' with %d component nodes"), 
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintComponentActions: Processing Blueprint '%s' with %d component nodes"), 
            *Blueprint->GetName(), SCS->GetAllNodes().Num());
     
     int32 AddedActions = 0;
@@ -248,11 +249,11 @@ static void AddBlueprintComponentActions(UBlueprint* Blueprint, const FString& S
         FString ComponentName = Node->GetVariableName().ToString();
         FString ComponentClassName = Node->ComponentTemplate->GetClass()->GetName();
         
-        UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Checking component '%s' (type: %s)"), *ComponentName, *ComponentClassName);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintComponentActions: Checking component '%s' (type: %s)"), *ComponentName, *ComponentClassName);
         
         if (!SearchFilter.IsEmpty() && !ComponentName.ToLower().Contains(SearchFilter.ToLower()))
         {
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Component '%s' doesn't match search filter '%s'"), *ComponentName, *SearchFilter);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintComponentActions: Component '%s' doesn't match search filter '%s'"), *ComponentName, *SearchFilter);
             continue;
         }
         
@@ -269,11 +270,11 @@ static void AddBlueprintComponentActions(UBlueprint* Blueprint, const FString& S
             GetterObj->SetBoolField(TEXT("is_blueprint_component"), true);
             OutActions.Add(MakeShared<FJsonValueObject>(GetterObj));
             AddedActions++;
-            UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Added getter for component '%s'"), *ComponentName);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintComponentActions: Added getter for component '%s'"), *ComponentName);
         }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("AddBlueprintComponentActions: Added %d component actions total"), AddedActions);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("AddBlueprintComponentActions: Added %d component actions total"), AddedActions);
 }
 
 FBlueprintActionSearchService::FBlueprintActionSearchService()
@@ -291,14 +292,14 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
     const FString& BlueprintName
 )
 {
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions called with: SearchQuery='%s', Category='%s', MaxResults=%d, BlueprintName='%s'"), *SearchQuery, *Category, MaxResults, *BlueprintName);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions called with: SearchQuery='%s', Category='%s', MaxResults=%d, BlueprintName='%s'"), *SearchQuery, *Category, MaxResults, *BlueprintName);
     
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ActionsArray;
     
     // Convert CamelCase to Title Case for better search results (e.g., "GetActorLocation" -> "Get Actor Location")
     FString TitleCaseQuery = ConvertCamelCaseToTitleCase(SearchQuery);
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: CamelCase conversion: '%s' -> '%s'"), *SearchQuery, *TitleCaseQuery);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: CamelCase conversion: '%s' -> '%s'"), *SearchQuery, *TitleCaseQuery);
     
     // Use title case version for searching if it's different from original
     FString EffectiveSearchQuery = TitleCaseQuery.Equals(SearchQuery, ESearchCase::IgnoreCase) ? SearchQuery : TitleCaseQuery;
@@ -307,11 +308,6 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
     FString SearchLower = EffectiveSearchQuery.ToLower();
     const TSet<FName>& OperatorNames = FTypePromotion::GetAllOpNames();
     
-    // Initialize variables that will be used after potential goto
-    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-    FBlueprintActionContext FilterContext;
-    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
-    
     if (SearchQuery.IsEmpty())
     {
         ResultObj->SetBoolField(TEXT("success"), false);
@@ -349,28 +345,28 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
     // Blueprint-local variable actions
     if (!BlueprintName.IsEmpty())
     {
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Using FUnrealMCPCommonUtils to find Blueprint: %s"), *BlueprintName);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Using FUnrealMCPCommonUtils to find Blueprint: %s"), *BlueprintName);
         UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindBlueprintByName(BlueprintName);
         
         if (Blueprint)
         {
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Adding variable actions for Blueprint: %s"), *Blueprint->GetName());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Adding variable actions for Blueprint: %s"), *Blueprint->GetName());
             AddBlueprintVariableActions(Blueprint, SearchQuery, ActionsArray);
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Added %d variable actions"), ActionsArray.Num());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Added %d variable actions"), ActionsArray.Num());
             
             // Add component actions
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Adding component actions for Blueprint: %s"), *Blueprint->GetName());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Adding component actions for Blueprint: %s"), *Blueprint->GetName());
             AddBlueprintComponentActions(Blueprint, SearchQuery, ActionsArray);
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Added %d total actions after components"), ActionsArray.Num());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Added %d total actions after components"), ActionsArray.Num());
             
             // Add custom function actions
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Adding custom function actions for Blueprint: %s"), *Blueprint->GetName());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Adding custom function actions for Blueprint: %s"), *Blueprint->GetName());
             AddBlueprintCustomFunctionActions(Blueprint, SearchQuery, ActionsArray);
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Total actions after custom functions: %d"), ActionsArray.Num());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Total actions after custom functions: %d"), ActionsArray.Num());
         }
         else
         {
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Failed to load Blueprint: %s using FUnrealMCPCommonUtils"), *BlueprintName);
+            UE_LOG(LogUnrealMCP, Warning, TEXT("SearchBlueprintActions: Failed to load Blueprint: %s using FUnrealMCPCommonUtils"), *BlueprintName);
         }
     }
     
@@ -378,13 +374,13 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
     // This is needed because Enhanced Input event nodes are registered through a different mechanism
     if (Category.IsEmpty() || Category.ToLower().Contains(TEXT("input")))
     {
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Searching for Enhanced Input Actions"));
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Searching for Enhanced Input Actions"));
         
         IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
         TArray<FAssetData> ActionAssets;
         AssetRegistry.GetAssetsByClass(UInputAction::StaticClass()->GetClassPathName(), ActionAssets, true);
         
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Found %d Enhanced Input Action assets"), ActionAssets.Num());
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Found %d Enhanced Input Action assets"), ActionAssets.Num());
         
         for (const FAssetData& ActionAsset : ActionAssets)
         {
@@ -412,7 +408,7 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
                     
                     ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
                     
-                    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Added Enhanced Input Action: %s"), *ActionName);
+                    UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Added Enhanced Input Action: %s"), *ActionName);
                     
                     // Limit results
                     if (ActionsArray.Num() >= MaxResults)
@@ -430,12 +426,12 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
                                  Category.ToLower().Contains(TEXT("comparison"))))
     {
         FString QueryType = bIsMathQuery ? TEXT("mathematical") : (bIsComparisonQuery ? TEXT("comparison") : TEXT("type promotion"));
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Prioritizing %s operators for query '%s'"), *QueryType, *SearchQuery);
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Available operators count: %d"), OperatorNames.Num());
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Prioritizing %s operators for query '%s'"), *QueryType, *SearchQuery);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Available operators count: %d"), OperatorNames.Num());
         
         for (const FName& OpName : OperatorNames)
         {
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Checking operator: %s"), *OpName.ToString());
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Checking operator: %s"), *OpName.ToString());
         }
         
         for (const FName& OpName : OperatorNames)
@@ -444,7 +440,7 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
             FString OpNameLower = OpNameString.ToLower();
             
             // Check if this operator matches our search
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Testing operator '%s' against search '%s'"), *OpNameString, *SearchLower);
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Testing operator '%s' against search '%s'"), *OpNameString, *SearchLower);
             bool bMatchesSearch = OpNameLower.Contains(SearchLower) ||
                                  // Math operators
                                  (SearchLower == TEXT("add") && (OpNameString == TEXT("Add") || OpNameString.Contains(TEXT("+")))) ||
@@ -478,7 +474,7 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
             
             if (bMatchesSearch)
             {
-                UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: MATCHED operator '%s' for search '%s'"), *OpNameString, *SearchLower);
+                UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: MATCHED operator '%s' for search '%s'"), *OpNameString, *SearchLower);
                 // Get the spawner for this operator
                 UBlueprintFunctionNodeSpawner* OperatorSpawner = FTypePromotion::GetOperatorSpawner(OpName);
                 if (OperatorSpawner)
@@ -498,7 +494,7 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
                     
                     ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
                     
-                    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Prioritized %s operator: %s"), bIsComparisonOp ? TEXT("comparison") : TEXT("mathematical"), *OpNameString);
+                    UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Prioritized %s operator: %s"), bIsComparisonOp ? TEXT("comparison") : TEXT("mathematical"), *OpNameString);
                     
                     // Limit results
                     if (ActionsArray.Num() >= MaxResults)
@@ -510,242 +506,37 @@ FString FBlueprintActionSearchService::SearchBlueprintActions(
         }
     }
 
-    // Use Unreal's native Blueprint Action Menu system for remaining search
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Using native UE Blueprint Action Menu system for search '%s' in category '%s'"), *SearchQuery, *Category);
-    if (!BlueprintName.IsEmpty())
+    // Remaining matches from the action database, ranked by its search index
     {
-        // Fix: Handle both short names (BP_MyBlueprint) and full paths (/Game/Folder/BP_MyBlueprint)
-        FString BlueprintPath;
-        if (BlueprintName.StartsWith(TEXT("/Game/")))
-        {
-            // Already a full path - extract just the asset name for the class reference
-            FString AssetName;
-            BlueprintName.Split(TEXT("/"), nullptr, &AssetName, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
-            AssetName.RemoveFromEnd(TEXT("_C")); // Remove _C suffix if present
-            BlueprintPath = FString::Printf(TEXT("%s.%s"), *BlueprintName, *AssetName);
-        }
-        else
-        {
-            // Short name - add /Game/ prefix
-            BlueprintPath = FString::Printf(TEXT("/Game/%s.%s"), *BlueprintName, *BlueprintName);
-        }
-        
-        UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Loading blueprint from path '%s'"), *BlueprintPath);
-        UBlueprint* ContextBlueprint = Cast<UBlueprint>(StaticLoadObject(UBlueprint::StaticClass(), nullptr, *BlueprintPath, nullptr, LOAD_Quiet | LOAD_NoWarn));
-        if (ContextBlueprint)
-        {
-            FilterContext.Blueprints.Add(ContextBlueprint);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Failed to load blueprint from path '%s'"), *BlueprintPath);
-        }
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Action database has %d action lists"), ActionRegistry.Num());
-    
-    // Go through all actions in the database
-    for (auto Iterator(ActionRegistry.CreateConstIterator()); Iterator; ++Iterator)
-    {
-        const FBlueprintActionDatabase::FActionList& ActionList = Iterator.Value();
-        for (UBlueprintNodeSpawner* NodeSpawner : ActionList)
-        {
-            if (!NodeSpawner)
-            {
-                continue;
-            }
-        
-            // Get the display name and properties - handle function spawners differently
-            FString ActionName;
-            FString NodeType;
-            FString ActionCategory = TEXT("Unknown");
-            FString Tooltip;
-            FString Keywords;
-            
-            // Declare template node for later use
-            UEdGraphNode* TemplateNode = nullptr;
-            
-            // Check if this is a function spawner (for KismetMathLibrary and other function libraries)
-            if (UBlueprintFunctionNodeSpawner* FunctionSpawner = Cast<UBlueprintFunctionNodeSpawner>(NodeSpawner))
-            {
-                UFunction const* Function = FunctionSpawner->GetFunction();
-                if (Function)
-                {
-                    ActionName = Function->GetDisplayNameText().ToString();
-                    if (ActionName.IsEmpty())
-                    {
-                        ActionName = Function->GetName();
-                    }
-                    NodeType = TEXT("Function");
-                    
-                    // Extract category from metadata
-                    if (Function->HasMetaData(TEXT("Category")))
-                    {
-                        ActionCategory = Function->GetMetaData(TEXT("Category"));
-                    }
-                    
-                    // Extract tooltip from metadata
-                    if (Function->HasMetaData(TEXT("ToolTip")))
-                    {
-                        Tooltip = Function->GetMetaData(TEXT("ToolTip"));
-                    }
-                    else
-                    {
-                        Tooltip = Function->GetToolTipText().ToString();
-                    }
-                    
-                    // Extract keywords from metadata
-                    if (Function->HasMetaData(TEXT("Keywords")))
-                    {
-                        Keywords = Function->GetMetaData(TEXT("Keywords"));
-                    }
-                    
-                    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Found function '%s' from class '%s', category: '%s'"), 
-                        *ActionName, *Function->GetOuterUClass()->GetName(), *ActionCategory);
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            // Check if this is an event spawner (for Event Tick, Custom Events, etc.)
-            else if (UBlueprintEventNodeSpawner* EventSpawner = Cast<UBlueprintEventNodeSpawner>(NodeSpawner))
-            {
-                // Get menu signature to extract the display name
-                const FBlueprintActionUiSpec& MenuSignature = NodeSpawner->DefaultMenuSignature;
-                ActionName = MenuSignature.MenuName.ToString();
-                NodeType = TEXT("Event");
-                
-                // Extract category from menu signature
-                if (!MenuSignature.Category.IsEmpty())
-                {
-                    ActionCategory = MenuSignature.Category.ToString();
-                }
-                
-                // Extract tooltip from menu signature
-                if (!MenuSignature.Tooltip.IsEmpty())
-                {
-                    Tooltip = MenuSignature.Tooltip.ToString();
-                }
-                
-                // Extract keywords from menu signature
-                if (!MenuSignature.Keywords.IsEmpty())
-                {
-                    Keywords = MenuSignature.Keywords.ToString();
-                }
-                
-                UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Found event '%s', category: '%s'"), 
-                    *ActionName, *ActionCategory);
-            }
-            else
-            {
-                // Handle regular template nodes
-                TemplateNode = NodeSpawner->GetTemplateNode();
-                if (!TemplateNode)
-                {
-                    continue;
-                }
-                
-                if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                {
-                    ActionName = FunctionNode->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                    NodeType = TEXT("Function");
-                }
-                else
-                {
-                    ActionName = TemplateNode->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                    NodeType = TemplateNode->GetClass()->GetName();
-                }
-                
-                Tooltip = TemplateNode->GetTooltipText().ToString();
-                Keywords = TemplateNode->GetKeywords().ToString();
-            }
-        
-        // Apply search and category filters (SearchLower already declared at function start)
-        FString ActionNameLower = ActionName.ToLower();
-        FString ActionCategoryLower = ActionCategory.ToLower();
-        FString TooltipLower = Tooltip.ToLower();
-        FString KeywordsLower = Keywords.ToLower();
-        
-        bool bMatchesSearch = ActionNameLower.Contains(SearchLower) ||
-                             ActionCategoryLower.Contains(SearchLower) ||
-                             TooltipLower.Contains(SearchLower) ||
-                             KeywordsLower.Contains(SearchLower);
+        TArray<const FBlueprintActionSearchIndex::FEntry*> Matches;
+        FBlueprintActionSearchIndex::Get().Search(EffectiveSearchQuery, Category, MaxResults - ActionsArray.Num(), Matches);
         
-        bool bMatchesCategory = Category.IsEmpty() || ActionCategoryLower.Contains(Category.ToLower());
-        
-        if (bMatchesSearch && bMatchesCategory)
+        for (const FBlueprintActionSearchIndex::FEntry* Match : Matches)
         {
             TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
-            ActionObj->SetStringField(TEXT("title"), ActionName);
-            ActionObj->SetStringField(TEXT("tooltip"), Tooltip);
-            ActionObj->SetStringField(TEXT("category"), ActionCategory);
+            ActionObj->SetStringField(TEXT("title"), Match->Title);
+            ActionObj->SetStringField(TEXT("tooltip"), Match->Tooltip);
+            ActionObj->SetStringField(TEXT("category"), Match->Category);
             
-            // Handle function spawners (for KismetMathLibrary and other function libraries)
-            if (UBlueprintFunctionNodeSpawner* FunctionSpawner = Cast<UBlueprintFunctionNodeSpawner>(NodeSpawner))
-            {
-                UFunction const* Function = FunctionSpawner->GetFunction();
-                if (Function)
-                {
-                    ActionObj->SetStringField(TEXT("function_name"), Function->GetName());
-                    ActionObj->SetStringField(TEXT("class_name"), Function->GetOwnerClass()->GetName());
-                    if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
-                    {
-                        ActionObj->SetBoolField(TEXT("is_math_function"), true);
-                    }
-                }
-            }
-            // Handle event spawners (for Event Tick, Custom Events, etc.)
-            else if (UBlueprintEventNodeSpawner* EventSpawner = Cast<UBlueprintEventNodeSpawner>(NodeSpawner))
+            // function_name is what create_node_by_action_name expects
+            if (!Match->FunctionName.IsEmpty())
             {
-                // For events, use the action name as function_name
-                // Special handling for "Add Custom Event..." - use "CustomEvent" as function name
-                if (ActionName.Contains(TEXT("Add Custom Event")))
-                {
-                    ActionObj->SetStringField(TEXT("function_name"), TEXT("CustomEvent"));
-                }
-                else
-                {
-                    ActionObj->SetStringField(TEXT("function_name"), ActionName);
-                }
-                ActionObj->SetStringField(TEXT("class_name"), TEXT(""));
+                ActionObj->SetStringField(TEXT("function_name"), Match->FunctionName);
             }
-            // Try to extract additional information if it's a function call
-            if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
+            if (Match->bHasClassName)
             {
-                if (UFunction* Function = FunctionNode->GetTargetFunction())
-                {
-                    ActionObj->SetStringField(TEXT("function_name"), Function->GetName());
-                    ActionObj->SetStringField(TEXT("class_name"), Function->GetOwnerClass()->GetName());
-                    if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
-                    {
-                        ActionObj->SetBoolField(TEXT("is_math_function"), true);
-                    }
-                }
+                ActionObj->SetStringField(TEXT("class_name"), Match->ClassName);
             }
-            else
+            if (Match->bIsMathFunction)
             {
-                // For non-function nodes, use the node class name or a fallback
-                // This ensures all actions have function_name for create_node_by_action_name
-                if (TemplateNode)
-                {
-                    // Use the action name as function_name for non-function nodes
-                    ActionObj->SetStringField(TEXT("function_name"), ActionName);
-                }
+                ActionObj->SetBoolField(TEXT("is_math_function"), true);
             }
             
             ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
-            
-            // Limit results
-            if (ActionsArray.Num() >= MaxResults)
-            {
-                goto EndSearch; // Break out of both loops
-            }
-        } // Close bMatchesSearch condition
-        } // Close inner NodeSpawner loop
+        }
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("SearchBlueprintActions: Standard search completed. Found %d actions from database iteration"), ActionsArray.Num());
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("SearchBlueprintActions: Standard search completed. Found %d actions including the action database"), ActionsArray.Num());
     
 EndSearch:
     
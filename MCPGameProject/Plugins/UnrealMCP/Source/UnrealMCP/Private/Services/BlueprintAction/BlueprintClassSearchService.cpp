@@ -241,6 +241,193 @@ FString FBlueprintClassSearchService::GetActionsForClass(
     return OutputString;
 }
 
+/**
+ * What get_actions_for_class_hierarchy reports for a class before filtering: its hierarchy, the
+ * Blueprint-visible properties along it and the function actions of the action database related
+ * to any class in it. Collecting those walks every property and the whole database, so they are
+ * kept per class until the database changes (Blueprint compiles, asset loads) or code reloads.
+ * Game thread only.
+ */
+class FBlueprintClassSearchService::FHierarchyActionCache
+{
+public:
+    struct FHierarchyProperty
+    {
+        FString PropName;
+        FString PinType;
+        /** Hierarchy class the property was first found through */
+        FString OwnerClassName;
+        bool bHasSetter = false;
+    };
+
+    struct FFunctionAction
+    {
+        FString ActionName;
+        FString FunctionName;
+        FString ClassName;
+        bool bIsMathFunction = false;
+    };
+
+    struct FHierarchyActions
+    {
+        /** Class names, child to parent */
+        TArray<FString> ClassNames;
+        TArray<FHierarchyProperty> Properties;
+        TArray<FFunctionAction> FunctionActions;
+    };
+
+    static FHierarchyActionCache& Get()
+    {
+        static FHierarchyActionCache Instance;
+        return Instance;
+    }
+
+    const FHierarchyActions& GetActions(UClass* TargetClass)
+    {
+        check(IsInGameThread());
+        if (const TSharedRef<FHierarchyActions>* Cached = ActionsByClass.Find(TargetClass))
+        {
+            return Cached->Get();
+        }
+
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        if (!EntryUpdatedHandle.IsValid())
+        {
+            EntryUpdatedHandle = ActionDatabase.OnEntryUpdated().AddRaw(this, &FHierarchyActionCache::HandleEntryChanged);
+            EntryRemovedHandle = ActionDatabase.OnEntryRemoved().AddRaw(this, &FHierarchyActionCache::HandleEntryChanged);
+            ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FHierarchyActionCache::HandleReloadComplete);
+        }
+
+        // Each class's entry holds every function action of the database, so keep only a few
+        if (ActionsByClass.Num() >= MaxCachedClasses)
+        {
+            ActionsByClass.Empty();
+        }
+
+        TSharedRef<FHierarchyActions> Actions = MakeShared<FHierarchyActions>();
+        TArray<UClass*> ClassHierarchy;
+        for (UClass* CurrentClass = TargetClass; CurrentClass; CurrentClass = CurrentClass->GetSuperClass())
+        {
+            ClassHierarchy.Add(CurrentClass);
+            Actions->ClassNames.Add(CurrentClass->GetName());
+        }
+
+        TSet<FString> SeenPropertyNames;
+        for (UClass* HierarchyClass : ClassHierarchy)
+        {
+            for (TFieldIterator<FProperty> PropIt(HierarchyClass, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+            {
+                FProperty* Property = *PropIt;
+                if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+                {
+                    continue;
+                }
+                FString PropName = Property->GetName();
+                bool bAlreadySeen = false;
+                SeenPropertyNames.Add(PropName, &bAlreadySeen);
+                if (bAlreadySeen)
+                {
+                    continue;
+                }
+
+                FHierarchyProperty& HierarchyProperty = Actions->Properties.AddDefaulted_GetRef();
+                HierarchyProperty.PropName = MoveTemp(PropName);
+                HierarchyProperty.PinType = Property->GetCPPType();
+                HierarchyProperty.OwnerClassName = HierarchyClass->GetName();
+                HierarchyProperty.bHasSetter = Property->HasMetaData(TEXT("BlueprintReadWrite")) && !Property->HasMetaData(TEXT("BlueprintReadOnly")) && !Property->HasAnyPropertyFlags(CPF_ConstParm);
+            }
+        }
+
+        TSet<FString> UniqueActionNames;
+        for (const auto& ActionPair : ActionDatabase.GetAllActions())
+        {
+            for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+            {
+                if (!NodeSpawner || !IsValid(NodeSpawner))
+                {
+                    continue;
+                }
+
+                UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(NodeSpawner->GetTemplateNode());
+                UFunction* Function = FunctionNode ? FunctionNode->GetTargetFunction() : nullptr;
+                if (!Function)
+                {
+                    continue;
+                }
+
+                UClass* OwnerClass = Function->GetOwnerClass();
+                const bool bRelevant = ClassHierarchy.ContainsByPredicate([OwnerClass](UClass* HierarchyClass)
+                {
+                    return OwnerClass == HierarchyClass || OwnerClass->IsChildOf(HierarchyClass) || HierarchyClass->IsChildOf(OwnerClass);
+                });
+                if (!bRelevant)
+                {
+                    continue;
+                }
+
+                // Function actions are named by their function
+                bool bAlreadySeen = false;
+                UniqueActionNames.Add(Function->GetName(), &bAlreadySeen);
+                if (bAlreadySeen)
+                {
+                    continue;
+                }
+
+                FFunctionAction& FunctionAction = Actions->FunctionActions.AddDefaulted_GetRef();
+                FunctionAction.ActionName = Function->GetName();
+                FunctionAction.FunctionName = Function->GetName();
+                FunctionAction.ClassName = OwnerClass->GetName();
+                FunctionAction.bIsMathFunction = OwnerClass == UKismetMathLibrary::StaticClass();
+            }
+        }
+
+        UE_LOG(LogTemp, Verbose, TEXT("FHierarchyActionCache: %s has %d properties and %d function actions"),
+            *TargetClass->GetName(), Actions->Properties.Num(), Actions->FunctionActions.Num());
+        return ActionsByClass.Add(TargetClass, Actions).Get();
+    }
+
+    void Shutdown()
+    {
+        // The handles are only set once the database exists, so this never creates it
+        if (EntryUpdatedHandle.IsValid())
+        {
+            FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+            ActionDatabase.OnEntryUpdated().Remove(EntryUpdatedHandle);
+            ActionDatabase.OnEntryRemoved().Remove(EntryRemovedHandle);
+            FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+            EntryUpdatedHandle.Reset();
+            EntryRemovedHandle.Reset();
+            ReloadCompleteHandle.Reset();
+        }
+        ActionsByClass.Empty();
+    }
+
+private:
+    static constexpr int32 MaxCachedClasses = 16;
+
+    void HandleEntryChanged(UObject* ActionKey)
+    {
+        ActionsByClass.Empty();
+    }
+
+    void HandleReloadComplete(EReloadCompleteReason Reason)
+    {
+        ActionsByClass.Empty();
+    }
+
+    TMap<TWeakObjectPtr<UClass>, TSharedRef<FHierarchyActions>> ActionsByClass;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
+
+void FBlueprintClassSearchService::ShutdownActionCache()
+{
+    check(IsInGameThread());
+    FHierarchyActionCache::Get().Shutdown();
+}
+
 FString FBlueprintClassSearchService::GetActionsForClassHierarchy(
     const FString& ClassName,
     const FString& SearchFilter,
@@ -275,205 +462,88 @@ FString FBlueprintClassSearchService::GetActionsForClassHierarchy(
     
     if (TargetClass)
     {
-        // Build class hierarchy
-        TArray<UClass*> ClassHierarchy;
-        UClass* CurrentClass = TargetClass;
-        while (CurrentClass)
+        // The hierarchy's properties and function actions are collected once per class
+        const FHierarchyActionCache::FHierarchyActions& HierarchyActions = FHierarchyActionCache::Get().GetActions(TargetClass);
+        for (const FString& HierarchyClassName : HierarchyActions.ClassNames)
         {
-            ClassHierarchy.Add(CurrentClass);
-            HierarchyArray.Add(MakeShared<FJsonValueString>(CurrentClass->GetName()));
-            CurrentClass = CurrentClass->GetSuperClass();
+            HierarchyArray.Add(MakeShared<FJsonValueString>(HierarchyClassName));
         }
         
-        // Get the blueprint action database
-        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-        FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
-        
         // --- BEGIN: Add native property getter/setter nodes for all classes in hierarchy ---
-        TSet<FString> SeenPropertyNames;
-        int32 PropertyActionsAdded = 0;
-        for (UClass* HierarchyClass : ClassHierarchy)
+        const FString SearchFilterLower = SearchFilter.ToLower();
+        for (const FHierarchyActionCache::FHierarchyProperty& HierarchyProperty : HierarchyActions.Properties)
         {
-            for (TFieldIterator<FProperty> PropIt(HierarchyClass, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+            const FString& PropName = HierarchyProperty.PropName;
+            const FString& PinType = HierarchyProperty.PinType;
+            FString Category = FString::Printf(TEXT("Native Property (%s)"), *HierarchyProperty.OwnerClassName);
+            FString Keywords = FString::Printf(TEXT("property variable %s %s native %s"), *PropName, *PinType, *HierarchyProperty.OwnerClassName);
+            FString Tooltip = FString::Printf(TEXT("Access the %s property on %s"), *PropName, *HierarchyProperty.OwnerClassName);
+            // Apply search filter
+            if (!SearchFilter.IsEmpty() && !(PropName.ToLower().Contains(SearchFilterLower) || PinType.ToLower().Contains(SearchFilterLower) || Keywords.ToLower().Contains(SearchFilterLower)))
             {
-                FProperty* Property = *PropIt;
-                if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
-                {
-                    continue;
-                }
-                FString PropName = Property->GetName();
-                if (SeenPropertyNames.Contains(PropName))
-                {
-                    continue; // Avoid duplicates
-                }
-                SeenPropertyNames.Add(PropName);
-                FString PinType = Property->GetCPPType();
-                FString Category = FString::Printf(TEXT("Native Property (%s)"), *HierarchyClass->GetName());
-                FString Keywords = FString::Printf(TEXT("property variable %s %s native %s"), *PropName, *PinType, *HierarchyClass->GetName());
-                FString Tooltip = FString::Printf(TEXT("Access the %s property on %s"), *PropName, *HierarchyClass->GetName());
-                FString PropNameLower = PropName.ToLower();
-                FString PinTypeLower = PinType.ToLower();
-                FString KeywordsLower = Keywords.ToLower();
-                FString SearchFilterLower = SearchFilter.ToLower();
-                // Apply search filter
-                if (!SearchFilter.IsEmpty() && !(PropNameLower.Contains(SearchFilterLower) || PinTypeLower.Contains(SearchFilterLower) || KeywordsLower.Contains(SearchFilterLower)))
-                {
-                    continue;
-                }
-                // Getter node
-                {
-                    TSharedPtr<FJsonObject> GetterObj = MakeShared<FJsonObject>();
-                    FString DisplayName = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
-                    GetterObj->SetStringField(TEXT("title"), FString::Printf(TEXT("Get %s"), *DisplayName));
-                    GetterObj->SetStringField(TEXT("tooltip"), Tooltip);
-                    GetterObj->SetStringField(TEXT("category"), Category);
-                    GetterObj->SetStringField(TEXT("variable_name"), PropName);
-                    GetterObj->SetStringField(TEXT("pin_type"), PinType);
-                    GetterObj->SetStringField(TEXT("function_name"), FString::Printf(TEXT("Get %s"), *DisplayName));
-                    GetterObj->SetBoolField(TEXT("is_native_property"), true);
-                    ActionsArray.Add(MakeShared<FJsonValueObject>(GetterObj));
-                    PropertyActionsAdded++;
-                    if (ActionsArray.Num() >= MaxResults) { break; }
-                }
-                // Setter node (if BlueprintReadWrite and not const)
-                if (Property->HasMetaData(TEXT("BlueprintReadWrite")) && !Property->HasMetaData(TEXT("BlueprintReadOnly")) && !Property->HasAnyPropertyFlags(CPF_ConstParm))
-                {
-                    TSharedPtr<FJsonObject> SetterObj = MakeShared<FJsonObject>();
-                    FString DisplayName = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
-                    SetterObj->SetStringField(TEXT("title"), FString::Printf(TEXT("Set %s"), *DisplayName));
-                    SetterObj->SetStringField(TEXT("tooltip"), Tooltip);
-                    SetterObj->SetStringField(TEXT("category"), Category);
-                    SetterObj->SetStringField(TEXT("variable_name"), PropName);
-                    SetterObj->SetStringField(TEXT("pin_type"), PinType);
-                    SetterObj->SetStringField(TEXT("function_name"), FString::Printf(TEXT("Set %s"), *DisplayName));
-                    SetterObj->SetBoolField(TEXT("is_native_property"), true);
-                    ActionsArray.Add(MakeShared<FJsonValueObject>(SetterObj));
-                    PropertyActionsAdded++;
-                    if (ActionsArray.Num() >= MaxResults) { break; }
-                }
+                continue;
+            }
+            FString DisplayName = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
+            // Getter node
+            {
+                TSharedPtr<FJsonObject> GetterObj = MakeShared<FJsonObject>();
+                GetterObj->SetStringField(TEXT("title"), FString::Printf(TEXT("Get %s"), *DisplayName));
+                GetterObj->SetStringField(TEXT("tooltip"), Tooltip);
+                GetterObj->SetStringField(TEXT("category"), Category);
+                GetterObj->SetStringField(TEXT("variable_name"), PropName);
+                GetterObj->SetStringField(TEXT("pin_type"), PinType);
+                GetterObj->SetStringField(TEXT("function_name"), FString::Printf(TEXT("Get %s"), *DisplayName));
+                GetterObj->SetBoolField(TEXT("is_native_property"), true);
+                ActionsArray.Add(MakeShared<FJsonValueObject>(GetterObj));
+                if (ActionsArray.Num() >= MaxResults) { break; }
+            }
+            // Setter node (if BlueprintReadWrite and not const)
+            if (HierarchyProperty.bHasSetter)
+            {
+                TSharedPtr<FJsonObject> SetterObj = MakeShared<FJsonObject>();
+                SetterObj->SetStringField(TEXT("title"), FString::Printf(TEXT("Set %s"), *DisplayName));
+                SetterObj->SetStringField(TEXT("tooltip"), Tooltip);
+                SetterObj->SetStringField(TEXT("category"), Category);
+                SetterObj->SetStringField(TEXT("variable_name"), PropName);
+                SetterObj->SetStringField(TEXT("pin_type"), PinType);
+                SetterObj->SetStringField(TEXT("function_name"), FString::Printf(TEXT("Set %s"), *DisplayName));
+                SetterObj->SetBoolField(TEXT("is_native_property"), true);
+                ActionsArray.Add(MakeShared<FJsonValueObject>(SetterObj));
                 if (ActionsArray.Num() >= MaxResults) { break; }
             }
-            if (ActionsArray.Num() >= MaxResults) { break; }
         }
         // --- END: Add native property getter/setter nodes for all classes in hierarchy ---
         
-        // Find actions relevant to this class hierarchy
-        TSet<FString> UniqueActionNames; // To avoid duplicates
-        for (const auto& ActionPair : ActionRegistry)
+        // Function actions relevant to this class hierarchy, each action name once
+        const FString CategoryName = TargetClass->GetName();
+        for (const FHierarchyActionCache::FFunctionAction& FunctionAction : HierarchyActions.FunctionActions)
         {
-            for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+            CategoryCounts.FindOrAdd(CategoryName)++;
+            
+            // Apply search filter if provided
+            bool bPassesFilter = true;
+            if (!SearchFilter.IsEmpty())
             {
-                if (NodeSpawner && IsValid(NodeSpawner))
+                bPassesFilter = FunctionAction.ActionName.ToLower().Contains(SearchFilterLower) ||
+                               CategoryName.ToLower().Contains(SearchFilterLower);
+            }
+            
+            if (bPassesFilter)
+            {
+                TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
+                ActionObj->SetStringField(TEXT("title"), FunctionAction.ActionName);
+                ActionObj->SetStringField(TEXT("tooltip"), TEXT(""));
+                ActionObj->SetStringField(TEXT("category"), CategoryName);
+                ActionObj->SetStringField(TEXT("function_name"), FunctionAction.FunctionName);
+                ActionObj->SetStringField(TEXT("class_name"), FunctionAction.ClassName);
+                if (FunctionAction.bIsMathFunction)
                 {
-                    bool bRelevant = false;
-                    
-                    if (UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode())
-                    {
-                        if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                        {
-                            if (UFunction* Function = FunctionNode->GetTargetFunction())
-                            {
-                                for (UClass* HierarchyClass : ClassHierarchy)
-                                {
-                                    if (Function->GetOwnerClass() == HierarchyClass || 
-                                        Function->GetOwnerClass()->IsChildOf(HierarchyClass) || 
-                                        HierarchyClass->IsChildOf(Function->GetOwnerClass()))
-                                    {
-                                        bRelevant = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                    
-                    if (bRelevant)
-                    {
-                        FString ActionName = TEXT("Unknown Action");
-                        if (UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode())
-                        {
-                            if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
-                            {
-                                ActionName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                                if (ActionName.IsEmpty())
-                                {
-                                    ActionName = K2Node->GetClass()->GetName();
-                                }
-                                
-                                if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(K2Node))
-                                {
-                                    if (UFunction* Function = FunctionNode->GetTargetFunction())
-                                    {
-                                        ActionName = Function->GetName();
-                                    }
-                                }
-                            }
-                            else
-                            {
-                                ActionName = TemplateNode->GetClass()->GetName();
-                            }
-                        }
-                        
-                        // Skip if we've already seen this action
-                        if (UniqueActionNames.Contains(ActionName))
-                        {
-                            continue;
-                        }
-                        UniqueActionNames.Add(ActionName);
-                        
-                        TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
-                        
-                        FString CategoryName = TargetClass->GetName();
-                        CategoryCounts.FindOrAdd(CategoryName)++;
-                        
-                        ActionObj->SetStringField(TEXT("title"), ActionName);
-                        ActionObj->SetStringField(TEXT("tooltip"), TEXT(""));
-                        ActionObj->SetStringField(TEXT("category"), CategoryName);
-                        
-                        if (UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode())
-                        {
-                            if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                            {
-                                if (UFunction* Function = FunctionNode->GetTargetFunction())
-                                {
-                                    ActionObj->SetStringField(TEXT("function_name"), Function->GetName());
-                                    ActionObj->SetStringField(TEXT("class_name"), Function->GetOwnerClass()->GetName());
-                                    
-                                    // Check if it's a math function
-                                    if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
-                                    {
-                                        ActionObj->SetBoolField(TEXT("is_math_function"), true);
-                                    }
-                                }
-                            }
-                        }
-                        
-                        // Apply search filter if provided
-                        bool bPassesFilter = true;
-                        if (!SearchFilter.IsEmpty())
-                        {
-                            FString SearchLower = SearchFilter.ToLower();
-                            FString ActionNameLower = ActionName.ToLower();
-                            FString CategoryLower = CategoryName.ToLower();
-                            
-                            bPassesFilter = ActionNameLower.Contains(SearchLower) ||
-                                           CategoryLower.Contains(SearchLower);
-                        }
-                        
-                        if (bPassesFilter)
-                        {
-                            ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
-                        }
-                        
-                        // Limit results
-                        if (ActionsArray.Num() >= MaxResults)
-                        {
-                            break;
-                        }
-                    }
+                    ActionObj->SetBoolField(TEXT("is_math_function"), true);
                 }
+                ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
             }
             
+            // Limit results
             if (ActionsArray.Num() >= MaxResults)
             {
                 break;
@@ -50,7 +50,13 @@ public:
         int32 MaxResults
     );
 
+    /** Drop the per-class actions get_actions_for_class_hierarchy keeps and stop following the action database */
+    static void ShutdownActionCache();
+
 private:
+    /** Per-class hierarchy actions; defined in the .cpp */
+    class FHierarchyActionCache;
+
     /**
      * Resolve class name to UClass pointer
      * Tries multiple search strategies (direct path, short name, common locations)
@@ -11,6 +11,283 @@
 #include "BlueprintFunctionNodeSpawner.h"
 #include "UObject/UnrealType.h"
 #include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+
+/**
+ * Pin schemas of library functions, and the function each (function name, class name) query
+ * resolved to. Pin infos are built on the first request for each pin.
+ *
+ * Cleared whenever the action database changes an entry or code is reloaded. Game thread only.
+ */
+class FBlueprintNodePinInfoService::FPinInfoCache
+{
+public:
+    struct FFunctionPins
+    {
+        TWeakObjectPtr<UFunction> Function;
+        FString ClassName;
+        TArray<FString> PinNames;
+        TMap<FString, TSharedRef<FJsonObject>> PinInfos;
+    };
+
+    static FPinInfoCache& Get()
+    {
+        static FPinInfoCache Instance;
+        return Instance;
+    }
+
+    /** @return The pins of the function a query resolved to before, or nullptr */
+    TSharedPtr<FFunctionPins> FindFunction(const FString& FunctionName, const FString& ClassName)
+    {
+        check(IsInGameThread());
+        const TWeakObjectPtr<UFunction>* Function = FunctionsByQuery.Find(MakeQueryKey(FunctionName, ClassName));
+        if (!Function || !Function->IsValid())
+        {
+            return nullptr;
+        }
+        const TSharedRef<FFunctionPins>* Pins = PinsByFunction.Find(*Function);
+        if (!Pins)
+        {
+            return nullptr;
+        }
+        return *Pins;
+    }
+
+    /** Remember what a query resolved to and describe the function's pins if new */
+    TSharedRef<FFunctionPins> AddFunction(const FString& FunctionName, const FString& ClassName, UFunction* Function)
+    {
+        check(IsInGameThread());
+        if (!EntryUpdatedHandle.IsValid())
+        {
+            FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+            EntryUpdatedHandle = ActionDatabase.OnEntryUpdated().AddRaw(this, &FPinInfoCache::HandleEntryChanged);
+            EntryRemovedHandle = ActionDatabase.OnEntryRemoved().AddRaw(this, &FPinInfoCache::HandleEntryChanged);
+            ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FPinInfoCache::HandleReloadComplete);
+        }
+
+        if (FunctionsByQuery.Num() >= MaxCachedQueries)
+        {
+            Empty();
+        }
+        FunctionsByQuery.Add(MakeQueryKey(FunctionName, ClassName), Function);
+
+        if (const TSharedRef<FFunctionPins>* Existing = PinsByFunction.Find(Function))
+        {
+            return *Existing;
+        }
+
+        TSharedRef<FFunctionPins> Pins = MakeShared<FFunctionPins>();
+        Pins->Function = Function;
+        Pins->ClassName = Function->GetOwnerClass()->GetName();
+        Pins->PinNames.Add(TEXT("execute"));  // Input exec pin
+        Pins->PinNames.Add(TEXT("then"));     // Output exec pin
+        for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
+        {
+            Pins->PinNames.Add(PropIt->GetName());
+        }
+        if (Function->GetReturnProperty())
+        {
+            Pins->PinNames.AddUnique(TEXT("ReturnValue"));
+        }
+        return PinsByFunction.Add(Function, Pins);
+    }
+
+    /** @return Pin info of a parameter of a cached function, or nullptr if it has no such parameter */
+    TSharedPtr<FJsonObject> FindPinInfo(FFunctionPins& Pins, const FString& PinName)
+    {
+        if (const TSharedRef<FJsonObject>* PinInfo = Pins.PinInfos.Find(PinName))
+        {
+            return *PinInfo;
+        }
+
+        UFunction* Function = Pins.Function.Get();
+        if (!Function)
+        {
+            return nullptr;
+        }
+
+        FProperty* Property = nullptr;
+        bool bIsReturnValue = false;
+        if (PinName.Equals(TEXT("ReturnValue"), ESearchCase::IgnoreCase) && Function->GetReturnProperty())
+        {
+            Property = Function->GetReturnProperty();
+            bIsReturnValue = true;
+        }
+        else
+        {
+            // A name that was never made into an FName cannot name a parameter
+            const FName ParamName(*PinName, FNAME_Find);
+            Property = ParamName.IsNone() ? nullptr : Function->FindPropertyByName(ParamName);
+            bIsReturnValue = Property && Property->HasAnyPropertyFlags(CPF_ReturnParm);
+        }
+        if (!Property)
+        {
+            return nullptr;
+        }
+
+        TSharedRef<FJsonObject> PinInfo = BuildPinInfoFromFunctionParam(Function, Property, bIsReturnValue).ToSharedRef();
+        PinInfo->SetStringField(TEXT("class_name"), Pins.ClassName);
+        Pins.PinInfos.Add(PinName, PinInfo);
+        return PinInfo;
+    }
+
+    void Shutdown()
+    {
+        // The handles are only set once the database exists, so this never creates it
+        if (EntryUpdatedHandle.IsValid())
+        {
+            FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+            ActionDatabase.OnEntryUpdated().Remove(EntryUpdatedHandle);
+            ActionDatabase.OnEntryRemoved().Remove(EntryRemovedHandle);
+            FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+            EntryUpdatedHandle.Reset();
+            EntryRemovedHandle.Reset();
+            ReloadCompleteHandle.Reset();
+        }
+        Empty();
+    }
+
+private:
+    static constexpr int32 MaxCachedQueries = 512;
+
+    static FString MakeQueryKey(const FString& FunctionName, const FString& ClassName)
+    {
+        return FunctionName + TEXT("|") + ClassName;
+    }
+
+    void Empty()
+    {
+        FunctionsByQuery.Empty();
+        PinsByFunction.Empty();
+    }
+
+    void HandleEntryChanged(UObject* ActionKey)
+    {
+        Empty();
+    }
+
+    void HandleReloadComplete(EReloadCompleteReason Reason)
+    {
+        Empty();
+    }
+
+    TMap<FString, TWeakObjectPtr<UFunction>> FunctionsByQuery;
+    TMap<TWeakObjectPtr<UFunction>, TSharedRef<FFunctionPins>> PinsByFunction;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
+
+/**
+ * The nodes of the loaded Blueprints, described one Blueprint at a time as lookups need them and
+ * matched like FUnrealMCPCommonUtils::FindNodeInGraph: by title, class, function or variable name.
+ * Lives for one request, so the Blueprints cannot be collected under it.
+ */
+class FBlueprintNodePinInfoService::FLoadedNodeScan
+{
+public:
+    struct FNode
+    {
+        UEdGraphNode* Node = nullptr;
+        UBlueprint* Blueprint = nullptr;
+        FString Title;
+        FString ClassName;
+        FString FunctionName;
+        FString VariableName;
+    };
+
+    FLoadedNodeScan()
+    {
+        for (TObjectIterator<UBlueprint> BlueprintItr; BlueprintItr; ++BlueprintItr)
+        {
+            if (UBlueprint* Blueprint = *BlueprintItr)
+            {
+                Blueprints.Add(Blueprint);
+            }
+        }
+        UE_LOG(LogTemp, Verbose, TEXT("FLoadedNodeScan: %d loaded Blueprints"), Blueprints.Num());
+    }
+
+    /** @return The first node matching the name, or nullptr */
+    const FNode* FindNode(const FString& NodeName)
+    {
+        int32 NodeIndex = 0;
+        while (true)
+        {
+            for (; NodeIndex < Nodes.Num(); ++NodeIndex)
+            {
+                const FNode& Node = Nodes[NodeIndex];
+                if (Node.Title.Contains(NodeName) || Node.ClassName.Contains(NodeName) ||
+                    Node.FunctionName.Contains(NodeName) || Node.VariableName.Contains(NodeName))
+                {
+                    return &Node;
+                }
+            }
+            if (!DescribeNextBlueprint())
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    /** @return Every node of the loaded Blueprints */
+    const TArray<FNode>& GetAllNodes()
+    {
+        while (DescribeNextBlueprint())
+        {
+        }
+        return Nodes;
+    }
+
+private:
+    bool DescribeNextBlueprint()
+    {
+        if (NextBlueprint >= Blueprints.Num())
+        {
+            return false;
+        }
+
+        UBlueprint* Blueprint = Blueprints[NextBlueprint++];
+        for (UEdGraph* Graph : FUnrealMCPCommonUtils::GetAllGraphsFromBlueprint(Blueprint))
+        {
+            if (!Graph)
+            {
+                continue;
+            }
+            for (UEdGraphNode* GraphNode : Graph->Nodes)
+            {
+                if (!GraphNode)
+                {
+                    continue;
+                }
+
+                FNode& Node = Nodes.AddDefaulted_GetRef();
+                Node.Node = GraphNode;
+                Node.Blueprint = Blueprint;
+                Node.Title = GraphNode->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+                Node.ClassName = GraphNode->GetClass()->GetName();
+                if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(GraphNode))
+                {
+                    if (UFunction* Function = FunctionNode->GetTargetFunction())
+                    {
+                        Node.FunctionName = Function->GetName();
+                    }
+                }
+                if (UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(GraphNode))
+                {
+                    Node.VariableName = VariableNode->GetVarName().ToString();
+                }
+            }
+        }
+        return true;
+    }
+
+    TArray<UBlueprint*> Blueprints;
+    int32 NextBlueprint = 0;
+    TArray<FNode> Nodes;
+};
 
 FBlueprintNodePinInfoService::FBlueprintNodePinInfoService()
 {
@@ -20,65 +297,100 @@ FBlueprintNodePinInfoService::~FBlueprintNodePinInfoService()
 {
 }
 
+void FBlueprintNodePinInfoService::ShutdownPinInfoCache()
+{
+    check(IsInGameThread());
+    FPinInfoCache::Get().Shutdown();
+}
+
 FString FBlueprintNodePinInfoService::GetNodePinInfo(
     const FString& NodeName,
     const FString& PinName,
     const FString& ClassName
 )
+{
+    FNodePinQuery Query;
+    Query.NodeName = NodeName;
+    Query.PinName = PinName;
+    Query.ClassName = ClassName;
+
+    FLoadedNodeScan Scan;
+    TSharedRef<FJsonObject> ResultObj = BuildNodePinInfo(Query, Scan);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResultObj, Writer);
+
+    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Returning JSON response: %s"), *OutputString);
+
+    return OutputString;
+}
+
+FString FBlueprintNodePinInfoService::GetNodePinInfoBatch(const TArray<FNodePinQuery>& Queries)
 {
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    
-    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Looking for pin '%s' on node '%s' using runtime inspection"), *PinName, *NodeName);
-    
-    // Try to find node in currently loaded Blueprints
-    UEdGraphNode* FoundNode = nullptr;
-    
-    // Search for the node in all loaded Blueprints using runtime inspection
-    TArray<UBlueprint*> LoadedBlueprints;
-    
-    // Get all loaded Blueprint assets
-    for (TObjectIterator<UBlueprint> BlueprintItr; BlueprintItr; ++BlueprintItr)
+    TArray<TSharedPtr<FJsonValue>> Results;
+    int32 FoundCount = 0;
+
+    FLoadedNodeScan Scan;
+    for (const FNodePinQuery& Query : Queries)
     {
-        if (UBlueprint* Blueprint = *BlueprintItr)
+        TSharedRef<FJsonObject> QueryResult = BuildNodePinInfo(Query, Scan);
+        if (QueryResult->GetBoolField(TEXT("success")))
         {
-            LoadedBlueprints.Add(Blueprint);
+            ++FoundCount;
         }
+        Results.Add(MakeShared<FJsonValueObject>(QueryResult));
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Searching through %d loaded Blueprints"), LoadedBlueprints.Num());
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("results"), Results);
+    ResultObj->SetNumberField(TEXT("query_count"), Queries.Num());
+    ResultObj->SetNumberField(TEXT("found_count"), FoundCount);
+    ResultObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Found pin information for %d of %d queries"), FoundCount, Queries.Num()));
 
-    // Search for the node across all loaded Blueprints
-    for (UBlueprint* Blueprint : LoadedBlueprints)
-    {
-        FoundNode = FUnrealMCPCommonUtils::FindNodeInBlueprint(Blueprint, NodeName);
-        if (FoundNode)
-        {
-            UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Found node '%s' in Blueprint '%s'"), *NodeName, *Blueprint->GetName());
-            break;
-        }
-    }
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
+
+    UE_LOG(LogTemp, Log, TEXT("GetNodePinInfoBatch: Found %d of %d pins"), FoundCount, Queries.Num());
+
+    return OutputString;
+}
+
+TSharedRef<FJsonObject> FBlueprintNodePinInfoService::BuildNodePinInfo(const FNodePinQuery& Query, FLoadedNodeScan& Scan)
+{
+    const FString& NodeName = Query.NodeName;
+    const FString& PinName = Query.PinName;
+    const FString& ClassName = Query.ClassName;
+
+    TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetStringField(TEXT("node_name"), NodeName);
+    ResultObj->SetStringField(TEXT("pin_name"), PinName);
 
-    if (FoundNode)
+    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Looking for pin '%s' on node '%s' using runtime inspection"), *PinName, *NodeName);
+
+    // Search for the node in all loaded Blueprints using runtime inspection
+    if (const FLoadedNodeScan::FNode* Found = Scan.FindNode(NodeName))
     {
+        UEdGraphNode* FoundNode = Found->Node;
+        UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Found node '%s' in Blueprint '%s'"), *NodeName, *Found->Blueprint->GetName());
+
         // Get pin information using runtime inspection
         TSharedPtr<FJsonObject> PinInfo = FUnrealMCPCommonUtils::GetNodePinInfoRuntime(FoundNode, PinName);
-        
+
         if (PinInfo->HasField(TEXT("pin_type")))
         {
             ResultObj->SetBoolField(TEXT("success"), true);
-            ResultObj->SetStringField(TEXT("node_name"), NodeName);
-            ResultObj->SetStringField(TEXT("pin_name"), PinName);
             ResultObj->SetObjectField(TEXT("pin_info"), PinInfo);
             ResultObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Found pin information for '%s' on node '%s' using runtime inspection"), *PinName, *NodeName));
         }
         else
         {
             ResultObj->SetBoolField(TEXT("success"), false);
-            ResultObj->SetStringField(TEXT("node_name"), NodeName);
-            ResultObj->SetStringField(TEXT("pin_name"), PinName);
             ResultObj->SetObjectField(TEXT("pin_info"), MakeShared<FJsonObject>());
             ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Pin '%s' not found on node '%s'"), *PinName, *NodeName));
-            
+
             // Provide available pins for this node
             TArray<TSharedPtr<FJsonValue>> AvailablePins;
             for (UEdGraphPin* Pin : FoundNode->Pins)
@@ -91,105 +403,75 @@ FString FBlueprintNodePinInfoService::GetNodePinInfo(
             ResultObj->SetArrayField(TEXT("available_pins"), AvailablePins);
             UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Provided %d available pins for node '%s'"), AvailablePins.Num(), *NodeName);
         }
+        return ResultObj;
     }
-    else
-    {
-        // Node not found in loaded Blueprints - try looking up as a library function
-        UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Node '%s' not found in loaded Blueprints, trying library function lookup"), *NodeName);
 
-        TSharedPtr<FJsonObject> LibraryPinInfo;
-        TArray<FString> AvailablePins;
+    // Node not found in loaded Blueprints - try looking up as a library function
+    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Node '%s' not found in loaded Blueprints, trying library function lookup"), *NodeName);
 
-        if (GetLibraryFunctionPinInfo(NodeName, PinName, ClassName, LibraryPinInfo, &AvailablePins))
+    TSharedPtr<FJsonObject> LibraryPinInfo;
+    TArray<FString> AvailablePins;
+
+    if (GetLibraryFunctionPinInfo(NodeName, PinName, ClassName, LibraryPinInfo, &AvailablePins))
+    {
+        // Found in library functions
+        ResultObj->SetBoolField(TEXT("success"), true);
+        ResultObj->SetObjectField(TEXT("pin_info"), LibraryPinInfo);
+        ResultObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Found pin information for '%s' on library function '%s'"), *PinName, *NodeName));
+        ResultObj->SetStringField(TEXT("source"), TEXT("library_function"));
+    }
+    else if (AvailablePins.Num() > 0)
+    {
+        // Found the function but not the specific pin
+        ResultObj->SetBoolField(TEXT("success"), false);
+        ResultObj->SetObjectField(TEXT("pin_info"), MakeShared<FJsonObject>());
+        ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Pin '%s' not found on library function '%s'"), *PinName, *NodeName));
+
+        TArray<TSharedPtr<FJsonValue>> PinArray;
+        for (const FString& Pin : AvailablePins)
         {
-            // Found in library functions
-            ResultObj->SetBoolField(TEXT("success"), true);
-            ResultObj->SetStringField(TEXT("node_name"), NodeName);
-            ResultObj->SetStringField(TEXT("pin_name"), PinName);
-            ResultObj->SetObjectField(TEXT("pin_info"), LibraryPinInfo);
-            ResultObj->SetStringField(TEXT("message"), FString::Printf(TEXT("Found pin information for '%s' on library function '%s'"), *PinName, *NodeName));
-            ResultObj->SetStringField(TEXT("source"), TEXT("library_function"));
+            PinArray.Add(MakeShared<FJsonValueString>(Pin));
         }
-        else if (AvailablePins.Num() > 0)
-        {
-            // Found the function but not the specific pin
-            ResultObj->SetBoolField(TEXT("success"), false);
-            ResultObj->SetStringField(TEXT("node_name"), NodeName);
-            ResultObj->SetStringField(TEXT("pin_name"), PinName);
-            ResultObj->SetObjectField(TEXT("pin_info"), MakeShared<FJsonObject>());
-            ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Pin '%s' not found on library function '%s'"), *PinName, *NodeName));
+        ResultObj->SetArrayField(TEXT("available_pins"), PinArray);
+        ResultObj->SetStringField(TEXT("hint"), TEXT("For container functions (Map_Add, Array_Add), pin names are: TargetMap/TargetArray, Key, Value, ReturnValue. Note that wildcard pins resolve their type when connected."));
+    }
+    else
+    {
+        // Not found anywhere
+        ResultObj->SetBoolField(TEXT("success"), false);
+        ResultObj->SetObjectField(TEXT("pin_info"), MakeShared<FJsonObject>());
+        ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Node '%s' not found in loaded Blueprints or library functions"), *NodeName));
 
-            TArray<TSharedPtr<FJsonValue>> PinArray;
-            for (const FString& Pin : AvailablePins)
+        // Provide list of available node types from loaded Blueprints
+        TArray<TSharedPtr<FJsonValue>> AvailableNodes;
+        TSet<FString> UniqueNodeNames;
+
+        for (const FLoadedNodeScan::FNode& Node : Scan.GetAllNodes())
+        {
+            if (Node.Title.IsEmpty())
             {
-                PinArray.Add(MakeShared<FJsonValueString>(Pin));
+                continue;
             }
-            ResultObj->SetArrayField(TEXT("available_pins"), PinArray);
-            ResultObj->SetStringField(TEXT("hint"), TEXT("For container functions (Map_Add, Array_Add), pin names are: TargetMap/TargetArray, Key, Value, ReturnValue. Note that wildcard pins resolve their type when connected."));
-        }
-        else
-        {
-            // Not found anywhere
-            ResultObj->SetBoolField(TEXT("success"), false);
-            ResultObj->SetStringField(TEXT("node_name"), NodeName);
-            ResultObj->SetStringField(TEXT("pin_name"), PinName);
-            ResultObj->SetObjectField(TEXT("pin_info"), MakeShared<FJsonObject>());
-            ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Node '%s' not found in loaded Blueprints or library functions"), *NodeName));
-
-            // Provide list of available node types from loaded Blueprints
-            TArray<TSharedPtr<FJsonValue>> AvailableNodes;
-            TSet<FString> UniqueNodeNames;
-
-            for (UBlueprint* Blueprint : LoadedBlueprints)
+            bool bAlreadySeen = false;
+            UniqueNodeNames.Add(Node.Title, &bAlreadySeen);
+            if (!bAlreadySeen)
             {
-                TArray<UEdGraph*> AllGraphs = FUnrealMCPCommonUtils::GetAllGraphsFromBlueprint(Blueprint);
-                for (UEdGraph* Graph : AllGraphs)
-                {
-                    if (Graph)
-                    {
-                        for (UEdGraphNode* Node : Graph->Nodes)
-                        {
-                            if (Node)
-                            {
-                                FString NodeDisplayName = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
-                                if (!NodeDisplayName.IsEmpty() && !UniqueNodeNames.Contains(NodeDisplayName))
-                                {
-                                    UniqueNodeNames.Add(NodeDisplayName);
-                                    AvailableNodes.Add(MakeShared<FJsonValueString>(NodeDisplayName));
-
-                                    // Limit the number of examples to avoid overly large responses
-                                    if (AvailableNodes.Num() >= 50)
-                                    {
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        if (AvailableNodes.Num() >= 50)
-                        {
-                            break;
-                        }
-                    }
-                }
+                AvailableNodes.Add(MakeShared<FJsonValueString>(Node.Title));
+
+                // Limit the number of examples to avoid overly large responses
                 if (AvailableNodes.Num() >= 50)
                 {
                     break;
                 }
             }
-
-            ResultObj->SetArrayField(TEXT("available_nodes"), AvailableNodes);
-            ResultObj->SetStringField(TEXT("hint"), TEXT("Try specifying class_name parameter for library functions (e.g., class_name='BlueprintMapLibrary' for Map_Add)"));
-            UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Provided %d example node names from loaded Blueprints"), AvailableNodes.Num());
         }
+
+        ResultObj->SetArrayField(TEXT("available_nodes"), AvailableNodes);
+        ResultObj->SetStringField(TEXT("hint"), TEXT("Try specifying class_name parameter for library functions (e.g., class_name='BlueprintMapLibrary' for Map_Add)"));
+        UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Provided %d example node names from loaded Blueprints"), AvailableNodes.Num());
     }
-    
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(ResultObj.ToSharedRef(), Writer);
-    
-    UE_LOG(LogTemp, Warning, TEXT("GetNodePinInfo: Returning JSON response: %s"), *OutputString);
-    
-    return OutputString;
+
+    return ResultObj;
 }
 
 FString FBlueprintNodePinInfoService::BuildPinInfoResult(
@@ -240,144 +522,111 @@ bool FBlueprintNodePinInfoService::GetLibraryFunctionPinInfo(
     UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Looking for function '%s' pin '%s' class '%s'"),
            *FunctionName, *PinName, *ClassName);
 
-    // Normalize function name for matching (handle "Map Add" vs "Map_Add" vs "Add")
-    FString NormalizedName = FunctionName;
-    NormalizedName.ReplaceInline(TEXT(" "), TEXT("_"));
+    FPinInfoCache& Cache = FPinInfoCache::Get();
+    TSharedPtr<FPinInfoCache::FFunctionPins> Pins = Cache.FindFunction(FunctionName, ClassName);
+    if (!Pins.IsValid())
+    {
+        // Normalize function name for matching (handle "Map Add" vs "Map_Add" vs "Add")
+        FString NormalizedName = FunctionName;
+        NormalizedName.ReplaceInline(TEXT(" "), TEXT("_"));
 
-    // Also create a variant without underscores for display name matching
-    FString DisplayName = FunctionName;
-    DisplayName.ReplaceInline(TEXT("_"), TEXT(" "));
+        // Also create a variant without underscores for display name matching
+        FString DisplayName = FunctionName;
+        DisplayName.ReplaceInline(TEXT("_"), TEXT(" "));
 
-    FString SearchLower = NormalizedName.ToLower();
-    FString DisplayLower = DisplayName.ToLower();
-    FString ClassNameLower = ClassName.ToLower();
+        FString SearchLower = NormalizedName.ToLower();
+        FString DisplayLower = DisplayName.ToLower();
+        FString ClassNameLower = ClassName.ToLower();
 
-    // Search the Blueprint Action Database
-    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
+        // Search the Blueprint Action Database
+        FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+        FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
 
-    UFunction* FoundFunction = nullptr;
-    FString FoundClassName;
+        UFunction* FoundFunction = nullptr;
 
-    for (auto Iterator(ActionRegistry.CreateConstIterator()); Iterator; ++Iterator)
-    {
-        const FBlueprintActionDatabase::FActionList& ActionList = Iterator.Value();
-        for (UBlueprintNodeSpawner* NodeSpawner : ActionList)
+        for (auto Iterator(ActionRegistry.CreateConstIterator()); Iterator; ++Iterator)
         {
-            if (!NodeSpawner)
+            const FBlueprintActionDatabase::FActionList& ActionList = Iterator.Value();
+            for (UBlueprintNodeSpawner* NodeSpawner : ActionList)
             {
-                continue;
-            }
+                if (!NodeSpawner)
+                {
+                    continue;
+                }
 
-            // Check if this is a function spawner
-            UBlueprintFunctionNodeSpawner* FunctionSpawner = Cast<UBlueprintFunctionNodeSpawner>(NodeSpawner);
-            if (!FunctionSpawner)
-            {
-                continue;
-            }
+                // Check if this is a function spawner
+                UBlueprintFunctionNodeSpawner* FunctionSpawner = Cast<UBlueprintFunctionNodeSpawner>(NodeSpawner);
+                if (!FunctionSpawner)
+                {
+                    continue;
+                }
 
-            UFunction const* Function = FunctionSpawner->GetFunction();
-            if (!Function)
-            {
-                continue;
-            }
+                UFunction const* Function = FunctionSpawner->GetFunction();
+                if (!Function)
+                {
+                    continue;
+                }
 
-            FString FuncName = Function->GetName();
-            FString FuncDisplayName = Function->GetDisplayNameText().ToString();
-            FString FuncClass = Function->GetOwnerClass()->GetName();
+                FString FuncName = Function->GetName();
+                FString FuncDisplayName = Function->GetDisplayNameText().ToString();
+                FString FuncClass = Function->GetOwnerClass()->GetName();
 
-            FString FuncNameLower = FuncName.ToLower();
-            FString FuncDisplayLower = FuncDisplayName.ToLower();
-            FString FuncClassLower = FuncClass.ToLower();
+                FString FuncNameLower = FuncName.ToLower();
+                FString FuncDisplayLower = FuncDisplayName.ToLower();
+                FString FuncClassLower = FuncClass.ToLower();
 
-            // Check if function name matches
-            bool bNameMatches = FuncNameLower == SearchLower ||
-                               FuncNameLower.Contains(SearchLower) ||
-                               FuncDisplayLower == DisplayLower ||
-                               FuncDisplayLower.Contains(DisplayLower);
+                // Check if function name matches
+                bool bNameMatches = FuncNameLower == SearchLower ||
+                                   FuncNameLower.Contains(SearchLower) ||
+                                   FuncDisplayLower == DisplayLower ||
+                                   FuncDisplayLower.Contains(DisplayLower);
 
-            // Check if class name matches (if specified)
-            bool bClassMatches = ClassName.IsEmpty() ||
-                                FuncClassLower == ClassNameLower ||
-                                FuncClassLower.Contains(ClassNameLower);
+                // Check if class name matches (if specified)
+                bool bClassMatches = ClassName.IsEmpty() ||
+                                    FuncClassLower == ClassNameLower ||
+                                    FuncClassLower.Contains(ClassNameLower);
 
-            if (bNameMatches && bClassMatches)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Found matching function '%s' in class '%s'"),
-                       *FuncName, *FuncClass);
+                if (bNameMatches && bClassMatches)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Found matching function '%s' in class '%s'"),
+                           *FuncName, *FuncClass);
 
-                FoundFunction = const_cast<UFunction*>(Function);
-                FoundClassName = FuncClass;
-                break;
+                    FoundFunction = const_cast<UFunction*>(Function);
+                    break;
+                }
             }
-        }
 
-        if (FoundFunction)
-        {
-            break;
+            if (FoundFunction)
+            {
+                break;
+            }
         }
-    }
-
-    if (!FoundFunction)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Function '%s' not found in Blueprint Action Database"), *FunctionName);
-        return false;
-    }
-
-    // Collect all pin names from the function
-    TArray<FString> AllPinNames;
-    AllPinNames.Add(TEXT("execute"));  // Input exec pin
-    AllPinNames.Add(TEXT("then"));     // Output exec pin
-
-    // Iterate through function parameters
-    FProperty* FoundProperty = nullptr;
-    bool bIsReturnValue = false;
-
-    for (TFieldIterator<FProperty> PropIt(FoundFunction); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        FString PropName = Property->GetName();
-        AllPinNames.Add(PropName);
-
-        UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Found parameter '%s'"), *PropName);
 
-        // Check if this is the pin we're looking for
-        if (PropName.Equals(PinName, ESearchCase::IgnoreCase))
+        if (!FoundFunction)
         {
-            FoundProperty = Property;
-            bIsReturnValue = Property->HasAnyPropertyFlags(CPF_ReturnParm);
+            UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Function '%s' not found in Blueprint Action Database"), *FunctionName);
+            return false;
         }
-    }
 
-    // Also check for return value
-    if (FProperty* ReturnProp = FoundFunction->GetReturnProperty())
-    {
-        AllPinNames.Add(TEXT("ReturnValue"));
-        if (PinName.Equals(TEXT("ReturnValue"), ESearchCase::IgnoreCase))
-        {
-            FoundProperty = ReturnProp;
-            bIsReturnValue = true;
-        }
+        Pins = Cache.AddFunction(FunctionName, ClassName, FoundFunction);
     }
 
     // Output available pins
     if (OutAvailablePins)
     {
-        *OutAvailablePins = AllPinNames;
+        *OutAvailablePins = Pins->PinNames;
     }
 
+    OutPinInfo = Cache.FindPinInfo(*Pins, PinName);
+
     // If we didn't find the specific pin
-    if (!FoundProperty)
+    if (!OutPinInfo.IsValid())
     {
         UE_LOG(LogTemp, Warning, TEXT("GetLibraryFunctionPinInfo: Pin '%s' not found on function '%s'. Available: %s"),
-               *PinName, *FunctionName, *FString::Join(AllPinNames, TEXT(", ")));
+               *PinName, *FunctionName, *FString::Join(Pins->PinNames, TEXT(", ")));
         return false;
     }
 
-    // Build pin info from the property
-    OutPinInfo = BuildPinInfoFromFunctionParam(FoundFunction, FoundProperty, bIsReturnValue);
-    OutPinInfo->SetStringField(TEXT("class_name"), FoundClassName);
-
     return true;
 }
 
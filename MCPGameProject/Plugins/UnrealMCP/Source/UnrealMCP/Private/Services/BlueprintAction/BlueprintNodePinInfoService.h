@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Services/IBlueprintActionService.h"
 
 // Forward declarations
 class UFunction;
@@ -14,6 +15,10 @@ class UFunction;
  * Supports:
  * 1. Runtime inspection of nodes in loaded Blueprints
  * 2. Library function lookup via Blueprint Action Database (Map_Add, Array_Add, etc.)
+ *
+ * Library function pin schemas are cached per function, and the function each (node name,
+ * class name) resolved to is remembered, until the action database changes or code is reloaded.
+ * Loaded Blueprints are scanned incrementally and the scan is shared by every query of a batch.
  */
 class FBlueprintNodePinInfoService
 {
@@ -47,7 +52,31 @@ public:
         const FString& ClassName = TEXT("")
     );
 
+    /**
+     * Get pin information for several nodes in one request
+     * @param Queries Node, pin and optional class name of each lookup
+     * @return JSON string with a results array holding one GetNodePinInfo result per query, in order
+     */
+    FString GetNodePinInfoBatch(const TArray<FNodePinQuery>& Queries);
+
+    /** Stop following the action database and drop the cached pin schemas */
+    static void ShutdownPinInfoCache();
+
 private:
+    /** Library function pin schemas; defined in the .cpp */
+    class FPinInfoCache;
+
+    /** Incremental walk over the nodes of the loaded Blueprints for one request; defined in the .cpp */
+    class FLoadedNodeScan;
+
+    /**
+     * Look up one pin
+     * @param Query Node, pin and optional class name
+     * @param Scan Loaded node scan shared by the queries of this request
+     * @return Result object as GetNodePinInfo returns it
+     */
+    TSharedRef<class FJsonObject> BuildNodePinInfo(const FNodePinQuery& Query, FLoadedNodeScan& Scan);
+
     /**
      * Build JSON result for pin info
      * @param bSuccess Success status
@@ -104,7 +133,7 @@ private:
      * Extract pin information from a UFunction parameter
      * Converts UE property types to Blueprint pin type information
      */
-    TSharedPtr<class FJsonObject> BuildPinInfoFromFunctionParam(
+    static TSharedPtr<class FJsonObject> BuildPinInfoFromFunctionParam(
         UFunction* Function,
         FProperty* Property,
         bool bIsReturnValue = false
@@ -0,0 +1,434 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Services/BlueprintAction/BlueprintPinCompatibilityIndex.h"
+#include "BlueprintActionDatabase.h"
+#include "BlueprintNodeSpawner.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_BreakStruct.h"
+#include "K2Node_MakeStruct.h"
+#include "K2Node_ConstructObjectFromClass.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_Self.h"
+#include "K2Node_Event.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet/GameplayStatics.h"
+#include "MCPLogging.h"
+#include "MCPMemory.h"
+
+namespace
+{
+    /** Removed slots tolerated before the index is rebuilt instead of patched */
+    constexpr int32 MaxRemovedSlots = 4096;
+
+    /** Queued database entries above which rebuilding beats patching */
+    constexpr int32 MaxPendingOwners = 512;
+
+    /** @return Whether the node is offered for every pin type */
+    bool IsGeneralNode(const UEdGraphNode* TemplateNode)
+    {
+        return TemplateNode->IsA<UK2Node_IfThenElse>()
+            || TemplateNode->IsA<UK2Node_ExecutionSequence>()
+            || TemplateNode->IsA<UK2Node_CustomEvent>()
+            || TemplateNode->IsA<UK2Node_DynamicCast>()
+            || TemplateNode->IsA<UK2Node_BreakStruct>()
+            || TemplateNode->IsA<UK2Node_MakeStruct>()
+            || TemplateNode->IsA<UK2Node_ConstructObjectFromClass>()
+            || TemplateNode->IsA<UK2Node_MacroInstance>()
+            || TemplateNode->IsA<UK2Node_InputAction>()
+            || TemplateNode->IsA<UK2Node_Self>()
+            || TemplateNode->IsA<UK2Node_Event>()
+            || TemplateNode->IsA<UK2Node_VariableGet>()
+            || TemplateNode->IsA<UK2Node_VariableSet>();
+    }
+
+    /** @return Whether the function has a float, int or double parameter or return value */
+    bool HasNumericProperty(const UFunction* Function)
+    {
+        for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
+        {
+            if (PropIt->IsA<FFloatProperty>() || PropIt->IsA<FIntProperty>() || PropIt->IsA<FDoubleProperty>())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Describe a template node the way get_actions_for_pin reports it
+     * @param OutKeywords Extra words the search filter matches
+     */
+    void DescribeNode(UEdGraphNode* TemplateNode, FBlueprintPinCompatibilityIndex::FEntry& OutEntry, FString& OutKeywords)
+    {
+        OutEntry.Title = TEXT("Unknown Action");
+        OutEntry.Category = TEXT("Unknown");
+
+        if (TemplateNode->IsA<UK2Node_IfThenElse>())
+        {
+            OutEntry.Title = TEXT("Branch");
+            OutEntry.Category = TEXT("Flow Control");
+            OutEntry.Tooltip = TEXT("Conditional execution based on boolean input");
+            OutEntry.NodeClass = TEXT("UK2Node_IfThenElse");
+            OutKeywords = TEXT("if then else conditional branch");
+        }
+        else if (TemplateNode->IsA<UK2Node_ExecutionSequence>())
+        {
+            OutEntry.Title = TEXT("Sequence");
+            OutEntry.Category = TEXT("Flow Control");
+            OutEntry.Tooltip = TEXT("Execute multiple outputs in order");
+            OutEntry.NodeClass = TEXT("UK2Node_ExecutionSequence");
+            OutKeywords = TEXT("sequence multiple execution order");
+        }
+        else if (TemplateNode->IsA<UK2Node_DynamicCast>())
+        {
+            OutEntry.Title = TEXT("Cast");
+            OutEntry.Category = TEXT("Utilities");
+            OutEntry.Tooltip = TEXT("Cast object to different type");
+            OutEntry.NodeClass = TEXT("UK2Node_DynamicCast");
+            OutKeywords = TEXT("cast convert type object");
+        }
+        else if (TemplateNode->IsA<UK2Node_CustomEvent>())
+        {
+            OutEntry.Title = TEXT("Custom Event");
+            OutEntry.Category = TEXT("Events");
+            OutEntry.Tooltip = TEXT("Create custom event that can be called");
+            OutEntry.NodeClass = TEXT("UK2Node_CustomEvent");
+            OutKeywords = TEXT("custom event call");
+        }
+        else if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
+        {
+            OutEntry.Title = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            if (OutEntry.Title.IsEmpty())
+            {
+                OutEntry.Title = K2Node->GetClass()->GetName();
+            }
+            OutEntry.NodeClass = K2Node->GetClass()->GetName();
+
+            if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(K2Node))
+            {
+                if (UFunction* Function = FunctionNode->GetTargetFunction())
+                {
+                    OutEntry.Title = Function->GetName();
+                    OutEntry.Category = Function->GetOwnerClass()->GetName();
+                    if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
+                    {
+                        OutEntry.Category = TEXT("Math");
+                        OutEntry.bIsMathFunction = true;
+                    }
+                    OutEntry.FunctionName = Function->GetName();
+                    OutEntry.ClassName = Function->GetOwnerClass()->GetName();
+                }
+            }
+        }
+        else
+        {
+            OutEntry.Title = TemplateNode->GetClass()->GetName();
+            OutEntry.NodeClass = OutEntry.Title;
+        }
+    }
+
+    /** Merge two ascending slot lists into one, without duplicates */
+    void MergeSlots(const TArray<int32>& A, const TArray<int32>& B, TArray<int32>& OutSlots)
+    {
+        OutSlots.Reset(A.Num() + B.Num());
+        int32 IndexA = 0;
+        int32 IndexB = 0;
+        while (IndexA < A.Num() || IndexB < B.Num())
+        {
+            if (IndexB >= B.Num() || (IndexA < A.Num() && A[IndexA] < B[IndexB]))
+            {
+                OutSlots.Add(A[IndexA++]);
+            }
+            else if (IndexA >= A.Num() || B[IndexB] < A[IndexA])
+            {
+                OutSlots.Add(B[IndexB++]);
+            }
+            else
+            {
+                OutSlots.Add(A[IndexA++]);
+                ++IndexB;
+            }
+        }
+    }
+}
+
+FBlueprintPinCompatibilityIndex& FBlueprintPinCompatibilityIndex::Get()
+{
+    static FBlueprintPinCompatibilityIndex Instance;
+    return Instance;
+}
+
+void FBlueprintPinCompatibilityIndex::Shutdown()
+{
+    check(IsInGameThread());
+
+    // The handles are only set once the database exists, so this never creates it
+    if (EntryUpdatedHandle.IsValid())
+    {
+        FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+        Database.OnEntryUpdated().Remove(EntryUpdatedHandle);
+        Database.OnEntryRemoved().Remove(EntryRemovedHandle);
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+        EntryUpdatedHandle.Reset();
+        EntryRemovedHandle.Reset();
+        ReloadCompleteHandle.Reset();
+        FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_pin_compatibility_index"));
+    }
+
+    Entries.Empty();
+    SlotsByOwner.Empty();
+    AnySlots.Empty();
+    NumericSlots.Empty();
+    WildcardSlots.Empty();
+    SlotsByFunctionClass.Empty();
+    ObjectSlotsByClass.Empty();
+    PendingOwners.Empty();
+    RemovedCount = 0;
+    bBuilt = false;
+}
+
+void FBlueprintPinCompatibilityIndex::Prewarm()
+{
+    check(IsInGameThread());
+    if (!bBuilt)
+    {
+        Build();
+    }
+}
+
+void FBlueprintPinCompatibilityIndex::Find(const FString& PinType, UClass* TargetClass, const FString& SearchFilter, int32 MaxResults, TArray<const FEntry*>& OutMatches)
+{
+    check(IsInGameThread());
+    OutMatches.Reset();
+    if (MaxResults <= 0)
+    {
+        return;
+    }
+
+    EnsureCurrent();
+
+    const TArray<int32>* Slots = &AnySlots;
+    if (PinType.Equals(TEXT("float"), ESearchCase::IgnoreCase)
+        || PinType.Equals(TEXT("int"), ESearchCase::IgnoreCase)
+        || PinType.Equals(TEXT("integer"), ESearchCase::IgnoreCase)
+        || PinType.Equals(TEXT("real"), ESearchCase::IgnoreCase))
+    {
+        Slots = &NumericSlots;
+    }
+    else if (PinType.IsEmpty() || PinType.Equals(TEXT("wildcard"), ESearchCase::IgnoreCase))
+    {
+        Slots = &WildcardSlots;
+    }
+    else if (TargetClass && PinType.Equals(TEXT("object"), ESearchCase::IgnoreCase))
+    {
+        Slots = &GetObjectSlots(TargetClass);
+    }
+
+    const FString LowerFilter = SearchFilter.ToLower();
+    for (int32 Slot : *Slots)
+    {
+        const FIndexedEntry& Indexed = Entries[Slot];
+        if (IsLive(Indexed) && (LowerFilter.IsEmpty() || Indexed.LowerText.Contains(LowerFilter, ESearchCase::CaseSensitive)))
+        {
+            OutMatches.Add(&Indexed.Entry);
+            if (OutMatches.Num() >= MaxResults)
+            {
+                break;
+            }
+        }
+    }
+}
+
+void FBlueprintPinCompatibilityIndex::EnsureCurrent()
+{
+    if (bBuilt && ((RemovedCount > MaxRemovedSlots && RemovedCount > Entries.Num() / 2) || PendingOwners.Num() > MaxPendingOwners))
+    {
+        bBuilt = false;
+        CacheCounters.RecordInvalidation();
+    }
+    if (!bBuilt)
+    {
+        CacheCounters.RecordMiss();
+        Build();
+        return;
+    }
+    CacheCounters.RecordHit();
+
+    if (PendingOwners.Num() == 0)
+    {
+        return;
+    }
+    for (const FObjectKey& Owner : PendingOwners)
+    {
+        RemoveOwner(Owner);
+        AddOwner(Owner);
+    }
+    PendingOwners.Reset();
+    ObjectSlotsByClass.Reset();
+}
+
+void FBlueprintPinCompatibilityIndex::Build()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    const double StartTime = FPlatformTime::Seconds();
+
+    Entries.Reset();
+    SlotsByOwner.Reset();
+    AnySlots.Reset();
+    NumericSlots.Reset();
+    WildcardSlots.Reset();
+    SlotsByFunctionClass.Reset();
+    ObjectSlotsByClass.Reset();
+    PendingOwners.Reset();
+    RemovedCount = 0;
+
+    // Getting the database registers every action, so it is complete from here on
+    FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+    if (!EntryUpdatedHandle.IsValid())
+    {
+        EntryUpdatedHandle = Database.OnEntryUpdated().AddRaw(this, &FBlueprintPinCompatibilityIndex::HandleEntryUpdated);
+        EntryRemovedHandle = Database.OnEntryRemoved().AddRaw(this, &FBlueprintPinCompatibilityIndex::HandleEntryRemoved);
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FBlueprintPinCompatibilityIndex::HandleReloadComplete);
+        FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_pin_compatibility_index"), TEXT("index"), CacheCounters,
+            [this]() { return static_cast<int64>(Entries.Num() - RemovedCount); });
+    }
+
+    for (auto Iterator(Database.GetAllActions().CreateConstIterator()); Iterator; ++Iterator)
+    {
+        AddOwner(Iterator.Key());
+    }
+    bBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("Blueprint pin compatibility index: %d actions, %d function classes in %.1f ms"),
+        Entries.Num(), SlotsByFunctionClass.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FBlueprintPinCompatibilityIndex::AddOwner(const FObjectKey& Owner)
+{
+    if (const FBlueprintActionDatabase::FActionList* ActionList = FBlueprintActionDatabase::Get().GetAllActions().Find(Owner))
+    {
+        for (UBlueprintNodeSpawner* NodeSpawner : *ActionList)
+        {
+            if (NodeSpawner)
+            {
+                AddSpawner(Owner, NodeSpawner);
+            }
+        }
+    }
+}
+
+void FBlueprintPinCompatibilityIndex::RemoveOwner(const FObjectKey& Owner)
+{
+    TArray<int32> Slots;
+    if (!SlotsByOwner.RemoveAndCopyValue(Owner, Slots))
+    {
+        return;
+    }
+
+    // Pin type lists keep pointing here; queries skip the slot for its missing spawner
+    for (int32 Slot : Slots)
+    {
+        Entries[Slot] = FIndexedEntry();
+        ++RemovedCount;
+    }
+}
+
+void FBlueprintPinCompatibilityIndex::AddSpawner(const FObjectKey& Owner, UBlueprintNodeSpawner* Spawner)
+{
+    UEdGraphNode* TemplateNode = Spawner->GetTemplateNode();
+    if (!TemplateNode)
+    {
+        return;
+    }
+
+    FIndexedEntry Indexed;
+    FString Keywords;
+    DescribeNode(TemplateNode, Indexed.Entry, Keywords);
+    Indexed.Entry.Spawner = Spawner;
+    Indexed.Owner = Owner;
+    Indexed.LowerText = FString::Join(TArray<FString>{ Indexed.Entry.Title, Indexed.Entry.Category, Indexed.Entry.Tooltip, Keywords }, TEXT("\n")).ToLower();
+
+    const UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode);
+    UFunction* Function = FunctionNode ? FunctionNode->GetTargetFunction() : nullptr;
+    UClass* FunctionClass = Function ? Function->GetOwnerClass() : nullptr;
+    const bool bLibraryFunction = FunctionClass == UKismetMathLibrary::StaticClass() || FunctionClass == UKismetSystemLibrary::StaticClass();
+    const bool bGeneral = IsGeneralNode(TemplateNode);
+
+    // Slots only grow, so every list stays in database order
+    const int32 Slot = Entries.Num();
+    if (bGeneral)
+    {
+        AnySlots.Add(Slot);
+    }
+    if (bGeneral || (bLibraryFunction && HasNumericProperty(Function)))
+    {
+        NumericSlots.Add(Slot);
+    }
+    if (bGeneral || !FunctionNode || bLibraryFunction || FunctionClass == UGameplayStatics::StaticClass())
+    {
+        WildcardSlots.Add(Slot);
+    }
+    if (FunctionClass && !bGeneral)
+    {
+        SlotsByFunctionClass.FindOrAdd(FunctionClass).Add(Slot);
+    }
+
+    SlotsByOwner.FindOrAdd(Owner).Add(Slot);
+    Entries.Add(MoveTemp(Indexed));
+}
+
+const TArray<int32>& FBlueprintPinCompatibilityIndex::GetObjectSlots(UClass* TargetClass)
+{
+    if (const TArray<int32>* Slots = ObjectSlotsByClass.Find(TargetClass))
+    {
+        return *Slots;
+    }
+
+    // Functions of the class itself, its parents (callable on it) and its children (callable after a cast)
+    TArray<int32> Slots = AnySlots;
+    TArray<int32> Merged;
+    for (const TPair<TWeakObjectPtr<UClass>, TArray<int32>>& Pair : SlotsByFunctionClass)
+    {
+        const UClass* FunctionClass = Pair.Key.Get();
+        if (FunctionClass && (FunctionClass->IsChildOf(TargetClass) || TargetClass->IsChildOf(FunctionClass)))
+        {
+            MergeSlots(Slots, Pair.Value, Merged);
+            Swap(Slots, Merged);
+        }
+    }
+    return ObjectSlotsByClass.Add(TargetClass, MoveTemp(Slots));
+}
+
+bool FBlueprintPinCompatibilityIndex::IsLive(const FIndexedEntry& Indexed)
+{
+    return Indexed.Entry.Spawner.IsValid();
+}
+
+void FBlueprintPinCompatibilityIndex::HandleEntryUpdated(UObject* ActionKey)
+{
+    if (bBuilt && ActionKey)
+    {
+        PendingOwners.Add(FObjectKey(ActionKey));
+    }
+}
+
+void FBlueprintPinCompatibilityIndex::HandleEntryRemoved(UObject* ActionKey)
+{
+    // Re-adding a removed entry finds no actions for it, which leaves it removed
+    HandleEntryUpdated(ActionKey);
+}
+
+void FBlueprintPinCompatibilityIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code replaces spawners and the classes they are indexed by
+    bBuilt = false;
+    CacheCounters.RecordInvalidation();
+}
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class UBlueprintNodeSpawner;
+
+/**
+ * Index over FBlueprintActionDatabase of the actions get_actions_for_pin offers for each pin type
+ *
+ * Each node spawner is described once (title, category, tooltip and the names the command reports)
+ * and sorted into the pin types it is offered for:
+ *   - "any": flow control, casts, struct make/break, events, variables and the other general
+ *     nodes, offered for every pin type (exec, bool, struct:FVector, ...)
+ *   - "numeric": those and the KismetMathLibrary/KismetSystemLibrary functions with a float, int
+ *     or double parameter, for float, int, integer and real pins
+ *   - "wildcard": the general nodes, every non-function node and the KismetMathLibrary,
+ *     KismetSystemLibrary and GameplayStatics functions, for wildcard and untyped pins
+ *   - "object:<class path>": the general nodes and the functions of that class, its parents and
+ *     its children. Functions are indexed by their owning class, and the list for a class is put
+ *     together from those on its first query and kept until the index changes.
+ * A query walks its pin type's list in database order, so it only applies the search filter.
+ *
+ * Built by the first query, after the database has registered its actions. Database entries
+ * refreshed or removed later are queued through OnEntryUpdated/OnEntryRemoved and re-described by
+ * the next query; a code reload drops the index.
+ *
+ * Game thread only.
+ */
+class FBlueprintPinCompatibilityIndex
+{
+public:
+    /** A described node spawner */
+    struct FEntry
+    {
+        TWeakObjectPtr<UBlueprintNodeSpawner> Spawner;
+        FString Title;
+        FString Category;
+        FString Tooltip;
+        FString NodeClass;
+        /** Target function of function call nodes; empty for other nodes */
+        FString FunctionName;
+        FString ClassName;
+        bool bIsMathFunction = false;
+    };
+
+    static FBlueprintPinCompatibilityIndex& Get();
+
+    /** Stop following the database and drop the index */
+    void Shutdown();
+
+    /** Build the index, and with it the action database, now rather than on the first query */
+    void Prewarm();
+
+    /**
+     * Find the actions offered for a pin type
+     * @param PinType Pin category as get_actions_for_pin takes it (object, float, exec, wildcard, ...)
+     * @param TargetClass Class of an object pin, or nullptr
+     * @param SearchFilter Case-insensitive substring of title, category, tooltip or keywords, or empty for all
+     * @param MaxResults Maximum number of results
+     * @param OutMatches Receives the matches in database order; valid until the next query
+     */
+    void Find(const FString& PinType, UClass* TargetClass, const FString& SearchFilter, int32 MaxResults, TArray<const FEntry*>& OutMatches);
+
+private:
+    FBlueprintPinCompatibilityIndex() = default;
+
+    struct FIndexedEntry
+    {
+        FEntry Entry;
+        FObjectKey Owner;
+        /** Lowercase title, category, tooltip and keywords, for the search filter */
+        FString LowerText;
+    };
+
+    /** Build the index if missing and apply the queued database changes */
+    void EnsureCurrent();
+
+    void Build();
+    void AddOwner(const FObjectKey& Owner);
+    void RemoveOwner(const FObjectKey& Owner);
+    void AddSpawner(const FObjectKey& Owner, UBlueprintNodeSpawner* Spawner);
+
+    /** @return The slots offered for object pins of the class, in database order */
+    const TArray<int32>& GetObjectSlots(UClass* TargetClass);
+
+    static bool IsLive(const FIndexedEntry& Indexed);
+
+    void HandleEntryUpdated(UObject* ActionKey);
+    void HandleEntryRemoved(UObject* ActionKey);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    /** Indexed slots are never reused; removed ones are left without a spawner */
+    TArray<FIndexedEntry> Entries;
+    TMap<FObjectKey, TArray<int32>> SlotsByOwner;
+    TArray<int32> AnySlots;
+    TArray<int32> NumericSlots;
+    TArray<int32> WildcardSlots;
+    /** Function call slots by the class owning the function */
+    TMap<TWeakObjectPtr<UClass>, TArray<int32>> SlotsByFunctionClass;
+    /** Object pin lists put together so far; dropped whenever slots are added */
+    TMap<TWeakObjectPtr<UClass>, TArray<int32>> ObjectSlotsByClass;
+    int32 RemovedCount = 0;
+    bool bBuilt = false;
+    /** Queries that found the index current, or had to build it */
+    FMCPCacheCounters CacheCounters;
+
+    /** Database entries changed since the last query */
+    TSet<FObjectKey> PendingOwners;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
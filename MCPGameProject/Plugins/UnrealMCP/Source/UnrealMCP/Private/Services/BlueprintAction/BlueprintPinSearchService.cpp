@@ -2,25 +2,8 @@
 
 #include "Services/BlueprintAction/BlueprintPinSearchService.h"
 #include "Services/NodeCreation/NodeCreationHelpers.h"
-#include "BlueprintActionDatabase.h"
-#include "BlueprintNodeSpawner.h"
-#include "K2Node_CallFunction.h"
-#include "K2Node_IfThenElse.h"
-#include "K2Node_ExecutionSequence.h"
-#include "K2Node_CustomEvent.h"
-#include "K2Node_DynamicCast.h"
-#include "K2Node_BreakStruct.h"
-#include "K2Node_MakeStruct.h"
-#include "K2Node_ConstructObjectFromClass.h"
-#include "K2Node_MacroInstance.h"
-#include "K2Node_InputAction.h"
-#include "K2Node_Self.h"
-#include "K2Node_Event.h"
-#include "K2Node_VariableGet.h"
-#include "K2Node_VariableSet.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "Kismet/KismetSystemLibrary.h"
-#include "Kismet/GameplayStatics.h"
+#include "Services/BlueprintAction/BlueprintPinCompatibilityIndex.h"
+#include "UObject/UnrealType.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 
@@ -42,10 +25,6 @@ FString FBlueprintPinSearchService::GetActionsForPin(
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ActionsArray;
     
-    // Get the blueprint action database
-    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
-    
     // Before using pin_subcategory or class name for type resolution, convert short names to full path names
     FString ResolvedPinSubcategory = PinSubCategory;
     if (!PinSubCategory.IsEmpty() && !PinSubCategory.StartsWith("/"))
@@ -59,7 +38,6 @@ FString FBlueprintPinSearchService::GetActionsForPin(
     }
     
     UE_LOG(LogTemp, Warning, TEXT("GetActionsForPin: Searching for pin type '%s' with subcategory '%s'"), *PinType, *ResolvedPinSubcategory);
-    UE_LOG(LogTemp, Warning, TEXT("Total actions in database: %d"), ActionRegistry.Num());
     
     // OPTIMIZATION: Resolve target class ONCE before the loop, not inside it
     UClass* TargetClass = nullptr;
@@ -77,231 +55,26 @@ FString FBlueprintPinSearchService::GetActionsForPin(
         }
     }
     
-    // Find matching actions based on pin type
-    for (const auto& ActionPair : ActionRegistry)
+    // Actions offered for this pin type, from the pin compatibility index
+    TArray<const FBlueprintPinCompatibilityIndex::FEntry*> Matches;
+    FBlueprintPinCompatibilityIndex::Get().Find(PinType, TargetClass, SearchFilter, MaxResults, Matches);
+    for (const FBlueprintPinCompatibilityIndex::FEntry* Match : Matches)
     {
-        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
+        ActionObj->SetStringField(TEXT("node_class"), Match->NodeClass);
+        if (!Match->FunctionName.IsEmpty())
         {
-            if (NodeSpawner && IsValid(NodeSpawner))
+            if (Match->bIsMathFunction)
             {
-                // Get template node to determine what type of node this is
-                UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
-                if (!TemplateNode)
-                {
-                    continue;
-                }
-                
-                bool bRelevant = false;
-                
-                // Check for control flow nodes that are always relevant
-                if (TemplateNode->IsA<UK2Node_IfThenElse>() ||
-                    TemplateNode->IsA<UK2Node_ExecutionSequence>() ||
-                    TemplateNode->IsA<UK2Node_CustomEvent>() ||
-                    TemplateNode->IsA<UK2Node_DynamicCast>() ||
-                    TemplateNode->IsA<UK2Node_BreakStruct>() ||
-                    TemplateNode->IsA<UK2Node_MakeStruct>() ||
-                    TemplateNode->IsA<UK2Node_ConstructObjectFromClass>() ||
-                    TemplateNode->IsA<UK2Node_MacroInstance>() ||
-                    TemplateNode->IsA<UK2Node_InputAction>() ||
-                    TemplateNode->IsA<UK2Node_Self>() ||
-                    TemplateNode->IsA<UK2Node_Event>() ||
-                    TemplateNode->IsA<UK2Node_VariableGet>() ||
-                    TemplateNode->IsA<UK2Node_VariableSet>())
-                {
-                    bRelevant = true;
-                }
-                
-                // For mathematical operators, check if it's from UKismetMathLibrary
-                if (!bRelevant && (PinType.Equals(TEXT("float"), ESearchCase::IgnoreCase) || 
-                    PinType.Equals(TEXT("int"), ESearchCase::IgnoreCase) || 
-                    PinType.Equals(TEXT("integer"), ESearchCase::IgnoreCase) ||
-                    PinType.Equals(TEXT("real"), ESearchCase::IgnoreCase)))
-                {
-                    if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                    {
-                        if (UFunction* Function = FunctionNode->GetTargetFunction())
-                        {
-                            UClass* OwnerClass = Function->GetOwnerClass();
-                            if (OwnerClass == UKismetMathLibrary::StaticClass() ||
-                                OwnerClass == UKismetSystemLibrary::StaticClass())
-                            {
-                                // Also check if function has float/int inputs or outputs
-                                for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
-                                {
-                                    FProperty* Property = *PropIt;
-                                    if (Property->IsA<FFloatProperty>() || Property->IsA<FIntProperty>() || Property->IsA<FDoubleProperty>())
-                                    {
-                                        bRelevant = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-                
-                // For object types, check class compatibility
-                if (!bRelevant && PinType.Equals(TEXT("object"), ESearchCase::IgnoreCase) && TargetClass)
-                {
-                    // TargetClass already resolved outside the loop for performance
-                    if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                    {
-                        if (UFunction* Function = FunctionNode->GetTargetFunction())
-                        {
-                            if (Function->GetOwnerClass()->IsChildOf(TargetClass) || TargetClass->IsChildOf(Function->GetOwnerClass()))
-                            {
-                                bRelevant = true;
-                            }
-                        }
-                    }
-                }
-                
-                // Default case - include more basic actions for wildcard/empty pin types
-                if (!bRelevant && (PinType.Equals(TEXT("wildcard"), ESearchCase::IgnoreCase) || PinType.IsEmpty()))
-                {
-                    if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                    {
-                        if (UFunction* Function = FunctionNode->GetTargetFunction())
-                        {
-                            UClass* OwnerClass = Function->GetOwnerClass();
-                            if (OwnerClass == UKismetMathLibrary::StaticClass() ||
-                                OwnerClass == UKismetSystemLibrary::StaticClass() ||
-                                OwnerClass == UGameplayStatics::StaticClass())
-                            {
-                                bRelevant = true;
-                            }
-                        }
-                    }
-                    // Also include control flow nodes for wildcard searches
-                    else
-                    {
-                        bRelevant = true; // Include all non-function nodes for wildcard
-                    }
-                }
-                
-                if (bRelevant)
-                {
-                    TSharedPtr<FJsonObject> ActionObj = MakeShared<FJsonObject>();
-                    
-                    // Get what information we can from the node spawner
-                    FString ActionName = TEXT("Unknown Action");
-                    FString Category = TEXT("Unknown");
-                    FString Tooltip = TEXT("");
-                    FString Keywords = TEXT("");
-                    FString NodeType = TEXT("Unknown");
-                    
-                    // Determine node type and get better naming
-                    if (TemplateNode->IsA<UK2Node_IfThenElse>())
-                    {
-                        ActionName = TEXT("Branch");
-                        Category = TEXT("Flow Control");
-                        NodeType = TEXT("Branch");
-                        Tooltip = TEXT("Conditional execution based on boolean input");
-                        Keywords = TEXT("if then else conditional branch");
-                        ActionObj->SetStringField(TEXT("node_class"), TEXT("UK2Node_IfThenElse"));
-                    }
-                    else if (TemplateNode->IsA<UK2Node_ExecutionSequence>())
-                    {
-                        ActionName = TEXT("Sequence");
-                        Category = TEXT("Flow Control");
-                        NodeType = TEXT("Sequence");
-                        Tooltip = TEXT("Execute multiple outputs in order");
-                        Keywords = TEXT("sequence multiple execution order");
-                        ActionObj->SetStringField(TEXT("node_class"), TEXT("UK2Node_ExecutionSequence"));
-                    }
-                    else if (TemplateNode->IsA<UK2Node_DynamicCast>())
-                    {
-                        ActionName = TEXT("Cast");
-                        Category = TEXT("Utilities");
-                        NodeType = TEXT("Cast");
-                        Tooltip = TEXT("Cast object to different type");
-                        Keywords = TEXT("cast convert type object");
-                        ActionObj->SetStringField(TEXT("node_class"), TEXT("UK2Node_DynamicCast"));
-                    }
-                    else if (TemplateNode->IsA<UK2Node_CustomEvent>())
-                    {
-                        ActionName = TEXT("Custom Event");
-                        Category = TEXT("Events");
-                        NodeType = TEXT("CustomEvent");
-                        Tooltip = TEXT("Create custom event that can be called");
-                        Keywords = TEXT("custom event call");
-                        ActionObj->SetStringField(TEXT("node_class"), TEXT("UK2Node_CustomEvent"));
-                    }
-                    else if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
-                    {
-                        ActionName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                        if (ActionName.IsEmpty())
-                        {
-                            ActionName = K2Node->GetClass()->GetName();
-                        }
-                        NodeType = K2Node->GetClass()->GetName();
-                        ActionObj->SetStringField(TEXT("node_class"), NodeType);
-                        
-                        // Try to get function information if it's a function call
-                        if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(K2Node))
-                        {
-                            if (UFunction* Function = FunctionNode->GetTargetFunction())
-                            {
-                                ActionName = Function->GetName();
-                                Category = Function->GetOwnerClass()->GetName();
-                                
-                                // Mark math functions
-                                if (Function->GetOwnerClass() == UKismetMathLibrary::StaticClass())
-                                {
-                                    Category = TEXT("Math");
-                                    ActionObj->SetBoolField(TEXT("is_math_function"), true);
-                                }
-                                
-                                ActionObj->SetStringField(TEXT("function_name"), Function->GetName());
-                                ActionObj->SetStringField(TEXT("class_name"), Function->GetOwnerClass()->GetName());
-                            }
-                        }
-                    }
-                    else
-                    {
-                        ActionName = TemplateNode->GetClass()->GetName();
-                        NodeType = ActionName;
-                        ActionObj->SetStringField(TEXT("node_class"), NodeType);
-                    }
-                    
-                    ActionObj->SetStringField(TEXT("title"), ActionName);
-                    ActionObj->SetStringField(TEXT("tooltip"), Tooltip);
-                    ActionObj->SetStringField(TEXT("category"), Category);
-                    
-                    // Apply search filter if provided
-                    bool bPassesFilter = true;
-                    if (!SearchFilter.IsEmpty())
-                    {
-                        FString SearchLower = SearchFilter.ToLower();
-                        FString ActionNameLower = ActionName.ToLower();
-                        FString CategoryLower = Category.ToLower();
-                        FString TooltipLower = Tooltip.ToLower();
-                        FString KeywordsLower = Keywords.ToLower();
-                        
-                        bPassesFilter = ActionNameLower.Contains(SearchLower) ||
-                                       CategoryLower.Contains(SearchLower) ||
-                                       TooltipLower.Contains(SearchLower) ||
-                                       KeywordsLower.Contains(SearchLower);
-                    }
-                    
-                    if (bPassesFilter)
-                    {
-                        ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
-                    }
-                    
-                    // Limit results to avoid overwhelming output
-                    if (ActionsArray.Num() >= MaxResults)
-                    {
-                        break;
-                    }
-                }
+                ActionObj->SetBoolField(TEXT("is_math_function"), true);
             }
+            ActionObj->SetStringField(TEXT("function_name"), Match->FunctionName);
+            ActionObj->SetStringField(TEXT("class_name"), Match->ClassName);
         }
-        
-        if (ActionsArray.Num() >= MaxResults)
-        {
-            break;
-        }
+        ActionObj->SetStringField(TEXT("title"), Match->Title);
+        ActionObj->SetStringField(TEXT("tooltip"), Match->Tooltip);
+        ActionObj->SetStringField(TEXT("category"), Match->Category);
+        ActionsArray.Add(MakeShared<FJsonValueObject>(ActionObj));
     }
     
     // --- BEGIN: Add native property getter/setter nodes for pin context ---
@@ -382,20 +155,6 @@ FString FBlueprintPinSearchService::ResolveShortClassName(const FString& ShortNa
     return FString();
 }
 
-bool FBlueprintPinSearchService::IsRelevantForMathOperations(UEdGraphNode* TemplateNode, const FString& PinType)
-{
-    // TODO: Move math operation relevance check (lines ~455-491)
-    // Checks if node is from KismetMathLibrary and has float/int properties
-    return false;
-}
-
-bool FBlueprintPinSearchService::IsRelevantForObjectType(UEdGraphNode* TemplateNode, UClass* TargetClass)
-{
-    // TODO: Move object type relevance check (lines ~494-507)
-    // Checks class compatibility using IsChildOf
-    return false;
-}
-
 void FBlueprintPinSearchService::AddNativePropertyNodes(
     UClass* TargetClass,
     TArray<TSharedPtr<FJsonValue>>& OutActions,
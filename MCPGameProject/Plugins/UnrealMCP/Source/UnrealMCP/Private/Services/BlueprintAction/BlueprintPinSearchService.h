@@ -44,22 +44,6 @@ private:
      */
     FString ResolveShortClassName(const FString& ShortName);
 
-    /**
-     * Check if node is relevant for math/numeric operations
-     * @param TemplateNode Node to check
-     * @param PinType Pin type being searched
-     * @return true if node is relevant for math operations
-     */
-    bool IsRelevantForMathOperations(class UEdGraphNode* TemplateNode, const FString& PinType);
-
-    /**
-     * Check if node is relevant for object pin type
-     * @param TemplateNode Node to check
-     * @param TargetClass Class to check compatibility with
-     * @return true if node is relevant for the object type
-     */
-    bool IsRelevantForObjectType(class UEdGraphNode* TemplateNode, class UClass* TargetClass);
-
     /**
      * Add native property getter/setter nodes for a class
      * @param TargetClass Class to get properties from
@@ -1,5 +1,6 @@
 #include "Services/BlueprintActionService.h"
 #include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommands.h"
+#include "Services/BlueprintAction/BlueprintNodePinInfoService.h"
 
 FString FBlueprintActionService::GetActionsForPin(const FString& PinType, const FString& PinSubCategory, const FString& SearchFilter, int32 MaxResults)
 {
@@ -26,6 +27,12 @@ FString FBlueprintActionService::GetNodePinInfo(const FString& NodeName, const F
     return UUnrealMCPBlueprintActionCommands::GetNodePinInfo(NodeName, PinName, ClassName);
 }
 
+FString FBlueprintActionService::GetNodePinInfoBatch(const TArray<FNodePinQuery>& Queries)
+{
+    FBlueprintNodePinInfoService Service;
+    return Service.GetNodePinInfoBatch(Queries);
+}
+
 FString FBlueprintActionService::CreateNodeByActionName(const FString& BlueprintName, const FString& FunctionName, const FString& ClassName, const FString& NodePosition, const FString& JsonParams)
 {
     UE_LOG(LogTemp, Warning, TEXT("*** SERVICE LAYER PROOF ***"));
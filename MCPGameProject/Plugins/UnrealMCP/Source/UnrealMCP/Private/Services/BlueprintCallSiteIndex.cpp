@@ -0,0 +1,191 @@
+#include "Services/BlueprintCallSiteIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "MCPLogging.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+FBlueprintCallSiteIndex& FBlueprintCallSiteIndex::Get()
+{
+    static FBlueprintCallSiteIndex Instance;
+    return Instance;
+}
+
+void FBlueprintCallSiteIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FBlueprintCallSiteIndex::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FBlueprintCallSiteIndex::HandleAssetRenamed);
+        PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBlueprintCallSiteIndex::HandlePackageSaved);
+        bInitialized = true;
+
+        FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_call_site_index"), TEXT("index"), CacheCounters,
+            [this]() { return static_cast<int64>(Packages.Num()); });
+    }
+}
+
+void FBlueprintCallSiteIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    PackageSavedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_call_site_index"));
+
+    Packages.Empty();
+}
+
+const FBlueprintCallSiteIndex::FPackageCallSites* FBlueprintCallSiteIndex::FindPackage(FName PackageName)
+{
+    check(IsInGameThread());
+    if (const FIndexedPackage* Indexed = Packages.Find(PackageName))
+    {
+        if (IsCurrent(*Indexed))
+        {
+            CacheCounters.RecordHit();
+            return &Indexed->CallSites;
+        }
+    }
+
+    // Ask the asset registry first, so packages without a Blueprint (levels, meshes, ...) are never loaded
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return nullptr;
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAssetsByPackageName(PackageName, Assets);
+    for (const FAssetData& Asset : Assets)
+    {
+        if (Asset.IsInstanceOf(UBlueprint::StaticClass()))
+        {
+            if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+            {
+                return &Scan(Blueprint).CallSites;
+            }
+        }
+    }
+    return nullptr;
+}
+
+const FBlueprintCallSiteIndex::FPackageCallSites& FBlueprintCallSiteIndex::FindBlueprint(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+    check(Blueprint);
+    if (const FIndexedPackage* Indexed = Packages.Find(Blueprint->GetPackage()->GetFName()))
+    {
+        if (Indexed->Blueprint.Get() == Blueprint && IsCurrent(*Indexed))
+        {
+            CacheCounters.RecordHit();
+            return Indexed->CallSites;
+        }
+    }
+    return Scan(Blueprint).CallSites;
+}
+
+bool FBlueprintCallSiteIndex::IsCurrent(const FIndexedPackage& Indexed)
+{
+    // An unloaded Blueprint matches its package file, which a save or rename would have reported
+    if (Indexed.bScannedDirty)
+    {
+        return false;
+    }
+    const UBlueprint* Blueprint = Indexed.Blueprint.Get();
+    return !Blueprint || !Blueprint->GetPackage()->IsDirty();
+}
+
+FBlueprintCallSiteIndex::FIndexedPackage& FBlueprintCallSiteIndex::Scan(UBlueprint* Blueprint)
+{
+    CacheCounters.RecordMiss();
+    FIndexedPackage& Indexed = Packages.FindOrAdd(Blueprint->GetPackage()->GetFName());
+    Indexed.Blueprint = Blueprint;
+    Indexed.bScannedDirty = Blueprint->GetPackage()->IsDirty();
+    Indexed.CallSites.BlueprintName = Blueprint->GetName();
+    Indexed.CallSites.CallSites.Reset();
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+            UFunction* Function = CallNode ? CallNode->GetTargetFunction() : nullptr;
+            if (!Function)
+            {
+                continue;
+            }
+
+            FCallSite& Site = Indexed.CallSites.CallSites.AddDefaulted_GetRef();
+            Site.FunctionName = Function->GetName();
+            if (const UClass* OwnerClass = Function->GetOwnerClass())
+            {
+                Site.OwnerClassName = OwnerClass->GetName();
+                Site.OwnerClassPath = OwnerClass->GetPathName();
+            }
+            Site.GraphName = Graph->GetName();
+            Site.NodeGuid = Node->NodeGuid;
+            Site.NodeTitle = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+            Site.PosX = Node->NodePosX;
+            Site.PosY = Node->NodePosY;
+        }
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("BlueprintCallSiteIndex: Indexed %d call site(s) in %s"),
+        Indexed.CallSites.CallSites.Num(), *Blueprint->GetPathName());
+    return Indexed;
+}
+
+void FBlueprintCallSiteIndex::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+    // The Blueprint is loaded, so scanning it again on the next lookup costs no load
+    if (Package && Packages.Remove(Package->GetFName()) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FBlueprintCallSiteIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (Packages.Remove(AssetData.PackageName) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FBlueprintCallSiteIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (Packages.Remove(FSoftObjectPath(OldObjectPath).GetLongPackageFName()) + Packages.Remove(AssetData.PackageName) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
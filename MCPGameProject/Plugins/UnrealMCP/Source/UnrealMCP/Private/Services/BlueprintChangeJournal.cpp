@@ -0,0 +1,450 @@
+#include "Services/BlueprintChangeJournal.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "MCPLogging.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectThreadContext.h"
+
+namespace
+{
+    uint32 HashPinType(const FEdGraphPinType& PinType)
+    {
+        uint32 Hash = GetTypeHash(PinType.PinCategory);
+        Hash = HashCombine(Hash, GetTypeHash(PinType.PinSubCategory));
+        Hash = HashCombine(Hash, GetTypeHash(PinType.PinSubCategoryObject.Get() ? PinType.PinSubCategoryObject->GetPathName() : FString()));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(PinType.ContainerType)));
+        return Hash;
+    }
+
+    /** Hash of the pins' names, types, defaults and links, in pin order */
+    uint32 HashPins(const UEdGraphNode* Node)
+    {
+        uint32 Hash = 0;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+            Hash = HashCombine(Hash, GetTypeHash(Pin->PinName));
+            Hash = HashCombine(Hash, HashPinType(Pin->PinType));
+            Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultValue));
+            Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : FString()));
+            Hash = HashCombine(Hash, GetTypeHash(Pin->DefaultTextValue.ToString()));
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+                {
+                    Hash = HashCombine(Hash, GetTypeHash(LinkedPin->GetOwningNodeUnchecked()->NodeGuid));
+                    Hash = HashCombine(Hash, GetTypeHash(LinkedPin->PinName));
+                }
+            }
+        }
+        return Hash;
+    }
+}
+
+FBlueprintChangeJournal& FBlueprintChangeJournal::Get()
+{
+    static FBlueprintChangeJournal Instance;
+    return Instance;
+}
+
+void FBlueprintChangeJournal::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FBlueprintChangeJournal::HandleObjectModified);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FBlueprintChangeJournal::HandleUndoRedo);
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FBlueprintChangeJournal::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FBlueprintChangeJournal::HandleAssetRenamed);
+    }
+    bInitialized = true;
+}
+
+void FBlueprintChangeJournal::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+    ObjectModifiedHandle.Reset();
+    UndoRedoHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    bInitialized = false;
+
+    Journals.Empty();
+    PendingPaths.Empty();
+}
+
+void FBlueprintChangeJournal::NoteModified(UBlueprint* Blueprint)
+{
+    if (!bInitialized || !Blueprint || !IsInGameThread())
+    {
+        return;
+    }
+    MarkPending(Blueprint);
+}
+
+void FBlueprintChangeJournal::FlushPendingChanges(const FString& Source)
+{
+    check(IsInGameThread());
+    if (PendingPaths.Num() == 0)
+    {
+        return;
+    }
+
+    TSet<FString> Paths = MoveTemp(PendingPaths);
+    PendingPaths.Reset();
+    for (const FString& Path : Paths)
+    {
+        if (FJournal* Journal = Journals.Find(Path))
+        {
+            RecordChanges(*Journal, Source);
+        }
+    }
+}
+
+void FBlueprintChangeJournal::GetChangesSince(UBlueprint* Blueprint, int32 SinceRevision, TArray<FChange>& OutChanges, int32& OutRevision, bool& bOutTruncated)
+{
+    check(IsInGameThread());
+    check(Blueprint);
+
+    // Edits made in the editor this frame are not on the journal until recorded
+    FlushPendingChanges(TEXT("editor"));
+
+    const FJournal& Journal = FindOrStartJournal(Blueprint);
+    OutChanges.Reset();
+    for (const FChange& Change : Journal.Changes)
+    {
+        if (Change.Revision > SinceRevision)
+        {
+            OutChanges.Add(Change);
+        }
+    }
+    OutRevision = Journal.Revision;
+    bOutTruncated = SinceRevision + 1 < Journal.OldestRevision;
+}
+
+FBlueprintChangeJournal::FJournal& FBlueprintChangeJournal::FindOrStartJournal(UBlueprint* Blueprint)
+{
+    const FString Path = Blueprint->GetPathName();
+    if (FJournal* Journal = Journals.Find(Path))
+    {
+        // A reloaded Blueprint is a new object; its graphs are compared with the old snapshot
+        Journal->Blueprint = Blueprint;
+        return *Journal;
+    }
+
+    FJournal& Journal = Journals.Add(Path);
+    Journal.Blueprint = Blueprint;
+    TakeSnapshot(Blueprint, Journal.Snapshot);
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("BlueprintChangeJournal: Tracking %s"), *Path);
+    return Journal;
+}
+
+void FBlueprintChangeJournal::RecordChanges(FJournal& Journal, const FString& Source)
+{
+    UBlueprint* Blueprint = Journal.Blueprint.Get();
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    FSnapshot Snapshot;
+    TakeSnapshot(Blueprint, Snapshot);
+
+    TArray<FChange> Changes;
+    DiffStates(Journal.Snapshot.Graphs, Snapshot.Graphs, TEXT("graph"),
+        [](const FNamedState& Before, const FNamedState& After, TArray<FString>& OutChanged)
+        {
+            if (Before.Name != After.Name) OutChanged.Add(TEXT("name"));
+        },
+        Changes);
+    DiffStates(Journal.Snapshot.Nodes, Snapshot.Nodes, TEXT("node"),
+        [](const FNodeState& Before, const FNodeState& After, TArray<FString>& OutChanged)
+        {
+            if (Before.Graph != After.Graph) OutChanged.Add(TEXT("graph"));
+            if (Before.Position != After.Position) OutChanged.Add(TEXT("position"));
+            if (Before.PinsHash != After.PinsHash) OutChanged.Add(TEXT("pins"));
+            if (Before.Comment != After.Comment) OutChanged.Add(TEXT("comment"));
+            if (Before.Title != After.Title) OutChanged.Add(TEXT("title"));
+        },
+        Changes);
+    DiffStates(Journal.Snapshot.Variables, Snapshot.Variables, TEXT("variable"),
+        [](const FNamedState& Before, const FNamedState& After, TArray<FString>& OutChanged)
+        {
+            if (Before.Name != After.Name) OutChanged.Add(TEXT("name"));
+            if (Before.DetailsHash != After.DetailsHash) OutChanged.Add(TEXT("definition"));
+        },
+        Changes);
+    DiffStates(Journal.Snapshot.Components, Snapshot.Components, TEXT("component"),
+        [](const FNamedState& Before, const FNamedState& After, TArray<FString>& OutChanged)
+        {
+            if (Before.Name != After.Name) OutChanged.Add(TEXT("name"));
+            if (Before.DetailsHash != After.DetailsHash) OutChanged.Add(TEXT("hierarchy"));
+        },
+        Changes);
+
+    Journal.Snapshot = MoveTemp(Snapshot);
+    if (Changes.Num() == 0)
+    {
+        return;
+    }
+
+    Journal.Revision++;
+    for (FChange& Change : Changes)
+    {
+        Change.Revision = Journal.Revision;
+        Change.Source = Source;
+    }
+    Journal.Changes.Append(MoveTemp(Changes));
+
+    const int32 Excess = Journal.Changes.Num() - MaxChangesPerBlueprint;
+    if (Excess > 0)
+    {
+        Journal.Changes.RemoveAt(0, Excess);
+    }
+    Journal.OldestRevision = Journal.Changes.Num() > 0 ? Journal.Changes[0].Revision : Journal.Revision + 1;
+}
+
+void FBlueprintChangeJournal::TakeSnapshot(UBlueprint* Blueprint, FSnapshot& OutSnapshot)
+{
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        const FString GraphName = Graph->GetName();
+        OutSnapshot.Graphs.Add(Graph->GraphGuid, { GraphName, 0 });
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            FNodeState& State = OutSnapshot.Nodes.Add(Node->NodeGuid);
+            State.Graph = GraphName;
+            State.Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+            State.Position = FIntPoint(Node->NodePosX, Node->NodePosY);
+            State.PinsHash = HashPins(Node);
+            State.Comment = Node->NodeComment;
+        }
+    }
+
+    for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+    {
+        uint32 Hash = HashPinType(Variable.VarType);
+        Hash = HashCombine(Hash, GetTypeHash(Variable.DefaultValue));
+        Hash = HashCombine(Hash, GetTypeHash(Variable.PropertyFlags));
+        Hash = HashCombine(Hash, GetTypeHash(Variable.Category.ToString()));
+        OutSnapshot.Variables.Add(Variable.VarGuid, { Variable.VarName.ToString(), Hash });
+    }
+
+    if (Blueprint->SimpleConstructionScript)
+    {
+        TMap<const USCS_Node*, FName> ParentNames;
+        const TArray<USCS_Node*>& SCSNodes = Blueprint->SimpleConstructionScript->GetAllNodes();
+        for (const USCS_Node* SCSNode : SCSNodes)
+        {
+            if (SCSNode)
+            {
+                for (const USCS_Node* Child : SCSNode->GetChildNodes())
+                {
+                    ParentNames.Add(Child, SCSNode->GetVariableName());
+                }
+            }
+        }
+
+        for (const USCS_Node* SCSNode : SCSNodes)
+        {
+            if (!SCSNode)
+            {
+                continue;
+            }
+            const FName* ParentName = ParentNames.Find(SCSNode);
+            uint32 Hash = GetTypeHash(SCSNode->ComponentClass ? SCSNode->ComponentClass->GetPathName() : FString());
+            Hash = HashCombine(Hash, GetTypeHash(ParentName ? *ParentName : SCSNode->ParentComponentOrVariableName));
+            OutSnapshot.Components.Add(SCSNode->VariableGuid, { SCSNode->GetVariableName().ToString(), Hash });
+        }
+    }
+}
+
+template <typename StateType, typename CompareType>
+void FBlueprintChangeJournal::DiffStates(const TMap<FGuid, StateType>& Before, const TMap<FGuid, StateType>& After, const TCHAR* Type, CompareType Compare, TArray<FChange>& OutChanges)
+{
+    auto MakeChange = [&OutChanges, Type](const TCHAR* Action, const FGuid& Id, const StateType& State) -> FChange&
+    {
+        FChange& Change = OutChanges.AddDefaulted_GetRef();
+        Change.Action = Action;
+        Change.Type = Type;
+        Change.Id = Id.ToString();
+        if constexpr (std::is_same_v<StateType, FNodeState>)
+        {
+            Change.Name = State.Title;
+            Change.Graph = State.Graph;
+        }
+        else
+        {
+            Change.Name = State.Name;
+        }
+        return Change;
+    };
+
+    for (const TPair<FGuid, StateType>& Entry : Before)
+    {
+        if (!After.Contains(Entry.Key))
+        {
+            MakeChange(TEXT("removed"), Entry.Key, Entry.Value);
+        }
+    }
+    for (const TPair<FGuid, StateType>& Entry : After)
+    {
+        const StateType* Previous = Before.Find(Entry.Key);
+        if (!Previous)
+        {
+            MakeChange(TEXT("added"), Entry.Key, Entry.Value);
+            continue;
+        }
+
+        TArray<FString> Changed;
+        Compare(*Previous, Entry.Value, Changed);
+        if (Changed.Num() > 0)
+        {
+            MakeChange(TEXT("modified"), Entry.Key, Entry.Value).Changed = MoveTemp(Changed);
+        }
+    }
+}
+
+UBlueprint* FBlueprintChangeJournal::FindOwningBlueprint(UObject* Object)
+{
+    if (!Object || Object->GetOutermost() == GetTransientPackage())
+    {
+        return nullptr;
+    }
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        return Blueprint;
+    }
+    if (UBlueprint* Blueprint = Object->GetTypedOuter<UBlueprint>())
+    {
+        return Blueprint;
+    }
+
+    // Component templates and construction script nodes live in the generated class
+    UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Object);
+    if (!GeneratedClass)
+    {
+        GeneratedClass = Object->GetTypedOuter<UBlueprintGeneratedClass>();
+    }
+    return GeneratedClass ? Cast<UBlueprint>(GeneratedClass->ClassGeneratedBy) : nullptr;
+}
+
+void FBlueprintChangeJournal::MarkPending(UBlueprint* Blueprint)
+{
+    // Tracking starts here at the latest, so the state before the first change becomes the baseline
+    FindOrStartJournal(Blueprint);
+    PendingPaths.Add(Blueprint->GetPathName());
+
+    if (!TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FBlueprintChangeJournal::HandleTick));
+    }
+}
+
+bool FBlueprintChangeJournal::HandleTick(float DeltaTime)
+{
+    TickerHandle.Reset();
+    FlushPendingChanges(TEXT("editor"));
+    return false;
+}
+
+void FBlueprintChangeJournal::HandleObjectModified(UObject* Object)
+{
+    if (!IsInGameThread())
+    {
+        return;
+    }
+    UBlueprint* Blueprint = FindOwningBlueprint(Object);
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    // Loading and compiling touch objects too; neither may serve as a baseline
+    if (!Journals.Contains(Blueprint->GetPathName()) &&
+        (FUObjectThreadContext::Get().IsRoutingPostLoad || Blueprint->HasAnyFlags(RF_NeedLoad | RF_NeedPostLoad) || Blueprint->bBeingCompiled))
+    {
+        return;
+    }
+    MarkPending(Blueprint);
+}
+
+void FBlueprintChangeJournal::HandleUndoRedo()
+{
+    // Undo restores objects without modifying them; compare every loaded tracked Blueprint
+    for (const TPair<FString, FJournal>& Entry : Journals)
+    {
+        if (UBlueprint* Blueprint = Entry.Value.Blueprint.Get())
+        {
+            MarkPending(Blueprint);
+        }
+    }
+}
+
+void FBlueprintChangeJournal::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    const FString Path = AssetData.GetObjectPathString();
+    Journals.Remove(Path);
+    PendingPaths.Remove(Path);
+}
+
+void FBlueprintChangeJournal::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    FJournal Journal;
+    if (Journals.RemoveAndCopyValue(OldObjectPath, Journal))
+    {
+        Journals.Add(AssetData.GetObjectPathString(), MoveTemp(Journal));
+    }
+    if (PendingPaths.Remove(OldObjectPath) > 0)
+    {
+        PendingPaths.Add(AssetData.GetObjectPathString());
+    }
+}
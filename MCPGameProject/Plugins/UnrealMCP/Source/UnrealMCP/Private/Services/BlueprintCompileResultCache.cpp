@@ -0,0 +1,175 @@
+#include "Services/BlueprintCompileResultCache.h"
+#include "Editor.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FBlueprintCompileResultCache& FBlueprintCompileResultCache::Get()
+{
+    static FBlueprintCompileResultCache Instance;
+    return Instance;
+}
+
+void FBlueprintCompileResultCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FBlueprintCompileResultCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FBlueprintCompileResultCache::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FBlueprintCompileResultCache::HandleUndoRedo);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_compile_result_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Results.Num()); });
+    FMCPCacheBudget::Get().Register(TEXT("blueprint_compile_result_cache"), *this);
+}
+
+void FBlueprintCompileResultCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_compile_result_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("blueprint_compile_result_cache"));
+
+    Results.Empty();
+    ResetUsedBytes();
+}
+
+const FBlueprintCompileResultCache::FResult* FBlueprintCompileResultCache::Find(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+
+    // Without the change handlers an edit that keeps the status would go unnoticed
+    if (!bInitialized || !Blueprint)
+    {
+        return nullptr;
+    }
+
+    if (FCachedResult* Cached = Results.Find(Blueprint))
+    {
+        // Any edit or dependency change since the compile has moved the status off what it left
+        if (Cached->Blueprint.Get() == Blueprint && Blueprint->Status == Cached->Result.Status && !Blueprint->bBeingCompiled)
+        {
+            CacheCounters.RecordHit();
+            Cached->LastUse = FMCPCacheBudget::NextUse();
+            return &Cached->Result;
+        }
+        RemoveMapEntry(Results, Blueprint);
+        CacheCounters.RecordInvalidation();
+    }
+
+    CacheCounters.RecordMiss();
+    return nullptr;
+}
+
+void FBlueprintCompileResultCache::Store(UBlueprint* Blueprint, const FResult& Result)
+{
+    check(IsInGameThread());
+    if (!bInitialized || !Blueprint)
+    {
+        return;
+    }
+
+    RemoveMapEntry(Results, Blueprint);
+    if (Result.Status != BS_UpToDate && Result.Status != BS_UpToDateWithWarnings)
+    {
+        return;
+    }
+
+    FCachedResult& Cached = Results.Add(Blueprint);
+    Cached.Blueprint = Blueprint;
+    Cached.Result = Result;
+    Cached.LastUse = FMCPCacheBudget::NextUse();
+    Cached.Bytes = sizeof(FCachedResult) + Result.StatusMessage.GetAllocatedSize() + GetStringsSize(Result.Warnings);
+    AddUsedBytes(Cached.Bytes);
+}
+
+void FBlueprintCompileResultCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    GetMapUses(Results, OutUses);
+}
+
+int64 FBlueprintCompileResultCache::EvictUsedBefore(uint64 Stamp)
+{
+    return EvictMapUsedBefore(Results, Stamp);
+}
+
+void FBlueprintCompileResultCache::Invalidate(UBlueprint* Blueprint)
+{
+    if (!Blueprint || !IsInGameThread())
+    {
+        return;
+    }
+
+    if (RemoveMapEntry(Results, Blueprint))
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+UBlueprint* FBlueprintCompileResultCache::FindOwningBlueprint(UObject* Object)
+{
+    if (!Object || Object->GetOutermost() == GetTransientPackage())
+    {
+        return nullptr;
+    }
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        return Blueprint;
+    }
+    if (UBlueprint* Blueprint = Object->GetTypedOuter<UBlueprint>())
+    {
+        return Blueprint;
+    }
+
+    // Component templates and construction script nodes live in the generated class
+    UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Object);
+    if (!GeneratedClass)
+    {
+        GeneratedClass = Object->GetTypedOuter<UBlueprintGeneratedClass>();
+    }
+    return GeneratedClass ? Cast<UBlueprint>(GeneratedClass->ClassGeneratedBy) : nullptr;
+}
+
+void FBlueprintCompileResultCache::HandleObjectModified(UObject* Object)
+{
+    if (Results.Num() == 0)
+    {
+        return;
+    }
+    Invalidate(FindOwningBlueprint(Object));
+}
+
+void FBlueprintCompileResultCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // FBlueprintEditorUtils::MarkBlueprintAsModified ends in PostEditChangeProperty, even for links made without Modify
+    if (Results.Num() > 0)
+    {
+        Invalidate(Cast<UBlueprint>(Object));
+    }
+}
+
+void FBlueprintCompileResultCache::HandleUndoRedo()
+{
+    if (Results.Num() > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    Results.Empty();
+    ResetUsedBytes();
+}
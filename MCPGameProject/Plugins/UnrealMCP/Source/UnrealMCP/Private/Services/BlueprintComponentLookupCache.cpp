@@ -0,0 +1,335 @@
+#include "Services/BlueprintComponentLookupCache.h"
+#include "Editor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+FBlueprintComponentLookupCache& FBlueprintComponentLookupCache::Get()
+{
+    static FBlueprintComponentLookupCache Instance;
+    return Instance;
+}
+
+void FBlueprintComponentLookupCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FBlueprintComponentLookupCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FBlueprintComponentLookupCache::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FBlueprintComponentLookupCache::HandleUndoRedo);
+    ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddRaw(this, &FBlueprintComponentLookupCache::HandleObjectsReplaced);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_component_lookup_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Maps.Num()); });
+    FMCPCacheBudget::Get().Register(TEXT("blueprint_component_lookup_cache"), *this);
+}
+
+void FBlueprintComponentLookupCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    ObjectsReplacedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_component_lookup_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("blueprint_component_lookup_cache"));
+
+    Maps.Empty();
+    ResetUsedBytes();
+}
+
+bool FBlueprintComponentLookupCache::Find(UBlueprint* Blueprint, const FString& ComponentName, FComponent& OutComponent)
+{
+    check(IsInGameThread());
+    OutComponent = FComponent();
+    if (!Blueprint || ComponentName.IsEmpty())
+    {
+        return false;
+    }
+
+    const FName Name(*ComponentName);
+    for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+    {
+        // A stale entry or an unknown name may be a change the handlers did not see; rebuild once
+        const bool bRebuild = Attempt > 0;
+        bool bBuilt = false;
+        FComponentMap& Map = GetMap(Blueprint, bRebuild, bBuilt);
+        if (const FEntry* Entry = Map.Components.Find(Name))
+        {
+            if (IsEntryValid(Map, Name, *Entry))
+            {
+                if (!bRebuild)
+                {
+                    CacheCounters.RecordHit();
+                }
+                OutComponent.Template = Entry->Template.Get();
+                OutComponent.Node = Entry->Node.Get();
+                OutComponent.bInherited = Entry->bInherited;
+                return true;
+            }
+        }
+        if (!bRebuild)
+        {
+            CacheCounters.RecordMiss();
+        }
+        if (bBuilt)
+        {
+            break;
+        }
+    }
+    return false;
+}
+
+UActorComponent* FBlueprintComponentLookupCache::FindTemplate(UBlueprint* Blueprint, const FString& ComponentName)
+{
+    FComponent Component;
+    return Find(Blueprint, ComponentName, Component) ? Component.Template : nullptr;
+}
+
+USCS_Node* FBlueprintComponentLookupCache::FindOwnNode(UBlueprint* Blueprint, const FString& ComponentName)
+{
+    FComponent Component;
+    return Find(Blueprint, ComponentName, Component) && !Component.bInherited ? Component.Node : nullptr;
+}
+
+void FBlueprintComponentLookupCache::Invalidate(UBlueprint* Blueprint)
+{
+    if (!Blueprint || !IsInGameThread() || Maps.Num() == 0)
+    {
+        return;
+    }
+
+    int32 Removed = RemoveMapEntry(Maps, Blueprint) ? 1 : 0;
+
+    // Child Blueprints list the nodes of this one as inherited
+    for (auto It = Maps.CreateIterator(); It; ++It)
+    {
+        if (It->Value.Parents.Contains(Blueprint))
+        {
+            AddUsedBytes(-It->Value.Bytes);
+            It.RemoveCurrent();
+            Removed++;
+        }
+    }
+
+    if (Removed > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+FBlueprintComponentLookupCache::FComponentMap& FBlueprintComponentLookupCache::GetMap(UBlueprint* Blueprint, bool bForceRebuild, bool& bOutBuilt)
+{
+    UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject(false) : nullptr;
+
+    // Without the change handlers a kept map could be out of date
+    FComponentMap* Map = Maps.Find(Blueprint);
+    if (Map && !bForceRebuild && bInitialized && Map->Blueprint.Get() == Blueprint && Map->DefaultObject.Get() == DefaultObject)
+    {
+        bOutBuilt = false;
+        Map->LastUse = FMCPCacheBudget::NextUse();
+        return *Map;
+    }
+
+    if (Map)
+    {
+        CacheCounters.RecordInvalidation();
+        AddUsedBytes(-Map->Bytes);
+    }
+    else
+    {
+        Map = &Maps.Add(Blueprint);
+    }
+    BuildMap(Blueprint, *Map);
+    Map->LastUse = FMCPCacheBudget::NextUse();
+    Map->Bytes = sizeof(FComponentMap) + Map->Parents.GetAllocatedSize() + Map->Components.GetAllocatedSize();
+    AddUsedBytes(Map->Bytes);
+    bOutBuilt = true;
+    return *Map;
+}
+
+void FBlueprintComponentLookupCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    GetMapUses(Maps, OutUses);
+}
+
+int64 FBlueprintComponentLookupCache::EvictUsedBefore(uint64 Stamp)
+{
+    return EvictMapUsedBefore(Maps, Stamp);
+}
+
+void FBlueprintComponentLookupCache::BuildMap(UBlueprint* Blueprint, FComponentMap& OutMap)
+{
+    OutMap.Blueprint = Blueprint;
+    OutMap.Parents.Reset();
+    OutMap.Components.Reset();
+
+    if (Blueprint->SimpleConstructionScript)
+    {
+        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
+        {
+            if (Node && Node->ComponentTemplate && !OutMap.Components.Contains(Node->GetVariableName()))
+            {
+                FEntry& Entry = OutMap.Components.Add(Node->GetVariableName());
+                Entry.Template = Node->ComponentTemplate.Get();
+                Entry.Node = Node;
+            }
+        }
+    }
+
+    // Nodes of parent Blueprints, with the template this Blueprint overrides them with
+    UInheritableComponentHandler* InheritableComponents = Blueprint->GetInheritableComponentHandler(false);
+    for (UClass* Class = Blueprint->ParentClass; Class; Class = Class->GetSuperClass())
+    {
+        UBlueprintGeneratedClass* ParentClass = Cast<UBlueprintGeneratedClass>(Class);
+        if (!ParentClass)
+        {
+            break;
+        }
+        if (UBlueprint* ParentBlueprint = Cast<UBlueprint>(ParentClass->ClassGeneratedBy))
+        {
+            OutMap.Parents.Add(ParentBlueprint);
+        }
+        if (!ParentClass->SimpleConstructionScript)
+        {
+            continue;
+        }
+
+        for (USCS_Node* Node : ParentClass->SimpleConstructionScript->GetAllNodes())
+        {
+            if (!Node || !Node->ComponentTemplate || OutMap.Components.Contains(Node->GetVariableName()))
+            {
+                continue;
+            }
+            UActorComponent* Override = InheritableComponents
+                ? InheritableComponents->GetOverridenComponentTemplate(FComponentKey(Node))
+                : nullptr;
+
+            FEntry& Entry = OutMap.Components.Add(Node->GetVariableName());
+            Entry.Template = Override ? Override : Node->ComponentTemplate.Get();
+            Entry.Node = Node;
+            Entry.bInherited = true;
+        }
+    }
+
+    // Native components live on the default object
+    UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject(false) : nullptr;
+    OutMap.DefaultObject = DefaultObject;
+    if (AActor* DefaultActor = Cast<AActor>(DefaultObject))
+    {
+        TArray<UActorComponent*> NativeComponents;
+        DefaultActor->GetComponents(NativeComponents);
+        for (UActorComponent* Component : NativeComponents)
+        {
+            if (Component && !OutMap.Components.Contains(Component->GetFName()))
+            {
+                OutMap.Components.Add(Component->GetFName()).Template = Component;
+            }
+        }
+    }
+}
+
+bool FBlueprintComponentLookupCache::IsEntryValid(const FComponentMap& Map, FName Name, const FEntry& Entry)
+{
+    const UActorComponent* Template = Entry.Template.Get();
+    if (!Template)
+    {
+        return false;
+    }
+
+    if (Entry.Node.IsExplicitlyNull())
+    {
+        return Template->GetOuter() == Map.DefaultObject.Get();
+    }
+
+    // Renamed nodes and replaced templates are caught here even if no handler saw the change
+    const USCS_Node* Node = Entry.Node.Get();
+    return Node && Node->GetVariableName() == Name && (Entry.bInherited || Node->ComponentTemplate == Template);
+}
+
+UBlueprint* FBlueprintComponentLookupCache::FindOwningBlueprint(UObject* Object)
+{
+    if (!Object || Object->GetOutermost() == GetTransientPackage())
+    {
+        return nullptr;
+    }
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        return Blueprint;
+    }
+    if (UBlueprint* Blueprint = Object->GetTypedOuter<UBlueprint>())
+    {
+        return Blueprint;
+    }
+
+    // Construction scripts, their nodes and component templates live in the generated class
+    UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Object);
+    if (!GeneratedClass)
+    {
+        GeneratedClass = Object->GetTypedOuter<UBlueprintGeneratedClass>();
+    }
+    return GeneratedClass ? Cast<UBlueprint>(GeneratedClass->ClassGeneratedBy) : nullptr;
+}
+
+void FBlueprintComponentLookupCache::HandleObjectModified(UObject* Object)
+{
+    // Only structure changes matter; edits to template properties keep every name and template
+    if (Maps.Num() == 0
+        || !(Object->IsA<USimpleConstructionScript>() || Object->IsA<USCS_Node>()
+            || Object->IsA<UInheritableComponentHandler>() || Object->IsA<UBlueprint>()))
+    {
+        return;
+    }
+    Invalidate(FindOwningBlueprint(Object));
+}
+
+void FBlueprintComponentLookupCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // FBlueprintEditorUtils::MarkBlueprintAsModified ends in PostEditChangeProperty on the Blueprint
+    if (Maps.Num() > 0)
+    {
+        Invalidate(Cast<UBlueprint>(Object));
+    }
+}
+
+void FBlueprintComponentLookupCache::HandleUndoRedo()
+{
+    Clear();
+}
+
+void FBlueprintComponentLookupCache::HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap)
+{
+    // Reinstancing replaces default objects and the templates on them
+    Clear();
+}
+
+void FBlueprintComponentLookupCache::Clear()
+{
+    if (Maps.Num() > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    Maps.Empty();
+    ResetUsedBytes();
+}
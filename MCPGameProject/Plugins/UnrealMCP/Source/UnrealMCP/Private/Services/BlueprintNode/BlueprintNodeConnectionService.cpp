@@ -12,6 +12,8 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_DynamicCast.h"
 #include "K2Node_PromotableOperator.h"
+#include "MCPBatchEditScope.h"
+#include "Algo/AllOf.h"
 
 namespace
 {
@@ -24,6 +26,123 @@ static FString GetSafeNodeId(UEdGraphNode* Node, const FString& NodeTitle)
     }
     return FGraphUtils::GetReliableNodeId(Node);
 }
+
+/** Nodes of one graph by node id, so a request resolves each id once instead of scanning the graph per wire */
+class FGraphNodeLookup
+{
+public:
+    explicit FGraphNodeLookup(UEdGraph* InGraph)
+        : Graph(InGraph)
+    {
+        NodesById.Reserve(Graph->Nodes.Num());
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node)
+            {
+                NodesById.Add(FGraphUtils::GetReliableNodeId(Node), Node);
+            }
+        }
+    }
+
+    UEdGraphNode* Find(const FString& NodeIdOrType)
+    {
+        if (UEdGraphNode** Found = NodesById.Find(NodeIdOrType))
+        {
+            return *Found;
+        }
+
+        // Entry and result nodes may be named by type or title, and nodes may have been added since
+        UEdGraphNode* Node = FBlueprintNodeConnectionService::Get().FindNodeByIdOrType(Graph, NodeIdOrType);
+        if (Node)
+        {
+            NodesById.Add(NodeIdOrType, Node);
+        }
+        return Node;
+    }
+
+private:
+    UEdGraph* Graph;
+    TMap<FString, UEdGraphNode*> NodesById;
+};
+
+/** A batch wire with its pins resolved */
+struct FResolvedWire
+{
+    int32 Index = INDEX_NONE;
+    UEdGraphPin* SourcePin = nullptr;
+    UEdGraphPin* TargetPin = nullptr;
+};
+
+/**
+ * Resolve the pins of each wire, filling in the results of wires that cannot be resolved
+ * @return The resolved wires, in order
+ */
+TArray<FResolvedWire> ResolveWires(UEdGraph* Graph, const TArray<FBlueprintNodeConnectionParams>& Wires, TArray<FConnectionResultInfo>& OutResults)
+{
+    OutResults.SetNum(Wires.Num());
+    TArray<FResolvedWire> Resolved;
+    Resolved.Reserve(Wires.Num());
+
+    FGraphNodeLookup Nodes(Graph);
+    for (int32 Index = 0; Index < Wires.Num(); ++Index)
+    {
+        const FBlueprintNodeConnectionParams& Wire = Wires[Index];
+        FConnectionResultInfo& Result = OutResults[Index];
+        Result.SourceNodeId = Wire.SourceNodeId;
+        Result.TargetNodeId = Wire.TargetNodeId;
+
+        if (!Wire.IsValid(Result.ErrorMessage))
+        {
+            continue;
+        }
+
+        UEdGraphNode* SourceNode = Nodes.Find(Wire.SourceNodeId);
+        UEdGraphNode* TargetNode = Nodes.Find(Wire.TargetNodeId);
+        if (!SourceNode || !TargetNode)
+        {
+            Result.ErrorMessage = FString::Printf(TEXT("Node not found: %s"), SourceNode ? *Wire.TargetNodeId : *Wire.SourceNodeId);
+            continue;
+        }
+
+        UEdGraphPin* SourcePin = FUnrealMCPCommonUtils::FindPin(SourceNode, Wire.SourcePin, EGPD_Output);
+        UEdGraphPin* TargetPin = FUnrealMCPCommonUtils::FindPin(TargetNode, Wire.TargetPin, EGPD_Input);
+        if (!SourcePin || !TargetPin)
+        {
+            Result.ErrorMessage = SourcePin
+                ? FString::Printf(TEXT("Input pin '%s' not found on node %s"), *Wire.TargetPin, *Wire.TargetNodeId)
+                : FString::Printf(TEXT("Output pin '%s' not found on node %s"), *Wire.SourcePin, *Wire.SourceNodeId);
+            continue;
+        }
+
+        Resolved.Add({Index, SourcePin, TargetPin});
+    }
+    return Resolved;
+}
+
+/** Break every link of a pin, noting the other nodes for the connection notifications */
+void BreakAllLinks(UEdGraphPin* Pin, TSet<UEdGraphNode*>& ChangedNodes)
+{
+    for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+    {
+        if (UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNodeUnchecked() : nullptr)
+        {
+            LinkedNode->Modify();
+            ChangedNodes.Add(LinkedNode);
+        }
+    }
+    Pin->BreakAllPinLinks(true);
+}
+
+/** Notify each changed node once, then the graph and the Blueprint */
+void NotifyConnectionsChanged(UBlueprint* Blueprint, UEdGraph* Graph, const TSet<UEdGraphNode*>& ChangedNodes)
+{
+    for (UEdGraphNode* Node : ChangedNodes)
+    {
+        Node->NodeConnectionListChanged();
+    }
+    FMCPBatchEditScope::NotifyGraphChanged(Graph);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
+}
 } // anonymous namespace
 
 FBlueprintNodeConnectionService& FBlueprintNodeConnectionService::Get()
@@ -130,41 +249,14 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodes(UBlueprint* Blueprin
 
     bool bAllSucceeded = true;
 
-    // Find the target graph dynamically
-    UEdGraph* SearchGraph = nullptr;
-
-    for (UEdGraph* Graph : Blueprint->UbergraphPages)
-    {
-        if (Graph && Graph->GetFName() == FName(*TargetGraph))
-        {
-            SearchGraph = Graph;
-            break;
-        }
-    }
-
-    if (!SearchGraph)
-    {
-        for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-        {
-            if (Graph && Graph->GetFName() == FName(*TargetGraph))
-            {
-                SearchGraph = Graph;
-                break;
-            }
-        }
-    }
-
-    if (!SearchGraph && TargetGraph == TEXT("EventGraph"))
-    {
-        SearchGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    }
-
+    UEdGraph* SearchGraph = FindTargetGraph(Blueprint, TargetGraph);
     if (!SearchGraph)
     {
         UE_LOG(LogTemp, Warning, TEXT("Target graph '%s' not found in Blueprint '%s'"), *TargetGraph, *Blueprint->GetName());
         return false;
     }
 
+    FGraphNodeLookup Nodes(SearchGraph);
     for (const FBlueprintNodeConnectionParams& Connection : Connections)
     {
         FString ValidationError;
@@ -175,8 +267,8 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodes(UBlueprint* Blueprin
             continue;
         }
 
-        UEdGraphNode* SourceNode = FindNodeByIdOrType(SearchGraph, Connection.SourceNodeId);
-        UEdGraphNode* TargetNode = FindNodeByIdOrType(SearchGraph, Connection.TargetNodeId);
+        UEdGraphNode* SourceNode = Nodes.Find(Connection.SourceNodeId);
+        UEdGraphNode* TargetNode = Nodes.Find(Connection.TargetNodeId);
 
         if (!SourceNode || !TargetNode)
         {
@@ -199,7 +291,7 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodes(UBlueprint* Blueprin
 
     if (bAllSucceeded)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     }
 
     return bAllSucceeded;
@@ -217,34 +309,7 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodesEnhanced(UBlueprint*
 
     bool bAllSucceeded = true;
 
-    UEdGraph* SearchGraph = nullptr;
-
-    for (UEdGraph* Graph : Blueprint->UbergraphPages)
-    {
-        if (Graph && Graph->GetFName() == FName(*TargetGraph))
-        {
-            SearchGraph = Graph;
-            break;
-        }
-    }
-
-    if (!SearchGraph)
-    {
-        for (UEdGraph* Graph : Blueprint->FunctionGraphs)
-        {
-            if (Graph && Graph->GetFName() == FName(*TargetGraph))
-            {
-                SearchGraph = Graph;
-                break;
-            }
-        }
-    }
-
-    if (!SearchGraph && TargetGraph == TEXT("EventGraph"))
-    {
-        SearchGraph = FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
-    }
-
+    UEdGraph* SearchGraph = FindTargetGraph(Blueprint, TargetGraph);
     if (!SearchGraph)
     {
         FConnectionResultInfo FailResult;
@@ -254,6 +319,7 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodesEnhanced(UBlueprint*
         return false;
     }
 
+    FGraphNodeLookup Nodes(SearchGraph);
     for (const FBlueprintNodeConnectionParams& Connection : Connections)
     {
         FConnectionResultInfo Result;
@@ -270,8 +336,8 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodesEnhanced(UBlueprint*
             continue;
         }
 
-        UEdGraphNode* SourceNode = FindNodeByIdOrType(SearchGraph, Connection.SourceNodeId);
-        UEdGraphNode* TargetNode = FindNodeByIdOrType(SearchGraph, Connection.TargetNodeId);
+        UEdGraphNode* SourceNode = Nodes.Find(Connection.SourceNodeId);
+        UEdGraphNode* TargetNode = Nodes.Find(Connection.TargetNodeId);
 
         if (!SourceNode || !TargetNode)
         {
@@ -316,12 +382,192 @@ bool FBlueprintNodeConnectionService::ConnectBlueprintNodesEnhanced(UBlueprint*
 
     if (bAllSucceeded)
     {
-        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     }
 
     return bAllSucceeded;
 }
 
+bool FBlueprintNodeConnectionService::ConnectPinsBatch(UBlueprint* Blueprint, const FString& TargetGraph, const TArray<FBlueprintNodeConnectionParams>& Wires,
+                                                       bool bAllOrNothing, TArray<FConnectionResultInfo>& OutResults, FString& OutError)
+{
+    OutResults.Empty();
+    UEdGraph* Graph = Blueprint ? FindTargetGraph(Blueprint, TargetGraph) : nullptr;
+    const UEdGraphSchema* Schema = Graph ? Graph->GetSchema() : nullptr;
+    if (!Schema)
+    {
+        OutError = FString::Printf(TEXT("Target graph '%s' not found"), *TargetGraph);
+        return false;
+    }
+
+    // Validate every wire against the graph as it is, before any of them is made
+    TArray<FResolvedWire> Resolved = ResolveWires(Graph, Wires, OutResults);
+    for (int32 Index = Resolved.Num() - 1; Index >= 0; --Index)
+    {
+        const FResolvedWire& Wire = Resolved[Index];
+        if (Wire.SourcePin->LinkedTo.Contains(Wire.TargetPin))
+        {
+            OutResults[Wire.Index].bSuccess = true;
+            Resolved.RemoveAt(Index);
+            continue;
+        }
+
+        const FPinConnectionResponse Response = Schema->CanCreateConnection(Wire.SourcePin, Wire.TargetPin);
+        if (Response.Response == CONNECT_RESPONSE_DISALLOW)
+        {
+            OutResults[Wire.Index].ErrorMessage = FString::Printf(TEXT("Connection rejected: %s"), *Response.Message.ToString());
+            Resolved.RemoveAt(Index);
+        }
+    }
+
+    const bool bAllValid = Algo::AllOf(OutResults, [](const FConnectionResultInfo& Result) { return Result.bSuccess || Result.ErrorMessage.IsEmpty(); });
+    if (!bAllValid && bAllOrNothing)
+    {
+        for (const FResolvedWire& Wire : Resolved)
+        {
+            OutResults[Wire.Index].ErrorMessage = TEXT("Not connected: another wire in the batch is invalid");
+        }
+        return false;
+    }
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Connect Pins (%d wires)"), Wires.Num())));
+    TSet<UEdGraphNode*> ChangedNodes;
+    for (const FResolvedWire& Wire : Resolved)
+    {
+        UEdGraphPin* SourcePin = Wire.SourcePin;
+        UEdGraphPin* TargetPin = Wire.TargetPin;
+        UEdGraphNode* SourceNode = SourcePin->GetOwningNode();
+        UEdGraphNode* TargetNode = TargetPin->GetOwningNode();
+        FConnectionResultInfo& Result = OutResults[Wire.Index];
+
+        // Asked again, since an earlier wire of the batch may have linked one of the pins
+        const FPinConnectionResponse Response = Schema->CanCreateConnection(SourcePin, TargetPin);
+        const int32 NodeCountBefore = Graph->Nodes.Num();
+        SourceNode->Modify();
+        TargetNode->Modify();
+
+        // The schema's TryCreateConnection would mark the Blueprint as modified for every wire
+        switch (Response.Response)
+        {
+        case CONNECT_RESPONSE_BREAK_OTHERS_A:
+        case CONNECT_RESPONSE_BREAK_OTHERS_B:
+        case CONNECT_RESPONSE_BREAK_OTHERS_AB:
+            if (Response.Response != CONNECT_RESPONSE_BREAK_OTHERS_B)
+            {
+                BreakAllLinks(SourcePin, ChangedNodes);
+            }
+            if (Response.Response != CONNECT_RESPONSE_BREAK_OTHERS_A)
+            {
+                BreakAllLinks(TargetPin, ChangedNodes);
+            }
+            [[fallthrough]];
+        case CONNECT_RESPONSE_MAKE:
+            SourcePin->MakeLinkTo(TargetPin);
+            SourceNode->PinConnectionListChanged(SourcePin);
+            TargetNode->PinConnectionListChanged(TargetPin);
+            Result.bSuccess = true;
+            break;
+        case CONNECT_RESPONSE_MAKE_WITH_CONVERSION_NODE:
+            Result.bSuccess = Schema->CreateAutomaticConversionNodeAndConnections(SourcePin, TargetPin);
+            break;
+        case CONNECT_RESPONSE_MAKE_WITH_PROMOTION:
+            Result.bSuccess = Schema->CreatePromotedConnection(SourcePin, TargetPin);
+            break;
+        default:
+            break;
+        }
+
+        if (!Result.bSuccess)
+        {
+            Result.ErrorMessage = Response.Response == CONNECT_RESPONSE_DISALLOW
+                ? FString::Printf(TEXT("Connection rejected after earlier wires of the batch: %s"), *Response.Message.ToString())
+                : TEXT("Failed to create the conversion node");
+            continue;
+        }
+
+        ChangedNodes.Add(SourceNode);
+        ChangedNodes.Add(TargetNode);
+        for (int32 NodeIndex = NodeCountBefore; NodeIndex < Graph->Nodes.Num(); ++NodeIndex)
+        {
+            if (UEdGraphNode* InsertedNode = Graph->Nodes[NodeIndex])
+            {
+                Result.AutoInsertedNodes.Emplace(FGraphUtils::GetReliableNodeId(InsertedNode),
+                    InsertedNode->GetNodeTitle(ENodeTitleType::ListView).ToString(), InsertedNode->GetClass()->GetName(), false);
+            }
+        }
+    }
+
+    if (ChangedNodes.Num() > 0)
+    {
+        NotifyConnectionsChanged(Blueprint, Graph, ChangedNodes);
+    }
+
+    return Algo::AllOf(OutResults, [](const FConnectionResultInfo& Result) { return Result.bSuccess; });
+}
+
+bool FBlueprintNodeConnectionService::DisconnectPinsBatch(UBlueprint* Blueprint, const FString& TargetGraph, const TArray<FBlueprintNodeConnectionParams>& Wires,
+                                                          bool bAllOrNothing, TArray<FConnectionResultInfo>& OutResults, FString& OutError)
+{
+    OutResults.Empty();
+    UEdGraph* Graph = Blueprint ? FindTargetGraph(Blueprint, TargetGraph) : nullptr;
+    if (!Graph)
+    {
+        OutError = FString::Printf(TEXT("Target graph '%s' not found"), *TargetGraph);
+        return false;
+    }
+
+    TArray<FResolvedWire> Resolved = ResolveWires(Graph, Wires, OutResults);
+    for (int32 Index = Resolved.Num() - 1; Index >= 0; --Index)
+    {
+        const FResolvedWire& Wire = Resolved[Index];
+        if (!Wire.SourcePin->LinkedTo.Contains(Wire.TargetPin))
+        {
+            OutResults[Wire.Index].ErrorMessage = FString::Printf(TEXT("Pins '%s' and '%s' are not connected"),
+                *Wires[Wire.Index].SourcePin, *Wires[Wire.Index].TargetPin);
+            Resolved.RemoveAt(Index);
+        }
+    }
+
+    if (bAllOrNothing && Resolved.Num() < Wires.Num())
+    {
+        for (const FResolvedWire& Wire : Resolved)
+        {
+            OutResults[Wire.Index].ErrorMessage = TEXT("Not disconnected: another wire in the batch is invalid");
+        }
+        return false;
+    }
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Disconnect Pins (%d wires)"), Wires.Num())));
+    TSet<UEdGraphNode*> ChangedNodes;
+    for (const FResolvedWire& Wire : Resolved)
+    {
+        // The same wire may be listed twice
+        if (!Wire.SourcePin->LinkedTo.Contains(Wire.TargetPin))
+        {
+            OutResults[Wire.Index].bSuccess = true;
+            continue;
+        }
+
+        UEdGraphNode* SourceNode = Wire.SourcePin->GetOwningNode();
+        UEdGraphNode* TargetNode = Wire.TargetPin->GetOwningNode();
+        SourceNode->Modify();
+        TargetNode->Modify();
+        Wire.SourcePin->BreakLinkTo(Wire.TargetPin);
+        SourceNode->PinConnectionListChanged(Wire.SourcePin);
+        TargetNode->PinConnectionListChanged(Wire.TargetPin);
+        ChangedNodes.Add(SourceNode);
+        ChangedNodes.Add(TargetNode);
+        OutResults[Wire.Index].bSuccess = true;
+    }
+
+    if (ChangedNodes.Num() > 0)
+    {
+        NotifyConnectionsChanged(Blueprint, Graph, ChangedNodes);
+    }
+
+    return Resolved.Num() == Wires.Num();
+}
+
 bool FBlueprintNodeConnectionService::ConnectPins(UEdGraphNode* SourceNode, const FString& SourcePinName, UEdGraphNode* TargetNode, const FString& TargetPinName)
 {
     if (!SourceNode || !TargetNode)
@@ -539,7 +785,7 @@ bool FBlueprintNodeConnectionService::ConnectNodesWithAutoCast(UEdGraph* Graph,
                 {
                     SourceSchema->ForceVisualizationCacheClear();
                 }
-                SourceGraph->NotifyGraphChanged();
+                FMCPBatchEditScope::NotifyGraphChanged(SourceGraph);
             }
         }
 
@@ -551,7 +797,7 @@ bool FBlueprintNodeConnectionService::ConnectNodesWithAutoCast(UEdGraph* Graph,
                 {
                     TargetSchema->ForceVisualizationCacheClear();
                 }
-                TargetGraph->NotifyGraphChanged();
+                FMCPBatchEditScope::NotifyGraphChanged(TargetGraph);
             }
         }
     }
@@ -695,3 +941,28 @@ UEdGraphNode* FBlueprintNodeConnectionService::FindNodeByIdOrType(UEdGraph* Grap
 
     return nullptr;
 }
+
+UEdGraph* FBlueprintNodeConnectionService::FindTargetGraph(UBlueprint* Blueprint, const FString& TargetGraph)
+{
+    for (UEdGraph* Graph : Blueprint->UbergraphPages)
+    {
+        if (Graph && Graph->GetFName() == FName(*TargetGraph))
+        {
+            return Graph;
+        }
+    }
+
+    for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+    {
+        if (Graph && Graph->GetFName() == FName(*TargetGraph))
+        {
+            return Graph;
+        }
+    }
+
+    if (TargetGraph == TEXT("EventGraph"))
+    {
+        return FUnrealMCPCommonUtils::FindOrCreateEventGraph(Blueprint);
+    }
+    return nullptr;
+}
@@ -0,0 +1,388 @@
+#include "Services/BlueprintNode/GraphSnippetService.h"
+#include "MCPLogging.h"
+#include "MCPBatchEditScope.h"
+#include "Utils/GraphUtils.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "EdGraphUtilities.h"
+#include "K2Node.h"
+#include "K2Node_Variable.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    /** Bumped when the snippet file layout changes */
+    constexpr int32 SnippetFileVersion = 1;
+}
+
+FGraphSnippetService& FGraphSnippetService::Get()
+{
+    static FGraphSnippetService Instance;
+    return Instance;
+}
+
+const FGraphSnippet* FGraphSnippetService::SaveSnippet(UEdGraph* Graph, const TArray<UEdGraphNode*>& Nodes, const TArray<FString>& Keys,
+    const FString& Name, const FString& Description, bool bOverwrite, FString& OutError)
+{
+    EnsureLoaded();
+
+    if (!IsValidName(Name))
+    {
+        OutError = FString::Printf(TEXT("Invalid snippet name '%s': use letters, digits, '_' and '-'"), *Name);
+        return nullptr;
+    }
+    if (!bOverwrite && Snippets.Contains(Name))
+    {
+        OutError = FString::Printf(TEXT("Snippet '%s' already exists; pass overwrite to replace it"), *Name);
+        return nullptr;
+    }
+    if (!Graph || Nodes.Num() == 0)
+    {
+        OutError = TEXT("No nodes to save");
+        return nullptr;
+    }
+    if (Keys.Num() > 0 && Keys.Num() != Nodes.Num())
+    {
+        OutError = FString::Printf(TEXT("Got %d keys for %d nodes"), Keys.Num(), Nodes.Num());
+        return nullptr;
+    }
+
+    FGraphSnippet Snippet;
+    Snippet.Name = Name;
+    Snippet.Description = Description;
+    Snippet.SchemaClass = Graph->GetSchema() ? Graph->GetSchema()->GetClass()->GetPathName() : FString();
+
+    TSet<FString> UsedKeys;
+    TSet<UObject*> NodesToExport;
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        UEdGraphNode* Node = Nodes[Index];
+        if (!Node || Node->GetGraph() != Graph)
+        {
+            OutError = FString::Printf(TEXT("Node %d is not in graph '%s'"), Index, *Graph->GetName());
+            return nullptr;
+        }
+
+        const FString Title = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+        // Paste finds the copies by the GUID the text keeps, and the editor never copies entry nodes
+        if (!Node->CanDuplicateNode() || !Node->NodeGuid.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Node '%s' cannot be copied"), *Title);
+            return nullptr;
+        }
+
+        const FString Key = Keys.Num() > 0 ? Keys[Index] : FString::Printf(TEXT("node%d"), Index);
+        bool bAlreadyUsed = false;
+        UsedKeys.Add(Key, &bAlreadyUsed);
+        if (Key.IsEmpty() || bAlreadyUsed)
+        {
+            OutError = FString::Printf(TEXT("Node keys must be unique and not empty: '%s'"), *Key);
+            return nullptr;
+        }
+
+        FGraphSnippet::FNode& SnippetNode = Snippet.Nodes.AddDefaulted_GetRef();
+        SnippetNode.Key = Key;
+        SnippetNode.Guid = Node->NodeGuid;
+        SnippetNode.Title = Title;
+        SnippetNode.Class = Node->GetClass()->GetName();
+        NodesToExport.Add(Node);
+    }
+
+    // As the graph editor's Copy: nodes strip what must not reach the text and restore it afterwards
+    for (UObject* Object : NodesToExport)
+    {
+        CastChecked<UEdGraphNode>(Object)->PrepareForCopying();
+    }
+    FEdGraphUtilities::ExportNodesToText(NodesToExport, Snippet.Text);
+    for (UObject* Object : NodesToExport)
+    {
+        if (UK2Node* K2Node = Cast<UK2Node>(Object))
+        {
+            K2Node->PostCopyNode();
+        }
+    }
+
+    if (Snippet.Text.IsEmpty())
+    {
+        OutError = TEXT("The nodes exported no text");
+        return nullptr;
+    }
+    if (!WriteSnippetFile(Snippet))
+    {
+        OutError = FString::Printf(TEXT("Could not write the snippet file for '%s'"), *Name);
+        return nullptr;
+    }
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("FGraphSnippetService: Saved snippet '%s' with %d nodes from graph '%s'"),
+        *Name, Snippet.Nodes.Num(), *Graph->GetName());
+    return &Snippets.Add(Name, MoveTemp(Snippet));
+}
+
+bool FGraphSnippetService::PasteSnippet(UEdGraph* Graph, const FGraphSnippet& Snippet, const FIntPoint& Position,
+    const TMap<FString, FGraphSnippetNodeOverride>& Overrides, TArray<FPastedSnippetNode>& OutNodes,
+    TArray<FString>& OutWarnings, FString& OutError)
+{
+    if (!Graph)
+    {
+        OutError = TEXT("No graph to paste into");
+        return false;
+    }
+    for (const TPair<FString, FGraphSnippetNodeOverride>& Pair : Overrides)
+    {
+        if (!Snippet.Nodes.ContainsByPredicate([&Pair](const FGraphSnippet::FNode& Node) { return Node.Key == Pair.Key; }))
+        {
+            OutError = FString::Printf(TEXT("Snippet '%s' has no node '%s'"), *Snippet.Name, *Pair.Key);
+            return false;
+        }
+    }
+    if (!FEdGraphUtilities::CanImportNodesFromText(Graph, Snippet.Text))
+    {
+        OutError = FString::Printf(TEXT("The nodes of snippet '%s' cannot be pasted into graph '%s'"), *Snippet.Name, *Graph->GetName());
+        return false;
+    }
+
+    UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("Paste Snippet %s"), *Snippet.Name)));
+    Graph->Modify();
+
+    TSet<UEdGraphNode*> ImportedNodes;
+    FEdGraphUtilities::ImportNodesFromText(Graph, Snippet.Text, ImportedNodes);
+    if (ImportedNodes.Num() == 0)
+    {
+        OutError = FString::Printf(TEXT("Snippet '%s' imported no nodes"), *Snippet.Name);
+        return false;
+    }
+
+    // The copies still carry the saved GUIDs, which is how they are matched to their keys
+    TMap<FGuid, UEdGraphNode*> NodesByOriginalGuid;
+    FIntPoint TopLeft(MAX_int32, MAX_int32);
+    for (UEdGraphNode* Node : ImportedNodes)
+    {
+        NodesByOriginalGuid.Add(Node->NodeGuid, Node);
+        TopLeft.X = FMath::Min(TopLeft.X, Node->NodePosX);
+        TopLeft.Y = FMath::Min(TopLeft.Y, Node->NodePosY);
+    }
+
+    const FIntPoint Offset = Position - TopLeft;
+    for (UEdGraphNode* Node : ImportedNodes)
+    {
+        Node->CreateNewGuid();
+        Node->NodePosX += Offset.X;
+        Node->NodePosY += Offset.Y;
+    }
+
+    const UEdGraphSchema* Schema = Graph->GetSchema();
+    for (const FGraphSnippet::FNode& SnippetNode : Snippet.Nodes)
+    {
+        UEdGraphNode* Node = NodesByOriginalGuid.FindRef(SnippetNode.Guid);
+        if (!Node)
+        {
+            OutWarnings.Add(FString::Printf(TEXT("Node '%s' (%s) was not pasted"), *SnippetNode.Key, *SnippetNode.Title));
+            continue;
+        }
+        OutNodes.Add({ SnippetNode.Key, Node });
+
+        const FGraphSnippetNodeOverride* Override = Overrides.Find(SnippetNode.Key);
+        if (!Override)
+        {
+            continue;
+        }
+
+        // The variable first, since reconstructing the node rebuilds its pins
+        if (!Override->Variable.IsEmpty())
+        {
+            UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node);
+            const FName VariableName(*Override->Variable);
+            if (!VariableNode)
+            {
+                OutWarnings.Add(FString::Printf(TEXT("Node '%s' is not a variable node"), *SnippetNode.Key));
+            }
+            else if (!Blueprint || !Blueprint->SkeletonGeneratedClass
+                || !FindFProperty<FProperty>(Blueprint->SkeletonGeneratedClass, VariableName))
+            {
+                OutWarnings.Add(FString::Printf(TEXT("Node '%s': variable '%s' not found"), *SnippetNode.Key, *Override->Variable));
+            }
+            else
+            {
+                VariableNode->Modify();
+                VariableNode->VariableReference.SetSelfMember(VariableName);
+                VariableNode->ReconstructNode();
+            }
+        }
+
+        for (const TPair<FString, FString>& PinValue : Override->PinValues)
+        {
+            UEdGraphPin* Pin = FGraphUtils::FindPin(Node, PinValue.Key, EGPD_Input);
+            if (!Pin)
+            {
+                OutWarnings.Add(FString::Printf(TEXT("Node '%s' has no input pin '%s'"), *SnippetNode.Key, *PinValue.Key));
+                continue;
+            }
+            Schema->TrySetDefaultValue(*Pin, PinValue.Value);
+        }
+    }
+
+    FMCPBatchEditScope::NotifyGraphChanged(Graph);
+    if (Blueprint)
+    {
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
+    }
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("FGraphSnippetService: Pasted snippet '%s' into graph '%s' (%d nodes)"),
+        *Snippet.Name, *Graph->GetName(), ImportedNodes.Num());
+    return true;
+}
+
+const FGraphSnippet* FGraphSnippetService::FindSnippet(const FString& Name)
+{
+    EnsureLoaded();
+    return Snippets.Find(Name);
+}
+
+TArray<const FGraphSnippet*> FGraphSnippetService::GetSnippets()
+{
+    EnsureLoaded();
+
+    TArray<const FGraphSnippet*> Result;
+    Result.Reserve(Snippets.Num());
+    for (const TPair<FString, FGraphSnippet>& Pair : Snippets)
+    {
+        Result.Add(&Pair.Value);
+    }
+    Result.Sort([](const FGraphSnippet& A, const FGraphSnippet& B) { return A.Name < B.Name; });
+    return Result;
+}
+
+FString FGraphSnippetService::GetSnippetDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("Snippets"));
+}
+
+void FGraphSnippetService::EnsureLoaded()
+{
+    if (bLoaded)
+    {
+        return;
+    }
+    bLoaded = true;
+
+    const FString Directory = GetSnippetDirectory();
+    TArray<FString> FileNames;
+    IFileManager::Get().FindFiles(FileNames, *FPaths::Combine(Directory, TEXT("*.json")), true, false);
+    for (const FString& FileName : FileNames)
+    {
+        FGraphSnippet Snippet;
+        if (!ReadSnippetFile(FPaths::Combine(Directory, FileName), Snippet))
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("FGraphSnippetService: Ignoring unreadable or outdated snippet file '%s'"), *FileName);
+            continue;
+        }
+        FString SnippetName = Snippet.Name;
+        Snippets.Add(MoveTemp(SnippetName), MoveTemp(Snippet));
+    }
+    UE_LOG(LogUnrealMCP, Log, TEXT("FGraphSnippetService: Loaded %d snippets"), Snippets.Num());
+}
+
+bool FGraphSnippetService::IsValidName(const FString& Name)
+{
+    if (Name.IsEmpty())
+    {
+        return false;
+    }
+    for (const TCHAR Char : Name)
+    {
+        if (!FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('-'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FGraphSnippetService::WriteSnippetFile(const FGraphSnippet& Snippet)
+{
+    TArray<TSharedPtr<FJsonValue>> NodeValues;
+    NodeValues.Reserve(Snippet.Nodes.Num());
+    for (const FGraphSnippet::FNode& Node : Snippet.Nodes)
+    {
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("key"), Node.Key);
+        NodeObj->SetStringField(TEXT("guid"), Node.Guid.ToString());
+        NodeObj->SetStringField(TEXT("title"), Node.Title);
+        NodeObj->SetStringField(TEXT("class"), Node.Class);
+        NodeValues.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    TSharedPtr<FJsonObject> RootObj = MakeShared<FJsonObject>();
+    RootObj->SetNumberField(TEXT("version"), SnippetFileVersion);
+    RootObj->SetStringField(TEXT("name"), Snippet.Name);
+    RootObj->SetStringField(TEXT("description"), Snippet.Description);
+    RootObj->SetStringField(TEXT("schema"), Snippet.SchemaClass);
+    RootObj->SetArrayField(TEXT("nodes"), NodeValues);
+    RootObj->SetStringField(TEXT("text"), Snippet.Text);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObj.ToSharedRef(), Writer);
+
+    const FString FilePath = FPaths::Combine(GetSnippetDirectory(), Snippet.Name + TEXT(".json"));
+    if (!FFileHelper::SaveStringToFile(OutputString, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FGraphSnippetService: Could not write '%s'"), *FilePath);
+        return false;
+    }
+    return true;
+}
+
+bool FGraphSnippetService::ReadSnippetFile(const FString& FilePath, FGraphSnippet& OutSnippet)
+{
+    FString InputString;
+    if (!FFileHelper::LoadFileToString(InputString, *FilePath))
+    {
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> RootObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+    int32 Version = 0;
+    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()
+        || !RootObj->TryGetNumberField(TEXT("version"), Version) || Version != SnippetFileVersion
+        || !RootObj->TryGetStringField(TEXT("name"), OutSnippet.Name) || !IsValidName(OutSnippet.Name)
+        || !RootObj->TryGetStringField(TEXT("text"), OutSnippet.Text)
+        || !RootObj->TryGetArrayField(TEXT("nodes"), NodeValues))
+    {
+        return false;
+    }
+    RootObj->TryGetStringField(TEXT("description"), OutSnippet.Description);
+    RootObj->TryGetStringField(TEXT("schema"), OutSnippet.SchemaClass);
+
+    for (const TSharedPtr<FJsonValue>& NodeValue : *NodeValues)
+    {
+        const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+        FString GuidString;
+        FGraphSnippet::FNode Node;
+        if (!NodeValue.IsValid() || !NodeValue->TryGetObject(NodeObj)
+            || !(*NodeObj)->TryGetStringField(TEXT("key"), Node.Key)
+            || !(*NodeObj)->TryGetStringField(TEXT("guid"), GuidString)
+            || !FGuid::Parse(GuidString, Node.Guid))
+        {
+            return false;
+        }
+        (*NodeObj)->TryGetStringField(TEXT("title"), Node.Title);
+        (*NodeObj)->TryGetStringField(TEXT("class"), Node.Class);
+        OutSnippet.Nodes.Add(MoveTemp(Node));
+    }
+    return true;
+}
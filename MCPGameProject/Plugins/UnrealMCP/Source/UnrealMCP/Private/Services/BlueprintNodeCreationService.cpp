@@ -16,6 +16,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Utils/UnrealMCPCommonUtils.h" // For utility blueprint finder
 #include "Utils/GraphUtils.h" // For reliable node IDs
+#include "MCPBatchEditScope.h"
 
 // Include refactored node creation helpers
 #include "NodeCreation/ArithmeticNodeCreator.h"
@@ -415,7 +416,7 @@ FString FBlueprintNodeCreationService::CreateNodeByActionName(const FString& Blu
     }
 
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
 
     // Combine all warnings into the warning message
     if (Warnings.Num() > 0)
@@ -0,0 +1,509 @@
+#include "Services/BlueprintSearchIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "MCPLogging.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Utils/GraphUtils.h"
+
+namespace
+{
+    /** Bumped when what a node is indexed by changes */
+    constexpr int32 PersistentStateVersion = 1;
+}
+
+FBlueprintSearchIndex& FBlueprintSearchIndex::Get()
+{
+    static FBlueprintSearchIndex Instance;
+    return Instance;
+}
+
+void FBlueprintSearchIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    const int32 LoadedCount = LoadPersistentState();
+    UE_LOG(LogUnrealMCP, Log, TEXT("FBlueprintSearchIndex: Restored %d indexed Blueprints from the last session"), LoadedCount);
+
+    AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FBlueprintSearchIndex::HandleAssetRemoved);
+    AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FBlueprintSearchIndex::HandleAssetRenamed);
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FBlueprintSearchIndex::HandlePackageSaved);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_search_index"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(Packages.Num()); });
+}
+
+void FBlueprintSearchIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    PackageSavedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_search_index"));
+
+    if (bDirty)
+    {
+        SavePersistentState();
+    }
+    Packages.Empty();
+    UncachedEntry = FPackageEntry();
+    bDirty = false;
+}
+
+const FBlueprintSearchIndex::FPackageEntry* FBlueprintSearchIndex::FindWithoutLoading(const FString& BlueprintPath)
+{
+    check(IsInGameThread());
+
+    const FSoftObjectPath ObjectPath(BlueprintPath);
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(ObjectPath.ResolveObject()))
+    {
+        return &FindOrIndex(Blueprint);
+    }
+
+    // The miss is counted once the caller has loaded the Blueprint and indexes it
+    const FName PackageName = ObjectPath.GetLongPackageFName();
+    return FindCurrent(PackageName);
+}
+
+const FBlueprintSearchIndex::FPackageEntry& FBlueprintSearchIndex::FindOrIndex(UBlueprint* Blueprint)
+{
+    check(IsInGameThread());
+    check(Blueprint);
+
+    // Unsaved edits are not in the package file the entry would be checked against
+    UPackage* Package = Blueprint->GetPackage();
+    const bool bHasUnsavedEdits = Package->IsDirty();
+    const FName PackageName = Package->GetFName();
+
+    if (!bHasUnsavedEdits)
+    {
+        if (const FPackageEntry* Current = FindCurrent(PackageName))
+        {
+            CacheCounters.RecordHit();
+            return *Current;
+        }
+    }
+    CacheCounters.RecordMiss();
+
+    FDateTime Timestamp;
+    const bool bHasFile = GetPackageTimestamp(PackageName, Timestamp);
+    if (!bInitialized || bHasUnsavedEdits || !bHasFile)
+    {
+        IndexBlueprint(Blueprint, UncachedEntry);
+        return &UncachedEntry;
+    }
+
+    FIndexedPackage& Indexed = Packages.Add(PackageName);
+    Indexed.PackageTimestamp = Timestamp;
+    IndexBlueprint(Blueprint, Indexed.Entry);
+    bDirty = true;
+    return Indexed.Entry;
+}
+
+const FBlueprintSearchIndex::FPackageEntry* FBlueprintSearchIndex::FindCurrent(FName PackageName)
+{
+    FIndexedPackage* Indexed = Packages.Find(PackageName);
+    if (!Indexed)
+    {
+        return nullptr;
+    }
+
+    FDateTime Timestamp;
+    if (GetPackageTimestamp(PackageName, Timestamp) && Indexed->PackageTimestamp == Timestamp)
+    {
+        return &Indexed->Entry;
+    }
+
+    Packages.Remove(PackageName);
+    bDirty = true;
+    CacheCounters.RecordInvalidation();
+    return nullptr;
+}
+
+void FBlueprintSearchIndex::IndexBlueprint(UBlueprint* Blueprint, FPackageEntry& OutEntry)
+{
+    OutEntry = FPackageEntry();
+    OutEntry.BlueprintPath = Blueprint->GetPathName();
+    OutEntry.BlueprintName = Blueprint->GetName();
+
+    TArray<UEdGraph*> AllGraphs;
+    Blueprint->GetAllGraphs(AllGraphs);
+    for (UEdGraph* Graph : AllGraphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        const int32 GraphIndex = OutEntry.GraphNames.Add(Graph->GetName());
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            FNode& IndexedNode = OutEntry.Nodes.AddDefaulted_GetRef();
+            IndexedNode.GraphIndex = GraphIndex;
+            IndexNode(Node, IndexedNode);
+        }
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("FBlueprintSearchIndex: Indexed %d node(s) in %s"), OutEntry.Nodes.Num(), *OutEntry.BlueprintPath);
+}
+
+void FBlueprintSearchIndex::IndexNode(UEdGraphNode* Node, FNode& OutNode)
+{
+    OutNode.NodeId = FGraphUtils::GetReliableNodeId(Node);
+    OutNode.NodeClass = Node->GetClass()->GetName();
+
+    if (Node->IsA<UK2Node_CallFunction>() || Node->IsA<UK2Node_FunctionEntry>() || OutNode.NodeClass.Contains(TEXT("CallFunction")))
+    {
+        OutNode.Kinds |= EBlueprintSearchNodeKind::Function;
+    }
+    if (Node->IsA<UK2Node_VariableGet>() || Node->IsA<UK2Node_VariableSet>() || OutNode.NodeClass.Contains(TEXT("Variable")))
+    {
+        OutNode.Kinds |= EBlueprintSearchNodeKind::Variable;
+    }
+    if (Node->IsA<UK2Node_Event>())
+    {
+        OutNode.Kinds |= EBlueprintSearchNodeKind::Event;
+    }
+    if (Node->IsA<UK2Node_CustomEvent>())
+    {
+        OutNode.Kinds |= EBlueprintSearchNodeKind::CustomEvent;
+    }
+    if (OutNode.NodeClass.Contains(TEXT("Comment")))
+    {
+        OutNode.Kinds |= EBlueprintSearchNodeKind::Comment;
+    }
+
+    TArray<FString>& Strings = OutNode.SearchableStrings;
+    Strings.Add(Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+
+    auto AddString = [&Strings](const FString& String)
+    {
+        if (!String.IsEmpty())
+        {
+            Strings.AddUnique(String);
+        }
+    };
+
+    AddString(Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString());
+
+    // Referenced function, variable and event names
+    if (const UK2Node_CallFunction* CallFunc = Cast<UK2Node_CallFunction>(Node))
+    {
+        const FName FuncName = CallFunc->FunctionReference.GetMemberName();
+        if (!FuncName.IsNone())
+        {
+            AddString(FuncName.ToString());
+        }
+    }
+    if (const UK2Node_VariableGet* VarGet = Cast<UK2Node_VariableGet>(Node))
+    {
+        const FName VarName = VarGet->VariableReference.GetMemberName();
+        if (!VarName.IsNone())
+        {
+            AddString(VarName.ToString());
+        }
+    }
+    else if (const UK2Node_VariableSet* VarSet = Cast<UK2Node_VariableSet>(Node))
+    {
+        const FName VarName = VarSet->VariableReference.GetMemberName();
+        if (!VarName.IsNone())
+        {
+            AddString(VarName.ToString());
+        }
+    }
+    if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        const FName EventName = EventNode->GetFunctionName();
+        if (!EventName.IsNone())
+        {
+            AddString(EventName.ToString());
+        }
+    }
+    if (const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+    {
+        AddString(CustomEvent->CustomFunctionName.ToString());
+    }
+
+    // Comment bubble, or the text of a comment box
+    AddString(Node->NodeComment);
+
+    // Values typed into unconnected input pins
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin || Pin->Direction != EGPD_Input || Pin->LinkedTo.Num() > 0)
+        {
+            continue;
+        }
+        AddString(Pin->DefaultValue);
+        AddString(Pin->DefaultTextValue.ToString());
+        if (Pin->DefaultObject)
+        {
+            AddString(Pin->DefaultObject->GetPathName());
+        }
+    }
+}
+
+bool FBlueprintSearchIndex::GetPackageTimestamp(FName PackageName, FDateTime& OutTimestamp)
+{
+    FString PackageFilename;
+    if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName.ToString(), PackageFilename, FPackageName::GetAssetPackageExtension()))
+    {
+        return false;
+    }
+
+    OutTimestamp = IFileManager::Get().GetTimeStamp(*PackageFilename);
+    return OutTimestamp != FDateTime::MinValue();
+}
+
+FString FBlueprintSearchIndex::GetPersistentStatePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("BlueprintSearchIndex.json"));
+}
+
+int32 FBlueprintSearchIndex::LoadPersistentState()
+{
+    FString InputString;
+    if (!FFileHelper::LoadFileToString(InputString, *GetPersistentStatePath()))
+    {
+        return 0;
+    }
+
+    TSharedPtr<FJsonObject> RootObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    const TArray<TSharedPtr<FJsonValue>>* PackageValues = nullptr;
+    int32 Version = 0;
+    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()
+        || !RootObj->TryGetNumberField(TEXT("version"), Version) || Version != PersistentStateVersion
+        || !RootObj->TryGetArrayField(TEXT("packages"), PackageValues))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FBlueprintSearchIndex: Ignoring unreadable or outdated '%s'"), *GetPersistentStatePath());
+        return 0;
+    }
+
+    int32 StaleCount = 0;
+    for (const TSharedPtr<FJsonValue>& PackageValue : *PackageValues)
+    {
+        const TSharedPtr<FJsonObject>* PackageObj = nullptr;
+        if (!PackageValue.IsValid() || !PackageValue->TryGetObject(PackageObj))
+        {
+            continue;
+        }
+
+        FString PackageNameString, TimestampString;
+        FIndexedPackage Indexed;
+        const TArray<TSharedPtr<FJsonValue>>* GraphValues = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+        if (!(*PackageObj)->TryGetStringField(TEXT("package"), PackageNameString)
+            || !(*PackageObj)->TryGetStringField(TEXT("package_timestamp"), TimestampString)
+            || !FDateTime::ParseIso8601(*TimestampString, Indexed.PackageTimestamp)
+            || !(*PackageObj)->TryGetStringField(TEXT("blueprint_path"), Indexed.Entry.BlueprintPath)
+            || !(*PackageObj)->TryGetStringField(TEXT("blueprint_name"), Indexed.Entry.BlueprintName)
+            || !(*PackageObj)->TryGetArrayField(TEXT("graphs"), GraphValues)
+            || !(*PackageObj)->TryGetArrayField(TEXT("nodes"), NodeValues))
+        {
+            continue;
+        }
+
+        // Entries of packages that changed outside the editor would describe other graphs
+        const FName PackageName(*PackageNameString);
+        FDateTime Timestamp;
+        if (!GetPackageTimestamp(PackageName, Timestamp) || Timestamp != Indexed.PackageTimestamp)
+        {
+            StaleCount++;
+            continue;
+        }
+
+        for (const TSharedPtr<FJsonValue>& GraphValue : *GraphValues)
+        {
+            Indexed.Entry.GraphNames.Add(GraphValue.IsValid() ? GraphValue->AsString() : FString());
+        }
+
+        Indexed.Entry.Nodes.Reserve(NodeValues->Num());
+        for (const TSharedPtr<FJsonValue>& NodeValue : *NodeValues)
+        {
+            const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+            const TArray<TSharedPtr<FJsonValue>>* TextValues = nullptr;
+            FNode Node;
+            int32 Kinds = 0;
+            if (!NodeValue.IsValid() || !NodeValue->TryGetObject(NodeObj)
+                || !(*NodeObj)->TryGetNumberField(TEXT("graph"), Node.GraphIndex)
+                || !Indexed.Entry.GraphNames.IsValidIndex(Node.GraphIndex)
+                || !(*NodeObj)->TryGetArrayField(TEXT("text"), TextValues) || TextValues->IsEmpty())
+            {
+                continue;
+            }
+
+            (*NodeObj)->TryGetStringField(TEXT("id"), Node.NodeId);
+            (*NodeObj)->TryGetStringField(TEXT("class"), Node.NodeClass);
+            (*NodeObj)->TryGetNumberField(TEXT("kinds"), Kinds);
+            Node.Kinds = static_cast<EBlueprintSearchNodeKind>(Kinds);
+            for (const TSharedPtr<FJsonValue>& TextValue : *TextValues)
+            {
+                Node.SearchableStrings.Add(TextValue.IsValid() ? TextValue->AsString() : FString());
+            }
+            Indexed.Entry.Nodes.Add(MoveTemp(Node));
+        }
+
+        Packages.Add(PackageName, MoveTemp(Indexed));
+    }
+
+    if (StaleCount > 0)
+    {
+        UE_LOG(LogUnrealMCP, Log, TEXT("FBlueprintSearchIndex: Dropped %d indexed Blueprints whose package changed since the last session"), StaleCount);
+        bDirty = true;
+    }
+    return Packages.Num();
+}
+
+void FBlueprintSearchIndex::SavePersistentState() const
+{
+    TArray<TSharedPtr<FJsonValue>> PackageValues;
+    PackageValues.Reserve(Packages.Num());
+    for (const TPair<FName, FIndexedPackage>& Pair : Packages)
+    {
+        const FPackageEntry& Entry = Pair.Value.Entry;
+
+        TArray<TSharedPtr<FJsonValue>> GraphValues;
+        GraphValues.Reserve(Entry.GraphNames.Num());
+        for (const FString& GraphName : Entry.GraphNames)
+        {
+            GraphValues.Add(MakeShared<FJsonValueString>(GraphName));
+        }
+
+        TArray<TSharedPtr<FJsonValue>> NodeValues;
+        NodeValues.Reserve(Entry.Nodes.Num());
+        for (const FNode& Node : Entry.Nodes)
+        {
+            TArray<TSharedPtr<FJsonValue>> TextValues;
+            TextValues.Reserve(Node.SearchableStrings.Num());
+            for (const FString& Text : Node.SearchableStrings)
+            {
+                TextValues.Add(MakeShared<FJsonValueString>(Text));
+            }
+
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetNumberField(TEXT("graph"), Node.GraphIndex);
+            NodeObj->SetStringField(TEXT("id"), Node.NodeId);
+            NodeObj->SetStringField(TEXT("class"), Node.NodeClass);
+            NodeObj->SetNumberField(TEXT("kinds"), static_cast<int32>(Node.Kinds));
+            NodeObj->SetArrayField(TEXT("text"), TextValues);
+            NodeValues.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+
+        TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+        PackageObj->SetStringField(TEXT("package"), Pair.Key.ToString());
+        PackageObj->SetStringField(TEXT("package_timestamp"), Pair.Value.PackageTimestamp.ToIso8601());
+        PackageObj->SetStringField(TEXT("blueprint_path"), Entry.BlueprintPath);
+        PackageObj->SetStringField(TEXT("blueprint_name"), Entry.BlueprintName);
+        PackageObj->SetArrayField(TEXT("graphs"), GraphValues);
+        PackageObj->SetArrayField(TEXT("nodes"), NodeValues);
+        PackageValues.Add(MakeShared<FJsonValueObject>(PackageObj));
+    }
+
+    TSharedPtr<FJsonObject> RootObj = MakeShared<FJsonObject>();
+    RootObj->SetNumberField(TEXT("version"), PersistentStateVersion);
+    RootObj->SetArrayField(TEXT("packages"), PackageValues);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObj.ToSharedRef(), Writer);
+
+    const FString StatePath = GetPersistentStatePath();
+    if (!FFileHelper::SaveStringToFile(OutputString, *StatePath))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FBlueprintSearchIndex: Could not write '%s'"), *StatePath);
+        return;
+    }
+    UE_LOG(LogUnrealMCP, Log, TEXT("FBlueprintSearchIndex: Saved %d indexed Blueprints"), PackageValues.Num());
+}
+
+void FBlueprintSearchIndex::HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext)
+{
+    if (!Package || ObjectSaveContext.IsProceduralSave())
+    {
+        return;
+    }
+
+    // The Blueprint is loaded and its package file now matches it, so index it while it costs no load
+    UBlueprint* Blueprint = Cast<UBlueprint>(Package->FindAssetInPackage());
+    FDateTime Timestamp;
+    if (!Blueprint || !GetPackageTimestamp(Package->GetFName(), Timestamp))
+    {
+        if (Packages.Remove(Package->GetFName()) > 0)
+        {
+            bDirty = true;
+            CacheCounters.RecordInvalidation();
+        }
+        return;
+    }
+
+    FIndexedPackage& Indexed = Packages.FindOrAdd(Package->GetFName());
+    Indexed.PackageTimestamp = Timestamp;
+    IndexBlueprint(Blueprint, Indexed.Entry);
+    bDirty = true;
+}
+
+void FBlueprintSearchIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (Packages.Remove(AssetData.PackageName) > 0)
+    {
+        bDirty = true;
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FBlueprintSearchIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (Packages.Remove(FSoftObjectPath(OldObjectPath).GetLongPackageFName()) + Packages.Remove(AssetData.PackageName) > 0)
+    {
+        bDirty = true;
+        CacheCounters.RecordInvalidation();
+    }
+}
@@ -7,6 +7,8 @@
 #include "Services/ComponentService.h"
 #include "Services/PropertyService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -34,6 +36,9 @@
 #include "Engine/BlueprintCore.h"
 #include "UObject/StructOnScope.h"
 #include "Engine/Engine.h"
+#include "MCPBatchEditScope.h"
+#include "MCPTrace.h"
+#include "Misc/PackageName.h"
 
 // Blueprint Service Implementation
 FBlueprintService::FBlueprintService()
@@ -41,10 +46,23 @@ FBlueprintService::FBlueprintService()
     , PropertyService(MakeUnique<FBlueprintPropertyService>())
     , FunctionService(MakeUnique<FBlueprintFunctionService>())
 {
+    FMCPCacheStatsRegistry::Get().Register(TEXT("blueprint_cache"), TEXT("cache"),
+        [this](FMCPCacheStatsRegistry::FStats& OutStats)
+        {
+            const FBlueprintCacheStats Stats = BlueprintCache.GetCacheStats();
+            OutStats.Hits = Stats.CacheHits;
+            OutStats.Misses = Stats.CacheMisses;
+            OutStats.Invalidations = Stats.InvalidatedCount;
+            OutStats.Entries = Stats.CachedCount;
+        },
+        [this]() { BlueprintCache.ResetCacheStats(); });
+    FMCPCacheBudget::Get().Register(TEXT("blueprint_cache"), BlueprintCache);
 }
 
 FBlueprintService::~FBlueprintService()
 {
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("blueprint_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("blueprint_cache"));
 }
 
 FBlueprintService& FBlueprintService::Get()
@@ -106,7 +124,10 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
     CompilerLog.bAnnotateMentionedNodes = true; // Annotate nodes with errors
     
     // Compile the blueprint with detailed logging (use different signature)
-    FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompilerLog);
+    {
+        MCP_TRACE_SCOPE("MCP::CompileBlueprint");
+        FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &CompilerLog);
+    }
     
     // Log the compilation status for debugging
     FString StatusName;
@@ -251,6 +272,51 @@ bool FBlueprintService::CompileBlueprint(UBlueprint* Blueprint, FString& OutErro
     return true;
 }
 
+bool FBlueprintService::CompileBlueprintSkeleton(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings)
+{
+    if (!Blueprint)
+    {
+        OutErrors.Add(TEXT("Invalid blueprint"));
+        return false;
+    }
+    
+    FCompilerResultsLog CompilerLog(true);
+    CompilerLog.bSilentMode = false;
+    
+    // Rebuilds the skeleton class from variables, components and function signatures; graphs are
+    // not compiled and the generated class and the Blueprint's status are left as they were
+    {
+        MCP_TRACE_SCOPE("MCP::CompileBlueprintSkeleton");
+        FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::RegenerateSkeletonOnly | EBlueprintCompileOptions::SkipGarbageCollection, &CompilerLog);
+    }
+    
+    for (const TSharedRef<FTokenizedMessage>& Message : CompilerLog.Messages)
+    {
+        const FString MessageText = Message->ToText().ToString();
+        if (MessageText.IsEmpty())
+        {
+            continue;
+        }
+        if (Message->GetSeverity() == EMessageSeverity::Error)
+        {
+            OutErrors.Add(MessageText);
+        }
+        else if (Message->GetSeverity() == EMessageSeverity::Warning)
+        {
+            OutWarnings.Add(MessageText);
+        }
+    }
+    
+    if (CompilerLog.NumErrors > 0 && OutErrors.IsEmpty())
+    {
+        OutErrors.Add(FString::Printf(TEXT("Blueprint '%s' skeleton failed to compile with %d error(s)"), *Blueprint->GetName(), CompilerLog.NumErrors));
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("FBlueprintService::CompileBlueprintSkeleton: '%s' - %d error(s), %d warning(s)"),
+        *Blueprint->GetName(), CompilerLog.NumErrors, CompilerLog.NumWarnings);
+    return OutErrors.IsEmpty();
+}
+
 UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
 {
     UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Looking for blueprint '%s'"), *BlueprintName);
@@ -263,6 +329,20 @@ UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
         return CachedBlueprint;
     }
     
+    // A name resolved before, possibly in an earlier session, loads straight from its package
+    const FString KnownPackage = BlueprintCache.GetKnownPackage(BlueprintName);
+    if (!KnownPackage.IsEmpty())
+    {
+        const FString ObjectPath = KnownPackage + TEXT(".") + FPackageName::GetShortName(KnownPackage);
+        if (UBlueprint* KnownBlueprint = LoadObject<UBlueprint>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn))
+        {
+            BlueprintCache.CacheBlueprint(BlueprintName, KnownBlueprint);
+            UE_LOG(LogTemp, Verbose, TEXT("FBlueprintService::FindBlueprint: Loaded blueprint '%s' from known package '%s'"), *BlueprintName, *KnownPackage);
+            return KnownBlueprint;
+        }
+        BlueprintCache.ForgetKnownPackage(BlueprintName);
+    }
+
     // Use common utils to find blueprint
     UBlueprint* FoundBlueprint = FUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
     if (FoundBlueprint)
@@ -279,6 +359,16 @@ UBlueprint* FBlueprintService::FindBlueprint(const FString& BlueprintName)
     return FoundBlueprint;
 }
 
+void FBlueprintService::WarmStartCache()
+{
+    BlueprintCache.WarmStart();
+}
+
+void FBlueprintService::SaveCacheState() const
+{
+    BlueprintCache.SavePersistentState();
+}
+
 bool FBlueprintService::AddVariableToBlueprint(UBlueprint* Blueprint, const FString& VariableName, const FString& VariableType, bool bIsExposed)
 {
     return PropertyService->AddVariableToBlueprint(Blueprint, VariableName, VariableType, bIsExposed, BlueprintCache);
@@ -339,7 +429,7 @@ bool FBlueprintService::AddInterfaceToBlueprint(UBlueprint* Blueprint, const FSt
     FBlueprintEditorUtils::ImplementNewInterface(Blueprint, InterfacePath);
     
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     
     // Invalidate cache since blueprint was modified
     BlueprintCache.InvalidateBlueprint(Blueprint->GetName());
@@ -1,7 +1,6 @@
 #include "Services/ComponentService.h"
 #include "Services/IPropertyService.h"
 #include "Services/PropertyService.h"
-#include "Services/AssetDiscoveryService.h"
 #include "Factories/ComponentFactory.h"
 #include "Engine/Blueprint.h"
 #include "Engine/SimpleConstructionScript.h"
@@ -9,348 +8,13 @@
 #include "Components/SceneComponent.h"
 #include "Components/ActorComponent.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/Kismet2NameValidators.h"
 #include "GameFramework/Actor.h"
 #include "SubobjectDataSubsystem.h"
 #include "SubobjectData.h"
 #include "Engine/Engine.h"
-
-// Component Type Cache Implementation
-UClass* FComponentTypeCache::GetComponentClass(const FString& ComponentType)
-{
-    FScopeLock Lock(&CacheLock);
-    
-    // Update statistics
-    UpdateStats(false); // Assume miss initially
-    
-    if (TWeakObjectPtr<UClass>* CachedPtr = CachedComponentClasses.Find(ComponentType))
-    {
-        if (CachedPtr->IsValid())
-        {
-            // Update to hit since we found a valid entry
-            CacheStats.CacheHits++;
-            CacheStats.CacheMisses--;
-            
-            UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Cache hit for component type '%s'"), *ComponentType);
-            return CachedPtr->Get();
-        }
-        else
-        {
-            // Remove invalid entry
-            CachedComponentClasses.Remove(ComponentType);
-            CacheStats.CachedCount = CachedComponentClasses.Num();
-            UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Removed invalid cache entry for component type '%s'"), *ComponentType);
-        }
-    }
-    
-    // Try lazy loading
-    UClass* LoadedClass = LazyLoadComponentClass(ComponentType);
-    if (LoadedClass)
-    {
-        // Cache the loaded class
-        CachedComponentClasses.Add(ComponentType, LoadedClass);
-        CacheStats.CachedCount = CachedComponentClasses.Num();
-        
-        // Update to hit since we successfully loaded
-        CacheStats.CacheHits++;
-        CacheStats.CacheMisses--;
-        
-        UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Lazy loaded and cached component type '%s'"), *ComponentType);
-    }
-    
-    return LoadedClass;
-}
-
-void FComponentTypeCache::CacheComponentClass(const FString& ComponentType, UClass* ComponentClass)
-{
-    if (!ComponentClass)
-    {
-        return;
-    }
-    
-    FScopeLock Lock(&CacheLock);
-    CachedComponentClasses.Add(ComponentType, ComponentClass);
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Cached component type '%s'"), *ComponentType);
-}
-
-void FComponentTypeCache::RefreshCache()
-{
-    FScopeLock Lock(&CacheLock);
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Refreshing cache"));
-    
-    // Clear invalid entries
-    int32 CleanedCount = 0;
-    for (auto It = CachedComponentClasses.CreateIterator(); It; ++It)
-    {
-        if (!It.Value().IsValid())
-        {
-            It.RemoveCurrent();
-            CleanedCount++;
-        }
-    }
-    
-    CacheStats.RefreshCount++;
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    bNeedsRefresh = false;
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cache refresh complete. Cleaned %d invalid entries. %d types cached"), 
-        CleanedCount, CacheStats.CachedCount);
-}
-
-void FComponentTypeCache::PreloadCommonComponentTypes()
-{
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Preloading common component types"));
-    
-    // Common component types that are frequently used
-    TArray<FString> CommonComponentTypes = {
-        TEXT("StaticMeshComponent"),
-        TEXT("PointLightComponent"),
-        TEXT("SpotLightComponent"),
-        TEXT("DirectionalLightComponent"),
-        TEXT("BoxComponent"),
-        TEXT("SphereComponent"),
-        TEXT("CapsuleComponent"),
-        TEXT("CameraComponent"),
-        TEXT("AudioComponent"),
-        TEXT("SceneComponent"),
-        TEXT("BillboardComponent"),
-        TEXT("StaticMesh"),
-        TEXT("PointLight"),
-        TEXT("SpotLight"),
-        TEXT("DirectionalLight"),
-        TEXT("Box"),
-        TEXT("Sphere"),
-        TEXT("Capsule"),
-        TEXT("Camera"),
-        TEXT("Audio"),
-        TEXT("Scene"),
-        TEXT("Billboard")
-    };
-    
-    int32 PreloadedCount = 0;
-    for (const FString& ComponentType : CommonComponentTypes)
-    {
-        if (!IsCached(ComponentType))
-        {
-            UClass* ComponentClass = GetComponentClass(ComponentType);
-            if (ComponentClass)
-            {
-                PreloadedCount++;
-                UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache: Preloaded component type '%s'"), *ComponentType);
-            }
-        }
-    }
-    
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Preloading complete. %d component types preloaded"), PreloadedCount);
-}
-
-bool FComponentTypeCache::IsCached(const FString& ComponentType) const
-{
-    FScopeLock Lock(&CacheLock);
-    
-    if (const TWeakObjectPtr<UClass>* CachedPtr = CachedComponentClasses.Find(ComponentType))
-    {
-        return CachedPtr->IsValid();
-    }
-    
-    return false;
-}
-
-void FComponentTypeCache::ClearCache()
-{
-    FScopeLock Lock(&CacheLock);
-    int32 ClearedCount = CachedComponentClasses.Num();
-    CachedComponentClasses.Empty();
-    CacheStats.CachedCount = 0;
-    bNeedsRefresh = false;
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cleared %d cached component types"), ClearedCount);
-}
-
-FComponentTypeCacheStats FComponentTypeCache::GetCacheStats() const
-{
-    FScopeLock Lock(&CacheLock);
-    FComponentTypeCacheStats StatsCopy = CacheStats;
-    StatsCopy.CachedCount = CachedComponentClasses.Num();
-    return StatsCopy;
-}
-
-void FComponentTypeCache::ResetCacheStats()
-{
-    FScopeLock Lock(&CacheLock);
-    CacheStats.Reset();
-    CacheStats.CachedCount = CachedComponentClasses.Num();
-    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache: Cache statistics reset"));
-}
-
-int32 FComponentTypeCache::GetCachedCount() const
-{
-    FScopeLock Lock(&CacheLock);
-    return CachedComponentClasses.Num();
-}
-
-void FComponentTypeCache::UpdateStats(bool bWasHit) const
-{
-    // This method assumes the lock is already held
-    CacheStats.TotalRequests++;
-    if (bWasHit)
-    {
-        CacheStats.CacheHits++;
-    }
-    else
-    {
-        CacheStats.CacheMisses++;
-    }
-}
-
-UClass* FComponentTypeCache::LazyLoadComponentClass(const FString& ComponentType)
-{
-    // This method assumes the lock is already held
-    return ResolveComponentClassInternal(ComponentType);
-}
-
-TMap<FString, FString> FComponentTypeCache::GetSupportedComponentTypes() const
-{
-    static TMap<FString, FString> SupportedTypes;
-    
-    if (SupportedTypes.Num() == 0)
-    {
-        // Initialize supported component types mapping
-        SupportedTypes.Add(TEXT("StaticMesh"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("StaticMeshComponent"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("PointLight"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("PointLightComponent"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLight"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLightComponent"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLight"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLightComponent"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("Box"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("BoxComponent"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("Sphere"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("SphereComponent"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("Capsule"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("CapsuleComponent"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("Camera"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("CameraComponent"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("Audio"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("AudioComponent"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("Scene"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("SceneComponent"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("Billboard"), TEXT("BillboardComponent"));
-        SupportedTypes.Add(TEXT("BillboardComponent"), TEXT("BillboardComponent"));
-        SupportedTypes.Add(TEXT("Widget"), TEXT("WidgetComponent"));
-        SupportedTypes.Add(TEXT("WidgetComponent"), TEXT("WidgetComponent"));
-    }
-    
-    return SupportedTypes;
-}
-
-UClass* FComponentTypeCache::ResolveComponentClassInternal(const FString& ComponentType) const
-{
-    // Get the mapped component type (for aliases like "StaticMesh" -> "StaticMeshComponent")
-    TMap<FString, FString> SupportedTypes = GetSupportedComponentTypes();
-    const FString* MappedType = SupportedTypes.Find(ComponentType);
-    FString ActualComponentType = MappedType ? *MappedType : ComponentType;
-    
-    // First, try using ComponentFactory which has all default types registered
-    UClass* ComponentClass = FComponentFactory::Get().GetComponentClass(ActualComponentType);
-    if (ComponentClass)
-    {
-        UE_LOG(LogTemp, Verbose, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Found component '%s' via ComponentFactory"), *ActualComponentType);
-        return ComponentClass;
-    }
-    
-    // If not in ComponentFactory, try loading from Engine module
-    FString EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *ActualComponentType);
-    ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    
-    if (!ComponentClass)
-    {
-        // Try with U prefix
-        FString WithUPrefix = FString::Printf(TEXT("U%s"), *ActualComponentType);
-        EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *WithUPrefix);
-        ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    }
-    
-    // If not found in Engine, try loading as a Blueprint class
-    if (!ComponentClass)
-    {
-        UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Component '%s' not found in Engine, searching for Blueprint..."), *ActualComponentType);
-        
-        // Try direct Blueprint path (e.g., "/Game/DialogueSystem/DialogueComponent")
-        if (ActualComponentType.StartsWith(TEXT("/")))
-        {
-            UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Trying direct path: %s"), *ActualComponentType);
-            
-            // Try both the Blueprint asset path and the generated class path
-            ComponentClass = LoadObject<UClass>(nullptr, *ActualComponentType);
-            if (!ComponentClass)
-            {
-                FString GeneratedClassPath = ActualComponentType + TEXT("_C");
-                UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Trying generated class path: %s"), *GeneratedClassPath);
-                ComponentClass = LoadObject<UClass>(nullptr, *GeneratedClassPath);
-            }
-            
-            if (ComponentClass)
-            {
-                UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Found Blueprint component via direct path"));
-            }
-        }
-        else
-        {
-            // Use AssetDiscoveryService to find Blueprint components
-            UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Using AssetDiscoveryService to find '%s'"), *ActualComponentType);
-            
-            TArray<FString> BlueprintPaths = FAssetDiscoveryService::Get().FindBlueprints(ActualComponentType);
-            UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: AssetDiscoveryService found %d Blueprint paths"), BlueprintPaths.Num());
-            
-            TArray<FString> BlueprintSearchPaths;
-            
-            // Convert Blueprint paths to generated class paths
-            for (const FString& BPPath : BlueprintPaths)
-            {
-                FString GeneratedClassPath = BPPath + TEXT("_C");
-                BlueprintSearchPaths.Add(GeneratedClassPath);
-                UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Will try generated class path: %s"), *GeneratedClassPath);
-            }
-            
-            for (const FString& SearchPath : BlueprintSearchPaths)
-            {
-                UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Attempting to load: %s"), *SearchPath);
-                ComponentClass = LoadObject<UClass>(nullptr, *SearchPath);
-                if (ComponentClass)
-                {
-                    UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Found Blueprint component at '%s'"), *SearchPath);
-                    break;
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Failed to load from '%s'"), *SearchPath);
-                }
-            }
-        }
-    }
-    
-    // Verify that the class is a valid component type
-    if (ComponentClass && !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Class '%s' is not a component type (found class: %s)"), 
-            *ActualComponentType, *ComponentClass->GetName());
-        return nullptr;
-    }
-    
-    if (!ComponentClass)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Failed to resolve component type '%s'"), *ActualComponentType);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Log, TEXT("FComponentTypeCache::ResolveComponentClassInternal: Successfully resolved '%s' to class '%s'"), 
-            *ActualComponentType, *ComponentClass->GetName());
-    }
-    
-    return ComponentClass;
-}
+#include "MCPBatchEditScope.h"
+#include "Services/BlueprintComponentLookupCache.h"
 
 FComponentService& FComponentService::Get()
 {
@@ -359,6 +23,11 @@ FComponentService& FComponentService::Get()
 }
 
 bool FComponentService::AddComponentToBlueprint(UBlueprint* Blueprint, const FComponentCreationParams& Params, FString& OutErrorMessage)
+{
+    return AddComponentToBlueprint(Blueprint, Params, OutErrorMessage, false);
+}
+
+bool FComponentService::AddComponentToBlueprint(UBlueprint* Blueprint, const FComponentCreationParams& Params, FString& OutErrorMessage, bool bDeferStructuralUpdate)
 {
     if (!Blueprint)
     {
@@ -502,7 +171,7 @@ bool FComponentService::AddComponentToBlueprint(UBlueprint* Blueprint, const FCo
     AddParams.ParentHandle = ParentHandle;
     AddParams.NewClass = ComponentClass;
     AddParams.BlueprintContext = Blueprint;
-    AddParams.bSkipMarkBlueprintModified = false; // We want to mark blueprint as modified
+    AddParams.bSkipMarkBlueprintModified = bDeferStructuralUpdate; // A batch marks the blueprint once, after its last component
     AddParams.bConformTransformToParent = false;   // Keep our custom transform
     
     // Log detailed information before attempting to add
@@ -548,7 +217,23 @@ bool FComponentService::AddComponentToBlueprint(UBlueprint* Blueprint, const FCo
     UObject* ComponentTemplate = const_cast<UObject*>(ConstComponentTemplate);
     
     // Rename the component to match requested name
-    if (!Params.ComponentName.IsEmpty())
+    USCS_Node* NewSCSNode = NewSubobjectData->GetSCSNode();
+    if (!Params.ComponentName.IsEmpty() && bDeferStructuralUpdate && NewSCSNode)
+    {
+        // RenameSubobject marks the blueprint structurally modified; nothing references the new
+        // node yet, so renaming the node and its template directly is all it would do here
+        const FName NewName(*Params.ComponentName);
+        if (FKismetNameValidator(Blueprint).IsValid(NewName) == EValidatorResult::Ok)
+        {
+            NewSCSNode->SetVariableName(NewName);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FComponentService::AddComponentToBlueprint: Failed to rename component to '%s'"), 
+                *Params.ComponentName);
+        }
+    }
+    else if (!Params.ComponentName.IsEmpty())
     {
         if (!SubobjectDataSubsystem->RenameSubobject(NewHandle, FText::FromString(Params.ComponentName)))
         {
@@ -581,8 +266,11 @@ bool FComponentService::AddComponentToBlueprint(UBlueprint* Blueprint, const FCo
     }
     
     // Mark blueprint as modified and refresh
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-    FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
+    if (!bDeferStructuralUpdate)
+    {
+        FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
+        FBlueprintEditorUtils::RefreshAllNodes(Blueprint);
+    }
     
     UE_LOG(LogTemp, Log, TEXT("FComponentService::AddComponentToBlueprint: Successfully added component '%s' using SubobjectDataSubsystem"), 
         *Params.ComponentName);
@@ -597,17 +285,8 @@ bool FComponentService::RemoveComponentFromBlueprint(UBlueprint* Blueprint, cons
         return false;
     }
     
-    // Find the component node
-    USCS_Node* ComponentNode = nullptr;
-    for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-    {
-        if (Node && Node->GetVariableName().ToString() == ComponentName)
-        {
-            ComponentNode = Node;
-            break;
-        }
-    }
-    
+    // Find the component node; inherited and native components cannot be removed here
+    USCS_Node* ComponentNode = FBlueprintComponentLookupCache::Get().FindOwnNode(Blueprint, ComponentName);
     if (!ComponentNode)
     {
         UE_LOG(LogTemp, Warning, TEXT("FComponentService::RemoveComponentFromBlueprint: Component '%s' not found"), *ComponentName);
@@ -618,7 +297,7 @@ bool FComponentService::RemoveComponentFromBlueprint(UBlueprint* Blueprint, cons
     Blueprint->SimpleConstructionScript->RemoveNode(ComponentNode);
     
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     
     UE_LOG(LogTemp, Log, TEXT("FComponentService::RemoveComponentFromBlueprint: Successfully removed component '%s'"), *ComponentName);
     return true;
@@ -626,40 +305,8 @@ bool FComponentService::RemoveComponentFromBlueprint(UBlueprint* Blueprint, cons
 
 UObject* FComponentService::FindComponentInBlueprint(UBlueprint* Blueprint, const FString& ComponentName)
 {
-    if (!Blueprint)
-    {
-        return nullptr;
-    }
-    
-    // Search in construction script first
-    if (Blueprint->SimpleConstructionScript)
-    {
-        for (USCS_Node* Node : Blueprint->SimpleConstructionScript->GetAllNodes())
-        {
-            if (Node && Node->GetVariableName().ToString() == ComponentName)
-            {
-                return Node->ComponentTemplate;
-            }
-        }
-    }
-    
-    // Search inherited components on the CDO
-    UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
-    AActor* DefaultActor = Cast<AActor>(DefaultObject);
-    if (DefaultActor)
-    {
-        TArray<UActorComponent*> AllComponents;
-        DefaultActor->GetComponents(AllComponents);
-        for (UActorComponent* Comp : AllComponents)
-        {
-            if (Comp && Comp->GetName() == ComponentName)
-            {
-                return Comp;
-            }
-        }
-    }
-    
-    return nullptr;
+    // Construction script nodes first, then inherited and native components
+    return FBlueprintComponentLookupCache::Get().FindTemplate(Blueprint, ComponentName);
 }
 
 TArray<TPair<FString, FString>> FComponentService::GetBlueprintComponents(UBlueprint* Blueprint)
@@ -723,86 +370,12 @@ TArray<TPair<FString, FString>> FComponentService::GetBlueprintComponents(UBluep
 
 bool FComponentService::IsValidComponentType(const FString& ComponentType)
 {
-    TMap<FString, FString> SupportedTypes = GetSupportedComponentTypes();
-    return SupportedTypes.Contains(ComponentType);
+    return GetComponentClass(ComponentType) != nullptr;
 }
 
 UClass* FComponentService::GetComponentClass(const FString& ComponentType)
 {
-    return ComponentTypeCache.GetComponentClass(ComponentType);
-}
-
-TMap<FString, FString> FComponentService::GetSupportedComponentTypes() const
-{
-    static TMap<FString, FString> SupportedTypes;
-    
-    if (SupportedTypes.Num() == 0)
-    {
-        // Initialize supported component types mapping
-        SupportedTypes.Add(TEXT("StaticMesh"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("StaticMeshComponent"), TEXT("StaticMeshComponent"));
-        SupportedTypes.Add(TEXT("PointLight"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("PointLightComponent"), TEXT("PointLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLight"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("SpotLightComponent"), TEXT("SpotLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLight"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("DirectionalLightComponent"), TEXT("DirectionalLightComponent"));
-        SupportedTypes.Add(TEXT("Box"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("BoxComponent"), TEXT("BoxComponent"));
-        SupportedTypes.Add(TEXT("Sphere"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("SphereComponent"), TEXT("SphereComponent"));
-        SupportedTypes.Add(TEXT("Capsule"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("CapsuleComponent"), TEXT("CapsuleComponent"));
-        SupportedTypes.Add(TEXT("Camera"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("CameraComponent"), TEXT("CameraComponent"));
-        SupportedTypes.Add(TEXT("Audio"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("AudioComponent"), TEXT("AudioComponent"));
-        SupportedTypes.Add(TEXT("Scene"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("SceneComponent"), TEXT("SceneComponent"));
-        SupportedTypes.Add(TEXT("Billboard"), TEXT("BillboardComponent"));
-        SupportedTypes.Add(TEXT("BillboardComponent"), TEXT("BillboardComponent"));
-        SupportedTypes.Add(TEXT("Widget"), TEXT("WidgetComponent"));
-        SupportedTypes.Add(TEXT("WidgetComponent"), TEXT("WidgetComponent"));
-    }
-    
-    return SupportedTypes;
-}
-
-UClass* FComponentService::ResolveComponentClass(const FString& ComponentType) const
-{
-    // Get the mapped component type (for aliases like "StaticMesh" -> "StaticMeshComponent")
-    TMap<FString, FString> SupportedTypes = GetSupportedComponentTypes();
-    const FString* MappedType = SupportedTypes.Find(ComponentType);
-    FString ActualComponentType = MappedType ? *MappedType : ComponentType;
-    
-    // First, try using ComponentFactory which has all default types registered
-    UClass* ComponentClass = FComponentFactory::Get().GetComponentClass(ActualComponentType);
-    if (ComponentClass)
-    {
-        UE_LOG(LogTemp, Verbose, TEXT("FComponentService::ResolveComponentClass: Found component '%s' via ComponentFactory"), *ActualComponentType);
-        return ComponentClass;
-    }
-    
-    // If not in ComponentFactory, try loading from Engine module
-    FString EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *ActualComponentType);
-    ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    
-    if (!ComponentClass)
-    {
-        // Try with U prefix
-        FString WithUPrefix = FString::Printf(TEXT("U%s"), *ActualComponentType);
-        EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *WithUPrefix);
-        ComponentClass = LoadObject<UClass>(nullptr, *EnginePath);
-    }
-    
-    // Verify that the class is a valid component type
-    if (ComponentClass && !ComponentClass->IsChildOf(UActorComponent::StaticClass()))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FComponentService::ResolveComponentClass: Class '%s' is not a component type"), *ActualComponentType);
-        return nullptr;
-    }
-    
-    return ComponentClass;
+    return FComponentFactory::Get().GetComponentClass(ComponentType);
 }
 
 void FComponentService::SetComponentTransform(USceneComponent* SceneComponent, 
@@ -893,7 +466,7 @@ bool FComponentService::SetPhysicsProperties(UBlueprint* Blueprint, const FStrin
     }
     
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     
     UE_LOG(LogTemp, Log, TEXT("FComponentService::SetPhysicsProperties: Successfully set physics properties for component '%s'"), *ComponentName);
     return true;
@@ -935,7 +508,7 @@ bool FComponentService::SetStaticMeshProperties(UBlueprint* Blueprint, const FSt
     StaticMeshComponent->SetStaticMesh(StaticMesh);
     
     // Mark blueprint as modified
-    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    FMCPBatchEditScope::MarkBlueprintAsModified(Blueprint);
     
     UE_LOG(LogTemp, Log, TEXT("FComponentService::SetStaticMeshProperties: Successfully set static mesh '%s' for component '%s'"), *StaticMeshPath, *ComponentName);
     return true;
@@ -0,0 +1,115 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableRowImporter.h"
+#include "Engine/DataTable.h"
+#include "Async/ParallelFor.h"
+
+bool FDataTableService::ImportRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows)
+{
+    if (!DataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    if (!RowStruct)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to get row struct from DataTable"));
+        return false;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    OutAddedRows.Empty(Rows.Num());
+    OutFailedRows.Empty();
+    
+    // Field names and property handlers are worked out once for the whole import
+    const FDataTableRowImporter Importer(RowStruct);
+    
+    DataTable->Modify(true);
+    
+    // Rows are handed to the table's row map directly instead of AddRow copying a scratch row;
+    // the table frees them with FMemory::Free like the ones it allocates itself
+    TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
+    RowMap.Reserve(RowMap.Num() + Rows.Num());
+    
+    // Rows are converted into their own memory first, on worker threads when the struct allows it;
+    // only handing them to the table stays on the game thread, in request order
+    struct FConvertedRow
+    {
+        uint8* RowMemory = nullptr;
+        FString Error;
+    };
+    TArray<FConvertedRow> ConvertedRows;
+    ConvertedRows.SetNum(Rows.Num());
+    
+    const int32 StructureSize = RowStruct->GetStructureSize();
+    const int32 MinAlignment = RowStruct->GetMinAlignment();
+    const bool bParallel = Importer.CanConvertOffGameThread() && Rows.Num() >= BulkImportParallelMinRows;
+    ParallelFor(TEXT("MCPDataTableImportRows"), Rows.Num(), BulkImportParallelBatchSize, [&](int32 RowIndex)
+    {
+        const FDataTableRowParams& RowParams = Rows[RowIndex];
+        FConvertedRow& Converted = ConvertedRows[RowIndex];
+        if (!RowParams.IsValid(DataTable, Converted.Error))
+        {
+            return;
+        }
+        
+        uint8* RowMemory = static_cast<uint8*>(FMemory::Malloc(StructureSize, MinAlignment));
+        RowStruct->InitializeStruct(RowMemory);
+        if (!Importer.ConvertRow(*RowParams.RowData, RowMemory, Converted.Error))
+        {
+            RowStruct->DestroyStruct(RowMemory);
+            FMemory::Free(RowMemory);
+            return;
+        }
+        Converted.RowMemory = RowMemory;
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    
+    for (int32 RowIndex = 0; RowIndex < Rows.Num(); ++RowIndex)
+    {
+        const FDataTableRowParams& RowParams = Rows[RowIndex];
+        FConvertedRow& Converted = ConvertedRows[RowIndex];
+        if (!Converted.RowMemory)
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *Converted.Error));
+            continue;
+        }
+        
+        HandOverImportedRow(RowMap, RowStruct, FName(*RowParams.RowName), Converted.RowMemory);
+        OutAddedRows.Add(RowParams.RowName);
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Bulk import of %d rows into '%s': %d added, %d failed in %.3f s (%s)"),
+        Rows.Num(), *DataTable->GetName(), OutAddedRows.Num(), OutFailedRows.Num(), FPlatformTime::Seconds() - StartTime,
+        bParallel ? TEXT("parallel") : TEXT("game thread"));
+    
+    if (OutAddedRows.Num() > 0)
+    {
+        FinishBulkImport(DataTable);
+        return true;
+    }
+    
+    return false;
+}
+
+void FDataTableService::HandOverImportedRow(TMap<FName, uint8*>& RowMap, const UScriptStruct* RowStruct, const FName& RowName, uint8* RowMemory)
+{
+    uint8*& Slot = RowMap.FindOrAdd(RowName, nullptr);
+    if (Slot)
+    {
+        RowStruct->DestroyStruct(Slot);
+        FMemory::Free(Slot);
+    }
+    Slot = RowMemory;
+}
+
+void FDataTableService::FinishBulkImport(UDataTable* DataTable)
+{
+    // One change notification for the whole import instead of one per row
+    DataTable->HandleDataTableChanged(NAME_None);
+    DataTable->PostEditChange();
+    DataTable->MarkPackageDirty();
+    
+    SaveAndSyncDataTable(DataTable);
+    RefreshDataTableEditor(DataTable);
+}
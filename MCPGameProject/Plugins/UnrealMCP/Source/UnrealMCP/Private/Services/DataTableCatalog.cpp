@@ -0,0 +1,185 @@
+#include "Services/DataTableCatalog.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/DataTable.h"
+#include "MCPLogging.h"
+#include "Misc/PackageName.h"
+
+FDataTableCatalog& FDataTableCatalog::Get()
+{
+    static FDataTableCatalog Instance;
+    return Instance;
+}
+
+void FDataTableCatalog::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FDataTableCatalog::HandleAssetChanged);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FDataTableCatalog::HandleAssetChanged);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FDataTableCatalog::HandleAssetRenamed);
+        AssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddRaw(this, &FDataTableCatalog::HandleAssetChanged);
+    }
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("datatable_catalog"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(Entries.Num()); });
+}
+
+void FDataTableCatalog::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("datatable_catalog"));
+
+    Invalidate();
+}
+
+FDataTableCatalog::EResolution FDataTableCatalog::Resolve(const FString& NameOrPath, FEntry& OutEntry)
+{
+    // Without the registry listeners a kept catalog could go stale unnoticed
+    if (!bInitialized || !IsInGameThread() || NameOrPath.IsEmpty() || !EnsureBuilt())
+    {
+        return EResolution::Unknown;
+    }
+
+    const FString Key = NameOrPath.ToLower();
+    const int32* Index = NameOrPath.StartsWith(TEXT("/")) ? EntryByPath.Find(Key) : nullptr;
+    if (!Index && !NameOrPath.Contains(TEXT("/")))
+    {
+        // "ItemTable.ItemTable" names the same table as "ItemTable"
+        FString Name = Key;
+        int32 DotIndex = INDEX_NONE;
+        if (Name.FindChar(TEXT('.'), DotIndex))
+        {
+            Name.LeftInline(DotIndex);
+        }
+        Index = EntryByName.Find(Name);
+    }
+
+    if (!Index)
+    {
+        return EResolution::NotFound;
+    }
+    OutEntry = Entries[*Index];
+    return EResolution::Found;
+}
+
+void FDataTableCatalog::Prewarm()
+{
+    check(IsInGameThread());
+    EnsureBuilt();
+}
+
+bool FDataTableCatalog::EnsureBuilt()
+{
+    if (bBuilt)
+    {
+        CacheCounters.RecordHit();
+        return true;
+    }
+    CacheCounters.RecordMiss();
+
+    // A catalog built while the registry is still scanning would miss tables and answer wrongly
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry || AssetRegistry->IsLoadingAssets())
+    {
+        return false;
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), Assets, true);
+    Assets.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.GetSoftObjectPath().ToString() < B.GetSoftObjectPath().ToString();
+    });
+
+    Entries.Reset(Assets.Num());
+    EntryByName.Reset();
+    EntryByPath.Reset();
+    for (const FAssetData& Asset : Assets)
+    {
+        const int32 Index = Entries.Num();
+        FEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.ObjectPath = Asset.GetSoftObjectPath();
+        Asset.GetTagValue(TEXT("RowStructure"), Entry.RowStructPath);
+
+        EntryByPath.Add(Entry.ObjectPath.ToString().ToLower(), Index);
+        EntryByPath.FindOrAdd(Asset.PackageName.ToString().ToLower(), Index);
+
+        int32& NameIndex = EntryByName.FindOrAdd(Asset.AssetName.ToString().ToLower(), Index);
+        if (GetFolderRank(Entry.ObjectPath) < GetFolderRank(Entries[NameIndex].ObjectPath))
+        {
+            NameIndex = Index;
+        }
+    }
+
+    bBuilt = true;
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("DataTable catalog: listed %d DataTables"), Entries.Num());
+    return true;
+}
+
+int32 FDataTableCatalog::GetFolderRank(const FSoftObjectPath& ObjectPath)
+{
+    const FString PackagePath = FPackageName::GetLongPackagePath(ObjectPath.GetLongPackageName());
+    if (PackagePath.Equals(TEXT("/Game/Data"), ESearchCase::IgnoreCase))
+    {
+        return 0;
+    }
+    if (PackagePath.Equals(TEXT("/Game/DataTables"), ESearchCase::IgnoreCase))
+    {
+        return 1;
+    }
+    if (PackagePath.Equals(TEXT("/Game"), ESearchCase::IgnoreCase))
+    {
+        return 2;
+    }
+    return 3;
+}
+
+void FDataTableCatalog::Invalidate()
+{
+    if (bBuilt)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    Entries.Empty();
+    EntryByName.Empty();
+    EntryByPath.Empty();
+    bBuilt = false;
+}
+
+void FDataTableCatalog::HandleAssetChanged(const FAssetData& AssetData)
+{
+    if (bBuilt && AssetData.IsInstanceOf(UDataTable::StaticClass()))
+    {
+        Invalidate();
+    }
+}
+
+void FDataTableCatalog::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    HandleAssetChanged(AssetData);
+}
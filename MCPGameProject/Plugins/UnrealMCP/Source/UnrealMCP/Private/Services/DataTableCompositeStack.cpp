@@ -0,0 +1,169 @@
+#include "Services/DataTableService.h"
+#include "Engine/CompositeDataTable.h"
+#include "Engine/DataTable.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** Parent tables of a composite table, in the order they are merged; ParentTables is not exposed in C++ */
+    TArray<const UDataTable*> GetParentTables(const UCompositeDataTable* CompositeTable)
+    {
+        TArray<const UDataTable*> Parents;
+        const FArrayProperty* ParentsProperty = FindFProperty<FArrayProperty>(UCompositeDataTable::StaticClass(), TEXT("ParentTables"));
+        if (!ParentsProperty || !ParentsProperty->Inner->IsA<FObjectPropertyBase>())
+        {
+            return Parents;
+        }
+
+        const FObjectPropertyBase* ParentProperty = CastFieldChecked<FObjectPropertyBase>(ParentsProperty->Inner);
+        FScriptArrayHelper ParentsHelper(ParentsProperty, ParentsProperty->ContainerPtrToValuePtr<void>(CompositeTable));
+        Parents.Reserve(ParentsHelper.Num());
+        for (int32 ParentIndex = 0; ParentIndex < ParentsHelper.Num(); ++ParentIndex)
+        {
+            Parents.Add(Cast<UDataTable>(ParentProperty->GetObjectPropertyValue(ParentsHelper.GetRawPtr(ParentIndex))));
+        }
+        return Parents;
+    }
+
+    FString TablePath(const UDataTable* Table)
+    {
+        return Table ? Table->GetPathName() : FString();
+    }
+}
+
+bool FDataTableService::GetCompositeDataTableStack(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    const UCompositeDataTable* CompositeTable = Cast<UCompositeDataTable>(DataTable);
+    if (!CompositeTable)
+    {
+        OutError = DataTable
+            ? FString::Printf(TEXT("DataTable '%s' is not a composite table"), *DataTable->GetName())
+            : TEXT("DataTable is null");
+        return false;
+    }
+
+    if (!Query.IsValid(OutError))
+    {
+        return false;
+    }
+    if (Query.Fields.Num() > 0 || Query.Filters.Num() > 0)
+    {
+        OutError = TEXT("Fields and filters do not apply to the parent stack; read rows with get_datatable_rows");
+        return false;
+    }
+
+    const TArray<const UDataTable*> Parents = GetParentTables(CompositeTable);
+
+    // The composite copies the parents' rows in order, so the last parent holding a row is its source
+    TMap<FName, TArray<int32, TInlineAllocator<4>>> RowSources;
+    TArray<TSharedPtr<FJsonValue>> ParentsArray;
+    ParentsArray.Reserve(Parents.Num());
+    for (int32 ParentIndex = 0; ParentIndex < Parents.Num(); ++ParentIndex)
+    {
+        const UDataTable* Parent = Parents[ParentIndex];
+
+        TSharedPtr<FJsonObject> ParentObj = MakeShared<FJsonObject>();
+        ParentObj->SetNumberField(TEXT("index"), ParentIndex);
+        if (!Parent)
+        {
+            ParentObj->SetBoolField(TEXT("missing"), true);
+            ParentsArray.Add(MakeShared<FJsonValueObject>(ParentObj));
+            continue;
+        }
+
+        ParentObj->SetStringField(TEXT("path"), TablePath(Parent));
+        ParentObj->SetStringField(TEXT("row_struct"), Parent->GetRowStruct() ? Parent->GetRowStruct()->GetPathName() : FString());
+        ParentObj->SetNumberField(TEXT("row_count"), Parent->GetRowMap().Num());
+        ParentObj->SetBoolField(TEXT("is_composite"), Parent->IsA<UCompositeDataTable>());
+        if (Parent->GetRowStruct() != CompositeTable->GetRowStruct())
+        {
+            // The composite skips parents whose row struct differs from its own
+            ParentObj->SetBoolField(TEXT("struct_mismatch"), true);
+        }
+        else
+        {
+            for (const TPair<FName, uint8*>& RowPair : Parent->GetRowMap())
+            {
+                RowSources.FindOrAdd(RowPair.Key).Add(ParentIndex);
+            }
+        }
+        ParentsArray.Add(MakeShared<FJsonValueObject>(ParentObj));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> RowsArray;
+    int32 MatchedCount = 0;
+    int32 OverriddenCount = 0;
+    auto VisitRow = [&](const FName& RowName)
+    {
+        const TArray<int32, TInlineAllocator<4>>* Sources = RowSources.Find(RowName);
+        const int32 MatchIndex = MatchedCount++;
+        if (Sources && Sources->Num() > 1)
+        {
+            ++OverriddenCount;
+        }
+        if (MatchIndex < Query.Offset || (Query.Limit > 0 && RowsArray.Num() >= Query.Limit))
+        {
+            return;
+        }
+
+        TSharedPtr<FJsonObject> RowObj = MakeShared<FJsonObject>();
+        RowObj->SetStringField(TEXT("row_name"), RowName.ToString());
+        if (Sources && Sources->Num() > 0)
+        {
+            RowObj->SetStringField(TEXT("source_table"), TablePath(Parents[Sources->Last()]));
+            RowObj->SetNumberField(TEXT("source_index"), Sources->Last());
+
+            TArray<TSharedPtr<FJsonValue>> Overridden;
+            for (int32 SourceIndex = 0; SourceIndex < Sources->Num() - 1; ++SourceIndex)
+            {
+                Overridden.Add(MakeShared<FJsonValueString>(TablePath(Parents[(*Sources)[SourceIndex]])));
+            }
+            RowObj->SetArrayField(TEXT("overridden_tables"), Overridden);
+        }
+        else
+        {
+            // Rows the composite holds that no current parent provides are stale until it is rebuilt
+            RowObj->SetBoolField(TEXT("stale"), true);
+        }
+        RowsArray.Add(MakeShared<FJsonValueObject>(RowObj));
+    };
+
+    const TMap<FName, uint8*>& RowMap = CompositeTable->GetRowMap();
+    if (Query.RowNames.Num() > 0)
+    {
+        for (const FString& RowName : Query.RowNames)
+        {
+            const FName Name(*RowName);
+            if (RowMap.Contains(Name) || RowSources.Contains(Name))
+            {
+                VisitRow(Name);
+            }
+        }
+    }
+    else
+    {
+        for (const TPair<FName, uint8*>& RowPair : RowMap)
+        {
+            VisitRow(RowPair.Key);
+        }
+    }
+
+    const int32 NextOffset = Query.Offset + RowsArray.Num();
+    const bool bHasMore = NextOffset < MatchedCount;
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetStringField(TEXT("row_struct"), CompositeTable->GetRowStruct() ? CompositeTable->GetRowStruct()->GetPathName() : FString());
+    OutResult->SetArrayField(TEXT("parents"), ParentsArray);
+    OutResult->SetArrayField(TEXT("rows"), RowsArray);
+    OutResult->SetNumberField(TEXT("total_rows"), RowMap.Num());
+    OutResult->SetNumberField(TEXT("matched_count"), MatchedCount);
+    OutResult->SetNumberField(TEXT("overridden_count"), OverriddenCount);
+    OutResult->SetNumberField(TEXT("offset"), Query.Offset);
+    OutResult->SetNumberField(TEXT("returned_count"), RowsArray.Num());
+    OutResult->SetBoolField(TEXT("has_more"), bHasMore);
+    if (bHasMore)
+    {
+        OutResult->SetNumberField(TEXT("next_offset"), NextOffset);
+    }
+    return true;
+}
@@ -0,0 +1,403 @@
+#include "Services/DataTableService.h"
+#include "Services/AssetDiscoveryService.h"
+#include "Engine/CurveTable.h"
+#include "Curves/RichCurve.h"
+#include "Curves/SimpleCurve.h"
+#include "EditorScriptingUtilities/Public/EditorAssetLibrary.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Algo/StableSort.h"
+#include "MCPSaveQueue.h"
+
+namespace
+{
+    const TCHAR* InterpModeToString(ERichCurveInterpMode Mode)
+    {
+        switch (Mode)
+        {
+        case RCIM_Linear:   return TEXT("linear");
+        case RCIM_Constant: return TEXT("constant");
+        case RCIM_Cubic:    return TEXT("cubic");
+        default:            return TEXT("none");
+        }
+    }
+
+    ERichCurveInterpMode InterpModeFromString(const FString& Mode)
+    {
+        if (Mode == TEXT("constant"))
+        {
+            return RCIM_Constant;
+        }
+        if (Mode == TEXT("cubic"))
+        {
+            return RCIM_Cubic;
+        }
+        return RCIM_Linear;
+    }
+
+    const TCHAR* CurveTableModeToString(ECurveTableMode Mode)
+    {
+        switch (Mode)
+        {
+        case ECurveTableMode::SimpleCurves: return TEXT("simple");
+        case ECurveTableMode::RichCurves:   return TEXT("rich");
+        default:                            return TEXT("empty");
+        }
+    }
+
+    /** Keys of a row sorted by time, with a later duplicate time replacing the earlier key */
+    void SortKeys(const FCurveTableRowParams& Row, TArray<TPair<float, float>>& OutKeys)
+    {
+        OutKeys.Reset(Row.Times.Num());
+        for (int32 KeyIndex = 0; KeyIndex < Row.Times.Num(); ++KeyIndex)
+        {
+            OutKeys.Emplace(Row.Times[KeyIndex], Row.Values[KeyIndex]);
+        }
+        Algo::StableSortBy(OutKeys, [](const TPair<float, float>& Key) { return Key.Key; });
+
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < OutKeys.Num(); ++ReadIndex)
+        {
+            if (WriteIndex > 0 && OutKeys[WriteIndex - 1].Key == OutKeys[ReadIndex].Key)
+            {
+                OutKeys[WriteIndex - 1] = OutKeys[ReadIndex];
+                continue;
+            }
+            OutKeys[WriteIndex++] = OutKeys[ReadIndex];
+        }
+        OutKeys.SetNum(WriteIndex);
+    }
+
+    /** Row as the packed arrays get_curve_table_rows returns */
+    TSharedPtr<FJsonObject> CurveRowToJson(const FName& RowName, const FRealCurve& Curve, ECurveTableMode Mode)
+    {
+        TArray<TSharedPtr<FJsonValue>> Times;
+        TArray<TSharedPtr<FJsonValue>> Values;
+        FString InterpMode;
+
+        if (Mode == ECurveTableMode::SimpleCurves)
+        {
+            const FSimpleCurve& SimpleCurve = static_cast<const FSimpleCurve&>(Curve);
+            const TArray<FSimpleCurveKey>& Keys = SimpleCurve.GetConstRefOfKeys();
+            Times.Reserve(Keys.Num());
+            Values.Reserve(Keys.Num());
+            for (const FSimpleCurveKey& Key : Keys)
+            {
+                Times.Add(MakeShared<FJsonValueNumber>(Key.Time));
+                Values.Add(MakeShared<FJsonValueNumber>(Key.Value));
+            }
+            InterpMode = InterpModeToString(SimpleCurve.GetKeyInterpMode());
+        }
+        else
+        {
+            const FRichCurve& RichCurve = static_cast<const FRichCurve&>(Curve);
+            const TArray<FRichCurveKey>& Keys = RichCurve.GetConstRefOfKeys();
+            Times.Reserve(Keys.Num());
+            Values.Reserve(Keys.Num());
+            for (const FRichCurveKey& Key : Keys)
+            {
+                Times.Add(MakeShared<FJsonValueNumber>(Key.Time));
+                Values.Add(MakeShared<FJsonValueNumber>(Key.Value));
+
+                // Rich curves carry a mode per key; a row is only given one mode when its keys agree
+                const FString KeyMode = InterpModeToString(Key.InterpMode);
+                InterpMode = InterpMode.IsEmpty() || InterpMode == KeyMode ? KeyMode : TEXT("mixed");
+            }
+            if (InterpMode.IsEmpty())
+            {
+                InterpMode = InterpModeToString(RCIM_Linear);
+            }
+        }
+
+        TSharedPtr<FJsonObject> RowObj = MakeShared<FJsonObject>();
+        RowObj->SetStringField(TEXT("row_name"), RowName.ToString());
+        RowObj->SetStringField(TEXT("interp_mode"), InterpMode);
+        RowObj->SetArrayField(TEXT("times"), Times);
+        RowObj->SetArrayField(TEXT("values"), Values);
+        return RowObj;
+    }
+
+    /** Interpolation a write gives a row: the requested mode, else the row's current one */
+    ERichCurveInterpMode ResolveInterpMode(const FRealCurve* Curve, ECurveTableMode Mode, const FString& InterpMode)
+    {
+        if (!InterpMode.IsEmpty() || !Curve)
+        {
+            return InterpModeFromString(InterpMode);
+        }
+        if (Mode == ECurveTableMode::SimpleCurves)
+        {
+            return static_cast<const FSimpleCurve*>(Curve)->GetKeyInterpMode();
+        }
+        const TArray<FRichCurveKey>& Keys = static_cast<const FRichCurve*>(Curve)->GetConstRefOfKeys();
+        return Keys.Num() > 0 ? Keys[0].InterpMode.GetValue() : RCIM_Linear;
+    }
+
+    /** @return true if a curve already has exactly these sorted keys and interpolation */
+    bool CurveMatches(const FRealCurve& Curve, ECurveTableMode Mode, const TArray<TPair<float, float>>& Keys, ERichCurveInterpMode InterpMode)
+    {
+        if (Mode == ECurveTableMode::SimpleCurves)
+        {
+            const FSimpleCurve& SimpleCurve = static_cast<const FSimpleCurve&>(Curve);
+            const TArray<FSimpleCurveKey>& OldKeys = SimpleCurve.GetConstRefOfKeys();
+            if (OldKeys.Num() != Keys.Num() || SimpleCurve.GetKeyInterpMode() != InterpMode)
+            {
+                return false;
+            }
+            for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+            {
+                if (OldKeys[KeyIndex].Time != Keys[KeyIndex].Key || OldKeys[KeyIndex].Value != Keys[KeyIndex].Value)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        const TArray<FRichCurveKey>& OldKeys = static_cast<const FRichCurve&>(Curve).GetConstRefOfKeys();
+        if (OldKeys.Num() != Keys.Num())
+        {
+            return false;
+        }
+        for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+        {
+            if (OldKeys[KeyIndex].Time != Keys[KeyIndex].Key || OldKeys[KeyIndex].Value != Keys[KeyIndex].Value
+                || OldKeys[KeyIndex].InterpMode != InterpMode)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Replace every key of a curve with sorted keys */
+    void WriteCurveKeys(FRealCurve& Curve, ECurveTableMode Mode, const TArray<TPair<float, float>>& Keys, ERichCurveInterpMode InterpMode)
+    {
+        if (Mode == ECurveTableMode::SimpleCurves)
+        {
+            TArray<FSimpleCurveKey> NewKeys;
+            NewKeys.Reserve(Keys.Num());
+            for (const TPair<float, float>& Key : Keys)
+            {
+                NewKeys.Emplace(Key.Key, Key.Value);
+            }
+            FSimpleCurve& SimpleCurve = static_cast<FSimpleCurve&>(Curve);
+            SimpleCurve.SetKeys(NewKeys);
+            SimpleCurve.SetKeyInterpMode(InterpMode);
+            return;
+        }
+
+        TArray<FRichCurveKey> NewKeys;
+        NewKeys.Reserve(Keys.Num());
+        for (const TPair<float, float>& Key : Keys)
+        {
+            FRichCurveKey& NewKey = NewKeys.Emplace_GetRef(Key.Key, Key.Value);
+            NewKey.InterpMode = InterpMode;
+        }
+        FRichCurve& RichCurve = static_cast<FRichCurve&>(Curve);
+        RichCurve.SetKeys(NewKeys);
+        RichCurve.AutoSetTangents();
+    }
+}
+
+UCurveTable* FDataTableService::FindCurveTable(const FString& CurveTableName)
+{
+    TArray<FString> PathVariations;
+    if (CurveTableName.StartsWith(TEXT("/")))
+    {
+        PathVariations.Add(CurveTableName);
+        if (!CurveTableName.Contains(TEXT(".")))
+        {
+            PathVariations.Add(FString::Printf(TEXT("%s.%s"), *CurveTableName, *FPaths::GetBaseFilename(CurveTableName)));
+        }
+    }
+    else
+    {
+        // Short names are resolved from the asset index, like DataTable names
+        FSoftObjectPath IndexedPath;
+        const FAssetDiscoveryService::EAssetResolution Resolution =
+            FAssetDiscoveryService::Get().ResolveAssetPath(CurveTableName, UCurveTable::StaticClass(), IndexedPath);
+        if (Resolution == FAssetDiscoveryService::EAssetResolution::Found)
+        {
+            if (UCurveTable* IndexedTable = Cast<UCurveTable>(IndexedPath.TryLoad()))
+            {
+                return IndexedTable;
+            }
+        }
+        else if (Resolution == FAssetDiscoveryService::EAssetResolution::NotFound)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to find CurveTable: '%s'"), *CurveTableName);
+            return nullptr;
+        }
+
+        PathVariations.Add(FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("Data/%s.%s"), *CurveTableName, *CurveTableName)));
+        PathVariations.Add(FUnrealMCPCommonUtils::BuildGamePath(FString::Printf(TEXT("%s.%s"), *CurveTableName, *CurveTableName)));
+    }
+
+    for (const FString& Path : PathVariations)
+    {
+        if (UCurveTable* FoundTable = Cast<UCurveTable>(UEditorAssetLibrary::LoadAsset(Path)))
+        {
+            return FoundTable;
+        }
+    }
+
+    UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to find CurveTable: '%s'. Tried paths: [%s]"),
+        *CurveTableName, *FString::Join(PathVariations, TEXT(", ")));
+    return nullptr;
+}
+
+bool FDataTableService::QueryCurveTableRows(const UCurveTable* CurveTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    if (!CurveTable)
+    {
+        OutError = TEXT("CurveTable is null");
+        return false;
+    }
+
+    if (!Query.IsValid(OutError))
+    {
+        return false;
+    }
+    if (Query.Fields.Num() > 0 || Query.Filters.Num() > 0)
+    {
+        OutError = TEXT("Fields and filters do not apply to CurveTable rows");
+        return false;
+    }
+
+    const ECurveTableMode Mode = CurveTable->GetCurveTableMode();
+    const TMap<FName, FRealCurve*>& RowMap = CurveTable->GetRowMap();
+
+    TArray<TSharedPtr<FJsonValue>> RowsArray;
+    int32 MatchedCount = 0;
+    auto VisitRow = [&](const FName& RowName, const FRealCurve* Curve)
+    {
+        const int32 MatchIndex = MatchedCount++;
+        if (!Curve || MatchIndex < Query.Offset || (Query.Limit > 0 && RowsArray.Num() >= Query.Limit))
+        {
+            return;
+        }
+        RowsArray.Add(MakeShared<FJsonValueObject>(CurveRowToJson(RowName, *Curve, Mode)));
+    };
+
+    if (Query.RowNames.Num() > 0)
+    {
+        for (const FString& RowName : Query.RowNames)
+        {
+            const FName Name(*RowName);
+            if (FRealCurve* const* Curve = RowMap.Find(Name))
+            {
+                VisitRow(Name, *Curve);
+            }
+        }
+    }
+    else
+    {
+        for (const TPair<FName, FRealCurve*>& RowPair : RowMap)
+        {
+            VisitRow(RowPair.Key, RowPair.Value);
+        }
+    }
+
+    const int32 NextOffset = Query.Offset + RowsArray.Num();
+    const bool bHasMore = NextOffset < MatchedCount;
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetStringField(TEXT("curve_table_mode"), CurveTableModeToString(Mode));
+    OutResult->SetArrayField(TEXT("rows"), RowsArray);
+    OutResult->SetNumberField(TEXT("total_rows"), RowMap.Num());
+    OutResult->SetNumberField(TEXT("matched_count"), MatchedCount);
+    OutResult->SetNumberField(TEXT("offset"), Query.Offset);
+    OutResult->SetNumberField(TEXT("returned_count"), RowsArray.Num());
+    OutResult->SetBoolField(TEXT("has_more"), bHasMore);
+    if (bHasMore)
+    {
+        OutResult->SetNumberField(TEXT("next_offset"), NextOffset);
+    }
+    return true;
+}
+
+bool FDataTableService::WriteCurveTableRows(UCurveTable* CurveTable, const TArray<FCurveTableRowParams>& Rows, FDataTableUpsertResult& OutResult)
+{
+    OutResult = FDataTableUpsertResult();
+
+    if (!CurveTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: CurveTable is null"));
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // The table is only marked modified once a row is actually written
+    bool bModified = false;
+    auto ModifyOnce = [CurveTable, &bModified]()
+    {
+        if (!bModified)
+        {
+            CurveTable->Modify(true);
+            bModified = true;
+        }
+    };
+
+    TArray<TPair<float, float>> Keys;
+    for (const FCurveTableRowParams& Row : Rows)
+    {
+        FString RowError;
+        if (!Row.IsValid(RowError))
+        {
+            OutResult.FailedRows.Add(FString::Printf(TEXT("%s: %s"), *Row.RowName, *RowError));
+            continue;
+        }
+        SortKeys(Row, Keys);
+
+        const FName RowName(*Row.RowName);
+        const ECurveTableMode Mode = CurveTable->GetCurveTableMode();
+        if (FRealCurve* ExistingCurve = CurveTable->GetRowMap().FindRef(RowName))
+        {
+            const ERichCurveInterpMode InterpMode = ResolveInterpMode(ExistingCurve, Mode, Row.InterpMode);
+            if (CurveMatches(*ExistingCurve, Mode, Keys, InterpMode))
+            {
+                OutResult.UnchangedRows.Add(Row.RowName);
+                continue;
+            }
+            ModifyOnce();
+            WriteCurveKeys(*ExistingCurve, Mode, Keys, InterpMode);
+            OutResult.UpdatedRows.Add(Row.RowName);
+            OutResult.ChangedFieldCount += Keys.Num();
+            continue;
+        }
+
+        // A new row takes the table's curve kind; an empty table gets simple curves, as CSV imports do
+        ModifyOnce();
+        FRealCurve* NewCurve = Mode == ECurveTableMode::RichCurves
+            ? static_cast<FRealCurve*>(&CurveTable->AddRichCurve(RowName))
+            : static_cast<FRealCurve*>(&CurveTable->AddSimpleCurve(RowName));
+        WriteCurveKeys(*NewCurve, CurveTable->GetCurveTableMode(), Keys, ResolveInterpMode(nullptr, Mode, Row.InterpMode));
+        OutResult.AddedRows.Add(Row.RowName);
+        OutResult.ChangedFieldCount += Keys.Num();
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Wrote %d rows to CurveTable '%s': %d added, %d updated, %d unchanged, %d failed in %.3f s"),
+        Rows.Num(), *CurveTable->GetName(), OutResult.AddedRows.Num(), OutResult.UpdatedRows.Num(),
+        OutResult.UnchangedRows.Num(), OutResult.FailedRows.Num(), FPlatformTime::Seconds() - StartTime);
+
+    if (bModified)
+    {
+        FinishCurveTableWrite(CurveTable);
+        return true;
+    }
+    return false;
+}
+
+void FDataTableService::FinishCurveTableWrite(UCurveTable* CurveTable)
+{
+    // One change notification for the whole batch instead of one per row
+    CurveTable->OnCurveTableChanged().Broadcast();
+    CurveTable->PostEditChange();
+    CurveTable->MarkPackageDirty();
+
+    if (!FMCPSaveQueue::Get().SaveOrEnqueue(CurveTable))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Failed to save CurveTable '%s'"), *CurveTable->GetPathName());
+    }
+    UEditorAssetLibrary::SyncBrowserToObjects({ CurveTable->GetPathName() });
+}
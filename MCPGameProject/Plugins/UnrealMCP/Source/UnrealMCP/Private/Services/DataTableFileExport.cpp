@@ -0,0 +1,312 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableStructNameCache.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** Identifies a packed column file; the last two characters are the format version */
+    constexpr ANSICHAR ColumnFileMagic[8] = { 'M', 'C', 'P', 'C', 'O', 'L', '0', '1' };
+
+    /** Column data starts at a multiple of this, so numeric columns can be mapped in place */
+    constexpr int64 ColumnAlignment = 8;
+
+    /** Type code of a column, as written to the file */
+    enum class EColumnType : uint8
+    {
+        Int8 = 1,
+        Int16,
+        Int32,
+        Int64,
+        UInt8,
+        UInt16,
+        UInt32,
+        UInt64,
+        Float,
+        Double,
+        Bool,
+        String
+    };
+
+    const TCHAR* GetColumnTypeName(EColumnType Type)
+    {
+        switch (Type)
+        {
+        case EColumnType::Int8:   return TEXT("int8");
+        case EColumnType::Int16:  return TEXT("int16");
+        case EColumnType::Int32:  return TEXT("int32");
+        case EColumnType::Int64:  return TEXT("int64");
+        case EColumnType::UInt8:  return TEXT("uint8");
+        case EColumnType::UInt16: return TEXT("uint16");
+        case EColumnType::UInt32: return TEXT("uint32");
+        case EColumnType::UInt64: return TEXT("uint64");
+        case EColumnType::Float:  return TEXT("float");
+        case EColumnType::Double: return TEXT("double");
+        case EColumnType::Bool:   return TEXT("bool");
+        default:                  return TEXT("string");
+        }
+    }
+
+    /** Column type of a field; enums, containers, structs and static arrays are stored as text */
+    EColumnType GetColumnType(const FProperty* Property)
+    {
+        if (Property->ArrayDim != 1)
+        {
+            return EColumnType::String;
+        }
+        if (Property->IsA<FBoolProperty>())
+        {
+            return EColumnType::Bool;
+        }
+        if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+        {
+            return ByteProperty->Enum ? EColumnType::String : EColumnType::UInt8;
+        }
+        if (Property->IsA<FInt8Property>())   { return EColumnType::Int8; }
+        if (Property->IsA<FInt16Property>())  { return EColumnType::Int16; }
+        if (Property->IsA<FIntProperty>())    { return EColumnType::Int32; }
+        if (Property->IsA<FInt64Property>())  { return EColumnType::Int64; }
+        if (Property->IsA<FUInt16Property>()) { return EColumnType::UInt16; }
+        if (Property->IsA<FUInt32Property>()) { return EColumnType::UInt32; }
+        if (Property->IsA<FUInt64Property>()) { return EColumnType::UInt64; }
+        if (Property->IsA<FFloatProperty>())  { return EColumnType::Float; }
+        if (Property->IsA<FDoubleProperty>()) { return EColumnType::Double; }
+        return EColumnType::String;
+    }
+
+    /** Text a string column stores for a field: the value of strings, names and texts, the name of enums, property text otherwise */
+    FString GetFieldText(const FProperty* Property, const uint8* RowPtr)
+    {
+        const void* ValuePtr = Property->ContainerPtrToValuePtr<void>(RowPtr);
+        if (Property->ArrayDim == 1)
+        {
+            if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+            {
+                return StrProperty->GetPropertyValue(ValuePtr);
+            }
+            if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+            {
+                return NameProperty->GetPropertyValue(ValuePtr).ToString();
+            }
+            if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+            {
+                return TextProperty->GetPropertyValue(ValuePtr).ToString();
+            }
+            if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+            {
+                return EnumProperty->GetEnum()->GetNameStringByValue(EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr));
+            }
+            if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+            {
+                return ByteProperty->Enum->GetNameStringByValue(ByteProperty->GetPropertyValue(ValuePtr));
+            }
+        }
+
+        FString Text;
+        Property->ExportText_InContainer(0, Text, RowPtr, nullptr, nullptr, PPF_None);
+        return Text;
+    }
+
+    /** Offsets of each row's text followed by the UTF-8 text of every row */
+    struct FStringColumn
+    {
+        TArray<uint32> Offsets;
+        TArray<uint8> Bytes;
+
+        void Add(const FString& Text)
+        {
+            const FTCHARToUTF8 Utf8(*Text);
+            Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            Offsets.Add(static_cast<uint32>(Bytes.Num()));
+        }
+
+        int64 GetDataSize() const
+        {
+            return Offsets.Num() * static_cast<int64>(sizeof(uint32)) + Bytes.Num();
+        }
+    };
+
+    /** Name, type and size of a column, then padding up to the aligned start of its data */
+    void WriteColumnHeader(FArchive& Archive, const FString& Name, EColumnType Type, int64 DataSize)
+    {
+        const FTCHARToUTF8 Utf8Name(*Name);
+        uint32 NameLength = static_cast<uint32>(Utf8Name.Length());
+        Archive << NameLength;
+        Archive.Serialize(const_cast<void*>(static_cast<const void*>(Utf8Name.Get())), NameLength);
+
+        uint8 TypeCode = static_cast<uint8>(Type);
+        Archive << TypeCode;
+        Archive << DataSize;
+
+        static const uint8 Padding[ColumnAlignment] = {};
+        const int64 Misalignment = Archive.Tell() % ColumnAlignment;
+        if (Misalignment != 0)
+        {
+            Archive.Serialize(const_cast<uint8*>(Padding), ColumnAlignment - Misalignment);
+        }
+    }
+
+    void WriteStringColumn(FArchive& Archive, const FString& Name, FStringColumn& Column)
+    {
+        WriteColumnHeader(Archive, Name, EColumnType::String, Column.GetDataSize());
+        Archive.Serialize(Column.Offsets.GetData(), Column.Offsets.Num() * sizeof(uint32));
+        Archive.Serialize(Column.Bytes.GetData(), Column.Bytes.Num());
+    }
+}
+
+bool FDataTableService::ExportDataTableToFile(const UDataTable* DataTable, const FDataTableFileExportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+
+    const UScriptStruct* RowStruct = DataTable ? DataTable->GetRowStruct() : nullptr;
+    if (!RowStruct)
+    {
+        OutError = TEXT("DataTable is null or has no row struct");
+        return false;
+    }
+
+    // Columns in struct order, or in the order asked for
+    TArray<const FProperty*> Fields;
+    if (Params.Fields.Num() > 0)
+    {
+        const TSharedRef<const FDataTableStructNameCache::FStructNames> Names = FDataTableStructNameCache::Get().GetNames(RowStruct);
+        for (const FString& FieldName : Params.Fields)
+        {
+            FProperty* const* Property = Names->PropertiesByFieldName.Find(FieldName);
+            if (!Property)
+            {
+                OutError = FString::Printf(TEXT("Unknown field '%s' in row struct '%s'"), *FieldName, *RowStruct->GetName());
+                return false;
+            }
+            Fields.AddUnique(*Property);
+        }
+    }
+    else
+    {
+        for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+        {
+            Fields.Add(*PropIt);
+        }
+    }
+
+    const FString FilePath = FPaths::IsRelative(Params.FilePath)
+        ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Params.FilePath)
+        : Params.FilePath;
+
+    TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileWriter(*FilePath));
+    if (!Archive)
+    {
+        OutError = FString::Printf(TEXT("Could not create file '%s'"), *FilePath);
+        return false;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // The row map is walked once; columns then read the rows in that order
+    const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+    TArray<const uint8*> Rows;
+    Rows.Reserve(RowMap.Num());
+    FStringColumn RowNameColumn;
+    RowNameColumn.Offsets.Reserve(RowMap.Num() + 1);
+    RowNameColumn.Offsets.Add(0);
+    for (const TPair<FName, uint8*>& RowPair : RowMap)
+    {
+        Rows.Add(RowPair.Value);
+        RowNameColumn.Add(RowPair.Key.ToString());
+    }
+
+    Archive->Serialize(const_cast<ANSICHAR*>(ColumnFileMagic), sizeof(ColumnFileMagic));
+    uint32 ColumnCount = static_cast<uint32>(Fields.Num() + 1);
+    uint64 RowCount = static_cast<uint64>(Rows.Num());
+    *Archive << ColumnCount;
+    *Archive << RowCount;
+
+    TArray<TSharedPtr<FJsonValue>> ColumnsArray;
+    auto AddColumnToReport = [&ColumnsArray](const FString& Name, EColumnType Type)
+    {
+        TSharedPtr<FJsonObject> ColumnObj = MakeShared<FJsonObject>();
+        ColumnObj->SetStringField(TEXT("name"), Name);
+        ColumnObj->SetStringField(TEXT("type"), GetColumnTypeName(Type));
+        ColumnsArray.Add(MakeShared<FJsonValueObject>(ColumnObj));
+    };
+
+    WriteStringColumn(*Archive, TEXT("row_name"), RowNameColumn);
+    AddColumnToReport(TEXT("row_name"), EColumnType::String);
+
+    FScopedSlowTask SlowTask(static_cast<float>(Fields.Num()), FText::FromString(FString::Printf(TEXT("Exporting %s"), *DataTable->GetName())));
+    for (const FProperty* Property : Fields)
+    {
+        SlowTask.EnterProgressFrame();
+
+        // Named as get_datatable_rows names the field
+        const FString ColumnName = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+        const EColumnType Type = GetColumnType(Property);
+        AddColumnToReport(ColumnName, Type);
+
+        if (Type == EColumnType::String)
+        {
+            FStringColumn Column;
+            Column.Offsets.Reserve(Rows.Num() + 1);
+            Column.Offsets.Add(0);
+            for (const uint8* RowPtr : Rows)
+            {
+                Column.Add(GetFieldText(Property, RowPtr));
+            }
+            WriteStringColumn(*Archive, ColumnName, Column);
+        }
+        else if (Type == EColumnType::Bool)
+        {
+            const FBoolProperty* BoolProperty = CastFieldChecked<FBoolProperty>(Property);
+            WriteColumnHeader(*Archive, ColumnName, Type, Rows.Num());
+            for (const uint8* RowPtr : Rows)
+            {
+                // Bitfield bools share a byte with other fields, so each is written as 0 or 1
+                uint8 Value = BoolProperty->GetPropertyValue(BoolProperty->ContainerPtrToValuePtr<void>(RowPtr)) ? 1 : 0;
+                *Archive << Value;
+            }
+        }
+        else
+        {
+            // Numeric values go from the row memory into the writer's buffer without a copy in between
+            const int32 ElementSize = Property->GetElementSize();
+            WriteColumnHeader(*Archive, ColumnName, Type, static_cast<int64>(ElementSize) * Rows.Num());
+            for (const uint8* RowPtr : Rows)
+            {
+                Archive->Serialize(const_cast<void*>(Property->ContainerPtrToValuePtr<void>(RowPtr)), ElementSize);
+            }
+        }
+    }
+
+    const int64 FileSize = Archive->Tell();
+    const bool bWritten = !Archive->IsError() && Archive->Close();
+    Archive.Reset();
+    if (!bWritten)
+    {
+        IFileManager::Get().Delete(*FilePath);
+        OutError = FString::Printf(TEXT("Could not write file '%s'"), *FilePath);
+        return false;
+    }
+
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogTemp, Log, TEXT("MCP DataTable: Exported %d rows and %d columns of '%s' to '%s' (%lld bytes) in %.2fs"),
+        Rows.Num(), ColumnCount, *DataTable->GetName(), *FilePath, FileSize, ElapsedSeconds);
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("file_path"), FilePath);
+    OutReport->SetStringField(TEXT("format"), TEXT("mcpcol"));
+    OutReport->SetNumberField(TEXT("row_count"), Rows.Num());
+    OutReport->SetNumberField(TEXT("column_count"), ColumnCount);
+    OutReport->SetArrayField(TEXT("columns"), ColumnsArray);
+    OutReport->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+    OutReport->SetNumberField(TEXT("elapsed_seconds"), ElapsedSeconds);
+    return true;
+}
@@ -0,0 +1,403 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableRowImporter.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Bytes read from the file at a time */
+    constexpr int64 ImportChunkSize = 256 * 1024;
+
+    /** Longest record accepted, so a file without line breaks cannot grow the buffer without bound */
+    constexpr int32 MaxRecordBytes = 16 * 1024 * 1024;
+
+    /** Records between progress updates */
+    constexpr int32 ProgressInterval = 10000;
+
+    /**
+     * Splits a file into records, one chunk in memory at a time
+     * A record ends at a line break; with CSV quoting, line breaks inside quoted cells do not end it.
+     */
+    class FRecordReader
+    {
+    public:
+        FRecordReader(FArchive& InArchive, bool bInCsvQuoting)
+            : Archive(InArchive)
+            , bCsvQuoting(bInCsvQuoting)
+        {
+        }
+
+        /**
+         * Read the next record
+         * @param OutRecord Receives the record without its line break
+         * @param OutLine Receives the line the record starts on, from 1
+         * @return false at the end of the file or on an error, see GetError
+         */
+        bool ReadRecord(FString& OutRecord, int32& OutLine)
+        {
+            RecordBytes.Reset();
+            bool bInQuotes = false;
+            OutLine = Line;
+
+            while (true)
+            {
+                if (ChunkPos >= Chunk.Num() && !ReadChunk())
+                {
+                    // The last record may end without a line break
+                    if (RecordBytes.Num() == 0)
+                    {
+                        return false;
+                    }
+                    break;
+                }
+
+                // Quotes and line breaks are single bytes in UTF-8, so records split without decoding
+                const uint8 Byte = Chunk[ChunkPos++];
+                if (Byte == '\n')
+                {
+                    Line++;
+                    if (!bInQuotes)
+                    {
+                        break;
+                    }
+                }
+                else if (Byte == '"' && bCsvQuoting)
+                {
+                    bInQuotes = !bInQuotes;
+                }
+
+                if (RecordBytes.Num() >= MaxRecordBytes)
+                {
+                    Error = FString::Printf(TEXT("Record at line %d is longer than %d bytes"), OutLine, MaxRecordBytes);
+                    return false;
+                }
+                RecordBytes.Add(Byte);
+            }
+
+            int32 Length = RecordBytes.Num();
+            if (Length > 0 && RecordBytes[Length - 1] == '\r')
+            {
+                Length--;
+            }
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(RecordBytes.GetData()), Length);
+            OutRecord = FString::ConstructFromPtrSize(Converted.Get(), Converted.Length());
+            return true;
+        }
+
+        int64 GetBytesRead() const { return Archive.Tell(); }
+        const FString& GetError() const { return Error; }
+
+    private:
+        bool ReadChunk()
+        {
+            const int64 Remaining = Archive.TotalSize() - Archive.Tell();
+            if (Remaining <= 0 || Archive.IsError())
+            {
+                return false;
+            }
+
+            const bool bFirstChunk = Archive.Tell() == 0;
+            Chunk.SetNumUninitialized(static_cast<int32>(FMath::Min(Remaining, ImportChunkSize)), EAllowShrinking::No);
+            Archive.Serialize(Chunk.GetData(), Chunk.Num());
+            ChunkPos = 0;
+
+            // Skip a UTF-8 byte order mark
+            if (bFirstChunk && Chunk.Num() >= 3 && Chunk[0] == 0xEF && Chunk[1] == 0xBB && Chunk[2] == 0xBF)
+            {
+                ChunkPos = 3;
+            }
+            return !Archive.IsError();
+        }
+
+        FArchive& Archive;
+        bool bCsvQuoting = false;
+        TArray<uint8> Chunk;
+        int32 ChunkPos = 0;
+        TArray<uint8> RecordBytes;
+        int32 Line = 1;
+        FString Error;
+    };
+
+    /** Split a CSV record into cells, unquoting quoted cells */
+    void SplitCsvRecord(const FString& Record, TArray<FString>& OutCells)
+    {
+        OutCells.Reset();
+        FString Cell;
+        bool bInQuotes = false;
+
+        for (int32 Index = 0; Index < Record.Len(); ++Index)
+        {
+            const TCHAR Char = Record[Index];
+            if (bInQuotes)
+            {
+                if (Char == TEXT('"'))
+                {
+                    // A doubled quote is a literal quote
+                    if (Index + 1 < Record.Len() && Record[Index + 1] == TEXT('"'))
+                    {
+                        Cell.AppendChar(TEXT('"'));
+                        Index++;
+                    }
+                    else
+                    {
+                        bInQuotes = false;
+                    }
+                }
+                else
+                {
+                    Cell.AppendChar(Char);
+                }
+            }
+            else if (Char == TEXT('"'))
+            {
+                bInQuotes = true;
+            }
+            else if (Char == TEXT(','))
+            {
+                OutCells.Add(MoveTemp(Cell));
+                Cell.Reset();
+            }
+            else
+            {
+                Cell.AppendChar(Char);
+            }
+        }
+        OutCells.Add(MoveTemp(Cell));
+    }
+
+    bool IsRowNameColumn(const FString& Column)
+    {
+        return Column == TEXT("---") || Column.Equals(TEXT("Name"), ESearchCase::IgnoreCase) || Column.Equals(TEXT("row_name"), ESearchCase::IgnoreCase);
+    }
+}
+
+bool FDataTableService::ImportRowsFromFile(UDataTable* DataTable, const FDataTableFileImportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable ? DataTable->GetRowStruct() : nullptr;
+    if (!RowStruct)
+    {
+        OutError = TEXT("DataTable is null or has no row struct");
+        return false;
+    }
+    
+    const FString FilePath = FPaths::IsRelative(Params.FilePath)
+        ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Params.FilePath)
+        : Params.FilePath;
+    
+    FString Format = Params.Format;
+    if (Format.IsEmpty())
+    {
+        const FString Extension = FPaths::GetExtension(FilePath).ToLower();
+        Format = (Extension == TEXT("jsonl") || Extension == TEXT("ndjson") || Extension == TEXT("json")) ? TEXT("jsonl") : TEXT("csv");
+    }
+    const bool bCsv = Format == TEXT("csv");
+    
+    TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*FilePath));
+    if (!Archive)
+    {
+        OutError = FString::Printf(TEXT("Could not open file '%s'"), *FilePath);
+        return false;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    const int64 FileSize = Archive->TotalSize();
+    FRecordReader Reader(*Archive, bCsv);
+    
+    const FDataTableRowImporter Importer(RowStruct);
+    const int32 StructureSize = RowStruct->GetStructureSize();
+    const int32 MinAlignment = RowStruct->GetMinAlignment();
+    
+    // CSV columns are resolved to fields once, from the header
+    TArray<int32> ColumnFields;
+    TArray<FString> ColumnNames;
+    int32 NameColumn = INDEX_NONE;
+    TArray<TSharedPtr<FJsonValue>> UnknownColumns;
+    TArray<FString> Cells;
+    
+    FString Record;
+    int32 Line = 0;
+    if (bCsv)
+    {
+        if (!Reader.ReadRecord(Record, Line))
+        {
+            OutError = Reader.GetError().IsEmpty() ? TEXT("CSV file has no header row") : Reader.GetError();
+            return false;
+        }
+        SplitCsvRecord(Record, Cells);
+        for (int32 Column = 0; Column < Cells.Num(); ++Column)
+        {
+            const FString ColumnName = Cells[Column].TrimStartAndEnd();
+            ColumnNames.Add(ColumnName);
+            if (NameColumn == INDEX_NONE && IsRowNameColumn(ColumnName))
+            {
+                NameColumn = Column;
+                ColumnFields.Add(INDEX_NONE);
+                continue;
+            }
+            const int32 Field = Importer.FindField(ColumnName);
+            if (Field == INDEX_NONE && !ColumnName.IsEmpty())
+            {
+                UnknownColumns.Add(MakeShared<FJsonValueString>(ColumnName));
+            }
+            ColumnFields.Add(Field);
+        }
+        if (NameColumn == INDEX_NONE)
+        {
+            // Like the editor's CSV import, the first column names the rows when no header says so
+            NameColumn = 0;
+            ColumnFields[0] = INDEX_NONE;
+        }
+    }
+    
+    DataTable->Modify(true);
+    TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
+    
+    int32 RecordCount = 0;
+    int32 ImportedCount = 0;
+    int32 FailedCount = 0;
+    TArray<TSharedPtr<FJsonValue>> Failures;
+    auto AddFailure = [&](int32 FailedLine, const FString& RowName, const FString& Reason)
+    {
+        FailedCount++;
+        if (Failures.Num() < Params.MaxReportedFailures)
+        {
+            TSharedPtr<FJsonObject> Failure = MakeShared<FJsonObject>();
+            Failure->SetNumberField(TEXT("line"), FailedLine);
+            Failure->SetStringField(TEXT("row_name"), RowName);
+            Failure->SetStringField(TEXT("error"), Reason);
+            Failures.Add(MakeShared<FJsonValueObject>(Failure));
+        }
+    };
+    
+    // The editor shows progress by bytes read; the log gets a line every ProgressInterval records
+    FScopedSlowTask SlowTask(static_cast<float>(FileSize), FText::FromString(FString::Printf(TEXT("Importing rows into %s"), *DataTable->GetName())));
+    SlowTask.MakeDialogDelayed(1.0f);
+    int64 ReportedBytes = Reader.GetBytesRead();
+    
+    while (Reader.ReadRecord(Record, Line))
+    {
+        if (Record.TrimStartAndEnd().IsEmpty())
+        {
+            continue;
+        }
+        RecordCount++;
+        
+        FString RowName;
+        uint8* RowMemory = static_cast<uint8*>(FMemory::Malloc(StructureSize, MinAlignment));
+        RowStruct->InitializeStruct(RowMemory);
+        FString RowError;
+        bool bConverted = true;
+        
+        if (bCsv)
+        {
+            SplitCsvRecord(Record, Cells);
+            RowName = Cells.IsValidIndex(NameColumn) ? Cells[NameColumn].TrimStartAndEnd() : FString();
+            TArray<FString> FailedColumns;
+            for (int32 Column = 0; Column < Cells.Num() && Column < ColumnFields.Num(); ++Column)
+            {
+                // Empty cells keep the struct default
+                if (ColumnFields[Column] != INDEX_NONE && !Cells[Column].IsEmpty()
+                    && !Importer.ImportFieldText(ColumnFields[Column], Cells[Column], RowMemory))
+                {
+                    FailedColumns.Add(ColumnNames[Column]);
+                }
+            }
+            if (FailedColumns.Num() > 0)
+            {
+                bConverted = false;
+                RowError = FString::Printf(TEXT("failed to import column(s) %s"), *FString::Join(FailedColumns, TEXT(", ")));
+            }
+        }
+        else
+        {
+            TSharedPtr<FJsonObject> RecordObject;
+            TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Record);
+            if (!FJsonSerializer::Deserialize(JsonReader, RecordObject) || !RecordObject.IsValid())
+            {
+                bConverted = false;
+                RowError = TEXT("line is not a JSON object");
+            }
+            else
+            {
+                if (!RecordObject->TryGetStringField(TEXT("row_name"), RowName))
+                {
+                    RecordObject->TryGetStringField(TEXT("Name"), RowName);
+                }
+                const TSharedPtr<FJsonObject>* RowData = nullptr;
+                bConverted = Importer.ConvertRow(RecordObject->TryGetObjectField(TEXT("row_data"), RowData) ? **RowData : *RecordObject, RowMemory, RowError);
+            }
+        }
+        
+        if (bConverted && RowName.IsEmpty())
+        {
+            bConverted = false;
+            RowError = TEXT("row has no name");
+        }
+        
+        if (bConverted)
+        {
+            HandOverImportedRow(RowMap, RowStruct, FName(*RowName), RowMemory);
+            ImportedCount++;
+        }
+        else
+        {
+            RowStruct->DestroyStruct(RowMemory);
+            FMemory::Free(RowMemory);
+            AddFailure(Line, RowName, RowError);
+        }
+        
+        if (RecordCount % ProgressInterval == 0)
+        {
+            const int64 BytesRead = Reader.GetBytesRead();
+            SlowTask.EnterProgressFrame(static_cast<float>(BytesRead - ReportedBytes));
+            ReportedBytes = BytesRead;
+            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Importing '%s': %d records, %lld of %lld bytes"),
+                *FilePath, RecordCount, BytesRead, FileSize);
+        }
+    }
+    
+    const FString ReadError = Reader.GetError();
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Imported '%s' into '%s': %d records, %d imported, %d failed in %.3f s"),
+        *FilePath, *DataTable->GetName(), RecordCount, ImportedCount, FailedCount, ElapsedSeconds);
+    
+    if (ImportedCount > 0)
+    {
+        FinishBulkImport(DataTable);
+    }
+    
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("file_path"), FilePath);
+    OutReport->SetStringField(TEXT("format"), Format);
+    OutReport->SetNumberField(TEXT("file_size"), static_cast<double>(FileSize));
+    OutReport->SetNumberField(TEXT("bytes_read"), static_cast<double>(Reader.GetBytesRead()));
+    OutReport->SetNumberField(TEXT("records_read"), RecordCount);
+    OutReport->SetNumberField(TEXT("imported_count"), ImportedCount);
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("failures"), Failures);
+    OutReport->SetBoolField(TEXT("failures_truncated"), FailedCount > Failures.Num());
+    if (bCsv)
+    {
+        OutReport->SetArrayField(TEXT("unknown_columns"), UnknownColumns);
+    }
+    OutReport->SetNumberField(TEXT("elapsed_seconds"), ElapsedSeconds);
+    
+    if (!ReadError.IsEmpty())
+    {
+        // Rows before the error are kept; the report says how far the import got
+        OutError = ReadError;
+        OutReport->SetStringField(TEXT("error"), ReadError);
+        return false;
+    }
+    
+    return true;
+}
@@ -0,0 +1,189 @@
+#include "Services/DataTableFingerprintIndex.h"
+#include "Editor.h"
+#include "Engine/DataTable.h"
+#include "Hash/xxhash.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/UObjectGlobals.h"
+#include "MCPMemory.h"
+
+FDataTableFingerprintIndex& FDataTableFingerprintIndex::Get()
+{
+    static FDataTableFingerprintIndex Instance;
+    return Instance;
+}
+
+void FDataTableFingerprintIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FDataTableFingerprintIndex::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FDataTableFingerprintIndex::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FDataTableFingerprintIndex::HandleUndoRedo);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("datatable_fingerprint_index"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(Fingerprints.Num()); });
+}
+
+void FDataTableFingerprintIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("datatable_fingerprint_index"));
+
+    Fingerprints.Empty();
+}
+
+TSharedRef<const FDataTableFingerprintIndex::FFingerprint> FDataTableFingerprintIndex::GetFingerprint(const UDataTable* DataTable, bool& bOutWasCached)
+{
+    check(IsInGameThread());
+    bOutWasCached = false;
+
+    // Without the change listeners a kept fingerprint could go stale unnoticed
+    if (!bInitialized || !DataTable)
+    {
+        return Build(DataTable);
+    }
+
+    if (const TSharedRef<const FFingerprint>* Fingerprint = Fingerprints.Find(DataTable))
+    {
+        // A row map or row struct of another size changed without a Modify
+        const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+        if ((*Fingerprint)->RowHashes.Num() == DataTable->GetRowMap().Num()
+            && (*Fingerprint)->StructureSize == (RowStruct ? RowStruct->GetStructureSize() : 0))
+        {
+            bOutWasCached = true;
+            CacheCounters.RecordHit();
+            return *Fingerprint;
+        }
+    }
+
+    // Fingerprints of tables that were garbage collected are dropped before a new one is added
+    for (auto It = Fingerprints.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    CacheCounters.RecordMiss();
+    TSharedRef<const FFingerprint> Fingerprint = Build(DataTable);
+    Fingerprints.Add(DataTable, Fingerprint);
+    return Fingerprint;
+}
+
+void FDataTableFingerprintIndex::Invalidate(const UDataTable* DataTable)
+{
+    if (DataTable && IsInGameThread() && Fingerprints.Remove(DataTable) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+FString FDataTableFingerprintIndex::HashToString(uint64 Hash)
+{
+    return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+TSharedRef<const FDataTableFingerprintIndex::FFingerprint> FDataTableFingerprintIndex::Build(const UDataTable* DataTable)
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    TSharedRef<FFingerprint> Fingerprint = MakeShared<FFingerprint>();
+    const UScriptStruct* RowStruct = DataTable ? DataTable->GetRowStruct() : nullptr;
+    if (!RowStruct)
+    {
+        return Fingerprint;
+    }
+
+    Fingerprint->StructureSize = RowStruct->GetStructureSize();
+    const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+    Fingerprint->RowHashes.Reserve(RowMap.Num());
+    TArray<uint8> Scratch;
+    for (const TPair<FName, uint8*>& RowPair : RowMap)
+    {
+        Fingerprint->RowHashes.Emplace(RowPair.Key, HashRow(RowStruct, RowPair.Key, RowPair.Value, Scratch));
+    }
+
+    // Pairs of hashes are hashed into the level above; an odd hash out moves up as it is
+    TArray<uint64> Level;
+    Level.Reserve(Fingerprint->RowHashes.Num());
+    for (const TPair<FName, uint64>& RowHash : Fingerprint->RowHashes)
+    {
+        Level.Add(RowHash.Value);
+    }
+    while (Level.Num() > 1)
+    {
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < Level.Num(); ReadIndex += 2)
+        {
+            if (ReadIndex + 1 < Level.Num())
+            {
+                const uint64 Pair[2] = { Level[ReadIndex], Level[ReadIndex + 1] };
+                Level[WriteIndex++] = FXxHash64::HashBuffer(Pair, sizeof(Pair)).Hash;
+            }
+            else
+            {
+                Level[WriteIndex++] = Level[ReadIndex];
+            }
+        }
+        Level.SetNum(WriteIndex, EAllowShrinking::No);
+    }
+
+    // The struct is part of the root, so an empty table or a reparented one fingerprints apart
+    const FString StructPath = RowStruct->GetPathName();
+    const uint64 Root[2] = { Level.Num() > 0 ? Level[0] : 0, FXxHash64::HashBuffer(*StructPath, StructPath.Len() * sizeof(TCHAR)).Hash };
+    Fingerprint->RootHash = FXxHash64::HashBuffer(Root, sizeof(Root)).Hash;
+    return Fingerprint;
+}
+
+uint64 FDataTableFingerprintIndex::HashRow(const UScriptStruct* RowStruct, const FName& RowName, uint8* RowPtr, TArray<uint8>& Scratch)
+{
+    Scratch.Reset();
+    FMemoryWriter Writer(Scratch);
+    FObjectAndNameAsStringProxyArchive Archive(Writer, false);
+
+    FString NameString = RowName.ToString();
+    Archive << NameString;
+    const_cast<UScriptStruct*>(RowStruct)->SerializeItem(Archive, RowPtr, nullptr);
+
+    return FXxHash64::HashBuffer(Scratch.GetData(), Scratch.Num()).Hash;
+}
+
+void FDataTableFingerprintIndex::HandleObjectModified(UObject* Object)
+{
+    if (const UDataTable* DataTable = Cast<UDataTable>(Object))
+    {
+        Invalidate(DataTable);
+    }
+}
+
+void FDataTableFingerprintIndex::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    if (const UDataTable* DataTable = Cast<UDataTable>(Object))
+    {
+        Invalidate(DataTable);
+    }
+}
+
+void FDataTableFingerprintIndex::HandleUndoRedo()
+{
+    Fingerprints.Empty();
+    CacheCounters.RecordInvalidation();
+}
@@ -0,0 +1,357 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableTransformationService.h"
+#include "Engine/DataTable.h"
+#include "JsonObjectConverter.h"
+#include "ScopedTransaction.h"
+
+bool FDataTableService::AddRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows)
+{
+    if (!DataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    if (!RowStruct)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to get row struct from DataTable"));
+        return false;
+    }
+    
+        OutAddedRows.Empty();
+    OutFailedRows.Empty();
+    
+    for (const FDataTableRowParams& RowParams : Rows)
+    {
+        FString ValidationError;
+        if (!RowParams.IsValid(DataTable, ValidationError))
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
+            continue;
+        }
+        
+        // Check if we have GUID fields that need transformation BEFORE validation (to avoid auto-fill contamination)
+        bool bHasGuidFields = false;
+        for (const auto& Field : RowParams.RowData->Values)
+        {
+            bool bIsGuid = FDataTableTransformationService::IsGuidField(Field.Key);
+            UE_LOG(LogTemp, Warning, TEXT("Field '%s' is GUID: %s"), *Field.Key, bIsGuid ? TEXT("YES") : TEXT("NO"));
+            if (bIsGuid)
+            {
+                bHasGuidFields = true;
+                break;
+            }
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("Has GUID fields: %s"), bHasGuidFields ? TEXT("YES") : TEXT("NO"));
+        
+        // Transform GUID field names to friendly names before validation and JsonObjectToUStruct
+        TSharedPtr<FJsonObject> StructJson = RowParams.RowData;
+        if (bHasGuidFields)
+        {
+            StructJson = FDataTableTransformationService::AutoTransformFromGuidNames(RowParams.RowData, RowStruct);
+        }
+        
+        // Validate row data (after potential transformation)
+        if (!ValidateRowData(DataTable, StructJson, ValidationError))
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
+            continue;
+        }
+        
+        // Allocate memory for the new row
+        uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
+        RowStruct->InitializeStruct(RowMemory);
+        FTableRowBase* NewRow = reinterpret_cast<FTableRowBase*>(RowMemory);
+        
+        TSharedRef<FJsonObject> JsonRef = StructJson.ToSharedRef();
+        
+        // DEBUG: Log the JSON structure before conversion
+        FString JsonString;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+        FJsonSerializer::Serialize(JsonRef, Writer);
+        UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JSON before conversion: %s"), *JsonString);
+        
+        // Log each field in JsonRef->Values
+        for (const auto& Pair : JsonRef->Values)
+        {
+            FString ValueType = TEXT("Unknown");
+            if (Pair.Value->Type == EJson::String) ValueType = TEXT("String");
+            else if (Pair.Value->Type == EJson::Number) ValueType = TEXT("Number");
+            else if (Pair.Value->Type == EJson::Boolean) ValueType = TEXT("Boolean");
+            else if (Pair.Value->Type == EJson::Array) ValueType = TEXT("Array");
+            else if (Pair.Value->Type == EJson::Object) ValueType = TEXT("Object");
+            
+            UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JSON field '%s' = Type: %s"), *Pair.Key, *ValueType);
+            
+            if (Pair.Value->Type == EJson::Array)
+            {
+                const TArray<TSharedPtr<FJsonValue>>* ArrayPtr = nullptr;
+                if (Pair.Value->TryGetArray(ArrayPtr) && ArrayPtr)
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: Array field '%s' has %d elements"), *Pair.Key, ArrayPtr->Num());
+                }
+            }
+        }
+        
+        // UE 5.7 proper fix: Use JsonAttributesToUStruct for struct array support
+        bool bJsonConverted = FJsonObjectConverter::JsonAttributesToUStruct(JsonRef->Values, RowStruct, RowMemory);
+        
+        UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JsonAttributesToUStruct result: %s"), bJsonConverted ? TEXT("SUCCESS") : TEXT("FAILED"));
+        
+        if (!bJsonConverted)
+        {
+            RowStruct->DestroyStruct(RowMemory);
+            FMemory::Free(RowMemory);
+            OutFailedRows.Add(FString::Printf(TEXT("%s: failed to convert JSON to UStruct"), *RowParams.RowName));
+            continue;
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: JsonObjectToUStruct SUCCESS - Adding row '%s' to DataTable"), *RowParams.RowName);
+        DataTable->AddRow(FName(*RowParams.RowName), *NewRow);
+        UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' successfully added to DataTable"), *RowParams.RowName);
+        
+        RowStruct->DestroyStruct(RowMemory);
+        FMemory::Free(RowMemory);
+        
+        OutAddedRows.Add(RowParams.RowName);
+    }
+    
+    if (OutAddedRows.Num() > 0)
+    {
+        // Mark dirty and refresh
+        DataTable->Modify(true);
+        DataTable->PostEditChange();
+        DataTable->MarkPackageDirty();
+        
+        SaveAndSyncDataTable(DataTable);
+        RefreshDataTableEditor(DataTable);
+        
+        return true;
+    }
+    
+    return false;
+}
+
+bool FDataTableService::UpdateRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutUpdatedRows, TArray<FString>& OutFailedRows)
+{
+    if (!DataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
+        return false;
+    }
+    
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    if (!RowStruct)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to get row struct from DataTable"));
+        return false;
+    }
+    
+    OutUpdatedRows.Empty();
+    OutFailedRows.Empty();
+    
+    for (const FDataTableRowParams& RowParams : Rows)
+    {
+        FString ValidationError;
+        if (!RowParams.IsValid(DataTable, ValidationError))
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
+            continue;
+        }
+        
+        // Check if row exists
+        if (!DataTable->GetRowMap().Contains(FName(*RowParams.RowName)))
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: row not found"), *RowParams.RowName));
+            continue;
+        }
+        
+        // Check if we have GUID fields that need transformation BEFORE validation (to avoid auto-fill contamination)
+        bool bHasGuidFields = false;
+        for (const auto& Field : RowParams.RowData->Values)
+        {
+            bool bIsGuid = FDataTableTransformationService::IsGuidField(Field.Key);
+            UE_LOG(LogTemp, Warning, TEXT("Field '%s' is GUID: %s"), *Field.Key, bIsGuid ? TEXT("YES") : TEXT("NO"));
+            if (bIsGuid)
+            {
+                bHasGuidFields = true;
+                break;
+            }
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("Has GUID fields: %s"), bHasGuidFields ? TEXT("YES") : TEXT("NO"));
+        
+        // Transform GUID field names to friendly names before validation and JsonObjectToUStruct
+        TSharedPtr<FJsonObject> StructJson = RowParams.RowData;
+        if (bHasGuidFields)
+        {
+            StructJson = FDataTableTransformationService::AutoTransformFromGuidNames(RowParams.RowData, RowStruct);
+        }
+        
+        // Validate row data (after potential transformation)
+        if (!ValidateRowData(DataTable, StructJson, ValidationError))
+        {
+            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
+            continue;
+        }
+        
+        // Allocate memory for the new row
+        uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
+        RowStruct->InitializeStruct(RowMemory);
+        FTableRowBase* NewRow = reinterpret_cast<FTableRowBase*>(RowMemory);
+        
+        TSharedRef<FJsonObject> JsonRef = StructJson.ToSharedRef();
+        
+        // UE 5.7 proper fix: Use JsonAttributesToUStruct for struct array support
+        bool bJsonConverted = FJsonObjectConverter::JsonAttributesToUStruct(JsonRef->Values, RowStruct, RowMemory);
+        
+        if (!bJsonConverted)
+        {
+            RowStruct->DestroyStruct(RowMemory);
+            FMemory::Free(RowMemory);
+            OutFailedRows.Add(FString::Printf(TEXT("%s: failed to convert JSON to UStruct"), *RowParams.RowName));
+            continue;
+        }
+        
+        // Use AddRow to update the row
+        DataTable->AddRow(FName(*RowParams.RowName), *NewRow);
+        
+        // Notify DataTable of the change
+        DataTable->HandleDataTableChanged(FName(*RowParams.RowName));
+        
+        RowStruct->DestroyStruct(RowMemory);
+        FMemory::Free(RowMemory);
+        
+        OutUpdatedRows.Add(RowParams.RowName);
+    }
+    
+    if (OutUpdatedRows.Num() > 0)
+    {
+        // Mark dirty and refresh
+        DataTable->Modify(true);
+        DataTable->PostEditChange();
+        DataTable->MarkPackageDirty();
+        
+        SaveAndSyncDataTable(DataTable);
+        RefreshDataTableEditor(DataTable);
+        
+        return true;
+    }
+    
+    return false;
+}
+
+bool FDataTableService::DeleteRowsFromDataTable(UDataTable* DataTable, const TArray<FString>& RowNames, TArray<FString>& OutDeletedRows, TArray<FString>& OutFailedRows)
+{
+    if (!DataTable)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
+        return false;
+    }
+    
+    // Check if DataTable is valid and has a row struct
+    if (!DataTable->GetRowStruct())
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable has no row struct"));
+        return false;
+    }
+    
+
+    
+    OutDeletedRows.Empty();
+    OutFailedRows.Empty();
+    
+    // First, validate all row names exist before attempting deletion
+    TArray<FName> ValidRowNames;
+    for (const FString& RowName : RowNames)
+    {
+        FName RowFName(*RowName);
+        if (DataTable->GetRowMap().Contains(RowFName))
+        {
+            ValidRowNames.Add(RowFName);
+        }
+        else
+        {
+            OutFailedRows.Add(RowName);
+            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' not found in DataTable"), *RowName);
+        }
+    }
+    
+    // Use direct row map manipulation to avoid UE 5.7 RemoveRow() crashes
+    for (const FName& RowFName : ValidRowNames)
+    {
+        try
+        {
+            // Mark the DataTable as modified before deletion
+            DataTable->Modify();
+            
+            // Get direct access to the row map
+            TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
+            
+            // Double-check the row exists before deletion
+            if (RowMap.Contains(RowFName))
+            {
+                // Create a scoped transaction for undo/redo support
+                FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Delete DataTable Row '%s'"), *RowFName.ToString())));
+                
+                // Mark as modified again within transaction
+                DataTable->Modify();
+                
+                // Get the row data pointer before removing
+                uint8* RowData = RowMap[RowFName];
+                
+                // Remove from the map first
+                RowMap.Remove(RowFName);
+                
+                // Free the memory if it exists and we have a valid struct
+                if (RowData && DataTable->GetRowStruct())
+                {
+                    // Properly destroy the struct data
+                    DataTable->GetRowStruct()->DestroyStruct(RowData);
+                    // Free the allocated memory
+                    FMemory::Free(RowData);
+                }
+                
+                OutDeletedRows.Add(RowFName.ToString());
+                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Successfully deleted row '%s'"), *RowFName.ToString());
+            }
+            else
+            {
+                OutFailedRows.Add(RowFName.ToString());
+                UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' not found during deletion"), *RowFName.ToString());
+            }
+        }
+        catch (const std::exception& e)
+        {
+            OutFailedRows.Add(RowFName.ToString());
+            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Exception while deleting row '%s': %s"), *RowFName.ToString(), *FString(e.what()));
+        }
+        catch (...)
+        {
+            OutFailedRows.Add(RowFName.ToString());
+            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Unknown exception while deleting row '%s'"), *RowFName.ToString());
+        }
+    }
+    
+    // Only save if we successfully deleted at least one row
+    if (OutDeletedRows.Num() > 0)
+    {
+        try
+        {
+            SaveAndSyncDataTable(DataTable);
+            RefreshDataTableEditor(DataTable);
+            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Successfully deleted %d rows, failed %d rows"), OutDeletedRows.Num(), OutFailedRows.Num());
+            return true;
+        }
+        catch (...)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Exception occurred while saving DataTable after deletion"));
+            return false;
+        }
+    }
+    
+    UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: No rows were deleted"));
+    return false;
+}
@@ -0,0 +1,216 @@
+#include "Services/DataTableRowImporter.h"
+#include "Services/DataTableStructNameCache.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "JsonObjectConverter.h"
+#include "UObject/UnrealType.h"
+
+FDataTableRowImporter::FDataTableRowImporter(const UScriptStruct* InRowStruct)
+    : RowStruct(InRowStruct)
+{
+    if (!RowStruct)
+    {
+        return;
+    }
+
+    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+    {
+        const int32 HandlerIndex = Handlers.Num();
+        FFieldHandler& Handler = Handlers.AddDefaulted_GetRef();
+        Handler.Property = *PropIt;
+
+        // Element objects are matched by authored name, so GUID-named element fields are renamed first
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*PropIt))
+        {
+            if (const FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProperty->Inner))
+            {
+                for (TFieldIterator<FProperty> InnerIt(InnerStruct->Struct); InnerIt; ++InnerIt)
+                {
+                    const FString InnerName = InnerIt->GetName();
+                    const FString InnerAuthoredName = InnerIt->GetAuthoredName();
+                    if (InnerName != InnerAuthoredName)
+                    {
+                        Handler.ElementRenames.Add(InnerName, InnerAuthoredName);
+                    }
+                }
+            }
+        }
+
+        // The property name first, so a friendly name of another property never shadows it
+        Keys.Add(PropIt->GetName(), { HandlerIndex, true });
+
+        TSet<const UStruct*> VisitedStructs;
+        bThreadSafe &= IsThreadSafeProperty(*PropIt, VisitedStructs);
+    }
+
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> StructNames = FDataTableStructNameCache::Get().GetNames(RowStruct);
+    for (int32 HandlerIndex = 0; HandlerIndex < Handlers.Num(); ++HandlerIndex)
+    {
+        const FString PropertyName = Handlers[HandlerIndex].Property->GetName();
+        for (const FString& Name : { StructNames->GuidToAuthored.FindRef(PropertyName), StructNames->GuidToFriendly.FindRef(PropertyName) })
+        {
+            if (!Name.IsEmpty() && !Keys.Contains(Name))
+            {
+                Keys.Add(Name, { HandlerIndex, false });
+            }
+        }
+    }
+}
+
+bool FDataTableRowImporter::ConvertRow(const FJsonObject& RowData, uint8* RowMemory, FString& OutError) const
+{
+    // Handlers set by their exact name this row; a friendly name of the same property is skipped after that
+    TArray<bool, TInlineAllocator<64>> SetByExactName;
+    SetByExactName.SetNumZeroed(Handlers.Num());
+
+    TArray<FString> FailedFields;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : RowData.Values)
+    {
+        const FFieldKey* Key = Keys.Find(Field.Key);
+        if (!Key || !Field.Value.IsValid() || (!Key->bExactName && SetByExactName[Key->HandlerIndex]))
+        {
+            continue;
+        }
+
+        const FFieldHandler& Handler = Handlers[Key->HandlerIndex];
+        void* ValuePtr = Handler.Property->ContainerPtrToValuePtr<void>(RowMemory);
+        if (!FJsonObjectConverter::JsonValueToUProperty(RenameElementFields(Handler, Field.Value), Handler.Property, ValuePtr))
+        {
+            FailedFields.Add(Field.Key);
+            continue;
+        }
+        SetByExactName[Key->HandlerIndex] |= Key->bExactName;
+    }
+
+    if (FailedFields.Num() > 0)
+    {
+        OutError = FString::Printf(TEXT("failed to convert field(s) %s"), *FString::Join(FailedFields, TEXT(", ")));
+        return false;
+    }
+    return true;
+}
+
+int32 FDataTableRowImporter::FindField(const FString& Name) const
+{
+    const FFieldKey* Key = Keys.Find(Name);
+    return Key ? Key->HandlerIndex : INDEX_NONE;
+}
+
+bool FDataTableRowImporter::ImportFieldText(int32 FieldIndex, const FString& Text, uint8* RowMemory) const
+{
+    if (!Handlers.IsValidIndex(FieldIndex))
+    {
+        return false;
+    }
+
+    const FProperty* Property = Handlers[FieldIndex].Property;
+    return Property->ImportText_Direct(*Text, Property->ContainerPtrToValuePtr<void>(RowMemory), nullptr, PPF_None) != nullptr;
+}
+
+bool FDataTableRowImporter::IsThreadSafeProperty(const FProperty* Property, TSet<const UStruct*>& VisitedStructs)
+{
+    // Soft references are paths and import without resolving anything
+    if (Property->IsA<FSoftObjectProperty>())
+    {
+        return true;
+    }
+    if (Property->IsA<FObjectPropertyBase>() || Property->IsA<FInterfaceProperty>() || Property->IsA<FDelegateProperty>()
+        || Property->IsA<FMulticastDelegateProperty>())
+    {
+        return false;
+    }
+    if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+    {
+        return IsThreadSafeProperty(ArrayProperty->Inner, VisitedStructs);
+    }
+    if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+    {
+        return IsThreadSafeProperty(SetProperty->ElementProp, VisitedStructs);
+    }
+    if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+    {
+        return IsThreadSafeProperty(MapProperty->KeyProp, VisitedStructs) && IsThreadSafeProperty(MapProperty->ValueProp, VisitedStructs);
+    }
+    if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        // Native text import (instanced structs, gameplay tags, ...) may look objects up by name
+        if (StructProperty->Struct->StructFlags & STRUCT_ImportTextItemNative)
+        {
+            return false;
+        }
+        bool bAlreadyVisited = false;
+        VisitedStructs.Add(StructProperty->Struct, &bAlreadyVisited);
+        if (bAlreadyVisited)
+        {
+            return true;
+        }
+        for (TFieldIterator<FProperty> InnerIt(StructProperty->Struct); InnerIt; ++InnerIt)
+        {
+            if (!IsThreadSafeProperty(*InnerIt, VisitedStructs))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TSharedPtr<FJsonValue> FDataTableRowImporter::RenameElementFields(const FFieldHandler& Handler, const TSharedPtr<FJsonValue>& Value)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Elements = nullptr;
+    if (Handler.ElementRenames.Num() == 0 || !Value->TryGetArray(Elements))
+    {
+        return Value;
+    }
+
+    // Only copied when an element actually uses a GUID name
+    TArray<TSharedPtr<FJsonValue>> RenamedElements;
+    for (int32 ElementIndex = 0; ElementIndex < Elements->Num(); ++ElementIndex)
+    {
+        const TSharedPtr<FJsonValue>& Element = (*Elements)[ElementIndex];
+        const TSharedPtr<FJsonObject>* ElementObject = nullptr;
+        bool bRenamed = false;
+        TSharedPtr<FJsonObject> RenamedObject;
+
+        if (Element.IsValid() && Element->TryGetObject(ElementObject))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& ElementField : (*ElementObject)->Values)
+            {
+                if (Handler.ElementRenames.Contains(ElementField.Key))
+                {
+                    bRenamed = true;
+                    break;
+                }
+            }
+            if (bRenamed)
+            {
+                RenamedObject = MakeShared<FJsonObject>();
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& ElementField : (*ElementObject)->Values)
+                {
+                    const FString* NewName = Handler.ElementRenames.Find(ElementField.Key);
+                    RenamedObject->SetField(NewName ? *NewName : ElementField.Key, ElementField.Value);
+                }
+            }
+        }
+
+        if (bRenamed && RenamedElements.Num() == 0)
+        {
+            RenamedElements.Reserve(Elements->Num());
+            RenamedElements.Append(Elements->GetData(), ElementIndex);
+        }
+        if (bRenamed)
+        {
+            RenamedElements.Add(MakeShared<FJsonValueObject>(RenamedObject));
+        }
+        else if (RenamedElements.Num() > 0)
+        {
+            RenamedElements.Add(Element);
+        }
+    }
+
+    if (RenamedElements.Num() == 0)
+    {
+        return Value;
+    }
+    return MakeShared<FJsonValueArray>(RenamedElements);
+}
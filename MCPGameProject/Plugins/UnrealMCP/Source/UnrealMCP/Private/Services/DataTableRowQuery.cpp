@@ -0,0 +1,378 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableStructNameCache.h"
+#include "Services/DataTableTransformationService.h"
+#include "Engine/DataTable.h"
+#include "JsonObjectConverter.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    enum class EFilterOp : uint8
+    {
+        Equal,
+        NotEqual,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Contains
+    };
+
+    enum class EFilterKind : uint8
+    {
+        Number,
+        Bool,
+        Text
+    };
+
+    /** A filter resolved against the row struct, so testing a row reads its memory directly */
+    struct FPreparedFilter
+    {
+        /** Field tested; null tests the row name */
+        const FProperty* Property = nullptr;
+        EFilterOp Op = EFilterOp::Equal;
+        EFilterKind Kind = EFilterKind::Text;
+        double Number = 0.0;
+        bool bBool = false;
+        FString Text;
+    };
+
+    bool ParseFilterOp(const FString& Operator, EFilterOp& OutOp)
+    {
+        static const TPair<const TCHAR*, EFilterOp> Ops[] = {
+            { TEXT("eq"), EFilterOp::Equal },
+            { TEXT("ne"), EFilterOp::NotEqual },
+            { TEXT("lt"), EFilterOp::Less },
+            { TEXT("le"), EFilterOp::LessEqual },
+            { TEXT("gt"), EFilterOp::Greater },
+            { TEXT("ge"), EFilterOp::GreaterEqual },
+            { TEXT("contains"), EFilterOp::Contains }
+        };
+
+        for (const TPair<const TCHAR*, EFilterOp>& Op : Ops)
+        {
+            if (Operator.Equals(Op.Key, ESearchCase::IgnoreCase))
+            {
+                OutOp = Op.Value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool PrepareFilter(const FDataTableRowFilter& Filter, const FDataTableStructNameCache::FStructNames& Names, FPreparedFilter& OutFilter, FString& OutError)
+    {
+        if (!ParseFilterOp(Filter.Operator, OutFilter.Op))
+        {
+            OutError = FString::Printf(TEXT("Unknown filter operator '%s' on '%s'; expected eq, ne, lt, le, gt, ge or contains"), *Filter.Operator, *Filter.Field);
+            return false;
+        }
+
+        if (FProperty* const* Property = Names.PropertiesByFieldName.Find(Filter.Field))
+        {
+            OutFilter.Property = *Property;
+        }
+        else if (!Filter.Field.Equals(TEXT("row_name"), ESearchCase::IgnoreCase))
+        {
+            OutError = FString::Printf(TEXT("Unknown filter field '%s'"), *Filter.Field);
+            return false;
+        }
+
+        const FNumericProperty* NumericProperty = CastField<FNumericProperty>(OutFilter.Property);
+        if (NumericProperty && !NumericProperty->IsEnum() && OutFilter.Property->ArrayDim == 1)
+        {
+            OutFilter.Kind = EFilterKind::Number;
+            FString NumberText;
+            if (Filter.Value->Type == EJson::Number)
+            {
+                OutFilter.Number = Filter.Value->AsNumber();
+            }
+            else if (Filter.Value->TryGetString(NumberText) && NumberText.IsNumeric())
+            {
+                OutFilter.Number = FCString::Atod(*NumberText);
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Filter on numeric field '%s' needs a number"), *Filter.Field);
+                return false;
+            }
+            if (OutFilter.Op == EFilterOp::Contains)
+            {
+                OutError = FString::Printf(TEXT("Filter on numeric field '%s' cannot use 'contains'"), *Filter.Field);
+                return false;
+            }
+            return true;
+        }
+
+        if (CastField<FBoolProperty>(OutFilter.Property) && OutFilter.Property->ArrayDim == 1)
+        {
+            OutFilter.Kind = EFilterKind::Bool;
+            if (!Filter.Value->TryGetBool(OutFilter.bBool))
+            {
+                OutError = FString::Printf(TEXT("Filter on bool field '%s' needs true or false"), *Filter.Field);
+                return false;
+            }
+            if (OutFilter.Op != EFilterOp::Equal && OutFilter.Op != EFilterOp::NotEqual)
+            {
+                OutError = FString::Printf(TEXT("Filter on bool field '%s' can only use 'eq' or 'ne'"), *Filter.Field);
+                return false;
+            }
+            return true;
+        }
+
+        OutFilter.Kind = EFilterKind::Text;
+        if (!Filter.Value->TryGetString(OutFilter.Text))
+        {
+            OutError = FString::Printf(TEXT("Filter on '%s' needs a string, number or bool value"), *Filter.Field);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Text of a field as a filter compares it; enums also give their display name
+     * Other types than strings, names, texts and enums compare their exported property text.
+     */
+    void ReadFieldText(const FPreparedFilter& Filter, const FName& RowName, const uint8* RowPtr, FString& OutText, FString& OutDisplayText)
+    {
+        if (!Filter.Property)
+        {
+            OutText = RowName.ToString();
+            return;
+        }
+
+        const void* ValuePtr = Filter.Property->ContainerPtrToValuePtr<void>(RowPtr);
+        if (Filter.Property->ArrayDim == 1)
+        {
+            if (const FStrProperty* StrProperty = CastField<FStrProperty>(Filter.Property))
+            {
+                OutText = StrProperty->GetPropertyValue(ValuePtr);
+                return;
+            }
+            if (const FNameProperty* NameProperty = CastField<FNameProperty>(Filter.Property))
+            {
+                OutText = NameProperty->GetPropertyValue(ValuePtr).ToString();
+                return;
+            }
+            if (const FTextProperty* TextProperty = CastField<FTextProperty>(Filter.Property))
+            {
+                OutText = TextProperty->GetPropertyValue(ValuePtr).ToString();
+                return;
+            }
+
+            const UEnum* Enum = nullptr;
+            int64 EnumValue = 0;
+            if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Filter.Property))
+            {
+                Enum = EnumProperty->GetEnum();
+                EnumValue = EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(ValuePtr);
+            }
+            else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Filter.Property))
+            {
+                Enum = ByteProperty->Enum;
+                EnumValue = ByteProperty->GetPropertyValue(ValuePtr);
+            }
+            if (Enum)
+            {
+                OutText = Enum->GetNameStringByValue(EnumValue);
+                OutDisplayText = Enum->GetDisplayNameTextByValue(EnumValue).ToString();
+                return;
+            }
+        }
+
+        Filter.Property->ExportText_InContainer(0, OutText, RowPtr, nullptr, nullptr, PPF_None);
+    }
+
+    bool CompareMatches(EFilterOp Op, int32 Comparison)
+    {
+        switch (Op)
+        {
+        case EFilterOp::Equal:        return Comparison == 0;
+        case EFilterOp::NotEqual:     return Comparison != 0;
+        case EFilterOp::Less:         return Comparison < 0;
+        case EFilterOp::LessEqual:    return Comparison <= 0;
+        case EFilterOp::Greater:      return Comparison > 0;
+        case EFilterOp::GreaterEqual: return Comparison >= 0;
+        default:                      return false;
+        }
+    }
+
+    bool TextMatches(const FPreparedFilter& Filter, const FString& Text)
+    {
+        if (Filter.Op == EFilterOp::Contains)
+        {
+            return Text.Contains(Filter.Text, ESearchCase::IgnoreCase);
+        }
+        return CompareMatches(Filter.Op, Text.Compare(Filter.Text, ESearchCase::IgnoreCase));
+    }
+
+    bool RowPasses(const FPreparedFilter& Filter, const FName& RowName, const uint8* RowPtr)
+    {
+        if (Filter.Kind == EFilterKind::Number)
+        {
+            const FNumericProperty* NumericProperty = CastFieldChecked<FNumericProperty>(Filter.Property);
+            const void* ValuePtr = Filter.Property->ContainerPtrToValuePtr<void>(RowPtr);
+            const double Value = NumericProperty->IsFloatingPoint()
+                ? NumericProperty->GetFloatingPointPropertyValue(ValuePtr)
+                : static_cast<double>(NumericProperty->GetSignedIntPropertyValue(ValuePtr));
+            return CompareMatches(Filter.Op, Value < Filter.Number ? -1 : (Value > Filter.Number ? 1 : 0));
+        }
+
+        if (Filter.Kind == EFilterKind::Bool)
+        {
+            const FBoolProperty* BoolProperty = CastFieldChecked<FBoolProperty>(Filter.Property);
+            const bool bValue = BoolProperty->GetPropertyValue(Filter.Property->ContainerPtrToValuePtr<void>(RowPtr));
+            return (bValue == Filter.bBool) == (Filter.Op == EFilterOp::Equal);
+        }
+
+        FString Text;
+        FString DisplayText;
+        ReadFieldText(Filter, RowName, RowPtr, Text, DisplayText);
+        if (DisplayText.IsEmpty())
+        {
+            return TextMatches(Filter, Text);
+        }
+
+        // An enum passes on its name or its display name; a negated test must fail on both
+        if (Filter.Op == EFilterOp::NotEqual)
+        {
+            return TextMatches(Filter, Text) && TextMatches(Filter, DisplayText);
+        }
+        return TextMatches(Filter, Text) || TextMatches(Filter, DisplayText);
+    }
+}
+
+bool FDataTableService::QueryDataTableRows(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    if (!DataTable || !DataTable->GetRowStruct())
+    {
+        OutError = TEXT("DataTable is null or has no row struct");
+        return false;
+    }
+
+    if (!Query.IsValid(OutError))
+    {
+        return false;
+    }
+
+    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> Names = FDataTableStructNameCache::Get().GetNames(RowStruct);
+
+    TArray<const FProperty*> Fields;
+    for (const FString& FieldName : Query.Fields)
+    {
+        FProperty* const* Property = Names->PropertiesByFieldName.Find(FieldName);
+        if (!Property)
+        {
+            OutError = FString::Printf(TEXT("Unknown field '%s' in row struct '%s'"), *FieldName, *RowStruct->GetName());
+            return false;
+        }
+        Fields.AddUnique(*Property);
+    }
+
+    TArray<FPreparedFilter> Filters;
+    Filters.Reserve(Query.Filters.Num());
+    for (const FDataTableRowFilter& Filter : Query.Filters)
+    {
+        if (!PrepareFilter(Filter, *Names, Filters.AddDefaulted_GetRef(), OutError))
+        {
+            return false;
+        }
+    }
+
+    // Every candidate is tested so matched_count is exact; only the page is converted
+    TArray<TSharedPtr<FJsonValue>> RowsArray;
+    int32 MatchedCount = 0;
+    auto VisitRow = [&](const FName& RowName, const uint8* RowPtr)
+    {
+        for (const FPreparedFilter& Filter : Filters)
+        {
+            if (!RowPasses(Filter, RowName, RowPtr))
+            {
+                return;
+            }
+        }
+
+        const int32 MatchIndex = MatchedCount++;
+        if (MatchIndex < Query.Offset || (Query.Limit > 0 && RowsArray.Num() >= Query.Limit))
+        {
+            return;
+        }
+
+        TSharedPtr<FJsonObject> RowObj = Fields.Num() > 0
+            ? ProjectedRowToJson(DataTable, RowName, RowPtr, Fields)
+            : RowToJson(DataTable, RowName);
+        RowsArray.Add(MakeShared<FJsonValueObject>(RowObj));
+    };
+
+    const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+    if (Query.RowNames.Num() > 0)
+    {
+        for (const FString& RowName : Query.RowNames)
+        {
+            const FName Name(*RowName);
+            if (uint8* const* RowPtr = RowMap.Find(Name))
+            {
+                VisitRow(Name, *RowPtr);
+            }
+        }
+    }
+    else
+    {
+        for (const TPair<FName, uint8*>& RowPair : RowMap)
+        {
+            VisitRow(RowPair.Key, RowPair.Value);
+        }
+    }
+
+    const int32 NextOffset = Query.Offset + RowsArray.Num();
+    const bool bHasMore = NextOffset < MatchedCount;
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetArrayField(TEXT("rows"), RowsArray);
+    OutResult->SetNumberField(TEXT("total_rows"), RowMap.Num());
+    OutResult->SetNumberField(TEXT("matched_count"), MatchedCount);
+    OutResult->SetNumberField(TEXT("offset"), Query.Offset);
+    OutResult->SetNumberField(TEXT("returned_count"), RowsArray.Num());
+    OutResult->SetBoolField(TEXT("has_more"), bHasMore);
+    if (bHasMore)
+    {
+        OutResult->SetNumberField(TEXT("next_offset"), NextOffset);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MCP DataTable: Query on '%s' matched %d of %d rows, returned %d from offset %d"),
+        *DataTable->GetName(), MatchedCount, RowMap.Num(), RowsArray.Num(), Query.Offset);
+    return true;
+}
+
+TSharedPtr<FJsonObject> FDataTableService::ProjectedRowToJson(const UDataTable* DataTable, const FName& RowName, const uint8* RowPtr, const TArray<const FProperty*>& Fields)
+{
+    TSharedPtr<FJsonObject> RowObj = MakeShared<FJsonObject>();
+    RowObj->SetStringField(TEXT("row_name"), RowName.ToString());
+
+    // Keys and values as UStructToJsonObject writes them, so the transform below names them as RowToJson does
+    TSharedPtr<FJsonObject> RowDataObj = MakeShared<FJsonObject>();
+    for (const FProperty* Field : Fields)
+    {
+        FProperty* Property = const_cast<FProperty*>(Field);
+        const FString Key = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+        if (Property->ArrayDim == 1)
+        {
+            RowDataObj->SetField(Key, FJsonObjectConverter::UPropertyToJsonValue(Property, Property->ContainerPtrToValuePtr<void>(RowPtr)));
+        }
+        else
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+            {
+                Elements.Add(FJsonObjectConverter::UPropertyToJsonValue(Property, Property->ContainerPtrToValuePtr<void>(RowPtr, Index)));
+            }
+            RowDataObj->SetArrayField(Key, Elements);
+        }
+    }
+
+    RowObj->SetObjectField(TEXT("row_data"), FDataTableTransformationService::AutoTransformFromGuidNames(RowDataObj, DataTable->GetRowStruct()));
+    return RowObj;
+}
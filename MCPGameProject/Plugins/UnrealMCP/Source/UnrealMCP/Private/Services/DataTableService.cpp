@@ -1,7 +1,10 @@
 #include "Services/DataTableService.h"
 #include "Services/DataTableTransformationService.h"
+#include "Services/DataTableStructNameCache.h"
+#include "Services/DataTableCatalog.h"
 #include "Services/AssetDiscoveryService.h"
 #include "Engine/DataTable.h"
+#include "Engine/CompositeDataTable.h"
 #include "UObject/ConstructorHelpers.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Factories/DataTableFactory.h"
@@ -12,7 +15,8 @@
 #include "Editor.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "UObject/MetaData.h"
-#include "ScopedTransaction.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
 
 FDataTableService::FDataTableService()
 {
@@ -55,6 +59,95 @@ bool FDataTableRowParams::IsValid(const UDataTable* DataTable, FString& OutError
         return false;
     }
     
+    // A composite table rebuilds its rows from its parents, which would drop rows written to it
+    if (DataTable->IsA<UCompositeDataTable>())
+    {
+        OutError = TEXT("DataTable is a composite table; write rows to one of its parent tables");
+        return false;
+    }
+    
+    return true;
+}
+
+bool FCurveTableRowParams::IsValid(FString& OutError) const
+{
+    if (RowName.IsEmpty())
+    {
+        OutError = TEXT("Row name cannot be empty");
+        return false;
+    }
+    
+    if (Times.Num() != Values.Num())
+    {
+        OutError = FString::Printf(TEXT("Row has %d times but %d values"), Times.Num(), Values.Num());
+        return false;
+    }
+    
+    if (!InterpMode.IsEmpty() && InterpMode != TEXT("linear") && InterpMode != TEXT("constant") && InterpMode != TEXT("cubic"))
+    {
+        OutError = FString::Printf(TEXT("Unknown interp mode '%s'; expected linear, constant or cubic"), *InterpMode);
+        return false;
+    }
+    
+    return true;
+}
+
+bool FDataTableFileImportParams::IsValid(FString& OutError) const
+{
+    if (FilePath.IsEmpty())
+    {
+        OutError = TEXT("File path cannot be empty");
+        return false;
+    }
+    
+    if (!Format.IsEmpty() && Format != TEXT("csv") && Format != TEXT("jsonl"))
+    {
+        OutError = FString::Printf(TEXT("Unknown file format '%s'; expected 'csv' or 'jsonl'"), *Format);
+        return false;
+    }
+    
+    return true;
+}
+
+bool FDataTableFileExportParams::IsValid(FString& OutError) const
+{
+    if (FilePath.IsEmpty())
+    {
+        OutError = TEXT("File path cannot be empty");
+        return false;
+    }
+    
+    return true;
+}
+
+bool FDataTableRowQuery::IsValid(FString& OutError) const
+{
+    if (Offset < 0)
+    {
+        OutError = TEXT("Offset cannot be negative");
+        return false;
+    }
+    
+    if (Limit < 0)
+    {
+        OutError = TEXT("Limit cannot be negative");
+        return false;
+    }
+    
+    for (const FDataTableRowFilter& Filter : Filters)
+    {
+        if (Filter.Field.IsEmpty())
+        {
+            OutError = TEXT("Filter field cannot be empty");
+            return false;
+        }
+        if (!Filter.Value.IsValid() || Filter.Value->IsNull())
+        {
+            OutError = FString::Printf(TEXT("Filter on '%s' has no value"), *Filter.Field);
+            return false;
+        }
+    }
+    
     return true;
 }
 
@@ -128,6 +221,27 @@ UDataTable* FDataTableService::CreateDataTable(const FDataTableCreationParams& P
 
 UDataTable* FDataTableService::FindDataTable(const FString& DataTableName)
 {
+    // The catalog answers names and paths from the asset registry, so only the table itself is loaded
+    FDataTableCatalog::FEntry CatalogEntry;
+    const FDataTableCatalog::EResolution Resolution = FDataTableCatalog::Get().Resolve(DataTableName, CatalogEntry);
+    if (Resolution == FDataTableCatalog::EResolution::Found)
+    {
+        UDataTable* CatalogTable = Cast<UDataTable>(CatalogEntry.ObjectPath.ResolveObject());
+        if (!CatalogTable)
+        {
+            CatalogTable = Cast<UDataTable>(CatalogEntry.ObjectPath.TryLoad());
+        }
+        if (CatalogTable)
+        {
+            return CatalogTable;
+        }
+    }
+    else if (Resolution == FDataTableCatalog::EResolution::NotFound && !DataTableName.StartsWith(TEXT("/")))
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to find DataTable: '%s'"), *DataTableName);
+        return nullptr;
+    }
+    
     // Try multiple path variations to find the datatable
     TArray<FString> PathVariations;
 
@@ -162,6 +276,23 @@ UDataTable* FDataTableService::FindDataTable(const FString& DataTableName)
     // Try common variations for short names
     if (!DataTableName.StartsWith(TEXT("/")))
     {
+        // The asset index answers short names anywhere under /Game without probing the guesses below
+        FSoftObjectPath IndexedPath;
+        const FAssetDiscoveryService::EAssetResolution Resolution =
+            FAssetDiscoveryService::Get().ResolveAssetPath(DataTableName, UDataTable::StaticClass(), IndexedPath);
+        if (Resolution == FAssetDiscoveryService::EAssetResolution::Found)
+        {
+            if (UDataTable* IndexedTable = Cast<UDataTable>(IndexedPath.TryLoad()))
+            {
+                return IndexedTable;
+            }
+        }
+        else if (Resolution == FAssetDiscoveryService::EAssetResolution::NotFound)
+        {
+            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to find DataTable: '%s'"), *DataTableName);
+            return nullptr;
+        }
+
         FString CleanName = DataTableName;
         // Remove any suffix if present
         if (CleanName.Contains(TEXT(".")))
@@ -196,358 +327,6 @@ UDataTable* FDataTableService::FindDataTable(const FString& DataTableName)
     return nullptr;
 }
 
-bool FDataTableService::AddRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows)
-{
-    if (!DataTable)
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
-        return false;
-    }
-    
-    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-    if (!RowStruct)
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to get row struct from DataTable"));
-        return false;
-    }
-    
-        OutAddedRows.Empty();
-    OutFailedRows.Empty();
-    
-    for (const FDataTableRowParams& RowParams : Rows)
-    {
-        FString ValidationError;
-        if (!RowParams.IsValid(DataTable, ValidationError))
-        {
-            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
-            continue;
-        }
-        
-        // Check if we have GUID fields that need transformation BEFORE validation (to avoid auto-fill contamination)
-        bool bHasGuidFields = false;
-        for (const auto& Field : RowParams.RowData->Values)
-        {
-            bool bIsGuid = FDataTableTransformationService::IsGuidField(Field.Key);
-            UE_LOG(LogTemp, Warning, TEXT("Field '%s' is GUID: %s"), *Field.Key, bIsGuid ? TEXT("YES") : TEXT("NO"));
-            if (bIsGuid)
-            {
-                bHasGuidFields = true;
-                break;
-            }
-        }
-        
-        UE_LOG(LogTemp, Warning, TEXT("Has GUID fields: %s"), bHasGuidFields ? TEXT("YES") : TEXT("NO"));
-        
-        // Transform GUID field names to friendly names before validation and JsonObjectToUStruct
-        TSharedPtr<FJsonObject> StructJson = RowParams.RowData;
-        if (bHasGuidFields)
-        {
-            StructJson = FDataTableTransformationService::AutoTransformFromGuidNames(RowParams.RowData, RowStruct);
-        }
-        
-        // Validate row data (after potential transformation)
-        if (!ValidateRowData(DataTable, StructJson, ValidationError))
-        {
-            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
-            continue;
-        }
-        
-        // Allocate memory for the new row
-        uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
-        RowStruct->InitializeStruct(RowMemory);
-        FTableRowBase* NewRow = reinterpret_cast<FTableRowBase*>(RowMemory);
-        
-        TSharedRef<FJsonObject> JsonRef = StructJson.ToSharedRef();
-        
-        // DEBUG: Log the JSON structure before conversion
-        FString JsonString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-        FJsonSerializer::Serialize(JsonRef, Writer);
-        UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JSON before conversion: %s"), *JsonString);
-        
-        // Log each field in JsonRef->Values
-        for (const auto& Pair : JsonRef->Values)
-        {
-            FString ValueType = TEXT("Unknown");
-            if (Pair.Value->Type == EJson::String) ValueType = TEXT("String");
-            else if (Pair.Value->Type == EJson::Number) ValueType = TEXT("Number");
-            else if (Pair.Value->Type == EJson::Boolean) ValueType = TEXT("Boolean");
-            else if (Pair.Value->Type == EJson::Array) ValueType = TEXT("Array");
-            else if (Pair.Value->Type == EJson::Object) ValueType = TEXT("Object");
-            
-            UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JSON field '%s' = Type: %s"), *Pair.Key, *ValueType);
-            
-            if (Pair.Value->Type == EJson::Array)
-            {
-                const TArray<TSharedPtr<FJsonValue>>* ArrayPtr = nullptr;
-                if (Pair.Value->TryGetArray(ArrayPtr) && ArrayPtr)
-                {
-                    UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: Array field '%s' has %d elements"), *Pair.Key, ArrayPtr->Num());
-                }
-            }
-        }
-        
-        // UE 5.7 proper fix: Use JsonAttributesToUStruct for struct array support
-        bool bJsonConverted = FJsonObjectConverter::JsonAttributesToUStruct(JsonRef->Values, RowStruct, RowMemory);
-        
-        UE_LOG(LogTemp, Warning, TEXT("MCP DEBUG: JsonAttributesToUStruct result: %s"), bJsonConverted ? TEXT("SUCCESS") : TEXT("FAILED"));
-        
-        if (!bJsonConverted)
-        {
-            RowStruct->DestroyStruct(RowMemory);
-            FMemory::Free(RowMemory);
-            OutFailedRows.Add(FString::Printf(TEXT("%s: failed to convert JSON to UStruct"), *RowParams.RowName));
-            continue;
-        }
-        
-        UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: JsonObjectToUStruct SUCCESS - Adding row '%s' to DataTable"), *RowParams.RowName);
-        DataTable->AddRow(FName(*RowParams.RowName), *NewRow);
-        UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' successfully added to DataTable"), *RowParams.RowName);
-        
-        RowStruct->DestroyStruct(RowMemory);
-        FMemory::Free(RowMemory);
-        
-        OutAddedRows.Add(RowParams.RowName);
-    }
-    
-    if (OutAddedRows.Num() > 0)
-    {
-        // Mark dirty and refresh
-        DataTable->Modify(true);
-        DataTable->PostEditChange();
-        DataTable->MarkPackageDirty();
-        
-        SaveAndSyncDataTable(DataTable);
-        RefreshDataTableEditor(DataTable);
-        
-        return true;
-    }
-    
-    return false;
-}
-
-bool FDataTableService::UpdateRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutUpdatedRows, TArray<FString>& OutFailedRows)
-{
-    if (!DataTable)
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
-        return false;
-    }
-    
-    const UScriptStruct* RowStruct = DataTable->GetRowStruct();
-    if (!RowStruct)
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Failed to get row struct from DataTable"));
-        return false;
-    }
-    
-    OutUpdatedRows.Empty();
-    OutFailedRows.Empty();
-    
-    for (const FDataTableRowParams& RowParams : Rows)
-    {
-        FString ValidationError;
-        if (!RowParams.IsValid(DataTable, ValidationError))
-        {
-            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
-            continue;
-        }
-        
-        // Check if row exists
-        if (!DataTable->GetRowMap().Contains(FName(*RowParams.RowName)))
-        {
-            OutFailedRows.Add(FString::Printf(TEXT("%s: row not found"), *RowParams.RowName));
-            continue;
-        }
-        
-        // Check if we have GUID fields that need transformation BEFORE validation (to avoid auto-fill contamination)
-        bool bHasGuidFields = false;
-        for (const auto& Field : RowParams.RowData->Values)
-        {
-            bool bIsGuid = FDataTableTransformationService::IsGuidField(Field.Key);
-            UE_LOG(LogTemp, Warning, TEXT("Field '%s' is GUID: %s"), *Field.Key, bIsGuid ? TEXT("YES") : TEXT("NO"));
-            if (bIsGuid)
-            {
-                bHasGuidFields = true;
-                break;
-            }
-        }
-        
-        UE_LOG(LogTemp, Warning, TEXT("Has GUID fields: %s"), bHasGuidFields ? TEXT("YES") : TEXT("NO"));
-        
-        // Transform GUID field names to friendly names before validation and JsonObjectToUStruct
-        TSharedPtr<FJsonObject> StructJson = RowParams.RowData;
-        if (bHasGuidFields)
-        {
-            StructJson = FDataTableTransformationService::AutoTransformFromGuidNames(RowParams.RowData, RowStruct);
-        }
-        
-        // Validate row data (after potential transformation)
-        if (!ValidateRowData(DataTable, StructJson, ValidationError))
-        {
-            OutFailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *ValidationError));
-            continue;
-        }
-        
-        // Allocate memory for the new row
-        uint8* RowMemory = (uint8*)FMemory::Malloc(RowStruct->GetStructureSize());
-        RowStruct->InitializeStruct(RowMemory);
-        FTableRowBase* NewRow = reinterpret_cast<FTableRowBase*>(RowMemory);
-        
-        TSharedRef<FJsonObject> JsonRef = StructJson.ToSharedRef();
-        
-        // UE 5.7 proper fix: Use JsonAttributesToUStruct for struct array support
-        bool bJsonConverted = FJsonObjectConverter::JsonAttributesToUStruct(JsonRef->Values, RowStruct, RowMemory);
-        
-        if (!bJsonConverted)
-        {
-            RowStruct->DestroyStruct(RowMemory);
-            FMemory::Free(RowMemory);
-            OutFailedRows.Add(FString::Printf(TEXT("%s: failed to convert JSON to UStruct"), *RowParams.RowName));
-            continue;
-        }
-        
-        // Use AddRow to update the row
-        DataTable->AddRow(FName(*RowParams.RowName), *NewRow);
-        
-        // Notify DataTable of the change
-        DataTable->HandleDataTableChanged(FName(*RowParams.RowName));
-        
-        RowStruct->DestroyStruct(RowMemory);
-        FMemory::Free(RowMemory);
-        
-        OutUpdatedRows.Add(RowParams.RowName);
-    }
-    
-    if (OutUpdatedRows.Num() > 0)
-    {
-        // Mark dirty and refresh
-        DataTable->Modify(true);
-        DataTable->PostEditChange();
-        DataTable->MarkPackageDirty();
-        
-        SaveAndSyncDataTable(DataTable);
-        RefreshDataTableEditor(DataTable);
-        
-        return true;
-    }
-    
-    return false;
-}
-
-bool FDataTableService::DeleteRowsFromDataTable(UDataTable* DataTable, const TArray<FString>& RowNames, TArray<FString>& OutDeletedRows, TArray<FString>& OutFailedRows)
-{
-    if (!DataTable)
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null"));
-        return false;
-    }
-    
-    // Check if DataTable is valid and has a row struct
-    if (!DataTable->GetRowStruct())
-    {
-        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable has no row struct"));
-        return false;
-    }
-    
-
-    
-    OutDeletedRows.Empty();
-    OutFailedRows.Empty();
-    
-    // First, validate all row names exist before attempting deletion
-    TArray<FName> ValidRowNames;
-    for (const FString& RowName : RowNames)
-    {
-        FName RowFName(*RowName);
-        if (DataTable->GetRowMap().Contains(RowFName))
-        {
-            ValidRowNames.Add(RowFName);
-        }
-        else
-        {
-            OutFailedRows.Add(RowName);
-            UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' not found in DataTable"), *RowName);
-        }
-    }
-    
-    // Use direct row map manipulation to avoid UE 5.7 RemoveRow() crashes
-    for (const FName& RowFName : ValidRowNames)
-    {
-        try
-        {
-            // Mark the DataTable as modified before deletion
-            DataTable->Modify();
-            
-            // Get direct access to the row map
-            TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
-            
-            // Double-check the row exists before deletion
-            if (RowMap.Contains(RowFName))
-            {
-                // Create a scoped transaction for undo/redo support
-                FScopedTransaction Transaction(FText::FromString(FString::Printf(TEXT("Delete DataTable Row '%s'"), *RowFName.ToString())));
-                
-                // Mark as modified again within transaction
-                DataTable->Modify();
-                
-                // Get the row data pointer before removing
-                uint8* RowData = RowMap[RowFName];
-                
-                // Remove from the map first
-                RowMap.Remove(RowFName);
-                
-                // Free the memory if it exists and we have a valid struct
-                if (RowData && DataTable->GetRowStruct())
-                {
-                    // Properly destroy the struct data
-                    DataTable->GetRowStruct()->DestroyStruct(RowData);
-                    // Free the allocated memory
-                    FMemory::Free(RowData);
-                }
-                
-                OutDeletedRows.Add(RowFName.ToString());
-                UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Successfully deleted row '%s'"), *RowFName.ToString());
-            }
-            else
-            {
-                OutFailedRows.Add(RowFName.ToString());
-                UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: Row '%s' not found during deletion"), *RowFName.ToString());
-            }
-        }
-        catch (const std::exception& e)
-        {
-            OutFailedRows.Add(RowFName.ToString());
-            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Exception while deleting row '%s': %s"), *RowFName.ToString(), *FString(e.what()));
-        }
-        catch (...)
-        {
-            OutFailedRows.Add(RowFName.ToString());
-            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Unknown exception while deleting row '%s'"), *RowFName.ToString());
-        }
-    }
-    
-    // Only save if we successfully deleted at least one row
-    if (OutDeletedRows.Num() > 0)
-    {
-        try
-        {
-            SaveAndSyncDataTable(DataTable);
-            RefreshDataTableEditor(DataTable);
-            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Successfully deleted %d rows, failed %d rows"), OutDeletedRows.Num(), OutFailedRows.Num());
-            return true;
-        }
-        catch (...)
-        {
-            UE_LOG(LogTemp, Error, TEXT("MCP DataTable: Exception occurred while saving DataTable after deletion"));
-            return false;
-        }
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("MCP DataTable: No rows were deleted"));
-    return false;
-}
-
 TSharedPtr<FJsonObject> FDataTableService::GetDataTableRows(const UDataTable* DataTable, const TArray<FString>& RowNames)
 {
     if (!DataTable)
@@ -629,6 +408,30 @@ TSharedPtr<FJsonObject> FDataTableService::GetDataTablePropertyMap(const UDataTa
         return nullptr;
     }
     
+    return BuildPropertyMap(RowStruct);
+}
+
+TSharedPtr<FJsonObject> FDataTableService::GetDataTablePropertyMap(const FString& DataTableName)
+{
+    // The row struct named by the table's registry tag is enough; the table itself stays unloaded
+    FDataTableCatalog::FEntry CatalogEntry;
+    if (FDataTableCatalog::Get().Resolve(DataTableName, CatalogEntry) == FDataTableCatalog::EResolution::Found
+        && !CatalogEntry.RowStructPath.IsEmpty())
+    {
+        const UScriptStruct* RowStruct = CatalogEntry.RowStructPath.Contains(TEXT("/"))
+            ? LoadObject<UScriptStruct>(nullptr, *CatalogEntry.RowStructPath)
+            : FindFirstObject<UScriptStruct>(*CatalogEntry.RowStructPath, EFindFirstObjectOptions::NativeFirst);
+        if (RowStruct)
+        {
+            return BuildPropertyMap(RowStruct);
+        }
+    }
+    
+    return GetDataTablePropertyMap(FindDataTable(DataTableName));
+}
+
+TSharedPtr<FJsonObject> FDataTableService::BuildPropertyMap(const UScriptStruct* RowStruct)
+{
     TSharedPtr<FJsonObject> MappingObj = MakeShared<FJsonObject>();
     for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
     {
@@ -739,19 +542,7 @@ UScriptStruct* FDataTableService::FindStruct(const FString& StructName)
 
 TMap<FString, FString> FDataTableService::BuildGuidToStructNameMap(const UScriptStruct* RowStruct)
 {
-    TMap<FString, FString> Map;
-    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        FString GuidName = Property->GetName(); // This is the GUID name
-        FString StructName = Property->GetAuthoredName(); // This is the original struct name
-        Map.Add(GuidName, StructName);
-        if (GuidName != StructName)
-        {
-            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Mapping GUID property '%s' to struct property '%s'"), *GuidName, *StructName);
-        }
-    }
-    return Map;
+    return FDataTableStructNameCache::Get().GetNames(RowStruct)->GuidToAuthored;
 }
 
 TSharedPtr<FJsonObject> FDataTableService::TransformJsonToStructNames(const TSharedPtr<FJsonObject>& InJson, const TMap<FString, FString>& GuidToStructMap)
@@ -813,12 +604,16 @@ void FDataTableService::RefreshDataTableEditor(UDataTable* DataTable)
 #if WITH_EDITOR
     if (GEditor && DataTable)
     {
-        UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-        if (AssetEditorSubsystem)
+        // Reopening the editor is expensive; a batch of row edits reopens it once at the end
+        FMCPBatchEditScope::Defer(DataTable, TEXT("RefreshDataTableEditor"), [DataTable]()
         {
-            AssetEditorSubsystem->CloseAllEditorsForAsset(DataTable);
-            AssetEditorSubsystem->OpenEditorForAsset(DataTable);
-        }
+            UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+            if (AssetEditorSubsystem)
+            {
+                AssetEditorSubsystem->CloseAllEditorsForAsset(DataTable);
+                AssetEditorSubsystem->OpenEditorForAsset(DataTable);
+            }
+        });
     }
 #endif
 }
@@ -828,10 +623,10 @@ void FDataTableService::SaveAndSyncDataTable(UDataTable* DataTable)
     if (DataTable)
     {
         UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Attempting to save asset: '%s'"), *DataTable->GetPathName());
-        bool bSaved = UEditorAssetLibrary::SaveAsset(DataTable->GetPathName(), false);
+        bool bSaved = FMCPSaveQueue::Get().SaveOrEnqueue(DataTable);
         if (bSaved)
         {
-            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Asset saved successfully"));
+            UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Asset saved or queued for saving"));
         }
         else
         {
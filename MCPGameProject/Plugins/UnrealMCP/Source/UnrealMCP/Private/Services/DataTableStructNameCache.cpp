@@ -0,0 +1,191 @@
+#include "Services/DataTableStructNameCache.h"
+#include "Services/DataTableTransformationService.h"
+#include "Kismet2/StructureEditorUtils.h"
+#include "StructUtils/UserDefinedStruct.h"
+#include "UObject/UnrealType.h"
+#include "MCPMemory.h"
+
+class FDataTableStructNameCache::FStructChangeListener : public FStructureEditorUtils::INotifyOnStructChanged
+{
+public:
+    explicit FStructChangeListener(FDataTableStructNameCache& InCache)
+        : Cache(InCache)
+    {
+    }
+
+    virtual void PreChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override
+    {
+    }
+
+    virtual void PostChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info) override
+    {
+        Cache.Invalidate(Struct);
+    }
+
+private:
+    FDataTableStructNameCache& Cache;
+};
+
+FDataTableStructNameCache& FDataTableStructNameCache::Get()
+{
+    static FDataTableStructNameCache Instance;
+    return Instance;
+}
+
+void FDataTableStructNameCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    StructChangeListener = MakeUnique<FStructChangeListener>(*this);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("datatable_struct_name_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Entries.Num()); });
+    FMCPCacheBudget::Get().Register(TEXT("datatable_struct_name_cache"), *this);
+}
+
+void FDataTableStructNameCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    StructChangeListener.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("datatable_struct_name_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("datatable_struct_name_cache"));
+
+    Entries.Empty();
+    ResetUsedBytes();
+}
+
+TSharedRef<const FDataTableStructNameCache::FStructNames> FDataTableStructNameCache::GetNames(const UScriptStruct* Struct)
+{
+    check(IsInGameThread());
+
+    // Without the struct listener a kept entry could go stale unnoticed
+    if (!bInitialized || !Struct)
+    {
+        return Build(Struct);
+    }
+
+    const FGuid StructGuid = Struct->GetCustomGuid();
+    if (FEntry* Entry = Entries.Find(Struct))
+    {
+        if (Entry->StructGuid == StructGuid)
+        {
+            CacheCounters.RecordHit();
+            Entry->LastUse = FMCPCacheBudget::NextUse();
+            return Entry->Names;
+        }
+    }
+
+    // Entries of structs that were garbage collected are dropped before a new one is added
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            AddUsedBytes(-It.Value().Bytes);
+            It.RemoveCurrent();
+        }
+    }
+
+    CacheCounters.RecordMiss();
+    TSharedRef<const FStructNames> Names = Build(Struct);
+    const int64 Bytes = static_cast<int64>(sizeof(FEntry)) + GetNamesSize(*Names);
+    RemoveMapEntry(Entries, Struct);
+    Entries.Add(Struct, { StructGuid, Names, FMCPCacheBudget::NextUse(), Bytes });
+    AddUsedBytes(Bytes);
+    return Names;
+}
+
+void FDataTableStructNameCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    GetMapUses(Entries, OutUses);
+}
+
+int64 FDataTableStructNameCache::EvictUsedBefore(uint64 Stamp)
+{
+    return EvictMapUsedBefore(Entries, Stamp);
+}
+
+int64 FDataTableStructNameCache::GetNamesSize(const FStructNames& Names)
+{
+    int64 Bytes = sizeof(FStructNames);
+    for (const TMap<FString, FString>* Map : { &Names.GuidToFriendly, &Names.GuidToCamelCaseFriendly, &Names.FriendlyToGuid, &Names.GuidToAuthored })
+    {
+        Bytes += Map->GetAllocatedSize();
+        for (const TPair<FString, FString>& Pair : *Map)
+        {
+            Bytes += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+        }
+    }
+    for (const TMap<FString, FProperty*>* Map : { &Names.PropertiesByName, &Names.PropertiesByFieldName })
+    {
+        Bytes += Map->GetAllocatedSize();
+        for (const TPair<FString, FProperty*>& Pair : *Map)
+        {
+            Bytes += Pair.Key.GetAllocatedSize();
+        }
+    }
+    return Bytes;
+}
+
+void FDataTableStructNameCache::Invalidate(const UScriptStruct* Struct)
+{
+    if (Struct && IsInGameThread() && RemoveMapEntry(Entries, Struct))
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+TSharedRef<const FDataTableStructNameCache::FStructNames> FDataTableStructNameCache::Build(const UScriptStruct* Struct)
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    TSharedRef<FStructNames> Names = MakeShared<FStructNames>();
+    if (!Struct)
+    {
+        return Names;
+    }
+
+    for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        const FString GuidName = Property->GetName();
+
+        FString FriendlyName = Property->GetDisplayNameText().ToString();
+        if (FriendlyName.IsEmpty())
+        {
+            // Fallback to property name without GUID
+            FriendlyName = FDataTableTransformationService::ExtractFriendlyName(GuidName);
+        }
+
+        FString CamelCaseName = FriendlyName;
+        if (!CamelCaseName.IsEmpty())
+        {
+            CamelCaseName[0] = FChar::ToLower(CamelCaseName[0]);
+        }
+
+        Names->GuidToFriendly.Add(GuidName, FriendlyName);
+        Names->GuidToCamelCaseFriendly.Add(GuidName, MoveTemp(CamelCaseName));
+        Names->FriendlyToGuid.Add(FriendlyName, GuidName);
+        Names->GuidToAuthored.Add(GuidName, Property->GetAuthoredName());
+        Names->PropertiesByName.Add(GuidName, Property);
+        Names->PropertiesByFieldName.Add(GuidName, Property);
+    }
+
+    // Friendly and authored names only fill in names no property is called
+    for (const TPair<FString, FProperty*>& Pair : Names->PropertiesByName)
+    {
+        Names->PropertiesByFieldName.FindOrAdd(Names->GuidToFriendly.FindChecked(Pair.Key), Pair.Value);
+        Names->PropertiesByFieldName.FindOrAdd(Names->GuidToAuthored.FindChecked(Pair.Key), Pair.Value);
+    }
+
+    return Names;
+}
@@ -1,4 +1,5 @@
 #include "Services/DataTableTransformationService.h"
+#include "Services/DataTableStructNameCache.h"
 #include "JsonObjectConverter.h"
 
 TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformToGuidNames(const TSharedPtr<FJsonObject>& InJson, const UScriptStruct* RowStruct)
@@ -15,8 +16,9 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformToGuidName
     
     TSharedPtr<FJsonObject> OutJson = MakeShared<FJsonObject>();
     
-    // Build mapping from friendly names to GUID names for the main struct
-    TMap<FString, FString> FriendlyToGuidMap = BuildFriendlyToGuidMap(RowStruct);
+    // Mapping from friendly names to GUID names for the main struct
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> StructNames = FDataTableStructNameCache::Get().GetNames(RowStruct);
+    const TMap<FString, FString>& FriendlyToGuidMap = StructNames->FriendlyToGuid;
     
     // Transform each field in the input JSON
     for (const auto& Pair : InJson->Values)
@@ -34,7 +36,7 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformToGuidName
         else
         {
             // This is a friendly field, try to map it to GUID
-            FString* GuidKeyPtr = FriendlyToGuidMap.Find(InputKey);
+            const FString* GuidKeyPtr = FriendlyToGuidMap.Find(InputKey);
             OutputKey = GuidKeyPtr ? *GuidKeyPtr : InputKey;
             UE_LOG(LogTemp, Warning, TEXT("AutoTransformToGuidNames: Friendly field '%s' -> '%s' (found: %s)"), *InputKey, *OutputKey, GuidKeyPtr ? TEXT("Yes") : TEXT("No"));
         }
@@ -45,18 +47,8 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformToGuidName
             const TArray<TSharedPtr<FJsonValue>>* InputArray;
             if (Pair.Value->TryGetArray(InputArray))
             {
-                // Find the array property to get its inner struct type
-                FProperty* ArrayProperty = nullptr;
-                for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
-                {
-                    // Compare using the property's actual name (which is the GUID name)
-                    if ((*PropIt)->GetName() == OutputKey)
-                    {
-                        ArrayProperty = *PropIt;
-                        UE_LOG(LogTemp, Warning, TEXT("AutoTransformToGuidNames: Found array property '%s' for output key '%s'"), *(*PropIt)->GetName(), *OutputKey);
-                        break;
-                    }
-                }
+                // Find the array property to get its inner struct type, by its actual (GUID) name
+                FProperty* ArrayProperty = StructNames->PropertiesByName.FindRef(OutputKey);
                 
                 if (!ArrayProperty)
                 {
@@ -109,9 +101,10 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformFromGuidNa
     
     TSharedPtr<FJsonObject> OutJson = MakeShared<FJsonObject>();
     
-    // Build mapping from GUID names to friendly names for the main struct
-    TMap<FString, FString> GuidToFriendlyMap = BuildGuidToFriendlyMap(RowStruct);
-    TMap<FString, FString> FriendlyToGuidMap = BuildFriendlyToGuidMap(RowStruct);
+    // Mappings between GUID names and friendly names for the main struct
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> StructNames = FDataTableStructNameCache::Get().GetNames(RowStruct);
+    const TMap<FString, FString>& GuidToFriendlyMap = StructNames->GuidToCamelCaseFriendly;
+    const TMap<FString, FString>& FriendlyToGuidMap = StructNames->FriendlyToGuid;
     
     // Track processed friendly field names to avoid duplicates
     TSet<FString> ProcessedFriendlyFields;
@@ -126,8 +119,8 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformFromGuidNa
         if (IsGuidField(InputKey))
         {
             // This is a GUID field - convert to friendly name
-            FString* FriendlyKeyPtr = GuidToFriendlyMap.Find(InputKey);
-            OutputKey = FriendlyKeyPtr ? ConvertToCamelCase(*FriendlyKeyPtr) : InputKey;
+            const FString* FriendlyKeyPtr = GuidToFriendlyMap.Find(InputKey);
+            OutputKey = FriendlyKeyPtr ? *FriendlyKeyPtr : InputKey;
             bShouldProcess = true;
             
             UE_LOG(LogTemp, Warning, TEXT("AutoTransformFromGuidNames: Converting GUID field '%s' -> '%s' (JSON type: %d)"), *InputKey, *OutputKey, (int32)Pair.Value->Type);
@@ -135,13 +128,13 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformFromGuidNa
             // Mark this friendly field as processed to avoid double processing
             if (FriendlyKeyPtr)
             {
-                ProcessedFriendlyFields.Add(ConvertToCamelCase(*FriendlyKeyPtr));
+                ProcessedFriendlyFields.Add(*FriendlyKeyPtr);
             }
         }
         else
         {
             // This might be a friendly field - check if it has a corresponding GUID field in the input
-            FString* GuidKeyPtr = FriendlyToGuidMap.Find(InputKey);
+            const FString* GuidKeyPtr = FriendlyToGuidMap.Find(InputKey);
             if (GuidKeyPtr && InJson->Values.Contains(*GuidKeyPtr))
             {
                 // Both GUID and friendly versions exist - skip friendly to avoid duplicates
@@ -179,19 +172,7 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformFromGuidNa
                 UE_LOG(LogTemp, Warning, TEXT("AutoTransformFromGuidNames: Array field '%s' has %d elements"), *InputKey, InputArray->Num());
                 
                 // Find the array property to get its inner struct type
-                FProperty* ArrayProperty = nullptr;
-                UE_LOG(LogTemp, Warning, TEXT("AutoTransformFromGuidNames: Searching for property matching InputKey '%s'"), *InputKey);
-                for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
-                {
-                    FString PropName = (*PropIt)->GetName();
-                    UE_LOG(LogTemp, Warning, TEXT("AutoTransformFromGuidNames: Checking property '%s' vs InputKey '%s'"), *PropName, *InputKey);
-                    if (PropName == InputKey)
-                    {
-                        ArrayProperty = *PropIt;
-                        UE_LOG(LogTemp, Warning, TEXT("AutoTransformFromGuidNames: Found matching property for field '%s'"), *InputKey);
-                        break;
-                    }
-                }
+                FProperty* ArrayProperty = StructNames->PropertiesByName.FindRef(InputKey);
                 
                 if (!ArrayProperty)
                 {
@@ -238,65 +219,6 @@ TSharedPtr<FJsonObject> FDataTableTransformationService::AutoTransformFromGuidNa
     return OutJson;
 }
 
-TMap<FString, FString> FDataTableTransformationService::BuildFriendlyToGuidMap(const UScriptStruct* Struct)
-{
-    TMap<FString, FString> FriendlyToGuidMap;
-    
-    UE_LOG(LogTemp, Error, TEXT("BuildFriendlyToGuidMap: Processing struct '%s'"), Struct ? *Struct->GetName() : TEXT("NULL"));
-    
-    for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        FString FriendlyName = Property->GetDisplayNameText().ToString();
-        if (FriendlyName.IsEmpty())
-        {
-            // Fallback to property name without GUID
-            FriendlyName = ExtractFriendlyName(Property->GetName());
-        }
-        
-        FString GuidName = Property->GetName();
-        FriendlyToGuidMap.Add(FriendlyName, GuidName);
-        
-        UE_LOG(LogTemp, Warning, TEXT("BuildFriendlyToGuidMap: Added mapping '%s' -> '%s'"), *FriendlyName, *GuidName);
-    }
-    
-    UE_LOG(LogTemp, Warning, TEXT("BuildFriendlyToGuidMap: Created %d mappings for struct '%s'"), FriendlyToGuidMap.Num(), *Struct->GetName());
-    return FriendlyToGuidMap;
-}
-
-TMap<FString, FString> FDataTableTransformationService::BuildGuidToFriendlyMap(const UScriptStruct* Struct)
-{
-    TMap<FString, FString> GuidToFriendlyMap;
-    
-    for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
-    {
-        FProperty* Property = *PropIt;
-        FString FriendlyName = Property->GetDisplayNameText().ToString();
-        if (FriendlyName.IsEmpty())
-        {
-            // Fallback to property name without GUID
-            FriendlyName = ExtractFriendlyName(Property->GetName());
-        }
-        
-        FString GuidName = Property->GetName();
-        GuidToFriendlyMap.Add(GuidName, FriendlyName);
-    }
-    
-    return GuidToFriendlyMap;
-}
-
-FString FDataTableTransformationService::ConvertToCamelCase(const FString& PascalCase)
-{
-    if (PascalCase.IsEmpty())
-    {
-        return PascalCase;
-    }
-    
-    FString Result = PascalCase;
-    Result[0] = FChar::ToLower(Result[0]);
-    return Result;
-}
-
 bool FDataTableTransformationService::IsGuidField(const FString& FieldName)
 {
     int32 GuidUnderscoreIndex;
@@ -335,8 +257,9 @@ TArray<TSharedPtr<FJsonValue>> FDataTableTransformationService::TransformArrayTo
     
     TArray<TSharedPtr<FJsonValue>> TransformedArray;
     
-    // Build mapping for the struct fields
-    TMap<FString, FString> StructFriendlyToGuidMap = BuildFriendlyToGuidMap(StructType);
+    // Mapping for the struct fields, shared by every element
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> StructNames = FDataTableStructNameCache::Get().GetNames(StructType);
+    const TMap<FString, FString>& StructFriendlyToGuidMap = StructNames->FriendlyToGuid;
     
     for (const auto& ArrayElement : InputArray)
     {
@@ -351,7 +274,7 @@ TArray<TSharedPtr<FJsonValue>> FDataTableTransformationService::TransformArrayTo
                 for (const auto& StructPair : (*ElementObj)->Values)
                 {
                     FString StructInputKey = StructPair.Key;
-                    FString* StructGuidKeyPtr = StructFriendlyToGuidMap.Find(StructInputKey);
+                    const FString* StructGuidKeyPtr = StructFriendlyToGuidMap.Find(StructInputKey);
                     FString StructOutputKey = StructGuidKeyPtr ? *StructGuidKeyPtr : StructInputKey;
                     
                     TransformedElement->SetField(StructOutputKey, StructPair.Value);
@@ -380,8 +303,9 @@ TArray<TSharedPtr<FJsonValue>> FDataTableTransformationService::TransformArrayFr
     
     TArray<TSharedPtr<FJsonValue>> TransformedArray;
     
-    // Build mapping for the struct fields
-    TMap<FString, FString> StructGuidToFriendlyMap = BuildGuidToFriendlyMap(StructType);
+    // Mapping for the struct fields, shared by every element
+    const TSharedRef<const FDataTableStructNameCache::FStructNames> StructNames = FDataTableStructNameCache::Get().GetNames(StructType);
+    const TMap<FString, FString>& StructGuidToFriendlyMap = StructNames->GuidToCamelCaseFriendly;
     
     UE_LOG(LogTemp, Warning, TEXT("TransformArrayFromGuidNames: Built GUID mapping with %d entries"), StructGuidToFriendlyMap.Num());
     for (const auto& MapPair : StructGuidToFriendlyMap)
@@ -407,8 +331,8 @@ TArray<TSharedPtr<FJsonValue>> FDataTableTransformationService::TransformArrayFr
                 for (const auto& StructPair : (*ElementObj)->Values)
                 {
                     FString StructInputKey = StructPair.Key;
-                    FString* StructFriendlyKeyPtr = StructGuidToFriendlyMap.Find(StructInputKey);
-                    FString StructOutputKey = StructFriendlyKeyPtr ? ConvertToCamelCase(*StructFriendlyKeyPtr) : StructInputKey;
+                    const FString* StructFriendlyKeyPtr = StructGuidToFriendlyMap.Find(StructInputKey);
+                    FString StructOutputKey = StructFriendlyKeyPtr ? *StructFriendlyKeyPtr : StructInputKey;
                     
                     UE_LOG(LogTemp, Warning, TEXT("TransformArrayFromGuidNames: Field '%s' -> '%s' (found mapping: %s)"), 
                            *StructInputKey, *StructOutputKey, StructFriendlyKeyPtr ? TEXT("Yes") : TEXT("No"));
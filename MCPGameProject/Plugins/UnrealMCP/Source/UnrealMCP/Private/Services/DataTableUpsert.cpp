@@ -0,0 +1,109 @@
+#include "Services/DataTableService.h"
+#include "Services/DataTableRowImporter.h"
+#include "Engine/DataTable.h"
+
+bool FDataTableService::UpsertRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, FDataTableUpsertResult& OutResult)
+{
+    OutResult = FDataTableUpsertResult();
+    
+    const UScriptStruct* RowStruct = DataTable ? DataTable->GetRowStruct() : nullptr;
+    if (!RowStruct)
+    {
+        UE_LOG(LogTemp, Error, TEXT("MCP DataTable: DataTable is null or has no row struct"));
+        return false;
+    }
+    
+    const double StartTime = FPlatformTime::Seconds();
+    const FDataTableRowImporter Importer(RowStruct);
+    
+    TArray<const FProperty*> Fields;
+    for (TFieldIterator<FProperty> PropIt(RowStruct); PropIt; ++PropIt)
+    {
+        Fields.Add(*PropIt);
+    }
+    
+    // The table is only marked modified once a row is actually written
+    bool bModified = false;
+    auto ModifyOnce = [DataTable, &bModified]()
+    {
+        if (!bModified)
+        {
+            DataTable->Modify(true);
+            bModified = true;
+        }
+    };
+    
+    TMap<FName, uint8*>& RowMap = const_cast<TMap<FName, uint8*>&>(DataTable->GetRowMap());
+    const int32 StructureSize = RowStruct->GetStructureSize();
+    const int32 MinAlignment = RowStruct->GetMinAlignment();
+    for (const FDataTableRowParams& RowParams : Rows)
+    {
+        FString RowError;
+        if (!RowParams.IsValid(DataTable, RowError))
+        {
+            OutResult.FailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *RowError));
+            continue;
+        }
+        
+        const FName RowName(*RowParams.RowName);
+        uint8* ExistingRow = RowMap.FindRef(RowName);
+        
+        // The row data is converted over a copy of the existing row, so only the fields it names can differ
+        uint8* RowMemory = static_cast<uint8*>(FMemory::Malloc(StructureSize, MinAlignment));
+        RowStruct->InitializeStruct(RowMemory);
+        if (ExistingRow)
+        {
+            RowStruct->CopyScriptStruct(RowMemory, ExistingRow);
+        }
+        if (!Importer.ConvertRow(*RowParams.RowData, RowMemory, RowError))
+        {
+            RowStruct->DestroyStruct(RowMemory);
+            FMemory::Free(RowMemory);
+            OutResult.FailedRows.Add(FString::Printf(TEXT("%s: %s"), *RowParams.RowName, *RowError));
+            continue;
+        }
+        
+        if (!ExistingRow)
+        {
+            ModifyOnce();
+            HandOverImportedRow(RowMap, RowStruct, RowName, RowMemory);
+            OutResult.AddedRows.Add(RowParams.RowName);
+            continue;
+        }
+        
+        int32 ChangedFields = 0;
+        for (const FProperty* Property : Fields)
+        {
+            if (!Property->Identical_InContainer(ExistingRow, RowMemory))
+            {
+                ModifyOnce();
+                Property->CopyCompleteValue_InContainer(ExistingRow, RowMemory);
+                ++ChangedFields;
+            }
+        }
+        RowStruct->DestroyStruct(RowMemory);
+        FMemory::Free(RowMemory);
+        
+        if (ChangedFields > 0)
+        {
+            OutResult.UpdatedRows.Add(RowParams.RowName);
+            OutResult.ChangedFieldCount += ChangedFields;
+        }
+        else
+        {
+            OutResult.UnchangedRows.Add(RowParams.RowName);
+        }
+    }
+    
+    UE_LOG(LogTemp, Display, TEXT("MCP DataTable: Upsert of %d rows into '%s': %d added, %d updated (%d fields), %d unchanged, %d failed in %.3f s"),
+        Rows.Num(), *DataTable->GetName(), OutResult.AddedRows.Num(), OutResult.UpdatedRows.Num(), OutResult.ChangedFieldCount,
+        OutResult.UnchangedRows.Num(), OutResult.FailedRows.Num(), FPlatformTime::Seconds() - StartTime);
+    
+    // A sync that changes nothing leaves the asset unsaved and the editor as it is
+    if (bModified)
+    {
+        FinishBulkImport(DataTable);
+    }
+    
+    return OutResult.FailedRows.Num() == 0;
+}
@@ -0,0 +1,179 @@
+#include "Services/EditorService.h"
+#include "Services/ActorIndex.h"
+#include "ConvexVolume.h"
+#include "Math/RotationMatrix.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Camera frustum as outward-facing planes, with the box around its corners */
+    void BuildFrustum(const FActorSpatialQuery& Query, FConvexVolume& OutFrustum, FBox& OutBounds)
+    {
+        const FRotationMatrix Axes(Query.Rotation);
+        const FVector Forward = Axes.GetUnitAxis(EAxis::X);
+        const FVector Right = Axes.GetUnitAxis(EAxis::Y);
+        const FVector Up = Axes.GetUnitAxis(EAxis::Z);
+        const double TanHalfFOV = FMath::Tan(FMath::DegreesToRadians(Query.FOV * 0.5));
+
+        auto Corners = [&](double Distance, FVector (&OutCorners)[4])
+        {
+            const FVector Center = Query.Origin + Forward * Distance;
+            const FVector HalfWidth = Right * (Distance * TanHalfFOV);
+            const FVector HalfHeight = Up * (Distance * TanHalfFOV / Query.AspectRatio);
+            OutCorners[0] = Center - HalfWidth + HalfHeight;
+            OutCorners[1] = Center + HalfWidth + HalfHeight;
+            OutCorners[2] = Center + HalfWidth - HalfHeight;
+            OutCorners[3] = Center - HalfWidth - HalfHeight;
+        };
+        FVector Near[4];
+        FVector Far[4];
+        Corners(Query.NearDistance, Near);
+        Corners(Query.FarDistance, Far);
+
+        OutBounds = FBox(ForceInit);
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            OutBounds += Near[Index];
+            OutBounds += Far[Index];
+        }
+
+        // Each side plane holds the camera and two far corners; flipped where needed to face out
+        const FVector Inside = Query.Origin + Forward * ((Query.NearDistance + Query.FarDistance) * 0.5);
+        OutFrustum.Planes.Reset();
+        OutFrustum.Planes.Add(FPlane(Query.Origin + Forward * Query.NearDistance, -Forward));
+        OutFrustum.Planes.Add(FPlane(Query.Origin + Forward * Query.FarDistance, Forward));
+        for (int32 Index = 0; Index < 4; ++Index)
+        {
+            FPlane Side(Query.Origin, Far[Index], Far[(Index + 1) % 4]);
+            OutFrustum.Planes.Add(Side.PlaneDot(Inside) > 0.0 ? Side.Flip() : Side);
+        }
+        OutFrustum.Init();
+    }
+
+    /** Whether an actor sits in an outliner folder or one of its subfolders */
+    bool IsInFolder(const AActor* Actor, const FString& Folder)
+    {
+        const FString ActorFolder = Actor->GetFolderPath().ToString();
+        return ActorFolder.Equals(Folder, ESearchCase::IgnoreCase)
+            || (ActorFolder.StartsWith(Folder, ESearchCase::IgnoreCase) && ActorFolder[Folder.Len()] == TEXT('/'));
+    }
+}
+
+bool FEditorService::QueryActorsSpatial(const FActorSpatialQuery& Query, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError)
+{
+    if (!Query.IsValid(OutError))
+    {
+        return false;
+    }
+
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        OutError = TEXT("Failed to get editor world");
+        return false;
+    }
+
+    FActorIndex& Index = FActorIndex::Get();
+    switch (Query.Shape)
+    {
+    case EActorSpatialShape::Box:
+        Index.FindActorsInBox(World, FBox(Query.Min, Query.Max), OutActors);
+        break;
+    case EActorSpatialShape::Sphere:
+        Index.FindActorsInSphere(World, Query.Center, Query.Radius, OutActors);
+        break;
+    case EActorSpatialShape::Frustum:
+    {
+        FConvexVolume Frustum;
+        FBox FrustumBounds;
+        BuildFrustum(Query, Frustum, FrustumBounds);
+        Index.FindActorsInVolume(World, Frustum, FrustumBounds, OutActors);
+        break;
+    }
+    case EActorSpatialShape::Nearest:
+    {
+        TArray<TPair<AActor*, double>> Nearest;
+        Index.FindNearestActors(World, Query.Center, Query.Count, Query.Radius, Nearest);
+        for (const TPair<AActor*, double>& Entry : Nearest)
+        {
+            OutActors.Add(Entry.Key);
+            OutDistances.Add(Entry.Value);
+        }
+        break;
+    }
+    }
+    return true;
+}
+
+bool FEditorService::FindActors(const FActorListFilter& Filter, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError)
+{
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        OutError = TEXT("Failed to get editor world");
+        return false;
+    }
+
+    UClass* ActorClass = nullptr;
+    if (!Filter.ClassName.IsEmpty())
+    {
+        ActorClass = GetActorClassFromType(Filter.ClassName);
+        if (!ActorClass)
+        {
+            // Plain class names, including loaded Blueprint classes ("BP_Door_C")
+            ActorClass = FindFirstObject<UClass>(*Filter.ClassName, EFindFirstObjectOptions::NativeFirst);
+        }
+        if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+        {
+            OutError = FString::Printf(TEXT("Unknown actor class: %s"), *Filter.ClassName);
+            return false;
+        }
+    }
+
+    const FName Tag = Filter.Tag.IsEmpty() ? NAME_None : FName(*Filter.Tag);
+    FString Folder = Filter.Folder;
+    Folder.RemoveFromEnd(TEXT("/"));
+
+    // Start from the narrowest candidate set an index gives, then check every filter
+    TArray<AActor*> Candidates;
+    TArray<double> CandidateDistances;
+    FActorIndex& Index = FActorIndex::Get();
+    if (Filter.Region.IsSet())
+    {
+        if (!QueryActorsSpatial(Filter.Region.GetValue(), Candidates, CandidateDistances, OutError))
+        {
+            return false;
+        }
+    }
+    else if (ActorClass)
+    {
+        Index.FindActorsOfClass(World, ActorClass, Candidates);
+    }
+    else if (!Tag.IsNone())
+    {
+        Index.FindActorsWithTag(World, Tag, Candidates);
+    }
+    else
+    {
+        Candidates = GetActorsInLevel();
+    }
+
+    for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex)
+    {
+        AActor* Actor = Candidates[CandidateIndex];
+        if (!Actor
+            || (ActorClass && !Actor->IsA(ActorClass))
+            || (!Tag.IsNone() && !Actor->ActorHasTag(Tag))
+            || (!Folder.IsEmpty() && !IsInFolder(Actor, Folder))
+            || (!Filter.NamePattern.IsEmpty() && !Actor->GetName().MatchesWildcard(Filter.NamePattern)))
+        {
+            continue;
+        }
+        OutActors.Add(Actor);
+        if (CandidateDistances.IsValidIndex(CandidateIndex))
+        {
+            OutDistances.Add(CandidateDistances[CandidateIndex]);
+        }
+    }
+    return true;
+}
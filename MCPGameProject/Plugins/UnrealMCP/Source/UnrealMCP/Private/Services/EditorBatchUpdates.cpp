@@ -0,0 +1,224 @@
+#include "Services/EditorService.h"
+#include "MCPBatchEditScope.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "Subsystems/EditorActorSubsystem.h"
+
+namespace
+{
+    /** Refresh the outliner and viewports once, when the outermost batch scope closes */
+    void DeferLevelEditorRefresh(UWorld* World)
+    {
+#if WITH_EDITOR
+        if (GEditor && World)
+        {
+            FMCPBatchEditScope::Defer(World, TEXT("RefreshLevelEditor"), []()
+            {
+                GEditor->BroadcastLevelActorListChanged();
+                GEditor->RedrawLevelEditingViewports();
+            });
+        }
+#endif
+    }
+}
+
+int32 FEditorService::SetActorTransforms(const TArray<FActorTransformUpdate>& Updates, TArray<FString>& OutErrors)
+{
+    OutErrors.Reset();
+    OutErrors.SetNum(Updates.Num());
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Move %d Actors"), Updates.Num())));
+
+    int32 UpdatedCount = 0;
+    for (int32 UpdateIndex = 0; UpdateIndex < Updates.Num(); ++UpdateIndex)
+    {
+        const FActorTransformUpdate& Update = Updates[UpdateIndex];
+        AActor* Actor = FindActorByName(Update.ActorName);
+        if (!Actor)
+        {
+            OutErrors[UpdateIndex] = FString::Printf(TEXT("Actor not found: %s"), *Update.ActorName);
+            continue;
+        }
+
+        FTransform NewTransform = Actor->GetTransform();
+        if (Update.Location.IsSet())
+        {
+            NewTransform.SetLocation(Update.Location.GetValue());
+        }
+        if (Update.Rotation.IsSet())
+        {
+            NewTransform.SetRotation(FQuat(Update.Rotation.GetValue()));
+        }
+        if (Update.Scale.IsSet())
+        {
+            NewTransform.SetScale3D(Update.Scale.GetValue());
+        }
+
+        // The transform lives on the root component, so both go into the transaction
+        Actor->Modify();
+        if (USceneComponent* Root = Actor->GetRootComponent())
+        {
+            Root->Modify();
+        }
+
+        Actor->SetActorTransform(NewTransform, false, nullptr, ETeleportType::TeleportPhysics);
+#if WITH_EDITOR
+        Actor->PostEditMove(true);
+#endif
+
+        // Lets the spatial actor index see the move, as a move in the viewport would
+        if (GEngine)
+        {
+            GEngine->BroadcastOnActorMoved(Actor);
+        }
+        ++UpdatedCount;
+    }
+
+    if (UpdatedCount > 0)
+    {
+        DeferLevelEditorRefresh(GetEditorWorld());
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Editor: Moved %d of %d actors"), UpdatedCount, Updates.Num());
+    return UpdatedCount;
+}
+
+int32 FEditorService::SetActorProperties(const TArray<FActorPropertyUpdate>& Updates, TArray<FString>& OutErrors)
+{
+    OutErrors.Reset();
+    OutErrors.SetNum(Updates.Num());
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Set Properties On %d Actors"), Updates.Num())));
+
+    int32 UpdatedCount = 0;
+    bool bAnyChanged = false;
+    for (int32 UpdateIndex = 0; UpdateIndex < Updates.Num(); ++UpdateIndex)
+    {
+        const FActorPropertyUpdate& Update = Updates[UpdateIndex];
+        AActor* Actor = FindActorByName(Update.ActorName);
+        if (!Actor)
+        {
+            OutErrors[UpdateIndex] = FString::Printf(TEXT("Actor not found: %s"), *Update.ActorName);
+            continue;
+        }
+        if (Update.Properties.Num() == 0)
+        {
+            OutErrors[UpdateIndex] = TEXT("No properties to set");
+            continue;
+        }
+
+        Actor->Modify();
+#if WITH_EDITOR
+        Actor->PreEditChange(nullptr);
+#endif
+
+        TArray<FString> PropertyErrors;
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Update.Properties)
+        {
+            FString PropertyError;
+            if (!FUnrealMCPCommonUtils::SetObjectProperty(Actor, Property.Key, Property.Value, PropertyError))
+            {
+                PropertyErrors.Add(FString::Printf(TEXT("%s: %s"), *Property.Key, *PropertyError));
+            }
+        }
+
+        // One change notification per actor, so construction scripts rerun once
+#if WITH_EDITOR
+        Actor->PostEditChange();
+#endif
+        bAnyChanged |= PropertyErrors.Num() < Update.Properties.Num();
+
+        if (PropertyErrors.Num() > 0)
+        {
+            OutErrors[UpdateIndex] = FString::Join(PropertyErrors, TEXT("; "));
+            continue;
+        }
+        ++UpdatedCount;
+    }
+
+    if (bAnyChanged)
+    {
+        DeferLevelEditorRefresh(GetEditorWorld());
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Editor: Set properties on %d of %d actors"), UpdatedCount, Updates.Num());
+    return UpdatedCount;
+}
+
+int32 FEditorService::DeleteActors(const TArray<FString>& ActorNames, bool bCollectGarbage, TArray<FString>& OutErrors)
+{
+    OutErrors.Reset();
+    OutErrors.SetNum(ActorNames.Num());
+
+    TArray<AActor*> ActorsToDelete;
+    TArray<int32> ActorNameIndices;
+    ActorsToDelete.Reserve(ActorNames.Num());
+    ActorNameIndices.Reserve(ActorNames.Num());
+    TSet<AActor*> SeenActors;
+    for (int32 NameIndex = 0; NameIndex < ActorNames.Num(); ++NameIndex)
+    {
+        AActor* Actor = FindActorByName(ActorNames[NameIndex]);
+        if (!Actor)
+        {
+            OutErrors[NameIndex] = FString::Printf(TEXT("Actor not found: %s"), *ActorNames[NameIndex]);
+            continue;
+        }
+
+        bool bAlreadyListed = false;
+        SeenActors.Add(Actor, &bAlreadyListed);
+        if (bAlreadyListed)
+        {
+            OutErrors[NameIndex] = FString::Printf(TEXT("Actor listed more than once: %s"), *ActorNames[NameIndex]);
+            continue;
+        }
+        ActorsToDelete.Add(Actor);
+        ActorNameIndices.Add(NameIndex);
+    }
+
+    if (ActorsToDelete.Num() == 0)
+    {
+        return 0;
+    }
+
+    UEditorActorSubsystem* ActorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UEditorActorSubsystem>() : nullptr;
+    if (!ActorSubsystem)
+    {
+        for (int32 NameIndex : ActorNameIndices)
+        {
+            OutErrors[NameIndex] = TEXT("Editor actor subsystem is not available");
+        }
+        return 0;
+    }
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Delete %d Actors"), ActorsToDelete.Num())));
+
+    // One editor delete for all actors: one selection change, one outliner rebuild, one level dirty
+    ActorSubsystem->DestroyActors(ActorsToDelete);
+
+    int32 DeletedCount = 0;
+    for (int32 ActorIndex = 0; ActorIndex < ActorsToDelete.Num(); ++ActorIndex)
+    {
+        AActor* Actor = ActorsToDelete[ActorIndex];
+        const FString& ActorName = ActorNames[ActorNameIndices[ActorIndex]];
+        if (IsValid(Actor) && !Actor->IsActorBeingDestroyed())
+        {
+            OutErrors[ActorNameIndices[ActorIndex]] = FString::Printf(TEXT("Editor refused to delete: %s"), *ActorName);
+            continue;
+        }
+
+        // Destroyed actors keep their names until garbage collection; renaming frees them now, as DeleteActor does
+        Actor->Rename(*FString::Printf(TEXT("PendingDelete_%s_%d"), *ActorName, FMath::Rand()), nullptr, REN_DontCreateRedirectors);
+        ++DeletedCount;
+    }
+
+    if (bCollectGarbage && DeletedCount > 0 && GEngine)
+    {
+        // Full purge on the next tick, once, instead of waiting for the periodic collection
+        GEngine->ForceGarbageCollection(true);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Editor: Deleted %d of %d actors"), DeletedCount, ActorNames.Num());
+    return DeletedCount;
+}
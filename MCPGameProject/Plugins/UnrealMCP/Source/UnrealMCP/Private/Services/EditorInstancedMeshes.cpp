@@ -0,0 +1,202 @@
+#include "Services/EditorService.h"
+#include "MCPBatchEditScope.h"
+#include "Editor.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Materials/MaterialInterface.h"
+
+AActor* FEditorService::SpawnInstancedMeshActor(const FString& Name, const TArray<FInstancedMeshGroup>& Groups, bool bHierarchical, TArray<FString>& OutComponentNames, FString& OutError)
+{
+    OutComponentNames.Reset();
+
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        OutError = TEXT("Failed to get editor world");
+        return nullptr;
+    }
+
+    if (Groups.Num() == 0)
+    {
+        OutError = TEXT("No mesh instances to spawn");
+        return nullptr;
+    }
+
+    if (FindActorByName(Name))
+    {
+        OutError = FString::Printf(TEXT("Actor with name '%s' already exists"), *Name);
+        return nullptr;
+    }
+
+    // Every mesh is loaded before anything is spawned, so a bad path leaves the level untouched
+    TArray<UStaticMesh*> Meshes;
+    Meshes.Reserve(Groups.Num());
+    for (const FInstancedMeshGroup& Group : Groups)
+    {
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *Group.MeshPath);
+        if (!Mesh)
+        {
+            OutError = FString::Printf(TEXT("Static mesh not found: %s"), *Group.MeshPath);
+            return nullptr;
+        }
+        Meshes.Add(Mesh);
+    }
+
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Spawn Instanced Meshes: %s"), *Name)));
+
+    FActorSpawnParameters SpawnParameters;
+    SpawnParameters.Name = *Name;
+    AActor* NewActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+    if (!NewActor)
+    {
+        OutError = TEXT("Failed to spawn actor");
+        return nullptr;
+    }
+
+    // Instances do not move, so the root and every instanced component are static
+    USceneComponent* Root = NewObject<USceneComponent>(NewActor, TEXT("Root"), RF_Transactional);
+    Root->SetMobility(EComponentMobility::Static);
+    NewActor->SetRootComponent(Root);
+    NewActor->AddInstanceComponent(Root);
+    Root->RegisterComponent();
+
+    UClass* ComponentClass = bHierarchical
+        ? UHierarchicalInstancedStaticMeshComponent::StaticClass()
+        : UInstancedStaticMeshComponent::StaticClass();
+
+    for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+    {
+        const FInstancedMeshGroup& Group = Groups[GroupIndex];
+        UStaticMesh* Mesh = Meshes[GroupIndex];
+
+        const FName ComponentName = MakeUniqueObjectName(NewActor, ComponentClass,
+            FName(*FString::Printf(TEXT("%s_%s"), bHierarchical ? TEXT("HISM") : TEXT("ISM"), *Mesh->GetName())));
+        UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(NewActor, ComponentClass, ComponentName, RF_Transactional);
+        Component->SetMobility(EComponentMobility::Static);
+        Component->SetupAttachment(Root);
+        Component->SetStaticMesh(Mesh);
+        for (int32 Slot = 0; Slot < Group.MaterialPaths.Num(); ++Slot)
+        {
+            if (Group.MaterialPaths[Slot].IsEmpty())
+            {
+                continue;
+            }
+            if (UMaterialInterface* Material = LoadObject<UMaterialInterface>(nullptr, *Group.MaterialPaths[Slot]))
+            {
+                Component->SetMaterial(Slot, Material);
+            }
+        }
+
+        NewActor->AddInstanceComponent(Component);
+        Component->RegisterComponent();
+
+        // All instances in one call: one render state update and, for HISM, one cluster tree build
+        Component->AddInstances(Group.Transforms, false, true);
+        OutComponentNames.Add(Component->GetName());
+    }
+
+    NewActor->SetActorLabel(Name);
+
+#if WITH_EDITOR
+    if (GEditor)
+    {
+        FMCPBatchEditScope::Defer(World, TEXT("RefreshLevelEditor"), []()
+        {
+            GEditor->BroadcastLevelActorListChanged();
+            GEditor->RedrawLevelEditingViewports();
+        });
+    }
+#endif
+
+    return NewActor;
+}
+
+AActor* FEditorService::ConvertActorsToInstances(const TArray<FString>& ActorNames, const FString& InstancedActorName, bool bHierarchical, bool bDeleteSourceActors, TArray<FString>& OutConvertedActors, TArray<FString>& OutSkippedActors, FString& OutError)
+{
+    OutConvertedActors.Reset();
+    OutSkippedActors.Reset();
+
+    if (FindActorByName(InstancedActorName))
+    {
+        OutError = FString::Printf(TEXT("Actor with name '%s' already exists"), *InstancedActorName);
+        return nullptr;
+    }
+
+    // Actors share a component when they use the same mesh and the same materials
+    TArray<FInstancedMeshGroup> Groups;
+    TMap<FString, int32> GroupIndexByKey;
+    for (const FString& ActorName : ActorNames)
+    {
+        AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(FindActorByName(ActorName));
+        UStaticMeshComponent* MeshComponent = MeshActor ? MeshActor->GetStaticMeshComponent() : nullptr;
+        UStaticMesh* Mesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+        if (!Mesh)
+        {
+            OutSkippedActors.Add(FString::Printf(TEXT("%s: %s"), *ActorName,
+                !MeshActor ? TEXT("not a StaticMeshActor in the level") : TEXT("has no static mesh")));
+            continue;
+        }
+
+        // Only slots whose material differs from the mesh's are overrides worth keeping
+        TArray<FString> MaterialPaths;
+        for (int32 Slot = 0; Slot < MeshComponent->GetNumMaterials(); ++Slot)
+        {
+            UMaterialInterface* Material = MeshComponent->GetMaterial(Slot);
+            const bool bOverridden = Material && Material != Mesh->GetMaterial(Slot);
+            MaterialPaths.Add(bOverridden ? Material->GetPathName() : FString());
+        }
+        while (MaterialPaths.Num() > 0 && MaterialPaths.Last().IsEmpty())
+        {
+            MaterialPaths.Pop();
+        }
+
+        const FString GroupKey = Mesh->GetPathName() + TEXT("|") + FString::Join(MaterialPaths, TEXT("|"));
+        int32& GroupIndex = GroupIndexByKey.FindOrAdd(GroupKey, INDEX_NONE);
+        if (GroupIndex == INDEX_NONE)
+        {
+            GroupIndex = Groups.Num();
+            FInstancedMeshGroup& NewGroup = Groups.AddDefaulted_GetRef();
+            NewGroup.MeshPath = Mesh->GetPathName();
+            NewGroup.MaterialPaths = MoveTemp(MaterialPaths);
+        }
+        Groups[GroupIndex].Transforms.Add(MeshComponent->GetComponentTransform());
+        OutConvertedActors.Add(ActorName);
+    }
+
+    if (Groups.Num() == 0)
+    {
+        OutError = TEXT("None of the actors is a StaticMeshActor with a mesh");
+        return nullptr;
+    }
+
+    // Spawning the instances and deleting the sources is one undo step
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Convert %d Actors To Instances"), OutConvertedActors.Num())));
+
+    TArray<FString> ComponentNames;
+    AActor* InstancedActor = SpawnInstancedMeshActor(InstancedActorName, Groups, bHierarchical, ComponentNames, OutError);
+    if (!InstancedActor)
+    {
+        OutConvertedActors.Reset();
+        return nullptr;
+    }
+
+    if (bDeleteSourceActors)
+    {
+        for (const FString& ActorName : OutConvertedActors)
+        {
+            FString DeleteError;
+            if (!DeleteActor(ActorName, DeleteError))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("MCP Editor: Converted actor '%s' was not deleted: %s"), *ActorName, *DeleteError);
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Editor: Converted %d actors into %d instanced components on '%s'"),
+        OutConvertedActors.Num(), Groups.Num(), *InstancedActorName);
+    return InstancedActor;
+}
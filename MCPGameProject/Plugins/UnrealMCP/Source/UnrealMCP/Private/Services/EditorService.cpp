@@ -1,5 +1,7 @@
 #include "Services/EditorService.h"
 #include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/ActorIndex.h"
+#include "MCPBatchEditScope.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
 #include "LevelEditorViewport.h"
@@ -114,17 +116,7 @@ TArray<AActor*> FEditorService::FindActorsByName(const FString& Pattern)
 
 AActor* FEditorService::FindActorByName(const FString& ActorName)
 {
-    TArray<AActor*> AllActors = GetActorsInLevel();
-    
-    for (AActor* Actor : AllActors)
-    {
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return Actor;
-        }
-    }
-    
-    return nullptr;
+    return FActorIndex::Get().FindActorByName(GetEditorWorld(), ActorName);
 }
 
 UClass* FEditorService::GetActorClassFromType(const FString& TypeString) const
@@ -517,15 +509,8 @@ void FEditorService::ConfigureSpawnedActor(AActor* NewActor, const FActorSpawnPa
     }
 }
 
-AActor* FEditorService::SpawnActor(const FActorSpawnParams& Params, FString& OutError)
+FActorSpawnParams FEditorService::ApplySpawnTypeDefaults(const FActorSpawnParams& Params) const
 {
-    UClass* ActorClass = GetActorClassFromType(Params.Type);
-    if (!ActorClass)
-    {
-        OutError = FString::Printf(TEXT("Unknown actor type: %s. Supported types include StaticMeshActor, TriggerBox, PlayerStart, InvisibleWall, etc. Use 'Blueprint:/Game/Path' for Blueprints or 'Class:/Script/Module.ClassName' for any native class."), *Params.Type);
-        return nullptr;
-    }
-
     // Create a mutable copy of params to apply defaults for special types
     FActorSpawnParams ModifiedParams = Params;
 
@@ -545,9 +530,104 @@ AActor* FEditorService::SpawnActor(const FActorSpawnParams& Params, FString& Out
         ModifiedParams.bShowCollisionInEditor = true;
     }
 
+    return ModifiedParams;
+}
+
+AActor* FEditorService::SpawnActor(const FActorSpawnParams& Params, FString& OutError)
+{
+    UClass* ActorClass = GetActorClassFromType(Params.Type);
+    if (!ActorClass)
+    {
+        OutError = FString::Printf(TEXT("Unknown actor type: %s. Supported types include StaticMeshActor, TriggerBox, PlayerStart, InvisibleWall, etc. Use 'Blueprint:/Game/Path' for Blueprints or 'Class:/Script/Module.ClassName' for any native class."), *Params.Type);
+        return nullptr;
+    }
+
+    const FActorSpawnParams ModifiedParams = ApplySpawnTypeDefaults(Params);
     return SpawnActorOfType(ActorClass, ModifiedParams.Name, ModifiedParams.Location, ModifiedParams.Rotation, ModifiedParams.Scale, ModifiedParams, OutError);
 }
 
+TArray<AActor*> FEditorService::SpawnActorsDeferred(const TArray<FActorSpawnParams>& ParamsList, TArray<FString>& OutErrors)
+{
+    TArray<AActor*> SpawnedActors;
+    SpawnedActors.Init(nullptr, ParamsList.Num());
+    OutErrors.Init(FString(), ParamsList.Num());
+
+    UWorld* World = GetEditorWorld();
+    if (!World)
+    {
+        for (FString& Error : OutErrors)
+        {
+            Error = TEXT("Failed to get editor world");
+        }
+        return SpawnedActors;
+    }
+
+    // One undo entry for the whole layout; viewport and outliner refreshes wait for the scope to close
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Batch Spawn Actors (%d)"), ParamsList.Num())));
+
+    // First pass: every actor is created and configured without running construction or
+    // registering components, so mesh and collision settings are in place before either happens
+    TArray<FTransform> SpawnTransforms;
+    SpawnTransforms.SetNum(ParamsList.Num());
+    for (int32 Index = 0; Index < ParamsList.Num(); ++Index)
+    {
+        const FActorSpawnParams Params = ApplySpawnTypeDefaults(ParamsList[Index]);
+
+        UClass* ActorClass = GetActorClassFromType(Params.Type);
+        if (!ActorClass)
+        {
+            OutErrors[Index] = FString::Printf(TEXT("Unknown actor type: %s"), *Params.Type);
+            continue;
+        }
+
+        // Actors spawned earlier in the batch are already in their level's object hash
+        if (FindActorByName(Params.Name))
+        {
+            OutErrors[Index] = FString::Printf(TEXT("Actor with name '%s' already exists"), *Params.Name);
+            continue;
+        }
+
+        FActorSpawnParameters SpawnParameters;
+        SpawnParameters.Name = *Params.Name;
+        SpawnParameters.bDeferConstruction = true;
+
+        // The scale goes in with the spawn transform instead of a second transform update
+        SpawnTransforms[Index] = FTransform(Params.Rotation, Params.Location, Params.Scale);
+        AActor* NewActor = World->SpawnActor(ActorClass, &SpawnTransforms[Index], SpawnParameters);
+        if (!NewActor)
+        {
+            OutErrors[Index] = TEXT("Failed to spawn actor");
+            continue;
+        }
+
+        ConfigureSpawnedActor(NewActor, Params);
+        SpawnedActors[Index] = NewActor;
+    }
+
+    // Second pass: construction scripts and component registration for the whole batch back to back
+    for (int32 Index = 0; Index < ParamsList.Num(); ++Index)
+    {
+        if (AActor* NewActor = SpawnedActors[Index])
+        {
+            NewActor->FinishSpawning(SpawnTransforms[Index]);
+            NewActor->SetActorLabel(ParamsList[Index].Name, false);
+        }
+    }
+
+#if WITH_EDITOR
+    if (GEditor)
+    {
+        FMCPBatchEditScope::Defer(World, TEXT("RefreshLevelEditor"), []()
+        {
+            GEditor->BroadcastLevelActorListChanged();
+            GEditor->RedrawLevelEditingViewports();
+        });
+    }
+#endif
+
+    return SpawnedActors;
+}
+
 AActor* FEditorService::SpawnBlueprintActor(const FBlueprintActorSpawnParams& Params, FString& OutError)
 {
     // Find the blueprint
@@ -644,6 +724,12 @@ bool FEditorService::SetActorTransform(AActor* Actor, const FVector* Location, c
     }
     
     Actor->SetActorTransform(NewTransform);
+
+    // Lets the spatial actor index see the move, as a move in the viewport would
+    if (GEngine)
+    {
+        GEngine->BroadcastOnActorMoved(Actor);
+    }
     return true;
 }
 
@@ -82,3 +82,54 @@ bool FBlueprintActorSpawnParams::IsValid(FString& OutError) const
     
     return true;
 }
+
+bool FActorSpatialQuery::IsValid(FString& OutError) const
+{
+    switch (Shape)
+    {
+    case EActorSpatialShape::Box:
+        if (Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z)
+        {
+            OutError = TEXT("Box min must not exceed max on any axis");
+            return false;
+        }
+        break;
+    case EActorSpatialShape::Sphere:
+        if (Radius <= 0.0)
+        {
+            OutError = TEXT("Sphere radius must be greater than 0");
+            return false;
+        }
+        break;
+    case EActorSpatialShape::Frustum:
+        if (FOV <= 0.0f || FOV >= 180.0f)
+        {
+            OutError = TEXT("Frustum fov must be between 0 and 180 degrees");
+            return false;
+        }
+        if (AspectRatio <= 0.0f)
+        {
+            OutError = TEXT("Frustum aspect_ratio must be greater than 0");
+            return false;
+        }
+        if (NearDistance < 0.0f || FarDistance <= NearDistance)
+        {
+            OutError = TEXT("Frustum far_distance must be greater than near_distance, which must not be negative");
+            return false;
+        }
+        break;
+    case EActorSpatialShape::Nearest:
+        if (Count <= 0)
+        {
+            OutError = TEXT("Nearest count must be greater than 0");
+            return false;
+        }
+        if (Radius < 0.0)
+        {
+            OutError = TEXT("Nearest max_distance must not be negative");
+            return false;
+        }
+        break;
+    }
+    return true;
+}
@@ -0,0 +1,358 @@
+#include "Services/GraphFingerprintCache.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Hash/xxhash.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Hash input with the helpers a node hash needs; every variable-length value is followed by its length */
+    class FFingerprintBuilder
+    {
+    public:
+        template <typename ValueType>
+        void Add(ValueType Value)
+        {
+            static_assert(std::is_trivially_copyable_v<ValueType> && !std::is_pointer_v<ValueType>, "Only plain values are hashed by their bytes");
+            Builder.Update(&Value, sizeof(ValueType));
+        }
+
+        void Add(const FString& Value)
+        {
+            Builder.Update(*Value, Value.Len() * sizeof(TCHAR));
+            Add(Value.Len());
+        }
+
+        void Add(FName Value)
+        {
+            Add(Value.ToString());
+        }
+
+        /** Objects by path, which is the same in every session */
+        void AddObject(const UObject* Object)
+        {
+            Add(Object ? Object->GetPathName() : FString());
+        }
+
+        uint64 Finalize() const
+        {
+            return Builder.Finalize().Hash;
+        }
+
+    private:
+        FXxHash64Builder Builder;
+    };
+}
+
+FGraphFingerprintCache& FGraphFingerprintCache::Get()
+{
+    static FGraphFingerprintCache Instance;
+    return Instance;
+}
+
+void FGraphFingerprintCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FGraphFingerprintCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGraphFingerprintCache::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FGraphFingerprintCache::HandleUndoRedo);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("graph_fingerprint_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Entries.Num()); });
+    FMCPCacheBudget::Get().Register(TEXT("graph_fingerprint_cache"), *this);
+}
+
+void FGraphFingerprintCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("graph_fingerprint_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("graph_fingerprint_cache"));
+
+    for (TPair<const UEdGraph*, FGraphEntry>& Pair : Entries)
+    {
+        if (UEdGraph* Graph = Pair.Value.Graph.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(Pair.Value.GraphChangedHandle);
+        }
+    }
+    Entries.Empty();
+    ResetUsedBytes();
+}
+
+uint64 FGraphFingerprintCache::GetFingerprint(UEdGraph* Graph)
+{
+    check(IsInGameThread());
+    check(Graph);
+
+    FGraphEntry UncachedEntry;
+    FGraphEntry* Entry = &UncachedEntry;
+    if (bInitialized)
+    {
+        Entry = Entries.Find(Graph);
+        if (Entry && Entry->Graph.Get() != Graph)
+        {
+            // A new graph at the address of a destroyed one
+            RemoveMapEntry(Entries, Graph);
+            Entry = nullptr;
+        }
+        if (!Entry)
+        {
+            Entry = &Entries.Add(Graph);
+            Entry->Graph = Graph;
+            Entry->Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
+            Entry->GraphChangedHandle = Graph->AddOnGraphChangedHandler(
+                FOnGraphChanged::FDelegate::CreateRaw(this, &FGraphFingerprintCache::HandleGraphChanged));
+        }
+
+        Entry->LastUse = FMCPCacheBudget::NextUse();
+
+        // Node count catches nodes added or removed without a notification
+        if (Entry->bCurrent && Entry->NodeCount == Graph->Nodes.Num())
+        {
+            CacheCounters.RecordHit();
+            return Entry->Fingerprint;
+        }
+        CacheCounters.RecordMiss();
+    }
+
+    // Rehash the nodes changed since the last query; hashes of nodes no longer in the graph are dropped
+    TMap<const UEdGraphNode*, uint64> NodeHashes;
+    NodeHashes.Reserve(Graph->Nodes.Num());
+    TArray<uint64> SortedHashes;
+    SortedHashes.Reserve(Graph->Nodes.Num());
+    for (const UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node)
+        {
+            continue;
+        }
+        const uint64* Known = Entry->NodeHashes.Find(Node);
+        const uint64 NodeHash = Known ? *Known : HashNode(Node);
+        NodeHashes.Add(Node, NodeHash);
+        SortedHashes.Add(NodeHash);
+    }
+    SortedHashes.Sort();
+
+    Entry->NodeHashes = MoveTemp(NodeHashes);
+    Entry->Fingerprint = FXxHash64::HashBuffer(SortedHashes.GetData(), SortedHashes.Num() * sizeof(uint64)).Hash;
+    Entry->NodeCount = Graph->Nodes.Num();
+    Entry->bCurrent = true;
+    const int64 Bytes = sizeof(FGraphEntry) + Entry->NodeHashes.GetAllocatedSize();
+    if (Entry != &UncachedEntry)
+    {
+        AddUsedBytes(Bytes - Entry->Bytes);
+    }
+    Entry->Bytes = Bytes;
+    return Entry->Fingerprint;
+}
+
+void FGraphFingerprintCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    GetMapUses(Entries, OutUses);
+}
+
+int64 FGraphFingerprintCache::EvictUsedBefore(uint64 Stamp)
+{
+    int64 Freed = 0;
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().LastUse < Stamp)
+        {
+            if (UEdGraph* Graph = It.Value().Graph.Get())
+            {
+                Graph->RemoveOnGraphChangedHandler(It.Value().GraphChangedHandle);
+            }
+            Freed += It.Value().Bytes;
+            It.RemoveCurrent();
+        }
+    }
+    AddUsedBytes(-Freed);
+    return Freed;
+}
+
+FString FGraphFingerprintCache::ToString(uint64 Fingerprint)
+{
+    return FString::Printf(TEXT("%016llx"), Fingerprint);
+}
+
+void FGraphFingerprintCache::Invalidate(UEdGraph* Graph)
+{
+    if (!Graph || !IsInGameThread())
+    {
+        return;
+    }
+    if (FGraphEntry* Entry = Entries.Find(Graph))
+    {
+        Reset(*Entry);
+    }
+}
+
+void FGraphFingerprintCache::Invalidate(UBlueprint* Blueprint)
+{
+    if (!Blueprint || !IsInGameThread())
+    {
+        return;
+    }
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        // Entries of destroyed graphs are dropped on the way
+        if (!It.Value().Graph.IsValid())
+        {
+            AddUsedBytes(-It.Value().Bytes);
+            It.RemoveCurrent();
+        }
+        else if (It.Value().Blueprint.Get() == Blueprint)
+        {
+            Reset(It.Value());
+        }
+    }
+}
+
+uint64 FGraphFingerprintCache::HashNode(const UEdGraphNode* Node)
+{
+    FFingerprintBuilder Builder;
+    Builder.AddObject(Node->GetClass());
+    Builder.Add(Node->NodeGuid);
+    Builder.Add(Node->NodePosX);
+    Builder.Add(Node->NodePosY);
+    Builder.Add(Node->NodeComment);
+    Builder.Add(static_cast<uint8>(Node->GetDesiredEnabledState()));
+    Builder.Add(Node->Pins.Num());
+
+    TArray<FGuid> LinkedPinIds;
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin)
+        {
+            continue;
+        }
+        Builder.Add(Pin->PinName);
+        Builder.Add(static_cast<uint8>(Pin->Direction));
+        Builder.Add(Pin->PinType.PinCategory);
+        Builder.Add(Pin->PinType.PinSubCategory);
+        Builder.AddObject(Pin->PinType.PinSubCategoryObject.Get());
+        Builder.Add(static_cast<uint8>(Pin->PinType.ContainerType));
+        Builder.Add(Pin->PinType.bIsReference);
+        Builder.Add(Pin->DefaultValue);
+        Builder.AddObject(Pin->DefaultObject.Get());
+        Builder.Add(Pin->DefaultTextValue.ToString());
+        Builder.Add(Pin->bHidden);
+        Builder.Add(Pin->bOrphanedPin);
+
+        // Links by the linked pin's id, sorted, since LinkedTo order is not content
+        LinkedPinIds.Reset();
+        for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+        {
+            if (LinkedPin)
+            {
+                LinkedPinIds.Add(LinkedPin->PinId);
+            }
+        }
+        LinkedPinIds.Sort([](const FGuid& A, const FGuid& B) { return A < B; });
+        Builder.Add(LinkedPinIds.Num());
+        for (const FGuid& LinkedPinId : LinkedPinIds)
+        {
+            Builder.Add(LinkedPinId);
+        }
+    }
+    return Builder.Finalize();
+}
+
+void FGraphFingerprintCache::Reset(FGraphEntry& Entry)
+{
+    if (Entry.bCurrent || Entry.NodeHashes.Num() > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    Entry.NodeHashes.Reset();
+    Entry.bCurrent = false;
+}
+
+void FGraphFingerprintCache::HandleGraphChanged(const FEdGraphEditAction& Action)
+{
+    FGraphEntry* Entry = Action.Graph ? Entries.Find(Action.Graph) : nullptr;
+    if (!Entry)
+    {
+        return;
+    }
+
+    // Notifications without nodes (UEdGraph::NotifyGraphChanged()) may stand for any edit
+    if (Action.Nodes.Num() == 0)
+    {
+        Reset(*Entry);
+        return;
+    }
+    for (const UEdGraphNode* Node : Action.Nodes)
+    {
+        Entry->NodeHashes.Remove(Node);
+    }
+    Entry->bCurrent = false;
+}
+
+void FGraphFingerprintCache::HandleObjectModified(UObject* Object)
+{
+    if (Entries.Num() == 0)
+    {
+        return;
+    }
+
+    if (const UEdGraphNode* Node = Cast<UEdGraphNode>(Object))
+    {
+        if (FGraphEntry* Entry = Entries.Find(Node->GetGraph()))
+        {
+            Entry->NodeHashes.Remove(Node);
+            Entry->bCurrent = false;
+        }
+    }
+    else if (const UEdGraph* Graph = Cast<UEdGraph>(Object))
+    {
+        // Adding and removing nodes modifies the graph; the nodes themselves are unchanged
+        if (FGraphEntry* Entry = Entries.Find(Graph))
+        {
+            Entry->bCurrent = false;
+        }
+    }
+    else if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        Invalidate(Blueprint);
+    }
+}
+
+void FGraphFingerprintCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // FBlueprintEditorUtils::MarkBlueprintAsModified ends in PostEditChangeProperty, even for links made without Modify
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        Invalidate(Blueprint);
+    }
+}
+
+void FGraphFingerprintCache::HandleUndoRedo()
+{
+    for (TPair<const UEdGraph*, FGraphEntry>& Pair : Entries)
+    {
+        Reset(Pair.Value);
+    }
+}
@@ -0,0 +1,303 @@
+#include "Services/GraphReachabilityCache.h"
+#include "Services/GraphFingerprintCache.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "MCPLogging.h"
+#include "UObject/UObjectGlobals.h"
+#include "Utils/GraphUtils.h"
+
+FGraphReachabilityCache& FGraphReachabilityCache::Get()
+{
+    static FGraphReachabilityCache Instance;
+    return Instance;
+}
+
+void FGraphReachabilityCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FGraphReachabilityCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FGraphReachabilityCache::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FGraphReachabilityCache::HandleUndoRedo);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("graph_reachability_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Analyses.Num()); });
+    FMCPCacheBudget::Get().Register(TEXT("graph_reachability_cache"), *this);
+}
+
+void FGraphReachabilityCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("graph_reachability_cache"));
+    FMCPCacheBudget::Get().Unregister(TEXT("graph_reachability_cache"));
+
+    Analyses.Empty();
+    ResetUsedBytes();
+}
+
+const FGraphReachabilityCache::FAnalysis& FGraphReachabilityCache::Analyze(UEdGraph* Graph)
+{
+    check(IsInGameThread());
+    check(Graph);
+
+    // Without the change handlers a cached analysis could go stale unnoticed
+    if (!bInitialized)
+    {
+        Compute(Graph, UncachedAnalysis);
+        return UncachedAnalysis;
+    }
+
+    if (FCachedAnalysis* Cached = Analyses.Find(Graph))
+    {
+        // The fingerprint catches edits that neither modified an object nor went through MCP
+        if (Cached->Graph.Get() == Graph && Cached->Fingerprint == FGraphFingerprintCache::Get().GetFingerprint(Graph))
+        {
+            CacheCounters.RecordHit();
+            Cached->LastUse = FMCPCacheBudget::NextUse();
+            return Cached->Analysis;
+        }
+    }
+
+    CacheCounters.RecordMiss();
+    RemoveMapEntry(Analyses, Graph);
+    FCachedAnalysis& Cached = Analyses.Add(Graph);
+    Cached.Graph = Graph;
+    Cached.Blueprint = FBlueprintEditorUtils::FindBlueprintForGraph(Graph);
+    Cached.Fingerprint = FGraphFingerprintCache::Get().GetFingerprint(Graph);
+    Compute(Graph, Cached.Analysis);
+    Cached.LastUse = FMCPCacheBudget::NextUse();
+    Cached.Bytes = sizeof(FCachedAnalysis) + GetAnalysisSize(Cached.Analysis);
+    AddUsedBytes(Cached.Bytes);
+    return Cached.Analysis;
+}
+
+void FGraphReachabilityCache::GetCacheUses(TArray<FMCPCacheUse>& OutUses) const
+{
+    GetMapUses(Analyses, OutUses);
+}
+
+int64 FGraphReachabilityCache::EvictUsedBefore(uint64 Stamp)
+{
+    return EvictMapUsedBefore(Analyses, Stamp);
+}
+
+int64 FGraphReachabilityCache::GetAnalysisSize(const FAnalysis& Analysis)
+{
+    int64 Bytes = Analysis.OrphanedNodes.GetAllocatedSize() + Analysis.OrphanedPinNodes.GetAllocatedSize();
+    for (const FOrphanedPinNode& PinNode : Analysis.OrphanedPinNodes)
+    {
+        Bytes += GetStringsSize(PinNode.PinNames);
+    }
+    return Bytes;
+}
+
+void FGraphReachabilityCache::Invalidate(UBlueprint* Blueprint)
+{
+    if (!Blueprint || !IsInGameThread())
+    {
+        return;
+    }
+
+    for (auto It = Analyses.CreateIterator(); It; ++It)
+    {
+        const UBlueprint* CachedBlueprint = It.Value().Blueprint.Get();
+        if (!CachedBlueprint || CachedBlueprint == Blueprint)
+        {
+            AddUsedBytes(-It.Value().Bytes);
+            It.RemoveCurrent();
+            CacheCounters.RecordInvalidation();
+        }
+    }
+}
+
+void FGraphReachabilityCache::Compute(UEdGraph* Graph, FAnalysis& OutAnalysis)
+{
+    OutAnalysis = FAnalysis();
+
+    // Forward along exec links from the entry points; each node is pushed once
+    TSet<UEdGraphNode*> Reachable;
+    TArray<UEdGraphNode*> Stack;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && FGraphUtils::IsEntryPoint(Node))
+        {
+            Reachable.Add(Node);
+            Stack.Add(Node);
+        }
+    }
+    OutAnalysis.EntryPointCount = Stack.Num();
+
+    while (Stack.Num() > 0)
+    {
+        UEdGraphNode* Current = Stack.Pop(EAllowShrinking::No);
+        for (UEdGraphPin* Pin : Current->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+            {
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNodeUnchecked() : nullptr;
+                bool bAlreadyReached = true;
+                if (LinkedNode)
+                {
+                    Reachable.Add(LinkedNode, &bAlreadyReached);
+                }
+                if (!bAlreadyReached)
+                {
+                    Stack.Add(LinkedNode);
+                }
+            }
+        }
+    }
+    OutAnalysis.ExecReachableCount = Reachable.Num();
+
+    // Backward along data links to the pure nodes feeding executed ones; non-pure nodes off the
+    // exec path are visited, but not followed
+    TSet<UEdGraphNode*> Visited = Reachable;
+    Stack = Reachable.Array();
+    while (Stack.Num() > 0)
+    {
+        UEdGraphNode* Current = Stack.Pop(EAllowShrinking::No);
+        for (UEdGraphPin* Pin : Current->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            {
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                UEdGraphNode* LinkedNode = LinkedPin ? LinkedPin->GetOwningNodeUnchecked() : nullptr;
+                bool bAlreadyVisited = true;
+                if (LinkedNode)
+                {
+                    Visited.Add(LinkedNode, &bAlreadyVisited);
+                }
+                if (!bAlreadyVisited && FGraphUtils::IsPureNode(LinkedNode))
+                {
+                    Reachable.Add(LinkedNode);
+                    Stack.Add(LinkedNode);
+                }
+            }
+        }
+    }
+    OutAnalysis.DataDependencyCount = Reachable.Num() - OutAnalysis.ExecReachableCount;
+
+    // One pass over every pin for connection counts, purity and orphaned pins
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (!Node)
+        {
+            continue;
+        }
+
+        bool bHasExecPin = false;
+        int32 InputConnections = 0;
+        int32 OutputConnections = 0;
+        TArray<FString> OrphanedPinNames;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+            bHasExecPin |= Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+            if (Pin->Direction == EGPD_Input)
+            {
+                InputConnections += Pin->LinkedTo.Num();
+            }
+            else
+            {
+                OutputConnections += Pin->LinkedTo.Num();
+            }
+            if (Pin->bOrphanedPin)
+            {
+                OrphanedPinNames.Add(Pin->PinName.ToString());
+            }
+        }
+
+        if (OrphanedPinNames.Num() > 0)
+        {
+            OutAnalysis.OrphanedPinNodes.Add({Node, MoveTemp(OrphanedPinNames)});
+        }
+
+        // Without entry points reachability says nothing; comments are not executable but not orphaned either
+        if (OutAnalysis.EntryPointCount == 0 || Reachable.Contains(Node) || Node->GetClass()->GetName().Contains(TEXT("Comment")))
+        {
+            continue;
+        }
+
+        FOrphanedNode& Orphan = OutAnalysis.OrphanedNodes.AddDefaulted_GetRef();
+        Orphan.Node = Node;
+        Orphan.bPure = !bHasExecPin;
+        Orphan.InputConnections = InputConnections;
+        Orphan.OutputConnections = OutputConnections;
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("GraphReachabilityCache: Graph '%s' - %d entry points, %d exec-reachable, %d data deps, %d orphaned, %d with orphaned pins"),
+        *Graph->GetName(), OutAnalysis.EntryPointCount, OutAnalysis.ExecReachableCount, OutAnalysis.DataDependencyCount,
+        OutAnalysis.OrphanedNodes.Num(), OutAnalysis.OrphanedPinNodes.Num());
+}
+
+void FGraphReachabilityCache::HandleObjectModified(UObject* Object)
+{
+    if (Analyses.Num() == 0)
+    {
+        return;
+    }
+
+    const UEdGraphNode* Node = Cast<UEdGraphNode>(Object);
+    if (const UEdGraph* Graph = Node ? Node->GetGraph() : Cast<UEdGraph>(Object))
+    {
+        if (RemoveMapEntry(Analyses, Graph))
+        {
+            CacheCounters.RecordInvalidation();
+        }
+    }
+    else if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        Invalidate(Blueprint);
+    }
+}
+
+void FGraphReachabilityCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // FBlueprintEditorUtils::MarkBlueprintAsModified ends in PostEditChangeProperty, even for links made without Modify
+    if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+    {
+        Invalidate(Blueprint);
+    }
+}
+
+void FGraphReachabilityCache::HandleUndoRedo()
+{
+    if (Analyses.Num() > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    Analyses.Empty();
+    ResetUsedBytes();
+}
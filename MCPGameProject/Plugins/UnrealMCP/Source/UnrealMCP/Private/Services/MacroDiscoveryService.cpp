@@ -4,10 +4,179 @@
 #include "Editor/EditorEngine.h"
 #include "Misc/Paths.h"
 
+/**
+ * Macro graphs of the macro libraries the asset registry knows (engine StandardMacros first, then
+ * project and plugin libraries) by graph name, case-insensitive. Built by the first lookup, which
+ * loads the libraries; dropped when a Blueprint asset is added, removed or renamed. Entries are
+ * checked against their library before use, so a graph renamed or removed since is rebuilt over,
+ * and a graph added to a loaded library is found by the fallback search, which drops the index too.
+ * Game thread only.
+ */
+class FMacroDiscoveryService::FMacroLibraryIndex
+{
+public:
+    static FMacroLibraryIndex& Get()
+    {
+        static FMacroLibraryIndex Instance;
+        return Instance;
+    }
+
+    /** The macro graph going by a name, preferring StandardMacros; nullptr if none */
+    UEdGraph* FindGraph(const FString& MacroGraphName, UBlueprint* InBlueprint = nullptr)
+    {
+        check(IsInGameThread());
+        for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+        {
+            EnsureBuilt();
+            bool bStale = false;
+            if (const TArray<FIndexedGraph>* Graphs = GraphsByName.Find(MacroGraphName))
+            {
+                for (const FIndexedGraph& Indexed : *Graphs)
+                {
+                    UBlueprint* Blueprint = Indexed.Blueprint.Get();
+                    UEdGraph* Graph = Indexed.Graph.Get();
+                    if (!Blueprint || !Graph || !Blueprint->MacroGraphs.Contains(Graph) || !Graph->GetFName().ToString().Equals(MacroGraphName, ESearchCase::IgnoreCase))
+                    {
+                        bStale = true;
+                        continue;
+                    }
+                    if (!InBlueprint || InBlueprint == Blueprint)
+                    {
+                        return Graph;
+                    }
+                }
+            }
+            if (!bStale)
+            {
+                return nullptr;
+            }
+            Invalidate();
+        }
+        return nullptr;
+    }
+
+    void Invalidate()
+    {
+        GraphsByName.Empty();
+        bBuilt = false;
+    }
+
+    void Shutdown()
+    {
+        if (AssetAddedHandle.IsValid())
+        {
+            // The asset registry may already be gone during editor shutdown
+            if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+            {
+                AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+                AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+                AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+            }
+            AssetAddedHandle.Reset();
+            AssetRemovedHandle.Reset();
+            AssetRenamedHandle.Reset();
+        }
+        Invalidate();
+    }
+
+private:
+    struct FIndexedGraph
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        TWeakObjectPtr<UEdGraph> Graph;
+    };
+
+    void EnsureBuilt()
+    {
+        if (bBuilt)
+        {
+            return;
+        }
+
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        if (!AssetAddedHandle.IsValid())
+        {
+            AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMacroLibraryIndex::HandleAssetChanged);
+            AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FMacroLibraryIndex::HandleAssetChanged);
+            AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FMacroLibraryIndex::HandleAssetRenamed);
+        }
+
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.TagsAndValues.Add(FBlueprintTags::BlueprintType, TEXT("BPTYPE_MacroLibrary"));
+        TArray<FAssetData> Libraries;
+        AssetRegistry.GetAssets(Filter, Libraries);
+
+        // StandardMacros first, as the common-path search always found it first
+        TArray<FSoftObjectPath> LibraryPaths;
+        LibraryPaths.Add(FSoftObjectPath(TEXT("/Engine/EditorBlueprintResources/StandardMacros.StandardMacros")));
+        for (const FAssetData& Library : Libraries)
+        {
+            LibraryPaths.AddUnique(Library.GetSoftObjectPath());
+        }
+
+        int32 GraphCount = 0;
+        for (const FSoftObjectPath& LibraryPath : LibraryPaths)
+        {
+            UBlueprint* Blueprint = Cast<UBlueprint>(LibraryPath.TryLoad());
+            if (!Blueprint)
+            {
+                continue;
+            }
+            for (UEdGraph* MacroGraph : Blueprint->MacroGraphs)
+            {
+                if (MacroGraph)
+                {
+                    GraphsByName.FindOrAdd(MacroGraph->GetFName().ToString()).Add({ Blueprint, MacroGraph });
+                    ++GraphCount;
+                }
+            }
+        }
+        bBuilt = true;
+
+        UE_LOG(LogTemp, Display, TEXT("MacroDiscoveryService: Indexed %d macro graphs in %d macro libraries"), GraphCount, LibraryPaths.Num());
+    }
+
+    void HandleAssetChanged(const FAssetData& AssetData)
+    {
+        if (bBuilt && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+        {
+            Invalidate();
+        }
+    }
+
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+    {
+        HandleAssetChanged(AssetData);
+    }
+
+    /** Graph names compare case-insensitively as FString keys */
+    TMap<FString, TArray<FIndexedGraph>> GraphsByName;
+    bool bBuilt = false;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
+
+void FMacroDiscoveryService::ShutdownMacroIndex()
+{
+    check(IsInGameThread());
+    FMacroLibraryIndex::Get().Shutdown();
+}
+
 UBlueprint* FMacroDiscoveryService::FindMacroBlueprint(const FString& MacroName)
 {
     UE_LOG(LogTemp, Display, TEXT("MacroDiscoveryService: Searching for macro blueprint: %s"), *MacroName);
     
+    // Strategy 0: The macro library index
+    if (UEdGraph* IndexedGraph = FMacroLibraryIndex::Get().FindGraph(MapFunctionNameToMacroGraphName(MacroName)))
+    {
+        UBlueprint* IndexedBlueprint = CastChecked<UBlueprint>(IndexedGraph->GetOuter());
+        UE_LOG(LogTemp, Display, TEXT("MacroDiscoveryService: Found macro via library index: %s"), *IndexedBlueprint->GetName());
+        return IndexedBlueprint;
+    }
+    
     // Strategy 1: Try loading from common macro paths
     UBlueprint* MacroBlueprint = TryLoadMacroFromCommonPaths(MacroName);
     if (MacroBlueprint)
@@ -36,6 +205,11 @@ UEdGraph* FMacroDiscoveryService::FindMacroGraph(UBlueprint* MacroBlueprint, con
         return nullptr;
     }
     
+    if (UEdGraph* IndexedGraph = FMacroLibraryIndex::Get().FindGraph(MacroGraphName, MacroBlueprint))
+    {
+        return IndexedGraph;
+    }
+    
     UE_LOG(LogTemp, Display, TEXT("MacroDiscoveryService: Searching for macro graph '%s' in blueprint with %d graphs"), 
            *MacroGraphName, MacroBlueprint->MacroGraphs.Num());
     
@@ -45,6 +219,12 @@ UEdGraph* FMacroDiscoveryService::FindMacroGraph(UBlueprint* MacroBlueprint, con
         if (MacroGraph && MacroGraph->GetFName().ToString().Equals(MacroGraphName, ESearchCase::IgnoreCase))
         {
             UE_LOG(LogTemp, Display, TEXT("MacroDiscoveryService: Found macro graph: %s"), *MacroGraphName);
+            
+            // A macro library graph the index missed was added since it was built
+            if (MacroBlueprint->BlueprintType == BPTYPE_MacroLibrary)
+            {
+                FMacroLibraryIndex::Get().Invalidate();
+            }
             return MacroGraph;
         }
         
@@ -113,8 +293,8 @@ TArray<FString> FMacroDiscoveryService::FindAllMacroBlueprints(const FString& Se
 
 bool FMacroDiscoveryService::IsMacroFunction(const FString& FunctionName)
 {
-    // Check against known macro function names
-    static TArray<FString> KnownMacros = {
+    // Known macro function names; FString set lookups are case-insensitive
+    static const TSet<FString> KnownMacros = {
         TEXT("Loop"), TEXT("For Loop"), TEXT("ForLoop"),
         TEXT("Loop with Break"), TEXT("LoopWithBreak"),
         TEXT("For Loop with Break"), TEXT("ForLoopWithBreak"),
@@ -128,15 +308,7 @@ bool FMacroDiscoveryService::IsMacroFunction(const FString& FunctionName)
         TEXT("Flip Flop"), TEXT("FlipFlop")
     };
     
-    for (const FString& KnownMacro : KnownMacros)
-    {
-        if (FunctionName.Equals(KnownMacro, ESearchCase::IgnoreCase))
-        {
-            return true;
-        }
-    }
-    
-    return false;
+    return KnownMacros.Contains(FunctionName);
 }
 
 TArray<FString> FMacroDiscoveryService::GetMacroSearchPaths()
@@ -160,7 +332,7 @@ TArray<FString> FMacroDiscoveryService::GetMacroSearchPaths()
 FString FMacroDiscoveryService::MapFunctionNameToMacroGraphName(const FString& FunctionName)
 {
     // Map common function name variations to their actual macro graph names
-    static TMap<FString, FString> NameMappings = {
+    static const TMap<FString, FString> NameMappings = {
         {TEXT("For Each Loop"), TEXT("ForEachLoop")},
         {TEXT("ForEachLoop"), TEXT("ForEachLoop")},
         {TEXT("For Loop"), TEXT("ForLoop")},
@@ -184,12 +356,10 @@ FString FMacroDiscoveryService::MapFunctionNameToMacroGraphName(const FString& F
         {TEXT("FlipFlop"), TEXT("FlipFlop")}
     };
     
-    for (const auto& Mapping : NameMappings)
+    // FString map lookups are case-insensitive
+    if (const FString* MacroGraphName = NameMappings.Find(FunctionName))
     {
-        if (FunctionName.Equals(Mapping.Key, ESearchCase::IgnoreCase))
-        {
-            return Mapping.Value;
-        }
+        return *MacroGraphName;
     }
     
     // If no mapping found, return the original name
@@ -0,0 +1,124 @@
+#include "Services/MaterialExpressionService.h"
+#include "MaterialShared.h"
+#include "ShaderCompiler.h"
+#include "Dom/JsonValue.h"
+
+bool FMaterialExpressionService::StartCompileMaterial(
+    const FString& MaterialPath,
+    TSharedPtr<FJsonObject>& OutResult,
+    FString& OutError)
+{
+    UMaterial* Material = FindAndValidateMaterial(MaterialPath, OutError);
+    if (!Material)
+    {
+        return false;
+    }
+
+    // PostEditChange only queues the shader maps; the workers compile them while the editor keeps ticking
+    RecompileMaterial(Material);
+
+    if (FEditSession* Session = EditSessions.Find(Material))
+    {
+        Session->PendingEdits = 0;
+    }
+
+    if (CompileJobs.Num() >= MaxCompileJobs)
+    {
+        int64 OldestJobId = MAX_int64;
+        for (const TPair<int64, FCompileJob>& Job : CompileJobs)
+        {
+            OldestJobId = FMath::Min(OldestJobId, Job.Key);
+        }
+        CompileJobs.Remove(OldestJobId);
+    }
+
+    const int64 JobId = NextCompileJobId++;
+    FCompileJob& Job = CompileJobs.Add(JobId);
+    Job.Material = Material;
+    Job.MaterialPath = MaterialPath;
+    Job.StartTime = FPlatformTime::Seconds();
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetBoolField(TEXT("success"), true);
+    OutResult->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutResult->SetStringField(TEXT("material_path"), MaterialPath);
+    OutResult->SetStringField(TEXT("status"), TEXT("compiling"));
+    OutResult->SetStringField(TEXT("message"), TEXT("Material compile started; poll get_material_compile_status for the result"));
+
+    UE_LOG(LogTemp, Log, TEXT("Started async compile %lld of material %s"), JobId, *MaterialPath);
+    return true;
+}
+
+bool FMaterialExpressionService::GetCompileJobStatus(
+    int64 JobId,
+    TSharedPtr<FJsonObject>& OutResult,
+    FString& OutError)
+{
+    FCompileJob* Job = CompileJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown compile job: %lld"), JobId);
+        return false;
+    }
+    if (Job->FinishedResult.IsValid())
+    {
+        OutResult = Job->FinishedResult;
+        return true;
+    }
+
+    UMaterial* Material = Job->Material.Get();
+    if (!Material)
+    {
+        OutError = FString::Printf(TEXT("Material of compile job %lld no longer exists: %s"), JobId, *Job->MaterialPath);
+        CompileJobs.Remove(JobId);
+        return false;
+    }
+
+    // Same resources CollectCompileErrors reads: the current shader platform at every quality level
+    const EShaderPlatform ShaderPlatform = GetFeatureLevelShaderPlatform(GMaxRHIFeatureLevel);
+    int32 CompilingResources = 0;
+    for (int32 QualityLevel = 0; QualityLevel < EMaterialQualityLevel::Num; ++QualityLevel)
+    {
+        const FMaterialResource* MaterialResource = Material->GetMaterialResource(ShaderPlatform, (EMaterialQualityLevel::Type)QualityLevel);
+        if (MaterialResource && !MaterialResource->IsCompilationFinished())
+        {
+            ++CompilingResources;
+        }
+    }
+
+    const double ElapsedSeconds = FPlatformTime::Seconds() - Job->StartTime;
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutResult->SetStringField(TEXT("material_path"), Job->MaterialPath);
+    OutResult->SetNumberField(TEXT("elapsed_seconds"), ElapsedSeconds);
+
+    if (CompilingResources > 0)
+    {
+        OutResult->SetBoolField(TEXT("success"), true);
+        OutResult->SetStringField(TEXT("status"), TEXT("compiling"));
+        OutResult->SetNumberField(TEXT("compiling_resources"), CompilingResources);
+        // The manager counts jobs of every asset; there is no per-material figure
+        OutResult->SetNumberField(TEXT("outstanding_shader_jobs"), GShaderCompilingManager ? GShaderCompilingManager->GetNumRemainingJobs() : 0);
+        return true;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> CompileErrorsArray;
+    TArray<TSharedPtr<FJsonValue>> ExpressionErrorsArray;
+    const bool bHasCompileErrors = CollectCompileErrors(Material, CompileErrorsArray, ExpressionErrorsArray);
+
+    OutResult->SetBoolField(TEXT("success"), !bHasCompileErrors);
+    OutResult->SetStringField(TEXT("status"), TEXT("finished"));
+    OutResult->SetArrayField(TEXT("compile_errors"), CompileErrorsArray);
+    OutResult->SetArrayField(TEXT("expression_errors"), ExpressionErrorsArray);
+    OutResult->SetBoolField(TEXT("has_compile_errors"), bHasCompileErrors);
+    OutResult->SetNumberField(TEXT("compile_error_count"), CompileErrorsArray.Num());
+    OutResult->SetStringField(TEXT("message"), bHasCompileErrors
+        ? FString::Printf(TEXT("Material has %d compile errors"), CompileErrorsArray.Num())
+        : TEXT("Material compiled successfully"));
+    Job->FinishedResult = OutResult;
+
+    UE_LOG(LogTemp, Log, TEXT("Async compile %lld of material %s finished after %.1fs with %d errors"),
+        JobId, *Job->MaterialPath, ElapsedSeconds, CompileErrorsArray.Num());
+    return true;
+}
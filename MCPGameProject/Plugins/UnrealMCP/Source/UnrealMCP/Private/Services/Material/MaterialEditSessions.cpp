@@ -0,0 +1,213 @@
+#include "Services/MaterialExpressionService.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+
+static TAutoConsoleVariable<float> CVarMCPMaterialEditSessionIdleSeconds(
+    TEXT("mcp.MaterialEditSessionIdleSeconds"),
+    300.0f,
+    TEXT("Seconds without an edit after which a material edit session ends on its own, recompiling and saving the material; 0 keeps sessions open until ended"),
+    ECVF_Default);
+
+bool FMaterialExpressionService::BeginEditSession(const FString& MaterialPath, FString& OutError)
+{
+    UMaterial* Material = FindAndValidateMaterial(MaterialPath, OutError);
+    if (!Material)
+    {
+        return false;
+    }
+
+    FEditSession& Session = EditSessions.FindOrAdd(Material);
+    Session.LastEditTime = FPlatformTime::Seconds();
+
+    if (!EditSessionTickerHandle.IsValid())
+    {
+        EditSessionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMaterialExpressionService::TickEditSessions), 1.0f);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Material edit session open: %s"), *Material->GetPathName());
+    return true;
+}
+
+bool FMaterialExpressionService::EndEditSession(const FString& MaterialPath, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    UMaterial* Material = FindAndValidateMaterial(MaterialPath, OutError);
+    if (!Material)
+    {
+        return false;
+    }
+
+    FEditSession Session;
+    if (!EditSessions.RemoveAndCopyValue(Material, Session))
+    {
+        OutError = FString::Printf(TEXT("Material has no open edit session: %s"), *MaterialPath);
+        return false;
+    }
+
+    // Edits already recompiled by compile_material only still need their save
+    if (Session.PendingEdits > 0)
+    {
+        if (!CompileMaterial(MaterialPath, OutResult, OutError))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        OutResult = MakeShared<FJsonObject>();
+        OutResult->SetBoolField(TEXT("success"), true);
+        OutResult->SetStringField(TEXT("material_path"), MaterialPath);
+    }
+    if (Session.bNeedsSave)
+    {
+        SaveMaterialPackage(Material);
+    }
+
+    OutResult->SetBoolField(TEXT("recompiled"), Session.PendingEdits > 0);
+    OutResult->SetNumberField(TEXT("deferred_edits"), Session.PendingEdits);
+    OutResult->SetBoolField(TEXT("saved"), Session.bNeedsSave);
+
+    UE_LOG(LogTemp, Log, TEXT("Material edit session ended: %s (%d deferred edits)"), *Material->GetPathName(), Session.PendingEdits);
+    return true;
+}
+
+void FMaterialExpressionService::EndAllEditSessions()
+{
+    TArray<TWeakObjectPtr<UMaterial>> Materials;
+    EditSessions.GetKeys(Materials);
+    for (const TWeakObjectPtr<UMaterial>& Material : Materials)
+    {
+        if (!Material.IsValid())
+        {
+            EditSessions.Remove(Material);
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> Result;
+        FString Error;
+        if (!EndEditSession(Material->GetPathName(), Result, Error))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to end material edit session: %s"), *Error);
+            EditSessions.Remove(Material);
+        }
+    }
+
+    if (EditSessionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(EditSessionTickerHandle);
+        EditSessionTickerHandle.Reset();
+    }
+}
+
+bool FMaterialExpressionService::TickEditSessions(float DeltaTime)
+{
+    // Sessions start and end on the game thread, and so does the core ticker
+    const float IdleSeconds = CVarMCPMaterialEditSessionIdleSeconds.GetValueOnGameThread();
+    const double IdleBefore = FPlatformTime::Seconds() - IdleSeconds;
+
+    TArray<TWeakObjectPtr<UMaterial>> Expired;
+    for (const TPair<TWeakObjectPtr<UMaterial>, FEditSession>& Session : EditSessions)
+    {
+        if (!Session.Key.IsValid() || (IdleSeconds > 0.0f && Session.Value.LastEditTime < IdleBefore))
+        {
+            Expired.Add(Session.Key);
+        }
+    }
+
+    for (const TWeakObjectPtr<UMaterial>& Material : Expired)
+    {
+        if (!Material.IsValid())
+        {
+            EditSessions.Remove(Material);
+            continue;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("Material edit session idle for %.0f seconds, ending: %s"), IdleSeconds, *Material->GetPathName());
+        TSharedPtr<FJsonObject> Result;
+        FString Error;
+        if (!EndEditSession(Material->GetPathName(), Result, Error))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Failed to end idle material edit session: %s"), *Error);
+            EditSessions.Remove(Material);
+        }
+    }
+
+    if (EditSessions.Num() == 0)
+    {
+        EditSessionTickerHandle.Reset();
+        return false;
+    }
+    return true;
+}
+
+void FMaterialExpressionService::CommitMaterialEdit(UMaterial* Material)
+{
+    if (!Material)
+    {
+        return;
+    }
+
+    if (FEditSession* Session = EditSessions.Find(Material))
+    {
+        // The graph stays current for the user; the shader compile and the save wait for the session
+        RefreshMaterialGraph(Material);
+        ++Session->PendingEdits;
+        Session->bNeedsSave = true;
+        Session->LastEditTime = FPlatformTime::Seconds();
+        return;
+    }
+
+    if (FMCPBatchEditScope::IsActive())
+    {
+        RefreshMaterialGraph(Material);
+        FMCPBatchEditScope::Defer(Material, TEXT("RecompileMaterial"), [this, WeakMaterial = TWeakObjectPtr<UMaterial>(Material)]()
+        {
+            if (UMaterial* EditedMaterial = WeakMaterial.Get())
+            {
+                RecompileMaterial(EditedMaterial);
+                if (!FMCPSaveQueue::Get().Enqueue(EditedMaterial))
+                {
+                    SaveMaterialPackage(EditedMaterial);
+                }
+            }
+        });
+        return;
+    }
+
+    RecompileMaterial(Material);
+    SaveMaterialPackage(Material);
+}
+
+void FMaterialExpressionService::NoteEditInSession(const FString& MaterialPath)
+{
+    if (EditSessions.Num() == 0)
+    {
+        return;
+    }
+
+    FString Error;
+    if (UMaterial* Material = FindAndValidateMaterial(MaterialPath, Error))
+    {
+        if (FEditSession* Session = EditSessions.Find(Material))
+        {
+            ++Session->PendingEdits;
+            Session->LastEditTime = FPlatformTime::Seconds();
+        }
+    }
+}
+
+void FMaterialExpressionService::SaveMaterialPackage(UMaterial* Material)
+{
+    UPackage* Package = Material ? Material->GetOutermost() : nullptr;
+    if (!Package)
+    {
+        return;
+    }
+
+    FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Standalone;
+    UPackage::SavePackage(Package, Material, *PackageFileName, SaveArgs);
+}
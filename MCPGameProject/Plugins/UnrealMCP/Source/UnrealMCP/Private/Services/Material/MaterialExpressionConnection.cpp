@@ -4,6 +4,7 @@
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Misc/PackageName.h"
 #include "UObject/SavePackage.h"
+#include "MCPBatchEditScope.h"
 
 bool FMaterialExpressionService::ConnectExpressions(
     const FMaterialExpressionConnectionParams& Params,
@@ -101,10 +102,11 @@ bool FMaterialExpressionService::ConnectExpressions(
     // Do NOT call RebuildGraph() here as it destroys/recreates all nodes, causing UI issues
     Material->MaterialGraph->Modify();
     Material->MaterialGraph->LinkGraphNodesFromMaterial();
-    Material->MaterialGraph->NotifyGraphChanged();
+    FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
 
     // Mark package dirty (let user save when ready)
     Material->MarkPackageDirty();
+    NoteEditInSession(Params.MaterialPath);
 
     UE_LOG(LogTemp, Log, TEXT("Connected expressions in material %s: %s -> %s.%s"),
         *Params.MaterialPath, *SourceExpr->GetName(), *TargetExpr->GetName(), *Params.TargetInputName);
@@ -207,10 +209,11 @@ bool FMaterialExpressionService::ConnectExpressionsBatch(
     EnsureMaterialGraph(Material);
     Material->MaterialGraph->Modify();
     Material->MaterialGraph->LinkGraphNodesFromMaterial();
-    Material->MaterialGraph->NotifyGraphChanged();
+    FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
 
     // Mark dirty (let user save when ready)
     Material->MarkPackageDirty();
+    NoteEditInSession(MaterialPath);
 
     UE_LOG(LogTemp, Log, TEXT("Batch connected %d/%d expressions in material %s"),
         SuccessCount, Connections.Num(), *MaterialPath);
@@ -276,10 +279,11 @@ bool FMaterialExpressionService::ConnectToMaterialOutput(
     EnsureMaterialGraph(Material);
     Material->MaterialGraph->Modify();
     Material->MaterialGraph->LinkGraphNodesFromMaterial();
-    Material->MaterialGraph->NotifyGraphChanged();
+    FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
 
     // Mark package dirty (let user save when ready)
     Material->MarkPackageDirty();
+    NoteEditInSession(MaterialPath);
 
     UE_LOG(LogTemp, Log, TEXT("Connected expression %s to %s in material %s"),
         *Expression->GetName(), *MaterialProperty, *MaterialPath);
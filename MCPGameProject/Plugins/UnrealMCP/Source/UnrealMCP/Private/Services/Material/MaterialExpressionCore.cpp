@@ -35,6 +35,7 @@
 #include "Materials/MaterialExpressionOneMinus.h"
 #include "Materials/MaterialExpressionSine.h"
 #include "Materials/MaterialExpressionFrac.h"
+#include "MCPBatchEditScope.h"
 // Particle/VFX expressions
 #include "Materials/MaterialExpressionParticleColor.h"
 #include "Materials/MaterialExpressionVertexColor.h"
@@ -330,6 +331,18 @@ void FMaterialExpressionService::RecompileMaterial(UMaterial* Material)
     // Notify the material that it has changed
     Material->PostEditChange();
 
+    RefreshMaterialGraph(Material);
+
+    UE_LOG(LogTemp, Log, TEXT("Material recompiled and editor notified: %s"), *Material->GetName());
+}
+
+void FMaterialExpressionService::RefreshMaterialGraph(UMaterial* Material)
+{
+    if (!Material)
+    {
+        return;
+    }
+
     // Mark the package as dirty
     Material->MarkPackageDirty();
 
@@ -345,7 +358,7 @@ void FMaterialExpressionService::RecompileMaterial(UMaterial* Material)
 
         // NotifyGraphChanged triggers the Slate SGraphEditor widget to refresh
         // This is the key step that makes changes appear in the Material Editor UI
-        Material->MaterialGraph->NotifyGraphChanged();
+        FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
     }
 
     // Notify any open Material Editor to refresh its view
@@ -378,6 +391,4 @@ void FMaterialExpressionService::RecompileMaterial(UMaterial* Material)
         // Refresh expression previews to show updated connections
         MaterialEditor->ForceRefreshExpressionPreviews();
     }
-
-    UE_LOG(LogTemp, Log, TEXT("Material recompiled and editor notified: %s"), *Material->GetName());
 }
@@ -18,6 +18,7 @@
 #include "Materials/MaterialExpressionComponentMask.h"
 #include "Materials/MaterialExpressionTextureCoordinate.h"
 #include "Materials/MaterialExpressionPanner.h"
+#include "MCPBatchEditScope.h"
 // Material Function support
 #include "Materials/MaterialExpressionMaterialFunctionCall.h"
 #include "Materials/MaterialFunctionInterface.h"
@@ -434,36 +435,24 @@ bool FMaterialExpressionService::ApplyExpressionProperties(UMaterialExpression*
     return true;
 }
 
-UMaterialExpression* FMaterialExpressionService::AddExpression(
-    const FMaterialExpressionCreationParams& Params,
-    TSharedPtr<FJsonObject>& OutExpressionInfo,
+UMaterialExpression* FMaterialExpressionService::CreateExpressionInMaterial(
+    UMaterial* Material,
+    const TSharedPtr<IMaterialEditor>& MaterialEditor,
+    const FString& ExpressionType,
+    const FVector2D& Position,
+    const TSharedPtr<FJsonObject>& Properties,
     FString& OutError)
 {
-    // Validate parameters
-    if (!Params.IsValid(OutError))
-    {
-        return nullptr;
-    }
-
-    // Find the working material (editor's transient copy if editor is open)
-    // Also get the MaterialEditor pointer if it's open
-    TSharedPtr<IMaterialEditor> MaterialEditor;
-    UMaterial* Material = FindWorkingMaterial(Params.MaterialPath, OutError, &MaterialEditor);
-    if (!Material)
-    {
-        return nullptr;
-    }
-
     // Get expression class
-    UClass* ExpressionClass = GetExpressionClassFromTypeName(Params.ExpressionType);
+    UClass* ExpressionClass = GetExpressionClassFromTypeName(ExpressionType);
     if (!ExpressionClass)
     {
-        OutError = FString::Printf(TEXT("Unknown expression type: %s"), *Params.ExpressionType);
+        OutError = FString::Printf(TEXT("Unknown expression type: %s"), *ExpressionType);
         return nullptr;
     }
 
     UMaterialExpression* NewExpression = nullptr;
-    FVector2D NodePos(Params.Position.X, Params.Position.Y);
+    FVector2D NodePos(Position.X, Position.Y);
 
     // If Material Editor is open, use its API for proper UI refresh
     if (MaterialEditor.IsValid())
@@ -477,77 +466,71 @@ UMaterialExpression* FMaterialExpressionService::AddExpression(
             Material->MaterialGraph
         );
 
-        if (NewExpression)
+        if (!NewExpression)
+        {
+            OutError = TEXT("Failed to create expression");
+            return nullptr;
+        }
+
+        // Ensure expression is in the ExpressionCollection (for proper serialization/querying)
+        UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData();
+        if (EditorData && !EditorData->ExpressionCollection.Expressions.Contains(NewExpression))
         {
-            // Ensure expression is in the ExpressionCollection (for proper serialization/querying)
-            UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData();
-            if (EditorData && !EditorData->ExpressionCollection.Expressions.Contains(NewExpression))
+            EditorData->ExpressionCollection.AddExpression(NewExpression);
+        }
+
+        // Apply type-specific properties after creation
+        if (Properties.IsValid())
+        {
+            // Mark expression for modification before changing properties
+            NewExpression->Modify();
+
+            if (!ApplyExpressionProperties(NewExpression, Properties, OutError))
             {
-                EditorData->ExpressionCollection.AddExpression(NewExpression);
+                // Property validation failed - clean up and return
+                Material->GetEditorOnlyData()->ExpressionCollection.RemoveExpression(NewExpression);
+                NewExpression->MarkAsGarbage();
+                return nullptr;
             }
 
-            // Apply type-specific properties after creation
-            if (Params.Properties.IsValid())
+            // After setting properties, we need to update the graph node to reflect changes
+            // Find the graph node for this expression and reconstruct it
+            if (Material->MaterialGraph)
             {
-                // Mark expression for modification before changing properties
-                NewExpression->Modify();
-
-                if (!ApplyExpressionProperties(NewExpression, Params.Properties, OutError))
-                {
-                    // Property validation failed - clean up and return
-                    Material->GetEditorOnlyData()->ExpressionCollection.RemoveExpression(NewExpression);
-                    NewExpression->MarkAsGarbage();
-                    return nullptr;
-                }
-
-                // After setting properties, we need to update the graph node to reflect changes
-                // Find the graph node for this expression and reconstruct it
-                if (Material->MaterialGraph)
+                for (UEdGraphNode* Node : Material->MaterialGraph->Nodes)
                 {
-                    for (UEdGraphNode* Node : Material->MaterialGraph->Nodes)
+                    UMaterialGraphNode* MatNode = Cast<UMaterialGraphNode>(Node);
+                    if (MatNode && MatNode->MaterialExpression == NewExpression)
                     {
-                        UMaterialGraphNode* MatNode = Cast<UMaterialGraphNode>(Node);
-                        if (MatNode && MatNode->MaterialExpression == NewExpression)
-                        {
-                            // Reconstruct the node to pick up property changes
-                            MatNode->ReconstructNode();
-                            break;
-                        }
+                        // Reconstruct the node to pick up property changes
+                        MatNode->ReconstructNode();
+                        break;
                     }
                 }
             }
-
-            // Notify graph of changes
-            if (Material->MaterialGraph)
-            {
-                Material->MaterialGraph->NotifyGraphChanged();
-            }
-
-            // Mark dirty (let user save when ready)
-            Material->MarkPackageDirty();
         }
     }
     else
     {
         // Fallback: Material editor not open, create expression manually
-        NewExpression = CreateExpressionByType(Material, Params.ExpressionType);
+        NewExpression = CreateExpressionByType(Material, ExpressionType);
         if (!NewExpression)
         {
-            OutError = FString::Printf(TEXT("Failed to create expression type: %s"), *Params.ExpressionType);
+            OutError = FString::Printf(TEXT("Failed to create expression type: %s"), *ExpressionType);
             return nullptr;
         }
 
         // Set position
-        NewExpression->MaterialExpressionEditorX = (int32)Params.Position.X;
-        NewExpression->MaterialExpressionEditorY = (int32)Params.Position.Y;
+        NewExpression->MaterialExpressionEditorX = (int32)Position.X;
+        NewExpression->MaterialExpressionEditorY = (int32)Position.Y;
 
         // Apply type-specific properties
-        if (Params.Properties.IsValid())
+        if (Properties.IsValid())
         {
             // Mark expression for modification before changing properties
             NewExpression->Modify();
 
-            if (!ApplyExpressionProperties(NewExpression, Params.Properties, OutError))
+            if (!ApplyExpressionProperties(NewExpression, Properties, OutError))
             {
                 // Property validation failed - clean up and return
                 NewExpression->MarkAsGarbage();
@@ -555,29 +538,65 @@ UMaterialExpression* FMaterialExpressionService::AddExpression(
             }
         }
 
-        // Add to material's expression collection
+        // Add to material's expression collection; the caller builds the visual nodes
         UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData();
         if (EditorData)
         {
             EditorData->ExpressionCollection.AddExpression(NewExpression);
         }
+    }
 
-        // Ensure graph exists and rebuild to create visual nodes
-        EnsureMaterialGraph(Material);
-        Material->MaterialGraph->Modify();
-        Material->MaterialGraph->RebuildGraph();
-        Material->MaterialGraph->NotifyGraphChanged();
+    return NewExpression;
+}
 
-        // Mark dirty (let user save when ready)
-        Material->MarkPackageDirty();
+UMaterialExpression* FMaterialExpressionService::AddExpression(
+    const FMaterialExpressionCreationParams& Params,
+    TSharedPtr<FJsonObject>& OutExpressionInfo,
+    FString& OutError)
+{
+    // Validate parameters
+    if (!Params.IsValid(OutError))
+    {
+        return nullptr;
     }
 
+    // Find the working material (editor's transient copy if editor is open)
+    // Also get the MaterialEditor pointer if it's open
+    TSharedPtr<IMaterialEditor> MaterialEditor;
+    UMaterial* Material = FindWorkingMaterial(Params.MaterialPath, OutError, &MaterialEditor);
+    if (!Material)
+    {
+        return nullptr;
+    }
+
+    UMaterialExpression* NewExpression = CreateExpressionInMaterial(
+        Material, MaterialEditor, Params.ExpressionType, Params.Position, Params.Properties, OutError);
     if (!NewExpression)
     {
-        OutError = TEXT("Failed to create expression");
         return nullptr;
     }
 
+    if (MaterialEditor.IsValid())
+    {
+        // Notify graph of changes
+        if (Material->MaterialGraph)
+        {
+            FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
+        }
+    }
+    else
+    {
+        // Ensure graph exists and rebuild to create visual nodes
+        EnsureMaterialGraph(Material);
+        Material->MaterialGraph->Modify();
+        Material->MaterialGraph->RebuildGraph();
+        FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
+    }
+
+    // Mark dirty (let user save when ready)
+    Material->MarkPackageDirty();
+    NoteEditInSession(Params.MaterialPath);
+
     // Build output info
     OutExpressionInfo = MakeShared<FJsonObject>();
     OutExpressionInfo->SetBoolField(TEXT("success"), true);
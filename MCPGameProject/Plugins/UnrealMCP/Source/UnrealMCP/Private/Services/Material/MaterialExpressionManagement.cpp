@@ -97,19 +97,8 @@ bool FMaterialExpressionService::DeleteExpression(
     // Remove from expression collection
     EditorData->ExpressionCollection.RemoveExpression(Expression);
 
-    // Recompile the material
-    RecompileMaterial(Material);
-
-    // Save the package
-    UPackage* Package = Material->GetOutermost();
-    if (Package)
-    {
-        FString PackageFileName = FPackageName::LongPackageNameToFilename(
-            Package->GetName(), FPackageName::GetAssetPackageExtension());
-        FSavePackageArgs SaveArgs;
-        SaveArgs.TopLevelFlags = RF_Standalone;
-        UPackage::SavePackage(Package, Material, *PackageFileName, SaveArgs);
-    }
+    // Recompile and save the material, or leave both to its edit session or the open batch
+    CommitMaterialEdit(Material);
 
     // Reopen editor if it was open
     if (bEditorWasOpen && GEditor)
@@ -187,18 +176,8 @@ bool FMaterialExpressionService::SetExpressionProperty(
         }
     }
 
-    // Use RecompileMaterial which does full refresh including RebuildGraph()
-    RecompileMaterial(Material);
-
-    // Save the package to persist changes to disk
-    UPackage* Package = Material->GetOutermost();
-    if (Package)
-    {
-        FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
-        FSavePackageArgs SaveArgs;
-        SaveArgs.TopLevelFlags = RF_Standalone;
-        UPackage::SavePackage(Package, Material, *PackageFileName, SaveArgs);
-    }
+    // Full refresh including RebuildGraph(); the recompile and save may wait for the session or batch
+    CommitMaterialEdit(Material);
 
     // Reopen the editor if it was open
     if (bEditorWasOpen && GEditor)
@@ -232,34 +211,18 @@ bool FMaterialExpressionService::CompileMaterial(
     // Recompile the material (this triggers shader compilation)
     RecompileMaterial(Material);
 
-    // Capture shader compilation errors
-    TArray<TSharedPtr<FJsonValue>> CompileErrorsArray;
-    bool bHasCompileErrors = false;
-
-    // Get errors from material resources for each quality level
-    // Use current shader platform (GetFeatureLevelShaderPlatform converts feature level to shader platform)
-    EShaderPlatform ShaderPlatform = GetFeatureLevelShaderPlatform(GMaxRHIFeatureLevel);
-
-    for (int32 QualityLevel = 0; QualityLevel < EMaterialQualityLevel::Num; ++QualityLevel)
+    // An open session has nothing left to recompile; its deferred save still waits for the end
+    if (FEditSession* Session = EditSessions.Find(Material))
     {
-        const FMaterialResource* MaterialResource = Material->GetMaterialResource(
-            ShaderPlatform,
-            (EMaterialQualityLevel::Type)QualityLevel);
-
-        if (MaterialResource)
-        {
-            const TArray<FString>& Errors = MaterialResource->GetCompileErrors();
-            for (const FString& Error : Errors)
-            {
-                TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
-                ErrorObj->SetStringField(TEXT("error"), Error);
-                ErrorObj->SetNumberField(TEXT("quality_level"), QualityLevel);
-                CompileErrorsArray.Add(MakeShared<FJsonValueObject>(ErrorObj));
-                bHasCompileErrors = true;
-            }
-        }
+        Session->PendingEdits = 0;
     }
 
+    // Capture shader compilation errors
+    TArray<TSharedPtr<FJsonValue>> CompileErrorsArray;
+    TArray<TSharedPtr<FJsonValue>> ExpressionErrorsArray;
+    const bool bHasCompileErrors = CollectCompileErrors(Material, CompileErrorsArray, ExpressionErrorsArray);
+    OutResult->SetArrayField(TEXT("expression_errors"), ExpressionErrorsArray);
+
     // Get editor data for orphan detection
     UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData();
     if (!EditorData)
@@ -357,3 +320,57 @@ bool FMaterialExpressionService::CompileMaterial(
 
     return true;
 }
+
+bool FMaterialExpressionService::CollectCompileErrors(
+    UMaterial* Material,
+    TArray<TSharedPtr<FJsonValue>>& OutCompileErrors,
+    TArray<TSharedPtr<FJsonValue>>& OutExpressionErrors)
+{
+    // Get errors from material resources for each quality level
+    // Use current shader platform (GetFeatureLevelShaderPlatform converts feature level to shader platform)
+    EShaderPlatform ShaderPlatform = GetFeatureLevelShaderPlatform(GMaxRHIFeatureLevel);
+
+    TSet<UMaterialExpression*> ReportedExpressions;
+    for (int32 QualityLevel = 0; QualityLevel < EMaterialQualityLevel::Num; ++QualityLevel)
+    {
+        const FMaterialResource* MaterialResource = Material->GetMaterialResource(
+            ShaderPlatform,
+            (EMaterialQualityLevel::Type)QualityLevel);
+
+        if (!MaterialResource)
+        {
+            continue;
+        }
+
+        const TArray<FString>& Errors = MaterialResource->GetCompileErrors();
+        for (const FString& Error : Errors)
+        {
+            TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+            ErrorObj->SetStringField(TEXT("error"), Error);
+            ErrorObj->SetNumberField(TEXT("quality_level"), QualityLevel);
+            OutCompileErrors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+        }
+
+        // The translator records which expressions raised errors; quality levels mostly repeat them
+        for (UMaterialExpression* Expression : MaterialResource->GetErrorExpressions())
+        {
+            bool bAlreadyReported = false;
+            ReportedExpressions.Add(Expression, &bAlreadyReported);
+            if (!Expression || bAlreadyReported)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+            ErrorObj->SetStringField(TEXT("expression_id"), Expression->MaterialExpressionGuid.ToString());
+            ErrorObj->SetStringField(TEXT("expression_type"), Expression->GetClass()->GetName().Replace(TEXT("MaterialExpression"), TEXT("")));
+#if WITH_EDITORONLY_DATA
+            ErrorObj->SetStringField(TEXT("error"), Expression->LastErrorText);
+#endif
+            ErrorObj->SetNumberField(TEXT("quality_level"), QualityLevel);
+            OutExpressionErrors.Add(MakeShared<FJsonValueObject>(ErrorObj));
+        }
+    }
+
+    return OutCompileErrors.Num() > 0;
+}
@@ -0,0 +1,449 @@
+#include "Services/MaterialExpressionService.h"
+#include "IMaterialEditor.h"
+#include "MaterialGraph/MaterialGraph.h"
+#include "MaterialGraph/MaterialGraphNode.h"
+#include "MCPBatchEditScope.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    /** Spacing of the automatic layout, in graph units */
+    constexpr int32 LayoutColumnSpacing = 300;
+    constexpr int32 LayoutRowSpacing = 150;
+
+    bool ReadOutputIndex(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName, int32& OutIndex)
+    {
+        double Index = 0.0;
+        if (Object->TryGetNumberField(FieldName, Index))
+        {
+            OutIndex = FMath::FloorToInt32(Index);
+        }
+        return OutIndex >= 0;
+    }
+
+    int32 FindInputIndexByName(UMaterialExpression* Expression, const FString& InputName)
+    {
+        const int32 NumInputs = Expression->GetInputsView().Num();
+        for (int32 InputIndex = 0; InputIndex < NumInputs; ++InputIndex)
+        {
+            if (Expression->GetInputName(InputIndex).ToString().Equals(InputName, ESearchCase::IgnoreCase))
+            {
+                return InputIndex;
+            }
+        }
+        return INDEX_NONE;
+    }
+}
+
+bool FMaterialGraphBuildSpec::FromJson(const TSharedPtr<FJsonObject>& Params, FMaterialGraphBuildSpec& OutSpec, FString& OutError)
+{
+    if (!Params.IsValid() || !Params->TryGetStringField(TEXT("material_path"), OutSpec.MaterialPath))
+    {
+        OutError = TEXT("Missing 'material_path' parameter");
+        return false;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ExpressionsArray = nullptr;
+    if (!Params->TryGetArrayField(TEXT("expressions"), ExpressionsArray) || ExpressionsArray->Num() == 0)
+    {
+        OutError = TEXT("Missing or empty 'expressions' array");
+        return false;
+    }
+
+    TSet<FString> Ids;
+    for (int32 Index = 0; Index < ExpressionsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject>* ExprObj = nullptr;
+        if (!(*ExpressionsArray)[Index].IsValid() || !(*ExpressionsArray)[Index]->TryGetObject(ExprObj))
+        {
+            OutError = FString::Printf(TEXT("expressions[%d] is not an object"), Index);
+            return false;
+        }
+
+        FExpression& Expression = OutSpec.Expressions.AddDefaulted_GetRef();
+        if (!(*ExprObj)->TryGetStringField(TEXT("id"), Expression.Id) || Expression.Id.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("expressions[%d] is missing 'id'"), Index);
+            return false;
+        }
+        bool bDuplicate = false;
+        Ids.Add(Expression.Id, &bDuplicate);
+        if (bDuplicate)
+        {
+            OutError = FString::Printf(TEXT("Expression id '%s' is used more than once"), *Expression.Id);
+            return false;
+        }
+        if (!(*ExprObj)->TryGetStringField(TEXT("expression_type"), Expression.ExpressionType) || Expression.ExpressionType.IsEmpty())
+        {
+            OutError = FString::Printf(TEXT("Expression '%s' is missing 'expression_type'"), *Expression.Id);
+            return false;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* PositionArray = nullptr;
+        if ((*ExprObj)->TryGetArrayField(TEXT("position"), PositionArray))
+        {
+            if (PositionArray->Num() < 2)
+            {
+                OutError = FString::Printf(TEXT("Expression '%s': position must be [x, y]"), *Expression.Id);
+                return false;
+            }
+            Expression.Position = FVector2D((*PositionArray)[0]->AsNumber(), (*PositionArray)[1]->AsNumber());
+        }
+
+        const TSharedPtr<FJsonObject>* PropertiesObj = nullptr;
+        if ((*ExprObj)->TryGetObjectField(TEXT("properties"), PropertiesObj))
+        {
+            Expression.Properties = *PropertiesObj;
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("connections"), ConnectionsArray))
+    {
+        for (int32 Index = 0; Index < ConnectionsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* ConnObj = nullptr;
+            if (!(*ConnectionsArray)[Index].IsValid() || !(*ConnectionsArray)[Index]->TryGetObject(ConnObj))
+            {
+                OutError = FString::Printf(TEXT("connections[%d] is not an object"), Index);
+                return false;
+            }
+
+            FConnection& Connection = OutSpec.Connections.AddDefaulted_GetRef();
+            if (!(*ConnObj)->TryGetStringField(TEXT("source_id"), Connection.SourceId)
+                || !(*ConnObj)->TryGetStringField(TEXT("target_id"), Connection.TargetId)
+                || !(*ConnObj)->TryGetStringField(TEXT("target_input_name"), Connection.TargetInputName))
+            {
+                OutError = FString::Printf(TEXT("connections[%d] needs 'source_id', 'target_id' and 'target_input_name'"), Index);
+                return false;
+            }
+            if (!ReadOutputIndex(*ConnObj, TEXT("source_output_index"), Connection.SourceOutputIndex))
+            {
+                OutError = FString::Printf(TEXT("connections[%d]: source_output_index must not be negative"), Index);
+                return false;
+            }
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* OutputsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("outputs"), OutputsArray))
+    {
+        for (int32 Index = 0; Index < OutputsArray->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* OutputObj = nullptr;
+            if (!(*OutputsArray)[Index].IsValid() || !(*OutputsArray)[Index]->TryGetObject(OutputObj))
+            {
+                OutError = FString::Printf(TEXT("outputs[%d] is not an object"), Index);
+                return false;
+            }
+
+            FOutputBinding& Output = OutSpec.Outputs.AddDefaulted_GetRef();
+            if (!(*OutputObj)->TryGetStringField(TEXT("source_id"), Output.SourceId)
+                || !(*OutputObj)->TryGetStringField(TEXT("material_property"), Output.MaterialProperty))
+            {
+                OutError = FString::Printf(TEXT("outputs[%d] needs 'source_id' and 'material_property'"), Index);
+                return false;
+            }
+            if (!ReadOutputIndex(*OutputObj, TEXT("output_index"), Output.SourceOutputIndex))
+            {
+                OutError = FString::Printf(TEXT("outputs[%d]: output_index must not be negative"), Index);
+                return false;
+            }
+        }
+    }
+
+    Params->TryGetBoolField(TEXT("auto_layout"), OutSpec.bAutoLayout);
+    Params->TryGetBoolField(TEXT("compile"), OutSpec.bCompile);
+    return true;
+}
+
+bool FMaterialExpressionService::BuildMaterialGraph(
+    const FMaterialGraphBuildSpec& Spec,
+    TSharedPtr<FJsonObject>& OutResult,
+    FString& OutError)
+{
+    TSharedPtr<IMaterialEditor> MaterialEditor;
+    UMaterial* Material = FindWorkingMaterial(Spec.MaterialPath, OutError, &MaterialEditor);
+    if (!Material)
+    {
+        return false;
+    }
+
+    // Everything that can be checked without creating expressions is checked before the material is touched
+    TMap<FString, int32> SpecIndexById;
+    for (int32 Index = 0; Index < Spec.Expressions.Num(); ++Index)
+    {
+        const FMaterialGraphBuildSpec::FExpression& Expression = Spec.Expressions[Index];
+        if (!GetExpressionClassFromTypeName(Expression.ExpressionType))
+        {
+            OutError = FString::Printf(TEXT("Expression '%s': unknown expression type: %s"), *Expression.Id, *Expression.ExpressionType);
+            return false;
+        }
+        SpecIndexById.Add(Expression.Id, Index);
+    }
+
+    // Ids outside the spec name expressions already in the material; each is looked up once
+    TMap<FString, UMaterialExpression*> ExistingById;
+    auto ResolveExistingId = [&](const FString& Id) -> bool
+    {
+        if (SpecIndexById.Contains(Id) || ExistingById.Contains(Id))
+        {
+            return true;
+        }
+        FGuid Guid;
+        UMaterialExpression* Existing = FGuid::Parse(Id, Guid) ? FindExpressionByGuid(Material, Guid) : nullptr;
+        if (!Existing)
+        {
+            OutError = FString::Printf(TEXT("Unknown expression id '%s': not in the spec and not an expression GUID of the material"), *Id);
+            return false;
+        }
+        ExistingById.Add(Id, Existing);
+        return true;
+    };
+    for (const FMaterialGraphBuildSpec::FConnection& Connection : Spec.Connections)
+    {
+        if (!ResolveExistingId(Connection.SourceId) || !ResolveExistingId(Connection.TargetId))
+        {
+            return false;
+        }
+    }
+    for (const FMaterialGraphBuildSpec::FOutputBinding& Output : Spec.Outputs)
+    {
+        if (!ResolveExistingId(Output.SourceId))
+        {
+            return false;
+        }
+    }
+
+    // Column of each new expression: its longest path to an output, so every wire runs left to right.
+    // A path can be no longer than the number of expressions; relaxing past that means a cycle.
+    TArray<int32> Depths;
+    Depths.Init(0, Spec.Expressions.Num());
+    for (int32 Pass = 0;; ++Pass)
+    {
+        bool bChanged = false;
+        for (const FMaterialGraphBuildSpec::FConnection& Connection : Spec.Connections)
+        {
+            const int32* SourceIndex = SpecIndexById.Find(Connection.SourceId);
+            const int32* TargetIndex = SpecIndexById.Find(Connection.TargetId);
+            if (SourceIndex && TargetIndex && Depths[*SourceIndex] < Depths[*TargetIndex] + 1)
+            {
+                Depths[*SourceIndex] = Depths[*TargetIndex] + 1;
+                bChanged = true;
+            }
+        }
+        if (!bChanged)
+        {
+            break;
+        }
+        if (Pass >= Spec.Expressions.Num())
+        {
+            OutError = TEXT("Connections form a cycle; material graphs can not have loops");
+            return false;
+        }
+    }
+
+    TArray<FVector2D> Positions;
+    Positions.Reserve(Spec.Expressions.Num());
+    TMap<int32, int32> RowsPerColumn;
+    for (int32 Index = 0; Index < Spec.Expressions.Num(); ++Index)
+    {
+        const FMaterialGraphBuildSpec::FExpression& Expression = Spec.Expressions[Index];
+        if (Expression.Position.IsSet() || !Spec.bAutoLayout)
+        {
+            Positions.Add(Expression.Position.Get(FVector2D::ZeroVector));
+            continue;
+        }
+        int32& Row = RowsPerColumn.FindOrAdd(Depths[Index]);
+        Positions.Add(FVector2D(
+            Material->EditorX - LayoutColumnSpacing * (Depths[Index] + 1),
+            Material->EditorY + LayoutRowSpacing * Row));
+        ++Row;
+    }
+
+    Material->Modify();
+
+    TArray<UMaterialExpression*> Created;
+    Created.Reserve(Spec.Expressions.Num());
+    auto RemoveCreated = [&]()
+    {
+        if (UMaterialEditorOnlyData* EditorData = Material->GetEditorOnlyData())
+        {
+            for (UMaterialExpression* Expression : Created)
+            {
+                EditorData->ExpressionCollection.RemoveExpression(Expression);
+            }
+        }
+        // The Material Editor made nodes for them; without it no nodes exist yet
+        if (MaterialEditor.IsValid() && Material->MaterialGraph)
+        {
+            TArray<UEdGraphNode*> Nodes = Material->MaterialGraph->Nodes;
+            for (UEdGraphNode* Node : Nodes)
+            {
+                UMaterialGraphNode* MatNode = Cast<UMaterialGraphNode>(Node);
+                if (MatNode && Created.Contains(MatNode->MaterialExpression))
+                {
+                    Material->MaterialGraph->RemoveNode(MatNode);
+                }
+            }
+            FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
+        }
+        for (UMaterialExpression* Expression : Created)
+        {
+            Expression->MarkAsGarbage();
+        }
+        Created.Reset();
+    };
+
+    for (int32 Index = 0; Index < Spec.Expressions.Num(); ++Index)
+    {
+        const FMaterialGraphBuildSpec::FExpression& Expression = Spec.Expressions[Index];
+        FString CreateError;
+        UMaterialExpression* NewExpression = CreateExpressionInMaterial(
+            Material, MaterialEditor, Expression.ExpressionType, Positions[Index], Expression.Properties, CreateError);
+        if (!NewExpression)
+        {
+            RemoveCreated();
+            OutError = FString::Printf(TEXT("Expression '%s': %s"), *Expression.Id, *CreateError);
+            return false;
+        }
+        Created.Add(NewExpression);
+    }
+
+    auto GetExpression = [&](const FString& Id) -> UMaterialExpression*
+    {
+        const int32* SpecIndex = SpecIndexById.Find(Id);
+        return SpecIndex ? Created[*SpecIndex] : ExistingById.FindRef(Id);
+    };
+
+    // Resolve every pin before wiring any, so a bad pin leaves existing expressions untouched
+    struct FResolvedWire
+    {
+        UMaterialExpression* Source;
+        int32 OutputIndex;
+        FExpressionInput* Input;
+    };
+    TArray<FResolvedWire> Wires;
+    Wires.Reserve(Spec.Connections.Num() + Spec.Outputs.Num());
+    for (const FMaterialGraphBuildSpec::FConnection& Connection : Spec.Connections)
+    {
+        UMaterialExpression* Source = GetExpression(Connection.SourceId);
+        UMaterialExpression* Target = GetExpression(Connection.TargetId);
+        if (Connection.SourceOutputIndex >= Source->GetOutputs().Num())
+        {
+            OutError = FString::Printf(TEXT("'%s' has no output %d (it has %d)"),
+                *Connection.SourceId, Connection.SourceOutputIndex, Source->GetOutputs().Num());
+            RemoveCreated();
+            return false;
+        }
+        const int32 InputIndex = FindInputIndexByName(Target, Connection.TargetInputName);
+        FExpressionInput* Input = InputIndex != INDEX_NONE ? Target->GetInput(InputIndex) : nullptr;
+        if (!Input)
+        {
+            TArray<FString> AvailableInputs;
+            for (int32 Index = 0; Index < Target->GetInputsView().Num(); ++Index)
+            {
+                AvailableInputs.Add(Target->GetInputName(Index).ToString());
+            }
+            OutError = FString::Printf(TEXT("Input '%s' not found on '%s'. Available inputs: %s"),
+                *Connection.TargetInputName, *Connection.TargetId, *FString::Join(AvailableInputs, TEXT(", ")));
+            RemoveCreated();
+            return false;
+        }
+        Wires.Add({ Source, Connection.SourceOutputIndex, Input });
+    }
+    for (const FMaterialGraphBuildSpec::FOutputBinding& Output : Spec.Outputs)
+    {
+        UMaterialExpression* Source = GetExpression(Output.SourceId);
+        if (Output.SourceOutputIndex >= Source->GetOutputs().Num())
+        {
+            OutError = FString::Printf(TEXT("'%s' has no output %d (it has %d)"),
+                *Output.SourceId, Output.SourceOutputIndex, Source->GetOutputs().Num());
+            RemoveCreated();
+            return false;
+        }
+        FExpressionInput* MaterialInput = Material->GetExpressionInputForProperty(GetMaterialPropertyFromString(Output.MaterialProperty));
+        if (!MaterialInput)
+        {
+            OutError = FString::Printf(TEXT("Material property not found: %s"), *Output.MaterialProperty);
+            RemoveCreated();
+            return false;
+        }
+        Wires.Add({ Source, Output.SourceOutputIndex, MaterialInput });
+    }
+
+    for (const FResolvedWire& Wire : Wires)
+    {
+        Wire.Source->Modify();
+        Wire.Source->ConnectExpression(Wire.Input, Wire.OutputIndex);
+    }
+
+    // One graph update for the whole build instead of one per expression and wire
+    EnsureMaterialGraph(Material);
+    Material->MaterialGraph->Modify();
+    if (MaterialEditor.IsValid())
+    {
+        Material->MaterialGraph->LinkGraphNodesFromMaterial();
+    }
+    else
+    {
+        Material->MaterialGraph->RebuildGraph();
+    }
+    FMCPBatchEditScope::NotifyGraphChanged(Material->MaterialGraph);
+    Material->MarkPackageDirty();
+
+    OutResult = MakeShared<FJsonObject>();
+    TSharedPtr<FJsonObject> IdsObj = MakeShared<FJsonObject>();
+    for (int32 Index = 0; Index < Spec.Expressions.Num(); ++Index)
+    {
+        IdsObj->SetStringField(Spec.Expressions[Index].Id, Created[Index]->MaterialExpressionGuid.ToString());
+    }
+
+    // Compile once, unless an edit session or a batch already defers it
+    FString LookupError;
+    UMaterial* Asset = FindAndValidateMaterial(Spec.MaterialPath, LookupError);
+    bool bCompiled = false;
+    if (Asset && EditSessions.Contains(Asset))
+    {
+        NoteEditInSession(Spec.MaterialPath);
+    }
+    else if (Spec.bCompile && Asset && FMCPBatchEditScope::IsActive())
+    {
+        FMCPBatchEditScope::Defer(Asset, TEXT("RecompileMaterial"), [this, WeakMaterial = TWeakObjectPtr<UMaterial>(Asset)]()
+        {
+            if (UMaterial* EditedMaterial = WeakMaterial.Get())
+            {
+                RecompileMaterial(EditedMaterial);
+            }
+        });
+    }
+    else if (Spec.bCompile)
+    {
+        TSharedPtr<FJsonObject> CompileResult;
+        FString CompileError;
+        if (CompileMaterial(Spec.MaterialPath, CompileResult, CompileError))
+        {
+            OutResult->SetObjectField(TEXT("compile"), CompileResult);
+            bCompiled = true;
+        }
+        else
+        {
+            OutResult->SetStringField(TEXT("compile_error"), CompileError);
+        }
+    }
+
+    OutResult->SetBoolField(TEXT("success"), true);
+    OutResult->SetStringField(TEXT("material_path"), Spec.MaterialPath);
+    OutResult->SetObjectField(TEXT("expression_ids"), IdsObj);
+    OutResult->SetNumberField(TEXT("expression_count"), Created.Num());
+    OutResult->SetNumberField(TEXT("connection_count"), Spec.Connections.Num());
+    OutResult->SetNumberField(TEXT("output_count"), Spec.Outputs.Num());
+    OutResult->SetBoolField(TEXT("compiled"), bCompiled);
+    OutResult->SetStringField(TEXT("message"), FString::Printf(TEXT("Built %d expressions, %d connections, %d outputs"),
+        Created.Num(), Spec.Connections.Num(), Spec.Outputs.Num()));
+
+    UE_LOG(LogTemp, Log, TEXT("Built material graph in %s: %d expressions, %d connections, %d outputs (via %s)"),
+        *Spec.MaterialPath, Created.Num(), Spec.Connections.Num(), Spec.Outputs.Num(),
+        MaterialEditor.IsValid() ? TEXT("MaterialEditor") : TEXT("manual"));
+    return true;
+}
@@ -0,0 +1,172 @@
+#include "Services/MaterialService.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Texture.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+    /** Guards against malformed parent chains in the registry */
+    constexpr int32 MaxParentDepth = 32;
+
+    /** Walk an instance's parent chain through asset registry tags, loading nothing */
+    bool IsDerivedFrom(IAssetRegistry& AssetRegistry, const FAssetData& Instance, const FSoftObjectPath& Ancestor)
+    {
+        FAssetData Current = Instance;
+        for (int32 Depth = 0; Depth < MaxParentDepth; ++Depth)
+        {
+            FString ParentTag;
+            if (!Current.GetTagValue(TEXT("Parent"), ParentTag) || ParentTag.IsEmpty())
+            {
+                return false;
+            }
+
+            const FSoftObjectPath ParentPath(FPackageName::ExportTextPathToObjectPath(ParentTag));
+            if (ParentPath == Ancestor)
+            {
+                return true;
+            }
+
+            Current = AssetRegistry.GetAssetByObjectPath(ParentPath);
+            if (!Current.IsValid())
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+}
+
+bool FMaterialService::FindMaterialInstances(const FString& FolderPath, const FString& ParentMaterialPath, bool bRecursive, TArray<FString>& OutInstancePaths, FString& OutError)
+{
+    OutInstancePaths.Reset();
+
+    FSoftObjectPath Ancestor;
+    if (!ParentMaterialPath.IsEmpty())
+    {
+        UMaterialInterface* ParentMaterial = FindMaterial(ParentMaterialPath);
+        if (!ParentMaterial)
+        {
+            OutError = FString::Printf(TEXT("Parent material not found: %s"), *ParentMaterialPath);
+            return false;
+        }
+        Ancestor = FSoftObjectPath(ParentMaterial);
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    if (!FolderPath.IsEmpty())
+    {
+        Filter.PackagePaths.Add(FName(*FolderPath));
+        Filter.bRecursivePaths = bRecursive;
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry.GetAssets(Filter, Assets);
+
+    for (const FAssetData& Asset : Assets)
+    {
+        if (Ancestor.IsNull() || IsDerivedFrom(AssetRegistry, Asset, Ancestor))
+        {
+            OutInstancePaths.Add(Asset.GetObjectPathString());
+        }
+    }
+    OutInstancePaths.Sort();
+
+    UE_LOG(LogTemp, Log, TEXT("Found %d material instances in '%s' (parent '%s')"), OutInstancePaths.Num(), *FolderPath, *ParentMaterialPath);
+    return true;
+}
+
+int32 FMaterialService::SetMaterialInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialInstanceParameterBatch& Batch, bool bSave, TArray<FMaterialInstanceParameterResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset();
+
+    // Every instance gets the same textures; load each once, and fail before touching anything
+    TMap<FString, UTexture*> Textures;
+    for (const TPair<FString, FString>& Param : Batch.TextureParams)
+    {
+        UTexture* Texture = LoadObject<UTexture>(nullptr, *Param.Value);
+        if (!Texture)
+        {
+            OutError = FString::Printf(TEXT("Texture not found for '%s': %s"), *Param.Key, *Param.Value);
+            return INDEX_NONE;
+        }
+        Textures.Add(Param.Key, Texture);
+    }
+
+    // One transaction for the batch; queued saves are written together when the scope closes
+    FMCPBatchEditScope EditScope(FText::FromString(FString::Printf(TEXT("MCP Set Parameters On %d Material Instances"), InstancePaths.Num())));
+
+    int32 UpdatedCount = 0;
+    OutResults.Reserve(InstancePaths.Num());
+    for (const FString& InstancePath : InstancePaths)
+    {
+        FMaterialInstanceParameterResult& Result = OutResults.AddDefaulted_GetRef();
+        Result.InstancePath = InstancePath;
+
+        UMaterialInstanceConstant* MIC = Cast<UMaterialInstanceConstant>(FindMaterial(InstancePath));
+        if (!MIC)
+        {
+            Result.Error = FString::Printf(TEXT("Material instance not found: %s"), *InstancePath);
+            continue;
+        }
+
+        MIC->Modify();
+        MIC->PreEditChange(nullptr);
+
+        // Parameters the material lacks would only add dead overrides; skip and report them
+        for (const TPair<FString, float>& Param : Batch.ScalarParams)
+        {
+            const FMaterialParameterInfo ParameterInfo(*Param.Key);
+            float CurrentValue = 0.0f;
+            if (!MIC->GetScalarParameterValue(ParameterInfo, CurrentValue))
+            {
+                Result.MissingParams.Add(Param.Key);
+                continue;
+            }
+            MIC->SetScalarParameterValueEditorOnly(ParameterInfo, Param.Value);
+            Result.SetScalarParams.Add(Param.Key);
+        }
+        for (const TPair<FString, FLinearColor>& Param : Batch.VectorParams)
+        {
+            const FMaterialParameterInfo ParameterInfo(*Param.Key);
+            FLinearColor CurrentValue;
+            if (!MIC->GetVectorParameterValue(ParameterInfo, CurrentValue))
+            {
+                Result.MissingParams.Add(Param.Key);
+                continue;
+            }
+            MIC->SetVectorParameterValueEditorOnly(ParameterInfo, Param.Value);
+            Result.SetVectorParams.Add(Param.Key);
+        }
+        for (const TPair<FString, UTexture*>& Param : Textures)
+        {
+            const FMaterialParameterInfo ParameterInfo(*Param.Key);
+            UTexture* CurrentValue = nullptr;
+            if (!MIC->GetTextureParameterValue(ParameterInfo, CurrentValue))
+            {
+                Result.MissingParams.Add(Param.Key);
+                continue;
+            }
+            MIC->SetTextureParameterValueEditorOnly(ParameterInfo, Param.Value);
+            Result.SetTextureParams.Add(Param.Key);
+        }
+
+        // One change notification per instance: one uniform buffer and permutation update for all its parameters
+        MIC->PostEditChange();
+        MIC->MarkPackageDirty();
+
+        if (bSave)
+        {
+            FMCPSaveQueue::Get().Enqueue(MIC);
+        }
+        ++UpdatedCount;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Set parameters on %d of %d material instances"), UpdatedCount, InstancePaths.Num());
+    return UpdatedCount;
+}
@@ -0,0 +1,419 @@
+#include "Services/MaterialPaletteIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Materials/MaterialExpression.h"
+#include "Materials/MaterialFunction.h"
+#include "UObject/UObjectHash.h"
+#include "MCPLogging.h"
+#include "MCPMemory.h"
+
+namespace
+{
+    const FName ExposeToLibraryTag(TEXT("bExposeToLibrary"));
+    const FName LibraryCategoriesTag(TEXT("LibraryCategories"));
+    const FName DescriptionTag(TEXT("Description"));
+
+    FTopLevelAssetPath GetMaterialFunctionClassPath()
+    {
+        return UMaterialFunction::StaticClass()->GetClassPathName();
+    }
+}
+
+FMaterialPaletteIndex& FMaterialPaletteIndex::Get()
+{
+    static FMaterialPaletteIndex Instance;
+    return Instance;
+}
+
+void FMaterialPaletteIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        FilesLoadedHandle = AssetRegistry->OnFilesLoaded().AddRaw(this, &FMaterialPaletteIndex::HandleFilesLoaded);
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FMaterialPaletteIndex::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FMaterialPaletteIndex::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FMaterialPaletteIndex::HandleAssetRenamed);
+        AssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddRaw(this, &FMaterialPaletteIndex::HandleAssetAdded);
+        ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FMaterialPaletteIndex::HandleReloadComplete);
+        bInitialized = true;
+
+        FMCPCacheStatsRegistry::Get().Register(TEXT("material_palette_index"), TEXT("index"), CacheCounters,
+            [this]() { return static_cast<int64>(Expressions.Num() + Functions.Num()); });
+        BuildFunctions();
+    }
+}
+
+void FMaterialPaletteIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    FilesLoadedHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("material_palette_index"));
+
+    Expressions.Empty();
+    ExpressionCategories.Empty();
+    bExpressionsBuilt = false;
+    Functions.Empty();
+    PartialFunctions.Empty();
+    bFunctionsBuilt = false;
+}
+
+void FMaterialPaletteIndex::Search(const FString& Query, const FString& CategoryFilter, bool bExpressions, bool bFunctions, TArray<FMatch>& OutMatches)
+{
+    check(IsInGameThread());
+    OutMatches.Reset();
+
+    if ((!bExpressions || bExpressionsBuilt) && (!bFunctions || bFunctionsBuilt))
+    {
+        CacheCounters.RecordHit();
+    }
+    else
+    {
+        CacheCounters.RecordMiss();
+    }
+
+    TArray<FString> Words;
+    Query.ToLower().ParseIntoArrayWS(Words);
+    const FString LowerCategoryFilter = CategoryFilter.ToLower();
+
+    auto AddIfMatching = [&Words, &LowerCategoryFilter, &OutMatches](const FEntry& Entry)
+    {
+        if (!LowerCategoryFilter.IsEmpty())
+        {
+            const bool bInCategory = Entry.LowerCategories.ContainsByPredicate([&LowerCategoryFilter](const FString& Category)
+            {
+                return Category.Contains(LowerCategoryFilter, ESearchCase::CaseSensitive);
+            });
+            if (!bInCategory)
+            {
+                return;
+            }
+        }
+
+        int32 Score = 0;
+        for (const FString& Word : Words)
+        {
+            const int32 WordScore = ScoreWord(Entry, Word);
+            if (WordScore == 0)
+            {
+                return;
+            }
+            Score += WordScore;
+        }
+        OutMatches.Add(FMatch{ &Entry, Score });
+    };
+
+    if (bExpressions)
+    {
+        BuildExpressions();
+        for (const FEntry& Entry : Expressions)
+        {
+            AddIfMatching(Entry);
+        }
+    }
+
+    if (bFunctions)
+    {
+        BuildFunctions();
+        const TMap<FSoftObjectPath, FEntry>* SearchedFunctions = &Functions;
+        if (!bFunctionsBuilt)
+        {
+            PartialFunctions.Reset();
+            CollectFunctions(PartialFunctions);
+            SearchedFunctions = &PartialFunctions;
+        }
+        for (const TPair<FSoftObjectPath, FEntry>& Pair : *SearchedFunctions)
+        {
+            AddIfMatching(Pair.Value);
+        }
+    }
+
+    OutMatches.Sort([](const FMatch& A, const FMatch& B)
+    {
+        if (A.Score != B.Score)
+        {
+            return A.Score > B.Score;
+        }
+        if (A.Entry->bIsFunction != B.Entry->bIsFunction)
+        {
+            return !A.Entry->bIsFunction;
+        }
+        return A.Entry->LowerName < B.Entry->LowerName;
+    });
+}
+
+const TArray<FString>& FMaterialPaletteIndex::GetExpressionCategories()
+{
+    check(IsInGameThread());
+    BuildExpressions();
+    return ExpressionCategories;
+}
+
+int32 FMaterialPaletteIndex::ScoreWord(const FEntry& Entry, const FString& Word)
+{
+    if (Entry.LowerName == Word)
+    {
+        return 100;
+    }
+    if (Entry.LowerName.StartsWith(Word, ESearchCase::CaseSensitive))
+    {
+        return 60;
+    }
+    if (Entry.LowerName.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 40;
+    }
+    if (Entry.LowerClassName.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 35;
+    }
+
+    int32 KeywordScore = 0;
+    for (const FString& Keyword : Entry.LowerKeywords)
+    {
+        if (Keyword == Word)
+        {
+            return 30;
+        }
+        if (Keyword.StartsWith(Word, ESearchCase::CaseSensitive))
+        {
+            KeywordScore = 20;
+        }
+    }
+    if (KeywordScore > 0)
+    {
+        return KeywordScore;
+    }
+
+    for (const FString& Category : Entry.LowerCategories)
+    {
+        if (Category.Contains(Word, ESearchCase::CaseSensitive))
+        {
+            return 15;
+        }
+    }
+    if (Entry.LowerPath.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 12;
+    }
+    if (Entry.LowerDescription.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 10;
+    }
+    return 0;
+}
+
+void FMaterialPaletteIndex::MakeLowerCopies(FEntry& Entry)
+{
+    Entry.LowerName = Entry.Name.ToLower();
+    Entry.LowerClassName = Entry.ClassName.ToLower();
+    Entry.LowerPath = Entry.Path.ToLower();
+    Entry.LowerDescription = Entry.Description.ToLower();
+    Entry.LowerCategories.Reset(Entry.Categories.Num());
+    for (const FString& Category : Entry.Categories)
+    {
+        Entry.LowerCategories.Add(Category.ToLower());
+    }
+}
+
+void FMaterialPaletteIndex::BuildExpressions()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    if (bExpressionsBuilt)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    static const FString Prefix = TEXT("MaterialExpression");
+
+    Expressions.Reset();
+    TSet<FString> Categories;
+
+    TArray<UClass*> ExpressionClasses;
+    GetDerivedClasses(UMaterialExpression::StaticClass(), ExpressionClasses, true);
+    for (UClass* Class : ExpressionClasses)
+    {
+        // Skip abstract, deprecated, private classes
+        if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated) || Class->HasMetaData(TEXT("Private")))
+        {
+            continue;
+        }
+
+        FEntry& Entry = Expressions.AddDefaulted_GetRef();
+        Entry.ClassName = Class->GetName();
+
+        // Display name without the "MaterialExpression" prefix
+        if (Class->HasMetaData(TEXT("DisplayName")))
+        {
+            Entry.Name = Class->GetDisplayNameText().ToString();
+        }
+        else
+        {
+            Entry.Name = Entry.ClassName.StartsWith(Prefix) ? Entry.ClassName.Mid(Prefix.Len()) : Entry.ClassName;
+        }
+
+        if (const UMaterialExpression* DefaultObject = Cast<UMaterialExpression>(Class->GetDefaultObject()))
+        {
+            for (const FText& Category : DefaultObject->MenuCategories)
+            {
+                Entry.Categories.Add(Category.ToString());
+                Categories.Add(Entry.Categories.Last());
+            }
+            Entry.Description = DefaultObject->GetCreationDescription().ToString();
+            DefaultObject->GetKeywords().ToString().ToLower().ParseIntoArrayWS(Entry.LowerKeywords, TEXT(","));
+        }
+        MakeLowerCopies(Entry);
+    }
+
+    ExpressionCategories = Categories.Array();
+    ExpressionCategories.Sort();
+    bExpressionsBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Material palette: %d expressions in %.1f ms"),
+        Expressions.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMaterialPaletteIndex::BuildFunctions()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    // Without the handlers the palette would go stale; an unfinished scan would leave it incomplete
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (bFunctionsBuilt || !bInitialized || !AssetRegistry || AssetRegistry->IsLoadingAssets())
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    Functions.Reset();
+    CollectFunctions(Functions);
+    PartialFunctions.Empty();
+    bFunctionsBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Material palette: %d functions in %.1f ms"),
+        Functions.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FMaterialPaletteIndex::CollectFunctions(TMap<FSoftObjectPath, FEntry>& OutEntries)
+{
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAssetsByClass(GetMaterialFunctionClassPath(), Assets);
+
+    OutEntries.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        FEntry Entry;
+        if (MakeFunctionEntry(AssetData, Entry))
+        {
+            OutEntries.Add(AssetData.GetSoftObjectPath(), MoveTemp(Entry));
+        }
+    }
+}
+
+bool FMaterialPaletteIndex::MakeFunctionEntry(const FAssetData& AssetData, FEntry& OutEntry)
+{
+    if (AssetData.AssetClassPath != GetMaterialFunctionClassPath())
+    {
+        return false;
+    }
+
+    // Only functions exposed to the library, and never transient ones
+    if (!AssetData.GetTagValueRef<bool>(ExposeToLibraryTag) || AssetData.PackageName == GetTransientPackage()->GetFName())
+    {
+        return false;
+    }
+
+    OutEntry.bIsFunction = true;
+    OutEntry.Name = AssetData.AssetName.ToString();
+    OutEntry.Path = AssetData.GetObjectPathString();
+
+    FString LibraryCategories;
+    if (AssetData.GetTagValue(LibraryCategoriesTag, LibraryCategories) && !LibraryCategories.IsEmpty())
+    {
+        OutEntry.Categories.Add(LibraryCategories);
+    }
+    AssetData.GetTagValue(DescriptionTag, OutEntry.Description);
+
+    MakeLowerCopies(OutEntry);
+    return true;
+}
+
+void FMaterialPaletteIndex::HandleFilesLoaded()
+{
+    BuildFunctions();
+}
+
+void FMaterialPaletteIndex::HandleAssetAdded(const FAssetData& AssetData)
+{
+    if (!bFunctionsBuilt || AssetData.AssetClassPath != GetMaterialFunctionClassPath())
+    {
+        return;
+    }
+
+    // Also handles updates: a function taken out of the library leaves the palette
+    FEntry Entry;
+    if (MakeFunctionEntry(AssetData, Entry))
+    {
+        Functions.Add(AssetData.GetSoftObjectPath(), MoveTemp(Entry));
+    }
+    else
+    {
+        Functions.Remove(AssetData.GetSoftObjectPath());
+    }
+}
+
+void FMaterialPaletteIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (bFunctionsBuilt)
+    {
+        Functions.Remove(AssetData.GetSoftObjectPath());
+    }
+}
+
+void FMaterialPaletteIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (bFunctionsBuilt)
+    {
+        Functions.Remove(FSoftObjectPath(OldObjectPath));
+        HandleAssetAdded(AssetData);
+    }
+}
+
+void FMaterialPaletteIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code may add, remove or replace expression classes
+    bExpressionsBuilt = false;
+    CacheCounters.RecordInvalidation();
+}
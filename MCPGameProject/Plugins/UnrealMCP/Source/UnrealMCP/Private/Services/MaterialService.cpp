@@ -5,7 +5,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/Texture.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
+#include "Services/ActorIndex.h"
 #include "Editor.h"
 #include "Components/MeshComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -576,16 +576,7 @@ AActor* FMaterialService::FindActorByName(const FString& ActorName) const
     }
 
     UWorld* World = GEditor->GetEditorWorldContext().World();
-    for (TActorIterator<AActor> It(World); It; ++It)
-    {
-        AActor* Actor = *It;
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return Actor;
-        }
-    }
-
-    return nullptr;
+    return FActorIndex::Get().FindActorByName(World, ActorName);
 }
 
 UMeshComponent* FMaterialService::GetMeshComponent(AActor* Actor, const FString& ComponentName) const
@@ -0,0 +1,235 @@
+#include "Services/MetaSoundPaletteIndex.h"
+#include "MetasoundFrontendNodeClassRegistry.h"
+#include "MetasoundFrontendSearchEngine.h"
+#include "MCPLogging.h"
+#include "Algo/AllOf.h"
+#include "Algo/StableSort.h"
+#include "MCPMemory.h"
+
+struct FMetaSoundPaletteIndex::FRegistryWatch
+{
+    decltype(Metasound::Frontend::INodeClassRegistry::Get()->CreateTransactionStream()) Stream;
+};
+
+FMetaSoundPaletteIndex& FMetaSoundPaletteIndex::Get()
+{
+    static FMetaSoundPaletteIndex Instance;
+    return Instance;
+}
+
+FMetaSoundPaletteIndex::~FMetaSoundPaletteIndex() = default;
+
+void FMetaSoundPaletteIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (Metasound::Frontend::INodeClassRegistry* Registry = Metasound::Frontend::INodeClassRegistry::Get())
+    {
+        RegistryWatch = MakeUnique<FRegistryWatch>();
+        RegistryWatch->Stream = Registry->CreateTransactionStream();
+        bInitialized = RegistryWatch->Stream.IsValid();
+        if (!bInitialized)
+        {
+            RegistryWatch.Reset();
+        }
+    }
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("metasound_palette_index"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(Entries.Num()); });
+}
+
+void FMetaSoundPaletteIndex::Shutdown()
+{
+    check(IsInGameThread());
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("metasound_palette_index"));
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    RegistryWatch.Reset();
+    bInitialized = false;
+
+    Entries.Empty();
+    bBuilt = false;
+}
+
+void FMetaSoundPaletteIndex::Search(const FString& Query, const TArray<FName>& InputTypes, const TArray<FName>& OutputTypes, TArray<FMatch>& OutMatches)
+{
+    check(IsInGameThread());
+    OutMatches.Reset();
+
+    Build();
+
+    TArray<FString> Words;
+    Query.ToLower().ParseIntoArrayWS(Words);
+
+    for (const FEntry& Entry : Entries)
+    {
+        const bool bHasTypes = Algo::AllOf(InputTypes, [&Entry](const FName& Type) { return Entry.InputTypes.Contains(Type); })
+            && Algo::AllOf(OutputTypes, [&Entry](const FName& Type) { return Entry.OutputTypes.Contains(Type); });
+        if (!bHasTypes)
+        {
+            continue;
+        }
+
+        int32 Score = 0;
+        for (const FString& Word : Words)
+        {
+            const int32 WordScore = ScoreWord(Entry, Word);
+            if (WordScore == 0)
+            {
+                Score = 0;
+                break;
+            }
+            Score += WordScore;
+        }
+        if (Score > 0 || Words.Num() == 0)
+        {
+            OutMatches.Add(FMatch{ &Entry, Score });
+        }
+    }
+
+    // Entries are sorted by full name, so a stable sort keeps equal scores in that order
+    Algo::StableSortBy(OutMatches, [](const FMatch& Match) { return -Match.Score; });
+}
+
+int32 FMetaSoundPaletteIndex::ScoreWord(const FEntry& Entry, const FString& Word)
+{
+    if (Entry.LowerName == Word || Entry.LowerDisplayName == Word)
+    {
+        return 100;
+    }
+    if (Entry.LowerName.StartsWith(Word, ESearchCase::CaseSensitive) || Entry.LowerDisplayName.StartsWith(Word, ESearchCase::CaseSensitive))
+    {
+        return 60;
+    }
+    if (Entry.LowerName.Contains(Word, ESearchCase::CaseSensitive) || Entry.LowerDisplayName.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 40;
+    }
+    if (Entry.LowerFullName.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 35;
+    }
+
+    int32 KeywordScore = 0;
+    for (const FString& Keyword : Entry.LowerKeywords)
+    {
+        if (Keyword == Word)
+        {
+            return 30;
+        }
+        if (Keyword.Contains(Word, ESearchCase::CaseSensitive))
+        {
+            KeywordScore = 20;
+        }
+    }
+    if (KeywordScore > 0)
+    {
+        return KeywordScore;
+    }
+
+    if (Entry.LowerCategory.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 15;
+    }
+    if (Entry.LowerDescription.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 10;
+    }
+    return 0;
+}
+
+void FMetaSoundPaletteIndex::Build()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    // Without the registry stream a kept palette could go stale, so it is read for every search
+    if (RegistryWatch.IsValid())
+    {
+        const bool bWasBuilt = bBuilt;
+        RegistryWatch->Stream->Consume([this](const auto&)
+        {
+            bBuilt = false;
+        });
+        if (bWasBuilt && !bBuilt)
+        {
+            CacheCounters.RecordInvalidation();
+        }
+    }
+    if (bBuilt && bInitialized)
+    {
+        CacheCounters.RecordHit();
+        return;
+    }
+    CacheCounters.RecordMiss();
+
+#if WITH_EDITORONLY_DATA
+    using namespace Metasound::Frontend;
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // false: deprecated class versions are left out
+    const TArray<FMetasoundFrontendClass> AllClasses = ISearchEngine::Get().FindAllClasses(false);
+
+    Entries.Reset(AllClasses.Num());
+    for (const FMetasoundFrontendClass& NodeClass : AllClasses)
+    {
+        const FMetasoundFrontendClassMetadata& Metadata = NodeClass.Metadata;
+        const FMetasoundFrontendClassName& ClassName = Metadata.GetClassName();
+
+        FEntry& Entry = Entries.AddDefaulted_GetRef();
+        Entry.Namespace = ClassName.Namespace.ToString();
+        Entry.Name = ClassName.Name.ToString();
+        Entry.Variant = ClassName.Variant.ToString();
+        Entry.DisplayName = Metadata.GetDisplayName().ToString();
+        Entry.Description = Metadata.GetDescription().ToString();
+
+        TArray<FString> Categories;
+        for (const FText& Category : Metadata.GetCategoryHierarchy())
+        {
+            Categories.Add(Category.ToString());
+        }
+        Entry.Category = FString::Join(Categories, TEXT(" > "));
+
+        // Full class name as add_metasound_node reports it
+        Entry.FullName = Entry.Namespace + TEXT("::") + Entry.Name;
+        if (!Entry.Variant.IsEmpty())
+        {
+            Entry.FullName += TEXT(" (") + Entry.Variant + TEXT(")");
+        }
+
+        const FMetasoundFrontendClassInterface& Interface = NodeClass.GetDefaultInterface();
+        for (const FMetasoundFrontendClassInput& Input : Interface.Inputs)
+        {
+            Entry.Inputs.Add(FVertex{ Input.Name.ToString(), Input.TypeName.ToString() });
+            Entry.InputTypes.Add(Input.TypeName);
+        }
+        for (const FMetasoundFrontendClassOutput& Output : Interface.Outputs)
+        {
+            Entry.Outputs.Add(FVertex{ Output.Name.ToString(), Output.TypeName.ToString() });
+            Entry.OutputTypes.Add(Output.TypeName);
+        }
+
+        Entry.LowerName = Entry.Name.ToLower();
+        Entry.LowerDisplayName = Entry.DisplayName.ToLower();
+        Entry.LowerFullName = Entry.FullName.ToLower();
+        Entry.LowerCategory = Entry.Category.ToLower();
+        Entry.LowerDescription = Entry.Description.ToLower();
+        for (const FText& Keyword : Metadata.GetKeywords())
+        {
+            Entry.LowerKeywords.Add(Keyword.ToString().ToLower());
+        }
+    }
+
+    Entries.Sort([](const FEntry& A, const FEntry& B) { return A.LowerFullName < B.LowerFullName; });
+    bBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("MetaSound palette: %d node classes in %.1f ms"),
+        Entries.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+#endif
+}
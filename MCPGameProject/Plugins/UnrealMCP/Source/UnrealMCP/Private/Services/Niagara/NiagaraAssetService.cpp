@@ -206,9 +206,8 @@ bool FNiagaraService::AddEmitterToSystem(const FString& SystemPath, const FStrin
     // This is what the engine does after adding emitters - fixes ParameterMap traversal errors
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     RefreshEditors(System);
 
@@ -326,9 +325,8 @@ bool FNiagaraService::SetEmitterEnabled(const FString& SystemPath, const FString
     // Mark dirty and recompile
     MarkSystemDirty(System);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     RefreshEditors(System);
 
@@ -474,9 +472,8 @@ bool FNiagaraService::SetEmitterProperty(const FNiagaraEmitterPropertyParams& Pa
     // Mark dirty and recompile
     MarkSystemDirty(System);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     RefreshEditors(System);
 
@@ -585,9 +582,8 @@ bool FNiagaraService::RemoveEmitterFromSystem(const FString& SystemPath, const F
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request compilation and wait
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     RefreshEditors(System);
 
@@ -0,0 +1,286 @@
+// NiagaraBulkDiagnosticsService.cpp - Diagnostics of many systems
+// StartBulkDiagnostics, GetBulkDiagnostics
+
+#include "Services/NiagaraService.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "NiagaraSystem.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Result of a system that could not be checked */
+    TSharedPtr<FJsonObject> MakeBulkDiagnosticsFailure(const FString& SystemPath, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("system_path"), SystemPath);
+        Result->SetBoolField(TEXT("loaded"), false);
+        Result->SetStringField(TEXT("error"), Error);
+        return Result;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ToJsonStrings(const TArray<FString>& Strings)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Strings.Num());
+        for (const FString& String : Strings)
+        {
+            Values.Add(MakeShared<FJsonValueString>(String));
+        }
+        return Values;
+    }
+}
+
+bool FNiagaraService::StartBulkDiagnostics(const TArray<FString>& SystemPaths, const FString& PackagePath, bool bCompile, int32 MaxInFlight, int64& OutJobId, int32& OutSystemCount, FString& OutError)
+{
+    check(IsInGameThread());
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FBulkDiagnosticsJob Job;
+    TSet<FSoftObjectPath> Seen;
+    auto Enqueue = [&Job, &Seen](const FSoftObjectPath& Path)
+    {
+        if (!Seen.Contains(Path))
+        {
+            Seen.Add(Path);
+            Job.Queue.Add(Path);
+        }
+    };
+
+    if (!PackagePath.IsEmpty())
+    {
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UNiagaraSystem::StaticClass()->GetClassPathName());
+        Filter.PackagePaths.Add(FName(*PackagePath));
+        Filter.bRecursivePaths = true;
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssets(Filter, Assets);
+        for (const FAssetData& Asset : Assets)
+        {
+            Enqueue(Asset.GetSoftObjectPath());
+        }
+    }
+
+    // Short names are matched against every system in the registry, gathered once
+    TMap<FString, FSoftObjectPath> PathsByName;
+    for (const FString& SystemPath : SystemPaths)
+    {
+        if (SystemPath.StartsWith(TEXT("/")))
+        {
+            // "/Game/Effects/NS_Fire" names the asset "/Game/Effects/NS_Fire.NS_Fire"
+            FString ObjectPath = SystemPath;
+            if (!ObjectPath.Contains(TEXT(".")))
+            {
+                ObjectPath += TEXT(".") + FPaths::GetBaseFilename(ObjectPath);
+            }
+            Enqueue(FSoftObjectPath(ObjectPath));
+            continue;
+        }
+
+        if (PathsByName.Num() == 0)
+        {
+            TArray<FAssetData> Assets;
+            AssetRegistry.GetAssetsByClass(UNiagaraSystem::StaticClass()->GetClassPathName(), Assets, true);
+            for (const FAssetData& Asset : Assets)
+            {
+                PathsByName.Add(Asset.AssetName.ToString().ToLower(), Asset.GetSoftObjectPath());
+            }
+        }
+
+        if (const FSoftObjectPath* Path = PathsByName.Find(SystemPath.ToLower()))
+        {
+            Enqueue(*Path);
+        }
+        else
+        {
+            Job.Results.Add(MakeBulkDiagnosticsFailure(SystemPath, FString::Printf(TEXT("Could not find Niagara System '%s'"), *SystemPath)));
+            Job.FailedCount++;
+        }
+    }
+
+    if (Job.Queue.Num() == 0 && Job.Results.Num() == 0)
+    {
+        OutError = PackagePath.IsEmpty()
+            ? TEXT("No Niagara Systems to diagnose")
+            : FString::Printf(TEXT("No Niagara Systems found under '%s'"), *PackagePath);
+        return false;
+    }
+
+    Job.MaxInFlight = FMath::Clamp(MaxInFlight, 1, 64);
+    Job.bCompile = bCompile;
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // Results of old runs are dropped before a new run adds its own
+    TArray<int64> FinishedIds;
+    for (const TPair<int64, FBulkDiagnosticsJob>& Pair : BulkDiagnosticsJobs)
+    {
+        if (Pair.Value.bFinished)
+        {
+            FinishedIds.Add(Pair.Key);
+        }
+    }
+    FinishedIds.Sort();
+    for (int32 Index = 0; Index <= FinishedIds.Num() - MaxFinishedBulkDiagnosticsJobs; ++Index)
+    {
+        BulkDiagnosticsJobs.Remove(FinishedIds[Index]);
+    }
+
+    OutJobId = NextBulkDiagnosticsJobId++;
+    OutSystemCount = Job.SystemCount = Job.Queue.Num() + Job.Results.Num();
+    BulkDiagnosticsJobs.Add(OutJobId, MoveTemp(Job));
+
+    if (!BulkDiagnosticsTickerHandle.IsValid())
+    {
+        BulkDiagnosticsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FNiagaraService::TickBulkDiagnostics));
+    }
+
+    UE_LOG(LogNiagaraService, Log, TEXT("Started bulk diagnostics %lld of %d Niagara System(s), %d at a time"),
+        OutJobId, OutSystemCount, FMath::Clamp(MaxInFlight, 1, 64));
+    return true;
+}
+
+bool FNiagaraService::TickBulkDiagnostics(float DeltaTime)
+{
+    bool bAnyRunning = false;
+
+    for (TPair<int64, FBulkDiagnosticsJob>& Pair : BulkDiagnosticsJobs)
+    {
+        const int64 JobId = Pair.Key;
+        FBulkDiagnosticsJob& Job = Pair.Value;
+        if (Job.bFinished)
+        {
+            continue;
+        }
+
+        // Applies the results of every finished script; true once none is outstanding
+        for (int32 Index = Job.Compiling.Num() - 1; Index >= 0; --Index)
+        {
+            UNiagaraSystem* System = Job.Compiling[Index].System.Get();
+            if (!System->PollForCompilationComplete())
+            {
+                continue;
+            }
+            const FBulkDiagnosticsSystem Entry = Job.Compiling[Index];
+
+            TArray<FString> CompileMessages;
+            TArray<FString> ModuleWarnings;
+            CollectCompileDiagnostics(System, CompileMessages, ModuleWarnings);
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetStringField(TEXT("system_path"), Entry.Path.ToString());
+            Result->SetBoolField(TEXT("loaded"), true);
+            Result->SetBoolField(TEXT("valid"), System->IsValid());
+            Result->SetArrayField(TEXT("compile_messages"), ToJsonStrings(CompileMessages));
+            Result->SetArrayField(TEXT("module_warnings"), ToJsonStrings(ModuleWarnings));
+            Result->SetNumberField(TEXT("elapsed_seconds"), FPlatformTime::Seconds() - Entry.StartTime);
+            Job.Results.Add(Result);
+
+            if (!System->IsValid())
+            {
+                Job.FailedCount++;
+            }
+            Job.Compiling.RemoveAtSwap(Index);
+        }
+
+        // Keep MaxInFlight systems loading or compiling; the loads complete on the game thread
+        while (Job.NextQueued < Job.Queue.Num() && Job.LoadsInFlight + Job.Compiling.Num() < Job.MaxInFlight)
+        {
+            const FSoftObjectPath Path = Job.Queue[Job.NextQueued++];
+            Job.LoadsInFlight++;
+            LoadPackageAsync(Path.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateLambda(
+                [this, JobId, Path](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+                {
+                    HandleBulkDiagnosticsLoaded(JobId, Path, Result == EAsyncLoadingResult::Succeeded);
+                }));
+        }
+
+        if (Job.NextQueued >= Job.Queue.Num() && Job.LoadsInFlight == 0 && Job.Compiling.Num() == 0)
+        {
+            Job.bFinished = true;
+            Job.FinishTime = FPlatformTime::Seconds();
+            UE_LOG(LogNiagaraService, Log, TEXT("Bulk diagnostics %lld finished: %d system(s), %d failed, %.1f s"),
+                JobId, Job.Results.Num(), Job.FailedCount, Job.FinishTime - Job.StartTime);
+            continue;
+        }
+        bAnyRunning = true;
+    }
+
+    if (!bAnyRunning)
+    {
+        BulkDiagnosticsTickerHandle.Reset();
+    }
+    return bAnyRunning;
+}
+
+void FNiagaraService::HandleBulkDiagnosticsLoaded(int64 JobId, const FSoftObjectPath& Path, bool bSucceeded)
+{
+    FBulkDiagnosticsJob* Job = BulkDiagnosticsJobs.Find(JobId);
+    if (!Job)
+    {
+        return;
+    }
+    Job->LoadsInFlight--;
+
+    UNiagaraSystem* System = bSucceeded ? Cast<UNiagaraSystem>(Path.ResolveObject()) : nullptr;
+    if (!System)
+    {
+        Job->Results.Add(MakeBulkDiagnosticsFailure(Path.ToString(), TEXT("Failed to load Niagara System")));
+        Job->FailedCount++;
+        return;
+    }
+
+    // Without a requested compile, a system loaded without cached compile data still compiles
+    // on its own; waiting on it either way reports the final state
+    if (Job->bCompile)
+    {
+        System->RequestCompile(false);
+    }
+
+    FBulkDiagnosticsSystem& Entry = Job->Compiling.AddDefaulted_GetRef();
+    Entry.Path = Path;
+    Entry.System.Reset(System);
+    Entry.StartTime = FPlatformTime::Seconds();
+}
+
+bool FNiagaraService::GetBulkDiagnostics(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    check(IsInGameThread());
+
+    const FBulkDiagnosticsJob* Job = BulkDiagnosticsJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown bulk diagnostics job: %lld"), JobId);
+        return false;
+    }
+
+    const int32 SystemsTotal = Job->SystemCount;
+    const int32 First = FMath::Clamp(Cursor, 0, Job->Results.Num());
+    const int32 Last = FMath::Min(Job->Results.Num(), First + FMath::Max(MaxResults, 0));
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Job->Results[Index]));
+    }
+
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutStatus->SetStringField(TEXT("state"), Job->bFinished ? TEXT("finished") : TEXT("running"));
+    OutStatus->SetNumberField(TEXT("elapsed_seconds"), (Job->bFinished ? Job->FinishTime : FPlatformTime::Seconds()) - Job->StartTime);
+    OutStatus->SetNumberField(TEXT("systems_total"), SystemsTotal);
+    OutStatus->SetNumberField(TEXT("systems_completed"), Job->Results.Num());
+    OutStatus->SetNumberField(TEXT("systems_loading"), Job->LoadsInFlight);
+    OutStatus->SetNumberField(TEXT("systems_compiling"), Job->Compiling.Num());
+    OutStatus->SetNumberField(TEXT("systems_failed"), Job->FailedCount);
+    OutStatus->SetNumberField(TEXT("progress"), SystemsTotal > 0 ? static_cast<double>(Job->Results.Num()) / SystemsTotal : 1.0);
+    OutStatus->SetArrayField(TEXT("results"), ResultsArray);
+    OutStatus->SetNumberField(TEXT("next_cursor"), Last);
+    OutStatus->SetBoolField(TEXT("has_more"), Last < Job->Results.Num() || !Job->bFinished);
+    return true;
+}
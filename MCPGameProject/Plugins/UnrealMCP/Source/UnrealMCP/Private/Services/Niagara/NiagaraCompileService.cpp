@@ -1,5 +1,5 @@
 // NiagaraCompileService.cpp - Compilation
-// CompileAsset
+// CompileAsset, StartCompileAsync, GetCompileStatus
 
 #include "Services/NiagaraService.h"
 
@@ -10,259 +10,277 @@
 #include "NiagaraGraph.h"
 #include "NiagaraNodeFunctionCall.h"
 #include "NiagaraScriptSource.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 
-bool FNiagaraService::CompileAsset(const FString& AssetPath, FString& OutError)
+namespace
 {
-    // Try as system first
-    UNiagaraSystem* System = FindSystem(AssetPath);
-    if (System)
+    /** Collect deprecated, experimental and note messages of the modules in every emitter */
+    void CollectModuleWarnings(UNiagaraSystem* System, TArray<FString>& WarningMessages)
     {
-        // Request compilation
-        System->RequestCompile(false);  // false = synchronous
-        System->WaitForCompilationComplete();
-
-        // In UE5.7, we check if the system is valid after compilation
-        bool bIsValid = System->IsValid();
-
-        // Always collect warnings (even on successful compilation)
-        TArray<FString> WarningMessages;
-
-        // Helper lambda to extract module warnings (deprecated, experimental, notes)
-        auto ExtractModuleWarningsForValidation = [&WarningMessages](UNiagaraSystem* InSystem)
+        for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
         {
-            for (const FNiagaraEmitterHandle& Handle : InSystem->GetEmitterHandles())
+            FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+            if (!EmitterData)
+            {
+                continue;
+            }
+
+            auto CheckScriptModules = [&WarningMessages, &Handle](UNiagaraScript* Script, const FString& StageName)
             {
-                FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
-                if (!EmitterData)
+                if (!Script)
                 {
-                    continue;
+                    return;
                 }
 
-                auto CheckScriptModules = [&WarningMessages, &Handle](UNiagaraScript* Script, const FString& StageName)
+                UNiagaraScriptSource* ScriptSource = Cast<UNiagaraScriptSource>(Script->GetLatestSource());
+                if (!ScriptSource || !ScriptSource->NodeGraph)
                 {
-                    if (!Script)
-                    {
-                        return;
-                    }
+                    return;
+                }
 
-                    UNiagaraScriptSource* ScriptSource = Cast<UNiagaraScriptSource>(Script->GetLatestSource());
-                    if (!ScriptSource || !ScriptSource->NodeGraph)
+                for (UEdGraphNode* Node : ScriptSource->NodeGraph->Nodes)
+                {
+                    UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
+                    if (!FunctionNode || !FunctionNode->FunctionScript)
                     {
-                        return;
+                        continue;
                     }
 
-                    for (UEdGraphNode* Node : ScriptSource->NodeGraph->Nodes)
+                    FString ModuleName = FunctionNode->GetFunctionName();
+                    FVersionedNiagaraScriptData* ScriptData = FunctionNode->GetScriptData();
+
+                    if (ScriptData)
                     {
-                        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-                        if (!FunctionNode || !FunctionNode->FunctionScript)
+                        // Check for deprecation
+                        if (ScriptData->bDeprecated)
                         {
-                            continue;
-                        }
-
-                        FString ModuleName = FunctionNode->GetFunctionName();
-                        FVersionedNiagaraScriptData* ScriptData = FunctionNode->GetScriptData();
+                            FString DeprecationMsg = FString::Printf(TEXT("[%s] %s Module '%s' [DEPRECATED]"),
+                                *Handle.GetName().ToString(),
+                                *StageName,
+                                *ModuleName);
 
-                        if (ScriptData)
-                        {
-                            // Check for deprecation
-                            if (ScriptData->bDeprecated)
+                            if (!ScriptData->DeprecationMessage.IsEmpty())
                             {
-                                FString DeprecationMsg = FString::Printf(TEXT("[%s] %s Module '%s' [DEPRECATED]"),
-                                    *Handle.GetName().ToString(),
-                                    *StageName,
-                                    *ModuleName);
-
-                                if (!ScriptData->DeprecationMessage.IsEmpty())
-                                {
-                                    DeprecationMsg += TEXT(": ") + ScriptData->DeprecationMessage.ToString();
-                                }
-
-                                if (ScriptData->DeprecationRecommendation)
-                                {
-                                    DeprecationMsg += FString::Printf(TEXT(" Suggested: %s"),
-                                        *ScriptData->DeprecationRecommendation->GetPathName());
-                                }
-
-                                WarningMessages.Add(DeprecationMsg);
+                                DeprecationMsg += TEXT(": ") + ScriptData->DeprecationMessage.ToString();
                             }
 
-                            // Check for experimental
-                            if (ScriptData->bExperimental)
+                            if (ScriptData->DeprecationRecommendation)
                             {
-                                FString ExperimentalMsg = FString::Printf(TEXT("[%s] %s Module '%s' [EXPERIMENTAL]"),
-                                    *Handle.GetName().ToString(),
-                                    *StageName,
-                                    *ModuleName);
+                                DeprecationMsg += FString::Printf(TEXT(" Suggested: %s"),
+                                    *ScriptData->DeprecationRecommendation->GetPathName());
+                            }
 
-                                if (!ScriptData->ExperimentalMessage.IsEmpty())
-                                {
-                                    ExperimentalMsg += TEXT(": ") + ScriptData->ExperimentalMessage.ToString();
-                                }
+                            WarningMessages.Add(DeprecationMsg);
+                        }
 
-                                WarningMessages.Add(ExperimentalMsg);
-                            }
+                        // Check for experimental
+                        if (ScriptData->bExperimental)
+                        {
+                            FString ExperimentalMsg = FString::Printf(TEXT("[%s] %s Module '%s' [EXPERIMENTAL]"),
+                                *Handle.GetName().ToString(),
+                                *StageName,
+                                *ModuleName);
 
-                            // Check for note messages (general warnings)
-                            if (!ScriptData->NoteMessage.IsEmpty())
+                            if (!ScriptData->ExperimentalMessage.IsEmpty())
                             {
-                                WarningMessages.Add(FString::Printf(TEXT("[%s] %s Module '%s' [Note]: %s"),
-                                    *Handle.GetName().ToString(),
-                                    *StageName,
-                                    *ModuleName,
-                                    *ScriptData->NoteMessage.ToString()));
+                                ExperimentalMsg += TEXT(": ") + ScriptData->ExperimentalMessage.ToString();
                             }
+
+                            WarningMessages.Add(ExperimentalMsg);
                         }
-                    }
-                };
 
-                CheckScriptModules(EmitterData->SpawnScriptProps.Script, TEXT("Spawn"));
-                CheckScriptModules(EmitterData->UpdateScriptProps.Script, TEXT("Update"));
-            }
-        };
+                        // Check for note messages (general warnings)
+                        if (!ScriptData->NoteMessage.IsEmpty())
+                        {
+                            WarningMessages.Add(FString::Printf(TEXT("[%s] %s Module '%s' [Note]: %s"),
+                                *Handle.GetName().ToString(),
+                                *StageName,
+                                *ModuleName,
+                                *ScriptData->NoteMessage.ToString()));
+                        }
+                    }
+                }
+            };
 
-        // Collect warnings
-        ExtractModuleWarningsForValidation(System);
+            CheckScriptModules(EmitterData->SpawnScriptProps.Script, TEXT("Spawn"));
+            CheckScriptModules(EmitterData->UpdateScriptProps.Script, TEXT("Update"));
+        }
+    }
 
-        if (bIsValid)
+    /** Collect the compile errors of every emitter's scripts and the feedback of its renderers */
+    void CollectCompileErrors(UNiagaraSystem* System, TArray<FString>& ErrorMessages)
+    {
+        // Check each emitter for issues
+        for (int32 i = 0; i < System->GetEmitterHandles().Num(); i++)
         {
-            // Report warnings even on success
-            if (WarningMessages.Num() > 0)
+            const FNiagaraEmitterHandle& Handle = System->GetEmitterHandle(i);
+            FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+
+            if (!EmitterData)
             {
-                OutError = TEXT("Compilation successful with warnings:\n") + FString::Join(WarningMessages, TEXT("\n"));
+                ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s': No emitter data available"), *Handle.GetName().ToString()));
+                continue;
             }
-            UE_LOG(LogNiagaraService, Log, TEXT("Niagara System compiled successfully: %s"), *AssetPath);
-            return true;
-        }
-        else
-        {
-            // Collect detailed error information
-            TArray<FString> ErrorMessages;
 
-            // Check each emitter for issues
-            for (int32 i = 0; i < System->GetEmitterHandles().Num(); i++)
+            // Helper lambda to extract compile errors from a script
+            auto ExtractScriptErrors = [&ErrorMessages, &Handle](UNiagaraScript* Script, const FString& ScriptTypeName)
             {
-                const FNiagaraEmitterHandle& Handle = System->GetEmitterHandle(i);
-                FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
-
-                if (!EmitterData)
+                if (!Script)
                 {
-                    ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s': No emitter data available"), *Handle.GetName().ToString()));
-                    continue;
+                    return;
                 }
 
-                // Helper lambda to extract compile errors from a script
-                auto ExtractScriptErrors = [&ErrorMessages, &Handle](UNiagaraScript* Script, const FString& ScriptTypeName)
+                // Check if script has errors
+                if (!Script->IsScriptCompilationPending(false) &&
+                    Script->GetLastCompileStatus() == ENiagaraScriptCompileStatus::NCS_Error)
                 {
-                    if (!Script)
-                    {
-                        return;
-                    }
+                    // Extract actual error messages from LastCompileEvents
+                    const FNiagaraVMExecutableData& VMData = Script->GetVMExecutableData();
+                    bool bFoundSpecificError = false;
 
-                    // Check if script has errors
-                    if (!Script->IsScriptCompilationPending(false) &&
-                        Script->GetLastCompileStatus() == ENiagaraScriptCompileStatus::NCS_Error)
+                    for (const FNiagaraCompileEvent& Event : VMData.LastCompileEvents)
                     {
-                        // Extract actual error messages from LastCompileEvents
-                        const FNiagaraVMExecutableData& VMData = Script->GetVMExecutableData();
-                        bool bFoundSpecificError = false;
-
-                        for (const FNiagaraCompileEvent& Event : VMData.LastCompileEvents)
-                        {
-                            if (Event.Severity == FNiagaraCompileEventSeverity::Error)
-                            {
-                                ErrorMessages.Add(FString::Printf(TEXT("[%s] %s: %s"),
-                                    *Handle.GetName().ToString(),
-                                    *ScriptTypeName,
-                                    *Event.Message));
-                                bFoundSpecificError = true;
-                            }
-                            else if (Event.Severity == FNiagaraCompileEventSeverity::Warning)
-                            {
-                                ErrorMessages.Add(FString::Printf(TEXT("[%s] %s [Warning]: %s"),
-                                    *Handle.GetName().ToString(),
-                                    *ScriptTypeName,
-                                    *Event.Message));
-                            }
-                        }
-
-                        // Also check the ErrorMsg field
-                        if (!VMData.ErrorMsg.IsEmpty())
+                        if (Event.Severity == FNiagaraCompileEventSeverity::Error)
                         {
                             ErrorMessages.Add(FString::Printf(TEXT("[%s] %s: %s"),
                                 *Handle.GetName().ToString(),
                                 *ScriptTypeName,
-                                *VMData.ErrorMsg));
+                                *Event.Message));
                             bFoundSpecificError = true;
                         }
-
-                        // Fallback if no specific error found
-                        if (!bFoundSpecificError)
+                        else if (Event.Severity == FNiagaraCompileEventSeverity::Warning)
                         {
-                            ErrorMessages.Add(FString::Printf(TEXT("[%s] %s: Compilation error (no details available)"),
+                            ErrorMessages.Add(FString::Printf(TEXT("[%s] %s [Warning]: %s"),
                                 *Handle.GetName().ToString(),
-                                *ScriptTypeName));
+                                *ScriptTypeName,
+                                *Event.Message));
                         }
                     }
-                };
 
-                // Check spawn script
-                ExtractScriptErrors(EmitterData->SpawnScriptProps.Script, TEXT("Spawn Script"));
+                    // Also check the ErrorMsg field
+                    if (!VMData.ErrorMsg.IsEmpty())
+                    {
+                        ErrorMessages.Add(FString::Printf(TEXT("[%s] %s: %s"),
+                            *Handle.GetName().ToString(),
+                            *ScriptTypeName,
+                            *VMData.ErrorMsg));
+                        bFoundSpecificError = true;
+                    }
+
+                    // Fallback if no specific error found
+                    if (!bFoundSpecificError)
+                    {
+                        ErrorMessages.Add(FString::Printf(TEXT("[%s] %s: Compilation error (no details available)"),
+                            *Handle.GetName().ToString(),
+                            *ScriptTypeName));
+                    }
+                }
+            };
+
+            // Check spawn script
+            ExtractScriptErrors(EmitterData->SpawnScriptProps.Script, TEXT("Spawn Script"));
 
-                // Check update script
-                ExtractScriptErrors(EmitterData->UpdateScriptProps.Script, TEXT("Update Script"));
+            // Check update script
+            ExtractScriptErrors(EmitterData->UpdateScriptProps.Script, TEXT("Update Script"));
 
-                // Check renderers - use the FText version which is simpler
-                for (UNiagaraRendererProperties* Renderer : EmitterData->GetRenderers())
+            // Check renderers - use the FText version which is simpler
+            for (UNiagaraRendererProperties* Renderer : EmitterData->GetRenderers())
+            {
+                if (Renderer)
                 {
-                    if (Renderer)
-                    {
-                        // Get renderer feedback using FText version
-                        TArray<FText> RendererErrors;
-                        TArray<FText> RendererWarnings;
-                        TArray<FText> RendererInfo;
-                        Renderer->GetRendererFeedback(Handle.GetInstance(), RendererErrors, RendererWarnings, RendererInfo);
+                    // Get renderer feedback using FText version
+                    TArray<FText> RendererErrors;
+                    TArray<FText> RendererWarnings;
+                    TArray<FText> RendererInfo;
+                    Renderer->GetRendererFeedback(Handle.GetInstance(), RendererErrors, RendererWarnings, RendererInfo);
 
-                        for (const FText& Error : RendererErrors)
-                        {
-                            ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s' Renderer '%s': %s"),
-                                *Handle.GetName().ToString(),
-                                *Renderer->GetName(),
-                                *Error.ToString()));
-                        }
+                    for (const FText& Error : RendererErrors)
+                    {
+                        ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s' Renderer '%s': %s"),
+                            *Handle.GetName().ToString(),
+                            *Renderer->GetName(),
+                            *Error.ToString()));
+                    }
 
-                        // Also include warnings as they may indicate why it's invalid
-                        for (const FText& Warning : RendererWarnings)
-                        {
-                            ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s' Renderer '%s' [Warning]: %s"),
-                                *Handle.GetName().ToString(),
-                                *Renderer->GetName(),
-                                *Warning.ToString()));
-                        }
+                    // Also include warnings as they may indicate why it's invalid
+                    for (const FText& Warning : RendererWarnings)
+                    {
+                        ErrorMessages.Add(FString::Printf(TEXT("Emitter '%s' Renderer '%s' [Warning]: %s"),
+                            *Handle.GetName().ToString(),
+                            *Renderer->GetName(),
+                            *Warning.ToString()));
                     }
                 }
             }
+        }
+    }
+
+    /** @return Compile status of a script as reported by get_compile_status */
+    FString GetScriptCompileState(UNiagaraScript* Script)
+    {
+        if (Script->IsScriptCompilationPending(false))
+        {
+            return TEXT("compiling");
+        }
+
+        switch (Script->GetLastCompileStatus())
+        {
+        case ENiagaraScriptCompileStatus::NCS_UpToDate:
+            return TEXT("up_to_date");
+        case ENiagaraScriptCompileStatus::NCS_UpToDateWithWarnings:
+        case ENiagaraScriptCompileStatus::NCS_ComputeUpToDateWithWarnings:
+            return TEXT("up_to_date_with_warnings");
+        case ENiagaraScriptCompileStatus::NCS_Error:
+            return TEXT("error");
+        case ENiagaraScriptCompileStatus::NCS_Dirty:
+            return TEXT("dirty");
+        default:
+            return TEXT("unknown");
+        }
+    }
 
-            // If no specific errors found, provide generic message with hints
-            if (ErrorMessages.Num() == 0)
+    /**
+     * Describe the compile state of a set of scripts
+     * @param Scripts - Scripts to describe
+     * @param OutScripts - Receives one entry per script
+     * @param OutPendingCount - Incremented by the number of scripts still compiling
+     */
+    void DescribeScripts(const TArray<UNiagaraScript*>& Scripts, TArray<TSharedPtr<FJsonValue>>& OutScripts, int32& OutPendingCount)
+    {
+        for (UNiagaraScript* Script : Scripts)
+        {
+            if (!Script)
             {
-                ErrorMessages.Add(TEXT("System is invalid. Common causes:"));
-                ErrorMessages.Add(TEXT("- Missing required modules (InitializeParticle, etc.)"));
-                ErrorMessages.Add(TEXT("- No valid renderers configured"));
-                ErrorMessages.Add(TEXT("- Missing required particle attributes"));
-                ErrorMessages.Add(TEXT("- Unresolved parameter bindings"));
+                continue;
             }
 
-            // Add module warnings (already collected above)
-            if (WarningMessages.Num() > 0)
+            const FString State = GetScriptCompileState(Script);
+            if (State == TEXT("compiling"))
             {
-                ErrorMessages.Add(TEXT("\n--- Module Warnings ---"));
-                ErrorMessages.Append(WarningMessages);
+                OutPendingCount++;
             }
 
-            OutError = FString::Join(ErrorMessages, TEXT("\n"));
-            return false;
+            TSharedPtr<FJsonObject> ScriptObj = MakeShared<FJsonObject>();
+            ScriptObj->SetStringField(TEXT("usage"), StaticEnum<ENiagaraScriptUsage>()->GetNameStringByValue(static_cast<int64>(Script->GetUsage())));
+            ScriptObj->SetStringField(TEXT("state"), State);
+            OutScripts.Add(MakeShared<FJsonValueObject>(ScriptObj));
         }
     }
+}
+
+bool FNiagaraService::CompileAsset(const FString& AssetPath, FString& OutError)
+{
+    // Try as system first
+    UNiagaraSystem* System = FindSystem(AssetPath);
+    if (System)
+    {
+        // Request compilation
+        System->RequestCompile(false);
+        System->WaitForCompilationComplete();
+
+        return FinishCompile(System, AssetPath, OutError);
+    }
 
     // Try as standalone emitter
     UNiagaraEmitter* Emitter = FindEmitter(AssetPath);
@@ -277,3 +295,199 @@ bool FNiagaraService::CompileAsset(const FString& AssetPath, FString& OutError)
     OutError = FString::Printf(TEXT("Asset not found: %s"), *AssetPath);
     return false;
 }
+
+bool FNiagaraService::FinishCompile(UNiagaraSystem* System, const FString& AssetPath, FString& OutMessage) const
+{
+    // In UE5.7, we check if the system is valid after compilation
+    const bool bIsValid = System->IsValid();
+
+    // Always collect warnings (even on successful compilation)
+    TArray<FString> WarningMessages;
+    CollectModuleWarnings(System, WarningMessages);
+
+    if (bIsValid)
+    {
+        // Report warnings even on success
+        if (WarningMessages.Num() > 0)
+        {
+            OutMessage = TEXT("Compilation successful with warnings:\n") + FString::Join(WarningMessages, TEXT("\n"));
+        }
+        UE_LOG(LogNiagaraService, Log, TEXT("Niagara System compiled successfully: %s"), *AssetPath);
+        return true;
+    }
+
+    // Collect detailed error information
+    TArray<FString> ErrorMessages;
+    CollectCompileErrors(System, ErrorMessages);
+
+    // If no specific errors found, provide generic message with hints
+    if (ErrorMessages.Num() == 0)
+    {
+        ErrorMessages.Add(TEXT("System is invalid. Common causes:"));
+        ErrorMessages.Add(TEXT("- Missing required modules (InitializeParticle, etc.)"));
+        ErrorMessages.Add(TEXT("- No valid renderers configured"));
+        ErrorMessages.Add(TEXT("- Missing required particle attributes"));
+        ErrorMessages.Add(TEXT("- Unresolved parameter bindings"));
+    }
+
+    // Add module warnings (already collected above)
+    if (WarningMessages.Num() > 0)
+    {
+        ErrorMessages.Add(TEXT("\n--- Module Warnings ---"));
+        ErrorMessages.Append(WarningMessages);
+    }
+
+    OutMessage = FString::Join(ErrorMessages, TEXT("\n"));
+    return false;
+}
+
+void FNiagaraService::CollectCompileDiagnostics(UNiagaraSystem* System, TArray<FString>& OutCompileMessages, TArray<FString>& OutModuleWarnings) const
+{
+    CollectCompileErrors(System, OutCompileMessages);
+    CollectModuleWarnings(System, OutModuleWarnings);
+}
+
+bool FNiagaraService::StartCompileAsync(const FString& AssetPath, int64& OutJobId, FString& OutError)
+{
+    check(IsInGameThread());
+
+    UNiagaraSystem* System = FindSystem(AssetPath);
+    if (!System)
+    {
+        OutError = FindEmitter(AssetPath)
+            ? TEXT("Standalone emitters cannot be compiled asynchronously - add to a system to compile")
+            : FString::Printf(TEXT("Asset not found: %s"), *AssetPath);
+        return false;
+    }
+
+    // A second request while the system compiles joins the running job instead of restarting it
+    for (const TPair<int64, FCompileJob>& Pair : CompileJobs)
+    {
+        if (!Pair.Value.bFinished && Pair.Value.System.Get() == System)
+        {
+            OutJobId = Pair.Key;
+            return true;
+        }
+    }
+
+    System->RequestCompile(false);
+
+    OutJobId = NextCompileJobId++;
+    FCompileJob& Job = CompileJobs.Add(OutJobId);
+    Job.AssetPath = AssetPath;
+    Job.System = System;
+    Job.StartTime = FPlatformTime::Seconds();
+
+    UE_LOG(LogNiagaraService, Log, TEXT("Started asynchronous compile %lld of Niagara System: %s"), OutJobId, *AssetPath);
+    return true;
+}
+
+bool FNiagaraService::GetCompileStatus(int64 JobId, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    check(IsInGameThread());
+
+    FCompileJob* Job = CompileJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown compile job: %lld"), JobId);
+        return false;
+    }
+
+    UNiagaraSystem* System = Job->System.Get();
+    if (!Job->bFinished)
+    {
+        if (!System)
+        {
+            Job->bFinished = true;
+            Job->FinishTime = FPlatformTime::Seconds();
+            Job->Message = FString::Printf(TEXT("Niagara System was unloaded before its compile finished: %s"), *Job->AssetPath);
+        }
+        // Applies the results of every finished script; true once none is outstanding
+        else if (System->PollForCompilationComplete())
+        {
+            Job->bFinished = true;
+            Job->FinishTime = FPlatformTime::Seconds();
+            Job->bSucceeded = FinishCompile(System, Job->AssetPath, Job->Message);
+        }
+    }
+
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutStatus->SetStringField(TEXT("asset_path"), Job->AssetPath);
+    OutStatus->SetStringField(TEXT("state"), !Job->bFinished ? TEXT("compiling") : Job->bSucceeded ? TEXT("succeeded") : TEXT("failed"));
+    OutStatus->SetNumberField(TEXT("elapsed_seconds"), (Job->bFinished ? Job->FinishTime : FPlatformTime::Seconds()) - Job->StartTime);
+
+    if (System)
+    {
+        int32 TotalScripts = 0;
+        int32 PendingScripts = 0;
+
+        TArray<TSharedPtr<FJsonValue>> SystemScripts;
+        DescribeScripts({ System->GetSystemSpawnScript(), System->GetSystemUpdateScript() }, SystemScripts, PendingScripts);
+        TotalScripts += SystemScripts.Num();
+
+        TArray<TSharedPtr<FJsonValue>> EmittersArray;
+        for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
+        {
+            FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+            if (!EmitterData)
+            {
+                continue;
+            }
+
+            TArray<UNiagaraScript*> Scripts;
+            EmitterData->GetScripts(Scripts, true);
+
+            int32 EmitterPending = 0;
+            TArray<TSharedPtr<FJsonValue>> EmitterScripts;
+            DescribeScripts(Scripts, EmitterScripts, EmitterPending);
+            TotalScripts += EmitterScripts.Num();
+            PendingScripts += EmitterPending;
+
+            TSharedPtr<FJsonObject> EmitterObj = MakeShared<FJsonObject>();
+            EmitterObj->SetStringField(TEXT("name"), Handle.GetName().ToString());
+            EmitterObj->SetBoolField(TEXT("enabled"), Handle.GetIsEnabled());
+            EmitterObj->SetNumberField(TEXT("scripts_total"), EmitterScripts.Num());
+            EmitterObj->SetNumberField(TEXT("scripts_pending"), EmitterPending);
+            EmitterObj->SetArrayField(TEXT("scripts"), EmitterScripts);
+            EmittersArray.Add(MakeShared<FJsonValueObject>(EmitterObj));
+        }
+
+        OutStatus->SetArrayField(TEXT("system_scripts"), SystemScripts);
+        OutStatus->SetArrayField(TEXT("emitters"), EmittersArray);
+        OutStatus->SetNumberField(TEXT("scripts_total"), TotalScripts);
+        OutStatus->SetNumberField(TEXT("scripts_pending"), PendingScripts);
+        OutStatus->SetNumberField(TEXT("progress"), TotalScripts > 0 ? static_cast<double>(TotalScripts - PendingScripts) / TotalScripts : 1.0);
+    }
+
+    if (Job->bFinished)
+    {
+        // Same text compile_niagara_asset reports when compiling synchronously
+        OutStatus->SetStringField(Job->bSucceeded ? TEXT("message") : TEXT("error"),
+            Job->Message.IsEmpty() ? TEXT("Asset compiled successfully") : Job->Message);
+        PruneFinishedCompileJobs();
+    }
+
+    return true;
+}
+
+void FNiagaraService::PruneFinishedCompileJobs()
+{
+    TArray<int64> FinishedIds;
+    for (const TPair<int64, FCompileJob>& Pair : CompileJobs)
+    {
+        if (Pair.Value.bFinished)
+        {
+            FinishedIds.Add(Pair.Key);
+        }
+    }
+
+    if (FinishedIds.Num() > MaxFinishedCompileJobs)
+    {
+        FinishedIds.Sort();
+        for (int32 Index = 0; Index < FinishedIds.Num() - MaxFinishedCompileJobs; ++Index)
+        {
+            CompileJobs.Remove(FinishedIds[Index]);
+        }
+    }
+}
@@ -24,40 +24,6 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Curves/RichCurve.h"
 
-// ============================================================================
-// Helper to find module node by name (shared logic)
-// ============================================================================
-
-static UNiagaraNodeFunctionCall* FindModuleNodeByName(
-    UNiagaraGraph* Graph,
-    const FString& ModuleName)
-{
-    FString NormalizedSearchName = ModuleName.Replace(TEXT(" "), TEXT(""));
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                return FunctionNode;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    return PartialMatchNode;
-}
-
 // ============================================================================
 // Helper to properly remove override nodes
 // Simply removing the connected node (Input, ParameterMapGet, or FunctionCall)
@@ -468,7 +434,7 @@ bool FNiagaraService::SetModuleCurveInput(const FNiagaraModuleCurveInputParams&
     }
 
     // Find the module node
-    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNodeByName(Graph, Params.ModuleName);
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
     if (!ModuleNode)
     {
         OutError = FString::Printf(TEXT("Module '%s' not found in stage '%s'"), *Params.ModuleName, *Params.Stage);
@@ -658,7 +624,7 @@ bool FNiagaraService::SetModuleColorCurveInput(const FNiagaraModuleColorCurveInp
     }
 
     // Find the module node
-    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNodeByName(Graph, Params.ModuleName);
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
     if (!ModuleNode)
     {
         OutError = FString::Printf(TEXT("Module '%s' not found in stage '%s'"), *Params.ModuleName, *Params.Stage);
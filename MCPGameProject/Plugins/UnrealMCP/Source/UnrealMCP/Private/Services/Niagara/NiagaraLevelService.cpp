@@ -1,13 +1,124 @@
 // NiagaraLevelService.cpp - Level Integration (Feature 6)
-// SpawnActor
+// SpawnActor, SetComponentParameters
 
 #include "Services/NiagaraService.h"
 
 #include "Editor.h"
-#include "EngineUtils.h"  // For TActorIterator
+#include "Services/ActorIndex.h"
 #include "NiagaraSystem.h"
 #include "NiagaraActor.h"
 #include "NiagaraComponent.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    /** Parameter name without the "User." namespace */
+    FString GetUserParameterBaseName(const FString& Name)
+    {
+        return Name.StartsWith(TEXT("User."), ESearchCase::IgnoreCase) ? Name.RightChop(5) : Name;
+    }
+
+    /** Class of the targeted actors: a loaded class name ("NiagaraActor", "ANiagaraActor") or a class path */
+    UClass* FindTargetActorClass(const FString& ClassName)
+    {
+        UClass* ActorClass = nullptr;
+        if (ClassName.StartsWith(TEXT("/")))
+        {
+            ActorClass = LoadObject<UClass>(nullptr, *ClassName);
+        }
+        else
+        {
+            ActorClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::None);
+        }
+        if (!ActorClass && !ClassName.StartsWith(TEXT("/")))
+        {
+            ActorClass = FindFirstObject<UClass>(*(TEXT("A") + ClassName), EFindFirstObjectOptions::None);
+        }
+        return ActorClass && ActorClass->IsChildOf(AActor::StaticClass()) ? ActorClass : nullptr;
+    }
+
+    /** @return Number of values a user parameter type takes; 0 if it cannot be set from numbers */
+    int32 GetUserParameterComponentCount(const FNiagaraTypeDefinition& Type)
+    {
+        if (Type == FNiagaraTypeDefinition::GetFloatDef() || Type == FNiagaraTypeDefinition::GetIntDef() || Type == FNiagaraTypeDefinition::GetBoolDef())
+        {
+            return 1;
+        }
+        if (Type == FNiagaraTypeDefinition::GetVec2Def())
+        {
+            return 2;
+        }
+        // Colors take RGB, alpha defaulting to 1
+        if (Type == FNiagaraTypeDefinition::GetVec3Def() || Type == FNiagaraTypeDefinition::GetPositionDef() || Type == FNiagaraTypeDefinition::GetColorDef())
+        {
+            return 3;
+        }
+        if (Type == FNiagaraTypeDefinition::GetVec4Def() || Type == FNiagaraTypeDefinition::GetQuatDef())
+        {
+            return 4;
+        }
+        return 0;
+    }
+
+    /**
+     * Set one user parameter on a component through the setter of its declared type
+     * @return Empty on success, else why the value does not fit the parameter
+     */
+    FString SetComponentUserParameter(UNiagaraComponent* Component, const FNiagaraVariable& Variable, const TArray<double>& C)
+    {
+        const FNiagaraTypeDefinition& Type = Variable.GetType();
+        const FName Name = Variable.GetName();
+
+        const int32 Required = GetUserParameterComponentCount(Type);
+        if (Required == 0)
+        {
+            return FString::Printf(TEXT("Unsupported parameter type %s"), *Type.GetName());
+        }
+        if (C.Num() < Required)
+        {
+            return FString::Printf(TEXT("%s needs %d value(s), got %d"), *Type.GetName(), Required, C.Num());
+        }
+
+        if (Type == FNiagaraTypeDefinition::GetFloatDef())
+        {
+            Component->SetVariableFloat(Name, static_cast<float>(C[0]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetIntDef())
+        {
+            Component->SetVariableInt(Name, FMath::RoundToInt(C[0]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetBoolDef())
+        {
+            Component->SetVariableBool(Name, C[0] != 0.0);
+        }
+        else if (Type == FNiagaraTypeDefinition::GetVec2Def())
+        {
+            Component->SetVariableVec2(Name, FVector2D(C[0], C[1]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetVec3Def())
+        {
+            Component->SetVariableVec3(Name, FVector(C[0], C[1], C[2]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetPositionDef())
+        {
+            Component->SetVariablePosition(Name, FVector(C[0], C[1], C[2]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetVec4Def())
+        {
+            Component->SetVariableVec4(Name, FVector4(C[0], C[1], C[2], C[3]));
+        }
+        else if (Type == FNiagaraTypeDefinition::GetQuatDef())
+        {
+            Component->SetVariableQuat(Name, FQuat(C[0], C[1], C[2], C[3]));
+        }
+        else
+        {
+            Component->SetVariableLinearColor(Name, FLinearColor(C[0], C[1], C[2], C.Num() > 3 ? C[3] : 1.0));
+        }
+        return FString();
+    }
+}
 
 // ============================================================================
 // Level Integration (Feature 6)
@@ -39,13 +150,10 @@ ANiagaraActor* FNiagaraService::SpawnActor(const FNiagaraActorSpawnParams& Param
 
     // Check if actor with same name already exists
     FName RequestedName(*Params.ActorName);
-    for (TActorIterator<AActor> It(World); It; ++It)
+    if (FActorIndex::Get().FindActorByName(World, Params.ActorName) || FActorIndex::Get().FindActorByLabel(World, Params.ActorName))
     {
-        if (It->GetFName() == RequestedName || It->GetActorLabel() == Params.ActorName)
-        {
-            OutError = FString::Printf(TEXT("Actor with name '%s' already exists. Delete it first or use a different name."), *Params.ActorName);
-            return nullptr;
-        }
+        OutError = FString::Printf(TEXT("Actor with name '%s' already exists. Delete it first or use a different name."), *Params.ActorName);
+        return nullptr;
     }
 
     // Spawn the actor
@@ -89,3 +197,156 @@ ANiagaraActor* FNiagaraService::SpawnActor(const FNiagaraActorSpawnParams& Param
 
     return NiagaraActor;
 }
+
+bool FNiagaraService::SetComponentParameters(const FNiagaraComponentParametersParams& Params, TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        OutError = TEXT("No valid editor world");
+        return false;
+    }
+
+    // Targets from the actor index; an actor matched several ways is visited once
+    TArray<AActor*> Actors;
+    TArray<FString> MissingActors;
+    for (const FString& ActorName : Params.ActorNames)
+    {
+        AActor* Actor = FActorIndex::Get().FindActorByName(World, ActorName);
+        if (!Actor)
+        {
+            Actor = FActorIndex::Get().FindActorByLabel(World, ActorName);
+        }
+        if (Actor)
+        {
+            Actors.AddUnique(Actor);
+        }
+        else
+        {
+            MissingActors.Add(ActorName);
+        }
+    }
+
+    if (!Params.Tag.IsEmpty())
+    {
+        TArray<AActor*> TaggedActors;
+        FActorIndex::Get().FindActorsWithTag(World, FName(*Params.Tag), TaggedActors);
+        for (AActor* Actor : TaggedActors)
+        {
+            Actors.AddUnique(Actor);
+        }
+    }
+
+    if (!Params.ClassName.IsEmpty())
+    {
+        UClass* ActorClass = FindTargetActorClass(Params.ClassName);
+        if (!ActorClass)
+        {
+            OutError = FString::Printf(TEXT("Actor class not found: %s"), *Params.ClassName);
+            return false;
+        }
+
+        TArray<AActor*> ClassActors;
+        FActorIndex::Get().FindActorsOfClass(World, ActorClass, ClassActors);
+        for (AActor* Actor : ClassActors)
+        {
+            Actors.AddUnique(Actor);
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ComponentsArray;
+    int32 ParametersSet = 0;
+    int32 ParametersFailed = 0;
+
+    for (AActor* Actor : Actors)
+    {
+        TArray<UNiagaraComponent*> Components;
+        Actor->GetComponents(Components);
+
+        for (UNiagaraComponent* Component : Components)
+        {
+            // The component's user parameters, declared by its system, give each value its type
+            TArray<FNiagaraVariable> UserParameters;
+            Component->GetOverrideParameters().GetUserParameters(UserParameters);
+
+            Component->Modify();
+
+            TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+            int32 ComponentSet = 0;
+            for (const FNiagaraComponentParameterValue& Value : Params.Parameters)
+            {
+                const FString BaseName = GetUserParameterBaseName(Value.Name);
+                const FNiagaraVariable* Variable = UserParameters.FindByPredicate([&BaseName](const FNiagaraVariable& Candidate)
+                {
+                    return GetUserParameterBaseName(Candidate.GetName().ToString()).Equals(BaseName, ESearchCase::IgnoreCase);
+                });
+
+                const FString Error = Variable
+                    ? SetComponentUserParameter(Component, *Variable, Value.Components)
+                    : FString::Printf(TEXT("No user parameter '%s'"), *BaseName);
+                if (Error.IsEmpty())
+                {
+                    ComponentSet++;
+                }
+                else
+                {
+                    ErrorsArray.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: %s"), *BaseName, *Error)));
+                }
+            }
+
+            // One refresh per component, after all of its parameters are set
+            if (ComponentSet > 0)
+            {
+                Component->MarkRenderStateDirty();
+            }
+            ParametersSet += ComponentSet;
+            ParametersFailed += ErrorsArray.Num();
+
+            TSharedPtr<FJsonObject> ComponentObj = MakeShared<FJsonObject>();
+            ComponentObj->SetStringField(TEXT("actor"), Actor->GetActorLabel());
+            ComponentObj->SetStringField(TEXT("component"), Component->GetName());
+            ComponentObj->SetStringField(TEXT("system"), Component->GetAsset() ? Component->GetAsset()->GetPathName() : FString());
+            ComponentObj->SetNumberField(TEXT("parameters_set"), ComponentSet);
+            if (ErrorsArray.Num() > 0)
+            {
+                ComponentObj->SetArrayField(TEXT("errors"), ErrorsArray);
+            }
+            ComponentsArray.Add(MakeShared<FJsonValueObject>(ComponentObj));
+        }
+    }
+
+    if (ComponentsArray.Num() == 0)
+    {
+        OutError = Actors.Num() == 0
+            ? TEXT("No actors matched")
+            : FString::Printf(TEXT("None of the %d matched actor(s) has a Niagara component"), Actors.Num());
+        return false;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MissingArray;
+    for (const FString& ActorName : MissingActors)
+    {
+        MissingArray.Add(MakeShared<FJsonValueString>(ActorName));
+    }
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetBoolField(TEXT("success"), ParametersFailed == 0 && MissingActors.Num() == 0);
+    OutResult->SetArrayField(TEXT("components"), ComponentsArray);
+    OutResult->SetNumberField(TEXT("actor_count"), Actors.Num());
+    OutResult->SetNumberField(TEXT("component_count"), ComponentsArray.Num());
+    OutResult->SetNumberField(TEXT("parameters_set"), ParametersSet);
+    OutResult->SetNumberField(TEXT("parameters_failed"), ParametersFailed);
+    if (MissingArray.Num() > 0)
+    {
+        OutResult->SetArrayField(TEXT("missing_actors"), MissingArray);
+    }
+
+    UE_LOG(LogNiagaraService, Log, TEXT("Set %d user parameter value(s) on %d Niagara component(s) of %d actor(s)"),
+        ParametersSet, ComponentsArray.Num(), Actors.Num());
+    return true;
+}
@@ -19,40 +19,6 @@
 #include "ViewModels/Stack/NiagaraStackGraphUtilities.h"
 #include "ViewModels/Stack/NiagaraParameterHandle.h"
 
-// ============================================================================
-// Helper to find module node by name
-// ============================================================================
-
-static UNiagaraNodeFunctionCall* FindModuleNodeByNameForLinked(
-    UNiagaraGraph* Graph,
-    const FString& ModuleName)
-{
-    FString NormalizedSearchName = ModuleName.Replace(TEXT(" "), TEXT(""));
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                return FunctionNode;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    return PartialMatchNode;
-}
-
 // ============================================================================
 // Helper to properly remove override nodes
 // Simply removing the connected node (Input, ParameterMapGet, or FunctionCall)
@@ -208,7 +174,7 @@ bool FNiagaraService::SetModuleLinkedInput(const FNiagaraModuleLinkedInputParams
     }
 
     // Find the module node
-    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNodeByNameForLinked(Graph, Params.ModuleName);
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
     if (!ModuleNode)
     {
         OutError = FString::Printf(TEXT("Module '%s' not found in stage '%s'"), *Params.ModuleName, *Params.Stage);
@@ -97,35 +97,7 @@ bool FNiagaraService::SetModuleInput(const FNiagaraModuleInputParams& Params, FS
     }
 
     // Find the module node by name - prioritize exact matches
-    UNiagaraNodeFunctionCall* ModuleNode = nullptr;
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-    FString NormalizedSearchName = Params.ModuleName.Replace(TEXT(" "), TEXT(""));
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                ModuleNode = FunctionNode;
-                break;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    // Use partial match only if no exact match found
-    if (!ModuleNode && PartialMatchNode)
-    {
-        ModuleNode = PartialMatchNode;
-    }
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
 
     if (!ModuleNode)
     {
@@ -145,8 +117,7 @@ bool FNiagaraService::SetModuleInput(const FNiagaraModuleInputParams& Params, FS
         {
             MarkSystemDirty(System);
             Graph->NotifyGraphChanged();
-            System->RequestCompile(false);
-            System->WaitForCompilationComplete();
+            RequestRecompile(System);
             RefreshEditors(System);
             return true;
         }
@@ -680,8 +651,7 @@ bool FNiagaraService::SetModuleInput(const FNiagaraModuleInputParams& Params, FS
     // Mark system dirty and force recompile to update UI
     MarkSystemDirty(System);
     Graph->NotifyGraphChanged();
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    RequestRecompile(System);
 
     // Refresh editors to show updated values
     RefreshEditors(System);
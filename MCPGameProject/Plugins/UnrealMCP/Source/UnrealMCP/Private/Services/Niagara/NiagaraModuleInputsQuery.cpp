@@ -23,44 +23,149 @@
 #include "ViewModels/Stack/NiagaraStackGraphUtilities.h"
 #include "ViewModels/Stack/NiagaraParameterHandle.h"
 #include "EdGraphSchema_Niagara.h"
+#include "Utils/JsonUtils.h"
 
-// Helper to find UNiagaraNodeStaticSwitch in module graph by parameter name
-static UNiagaraNodeStaticSwitch* FindStaticSwitchNodeByName(UNiagaraGraph* Graph, const FName& ParameterName)
+// Static switch of a module, as far as get_module_inputs reports it
+struct FStaticSwitchSchema
 {
-    if (!Graph)
+    ENiagaraStaticSwitchType SwitchType = ENiagaraStaticSwitchType::Bool;
+    TWeakObjectPtr<UEnum> Enum;
+    /** Option values of an integer switch */
+    TArray<int32> OptionValues;
+    /** Enum-style dropdown names of an integer switch, by option index; empty if the switch has none */
+    TArray<FString> EnumStyleNames;
+};
+
+// Part of a module's inputs that only changes with the module script, its version or its static switches
+struct FModuleInputSchema
+{
+    /** Module inputs as FNiagaraStackGraphUtilities::GetStackFunctionInputs lists them */
+    TArray<FNiagaraVariable> Inputs;
+    /** Static switches of the module's graph by input parameter name; the first node wins */
+    TMap<FName, FStaticSwitchSchema> StaticSwitches;
+};
+
+struct FModuleInputSchemaKey
+{
+    TWeakObjectPtr<UNiagaraScript> FunctionScript;
+    FGuid ScriptVersion;
+    /** Change id of the module's graph, so edits to the module asset invalidate the entry */
+    FGuid GraphChangeId;
+    TWeakObjectPtr<UNiagaraSystem> System;
+    ENiagaraScriptUsage Usage = ENiagaraScriptUsage::Module;
+    /** Names and values of the call node's input pins; static switch values decide which inputs are visible */
+    uint32 PinValuesHash = 0;
+
+    bool operator==(const FModuleInputSchemaKey& Other) const
     {
-        return nullptr;
+        return FunctionScript == Other.FunctionScript && ScriptVersion == Other.ScriptVersion && GraphChangeId == Other.GraphChangeId
+            && System == Other.System && Usage == Other.Usage && PinValuesHash == Other.PinValuesHash;
+    }
+
+    friend uint32 GetTypeHash(const FModuleInputSchemaKey& Key)
+    {
+        uint32 Hash = HashCombine(GetTypeHash(Key.FunctionScript), GetTypeHash(Key.ScriptVersion));
+        Hash = HashCombine(Hash, GetTypeHash(Key.GraphChangeId));
+        Hash = HashCombine(Hash, GetTypeHash(Key.System));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Key.Usage)));
+        return HashCombine(Hash, Key.PinValuesHash);
     }
+};
 
-    TArray<UNiagaraNodeStaticSwitch*> StaticSwitchNodes;
-    Graph->GetNodesOfClass<UNiagaraNodeStaticSwitch>(StaticSwitchNodes);
+// Entries kept before the schema cache is cleared
+static constexpr int32 MaxModuleInputSchemas = 256;
 
-    for (UNiagaraNodeStaticSwitch* SwitchNode : StaticSwitchNodes)
+// Get the static part of a module's inputs, deriving it only the first time a module, version and
+// set of static switch values is queried. Game thread only.
+static const FModuleInputSchema& GetModuleInputSchema(UNiagaraSystem* System, UNiagaraNodeFunctionCall* ModuleNode, ENiagaraScriptUsage ScriptUsage)
+{
+    static TMap<FModuleInputSchemaKey, FModuleInputSchema> Schemas;
+    check(IsInGameThread());
+
+    UNiagaraGraph* ModuleGraph = ModuleNode->GetCalledGraph();
+
+    FModuleInputSchemaKey Key;
+    Key.FunctionScript = ModuleNode->FunctionScript;
+    Key.ScriptVersion = ModuleNode->SelectedScriptVersion;
+    Key.GraphChangeId = ModuleGraph ? ModuleGraph->GetChangeID() : FGuid();
+    Key.System = System;
+    Key.Usage = ScriptUsage;
+    for (const UEdGraphPin* Pin : ModuleNode->Pins)
     {
-        if (SwitchNode && SwitchNode->InputParameterName == ParameterName)
+        if (Pin->Direction == EGPD_Input)
         {
-            return SwitchNode;
+            Key.PinValuesHash = HashCombine(Key.PinValuesHash, HashCombine(GetTypeHash(Pin->PinName), GetTypeHash(Pin->DefaultValue)));
         }
     }
 
-    return nullptr;
-}
+    if (const FModuleInputSchema* Cached = Schemas.Find(Key))
+    {
+        return *Cached;
+    }
 
-// Helper to add enum options to JSON object from a static switch node
-static void AddStaticSwitchEnumOptions(TSharedPtr<FJsonObject>& InputObj, UNiagaraNodeStaticSwitch* SwitchNode, const FString& CurrentValue)
-{
-    if (!SwitchNode)
+    if (Schemas.Num() >= MaxModuleInputSchemas)
     {
-        return;
+        Schemas.Reset();
     }
 
-    // Access SwitchTypeData - it's a public member
-    const FStaticSwitchTypeData& SwitchTypeData = SwitchNode->SwitchTypeData;
+    FModuleInputSchema& Schema = Schemas.Add(Key);
+
+    // Get module inputs using the Stack API (same as SetModuleInput)
+    FCompileConstantResolver ConstantResolver(System, ScriptUsage);
+    FNiagaraStackGraphUtilities::GetStackFunctionInputs(
+        *ModuleNode,
+        Schema.Inputs,
+        ConstantResolver,
+        FNiagaraStackGraphUtilities::ENiagaraGetStackFunctionInputPinsOptions::ModuleInputsOnly
+    );
 
-    if (SwitchTypeData.SwitchType == ENiagaraStaticSwitchType::Enum && SwitchTypeData.Enum)
+    if (ModuleGraph)
     {
-        UEnum* EnumType = SwitchTypeData.Enum;
+        TArray<UNiagaraNodeStaticSwitch*> StaticSwitchNodes;
+        ModuleGraph->GetNodesOfClass<UNiagaraNodeStaticSwitch>(StaticSwitchNodes);
+
+        for (UNiagaraNodeStaticSwitch* SwitchNode : StaticSwitchNodes)
+        {
+            if (!SwitchNode || Schema.StaticSwitches.Contains(SwitchNode->InputParameterName))
+            {
+                continue;
+            }
 
+            FStaticSwitchSchema& Switch = Schema.StaticSwitches.Add(SwitchNode->InputParameterName);
+            Switch.SwitchType = SwitchNode->SwitchTypeData.SwitchType;
+            Switch.Enum = SwitchNode->SwitchTypeData.Enum;
+
+            if (Switch.SwitchType == ENiagaraStaticSwitchType::Integer)
+            {
+                Switch.OptionValues = SwitchNode->GetOptionValues();
+
+                // For integer switches, try to get custom display names from ScriptVariable metadata
+                // Uses the exported GetScriptVariable(FName) overload from NiagaraGraph.h
+                UNiagaraGraph* SwitchGraph = SwitchNode->GetNiagaraGraph();
+                if (SwitchGraph && !SwitchGraph->IsCompilationCopy())
+                {
+                    UNiagaraScriptVariable* ScriptVar = SwitchGraph->GetScriptVariable(SwitchNode->InputParameterName);
+                    if (ScriptVar && ScriptVar->Metadata.WidgetCustomization.WidgetType == ENiagaraInputWidgetType::EnumStyle)
+                    {
+                        for (const auto& DropdownValue : ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues)
+                        {
+                            Switch.EnumStyleNames.Add(DropdownValue.DisplayName.ToString());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return Schema;
+}
+
+// Helper to add enum options to JSON object from a static switch
+static void AddStaticSwitchEnumOptions(TSharedPtr<FJsonObject>& InputObj, const FStaticSwitchSchema& Switch, const FString& CurrentValue)
+{
+    UEnum* EnumType = Switch.Enum.Get();
+    if (Switch.SwitchType == ENiagaraStaticSwitchType::Enum && EnumType)
+    {
         // Store raw value
         InputObj->SetStringField(TEXT("raw_value"), CurrentValue);
 
@@ -96,52 +201,35 @@ static void AddStaticSwitchEnumOptions(TSharedPtr<FJsonObject>& InputObj, UNiaga
         InputObj->SetArrayField(TEXT("options"), OptionsArray);
         InputObj->SetStringField(TEXT("input_type"), TEXT("enum"));
     }
-    else if (SwitchTypeData.SwitchType == ENiagaraStaticSwitchType::Bool)
+    else if (Switch.SwitchType == ENiagaraStaticSwitchType::Bool)
     {
         InputObj->SetStringField(TEXT("input_type"), TEXT("bool"));
     }
-    else if (SwitchTypeData.SwitchType == ENiagaraStaticSwitchType::Integer)
+    else if (Switch.SwitchType == ENiagaraStaticSwitchType::Integer)
     {
         InputObj->SetStringField(TEXT("input_type"), TEXT("integer"));
 
-        // For integer switches, try to get custom display names from ScriptVariable metadata
-        // Uses the exported GetScriptVariable(FName) overload from NiagaraGraph.h
-        UNiagaraGraph* ModuleGraph = SwitchNode->GetNiagaraGraph();
-        UNiagaraScriptVariable* ScriptVar = nullptr;
-        bool bHasEnumStyleNames = false;
-
-        if (ModuleGraph && !ModuleGraph->IsCompilationCopy())
-        {
-            // Use the simpler overload that takes just the parameter name (NIAGARAEDITOR_API exported)
-            ScriptVar = ModuleGraph->GetScriptVariable(SwitchNode->InputParameterName);
-            if (ScriptVar && ScriptVar->Metadata.WidgetCustomization.WidgetType == ENiagaraInputWidgetType::EnumStyle)
-            {
-                bHasEnumStyleNames = ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues.Num() > 0;
-            }
-        }
-
         // Get option values
-        TArray<int32> OptionValues = SwitchNode->GetOptionValues();
-        if (OptionValues.Num() > 0)
+        if (Switch.OptionValues.Num() > 0)
         {
             TArray<TSharedPtr<FJsonValue>> OptionsArray;
-            for (int32 i = 0; i < OptionValues.Num(); ++i)
+            for (int32 i = 0; i < Switch.OptionValues.Num(); ++i)
             {
                 TSharedPtr<FJsonObject> OptionObj = MakeShared<FJsonObject>();
                 OptionObj->SetNumberField(TEXT("index"), i);
-                OptionObj->SetNumberField(TEXT("value"), OptionValues[i]);
+                OptionObj->SetNumberField(TEXT("value"), Switch.OptionValues[i]);
 
                 // Try to get custom display name from EnumStyleDropdownValues
                 FString DisplayName;
-                if (bHasEnumStyleNames && ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues.IsValidIndex(i))
+                if (Switch.EnumStyleNames.IsValidIndex(i))
                 {
-                    DisplayName = ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues[i].DisplayName.ToString();
+                    DisplayName = Switch.EnumStyleNames[i];
                 }
 
                 // Fallback to "Case N" if no custom name
                 if (DisplayName.IsEmpty())
                 {
-                    DisplayName = FString::Printf(TEXT("Case %d"), OptionValues[i]);
+                    DisplayName = FString::Printf(TEXT("Case %d"), Switch.OptionValues[i]);
                 }
                 OptionObj->SetStringField(TEXT("display_name"), DisplayName);
 
@@ -150,17 +238,13 @@ static void AddStaticSwitchEnumOptions(TSharedPtr<FJsonObject>& InputObj, UNiaga
             InputObj->SetArrayField(TEXT("options"), OptionsArray);
 
             // Also resolve current value display name
-            if (bHasEnumStyleNames && CurrentValue.IsNumeric())
+            if (Switch.EnumStyleNames.Num() > 0 && CurrentValue.IsNumeric())
             {
                 int32 CurrentIndex = FCString::Atoi(*CurrentValue);
-                if (ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues.IsValidIndex(CurrentIndex))
+                if (Switch.EnumStyleNames.IsValidIndex(CurrentIndex) && !Switch.EnumStyleNames[CurrentIndex].IsEmpty())
                 {
-                    FString ResolvedName = ScriptVar->Metadata.WidgetCustomization.EnumStyleDropdownValues[CurrentIndex].DisplayName.ToString();
-                    if (!ResolvedName.IsEmpty())
-                    {
-                        InputObj->SetStringField(TEXT("raw_value"), CurrentValue);
-                        InputObj->SetStringField(TEXT("value"), ResolvedName);
-                    }
+                    InputObj->SetStringField(TEXT("raw_value"), CurrentValue);
+                    InputObj->SetStringField(TEXT("value"), Switch.EnumStyleNames[CurrentIndex]);
                 }
             }
         }
@@ -746,8 +830,18 @@ static void ExtractUniformRangedValues(
     }
 }
 
+// Helper to write packed curve keys: parallel arrays instead of one object per key
+static void SetPackedCurveFields(TSharedPtr<FJsonObject>& InputObj, const TArray<float>& Times, const FString& ValuesField, const TArray<float>& Values, ENiagaraCurveDataFormat Format)
+{
+    const bool bBase64 = Format == ENiagaraCurveDataFormat::Base64;
+    InputObj->SetStringField(TEXT("curve_format"), bBase64 ? TEXT("base64") : TEXT("arrays"));
+    InputObj->SetNumberField(TEXT("key_count"), Times.Num());
+    InputObj->SetField(TEXT("times"), FJsonUtils::CreatePackedFloatArrayValue(Times, bBase64));
+    InputObj->SetField(ValuesField, FJsonUtils::CreatePackedFloatArrayValue(Values, bBase64));
+}
+
 // Helper to add curve data from a DataInterface to a JSON object
-static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataInterface* DataInterface)
+static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataInterface* DataInterface, ENiagaraCurveDataFormat Format)
 {
     if (!DataInterface)
     {
@@ -758,6 +852,23 @@ static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataIn
     if (UNiagaraDataInterfaceCurve* FloatCurveDI = Cast<UNiagaraDataInterfaceCurve>(DataInterface))
     {
         InputObj->SetStringField(TEXT("curve_type"), TEXT("Float"));
+
+        if (Format != ENiagaraCurveDataFormat::Keyframes)
+        {
+            const TArray<FRichCurveKey>& Keys = FloatCurveDI->Curve.GetConstRefOfKeys();
+            TArray<float> Times;
+            TArray<float> Values;
+            Times.Reserve(Keys.Num());
+            Values.Reserve(Keys.Num());
+            for (const FRichCurveKey& Key : Keys)
+            {
+                Times.Add(Key.Time);
+                Values.Add(Key.Value);
+            }
+            SetPackedCurveFields(InputObj, Times, TEXT("values"), Values, Format);
+            return;
+        }
+
         TArray<TSharedPtr<FJsonValue>> Keyframes;
         ExtractCurveKeyframes(FloatCurveDI->Curve, Keyframes);
         if (Keyframes.Num() > 0)
@@ -772,8 +883,6 @@ static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataIn
     {
         InputObj->SetStringField(TEXT("curve_type"), TEXT("Color"));
 
-        TArray<TSharedPtr<FJsonValue>> ColorKeyframes;
-
         // Get all unique time values across all channels
         TSet<float> TimeValues;
         for (const FRichCurveKey& Key : ColorCurveDI->RedCurve.GetConstRefOfKeys()) TimeValues.Add(Key.Time);
@@ -785,6 +894,23 @@ static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataIn
         TArray<float> SortedTimes = TimeValues.Array();
         SortedTimes.Sort();
 
+        if (Format != ENiagaraCurveDataFormat::Keyframes)
+        {
+            // RGBA of each key, interleaved
+            TArray<float> Colors;
+            Colors.Reserve(SortedTimes.Num() * 4);
+            for (float Time : SortedTimes)
+            {
+                Colors.Add(ColorCurveDI->RedCurve.Eval(Time));
+                Colors.Add(ColorCurveDI->GreenCurve.Eval(Time));
+                Colors.Add(ColorCurveDI->BlueCurve.Eval(Time));
+                Colors.Add(ColorCurveDI->AlphaCurve.Eval(Time));
+            }
+            SetPackedCurveFields(InputObj, SortedTimes, TEXT("colors"), Colors, Format);
+            return;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> ColorKeyframes;
         for (float Time : SortedTimes)
         {
             TSharedPtr<FJsonObject> KeyObj = MakeShared<FJsonObject>();
@@ -804,7 +930,7 @@ static void AddCurveDataToJson(TSharedPtr<FJsonObject>& InputObj, UNiagaraDataIn
     }
 }
 
-bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs)
+bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs, ENiagaraCurveDataFormat CurveFormat)
 {
     OutInputs = MakeShared<FJsonObject>();
 
@@ -893,35 +1019,7 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
     }
 
     // Find the module node by name - prioritize exact matches
-    UNiagaraNodeFunctionCall* ModuleNode = nullptr;
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-    FString NormalizedSearchName = ModuleName.Replace(TEXT(" "), TEXT(""));
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                ModuleNode = FunctionNode;
-                break;
-            }
-            // Track partial match as fallback (only if search name contains node name, not vice versa)
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    // Use partial match only if no exact match found
-    if (!ModuleNode && PartialMatchNode)
-    {
-        ModuleNode = PartialMatchNode;
-    }
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), ModuleName);
 
     if (!ModuleNode)
     {
@@ -936,21 +1034,27 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
     OutInputs->SetStringField(TEXT("emitter_name"), EmitterName);
     OutInputs->SetStringField(TEXT("stage"), Stage);
 
-    // Get module inputs using the Stack API (same as SetModuleInput)
-    FCompileConstantResolver ConstantResolver(System, ScriptUsage);
-    TArray<FNiagaraVariable> ModuleInputs;
-    FNiagaraStackGraphUtilities::GetStackFunctionInputs(
-        *ModuleNode,
-        ModuleInputs,
-        ConstantResolver,
-        FNiagaraStackGraphUtilities::ENiagaraGetStackFunctionInputPinsOptions::ModuleInputsOnly
-    );
+    TArray<TSharedPtr<FJsonValue>> InputsArray;
+    BuildModuleInputs(System, EmitterHandle, Script, Graph, ModuleNode, UsageValue, InputsArray, CurveFormat);
+
+    OutInputs->SetArrayField(TEXT("inputs"), InputsArray);
+    OutInputs->SetNumberField(TEXT("input_count"), InputsArray.Num());
+
+    return true;
+}
+
+void FNiagaraService::BuildModuleInputs(UNiagaraSystem* System, const FNiagaraEmitterHandle& EmitterHandle, UNiagaraScript* Script, UNiagaraGraph* Graph, UNiagaraNodeFunctionCall* ModuleNode, uint8 Usage, TArray<TSharedPtr<FJsonValue>>& InputsArray, ENiagaraCurveDataFormat CurveFormat) const
+{
+    const ENiagaraScriptUsage ScriptUsage = static_cast<ENiagaraScriptUsage>(Usage);
+
+    // Input names, types and static switch options come from the cache; only values are read below
+    const FModuleInputSchema& Schema = GetModuleInputSchema(System, ModuleNode, ScriptUsage);
+    const TArray<FNiagaraVariable>& ModuleInputs = Schema.Inputs;
 
     // Get emitter unique name for rapid iteration parameter lookup
     FString UniqueEmitterName = EmitterHandle.GetInstance().Emitter->GetUniqueEmitterName();
 
     // Collect all module inputs and their values
-    TArray<TSharedPtr<FJsonValue>> InputsArray;
     for (const FNiagaraVariable& Input : ModuleInputs)
     {
         TSharedPtr<FJsonObject> InputObj = MakeShared<FJsonObject>();
@@ -1405,21 +1509,15 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
                     // Fallback for Niagara static switches - check module's internal graph
                     if (!bEnumResolved && MatchingPin->PinType.PinCategory.ToString() == TEXT("Type"))
                     {
-                        // Get the module's internal graph to find static switch nodes
-                        UNiagaraGraph* ModuleGraph = ModuleNode->GetCalledGraph();
-                        if (ModuleGraph)
+                        // Find static switch by pin name in the module's internal graph
+                        if (const FStaticSwitchSchema* Switch = Schema.StaticSwitches.Find(MatchingPin->PinName))
                         {
-                            // Find static switch by pin name
-                            UNiagaraNodeStaticSwitch* SwitchNode = FindStaticSwitchNodeByName(ModuleGraph, MatchingPin->PinName);
-                            if (SwitchNode)
+                            // Use helper to add enum options from the static switch
+                            AddStaticSwitchEnumOptions(InputObj, *Switch, ValueStr);
+                            // Update ValueStr if helper resolved it
+                            if (InputObj->HasField(TEXT("value")))
                             {
-                                // Use helper to add enum options from the static switch node
-                                AddStaticSwitchEnumOptions(InputObj, SwitchNode, ValueStr);
-                                // Update ValueStr if helper resolved it
-                                if (InputObj->HasField(TEXT("value")))
-                                {
-                                    ValueStr = InputObj->GetStringField(TEXT("value"));
-                                }
+                                ValueStr = InputObj->GetStringField(TEXT("value"));
                             }
                         }
                     }
@@ -1439,7 +1537,7 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
         // Extract curve keyframes if we found a curve DataInterface
         if (FoundDataInterface)
         {
-            AddCurveDataToJson(InputObj, FoundDataInterface);
+            AddCurveDataToJson(InputObj, FoundDataInterface, CurveFormat);
         }
 
         InputsArray.Add(MakeShared<FJsonValueObject>(InputObj));
@@ -1561,21 +1659,15 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
                 // Static switches in Niagara don't expose UEnum via PinSubCategoryObject
                 if (!bEnumResolved && Pin->PinType.PinCategory.ToString() == TEXT("Type"))
                 {
-                    // Get the module's internal graph to find static switch nodes
-                    UNiagaraGraph* ModuleGraph = ModuleNode->GetCalledGraph();
-                    if (ModuleGraph)
+                    // Find static switch by pin name in the module's internal graph
+                    if (const FStaticSwitchSchema* Switch = Schema.StaticSwitches.Find(Pin->PinName))
                     {
-                        // Find static switch by pin name
-                        UNiagaraNodeStaticSwitch* SwitchNode = FindStaticSwitchNodeByName(ModuleGraph, Pin->PinName);
-                        if (SwitchNode)
+                        // Use helper to add enum options from the static switch
+                        AddStaticSwitchEnumOptions(InputObj, *Switch, Value);
+                        // Update Value if helper resolved it
+                        if (InputObj->HasField(TEXT("value")))
                         {
-                            // Use helper to add enum options from the static switch node
-                            AddStaticSwitchEnumOptions(InputObj, SwitchNode, Value);
-                            // Update Value if helper resolved it
-                            if (InputObj->HasField(TEXT("value")))
-                            {
-                                Value = InputObj->GetStringField(TEXT("value"));
-                            }
+                            Value = InputObj->GetStringField(TEXT("value"));
                         }
                     }
                 }
@@ -1586,9 +1678,4 @@ bool FNiagaraService::GetModuleInputs(const FString& SystemPath, const FString&
             }
         }
     }
-
-    OutInputs->SetArrayField(TEXT("inputs"), InputsArray);
-    OutInputs->SetNumberField(TEXT("input_count"), InputsArray.Num());
-
-    return true;
 }
@@ -2,6 +2,7 @@
 // AddModule, SearchModules, SetModuleInput
 
 #include "Services/NiagaraService.h"
+#include "Services/NiagaraModuleIndex.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "NiagaraSystem.h"
@@ -469,35 +470,7 @@ bool FNiagaraService::RemoveModule(const FNiagaraModuleRemoveParams& Params, FSt
     }
 
     // Find the module node by name - prioritize exact matches
-    UNiagaraNodeFunctionCall* ModuleNode = nullptr;
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-    FString NormalizedSearchName = Params.ModuleName.Replace(TEXT(" "), TEXT(""));
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                ModuleNode = FunctionNode;
-                break;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    // Use partial match only if no exact match found
-    if (!ModuleNode && PartialMatchNode)
-    {
-        ModuleNode = PartialMatchNode;
-    }
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
 
     if (!ModuleNode)
     {
@@ -562,9 +535,8 @@ bool FNiagaraService::RemoveModule(const FNiagaraModuleRemoveParams& Params, FSt
     // Notify graph of changes
     Graph->NotifyGraphChanged();
 
-    // Request compilation and wait for it
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -577,54 +549,69 @@ bool FNiagaraService::RemoveModule(const FNiagaraModuleRemoveParams& Params, FSt
 
 bool FNiagaraService::SearchModules(const FString& SearchQuery, const FString& StageFilter, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutModules)
 {
-    // This can be implemented now as it's just asset discovery
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    TArray<FAssetData> ModuleAssets;
-    AssetRegistry.GetAssetsByClass(FTopLevelAssetPath(TEXT("/Script/Niagara"), TEXT("NiagaraScript")), ModuleAssets);
-
-    int32 Count = 0;
-    for (const FAssetData& Asset : ModuleAssets)
+    // Modules declare the stages they fit in through their usage bitmask
+    int32 UsageBitmask = 0;
+    if (!StageFilter.IsEmpty())
     {
-        if (Count >= MaxResults)
+        uint8 UsageValue;
+        FString Error;
+        if (!GetScriptUsageFromStage(StageFilter, UsageValue, Error))
         {
-            break;
+            UE_LOG(LogNiagaraService, Warning, TEXT("SearchModules: %s"), *Error);
+            return false;
         }
+        UsageBitmask = 1 << UsageValue;
+    }
 
-        FString AssetName = Asset.AssetName.ToString();
+    // Served from the module index, which reads the asset registry tags without loading any script
+    TArray<FNiagaraModuleIndex::FMatch> Matches;
+    int32 TotalMatches = 0;
+    FNiagaraModuleIndex::Get().Search(SearchQuery, UsageBitmask, MaxResults, Matches, TotalMatches);
 
-        // Apply search filter - split query into words and match ALL
-        if (!SearchQuery.IsEmpty())
+    const ENiagaraScriptUsage StageUsages[] = {
+        ENiagaraScriptUsage::ParticleSpawnScript,
+        ENiagaraScriptUsage::ParticleUpdateScript,
+        ENiagaraScriptUsage::ParticleEventScript,
+        ENiagaraScriptUsage::EmitterSpawnScript,
+        ENiagaraScriptUsage::EmitterUpdateScript
+    };
+
+    for (const FNiagaraModuleIndex::FMatch& Match : Matches)
+    {
+        const FNiagaraModuleIndex::FEntry& Entry = *Match.Entry;
+
+        TSharedPtr<FJsonObject> ModuleInfo = MakeShared<FJsonObject>();
+        ModuleInfo->SetStringField(TEXT("name"), Entry.Name);
+        ModuleInfo->SetStringField(TEXT("path"), Entry.ObjectPath.ToString());
+        if (!Entry.Category.IsEmpty())
+        {
+            ModuleInfo->SetStringField(TEXT("category"), Entry.Category);
+        }
+        if (!Entry.Description.IsEmpty())
         {
-            TArray<FString> SearchWords;
-            SearchQuery.ParseIntoArray(SearchWords, TEXT(" "), true);
+            ModuleInfo->SetStringField(TEXT("description"), Entry.Description);
+        }
 
-            if (SearchWords.Num() > 0)
+        if (Entry.UsageBitmask != 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> StagesArray;
+            for (ENiagaraScriptUsage StageUsage : StageUsages)
             {
-                bool bAllWordsFound = true;
-                for (const FString& Word : SearchWords)
-                {
-                    if (!AssetName.Contains(Word, ESearchCase::IgnoreCase))
-                    {
-                        bAllWordsFound = false;
-                        break;
-                    }
-                }
-
-                if (!bAllWordsFound)
+                if (Entry.UsageBitmask & (1 << static_cast<int32>(StageUsage)))
                 {
-                    continue;
+                    StagesArray.Add(MakeShared<FJsonValueString>(GetStageFromScriptUsage(static_cast<uint8>(StageUsage))));
                 }
             }
+            ModuleInfo->SetArrayField(TEXT("stages"), StagesArray);
         }
 
-        TSharedPtr<FJsonObject> ModuleInfo = MakeShared<FJsonObject>();
-        ModuleInfo->SetStringField(TEXT("name"), AssetName);
-        ModuleInfo->SetStringField(TEXT("path"), Asset.GetObjectPathString());
+        if (Entry.bDeprecated)
+        {
+            ModuleInfo->SetBoolField(TEXT("deprecated"), true);
+        }
+        ModuleInfo->SetNumberField(TEXT("score"), Match.Score);
 
         OutModules.Add(ModuleInfo);
-        Count++;
     }
 
     return true;
@@ -715,35 +702,7 @@ bool FNiagaraService::MoveModule(const FNiagaraModuleMoveParams& Params, FString
     }
 
     // Find the module node by name - prioritize exact matches
-    UNiagaraNodeFunctionCall* ModuleNode = nullptr;
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-    FString NormalizedSearchName = Params.ModuleName.Replace(TEXT(" "), TEXT(""));
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                ModuleNode = FunctionNode;
-                break;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-    // Use partial match only if no exact match found
-    if (!ModuleNode && PartialMatchNode)
-    {
-        ModuleNode = PartialMatchNode;
-    }
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
 
     if (!ModuleNode)
     {
@@ -935,9 +894,8 @@ bool FNiagaraService::MoveModule(const FNiagaraModuleMoveParams& Params, FString
     // Notify graph of changes
     Graph->NotifyGraphChanged();
 
-    // Request compilation
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -84,9 +84,8 @@ bool FNiagaraService::AddRenderer(const FNiagaraRendererParams& Params, FString&
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -198,8 +197,7 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
         // Mark dirty and compile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        RequestRecompile(System);
         RefreshEditors(System);
 
         return true;
@@ -236,8 +234,7 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
         // Mark dirty and compile
         MarkSystemDirty(System);
         System->OnSystemPostEditChange().Broadcast(System);
-        System->RequestCompile(false);
-        System->WaitForCompilationComplete();
+        RequestRecompile(System);
         RefreshEditors(System);
 
         return true;
@@ -520,9 +517,8 @@ bool FNiagaraService::SetRendererProperty(const FString& SystemPath, const FStri
     // Broadcast post-edit change to trigger parameter map rebuilding
     System->OnSystemPostEditChange().Broadcast(System);
 
-    // Request synchronous compilation and wait for it to complete
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    // Compile now, or once when the enclosing batch scope closes
+    RequestRecompile(System);
 
     // Refresh editors
     RefreshEditors(System);
@@ -592,14 +588,29 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
     OutProperties->SetStringField(TEXT("renderer_name"), FoundRenderer->GetName());
     OutProperties->SetStringField(TEXT("renderer_type"), FoundRenderer->GetClass()->GetName());
 
+    TSharedPtr<FJsonObject> PropertiesObj;
+    TSharedPtr<FJsonObject> BindingsObj;
+    SerializeRendererProperties(FoundRenderer, PropertiesObj, BindingsObj);
+
+    OutProperties->SetObjectField(TEXT("properties"), PropertiesObj);
+    OutProperties->SetObjectField(TEXT("bindings"), BindingsObj);
+
+    UE_LOG(LogNiagaraService, Log, TEXT("Retrieved properties for renderer '%s' of type '%s'"),
+        *FoundRenderer->GetName(), *FoundRenderer->GetClass()->GetName());
+
+    return true;
+}
+
+void FNiagaraService::SerializeRendererProperties(UNiagaraRendererProperties* Renderer, TSharedPtr<FJsonObject>& PropertiesObj, TSharedPtr<FJsonObject>& BindingsObj) const
+{
     // Create properties object
-    TSharedPtr<FJsonObject> PropertiesObj = MakeShared<FJsonObject>();
+    PropertiesObj = MakeShared<FJsonObject>();
 
     // Create bindings object
-    TSharedPtr<FJsonObject> BindingsObj = MakeShared<FJsonObject>();
+    BindingsObj = MakeShared<FJsonObject>();
 
     // Iterate over all UPROPERTY fields using reflection
-    UClass* RendererClass = FoundRenderer->GetClass();
+    UClass* RendererClass = Renderer->GetClass();
     for (TFieldIterator<FProperty> PropIt(RendererClass); PropIt; ++PropIt)
     {
         FProperty* Property = *PropIt;
@@ -619,7 +630,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
         // Handle different property types
         if (FObjectProperty* ObjectProp = CastField<FObjectProperty>(Property))
         {
-            UObject* Value = ObjectProp->GetObjectPropertyValue_InContainer(FoundRenderer);
+            UObject* Value = ObjectProp->GetObjectPropertyValue_InContainer(Renderer);
             if (Value)
             {
                 PropertiesObj->SetStringField(PropName, Value->GetPathName());
@@ -631,22 +642,22 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
         }
         else if (FBoolProperty* BoolProp = CastField<FBoolProperty>(Property))
         {
-            bool Value = BoolProp->GetPropertyValue_InContainer(FoundRenderer);
+            bool Value = BoolProp->GetPropertyValue_InContainer(Renderer);
             PropertiesObj->SetBoolField(PropName, Value);
         }
         else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
         {
-            float Value = FloatProp->GetPropertyValue_InContainer(FoundRenderer);
+            float Value = FloatProp->GetPropertyValue_InContainer(Renderer);
             PropertiesObj->SetNumberField(PropName, Value);
         }
         else if (FDoubleProperty* DoubleProp = CastField<FDoubleProperty>(Property))
         {
-            double Value = DoubleProp->GetPropertyValue_InContainer(FoundRenderer);
+            double Value = DoubleProp->GetPropertyValue_InContainer(Renderer);
             PropertiesObj->SetNumberField(PropName, Value);
         }
         else if (FIntProperty* IntProp = CastField<FIntProperty>(Property))
         {
-            int32 Value = IntProp->GetPropertyValue_InContainer(FoundRenderer);
+            int32 Value = IntProp->GetPropertyValue_InContainer(Renderer);
             PropertiesObj->SetNumberField(PropName, Value);
         }
         else if (FEnumProperty* EnumProp = CastField<FEnumProperty>(Property))
@@ -657,7 +668,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
                 FNumericProperty* UnderlyingProp = EnumProp->GetUnderlyingProperty();
                 if (UnderlyingProp)
                 {
-                    const void* PropertyAddress = EnumProp->ContainerPtrToValuePtr<void>(FoundRenderer);
+                    const void* PropertyAddress = EnumProp->ContainerPtrToValuePtr<void>(Renderer);
                     int64 EnumValue = UnderlyingProp->GetSignedIntPropertyValue(PropertyAddress);
                     FString EnumName = EnumClass->GetNameStringByValue(EnumValue);
                     // Remove enum prefix if present (e.g., "ENiagaraSpriteAlignment::" -> "")
@@ -671,14 +682,14 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
             UEnum* EnumClass = ByteProp->Enum;
             if (EnumClass)
             {
-                uint8 Value = ByteProp->GetPropertyValue_InContainer(FoundRenderer);
+                uint8 Value = ByteProp->GetPropertyValue_InContainer(Renderer);
                 FString EnumName = EnumClass->GetNameStringByValue(Value);
                 EnumName.RemoveFromStart(EnumClass->GetName() + TEXT("::"));
                 PropertiesObj->SetStringField(PropName, EnumName);
             }
             else
             {
-                uint8 Value = ByteProp->GetPropertyValue_InContainer(FoundRenderer);
+                uint8 Value = ByteProp->GetPropertyValue_InContainer(Renderer);
                 PropertiesObj->SetNumberField(PropName, Value);
             }
         }
@@ -687,7 +698,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
             // Handle FNiagaraVariableAttributeBinding (bindings)
             if (StructProp->Struct && StructProp->Struct->GetName() == TEXT("NiagaraVariableAttributeBinding"))
             {
-                const FNiagaraVariableAttributeBinding* Binding = StructProp->ContainerPtrToValuePtr<FNiagaraVariableAttributeBinding>(FoundRenderer);
+                const FNiagaraVariableAttributeBinding* Binding = StructProp->ContainerPtrToValuePtr<FNiagaraVariableAttributeBinding>(Renderer);
                 if (Binding)
                 {
                     // Get the bound variable name
@@ -699,7 +710,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
             // Handle FVector2D
             else if (StructProp->Struct && StructProp->Struct->GetName() == TEXT("Vector2D"))
             {
-                const FVector2D* Vec = StructProp->ContainerPtrToValuePtr<FVector2D>(FoundRenderer);
+                const FVector2D* Vec = StructProp->ContainerPtrToValuePtr<FVector2D>(Renderer);
                 if (Vec)
                 {
                     TArray<TSharedPtr<FJsonValue>> VecArray;
@@ -711,7 +722,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
             // Handle FVector
             else if (StructProp->Struct && StructProp->Struct->GetName() == TEXT("Vector"))
             {
-                const FVector* Vec = StructProp->ContainerPtrToValuePtr<FVector>(FoundRenderer);
+                const FVector* Vec = StructProp->ContainerPtrToValuePtr<FVector>(Renderer);
                 if (Vec)
                 {
                     TArray<TSharedPtr<FJsonValue>> VecArray;
@@ -724,7 +735,7 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
             // Handle FLinearColor
             else if (StructProp->Struct && StructProp->Struct->GetName() == TEXT("LinearColor"))
             {
-                const FLinearColor* Color = StructProp->ContainerPtrToValuePtr<FLinearColor>(FoundRenderer);
+                const FLinearColor* Color = StructProp->ContainerPtrToValuePtr<FLinearColor>(Renderer);
                 if (Color)
                 {
                     TArray<TSharedPtr<FJsonValue>> ColorArray;
@@ -739,16 +750,8 @@ bool FNiagaraService::GetRendererProperties(const FString& SystemPath, const FSt
         }
         else if (FUInt32Property* UInt32Prop = CastField<FUInt32Property>(Property))
         {
-            uint32 Value = UInt32Prop->GetPropertyValue_InContainer(FoundRenderer);
+            uint32 Value = UInt32Prop->GetPropertyValue_InContainer(Renderer);
             PropertiesObj->SetNumberField(PropName, static_cast<double>(Value));
         }
     }
-
-    OutProperties->SetObjectField(TEXT("properties"), PropertiesObj);
-    OutProperties->SetObjectField(TEXT("bindings"), BindingsObj);
-
-    UE_LOG(LogNiagaraService, Log, TEXT("Retrieved properties for renderer '%s' of type '%s'"),
-        *FoundRenderer->GetName(), *FoundRenderer->GetClass()->GetName());
-
-    return true;
 }
@@ -2,10 +2,13 @@
 // FindSystem, FindEmitter, RefreshEditors, GetScriptUsageFromStage, etc.
 
 #include "Services/NiagaraService.h"
+#include "MCPSaveQueue.h"
+#include "MCPBatchEditScope.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Editor.h"
 #include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "UObject/SavePackage.h"
 #include "NiagaraSystem.h"
 #include "NiagaraEmitter.h"
@@ -49,6 +52,123 @@ namespace
         }
         return nullptr;
     }
+
+    /** Systems found by FindSystem, by the path or name they were asked for */
+    TMap<FString, TWeakObjectPtr<UNiagaraSystem>>& GetResolvedSystems()
+    {
+        static TMap<FString, TWeakObjectPtr<UNiagaraSystem>> ResolvedSystems;
+        return ResolvedSystems;
+    }
+
+    /** Emitter handle indices by name, per system */
+    TMap<TObjectKey<UNiagaraSystem>, TMap<FName, int32>>& GetEmitterIndexMaps()
+    {
+        static TMap<TObjectKey<UNiagaraSystem>, TMap<FName, int32>> EmitterIndexMaps;
+        return EmitterIndexMaps;
+    }
+
+    /** Modules of one stage in stack order, with their names normalized for lookups */
+    struct FStageModuleList
+    {
+        /** ChangeId of the graph when the list was built */
+        FGuid GraphChangeId;
+        TArray<TPair<FString, TWeakObjectPtr<UNiagaraNodeFunctionCall>>> Modules;
+        /** First module per normalized name */
+        TMap<FString, TWeakObjectPtr<UNiagaraNodeFunctionCall>> ExactMatches;
+    };
+
+    /** Resolved systems, emitter index maps or stage module lists held before each is dropped as a whole */
+    constexpr int32 MaxCachedLookups = 256;
+
+    /** Lowercase name without spaces, as module names are compared */
+    FString NormalizeModuleName(const FString& Name)
+    {
+        return Name.Replace(TEXT(" "), TEXT("")).ToLower();
+    }
+
+    /**
+     * Modules of a stage, traced from the stage's output nodes, cached until the graph's ChangeId
+     * moves on (adding, removing and relinking nodes all notify the graph)
+     */
+    const FStageModuleList& GetStageModuleList(UNiagaraGraph* Graph, ENiagaraScriptUsage Usage)
+    {
+        static TMap<TPair<TObjectKey<UNiagaraGraph>, uint8>, FStageModuleList> StageModuleLists;
+
+        const TPair<TObjectKey<UNiagaraGraph>, uint8> Key(Graph, static_cast<uint8>(Usage));
+        if (const FStageModuleList* Cached = StageModuleLists.Find(Key))
+        {
+            if (Cached->GraphChangeId == Graph->GetChangeID())
+            {
+                return *Cached;
+            }
+        }
+
+        if (StageModuleLists.Num() >= MaxCachedLookups)
+        {
+            StageModuleLists.Reset();
+        }
+
+        FStageModuleList& List = StageModuleLists.FindOrAdd(Key);
+        List.GraphChangeId = Graph->GetChangeID();
+        List.Modules.Reset();
+        List.ExactMatches.Reset();
+
+        // The stages of an emitter share one graph; event handlers have one output node each
+        bool bFoundOutputNode = false;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            UNiagaraNodeOutput* OutputNode = Cast<UNiagaraNodeOutput>(Node);
+            if (!OutputNode || OutputNode->GetUsage() != Usage)
+            {
+                continue;
+            }
+            bFoundOutputNode = true;
+
+            TArray<UNiagaraNodeFunctionCall*> StageModules;
+            UNiagaraNode* CurrentNode = OutputNode;
+            while (CurrentNode != nullptr)
+            {
+                UEdGraphPin* InputPin = GetParameterMapInputPinHelpers(*CurrentNode);
+                if (InputPin == nullptr || InputPin->LinkedTo.Num() != 1)
+                {
+                    break;
+                }
+
+                UNiagaraNode* PreviousNode = Cast<UNiagaraNode>(InputPin->LinkedTo[0]->GetOwningNode());
+                if (UNiagaraNodeFunctionCall* ModuleNode = Cast<UNiagaraNodeFunctionCall>(PreviousNode))
+                {
+                    StageModules.Insert(ModuleNode, 0);  // Insert at front (walking backwards)
+                }
+                CurrentNode = PreviousNode;
+            }
+
+            for (UNiagaraNodeFunctionCall* ModuleNode : StageModules)
+            {
+                List.Modules.Emplace(NormalizeModuleName(ModuleNode->GetFunctionName()), ModuleNode);
+            }
+        }
+
+        // Without an output node for the stage, search the whole graph as lookups always did
+        if (!bFoundOutputNode)
+        {
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (UNiagaraNodeFunctionCall* ModuleNode = Cast<UNiagaraNodeFunctionCall>(Node))
+                {
+                    List.Modules.Emplace(NormalizeModuleName(ModuleNode->GetFunctionName()), ModuleNode);
+                }
+            }
+        }
+
+        for (const TPair<FString, TWeakObjectPtr<UNiagaraNodeFunctionCall>>& Module : List.Modules)
+        {
+            if (!List.ExactMatches.Contains(Module.Key))
+            {
+                List.ExactMatches.Add(Module.Key, Module.Value);
+            }
+        }
+        return List;
+    }
 }
 
 // ============================================================================
@@ -57,10 +177,44 @@ namespace
 
 UNiagaraSystem* FNiagaraService::FindSystem(const FString& SystemPath)
 {
+    // Name the system must still have for a cached resolution to hold (e.g. "NS_Fire")
+    FString ObjectName = SystemPath;
+    int32 SeparatorIndex;
+    if (ObjectName.FindLastChar('/', SeparatorIndex))
+    {
+        ObjectName.RightChopInline(SeparatorIndex + 1);
+    }
+    if (ObjectName.FindLastChar('.', SeparatorIndex))
+    {
+        ObjectName.RightChopInline(SeparatorIndex + 1);
+    }
+
+    // Paths that needed a retried load or a registry search are not resolved again per command
+    TMap<FString, TWeakObjectPtr<UNiagaraSystem>>& ResolvedSystems = GetResolvedSystems();
+    if (const TWeakObjectPtr<UNiagaraSystem>* Resolved = ResolvedSystems.Find(SystemPath))
+    {
+        UNiagaraSystem* System = Resolved->Get();
+        if (System && System->GetName().Equals(ObjectName, ESearchCase::IgnoreCase))
+        {
+            return System;
+        }
+        ResolvedSystems.Remove(SystemPath);
+    }
+
+    auto RememberSystem = [&ResolvedSystems, &SystemPath](UNiagaraSystem* System)
+    {
+        if (ResolvedSystems.Num() >= MaxCachedLookups)
+        {
+            ResolvedSystems.Reset();
+        }
+        ResolvedSystems.Add(SystemPath, System);
+        return System;
+    };
+
     // First try direct load (works for full paths like "/Game/Effects/NS_Fire")
     if (UNiagaraSystem* System = LoadObject<UNiagaraSystem>(nullptr, *SystemPath))
     {
-        return System;
+        return RememberSystem(System);
     }
 
     // If direct load failed, try asset registry search for short names
@@ -91,7 +245,8 @@ UNiagaraSystem* FNiagaraService::FindSystem(const FString& SystemPath)
         if (AssetData.AssetName.ToString().Equals(SearchName, ESearchCase::IgnoreCase))
         {
             UE_LOG(LogNiagaraService, Log, TEXT("Found Niagara System '%s' at '%s'"), *SearchName, *AssetData.GetObjectPathString());
-            return Cast<UNiagaraSystem>(AssetData.GetAsset());
+            UNiagaraSystem* System = Cast<UNiagaraSystem>(AssetData.GetAsset());
+            return System ? RememberSystem(System) : nullptr;
         }
     }
 
@@ -166,6 +321,21 @@ void FNiagaraService::RefreshEditors(UObject* Asset)
     }
 }
 
+void FNiagaraService::RequestRecompile(UNiagaraSystem* System)
+{
+    if (!System)
+    {
+        return;
+    }
+
+    // Inside a batch, every edit to the system shares one compile
+    FMCPBatchEditScope::Defer(System, TEXT("NiagaraRecompile"), [System]()
+    {
+        System->RequestCompile(false);
+        System->WaitForCompilationComplete();
+    });
+}
+
 // ============================================================================
 // Internal Helper Methods
 // ============================================================================
@@ -228,21 +398,14 @@ FString FNiagaraService::GetStageFromScriptUsage(uint8 Usage) const
 
 bool FNiagaraService::FindEmitterHandleByName(UNiagaraSystem* System, const FString& EmitterName, const FNiagaraEmitterHandle** OutHandle) const
 {
-    if (!System)
+    const int32 EmitterIndex = FindEmitterHandleIndex(System, EmitterName);
+    if (EmitterIndex == INDEX_NONE)
     {
         return false;
     }
 
-    for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
-    {
-        if (Handle.GetName().ToString().Equals(EmitterName, ESearchCase::IgnoreCase))
-        {
-            *OutHandle = &Handle;
-            return true;
-        }
-    }
-
-    return false;
+    *OutHandle = &System->GetEmitterHandle(EmitterIndex);
+    return true;
 }
 
 int32 FNiagaraService::FindEmitterHandleIndex(UNiagaraSystem* System, const FString& EmitterName) const
@@ -252,16 +415,78 @@ int32 FNiagaraService::FindEmitterHandleIndex(UNiagaraSystem* System, const FStr
         return INDEX_NONE;
     }
 
+    // Emitter names are FNames, and FName comparison ignores case; a name not in the name table
+    // belongs to no emitter
+    const FName Name(*EmitterName, FNAME_Find);
+    if (Name.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    // A cached index is checked against its handle, so adding, removing, reordering and renaming
+    // emitters need no invalidation; a stale or missing entry rebuilds the map
     const TArray<FNiagaraEmitterHandle>& Handles = System->GetEmitterHandles();
+    TMap<TObjectKey<UNiagaraSystem>, TMap<FName, int32>>& EmitterIndexMaps = GetEmitterIndexMaps();
+    if (const TMap<FName, int32>* Indices = EmitterIndexMaps.Find(System))
+    {
+        const int32* CachedIndex = Indices->Find(Name);
+        if (CachedIndex && Handles.IsValidIndex(*CachedIndex) && Handles[*CachedIndex].GetName() == Name)
+        {
+            return *CachedIndex;
+        }
+    }
+
+    if (EmitterIndexMaps.Num() >= MaxCachedLookups)
+    {
+        EmitterIndexMaps.Reset();
+    }
+
+    TMap<FName, int32>& Indices = EmitterIndexMaps.FindOrAdd(System);
+    Indices.Reset();
     for (int32 i = 0; i < Handles.Num(); i++)
     {
-        if (Handles[i].GetName().ToString().Equals(EmitterName, ESearchCase::IgnoreCase))
+        // The first emitter with a name wins, as the linear search did
+        if (!Indices.Contains(Handles[i].GetName()))
+        {
+            Indices.Add(Handles[i].GetName(), i);
+        }
+    }
+
+    const int32* Index = Indices.Find(Name);
+    return Index ? *Index : INDEX_NONE;
+}
+
+UNiagaraNodeFunctionCall* FNiagaraService::FindModuleNode(UNiagaraGraph* Graph, uint8 Usage, const FString& ModuleName) const
+{
+    if (!Graph)
+    {
+        return nullptr;
+    }
+
+    const FString SearchName = NormalizeModuleName(ModuleName);
+    const FStageModuleList& List = GetStageModuleList(Graph, static_cast<ENiagaraScriptUsage>(Usage));
+
+    // Exact match takes priority
+    if (const TWeakObjectPtr<UNiagaraNodeFunctionCall>* ExactMatch = List.ExactMatches.Find(SearchName))
+    {
+        if (UNiagaraNodeFunctionCall* ModuleNode = ExactMatch->Get())
         {
-            return i;
+            return ModuleNode;
         }
     }
 
-    return INDEX_NONE;
+    // Fall back to the first partial match in stack order
+    for (const TPair<FString, TWeakObjectPtr<UNiagaraNodeFunctionCall>>& Module : List.Modules)
+    {
+        if (Module.Key.Contains(SearchName, ESearchCase::CaseSensitive))
+        {
+            if (UNiagaraNodeFunctionCall* ModuleNode = Module.Value.Get())
+            {
+                return ModuleNode;
+            }
+        }
+    }
+    return nullptr;
 }
 
 FVersionedNiagaraEmitterData* FNiagaraService::GetEmitterData(const FNiagaraEmitterHandle& Handle) const
@@ -712,6 +937,12 @@ bool FNiagaraService::SaveAsset(UObject* Asset, FString& OutError) const
         return false;
     }
 
+    // Written together with the other saves of this batch (see FMCPSaveQueue)
+    if (FMCPSaveQueue::Get().Enqueue(Asset))
+    {
+        return true;
+    }
+
     UPackage* Package = Asset->GetOutermost();
     Package->MarkPackageDirty();
 
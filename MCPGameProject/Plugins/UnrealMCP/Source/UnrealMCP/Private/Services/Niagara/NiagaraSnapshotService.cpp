@@ -0,0 +1,308 @@
+// NiagaraSnapshotService.cpp - Whole-system snapshot
+// GetSystemSnapshot
+
+#include "Services/NiagaraService.h"
+
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraScript.h"
+#include "NiagaraGraph.h"
+#include "NiagaraNodeFunctionCall.h"
+#include "NiagaraNodeOutput.h"
+#include "NiagaraScriptSource.h"
+#include "NiagaraRendererProperties.h"
+#include "NiagaraDataInterface.h"
+#include "NiagaraTypes.h"
+#include "EdGraphSchema_Niagara.h"
+
+namespace
+{
+    // Helper function to get parameter map input pin (replicates FNiagaraStackGraphUtilities::GetParameterMapInputPin logic)
+    UEdGraphPin* GetParameterMapInputPinSnapshot(UNiagaraNode& Node)
+    {
+        TArray<UEdGraphPin*> InputPins;
+        Node.GetInputPins(InputPins);
+
+        for (UEdGraphPin* Pin : InputPins)
+        {
+            if (Pin)
+            {
+                const UEdGraphSchema_Niagara* NiagaraSchema = Cast<UEdGraphSchema_Niagara>(Pin->GetSchema());
+                if (NiagaraSchema && NiagaraSchema->PinToTypeDefinition(Pin) == FNiagaraTypeDefinition::GetParameterMapDef())
+                {
+                    return Pin;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /** Modules of a stage in execution order, traced back from the stage's output node */
+    void GetOrderedSnapshotModules(UNiagaraGraph* Graph, ENiagaraScriptUsage Usage, TArray<UNiagaraNodeFunctionCall*>& OutModules)
+    {
+        UNiagaraNodeOutput* OutputNode = nullptr;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            UNiagaraNodeOutput* TestNode = Cast<UNiagaraNodeOutput>(Node);
+            if (TestNode && TestNode->GetUsage() == Usage)
+            {
+                OutputNode = TestNode;
+                break;
+            }
+        }
+
+        UNiagaraNode* CurrentNode = OutputNode;
+        while (CurrentNode != nullptr)
+        {
+            UEdGraphPin* InputPin = GetParameterMapInputPinSnapshot(*CurrentNode);
+            if (InputPin == nullptr || InputPin->LinkedTo.Num() != 1)
+            {
+                break;
+            }
+
+            UNiagaraNode* PreviousNode = Cast<UNiagaraNode>(InputPin->LinkedTo[0]->GetOwningNode());
+            if (UNiagaraNodeFunctionCall* ModuleNode = Cast<UNiagaraNodeFunctionCall>(PreviousNode))
+            {
+                OutModules.Insert(ModuleNode, 0);  // Insert at front (walking backwards)
+            }
+            CurrentNode = PreviousNode;
+        }
+    }
+
+    /** Stage script of an emitter, with the stage name get_emitter_modules uses for it */
+    struct FSnapshotStage
+    {
+        const TCHAR* Name;
+        UNiagaraScript* Script;
+        ENiagaraScriptUsage Usage;
+    };
+}
+
+bool FNiagaraService::GetSystemSnapshot(const FString& SystemPath, const TArray<FString>* Fields, const FString& EmitterName, TSharedPtr<FJsonObject>& OutSnapshot, FString& OutError, ENiagaraCurveDataFormat CurveFormat)
+{
+    UNiagaraSystem* System = FindSystem(SystemPath);
+    if (!System)
+    {
+        OutError = FString::Printf(TEXT("System not found: %s"), *SystemPath);
+        return false;
+    }
+
+    if (!EmitterName.IsEmpty() && FindEmitterHandleIndex(System, EmitterName) == INDEX_NONE)
+    {
+        OutError = FString::Printf(TEXT("Emitter '%s' not found in system '%s'"), *EmitterName, *SystemPath);
+        return false;
+    }
+
+    const bool bIncludeAll = !Fields || Fields->Num() == 0 || Fields->Contains(TEXT("*"));
+    auto WantsField = [bIncludeAll, Fields](const TCHAR* Field)
+    {
+        return bIncludeAll || Fields->Contains(Field);
+    };
+
+    // Inputs are listed per module, so asking for them implies the modules
+    const bool bIncludeInputs = WantsField(TEXT("inputs"));
+    const bool bIncludeModules = bIncludeInputs || WantsField(TEXT("modules"));
+    const bool bIncludeInputOptions = Fields && Fields->Contains(TEXT("input_options"));
+    const bool bIncludeRendererProperties = Fields && Fields->Contains(TEXT("renderer_properties"));
+    const bool bIncludeRenderers = bIncludeRendererProperties || WantsField(TEXT("renderers"));
+    const bool bIncludeDataInterfaces = WantsField(TEXT("data_interfaces"));
+
+    OutSnapshot = MakeShared<FJsonObject>();
+    OutSnapshot->SetStringField(TEXT("system_path"), SystemPath);
+    OutSnapshot->SetStringField(TEXT("system_name"), System->GetName());
+
+    // System-level sections come from the same code get_niagara_metadata uses
+    TArray<FString> SystemFields;
+    for (const TCHAR* Field : { TEXT("status"), TEXT("parameters") })
+    {
+        if (WantsField(Field))
+        {
+            SystemFields.Add(Field);
+        }
+    }
+    if (SystemFields.Num() > 0)
+    {
+        AddSystemMetadata(System, &SystemFields, OutSnapshot, FString(), FString());
+    }
+
+    int32 ModuleCount = 0;
+    int32 InputCount = 0;
+    TArray<TSharedPtr<FJsonValue>> EmittersArray;
+    for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
+    {
+        if (!EmitterName.IsEmpty() && !Handle.GetName().ToString().Equals(EmitterName, ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> EmitterObj = MakeShared<FJsonObject>();
+        EmitterObj->SetStringField(TEXT("name"), Handle.GetName().ToString());
+        EmitterObj->SetBoolField(TEXT("enabled"), Handle.GetIsEnabled());
+
+        FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+        if (!EmitterData)
+        {
+            EmitterObj->SetStringField(TEXT("error"), TEXT("No emitter data available"));
+            EmittersArray.Add(MakeShared<FJsonValueObject>(EmitterObj));
+            continue;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> EmitterDataInterfaces;
+
+        if (bIncludeModules)
+        {
+            TArray<FSnapshotStage> Stages = {
+                { TEXT("EmitterSpawn"), EmitterData->EmitterSpawnScriptProps.Script, ENiagaraScriptUsage::EmitterSpawnScript },
+                { TEXT("EmitterUpdate"), EmitterData->EmitterUpdateScriptProps.Script, ENiagaraScriptUsage::EmitterUpdateScript },
+                { TEXT("ParticleSpawn"), EmitterData->SpawnScriptProps.Script, ENiagaraScriptUsage::ParticleSpawnScript },
+                { TEXT("ParticleUpdate"), EmitterData->UpdateScriptProps.Script, ENiagaraScriptUsage::ParticleUpdateScript }
+            };
+            for (const FNiagaraEventScriptProperties& EventProps : EmitterData->GetEventHandlers())
+            {
+                Stages.Add({ TEXT("Event"), EventProps.Script, ENiagaraScriptUsage::ParticleEventScript });
+            }
+
+            TSharedPtr<FJsonObject> StagesObj = MakeShared<FJsonObject>();
+            for (const FSnapshotStage& Stage : Stages)
+            {
+                UNiagaraScriptSource* ScriptSource = Stage.Script ? Cast<UNiagaraScriptSource>(Stage.Script->GetLatestSource()) : nullptr;
+                if (!ScriptSource || !ScriptSource->NodeGraph)
+                {
+                    continue;
+                }
+
+                TArray<UNiagaraNodeFunctionCall*> Modules;
+                GetOrderedSnapshotModules(ScriptSource->NodeGraph, Stage.Usage, Modules);
+
+                // Event handlers share one stage entry, as in get_emitter_modules
+                TArray<TSharedPtr<FJsonValue>> ModulesArray = StagesObj->HasField(Stage.Name)
+                    ? StagesObj->GetArrayField(Stage.Name)
+                    : TArray<TSharedPtr<FJsonValue>>();
+
+                for (UNiagaraNodeFunctionCall* ModuleNode : Modules)
+                {
+                    TSharedPtr<FJsonObject> ModuleObj = MakeShared<FJsonObject>();
+                    ModuleObj->SetStringField(TEXT("name"), ModuleNode->GetFunctionName());
+                    ModuleObj->SetNumberField(TEXT("index"), ModulesArray.Num());
+                    ModuleObj->SetBoolField(TEXT("enabled"), ModuleNode->IsNodeEnabled());
+                    if (ModuleNode->FunctionScript)
+                    {
+                        ModuleObj->SetStringField(TEXT("script_path"), ModuleNode->FunctionScript->GetPathName());
+                    }
+
+                    if (bIncludeInputs)
+                    {
+                        TArray<TSharedPtr<FJsonValue>> InputsArray;
+                        BuildModuleInputs(System, Handle, Stage.Script, ScriptSource->NodeGraph, ModuleNode, static_cast<uint8>(Stage.Usage), InputsArray, CurveFormat);
+
+                        for (const TSharedPtr<FJsonValue>& InputValue : InputsArray)
+                        {
+                            const TSharedPtr<FJsonObject>& InputObj = InputValue->AsObject();
+
+                            // Keep the snapshot compact; get_module_inputs has the full entries
+                            InputObj->RemoveField(TEXT("full_name"));
+                            if (!bIncludeInputOptions)
+                            {
+                                InputObj->RemoveField(TEXT("options"));
+                            }
+
+                            FString ValueMode;
+                            if (bIncludeDataInterfaces && InputObj->TryGetStringField(TEXT("value_mode"), ValueMode) && ValueMode == TEXT("DataInterface"))
+                            {
+                                TSharedPtr<FJsonObject> DataInterfaceObj = MakeShared<FJsonObject>();
+                                DataInterfaceObj->SetStringField(TEXT("module"), ModuleNode->GetFunctionName());
+                                DataInterfaceObj->SetStringField(TEXT("stage"), Stage.Name);
+                                DataInterfaceObj->SetStringField(TEXT("input"), InputObj->GetStringField(TEXT("name")));
+                                DataInterfaceObj->SetStringField(TEXT("value"), InputObj->GetStringField(TEXT("value")));
+                                EmitterDataInterfaces.Add(MakeShared<FJsonValueObject>(DataInterfaceObj));
+                            }
+                        }
+
+                        ModuleObj->SetArrayField(TEXT("inputs"), InputsArray);
+                        InputCount += InputsArray.Num();
+                    }
+
+                    ModulesArray.Add(MakeShared<FJsonValueObject>(ModuleObj));
+                    ModuleCount++;
+                }
+
+                StagesObj->SetArrayField(Stage.Name, ModulesArray);
+            }
+            EmitterObj->SetObjectField(TEXT("stages"), StagesObj);
+        }
+
+        if (bIncludeRenderers)
+        {
+            TArray<TSharedPtr<FJsonValue>> RenderersArray;
+            for (UNiagaraRendererProperties* Renderer : EmitterData->GetRenderers())
+            {
+                if (!Renderer)
+                {
+                    continue;
+                }
+
+                TSharedPtr<FJsonObject> RendererObj = MakeShared<FJsonObject>();
+                RendererObj->SetStringField(TEXT("name"), Renderer->GetName());
+                RendererObj->SetStringField(TEXT("type"), Renderer->GetClass()->GetName());
+                RendererObj->SetBoolField(TEXT("enabled"), Renderer->GetIsEnabled());
+
+                if (bIncludeRendererProperties)
+                {
+                    TSharedPtr<FJsonObject> PropertiesObj;
+                    TSharedPtr<FJsonObject> BindingsObj;
+                    SerializeRendererProperties(Renderer, PropertiesObj, BindingsObj);
+                    RendererObj->SetObjectField(TEXT("properties"), PropertiesObj);
+                    RendererObj->SetObjectField(TEXT("bindings"), BindingsObj);
+                }
+
+                RenderersArray.Add(MakeShared<FJsonValueObject>(RendererObj));
+            }
+            EmitterObj->SetArrayField(TEXT("renderers"), RenderersArray);
+        }
+
+        if (bIncludeDataInterfaces && bIncludeInputs)
+        {
+            EmitterObj->SetArrayField(TEXT("data_interfaces"), EmitterDataInterfaces);
+        }
+
+        EmittersArray.Add(MakeShared<FJsonValueObject>(EmitterObj));
+    }
+
+    OutSnapshot->SetArrayField(TEXT("emitters"), EmittersArray);
+    OutSnapshot->SetNumberField(TEXT("emitter_count"), EmittersArray.Num());
+    if (bIncludeModules)
+    {
+        OutSnapshot->SetNumberField(TEXT("module_count"), ModuleCount);
+    }
+    if (bIncludeInputs)
+    {
+        OutSnapshot->SetNumberField(TEXT("input_count"), InputCount);
+    }
+
+    // Data interfaces exposed as user parameters
+    if (bIncludeDataInterfaces)
+    {
+        TArray<TSharedPtr<FJsonValue>> UserDataInterfaces;
+        const FNiagaraParameterStore& Store = System->GetExposedParameters();
+        TArray<FNiagaraVariable> Params;
+        Store.GetParameters(Params);
+
+        for (const FNiagaraVariable& Param : Params)
+        {
+            if (!Param.IsDataInterface())
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> DataInterfaceObj = MakeShared<FJsonObject>();
+            DataInterfaceObj->SetStringField(TEXT("name"), Param.GetName().ToString());
+            UNiagaraDataInterface* DataInterface = Store.GetDataInterface(Param);
+            DataInterfaceObj->SetStringField(TEXT("type"), DataInterface ? DataInterface->GetClass()->GetName() : Param.GetType().GetName());
+            UserDataInterfaces.Add(MakeShared<FJsonValueObject>(DataInterfaceObj));
+        }
+        OutSnapshot->SetArrayField(TEXT("user_data_interfaces"), UserDataInterfaces);
+    }
+
+    OutSnapshot->SetBoolField(TEXT("success"), true);
+    return true;
+}
@@ -93,37 +93,7 @@ bool FNiagaraService::SetModuleStaticSwitch(const FNiagaraModuleStaticSwitchPara
     }
 
     // Find the module node by name - prioritize exact matches
-    UNiagaraNodeFunctionCall* ModuleNode = nullptr;
-    UNiagaraNodeFunctionCall* PartialMatchNode = nullptr;
-    FString NormalizedSearchName = Params.ModuleName.Replace(TEXT(" "), TEXT(""));
-
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        UNiagaraNodeFunctionCall* FunctionNode = Cast<UNiagaraNodeFunctionCall>(Node);
-        if (FunctionNode)
-        {
-            FString NodeName = FunctionNode->GetFunctionName();
-            FString NormalizedNodeName = NodeName.Replace(TEXT(" "), TEXT(""));
-
-            // Exact match takes priority
-            if (NormalizedNodeName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                ModuleNode = FunctionNode;
-                break;
-            }
-            // Track partial match as fallback
-            if (!PartialMatchNode && NormalizedNodeName.Contains(NormalizedSearchName, ESearchCase::IgnoreCase))
-            {
-                PartialMatchNode = FunctionNode;
-            }
-        }
-    }
-
-    // Use partial match only if no exact match found
-    if (!ModuleNode && PartialMatchNode)
-    {
-        ModuleNode = PartialMatchNode;
-    }
+    UNiagaraNodeFunctionCall* ModuleNode = FindModuleNode(Graph, static_cast<uint8>(ScriptUsage), Params.ModuleName);
 
     if (!ModuleNode)
     {
@@ -295,8 +265,7 @@ bool FNiagaraService::SetModuleStaticSwitch(const FNiagaraModuleStaticSwitchPara
     // Mark dirty, notify, and recompile - static switches require recompilation
     MarkSystemDirty(System);
     Graph->NotifyGraphChanged();
-    System->RequestCompile(false);
-    System->WaitForCompilationComplete();
+    RequestRecompile(System);
     RefreshEditors(System);
 
     UE_LOG(LogNiagaraService, Log, TEXT("Successfully set static switch '%s' on module '%s' to '%s'"),
@@ -0,0 +1,342 @@
+#include "Services/NiagaraModuleIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "MCPLogging.h"
+#include "MCPMemory.h"
+
+namespace
+{
+    /** UNiagaraScript's class and the asset registry tags of its latest version */
+    const FTopLevelAssetPath NiagaraScriptClassPath(TEXT("/Script/Niagara"), TEXT("NiagaraScript"));
+    const FName UsageTag(TEXT("Usage"));
+    const FName ModuleUsageBitmaskTag(TEXT("ModuleUsageBitmask"));
+    const FName CategoryTag(TEXT("Category"));
+    const FName DescriptionTag(TEXT("Description"));
+    const FName KeywordsTag(TEXT("Keywords"));
+    const FName DeprecatedTag(TEXT("bDeprecated"));
+
+    /** Value of a tag holding an FText, which may be written in its exported form */
+    FString GetTextTagValue(const FAssetData& AssetData, FName Tag)
+    {
+        FString Value;
+        if (!AssetData.GetTagValue(Tag, Value))
+        {
+            return FString();
+        }
+
+        if (FTextStringHelper::IsComplexText(*Value))
+        {
+            FText Text;
+            if (FTextStringHelper::ReadFromBuffer(*Value, Text))
+            {
+                return Text.ToString();
+            }
+        }
+        return Value;
+    }
+}
+
+FNiagaraModuleIndex& FNiagaraModuleIndex::Get()
+{
+    static FNiagaraModuleIndex Instance;
+    return Instance;
+}
+
+void FNiagaraModuleIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        FilesLoadedHandle = AssetRegistry->OnFilesLoaded().AddRaw(this, &FNiagaraModuleIndex::HandleFilesLoaded);
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FNiagaraModuleIndex::HandleAssetAdded);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FNiagaraModuleIndex::HandleAssetRemoved);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FNiagaraModuleIndex::HandleAssetRenamed);
+        AssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddRaw(this, &FNiagaraModuleIndex::HandleAssetAdded);
+        bInitialized = true;
+
+        FMCPCacheStatsRegistry::Get().Register(TEXT("niagara_module_index"), TEXT("index"), CacheCounters,
+            [this]() { return static_cast<int64>(Entries.Num()); });
+        Build();
+    }
+}
+
+void FNiagaraModuleIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    // The asset registry may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+    FilesLoadedHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("niagara_module_index"));
+
+    Entries.Empty();
+    PartialEntries.Empty();
+    bBuilt = false;
+}
+
+void FNiagaraModuleIndex::Search(const FString& Query, int32 UsageBitmask, int32 MaxResults, TArray<FMatch>& OutMatches, int32& OutTotalMatches)
+{
+    check(IsInGameThread());
+    OutMatches.Reset();
+    OutTotalMatches = 0;
+
+    if (bBuilt)
+    {
+        CacheCounters.RecordHit();
+    }
+    else
+    {
+        CacheCounters.RecordMiss();
+    }
+    Build();
+    const TMap<FSoftObjectPath, FEntry>* SearchedEntries = &Entries;
+    if (!bBuilt)
+    {
+        PartialEntries.Reset();
+        CollectEntries(PartialEntries);
+        SearchedEntries = &PartialEntries;
+    }
+
+    TArray<FString> Words;
+    Query.ToLower().ParseIntoArrayWS(Words);
+
+    for (const TPair<FSoftObjectPath, FEntry>& Pair : *SearchedEntries)
+    {
+        const FEntry& Entry = Pair.Value;
+        if (UsageBitmask != 0 && Entry.UsageBitmask != 0 && (Entry.UsageBitmask & UsageBitmask) == 0)
+        {
+            continue;
+        }
+
+        int32 Score = 0;
+        bool bAllWordsFound = true;
+        for (const FString& Word : Words)
+        {
+            const int32 WordScore = ScoreWord(Entry, Word);
+            if (WordScore == 0)
+            {
+                bAllWordsFound = false;
+                break;
+            }
+            Score += WordScore;
+        }
+        if (!bAllWordsFound)
+        {
+            continue;
+        }
+
+        // Deprecated modules still match, behind their replacements
+        if (Entry.bDeprecated)
+        {
+            Score /= 2;
+        }
+
+        OutMatches.Add(FMatch{ &Entry, Score });
+    }
+
+    OutMatches.Sort([](const FMatch& A, const FMatch& B)
+    {
+        if (A.Score != B.Score)
+        {
+            return A.Score > B.Score;
+        }
+        return A.Entry->LowerName < B.Entry->LowerName;
+    });
+
+    OutTotalMatches = OutMatches.Num();
+    if (OutMatches.Num() > FMath::Max(MaxResults, 0))
+    {
+        OutMatches.SetNum(FMath::Max(MaxResults, 0));
+    }
+}
+
+int32 FNiagaraModuleIndex::ScoreWord(const FEntry& Entry, const FString& Word)
+{
+    if (Entry.LowerName == Word)
+    {
+        return 100;
+    }
+    if (Entry.LowerName.StartsWith(Word, ESearchCase::CaseSensitive))
+    {
+        return 60;
+    }
+    if (Entry.LowerName.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 40;
+    }
+
+    int32 KeywordScore = 0;
+    for (const FString& Keyword : Entry.LowerKeywords)
+    {
+        if (Keyword == Word)
+        {
+            return 30;
+        }
+        if (Keyword.StartsWith(Word, ESearchCase::CaseSensitive))
+        {
+            KeywordScore = 20;
+        }
+    }
+    if (KeywordScore > 0)
+    {
+        return KeywordScore;
+    }
+
+    if (Entry.LowerCategory.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 15;
+    }
+    if (Entry.LowerDescription.Contains(Word, ESearchCase::CaseSensitive))
+    {
+        return 10;
+    }
+    return 0;
+}
+
+void FNiagaraModuleIndex::Build()
+{
+    LLM_SCOPE_BYTAG(UnrealMCP_Caches);
+    // Without the handlers the index would go stale; an unfinished scan would leave it incomplete
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (bBuilt || !bInitialized || !AssetRegistry || AssetRegistry->IsLoadingAssets())
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    Entries.Reset();
+    CollectEntries(Entries);
+    PartialEntries.Empty();
+    bBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Niagara module index: %d modules in %.1f ms"),
+        Entries.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FNiagaraModuleIndex::CollectEntries(TMap<FSoftObjectPath, FEntry>& OutEntries)
+{
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    TArray<FAssetData> Assets;
+    AssetRegistry->GetAssetsByClass(NiagaraScriptClassPath, Assets);
+
+    OutEntries.Reserve(Assets.Num());
+    for (const FAssetData& AssetData : Assets)
+    {
+        FEntry Entry;
+        if (MakeEntry(AssetData, Entry))
+        {
+            OutEntries.Add(Entry.ObjectPath, MoveTemp(Entry));
+        }
+    }
+}
+
+bool FNiagaraModuleIndex::MakeEntry(const FAssetData& AssetData, FEntry& OutEntry)
+{
+    if (AssetData.AssetClassPath != NiagaraScriptClassPath)
+    {
+        return false;
+    }
+
+    // Dynamic inputs and functions are scripts too; the tag holds the ENiagaraScriptUsage name,
+    // qualified or not depending on the engine version that saved the asset
+    FString Usage;
+    if (AssetData.GetTagValue(UsageTag, Usage))
+    {
+        int32 ScopeIndex = INDEX_NONE;
+        if (Usage.FindLastChar(TEXT(':'), ScopeIndex))
+        {
+            Usage.RightChopInline(ScopeIndex + 1);
+        }
+        if (!Usage.Equals(TEXT("Module"), ESearchCase::IgnoreCase))
+        {
+            return false;
+        }
+    }
+
+    OutEntry.ObjectPath = AssetData.GetSoftObjectPath();
+    OutEntry.Name = AssetData.AssetName.ToString();
+    OutEntry.Category = GetTextTagValue(AssetData, CategoryTag);
+    OutEntry.Description = GetTextTagValue(AssetData, DescriptionTag);
+
+    FString Bitmask;
+    if (AssetData.GetTagValue(ModuleUsageBitmaskTag, Bitmask))
+    {
+        OutEntry.UsageBitmask = FCString::Atoi(*Bitmask);
+    }
+
+    FString Deprecated;
+    OutEntry.bDeprecated = AssetData.GetTagValue(DeprecatedTag, Deprecated) && Deprecated.ToBool();
+
+    OutEntry.LowerName = OutEntry.Name.ToLower();
+    OutEntry.LowerCategory = OutEntry.Category.ToLower();
+    OutEntry.LowerDescription = OutEntry.Description.ToLower();
+    GetTextTagValue(AssetData, KeywordsTag).ToLower().ParseIntoArrayWS(OutEntry.LowerKeywords, TEXT(","));
+    return true;
+}
+
+void FNiagaraModuleIndex::HandleFilesLoaded()
+{
+    Build();
+}
+
+void FNiagaraModuleIndex::HandleAssetAdded(const FAssetData& AssetData)
+{
+    if (!bBuilt || AssetData.AssetClassPath != NiagaraScriptClassPath)
+    {
+        return;
+    }
+
+    // Also handles updates: a module whose usage changed away from Module leaves the index
+    FEntry Entry;
+    if (MakeEntry(AssetData, Entry))
+    {
+        Entries.Add(Entry.ObjectPath, MoveTemp(Entry));
+    }
+    else
+    {
+        Entries.Remove(AssetData.GetSoftObjectPath());
+    }
+}
+
+void FNiagaraModuleIndex::HandleAssetRemoved(const FAssetData& AssetData)
+{
+    if (bBuilt)
+    {
+        Entries.Remove(AssetData.GetSoftObjectPath());
+    }
+}
+
+void FNiagaraModuleIndex::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    if (bBuilt)
+    {
+        Entries.Remove(FSoftObjectPath(OldObjectPath));
+        HandleAssetAdded(AssetData);
+    }
+}
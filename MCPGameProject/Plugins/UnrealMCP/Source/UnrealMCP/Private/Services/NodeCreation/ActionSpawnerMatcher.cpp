@@ -2,6 +2,7 @@
 
 #include "ActionSpawnerMatcher.h"
 #include "BlueprintActionDatabase.h"
+#include "UObject/ObjectKey.h"
 #include "BlueprintNodeSpawner.h"
 #include "K2Node_CallFunction.h"
 #include "NodeCreationHelpers.h"
@@ -135,201 +136,434 @@ TArray<FString> FActionSpawnerMatcher::BuildSearchNames(const FString& FunctionN
     return SearchNames;
 }
 
-void FActionSpawnerMatcher::FindMatchingSpawners(
-    const TArray<FString>& SearchNames,
-    const FString& ClassName,
-    TArray<FMatchedSpawnerInfo>& OutMatchedSpawners,
-    TMap<FString, TArray<FString>>& OutMatchingFunctionsByClass
-)
+/**
+ * Described spawners of the action database, found by the lowercase names MatchSpawner compares:
+ * node title, function name, and function name without its K2_/BP_ prefix. Built by the first
+ * lookup; database entries refreshed or removed later are queued through OnEntryUpdated and
+ * OnEntryRemoved and described again by the next lookup, and a code reload drops the index.
+ * Game thread only.
+ */
+class FActionSpawnerMatcher::FSpawnerIndex
 {
-    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
-    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
+public:
+    static FSpawnerIndex& Get()
+    {
+        static FSpawnerIndex Instance;
+        return Instance;
+    }
 
-    UE_LOG(LogTemp, Warning, TEXT("FindMatchingSpawners: Found %d action categories, searching for %d name variations"), ActionRegistry.Num(), SearchNames.Num());
+    /** Descriptions that may match one of the search names, in database order */
+    void FindCandidates(const TArray<FString>& SearchNames, TArray<const FSpawnerDescription*>& OutCandidates)
+    {
+        EnsureCurrent();
 
-    int32 ProcessedSpawners = 0;
+        TArray<int32> Slots;
+        for (const FString& SearchName : SearchNames)
+        {
+            AppendSlots(SearchName.ToLower(), Slots);
+            AppendSlots(NormalizeFunctionName(SearchName).ToLower(), Slots);
+        }
+        Slots.Sort();
 
-    for (const auto& ActionPair : ActionRegistry)
-    {
-        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        int32 PreviousSlot = INDEX_NONE;
+        for (int32 Slot : Slots)
         {
-            ProcessedSpawners++;
-            if (ProcessedSpawners % 1000 == 0)
+            if (Slot != PreviousSlot && Spawners[Slot].IsValid())
             {
-                UE_LOG(LogTemp, Verbose, TEXT("FindMatchingSpawners: Processed %d spawners so far..."), ProcessedSpawners);
+                OutCandidates.Add(&Descriptions[Slot]);
             }
+            PreviousSlot = Slot;
+        }
+    }
 
-            if (!NodeSpawner || !IsValid(NodeSpawner))
+    int32 Num() const
+    {
+        return Descriptions.Num() - RemovedCount;
+    }
+
+    void Prewarm()
+    {
+        EnsureCurrent();
+    }
+
+    void Shutdown()
+    {
+        // The handles are only set once the database exists, so this never creates it
+        if (EntryUpdatedHandle.IsValid())
+        {
+            FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+            Database.OnEntryUpdated().Remove(EntryUpdatedHandle);
+            Database.OnEntryRemoved().Remove(EntryRemovedHandle);
+            FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+            EntryUpdatedHandle.Reset();
+            EntryRemovedHandle.Reset();
+            ReloadCompleteHandle.Reset();
+        }
+        Reset();
+        bBuilt = false;
+    }
+
+private:
+    /** Removed slots tolerated before the index is rebuilt instead of patched */
+    static constexpr int32 MaxRemovedSlots = 4096;
+
+    /** Queued database entries above which rebuilding beats patching */
+    static constexpr int32 MaxPendingOwners = 512;
+
+    void EnsureCurrent()
+    {
+        if (bBuilt && ((RemovedCount > MaxRemovedSlots && RemovedCount > Descriptions.Num() / 2) || PendingOwners.Num() > MaxPendingOwners))
+        {
+            bBuilt = false;
+        }
+        if (!bBuilt)
+        {
+            Build();
+            return;
+        }
+
+        for (const FObjectKey& Owner : PendingOwners)
+        {
+            RemoveOwner(Owner);
+            AddOwner(Owner);
+        }
+        PendingOwners.Reset();
+    }
+
+    void Build()
+    {
+        Reset();
+
+        FBlueprintActionDatabase& Database = FBlueprintActionDatabase::Get();
+        if (!EntryUpdatedHandle.IsValid())
+        {
+            EntryUpdatedHandle = Database.OnEntryUpdated().AddRaw(this, &FSpawnerIndex::HandleEntryChanged);
+            EntryRemovedHandle = Database.OnEntryRemoved().AddRaw(this, &FSpawnerIndex::HandleEntryChanged);
+            ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FSpawnerIndex::HandleReloadComplete);
+        }
+
+        for (const auto& ActionPair : Database.GetAllActions())
+        {
+            AddOwner(ActionPair.Key);
+        }
+        bBuilt = true;
+        UE_LOG(LogTemp, Log, TEXT("FSpawnerIndex: Described %d spawners"), Descriptions.Num());
+    }
+
+    void Reset()
+    {
+        Descriptions.Reset();
+        Spawners.Reset();
+        SlotsByOwner.Reset();
+        SlotsByName.Reset();
+        PendingOwners.Reset();
+        RemovedCount = 0;
+    }
+
+    void AddOwner(const FObjectKey& Owner)
+    {
+        const FBlueprintActionDatabase::FActionList* ActionList = FBlueprintActionDatabase::Get().GetAllActions().Find(Owner);
+        if (!ActionList)
+        {
+            return;
+        }
+
+        for (const UBlueprintNodeSpawner* NodeSpawner : *ActionList)
+        {
+            FSpawnerDescription Description;
+            if (!DescribeSpawner(NodeSpawner, Description))
             {
                 continue;
             }
 
-            UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
-            if (!TemplateNode)
+            TArray<FString, TInlineAllocator<3>> Names;
+            Names.Add(Description.NodeName.ToLower());
+            if (!Description.FunctionName.IsEmpty())
             {
-                continue;
+                Names.AddUnique(Description.FunctionName.ToLower());
+                Names.AddUnique(NormalizeFunctionName(Description.FunctionName).ToLower());
             }
 
-            // Try to match based on node type and function name
-            FString NodeName = TEXT("");
-            FString NodeClass = TemplateNode->GetClass()->GetName();
-            FString FunctionNameFromNode = TEXT("");
-            FString DetectedClassName = TEXT("Unknown");
+            const int32 Slot = Descriptions.Add(MoveTemp(Description));
+            Spawners.Add(NodeSpawner);
+            for (const FString& Name : Names)
+            {
+                SlotsByName.FindOrAdd(Name).Add(Slot);
+            }
+            SlotsByOwner.FindOrAdd(Owner).Add(Slot);
+        }
+    }
 
-            // Get human-readable node name
-            if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
+    void RemoveOwner(const FObjectKey& Owner)
+    {
+        TArray<int32> Slots;
+        if (!SlotsByOwner.RemoveAndCopyValue(Owner, Slots))
+        {
+            return;
+        }
+
+        // Name slots keep pointing here; lookups skip the slot for its missing spawner
+        for (int32 Slot : Slots)
+        {
+            Descriptions[Slot] = FSpawnerDescription();
+            Spawners[Slot].Reset();
+            ++RemovedCount;
+        }
+    }
+
+    void AppendSlots(const FString& Name, TArray<int32>& OutSlots) const
+    {
+        if (const TArray<int32>* Slots = SlotsByName.Find(Name))
+        {
+            OutSlots.Append(*Slots);
+        }
+    }
+
+    void HandleEntryChanged(UObject* ActionKey)
+    {
+        // Describing a removed entry again finds no actions for it, which leaves it removed
+        if (bBuilt && ActionKey)
+        {
+            PendingOwners.Add(FObjectKey(ActionKey));
+        }
+    }
+
+    void HandleReloadComplete(EReloadCompleteReason Reason)
+    {
+        // Reloaded code replaces spawners and the functions they call
+        bBuilt = false;
+    }
+
+    /** Slots are never reused; removed ones are left without a spawner */
+    TArray<FSpawnerDescription> Descriptions;
+    TArray<TWeakObjectPtr<const UBlueprintNodeSpawner>> Spawners;
+    TMap<FObjectKey, TArray<int32>> SlotsByOwner;
+    TMap<FString, TArray<int32>> SlotsByName;
+    TSet<FObjectKey> PendingOwners;
+    int32 RemovedCount = 0;
+    bool bBuilt = false;
+
+    FDelegateHandle EntryUpdatedHandle;
+    FDelegateHandle EntryRemovedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
+
+void FActionSpawnerMatcher::ShutdownSpawnerIndex()
+{
+    check(IsInGameThread());
+    FSpawnerIndex::Get().Shutdown();
+}
+
+void FActionSpawnerMatcher::PrewarmSpawnerIndex()
+{
+    check(IsInGameThread());
+    FSpawnerIndex::Get().Prewarm();
+}
+
+bool FActionSpawnerMatcher::DescribeSpawner(const UBlueprintNodeSpawner* NodeSpawner, FSpawnerDescription& OutDescription)
+{
+    if (!NodeSpawner || !IsValid(NodeSpawner))
+    {
+        return false;
+    }
+
+    UEdGraphNode* TemplateNode = NodeSpawner->GetTemplateNode();
+    if (!TemplateNode)
+    {
+        return false;
+    }
+
+    OutDescription.Spawner = NodeSpawner;
+    OutDescription.DetectedClassName = TEXT("Unknown");
+    const FString NodeClass = TemplateNode->GetClass()->GetName();
+
+    // Get human-readable node name
+    if (UK2Node* K2Node = Cast<UK2Node>(TemplateNode))
+    {
+        OutDescription.NodeName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+        if (OutDescription.NodeName.IsEmpty())
+        {
+            OutDescription.NodeName = K2Node->GetClass()->GetName();
+        }
+
+        // For function calls, get the function name and class
+        if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(K2Node))
+        {
+            if (UFunction* Function = FunctionNode->GetTargetFunction())
             {
-                NodeName = K2Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
-                if (NodeName.IsEmpty())
+                OutDescription.FunctionName = Function->GetName();
+                if (OutDescription.NodeName.IsEmpty() || OutDescription.NodeName == NodeClass)
                 {
-                    NodeName = K2Node->GetClass()->GetName();
+                    OutDescription.NodeName = OutDescription.FunctionName;
                 }
-
-                // For function calls, get the function name and class
-                if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(K2Node))
+                if (UClass* OwnerClass = Function->GetOwnerClass())
                 {
-                    if (UFunction* Function = FunctionNode->GetTargetFunction())
-                    {
-                        FunctionNameFromNode = Function->GetName();
-                        if (NodeName.IsEmpty() || NodeName == NodeClass)
-                        {
-                            NodeName = FunctionNameFromNode;
-                        }
-                        if (UClass* OwnerClass = Function->GetOwnerClass())
-                        {
-                            DetectedClassName = OwnerClass->GetName();
-                        }
-                    }
+                    OutDescription.DetectedClassName = OwnerClass->GetName();
+                    OutDescription.bHasOwnerClass = true;
                 }
             }
-            else
-            {
-                NodeName = TemplateNode->GetClass()->GetName();
-            }
+        }
+    }
+    else
+    {
+        OutDescription.NodeName = NodeClass;
+    }
+    return true;
+}
 
-            // Check if any of our search names match
-            bool bFoundMatch = false;
-            bool bExactMatch = false;
-            FString MatchedName;
+void FActionSpawnerMatcher::MatchSpawner(
+    const FSpawnerDescription& Description,
+    const TArray<FString>& SearchNames,
+    const FString& ClassName,
+    TArray<FMatchedSpawnerInfo>& OutMatchedSpawners,
+    TMap<FString, TArray<FString>>& OutMatchingFunctionsByClass
+)
+{
+    const FString& NodeName = Description.NodeName;
+    const FString& FunctionNameFromNode = Description.FunctionName;
+
+    // Check if any of our search names match
+    bool bFoundMatch = false;
+    bool bExactMatch = false;
+
+    for (const FString& SearchName : SearchNames)
+    {
+        // Try exact match on node title
+        if (NodeName.Equals(SearchName, ESearchCase::IgnoreCase))
+        {
+            bFoundMatch = true;
+            bExactMatch = true;
+            break;
+        }
 
+        // Try exact match on function name
+        if (!FunctionNameFromNode.IsEmpty() && FunctionNameFromNode.Equals(SearchName, ESearchCase::IgnoreCase))
+        {
+            bFoundMatch = true;
+            bExactMatch = true;
+            break;
+        }
+
+        // Try partial match (for operations like "+" which might show as "Add (float)")
+        if (!bFoundMatch && NodeName.Contains(SearchName, ESearchCase::IgnoreCase))
+        {
+            bFoundMatch = true;
+            bExactMatch = false;
+            // Don't break - keep searching for exact match
+        }
+    }
+
+    if (!bFoundMatch)
+    {
+        return;
+    }
+
+    // When ClassName is NOT specified, prefer exact function name matches
+    if (ClassName.IsEmpty() && !bExactMatch)
+    {
+        bool bIsExactFunctionMatch = false;
+        if (!FunctionNameFromNode.IsEmpty())
+        {
             for (const FString& SearchName : SearchNames)
             {
-                // Try exact match on node title
-                if (NodeName.Equals(SearchName, ESearchCase::IgnoreCase))
+                if (FunctionNameFromNode.Equals(SearchName, ESearchCase::IgnoreCase))
                 {
-                    bFoundMatch = true;
-                    bExactMatch = true;
-                    MatchedName = SearchName;
+                    bIsExactFunctionMatch = true;
                     break;
                 }
+            }
+        }
+        if (!bIsExactFunctionMatch)
+        {
+            return; // Skip partial matches when looking for exact
+        }
+    }
 
-                // Try exact match on function name
-                if (!FunctionNameFromNode.IsEmpty() && FunctionNameFromNode.Equals(SearchName, ESearchCase::IgnoreCase))
-                {
-                    bFoundMatch = true;
-                    bExactMatch = true;
-                    MatchedName = SearchName;
-                    break;
-                }
+    // Check class name filter
+    if (!ClassName.IsEmpty() && !(Description.bHasOwnerClass && ClassNameMatches(Description.DetectedClassName, ClassName)))
+    {
+        return;
+    }
 
-                // Try partial match (for operations like "+" which might show as "Add (float)")
-                if (!bFoundMatch && NodeName.Contains(SearchName, ESearchCase::IgnoreCase))
-                {
-                    bFoundMatch = true;
-                    bExactMatch = false;
-                    MatchedName = SearchName;
-                    // Don't break - keep searching for exact match
-                }
-            }
+    // Check exact function name match when class is specified
+    if (!ClassName.IsEmpty() && !FunctionNameFromNode.IsEmpty())
+    {
+        FString NormalizedFunctionName = NormalizeFunctionName(FunctionNameFromNode);
+        bool bFunctionNameMatches = false;
 
-            if (!bFoundMatch)
+        for (const FString& SearchName : SearchNames)
+        {
+            FString NormalizedSearchName = NormalizeFunctionName(SearchName);
+            if (NormalizedFunctionName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
             {
-                continue;
+                bFunctionNameMatches = true;
+                break;
             }
+        }
 
-            // When ClassName is NOT specified, prefer exact function name matches
-            if (ClassName.IsEmpty() && !bExactMatch)
-            {
-                bool bIsExactFunctionMatch = false;
-                if (!FunctionNameFromNode.IsEmpty())
-                {
-                    for (const FString& SearchName : SearchNames)
-                    {
-                        if (FunctionNameFromNode.Equals(SearchName, ESearchCase::IgnoreCase))
-                        {
-                            bIsExactFunctionMatch = true;
-                            break;
-                        }
-                    }
-                }
-                if (!bIsExactFunctionMatch)
-                {
-                    continue; // Skip partial matches when looking for exact
-                }
-            }
+        if (!bFunctionNameMatches)
+        {
+            return;
+        }
+    }
 
-            // Check class name filter
-            bool bClassMatches = true;
-            if (!ClassName.IsEmpty())
-            {
-                bClassMatches = false;
+    // Track this match
+    FMatchedSpawnerInfo Info;
+    Info.Spawner = Description.Spawner;
+    Info.DetectedClassName = Description.DetectedClassName;
+    Info.FunctionName = FunctionNameFromNode.IsEmpty() ? NodeName : FunctionNameFromNode;
+    Info.NodeName = NodeName;
+    Info.bExactMatch = bExactMatch;
+    OutMatchedSpawners.Add(Info);
+
+    // Track for duplicate detection
+    OutMatchingFunctionsByClass.FindOrAdd(Info.FunctionName).Add(Description.DetectedClassName);
+}
 
-                if (UK2Node_CallFunction* FunctionNode = Cast<UK2Node_CallFunction>(TemplateNode))
-                {
-                    if (UFunction* Function = FunctionNode->GetTargetFunction())
-                    {
-                        if (UClass* OwnerClass = Function->GetOwnerClass())
-                        {
-                            bClassMatches = ClassNameMatches(OwnerClass->GetName(), ClassName);
-                        }
-                    }
-                }
-            }
+void FActionSpawnerMatcher::FindMatchingSpawners(
+    const TArray<FString>& SearchNames,
+    const FString& ClassName,
+    TArray<FMatchedSpawnerInfo>& OutMatchedSpawners,
+    TMap<FString, TArray<FString>>& OutMatchingFunctionsByClass
+)
+{
+    // Only spawners with a matching name can pass MatchSpawner, and the index finds those by name
+    if (IsInGameThread())
+    {
+        FSpawnerIndex& SpawnerIndex = FSpawnerIndex::Get();
+        TArray<const FSpawnerDescription*> Candidates;
+        SpawnerIndex.FindCandidates(SearchNames, Candidates);
+        for (const FSpawnerDescription* Description : Candidates)
+        {
+            MatchSpawner(*Description, SearchNames, ClassName, OutMatchedSpawners, OutMatchingFunctionsByClass);
+        }
 
-            if (!bClassMatches)
-            {
-                continue;
-            }
+        UE_LOG(LogTemp, Verbose, TEXT("FindMatchingSpawners: Matched %d of %d indexed spawners, found %d matches."), Candidates.Num(), SpawnerIndex.Num(), OutMatchedSpawners.Num());
+        return;
+    }
 
-            // Check exact function name match when class is specified
-            bool bFunctionNameMatches = true;
-            if (!ClassName.IsEmpty() && !FunctionNameFromNode.IsEmpty())
-            {
-                FString NormalizedFunctionName = NormalizeFunctionName(FunctionNameFromNode);
-                bFunctionNameMatches = false;
+    FBlueprintActionDatabase& ActionDatabase = FBlueprintActionDatabase::Get();
+    FBlueprintActionDatabase::FActionRegistry const& ActionRegistry = ActionDatabase.GetAllActions();
 
-                for (const FString& SearchName : SearchNames)
-                {
-                    FString NormalizedSearchName = NormalizeFunctionName(SearchName);
-                    if (NormalizedFunctionName.Equals(NormalizedSearchName, ESearchCase::IgnoreCase))
-                    {
-                        bFunctionNameMatches = true;
-                        break;
-                    }
-                }
-            }
+    UE_LOG(LogTemp, Warning, TEXT("FindMatchingSpawners: Found %d action categories, searching for %d name variations"), ActionRegistry.Num(), SearchNames.Num());
 
-            if (!bFunctionNameMatches)
+    int32 ProcessedSpawners = 0;
+
+    for (const auto& ActionPair : ActionRegistry)
+    {
+        for (const UBlueprintNodeSpawner* NodeSpawner : ActionPair.Value)
+        {
+            ProcessedSpawners++;
+            if (ProcessedSpawners % 1000 == 0)
             {
-                continue;
+                UE_LOG(LogTemp, Verbose, TEXT("FindMatchingSpawners: Processed %d spawners so far..."), ProcessedSpawners);
             }
 
-            // Track this match
-            FMatchedSpawnerInfo Info;
-            Info.Spawner = NodeSpawner;
-            Info.DetectedClassName = DetectedClassName;
-            Info.FunctionName = FunctionNameFromNode.IsEmpty() ? NodeName : FunctionNameFromNode;
-            Info.NodeName = NodeName;
-            Info.bExactMatch = bExactMatch;
-            OutMatchedSpawners.Add(Info);
-
-            // Track for duplicate detection
-            FString TrackingKey = Info.FunctionName;
-            if (!OutMatchingFunctionsByClass.Contains(TrackingKey))
+            FSpawnerDescription Description;
+            if (DescribeSpawner(NodeSpawner, Description))
             {
-                OutMatchingFunctionsByClass.Add(TrackingKey, TArray<FString>());
+                MatchSpawner(Description, SearchNames, ClassName, OutMatchedSpawners, OutMatchingFunctionsByClass);
             }
-            OutMatchingFunctionsByClass[TrackingKey].Add(DetectedClassName);
         }
     }
 
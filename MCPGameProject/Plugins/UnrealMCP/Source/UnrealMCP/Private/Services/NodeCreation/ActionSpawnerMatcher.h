@@ -26,6 +26,24 @@ struct FMatchedSpawnerInfo
     {}
 };
 
+/**
+ * What a spawner's template node is matched on: its title, function and owning class.
+ * Getting the title is the expensive part of a database search.
+ */
+struct FSpawnerDescription
+{
+    const UBlueprintNodeSpawner* Spawner;
+    FString NodeName;
+    FString FunctionName;
+    FString DetectedClassName;
+    bool bHasOwnerClass;
+
+    FSpawnerDescription()
+        : Spawner(nullptr)
+        , bHasOwnerClass(false)
+    {}
+};
+
 /**
  * Service for matching and filtering Blueprint Action Database spawners.
  * Handles the complex logic of finding the correct spawner for a function name,
@@ -34,6 +52,15 @@ struct FMatchedSpawnerInfo
 class FActionSpawnerMatcher
 {
 public:
+    /**
+     * Drop the spawner index FindMatchingSpawners keeps on the game thread and stop following the
+     * action database. The next lookup builds it again.
+     */
+    static void ShutdownSpawnerIndex();
+
+    /** Build the spawner index now rather than on the first lookup */
+    static void PrewarmSpawnerIndex();
+
     /**
      * Build the list of search names for a function, including aliases and variations.
      *
@@ -106,6 +133,29 @@ public:
     );
 
 private:
+    /** Described spawners by the names they match; defined in the .cpp */
+    class FSpawnerIndex;
+
+    /**
+     * Describe a spawner's template node for matching.
+     *
+     * @param NodeSpawner - Spawner to describe
+     * @param OutDescription - Output: the description
+     * @return False if the spawner has no template node
+     */
+    static bool DescribeSpawner(const UBlueprintNodeSpawner* NodeSpawner, FSpawnerDescription& OutDescription);
+
+    /**
+     * Add a described spawner to the matches if it matches the search names and class filter.
+     */
+    static void MatchSpawner(
+        const FSpawnerDescription& Description,
+        const TArray<FString>& SearchNames,
+        const FString& ClassName,
+        TArray<FMatchedSpawnerInfo>& OutMatchedSpawners,
+        TMap<FString, TArray<FString>>& OutMatchingFunctionsByClass
+    );
+
     /**
      * Get operation aliases map (Add -> Add_FloatFloat, Add_IntInt, etc.)
      */
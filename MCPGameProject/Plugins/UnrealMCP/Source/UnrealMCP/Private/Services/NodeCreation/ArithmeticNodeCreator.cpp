@@ -7,6 +7,7 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "BlueprintNodeBinder.h"
 #include "BlueprintTypePromotion.h"
+#include "MCPBatchEditScope.h"
 
 bool FArithmeticNodeCreator::TryCreateArithmeticOrComparisonNode(
     const FString& OperationName,
@@ -97,7 +98,7 @@ bool FArithmeticNodeCreator::TryCreateArithmeticOrComparisonNode(
                 {
                     Schema->ForceVisualizationCacheClear();
                 }
-                EventGraph->NotifyGraphChanged();
+                FMCPBatchEditScope::NotifyGraphChanged(EventGraph);
 
                 UE_LOG(LogTemp, Warning, TEXT("Applied PromotableOperator wildcard pin fix for node: %s"), *OutTitle);
             }
@@ -171,7 +172,7 @@ bool FArithmeticNodeCreator::TryCreateArithmeticOrComparisonNode(
             {
                 Schema->ForceVisualizationCacheClear();
             }
-            EventGraph->NotifyGraphChanged();
+            FMCPBatchEditScope::NotifyGraphChanged(EventGraph);
 
             OutNode = PromotableOp;
             FText UserFacingName = FTypePromotion::GetUserFacingOperatorName(*OpName);
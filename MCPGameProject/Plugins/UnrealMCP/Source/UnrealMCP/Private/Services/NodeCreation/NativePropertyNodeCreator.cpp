@@ -2,8 +2,10 @@
 
 #include "NativePropertyNodeCreator.h"
 #include "NodeCreationHelpers.h"
+#include "Services/ReflectionTypeIndex.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
+#include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
@@ -61,22 +63,18 @@ bool FNativePropertyNodeCreator::TryCreateNativePropertyNode(
     };
     TArray<FPropMatch> Matches;
 
-    // Iterate over all loaded classes once and gather potential matches
-    for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+    // Native properties come from the reflection index; a property is available on the class
+    // that declares it and on every subclass of that class
+    TSet<FProperty*> SeenProperties;
+    for (const FString& Candidate : Candidates)
     {
-        UClass* TargetClass = *ClassIt;
-        if (!TargetClass || TargetClass->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+        for (FProperty* Property : FReflectionTypeIndex::Get().FindBlueprintProperties(Candidate))
         {
-            continue;
-        }
-
-        for (TFieldIterator<FProperty> PropIt(TargetClass, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
-        {
-            FProperty* Property = *PropIt;
-            if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+            if (SeenProperties.Contains(Property))
             {
-                continue; // Not visible to Blueprints – skip
+                continue;
             }
+            SeenProperties.Add(Property);
 
             // For setter requests ensure the property is writable
             if (!bIsGetter && !IsPropertyWritable(Property))
@@ -84,42 +82,82 @@ bool FNativePropertyNodeCreator::TryCreateNativePropertyNode(
                 continue; // Not writable – skip for setters
             }
 
-            const FString PropName    = Property->GetName();
-            const FString StrippedProp = StripBoolPrefix(PropName);
-
-            // Build list of potential property names for matching
-            TArray<FString> NameOptions;
-            NameOptions.Add(PropName);
-            if (StrippedProp != PropName)
+            UClass* OwnerClass = Property->GetOwnerClass();
+            TArray<UClass*> TargetClasses;
+            GetDerivedClasses(OwnerClass, TargetClasses, true);
+            TargetClasses.Add(OwnerClass);
+            for (UClass* TargetClass : TargetClasses)
             {
-                NameOptions.Add(StrippedProp);
+                if (TargetClass && !TargetClass->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+                {
+                    Matches.Add({ TargetClass, Property });
+                }
             }
+        }
+    }
 
-            FString DisplayNameMeta = Property->GetMetaData(TEXT("DisplayName"));
-            if (DisplayNameMeta.IsEmpty())
+    // Properties declared by Blueprint classes are not indexed; look through those only when no native one matched
+    if (Matches.Num() == 0)
+    {
+        for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+        {
+            UClass* TargetClass = *ClassIt;
+            if (!TargetClass || TargetClass->HasAnyClassFlags(CLASS_Native | CLASS_Deprecated | CLASS_NewerVersionExists))
             {
-                DisplayNameMeta = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
+                continue;
             }
-            NameOptions.Add(DisplayNameMeta.Replace(TEXT(" "), TEXT("")));
 
-            // Perform case-insensitive comparison against all candidates
-            bool bMatch = false;
-            for (const FString& Candidate : Candidates)
+            for (TFieldIterator<FProperty> PropIt(TargetClass, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
             {
-                for (const FString& Option : NameOptions)
+                FProperty* Property = *PropIt;
+                if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+                {
+                    continue; // Not visible to Blueprints – skip
+                }
+
+                // For setter requests ensure the property is writable
+                if (!bIsGetter && !IsPropertyWritable(Property))
                 {
-                    if (Option.Equals(Candidate, ESearchCase::IgnoreCase))
+                    continue; // Not writable – skip for setters
+                }
+
+                const FString PropName    = Property->GetName();
+                const FString StrippedProp = StripBoolPrefix(PropName);
+
+                // Build list of potential property names for matching
+                TArray<FString> NameOptions;
+                NameOptions.Add(PropName);
+                if (StrippedProp != PropName)
+                {
+                    NameOptions.Add(StrippedProp);
+                }
+
+                FString DisplayNameMeta = Property->GetMetaData(TEXT("DisplayName"));
+                if (DisplayNameMeta.IsEmpty())
+                {
+                    DisplayNameMeta = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
+                }
+                NameOptions.Add(DisplayNameMeta.Replace(TEXT(" "), TEXT("")));
+
+                // Perform case-insensitive comparison against all candidates
+                bool bMatch = false;
+                for (const FString& Candidate : Candidates)
+                {
+                    for (const FString& Option : NameOptions)
                     {
-                        bMatch = true;
-                        break;
+                        if (Option.Equals(Candidate, ESearchCase::IgnoreCase))
+                        {
+                            bMatch = true;
+                            break;
+                        }
                     }
+                    if (bMatch) break;
                 }
-                if (bMatch) break;
-            }
 
-            if (bMatch)
-            {
-                Matches.Add({ TargetClass, Property });
+                if (bMatch)
+                {
+                    Matches.Add({ TargetClass, Property });
+                }
             }
         }
     }
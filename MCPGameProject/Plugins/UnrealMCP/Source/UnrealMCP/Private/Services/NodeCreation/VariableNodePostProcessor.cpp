@@ -8,7 +8,6 @@
 #include "Engine/Blueprint.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
-#include "UObject/UObjectIterator.h"
 
 void FVariableNodePostProcessor::ProcessVariableGetNode(
     UK2Node_VariableGet* GetNode,
@@ -131,18 +130,12 @@ UClass* FVariableNodePostProcessor::FindClassByName(const FString& ClassName)
         ClassNameWithSuffix += TEXT("_C");
     }
 
-    // Search for Blueprint-generated class
-    for (TObjectIterator<UClass> It; It; ++It)
+    // Object names are case-insensitive FNames, so the name hash finds native and Blueprint-generated classes alike
+    if (UClass* FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst))
     {
-        UClass* TestClass = *It;
-        if (TestClass && (TestClass->GetName().Equals(ClassName, ESearchCase::IgnoreCase) ||
-                          TestClass->GetName().Equals(ClassNameWithSuffix, ESearchCase::IgnoreCase)))
-        {
-            return TestClass;
-        }
+        return FoundClass;
     }
-
-    return nullptr;
+    return FindFirstObject<UClass>(*ClassNameWithSuffix, EFindFirstObjectOptions::NativeFirst);
 }
 
 bool FVariableNodePostProcessor::IsSelfVariable(UBlueprint* Blueprint, FName VarName)
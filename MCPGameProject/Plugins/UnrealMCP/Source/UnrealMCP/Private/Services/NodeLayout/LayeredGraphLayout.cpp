@@ -0,0 +1,685 @@
+#include "Services/NodeLayout/LayeredGraphLayout.h"
+
+namespace
+{
+    /** A node of the component being laid out, or a dummy on a long edge */
+    struct FVertex
+    {
+        /** Index into the nodes, or INDEX_NONE for a dummy */
+        int32 Node = INDEX_NONE;
+        int32 Layer = 0;
+        float Width = 0.0f;
+        float Height = 0.0f;
+        float Y = 0.0f;
+        /** Index within its layer */
+        int32 Position = 0;
+        float SortKey = 0.0f;
+    };
+
+    /** The piece of an edge between two adjacent layers */
+    struct FSegment
+    {
+        int32 Left = INDEX_NONE;
+        int32 Right = INDEX_NONE;
+        /** Where along each vertex the pin sits, 0 (top) to 1, for ordering */
+        float LeftPort = 0.0f;
+        float RightPort = 0.0f;
+        /** Pin heights below the top of each vertex, for placement */
+        float LeftPinY = 0.0f;
+        float RightPinY = 0.0f;
+    };
+
+    /** Count the pairs that are out of order, sorting the keys */
+    int64 CountInversions(TArray<float>& Keys, TArray<float>& Scratch)
+    {
+        const int32 Num = Keys.Num();
+        Scratch.SetNumUninitialized(Num, EAllowShrinking::No);
+        int64 Inversions = 0;
+        for (int32 Width = 1; Width < Num; Width *= 2)
+        {
+            for (int32 Start = 0; Start < Num; Start += 2 * Width)
+            {
+                const int32 Mid = FMath::Min(Start + Width, Num);
+                const int32 End = FMath::Min(Start + 2 * Width, Num);
+                int32 A = Start;
+                int32 B = Mid;
+                int32 Out = Start;
+                while (A < Mid && B < End)
+                {
+                    if (Keys[B] < Keys[A])
+                    {
+                        Inversions += Mid - A;
+                        Scratch[Out++] = Keys[B++];
+                    }
+                    else
+                    {
+                        Scratch[Out++] = Keys[A++];
+                    }
+                }
+                while (A < Mid)
+                {
+                    Scratch[Out++] = Keys[A++];
+                }
+                while (B < End)
+                {
+                    Scratch[Out++] = Keys[B++];
+                }
+            }
+            Swap(Keys, Scratch);
+        }
+        return Inversions;
+    }
+
+    /** Lays out one weakly connected component at a time, reusing the per-node state */
+    class FComponentLayout
+    {
+    public:
+        FComponentLayout(TArray<FLayeredGraphLayout::FNode>& InNodes, const TArray<FLayeredGraphLayout::FEdge>& InEdges,
+            const FLayeredGraphLayout::FSettings& InSettings)
+            : Nodes(InNodes)
+            , Edges(InEdges)
+            , Settings(InSettings)
+        {
+            const int32 NumNodes = Nodes.Num();
+            OutEdges.SetNum(NumNodes);
+            InEdges.SetNum(NumNodes);
+            for (int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); ++EdgeIndex)
+            {
+                const FLayeredGraphLayout::FEdge& Edge = Edges[EdgeIndex];
+                if (Nodes.IsValidIndex(Edge.Source) && Nodes.IsValidIndex(Edge.Target) && Edge.Source != Edge.Target)
+                {
+                    OutEdges[Edge.Source].Add(EdgeIndex);
+                    InEdges[Edge.Target].Add(EdgeIndex);
+                }
+            }
+
+            // The walk follows execution flow first, then pins top to bottom
+            for (TArray<int32>& NodeEdges : OutEdges)
+            {
+                NodeEdges.StableSort([this](int32 A, int32 B)
+                {
+                    if (Edges[A].bIsExec != Edges[B].bIsExec)
+                    {
+                        return Edges[A].bIsExec;
+                    }
+                    return Edges[A].SourceOffsetY < Edges[B].SourceOffsetY;
+                });
+            }
+
+            State.SetNumZeroed(NumNodes);
+            Preorder.SetNumZeroed(NumNodes);
+            Layer.SetNumZeroed(NumNodes);
+            VertexOfNode.Init(INDEX_NONE, NumNodes);
+            bBackEdge.SetNumZeroed(Edges.Num());
+        }
+
+        /** Split the nodes into weakly connected components, each in node order */
+        void FindComponents(TArray<TArray<int32>>& OutComponents) const
+        {
+            TArray<int32> Parent;
+            Parent.SetNumUninitialized(Nodes.Num());
+            for (int32 Index = 0; Index < Parent.Num(); ++Index)
+            {
+                Parent[Index] = Index;
+            }
+
+            auto FindRoot = [&Parent](int32 Index)
+            {
+                while (Parent[Index] != Index)
+                {
+                    Parent[Index] = Parent[Parent[Index]];
+                    Index = Parent[Index];
+                }
+                return Index;
+            };
+
+            for (int32 Source = 0; Source < OutEdges.Num(); ++Source)
+            {
+                for (int32 EdgeIndex : OutEdges[Source])
+                {
+                    const int32 RootA = FindRoot(Source);
+                    const int32 RootB = FindRoot(Edges[EdgeIndex].Target);
+                    if (RootA != RootB)
+                    {
+                        // The lower index stays the root, so components keep the order of their first node
+                        Parent[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+                    }
+                }
+            }
+
+            TMap<int32, int32> ComponentOfRoot;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                const int32 Root = FindRoot(Index);
+                int32* Component = ComponentOfRoot.Find(Root);
+                if (!Component)
+                {
+                    Component = &ComponentOfRoot.Add(Root, OutComponents.Num());
+                    OutComponents.AddDefaulted();
+                }
+                OutComponents[*Component].Add(Index);
+            }
+        }
+
+        /**
+         * Lay out one component
+         * @param ComponentNodes The component's nodes, in node order
+         * @param Top Y of the component's top edge
+         * @return Height of the component
+         */
+        int32 Arrange(const TArray<int32>& ComponentNodes, int32 Top)
+        {
+            Vertices.Reset();
+            Segments.Reset();
+            LeftSegments.Reset();
+            RightSegments.Reset();
+            Layers.Reset();
+
+            TArray<int32> Postorder;
+            BreakCycles(ComponentNodes, Postorder);
+            AssignLayers(Postorder);
+            BuildVertices(ComponentNodes);
+            OrderLayers();
+            PlaceVertices();
+
+            // Columns as wide as their widest node
+            TArray<int32> LayerX;
+            LayerX.SetNumZeroed(Layers.Num());
+            int32 X = 0;
+            for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); ++LayerIndex)
+            {
+                LayerX[LayerIndex] = X;
+                float Widest = 0.0f;
+                for (int32 VertexIndex : Layers[LayerIndex])
+                {
+                    Widest = FMath::Max(Widest, Vertices[VertexIndex].Width);
+                }
+                X += FMath::CeilToInt(Widest) + Settings.LayerGap;
+            }
+
+            float MinY = TNumericLimits<float>::Max();
+            float MaxY = TNumericLimits<float>::Lowest();
+            for (const FVertex& Vertex : Vertices)
+            {
+                if (Vertex.Node != INDEX_NONE)
+                {
+                    MinY = FMath::Min(MinY, Vertex.Y);
+                    MaxY = FMath::Max(MaxY, Vertex.Y + Vertex.Height);
+                }
+            }
+
+            for (const FVertex& Vertex : Vertices)
+            {
+                if (Vertex.Node != INDEX_NONE)
+                {
+                    Nodes[Vertex.Node].Position = FIntPoint(LayerX[Vertex.Layer], Top + FMath::RoundToInt(Vertex.Y - MinY));
+                }
+            }
+            return FMath::CeilToInt(MaxY - MinY);
+        }
+
+    private:
+        /** Mark back edges with an iterative depth-first walk and record the finishing order */
+        void BreakCycles(const TArray<int32>& ComponentNodes, TArray<int32>& OutPostorder)
+        {
+            struct FFrame
+            {
+                int32 Node;
+                int32 NextEdge;
+            };
+            TArray<FFrame> Stack;
+            int32 Counter = 0;
+
+            auto Walk = [&](int32 Start)
+            {
+                if (State[Start] != 0)
+                {
+                    return;
+                }
+                State[Start] = 1;
+                Preorder[Start] = Counter++;
+                Stack.Add({ Start, 0 });
+                while (Stack.Num() > 0)
+                {
+                    FFrame& Frame = Stack.Last();
+                    const TArray<int32>& NodeEdges = OutEdges[Frame.Node];
+                    if (Frame.NextEdge < NodeEdges.Num())
+                    {
+                        const int32 EdgeIndex = NodeEdges[Frame.NextEdge++];
+                        const int32 Target = Edges[EdgeIndex].Target;
+                        if (State[Target] == 1)
+                        {
+                            bBackEdge[EdgeIndex] = true;
+                        }
+                        else if (State[Target] == 0)
+                        {
+                            State[Target] = 1;
+                            Preorder[Target] = Counter++;
+                            Stack.Add({ Target, 0 });
+                        }
+                    }
+                    else
+                    {
+                        State[Frame.Node] = 2;
+                        OutPostorder.Add(Frame.Node);
+                        Stack.Pop(EAllowShrinking::No);
+                    }
+                }
+            };
+
+            // Execution sources (events, entry points) first, then the pure ones, then whatever cycles hide
+            for (int32 Node : ComponentNodes)
+            {
+                if (InEdges[Node].Num() == 0 && !Nodes[Node].bPullTowardsConsumers)
+                {
+                    Walk(Node);
+                }
+            }
+            for (int32 Node : ComponentNodes)
+            {
+                if (InEdges[Node].Num() == 0)
+                {
+                    Walk(Node);
+                }
+            }
+            for (int32 Node : ComponentNodes)
+            {
+                Walk(Node);
+            }
+        }
+
+        /** Longest-path layers, then pull nodes that only feed others next to their consumers */
+        void AssignLayers(const TArray<int32>& Postorder)
+        {
+            for (int32 Index = Postorder.Num() - 1; Index >= 0; --Index)
+            {
+                const int32 Node = Postorder[Index];
+                int32 NodeLayer = 0;
+                for (int32 EdgeIndex : InEdges[Node])
+                {
+                    if (!bBackEdge[EdgeIndex])
+                    {
+                        NodeLayer = FMath::Max(NodeLayer, Layer[Edges[EdgeIndex].Source] + 1);
+                    }
+                }
+                Layer[Node] = NodeLayer;
+            }
+
+            // Consumers finish before their inputs, so they are already final
+            for (int32 Node : Postorder)
+            {
+                if (!Nodes[Node].bPullTowardsConsumers)
+                {
+                    continue;
+                }
+                int32 NearestConsumer = TNumericLimits<int32>::Max();
+                for (int32 EdgeIndex : OutEdges[Node])
+                {
+                    if (!bBackEdge[EdgeIndex])
+                    {
+                        NearestConsumer = FMath::Min(NearestConsumer, Layer[Edges[EdgeIndex].Target]);
+                    }
+                }
+                if (NearestConsumer != TNumericLimits<int32>::Max())
+                {
+                    Layer[Node] = NearestConsumer - 1;
+                }
+            }
+
+            // Pulling can empty a layer; close the gap
+            int32 MaxLayer = 0;
+            for (int32 Node : Postorder)
+            {
+                MaxLayer = FMath::Max(MaxLayer, Layer[Node]);
+            }
+            TArray<int32> CompactLayer;
+            CompactLayer.Init(0, MaxLayer + 1);
+            for (int32 Node : Postorder)
+            {
+                CompactLayer[Layer[Node]] = 1;
+            }
+            int32 NextLayer = 0;
+            for (int32& Compact : CompactLayer)
+            {
+                Compact = Compact ? NextLayer++ : INDEX_NONE;
+            }
+            for (int32 Node : Postorder)
+            {
+                Layer[Node] = CompactLayer[Layer[Node]];
+            }
+        }
+
+        int32 AddVertex(int32 Node, int32 VertexLayer, float Width, float Height, float SortKey)
+        {
+            FVertex Vertex;
+            Vertex.Node = Node;
+            Vertex.Layer = VertexLayer;
+            Vertex.Width = Width;
+            Vertex.Height = Height;
+            Vertex.SortKey = SortKey;
+            LeftSegments.AddDefaulted();
+            RightSegments.AddDefaulted();
+            if (Layers.Num() <= VertexLayer)
+            {
+                Layers.SetNum(VertexLayer + 1);
+            }
+            const int32 VertexIndex = Vertices.Add(Vertex);
+            Layers[VertexLayer].Add(VertexIndex);
+            return VertexIndex;
+        }
+
+        void AddSegment(int32 Left, float LeftPinY, int32 Right, float RightPinY)
+        {
+            FSegment Segment;
+            Segment.Left = Left;
+            Segment.Right = Right;
+            Segment.LeftPinY = LeftPinY;
+            Segment.RightPinY = RightPinY;
+            Segment.LeftPort = FMath::Clamp(LeftPinY / FMath::Max(Vertices[Left].Height, 1.0f), 0.0f, 0.99f);
+            Segment.RightPort = FMath::Clamp(RightPinY / FMath::Max(Vertices[Right].Height, 1.0f), 0.0f, 0.99f);
+            const int32 SegmentIndex = Segments.Add(Segment);
+            RightSegments[Left].Add(SegmentIndex);
+            LeftSegments[Right].Add(SegmentIndex);
+        }
+
+        /** Vertices for the nodes and for the dummies of long edges, layers in walk order */
+        void BuildVertices(const TArray<int32>& ComponentNodes)
+        {
+            for (int32 Node : ComponentNodes)
+            {
+                const FIntPoint& Size = Nodes[Node].Size;
+                VertexOfNode[Node] = AddVertex(Node, Layer[Node], (float)Size.X, (float)Size.Y, (float)Preorder[Node]);
+            }
+
+            const float DummyHeight = (float)Settings.DummyHeight;
+            for (int32 Node : ComponentNodes)
+            {
+                for (int32 EdgeIndex : OutEdges[Node])
+                {
+                    if (bBackEdge[EdgeIndex])
+                    {
+                        continue;
+                    }
+                    const FLayeredGraphLayout::FEdge& Edge = Edges[EdgeIndex];
+                    const int32 Span = Layer[Edge.Target] - Layer[Node];
+                    if (Span < 1 || Span > Settings.MaxDummySpan)
+                    {
+                        continue;
+                    }
+
+                    int32 Left = VertexOfNode[Node];
+                    float LeftPinY = (float)Edge.SourceOffsetY;
+                    for (int32 Step = 1; Step < Span; ++Step)
+                    {
+                        // Dummies sort right after the node the edge leaves
+                        const int32 Dummy = AddVertex(INDEX_NONE, Layer[Node] + Step, 0.0f, DummyHeight, Preorder[Node] + 0.5f);
+                        AddSegment(Left, LeftPinY, Dummy, DummyHeight * 0.5f);
+                        Left = Dummy;
+                        LeftPinY = DummyHeight * 0.5f;
+                    }
+                    AddSegment(Left, LeftPinY, VertexOfNode[Edge.Target], (float)Edge.TargetOffsetY);
+                }
+            }
+
+            for (TArray<int32>& LayerVertices : Layers)
+            {
+                LayerVertices.StableSort([this](int32 A, int32 B)
+                {
+                    return Vertices[A].SortKey < Vertices[B].SortKey;
+                });
+            }
+            UpdatePositions();
+        }
+
+        void UpdatePositions()
+        {
+            for (const TArray<int32>& LayerVertices : Layers)
+            {
+                for (int32 Position = 0; Position < LayerVertices.Num(); ++Position)
+                {
+                    Vertices[LayerVertices[Position]].Position = Position;
+                }
+            }
+        }
+
+        /** Reorder one layer by the barycenter of its neighbours' pins on one side */
+        void ReorderLayer(int32 LayerIndex, bool bByLeftNeighbours)
+        {
+            TArray<int32>& LayerVertices = Layers[LayerIndex];
+            for (int32 VertexIndex : LayerVertices)
+            {
+                FVertex& Vertex = Vertices[VertexIndex];
+                const TArray<int32>& Neighbours = bByLeftNeighbours ? LeftSegments[VertexIndex] : RightSegments[VertexIndex];
+                if (Neighbours.Num() == 0)
+                {
+                    // Unconnected on this side: stay put
+                    Vertex.SortKey = (float)Vertex.Position;
+                    continue;
+                }
+                float Sum = 0.0f;
+                for (int32 SegmentIndex : Neighbours)
+                {
+                    const FSegment& Segment = Segments[SegmentIndex];
+                    Sum += bByLeftNeighbours
+                        ? Vertices[Segment.Left].Position + Segment.LeftPort
+                        : Vertices[Segment.Right].Position + Segment.RightPort;
+                }
+                Vertex.SortKey = Sum / Neighbours.Num();
+            }
+
+            LayerVertices.StableSort([this](int32 A, int32 B)
+            {
+                return Vertices[A].SortKey < Vertices[B].SortKey;
+            });
+            for (int32 Position = 0; Position < LayerVertices.Num(); ++Position)
+            {
+                Vertices[LayerVertices[Position]].Position = Position;
+            }
+        }
+
+        int64 CountCrossings()
+        {
+            int64 Crossings = 0;
+            TArray<TPair<float, float>> Keys;
+            TArray<float> RightKeys;
+            TArray<float> Scratch;
+            for (int32 LayerIndex = 0; LayerIndex + 1 < Layers.Num(); ++LayerIndex)
+            {
+                Keys.Reset();
+                for (int32 VertexIndex : Layers[LayerIndex])
+                {
+                    for (int32 SegmentIndex : RightSegments[VertexIndex])
+                    {
+                        const FSegment& Segment = Segments[SegmentIndex];
+                        Keys.Emplace(Vertices[Segment.Left].Position + Segment.LeftPort, Vertices[Segment.Right].Position + Segment.RightPort);
+                    }
+                }
+                Keys.Sort([](const TPair<float, float>& A, const TPair<float, float>& B)
+                {
+                    return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+                });
+                RightKeys.Reset();
+                for (const TPair<float, float>& Key : Keys)
+                {
+                    RightKeys.Add(Key.Value);
+                }
+                Crossings += CountInversions(RightKeys, Scratch);
+            }
+            return Crossings;
+        }
+
+        /** Alternate left-to-right and right-to-left sweeps, keeping the order with the fewest crossings */
+        void OrderLayers()
+        {
+            int64 BestCrossings = CountCrossings();
+            TArray<TArray<int32>> BestLayers = Layers;
+            for (int32 Sweep = 0; Sweep < Settings.CrossingSweeps && BestCrossings > 0; ++Sweep)
+            {
+                if (Sweep % 2 == 0)
+                {
+                    for (int32 LayerIndex = 1; LayerIndex < Layers.Num(); ++LayerIndex)
+                    {
+                        ReorderLayer(LayerIndex, true);
+                    }
+                }
+                else
+                {
+                    for (int32 LayerIndex = Layers.Num() - 2; LayerIndex >= 0; --LayerIndex)
+                    {
+                        ReorderLayer(LayerIndex, false);
+                    }
+                }
+
+                const int64 Crossings = CountCrossings();
+                if (Crossings < BestCrossings)
+                {
+                    BestCrossings = Crossings;
+                    BestLayers = Layers;
+                }
+            }
+            Layers = MoveTemp(BestLayers);
+            UpdatePositions();
+        }
+
+        /**
+         * Move a layer's vertices as close as possible, in the least-squares sense, to where their
+         * neighbours' pins are, keeping their order and gaps (pool adjacent violators)
+         */
+        void PlaceLayer(int32 LayerIndex, bool bUseLeft, bool bUseRight)
+        {
+            struct FBlock
+            {
+                double WeightedSum;
+                double Weight;
+                int32 First;
+                int32 Count;
+                double Mean() const { return WeightedSum / Weight; }
+            };
+
+            const TArray<int32>& LayerVertices = Layers[LayerIndex];
+            TArray<float, TInlineAllocator<64>> Offsets;
+            TArray<FBlock, TInlineAllocator<64>> Blocks;
+            float Offset = 0.0f;
+            for (int32 Position = 0; Position < LayerVertices.Num(); ++Position)
+            {
+                const int32 VertexIndex = LayerVertices[Position];
+                const FVertex& Vertex = Vertices[VertexIndex];
+
+                double Sum = 0.0;
+                int32 Count = 0;
+                if (bUseLeft)
+                {
+                    for (int32 SegmentIndex : LeftSegments[VertexIndex])
+                    {
+                        const FSegment& Segment = Segments[SegmentIndex];
+                        Sum += Vertices[Segment.Left].Y + Segment.LeftPinY - Segment.RightPinY;
+                        ++Count;
+                    }
+                }
+                if (bUseRight)
+                {
+                    for (int32 SegmentIndex : RightSegments[VertexIndex])
+                    {
+                        const FSegment& Segment = Segments[SegmentIndex];
+                        Sum += Vertices[Segment.Right].Y + Segment.RightPinY - Segment.LeftPinY;
+                        ++Count;
+                    }
+                }
+                const double Desired = Count > 0 ? Sum / Count : Vertex.Y;
+                const double Weight = Count > 0 ? Count : 0.5;
+
+                // With the gaps taken out, the positions only have to be non-decreasing
+                Offsets.Add(Offset);
+                FBlock Block = { (Desired - Offset) * Weight, Weight, Position, 1 };
+                while (Blocks.Num() > 0 && Blocks.Last().Mean() > Block.Mean())
+                {
+                    const FBlock Previous = Blocks.Pop(EAllowShrinking::No);
+                    Block.WeightedSum += Previous.WeightedSum;
+                    Block.Weight += Previous.Weight;
+                    Block.First = Previous.First;
+                    Block.Count += Previous.Count;
+                }
+                Blocks.Add(Block);
+                Offset += Vertex.Height + Settings.NodeGap;
+            }
+
+            for (const FBlock& Block : Blocks)
+            {
+                const float Mean = (float)Block.Mean();
+                for (int32 Position = Block.First; Position < Block.First + Block.Count; ++Position)
+                {
+                    Vertices[LayerVertices[Position]].Y = Mean + Offsets[Position];
+                }
+            }
+        }
+
+        void PlaceVertices()
+        {
+            for (const TArray<int32>& LayerVertices : Layers)
+            {
+                float Y = 0.0f;
+                for (int32 VertexIndex : LayerVertices)
+                {
+                    Vertices[VertexIndex].Y = Y;
+                    Y += Vertices[VertexIndex].Height + Settings.NodeGap;
+                }
+            }
+
+            for (int32 Pass = 0; Pass < Settings.PlacementPasses; ++Pass)
+            {
+                const bool bLastPass = Pass == Settings.PlacementPasses - 1;
+                if (bLastPass || Pass % 2 == 0)
+                {
+                    for (int32 LayerIndex = bLastPass ? 0 : 1; LayerIndex < Layers.Num(); ++LayerIndex)
+                    {
+                        PlaceLayer(LayerIndex, true, bLastPass);
+                    }
+                }
+                else
+                {
+                    for (int32 LayerIndex = Layers.Num() - 2; LayerIndex >= 0; --LayerIndex)
+                    {
+                        PlaceLayer(LayerIndex, false, true);
+                    }
+                }
+            }
+        }
+
+        TArray<FLayeredGraphLayout::FNode>& Nodes;
+        const TArray<FLayeredGraphLayout::FEdge>& Edges;
+        const FLayeredGraphLayout::FSettings& Settings;
+
+        TArray<TArray<int32>> OutEdges;
+        TArray<TArray<int32>> InEdges;
+        /** Walk state per node: 0 unvisited, 1 on the stack, 2 finished */
+        TArray<uint8> State;
+        TArray<int32> Preorder;
+        TArray<int32> Layer;
+        TArray<int32> VertexOfNode;
+        TArray<bool> bBackEdge;
+
+        TArray<FVertex> Vertices;
+        TArray<FSegment> Segments;
+        TArray<TArray<int32>> LeftSegments;
+        TArray<TArray<int32>> RightSegments;
+        TArray<TArray<int32>> Layers;
+    };
+}
+
+void FLayeredGraphLayout::Arrange(TArray<FNode>& Nodes, const TArray<FEdge>& Edges, const FSettings& Settings)
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    FComponentLayout Layout(Nodes, Edges, Settings);
+    TArray<TArray<int32>> Components;
+    Layout.FindComponents(Components);
+
+    int32 Top = 0;
+    for (const TArray<int32>& Component : Components)
+    {
+        Top += Layout.Arrange(Component, Top) + Settings.ComponentGap;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Layered (Sugiyama-style) left-to-right layout of a directed graph of boxes
+ *
+ * 1. Cycles are broken by ignoring the back edges of a depth-first walk that follows execution
+ *    edges before data edges
+ * 2. Nodes get longest-path layers; nodes marked bPullTowardsConsumers (pure nodes) then move right,
+ *    into the layer just before their nearest consumer
+ * 3. Edges spanning several layers get dummy vertices, and barycenter sweeps that take pin order into
+ *    account reorder the layers; the order with the fewest crossings is kept
+ * 4. Each layer is a column as wide as its widest node. Within a column, nodes are pulled towards
+ *    the pins they connect to while keeping their order and spacing
+ *
+ * Weakly connected components are laid out on their own and stacked top to bottom, in the order
+ * of their first node. A sweep costs O((V + E) log V) for V vertices, dummies included.
+ */
+class FLayeredGraphLayout
+{
+public:
+    struct FNode
+    {
+        FIntPoint Size = FIntPoint::ZeroValue;
+        /** Place the node next to its consumers rather than after its inputs */
+        bool bPullTowardsConsumers = false;
+        /** Receives the top-left corner */
+        FIntPoint Position = FIntPoint::ZeroValue;
+    };
+
+    struct FEdge
+    {
+        int32 Source = INDEX_NONE;
+        int32 Target = INDEX_NONE;
+        /** Pin heights below the top of the source and target nodes */
+        int32 SourceOffsetY = 0;
+        int32 TargetOffsetY = 0;
+        bool bIsExec = false;
+    };
+
+    struct FSettings
+    {
+        int32 LayerGap = 120;
+        int32 NodeGap = 40;
+        int32 ComponentGap = 160;
+        int32 CrossingSweeps = 8;
+        /** Longest edge, in layers, that gets dummy vertices; longer edges do not affect ordering */
+        int32 MaxDummySpan = 16;
+        int32 DummyHeight = 24;
+        int32 PlacementPasses = 5;
+    };
+
+    /**
+     * Position every node
+     * @param Nodes Nodes in priority order: earlier nodes start the depth-first walk and their components come first
+     * @param Edges Edges between the nodes; self-loops are ignored
+     * @param Settings Spacing and effort
+     */
+    static void Arrange(TArray<FNode>& Nodes, const TArray<FEdge>& Edges, const FSettings& Settings);
+};
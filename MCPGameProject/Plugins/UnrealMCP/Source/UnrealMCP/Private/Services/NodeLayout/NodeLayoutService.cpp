@@ -1,10 +1,92 @@
 #include "Services/NodeLayout/NodeLayoutService.h"
+#include "Services/NodeLayout/LayeredGraphLayout.h"
 #include "Utils/GraphUtils.h"
 #include "EdGraph/EdGraphPin.h"
+#include "EdGraphNode_Comment.h"
 #include "EdGraphSchema_K2.h"
-#include "K2Node_Event.h"
-#include "K2Node_FunctionEntry.h"
-#include "K2Node_CustomEvent.h"
+#include "MCPBatchEditScope.h"
+#include "Services/GraphFingerprintCache.h"
+
+namespace
+{
+    /** Uniform grid over rectangles, so overlap checks only look at nearby ones */
+    class FRectGrid
+    {
+    public:
+        explicit FRectGrid(int32 InCellSize)
+            : CellSize(InCellSize)
+        {
+        }
+
+        void Add(int32 Id, const FIntRect& Rect)
+        {
+            ForEachCell(Rect, [this, Id](const FIntPoint& Cell)
+            {
+                Cells.FindOrAdd(Cell).Add(Id);
+            });
+        }
+
+        /** Ids of the rectangles sharing a cell with Rect, ascending */
+        void FindCandidates(const FIntRect& Rect, TArray<int32>& OutIds) const
+        {
+            OutIds.Reset();
+            ForEachCell(Rect, [this, &OutIds](const FIntPoint& Cell)
+            {
+                if (const TArray<int32>* Ids = Cells.Find(Cell))
+                {
+                    OutIds.Append(*Ids);
+                }
+            });
+            OutIds.Sort();
+            for (int32 Index = OutIds.Num() - 1; Index > 0; --Index)
+            {
+                if (OutIds[Index] == OutIds[Index - 1])
+                {
+                    OutIds.RemoveAt(Index, EAllowShrinking::No);
+                }
+            }
+        }
+
+    private:
+        template <typename FunctorType>
+        void ForEachCell(const FIntRect& Rect, FunctorType&& Functor) const
+        {
+            // Inclusive, so rectangles that only touch still meet in a cell
+            const int32 MinX = FMath::DivideAndRoundDown(Rect.Min.X, CellSize);
+            const int32 MinY = FMath::DivideAndRoundDown(Rect.Min.Y, CellSize);
+            const int32 MaxX = FMath::DivideAndRoundDown(Rect.Max.X, CellSize);
+            const int32 MaxY = FMath::DivideAndRoundDown(Rect.Max.Y, CellSize);
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                for (int32 X = MinX; X <= MaxX; ++X)
+                {
+                    Functor(FIntPoint(X, Y));
+                }
+            }
+        }
+
+        int32 CellSize;
+        TMap<FIntPoint, TArray<int32>> Cells;
+    };
+
+    struct FArrangedGraph
+    {
+        TWeakObjectPtr<UEdGraph> Graph;
+        /** Fingerprint right after the arrangement */
+        uint64 Fingerprint = 0;
+        int32 ArrangedCount = 0;
+    };
+
+    /** Graphs as AutoArrangeNodes left them; game thread only */
+    TMap<const UEdGraph*, FArrangedGraph> ArrangedGraphs;
+
+    /** Fingerprint from a full rehash; node positions are often written without a notification */
+    uint64 GetLayoutFingerprint(UEdGraph* Graph)
+    {
+        FGraphFingerprintCache::Get().Invalidate(Graph);
+        return FGraphFingerprintCache::Get().GetFingerprint(Graph);
+    }
+}
 
 bool FNodeLayoutService::AutoArrangeNodes(UEdGraph* Graph, int32& OutArrangedCount)
 {
@@ -16,130 +98,340 @@ bool FNodeLayoutService::AutoArrangeNodes(UEdGraph* Graph, int32& OutArrangedCou
 
     OutArrangedCount = 0;
 
-    // Get all nodes
-    TArray<UEdGraphNode*> AllNodes = Graph->Nodes;
-    if (AllNodes.Num() == 0)
+    // Comments frame other nodes and are not part of the flow
+    TArray<UEdGraphNode*> LayoutNodes;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && !Node->IsA<UEdGraphNode_Comment>())
+        {
+            LayoutNodes.Add(Node);
+        }
+    }
+    if (LayoutNodes.Num() == 0)
     {
         UE_LOG(LogTemp, Log, TEXT("FNodeLayoutService::AutoArrangeNodes: Graph has no nodes"));
         return true;
     }
 
-    // Separate pure nodes from execution nodes
-    TArray<UEdGraphNode*> PureNodes = FindPureNodes(Graph);
-    TSet<UEdGraphNode*> PureNodeSet(PureNodes);
+    // The layout only depends on the graph's content, so a graph unchanged since its last
+    // arrangement is left as it is
+    if (const FArrangedGraph* Arranged = ArrangedGraphs.Find(Graph))
+    {
+        if (Arranged->Graph.Get() == Graph && Arranged->Fingerprint == GetLayoutFingerprint(Graph))
+        {
+            OutArrangedCount = Arranged->ArrangedCount;
+            UE_LOG(LogTemp, Log, TEXT("FNodeLayoutService::AutoArrangeNodes: Graph unchanged since it was arranged"));
+            return true;
+        }
+    }
 
-    // Find root nodes (events, entry points)
-    TArray<UEdGraphNode*> RootNodes = FindRootNodes(Graph);
+    const double StartTime = FPlatformTime::Seconds();
 
-    // If no root nodes found, use leftmost nodes as starting points
-    if (RootNodes.Num() == 0)
+    // Earlier nodes lead the layout, so event chains keep their top-to-bottom order
+    LayoutNodes.StableSort([](const UEdGraphNode& A, const UEdGraphNode& B)
+    {
+        return A.NodePosY != B.NodePosY ? A.NodePosY < B.NodePosY : A.NodePosX < B.NodePosX;
+    });
+
+    TMap<UEdGraphNode*, int32> IndexByNode;
+    TMap<const UEdGraphPin*, int32> PinOffsets;
+    TArray<FLayeredGraphLayout::FNode> Nodes;
+    IndexByNode.Reserve(LayoutNodes.Num());
+    Nodes.Reserve(LayoutNodes.Num());
+    for (UEdGraphNode* Node : LayoutNodes)
     {
-        int32 MinX = TNumericLimits<int32>::Max();
-        for (UEdGraphNode* Node : AllNodes)
+        IndexByNode.Add(Node, Nodes.Num());
+        FLayeredGraphLayout::FNode& LayoutNode = Nodes.AddDefaulted_GetRef();
+        LayoutNode.Size = EstimateNodeSize(Node, &PinOffsets);
+        LayoutNode.bPullTowardsConsumers = IsPureNode(Node);
+    }
+
+    TArray<FLayeredGraphLayout::FEdge> Edges;
+    for (int32 Source = 0; Source < LayoutNodes.Num(); ++Source)
+    {
+        for (UEdGraphPin* Pin : LayoutNodes[Source]->Pins)
         {
-            if (Node && !PureNodeSet.Contains(Node))
+            if (!Pin || Pin->Direction != EGPD_Output)
             {
-                if (Node->NodePosX < MinX)
-                {
-                    MinX = Node->NodePosX;
-                    RootNodes.Empty();
-                    RootNodes.Add(Node);
-                }
-                else if (Node->NodePosX == MinX)
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const int32* Target = LinkedPin ? IndexByNode.Find(LinkedPin->GetOwningNode()) : nullptr;
+                if (!Target || *Target == Source)
                 {
-                    RootNodes.Add(Node);
+                    continue;
                 }
+
+                // Pins folded away (split structs, advanced view) are taken to sit under the title
+                const int32* SourceOffset = PinOffsets.Find(Pin);
+                const int32* TargetOffset = PinOffsets.Find(LinkedPin);
+                FLayeredGraphLayout::FEdge& Edge = Edges.AddDefaulted_GetRef();
+                Edge.Source = Source;
+                Edge.Target = *Target;
+                Edge.SourceOffsetY = SourceOffset ? *SourceOffset : NODE_HEADER_HEIGHT;
+                Edge.TargetOffsetY = TargetOffset ? *TargetOffset : NODE_HEADER_HEIGHT;
+                Edge.bIsExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
             }
         }
     }
 
-    // Assign layers to execution nodes
-    TMap<UEdGraphNode*, int32> NodeLayers;
-    AssignLayers(RootNodes, NodeLayers);
+    FLayeredGraphLayout::FSettings Settings;
+    Settings.LayerGap = LAYER_GAP;
+    Settings.NodeGap = NODE_GAP;
+    Settings.ComponentGap = COMPONENT_GAP;
+    FLayeredGraphLayout::Arrange(Nodes, Edges, Settings);
 
-    // Add any unvisited non-pure nodes to layer 0
-    for (UEdGraphNode* Node : AllNodes)
+    TArray<FIntRect> Rects;
+    Rects.Reserve(Nodes.Num());
+    for (const FLayeredGraphLayout::FNode& LayoutNode : Nodes)
     {
-        if (Node && !PureNodeSet.Contains(Node) && !NodeLayers.Contains(Node))
+        Rects.Emplace(LayoutNode.Position, LayoutNode.Position + LayoutNode.Size);
+    }
+    const int32 MovedCount = ResolveOverlaps(Rects);
+
+    for (int32 Index = 0; Index < LayoutNodes.Num(); ++Index)
+    {
+        LayoutNodes[Index]->NodePosX = Rects[Index].Min.X;
+        LayoutNodes[Index]->NodePosY = Rects[Index].Min.Y;
+    }
+    OutArrangedCount = LayoutNodes.Num();
+
+    // Mark graph as modified
+    FMCPBatchEditScope::NotifyGraphChanged(Graph);
+
+    for (auto It = ArrangedGraphs.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().Graph.IsValid())
         {
-            NodeLayers.Add(Node, 0);
+            It.RemoveCurrent();
         }
     }
+    FArrangedGraph& Arranged = ArrangedGraphs.Add(Graph);
+    Arranged.Graph = Graph;
+    Arranged.Fingerprint = GetLayoutFingerprint(Graph);
+    Arranged.ArrangedCount = OutArrangedCount;
+
+    UE_LOG(LogTemp, Log, TEXT("FNodeLayoutService::AutoArrangeNodes: Arranged %d nodes and %d links in %.1f ms (%d moved to clear overlaps)"),
+        OutArrangedCount, Edges.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, MovedCount);
 
-    // Group nodes by layer
-    TMap<int32, TArray<UEdGraphNode*>> LayerGroups;
-    for (auto& Pair : NodeLayers)
+    return true;
+}
+
+bool FNodeLayoutService::ArrangeNewNodes(UEdGraph* Graph, const TArray<UEdGraphNode*>& NewNodes, int32& OutArrangedCount)
+{
+    if (!Graph)
     {
-        LayerGroups.FindOrAdd(Pair.Value).Add(Pair.Key);
+        UE_LOG(LogTemp, Error, TEXT("FNodeLayoutService::ArrangeNewNodes: Invalid graph"));
+        return false;
     }
 
-    // Sort layers
-    TArray<int32> SortedLayers;
-    LayerGroups.GetKeys(SortedLayers);
-    SortedLayers.Sort();
+    OutArrangedCount = 0;
 
-    // Position execution nodes by layer
-    for (int32 Layer : SortedLayers)
+    TSet<UEdGraphNode*> Pending;
+    for (UEdGraphNode* Node : NewNodes)
+    {
+        if (Node && !Node->IsA<UEdGraphNode_Comment>() && Graph->Nodes.Contains(Node))
+        {
+            Pending.Add(Node);
+        }
+    }
+    if (Pending.Num() == 0)
     {
-        TArray<UEdGraphNode*>& NodesInLayer = LayerGroups[Layer];
+        return true;
+    }
 
-        // Sort nodes in layer by their original Y position for stability
-        NodesInLayer.Sort([](const UEdGraphNode& A, const UEdGraphNode& B) {
-            return A.NodePosY < B.NodePosY;
-        });
+    const double StartTime = FPlatformTime::Seconds();
 
-        int32 X = Layer * HORIZONTAL_SPACING;
-        int32 Y = 0;
+    // Every other node is an obstacle that keeps its place; placed new nodes join them
+    TArray<FIntRect> Rects;
+    TMap<UEdGraphNode*, int32> RectByNode;
+    TMap<const UEdGraphPin*, int32> PinOffsets;
+    FRectGrid Grid(OVERLAP_GRID_CELL);
+    auto AddPlaced = [&Rects, &RectByNode, &Grid](UEdGraphNode* Node, const FIntRect& Rect)
+    {
+        const int32 RectIndex = Rects.Add(Rect);
+        RectByNode.Add(Node, RectIndex);
+        Grid.Add(RectIndex, Rect);
+    };
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (Node && !Node->IsA<UEdGraphNode_Comment>() && !Pending.Contains(Node))
+        {
+            const FIntPoint Size = EstimateNodeSize(Node, &PinOffsets);
+            AddPlaced(Node, FIntRect(FIntPoint(Node->NodePosX, Node->NodePosY), FIntPoint(Node->NodePosX, Node->NodePosY) + Size));
+        }
+    }
 
-        for (UEdGraphNode* Node : NodesInLayer)
+    auto PinOffset = [&PinOffsets](const UEdGraphPin* Pin)
+    {
+        const int32* Offset = PinOffsets.Find(Pin);
+        return Offset ? *Offset : NODE_HEADER_HEIGHT;
+    };
+
+    // Nodes next to placed ones go first, so a new chain grows outwards from the graph it hangs off
+    TArray<UEdGraphNode*> Order;
+    Order.Reserve(Pending.Num());
+    TSet<UEdGraphNode*> Queued;
+    auto EnqueueNeighbours = [&Order, &Queued, &Pending](UEdGraphNode* Node)
+    {
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                UEdGraphNode* Neighbour = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+                if (Neighbour && Pending.Contains(Neighbour) && !Queued.Contains(Neighbour))
+                {
+                    Queued.Add(Neighbour);
+                    Order.Add(Neighbour);
+                }
+            }
+        }
+    };
+    for (UEdGraphNode* Node : NewNodes)
+    {
+        if (Pending.Contains(Node) && !Queued.Contains(Node))
         {
-            if (Node)
+            for (UEdGraphPin* Pin : Node->Pins)
             {
-                Node->NodePosX = X;
-                Node->NodePosY = Y;
-                Y += VERTICAL_SPACING;
-                OutArrangedCount++;
+                const bool bTouchesPlaced = Pin && Pin->LinkedTo.ContainsByPredicate([&RectByNode](const UEdGraphPin* LinkedPin)
+                {
+                    return LinkedPin && RectByNode.Contains(LinkedPin->GetOwningNode());
+                });
+                if (bTouchesPlaced)
+                {
+                    Queued.Add(Node);
+                    Order.Add(Node);
+                    break;
+                }
             }
         }
     }
+    for (int32 Cursor = 0; Cursor < Pending.Num(); ++Cursor)
+    {
+        // Chains that touch nothing placed start from their first listed node
+        if (Cursor == Order.Num())
+        {
+            for (UEdGraphNode* Node : NewNodes)
+            {
+                if (Pending.Contains(Node) && !Queued.Contains(Node))
+                {
+                    Queued.Add(Node);
+                    Order.Add(Node);
+                    break;
+                }
+            }
+        }
+        EnqueueNeighbours(Order[Cursor]);
+    }
 
-    // Position pure nodes near their consumers
-    // Track how many pure nodes have been placed per consumer to avoid overlaps
-    TMap<UEdGraphNode*, int32> ConsumerPureNodeCount;
-    int32 UnconnectedPureNodeCount = 0;
-
-    for (UEdGraphNode* PureNode : PureNodes)
+    TArray<int32> Candidates;
+    auto FindBlocker = [&Rects, &Grid, &Candidates](const FIntRect& Rect) -> int32
     {
-        if (!PureNode) continue;
+        Grid.FindCandidates(FIntRect(Rect.Min - FIntPoint(NODE_GAP, NODE_GAP), Rect.Max + FIntPoint(NODE_GAP, NODE_GAP)), Candidates);
+        const int32* Blocker = Candidates.FindByPredicate([&Rects, &Rect](int32 Other)
+        {
+            return AreTooClose(Rects[Other], Rect);
+        });
+        return Blocker ? *Blocker : INDEX_NONE;
+    };
 
-        UEdGraphNode* Consumer = GetPureNodeConsumer(PureNode);
-        if (Consumer)
+    int32 MovedCount = 0;
+    for (UEdGraphNode* Node : Order)
+    {
+        const FIntPoint Size = EstimateNodeSize(Node, &PinOffsets);
+        const bool bIsPure = IsPureNode(Node);
+
+        // Follow the placed inputs, or lead the placed consumers; pure nodes prefer their consumers
+        int32 AfterInputsX = MIN_int32;
+        int32 BeforeConsumersX = MAX_int32;
+        int64 InputsY = 0;
+        int64 ConsumersY = 0;
+        int32 InputCount = 0;
+        int32 ConsumerCount = 0;
+        for (UEdGraphPin* Pin : Node->Pins)
         {
-            // Get the index for this consumer (how many pure nodes already placed for it)
-            int32& PureIndex = ConsumerPureNodeCount.FindOrAdd(Consumer);
+            if (!Pin)
+            {
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const int32* RectIndex = LinkedPin ? RectByNode.Find(LinkedPin->GetOwningNode()) : nullptr;
+                if (!RectIndex)
+                {
+                    continue;
+                }
+                const FIntRect& Neighbour = Rects[*RectIndex];
+                const int32 AlignedY = Neighbour.Min.Y + PinOffset(LinkedPin) - PinOffset(Pin);
+                if (Pin->Direction == EGPD_Input)
+                {
+                    AfterInputsX = FMath::Max(AfterInputsX, Neighbour.Max.X + LAYER_GAP);
+                    InputsY += AlignedY;
+                    InputCount++;
+                }
+                else
+                {
+                    BeforeConsumersX = FMath::Min(BeforeConsumersX, Neighbour.Min.X - LAYER_GAP - Size.X);
+                    ConsumersY += AlignedY;
+                    ConsumerCount++;
+                }
+            }
+        }
 
-            // Position pure node to the left of consumer, stacked vertically
-            // Each subsequent pure node for the same consumer is offset further up
-            PureNode->NodePosX = Consumer->NodePosX + PURE_NODE_OFFSET_X;
-            PureNode->NodePosY = Consumer->NodePosY + PURE_NODE_OFFSET_Y - (PureIndex * PURE_NODE_VERTICAL_GAP);
+        FIntPoint Desired(Node->NodePosX, Node->NodePosY);
+        if (ConsumerCount > 0 && (bIsPure || InputCount == 0))
+        {
+            Desired = FIntPoint(BeforeConsumersX, static_cast<int32>(ConsumersY / ConsumerCount));
+        }
+        else if (InputCount > 0)
+        {
+            Desired = FIntPoint(AfterInputsX, static_cast<int32>(InputsY / InputCount));
+        }
 
-            PureIndex++;
+        // Step past blockers downwards and upwards and keep whichever lands closer
+        FIntRect Down(Desired, Desired + Size);
+        FIntRect Up = Down;
+        bool bDownFree = false;
+        bool bUpFree = false;
+        for (int32 Attempt = 0; Attempt <= Rects.Num() && !bDownFree; ++Attempt)
+        {
+            const int32 Blocker = FindBlocker(Down);
+            bDownFree = Blocker == INDEX_NONE;
+            if (!bDownFree)
+            {
+                Down.Min.Y = Rects[Blocker].Max.Y + NODE_GAP;
+                Down.Max.Y = Down.Min.Y + Size.Y;
+            }
         }
-        else
+        for (int32 Attempt = 0; Attempt <= Rects.Num() && !bUpFree; ++Attempt)
         {
-            // No consumer found, place at origin area, stacked vertically
-            PureNode->NodePosX = -200;
-            PureNode->NodePosY = UnconnectedPureNodeCount * PURE_NODE_VERTICAL_GAP;
-            UnconnectedPureNodeCount++;
+            const int32 Blocker = FindBlocker(Up);
+            bUpFree = Blocker == INDEX_NONE;
+            if (!bUpFree)
+            {
+                Up.Max.Y = Rects[Blocker].Min.Y - NODE_GAP;
+                Up.Min.Y = Up.Max.Y - Size.Y;
+            }
         }
+        const bool bTakeUp = bUpFree && (!bDownFree || Desired.Y - Up.Min.Y < Down.Min.Y - Desired.Y);
+        const FIntRect& Placed = bTakeUp ? Up : Down;
+
+        MovedCount += Placed.Min != FIntPoint(Node->NodePosX, Node->NodePosY) ? 1 : 0;
+        Node->NodePosX = Placed.Min.X;
+        Node->NodePosY = Placed.Min.Y;
+        AddPlaced(Node, Placed);
         OutArrangedCount++;
     }
 
-    // Mark graph as modified
-    Graph->NotifyGraphChanged();
+    FMCPBatchEditScope::NotifyGraphChanged(Graph);
 
-    UE_LOG(LogTemp, Log, TEXT("FNodeLayoutService::AutoArrangeNodes: Arranged %d nodes in %d layers"),
-        OutArrangedCount, SortedLayers.Num());
+    UE_LOG(LogTemp, Log, TEXT("FNodeLayoutService::ArrangeNewNodes: Placed %d nodes among %d in %.1f ms (%d moved)"),
+        OutArrangedCount, Rects.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, MovedCount);
 
     return true;
 }
@@ -166,95 +458,45 @@ bool FNodeLayoutService::GetGraphLayoutInfo(UEdGraph* Graph,
         }
     }
 
-    // Detect overlapping nodes
-    TArray<UEdGraphNode*> Nodes = Graph->Nodes;
-    for (int32 i = 0; i < Nodes.Num(); i++)
+    // Detect overlapping nodes; each node is checked against the earlier nodes near it
+    const TArray<UEdGraphNode*>& Nodes = Graph->Nodes;
+    TArray<FIntRect> Bounds;
+    Bounds.SetNum(Nodes.Num());
+    TArray<TPair<int32, int32>> OverlappingIndices;
+    TArray<int32> Candidates;
+    FRectGrid Grid(OVERLAP_GRID_CELL);
+    for (int32 j = 0; j < Nodes.Num(); j++)
     {
-        for (int32 j = i + 1; j < Nodes.Num(); j++)
+        if (!Nodes[j])
         {
-            if (Nodes[i] && Nodes[j] && DoNodeBoundsOverlap(Nodes[i], Nodes[j]))
-            {
-                OutOverlappingPairs.Add(TPair<FString, FString>(
-                    FGraphUtils::GetReliableNodeId(Nodes[i]),
-                    FGraphUtils::GetReliableNodeId(Nodes[j])
-                ));
-            }
-        }
-    }
-
-    return true;
-}
-
-TArray<UEdGraphNode*> FNodeLayoutService::FindRootNodes(UEdGraph* Graph)
-{
-    TArray<UEdGraphNode*> RootNodes;
-
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        if (!Node) continue;
-
-        // Check if it's an event or entry node
-        bool bIsEventNode = Node->IsA<UK2Node_Event>() ||
-                           Node->IsA<UK2Node_FunctionEntry>() ||
-                           Node->IsA<UK2Node_CustomEvent>();
-
-        if (bIsEventNode)
-        {
-            RootNodes.Add(Node);
             continue;
         }
-
-        // Check if it has execution pins but no incoming exec connections
-        bool bHasExecPins = false;
-        for (UEdGraphPin* Pin : Node->Pins)
+        Bounds[j] = GetNodeBounds(Nodes[j]);
+        Grid.FindCandidates(Bounds[j], Candidates);
+        for (int32 i : Candidates)
         {
-            if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            if (Bounds[i].Intersect(Bounds[j]))
             {
-                bHasExecPins = true;
-                break;
+                OverlappingIndices.Emplace(i, j);
             }
         }
-
-        if (bHasExecPins && !HasIncomingExecConnection(Node))
-        {
-            RootNodes.Add(Node);
-        }
+        Grid.Add(j, Bounds[j]);
     }
 
-    return RootNodes;
-}
-
-TArray<UEdGraphNode*> FNodeLayoutService::FindPureNodes(UEdGraph* Graph)
-{
-    TArray<UEdGraphNode*> PureNodes;
-
-    for (UEdGraphNode* Node : Graph->Nodes)
+    // Same order as comparing every pair
+    OverlappingIndices.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
     {
-        if (Node && IsPureNode(Node))
-        {
-            PureNodes.Add(Node);
-        }
-    }
-
-    return PureNodes;
-}
-
-bool FNodeLayoutService::HasIncomingExecConnection(UEdGraphNode* Node)
-{
-    if (!Node) return false;
-
-    for (UEdGraphPin* Pin : Node->Pins)
+        return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+    });
+    for (const TPair<int32, int32>& Pair : OverlappingIndices)
     {
-        if (Pin &&
-            Pin->Direction == EGPD_Input &&
-            Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec &&
-            Pin->LinkedTo.Num() > 0)
-        {
-            return true;
-        }
+        OutOverlappingPairs.Add(TPair<FString, FString>(
+            FGraphUtils::GetReliableNodeId(Nodes[Pair.Key]),
+            FGraphUtils::GetReliableNodeId(Nodes[Pair.Value])
+        ));
     }
 
-    return false;
+    return true;
 }
 
 bool FNodeLayoutService::IsPureNode(UEdGraphNode* Node)
@@ -273,118 +515,116 @@ bool FNodeLayoutService::IsPureNode(UEdGraphNode* Node)
     return true; // No exec pins, it's pure
 }
 
-void FNodeLayoutService::AssignLayers(const TArray<UEdGraphNode*>& RootNodes,
-    TMap<UEdGraphNode*, int32>& OutNodeLayers)
+FIntRect FNodeLayoutService::GetNodeBounds(UEdGraphNode* Node)
 {
-    OutNodeLayers.Empty();
+    if (!Node)
+    {
+        return FIntRect();
+    }
 
-    // BFS to assign layers
-    TQueue<TPair<UEdGraphNode*, int32>> Queue;
-    TSet<UEdGraphNode*> Visited;
+    const FIntPoint Size = EstimateNodeSize(Node);
+    return FIntRect(
+        FIntPoint(Node->NodePosX, Node->NodePosY),
+        FIntPoint(Node->NodePosX + Size.X, Node->NodePosY + Size.Y)
+    );
+}
 
-    // Add root nodes at layer 0
-    for (UEdGraphNode* Root : RootNodes)
+FIntPoint FNodeLayoutService::EstimateNodeSize(UEdGraphNode* Node, TMap<const UEdGraphPin*, int32>* OutPinOffsets)
+{
+    int32 InputRows = 0;
+    int32 OutputRows = 0;
+    int32 LongestInputLabel = 0;
+    int32 LongestOutputLabel = 0;
+    for (UEdGraphPin* Pin : Node->Pins)
     {
-        if (Root)
+        if (!Pin || Pin->bHidden)
         {
-            Queue.Enqueue(TPair<UEdGraphNode*, int32>(Root, 0));
-            Visited.Add(Root);
+            continue;
         }
-    }
-
-    while (!Queue.IsEmpty())
-    {
-        TPair<UEdGraphNode*, int32> Current;
-        Queue.Dequeue(Current);
-
-        UEdGraphNode* Node = Current.Key;
-        int32 Layer = Current.Value;
 
-        OutNodeLayers.Add(Node, Layer);
-
-        // Get connected nodes via execution pins
-        TArray<UEdGraphNode*> ConnectedNodes = GetOutgoingExecConnectedNodes(Node);
-        for (UEdGraphNode* Connected : ConnectedNodes)
+        const bool bIsInput = Pin->Direction == EGPD_Input;
+        const int32 Row = bIsInput ? InputRows++ : OutputRows++;
+        if (OutPinOffsets)
         {
-            if (Connected && !Visited.Contains(Connected))
-            {
-                Visited.Add(Connected);
-                Queue.Enqueue(TPair<UEdGraphNode*, int32>(Connected, Layer + 1));
-            }
+            OutPinOffsets->Add(Pin, NODE_HEADER_HEIGHT + Row * PIN_ROW_HEIGHT + PIN_ROW_HEIGHT / 2);
         }
-    }
-}
 
-TArray<UEdGraphNode*> FNodeLayoutService::GetOutgoingExecConnectedNodes(UEdGraphNode* Node)
-{
-    TArray<UEdGraphNode*> ConnectedNodes;
+        const int32 LabelLength = Node->GetPinDisplayName(Pin).ToString().Len();
+        int32& LongestLabel = bIsInput ? LongestInputLabel : LongestOutputLabel;
+        LongestLabel = FMath::Max(LongestLabel, LabelLength);
+    }
 
-    if (!Node) return ConnectedNodes;
+    // Use node's actual width/height if available (comments, resizable nodes), otherwise estimate
+    if (Node->NodeWidth > 0 && Node->NodeHeight > 0)
+    {
+        return FIntPoint(Node->NodeWidth, Node->NodeHeight);
+    }
 
-    for (UEdGraphPin* Pin : Node->Pins)
+    // Only the first line of a multi-line title sets the width
+    FString Title = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString();
+    int32 LineEnd = INDEX_NONE;
+    if (Title.FindChar(TEXT('\n'), LineEnd))
     {
-        if (Pin &&
-            Pin->Direction == EGPD_Output &&
-            Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-        {
-            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-            {
-                if (LinkedPin && LinkedPin->GetOwningNode())
-                {
-                    ConnectedNodes.AddUnique(LinkedPin->GetOwningNode());
-                }
-            }
-        }
+        Title.LeftInline(LineEnd);
     }
 
-    return ConnectedNodes;
+    const int32 TitleWidth = Title.Len() * CHAR_WIDTH_ESTIMATE + 64;
+    const int32 PinsWidth = (LongestInputLabel + LongestOutputLabel) * CHAR_WIDTH_ESTIMATE + 96;
+    const int32 Width = FMath::Clamp(FMath::Max(TitleWidth, PinsWidth), NODE_MIN_WIDTH, NODE_MAX_WIDTH);
+    const int32 Height = NODE_HEADER_HEIGHT + FMath::Max(FMath::Max(InputRows, OutputRows), 1) * PIN_ROW_HEIGHT + 8;
+    return FIntPoint(Width, Height);
 }
 
-UEdGraphNode* FNodeLayoutService::GetPureNodeConsumer(UEdGraphNode* PureNode)
+int32 FNodeLayoutService::ResolveOverlaps(TArray<FIntRect>& Rects)
 {
-    if (!PureNode) return nullptr;
+    // Column by column, top to bottom, so a pushed node only pushes the ones below it
+    TArray<int32> Order;
+    Order.SetNumUninitialized(Rects.Num());
+    for (int32 Index = 0; Index < Rects.Num(); ++Index)
+    {
+        Order[Index] = Index;
+    }
+    Order.Sort([&Rects](int32 A, int32 B)
+    {
+        return Rects[A].Min.X != Rects[B].Min.X ? Rects[A].Min.X < Rects[B].Min.X : Rects[A].Min.Y < Rects[B].Min.Y;
+    });
+
+    auto Overlap = [](const FIntRect& A, const FIntRect& B)
+    {
+        return A.Min.X < B.Max.X && B.Min.X < A.Max.X && A.Min.Y < B.Max.Y && B.Min.Y < A.Max.Y;
+    };
 
-    // Find the first node that uses any of this pure node's output pins
-    for (UEdGraphPin* Pin : PureNode->Pins)
+    int32 MovedCount = 0;
+    TArray<int32> Candidates;
+    FRectGrid Grid(OVERLAP_GRID_CELL);
+    for (int32 Index : Order)
     {
-        if (Pin && Pin->Direction == EGPD_Output)
+        FIntRect& Rect = Rects[Index];
+        bool bMoved = false;
+        for (int32 Attempt = 0; Attempt < Rects.Num(); ++Attempt)
         {
-            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            Grid.FindCandidates(Rect, Candidates);
+            const int32* Blocker = Candidates.FindByPredicate([&Rects, &Rect, &Overlap](int32 Other)
             {
-                if (LinkedPin && LinkedPin->GetOwningNode())
-                {
-                    return LinkedPin->GetOwningNode();
-                }
+                return Overlap(Rects[Other], Rect);
+            });
+            if (!Blocker)
+            {
+                break;
             }
+            const int32 Height = Rect.Height();
+            Rect.Min.Y = Rects[*Blocker].Max.Y + NODE_GAP;
+            Rect.Max.Y = Rect.Min.Y + Height;
+            bMoved = true;
         }
+        MovedCount += bMoved ? 1 : 0;
+        Grid.Add(Index, Rect);
     }
-
-    return nullptr;
+    return MovedCount;
 }
 
-bool FNodeLayoutService::DoNodeBoundsOverlap(UEdGraphNode* NodeA, UEdGraphNode* NodeB)
+bool FNodeLayoutService::AreTooClose(const FIntRect& A, const FIntRect& B)
 {
-    if (!NodeA || !NodeB) return false;
-
-    FIntRect BoundsA = GetNodeBounds(NodeA);
-    FIntRect BoundsB = GetNodeBounds(NodeB);
-
-    return BoundsA.Intersect(BoundsB);
-}
-
-FIntRect FNodeLayoutService::GetNodeBounds(UEdGraphNode* Node)
-{
-    if (!Node)
-    {
-        return FIntRect();
-    }
-
-    // Use node's actual width/height if available, otherwise use estimates
-    int32 Width = (Node->NodeWidth > 0) ? Node->NodeWidth : NODE_WIDTH_ESTIMATE;
-    int32 Height = (Node->NodeHeight > 0) ? Node->NodeHeight : NODE_HEIGHT_ESTIMATE;
-
-    return FIntRect(
-        FIntPoint(Node->NodePosX, Node->NodePosY),
-        FIntPoint(Node->NodePosX + Width, Node->NodePosY + Height)
-    );
+    return A.Min.X < B.Max.X + NODE_GAP && B.Min.X < A.Max.X + NODE_GAP
+        && A.Min.Y < B.Max.Y + NODE_GAP && B.Min.Y < A.Max.Y + NODE_GAP;
 }
@@ -0,0 +1,26 @@
+#include "Services/ObjectPool.h"
+
+namespace
+{
+    TAtomic<uint32> NextPoolId { 1 };
+
+    /** Pool id to this thread's cache of that pool; pools are few, so a linear scan is fastest */
+    thread_local TArray<TPair<uint32, void*>, TInlineAllocator<8>> ThreadCacheSlots;
+}
+
+uint32 MCPObjectPool::AllocatePoolId()
+{
+    return NextPoolId++;
+}
+
+void*& MCPObjectPool::GetThreadCacheSlot(uint32 PoolId)
+{
+    for (TPair<uint32, void*>& Slot : ThreadCacheSlots)
+    {
+        if (Slot.Key == PoolId)
+        {
+            return Slot.Value;
+        }
+    }
+    return ThreadCacheSlots.Emplace_GetRef(PoolId, nullptr).Value;
+}
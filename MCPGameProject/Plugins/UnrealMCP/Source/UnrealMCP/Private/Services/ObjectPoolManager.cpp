@@ -1,4 +1,46 @@
 #include "Services/ObjectPoolManager.h"
+#include "Dom/JsonObject.h"
+#include "Misc/ScopeRWLock.h"
+#include "MCPCacheStats.h"
+
+namespace
+{
+    const TCHAR* const PoolStatsNames[] = {
+        TEXT("json_object_pool"), TEXT("mcp_response_pool"), TEXT("parameter_validator_pool"),
+        TEXT("json_value_pool"), TEXT("string_buffer_pool") };
+
+    /** Register a pool's statistics, read under the manager's lock */
+    template<typename T>
+    void RegisterPoolStats(const TCHAR* Name, FRWLock& ManagerLock, const TUniquePtr<TObjectPool<T>>& Pool)
+    {
+        FMCPCacheStatsRegistry::Get().Register(Name, TEXT("pool"),
+            [&ManagerLock, &Pool](FMCPCacheStatsRegistry::FStats& OutStats)
+            {
+                FReadScopeLock Lock(ManagerLock);
+                if (!Pool.IsValid())
+                {
+                    return;
+                }
+                const FObjectPoolStats Stats = Pool->GetStats();
+                OutStats.Hits = Stats.PoolHits;
+                OutStats.Misses = Stats.PoolMisses;
+                OutStats.Entries = Stats.PooledCount;
+                OutStats.Details = MakeShared<FJsonObject>();
+                OutStats.Details->SetNumberField(TEXT("max_pooled"), Stats.MaxPooledCount);
+                OutStats.Details->SetNumberField(TEXT("max_pool_size"), Pool->GetMaxPoolSize());
+                OutStats.Details->SetNumberField(TEXT("returns"), Stats.TotalReturns);
+                OutStats.Details->SetNumberField(TEXT("discarded"), Stats.DiscardedCount);
+            },
+            [&ManagerLock, &Pool]()
+            {
+                FReadScopeLock Lock(ManagerLock);
+                if (Pool.IsValid())
+                {
+                    Pool->ResetStats();
+                }
+            });
+    }
+}
 
 FObjectPoolManager& FObjectPoolManager::Get()
 {
@@ -13,7 +55,7 @@ FObjectPoolManager::~FObjectPoolManager()
 
 void FObjectPoolManager::Initialize()
 {
-    FScopeLock Lock(&ManagerLock);
+    FWriteScopeLock Lock(ManagerLock);
     
     if (bInitialized)
     {
@@ -28,6 +70,13 @@ void FObjectPoolManager::Initialize()
     MCPResponsePool = MakeUnique<TObjectPool<FPoolableMCPResponse>>(100, 20);
     ParameterValidatorPool = MakeUnique<TObjectPool<FPoolableParameterValidator>>(30, 5);
     JsonValuePool = MakeUnique<TObjectPool<FPoolableJsonValue>>(200, 50);
+    StringBufferPool = MakeUnique<TObjectPool<FPoolableStringBuffer>>(16, 4);
+
+    RegisterPoolStats(PoolStatsNames[0], ManagerLock, JsonObjectPool);
+    RegisterPoolStats(PoolStatsNames[1], ManagerLock, MCPResponsePool);
+    RegisterPoolStats(PoolStatsNames[2], ManagerLock, ParameterValidatorPool);
+    RegisterPoolStats(PoolStatsNames[3], ManagerLock, JsonValuePool);
+    RegisterPoolStats(PoolStatsNames[4], ManagerLock, StringBufferPool);
     
     bInitialized = true;
     
@@ -36,7 +85,10 @@ void FObjectPoolManager::Initialize()
 
 void FObjectPoolManager::Shutdown()
 {
-    FScopeLock Lock(&ManagerLock);
+    // Get final statistics before shutdown; ManagerLock is not reentrant
+    FObjectPoolManagerStats FinalStats = GetCombinedStats();
+    
+    FWriteScopeLock Lock(ManagerLock);
     
     if (!bInitialized)
     {
@@ -45,16 +97,20 @@ void FObjectPoolManager::Shutdown()
     
     UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::Shutdown: Shutting down object pools"));
     
-    // Get final statistics before shutdown
-    FObjectPoolManagerStats FinalStats = GetCombinedStats();
     UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::Shutdown: Final stats - Total Requests: %d, Total Hits: %d, Hit Ratio: %.2f%%, Total Pooled: %d"),
         FinalStats.GetTotalRequests(), FinalStats.GetTotalHits(), FinalStats.GetOverallHitRatio() * 100.0f, FinalStats.GetTotalPooledObjects());
     
+    for (const TCHAR* Name : PoolStatsNames)
+    {
+        FMCPCacheStatsRegistry::Get().Unregister(Name);
+    }
+
     // Destroy pools
     JsonObjectPool.Reset();
     MCPResponsePool.Reset();
     ParameterValidatorPool.Reset();
     JsonValuePool.Reset();
+    StringBufferPool.Reset();
     
     bInitialized = false;
     
@@ -63,7 +119,7 @@ void FObjectPoolManager::Shutdown()
 
 TSharedPtr<FPoolableJsonObject> FObjectPoolManager::GetJsonObject()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !JsonObjectPool.IsValid())
     {
@@ -76,7 +132,7 @@ TSharedPtr<FPoolableJsonObject> FObjectPoolManager::GetJsonObject()
 
 void FObjectPoolManager::ReturnJsonObject(TSharedPtr<FPoolableJsonObject> Object)
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !JsonObjectPool.IsValid())
     {
@@ -88,7 +144,7 @@ void FObjectPoolManager::ReturnJsonObject(TSharedPtr<FPoolableJsonObject> Object
 
 TSharedPtr<FPoolableMCPResponse> FObjectPoolManager::GetMCPResponse()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !MCPResponsePool.IsValid())
     {
@@ -101,7 +157,7 @@ TSharedPtr<FPoolableMCPResponse> FObjectPoolManager::GetMCPResponse()
 
 void FObjectPoolManager::ReturnMCPResponse(TSharedPtr<FPoolableMCPResponse> Response)
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !MCPResponsePool.IsValid())
     {
@@ -113,7 +169,7 @@ void FObjectPoolManager::ReturnMCPResponse(TSharedPtr<FPoolableMCPResponse> Resp
 
 TSharedPtr<FPoolableParameterValidator> FObjectPoolManager::GetParameterValidator()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !ParameterValidatorPool.IsValid())
     {
@@ -126,7 +182,7 @@ TSharedPtr<FPoolableParameterValidator> FObjectPoolManager::GetParameterValidato
 
 void FObjectPoolManager::ReturnParameterValidator(TSharedPtr<FPoolableParameterValidator> Validator)
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !ParameterValidatorPool.IsValid())
     {
@@ -138,7 +194,7 @@ void FObjectPoolManager::ReturnParameterValidator(TSharedPtr<FPoolableParameterV
 
 TSharedPtr<FPoolableJsonValue> FObjectPoolManager::GetJsonValue()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !JsonValuePool.IsValid())
     {
@@ -151,7 +207,7 @@ TSharedPtr<FPoolableJsonValue> FObjectPoolManager::GetJsonValue()
 
 void FObjectPoolManager::ReturnJsonValue(TSharedPtr<FPoolableJsonValue> Value)
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized || !JsonValuePool.IsValid())
     {
@@ -161,9 +217,34 @@ void FObjectPoolManager::ReturnJsonValue(TSharedPtr<FPoolableJsonValue> Value)
     JsonValuePool->ReturnObject(Value);
 }
 
+TSharedPtr<FPoolableStringBuffer> FObjectPoolManager::GetStringBuffer()
+{
+    FReadScopeLock Lock(ManagerLock);
+    
+    if (!bInitialized || !StringBufferPool.IsValid())
+    {
+        // Serialization runs before module startup and after shutdown too, so this isn't an error
+        return MakeShared<FPoolableStringBuffer>();
+    }
+    
+    return StringBufferPool->GetObject();
+}
+
+void FObjectPoolManager::ReturnStringBuffer(TSharedPtr<FPoolableStringBuffer> Buffer)
+{
+    FReadScopeLock Lock(ManagerLock);
+    
+    if (!bInitialized || !StringBufferPool.IsValid())
+    {
+        return;
+    }
+    
+    StringBufferPool->ReturnObject(Buffer);
+}
+
 FObjectPoolManagerStats FObjectPoolManager::GetCombinedStats() const
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     FObjectPoolManagerStats CombinedStats;
     
@@ -188,6 +269,11 @@ FObjectPoolManagerStats FObjectPoolManager::GetCombinedStats() const
         {
             CombinedStats.JsonValueStats = JsonValuePool->GetStats();
         }
+        
+        if (StringBufferPool.IsValid())
+        {
+            CombinedStats.StringBufferStats = StringBufferPool->GetStats();
+        }
     }
     
     return CombinedStats;
@@ -195,7 +281,7 @@ FObjectPoolManagerStats FObjectPoolManager::GetCombinedStats() const
 
 void FObjectPoolManager::ResetAllStats()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized)
     {
@@ -224,12 +310,17 @@ void FObjectPoolManager::ResetAllStats()
         JsonValuePool->ResetStats();
     }
     
+    if (StringBufferPool.IsValid())
+    {
+        StringBufferPool->ResetStats();
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::ResetAllStats: All pool statistics reset"));
 }
 
 void FObjectPoolManager::ClearAllPools()
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized)
     {
@@ -258,15 +349,21 @@ void FObjectPoolManager::ClearAllPools()
         JsonValuePool->ClearPool();
     }
     
+    if (StringBufferPool.IsValid())
+    {
+        StringBufferPool->ClearPool();
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::ClearAllPools: All pools cleared"));
 }
 
 void FObjectPoolManager::ConfigurePoolSizes(int32 JsonObjectPoolSize, 
                                            int32 MCPResponsePoolSize, 
                                            int32 ParameterValidatorPoolSize,
-                                           int32 JsonValuePoolSize)
+                                           int32 JsonValuePoolSize,
+                                           int32 StringBufferPoolSize)
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     if (!bInitialized)
     {
@@ -274,8 +371,8 @@ void FObjectPoolManager::ConfigurePoolSizes(int32 JsonObjectPoolSize,
         return;
     }
     
-    UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::ConfigurePoolSizes: Configuring pool sizes - JSON: %d, Response: %d, Validator: %d, Value: %d"),
-        JsonObjectPoolSize, MCPResponsePoolSize, ParameterValidatorPoolSize, JsonValuePoolSize);
+    UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::ConfigurePoolSizes: Configuring pool sizes - JSON: %d, Response: %d, Validator: %d, Value: %d, String buffer: %d"),
+        JsonObjectPoolSize, MCPResponsePoolSize, ParameterValidatorPoolSize, JsonValuePoolSize, StringBufferPoolSize);
     
     if (JsonObjectPool.IsValid())
     {
@@ -297,20 +394,27 @@ void FObjectPoolManager::ConfigurePoolSizes(int32 JsonObjectPoolSize,
         JsonValuePool->SetMaxPoolSize(JsonValuePoolSize);
     }
     
+    if (StringBufferPool.IsValid())
+    {
+        StringBufferPool->SetMaxPoolSize(StringBufferPoolSize);
+    }
+    
     UE_LOG(LogTemp, Log, TEXT("FObjectPoolManager::ConfigurePoolSizes: Pool sizes configured successfully"));
 }
 
 void FObjectPoolManager::GetPoolSizes(int32& OutJsonObjectPoolSize, 
                                      int32& OutMCPResponsePoolSize, 
                                      int32& OutParameterValidatorPoolSize,
-                                     int32& OutJsonValuePoolSize) const
+                                     int32& OutJsonValuePoolSize,
+                                     int32& OutStringBufferPoolSize) const
 {
-    FScopeLock Lock(&ManagerLock);
+    FReadScopeLock Lock(ManagerLock);
     
     OutJsonObjectPoolSize = 0;
     OutMCPResponsePoolSize = 0;
     OutParameterValidatorPoolSize = 0;
     OutJsonValuePoolSize = 0;
+    OutStringBufferPoolSize = 0;
     
     if (bInitialized)
     {
@@ -333,5 +437,10 @@ void FObjectPoolManager::GetPoolSizes(int32& OutJsonObjectPoolSize,
         {
             OutJsonValuePoolSize = JsonValuePool->GetMaxPoolSize();
         }
+        
+        if (StringBufferPool.IsValid())
+        {
+            OutStringBufferPoolSize = StringBufferPool->GetMaxPoolSize();
+        }
     }
 }
@@ -0,0 +1,273 @@
+// ProjectAssetBatchOperations.cpp - Batch asset methods for FProjectAssetOperations
+// RenameAssets, DuplicateAssets, DeleteAssets
+
+#include "Services/Project/ProjectAssetOperations.h"
+#include "EditorAssetLibrary.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "ObjectTools.h"
+#include "UObject/ObjectRedirector.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    /** "/Game/Data/DA_Goblin" names the asset "/Game/Data/DA_Goblin.DA_Goblin" */
+    FString NormalizeBatchObjectPath(const FString& AssetPath)
+    {
+        return AssetPath.Contains(TEXT("."))
+            ? AssetPath
+            : AssetPath + TEXT(".") + FPaths::GetBaseFilename(AssetPath);
+    }
+
+    /**
+     * Check an entry of a rename or duplicate batch and work out its destination package
+     * @param UsedDestinations - Destinations of the entries accepted so far, lower case
+     * @return The source asset, or null with OutError set
+     */
+    UObject* ResolveBatchEntry(const FAssetBatchEntry& Entry, TSet<FString>& UsedDestinations,
+                               FString& OutFolder, FString& OutName, FString& OutError)
+    {
+        if (Entry.AssetPath.IsEmpty())
+        {
+            OutError = TEXT("Asset path cannot be empty");
+            return nullptr;
+        }
+
+        const FString ObjectPath = NormalizeBatchObjectPath(Entry.AssetPath);
+        if (!UEditorAssetLibrary::DoesAssetExist(ObjectPath))
+        {
+            OutError = FString::Printf(TEXT("Asset not found: %s"), *Entry.AssetPath);
+            return nullptr;
+        }
+
+        const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+        OutFolder = Entry.DestinationFolder.IsEmpty() ? FPackageName::GetLongPackagePath(PackageName) : Entry.DestinationFolder;
+        OutFolder.RemoveFromEnd(TEXT("/"));
+        OutName = Entry.NewName.IsEmpty() ? FPackageName::GetShortName(PackageName) : Entry.NewName;
+
+        const FString NewPackageName = OutFolder / OutName;
+        if (NewPackageName.Equals(PackageName, ESearchCase::IgnoreCase))
+        {
+            OutError = FString::Printf(TEXT("Asset is already at %s"), *NewPackageName);
+            return nullptr;
+        }
+        if (UsedDestinations.Contains(NewPackageName.ToLower()))
+        {
+            OutError = FString::Printf(TEXT("Another asset of the batch also goes to %s"), *NewPackageName);
+            return nullptr;
+        }
+        if (UEditorAssetLibrary::DoesAssetExist(NewPackageName))
+        {
+            OutError = FString::Printf(TEXT("Destination asset already exists: %s"), *NewPackageName);
+            return nullptr;
+        }
+
+        if (!UEditorAssetLibrary::DoesDirectoryExist(OutFolder) && !UEditorAssetLibrary::MakeDirectory(OutFolder))
+        {
+            OutError = FString::Printf(TEXT("Failed to create destination folder: %s"), *OutFolder);
+            return nullptr;
+        }
+
+        UObject* Asset = UEditorAssetLibrary::LoadAsset(ObjectPath);
+        if (!Asset)
+        {
+            OutError = FString::Printf(TEXT("Failed to load asset: %s"), *Entry.AssetPath);
+            return nullptr;
+        }
+
+        UsedDestinations.Add(NewPackageName.ToLower());
+        return Asset;
+    }
+}
+
+bool FProjectAssetOperations::RenameAssets(const TArray<FAssetBatchEntry>& Entries, bool bFixupRedirectors, TArray<FAssetBatchResult>& OutResults, int32& OutFixedRedirectors, FString& OutError)
+{
+    OutResults.Reset();
+    OutFixedRedirectors = 0;
+    if (Entries.Num() == 0)
+    {
+        OutError = TEXT("No assets to rename");
+        return false;
+    }
+    OutResults.SetNum(Entries.Num());
+
+    TArray<FAssetRenameData> RenameData;
+    TArray<int32> RenameEntries;
+    TArray<FString> OldObjectPaths;
+    TSet<FString> UsedDestinations;
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        const FAssetBatchEntry& Entry = Entries[Index];
+        FAssetBatchResult& Result = OutResults[Index];
+        Result.AssetPath = Entry.AssetPath;
+
+        if (Entry.DestinationFolder.IsEmpty() && Entry.NewName.IsEmpty())
+        {
+            Result.Error = TEXT("Each asset needs a destination folder and/or a new name");
+            continue;
+        }
+
+        FString Folder;
+        FString Name;
+        UObject* Asset = ResolveBatchEntry(Entry, UsedDestinations, Folder, Name, Result.Error);
+        if (!Asset)
+        {
+            continue;
+        }
+
+        Result.NewAssetPath = Folder / Name;
+        RenameData.Emplace(Asset, Folder, Name);
+        RenameEntries.Add(Index);
+        OldObjectPaths.Add(Asset->GetPathName());
+    }
+
+    int32 RenamedCount = 0;
+    if (RenameData.Num() > 0)
+    {
+        // One call for the whole set: referencers are gathered, loaded and updated once
+        IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+        AssetTools.RenameAssets(RenameData);
+
+        // RenameAssets reports only overall success; an asset not in its new package was not renamed
+        TArray<UObjectRedirector*> Redirectors;
+        for (int32 RenameIndex = 0; RenameIndex < RenameData.Num(); ++RenameIndex)
+        {
+            FAssetBatchResult& Result = OutResults[RenameEntries[RenameIndex]];
+            const UObject* Asset = RenameData[RenameIndex].Asset.Get();
+            if (!Asset || Asset->GetOutermost()->GetName() != Result.NewAssetPath)
+            {
+                Result.Error = FString::Printf(TEXT("Failed to rename asset from %s to %s"), *Result.AssetPath, *Result.NewAssetPath);
+                Result.NewAssetPath.Reset();
+                continue;
+            }
+            Result.bSuccess = true;
+            ++RenamedCount;
+
+            if (UObjectRedirector* Redirector = FindObject<UObjectRedirector>(nullptr, *OldObjectPaths[RenameIndex]))
+            {
+                Redirectors.Add(Redirector);
+            }
+        }
+
+        // One fixup pass for every redirector the batch left behind
+        if (bFixupRedirectors && Redirectors.Num() > 0)
+        {
+            AssetTools.FixupReferencers(Redirectors, false, ERedirectFixupMode::DeleteFixedUpRedirectors);
+            OutFixedRedirectors = Redirectors.Num();
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Renamed %d of %d asset(s), fixed up %d redirector(s)"),
+        RenamedCount, Entries.Num(), OutFixedRedirectors);
+    return true;
+}
+
+bool FProjectAssetOperations::DuplicateAssets(const TArray<FAssetBatchEntry>& Entries, TArray<FAssetBatchResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset();
+    if (Entries.Num() == 0)
+    {
+        OutError = TEXT("No assets to duplicate");
+        return false;
+    }
+    OutResults.SetNum(Entries.Num());
+
+    // Every entry is checked before the first copy, so no two entries copy to the same path
+    TArray<TPair<int32, UObject*>> Sources;
+    TArray<TPair<FString, FString>> Destinations;
+    TSet<FString> UsedDestinations;
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        FAssetBatchResult& Result = OutResults[Index];
+        Result.AssetPath = Entries[Index].AssetPath;
+
+        FString Folder;
+        FString Name;
+        if (UObject* Asset = ResolveBatchEntry(Entries[Index], UsedDestinations, Folder, Name, Result.Error))
+        {
+            Sources.Emplace(Index, Asset);
+            Destinations.Emplace(Folder, Name);
+        }
+    }
+
+    IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+    int32 DuplicatedCount = 0;
+    for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+    {
+        FAssetBatchResult& Result = OutResults[Sources[SourceIndex].Key];
+        const FString& Folder = Destinations[SourceIndex].Key;
+        const FString& Name = Destinations[SourceIndex].Value;
+
+        if (!AssetTools.DuplicateAsset(Name, Folder, Sources[SourceIndex].Value))
+        {
+            Result.Error = FString::Printf(TEXT("Failed to duplicate asset from '%s' to '%s'"), *Result.AssetPath, *(Folder / Name));
+            continue;
+        }
+        Result.NewAssetPath = Folder / Name;
+        Result.bSuccess = true;
+        ++DuplicatedCount;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Duplicated %d of %d asset(s)"), DuplicatedCount, Entries.Num());
+    return true;
+}
+
+bool FProjectAssetOperations::DeleteAssets(const TArray<FString>& AssetPaths, TArray<FAssetBatchResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset();
+    if (AssetPaths.Num() == 0)
+    {
+        OutError = TEXT("No assets to delete");
+        return false;
+    }
+    OutResults.SetNum(AssetPaths.Num());
+
+    TArray<UObject*> ObjectsToDelete;
+    TArray<int32> DeleteEntries;
+    for (int32 Index = 0; Index < AssetPaths.Num(); ++Index)
+    {
+        FAssetBatchResult& Result = OutResults[Index];
+        Result.AssetPath = AssetPaths[Index];
+
+        const FString ObjectPath = NormalizeBatchObjectPath(AssetPaths[Index]);
+        if (!UEditorAssetLibrary::DoesAssetExist(ObjectPath))
+        {
+            Result.Error = FString::Printf(TEXT("Asset does not exist: %s"), *AssetPaths[Index]);
+            continue;
+        }
+
+        UObject* Asset = UEditorAssetLibrary::LoadAsset(ObjectPath);
+        if (!Asset)
+        {
+            Result.Error = FString::Printf(TEXT("Failed to load asset: %s"), *AssetPaths[Index]);
+            continue;
+        }
+
+        // The same asset named twice is deleted once and reported for both
+        ObjectsToDelete.AddUnique(Asset);
+        DeleteEntries.Add(Index);
+    }
+
+    // One call for the whole set: references to any of them are cleared in one pass
+    if (ObjectsToDelete.Num() > 0)
+    {
+        ObjectTools::ForceDeleteObjects(ObjectsToDelete, false);
+    }
+
+    int32 DeletedCount = 0;
+    for (int32 Index : DeleteEntries)
+    {
+        FAssetBatchResult& Result = OutResults[Index];
+        if (UEditorAssetLibrary::DoesAssetExist(NormalizeBatchObjectPath(Result.AssetPath)))
+        {
+            Result.Error = FString::Printf(TEXT("Failed to delete asset: %s"), *Result.AssetPath);
+            continue;
+        }
+        Result.bSuccess = true;
+        ++DeletedCount;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Deleted %d of %d asset(s)"), DeletedCount, AssetPaths.Num());
+    return true;
+}
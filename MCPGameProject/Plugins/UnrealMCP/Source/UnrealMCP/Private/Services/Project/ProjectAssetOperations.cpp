@@ -1,6 +1,7 @@
 #include "Services/Project/ProjectAssetOperations.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Services/AssetSearchIndex.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformFileManager.h"
 
@@ -183,18 +184,11 @@ TArray<TSharedPtr<FJsonObject>> FProjectAssetOperations::SearchAssets(const FStr
     TArray<TSharedPtr<FJsonObject>> Results;
     bOutSuccess = false;
 
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    // Build filter
-    FARFilter Filter;
-
     // Set search path
     FString SearchPath = Folder.IsEmpty() ? TEXT("/Game") : Folder;
-    Filter.PackagePaths.Add(FName(*SearchPath));
-    Filter.bRecursivePaths = true;
 
     // Filter by class if specified
+    TArray<FTopLevelAssetPath> ClassPaths;
     if (!AssetClass.IsEmpty())
     {
         // Try to find the class using UE5's FindFirstObject (replaces deprecated ANY_PACKAGE)
@@ -210,42 +204,67 @@ TArray<TSharedPtr<FJsonObject>> FProjectAssetOperations::SearchAssets(const FStr
         }
         if (Class)
         {
-            Filter.ClassPaths.Add(Class->GetClassPathName());
-            Filter.bRecursiveClasses = true;
+            ClassPaths.Add(Class->GetClassPathName());
         }
     }
 
-    // Get assets
-    TArray<FAssetData> AssetList;
-    AssetRegistry.GetAssets(Filter, AssetList);
+    // Convert wildcard pattern to fragment matching
+    const FString SearchPattern = Pattern.Replace(TEXT("*"), TEXT(""));
 
-    // Filter by pattern if specified
-    FString SearchPattern = Pattern;
-    bool bHasPattern = !SearchPattern.IsEmpty();
-
-    // Convert wildcard pattern to regex-like matching
-    if (bHasPattern)
+    auto AddResult = [&Results](const FString& Name, const FString& ObjectPath, const FString& PackagePath, const FString& ClassName)
+    {
+        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+        AssetObj->SetStringField(TEXT("name"), Name);
+        AssetObj->SetStringField(TEXT("path"), ObjectPath);
+        AssetObj->SetStringField(TEXT("package_path"), PackagePath);
+        AssetObj->SetStringField(TEXT("class"), ClassName);
+        Results.Add(AssetObj);
+    };
+
+    // The name index answers for /Game once built
+    FAssetSearchIndex::FQuery Query;
+    Query.NameFilter = SearchPattern;
+    Query.ClassPaths = ClassPaths;
+    Query.PackagePath = SearchPath;
+    TArray<FAssetSearchIndex::FEntry> Matches;
+    int32 TotalMatches = 0;
+    if (FAssetSearchIndex::Get().Search(Query, Matches, TotalMatches))
     {
-        SearchPattern = SearchPattern.Replace(TEXT("*"), TEXT(""));
+        for (const FAssetSearchIndex::FEntry& Match : Matches)
+        {
+            AddResult(Match.AssetName.ToString(), Match.ObjectPath.ToString(), Match.PackagePath.ToString(), Match.ClassPath.GetAssetName().ToString());
+        }
+
+        bOutSuccess = true;
+        UE_LOG(LogTemp, Display, TEXT("MCP Project: Found %d assets matching pattern '%s'"), Results.Num(), *Pattern);
+        return Results;
     }
 
+    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+    // Build filter
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*SearchPath));
+    Filter.bRecursivePaths = true;
+    Filter.ClassPaths = ClassPaths;
+    Filter.bRecursiveClasses = ClassPaths.Num() > 0;
+
+    // Get assets
+    TArray<FAssetData> AssetList;
+    AssetRegistry.GetAssets(Filter, AssetList);
+
     for (const FAssetData& AssetData : AssetList)
     {
         FString AssetName = AssetData.AssetName.ToString();
 
         // Apply pattern filter
-        if (bHasPattern && !AssetName.Contains(SearchPattern, ESearchCase::IgnoreCase))
+        if (!SearchPattern.IsEmpty() && !AssetName.Contains(SearchPattern, ESearchCase::IgnoreCase))
         {
             continue;
         }
 
-        TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
-        AssetObj->SetStringField(TEXT("name"), AssetName);
-        AssetObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
-        AssetObj->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
-        AssetObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.GetAssetName().ToString());
-
-        Results.Add(AssetObj);
+        AddResult(AssetName, AssetData.GetObjectPathString(), AssetData.PackagePath.ToString(), AssetData.AssetClassPath.GetAssetName().ToString());
     }
 
     bOutSuccess = true;
@@ -5,6 +5,11 @@
 #include "Misc/Paths.h"
 #include "UObject/UObjectGlobals.h"
 #include "Serialization/ObjectReader.h"
+#include "Services/PropertyAccessorCache.h"
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
 
 FProjectDataAssetService& FProjectDataAssetService::Get()
 {
@@ -23,6 +28,59 @@ namespace ProjectDataAssetServiceHelpers
         }
         return true;
     }
+
+    /** Find a class by name, name with the U prefix, or path; nullptr if none matches */
+    static UClass* FindDataAssetClass(const FString& AssetClass)
+    {
+        // Try to find the DataAsset class using UE5's FindFirstObject (replaces deprecated ANY_PACKAGE)
+        // First, try exact match
+        UClass* DataAssetClass = FindFirstObject<UClass>(*AssetClass, EFindFirstObjectOptions::ExactClass);
+
+        // Try with U prefix
+        if (!DataAssetClass)
+        {
+            DataAssetClass = FindFirstObject<UClass>(*(TEXT("U") + AssetClass), EFindFirstObjectOptions::ExactClass);
+        }
+
+        // Try loading by path if it looks like a path
+        if (!DataAssetClass && AssetClass.Contains(TEXT("/")))
+        {
+            DataAssetClass = LoadClass<UDataAsset>(nullptr, *AssetClass);
+        }
+        return DataAssetClass;
+    }
+
+    /** Serialize new packages on worker threads; names of the packages that were not written are added to OutUnsaved */
+    static void SavePackagesConcurrently(const TArray<UPackage*>& Packages, TArray<FString>& OutUnsaved)
+    {
+        TArray<FPackageSaveInfo> SaveInfos;
+        SaveInfos.Reserve(Packages.Num());
+        for (UPackage* Package : Packages)
+        {
+            FPackageSaveInfo& SaveInfo = SaveInfos.AddDefaulted_GetRef();
+            SaveInfo.Package = Package;
+            SaveInfo.Asset = Package->FindAssetInPackage();
+            SaveInfo.Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+        }
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+        SaveArgs.SaveFlags = SAVE_NoError | SAVE_Concurrent;
+        TArray<FSavePackageResultStruct> Results;
+        UPackage::SaveConcurrent(SaveInfos, SaveArgs, Results);
+
+        for (int32 Index = 0; Index < Packages.Num(); ++Index)
+        {
+            if (!Results.IsValidIndex(Index) || Results[Index].Result != ESavePackageResult::Success)
+            {
+                OutUnsaved.Add(Packages[Index]->GetName());
+            }
+            else
+            {
+                Packages[Index]->SetDirtyFlag(false);
+            }
+        }
+    }
 }
 
 bool FProjectDataAssetService::CreateDataAsset(const FString& Name, const FString& AssetClass, const FString& FolderPath, const TSharedPtr<FJsonObject>& Properties, FString& OutAssetPath, FString& OutError)
@@ -47,23 +105,7 @@ bool FProjectDataAssetService::CreateDataAsset(const FString& Name, const FStrin
     // Ensure the folder exists
     ProjectDataAssetServiceHelpers::EnsureFolderExists(BasePath);
 
-    // Try to find the DataAsset class using UE5's FindFirstObject (replaces deprecated ANY_PACKAGE)
-    UClass* DataAssetClass = nullptr;
-
-    // First, try exact match
-    DataAssetClass = FindFirstObject<UClass>(*AssetClass, EFindFirstObjectOptions::ExactClass);
-
-    // Try with U prefix
-    if (!DataAssetClass)
-    {
-        DataAssetClass = FindFirstObject<UClass>(*(TEXT("U") + AssetClass), EFindFirstObjectOptions::ExactClass);
-    }
-
-    // Try loading by path if it looks like a path
-    if (!DataAssetClass && AssetClass.Contains(TEXT("/")))
-    {
-        DataAssetClass = LoadClass<UDataAsset>(nullptr, *AssetClass);
-    }
+    UClass* DataAssetClass = ProjectDataAssetServiceHelpers::FindDataAssetClass(AssetClass);
 
     // Fallback to base UDataAsset
     if (!DataAssetClass)
@@ -301,3 +343,125 @@ TSharedPtr<FJsonObject> FProjectDataAssetService::GetDataAssetMetadata(const FSt
 
     return Metadata;
 }
+
+bool FProjectDataAssetService::CreateDataAssets(const FBulkDataAssetParams& Params, FBulkDataAssetResult& OutResult, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (Params.Rows.Num() == 0)
+    {
+        OutError = TEXT("'rows' must list at least one data asset");
+        return false;
+    }
+
+    // Unlike create_data_asset, an unknown class is an error: falling back would create every row wrong
+    UClass* DataAssetClass = ProjectDataAssetServiceHelpers::FindDataAssetClass(Params.AssetClass);
+    if (!DataAssetClass || !DataAssetClass->IsChildOf(UDataAsset::StaticClass()) || DataAssetClass->HasAnyClassFlags(CLASS_Abstract))
+    {
+        OutError = FString::Printf(TEXT("Class '%s' is not a concrete DataAsset subclass"), *Params.AssetClass);
+        return false;
+    }
+
+    TArray<UPackage*> CreatedPackages;
+    CreatedPackages.Reserve(Params.Rows.Num());
+    TSet<FString> CheckedFolders;
+    TSet<FString> UsedPackages;
+
+    for (const FBulkDataAssetRow& Row : Params.Rows)
+    {
+        FString Folder = Row.FolderPath.IsEmpty() ? Params.FolderPath : Row.FolderPath;
+        Folder.RemoveFromEnd(TEXT("/"));
+        const FString PackageName = Folder / Row.Name;
+
+        TSharedPtr<FJsonObject> RowResult = MakeShared<FJsonObject>();
+        RowResult->SetStringField(TEXT("name"), Row.Name);
+        RowResult->SetStringField(TEXT("asset_path"), PackageName);
+        RowResult->SetBoolField(TEXT("created"), false);
+        OutResult.Rows.Add(RowResult);
+
+        FString Error;
+        if (Row.Name.IsEmpty())
+        {
+            Error = TEXT("Row has no name");
+        }
+        else if (UsedPackages.Contains(PackageName.ToLower()))
+        {
+            Error = FString::Printf(TEXT("'%s' is named more than once"), *PackageName);
+        }
+        else if (!CheckedFolders.Contains(Folder) && !ProjectDataAssetServiceHelpers::EnsureFolderExists(Folder))
+        {
+            Error = FString::Printf(TEXT("Failed to create folder: %s"), *Folder);
+        }
+        else if (FindObject<UPackage>(nullptr, *PackageName) || FPackageName::DoesPackageExist(PackageName))
+        {
+            Error = FString::Printf(TEXT("Asset already exists: %s"), *PackageName);
+        }
+        if (!Error.IsEmpty())
+        {
+            RowResult->SetStringField(TEXT("error"), Error);
+            OutResult.FailedCount++;
+            continue;
+        }
+        CheckedFolders.Add(Folder);
+        UsedPackages.Add(PackageName.ToLower());
+
+        UPackage* Package = CreatePackage(*PackageName);
+        UDataAsset* NewDataAsset = Package ? NewObject<UDataAsset>(Package, DataAssetClass, *Row.Name, RF_Public | RF_Standalone) : nullptr;
+        if (!NewDataAsset)
+        {
+            RowResult->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to create DataAsset: %s"), *Row.Name));
+            OutResult.FailedCount++;
+            continue;
+        }
+
+        // Each path is resolved once for the class; the rows after the first only walk the cached chain
+        if (Row.Properties.IsValid())
+        {
+            TArray<TSharedPtr<FJsonValue>> PropertyErrors;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Row.Properties->Values)
+            {
+                FString PropertyError;
+                if (!FPropertyAccessorCache::Get().SetPropertyByPath(NewDataAsset, Pair.Key, Pair.Value, PropertyError))
+                {
+                    PropertyErrors.Add(MakeShared<FJsonValueString>(FString::Printf(TEXT("%s: %s"), *Pair.Key, *PropertyError)));
+                }
+            }
+            if (PropertyErrors.Num() > 0)
+            {
+                RowResult->SetArrayField(TEXT("property_errors"), PropertyErrors);
+                OutResult.PropertyErrorCount += PropertyErrors.Num();
+            }
+        }
+
+        Package->MarkPackageDirty();
+        FAssetRegistryModule::AssetCreated(NewDataAsset);
+        CreatedPackages.Add(Package);
+        RowResult->SetBoolField(TEXT("created"), true);
+        OutResult.CreatedCount++;
+    }
+
+    if (Params.bSave && CreatedPackages.Num() > 0)
+    {
+        if (Params.bParallelSave)
+        {
+            ProjectDataAssetServiceHelpers::SavePackagesConcurrently(CreatedPackages, OutResult.UnsavedPackages);
+        }
+        else
+        {
+            UEditorLoadingAndSavingUtils::SavePackages(CreatedPackages, true);
+
+            // SavePackages reports only overall success; a package still dirty was not written
+            for (UPackage* Package : CreatedPackages)
+            {
+                if (Package->IsDirty())
+                {
+                    OutResult.UnsavedPackages.Add(Package->GetName());
+                }
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Created %d DataAssets of type '%s', %d failed, %d property errors"),
+        OutResult.CreatedCount, *DataAssetClass->GetName(), OutResult.FailedCount, OutResult.PropertyErrorCount);
+    return true;
+}
@@ -5,6 +5,7 @@
 #include "Kismet2/EnumEditorUtils.h"
 #include "AssetToolsModule.h"
 #include "Factories/EnumFactory.h"
+#include "ScopedTransaction.h"
 
 FProjectEnumService& FProjectEnumService::Get()
 {
@@ -256,3 +257,138 @@ bool FProjectEnumService::UpdateEnum(const FString& EnumName, const FString& Pat
 
     return true;
 }
+
+bool FProjectEnumService::ApplyEnumChanges(UUserDefinedEnum* Enum, const TArray<FSchemaChange>& Changes, TArray<FSchemaChangeResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset(Changes.Num());
+    if (!Enum)
+    {
+        OutError = TEXT("Enum is null");
+        return false;
+    }
+
+    struct FEnumerator
+    {
+        FName Name;
+        FText DisplayName;
+        FString ToolTip;
+        bool bToolTipChanged = false;
+    };
+
+    // Work on a copy of the enumerators (without MAX), so the enum changes once at the end
+    TArray<TPair<FName, int64>> OldNames;
+    TArray<FEnumerator> Enumerators;
+    for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+    {
+        OldNames.Emplace(Enum->GetNameByIndex(Index), Enum->GetValueByIndex(Index));
+        FEnumerator& Enumerator = Enumerators.AddDefaulted_GetRef();
+        Enumerator.Name = Enum->GetNameByIndex(Index);
+        Enumerator.DisplayName = Enum->GetDisplayNameTextByIndex(Index);
+    }
+
+    auto FindByDisplayName = [&Enumerators](const FString& DisplayName)
+    {
+        return Enumerators.IndexOfByPredicate([&DisplayName](const FEnumerator& Enumerator)
+        {
+            return Enumerator.DisplayName.ToString().Equals(DisplayName, ESearchCase::IgnoreCase);
+        });
+    };
+
+    int32 AppliedCount = 0;
+    for (const FSchemaChange& Change : Changes)
+    {
+        FSchemaChangeResult& Result = OutResults.AddDefaulted_GetRef();
+        Result.Operation = Change.Operation;
+        Result.Name = Change.Name;
+
+        const int32 EnumeratorIndex = FindByDisplayName(Change.Name);
+        if (Change.Operation == TEXT("add"))
+        {
+            if (Change.Name.IsEmpty() || EnumeratorIndex != INDEX_NONE)
+            {
+                Result.Error = FString::Printf(TEXT("Cannot add '%s': the name is empty or taken"), *Change.Name);
+                continue;
+            }
+            // Internal names are generated, as the enum editor does; the display name is what Blueprints show
+            FEnumerator& Enumerator = Enumerators.AddDefaulted_GetRef();
+            Enumerator.Name = FName(*Enum->GenerateFullEnumName(*Enum->GenerateNewEnumeratorName()));
+            Enumerator.DisplayName = FText::FromString(Change.Name);
+            Enumerator.ToolTip = Change.Description;
+            Enumerator.bToolTipChanged = !Change.Description.IsEmpty();
+        }
+        else if (EnumeratorIndex == INDEX_NONE)
+        {
+            Result.Error = FString::Printf(TEXT("Enum has no enumerator '%s'"), *Change.Name);
+            continue;
+        }
+        else if (Change.Operation == TEXT("remove"))
+        {
+            if (Enumerators.Num() <= 1)
+            {
+                Result.Error = TEXT("An enum keeps at least one enumerator");
+                continue;
+            }
+            Enumerators.RemoveAt(EnumeratorIndex);
+        }
+        else if (Change.Operation == TEXT("rename"))
+        {
+            const int32 ExistingIndex = FindByDisplayName(Change.NewName);
+            if (Change.NewName.IsEmpty() || (ExistingIndex != INDEX_NONE && ExistingIndex != EnumeratorIndex))
+            {
+                Result.Error = FString::Printf(TEXT("Cannot rename '%s' to '%s': the name is empty or taken"), *Change.Name, *Change.NewName);
+                continue;
+            }
+            Enumerators[EnumeratorIndex].DisplayName = FText::FromString(Change.NewName);
+        }
+        else if (Change.Operation == TEXT("set_description"))
+        {
+            Enumerators[EnumeratorIndex].ToolTip = Change.Description;
+            Enumerators[EnumeratorIndex].bToolTipChanged = true;
+        }
+        else
+        {
+            Result.Error = FString::Printf(TEXT("Unknown enum change '%s'"), *Change.Operation);
+            continue;
+        }
+
+        Result.bSuccess = true;
+        ++AppliedCount;
+    }
+
+    if (AppliedCount == 0)
+    {
+        OutError = TEXT("None of the changes could be applied");
+        return false;
+    }
+
+    const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "ApplyEnumChanges", "Apply Enum Changes"));
+    FEnumEditorUtils::PrepareForChange(Enum);
+
+    // Values follow the order, as FEnumEditorUtils keeps them after a removal
+    TArray<TPair<FName, int64>> Names;
+    Names.Reserve(Enumerators.Num());
+    for (int32 Index = 0; Index < Enumerators.Num(); ++Index)
+    {
+        Names.Emplace(Enumerators[Index].Name, Index);
+    }
+    Enum->SetEnums(Names, Enum->GetCppForm());
+
+    Enum->DisplayNameMap.Reset();
+    for (int32 Index = 0; Index < Enumerators.Num(); ++Index)
+    {
+        const FEnumerator& Enumerator = Enumerators[Index];
+        Enum->DisplayNameMap.Add(Enumerator.Name, Enumerator.DisplayName);
+        if (Enumerator.bToolTipChanged)
+        {
+            Enum->SetMetaData(TEXT("ToolTip"), *Enumerator.ToolTip, Index);
+        }
+    }
+    FEnumEditorUtils::EnsureAllDisplayNamesExist(Enum);
+
+    // One broadcast; dependent Blueprints and DataTables remap their values from the old names here
+    FEnumEditorUtils::BroadcastChanges(Enum, OldNames);
+    Enum->MarkPackageDirty();
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Applied %d of %d changes to enum '%s'"), AppliedCount, Changes.Num(), *Enum->GetName());
+    return true;
+}
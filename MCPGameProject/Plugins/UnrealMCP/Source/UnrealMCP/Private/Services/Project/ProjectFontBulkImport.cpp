@@ -0,0 +1,287 @@
+// ProjectFontBulkImport.cpp - Bulk font import methods for FProjectFontService
+// StartBulkFontImport, GetBulkFontImport
+
+#include "Services/Project/ProjectFontService.h"
+#include "FileHelpers.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    /** Result of a font that was not created */
+    TSharedPtr<FJsonObject> MakeBulkFontImportFailure(const FBulkFontImportEntry& Font, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("font_name"), Font.FontName);
+        Result->SetStringField(TEXT("source_type"), Font.SourceType);
+        Result->SetBoolField(TEXT("created"), false);
+        Result->SetStringField(TEXT("error"), Error);
+        return Result;
+    }
+}
+
+bool FProjectFontService::StartBulkFontImport(const FBulkFontImportParams& Params, int64& OutJobId, int32& OutFontCount, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+
+    FBulkFontImportJob Job;
+
+    // Two fonts of one run must not create the same asset; the first one named wins
+    TSet<FString> UsedPackages;
+    for (const FBulkFontImportEntry& RequestedFont : Params.Fonts)
+    {
+        FBulkFontImportEntry Font = RequestedFont;
+        if (Font.Path.IsEmpty())
+        {
+            Font.Path = Params.Path;
+        }
+        Font.Path.RemoveFromEnd(TEXT("/"));
+
+        const FString PackageName = (Font.Path / Font.FontName).ToLower();
+        if (UsedPackages.Contains(PackageName))
+        {
+            Job.Results.Add(MakeBulkFontImportFailure(Font, FString::Printf(
+                TEXT("Font '%s' is named more than once in '%s'"), *Font.FontName, *Font.Path)));
+            Job.FailedCount++;
+            continue;
+        }
+        UsedPackages.Add(PackageName);
+        Job.Fonts.Add(MoveTemp(Font));
+    }
+
+    Job.bSave = Params.bSave;
+    Job.MaxInFlight = FMath::Clamp(Params.MaxInFlight, 1, 64);
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // Results of old runs are dropped before a new run adds its own
+    TArray<int64> FinishedIds;
+    for (const TPair<int64, FBulkFontImportJob>& Pair : BulkFontImportJobs)
+    {
+        if (Pair.Value.bFinished)
+        {
+            FinishedIds.Add(Pair.Key);
+        }
+    }
+    FinishedIds.Sort();
+    for (int32 Index = 0; Index <= FinishedIds.Num() - MaxFinishedBulkFontImportJobs; ++Index)
+    {
+        BulkFontImportJobs.Remove(FinishedIds[Index]);
+    }
+
+    OutJobId = NextBulkFontImportJobId++;
+    OutFontCount = Job.FontCount = Job.Fonts.Num() + Job.Results.Num();
+    BulkFontImportJobs.Add(OutJobId, MoveTemp(Job));
+
+    if (!BulkFontImportTickerHandle.IsValid())
+    {
+        BulkFontImportTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FProjectFontService::TickBulkFontImport));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Started bulk font import job %lld of %d font(s)"), OutJobId, OutFontCount);
+    return true;
+}
+
+bool FProjectFontService::TickBulkFontImport(float DeltaTime)
+{
+    bool bAnyRunning = false;
+
+    for (TPair<int64, FBulkFontImportJob>& Pair : BulkFontImportJobs)
+    {
+        const int64 JobId = Pair.Key;
+        FBulkFontImportJob& Job = Pair.Value;
+        if (Job.bFinished)
+        {
+            continue;
+        }
+
+        // Create the fonts whose files the workers have read
+        for (int32 Index = Job.Preparing.Num() - 1; Index >= 0; --Index)
+        {
+            FBulkFontImportPreparing& Entry = Job.Preparing[Index];
+            if (!Entry.Result.IsReady())
+            {
+                continue;
+            }
+
+            FBulkFontImportPrepared Prepared = Entry.Result.Get();
+            const int32 FontIndex = Entry.FontIndex;
+            Job.Preparing.RemoveAtSwap(Index);
+
+            if (Prepared.Error.IsEmpty())
+            {
+                CreateBulkFont(Job, FontIndex, MoveTemp(Prepared));
+            }
+            else
+            {
+                Job.Results.Add(MakeBulkFontImportFailure(Job.Fonts[FontIndex], Prepared.Error));
+                Job.FailedCount++;
+            }
+        }
+
+        // Keep MaxInFlight fonts being read and parsed on worker threads
+        while (Job.NextQueued < Job.Fonts.Num() && Job.Preparing.Num() < Job.MaxInFlight)
+        {
+            FBulkFontImportPreparing& Entry = Job.Preparing.AddDefaulted_GetRef();
+            Entry.FontIndex = Job.NextQueued++;
+            Entry.Result = Async(EAsyncExecution::ThreadPool, [Font = Job.Fonts[Entry.FontIndex]]()
+            {
+                FBulkFontImportPrepared Prepared;
+                if (Font.SourceType == TEXT("ttf"))
+                {
+                    ReadFontFile(Font.TTFFilePath, Prepared.FontData, Prepared.Error);
+                }
+                else
+                {
+                    BuildOfflineGlyphTable(Font.MetricsFilePath, Prepared.GlyphTable, Prepared.Error);
+                }
+                return Prepared;
+            });
+        }
+
+        if (Job.NextQueued >= Job.Fonts.Num() && Job.Preparing.Num() == 0)
+        {
+            if (Job.bSave)
+            {
+                TArray<UPackage*> Packages;
+                for (const TWeakObjectPtr<UPackage>& Package : Job.CreatedPackages)
+                {
+                    if (Package.IsValid())
+                    {
+                        Packages.Add(Package.Get());
+                    }
+                }
+                if (Packages.Num() > 0)
+                {
+                    UEditorLoadingAndSavingUtils::SavePackages(Packages, true);
+                }
+
+                // SavePackages reports only overall success; a package still dirty was not written
+                for (UPackage* Package : Packages)
+                {
+                    if (Package->IsDirty())
+                    {
+                        Job.UnsavedPackages.Add(Package->GetName());
+                    }
+                }
+            }
+
+            Job.bFinished = true;
+            Job.FinishTime = FPlatformTime::Seconds();
+            UE_LOG(LogTemp, Display, TEXT("MCP Project: Bulk font import job %lld finished: %d created, %d failed, %.1f s"),
+                JobId, Job.CreatedCount, Job.FailedCount, Job.FinishTime - Job.StartTime);
+            continue;
+        }
+        bAnyRunning = true;
+    }
+
+    if (!bAnyRunning)
+    {
+        BulkFontImportTickerHandle.Reset();
+    }
+    return bAnyRunning;
+}
+
+void FProjectFontService::CreateBulkFont(FBulkFontImportJob& Job, int32 FontIndex, FBulkFontImportPrepared&& Prepared)
+{
+    const FBulkFontImportEntry& Font = Job.Fonts[FontIndex];
+
+    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+    Result->SetStringField(TEXT("font_name"), Font.FontName);
+    Result->SetStringField(TEXT("source_type"), Font.SourceType);
+
+    FString AssetPath;
+    FString Error;
+    TArray<UPackage*> Packages;
+    bool bCreated = false;
+    if (Font.SourceType == TEXT("ttf"))
+    {
+        FString FontFacePath;
+        bCreated = CreateTTFFontAssets(Font.FontName, Font.Path, Font.TTFFilePath, MoveTemp(Prepared.FontData), Font.FontMetrics,
+            AssetPath, FontFacePath, Packages, Error);
+        Result->SetStringField(TEXT("font_face_path"), FontFacePath);
+    }
+    else
+    {
+        UPackage* Package = nullptr;
+        int32 CharacterCount = 0;
+        bCreated = CreateOfflineFontAsset(Font.FontName, Font.Path, Font.AtlasTexturePath, MoveTemp(Prepared.GlyphTable),
+            AssetPath, Package, CharacterCount, Error);
+        if (Package)
+        {
+            Packages.Add(Package);
+        }
+        Result->SetNumberField(TEXT("character_count"), CharacterCount);
+    }
+
+    // A TTF font that failed after its FontFace was created still leaves that package to save
+    for (UPackage* Package : Packages)
+    {
+        Job.CreatedPackages.Add(Package);
+    }
+
+    if (!bCreated)
+    {
+        Job.Results.Add(MakeBulkFontImportFailure(Font, Error));
+        Job.FailedCount++;
+        return;
+    }
+
+    Result->SetBoolField(TEXT("created"), true);
+    Result->SetStringField(TEXT("asset_path"), AssetPath);
+    Job.Results.Add(Result);
+    Job.CreatedCount++;
+}
+
+bool FProjectFontService::GetBulkFontImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    check(IsInGameThread());
+
+    const FBulkFontImportJob* Job = BulkFontImportJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown bulk font import job: %lld"), JobId);
+        return false;
+    }
+
+    const int32 FontsTotal = Job->FontCount;
+    const int32 First = FMath::Clamp(Cursor, 0, Job->Results.Num());
+    const int32 Last = FMath::Min(Job->Results.Num(), First + FMath::Max(MaxResults, 0));
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Job->Results[Index]));
+    }
+
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutStatus->SetStringField(TEXT("state"), Job->bFinished ? TEXT("finished") : TEXT("running"));
+    OutStatus->SetNumberField(TEXT("elapsed_seconds"), (Job->bFinished ? Job->FinishTime : FPlatformTime::Seconds()) - Job->StartTime);
+    OutStatus->SetNumberField(TEXT("fonts_total"), FontsTotal);
+    OutStatus->SetNumberField(TEXT("fonts_completed"), Job->Results.Num());
+    OutStatus->SetNumberField(TEXT("fonts_preparing"), Job->Preparing.Num());
+    OutStatus->SetNumberField(TEXT("fonts_created"), Job->CreatedCount);
+    OutStatus->SetNumberField(TEXT("fonts_failed"), Job->FailedCount);
+    OutStatus->SetNumberField(TEXT("progress"), FontsTotal > 0 ? static_cast<double>(Job->Results.Num()) / FontsTotal : 1.0);
+    if (Job->bFinished && Job->bSave)
+    {
+        TArray<TSharedPtr<FJsonValue>> UnsavedArray;
+        for (const FString& PackageName : Job->UnsavedPackages)
+        {
+            UnsavedArray.Add(MakeShared<FJsonValueString>(PackageName));
+        }
+        OutStatus->SetArrayField(TEXT("unsaved_packages"), UnsavedArray);
+    }
+    OutStatus->SetArrayField(TEXT("results"), ResultsArray);
+    OutStatus->SetNumberField(TEXT("next_cursor"), Last);
+    OutStatus->SetBoolField(TEXT("has_more"), Last < Job->Results.Num() || !Job->bFinished);
+    return true;
+}
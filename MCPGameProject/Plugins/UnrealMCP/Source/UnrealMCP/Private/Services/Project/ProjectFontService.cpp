@@ -121,7 +121,7 @@ bool FProjectFontService::CreateFontFace(const FString& FontName, const FString&
     return true;
 }
 
-bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString& Path, const FString& TTFFilePath, const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutError)
+bool FProjectFontService::ReadFontFile(const FString& TTFFilePath, TArray<uint8>& OutFontData, FString& OutError)
 {
     // Validate the TTF file exists
     if (!FPaths::FileExists(TTFFilePath))
@@ -130,6 +130,56 @@ bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString&
         return false;
     }
 
+    // Read the TTF file into memory
+    if (!FFileHelper::LoadFileToArray(OutFontData, *TTFFilePath, FILEREAD_Silent))
+    {
+        OutError = FString::Printf(TEXT("Failed to read TTF file: %s"), *TTFFilePath);
+        return false;
+    }
+
+    // TrueType (0x00010000 or 'true'), OpenType CFF ('OTTO') or a font collection ('ttcf');
+    // anything else would only fail once Slate first renders with the font
+    const uint32 Signature = OutFontData.Num() >= 4
+        ? (uint32(OutFontData[0]) << 24) | (uint32(OutFontData[1]) << 16) | (uint32(OutFontData[2]) << 8) | uint32(OutFontData[3])
+        : 0;
+    if (Signature != 0x00010000 && Signature != 0x4F54544F && Signature != 0x74727565 && Signature != 0x74746366)
+    {
+        OutError = FString::Printf(TEXT("Not a TrueType or OpenType font file: %s"), *TTFFilePath);
+        OutFontData.Empty();
+        return false;
+    }
+
+    return true;
+}
+
+bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString& Path, const FString& TTFFilePath, const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutError)
+{
+    TArray<uint8> FontData;
+    if (!ReadFontFile(TTFFilePath, FontData, OutError))
+    {
+        return false;
+    }
+
+    FString FontFacePath;
+    TArray<UPackage*> Packages;
+    if (!CreateTTFFontAssets(FontName, Path, TTFFilePath, MoveTemp(FontData), FontMetrics, OutAssetPath, FontFacePath, Packages, OutError))
+    {
+        return false;
+    }
+
+    // Save the FontFace and the Font
+    UEditorAssetLibrary::SaveAsset(FontFacePath, false);
+    UEditorAssetLibrary::SaveAsset(OutAssetPath, false);
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Successfully imported TTF font '%s' from '%s' (FontFace: %s, Font: %s)"),
+        *FontName, *TTFFilePath, *FontFacePath, *OutAssetPath);
+
+    return true;
+}
+
+bool FProjectFontService::CreateTTFFontAssets(const FString& FontName, const FString& Path, const FString& TTFFilePath, TArray<uint8>&& FontData,
+    const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutFontFacePath, TArray<UPackage*>& OutPackages, FString& OutError)
+{
     // Ensure the output path exists
     if (!UEditorAssetLibrary::DoesDirectoryExist(Path))
     {
@@ -150,6 +200,7 @@ bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString&
     FString FontPackageName = PackagePath + AssetName;
     FString FontFacePackageName = PackagePath + AssetName + TEXT("_Face");
     OutAssetPath = FontPackageName;
+    OutFontFacePath = FontFacePackageName;
 
     // Check if the font already exists
     if (UEditorAssetLibrary::DoesAssetExist(FontPackageName))
@@ -158,14 +209,6 @@ bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString&
         return false;
     }
 
-    // Read the TTF file into memory
-    TArray<uint8> FontData;
-    if (!FFileHelper::LoadFileToArray(FontData, *TTFFilePath))
-    {
-        OutError = FString::Printf(TEXT("Failed to read TTF file: %s"), *TTFFilePath);
-        return false;
-    }
-
     // Step 1: Create the FontFace asset (holds the raw TTF data)
     UPackage* FontFacePackage = CreatePackage(*FontFacePackageName);
     if (!FontFacePackage)
@@ -211,11 +254,10 @@ bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString&
         }
     }
 
-    // Save the FontFace
     NewFontFace->MarkPackageDirty();
     FontFacePackage->MarkPackageDirty();
     FAssetRegistryModule::AssetCreated(NewFontFace);
-    UEditorAssetLibrary::SaveAsset(FontFacePackageName, false);
+    OutPackages.Add(FontFacePackage);
 
     // Step 2: Create the UFont (composite font) that UMG can use
     UPackage* FontPackage = CreatePackage(*FontPackageName);
@@ -246,14 +288,10 @@ bool FProjectFontService::ImportTTFFont(const FString& FontName, const FString&
     TypefaceEntry.Name = TEXT("Regular");
     TypefaceEntry.Font = FFontData(NewFontFace);
 
-    // Save the Font
     NewFont->MarkPackageDirty();
     FontPackage->MarkPackageDirty();
     FAssetRegistryModule::AssetCreated(NewFont);
-    UEditorAssetLibrary::SaveAsset(FontPackageName, false);
-
-    UE_LOG(LogTemp, Display, TEXT("MCP Project: Successfully imported TTF font '%s' from '%s' (FontFace: %s, Font: %s)"),
-        *FontName, *TTFFilePath, *FontFacePackageName, *OutAssetPath);
+    OutPackages.Add(FontPackage);
 
     return true;
 }
@@ -424,6 +462,32 @@ TSharedPtr<FJsonObject> FProjectFontService::GetFontFaceMetadata(const FString&
 }
 
 bool FProjectFontService::CreateOfflineFont(const FString& FontName, const FString& Path, const FString& TexturePath, const FString& MetricsFilePath, FString& OutAssetPath, FString& OutError)
+{
+    FOfflineGlyphTable GlyphTable;
+    if (!BuildOfflineGlyphTable(MetricsFilePath, GlyphTable, OutError))
+    {
+        return false;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Loaded metrics from file: %s"), *MetricsFilePath);
+
+    UPackage* Package = nullptr;
+    int32 CharacterCount = 0;
+    if (!CreateOfflineFontAsset(FontName, Path, TexturePath, MoveTemp(GlyphTable), OutAssetPath, Package, CharacterCount, OutError))
+    {
+        return false;
+    }
+
+    // Save the asset
+    UEditorAssetLibrary::SaveAsset(OutAssetPath, false);
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Successfully created offline font '%s' at '%s' with %d characters"),
+        *FontName, *OutAssetPath, CharacterCount);
+
+    return true;
+}
+
+bool FProjectFontService::BuildOfflineGlyphTable(const FString& MetricsFilePath, FOfflineGlyphTable& OutGlyphTable, FString& OutError)
 {
     // Load metrics JSON from file
     if (MetricsFilePath.IsEmpty())
@@ -456,8 +520,58 @@ bool FProjectFontService::CreateOfflineFont(const FString& FontName, const FStri
         return false;
     }
 
-    UE_LOG(LogTemp, Display, TEXT("MCP Project: Loaded metrics from file: %s"), *MetricsFilePath);
+    // Extract metrics from JSON
+    OutGlyphTable.AtlasWidth = MetricsJson->GetIntegerField(TEXT("atlasWidth"));
+    OutGlyphTable.AtlasHeight = MetricsJson->GetIntegerField(TEXT("atlasHeight"));
+    OutGlyphTable.LineHeight = MetricsJson->GetIntegerField(TEXT("lineHeight"));
+    OutGlyphTable.Baseline = MetricsJson->GetIntegerField(TEXT("baseline"));
+
+    // Process characters from JSON
+    const TSharedPtr<FJsonObject>* CharactersObj;
+    if (MetricsJson->TryGetObjectField(TEXT("characters"), CharactersObj))
+    {
+        OutGlyphTable.bHasCharacters = true;
+        OutGlyphTable.Characters.Reserve((*CharactersObj)->Values.Num());
+        OutGlyphTable.CharRemap.Reserve((*CharactersObj)->Values.Num());
+
+        for (const auto& CharPair : (*CharactersObj)->Values)
+        {
+            int32 CharCode = FCString::Atoi(*CharPair.Key);
+            const TSharedPtr<FJsonObject>& CharData = CharPair.Value->AsObject();
+
+            if (!CharData.IsValid())
+            {
+                continue;
+            }
+
+            // Get UV coordinates (normalized 0-1)
+            double U = CharData->GetNumberField(TEXT("u"));
+            double V = CharData->GetNumberField(TEXT("v"));
+            int32 Width = CharData->GetIntegerField(TEXT("width"));
+            int32 Height = CharData->GetIntegerField(TEXT("height"));
+            int32 YOffset = CharData->GetIntegerField(TEXT("yOffset"));
 
+            // Create the font character, converting normalized UVs to pixel coordinates
+            FFontCharacter FontChar;
+            FontChar.StartU = FMath::RoundToInt(U * OutGlyphTable.AtlasWidth);
+            FontChar.StartV = FMath::RoundToInt(V * OutGlyphTable.AtlasHeight);
+            FontChar.USize = Width;
+            FontChar.VSize = Height;
+            FontChar.TextureIndex = 0; // First (and only) texture
+            FontChar.VerticalOffset = YOffset;
+
+            // Add to characters array and remap table
+            int32 CharIndex = OutGlyphTable.Characters.Add(FontChar);
+            OutGlyphTable.CharRemap.Emplace(static_cast<uint16>(CharCode), static_cast<uint16>(CharIndex));
+        }
+    }
+
+    return true;
+}
+
+bool FProjectFontService::CreateOfflineFontAsset(const FString& FontName, const FString& Path, const FString& TexturePath, FOfflineGlyphTable&& GlyphTable,
+    FString& OutAssetPath, UPackage*& OutPackage, int32& OutCharacterCount, FString& OutError)
+{
     // Ensure the path exists
     if (!UEditorAssetLibrary::DoesDirectoryExist(Path))
     {
@@ -523,65 +637,24 @@ bool FProjectFontService::CreateOfflineFont(const FString& FontName, const FStri
     // Add the texture to the font
     NewFont->Textures.Add(FontTexture);
 
-    // Extract metrics from JSON
-    int32 AtlasWidth = MetricsJson->GetIntegerField(TEXT("atlasWidth"));
-    int32 AtlasHeight = MetricsJson->GetIntegerField(TEXT("atlasHeight"));
-    int32 LineHeight = MetricsJson->GetIntegerField(TEXT("lineHeight"));
-    int32 Baseline = MetricsJson->GetIntegerField(TEXT("baseline"));
-
     // Set font metrics
     NewFont->EmScale = 1.0f;
-    NewFont->Ascent = static_cast<float>(Baseline);
-    NewFont->Descent = static_cast<float>(LineHeight - Baseline);
+    NewFont->Ascent = static_cast<float>(GlyphTable.Baseline);
+    NewFont->Descent = static_cast<float>(GlyphTable.LineHeight - GlyphTable.Baseline);
     NewFont->Leading = 0.0f;
     NewFont->Kerning = 0;
     NewFont->ScalingFactor = 1.0f;
-    NewFont->LegacyFontSize = LineHeight;
+    NewFont->LegacyFontSize = GlyphTable.LineHeight;
 
-    // Process characters from JSON
-    const TSharedPtr<FJsonObject>* CharactersObj;
-    if (MetricsJson->TryGetObjectField(TEXT("characters"), CharactersObj))
+    // Characters and remap table were built from the metrics file
+    if (GlyphTable.bHasCharacters)
     {
-        TMap<FString, TSharedPtr<FJsonValue>> CharMap = (*CharactersObj)->Values;
-
-        // Initialize character remap
         NewFont->IsRemapped = 1;
-
-        for (const auto& CharPair : CharMap)
+        NewFont->Characters = MoveTemp(GlyphTable.Characters);
+        NewFont->CharRemap.Reserve(GlyphTable.CharRemap.Num());
+        for (const TPair<uint16, uint16>& Remap : GlyphTable.CharRemap)
         {
-            int32 CharCode = FCString::Atoi(*CharPair.Key);
-            const TSharedPtr<FJsonObject>& CharData = CharPair.Value->AsObject();
-
-            if (!CharData.IsValid())
-            {
-                continue;
-            }
-
-            // Get UV coordinates (normalized 0-1)
-            double U = CharData->GetNumberField(TEXT("u"));
-            double V = CharData->GetNumberField(TEXT("v"));
-            int32 Width = CharData->GetIntegerField(TEXT("width"));
-            int32 Height = CharData->GetIntegerField(TEXT("height"));
-            int32 YOffset = CharData->GetIntegerField(TEXT("yOffset"));
-
-            // Convert normalized UVs to pixel coordinates
-            int32 StartU = FMath::RoundToInt(U * AtlasWidth);
-            int32 StartV = FMath::RoundToInt(V * AtlasHeight);
-
-            // Create the font character
-            FFontCharacter FontChar;
-            FontChar.StartU = StartU;
-            FontChar.StartV = StartV;
-            FontChar.USize = Width;
-            FontChar.VSize = Height;
-            FontChar.TextureIndex = 0; // First (and only) texture
-            FontChar.VerticalOffset = YOffset;
-
-            // Add to characters array
-            int32 CharIndex = NewFont->Characters.Add(FontChar);
-
-            // Add to remap table
-            NewFont->CharRemap.Add(static_cast<uint16>(CharCode), static_cast<uint16>(CharIndex));
+            NewFont->CharRemap.Add(Remap.Key, Remap.Value);
         }
     }
 
@@ -595,12 +668,8 @@ bool FProjectFontService::CreateOfflineFont(const FString& FontName, const FStri
     // Notify asset registry
     FAssetRegistryModule::AssetCreated(NewFont);
 
-    // Save the asset
-    UEditorAssetLibrary::SaveAsset(PackageName, false);
-
-    UE_LOG(LogTemp, Display, TEXT("MCP Project: Successfully created offline font '%s' at '%s' with %d characters"),
-        *FontName, *OutAssetPath, NewFont->Characters.Num());
-
+    OutPackage = Package;
+    OutCharacterCount = NewFont->Characters.Num();
     return true;
 }
 
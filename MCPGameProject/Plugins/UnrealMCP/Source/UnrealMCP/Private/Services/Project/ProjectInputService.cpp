@@ -0,0 +1,294 @@
+#include "Services/Project/ProjectInputService.h"
+#include "EnhancedInput/Public/InputAction.h"
+#include "EnhancedInput/Public/InputMappingContext.h"
+#include "EnhancedInput/Public/InputModifiers.h"
+#include "EnhancedInput/Public/InputTriggers.h"
+#include "AssetToolsModule.h"
+#include "EditorAssetLibrary.h"
+#include "FileHelpers.h"
+#include "JsonObjectConverter.h"
+
+namespace
+{
+    /** Find an Enhanced Input class by its name with or without the prefix, or by class path */
+    UClass* FindInputClass(const FString& TypeName, const TCHAR* Prefix, UClass* BaseClass)
+    {
+        UClass* Class = nullptr;
+        if (TypeName.Contains(TEXT(".")))
+        {
+            Class = LoadObject<UClass>(nullptr, *TypeName);
+        }
+        else
+        {
+            Class = FindFirstObject<UClass>(*(Prefix + TypeName), EFindFirstObjectOptions::NativeFirst);
+            if (!Class)
+            {
+                Class = FindFirstObject<UClass>(*TypeName, EFindFirstObjectOptions::NativeFirst);
+            }
+        }
+        return Class && Class->IsChildOf(BaseClass) && !Class->HasAnyClassFlags(CLASS_Abstract) ? Class : nullptr;
+    }
+
+    template <typename InstanceType>
+    const TCHAR* GetInstancePrefix();
+
+    template <>
+    const TCHAR* GetInstancePrefix<UInputModifier>() { return TEXT("InputModifier"); }
+
+    template <>
+    const TCHAR* GetInstancePrefix<UInputTrigger>() { return TEXT("InputTrigger"); }
+
+    EInputActionValueType ParseValueType(const FString& ValueType)
+    {
+        if (ValueType.Equals(TEXT("Analog"), ESearchCase::IgnoreCase))
+        {
+            return EInputActionValueType::Axis1D;
+        }
+        if (ValueType.Equals(TEXT("Axis2D"), ESearchCase::IgnoreCase))
+        {
+            return EInputActionValueType::Axis2D;
+        }
+        if (ValueType.Equals(TEXT("Axis3D"), ESearchCase::IgnoreCase))
+        {
+            return EInputActionValueType::Axis3D;
+        }
+        // Digital and anything unknown, as create_enhanced_input_action does
+        return EInputActionValueType::Boolean;
+    }
+
+    /** @return The name with the prefix the single-asset commands give it */
+    FString WithPrefix(const FString& Name, const TCHAR* Prefix)
+    {
+        return Name.StartsWith(Prefix) ? Name : Prefix + Name;
+    }
+
+    TSharedPtr<FJsonObject> MakeAssetResult(const FString& Name, const FString& AssetPath)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("name"), Name);
+        Result->SetStringField(TEXT("asset_path"), AssetPath);
+        Result->SetBoolField(TEXT("created"), false);
+        return Result;
+    }
+
+    /** Create a new asset in a folder; nullptr and an error if it exists or cannot be created */
+    template <typename AssetType>
+    AssetType* CreateInputAsset(const FString& Name, const FString& Folder, FString& OutError)
+    {
+        if (!UEditorAssetLibrary::DoesDirectoryExist(Folder) && !UEditorAssetLibrary::MakeDirectory(Folder))
+        {
+            OutError = FString::Printf(TEXT("Failed to create directory: %s"), *Folder);
+            return nullptr;
+        }
+        if (UEditorAssetLibrary::DoesAssetExist(Folder / Name))
+        {
+            OutError = FString::Printf(TEXT("Asset already exists: %s"), *(Folder / Name));
+            return nullptr;
+        }
+
+        FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
+        AssetType* Asset = Cast<AssetType>(AssetToolsModule.Get().CreateAsset(Name, Folder, AssetType::StaticClass(), nullptr));
+        if (!Asset)
+        {
+            OutError = FString::Printf(TEXT("Failed to create %s asset"), *AssetType::StaticClass()->GetName());
+        }
+        return Asset;
+    }
+
+    /** Instance the modifiers or triggers a setup lists, as class names or {"type", "properties"} objects */
+    template <typename InstanceType>
+    bool CreateInstances(const TArray<TSharedPtr<FJsonValue>>& Specs, UObject* Outer, TArray<TObjectPtr<InstanceType>>& OutInstances, FString& OutError)
+    {
+        for (const TSharedPtr<FJsonValue>& Spec : Specs)
+        {
+            FString TypeName;
+            const TSharedPtr<FJsonObject>* SpecObj = nullptr;
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Spec.IsValid() && Spec->TryGetObject(SpecObj))
+            {
+                (*SpecObj)->TryGetStringField(TEXT("type"), TypeName);
+                (*SpecObj)->TryGetObjectField(TEXT("properties"), Properties);
+            }
+            else if (Spec.IsValid())
+            {
+                Spec->TryGetString(TypeName);
+            }
+
+            UClass* Class = FindInputClass(TypeName, GetInstancePrefix<InstanceType>(), InstanceType::StaticClass());
+            if (!Class)
+            {
+                OutError = FString::Printf(TEXT("Unknown %s '%s'"), GetInstancePrefix<InstanceType>(), *TypeName);
+                return false;
+            }
+
+            InstanceType* Instance = NewObject<InstanceType>(Outer, Class, NAME_None, RF_Transactional);
+            if (Properties && !FJsonObjectConverter::JsonObjectToUStruct((*Properties).ToSharedRef(), Class, Instance, 0, 0))
+            {
+                OutError = FString::Printf(TEXT("Failed to set the properties of %s '%s'"), GetInstancePrefix<InstanceType>(), *TypeName);
+                return false;
+            }
+            OutInstances.Add(Instance);
+        }
+        return true;
+    }
+}
+
+FProjectInputService& FProjectInputService::Get()
+{
+    static FProjectInputService Instance;
+    return Instance;
+}
+
+bool FProjectInputService::CreateInputSetup(const FInputSetupParams& Params, FInputSetupResult& OutResult, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (Params.Actions.Num() == 0 && Params.Contexts.Num() == 0)
+    {
+        OutError = TEXT("An input setup needs at least one action or context");
+        return false;
+    }
+
+    TArray<UPackage*> CreatedPackages;
+    // Actions of this setup by lowercase name, for the mappings to refer to
+    TMap<FString, UInputAction*> ActionsByName;
+
+    for (const FInputSetupAction& Spec : Params.Actions)
+    {
+        const FString Name = WithPrefix(Spec.Name, TEXT("IA_"));
+        FString Folder = Spec.Path.IsEmpty() ? Params.ActionPath : Spec.Path;
+        Folder.RemoveFromEnd(TEXT("/"));
+        TSharedPtr<FJsonObject> Result = MakeAssetResult(Name, Folder / Name);
+        OutResult.Actions.Add(Result);
+
+        FString Error;
+        UInputAction* Action = nullptr;
+        if (ActionsByName.Contains(Name.ToLower()))
+        {
+            Error = FString::Printf(TEXT("Action '%s' is named more than once"), *Name);
+        }
+        else
+        {
+            Action = CreateInputAsset<UInputAction>(Name, Folder, Error);
+        }
+        if (Action)
+        {
+            Action->ValueType = ParseValueType(Spec.ValueType);
+            if (!Spec.Description.IsEmpty())
+            {
+                Action->ActionDescription = FText::FromString(Spec.Description);
+            }
+            if (!CreateInstances(Spec.Modifiers, Action, Action->Modifiers, Error) || !CreateInstances(Spec.Triggers, Action, Action->Triggers, Error))
+            {
+                // The action exists now; keep it and report what was left out
+                Result->SetStringField(TEXT("warning"), Error);
+                Error.Reset();
+            }
+            Action->MarkPackageDirty();
+            CreatedPackages.Add(Action->GetPackage());
+            ActionsByName.Add(Name.ToLower(), Action);
+        }
+
+        if (!Error.IsEmpty())
+        {
+            Result->SetStringField(TEXT("error"), Error);
+            OutResult.FailedCount++;
+            continue;
+        }
+        Result->SetBoolField(TEXT("created"), true);
+        OutResult.CreatedCount++;
+    }
+
+    for (const FInputSetupContext& Spec : Params.Contexts)
+    {
+        const FString Name = WithPrefix(Spec.Name, TEXT("IMC_"));
+        FString Folder = Spec.Path.IsEmpty() ? Params.ContextPath : Spec.Path;
+        Folder.RemoveFromEnd(TEXT("/"));
+        TSharedPtr<FJsonObject> Result = MakeAssetResult(Name, Folder / Name);
+        OutResult.Contexts.Add(Result);
+
+        FString Error;
+        UInputMappingContext* Context = CreateInputAsset<UInputMappingContext>(Name, Folder, Error);
+        if (!Context)
+        {
+            Result->SetStringField(TEXT("error"), Error);
+            OutResult.FailedCount++;
+            continue;
+        }
+        if (!Spec.Description.IsEmpty())
+        {
+            Context->ContextDescription = FText::FromString(Spec.Description);
+        }
+
+        int32 MappingsAdded = 0;
+        TArray<TSharedPtr<FJsonValue>> MappingErrors;
+        for (int32 Index = 0; Index < Spec.Mappings.Num(); ++Index)
+        {
+            const FInputSetupMapping& Mapping = Spec.Mappings[Index];
+            FString MappingError;
+
+            UInputAction* Action = nullptr;
+            if (Mapping.Action.StartsWith(TEXT("/")))
+            {
+                Action = Cast<UInputAction>(UEditorAssetLibrary::LoadAsset(Mapping.Action));
+            }
+            else if (UInputAction** Found = ActionsByName.Find(WithPrefix(Mapping.Action, TEXT("IA_")).ToLower()))
+            {
+                Action = *Found;
+            }
+
+            const FKey Key(*Mapping.Key);
+            if (!Action)
+            {
+                MappingError = FString::Printf(TEXT("mappings[%d]: unknown action '%s'"), Index, *Mapping.Action);
+            }
+            else if (!Key.IsValid())
+            {
+                MappingError = FString::Printf(TEXT("mappings[%d]: invalid key '%s'"), Index, *Mapping.Key);
+            }
+            else
+            {
+                FEnhancedActionKeyMapping& NewMapping = Context->MapKey(Action, Key);
+                if (!CreateInstances(Mapping.Modifiers, Context, NewMapping.Modifiers, MappingError) || !CreateInstances(Mapping.Triggers, Context, NewMapping.Triggers, MappingError))
+                {
+                    MappingError = FString::Printf(TEXT("mappings[%d]: %s"), Index, *MappingError);
+                }
+                MappingsAdded++;
+            }
+
+            if (!MappingError.IsEmpty())
+            {
+                MappingErrors.Add(MakeShared<FJsonValueString>(MappingError));
+            }
+        }
+
+        Context->MarkPackageDirty();
+        CreatedPackages.Add(Context->GetPackage());
+        Result->SetBoolField(TEXT("created"), true);
+        Result->SetNumberField(TEXT("mappings_added"), MappingsAdded);
+        if (MappingErrors.Num() > 0)
+        {
+            Result->SetArrayField(TEXT("mapping_errors"), MappingErrors);
+        }
+        OutResult.CreatedCount++;
+        OutResult.MappingCount += MappingsAdded;
+    }
+
+    if (Params.bSave && CreatedPackages.Num() > 0)
+    {
+        UEditorLoadingAndSavingUtils::SavePackages(CreatedPackages, true);
+
+        // SavePackages reports only overall success; a package still dirty was not written
+        for (UPackage* Package : CreatedPackages)
+        {
+            if (Package->IsDirty())
+            {
+                OutResult.UnsavedPackages.Add(Package->GetName());
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Input setup created %d assets with %d mappings, %d failed"),
+        OutResult.CreatedCount, OutResult.MappingCount, OutResult.FailedCount);
+    return true;
+}
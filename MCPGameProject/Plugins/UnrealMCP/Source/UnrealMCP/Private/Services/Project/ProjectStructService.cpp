@@ -8,6 +8,38 @@
 #include "AssetToolsModule.h"
 #include "Factories/StructureFactory.h"
 #include "UserDefinedStructure/UserDefinedStructEditorData.h"
+#include "ScopedTransaction.h"
+
+namespace
+{
+    /**
+     * Property name for a struct member, in the form FStructureEditorUtils gives its members:
+     * "<DisplayName>_<unique id>_<guid>", with invalid characters replaced
+     */
+    FName MakeMemberVariableName(UUserDefinedStruct* Struct, const FString& DisplayName, const FGuid& Guid)
+    {
+        FString BaseName = DisplayName;
+        if (!FName::IsValidXName(BaseName, INVALID_OBJECTNAME_CHARACTERS))
+        {
+            BaseName = MakeObjectNameFromDisplayLabel(BaseName, NAME_None).GetPlainNameString();
+        }
+        if (BaseName.IsEmpty())
+        {
+            BaseName = TEXT("MemberVar");
+        }
+        const uint32 UniqueNameId = CastChecked<UUserDefinedStructEditorData>(Struct->EditorData)->GenerateUniqueNameIdForMemberVariable();
+        return FName(*FString::Printf(TEXT("%s_%u_%s"), *BaseName, UniqueNameId, *Guid.ToString(EGuidFormats::Digits)));
+    }
+
+    /** @return The index of the member with the display name, or INDEX_NONE */
+    int32 FindMemberByDisplayName(const TArray<FStructVariableDescription>& Members, const FString& DisplayName)
+    {
+        return Members.IndexOfByPredicate([&DisplayName](const FStructVariableDescription& Member)
+        {
+            return Member.FriendlyName.Equals(DisplayName, ESearchCase::IgnoreCase);
+        });
+    }
+}
 
 FProjectStructService& FProjectStructService::Get()
 {
@@ -346,6 +378,116 @@ bool FProjectStructService::UpdateStruct(const FString& StructName, const FStrin
     return true;
 }
 
+bool FProjectStructService::ApplyStructChanges(UUserDefinedStruct* Struct, const TArray<FSchemaChange>& Changes, TArray<FSchemaChangeResult>& OutResults, FString& OutError)
+{
+    OutResults.Reset(Changes.Num());
+    if (!Struct || !Struct->EditorData)
+    {
+        OutError = TEXT("Struct has no editor data");
+        return false;
+    }
+
+    // Every FStructureEditorUtils edit compiles the struct and updates its dependents; edit the
+    // member descriptions directly instead and announce the whole change once at the end
+    const FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "ApplyStructChanges", "Apply Struct Changes"));
+    FStructureEditorUtils::ModifyStructData(Struct);
+    TArray<FStructVariableDescription>& Members = CastChecked<UUserDefinedStructEditorData>(Struct->EditorData)->VariablesDescriptions;
+
+    int32 AppliedCount = 0;
+    for (const FSchemaChange& Change : Changes)
+    {
+        FSchemaChangeResult& Result = OutResults.AddDefaulted_GetRef();
+        Result.Operation = Change.Operation;
+        Result.Name = Change.Name;
+
+        const int32 MemberIndex = FindMemberByDisplayName(Members, Change.Name);
+        if (Change.Operation != TEXT("add") && MemberIndex == INDEX_NONE)
+        {
+            Result.Error = FString::Printf(TEXT("Struct has no member '%s'"), *Change.Name);
+            continue;
+        }
+
+        if (Change.Operation == TEXT("add") || Change.Operation == TEXT("set_type"))
+        {
+            FEdGraphPinType PinType;
+            if (!FPropertyTypeResolverService::Get().ResolvePropertyType(Change.Type, PinType))
+            {
+                Result.Error = FString::Printf(TEXT("Unknown member type '%s'"), *Change.Type);
+                continue;
+            }
+
+            if (Change.Operation == TEXT("add"))
+            {
+                if (MemberIndex != INDEX_NONE)
+                {
+                    Result.Error = FString::Printf(TEXT("Struct already has a member '%s'"), *Change.Name);
+                    continue;
+                }
+                FStructVariableDescription& Member = Members.AddDefaulted_GetRef();
+                Member.VarGuid = FGuid::NewGuid();
+                Member.VarName = MakeMemberVariableName(Struct, Change.Name, Member.VarGuid);
+                Member.FriendlyName = Change.Name;
+                Member.ToolTip = Change.Description;
+                Member.SetPinType(PinType);
+            }
+            else
+            {
+                // A new property name keeps data saved with the old type from loading into the new one
+                FStructVariableDescription& Member = Members[MemberIndex];
+                Member.VarName = MakeMemberVariableName(Struct, Member.FriendlyName, Member.VarGuid);
+                Member.SetPinType(PinType);
+                Member.DefaultValue.Empty();
+            }
+        }
+        else if (Change.Operation == TEXT("remove"))
+        {
+            if (Members.Num() <= 1)
+            {
+                Result.Error = TEXT("A struct keeps at least one member");
+                continue;
+            }
+            Members.RemoveAt(MemberIndex);
+        }
+        else if (Change.Operation == TEXT("rename"))
+        {
+            const int32 ExistingIndex = FindMemberByDisplayName(Members, Change.NewName);
+            if (Change.NewName.IsEmpty() || (ExistingIndex != INDEX_NONE && ExistingIndex != MemberIndex))
+            {
+                Result.Error = FString::Printf(TEXT("Cannot rename '%s' to '%s': the name is empty or taken"), *Change.Name, *Change.NewName);
+                continue;
+            }
+            FStructVariableDescription& Member = Members[MemberIndex];
+            Member.FriendlyName = Change.NewName;
+            Member.VarName = MakeMemberVariableName(Struct, Change.NewName, Member.VarGuid);
+        }
+        else if (Change.Operation == TEXT("set_description"))
+        {
+            Members[MemberIndex].ToolTip = Change.Description;
+        }
+        else
+        {
+            Result.Error = FString::Printf(TEXT("Unknown struct change '%s'"), *Change.Operation);
+            continue;
+        }
+
+        Result.bSuccess = true;
+        ++AppliedCount;
+    }
+
+    if (AppliedCount == 0)
+    {
+        OutError = TEXT("None of the changes could be applied");
+        return false;
+    }
+
+    // One compile; dependent Blueprints and DataTables are updated from here
+    FStructureEditorUtils::OnStructureChanged(Struct, FStructureEditorUtils::EStructureEditorChangeInfo::Unknown);
+    Struct->MarkPackageDirty();
+
+    UE_LOG(LogTemp, Display, TEXT("MCP Project: Applied %d of %d changes to struct '%s'"), AppliedCount, Changes.Num(), *Struct->GetName());
+    return true;
+}
+
 bool FProjectStructService::CreateStructProperty(UUserDefinedStruct* Struct, const TSharedPtr<FJsonObject>& PropertyObj) const
 {
     if (!Struct || !PropertyObj.IsValid())
@@ -2,6 +2,7 @@
 #include "Services/Project/ProjectStructService.h"
 #include "Services/Project/ProjectEnumService.h"
 #include "Services/Project/ProjectFontService.h"
+#include "Services/Project/ProjectInputService.h"
 #include "Services/Project/ProjectAssetOperations.h"
 #include "Services/Project/ProjectDataAssetService.h"
 #include "GameFramework/InputSettings.h"
@@ -9,6 +10,8 @@
 #include "HAL/PlatformFileManager.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/UserDefinedEnum.h"
+#include "Engine/UserDefinedStruct.h"
 
 FProjectService::FProjectService()
 {
@@ -279,6 +282,30 @@ bool FProjectService::UpdateEnum(const FString& EnumName, const FString& Path, c
     return FProjectEnumService::Get().UpdateEnum(EnumName, Path, Description, Values, ValueDescriptions, OutError);
 }
 
+// ============================================
+// Schema Changes - Delegate by asset type
+// ============================================
+
+bool FProjectService::ApplySchemaChanges(const FString& AssetPath, const TArray<FSchemaChange>& Changes, FString& OutAssetKind, TArray<FSchemaChangeResult>& OutResults, FString& OutError)
+{
+    UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
+    if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
+    {
+        OutAssetKind = TEXT("struct");
+        return FProjectStructService::Get().ApplyStructChanges(Struct, Changes, OutResults, OutError);
+    }
+    if (UUserDefinedEnum* Enum = Cast<UUserDefinedEnum>(Asset))
+    {
+        OutAssetKind = TEXT("enum");
+        return FProjectEnumService::Get().ApplyEnumChanges(Enum, Changes, OutResults, OutError);
+    }
+
+    OutError = Asset
+        ? FString::Printf(TEXT("'%s' is a %s, not a user-defined struct or enum"), *AssetPath, *Asset->GetClass()->GetName())
+        : FString::Printf(TEXT("Asset not found: %s"), *AssetPath);
+    return false;
+}
+
 // ============================================
 // Enhanced Input Operations - Placeholders
 // ============================================
@@ -323,6 +350,11 @@ TArray<TSharedPtr<FJsonObject>> FProjectService::ListInputMappingContexts(const
     return Contexts;
 }
 
+bool FProjectService::CreateInputSetup(const FInputSetupParams& Params, FInputSetupResult& OutResult, FString& OutError)
+{
+    return FProjectInputService::Get().CreateInputSetup(Params, OutResult, OutError);
+}
+
 // ============================================
 // Asset Operations - Delegate to ProjectAssetOperations
 // ============================================
@@ -352,6 +384,21 @@ TArray<TSharedPtr<FJsonObject>> FProjectService::SearchAssets(const FString& Pat
     return FProjectAssetOperations::Get().SearchAssets(Pattern, AssetClass, Folder, bOutSuccess, OutError);
 }
 
+bool FProjectService::RenameAssets(const TArray<FAssetBatchEntry>& Entries, bool bFixupRedirectors, TArray<FAssetBatchResult>& OutResults, int32& OutFixedRedirectors, FString& OutError)
+{
+    return FProjectAssetOperations::Get().RenameAssets(Entries, bFixupRedirectors, OutResults, OutFixedRedirectors, OutError);
+}
+
+bool FProjectService::DuplicateAssets(const TArray<FAssetBatchEntry>& Entries, TArray<FAssetBatchResult>& OutResults, FString& OutError)
+{
+    return FProjectAssetOperations::Get().DuplicateAssets(Entries, OutResults, OutError);
+}
+
+bool FProjectService::DeleteAssets(const TArray<FString>& AssetPaths, TArray<FAssetBatchResult>& OutResults, FString& OutError)
+{
+    return FProjectAssetOperations::Get().DeleteAssets(AssetPaths, OutResults, OutError);
+}
+
 // ============================================
 // Font Operations - Delegate to ProjectFontService
 // ============================================
@@ -386,6 +433,16 @@ TSharedPtr<FJsonObject> FProjectService::GetFontMetadata(const FString& FontPath
     return FProjectFontService::Get().GetFontMetadata(FontPath, OutError);
 }
 
+bool FProjectService::StartBulkFontImport(const FBulkFontImportParams& Params, int64& OutJobId, int32& OutFontCount, FString& OutError)
+{
+    return FProjectFontService::Get().StartBulkFontImport(Params, OutJobId, OutFontCount, OutError);
+}
+
+bool FProjectService::GetBulkFontImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    return FProjectFontService::Get().GetBulkFontImport(JobId, Cursor, MaxResults, OutStatus, OutError);
+}
+
 // ============================================
 // DataAsset Operations - Delegate to ProjectDataAssetService
 // ============================================
@@ -404,3 +461,8 @@ TSharedPtr<FJsonObject> FProjectService::GetDataAssetMetadata(const FString& Ass
 {
     return FProjectDataAssetService::Get().GetDataAssetMetadata(AssetPath, OutError);
 }
+
+bool FProjectService::CreateDataAssets(const FBulkDataAssetParams& Params, FBulkDataAssetResult& OutResult, FString& OutError)
+{
+    return FProjectDataAssetService::Get().CreateDataAssets(Params, OutResult, OutError);
+}
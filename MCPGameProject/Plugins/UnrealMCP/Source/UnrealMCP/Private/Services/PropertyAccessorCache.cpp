@@ -0,0 +1,429 @@
+#include "Services/PropertyAccessorCache.h"
+#include "Services/PropertyService.h"
+#include "Dom/JsonValue.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** Read an array of numbers of the given length range; false if any element is not a number */
+    bool ReadNumbers(const FJsonValue& Value, int32 MinCount, int32 MaxCount, double* OutNumbers, int32& OutCount)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Elements = nullptr;
+        if (!Value.TryGetArray(Elements) || Elements->Num() < MinCount || Elements->Num() > MaxCount)
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Elements->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonValue>& Element = (*Elements)[Index];
+            if (!Element.IsValid() || !Element->TryGetNumber(OutNumbers[Index]))
+            {
+                return false;
+            }
+        }
+        OutCount = Elements->Num();
+        return true;
+    }
+
+    /** Enum value named by a JSON string or number, as FPropertyService accepts it */
+    bool ReadEnumValue(const UEnum* Enum, const FJsonValue& Value, int64& OutValue, FString& OutError)
+    {
+        if (Value.Type == EJson::Number)
+        {
+            OutValue = static_cast<int64>(Value.AsNumber());
+            if (!Enum->IsValidEnumValue(OutValue))
+            {
+                OutError = FString::Printf(TEXT("Invalid enum numeric value %lld for enum '%s'"), OutValue, *Enum->GetName());
+                return false;
+            }
+            return true;
+        }
+
+        const FString ValueName = Value.AsString();
+        OutValue = Enum->GetValueByNameString(ValueName);
+        if (OutValue == INDEX_NONE)
+        {
+            OutValue = Enum->GetValueByNameString(FString::Printf(TEXT("%s::%s"), *Enum->GetName(), *ValueName));
+        }
+        if (OutValue == INDEX_NONE)
+        {
+            OutError = FString::Printf(TEXT("Invalid enum value '%s' for enum '%s'"), *ValueName, *Enum->GetName());
+            return false;
+        }
+        return true;
+    }
+}
+
+void* FPropertyAccessorCache::FAccessor::GetValuePtr(void* Container) const
+{
+    void* ValuePtr = Container;
+    for (const FProperty* Property : Chain)
+    {
+        ValuePtr = Property->ContainerPtrToValuePtr<void>(ValuePtr);
+    }
+    return ValuePtr;
+}
+
+FPropertyAccessorCache& FPropertyAccessorCache::Get()
+{
+    static FPropertyAccessorCache Instance;
+    return Instance;
+}
+
+void FPropertyAccessorCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FPropertyAccessorCache::HandleReloadComplete);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("property_accessor_cache"), TEXT("cache"), CacheCounters,
+        [this]()
+        {
+            int64 Count = 0;
+            for (const TPair<TWeakObjectPtr<const UStruct>, TMap<FName, TSharedRef<const FAccessor>>>& Entry : Accessors)
+            {
+                Count += Entry.Value.Num();
+            }
+            return Count;
+        });
+}
+
+void FPropertyAccessorCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ReloadCompleteHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("property_accessor_cache"));
+
+    Accessors.Empty();
+}
+
+TSharedRef<const FPropertyAccessorCache::FAccessor> FPropertyAccessorCache::Resolve(const UStruct* Owner, const FString& PropertyPath)
+{
+    // Without the reload handler a kept chain could outlive the properties it points to
+    if (!bInitialized || !IsInGameThread() || !Owner)
+    {
+        CacheCounters.RecordMiss();
+        TSharedRef<FAccessor> Uncached = MakeShared<FAccessor>();
+        ResolvePath(Owner, PropertyPath, *Uncached);
+        return Uncached;
+    }
+
+    const FName PathKey(*PropertyPath);
+    TMap<FName, TSharedRef<const FAccessor>>& OwnerAccessors = Accessors.FindOrAdd(Owner);
+    if (const TSharedRef<const FAccessor>* Cached = OwnerAccessors.Find(PathKey))
+    {
+        CacheCounters.RecordHit();
+        return *Cached;
+    }
+    CacheCounters.RecordMiss();
+
+    TSharedRef<FAccessor> Resolved = MakeShared<FAccessor>();
+    if (ResolvePath(Owner, PropertyPath, *Resolved))
+    {
+        OwnerAccessors.Add(PathKey, Resolved);
+    }
+    return Resolved;
+}
+
+bool FPropertyAccessorCache::SetValue(const FAccessor& Accessor, void* Container, UObject* Outer,
+                                      const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError)
+{
+    if (!Accessor.IsValid() || !Container)
+    {
+        OutError = Accessor.IsValid() ? TEXT("Invalid container") : Accessor.Error;
+        return false;
+    }
+    return ConvertValue(Accessor, Accessor.GetValuePtr(Container), Outer, PropertyValue, OutError);
+}
+
+bool FPropertyAccessorCache::ConvertValue(const FAccessor& Accessor, void* ValuePtr, UObject* Outer,
+                                          const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError)
+{
+    if (!Accessor.IsValid() || !ValuePtr || !PropertyValue.IsValid())
+    {
+        OutError = Accessor.IsValid() ? TEXT("Invalid value pointer or property value") : Accessor.Error;
+        return false;
+    }
+
+    FProperty* Property = Accessor.GetProperty();
+    bool bSet = false;
+    if (Accessor.FastSetter != EFastSetter::None
+        && TrySetFast(Accessor.FastSetter, Property, ValuePtr, *PropertyValue, bSet, OutError))
+    {
+        return bSet;
+    }
+    return FPropertyService::Get().SetResolvedProperty(Outer, Property, ValuePtr, PropertyValue, OutError);
+}
+
+bool FPropertyAccessorCache::SetPropertyByPath(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError)
+{
+    if (!Object || !PropertyValue.IsValid())
+    {
+        OutError = TEXT("Invalid object or property value");
+        return false;
+    }
+
+    const TSharedRef<const FAccessor> Accessor = Resolve(Object->GetClass(), PropertyPath);
+    if (!Accessor->IsValid())
+    {
+        OutError = FString::Printf(TEXT("%s on object '%s' (Class: %s)"), *Accessor->Error, *Object->GetName(), *Object->GetClass()->GetName());
+        return false;
+    }
+    return SetValue(*Accessor, Object, Object, PropertyValue, OutError);
+}
+
+bool FPropertyAccessorCache::ResolvePath(const UStruct* Owner, const FString& PropertyPath, FAccessor& OutAccessor)
+{
+    TArray<FString> Segments;
+    PropertyPath.ParseIntoArray(Segments, TEXT("."));
+
+    bool bNative = true;
+    for (int32 Index = 0; Index < Segments.Num(); ++Index)
+    {
+        FProperty* Property = Owner ? FindFProperty<FProperty>(Owner, *Segments[Index]) : nullptr;
+        if (!Property)
+        {
+            OutAccessor.Chain.Reset();
+            OutAccessor.Error = Index == 0
+                ? FString::Printf(TEXT("Property '%s' not found"), *PropertyPath)
+                : FString::Printf(TEXT("Property '%s' of path '%s' not found"), *Segments[Index], *PropertyPath);
+            // A blueprint compile may add the property later
+            return bNative && Owner && Owner->IsNative();
+        }
+
+        bNative &= Property->GetOwnerStruct() && Property->GetOwnerStruct()->IsNative();
+        OutAccessor.Chain.Add(Property);
+
+        // Every segment but the last steps into a struct member
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        Owner = StructProperty ? StructProperty->Struct : nullptr;
+        if (!Owner && Index + 1 < Segments.Num())
+        {
+            OutAccessor.Chain.Reset();
+            OutAccessor.Error = FString::Printf(TEXT("Property '%s' of path '%s' is not a struct"), *Segments[Index], *PropertyPath);
+            return bNative;
+        }
+    }
+
+    if (OutAccessor.Chain.Num() == 0)
+    {
+        OutAccessor.Error = FString::Printf(TEXT("Invalid property path '%s'"), *PropertyPath);
+        return bNative;
+    }
+
+    OutAccessor.FastSetter = PickFastSetter(OutAccessor.GetProperty());
+    return bNative;
+}
+
+FPropertyAccessorCache::EFastSetter FPropertyAccessorCache::PickFastSetter(const FProperty* Property)
+{
+    // A C-style array property holds several values at the pointer
+    if (Property->ArrayDim != 1)
+    {
+        return EFastSetter::None;
+    }
+
+    if (Property->IsA<FBoolProperty>())
+    {
+        return EFastSetter::Bool;
+    }
+    if (Property->IsA<FFloatProperty>())
+    {
+        return EFastSetter::Float;
+    }
+    if (Property->IsA<FDoubleProperty>())
+    {
+        return EFastSetter::Double;
+    }
+    if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        return ByteProperty->Enum ? EFastSetter::ByteEnum : EFastSetter::Integer;
+    }
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        return EnumProperty->GetEnum() ? EFastSetter::Enum : EFastSetter::None;
+    }
+    if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+    {
+        return NumericProperty->IsInteger() ? EFastSetter::Integer : EFastSetter::None;
+    }
+    if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+        {
+            return EFastSetter::Vector;
+        }
+        if (StructProperty->Struct == TBaseStructure<FRotator>::Get())
+        {
+            return EFastSetter::Rotator;
+        }
+        if (StructProperty->Struct == TBaseStructure<FLinearColor>::Get())
+        {
+            return EFastSetter::LinearColor;
+        }
+        if (StructProperty->Struct == TBaseStructure<FColor>::Get())
+        {
+            return EFastSetter::Color;
+        }
+        return EFastSetter::None;
+    }
+
+    // Instanced references create subobjects and class references resolve blueprints;
+    // both keep their reflection-based handling
+    const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+    if (ObjectProperty && !ObjectProperty->IsA<FClassProperty>()
+        && !ObjectProperty->HasAnyPropertyFlags(CPF_InstancedReference | CPF_PersistentInstance))
+    {
+        return EFastSetter::Object;
+    }
+    return EFastSetter::None;
+}
+
+bool FPropertyAccessorCache::TrySetFast(EFastSetter FastSetter, FProperty* Property, void* ValuePtr,
+                                        const FJsonValue& PropertyValue, bool& bOutSet, FString& OutError)
+{
+    double Numbers[4];
+    int32 Count = 0;
+    bOutSet = true;
+
+    switch (FastSetter)
+    {
+    case EFastSetter::Bool:
+        if (PropertyValue.Type == EJson::Boolean)
+        {
+            CastFieldChecked<FBoolProperty>(Property)->SetPropertyValue(ValuePtr, PropertyValue.AsBool());
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Float:
+    case EFastSetter::Double:
+        if (PropertyValue.Type == EJson::Number)
+        {
+            CastFieldChecked<FNumericProperty>(Property)->SetFloatingPointPropertyValue(ValuePtr, PropertyValue.AsNumber());
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Integer:
+        if (PropertyValue.Type == EJson::Number)
+        {
+            CastFieldChecked<FNumericProperty>(Property)->SetIntPropertyValue(ValuePtr, static_cast<int64>(PropertyValue.AsNumber()));
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Enum:
+    case EFastSetter::ByteEnum:
+    {
+        if (PropertyValue.Type != EJson::Number && PropertyValue.Type != EJson::String)
+        {
+            return false;
+        }
+
+        const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property);
+        const UEnum* Enum = EnumProperty ? EnumProperty->GetEnum() : CastFieldChecked<FByteProperty>(Property)->Enum;
+        int64 EnumValue = 0;
+        if (!ReadEnumValue(Enum, PropertyValue, EnumValue, OutError))
+        {
+            bOutSet = false;
+            return true;
+        }
+
+        if (EnumProperty)
+        {
+            EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(ValuePtr, EnumValue);
+        }
+        else
+        {
+            CastFieldChecked<FByteProperty>(Property)->SetPropertyValue(ValuePtr, static_cast<uint8>(EnumValue));
+        }
+        return true;
+    }
+
+    case EFastSetter::Vector:
+        if (ReadNumbers(PropertyValue, 3, 3, Numbers, Count))
+        {
+            *static_cast<FVector*>(ValuePtr) = FVector(Numbers[0], Numbers[1], Numbers[2]);
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Rotator:
+        // [Pitch, Yaw, Roll], the order GetObjectProperty reports
+        if (ReadNumbers(PropertyValue, 3, 3, Numbers, Count))
+        {
+            *static_cast<FRotator*>(ValuePtr) = FRotator(Numbers[0], Numbers[1], Numbers[2]);
+            return true;
+        }
+        return false;
+
+    case EFastSetter::LinearColor:
+        if (ReadNumbers(PropertyValue, 3, 4, Numbers, Count))
+        {
+            *static_cast<FLinearColor*>(ValuePtr) = FLinearColor(Numbers[0], Numbers[1], Numbers[2], Count == 4 ? Numbers[3] : 1.0);
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Color:
+        if (ReadNumbers(PropertyValue, 3, 4, Numbers, Count))
+        {
+            const auto ToChannel = [](double Channel) { return static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Channel), 0, 255)); };
+            *static_cast<FColor*>(ValuePtr) = FColor(ToChannel(Numbers[0]), ToChannel(Numbers[1]), ToChannel(Numbers[2]),
+                                                     Count == 4 ? ToChannel(Numbers[3]) : 255);
+            return true;
+        }
+        return false;
+
+    case EFastSetter::Object:
+    {
+        // Quoted export text such as "StaticMesh'/Game/Cube.Cube'" is left to ImportText
+        FString ObjectPath;
+        if (!PropertyValue.TryGetString(ObjectPath) || ObjectPath.Contains(TEXT("'")))
+        {
+            return false;
+        }
+
+        FObjectProperty* ObjectProperty = CastFieldChecked<FObjectProperty>(Property);
+        if (ObjectPath.IsEmpty() || ObjectPath == TEXT("None"))
+        {
+            ObjectProperty->SetObjectPropertyValue(ValuePtr, nullptr);
+            return true;
+        }
+
+        UObject* Value = StaticLoadObject(ObjectProperty->PropertyClass, nullptr, *ObjectPath);
+        if (!Value)
+        {
+            OutError = FString::Printf(TEXT("Could not load %s from path: %s"), *ObjectProperty->PropertyClass->GetName(), *ObjectPath);
+            bOutSet = false;
+            return true;
+        }
+        ObjectProperty->SetObjectPropertyValue(ValuePtr, Value);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+void FPropertyAccessorCache::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code replaces classes and the properties they declare
+    Accessors.Empty();
+    CacheCounters.RecordInvalidation();
+}
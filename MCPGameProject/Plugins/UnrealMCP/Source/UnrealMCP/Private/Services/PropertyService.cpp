@@ -1,4 +1,5 @@
 #include "Services/PropertyService.h"
+#include "Services/PropertyAccessorCache.h"
 #include "UObject/Field.h"
 #include "Components/PrimitiveComponent.h"
 #include "Engine/Engine.h"
@@ -32,20 +33,8 @@ bool FPropertyService::SetObjectProperty(UObject* Object, const FString& Propert
         return true;
     }
     
-    // Find the property
-    FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), *PropertyName);
-    if (!Property)
-    {
-        OutError = FString::Printf(TEXT("Property '%s' not found on object '%s' (Class: %s)"), 
-                                  *PropertyName, *Object->GetName(), *Object->GetClass()->GetName());
-        return false;
-    }
-    
-    // Get property data pointer
-    void* PropertyData = Property->ContainerPtrToValuePtr<void>(Object);
-
-    // Set the property value, passing Object as the outer for instanced subobjects
-    return SetPropertyFromJson(Property, PropertyData, PropertyValue, OutError, Object);
+    // Resolve the name or struct member path once per class, passing Object as the outer for instanced subobjects
+    return FPropertyAccessorCache::Get().SetPropertyByPath(Object, PropertyName, PropertyValue, OutError);
 }
 
 bool FPropertyService::SetObjectProperties(UObject* Object, const TSharedPtr<FJsonObject>& Properties,
@@ -90,20 +79,18 @@ bool FPropertyService::GetObjectProperty(UObject* Object, const FString& Propert
         return false;
     }
     
-    // Find the property
-    FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), *PropertyName);
-    if (!Property)
+    // Find the property by name or struct member path
+    const TSharedRef<const FPropertyAccessorCache::FAccessor> Accessor =
+        FPropertyAccessorCache::Get().Resolve(Object->GetClass(), PropertyName);
+    if (!Accessor->IsValid())
     {
-        OutError = FString::Printf(TEXT("Property '%s' not found on object '%s' (Class: %s)"), 
-                                  *PropertyName, *Object->GetName(), *Object->GetClass()->GetName());
+        OutError = FString::Printf(TEXT("%s on object '%s' (Class: %s)"), 
+                                  *Accessor->Error, *Object->GetName(), *Object->GetClass()->GetName());
         return false;
     }
     
-    // Get property data pointer
-    const void* PropertyData = Property->ContainerPtrToValuePtr<void>(Object);
-    
     // Get the property value as JSON
-    return GetPropertyAsJson(Property, PropertyData, OutValue, OutError);
+    return GetPropertyAsJson(Accessor->GetProperty(), Accessor->GetValuePtr(Object), OutValue, OutError);
 }
 
 bool FPropertyService::HasProperty(UObject* Object, const FString& PropertyName)
@@ -113,8 +100,7 @@ bool FPropertyService::HasProperty(UObject* Object, const FString& PropertyName)
         return false;
     }
     
-    FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), *PropertyName);
-    return Property != nullptr;
+    return FPropertyAccessorCache::Get().Resolve(Object->GetClass(), PropertyName)->IsValid();
 }
 
 TArray<FString> FPropertyService::GetObjectPropertyNames(UObject* Object)
@@ -139,6 +125,12 @@ TArray<FString> FPropertyService::GetObjectPropertyNames(UObject* Object)
     return PropertyNames;
 }
 
+bool FPropertyService::SetResolvedProperty(UObject* Object, FProperty* Property, void* PropertyData,
+                                           const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) const
+{
+    return SetPropertyFromJson(Property, PropertyData, PropertyValue, OutError, Object);
+}
+
 bool FPropertyService::SetPropertyFromJson(FProperty* Property, void* PropertyData,
                                           const TSharedPtr<FJsonValue>& JsonValue, FString& OutError,
                                           UObject* Outer) const
@@ -736,18 +728,17 @@ bool FPropertyService::SetStructPropertyFromJson(FStructProperty* StructProp, vo
                 }
 
                 // Find the property on the target struct
-                FProperty* StructField = FindFProperty<FProperty>(TargetStruct, *FieldPair.Key);
-                if (!StructField)
+                const TSharedRef<const FPropertyAccessorCache::FAccessor> StructField =
+                    FPropertyAccessorCache::Get().Resolve(TargetStruct, FieldPair.Key);
+                if (!StructField->IsValid())
                 {
                     UE_LOG(LogTemp, Warning, TEXT("FInstancedStruct: Field '%s' not found on struct '%s', skipping"),
                            *FieldPair.Key, *TargetStruct->GetName());
                     continue;
                 }
 
-                void* FieldData = StructField->ContainerPtrToValuePtr<void>(StructData);
                 FString FieldError;
-
-                if (!SetPropertyFromJson(StructField, FieldData, FieldPair.Value, FieldError))
+                if (!FPropertyAccessorCache::SetValue(*StructField, StructData, nullptr, FieldPair.Value, FieldError))
                 {
                     OutError = FString::Printf(TEXT("Failed to set FInstancedStruct field '%s': %s"), *FieldPair.Key, *FieldError);
                     return false;
@@ -766,22 +757,21 @@ bool FPropertyService::SetStructPropertyFromJson(FStructProperty* StructProp, vo
     {
         TSharedPtr<FJsonObject> StructJson = JsonValue->AsObject();
         
-        // Iterate through all fields of the struct and set them
-        for (TFieldIterator<FProperty> It(Struct); It; ++It)
+        // Set the fields the JSON names; names that are not fields of the struct are ignored
+        for (const auto& FieldPair : StructJson->Values)
         {
-            FProperty* StructField = *It;
-            FString FieldName = StructField->GetName();
+            const TSharedRef<const FPropertyAccessorCache::FAccessor> StructField =
+                FPropertyAccessorCache::Get().Resolve(Struct, FieldPair.Key);
+            if (!StructField->IsValid())
+            {
+                continue;
+            }
             
-            if (StructJson->HasField(FieldName))
+            FString FieldError;
+            if (!FPropertyAccessorCache::SetValue(*StructField, PropertyData, nullptr, FieldPair.Value, FieldError))
             {
-                void* FieldData = StructField->ContainerPtrToValuePtr<void>(PropertyData);
-                FString FieldError;
-                
-                if (!SetPropertyFromJson(StructField, FieldData, StructJson->Values[FieldName], FieldError))
-                {
-                    OutError = FString::Printf(TEXT("Failed to set struct field '%s': %s"), *FieldName, *FieldError);
-                    return false;
-                }
+                OutError = FString::Printf(TEXT("Failed to set struct field '%s': %s"), *FieldPair.Key, *FieldError);
+                return false;
             }
         }
         
@@ -0,0 +1,118 @@
+// PropertyServiceBulkOps.cpp
+// Setting one property on many objects for FPropertyService
+// This file is part of the PropertyService implementation
+
+#include "Services/PropertyService.h"
+#include "Services/PropertyAccessorCache.h"
+#include "UObject/UnrealType.h"
+
+int32 FPropertyService::SetPropertyOnObjects(const TArray<UObject*>& Objects, const FString& PropertyPath,
+                                             const TSharedPtr<FJsonValue>& PropertyValue, TArray<FString>& OutErrors)
+{
+    OutErrors.Reset();
+    OutErrors.SetNum(Objects.Num());
+
+    if (!PropertyValue.IsValid())
+    {
+        for (FString& Error : OutErrors)
+        {
+            Error = TEXT("Invalid property value");
+        }
+        return 0;
+    }
+
+    // Group by class so each class resolves the path and converts the value once
+    TMap<UClass*, TArray<int32>> ClassGroups;
+    for (int32 Index = 0; Index < Objects.Num(); ++Index)
+    {
+        if (Objects[Index])
+        {
+            ClassGroups.FindOrAdd(Objects[Index]->GetClass()).Add(Index);
+        }
+        else
+        {
+            OutErrors[Index] = TEXT("Invalid object");
+        }
+    }
+
+    int32 SetCount = 0;
+    for (const TPair<UClass*, TArray<int32>>& Group : ClassGroups)
+    {
+        const TSharedRef<const FPropertyAccessorCache::FAccessor> Accessor =
+            FPropertyAccessorCache::Get().Resolve(Group.Key, PropertyPath);
+        if (!Accessor->IsValid())
+        {
+            for (int32 Index : Group.Value)
+            {
+                if (SetObjectProperty(Objects[Index], PropertyPath, PropertyValue, OutErrors[Index]))
+                {
+                    OutErrors[Index].Reset();
+                    ++SetCount;
+                }
+            }
+            continue;
+        }
+
+        FProperty* Property = Accessor->GetProperty();
+        FProperty* MemberProperty = Accessor->Chain[0];
+
+        // A JSON object may name only some fields, which keep each object's own value for the rest,
+        // and instanced subobjects must be created with each object as their outer
+        const bool bConvertOnce = PropertyValue->Type != EJson::Object && !Property->ContainsInstancedObjectProperty();
+
+        void* ConvertedValue = nullptr;
+        FString ConvertError;
+        if (bConvertOnce)
+        {
+            ConvertedValue = FMemory::Malloc(Property->GetSize(), Property->GetMinAlignment());
+            Property->InitializeValue(ConvertedValue);
+            if (!FPropertyAccessorCache::ConvertValue(*Accessor, ConvertedValue, nullptr, PropertyValue, ConvertError))
+            {
+                Property->DestroyValue(ConvertedValue);
+                FMemory::Free(ConvertedValue);
+                for (int32 Index : Group.Value)
+                {
+                    OutErrors[Index] = ConvertError;
+                }
+                continue;
+            }
+        }
+
+        TArray<const UObject*> EditedObjects;
+        EditedObjects.Reserve(Group.Value.Num());
+        for (int32 Index : Group.Value)
+        {
+            UObject* Object = Objects[Index];
+            Object->Modify();
+            Object->PreEditChange(MemberProperty);
+            EditedObjects.Add(Object);
+
+            if (ConvertedValue)
+            {
+                Property->CopyCompleteValue(Accessor->GetValuePtr(Object), ConvertedValue);
+                ++SetCount;
+            }
+            else if (FPropertyAccessorCache::SetValue(*Accessor, Object, Object, PropertyValue, OutErrors[Index]))
+            {
+                ++SetCount;
+            }
+        }
+
+        if (ConvertedValue)
+        {
+            Property->DestroyValue(ConvertedValue);
+            FMemory::Free(ConvertedValue);
+        }
+
+        // One event for the group, as the details panel sends when editing a multi-selection
+        FPropertyChangedEvent ChangedEvent(Property, EPropertyChangeType::ValueSet, EditedObjects);
+        ChangedEvent.SetActiveMemberProperty(MemberProperty);
+        for (int32 ObjectIndex = 0; ObjectIndex < Group.Value.Num(); ++ObjectIndex)
+        {
+            ChangedEvent.ObjectIteratorIndex = ObjectIndex;
+            Objects[Group.Value[ObjectIndex]]->PostEditChangeProperty(ChangedEvent);
+        }
+    }
+
+    return SetCount;
+}
@@ -0,0 +1,194 @@
+#include "Services/ReflectionTypeIndex.h"
+#include "Services/NodeCreation/NodeCreationHelpers.h"
+#include "MCPLogging.h"
+#include "UObject/Class.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UnrealType.h"
+
+FReflectionTypeIndex& FReflectionTypeIndex::Get()
+{
+    static FReflectionTypeIndex Instance;
+    return Instance;
+}
+
+void FReflectionTypeIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (ModulesChangedHandle.IsValid())
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FReflectionTypeIndex::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FReflectionTypeIndex::HandleReloadComplete);
+    FMCPCacheStatsRegistry::Get().Register(TEXT("reflection_type_index"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(StructsByBase.Num() + PropertiesByName.Num()); });
+}
+
+void FReflectionTypeIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (ModulesChangedHandle.IsValid())
+    {
+        FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+        FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+        ModulesChangedHandle.Reset();
+        ReloadCompleteHandle.Reset();
+        FMCPCacheStatsRegistry::Get().Unregister(TEXT("reflection_type_index"));
+    }
+    Invalidate();
+}
+
+const TArray<UScriptStruct*>& FReflectionTypeIndex::GetDerivedStructs(const UScriptStruct* BaseStruct)
+{
+    static const TArray<UScriptStruct*> Empty;
+    EnsureBuilt();
+    const TArray<UScriptStruct*>* Structs = BaseStruct ? StructsByBase.Find(BaseStruct) : nullptr;
+    return Structs ? *Structs : Empty;
+}
+
+const TArray<FProperty*>& FReflectionTypeIndex::FindBlueprintProperties(const FString& Name)
+{
+    static const TArray<FProperty*> Empty;
+    EnsureBuilt();
+    const TArray<FProperty*>* Properties = PropertiesByName.Find(Name.ToLower());
+    return Properties ? *Properties : Empty;
+}
+
+void FReflectionTypeIndex::EnsureBuilt()
+{
+    check(IsInGameThread());
+    if (bBuilt)
+    {
+        CacheCounters.RecordHit();
+        return;
+    }
+    CacheCounters.RecordMiss();
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (TObjectIterator<UScriptStruct> It; It; ++It)
+    {
+        AddStruct(*It);
+    }
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        AddClass(*It);
+    }
+    bBuilt = true;
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("Reflection type index: %d base structs, %d property names in %.1f ms"),
+        StructsByBase.Num(), PropertiesByName.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FReflectionTypeIndex::AddPackage(UPackage* Package)
+{
+    ForEachObjectWithPackage(Package, [this](UObject* Object)
+    {
+        if (UScriptStruct* Struct = Cast<UScriptStruct>(Object))
+        {
+            AddStruct(Struct);
+        }
+        else if (UClass* Class = Cast<UClass>(Object))
+        {
+            AddClass(Class);
+        }
+        return true;
+    }, false);
+}
+
+void FReflectionTypeIndex::AddStruct(UScriptStruct* Struct)
+{
+    // Non-native structs may be garbage collected; nothing would take them out again
+    if (!Struct || !Struct->IsNative())
+    {
+        return;
+    }
+
+    for (const UStruct* Super = Struct->GetSuperStruct(); Super; Super = Super->GetSuperStruct())
+    {
+        if (const UScriptStruct* SuperStruct = Cast<UScriptStruct>(Super))
+        {
+            StructsByBase.FindOrAdd(SuperStruct).Add(Struct);
+        }
+    }
+}
+
+void FReflectionTypeIndex::AddClass(UClass* Class)
+{
+    if (!Class || !Class->HasAnyClassFlags(CLASS_Native) || Class->HasAnyClassFlags(CLASS_Deprecated | CLASS_NewerVersionExists))
+    {
+        return;
+    }
+
+    // Only the properties a class declares; subclasses are found through the class tree
+    for (TFieldIterator<FProperty> PropIt(Class, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+    {
+        FProperty* Property = *PropIt;
+        if (!Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+        {
+            continue;
+        }
+
+        const FString PropName = Property->GetName();
+        TArray<FString, TInlineAllocator<3>> Names;
+        Names.Add(PropName.ToLower());
+
+        // Leading 'b' followed by an uppercase character is the UE bool convention
+        if (PropName.StartsWith(TEXT("b")) && PropName.Len() > 1 && FChar::IsUpper(PropName[1]))
+        {
+            Names.AddUnique(PropName.Mid(1).ToLower());
+        }
+
+        FString DisplayName = Property->GetMetaData(TEXT("DisplayName"));
+        if (DisplayName.IsEmpty())
+        {
+            DisplayName = NodeCreationHelpers::ConvertPropertyNameToDisplay(PropName);
+        }
+        Names.AddUnique(DisplayName.Replace(TEXT(" "), TEXT("")).ToLower());
+
+        for (const FString& Name : Names)
+        {
+            PropertiesByName.FindOrAdd(Name).Add(Property);
+        }
+    }
+}
+
+void FReflectionTypeIndex::Invalidate()
+{
+    if (bBuilt)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    StructsByBase.Empty();
+    PropertiesByName.Empty();
+    bBuilt = false;
+}
+
+void FReflectionTypeIndex::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    if (!bBuilt)
+    {
+        return;
+    }
+
+    if (Reason == EModuleChangeReason::ModuleLoaded)
+    {
+        // A module's native types live in its /Script package and are registered before it is reported loaded
+        if (UPackage* Package = FindPackage(nullptr, *(TEXT("/Script/") + ModuleName.ToString())))
+        {
+            AddPackage(Package);
+        }
+    }
+    else if (Reason == EModuleChangeReason::ModuleUnloaded)
+    {
+        Invalidate();
+    }
+}
+
+void FReflectionTypeIndex::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code replaces classes, structs and properties
+    Invalidate();
+}
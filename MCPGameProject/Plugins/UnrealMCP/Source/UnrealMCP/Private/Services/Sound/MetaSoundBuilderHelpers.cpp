@@ -0,0 +1,308 @@
+// MetaSoundBuilderHelpers.cpp - Builder-level MetaSound edits shared by the FSoundService commands
+
+#include "Services/Sound/MetaSoundBuilderHelpers.h"
+#include "Services/SoundService.h"
+#include "MetasoundSource.h"
+#include "MetasoundBuilderSubsystem.h"
+#include "MetasoundBuilderBase.h"
+#include "MetasoundFrontendDocumentBuilder.h"
+#include "MetasoundAssetManager.h"
+#include "MetasoundAssetBase.h"
+#include "MetasoundUObjectRegistry.h"
+#include "MetasoundDocumentBuilderRegistry.h"
+#include "NodeTemplates/MetasoundFrontendNodeTemplateInput.h"
+#include "Dom/JsonValue.h"
+
+namespace MetaSoundBuilderHelpers
+{
+    FName ResolveMetaSoundDataType(const FString& DataType)
+    {
+        if (DataType.Equals(TEXT("Int"), ESearchCase::IgnoreCase))
+        {
+            return FName(TEXT("Int32"));
+        }
+        if (DataType.Equals(TEXT("Boolean"), ESearchCase::IgnoreCase))
+        {
+            return FName(TEXT("Bool"));
+        }
+        for (const TCHAR* KnownType : { TEXT("Float"), TEXT("Int32"), TEXT("Bool"), TEXT("Trigger"), TEXT("Audio"), TEXT("String") })
+        {
+            if (DataType.Equals(KnownType, ESearchCase::IgnoreCase))
+            {
+                return FName(KnownType);
+            }
+        }
+        return FName(*DataType);
+    }
+
+    bool RegisterMetaSoundForExecution(UMetaSoundSource& MetaSound, FString& OutError)
+    {
+        FMetasoundAssetBase* AssetBase = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(&MetaSound);
+        if (!AssetBase)
+        {
+            OutError = TEXT("Failed to get MetaSound asset base");
+            return false;
+        }
+
+        Metasound::Frontend::FMetaSoundAssetRegistrationOptions RegOptions;
+        RegOptions.bForceReregister = true;
+        AssetBase->UpdateAndRegisterForExecution(RegOptions);
+        return true;
+    }
+
+#if WITH_EDITORONLY_DATA
+    void MarkMetaSoundNodeModified(UMetaSoundSource& MetaSound, const FGuid& NodeId)
+    {
+        if (FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(&MetaSound))
+        {
+            MetaSoundAsset->GetModifyContext().AddNodeIDModified(NodeId);
+        }
+    }
+
+    bool AddNodeWithBuilder(UMetaSoundSource& MetaSound, UMetaSoundSourceBuilder& Builder, const FMetaSoundNodeParams& Params, FGuid& OutNodeId, FString& OutError)
+    {
+        // Create the class name from namespace, name, and variant
+        FMetasoundFrontendClassName ClassName;
+        ClassName.Namespace = FName(*Params.NodeNamespace);
+        ClassName.Name = FName(*Params.NodeClassName);
+        if (!Params.NodeVariant.IsEmpty())
+        {
+            ClassName.Variant = FName(*Params.NodeVariant);
+        }
+
+        UE_LOG(LogSoundService, Log, TEXT("Adding node: Namespace='%s', Name='%s', Variant='%s'"),
+            *ClassName.Namespace.ToString(), *ClassName.Name.ToString(), *ClassName.Variant.ToString());
+
+        // Add the node using the builder
+        EMetaSoundBuilderResult Result;
+        FMetaSoundNodeHandle NodeHandle = Builder.AddNodeByClassName(ClassName, Result, 1);
+
+        if (Result != EMetaSoundBuilderResult::Succeeded || !NodeHandle.IsSet())
+        {
+            OutError = FString::Printf(TEXT("Failed to add node '%s::%s' (variant: '%s'). Use search_metasound_palette to find valid node names."),
+                *Params.NodeNamespace, *Params.NodeClassName, *Params.NodeVariant);
+            return false;
+        }
+
+        OutNodeId = NodeHandle.NodeID;
+
+        // CRITICAL: Set the node's location in the document so it appears in the editor graph
+        // Without this, the editor's SynchronizeNodes won't visualize the node
+        FVector2D NodeLocation(static_cast<float>(Params.PosX), static_cast<float>(Params.PosY));
+        Builder.SetNodeLocation(NodeHandle, NodeLocation, Result);
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            UE_LOG(LogSoundService, Warning, TEXT("Failed to set node location for '%s::%s', node may not appear in editor graph"),
+                *Params.NodeNamespace, *Params.NodeClassName);
+            // Continue anyway - node was added, just location may be wrong
+        }
+
+        // CRITICAL: Mark the node as modified in the document's ModifyContext
+        // This signals to the editor graph that a node was added and needs synchronization
+        MarkMetaSoundNodeModified(MetaSound, NodeHandle.NodeID);
+        return true;
+    }
+
+    bool ConnectWithBuilder(UMetaSoundSource& MetaSound, UMetaSoundSourceBuilder& Builder, const FGuid& SourceNodeId, const FString& SourcePinName,
+                            const FGuid& TargetNodeId, const FString& TargetPinName, FString& OutError)
+    {
+        // Create node handles - use FMetaSoundNodeHandle for generic nodes
+        FMetaSoundNodeHandle SourceHandle;
+        SourceHandle.NodeID = SourceNodeId;
+
+        FMetaSoundNodeHandle TargetHandle;
+        TargetHandle.NodeID = TargetNodeId;
+
+        // Get output handle from source node
+        EMetaSoundBuilderResult Result;
+        FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder.FindNodeOutputByName(SourceHandle, FName(*SourcePinName), Result);
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Source pin '%s' not found on node %s"), *SourcePinName, *SourceNodeId.ToString());
+            return false;
+        }
+
+        // Get input handle from target node
+        FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(TargetHandle, FName(*TargetPinName), Result);
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Target pin '%s' not found on node %s"), *TargetPinName, *TargetNodeId.ToString());
+            return false;
+        }
+
+        // Make the connection
+        Builder.ConnectNodes(OutputHandle, InputHandle, Result);
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Failed to connect '%s.%s' to '%s.%s'"),
+                *SourceNodeId.ToString(), *SourcePinName, *TargetNodeId.ToString(), *TargetPinName);
+            return false;
+        }
+
+        // Mark both connected nodes as modified for synchronization
+        MarkMetaSoundNodeModified(MetaSound, SourceNodeId);
+        MarkMetaSoundNodeModified(MetaSound, TargetNodeId);
+        return true;
+    }
+
+    bool SetNodeInputWithBuilder(UMetaSoundSourceBuilder& Builder, const FGuid& NodeId, const FString& InputName, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+    {
+        // Get the builder subsystem for literal creation helpers
+        UMetaSoundBuilderSubsystem* BuilderSubsystem = UMetaSoundBuilderSubsystem::Get();
+        if (!BuilderSubsystem)
+        {
+            OutError = TEXT("MetaSound Builder Subsystem not available");
+            return false;
+        }
+
+        // Create node handle - use FMetaSoundNodeHandle for generic nodes
+        FMetaSoundNodeHandle NodeHandle;
+        NodeHandle.NodeID = NodeId;
+
+        // Find the input
+        EMetaSoundBuilderResult Result;
+        FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(NodeHandle, FName(*InputName), Result);
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *NodeId.ToString());
+            return false;
+        }
+
+        if (!Value.IsValid())
+        {
+            OutError = TEXT("Missing input value");
+            return false;
+        }
+
+        // Set the value based on JSON type - need FName references for literal creation
+        FName DataType;
+        if (Value->Type == EJson::Number)
+        {
+            FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateFloatMetaSoundLiteral(static_cast<float>(Value->AsNumber()), DataType);
+            Builder.SetNodeInputDefault(InputHandle, Literal, Result);
+        }
+        else if (Value->Type == EJson::Boolean)
+        {
+            FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateBoolMetaSoundLiteral(Value->AsBool(), DataType);
+            Builder.SetNodeInputDefault(InputHandle, Literal, Result);
+        }
+        else if (Value->Type == EJson::String)
+        {
+            FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateStringMetaSoundLiteral(Value->AsString(), DataType);
+            Builder.SetNodeInputDefault(InputHandle, Literal, Result);
+        }
+        else
+        {
+            OutError = TEXT("Unsupported value type. Supported: number, boolean, string");
+            return false;
+        }
+
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Failed to set input value for '%s' on node %s"), *InputName, *NodeId.ToString());
+            return false;
+        }
+        return true;
+    }
+
+    bool AddGraphInputWithBuilder(UMetaSoundSourceBuilder& Builder, const FMetaSoundInputParams& Params, const FVector2D& Location, FGuid& OutNodeId, FString& OutError)
+    {
+        const FName DataTypeName = ResolveMetaSoundDataType(Params.DataType);
+
+        // Create the default value literal based on data type
+        FMetasoundFrontendLiteral DefaultLiteral;
+        if (!Params.DefaultValue.IsEmpty())
+        {
+            if (DataTypeName == FName(TEXT("Float")))
+            {
+                DefaultLiteral.Set(FCString::Atof(*Params.DefaultValue));
+            }
+            else if (DataTypeName == FName(TEXT("Int32")))
+            {
+                DefaultLiteral.Set(FCString::Atoi(*Params.DefaultValue));
+            }
+            else if (DataTypeName == FName(TEXT("Bool")))
+            {
+                DefaultLiteral.Set(Params.DefaultValue.ToBool());
+            }
+            else if (DataTypeName == FName(TEXT("String")))
+            {
+                DefaultLiteral.Set(Params.DefaultValue);
+            }
+            // Trigger and Audio types don't have default values
+        }
+
+        // Add the input - AddGraphInputNode returns an OUTPUT handle (the output of the input node)
+        EMetaSoundBuilderResult Result;
+        FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder.AddGraphInputNode(
+            FName(*Params.InputName),
+            DataTypeName,
+            DefaultLiteral,
+            Result,
+            false  // Not a constructor input
+        );
+
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Failed to add input '%s' of type '%s'"), *Params.InputName, *Params.DataType);
+            return false;
+        }
+
+        OutNodeId = OutputHandle.NodeID;
+
+        // CRITICAL: Create the template input node for visual representation
+        // The editor visualizes template nodes (FInputNodeTemplate), not the interface input nodes directly.
+        // Without this, the input won't appear in the graph until the asset is reopened.
+        FMetaSoundFrontendDocumentBuilder& DocBuilder = Builder.GetBuilder();
+        const FMetasoundFrontendNode* TemplateNode = Metasound::Frontend::FInputNodeTemplate::CreateNode(
+            DocBuilder,
+            FName(*Params.InputName)
+        );
+
+        if (TemplateNode)
+        {
+            // Set location on the TEMPLATE node (this is what the editor visualizes)
+            DocBuilder.SetNodeLocation(TemplateNode->GetID(), Location);
+
+            UE_LOG(LogSoundService, Log, TEXT("Created template input node for '%s' with ID: %s"),
+                *Params.InputName, *TemplateNode->GetID().ToString());
+        }
+        else
+        {
+            UE_LOG(LogSoundService, Warning, TEXT("Failed to create template input node for '%s' - input may not appear visually"), *Params.InputName);
+        }
+        return true;
+    }
+
+    bool AddGraphOutputWithBuilder(UMetaSoundSourceBuilder& Builder, const FMetaSoundOutputParams& Params, const FVector2D& Location, FGuid& OutNodeId, FString& OutError)
+    {
+        const FName DataTypeName = ResolveMetaSoundDataType(Params.DataType);
+
+        // Add the output - AddGraphOutputNode returns an INPUT handle (the input of the output node)
+        EMetaSoundBuilderResult Result;
+        FMetaSoundBuilderNodeInputHandle InputHandle = Builder.AddGraphOutputNode(
+            FName(*Params.OutputName),
+            DataTypeName,
+            FMetasoundFrontendLiteral(),  // Default value (empty for now)
+            Result,
+            false  // Not a constructor output
+        );
+
+        if (Result != EMetaSoundBuilderResult::Succeeded)
+        {
+            OutError = FString::Printf(TEXT("Failed to add output '%s' of type '%s'"), *Params.OutputName, *Params.DataType);
+            return false;
+        }
+
+        OutNodeId = InputHandle.NodeID;
+
+        // Output nodes (class type: Output) are visualized directly, unlike inputs which use template nodes.
+        // Set the location using the document builder for the output node.
+        Builder.GetBuilder().SetNodeLocation(InputHandle.NodeID, Location);
+
+        UE_LOG(LogSoundService, Log, TEXT("Set location for output node '%s' at (%f, %f)"),
+            *Params.OutputName, Location.X, Location.Y);
+        return true;
+    }
+#endif
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Services/SoundService.h"
+
+class UMetaSoundSource;
+class UMetaSoundSourceBuilder;
+class FJsonValue;
+
+/**
+ * Builder-level MetaSound edits shared by the single-step MetaSound commands and
+ * build_metasound_from_spec
+ *
+ * The edits only change the builder's document. Callers register the graph with the frontend
+ * (or conform the object) and save afterwards, once per command.
+ */
+namespace MetaSoundBuilderHelpers
+{
+    /** MetaSound type name for a data type as the commands accept it; unknown names are used as-is */
+    FName ResolveMetaSoundDataType(const FString& DataType);
+
+    /** Register a MetaSound's current document for execution, which compiles its graph */
+    bool RegisterMetaSoundForExecution(UMetaSoundSource& MetaSound, FString& OutError);
+
+#if WITH_EDITORONLY_DATA
+    /** Flag a node for the editor graph's next synchronization */
+    void MarkMetaSoundNodeModified(UMetaSoundSource& MetaSound, const FGuid& NodeId);
+
+    bool AddNodeWithBuilder(UMetaSoundSource& MetaSound, UMetaSoundSourceBuilder& Builder, const FMetaSoundNodeParams& Params, FGuid& OutNodeId, FString& OutError);
+
+    bool ConnectWithBuilder(UMetaSoundSource& MetaSound, UMetaSoundSourceBuilder& Builder, const FGuid& SourceNodeId, const FString& SourcePinName,
+                            const FGuid& TargetNodeId, const FString& TargetPinName, FString& OutError);
+
+    bool SetNodeInputWithBuilder(UMetaSoundSourceBuilder& Builder, const FGuid& NodeId, const FString& InputName, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
+    bool AddGraphInputWithBuilder(UMetaSoundSourceBuilder& Builder, const FMetaSoundInputParams& Params, const FVector2D& Location, FGuid& OutNodeId, FString& OutError);
+
+    bool AddGraphOutputWithBuilder(UMetaSoundSourceBuilder& Builder, const FMetaSoundOutputParams& Params, const FVector2D& Location, FGuid& OutNodeId, FString& OutError);
+#endif
+}
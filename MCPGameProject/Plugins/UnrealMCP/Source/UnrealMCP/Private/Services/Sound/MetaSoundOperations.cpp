@@ -2,11 +2,11 @@
 // This file implements the MetaSound operations of FSoundService
 
 #include "Services/SoundService.h"
+#include "Services/Sound/MetaSoundBuilderHelpers.h"
 #include "MetasoundSource.h"
 #include "MetasoundBuilderSubsystem.h"
 #include "MetasoundBuilderBase.h"
 #include "MetasoundFrontendDocumentBuilder.h"
-#include "MetasoundFrontendSearchEngine.h"
 #include "MetasoundAssetManager.h"
 #include "MetasoundAssetBase.h"
 #include "MetasoundUObjectRegistry.h"
@@ -14,9 +14,13 @@
 #include "MetasoundEditorSubsystem.h"
 #include "NodeTemplates/MetasoundFrontendNodeTemplateInput.h"
 #include "Dom/JsonValue.h"
+#include "MCPBatchEditScope.h"
+#include "Services/MetaSoundPaletteIndex.h"
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
 
+using namespace MetaSoundBuilderHelpers;
+
 // ============================================================================
 // MetaSound Operations
 // ============================================================================
@@ -275,8 +279,6 @@ bool FSoundService::GetMetaSoundMetadata(const FString& MetaSoundPath, TSharedPt
 bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString& OutNodeId, FString& OutError)
 {
 #if WITH_EDITORONLY_DATA
-    using namespace Metasound::Frontend;
-
     UMetaSoundSource* MetaSound = FindMetaSoundSource(Params.MetaSoundPath);
     if (!MetaSound)
     {
@@ -288,53 +290,15 @@ bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString
     Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
     UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
 
-    // Create the class name from namespace, name, and variant
-    FMetasoundFrontendClassName ClassName;
-    ClassName.Namespace = FName(*Params.NodeNamespace);
-    ClassName.Name = FName(*Params.NodeClassName);
-    if (!Params.NodeVariant.IsEmpty())
-    {
-        ClassName.Variant = FName(*Params.NodeVariant);
-    }
-
-    UE_LOG(LogSoundService, Log, TEXT("Adding node: Namespace='%s', Name='%s', Variant='%s'"),
-        *ClassName.Namespace.ToString(), *ClassName.Name.ToString(), *ClassName.Variant.ToString());
-
     // Mark the MetaSound as modified before making changes
     MetaSound->Modify();
 
-    // Add the node using the builder
-    EMetaSoundBuilderResult Result;
-    FMetaSoundNodeHandle NodeHandle = Builder.AddNodeByClassName(ClassName, Result, 1);
-
-    if (Result != EMetaSoundBuilderResult::Succeeded || !NodeHandle.IsSet())
+    FGuid NodeId;
+    if (!AddNodeWithBuilder(*MetaSound, Builder, Params, NodeId, OutError))
     {
-        OutError = FString::Printf(TEXT("Failed to add node '%s::%s' (variant: '%s'). Use search_metasound_palette to find valid node names."),
-            *Params.NodeNamespace, *Params.NodeClassName, *Params.NodeVariant);
         return false;
     }
-
-    // Get the node ID from the handle
-    OutNodeId = NodeHandle.NodeID.ToString();
-
-    // CRITICAL: Set the node's location in the document so it appears in the editor graph
-    // Without this, the editor's SynchronizeNodes won't visualize the node
-    FVector2D NodeLocation(static_cast<float>(Params.PosX), static_cast<float>(Params.PosY));
-    Builder.SetNodeLocation(NodeHandle, NodeLocation, Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        UE_LOG(LogSoundService, Warning, TEXT("Failed to set node location for '%s::%s', node may not appear in editor graph"),
-            *Params.NodeNamespace, *Params.NodeClassName);
-        // Continue anyway - node was added, just location may be wrong
-    }
-
-    // CRITICAL: Mark the node as modified in the document's ModifyContext
-    // This signals to the editor graph that a node was added and needs synchronization
-    FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound);
-    if (MetaSoundAsset)
-    {
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(NodeHandle.NodeID);
-    }
+    OutNodeId = NodeId.ToString();
 
     // Register the graph with the frontend to synchronize the editor graph
     // This creates the visual editor node representation
@@ -358,6 +322,7 @@ bool FSoundService::AddMetaSoundNode(const FMetaSoundNodeParams& Params, FString
 
 bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FString& SourceNodeId, const FString& SourcePinName, const FString& TargetNodeId, const FString& TargetPinName, FString& OutError)
 {
+#if WITH_EDITORONLY_DATA
     UMetaSoundSource* MetaSound = FindMetaSoundSource(MetaSoundPath);
     if (!MetaSound)
     {
@@ -366,13 +331,8 @@ bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FS
     }
 
     // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
     Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
     UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
 
     // Parse node IDs
     FGuid SourceGuid, TargetGuid;
@@ -387,50 +347,14 @@ bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FS
         return false;
     }
 
-    // Create node handles - use FMetaSoundNodeHandle for generic nodes
-    FMetaSoundNodeHandle SourceHandle;
-    SourceHandle.NodeID = SourceGuid;
-
-    FMetaSoundNodeHandle TargetHandle;
-    TargetHandle.NodeID = TargetGuid;
-
-    // Get output handle from source node
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder.FindNodeOutputByName(SourceHandle, FName(*SourcePinName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Source pin '%s' not found on node %s"), *SourcePinName, *SourceNodeId);
-        return false;
-    }
-
-    // Get input handle from target node
-    FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(TargetHandle, FName(*TargetPinName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Target pin '%s' not found on node %s"), *TargetPinName, *TargetNodeId);
-        return false;
-    }
-
     // Mark the MetaSound as modified before making changes
     MetaSound->Modify();
 
-    // Make the connection
-    Builder.ConnectNodes(OutputHandle, InputHandle, Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
+    if (!ConnectWithBuilder(*MetaSound, Builder, SourceGuid, SourcePinName, TargetGuid, TargetPinName, OutError))
     {
-        OutError = FString::Printf(TEXT("Failed to connect '%s.%s' to '%s.%s'"),
-            *SourceNodeId, *SourcePinName, *TargetNodeId, *TargetPinName);
         return false;
     }
 
-    // Mark both connected nodes as modified for synchronization
-    FMetasoundAssetBase* MetaSoundAsset = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound);
-    if (MetaSoundAsset)
-    {
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(SourceGuid);
-        MetaSoundAsset->GetModifyContext().AddNodeIDModified(TargetGuid);
-    }
-
     // Register the graph with the frontend to synchronize the editor graph
     UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
 
@@ -444,10 +368,15 @@ bool FSoundService::ConnectMetaSoundNodes(const FString& MetaSoundPath, const FS
         *SourceNodeId, *SourcePinName, *TargetNodeId, *TargetPinName, *MetaSoundPath);
 
     return true;
+#else
+    OutError = TEXT("MetaSound editing requires editor data");
+    return false;
+#endif
 }
 
 bool FSoundService::SetMetaSoundNodeInput(const FString& MetaSoundPath, const FString& NodeId, const FString& InputName, const TSharedPtr<FJsonValue>& Value, FString& OutError)
 {
+#if WITH_EDITORONLY_DATA
     UMetaSoundSource* MetaSound = FindMetaSoundSource(MetaSoundPath);
     if (!MetaSound)
     {
@@ -455,22 +384,9 @@ bool FSoundService::SetMetaSoundNodeInput(const FString& MetaSoundPath, const FS
         return false;
     }
 
-    // Get the builder subsystem for literal creation helpers
-    UMetaSoundBuilderSubsystem* BuilderSubsystem = UMetaSoundBuilderSubsystem::Get();
-    if (!BuilderSubsystem)
-    {
-        OutError = TEXT("MetaSound Builder Subsystem not available");
-        return false;
-    }
-
     // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
     Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
     UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
 
     // Parse node ID
     FGuid NodeGuid;
@@ -480,45 +396,8 @@ bool FSoundService::SetMetaSoundNodeInput(const FString& MetaSoundPath, const FS
         return false;
     }
 
-    // Create node handle - use FMetaSoundNodeHandle for generic nodes
-    FMetaSoundNodeHandle NodeHandle;
-    NodeHandle.NodeID = NodeGuid;
-
-    // Find the input
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeInputHandle InputHandle = Builder.FindNodeInputByName(NodeHandle, FName(*InputName), Result);
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Input '%s' not found on node %s"), *InputName, *NodeId);
-        return false;
-    }
-
-    // Set the value based on JSON type - need FName references for literal creation
-    FName DataType;
-    if (Value->Type == EJson::Number)
+    if (!SetNodeInputWithBuilder(Builder, NodeGuid, InputName, Value, OutError))
     {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateFloatMetaSoundLiteral(static_cast<float>(Value->AsNumber()), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else if (Value->Type == EJson::Boolean)
-    {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateBoolMetaSoundLiteral(Value->AsBool(), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else if (Value->Type == EJson::String)
-    {
-        FMetasoundFrontendLiteral Literal = BuilderSubsystem->CreateStringMetaSoundLiteral(Value->AsString(), DataType);
-        Builder.SetNodeInputDefault(InputHandle, Literal, Result);
-    }
-    else
-    {
-        OutError = TEXT("Unsupported value type. Supported: number, boolean, string");
-        return false;
-    }
-
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Failed to set input value for '%s' on node %s"), *InputName, *NodeId);
         return false;
     }
 
@@ -535,10 +414,15 @@ bool FSoundService::SetMetaSoundNodeInput(const FString& MetaSoundPath, const FS
     UE_LOG(LogSoundService, Log, TEXT("Set input '%s' on node '%s' in MetaSound: %s"), *InputName, *NodeId, *MetaSoundPath);
 
     return true;
+#else
+    OutError = TEXT("MetaSound editing requires editor data");
+    return false;
+#endif
 }
 
 bool FSoundService::AddMetaSoundInput(const FMetaSoundInputParams& Params, FString& OutInputNodeId, FString& OutError)
 {
+#if WITH_EDITORONLY_DATA
     UMetaSoundSource* MetaSound = FindMetaSoundSource(Params.MetaSoundPath);
     if (!MetaSound)
     {
@@ -547,109 +431,15 @@ bool FSoundService::AddMetaSoundInput(const FMetaSoundInputParams& Params, FStri
     }
 
     // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
     Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
     UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
 
-    // Map data type string to MetaSound type name
-    FName DataTypeName;
-    if (Params.DataType.Equals(TEXT("Float"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Float"));
-    }
-    else if (Params.DataType.Equals(TEXT("Int32"), ESearchCase::IgnoreCase) || Params.DataType.Equals(TEXT("Int"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Int32"));
-    }
-    else if (Params.DataType.Equals(TEXT("Bool"), ESearchCase::IgnoreCase) || Params.DataType.Equals(TEXT("Boolean"), ESearchCase::IgnoreCase))
+    FGuid InputNodeId;
+    if (!AddGraphInputWithBuilder(Builder, Params, FVector2D(-200.0f, 200.0f), InputNodeId, OutError))
     {
-        DataTypeName = FName(TEXT("Bool"));
-    }
-    else if (Params.DataType.Equals(TEXT("Trigger"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Trigger"));
-    }
-    else if (Params.DataType.Equals(TEXT("Audio"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Audio"));
-    }
-    else if (Params.DataType.Equals(TEXT("String"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("String"));
-    }
-    else
-    {
-        // Use the type name as-is for custom types
-        DataTypeName = FName(*Params.DataType);
-    }
-
-    // Create the default value literal based on data type
-    FMetasoundFrontendLiteral DefaultLiteral;
-    if (!Params.DefaultValue.IsEmpty())
-    {
-        if (DataTypeName == FName(TEXT("Float")))
-        {
-            DefaultLiteral.Set(FCString::Atof(*Params.DefaultValue));
-        }
-        else if (DataTypeName == FName(TEXT("Int32")))
-        {
-            DefaultLiteral.Set(FCString::Atoi(*Params.DefaultValue));
-        }
-        else if (DataTypeName == FName(TEXT("Bool")))
-        {
-            DefaultLiteral.Set(Params.DefaultValue.ToBool());
-        }
-        else if (DataTypeName == FName(TEXT("String")))
-        {
-            DefaultLiteral.Set(Params.DefaultValue);
-        }
-        // Trigger and Audio types don't have default values
-    }
-
-    // Add the input - AddGraphInputNode returns an OUTPUT handle (the output of the input node)
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeOutputHandle OutputHandle = Builder.AddGraphInputNode(
-        FName(*Params.InputName),
-        DataTypeName,
-        DefaultLiteral,
-        Result,
-        false  // Not a constructor input
-    );
-
-    if (Result != EMetaSoundBuilderResult::Succeeded)
-    {
-        OutError = FString::Printf(TEXT("Failed to add input '%s' of type '%s'"), *Params.InputName, *Params.DataType);
         return false;
     }
-
-    OutInputNodeId = OutputHandle.NodeID.ToString();
-
-    // CRITICAL: Create the template input node for visual representation
-    // The editor visualizes template nodes (FInputNodeTemplate), not the interface input nodes directly.
-    // Without this, the input won't appear in the graph until the asset is reopened.
-    FMetaSoundFrontendDocumentBuilder& DocBuilder = Builder.GetBuilder();
-    const FMetasoundFrontendNode* TemplateNode = Metasound::Frontend::FInputNodeTemplate::CreateNode(
-        DocBuilder,
-        FName(*Params.InputName)
-    );
-
-    if (TemplateNode)
-    {
-        // Set location on the TEMPLATE node (this is what the editor visualizes)
-        FVector2D NodeLocation(-200.0f, 200.0f);  // Default position for inputs
-        DocBuilder.SetNodeLocation(TemplateNode->GetID(), NodeLocation);
-
-        UE_LOG(LogSoundService, Log, TEXT("Created template input node for '%s' with ID: %s"),
-            *Params.InputName, *TemplateNode->GetID().ToString());
-    }
-    else
-    {
-        UE_LOG(LogSoundService, Warning, TEXT("Failed to create template input node for '%s' - input may not appear visually"), *Params.InputName);
-    }
+    OutInputNodeId = InputNodeId.ToString();
 
     // Register the graph with the frontend to synchronize the editor graph
     UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
@@ -665,10 +455,15 @@ bool FSoundService::AddMetaSoundInput(const FMetaSoundInputParams& Params, FStri
         *Params.InputName, *Params.DataType, *OutInputNodeId, *Params.MetaSoundPath);
 
     return true;
+#else
+    OutError = TEXT("MetaSound editing requires editor data");
+    return false;
+#endif
 }
 
 bool FSoundService::AddMetaSoundOutput(const FMetaSoundOutputParams& Params, FString& OutOutputNodeId, FString& OutError)
 {
+#if WITH_EDITORONLY_DATA
     UMetaSoundSource* MetaSound = FindMetaSoundSource(Params.MetaSoundPath);
     if (!MetaSound)
     {
@@ -677,68 +472,15 @@ bool FSoundService::AddMetaSoundOutput(const FMetaSoundOutputParams& Params, FSt
     }
 
     // Get or create a builder for this existing MetaSound using the document builder registry
-#if WITH_EDITORONLY_DATA
     Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
     UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
-#else
-    OutError = TEXT("MetaSound editing requires editor data");
-    return false;
-#endif
-
-    // Map data type string to MetaSound type name
-    FName DataTypeName;
-    if (Params.DataType.Equals(TEXT("Float"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Float"));
-    }
-    else if (Params.DataType.Equals(TEXT("Int32"), ESearchCase::IgnoreCase) || Params.DataType.Equals(TEXT("Int"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Int32"));
-    }
-    else if (Params.DataType.Equals(TEXT("Bool"), ESearchCase::IgnoreCase) || Params.DataType.Equals(TEXT("Boolean"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Bool"));
-    }
-    else if (Params.DataType.Equals(TEXT("Trigger"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Trigger"));
-    }
-    else if (Params.DataType.Equals(TEXT("Audio"), ESearchCase::IgnoreCase))
-    {
-        DataTypeName = FName(TEXT("Audio"));
-    }
-    else
-    {
-        // Use the type name as-is for custom types
-        DataTypeName = FName(*Params.DataType);
-    }
-
-    // Add the output - AddGraphOutputNode returns an INPUT handle (the input of the output node)
-    EMetaSoundBuilderResult Result;
-    FMetaSoundBuilderNodeInputHandle InputHandle = Builder.AddGraphOutputNode(
-        FName(*Params.OutputName),
-        DataTypeName,
-        FMetasoundFrontendLiteral(),  // Default value (empty for now)
-        Result,
-        false  // Not a constructor output
-    );
 
-    if (Result != EMetaSoundBuilderResult::Succeeded)
+    FGuid OutputNodeId;
+    if (!AddGraphOutputWithBuilder(Builder, Params, FVector2D(400.0f, 200.0f), OutputNodeId, OutError))
     {
-        OutError = FString::Printf(TEXT("Failed to add output '%s' of type '%s'"), *Params.OutputName, *Params.DataType);
         return false;
     }
-
-    OutOutputNodeId = InputHandle.NodeID.ToString();
-
-    // Output nodes (class type: Output) are visualized directly, unlike inputs which use template nodes.
-    // Set the location using the document builder for the output node.
-    FMetaSoundFrontendDocumentBuilder& DocBuilder = Builder.GetBuilder();
-    FVector2D NodeLocation(400.0f, 200.0f);  // Default position for outputs (right side)
-    DocBuilder.SetNodeLocation(InputHandle.NodeID, NodeLocation);
-
-    UE_LOG(LogSoundService, Log, TEXT("Set location for output node '%s' at (%f, %f)"),
-        *Params.OutputName, NodeLocation.X, NodeLocation.Y);
+    OutOutputNodeId = OutputNodeId.ToString();
 
     // Register the graph with the frontend to synchronize the editor graph
     UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
@@ -754,6 +496,10 @@ bool FSoundService::AddMetaSoundOutput(const FMetaSoundOutputParams& Params, FSt
         *Params.OutputName, *Params.DataType, *OutOutputNodeId, *Params.MetaSoundPath);
 
     return true;
+#else
+    OutError = TEXT("MetaSound editing requires editor data");
+    return false;
+#endif
 }
 
 bool FSoundService::CompileMetaSound(const FString& MetaSoundPath, FString& OutError)
@@ -765,19 +511,11 @@ bool FSoundService::CompileMetaSound(const FString& MetaSoundPath, FString& OutE
         return false;
     }
 
-    // Get the asset base for registration
-    FMetasoundAssetBase* AssetBase = Metasound::IMetasoundUObjectRegistry::Get().GetObjectAsAssetBase(MetaSound);
-    if (!AssetBase)
+    if (!RegisterMetaSoundForExecution(*MetaSound, OutError))
     {
-        OutError = TEXT("Failed to get MetaSound asset base");
         return false;
     }
 
-    // Compile by updating and registering for execution
-    Metasound::Frontend::FMetaSoundAssetRegistrationOptions RegOptions;
-    RegOptions.bForceReregister = true;
-    AssetBase->UpdateAndRegisterForExecution(RegOptions);
-
     // Save the MetaSound
     MetaSound->Modify();
     if (!SaveAsset(MetaSound, OutError))
@@ -790,108 +528,61 @@ bool FSoundService::CompileMetaSound(const FString& MetaSoundPath, FString& OutE
     return true;
 }
 
-bool FSoundService::SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError)
+bool FSoundService::SearchMetaSoundPalette(const FMetaSoundPaletteQuery& Query, TArray<TSharedPtr<FJsonObject>>& OutResults, int32& OutTotalCount, FString& OutError)
 {
 #if WITH_EDITORONLY_DATA
-    using namespace Metasound::Frontend;
-
-    // Get all registered MetaSound node classes
-    ISearchEngine& SearchEngine = ISearchEngine::Get();
-    TArray<FMetasoundFrontendClass> AllClasses = SearchEngine.FindAllClasses(false); // false = don't include deprecated versions
-
-    FString LowerQuery = SearchQuery.ToLower();
-    int32 ResultCount = 0;
-
-    for (const FMetasoundFrontendClass& NodeClass : AllClasses)
+    // Accept the data type names the other MetaSound commands take
+    TArray<FName> InputTypes;
+    for (const FString& Type : Query.InputTypes)
     {
-        if (MaxResults > 0 && ResultCount >= MaxResults)
-        {
-            break;
-        }
-
-        const FMetasoundFrontendClassMetadata& Metadata = NodeClass.Metadata;
-        const FMetasoundFrontendClassName& ClassName = Metadata.GetClassName();
+        InputTypes.Add(ResolveMetaSoundDataType(Type));
+    }
+    TArray<FName> OutputTypes;
+    for (const FString& Type : Query.OutputTypes)
+    {
+        OutputTypes.Add(ResolveMetaSoundDataType(Type));
+    }
 
-        // Build searchable strings
-        FString NameStr = ClassName.Name.ToString();
-        FString NamespaceStr = ClassName.Namespace.ToString();
-        FString VariantStr = ClassName.Variant.ToString();
-        FString DisplayNameStr = Metadata.GetDisplayName().ToString();
-        FString DescriptionStr = Metadata.GetDescription().ToString();
+    TArray<FMetaSoundPaletteIndex::FMatch> Matches;
+    FMetaSoundPaletteIndex::Get().Search(Query.SearchQuery, InputTypes, OutputTypes, Matches);
+    OutTotalCount = Matches.Num();
 
-        // Build category string from hierarchy
-        FString CategoryStr;
-        const TArray<FText>& CategoryHierarchy = Metadata.GetCategoryHierarchy();
-        for (int32 i = 0; i < CategoryHierarchy.Num(); ++i)
-        {
-            if (i > 0) CategoryStr += TEXT(" > ");
-            CategoryStr += CategoryHierarchy[i].ToString();
-        }
+    const int32 PageStart = FMath::Max(Query.Offset, 0);
+    const int32 PageEnd = Query.MaxResults > 0 ? FMath::Min(Matches.Num(), PageStart + Query.MaxResults) : Matches.Num();
+    for (int32 MatchIndex = PageStart; MatchIndex < PageEnd; ++MatchIndex)
+    {
+        const FMetaSoundPaletteIndex::FEntry& Entry = *Matches[MatchIndex].Entry;
 
-        // Build keywords string
-        FString KeywordsStr;
-        const TArray<FText>& Keywords = Metadata.GetKeywords();
-        for (const FText& Keyword : Keywords)
-        {
-            KeywordsStr += TEXT(" ") + Keyword.ToString();
-        }
+        TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("namespace"), Entry.Namespace);
+        ResultObj->SetStringField(TEXT("name"), Entry.Name);
+        ResultObj->SetStringField(TEXT("variant"), Entry.Variant);
+        ResultObj->SetStringField(TEXT("display_name"), Entry.DisplayName);
+        ResultObj->SetStringField(TEXT("description"), Entry.Description);
+        ResultObj->SetStringField(TEXT("category"), Entry.Category);
+        ResultObj->SetStringField(TEXT("full_name"), Entry.FullName);
+        ResultObj->SetNumberField(TEXT("score"), Matches[MatchIndex].Score);
 
-        // Check if any field matches the search query
-        bool bMatches = LowerQuery.IsEmpty() ||
-            NameStr.ToLower().Contains(LowerQuery) ||
-            NamespaceStr.ToLower().Contains(LowerQuery) ||
-            VariantStr.ToLower().Contains(LowerQuery) ||
-            DisplayNameStr.ToLower().Contains(LowerQuery) ||
-            DescriptionStr.ToLower().Contains(LowerQuery) ||
-            CategoryStr.ToLower().Contains(LowerQuery) ||
-            KeywordsStr.ToLower().Contains(LowerQuery);
-
-        if (bMatches)
+        auto MakeVertexArray = [](const TArray<FMetaSoundPaletteIndex::FVertex>& Vertices)
         {
-            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-            ResultObj->SetStringField(TEXT("namespace"), NamespaceStr);
-            ResultObj->SetStringField(TEXT("name"), NameStr);
-            ResultObj->SetStringField(TEXT("variant"), VariantStr);
-            ResultObj->SetStringField(TEXT("display_name"), DisplayNameStr);
-            ResultObj->SetStringField(TEXT("description"), DescriptionStr);
-            ResultObj->SetStringField(TEXT("category"), CategoryStr);
-
-            // Build full class name for use with add_metasound_node
-            FString FullClassName = NamespaceStr + TEXT("::") + NameStr;
-            if (!VariantStr.IsEmpty())
-            {
-                FullClassName += TEXT(" (") + VariantStr + TEXT(")");
-            }
-            ResultObj->SetStringField(TEXT("full_name"), FullClassName);
-
-            // Include inputs/outputs info
-            const FMetasoundFrontendClassInterface& Interface = NodeClass.GetDefaultInterface();
-            TArray<TSharedPtr<FJsonValue>> InputsArray;
-            for (const FMetasoundFrontendClassInput& Input : Interface.Inputs)
+            TArray<TSharedPtr<FJsonValue>> VertexArray;
+            for (const FMetaSoundPaletteIndex::FVertex& Vertex : Vertices)
             {
-                TSharedPtr<FJsonObject> InputObj = MakeShared<FJsonObject>();
-                InputObj->SetStringField(TEXT("name"), Input.Name.ToString());
-                InputObj->SetStringField(TEXT("type"), Input.TypeName.ToString());
-                InputsArray.Add(MakeShared<FJsonValueObject>(InputObj));
+                TSharedPtr<FJsonObject> VertexObj = MakeShared<FJsonObject>();
+                VertexObj->SetStringField(TEXT("name"), Vertex.Name);
+                VertexObj->SetStringField(TEXT("type"), Vertex.Type);
+                VertexArray.Add(MakeShared<FJsonValueObject>(VertexObj));
             }
-            ResultObj->SetArrayField(TEXT("inputs"), InputsArray);
+            return VertexArray;
+        };
+        ResultObj->SetArrayField(TEXT("inputs"), MakeVertexArray(Entry.Inputs));
+        ResultObj->SetArrayField(TEXT("outputs"), MakeVertexArray(Entry.Outputs));
 
-            TArray<TSharedPtr<FJsonValue>> OutputsArray;
-            for (const FMetasoundFrontendClassOutput& Output : Interface.Outputs)
-            {
-                TSharedPtr<FJsonObject> OutputObj = MakeShared<FJsonObject>();
-                OutputObj->SetStringField(TEXT("name"), Output.Name.ToString());
-                OutputObj->SetStringField(TEXT("type"), Output.TypeName.ToString());
-                OutputsArray.Add(MakeShared<FJsonValueObject>(OutputObj));
-            }
-            ResultObj->SetArrayField(TEXT("outputs"), OutputsArray);
-
-            OutResults.Add(ResultObj);
-            ResultCount++;
-        }
+        OutResults.Add(ResultObj);
     }
 
-    UE_LOG(LogSoundService, Log, TEXT("MetaSound palette search for '%s' returned %d results"), *SearchQuery, ResultCount);
+    UE_LOG(LogSoundService, Log, TEXT("MetaSound palette search for '%s' matched %d node classes, returned %d"),
+        *Query.SearchQuery, OutTotalCount, OutResults.Num());
     return true;
 #else
     OutError = TEXT("MetaSound palette search requires editor data");
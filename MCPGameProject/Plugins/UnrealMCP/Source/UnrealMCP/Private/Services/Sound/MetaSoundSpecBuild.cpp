@@ -0,0 +1,238 @@
+// MetaSoundSpecBuild.cpp - Declarative MetaSound build for FSoundService
+// BuildMetaSoundFromSpec
+
+#include "Services/SoundService.h"
+#include "Services/Sound/MetaSoundBuilderHelpers.h"
+#include "MetasoundSource.h"
+#include "MetasoundBuilderSubsystem.h"
+#include "MetasoundBuilderBase.h"
+#include "MetasoundFrontendDocumentBuilder.h"
+#include "MetasoundDocumentBuilderRegistry.h"
+#include "MetasoundEditorSubsystem.h"
+#include "Dom/JsonValue.h"
+#include "MCPBatchEditScope.h"
+
+using namespace MetaSoundBuilderHelpers;
+
+namespace
+{
+    /** Append one element result to the report of BuildMetaSoundFromSpec */
+    void AddMetaSoundSpecElement(TArray<TSharedPtr<FJsonValue>>& OutElements, int32& OutFailedCount, const TCHAR* Kind,
+                                 const FString& ElementName, bool bSucceeded, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Element = MakeShared<FJsonObject>();
+        Element->SetStringField(TEXT("kind"), Kind);
+        Element->SetStringField(TEXT("name"), ElementName);
+        Element->SetBoolField(TEXT("success"), bSucceeded);
+        if (!bSucceeded)
+        {
+            Element->SetStringField(TEXT("error"), Error.IsEmpty() ? TEXT("Unknown error") : Error);
+            OutFailedCount++;
+        }
+        OutElements.Add(MakeShared<FJsonValueObject>(Element));
+    }
+}
+
+bool FSoundService::BuildMetaSoundFromSpec(const FBuildMetaSoundFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+#if WITH_EDITORONLY_DATA
+    // One undo step; the saves below are queued and written once when the scope closes
+    FMCPBatchEditScope EditScope(FText::FromString(TEXT("MCP Build MetaSound From Spec")));
+
+    UMetaSoundSource* MetaSound = nullptr;
+    bool bCreated = false;
+    if (!Params.MetaSoundPath.IsEmpty())
+    {
+        MetaSound = FindMetaSoundSource(Params.MetaSoundPath);
+        if (!MetaSound)
+        {
+            OutError = FString::Printf(TEXT("MetaSound not found: %s"), *Params.MetaSoundPath);
+            return false;
+        }
+    }
+    else
+    {
+        FString CreatedPath;
+        MetaSound = CreateMetaSoundSource(Params.Creation, CreatedPath, OutError);
+        if (!MetaSound)
+        {
+            return false;
+        }
+        bCreated = true;
+    }
+
+    const FString MetaSoundPath = MetaSound->GetPathName();
+    UE_LOG(LogSoundService, Log, TEXT("Building MetaSound '%s' from spec: %d input(s), %d output(s), %d node(s), %d edge(s)"),
+        *MetaSoundPath, Params.Inputs.Num(), Params.Outputs.Num(), Params.Nodes.Num(), Params.Edges.Num());
+
+    // One builder session for the whole spec
+    Metasound::Engine::FDocumentBuilderRegistry& BuilderRegistry = Metasound::Engine::FDocumentBuilderRegistry::GetChecked();
+    UMetaSoundSourceBuilder& Builder = BuilderRegistry.FindOrBeginBuilding<UMetaSoundSourceBuilder>(*MetaSound);
+    MetaSound->Modify();
+
+    TArray<TSharedPtr<FJsonValue>> Elements;
+    int32 FailedCount = 0;
+
+    // Node IDs the edges can refer to by spec key, input name or output name
+    TMap<FString, FGuid> NodesByKey;
+    TMap<FString, FGuid> InputNodes;
+    TMap<FString, FGuid> OutputNodes;
+    TSharedPtr<FJsonObject> NodeIds = MakeShared<FJsonObject>();
+
+    // Inputs stacked down the left of the graph, outputs down the right
+    constexpr float MemberSpacing = 100.0f;
+    for (int32 Index = 0; Index < Params.Inputs.Num(); ++Index)
+    {
+        const FMetaSoundInputParams& Input = Params.Inputs[Index];
+        FGuid NodeId;
+        FString Error;
+        const bool bAdded = AddGraphInputWithBuilder(Builder, Input, FVector2D(-200.0f, 200.0f + Index * MemberSpacing), NodeId, Error);
+        if (bAdded)
+        {
+            InputNodes.Add(Input.InputName, NodeId);
+        }
+        AddMetaSoundSpecElement(Elements, FailedCount, TEXT("input"), Input.InputName, bAdded, Error);
+    }
+
+    for (int32 Index = 0; Index < Params.Outputs.Num(); ++Index)
+    {
+        const FMetaSoundOutputParams& Output = Params.Outputs[Index];
+        FGuid NodeId;
+        FString Error;
+        const bool bAdded = AddGraphOutputWithBuilder(Builder, Output, FVector2D(400.0f, 200.0f + Index * MemberSpacing), NodeId, Error);
+        if (bAdded)
+        {
+            OutputNodes.Add(Output.OutputName, NodeId);
+        }
+        AddMetaSoundSpecElement(Elements, FailedCount, TEXT("output"), Output.OutputName, bAdded, Error);
+    }
+
+    for (const FMetaSoundSpecNode& SpecNode : Params.Nodes)
+    {
+        const FString NodeName = SpecNode.Key.IsEmpty() ? SpecNode.Node.NodeClassName : SpecNode.Key;
+
+        FGuid NodeId;
+        FString Error;
+        const bool bAdded = AddNodeWithBuilder(*MetaSound, Builder, SpecNode.Node, NodeId, Error);
+        AddMetaSoundSpecElement(Elements, FailedCount, TEXT("node"), NodeName, bAdded, Error);
+        if (!bAdded)
+        {
+            continue;
+        }
+
+        if (!SpecNode.Key.IsEmpty())
+        {
+            NodesByKey.Add(SpecNode.Key, NodeId);
+            NodeIds->SetStringField(SpecNode.Key, NodeId.ToString());
+        }
+
+        if (SpecNode.InputDefaults.IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Default : SpecNode.InputDefaults->Values)
+            {
+                FString DefaultError;
+                const bool bSet = SetNodeInputWithBuilder(Builder, NodeId, Default.Key, Default.Value, DefaultError);
+                AddMetaSoundSpecElement(Elements, FailedCount, TEXT("input_default"),
+                    FString::Printf(TEXT("%s.%s"), *NodeName, *Default.Key), bSet, DefaultError);
+            }
+        }
+    }
+
+    // An edge end is a spec node, a graph member of the spec or of the MetaSound, or a node ID
+    auto ResolveEdgeEnd = [&Builder, &NodesByKey](const FString& NodeName, const TMap<FString, FGuid>& SpecMembers, bool bFromEnd,
+                                                  FString& InOutPin, FGuid& OutNodeId, FString& OutEndError) -> bool
+    {
+        if (const FGuid* SpecNodeId = NodesByKey.Find(NodeName))
+        {
+            OutNodeId = *SpecNodeId;
+        }
+        else if (const FGuid* MemberNodeId = SpecMembers.Find(NodeName))
+        {
+            OutNodeId = *MemberNodeId;
+            InOutPin = InOutPin.IsEmpty() ? NodeName : InOutPin;
+        }
+        else
+        {
+            EMetaSoundBuilderResult Result = EMetaSoundBuilderResult::Failed;
+            const FMetaSoundNodeHandle MemberNode = bFromEnd
+                ? Builder.FindGraphInputNode(FName(*NodeName), Result)
+                : Builder.FindGraphOutputNode(FName(*NodeName), Result);
+            if (Result == EMetaSoundBuilderResult::Succeeded && MemberNode.IsSet())
+            {
+                OutNodeId = MemberNode.NodeID;
+                InOutPin = InOutPin.IsEmpty() ? NodeName : InOutPin;
+            }
+            else if (!FGuid::Parse(NodeName, OutNodeId))
+            {
+                OutEndError = FString::Printf(TEXT("No node, graph %s or node ID named '%s'"), bFromEnd ? TEXT("input") : TEXT("output"), *NodeName);
+                return false;
+            }
+        }
+
+        if (InOutPin.IsEmpty())
+        {
+            OutEndError = FString::Printf(TEXT("Missing pin on node '%s'"), *NodeName);
+            return false;
+        }
+        return true;
+    };
+
+    for (const FMetaSoundSpecEdge& Edge : Params.Edges)
+    {
+        FString FromPin = Edge.FromPin;
+        FString ToPin = Edge.ToPin;
+        FGuid FromNodeId;
+        FGuid ToNodeId;
+        FString Error;
+        const bool bConnected = ResolveEdgeEnd(Edge.FromNode, InputNodes, true, FromPin, FromNodeId, Error)
+            && ResolveEdgeEnd(Edge.ToNode, OutputNodes, false, ToPin, ToNodeId, Error)
+            && ConnectWithBuilder(*MetaSound, Builder, FromNodeId, FromPin, ToNodeId, ToPin, Error);
+        AddMetaSoundSpecElement(Elements, FailedCount, TEXT("edge"),
+            FString::Printf(TEXT("%s.%s -> %s.%s"), *Edge.FromNode, *FromPin, *Edge.ToNode, *ToPin), bConnected, Error);
+    }
+
+    // One synchronization of the object and the editor graph for every edit above
+    MetaSound->ConformObjectToDocument();
+    UMetaSoundEditorSubsystem::GetChecked().RegisterGraphWithFrontend(*MetaSound, true);
+
+    // One compile for the whole spec
+    bool bCompiled = false;
+    FString CompileError;
+    if (Params.bCompile)
+    {
+        bCompiled = RegisterMetaSoundForExecution(*MetaSound, CompileError);
+    }
+
+    FString SaveError;
+    if (!SaveAsset(MetaSound, SaveError))
+    {
+        UE_LOG(LogSoundService, Warning, TEXT("Failed to save MetaSound after building from spec: %s"), *SaveError);
+    }
+
+    UE_LOG(LogSoundService, Log, TEXT("Built MetaSound '%s' from spec: %d element(s), %d failed"),
+        *MetaSoundPath, Elements.Num(), FailedCount);
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("metasound_path"), MetaSoundPath);
+    OutReport->SetBoolField(TEXT("created"), bCreated);
+    OutReport->SetObjectField(TEXT("node_ids"), NodeIds);
+    OutReport->SetNumberField(TEXT("element_count"), Elements.Num());
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("elements"), Elements);
+    OutReport->SetBoolField(TEXT("compile_requested"), Params.bCompile);
+    if (Params.bCompile)
+    {
+        OutReport->SetBoolField(TEXT("compiled"), bCompiled);
+        if (!bCompiled)
+        {
+            OutReport->SetStringField(TEXT("compile_error"), CompileError);
+        }
+    }
+
+    return true;
+#else
+    OutError = TEXT("MetaSound editing requires editor data");
+    return false;
+#endif
+}
+
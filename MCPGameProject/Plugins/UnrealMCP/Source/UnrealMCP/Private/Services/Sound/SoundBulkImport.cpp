@@ -0,0 +1,401 @@
+// SoundBulkImport.cpp - Bulk audio import methods for FSoundService
+// StartBulkSoundImport, GetBulkSoundImport
+
+#include "Services/SoundService.h"
+#include "Sound/SoundWave.h"
+#include "Audio.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "AssetImportTask.h"
+#include "FileHelpers.h"
+#include "ObjectTools.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    /** Extensions the sound factories import, as ImportSoundFile accepts them */
+    bool IsSupportedAudioFile(const FString& FilePath)
+    {
+        static const TArray<FString> SupportedExtensions = { TEXT("wav"), TEXT("mp3"), TEXT("ogg"), TEXT("flac"), TEXT("aiff"), TEXT("aif") };
+        return SupportedExtensions.Contains(FPaths::GetExtension(FilePath).ToLower());
+    }
+
+    /** Result of a file that was not imported */
+    TSharedPtr<FJsonObject> MakeBulkSoundImportFailure(const FString& SourceFilePath, const FString& AssetName, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("source_file_path"), SourceFilePath);
+        Result->SetStringField(TEXT("asset_name"), AssetName);
+        Result->SetBoolField(TEXT("imported"), false);
+        Result->SetStringField(TEXT("error"), Error);
+        return Result;
+    }
+}
+
+bool FSoundService::StartBulkSoundImport(const FBulkSoundImportParams& Params, int64& OutJobId, int32& OutFileCount, FString& OutError)
+{
+    check(IsInGameThread());
+
+    if (!Params.IsValid(OutError))
+    {
+        return false;
+    }
+
+    TArray<FString> SourceFiles = Params.SourceFilePaths;
+    if (!Params.SourceDirectory.IsEmpty())
+    {
+        if (!IFileManager::Get().DirectoryExists(*Params.SourceDirectory))
+        {
+            OutError = FString::Printf(TEXT("Source directory does not exist: %s"), *Params.SourceDirectory);
+            return false;
+        }
+
+        TArray<FString> FoundFiles;
+        if (Params.bRecursive)
+        {
+            IFileManager::Get().FindFilesRecursive(FoundFiles, *Params.SourceDirectory, TEXT("*.*"), true, false);
+        }
+        else
+        {
+            IFileManager::Get().FindFiles(FoundFiles, *(Params.SourceDirectory / TEXT("*.*")), true, false);
+            for (FString& FoundFile : FoundFiles)
+            {
+                FoundFile = Params.SourceDirectory / FoundFile;
+            }
+        }
+        FoundFiles.Sort();
+        for (const FString& FoundFile : FoundFiles)
+        {
+            if (IsSupportedAudioFile(FoundFile))
+            {
+                SourceFiles.Add(FoundFile);
+            }
+        }
+    }
+
+    FBulkSoundImportJob Job;
+
+    // Same destination rules as ImportSoundFile
+    Job.FolderPath = Params.FolderPath;
+    if (!Job.FolderPath.StartsWith(TEXT("/")))
+    {
+        Job.FolderPath = TEXT("/Game/") + Job.FolderPath;
+    }
+    else if (!Job.FolderPath.StartsWith(TEXT("/Game")))
+    {
+        Job.FolderPath = TEXT("/Game") + Job.FolderPath;
+    }
+
+    // Files whose names sanitize to the same asset name get numbered, so none replaces another
+    TSet<FString> SeenFiles;
+    TSet<FString> UsedNames;
+    for (const FString& SourceFile : SourceFiles)
+    {
+        const FString FullPath = FPaths::ConvertRelativePathToFull(SourceFile);
+        if (SeenFiles.Contains(FullPath))
+        {
+            continue;
+        }
+        SeenFiles.Add(FullPath);
+
+        const FString BaseName = ObjectTools::SanitizeObjectName(Params.AssetPrefix + FPaths::GetBaseFilename(FullPath));
+        FString AssetName = BaseName;
+        for (int32 Suffix = 2; UsedNames.Contains(AssetName.ToLower()); ++Suffix)
+        {
+            AssetName = FString::Printf(TEXT("%s_%d"), *BaseName, Suffix);
+        }
+        UsedNames.Add(AssetName.ToLower());
+
+        if (!IsSupportedAudioFile(FullPath))
+        {
+            Job.Results.Add(MakeBulkSoundImportFailure(FullPath, AssetName, FString::Printf(
+                TEXT("Unsupported audio format: %s. Supported: wav, mp3, ogg, flac, aiff"), *FPaths::GetExtension(FullPath))));
+            Job.FailedCount++;
+            continue;
+        }
+        Job.Files.Add(FBulkSoundImportFile{ FullPath, AssetName });
+    }
+
+    if (Job.Files.Num() == 0 && Job.Results.Num() == 0)
+    {
+        OutError = Params.SourceDirectory.IsEmpty()
+            ? TEXT("No audio files to import")
+            : FString::Printf(TEXT("No audio files found in '%s'"), *Params.SourceDirectory);
+        return false;
+    }
+
+    Job.bReplaceExisting = Params.bReplaceExisting;
+    Job.bSave = Params.bSave;
+    Job.BatchSize = FMath::Clamp(Params.BatchSize, 1, 1024);
+    Job.MaxInFlight = FMath::Clamp(Params.MaxInFlight, 1, 64);
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // Results of old runs are dropped before a new run adds its own
+    TArray<int64> FinishedIds;
+    for (const TPair<int64, FBulkSoundImportJob>& Pair : BulkSoundImportJobs)
+    {
+        if (Pair.Value.bFinished)
+        {
+            FinishedIds.Add(Pair.Key);
+        }
+    }
+    FinishedIds.Sort();
+    for (int32 Index = 0; Index <= FinishedIds.Num() - MaxFinishedBulkSoundImportJobs; ++Index)
+    {
+        BulkSoundImportJobs.Remove(FinishedIds[Index]);
+    }
+
+    OutJobId = NextBulkSoundImportJobId++;
+    OutFileCount = Job.FileCount = Job.Files.Num() + Job.Results.Num();
+    const int32 BatchSize = Job.BatchSize;
+    BulkSoundImportJobs.Add(OutJobId, MoveTemp(Job));
+
+    if (!BulkSoundImportTickerHandle.IsValid())
+    {
+        BulkSoundImportTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FSoundService::TickBulkSoundImport));
+    }
+
+    UE_LOG(LogSoundService, Log, TEXT("Started bulk sound import job %lld of %d file(s) into '%s', %d per batch"),
+        OutJobId, OutFileCount, *Params.FolderPath, BatchSize);
+    return true;
+}
+
+bool FSoundService::TickBulkSoundImport(float DeltaTime)
+{
+    bool bAnyRunning = false;
+
+    for (TPair<int64, FBulkSoundImportJob>& Pair : BulkSoundImportJobs)
+    {
+        const int64 JobId = Pair.Key;
+        FBulkSoundImportJob& Job = Pair.Value;
+        if (Job.bFinished)
+        {
+            continue;
+        }
+
+        // Take the files the workers have read; valid ones wait for the next batch
+        for (int32 Index = Job.Validating.Num() - 1; Index >= 0; --Index)
+        {
+            FBulkSoundImportValidating& Entry = Job.Validating[Index];
+            if (!Entry.Result.IsReady())
+            {
+                continue;
+            }
+
+            FBulkSoundImportValidation Validation = Entry.Result.Get();
+            if (Validation.Error.IsEmpty())
+            {
+                Job.ReadyToImport.Emplace(Entry.FileIndex, MoveTemp(Validation));
+            }
+            else
+            {
+                const FBulkSoundImportFile& File = Job.Files[Entry.FileIndex];
+                Job.Results.Add(MakeBulkSoundImportFailure(File.SourceFilePath, File.AssetName, Validation.Error));
+                Job.FailedCount++;
+            }
+            Job.Validating.RemoveAtSwap(Index);
+        }
+
+        // Keep MaxInFlight files being read and checked on worker threads
+        while (Job.NextQueued < Job.Files.Num() && Job.Validating.Num() < Job.MaxInFlight)
+        {
+            FBulkSoundImportValidating& Entry = Job.Validating.AddDefaulted_GetRef();
+            Entry.FileIndex = Job.NextQueued++;
+            Entry.Result = Async(EAsyncExecution::ThreadPool, [SourceFilePath = Job.Files[Entry.FileIndex].SourceFilePath]()
+            {
+                FBulkSoundImportValidation Validation;
+
+                TArray<uint8> FileData;
+                if (!FFileHelper::LoadFileToArray(FileData, *SourceFilePath, FILEREAD_Silent))
+                {
+                    Validation.Error = FString::Printf(TEXT("Could not read audio file: %s"), *SourceFilePath);
+                    return Validation;
+                }
+                if (FileData.Num() == 0)
+                {
+                    Validation.Error = FString::Printf(TEXT("Audio file is empty: %s"), *SourceFilePath);
+                    return Validation;
+                }
+
+                // WAV headers are parsed here so a corrupt file fails before the factory sees it
+                if (FPaths::GetExtension(SourceFilePath).Equals(TEXT("wav"), ESearchCase::IgnoreCase))
+                {
+                    FWaveModInfo WaveInfo;
+                    FString WaveError;
+                    if (!WaveInfo.ReadWaveInfo(FileData.GetData(), FileData.Num(), &WaveError))
+                    {
+                        Validation.Error = FString::Printf(TEXT("Invalid WAV file %s: %s"), *SourceFilePath, *WaveError);
+                        return Validation;
+                    }
+                    Validation.NumChannels = *WaveInfo.pChannels;
+                    Validation.SampleRate = static_cast<int32>(*WaveInfo.pSamplesPerSec);
+                }
+                return Validation;
+            });
+        }
+
+        // One import task call per full batch, or for the rest once every file is checked
+        const bool bAllValidated = Job.NextQueued >= Job.Files.Num() && Job.Validating.Num() == 0;
+        if (Job.ReadyToImport.Num() >= Job.BatchSize || (bAllValidated && Job.ReadyToImport.Num() > 0))
+        {
+            ImportBulkSoundBatch(Job);
+        }
+
+        if (bAllValidated && Job.ReadyToImport.Num() == 0)
+        {
+            if (Job.bSave)
+            {
+                TArray<UPackage*> Packages;
+                for (const TWeakObjectPtr<UPackage>& Package : Job.ImportedPackages)
+                {
+                    if (Package.IsValid())
+                    {
+                        Packages.Add(Package.Get());
+                    }
+                }
+                if (Packages.Num() > 0)
+                {
+                    UEditorLoadingAndSavingUtils::SavePackages(Packages, true);
+                }
+
+                // SavePackages reports only overall success; a package still dirty was not written
+                for (UPackage* Package : Packages)
+                {
+                    if (Package->IsDirty())
+                    {
+                        Job.UnsavedPackages.Add(Package->GetName());
+                    }
+                }
+            }
+
+            Job.bFinished = true;
+            Job.FinishTime = FPlatformTime::Seconds();
+            UE_LOG(LogSoundService, Log, TEXT("Bulk sound import job %lld finished: %d imported, %d failed, %d batch(es), %.1f s"),
+                JobId, Job.ImportedCount, Job.FailedCount, Job.BatchCount, Job.FinishTime - Job.StartTime);
+            continue;
+        }
+        bAnyRunning = true;
+    }
+
+    if (!bAnyRunning)
+    {
+        BulkSoundImportTickerHandle.Reset();
+    }
+    return bAnyRunning;
+}
+
+void FSoundService::ImportBulkSoundBatch(FBulkSoundImportJob& Job)
+{
+    const int32 BatchCount = FMath::Min(Job.ReadyToImport.Num(), Job.BatchSize);
+
+    TArray<UAssetImportTask*> ImportTasks;
+    ImportTasks.Reserve(BatchCount);
+    for (int32 Index = 0; Index < BatchCount; ++Index)
+    {
+        const FBulkSoundImportFile& File = Job.Files[Job.ReadyToImport[Index].Key];
+
+        UAssetImportTask* ImportTask = NewObject<UAssetImportTask>();
+        ImportTask->Filename = File.SourceFilePath;
+        ImportTask->DestinationPath = Job.FolderPath;
+        ImportTask->DestinationName = File.AssetName;
+        ImportTask->bReplaceExisting = Job.bReplaceExisting;
+        ImportTask->bAutomated = true;
+        // Saved together when the job finishes, not one package per task
+        ImportTask->bSave = false;
+        ImportTasks.Add(ImportTask);
+    }
+
+    IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+    AssetTools.ImportAssetTasks(ImportTasks);
+    Job.BatchCount++;
+
+    for (int32 Index = 0; Index < BatchCount; ++Index)
+    {
+        const FBulkSoundImportFile& File = Job.Files[Job.ReadyToImport[Index].Key];
+        const FBulkSoundImportValidation& Validation = Job.ReadyToImport[Index].Value;
+        const UAssetImportTask* ImportTask = ImportTasks[Index];
+
+        USoundWave* ImportedSound = ImportTask->ImportedObjectPaths.Num() > 0 ? FindSoundWave(ImportTask->ImportedObjectPaths[0]) : nullptr;
+        if (!ImportedSound)
+        {
+            Job.Results.Add(MakeBulkSoundImportFailure(File.SourceFilePath, File.AssetName, ImportTask->ImportedObjectPaths.Num() > 0
+                ? FString::Printf(TEXT("Import succeeded but asset is not a SoundWave: %s"), *ImportTask->ImportedObjectPaths[0])
+                : FString::Printf(TEXT("Failed to import audio file: %s"), *File.SourceFilePath)));
+            Job.FailedCount++;
+            continue;
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("source_file_path"), File.SourceFilePath);
+        Result->SetStringField(TEXT("asset_name"), File.AssetName);
+        Result->SetBoolField(TEXT("imported"), true);
+        Result->SetStringField(TEXT("asset_path"), ImportTask->ImportedObjectPaths[0]);
+        Result->SetNumberField(TEXT("duration"), ImportedSound->Duration);
+        Result->SetNumberField(TEXT("num_channels"), ImportedSound->NumChannels);
+        if (Validation.SampleRate > 0)
+        {
+            Result->SetNumberField(TEXT("sample_rate"), Validation.SampleRate);
+        }
+        Result->SetNumberField(TEXT("batch"), Job.BatchCount);
+        Job.Results.Add(Result);
+
+        Job.ImportedPackages.Add(ImportedSound->GetOutermost());
+        Job.ImportedCount++;
+    }
+
+    Job.ReadyToImport.RemoveAt(0, BatchCount);
+}
+
+bool FSoundService::GetBulkSoundImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    check(IsInGameThread());
+
+    const FBulkSoundImportJob* Job = BulkSoundImportJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown bulk sound import job: %lld"), JobId);
+        return false;
+    }
+
+    const int32 FilesTotal = Job->FileCount;
+    const int32 First = FMath::Clamp(Cursor, 0, Job->Results.Num());
+    const int32 Last = FMath::Min(Job->Results.Num(), First + FMath::Max(MaxResults, 0));
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Job->Results[Index]));
+    }
+
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutStatus->SetStringField(TEXT("state"), Job->bFinished ? TEXT("finished") : TEXT("running"));
+    OutStatus->SetNumberField(TEXT("elapsed_seconds"), (Job->bFinished ? Job->FinishTime : FPlatformTime::Seconds()) - Job->StartTime);
+    OutStatus->SetNumberField(TEXT("files_total"), FilesTotal);
+    OutStatus->SetNumberField(TEXT("files_completed"), Job->Results.Num());
+    OutStatus->SetNumberField(TEXT("files_validating"), Job->Validating.Num());
+    OutStatus->SetNumberField(TEXT("files_waiting_for_batch"), Job->ReadyToImport.Num());
+    OutStatus->SetNumberField(TEXT("files_imported"), Job->ImportedCount);
+    OutStatus->SetNumberField(TEXT("files_failed"), Job->FailedCount);
+    OutStatus->SetNumberField(TEXT("batches_imported"), Job->BatchCount);
+    OutStatus->SetNumberField(TEXT("progress"), FilesTotal > 0 ? static_cast<double>(Job->Results.Num()) / FilesTotal : 1.0);
+    if (Job->bFinished && Job->bSave)
+    {
+        TArray<TSharedPtr<FJsonValue>> UnsavedArray;
+        for (const FString& PackageName : Job->UnsavedPackages)
+        {
+            UnsavedArray.Add(MakeShared<FJsonValueString>(PackageName));
+        }
+        OutStatus->SetArrayField(TEXT("unsaved_packages"), UnsavedArray);
+    }
+    OutStatus->SetArrayField(TEXT("results"), ResultsArray);
+    OutStatus->SetNumberField(TEXT("next_cursor"), Last);
+    OutStatus->SetBoolField(TEXT("has_more"), Last < Job->Results.Num() || !Job->bFinished);
+    return true;
+}
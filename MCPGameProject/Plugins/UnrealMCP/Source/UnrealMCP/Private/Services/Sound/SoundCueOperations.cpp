@@ -14,6 +14,300 @@
 #include "Sound/SoundNodeConcatenator.h"
 #include "Sound/SoundNodeAttenuation.h"
 #include "Dom/JsonValue.h"
+#include "EdGraph/EdGraphNode.h"
+#include "MCPBatchEditScope.h"
+
+namespace
+{
+    /** Append one element result to a build report */
+    void AddSoundCueSpecElement(TArray<TSharedPtr<FJsonValue>>& OutElements, int32& OutFailedCount, const TCHAR* Kind,
+                                const FString& ElementName, bool bSucceeded, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Element = MakeShared<FJsonObject>();
+        Element->SetStringField(TEXT("kind"), Kind);
+        Element->SetStringField(TEXT("name"), ElementName);
+        Element->SetBoolField(TEXT("success"), bSucceeded);
+        if (!bSucceeded)
+        {
+            Element->SetStringField(TEXT("error"), Error.IsEmpty() ? TEXT("Unknown error") : Error);
+            OutFailedCount++;
+        }
+        OutElements.Add(MakeShared<FJsonValueObject>(Element));
+    }
+
+    // The edits below change the sound nodes only. Callers link the editor graph, compile and
+    // save afterwards, once per command.
+
+    /** Construct a node of one of the supported types */
+    USoundNode* ConstructSoundCueNode(FSoundService& Service, USoundCue& SoundCue, const FString& NodeTypeName, const FString& SoundWavePath, FString& OutError)
+    {
+        USoundNode* NewNode = nullptr;
+        const FString NodeType = NodeTypeName.ToLower();
+
+        // Create the appropriate node type
+        if (NodeType == TEXT("waveplayer") || NodeType == TEXT("wave_player"))
+        {
+            USoundNodeWavePlayer* WavePlayer = SoundCue.ConstructSoundNode<USoundNodeWavePlayer>();
+            if (WavePlayer && !SoundWavePath.IsEmpty())
+            {
+                USoundWave* SoundWave = Service.FindSoundWave(SoundWavePath);
+                if (SoundWave)
+                {
+                    WavePlayer->SetSoundWave(SoundWave);
+                }
+                else
+                {
+                    UE_LOG(LogSoundService, Warning, TEXT("Sound wave not found: %s"), *SoundWavePath);
+                }
+            }
+            NewNode = WavePlayer;
+        }
+        else if (NodeType == TEXT("mixer"))
+        {
+            NewNode = SoundCue.ConstructSoundNode<USoundNodeMixer>();
+        }
+        else if (NodeType == TEXT("random"))
+        {
+            NewNode = SoundCue.ConstructSoundNode<USoundNodeRandom>();
+        }
+        else if (NodeType == TEXT("modulator"))
+        {
+            USoundNodeModulator* Modulator = SoundCue.ConstructSoundNode<USoundNodeModulator>();
+            if (Modulator)
+            {
+                // Set default ranges
+                Modulator->PitchMin = 1.0f;
+                Modulator->PitchMax = 1.0f;
+                Modulator->VolumeMin = 1.0f;
+                Modulator->VolumeMax = 1.0f;
+            }
+            NewNode = Modulator;
+        }
+        else if (NodeType == TEXT("looping"))
+        {
+            USoundNodeLooping* Looping = SoundCue.ConstructSoundNode<USoundNodeLooping>();
+            if (Looping)
+            {
+                Looping->LoopCount = 1;
+                Looping->bLoopIndefinitely = false;
+            }
+            NewNode = Looping;
+        }
+        else if (NodeType == TEXT("delay"))
+        {
+            NewNode = SoundCue.ConstructSoundNode<USoundNodeDelay>();
+        }
+        else if (NodeType == TEXT("concatenator"))
+        {
+            NewNode = SoundCue.ConstructSoundNode<USoundNodeConcatenator>();
+        }
+        else if (NodeType == TEXT("attenuation"))
+        {
+            NewNode = SoundCue.ConstructSoundNode<USoundNodeAttenuation>();
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown node type: %s. Valid types: WavePlayer, Mixer, Random, Modulator, Looping, Delay, Concatenator, Attenuation"), *NodeTypeName);
+            return nullptr;
+        }
+
+        if (!NewNode)
+        {
+            OutError = FString::Printf(TEXT("Failed to create node of type: %s"), *NodeTypeName);
+        }
+        return NewNode;
+    }
+
+#if WITH_EDITORONLY_DATA
+    /** Node of a Sound Cue by object name */
+    USoundNode* FindSoundCueNode(const USoundCue& SoundCue, const FString& NodeId)
+    {
+        for (USoundNode* Node : SoundCue.AllNodes)
+        {
+            if (Node && Node->GetName() == NodeId)
+            {
+                return Node;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Make a node the child of another at an input, or the cue's output when the target is "Output" */
+    bool ConnectSoundCueNode(USoundCue& SoundCue, USoundNode* SourceNode, USoundNode* TargetNode, int32 TargetPinIndex, FString& OutError)
+    {
+        if (!TargetNode)
+        {
+            SoundCue.FirstNode = SourceNode;
+            return true;
+        }
+
+        // Validate pin index against max children
+        const int32 MaxChildren = TargetNode->GetMaxChildNodes();
+        if (TargetPinIndex < 0 || TargetPinIndex >= MaxChildren)
+        {
+            OutError = FString::Printf(TEXT("Target pin index %d exceeds max children %d for node type %s"),
+                TargetPinIndex, MaxChildren, *TargetNode->GetClass()->GetName());
+            return false;
+        }
+
+        // Use InsertChildNode to properly add child slots with graph pin synchronization
+        // This ensures InputPins.Num() == ChildNodes.Num() is maintained
+        while (TargetNode->ChildNodes.Num() <= TargetPinIndex)
+        {
+            const int32 NewChildIndex = TargetNode->ChildNodes.Num();
+            TargetNode->InsertChildNode(NewChildIndex);
+        }
+
+        // Make the connection
+        TargetNode->ChildNodes[TargetPinIndex] = SourceNode;
+        return true;
+    }
+
+    /** Apply one property to a node of a supported type */
+    bool SetSoundCueNodePropertyValue(FSoundService& Service, USoundNode* TargetNode, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError)
+    {
+        if (!PropertyValue.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Missing value for property '%s'"), *PropertyName);
+            return false;
+        }
+
+        TargetNode->Modify();
+        const FString PropLower = PropertyName.ToLower();
+
+        // Handle WavePlayer properties
+        if (USoundNodeWavePlayer* WavePlayer = Cast<USoundNodeWavePlayer>(TargetNode))
+        {
+            if (PropLower == TEXT("looping") || PropLower == TEXT("blooping"))
+            {
+                WavePlayer->bLooping = PropertyValue->AsBool();
+            }
+            else if (PropLower == TEXT("sound_wave") || PropLower == TEXT("soundwave"))
+            {
+                FString WavePath = PropertyValue->AsString();
+                USoundWave* SoundWave = Service.FindSoundWave(WavePath);
+                if (SoundWave)
+                {
+                    WavePlayer->SetSoundWave(SoundWave);
+                }
+                else
+                {
+                    OutError = FString::Printf(TEXT("Sound wave not found: %s"), *WavePath);
+                    return false;
+                }
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Unknown property '%s' for WavePlayer node"), *PropertyName);
+                return false;
+            }
+        }
+        // Handle Mixer properties
+        else if (USoundNodeMixer* Mixer = Cast<USoundNodeMixer>(TargetNode))
+        {
+            if (PropLower == TEXT("input_volume") || PropLower == TEXT("inputvolume"))
+            {
+                // Expect an array or index:value pair
+                if (PropertyValue->Type == EJson::Array)
+                {
+                    Mixer->InputVolume.Empty();
+                    for (auto& Val : PropertyValue->AsArray())
+                    {
+                        Mixer->InputVolume.Add(static_cast<float>(Val->AsNumber()));
+                    }
+                }
+                else
+                {
+                    OutError = TEXT("input_volume expects an array of floats");
+                    return false;
+                }
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Unknown property '%s' for Mixer node"), *PropertyName);
+                return false;
+            }
+        }
+        // Handle Random properties
+        else if (USoundNodeRandom* Random = Cast<USoundNodeRandom>(TargetNode))
+        {
+            if (PropLower == TEXT("weights"))
+            {
+                if (PropertyValue->Type == EJson::Array)
+                {
+                    Random->Weights.Empty();
+                    for (auto& Val : PropertyValue->AsArray())
+                    {
+                        Random->Weights.Add(static_cast<float>(Val->AsNumber()));
+                    }
+                }
+                else
+                {
+                    OutError = TEXT("weights expects an array of floats");
+                    return false;
+                }
+            }
+            else if (PropLower == TEXT("randomize_without_replacement") || PropLower == TEXT("brandomizewithoutreplacement"))
+            {
+                Random->bRandomizeWithoutReplacement = PropertyValue->AsBool();
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Unknown property '%s' for Random node"), *PropertyName);
+                return false;
+            }
+        }
+        // Handle Modulator properties
+        else if (USoundNodeModulator* Modulator = Cast<USoundNodeModulator>(TargetNode))
+        {
+            if (PropLower == TEXT("pitch_min") || PropLower == TEXT("pitchmin"))
+            {
+                Modulator->PitchMin = static_cast<float>(PropertyValue->AsNumber());
+            }
+            else if (PropLower == TEXT("pitch_max") || PropLower == TEXT("pitchmax"))
+            {
+                Modulator->PitchMax = static_cast<float>(PropertyValue->AsNumber());
+            }
+            else if (PropLower == TEXT("volume_min") || PropLower == TEXT("volumemin"))
+            {
+                Modulator->VolumeMin = static_cast<float>(PropertyValue->AsNumber());
+            }
+            else if (PropLower == TEXT("volume_max") || PropLower == TEXT("volumemax"))
+            {
+                Modulator->VolumeMax = static_cast<float>(PropertyValue->AsNumber());
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Unknown property '%s' for Modulator node. Valid: pitch_min, pitch_max, volume_min, volume_max"), *PropertyName);
+                return false;
+            }
+        }
+        // Handle Looping properties
+        else if (USoundNodeLooping* Looping = Cast<USoundNodeLooping>(TargetNode))
+        {
+            if (PropLower == TEXT("loop_count") || PropLower == TEXT("loopcount"))
+            {
+                Looping->LoopCount = static_cast<int32>(PropertyValue->AsNumber());
+            }
+            else if (PropLower == TEXT("loop_indefinitely") || PropLower == TEXT("bloopindefinitely"))
+            {
+                Looping->bLoopIndefinitely = PropertyValue->AsBool();
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Unknown property '%s' for Looping node. Valid: loop_count, loop_indefinitely"), *PropertyName);
+                return false;
+            }
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Node type '%s' does not support property setting via this interface"), *TargetNode->GetClass()->GetName());
+            return false;
+        }
+        return true;
+    }
+#endif
+}
 
 // ============================================================================
 // Sound Cue Operations
@@ -198,79 +492,9 @@ bool FSoundService::AddSoundCueNode(const FSoundCueNodeParams& Params, FString&
 
     SoundCue->Modify();
 
-    USoundNode* NewNode = nullptr;
-    FString NodeType = Params.NodeType.ToLower();
-
-    // Create the appropriate node type
-    if (NodeType == TEXT("waveplayer") || NodeType == TEXT("wave_player"))
-    {
-        USoundNodeWavePlayer* WavePlayer = SoundCue->ConstructSoundNode<USoundNodeWavePlayer>();
-        if (WavePlayer && !Params.SoundWavePath.IsEmpty())
-        {
-            USoundWave* SoundWave = FindSoundWave(Params.SoundWavePath);
-            if (SoundWave)
-            {
-                WavePlayer->SetSoundWave(SoundWave);
-            }
-            else
-            {
-                UE_LOG(LogSoundService, Warning, TEXT("Sound wave not found: %s"), *Params.SoundWavePath);
-            }
-        }
-        NewNode = WavePlayer;
-    }
-    else if (NodeType == TEXT("mixer"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeMixer>();
-    }
-    else if (NodeType == TEXT("random"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeRandom>();
-    }
-    else if (NodeType == TEXT("modulator"))
-    {
-        USoundNodeModulator* Modulator = SoundCue->ConstructSoundNode<USoundNodeModulator>();
-        if (Modulator)
-        {
-            // Set default ranges
-            Modulator->PitchMin = 1.0f;
-            Modulator->PitchMax = 1.0f;
-            Modulator->VolumeMin = 1.0f;
-            Modulator->VolumeMax = 1.0f;
-        }
-        NewNode = Modulator;
-    }
-    else if (NodeType == TEXT("looping"))
-    {
-        USoundNodeLooping* Looping = SoundCue->ConstructSoundNode<USoundNodeLooping>();
-        if (Looping)
-        {
-            Looping->LoopCount = 1;
-            Looping->bLoopIndefinitely = false;
-        }
-        NewNode = Looping;
-    }
-    else if (NodeType == TEXT("delay"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeDelay>();
-    }
-    else if (NodeType == TEXT("concatenator"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeConcatenator>();
-    }
-    else if (NodeType == TEXT("attenuation"))
-    {
-        NewNode = SoundCue->ConstructSoundNode<USoundNodeAttenuation>();
-    }
-    else
-    {
-        OutError = FString::Printf(TEXT("Unknown node type: %s. Valid types: WavePlayer, Mixer, Random, Modulator, Looping, Delay, Concatenator, Attenuation"), *Params.NodeType);
-        return false;
-    }
-
+    USoundNode* NewNode = ConstructSoundCueNode(*this, *SoundCue, Params.NodeType, Params.SoundWavePath, OutError);
     if (!NewNode)
     {
-        OutError = FString::Printf(TEXT("Failed to create node of type: %s"), *Params.NodeType);
         return false;
     }
 
@@ -304,68 +528,30 @@ bool FSoundService::ConnectSoundCueNodes(const FString& SoundCuePath, const FStr
 
 #if WITH_EDITORONLY_DATA
     // Find the source node
-    USoundNode* SourceNode = nullptr;
-    for (USoundNode* Node : SoundCue->AllNodes)
-    {
-        if (Node && Node->GetName() == SourceNodeId)
-        {
-            SourceNode = Node;
-            break;
-        }
-    }
-
+    USoundNode* SourceNode = FindSoundCueNode(*SoundCue, SourceNodeId);
     if (!SourceNode)
     {
         OutError = FString::Printf(TEXT("Source node not found: %s"), *SourceNodeId);
         return false;
     }
 
-    // Check if target is "Output" - meaning connect to FirstNode (root)
-    if (TargetNodeId.Equals(TEXT("Output"), ESearchCase::IgnoreCase))
-    {
-        SoundCue->FirstNode = SourceNode;
-        UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to Sound Cue Output"), *SourceNodeId);
-    }
-    else
+    // "Output" means connect to FirstNode (root)
+    USoundNode* TargetNode = nullptr;
+    if (!TargetNodeId.Equals(TEXT("Output"), ESearchCase::IgnoreCase))
     {
-        // Find the target node
-        USoundNode* TargetNode = nullptr;
-        for (USoundNode* Node : SoundCue->AllNodes)
-        {
-            if (Node && Node->GetName() == TargetNodeId)
-            {
-                TargetNode = Node;
-                break;
-            }
-        }
-
+        TargetNode = FindSoundCueNode(*SoundCue, TargetNodeId);
         if (!TargetNode)
         {
             OutError = FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId);
             return false;
         }
+    }
 
-        // Validate pin index against max children
-        int32 MaxChildren = TargetNode->GetMaxChildNodes();
-        if (TargetPinIndex >= MaxChildren)
-        {
-            OutError = FString::Printf(TEXT("Target pin index %d exceeds max children %d for node type %s"),
-                TargetPinIndex, MaxChildren, *TargetNode->GetClass()->GetName());
-            return false;
-        }
-
-        // Use InsertChildNode to properly add child slots with graph pin synchronization
-        // This ensures InputPins.Num() == ChildNodes.Num() is maintained
-        while (TargetNode->ChildNodes.Num() <= TargetPinIndex)
-        {
-            int32 NewChildIndex = TargetNode->ChildNodes.Num();
-            TargetNode->InsertChildNode(NewChildIndex);
-        }
-
-        // Make the connection
-        TargetNode->ChildNodes[TargetPinIndex] = SourceNode;
-        UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to '%s' at pin %d"), *SourceNodeId, *TargetNodeId, TargetPinIndex);
+    if (!ConnectSoundCueNode(*SoundCue, SourceNode, TargetNode, TargetPinIndex, OutError))
+    {
+        return false;
     }
+    UE_LOG(LogSoundService, Log, TEXT("Connected '%s' to '%s' at pin %d"), *SourceNodeId, *TargetNodeId, TargetPinIndex);
 
 #if WITH_EDITOR
     // Update the editor graph to reflect the new connection
@@ -399,152 +585,15 @@ bool FSoundService::SetSoundCueNodeProperty(const FString& SoundCuePath, const F
 
 #if WITH_EDITORONLY_DATA
     // Find the node
-    USoundNode* TargetNode = nullptr;
-    for (USoundNode* Node : SoundCue->AllNodes)
-    {
-        if (Node && Node->GetName() == NodeId)
-        {
-            TargetNode = Node;
-            break;
-        }
-    }
-
+    USoundNode* TargetNode = FindSoundCueNode(*SoundCue, NodeId);
     if (!TargetNode)
     {
         OutError = FString::Printf(TEXT("Node not found: %s"), *NodeId);
         return false;
     }
 
-    TargetNode->Modify();
-    FString PropLower = PropertyName.ToLower();
-
-    // Handle WavePlayer properties
-    if (USoundNodeWavePlayer* WavePlayer = Cast<USoundNodeWavePlayer>(TargetNode))
+    if (!SetSoundCueNodePropertyValue(*this, TargetNode, PropertyName, PropertyValue, OutError))
     {
-        if (PropLower == TEXT("looping") || PropLower == TEXT("blooping"))
-        {
-            WavePlayer->bLooping = PropertyValue->AsBool();
-        }
-        else if (PropLower == TEXT("sound_wave") || PropLower == TEXT("soundwave"))
-        {
-            FString WavePath = PropertyValue->AsString();
-            USoundWave* SoundWave = FindSoundWave(WavePath);
-            if (SoundWave)
-            {
-                WavePlayer->SetSoundWave(SoundWave);
-            }
-            else
-            {
-                OutError = FString::Printf(TEXT("Sound wave not found: %s"), *WavePath);
-                return false;
-            }
-        }
-        else
-        {
-            OutError = FString::Printf(TEXT("Unknown property '%s' for WavePlayer node"), *PropertyName);
-            return false;
-        }
-    }
-    // Handle Mixer properties
-    else if (USoundNodeMixer* Mixer = Cast<USoundNodeMixer>(TargetNode))
-    {
-        if (PropLower == TEXT("input_volume") || PropLower == TEXT("inputvolume"))
-        {
-            // Expect an array or index:value pair
-            if (PropertyValue->Type == EJson::Array)
-            {
-                Mixer->InputVolume.Empty();
-                for (auto& Val : PropertyValue->AsArray())
-                {
-                    Mixer->InputVolume.Add(static_cast<float>(Val->AsNumber()));
-                }
-            }
-            else
-            {
-                OutError = TEXT("input_volume expects an array of floats");
-                return false;
-            }
-        }
-        else
-        {
-            OutError = FString::Printf(TEXT("Unknown property '%s' for Mixer node"), *PropertyName);
-            return false;
-        }
-    }
-    // Handle Random properties
-    else if (USoundNodeRandom* Random = Cast<USoundNodeRandom>(TargetNode))
-    {
-        if (PropLower == TEXT("weights"))
-        {
-            if (PropertyValue->Type == EJson::Array)
-            {
-                Random->Weights.Empty();
-                for (auto& Val : PropertyValue->AsArray())
-                {
-                    Random->Weights.Add(static_cast<float>(Val->AsNumber()));
-                }
-            }
-            else
-            {
-                OutError = TEXT("weights expects an array of floats");
-                return false;
-            }
-        }
-        else if (PropLower == TEXT("randomize_without_replacement") || PropLower == TEXT("brandomizewithoutreplacement"))
-        {
-            Random->bRandomizeWithoutReplacement = PropertyValue->AsBool();
-        }
-        else
-        {
-            OutError = FString::Printf(TEXT("Unknown property '%s' for Random node"), *PropertyName);
-            return false;
-        }
-    }
-    // Handle Modulator properties
-    else if (USoundNodeModulator* Modulator = Cast<USoundNodeModulator>(TargetNode))
-    {
-        if (PropLower == TEXT("pitch_min") || PropLower == TEXT("pitchmin"))
-        {
-            Modulator->PitchMin = static_cast<float>(PropertyValue->AsNumber());
-        }
-        else if (PropLower == TEXT("pitch_max") || PropLower == TEXT("pitchmax"))
-        {
-            Modulator->PitchMax = static_cast<float>(PropertyValue->AsNumber());
-        }
-        else if (PropLower == TEXT("volume_min") || PropLower == TEXT("volumemin"))
-        {
-            Modulator->VolumeMin = static_cast<float>(PropertyValue->AsNumber());
-        }
-        else if (PropLower == TEXT("volume_max") || PropLower == TEXT("volumemax"))
-        {
-            Modulator->VolumeMax = static_cast<float>(PropertyValue->AsNumber());
-        }
-        else
-        {
-            OutError = FString::Printf(TEXT("Unknown property '%s' for Modulator node. Valid: pitch_min, pitch_max, volume_min, volume_max"), *PropertyName);
-            return false;
-        }
-    }
-    // Handle Looping properties
-    else if (USoundNodeLooping* Looping = Cast<USoundNodeLooping>(TargetNode))
-    {
-        if (PropLower == TEXT("loop_count") || PropLower == TEXT("loopcount"))
-        {
-            Looping->LoopCount = static_cast<int32>(PropertyValue->AsNumber());
-        }
-        else if (PropLower == TEXT("loop_indefinitely") || PropLower == TEXT("bloopindefinitely"))
-        {
-            Looping->bLoopIndefinitely = PropertyValue->AsBool();
-        }
-        else
-        {
-            OutError = FString::Printf(TEXT("Unknown property '%s' for Looping node. Valid: loop_count, loop_indefinitely"), *PropertyName);
-            return false;
-        }
-    }
-    else
-    {
-        OutError = FString::Printf(TEXT("Node type '%s' does not support property setting via this interface"), *TargetNode->GetClass()->GetName());
         return false;
     }
 
@@ -677,3 +726,159 @@ bool FSoundService::CompileSoundCue(const FString& SoundCuePath, FString& OutErr
     return false;
 #endif
 }
+
+bool FSoundService::BuildSoundCueFromSpec(const FBuildSoundCueFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+#if WITH_EDITOR
+    // One undo step; the saves below are queued and written once when the scope closes
+    FMCPBatchEditScope EditScope(FText::FromString(TEXT("MCP Build Sound Cue From Spec")));
+
+    USoundCue* SoundCue = nullptr;
+    bool bCreated = false;
+    if (!Params.SoundCuePath.IsEmpty())
+    {
+        SoundCue = FindSoundCue(Params.SoundCuePath);
+        if (!SoundCue)
+        {
+            OutError = FString::Printf(TEXT("Sound Cue not found: %s"), *Params.SoundCuePath);
+            return false;
+        }
+    }
+    else
+    {
+        FString CreatedPath;
+        SoundCue = CreateSoundCue(Params.Creation, CreatedPath, OutError);
+        if (!SoundCue)
+        {
+            return false;
+        }
+        bCreated = true;
+    }
+
+    const FString SoundCuePath = SoundCue->GetPathName();
+    UE_LOG(LogSoundService, Log, TEXT("Building Sound Cue '%s' from spec: %d node(s), %d connection(s)"),
+        *SoundCuePath, Params.Nodes.Num(), Params.Connections.Num());
+
+    SoundCue->Modify();
+
+    TArray<TSharedPtr<FJsonValue>> Elements;
+    int32 FailedCount = 0;
+
+    // Nodes the connections can refer to by spec key
+    TMap<FString, USoundNode*> NodesByKey;
+    TArray<TPair<USoundNode*, FIntPoint>> NodePositions;
+    TSharedPtr<FJsonObject> NodeIds = MakeShared<FJsonObject>();
+
+    for (const FSoundCueSpecNode& SpecNode : Params.Nodes)
+    {
+        const FString NodeName = SpecNode.Key.IsEmpty() ? SpecNode.NodeType : SpecNode.Key;
+        FString Error;
+        USoundNode* NewNode = ConstructSoundCueNode(*this, *SoundCue, SpecNode.NodeType, SpecNode.SoundWavePath, Error);
+        AddSoundCueSpecElement(Elements, FailedCount, TEXT("node"), NodeName, NewNode != nullptr, Error);
+        if (!NewNode)
+        {
+            continue;
+        }
+
+        if (!SpecNode.Key.IsEmpty())
+        {
+            NodesByKey.Add(SpecNode.Key, NewNode);
+            NodeIds->SetStringField(SpecNode.Key, NewNode->GetName());
+        }
+        NodePositions.Emplace(NewNode, FIntPoint(SpecNode.PosX, SpecNode.PosY));
+
+        if (SpecNode.Properties.IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : SpecNode.Properties->Values)
+            {
+                FString PropertyError;
+                const bool bSet = SetSoundCueNodePropertyValue(*this, NewNode, Property.Key, Property.Value, PropertyError);
+                AddSoundCueSpecElement(Elements, FailedCount, TEXT("property"),
+                    FString::Printf(TEXT("%s.%s"), *NodeName, *Property.Key), bSet, PropertyError);
+            }
+        }
+    }
+
+    // A connection end is a spec node or a node already in the cue
+    auto ResolveNode = [&SoundCue, &NodesByKey](const FString& NodeName) -> USoundNode*
+    {
+        if (USoundNode* const* SpecNode = NodesByKey.Find(NodeName))
+        {
+            return *SpecNode;
+        }
+        return FindSoundCueNode(*SoundCue, NodeName);
+    };
+
+    for (const FSoundCueSpecConnection& Connection : Params.Connections)
+    {
+        const FString ConnectionName = FString::Printf(TEXT("%s -> %s[%d]"), *Connection.SourceNode, *Connection.TargetNode, Connection.TargetPinIndex);
+        FString Error;
+        bool bConnected = false;
+
+        USoundNode* SourceNode = ResolveNode(Connection.SourceNode);
+        const bool bToOutput = Connection.TargetNode.Equals(TEXT("Output"), ESearchCase::IgnoreCase);
+        USoundNode* TargetNode = bToOutput ? nullptr : ResolveNode(Connection.TargetNode);
+        if (!SourceNode)
+        {
+            Error = FString::Printf(TEXT("Source node not found: %s"), *Connection.SourceNode);
+        }
+        else if (!bToOutput && !TargetNode)
+        {
+            Error = FString::Printf(TEXT("Target node not found: %s"), *Connection.TargetNode);
+        }
+        else
+        {
+            bConnected = ConnectSoundCueNode(*SoundCue, SourceNode, TargetNode, Connection.TargetPinIndex, Error);
+        }
+        AddSoundCueSpecElement(Elements, FailedCount, TEXT("connection"), ConnectionName, bConnected, Error);
+    }
+
+    // One editor graph sync for every node and connection, then the spec's positions
+    SoundCue->LinkGraphNodesFromSoundNodes();
+    for (const TPair<USoundNode*, FIntPoint>& NodePosition : NodePositions)
+    {
+        if (UEdGraphNode* GraphNode = NodePosition.Key->GetGraphNode())
+        {
+            GraphNode->NodePosX = NodePosition.Value.X;
+            GraphNode->NodePosY = NodePosition.Value.Y;
+        }
+    }
+
+    if (Params.bCompile)
+    {
+        SoundCue->CompileSoundNodesFromGraphNodes();
+        SoundCue->CacheAggregateValues();
+    }
+
+    // One change notification refreshes an open Sound Cue editor
+    SoundCue->PostEditChange();
+    SoundCue->MarkPackageDirty();
+
+    FString SaveError;
+    if (!SaveAsset(SoundCue, SaveError))
+    {
+        UE_LOG(LogSoundService, Warning, TEXT("Failed to save Sound Cue after build: %s"), *SaveError);
+    }
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("sound_cue_path"), SoundCuePath);
+    OutReport->SetBoolField(TEXT("created"), bCreated);
+    OutReport->SetObjectField(TEXT("node_ids"), NodeIds);
+    OutReport->SetNumberField(TEXT("element_count"), Elements.Num());
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("elements"), Elements);
+    OutReport->SetBoolField(TEXT("compile_requested"), Params.bCompile);
+    OutReport->SetBoolField(TEXT("has_output"), SoundCue->FirstNode != nullptr);
+    if (Params.bCompile)
+    {
+        OutReport->SetNumberField(TEXT("duration"), SoundCue->Duration);
+        OutReport->SetNumberField(TEXT("max_distance"), SoundCue->GetMaxDistance());
+    }
+
+    UE_LOG(LogSoundService, Log, TEXT("Built Sound Cue '%s': %d element(s), %d failed"), *SoundCuePath, Elements.Num(), FailedCount);
+    return true;
+#else
+    OutError = TEXT("Sound Cue editing requires editor");
+    return false;
+#endif
+}
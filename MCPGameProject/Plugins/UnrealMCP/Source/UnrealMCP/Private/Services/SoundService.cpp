@@ -17,6 +17,9 @@
 #include "AssetImportTask.h"
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
+#include "MCPSaveQueue.h"
+#include "Services/SoundWaveSummaryCache.h"
+#include "Misc/PackageName.h"
 
 DEFINE_LOG_CATEGORY(LogSoundService);
 
@@ -122,34 +125,137 @@ bool FSoundService::ImportSoundFile(const FSoundWaveImportParams& Params, FStrin
     return true;
 }
 
-bool FSoundService::GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError)
+bool FSoundService::GetSoundWaveMetadata(const FString& SoundWavePath, bool bAllowLoad, bool bIncludeEnvelope, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError)
 {
-    USoundWave* SoundWave = FindSoundWave(SoundWavePath);
-    if (!SoundWave)
+    // Package paths name the asset of the same name
+    FSoftObjectPath ObjectPath(SoundWavePath);
+    if (ObjectPath.GetAssetName().IsEmpty() && FPackageName::IsValidLongPackageName(SoundWavePath))
     {
-        OutError = FString::Printf(TEXT("Sound wave not found: %s"), *SoundWavePath);
-        return false;
+        ObjectPath = FSoftObjectPath(SoundWavePath + TEXT(".") + FPackageName::GetShortName(SoundWavePath));
+    }
+    const FString PackageName = ObjectPath.GetLongPackageName();
+
+    FSoundWaveSummaryCache& SummaryCache = FSoundWaveSummaryCache::Get();
+    const FSoundWaveSummaryCache::FSummary* Summary = nullptr;
+    FString Source;
+
+    // A loaded wave may have unsaved edits, so it is read rather than its kept summary
+    USoundWave* SoundWave = Cast<USoundWave>(ObjectPath.ResolveObject());
+    if (!SoundWave && !PackageName.IsEmpty())
+    {
+        Summary = SummaryCache.Find(PackageName);
+        Source = TEXT("cache");
+    }
+    if (!Summary && !SoundWave && bAllowLoad)
+    {
+        SoundWave = FindSoundWave(SoundWavePath);
+    }
+
+    if (SoundWave)
+    {
+        bool bWasCached = false;
+        Summary = &SummaryCache.FindOrCompute(*SoundWave, bWasCached);
+        Source = bWasCached ? TEXT("cache") : TEXT("loaded");
     }
 
     OutMetadata = MakeShared<FJsonObject>();
-    OutMetadata->SetStringField(TEXT("name"), SoundWave->GetName());
+    OutMetadata->SetStringField(TEXT("name"), ObjectPath.GetAssetName());
     OutMetadata->SetStringField(TEXT("path"), SoundWavePath);
-    OutMetadata->SetNumberField(TEXT("duration"), SoundWave->Duration);
-    OutMetadata->SetNumberField(TEXT("sample_rate"), SoundWave->GetSampleRateForCurrentPlatform());
-    OutMetadata->SetNumberField(TEXT("num_channels"), SoundWave->NumChannels);
-    OutMetadata->SetBoolField(TEXT("is_looping"), SoundWave->bLooping);
-    OutMetadata->SetNumberField(TEXT("volume"), SoundWave->Volume);
-    OutMetadata->SetNumberField(TEXT("pitch"), SoundWave->Pitch);
+
+    if (!Summary)
+    {
+        if (bAllowLoad || !DescribeSoundWaveFromRegistry(ObjectPath, OutMetadata))
+        {
+            OutError = FString::Printf(TEXT("Sound wave not found: %s"), *SoundWavePath);
+            return false;
+        }
+        OutMetadata->SetStringField(TEXT("source"), TEXT("registry"));
+        OutMetadata->SetBoolField(TEXT("has_levels"), false);
+        return true;
+    }
+
+    OutMetadata->SetStringField(TEXT("source"), Source);
+    OutMetadata->SetNumberField(TEXT("duration"), Summary->Duration);
+    OutMetadata->SetNumberField(TEXT("sample_rate"), Summary->SampleRate);
+    OutMetadata->SetNumberField(TEXT("num_channels"), Summary->NumChannels);
+    OutMetadata->SetBoolField(TEXT("is_looping"), Summary->bLooping);
+    OutMetadata->SetNumberField(TEXT("volume"), Summary->Volume);
+    OutMetadata->SetNumberField(TEXT("pitch"), Summary->Pitch);
 
     // Compression and streaming info
-    OutMetadata->SetBoolField(TEXT("is_streaming"), SoundWave->IsStreaming());
+    OutMetadata->SetBoolField(TEXT("is_streaming"), Summary->bStreaming);
+
+    // Levels of the imported PCM, which procedural and cooked-only waves do not keep
+    OutMetadata->SetBoolField(TEXT("has_levels"), Summary->bHasLevels);
+    if (Summary->bHasLevels)
+    {
+        OutMetadata->SetNumberField(TEXT("peak"), Summary->Peak);
+        OutMetadata->SetNumberField(TEXT("peak_db"), FSoundWaveSummaryCache::ToDecibels(Summary->Peak));
+        OutMetadata->SetNumberField(TEXT("rms"), Summary->Rms);
+        OutMetadata->SetNumberField(TEXT("rms_db"), FSoundWaveSummaryCache::ToDecibels(Summary->Rms));
+        if (bIncludeEnvelope)
+        {
+            TArray<TSharedPtr<FJsonValue>> EnvelopeValues;
+            EnvelopeValues.Reserve(Summary->Envelope.Num());
+            for (const uint8 Level : Summary->Envelope)
+            {
+                EnvelopeValues.Add(MakeShared<FJsonValueNumber>(FMath::RoundToFloat(Level / 255.0f * 1000.0f) / 1000.0f));
+            }
+            OutMetadata->SetArrayField(TEXT("envelope"), EnvelopeValues);
+        }
+    }
 
-    UE_LOG(LogSoundService, Log, TEXT("Retrieved metadata for sound wave: %s (Duration: %.2fs, Channels: %d)"),
-        *SoundWavePath, SoundWave->Duration, SoundWave->NumChannels);
+    UE_LOG(LogSoundService, Verbose, TEXT("Retrieved metadata for sound wave: %s from %s (Duration: %.2fs, Channels: %d)"),
+        *SoundWavePath, *Source, Summary->Duration, Summary->NumChannels);
 
     return true;
 }
 
+bool FSoundService::DescribeSoundWaveFromRegistry(const FSoftObjectPath& ObjectPath, TSharedPtr<FJsonObject>& OutMetadata) const
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(ObjectPath);
+    if (!AssetData.IsValid() || !AssetData.IsInstanceOf(USoundWave::StaticClass()))
+    {
+        return false;
+    }
+
+    // Searchable properties are written as tags; engine versions name some of them differently
+    auto ReadNumberTag = [&AssetData](std::initializer_list<const TCHAR*> TagNames, double& OutValue)
+    {
+        for (const TCHAR* TagName : TagNames)
+        {
+            FString Value;
+            if (AssetData.GetTagValue(FName(TagName), Value) && LexTryParseString(OutValue, *Value))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    double Value = 0.0;
+    if (ReadNumberTag({ TEXT("Duration") }, Value))
+    {
+        OutMetadata->SetNumberField(TEXT("duration"), Value);
+    }
+    if (ReadNumberTag({ TEXT("SampleRate"), TEXT("ImportedSampleRate") }, Value))
+    {
+        OutMetadata->SetNumberField(TEXT("sample_rate"), Value);
+    }
+    if (ReadNumberTag({ TEXT("NumChannels"), TEXT("Channels") }, Value))
+    {
+        OutMetadata->SetNumberField(TEXT("num_channels"), Value);
+    }
+
+    FString LoopingTag;
+    if (AssetData.GetTagValue(TEXT("bLooping"), LoopingTag))
+    {
+        OutMetadata->SetBoolField(TEXT("is_looping"), LoopingTag.ToBool());
+    }
+    return true;
+}
+
 bool FSoundService::SetSoundWaveProperties(const FString& SoundWavePath, bool bLooping, float Volume, float Pitch, FString& OutError)
 {
     USoundWave* SoundWave = FindSoundWave(SoundWavePath);
@@ -445,6 +551,12 @@ bool FSoundService::SaveAsset(UObject* Asset, FString& OutError) const
         return false;
     }
 
+    // Written together with the other saves of this batch (see FMCPSaveQueue)
+    if (FMCPSaveQueue::Get().Enqueue(Asset))
+    {
+        return true;
+    }
+
     Package->MarkPackageDirty();
 
     FString PackageFileName = FPackageName::LongPackageNameToFilename(
@@ -0,0 +1,330 @@
+#include "Services/SoundWaveSummaryCache.h"
+#include "MCPLogging.h"
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    /** Bumped when the summary fields or how they are computed change */
+    constexpr int32 PersistentStateVersion = 1;
+}
+
+FSoundWaveSummaryCache& FSoundWaveSummaryCache::Get()
+{
+    static FSoundWaveSummaryCache Instance;
+    return Instance;
+}
+
+void FSoundWaveSummaryCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    const int32 LoadedCount = LoadPersistentState();
+    UE_LOG(LogUnrealMCP, Log, TEXT("FSoundWaveSummaryCache: Restored %d sound wave summaries from the last session"), LoadedCount);
+
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FSoundWaveSummaryCache::HandleObjectPropertyChanged);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("soundwave_summary_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(Entries.Num()); });
+}
+
+void FSoundWaveSummaryCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    ObjectPropertyChangedHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("soundwave_summary_cache"));
+
+    if (bDirty)
+    {
+        SavePersistentState();
+    }
+    Entries.Empty();
+    bDirty = false;
+}
+
+const FSoundWaveSummaryCache::FSummary* FSoundWaveSummaryCache::Find(const FString& PackageName)
+{
+    check(IsInGameThread());
+
+    const FEntry* Entry = Entries.Find(PackageName);
+    if (!Entry)
+    {
+        CacheCounters.RecordMiss();
+        return nullptr;
+    }
+
+    FDateTime Timestamp;
+    if (!GetPackageTimestamp(PackageName, Timestamp) || Timestamp != Entry->PackageTimestamp)
+    {
+        Entries.Remove(PackageName);
+        bDirty = true;
+        CacheCounters.RecordInvalidation();
+        CacheCounters.RecordMiss();
+        return nullptr;
+    }
+    CacheCounters.RecordHit();
+    return &Entry->Summary;
+}
+
+const FSoundWaveSummaryCache::FSummary& FSoundWaveSummaryCache::FindOrCompute(const USoundWave& SoundWave, bool& bOutWasCached)
+{
+    check(IsInGameThread());
+    bOutWasCached = false;
+
+    // Unsaved edits are not in the package file the summary would be checked against
+    const UPackage* Package = SoundWave.GetPackage();
+    const FString PackageName = Package->GetName();
+    FDateTime Timestamp;
+    if (!bInitialized || Package->IsDirty() || !GetPackageTimestamp(PackageName, Timestamp))
+    {
+        CacheCounters.RecordMiss();
+        ComputeSummary(SoundWave, UncachedSummary);
+        return UncachedSummary;
+    }
+
+    if (const FSummary* Summary = Find(PackageName))
+    {
+        bOutWasCached = true;
+        return *Summary;
+    }
+
+    FEntry& Entry = Entries.Add(PackageName);
+    Entry.PackageTimestamp = Timestamp;
+    ComputeSummary(SoundWave, Entry.Summary);
+    bDirty = true;
+    return Entry.Summary;
+}
+
+float FSoundWaveSummaryCache::ToDecibels(float Level)
+{
+    return Level > UE_SMALL_NUMBER ? FMath::Max(20.0f * FMath::LogX(10.0f, Level), -120.0f) : -120.0f;
+}
+
+void FSoundWaveSummaryCache::ComputeSummary(const USoundWave& SoundWave, FSummary& OutSummary)
+{
+    OutSummary = FSummary();
+    OutSummary.Duration = SoundWave.Duration;
+    OutSummary.SampleRate = FMath::RoundToInt(SoundWave.GetSampleRateForCurrentPlatform());
+    OutSummary.NumChannels = SoundWave.NumChannels;
+    OutSummary.bLooping = SoundWave.bLooping;
+    OutSummary.Volume = SoundWave.Volume;
+    OutSummary.Pitch = SoundWave.Pitch;
+    OutSummary.bStreaming = SoundWave.IsStreaming();
+
+#if WITH_EDITORONLY_DATA
+    // 16-bit interleaved PCM as imported; procedural and cooked-only waves have none
+    TArray<uint8> RawPCM;
+    uint32 ImportedSampleRate = 0;
+    uint16 ImportedChannels = 0;
+    if (!SoundWave.GetImportedSoundWaveData(RawPCM, ImportedSampleRate, ImportedChannels) || ImportedChannels == 0)
+    {
+        return;
+    }
+
+    const int16* Samples = reinterpret_cast<const int16*>(RawPCM.GetData());
+    const int32 SampleCount = RawPCM.Num() / sizeof(int16);
+    const int32 FrameCount = SampleCount / ImportedChannels;
+    if (FrameCount == 0)
+    {
+        return;
+    }
+
+    OutSummary.Envelope.SetNumZeroed(EnvelopeBuckets);
+    int32 Peak = 0;
+    double SumOfSquares = 0.0;
+    for (int32 Frame = 0; Frame < FrameCount; ++Frame)
+    {
+        const int32 Bucket = static_cast<int32>((static_cast<int64>(Frame) * EnvelopeBuckets) / FrameCount);
+        int32 FramePeak = 0;
+        for (int32 Channel = 0; Channel < ImportedChannels; ++Channel)
+        {
+            const int32 Sample = Samples[Frame * ImportedChannels + Channel];
+            FramePeak = FMath::Max(FramePeak, FMath::Abs(Sample));
+            SumOfSquares += static_cast<double>(Sample) * Sample;
+        }
+        Peak = FMath::Max(Peak, FramePeak);
+        const uint8 Scaled = static_cast<uint8>(FMath::Min(FramePeak * 255 / 32767, 255));
+        OutSummary.Envelope[Bucket] = FMath::Max(OutSummary.Envelope[Bucket], Scaled);
+    }
+
+    OutSummary.bHasLevels = true;
+    OutSummary.Peak = FMath::Min(Peak / 32767.0f, 1.0f);
+    OutSummary.Rms = static_cast<float>(FMath::Sqrt(SumOfSquares / (static_cast<double>(FrameCount) * ImportedChannels)) / 32767.0);
+    if (OutSummary.SampleRate == 0)
+    {
+        OutSummary.SampleRate = ImportedSampleRate;
+    }
+#endif
+}
+
+bool FSoundWaveSummaryCache::GetPackageTimestamp(const FString& PackageName, FDateTime& OutTimestamp)
+{
+    FString PackageFilename;
+    if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName, PackageFilename, FPackageName::GetAssetPackageExtension()))
+    {
+        return false;
+    }
+
+    OutTimestamp = IFileManager::Get().GetTimeStamp(*PackageFilename);
+    return OutTimestamp != FDateTime::MinValue();
+}
+
+FString FSoundWaveSummaryCache::GetPersistentStatePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UnrealMCP"), TEXT("SoundWaveSummaries.json"));
+}
+
+int32 FSoundWaveSummaryCache::LoadPersistentState()
+{
+    FString InputString;
+    if (!FFileHelper::LoadFileToString(InputString, *GetPersistentStatePath()))
+    {
+        return 0;
+    }
+
+    TSharedPtr<FJsonObject> RootObj;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InputString);
+    const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+    int32 Version = 0;
+    if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()
+        || !RootObj->TryGetNumberField(TEXT("version"), Version) || Version != PersistentStateVersion
+        || !RootObj->TryGetArrayField(TEXT("sound_waves"), EntryValues))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FSoundWaveSummaryCache: Ignoring unreadable or outdated '%s'"), *GetPersistentStatePath());
+        return 0;
+    }
+
+    int32 StaleCount = 0;
+    for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValues)
+    {
+        const TSharedPtr<FJsonObject>* EntryObj = nullptr;
+        if (!EntryValue.IsValid() || !EntryValue->TryGetObject(EntryObj))
+        {
+            continue;
+        }
+
+        FString PackageName, TimestampString;
+        FEntry Entry;
+        if (!(*EntryObj)->TryGetStringField(TEXT("package"), PackageName)
+            || !(*EntryObj)->TryGetStringField(TEXT("package_timestamp"), TimestampString)
+            || !FDateTime::ParseIso8601(*TimestampString, Entry.PackageTimestamp))
+        {
+            continue;
+        }
+
+        // Summaries of packages that changed outside the editor would describe other audio
+        FDateTime Timestamp;
+        if (!GetPackageTimestamp(PackageName, Timestamp) || Timestamp != Entry.PackageTimestamp)
+        {
+            StaleCount++;
+            continue;
+        }
+
+        FSummary& Summary = Entry.Summary;
+        (*EntryObj)->TryGetNumberField(TEXT("duration"), Summary.Duration);
+        (*EntryObj)->TryGetNumberField(TEXT("sample_rate"), Summary.SampleRate);
+        (*EntryObj)->TryGetNumberField(TEXT("num_channels"), Summary.NumChannels);
+        (*EntryObj)->TryGetBoolField(TEXT("is_looping"), Summary.bLooping);
+        (*EntryObj)->TryGetNumberField(TEXT("volume"), Summary.Volume);
+        (*EntryObj)->TryGetNumberField(TEXT("pitch"), Summary.Pitch);
+        (*EntryObj)->TryGetBoolField(TEXT("is_streaming"), Summary.bStreaming);
+
+        FString EnvelopeHex;
+        if ((*EntryObj)->TryGetNumberField(TEXT("peak"), Summary.Peak)
+            && (*EntryObj)->TryGetNumberField(TEXT("rms"), Summary.Rms)
+            && (*EntryObj)->TryGetStringField(TEXT("envelope"), EnvelopeHex)
+            && EnvelopeHex.Len() == EnvelopeBuckets * 2)
+        {
+            Summary.Envelope.SetNumUninitialized(EnvelopeBuckets);
+            HexToBytes(EnvelopeHex, Summary.Envelope.GetData());
+            Summary.bHasLevels = true;
+        }
+
+        Entries.Add(PackageName, MoveTemp(Entry));
+    }
+
+    if (StaleCount > 0)
+    {
+        UE_LOG(LogUnrealMCP, Log, TEXT("FSoundWaveSummaryCache: Dropped %d sound wave summaries whose package changed since the last session"), StaleCount);
+        bDirty = true;
+    }
+    return Entries.Num();
+}
+
+void FSoundWaveSummaryCache::SavePersistentState() const
+{
+    TArray<TSharedPtr<FJsonValue>> EntryValues;
+    EntryValues.Reserve(Entries.Num());
+    for (const TPair<FString, FEntry>& Pair : Entries)
+    {
+        const FSummary& Summary = Pair.Value.Summary;
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("package"), Pair.Key);
+        EntryObj->SetStringField(TEXT("package_timestamp"), Pair.Value.PackageTimestamp.ToIso8601());
+        EntryObj->SetNumberField(TEXT("duration"), Summary.Duration);
+        EntryObj->SetNumberField(TEXT("sample_rate"), Summary.SampleRate);
+        EntryObj->SetNumberField(TEXT("num_channels"), Summary.NumChannels);
+        EntryObj->SetBoolField(TEXT("is_looping"), Summary.bLooping);
+        EntryObj->SetNumberField(TEXT("volume"), Summary.Volume);
+        EntryObj->SetNumberField(TEXT("pitch"), Summary.Pitch);
+        EntryObj->SetBoolField(TEXT("is_streaming"), Summary.bStreaming);
+        if (Summary.bHasLevels)
+        {
+            EntryObj->SetNumberField(TEXT("peak"), Summary.Peak);
+            EntryObj->SetNumberField(TEXT("rms"), Summary.Rms);
+            EntryObj->SetStringField(TEXT("envelope"), BytesToHex(Summary.Envelope.GetData(), Summary.Envelope.Num()));
+        }
+        EntryValues.Add(MakeShared<FJsonValueObject>(EntryObj));
+    }
+
+    TSharedPtr<FJsonObject> RootObj = MakeShared<FJsonObject>();
+    RootObj->SetNumberField(TEXT("version"), PersistentStateVersion);
+    RootObj->SetArrayField(TEXT("sound_waves"), EntryValues);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(RootObj.ToSharedRef(), Writer);
+
+    const FString StatePath = GetPersistentStatePath();
+    if (!FFileHelper::SaveStringToFile(OutputString, *StatePath))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("FSoundWaveSummaryCache: Could not write '%s'"), *StatePath);
+        return;
+    }
+    UE_LOG(LogUnrealMCP, Log, TEXT("FSoundWaveSummaryCache: Saved %d sound wave summaries"), EntryValues.Num());
+}
+
+void FSoundWaveSummaryCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // Reimports and property edits end in PostEditChange; the package timestamp only moves on save
+    if (const USoundWave* SoundWave = Cast<USoundWave>(Object))
+    {
+        if (Entries.Remove(SoundWave->GetPackage()->GetName()) > 0)
+        {
+            bDirty = true;
+            CacheCounters.RecordInvalidation();
+        }
+    }
+}
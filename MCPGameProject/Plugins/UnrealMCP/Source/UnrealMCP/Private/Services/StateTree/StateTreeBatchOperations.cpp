@@ -0,0 +1,166 @@
+// StateTreeBatchOperations.cpp - Bulk state and transition edits
+// BatchAddStates, BatchAddTransitions
+
+#include "Services/StateTreeService.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "Dom/JsonObject.h"
+
+bool FStateTreeService::BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    // Resolve every name against one map instead of searching the tree per definition;
+    // states added earlier in the batch can be parents of later ones
+    TMap<FString, UStateTreeState*> StatesByName;
+    CollectStatesByName(EditorData, StatesByName);
+
+    StateTree->Modify();
+    EditorData->Modify();
+    TSet<UStateTreeState*> ModifiedParents;
+
+    int32 AddedCount = 0;
+    for (const FBatchStateDefinition& StateDef : Params.States)
+    {
+        UStateTreeState* ParentState = nullptr;
+        if (!StateDef.ParentStateName.IsEmpty())
+        {
+            UStateTreeState** FoundParent = StatesByName.Find(StateDef.ParentStateName);
+            if (!FoundParent)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddStates: Failed to add state '%s': Parent state not found: '%s'"),
+                    *StateDef.StateName, *StateDef.ParentStateName);
+                continue;
+            }
+            ParentState = *FoundParent;
+
+            if (!ModifiedParents.Contains(ParentState))
+            {
+                ParentState->Modify();
+                ModifiedParents.Add(ParentState);
+            }
+        }
+
+        UStateTreeState* NewState = CreateState(EditorData, ParentState, StateDef.StateName, StateDef.StateType, StateDef.SelectionBehavior, StateDef.bEnabled);
+        if (!NewState)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddStates: Failed to add state '%s': Failed to create state object"),
+                *StateDef.StateName);
+            continue;
+        }
+
+        if (!StatesByName.Contains(StateDef.StateName))
+        {
+            StatesByName.Add(StateDef.StateName, NewState);
+        }
+        AddedCount++;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddStates: Added %d/%d states"), AddedCount, Params.States.Num());
+
+    if (AddedCount == 0)
+    {
+        OutError = TEXT("Failed to add any states");
+        return false;
+    }
+
+    // One save for the whole batch
+    FString SaveError;
+    SaveAsset(StateTree, SaveError);
+
+    return true;
+}
+
+bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    TMap<FString, UStateTreeState*> StatesByName;
+    CollectStatesByName(EditorData, StatesByName);
+
+    StateTree->Modify();
+    TSet<UStateTreeState*> ModifiedStates;
+
+    int32 AddedCount = 0;
+    for (const FBatchTransitionDefinition& TransDef : Params.Transitions)
+    {
+        UStateTreeState** SourceState = StatesByName.Find(TransDef.SourceStateName);
+        if (!SourceState)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddTransitions: Failed to add transition from '%s' to '%s': Source state not found: '%s'"),
+                *TransDef.SourceStateName, *TransDef.TargetStateName, *TransDef.SourceStateName);
+            continue;
+        }
+
+        UStateTreeState* TargetState = nullptr;
+        if (!TransDef.TargetStateName.IsEmpty())
+        {
+            UStateTreeState** FoundTarget = StatesByName.Find(TransDef.TargetStateName);
+            if (!FoundTarget)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddTransitions: Failed to add transition from '%s' to '%s': Target state not found: '%s'"),
+                    *TransDef.SourceStateName, *TransDef.TargetStateName, *TransDef.TargetStateName);
+                continue;
+            }
+            TargetState = *FoundTarget;
+        }
+
+        FAddTransitionParams AddParams;
+        AddParams.StateTreePath = Params.StateTreePath;
+        AddParams.SourceStateName = TransDef.SourceStateName;
+        AddParams.TargetStateName = TransDef.TargetStateName;
+        AddParams.Trigger = TransDef.Trigger;
+        AddParams.TransitionType = TransDef.TransitionType;
+        AddParams.Priority = TransDef.Priority;
+
+        FStateTreeTransition NewTransition;
+        InitTransition(AddParams, TargetState, NewTransition);
+
+        if (!ModifiedStates.Contains(*SourceState))
+        {
+            (*SourceState)->Modify();
+            ModifiedStates.Add(*SourceState);
+        }
+        (*SourceState)->Transitions.Add(NewTransition);
+        AddedCount++;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddTransitions: Added %d/%d transitions"), AddedCount, Params.Transitions.Num());
+
+    if (AddedCount == 0)
+    {
+        OutError = TEXT("Failed to add any transitions");
+        return false;
+    }
+
+    // One save for the whole batch
+    FString SaveError;
+    SaveAsset(StateTree, SaveError);
+
+    return true;
+}
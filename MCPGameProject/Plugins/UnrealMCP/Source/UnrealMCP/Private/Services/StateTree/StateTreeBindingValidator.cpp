@@ -0,0 +1,115 @@
+#include "Services/StateTree/StateTreeBindingValidator.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeExecutionTypes.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+bool FStateTreeBindingValidator::TakeSnapshot(const UStateTree* StateTree, FSnapshot& OutSnapshot)
+{
+    check(IsInGameThread());
+
+    const UStateTreeEditorData* EditorData = StateTree ? Cast<UStateTreeEditorData>(StateTree->EditorData) : nullptr;
+    if (!EditorData)
+    {
+        return false;
+    }
+
+    OutSnapshot.StateTreePath = StateTree->GetPathName();
+    OutSnapshot.bNoRootState = EditorData->SubTrees.Num() == 0;
+
+    TMap<FGuid, const FStateTreeDataView> AllValues;
+    EditorData->GetAllStructValues(AllValues);
+    OutSnapshot.Structs.Reserve(AllValues.Num());
+    for (const TPair<FGuid, const FStateTreeDataView>& Pair : AllValues)
+    {
+        OutSnapshot.Structs.Add(Pair.Key, Pair.Value.GetStruct());
+    }
+
+    EditorData->EditorBindings.ForEachBinding([&OutSnapshot](const FPropertyBindingBinding& Binding)
+    {
+        OutSnapshot.Bindings.Emplace(Binding.GetSourcePath(), Binding.GetTargetPath());
+    });
+    return true;
+}
+
+void FStateTreeBindingValidator::Validate(const FSnapshot& Snapshot, TArray<FIssue>& OutIssues)
+{
+    if (Snapshot.bNoRootState)
+    {
+        OutIssues.Add({ TEXT("error"), TEXT("StateTree has no root states"), FString(), FString() });
+    }
+
+    // Resolves a path from its struct; the leaf property is what the binding reads or writes
+    auto ResolvePath = [&Snapshot](const FPropertyBindingPath& Path, const TCHAR* Role, const FProperty*& OutLeaf, FString& OutError)
+    {
+        OutLeaf = nullptr;
+        const UStruct* const* Struct = Snapshot.Structs.Find(Path.GetStructID());
+        if (!Struct || !*Struct)
+        {
+            OutError = FString::Printf(TEXT("Binding %s node no longer exists (%s)"), Role, *Path.GetStructID().ToString());
+            return false;
+        }
+
+        TArray<FPropertyBindingPathIndirection> Indirections;
+        FString ResolveError;
+        if (!Path.ResolveIndirections(*Struct, Indirections, &ResolveError))
+        {
+            OutError = FString::Printf(TEXT("Binding %s path '%s' does not resolve on '%s': %s"),
+                Role, *Path.ToString(), *(*Struct)->GetName(), *ResolveError);
+            return false;
+        }
+        if (Indirections.Num() > 0)
+        {
+            OutLeaf = Indirections.Last().GetProperty();
+        }
+        return true;
+    };
+
+    for (const TPair<FPropertyBindingPath, FPropertyBindingPath>& Binding : Snapshot.Bindings)
+    {
+        const FString SourceString = Binding.Key.ToString();
+        const FString TargetString = Binding.Value.ToString();
+
+        const FProperty* SourceLeaf = nullptr;
+        const FProperty* TargetLeaf = nullptr;
+        FString Error;
+        if (!ResolvePath(Binding.Value, TEXT("target"), TargetLeaf, Error))
+        {
+            OutIssues.Add({ TEXT("error"), Error, SourceString, TargetString });
+            continue;
+        }
+        if (!ResolvePath(Binding.Key, TEXT("source"), SourceLeaf, Error))
+        {
+            OutIssues.Add({ TEXT("error"), Error, SourceString, TargetString });
+            continue;
+        }
+
+        // Numeric promotions compile, so a type difference is worth a look rather than an error
+        if (SourceLeaf && TargetLeaf && !SourceLeaf->SameType(TargetLeaf))
+        {
+            OutIssues.Add({ TEXT("warning"),
+                FString::Printf(TEXT("Binding types differ: %s -> %s"), *SourceLeaf->GetCPPType(), *TargetLeaf->GetCPPType()),
+                SourceString, TargetString });
+        }
+    }
+}
+
+TArray<TSharedPtr<FJsonValue>> FStateTreeBindingValidator::IssuesToJson(const TArray<FIssue>& Issues)
+{
+    TArray<TSharedPtr<FJsonValue>> IssuesArray;
+    IssuesArray.Reserve(Issues.Num());
+    for (const FIssue& Issue : Issues)
+    {
+        TSharedPtr<FJsonObject> IssueObj = MakeShared<FJsonObject>();
+        IssueObj->SetStringField(TEXT("type"), Issue.Type);
+        IssueObj->SetStringField(TEXT("message"), Issue.Message);
+        if (!Issue.SourcePath.IsEmpty() || !Issue.TargetPath.IsEmpty())
+        {
+            IssueObj->SetStringField(TEXT("source_path"), Issue.SourcePath);
+            IssueObj->SetStringField(TEXT("target_path"), Issue.TargetPath);
+        }
+        IssuesArray.Add(MakeShared<FJsonValueObject>(IssueObj));
+    }
+    return IssuesArray;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PropertyBindingPath.h"
+
+class UStateTree;
+
+/**
+ * Checks of the property bindings of a StateTree's editor data
+ *
+ * The bindings and the structs their paths start from are copied into a snapshot on the game
+ * thread; the snapshot is then checked without touching the StateTree, so bulk validation can run
+ * it on worker threads. The structs are only read through reflection, and whoever takes the
+ * snapshot keeps the StateTree (and with it the node types) loaded until the check is done.
+ */
+class FStateTreeBindingValidator
+{
+public:
+    /** Bindings of one StateTree and the structs their IDs name */
+    struct FSnapshot
+    {
+        FString StateTreePath;
+        /** Struct each bindable node, context, parameter bag or property function ID starts from */
+        TMap<FGuid, const UStruct*> Structs;
+        /** Source and target path of each binding */
+        TArray<TPair<FPropertyBindingPath, FPropertyBindingPath>> Bindings;
+        /** The tree has no root state */
+        bool bNoRootState = false;
+    };
+
+    /** One problem found */
+    struct FIssue
+    {
+        /** "error" or "warning" */
+        FString Type;
+        FString Message;
+        FString SourcePath;
+        FString TargetPath;
+    };
+
+    /**
+     * Copy what validation needs out of a StateTree; game thread only
+     * @return false if the StateTree has no editor data
+     */
+    static bool TakeSnapshot(const UStateTree* StateTree, FSnapshot& OutSnapshot);
+
+    /** Check every binding of a snapshot; any thread */
+    static void Validate(const FSnapshot& Snapshot, TArray<FIssue>& OutIssues);
+
+    /** Issues as the JSON objects validate_all_bindings reports */
+    static TArray<TSharedPtr<FJsonValue>> IssuesToJson(const TArray<FIssue>& Issues);
+};
@@ -0,0 +1,287 @@
+// StateTreeBulkValidationService.cpp - Binding validation of many StateTrees
+// StartBulkBindingValidation, GetBulkBindingValidation
+
+#include "Services/StateTreeService.h"
+#include "Services/StateTree/StateTreeBindingValidator.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "StateTree.h"
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    /** Result of a tree that could not be checked */
+    TSharedPtr<FJsonObject> MakeBulkBindingValidationFailure(const FString& StateTreePath, const FString& Error)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("state_tree_path"), StateTreePath);
+        Result->SetBoolField(TEXT("loaded"), false);
+        Result->SetStringField(TEXT("error"), Error);
+        return Result;
+    }
+}
+
+bool FStateTreeService::StartBulkBindingValidation(const TArray<FString>& StateTreePaths, const FString& PackagePath, int32 MaxInFlight, int64& OutJobId, int32& OutTreeCount, FString& OutError)
+{
+    check(IsInGameThread());
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FBulkBindingValidationJob Job;
+    TSet<FSoftObjectPath> Seen;
+    auto Enqueue = [&Job, &Seen](const FSoftObjectPath& Path)
+    {
+        if (!Seen.Contains(Path))
+        {
+            Seen.Add(Path);
+            Job.Queue.Add(Path);
+        }
+    };
+
+    if (!PackagePath.IsEmpty())
+    {
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UStateTree::StaticClass()->GetClassPathName());
+        Filter.PackagePaths.Add(FName(*PackagePath));
+        Filter.bRecursivePaths = true;
+        Filter.bRecursiveClasses = true;
+
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssets(Filter, Assets);
+        for (const FAssetData& Asset : Assets)
+        {
+            Enqueue(Asset.GetSoftObjectPath());
+        }
+    }
+
+    // Short names are matched against every StateTree in the registry, gathered once
+    TMap<FString, FSoftObjectPath> PathsByName;
+    for (const FString& StateTreePath : StateTreePaths)
+    {
+        if (StateTreePath.StartsWith(TEXT("/")))
+        {
+            // "/Game/AI/ST_Enemy" names the asset "/Game/AI/ST_Enemy.ST_Enemy"
+            FString ObjectPath = StateTreePath;
+            if (!ObjectPath.Contains(TEXT(".")))
+            {
+                ObjectPath += TEXT(".") + FPaths::GetBaseFilename(ObjectPath);
+            }
+            Enqueue(FSoftObjectPath(ObjectPath));
+            continue;
+        }
+
+        if (PathsByName.Num() == 0)
+        {
+            TArray<FAssetData> Assets;
+            AssetRegistry.GetAssetsByClass(UStateTree::StaticClass()->GetClassPathName(), Assets, true);
+            for (const FAssetData& Asset : Assets)
+            {
+                PathsByName.Add(Asset.AssetName.ToString().ToLower(), Asset.GetSoftObjectPath());
+            }
+        }
+
+        if (const FSoftObjectPath* Path = PathsByName.Find(StateTreePath.ToLower()))
+        {
+            Enqueue(*Path);
+        }
+        else
+        {
+            Job.Results.Add(MakeBulkBindingValidationFailure(StateTreePath, FString::Printf(TEXT("Could not find StateTree '%s'"), *StateTreePath)));
+            Job.FailedCount++;
+        }
+    }
+
+    if (Job.Queue.Num() == 0 && Job.Results.Num() == 0)
+    {
+        OutError = PackagePath.IsEmpty()
+            ? TEXT("No StateTrees to validate")
+            : FString::Printf(TEXT("No StateTrees found under '%s'"), *PackagePath);
+        return false;
+    }
+
+    Job.MaxInFlight = FMath::Clamp(MaxInFlight, 1, 64);
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // Results of old runs are dropped before a new run adds its own
+    TArray<int64> FinishedIds;
+    for (const TPair<int64, FBulkBindingValidationJob>& Pair : BulkBindingValidationJobs)
+    {
+        if (Pair.Value.bFinished)
+        {
+            FinishedIds.Add(Pair.Key);
+        }
+    }
+    FinishedIds.Sort();
+    for (int32 Index = 0; Index <= FinishedIds.Num() - MaxFinishedBulkBindingValidationJobs; ++Index)
+    {
+        BulkBindingValidationJobs.Remove(FinishedIds[Index]);
+    }
+
+    OutJobId = NextBulkBindingValidationJobId++;
+    OutTreeCount = Job.TreeCount = Job.Queue.Num() + Job.Results.Num();
+    BulkBindingValidationJobs.Add(OutJobId, MoveTemp(Job));
+
+    if (!BulkBindingValidationTickerHandle.IsValid())
+    {
+        BulkBindingValidationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &FStateTreeService::TickBulkBindingValidation));
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::StartBulkBindingValidation: Started job %lld of %d StateTree(s), %d at a time"),
+        OutJobId, OutTreeCount, FMath::Clamp(MaxInFlight, 1, 64));
+    return true;
+}
+
+bool FStateTreeService::TickBulkBindingValidation(float DeltaTime)
+{
+    bool bAnyRunning = false;
+
+    for (TPair<int64, FBulkBindingValidationJob>& Pair : BulkBindingValidationJobs)
+    {
+        const int64 JobId = Pair.Key;
+        FBulkBindingValidationJob& Job = Pair.Value;
+        if (Job.bFinished)
+        {
+            continue;
+        }
+
+        // Take the results of the checks the workers have finished; the trees may be collected after
+        for (int32 Index = Job.Validating.Num() - 1; Index >= 0; --Index)
+        {
+            FBulkBindingValidationTree& Entry = Job.Validating[Index];
+            if (!Entry.Result.IsReady())
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> Result = Entry.Result.Get();
+            bool bValid = false;
+            if (Result->TryGetBoolField(TEXT("valid"), bValid) && !bValid)
+            {
+                Job.FailedCount++;
+            }
+            Job.Results.Add(Result);
+            Job.Validating.RemoveAtSwap(Index);
+        }
+
+        // Keep MaxInFlight trees loading or being checked; the loads complete on the game thread
+        while (Job.NextQueued < Job.Queue.Num() && Job.LoadsInFlight + Job.Validating.Num() < Job.MaxInFlight)
+        {
+            const FSoftObjectPath Path = Job.Queue[Job.NextQueued++];
+            Job.LoadsInFlight++;
+            LoadPackageAsync(Path.GetLongPackageName(), FLoadPackageAsyncDelegate::CreateLambda(
+                [this, JobId, Path](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+                {
+                    HandleBulkBindingValidationLoaded(JobId, Path, Result == EAsyncLoadingResult::Succeeded);
+                }));
+        }
+
+        if (Job.NextQueued >= Job.Queue.Num() && Job.LoadsInFlight == 0 && Job.Validating.Num() == 0)
+        {
+            Job.bFinished = true;
+            Job.FinishTime = FPlatformTime::Seconds();
+            UE_LOG(LogTemp, Log, TEXT("FStateTreeService::TickBulkBindingValidation: Job %lld finished: %d tree(s), %d failed, %.1f s"),
+                JobId, Job.Results.Num(), Job.FailedCount, Job.FinishTime - Job.StartTime);
+            continue;
+        }
+        bAnyRunning = true;
+    }
+
+    if (!bAnyRunning)
+    {
+        BulkBindingValidationTickerHandle.Reset();
+    }
+    return bAnyRunning;
+}
+
+void FStateTreeService::HandleBulkBindingValidationLoaded(int64 JobId, const FSoftObjectPath& Path, bool bSucceeded)
+{
+    FBulkBindingValidationJob* Job = BulkBindingValidationJobs.Find(JobId);
+    if (!Job)
+    {
+        return;
+    }
+    Job->LoadsInFlight--;
+
+    UStateTree* StateTree = bSucceeded ? Cast<UStateTree>(Path.ResolveObject()) : nullptr;
+    if (!StateTree)
+    {
+        Job->Results.Add(MakeBulkBindingValidationFailure(Path.ToString(), TEXT("Failed to load StateTree")));
+        Job->FailedCount++;
+        return;
+    }
+
+    FStateTreeBindingValidator::FSnapshot Snapshot;
+    if (!FStateTreeBindingValidator::TakeSnapshot(StateTree, Snapshot))
+    {
+        Job->Results.Add(MakeBulkBindingValidationFailure(Path.ToString(), TEXT("StateTree has no editor data")));
+        Job->FailedCount++;
+        return;
+    }
+
+    FBulkBindingValidationTree& Entry = Job->Validating.AddDefaulted_GetRef();
+    Entry.Path = Path;
+    Entry.StateTree.Reset(StateTree);
+    Entry.Result = Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), StartTime = FPlatformTime::Seconds()]()
+    {
+        TArray<FStateTreeBindingValidator::FIssue> Issues;
+        FStateTreeBindingValidator::Validate(Snapshot, Issues);
+
+        int32 ErrorCount = 0;
+        for (const FStateTreeBindingValidator::FIssue& Issue : Issues)
+        {
+            ErrorCount += Issue.Type == TEXT("error") ? 1 : 0;
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("state_tree_path"), Snapshot.StateTreePath);
+        Result->SetBoolField(TEXT("loaded"), true);
+        Result->SetBoolField(TEXT("valid"), ErrorCount == 0);
+        Result->SetNumberField(TEXT("binding_count"), Snapshot.Bindings.Num());
+        Result->SetNumberField(TEXT("error_count"), ErrorCount);
+        Result->SetNumberField(TEXT("warning_count"), Issues.Num() - ErrorCount);
+        Result->SetArrayField(TEXT("issues"), FStateTreeBindingValidator::IssuesToJson(Issues));
+        Result->SetNumberField(TEXT("elapsed_seconds"), FPlatformTime::Seconds() - StartTime);
+        return Result;
+    });
+}
+
+bool FStateTreeService::GetBulkBindingValidation(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError)
+{
+    check(IsInGameThread());
+
+    const FBulkBindingValidationJob* Job = BulkBindingValidationJobs.Find(JobId);
+    if (!Job)
+    {
+        OutError = FString::Printf(TEXT("Unknown bulk binding validation job: %lld"), JobId);
+        return false;
+    }
+
+    const int32 TreesTotal = Job->TreeCount;
+    const int32 First = FMath::Clamp(Cursor, 0, Job->Results.Num());
+    const int32 Last = FMath::Min(Job->Results.Num(), First + FMath::Max(MaxResults, 0));
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        ResultsArray.Add(MakeShared<FJsonValueObject>(Job->Results[Index]));
+    }
+
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetNumberField(TEXT("job_id"), static_cast<double>(JobId));
+    OutStatus->SetStringField(TEXT("state"), Job->bFinished ? TEXT("finished") : TEXT("running"));
+    OutStatus->SetNumberField(TEXT("elapsed_seconds"), (Job->bFinished ? Job->FinishTime : FPlatformTime::Seconds()) - Job->StartTime);
+    OutStatus->SetNumberField(TEXT("trees_total"), TreesTotal);
+    OutStatus->SetNumberField(TEXT("trees_completed"), Job->Results.Num());
+    OutStatus->SetNumberField(TEXT("trees_loading"), Job->LoadsInFlight);
+    OutStatus->SetNumberField(TEXT("trees_validating"), Job->Validating.Num());
+    OutStatus->SetNumberField(TEXT("trees_failed"), Job->FailedCount);
+    OutStatus->SetNumberField(TEXT("progress"), TreesTotal > 0 ? static_cast<double>(Job->Results.Num()) / TreesTotal : 1.0);
+    OutStatus->SetArrayField(TEXT("results"), ResultsArray);
+    OutStatus->SetNumberField(TEXT("next_cursor"), Last);
+    OutStatus->SetBoolField(TEXT("has_more"), Last < Job->Results.Num() || !Job->bFinished);
+    return true;
+}
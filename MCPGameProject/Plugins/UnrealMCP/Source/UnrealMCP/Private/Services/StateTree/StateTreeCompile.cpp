@@ -0,0 +1,176 @@
+// StateTreeCompile.cpp - Compiling and validate-only compiles of StateTrees
+// CompileStateTree, IsStateTreeCompileUpToDate, ValidateStateTree, CalculateEditorDataHash
+
+#include "Services/StateTreeService.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeCompiler.h"
+#include "StateTreeCompilerLog.h"
+#include "Serialization/ArchiveObjectCrc32.h"
+#include "UObject/Package.h"
+
+// Errors and warnings of a StateTree compiler run
+static TArray<FString> GetStateTreeCompilerMessages(FStateTreeCompilerLog& Log)
+{
+    TArray<FString> ErrorMessages;
+    for (const TSharedRef<FTokenizedMessage>& Message : Log.ToTokenizedMessages())
+    {
+        if (Message->GetSeverity() == EMessageSeverity::Error || Message->GetSeverity() == EMessageSeverity::Warning)
+        {
+            ErrorMessages.Add(Message->ToText().ToString());
+        }
+    }
+    return ErrorMessages;
+}
+
+bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutError, bool bForce)
+{
+    if (!StateTree)
+    {
+        OutError = TEXT("StateTree is null");
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    // Check for basic validity first
+    if (EditorData->SubTrees.Num() == 0)
+    {
+        OutError = TEXT("StateTree has no subtrees defined");
+        UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::CompileStateTree: StateTree has no subtrees"));
+        return false;
+    }
+
+    // Nothing changed since the last successful compile: its compiled data and save still stand
+    if (!bForce && IsStateTreeCompileUpToDate(StateTree))
+    {
+        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: StateTree '%s' is up to date"), *StateTree->GetName());
+        return true;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Compiling StateTree '%s'"), *StateTree->GetName());
+
+    // Mark dirty before compilation
+    StateTree->Modify();
+
+    // Use the actual UE5 StateTree compiler for proper validation
+    FStateTreeCompilerLog Log;
+    FStateTreeCompiler Compiler(Log);
+
+    bool bSuccess = Compiler.Compile(StateTree);
+
+    if (!bSuccess)
+    {
+        LastCompiledHashes.Remove(StateTree);
+
+        // Collect all error messages from the compiler log
+        TArray<FString> ErrorMessages = GetStateTreeCompilerMessages(Log);
+
+        if (ErrorMessages.Num() > 0)
+        {
+            // Join all error messages with newlines
+            OutError = FString::Join(ErrorMessages, TEXT("\n"));
+        }
+        else
+        {
+            OutError = TEXT("Compilation failed with unknown error");
+        }
+
+        // Also log to output for debugging
+        Log.DumpToLog(LogTemp);
+
+        UE_LOG(LogTemp, Error, TEXT("FStateTreeService::CompileStateTree: Compilation failed for '%s': %s"),
+            *StateTree->GetName(), *OutError);
+        return false;
+    }
+
+    // Hashed after the compile, which may fix up the editor data it reads
+    LastCompiledHashes.Add(StateTree, CalculateEditorDataHash(StateTree));
+
+    // Save after successful compilation
+    FString SaveError;
+    if (!SaveAsset(StateTree, SaveError))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::CompileStateTree: Failed to save after compilation: %s"), *SaveError);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Successfully compiled StateTree '%s'"), *StateTree->GetName());
+    return true;
+}
+
+bool FStateTreeService::IsStateTreeCompileUpToDate(UStateTree* StateTree)
+{
+    if (!StateTree || !StateTree->IsReadyToRun())
+    {
+        return false;
+    }
+
+    const uint32* LastHash = LastCompiledHashes.Find(StateTree);
+    return LastHash && *LastHash == CalculateEditorDataHash(StateTree);
+}
+
+bool FStateTreeService::ValidateStateTree(UStateTree* StateTree, TArray<FString>& OutMessages, FString& OutError)
+{
+    if (!StateTree)
+    {
+        OutError = TEXT("StateTree is null");
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    if (EditorData->SubTrees.Num() == 0)
+    {
+        OutError = TEXT("StateTree has no subtrees defined");
+        return false;
+    }
+
+    // The last successful compile already validated this exact editor data
+    if (IsStateTreeCompileUpToDate(StateTree))
+    {
+        return true;
+    }
+
+    // The compiler writes its output into the tree it compiles, so it runs on a transient copy
+    UStateTree* ScratchTree = DuplicateObject<UStateTree>(StateTree, GetTransientPackage(),
+        MakeUniqueObjectName(GetTransientPackage(), UStateTree::StaticClass(), StateTree->GetFName()));
+    if (!ScratchTree)
+    {
+        OutError = TEXT("Failed to copy StateTree for validation");
+        return false;
+    }
+    ScratchTree->ClearFlags(RF_Public | RF_Standalone);
+
+    FStateTreeCompilerLog Log;
+    FStateTreeCompiler Compiler(Log);
+    const bool bValid = Compiler.Compile(ScratchTree);
+
+    OutMessages = GetStateTreeCompilerMessages(Log);
+    ScratchTree->MarkAsGarbage();
+
+    if (!bValid)
+    {
+        OutError = OutMessages.Num() > 0 ? FString::Join(OutMessages, TEXT("\n")) : TEXT("Validation failed with unknown error");
+        return false;
+    }
+
+    return true;
+}
+
+uint32 FStateTreeService::CalculateEditorDataHash(UStateTree* StateTree) const
+{
+    // Serializes the editor data with the states and nodes it owns, as the StateTree editor does
+    // to tell whether a tree needs compiling
+    FArchiveObjectCrc32 Archive;
+    return Archive.Crc32(StateTree->EditorData);
+}
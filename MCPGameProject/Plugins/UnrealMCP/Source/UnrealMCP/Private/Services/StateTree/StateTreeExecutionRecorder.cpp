@@ -0,0 +1,238 @@
+#include "Services/StateTreeExecutionRecorder.h"
+#include "MCPLogging.h"
+#include "StateTree.h"
+#include "StateTreeExecutionContext.h"
+#include "StateTreeTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+FStateTreeExecutionRecorder& FStateTreeExecutionRecorder::Get()
+{
+    static FStateTreeExecutionRecorder Instance;
+    return Instance;
+}
+
+void FStateTreeExecutionRecorder::Shutdown()
+{
+    check(IsInGameThread());
+    Stop();
+
+    FRWScopeLock Lock(BuffersLock, SLT_Write);
+    Buffers.Empty();
+}
+
+bool FStateTreeExecutionRecorder::Start(const UStateTree* StateTree, int32 InCapacity, FString& OutError)
+{
+    check(IsInGameThread());
+
+#if WITH_STATETREE_DEBUG
+    {
+        FRWScopeLock Lock(BuffersLock, SLT_Write);
+        Buffers.Empty();
+        Capacity = FMath::Clamp(InCapacity > 0 ? InCapacity : DefaultCapacity, 16, 65536);
+        RecordedStateTree = FObjectKey(StateTree);
+        bFilterStateTree = StateTree != nullptr;
+    }
+
+    if (!bRecording)
+    {
+        BindEvents();
+        bRecording = true;
+    }
+
+    UE_LOG(LogUnrealMCP, Log, TEXT("StateTree execution recorder: recording %s, %d events per instance"),
+        StateTree ? *StateTree->GetPathName() : TEXT("every StateTree"), Capacity);
+    return true;
+#else
+    OutError = TEXT("StateTree execution recording needs a build with WITH_STATETREE_DEBUG");
+    return false;
+#endif
+}
+
+void FStateTreeExecutionRecorder::Stop()
+{
+    check(IsInGameThread());
+    if (!bRecording)
+    {
+        return;
+    }
+
+    bRecording = false;
+    UnbindEvents();
+}
+
+void FStateTreeExecutionRecorder::GetHistory(const FString& StateTreePath, const FString& OwnerPath, int32 MaxEvents, TArray<FInstanceHistory>& OutHistories) const
+{
+    OutHistories.Reset();
+
+    FRWScopeLock Lock(BuffersLock, SLT_ReadOnly);
+    for (const TPair<TPair<FObjectKey, FObjectKey>, TUniquePtr<FInstanceBuffer>>& Pair : Buffers)
+    {
+        const FInstanceBuffer& Buffer = *Pair.Value;
+
+        // "/Game/AI/ST_Enemy" names the asset "/Game/AI/ST_Enemy.ST_Enemy"
+        if (!StateTreePath.IsEmpty()
+            && !Buffer.StateTreePath.Equals(StateTreePath, ESearchCase::IgnoreCase)
+            && !Buffer.StateTreePath.StartsWith(StateTreePath + TEXT("."), ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+        if (!OwnerPath.IsEmpty()
+            && !Buffer.OwnerPath.Equals(OwnerPath, ESearchCase::IgnoreCase)
+            && !Buffer.OwnerName.Equals(OwnerPath, ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+
+        FInstanceHistory& History = OutHistories.AddDefaulted_GetRef();
+        History.OwnerPath = Buffer.OwnerPath;
+        History.OwnerName = Buffer.OwnerName;
+        History.StateTreePath = Buffer.StateTreePath;
+
+        const uint64 WriteCount = Buffer.WriteCount.Load();
+        const uint64 SlotCount = Buffer.Slots.Num();
+        uint64 First = WriteCount > SlotCount ? WriteCount - SlotCount : 0;
+        if (MaxEvents > 0 && WriteCount - First > static_cast<uint64>(MaxEvents))
+        {
+            First = WriteCount - MaxEvents;
+        }
+        History.RecordedCount = WriteCount;
+        History.Events.Reserve(static_cast<int32>(WriteCount - First));
+
+        for (uint64 Sequence = First; Sequence < WriteCount; ++Sequence)
+        {
+            const FSlot& Slot = Buffer.Slots[static_cast<int32>(Sequence % SlotCount)];
+
+            // A slot is only read when it was published for this sequence before and after the copy
+            if (Slot.Sequence.Load(EMemoryOrder::SequentiallyConsistent) != Sequence + 1)
+            {
+                continue;
+            }
+            FEvent Event;
+            Event.Type = Slot.Type;
+            Event.State = Slot.State;
+            Event.TargetState = Slot.TargetState;
+            Event.WorldTime = Slot.WorldTime;
+            Event.Frame = Slot.Frame;
+            Event.Sequence = Sequence;
+            if (Slot.Sequence.Load(EMemoryOrder::SequentiallyConsistent) != Sequence + 1)
+            {
+                continue;
+            }
+            History.Events.Add(Event);
+        }
+    }
+}
+
+FStateTreeExecutionRecorder::FInstanceBuffer* FStateTreeExecutionRecorder::FindOrAddBuffer(const FStateTreeExecutionContext& Context)
+{
+    const UObject* Owner = Context.GetOwner();
+    const UStateTree* StateTree = Context.GetStateTree();
+    const TPair<FObjectKey, FObjectKey> Key(FObjectKey(Owner), FObjectKey(StateTree));
+
+    if (const TUniquePtr<FInstanceBuffer>* Buffer = Buffers.Find(Key))
+    {
+        return Buffer->Get();
+    }
+
+    // Only the first event of an instance gets here; the caller's shared lock is traded for the
+    // exclusive one, and another writer may have added the buffer in between
+    BuffersLock.ReadUnlock();
+    BuffersLock.WriteLock();
+    TUniquePtr<FInstanceBuffer>& Buffer = Buffers.FindOrAdd(Key);
+    if (!Buffer.IsValid())
+    {
+        Buffer = MakeUnique<FInstanceBuffer>();
+        Buffer->OwnerPath = Owner ? Owner->GetPathName() : FString();
+        Buffer->OwnerName = Owner ? Owner->GetName() : FString();
+        if (const AActor* Actor = Owner ? Owner->GetTypedOuter<AActor>() : nullptr)
+        {
+            // A component owner is listed under its actor, which is what callers name
+            Buffer->OwnerName = Actor->GetActorNameOrLabel();
+        }
+        Buffer->StateTreePath = StateTree ? StateTree->GetPathName() : FString();
+        Buffer->Slots.SetNum(Capacity);
+    }
+    FInstanceBuffer* Result = Buffer.Get();
+    BuffersLock.WriteUnlock();
+    BuffersLock.ReadLock();
+    return Result;
+}
+
+void FStateTreeExecutionRecorder::Record(const FStateTreeExecutionContext& Context, EEventType Type, FName State, FName TargetState)
+{
+    const UWorld* World = Context.GetWorld();
+    if (!World || World->WorldType != EWorldType::PIE)
+    {
+        return;
+    }
+
+    // Buffers are only dropped under the exclusive lock, so a buffer stays valid while this holds the shared one
+    BuffersLock.ReadLock();
+    if (bRecording && (!bFilterStateTree || FObjectKey(Context.GetStateTree()) == RecordedStateTree))
+    {
+        FInstanceBuffer* Buffer = FindOrAddBuffer(Context);
+        const uint64 Sequence = Buffer->WriteCount.IncrementExchange();
+        FSlot& Slot = Buffer->Slots[static_cast<int32>(Sequence % Buffer->Slots.Num())];
+
+        // Readers skip the slot until the new sequence is published
+        Slot.Sequence.Store(0, EMemoryOrder::SequentiallyConsistent);
+        Slot.Type = Type;
+        Slot.State = State;
+        Slot.TargetState = TargetState;
+        Slot.WorldTime = World->GetTimeSeconds();
+        Slot.Frame = GFrameCounter;
+        Slot.Sequence.Store(Sequence + 1, EMemoryOrder::SequentiallyConsistent);
+    }
+    BuffersLock.ReadUnlock();
+}
+
+FName FStateTreeExecutionRecorder::GetStateName(const FStateTreeExecutionContext& Context, const FStateTreeStateHandle& Handle)
+{
+    // Handles are relative to the frame being processed, which may run a linked StateTree asset
+    const FStateTreeExecutionFrame* Frame = Context.GetCurrentlyProcessedFrame();
+    const UStateTree* StateTree = Frame && Frame->StateTree ? Frame->StateTree.Get() : Context.GetStateTree();
+    if (const FCompactStateTreeState* State = StateTree ? StateTree->GetStateFromHandle(Handle) : nullptr)
+    {
+        return State->Name;
+    }
+
+    // Succeeded, Failed and Stopped are handles without a state
+    return FName(*Handle.Describe());
+}
+
+void FStateTreeExecutionRecorder::BindEvents()
+{
+#if WITH_STATETREE_DEBUG
+    EnterStateHandle = UE::StateTree::Debug::OnEnterState_AnyThread.AddRaw(this, &FStateTreeExecutionRecorder::HandleEnterState);
+    ExitStateHandle = UE::StateTree::Debug::OnExitState_AnyThread.AddRaw(this, &FStateTreeExecutionRecorder::HandleExitState);
+    TransitionHandle = UE::StateTree::Debug::OnTransition_AnyThread.AddRaw(this, &FStateTreeExecutionRecorder::HandleTransition);
+#endif
+}
+
+void FStateTreeExecutionRecorder::UnbindEvents()
+{
+#if WITH_STATETREE_DEBUG
+    UE::StateTree::Debug::OnEnterState_AnyThread.Remove(EnterStateHandle);
+    UE::StateTree::Debug::OnExitState_AnyThread.Remove(ExitStateHandle);
+    UE::StateTree::Debug::OnTransition_AnyThread.Remove(TransitionHandle);
+#endif
+    EnterStateHandle.Reset();
+    ExitStateHandle.Reset();
+    TransitionHandle.Reset();
+}
+
+void FStateTreeExecutionRecorder::HandleEnterState(const FStateTreeExecutionContext& Context, FStateTreeStateHandle StateHandle)
+{
+    Record(Context, EEventType::Enter, GetStateName(Context, StateHandle), NAME_None);
+}
+
+void FStateTreeExecutionRecorder::HandleExitState(const FStateTreeExecutionContext& Context, FStateTreeStateHandle StateHandle)
+{
+    Record(Context, EEventType::Exit, GetStateName(Context, StateHandle), NAME_None);
+}
+
+void FStateTreeExecutionRecorder::HandleTransition(const FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
+{
+    Record(Context, EEventType::Transition, GetStateName(Context, Transition.SourceState), GetStateName(Context, Transition.TargetState));
+}
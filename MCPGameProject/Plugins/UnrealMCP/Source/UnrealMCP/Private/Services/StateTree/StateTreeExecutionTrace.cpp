@@ -0,0 +1,175 @@
+// StateTreeExecutionTrace.cpp - Runtime inspection and PIE execution traces of StateTrees
+// GetActiveStateTreeStatus, GetCurrentActiveStates, GetStateExecutionHistory, StartStateTreeRecording, StopStateTreeRecording
+
+#include "Services/StateTreeService.h"
+#include "Services/StateTreeExecutionRecorder.h"
+#include "StateTree.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+bool FStateTreeService::GetActiveStateTreeStatus(const FString& StateTreePath, const FString& ActorPath, TSharedPtr<FJsonObject>& OutStatus)
+{
+    OutStatus = MakeShared<FJsonObject>();
+    OutStatus->SetStringField(TEXT("state_tree_path"), StateTreePath);
+    OutStatus->SetStringField(TEXT("actor_path"), ActorPath);
+
+    // Runtime inspection requires PIE and access to world actors
+    // This is a placeholder that would need game-time implementation
+    OutStatus->SetBoolField(TEXT("is_running"), false);
+    OutStatus->SetStringField(TEXT("note"), TEXT("Runtime inspection requires PIE context"));
+
+    return true;
+}
+
+bool FStateTreeService::GetCurrentActiveStates(const FString& StateTreePath, const FString& ActorPath, TArray<FString>& OutActiveStates)
+{
+    // Replayed from the execution recorder: a state is active once entered until it is exited.
+    // Without a recording there is nothing to replay.
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::GetCurrentActiveStates: Runtime inspection for '%s' on actor '%s'"),
+        *StateTreePath, *ActorPath);
+
+    TArray<FStateTreeExecutionRecorder::FInstanceHistory> Histories;
+    FStateTreeExecutionRecorder::Get().GetHistory(StateTreePath, ActorPath, 0, Histories);
+    for (const FStateTreeExecutionRecorder::FInstanceHistory& History : Histories)
+    {
+        TArray<FName> ActiveStates;
+        for (const FStateTreeExecutionRecorder::FEvent& Event : History.Events)
+        {
+            if (Event.Type == FStateTreeExecutionRecorder::EEventType::Enter)
+            {
+                ActiveStates.AddUnique(Event.State);
+            }
+            else if (Event.Type == FStateTreeExecutionRecorder::EEventType::Exit)
+            {
+                ActiveStates.Remove(Event.State);
+            }
+        }
+        for (const FName& State : ActiveStates)
+        {
+            OutActiveStates.AddUnique(State.ToString());
+        }
+    }
+
+    return true;
+}
+
+bool FStateTreeService::GetStateExecutionHistory(const FString& StateTreePath, const FString& ActorPath, int32 MaxEntries, TSharedPtr<FJsonObject>& OutHistory)
+{
+    FStateTreeExecutionRecorder& Recorder = FStateTreeExecutionRecorder::Get();
+
+    OutHistory = MakeShared<FJsonObject>();
+    OutHistory->SetStringField(TEXT("state_tree_path"), StateTreePath);
+    OutHistory->SetStringField(TEXT("actor_path"), ActorPath);
+    OutHistory->SetNumberField(TEXT("max_entries"), MaxEntries);
+    OutHistory->SetBoolField(TEXT("recording"), Recorder.IsRecording());
+    OutHistory->SetNumberField(TEXT("capacity"), Recorder.GetCapacity());
+
+    TArray<FStateTreeExecutionRecorder::FInstanceHistory> Histories;
+    Recorder.GetHistory(StateTreePath, ActorPath, MaxEntries, Histories);
+
+    // Entries of every matching instance, merged by time; durations are paired per instance
+    struct FTimedEntry
+    {
+        double WorldTime;
+        uint64 Frame;
+        uint64 Sequence;
+        TSharedPtr<FJsonObject> Entry;
+    };
+    TArray<FTimedEntry> Entries;
+    TArray<TSharedPtr<FJsonValue>> InstancesArray;
+
+    for (const FStateTreeExecutionRecorder::FInstanceHistory& History : Histories)
+    {
+        TMap<FName, double> EnterTimes;
+        for (const FStateTreeExecutionRecorder::FEvent& Event : History.Events)
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("actor"), History.OwnerName);
+            Entry->SetStringField(TEXT("state_name"), Event.State.ToString());
+            Entry->SetNumberField(TEXT("timestamp"), Event.WorldTime);
+            Entry->SetNumberField(TEXT("frame"), static_cast<double>(Event.Frame));
+            Entry->SetNumberField(TEXT("sequence"), static_cast<double>(Event.Sequence));
+
+            switch (Event.Type)
+            {
+            case FStateTreeExecutionRecorder::EEventType::Enter:
+                Entry->SetStringField(TEXT("event"), TEXT("enter"));
+                EnterTimes.Add(Event.State, Event.WorldTime);
+                break;
+            case FStateTreeExecutionRecorder::EEventType::Exit:
+                Entry->SetStringField(TEXT("event"), TEXT("exit"));
+                if (const double* EnterTime = EnterTimes.Find(Event.State))
+                {
+                    Entry->SetNumberField(TEXT("duration"), Event.WorldTime - *EnterTime);
+                    EnterTimes.Remove(Event.State);
+                }
+                break;
+            case FStateTreeExecutionRecorder::EEventType::Transition:
+                Entry->SetStringField(TEXT("event"), TEXT("transition"));
+                Entry->SetStringField(TEXT("target_state"), Event.TargetState.ToString());
+                break;
+            }
+            Entries.Add({ Event.WorldTime, Event.Frame, Event.Sequence, Entry });
+        }
+
+        TSharedPtr<FJsonObject> InstanceObj = MakeShared<FJsonObject>();
+        InstanceObj->SetStringField(TEXT("actor"), History.OwnerName);
+        InstanceObj->SetStringField(TEXT("owner_path"), History.OwnerPath);
+        InstanceObj->SetStringField(TEXT("state_tree_path"), History.StateTreePath);
+        InstanceObj->SetNumberField(TEXT("recorded_count"), static_cast<double>(History.RecordedCount));
+        InstanceObj->SetNumberField(TEXT("dropped_count"), static_cast<double>(FMath::Max<int64>(0,
+            static_cast<int64>(History.RecordedCount) - Recorder.GetCapacity())));
+        InstancesArray.Add(MakeShared<FJsonValueObject>(InstanceObj));
+    }
+
+    Entries.StableSort([](const FTimedEntry& A, const FTimedEntry& B)
+    {
+        if (A.Frame != B.Frame)
+        {
+            return A.Frame < B.Frame;
+        }
+        return A.WorldTime < B.WorldTime;
+    });
+
+    TArray<TSharedPtr<FJsonValue>> HistoryArray;
+    HistoryArray.Reserve(Entries.Num());
+    for (const FTimedEntry& Entry : Entries)
+    {
+        HistoryArray.Add(MakeShared<FJsonValueObject>(Entry.Entry));
+    }
+    OutHistory->SetArrayField(TEXT("history"), HistoryArray);
+    OutHistory->SetArrayField(TEXT("instances"), InstancesArray);
+
+    if (Histories.Num() == 0)
+    {
+        OutHistory->SetStringField(TEXT("note"), Recorder.IsRecording()
+            ? TEXT("No matching StateTree has run in PIE since recording started")
+            : TEXT("Execution history is recorded while start_state_tree_recording is active during PIE"));
+    }
+
+    return true;
+}
+
+bool FStateTreeService::StartStateTreeRecording(const FString& StateTreePath, int32 Capacity, FString& OutError)
+{
+    UStateTree* StateTree = nullptr;
+    if (!StateTreePath.IsEmpty())
+    {
+        StateTree = FindStateTree(StateTreePath);
+        if (!StateTree)
+        {
+            OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *StateTreePath);
+            return false;
+        }
+    }
+
+    return FStateTreeExecutionRecorder::Get().Start(StateTree, Capacity, OutError);
+}
+
+bool FStateTreeService::StopStateTreeRecording()
+{
+    FStateTreeExecutionRecorder& Recorder = FStateTreeExecutionRecorder::Get();
+    const bool bWasRecording = Recorder.IsRecording();
+    Recorder.Stop();
+    return bWasRecording;
+}
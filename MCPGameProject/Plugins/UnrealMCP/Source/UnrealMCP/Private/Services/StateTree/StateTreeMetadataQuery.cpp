@@ -0,0 +1,264 @@
+// StateTreeMetadataQuery.cpp - StateTree metadata with subtree, depth, field and revision queries
+// GetStateTreeMetadata, BuildStateMetadata
+
+#include "Services/StateTreeService.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+namespace
+{
+    /** A field is returned when the query names it, or names no field at all */
+    bool WantsMetadataField(const FStateTreeMetadataQuery& Query, const TCHAR* Field)
+    {
+        return Query.Fields.Num() == 0 || Query.Fields.Contains(Field);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> BuildEvaluatorMetadata(const UStateTreeEditorData* EditorData)
+    {
+        TArray<TSharedPtr<FJsonValue>> EvaluatorArray;
+        for (const FStateTreeEditorNode& Evaluator : EditorData->Evaluators)
+        {
+            TSharedPtr<FJsonObject> EvalObj = MakeShared<FJsonObject>();
+            EvalObj->SetStringField(TEXT("id"), Evaluator.ID.ToString());
+            // Use struct name as the evaluator name in UE5.7 (InstanceName not available)
+            if (Evaluator.Node.GetScriptStruct())
+            {
+                EvalObj->SetStringField(TEXT("name"), Evaluator.Node.GetScriptStruct()->GetName());
+                EvalObj->SetStringField(TEXT("type"), Evaluator.Node.GetScriptStruct()->GetName());
+            }
+            else
+            {
+                EvalObj->SetStringField(TEXT("name"), TEXT("Unknown"));
+            }
+            EvaluatorArray.Add(MakeShared<FJsonValueObject>(EvalObj));
+        }
+        return EvaluatorArray;
+    }
+}
+
+bool FStateTreeService::GetStateTreeMetadata(UStateTree* StateTree, const FStateTreeMetadataQuery& Query, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError)
+{
+    if (!StateTree)
+    {
+        OutError = TEXT("Invalid StateTree");
+        return false;
+    }
+
+    OutMetadata = MakeShared<FJsonObject>();
+    OutMetadata->SetStringField(TEXT("name"), StateTree->GetName());
+    OutMetadata->SetStringField(TEXT("path"), StateTree->GetPathName());
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        return true;
+    }
+
+    // The subtree is resolved before the walk so an unknown state fails without side effects
+    TArray<UStateTreeState*> StartStates;
+    if (!Query.StateName.IsEmpty())
+    {
+        UStateTreeState* StartState = FindStateByName(EditorData, Query.StateName);
+        if (!StartState)
+        {
+            OutError = FString::Printf(TEXT("State '%s' not found"), *Query.StateName);
+            return false;
+        }
+        StartStates.Add(StartState);
+        OutMetadata->SetStringField(TEXT("root_state"), StartState->Name.ToString());
+    }
+    else
+    {
+        StartStates = GetRootStates(EditorData);
+    }
+
+    const FTreeRevision& Revision = UpdateTreeRevision(StateTree, EditorData);
+    OutMetadata->SetNumberField(TEXT("revision"), static_cast<double>(Revision.Revision));
+
+    // A revision from before the tree was first seen (an earlier editor session) or not handed out yet
+    // cannot be diffed against, so it gets a full read
+    const bool bDiff = Query.SinceRevision >= Revision.FirstRevision && Query.SinceRevision <= Revision.Revision;
+    OutMetadata->SetBoolField(TEXT("full"), !bDiff);
+
+    if (!bDiff || Revision.GlobalsChangedAt > Query.SinceRevision)
+    {
+        if (EditorData->Schema && WantsMetadataField(Query, TEXT("schema")))
+        {
+            OutMetadata->SetStringField(TEXT("schema"), EditorData->Schema->GetName());
+        }
+        if (WantsMetadataField(Query, TEXT("evaluators")))
+        {
+            OutMetadata->SetArrayField(TEXT("evaluators"), BuildEvaluatorMetadata(EditorData));
+        }
+    }
+
+    if (!bDiff)
+    {
+        // Add states (tree structure)
+        TArray<TSharedPtr<FJsonValue>> StatesArray;
+        for (UStateTreeState* StartState : StartStates)
+        {
+            StatesArray.Add(MakeShared<FJsonValueObject>(BuildStateMetadata(StartState, Query, 0, false)));
+        }
+        OutMetadata->SetArrayField(TEXT("states"), StatesArray);
+        return true;
+    }
+
+    OutMetadata->SetNumberField(TEXT("since_revision"), static_cast<double>(Query.SinceRevision));
+    OutMetadata->SetBoolField(TEXT("globals_changed"), Revision.GlobalsChangedAt > Query.SinceRevision);
+
+    // Changed states within the subtree and depth, flat, each naming its parent
+    TArray<TSharedPtr<FJsonValue>> ChangedArray;
+    TArray<TPair<UStateTreeState*, int32>> Stack;
+    for (int32 Index = StartStates.Num() - 1; Index >= 0; --Index)
+    {
+        Stack.Emplace(StartStates[Index], 0);
+    }
+    while (Stack.Num() > 0)
+    {
+        const TPair<UStateTreeState*, int32> Entry = Stack.Pop(EAllowShrinking::No);
+        UStateTreeState* State = Entry.Key;
+        if (!State)
+        {
+            continue;
+        }
+
+        const FStateRevision* StateRevision = Revision.States.Find(State->ID);
+        if (StateRevision && StateRevision->ChangedAt > Query.SinceRevision)
+        {
+            TSharedPtr<FJsonObject> StateObj = BuildStateMetadata(State, Query, Entry.Value, true);
+            StateObj->SetStringField(TEXT("parent_id"), State->Parent ? State->Parent->ID.ToString() : FString());
+            StateObj->SetNumberField(TEXT("depth"), Entry.Value);
+            ChangedArray.Add(MakeShared<FJsonValueObject>(StateObj));
+        }
+
+        if (Query.MaxDepth < 0 || Entry.Value < Query.MaxDepth)
+        {
+            for (int32 ChildIndex = State->Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+            {
+                Stack.Emplace(State->Children[ChildIndex], Entry.Value + 1);
+            }
+        }
+    }
+    OutMetadata->SetArrayField(TEXT("changed_states"), ChangedArray);
+
+    // Removed states are reported wherever they were, their position being gone with them
+    TArray<TSharedPtr<FJsonValue>> RemovedArray;
+    for (const TPair<FGuid, int64>& Removed : Revision.RemovedAt)
+    {
+        if (Removed.Value > Query.SinceRevision)
+        {
+            RemovedArray.Add(MakeShared<FJsonValueString>(Removed.Key.ToString()));
+        }
+    }
+    OutMetadata->SetArrayField(TEXT("removed_state_ids"), RemovedArray);
+
+    return true;
+}
+
+TSharedPtr<FJsonObject> FStateTreeService::BuildStateMetadata(UStateTreeState* State, const FStateTreeMetadataQuery& Query, int32 Depth, bool bFlat)
+{
+    TSharedPtr<FJsonObject> StateObj = MakeShared<FJsonObject>();
+
+    if (!State)
+    {
+        return StateObj;
+    }
+
+    StateObj->SetStringField(TEXT("name"), State->Name.ToString());
+    StateObj->SetStringField(TEXT("id"), State->ID.ToString());
+    if (WantsMetadataField(Query, TEXT("enabled")))
+    {
+        StateObj->SetBoolField(TEXT("enabled"), State->bEnabled);
+    }
+    if (WantsMetadataField(Query, TEXT("type")))
+    {
+        StateObj->SetNumberField(TEXT("type"), static_cast<int32>(State->Type));
+    }
+    if (WantsMetadataField(Query, TEXT("selection_behavior")))
+    {
+        StateObj->SetNumberField(TEXT("selection_behavior"), static_cast<int32>(State->SelectionBehavior));
+    }
+
+    // Add tasks
+    if (WantsMetadataField(Query, TEXT("tasks")))
+    {
+        TArray<TSharedPtr<FJsonValue>> TasksArray;
+        for (const FStateTreeEditorNode& Task : State->Tasks)
+        {
+            TSharedPtr<FJsonObject> TaskObj = MakeShared<FJsonObject>();
+            TaskObj->SetStringField(TEXT("id"), Task.ID.ToString());
+            if (Task.Node.GetScriptStruct())
+            {
+                TaskObj->SetStringField(TEXT("type"), Task.Node.GetScriptStruct()->GetName());
+            }
+            TasksArray.Add(MakeShared<FJsonValueObject>(TaskObj));
+        }
+        StateObj->SetArrayField(TEXT("tasks"), TasksArray);
+    }
+
+    // Add transitions
+    if (WantsMetadataField(Query, TEXT("transitions")))
+    {
+        TArray<TSharedPtr<FJsonValue>> TransitionsArray;
+        for (const FStateTreeTransition& Transition : State->Transitions)
+        {
+            TSharedPtr<FJsonObject> TransObj = MakeShared<FJsonObject>();
+            TransObj->SetNumberField(TEXT("trigger"), static_cast<int32>(Transition.Trigger));
+            TransObj->SetBoolField(TEXT("delay_transition"), Transition.bDelayTransition);
+            TransObj->SetNumberField(TEXT("delay_duration"), Transition.DelayDuration);
+            TransObj->SetNumberField(TEXT("priority"), static_cast<int32>(Transition.Priority));
+            TransObj->SetNumberField(TEXT("condition_count"), Transition.Conditions.Num());
+            TransitionsArray.Add(MakeShared<FJsonValueObject>(TransObj));
+        }
+        StateObj->SetArrayField(TEXT("transitions"), TransitionsArray);
+    }
+
+    // Add enter conditions count
+    if (WantsMetadataField(Query, TEXT("enter_condition_count")))
+    {
+        StateObj->SetNumberField(TEXT("enter_condition_count"), State->EnterConditions.Num());
+    }
+
+    if (!WantsMetadataField(Query, TEXT("children")))
+    {
+        return StateObj;
+    }
+
+    if (bFlat)
+    {
+        TArray<TSharedPtr<FJsonValue>> ChildIdsArray;
+        for (UStateTreeState* Child : State->Children)
+        {
+            if (Child)
+            {
+                ChildIdsArray.Add(MakeShared<FJsonValueString>(Child->ID.ToString()));
+            }
+        }
+        StateObj->SetArrayField(TEXT("child_ids"), ChildIdsArray);
+    }
+    else if (Query.MaxDepth >= 0 && Depth >= Query.MaxDepth)
+    {
+        // Below the requested depth only the number of children is reported
+        StateObj->SetNumberField(TEXT("child_count"), State->Children.Num());
+    }
+    else
+    {
+        // Add children recursively
+        TArray<TSharedPtr<FJsonValue>> ChildrenArray;
+        for (UStateTreeState* Child : State->Children)
+        {
+            if (Child)
+            {
+                TSharedPtr<FJsonObject> ChildObj = BuildStateMetadata(Child, Query, Depth + 1, false);
+                ChildrenArray.Add(MakeShared<FJsonValueObject>(ChildObj));
+            }
+        }
+        StateObj->SetArrayField(TEXT("children"), ChildrenArray);
+    }
+
+    return StateObj;
+}
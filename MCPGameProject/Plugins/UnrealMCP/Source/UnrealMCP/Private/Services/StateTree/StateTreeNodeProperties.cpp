@@ -0,0 +1,421 @@
+// StateTreeNodeProperties.cpp - Task and evaluator removal and property edits
+// RemoveTaskFromState, SetTaskProperties, RemoveEvaluator, SetEvaluatorProperties, ApplyNodeProperties, BatchSetNodeProperties
+
+#include "Services/StateTreeService.h"
+#include "Services/StateTree/StateTreePropertyPathResolver.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "Dom/JsonObject.h"
+#include "MCPBatchEditScope.h"
+
+bool FBatchSetNodePropertiesParams::IsValid(FString& OutError) const
+{
+    if (StateTreePath.IsEmpty())
+    {
+        OutError = TEXT("StateTreePath is required");
+        return false;
+    }
+    if (Edits.Num() == 0)
+    {
+        OutError = TEXT("At least one edit is required");
+        return false;
+    }
+    return true;
+}
+
+bool FStateTreeService::RemoveTaskFromState(const FRemoveTaskFromStateParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    UStateTreeState* State = FindStateByName(EditorData, Params.StateName);
+    if (!State)
+    {
+        OutError = FString::Printf(TEXT("State not found: '%s'"), *Params.StateName);
+        return false;
+    }
+
+    if (Params.TaskIndex < 0 || Params.TaskIndex >= State->Tasks.Num())
+    {
+        OutError = FString::Printf(TEXT("Invalid task index: %d (total: %d)"), Params.TaskIndex, State->Tasks.Num());
+        return false;
+    }
+
+    State->Tasks.RemoveAt(Params.TaskIndex);
+
+    StateTree->Modify();
+    SaveAsset(StateTree, OutError);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::RemoveTaskFromState: Removed task %d from state '%s'"),
+        Params.TaskIndex, *Params.StateName);
+    return true;
+}
+
+bool FStateTreeService::SetTaskProperties(const FSetTaskPropertiesParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    UStateTreeState* State = FindStateByName(EditorData, Params.StateName);
+    if (!State)
+    {
+        OutError = FString::Printf(TEXT("State not found: '%s'"), *Params.StateName);
+        return false;
+    }
+
+    if (Params.TaskIndex < 0 || Params.TaskIndex >= State->Tasks.Num())
+    {
+        OutError = FString::Printf(TEXT("Invalid task index: %d (total: %d)"), Params.TaskIndex, State->Tasks.Num());
+        return false;
+    }
+
+    FStateTreeEditorNode& TaskNode = State->Tasks[Params.TaskIndex];
+
+    StateTree->Modify();
+    State->Modify();
+
+    TArray<FString> SetPaths;
+    TMap<FString, FString> FailedPaths;
+    FStateTreePropertyPathResolver Resolver;
+    ApplyNodeProperties(TaskNode, Params.Properties, Resolver, SetPaths, FailedPaths);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::SetTaskProperties: Set %d propert(ies) on task %d in state '%s', %d failed"),
+        SetPaths.Num(), Params.TaskIndex, *Params.StateName, FailedPaths.Num());
+
+    FString SaveError;
+    SaveAsset(StateTree, SaveError);
+
+    if (FailedPaths.Num() > 0)
+    {
+        TArray<FString> Failures;
+        for (const TPair<FString, FString>& Failed : FailedPaths)
+        {
+            Failures.Add(FString::Printf(TEXT("%s (%s)"), *Failed.Key, *Failed.Value));
+        }
+        OutError = FString::Printf(TEXT("Failed to set properties: %s"), *FString::Join(Failures, TEXT(", ")));
+        return false;
+    }
+    return true;
+}
+
+bool FStateTreeService::RemoveEvaluator(const FRemoveEvaluatorParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    if (Params.EvaluatorIndex < 0 || Params.EvaluatorIndex >= EditorData->Evaluators.Num())
+    {
+        OutError = FString::Printf(TEXT("Invalid evaluator index: %d (total: %d)"), Params.EvaluatorIndex, EditorData->Evaluators.Num());
+        return false;
+    }
+
+    EditorData->Evaluators.RemoveAt(Params.EvaluatorIndex);
+
+    StateTree->Modify();
+    SaveAsset(StateTree, OutError);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::RemoveEvaluator: Removed evaluator %d"), Params.EvaluatorIndex);
+    return true;
+}
+
+bool FStateTreeService::SetEvaluatorProperties(const FSetEvaluatorPropertiesParams& Params, FString& OutError)
+{
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    if (Params.EvaluatorIndex < 0 || Params.EvaluatorIndex >= EditorData->Evaluators.Num())
+    {
+        OutError = FString::Printf(TEXT("Invalid evaluator index: %d (total: %d)"), Params.EvaluatorIndex, EditorData->Evaluators.Num());
+        return false;
+    }
+
+    FStateTreeEditorNode& EvaluatorNode = EditorData->Evaluators[Params.EvaluatorIndex];
+
+    StateTree->Modify();
+    EditorData->Modify();
+
+    TArray<FString> SetPaths;
+    TMap<FString, FString> FailedPaths;
+    FStateTreePropertyPathResolver Resolver;
+    ApplyNodeProperties(EvaluatorNode, Params.Properties, Resolver, SetPaths, FailedPaths);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::SetEvaluatorProperties: Set %d propert(ies) on evaluator %d, %d failed"),
+        SetPaths.Num(), Params.EvaluatorIndex, FailedPaths.Num());
+
+    FString SaveError;
+    SaveAsset(StateTree, SaveError);
+
+    if (FailedPaths.Num() > 0)
+    {
+        TArray<FString> Failures;
+        for (const TPair<FString, FString>& Failed : FailedPaths)
+        {
+            Failures.Add(FString::Printf(TEXT("%s (%s)"), *Failed.Key, *Failed.Value));
+        }
+        OutError = FString::Printf(TEXT("Failed to set properties: %s"), *FString::Join(Failures, TEXT(", ")));
+        return false;
+    }
+    return true;
+}
+
+void FStateTreeService::ApplyNodeProperties(FStateTreeEditorNode& Node, const TSharedPtr<FJsonObject>& Properties,
+                                            FStateTreePropertyPathResolver& Resolver, TArray<FString>& OutSet, TMap<FString, FString>& OutFailed)
+{
+    if (!Properties.IsValid())
+    {
+        return;
+    }
+
+    // Instance data first, as the editor's details panel shows it; Blueprint nodes keep theirs in an object
+    UObject* InstanceObject = Node.InstanceObject;
+    const UStruct* InstanceType = InstanceObject ? InstanceObject->GetClass() : Node.Instance.GetScriptStruct();
+    void* InstanceMemory = InstanceObject ? static_cast<void*>(InstanceObject) : Node.Instance.GetMutableMemory();
+    const UStruct* NodeType = Node.Node.GetScriptStruct();
+    void* NodeMemory = Node.Node.GetMutableMemory();
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Properties->Values)
+    {
+        const TArray<const FProperty*>* Chain = nullptr;
+        void* Container = nullptr;
+        if (InstanceMemory)
+        {
+            Chain = Resolver.Resolve(InstanceType, Property.Key);
+            Container = InstanceMemory;
+        }
+        if (!Chain && NodeMemory)
+        {
+            Chain = Resolver.Resolve(NodeType, Property.Key);
+            Container = NodeMemory;
+        }
+        if (!Chain)
+        {
+            OutFailed.Add(Property.Key, TEXT("Property not found"));
+            continue;
+        }
+
+        if (InstanceObject && Container == InstanceMemory)
+        {
+            InstanceObject->Modify();
+        }
+
+        FProperty* Leaf = const_cast<FProperty*>(Chain->Last());
+        if (!FJsonObjectConverter::JsonValueToUProperty(Property.Value, Leaf, FStateTreePropertyPathResolver::GetValuePtr(*Chain, Container), 0, 0))
+        {
+            OutFailed.Add(Property.Key, FString::Printf(TEXT("Value does not convert to %s"), *Leaf->GetCPPType()));
+            continue;
+        }
+        OutSet.Add(Property.Key);
+    }
+}
+
+bool FStateTreeService::BatchSetNodeProperties(const FBatchSetNodePropertiesParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+    // One undo step and one save for every edit
+    FMCPBatchEditScope EditScope(FText::FromString(TEXT("MCP Batch Set Node Properties")));
+
+    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
+    if (!StateTree)
+    {
+        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+        return false;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    StateTree->Modify();
+    EditorData->Modify();
+
+    // States and property paths are each looked up once for the whole batch
+    TMap<FString, UStateTreeState*> StatesByName;
+    CollectStatesByName(EditorData, StatesByName);
+    TSet<UStateTreeState*> ModifiedStates;
+    FStateTreePropertyPathResolver Resolver;
+
+    TArray<TSharedPtr<FJsonValue>> EditResults;
+    int32 SetCount = 0;
+    int32 FailedCount = 0;
+
+    for (int32 EditIndex = 0; EditIndex < Params.Edits.Num(); ++EditIndex)
+    {
+        const FNodePropertyEdit& Edit = Params.Edits[EditIndex];
+
+        TSharedPtr<FJsonObject> EditResult = MakeShared<FJsonObject>();
+        EditResult->SetNumberField(TEXT("index"), EditIndex);
+        EditResult->SetStringField(TEXT("node_type"), Edit.NodeType);
+        if (!Edit.StateName.IsEmpty())
+        {
+            EditResult->SetStringField(TEXT("state"), Edit.StateName);
+        }
+        EditResults.Add(MakeShared<FJsonValueObject>(EditResult));
+
+        auto FailEdit = [&EditResult, &FailedCount](const FString& Error)
+        {
+            EditResult->SetBoolField(TEXT("success"), false);
+            EditResult->SetStringField(TEXT("error"), Error);
+            FailedCount++;
+        };
+
+        TArray<FStateTreeEditorNode>* Nodes = nullptr;
+        if (Edit.NodeType == TEXT("task"))
+        {
+            UStateTreeState** State = StatesByName.Find(Edit.StateName);
+            if (!State)
+            {
+                // The map holds the first state of each name; IDs go through the index
+                UStateTreeState* FoundState = FindStateByName(EditorData, Edit.StateName);
+                State = FoundState ? &StatesByName.Add(Edit.StateName, FoundState) : nullptr;
+            }
+            if (!State)
+            {
+                FailEdit(FString::Printf(TEXT("State not found: '%s'"), *Edit.StateName));
+                continue;
+            }
+            if (!ModifiedStates.Contains(*State))
+            {
+                (*State)->Modify();
+                ModifiedStates.Add(*State);
+            }
+            Nodes = &(*State)->Tasks;
+        }
+        else if (Edit.NodeType == TEXT("global_task"))
+        {
+            Nodes = &EditorData->GlobalTasks;
+        }
+        else if (Edit.NodeType == TEXT("evaluator"))
+        {
+            Nodes = &EditorData->Evaluators;
+        }
+        else
+        {
+            FailEdit(FString::Printf(TEXT("Unknown node type: '%s' (expected task, global_task or evaluator)"), *Edit.NodeType));
+            continue;
+        }
+
+        int32 NodeIndex = INDEX_NONE;
+        if (!Edit.NodeName.IsEmpty())
+        {
+            FGuid NodeId;
+            const bool bIsId = FGuid::Parse(Edit.NodeName, NodeId);
+            NodeIndex = Nodes->IndexOfByPredicate([&Edit, &NodeId, bIsId](const FStateTreeEditorNode& Node)
+            {
+                if (bIsId)
+                {
+                    return Node.ID == NodeId;
+                }
+                const FStateTreeNodeBase* NodeBase = Node.Node.GetPtr<FStateTreeNodeBase>();
+                return (NodeBase && NodeBase->Name.ToString() == Edit.NodeName)
+                    || (Node.Node.GetScriptStruct() && Node.Node.GetScriptStruct()->GetName() == Edit.NodeName);
+            });
+            if (NodeIndex == INDEX_NONE)
+            {
+                FailEdit(FString::Printf(TEXT("Node not found: '%s'"), *Edit.NodeName));
+                continue;
+            }
+        }
+        else if (Edit.NodeIndex >= 0 && Edit.NodeIndex < Nodes->Num())
+        {
+            NodeIndex = Edit.NodeIndex;
+        }
+        else
+        {
+            FailEdit(FString::Printf(TEXT("Invalid node index: %d (total: %d)"), Edit.NodeIndex, Nodes->Num()));
+            continue;
+        }
+
+        FStateTreeEditorNode& Node = (*Nodes)[NodeIndex];
+        EditResult->SetNumberField(TEXT("node_index"), NodeIndex);
+        EditResult->SetStringField(TEXT("node_id"), Node.ID.ToString());
+
+        TArray<FString> SetPaths;
+        TMap<FString, FString> FailedPaths;
+        ApplyNodeProperties(Node, Edit.Properties, Resolver, SetPaths, FailedPaths);
+        SetCount += SetPaths.Num();
+
+        TArray<TSharedPtr<FJsonValue>> SetArray;
+        for (const FString& Path : SetPaths)
+        {
+            SetArray.Add(MakeShared<FJsonValueString>(Path));
+        }
+        EditResult->SetArrayField(TEXT("set"), SetArray);
+
+        if (FailedPaths.Num() > 0)
+        {
+            TSharedPtr<FJsonObject> FailedObj = MakeShared<FJsonObject>();
+            for (const TPair<FString, FString>& Failed : FailedPaths)
+            {
+                FailedObj->SetStringField(Failed.Key, Failed.Value);
+            }
+            EditResult->SetObjectField(TEXT("failed"), FailedObj);
+            FailEdit(FString::Printf(TEXT("%d propert(ies) could not be set"), FailedPaths.Num()));
+            continue;
+        }
+        EditResult->SetBoolField(TEXT("success"), true);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchSetNodeProperties: Set %d propert(ies) over %d edit(s), %d edit(s) failed, %d path(s) reflected"),
+        SetCount, Params.Edits.Num(), FailedCount, Resolver.GetResolvedCount());
+
+    if (SetCount > 0)
+    {
+        FString SaveError;
+        SaveAsset(StateTree, SaveError);
+    }
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("state_tree_path"), StateTree->GetPathName());
+    OutReport->SetNumberField(TEXT("edit_count"), Params.Edits.Num());
+    OutReport->SetNumberField(TEXT("property_count"), SetCount);
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("edits"), EditResults);
+    return true;
+}
@@ -0,0 +1,425 @@
+#include "Services/StateTreeNodeTypeCatalog.h"
+#include "Services/ReflectionTypeIndex.h"
+#include "MCPLogging.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Blueprint/StateTreeTaskBlueprintBase.h"
+#include "Blueprint/StateTreeConditionBlueprintBase.h"
+#include "Blueprint/StateTreeEvaluatorBlueprintBase.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeConditionBase.h"
+#include "StateTreeEvaluatorBase.h"
+#include "StateTreeSchema.h"
+#include "Engine/Blueprint.h"
+#include "UObject/UObjectHash.h"
+#include "Editor.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+    /** Base struct of the native types of each kind */
+    const UScriptStruct* GetNodeBaseStruct(EStateTreeNodeKind Kind)
+    {
+        switch (Kind)
+        {
+        case EStateTreeNodeKind::Task:
+            return FStateTreeTaskBase::StaticStruct();
+        case EStateTreeNodeKind::Condition:
+            return FStateTreeConditionBase::StaticStruct();
+        default:
+            return FStateTreeEvaluatorBase::StaticStruct();
+        }
+    }
+
+    /** Kind of node a class is, if it derives from one of the Blueprint node base classes */
+    bool GetNodeKindOfClass(const UClass* Class, EStateTreeNodeKind& OutKind)
+    {
+        if (!Class)
+        {
+            return false;
+        }
+        if (Class->IsChildOf(UStateTreeTaskBlueprintBase::StaticClass()))
+        {
+            OutKind = EStateTreeNodeKind::Task;
+            return true;
+        }
+        if (Class->IsChildOf(UStateTreeConditionBlueprintBase::StaticClass()))
+        {
+            OutKind = EStateTreeNodeKind::Condition;
+            return true;
+        }
+        if (Class->IsChildOf(UStateTreeEvaluatorBlueprintBase::StaticClass()))
+        {
+            OutKind = EStateTreeNodeKind::Evaluator;
+            return true;
+        }
+        return false;
+    }
+}
+
+FStateTreeNodeTypeCatalog& FStateTreeNodeTypeCatalog::Get()
+{
+    static FStateTreeNodeTypeCatalog Instance;
+    return Instance;
+}
+
+void FStateTreeNodeTypeCatalog::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleModulesChanged);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FStateTreeNodeTypeCatalog::HandleReloadComplete);
+
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetAddedHandle = AssetRegistry->OnAssetAdded().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleAssetChanged);
+        AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleAssetChanged);
+        AssetRenamedHandle = AssetRegistry->OnAssetRenamed().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleAssetRenamed);
+        AssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleAssetChanged);
+    }
+
+    if (GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FStateTreeNodeTypeCatalog::HandleBlueprintCompiled);
+    }
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("statetree_node_type_catalog"), TEXT("index"), CacheCounters,
+        [this]()
+        {
+            int64 Count = 0;
+            for (const TPair<TObjectKey<UClass>, FSchemaLists>& Entry : NativeListsBySchema)
+            {
+                for (const TArray<FEntry>& List : Entry.Value.Native)
+                {
+                    Count += List.Num();
+                }
+            }
+            for (const TArray<FEntry>& List : BlueprintTypes)
+            {
+                Count += List.Num();
+            }
+            return Count;
+        });
+}
+
+void FStateTreeNodeTypeCatalog::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+
+    // The asset registry and the editor may already be gone during editor shutdown
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry->OnAssetRenamed().Remove(AssetRenamedHandle);
+        AssetRegistry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+    }
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    ModulesChangedHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    AssetAddedHandle.Reset();
+    AssetRemovedHandle.Reset();
+    AssetRenamedHandle.Reset();
+    AssetUpdatedHandle.Reset();
+    BlueprintCompiledHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("statetree_node_type_catalog"));
+
+    InvalidateNative();
+    InvalidateBlueprints();
+}
+
+const TArray<FStateTreeNodeTypeCatalog::FEntry>& FStateTreeNodeTypeCatalog::GetNativeTypes(EStateTreeNodeKind Kind, const UClass* SchemaClass)
+{
+    check(IsInGameThread());
+
+    const TObjectKey<UClass> SchemaKey(SchemaClass);
+    if (FSchemaLists* Lists = NativeListsBySchema.Find(SchemaKey))
+    {
+        CacheCounters.RecordHit();
+        return Lists->Native[static_cast<int32>(Kind)];
+    }
+    CacheCounters.RecordMiss();
+
+    // Every kind of a schema is built at once; a tree being edited asks for all three
+    const double StartTime = FPlatformTime::Seconds();
+    const UStateTreeSchema* Schema = SchemaClass && SchemaClass->IsChildOf(UStateTreeSchema::StaticClass())
+        ? SchemaClass->GetDefaultObject<UStateTreeSchema>()
+        : nullptr;
+
+    FSchemaLists& Lists = NativeListsBySchema.Add(SchemaKey);
+    for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(Lists.Native); ++KindIndex)
+    {
+        TArray<FEntry>& Entries = Lists.Native[KindIndex];
+        for (UScriptStruct* Struct : FReflectionTypeIndex::Get().GetDerivedStructs(GetNodeBaseStruct(static_cast<EStateTreeNodeKind>(KindIndex))))
+        {
+            if (!Schema || Schema->IsStructAllowed(Struct))
+            {
+                Entries.Add(MakeEntry(Struct->GetPathName(), Struct->GetName()));
+            }
+        }
+        SortEntries(Entries);
+    }
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("StateTree node type catalog: %d tasks, %d conditions, %d evaluators for schema '%s' in %.1f ms"),
+        Lists.Native[0].Num(), Lists.Native[1].Num(), Lists.Native[2].Num(),
+        SchemaClass ? *SchemaClass->GetName() : TEXT("any"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return Lists.Native[static_cast<int32>(Kind)];
+}
+
+const TArray<FStateTreeNodeTypeCatalog::FEntry>& FStateTreeNodeTypeCatalog::GetBlueprintTypes(EStateTreeNodeKind Kind)
+{
+    check(IsInGameThread());
+    EnsureBlueprintTypesBuilt();
+    return BlueprintTypes[static_cast<int32>(Kind)];
+}
+
+int32 FStateTreeNodeTypeCatalog::FilterEntries(const TArray<FEntry>& Entries, const FString& Filter, int32 Offset, int32 Limit, TArray<const FEntry*>& OutPage)
+{
+    OutPage.Reset();
+
+    const FString LowerFilter = Filter.ToLower();
+    const int32 First = FMath::Max(Offset, 0);
+    int32 MatchCount = 0;
+    for (const FEntry& Entry : Entries)
+    {
+        if (!LowerFilter.IsEmpty()
+            && !Entry.LowerName.Contains(LowerFilter, ESearchCase::CaseSensitive)
+            && !Entry.LowerPath.Contains(LowerFilter, ESearchCase::CaseSensitive))
+        {
+            continue;
+        }
+
+        if (MatchCount >= First && (Limit <= 0 || OutPage.Num() < Limit))
+        {
+            OutPage.Add(&Entry);
+        }
+        MatchCount++;
+    }
+    return MatchCount;
+}
+
+void FStateTreeNodeTypeCatalog::EnsureBlueprintTypesBuilt()
+{
+    if (bBlueprintTypesBuilt)
+    {
+        CacheCounters.RecordHit();
+        return;
+    }
+    CacheCounters.RecordMiss();
+
+    IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+    if (!AssetRegistry)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    InvalidateBlueprints();
+
+    TArray<FAssetData> BlueprintAssets;
+    AssetRegistry->GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets, true);
+
+    for (const FAssetData& AssetData : BlueprintAssets)
+    {
+        EStateTreeNodeKind Kind;
+        FString ObjectPath;
+        if (GetBlueprintNodeKind(AssetData, Kind, ObjectPath))
+        {
+            BlueprintTypes[static_cast<int32>(Kind)].Add(MakeEntry(ObjectPath, AssetData.AssetName.ToString()));
+        }
+    }
+    for (TArray<FEntry>& Entries : BlueprintTypes)
+    {
+        SortEntries(Entries);
+    }
+
+    // A scan still running leaves the lists incomplete; they are rebuilt by the next lookup
+    bBlueprintTypesBuilt = !AssetRegistry->IsLoadingAssets();
+
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("StateTree node type catalog: %d Blueprint tasks, %d conditions, %d evaluators of %d Blueprints in %.1f ms"),
+        BlueprintTypes[0].Num(), BlueprintTypes[1].Num(), BlueprintTypes[2].Num(), BlueprintAssets.Num(),
+        (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+}
+
+bool FStateTreeNodeTypeCatalog::GetBlueprintNodeKind(const FAssetData& AssetData, EStateTreeNodeKind& OutKind, FString& OutClassPath)
+{
+    OutClassPath = AssetData.GetObjectPathString();
+
+    // A loaded Blueprint knows its current parent, which may differ from the saved tag
+    if (const UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.FastGetAsset(false)))
+    {
+        return GetNodeKindOfClass(Blueprint->GeneratedClass ? Blueprint->GeneratedClass.Get() : Blueprint->ParentClass.Get(), OutKind);
+    }
+
+    FString NativeParentClassPath;
+    if (!AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+    {
+        return false;
+    }
+
+    // The tag holds the exported text form, e.g. "/Script/CoreUObject.Class'/Script/StateTreeModule.StateTreeTaskBlueprintBase'"
+    const FString ClassObjectPath = FPackageName::ExportTextPathToObjectPath(NativeParentClassPath);
+    return GetNodeKindOfClass(FindObject<UClass>(nullptr, *ClassObjectPath), OutKind);
+}
+
+void FStateTreeNodeTypeCatalog::SortEntries(TArray<FEntry>& Entries)
+{
+    Entries.Sort([](const FEntry& A, const FEntry& B)
+    {
+        if (A.LowerName != B.LowerName)
+        {
+            return A.LowerName < B.LowerName;
+        }
+        return A.LowerPath < B.LowerPath;
+    });
+}
+
+FStateTreeNodeTypeCatalog::FEntry FStateTreeNodeTypeCatalog::MakeEntry(const FString& Path, const FString& Name)
+{
+    FEntry Entry;
+    Entry.Path = Path;
+    Entry.Name = Name;
+    Entry.LowerPath = Path.ToLower();
+    Entry.LowerName = Name.ToLower();
+    return Entry;
+}
+
+void FStateTreeNodeTypeCatalog::InvalidateNative()
+{
+    if (NativeListsBySchema.Num() > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    NativeListsBySchema.Empty();
+}
+
+void FStateTreeNodeTypeCatalog::InvalidateBlueprints()
+{
+    if (bBlueprintTypesBuilt)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+    for (TArray<FEntry>& Entries : BlueprintTypes)
+    {
+        Entries.Empty();
+    }
+    bBlueprintTypesBuilt = false;
+}
+
+void FStateTreeNodeTypeCatalog::HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    // A new module may declare node structs and Blueprint base classes alike
+    if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+    {
+        InvalidateNative();
+        InvalidateBlueprints();
+    }
+}
+
+void FStateTreeNodeTypeCatalog::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    InvalidateNative();
+    InvalidateBlueprints();
+}
+
+void FStateTreeNodeTypeCatalog::HandleAssetChanged(const FAssetData& AssetData)
+{
+    if (bBlueprintTypesBuilt && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        InvalidateBlueprints();
+    }
+}
+
+void FStateTreeNodeTypeCatalog::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    HandleAssetChanged(AssetData);
+}
+
+void FStateTreeNodeTypeCatalog::HandleBlueprintCompiled()
+{
+    InvalidateBlueprints();
+}
+
+UClass* FStateTreeNodeTypeCatalog::FindSchemaClass(const FString& SchemaClassName)
+{
+    UClass* SchemaClass = nullptr;
+    FString TargetNameWithU = TEXT("U") + SchemaClassName;
+
+    // Try FindObject with exact name and U prefix
+    SchemaClass = FindObject<UClass>(nullptr, *SchemaClassName);
+    if (!SchemaClass)
+    {
+        SchemaClass = FindObject<UClass>(nullptr, *TargetNameWithU);
+    }
+
+    // Try LoadClass from common StateTree modules
+    if (!SchemaClass)
+    {
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/StateTreeModule.%s"), *SchemaClassName));
+    }
+    if (!SchemaClass)
+    {
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/StateTreeModule.U%s"), *SchemaClassName));
+    }
+    if (!SchemaClass)
+    {
+        // GameplayStateTreeModule is where AI and Component schemas live in UE5.7+
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/GameplayStateTreeModule.U%s"), *SchemaClassName));
+    }
+
+    // Try full script path format (e.g., "/Script/GameModule.UCustomStateTreeSchema")
+    if (!SchemaClass && SchemaClassName.StartsWith(TEXT("/Script/")))
+    {
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *SchemaClassName);
+    }
+
+    // Try game module (MCPGameProject) for project-specific schemas
+    if (!SchemaClass)
+    {
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/MCPGameProject.%s"), *SchemaClassName));
+    }
+    if (!SchemaClass)
+    {
+        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/MCPGameProject.U%s"), *SchemaClassName));
+    }
+
+    // Last resort: iterate through all loaded UStateTreeSchema subclasses and find by name
+    if (!SchemaClass)
+    {
+        TArray<UClass*> SchemaClasses;
+        GetDerivedClasses(UStateTreeSchema::StaticClass(), SchemaClasses, true);
+        for (UClass* Class : SchemaClasses)
+        {
+            if (Class && !Class->HasAnyClassFlags(CLASS_Abstract))
+            {
+                FString ClassName = Class->GetName();
+                if (ClassName.Equals(SchemaClassName, ESearchCase::IgnoreCase) ||
+                    ClassName.Equals(TargetNameWithU, ESearchCase::IgnoreCase))
+                {
+                    SchemaClass = Class;
+                    break;
+                }
+            }
+        }
+    }
+
+    return SchemaClass && SchemaClass->IsChildOf(UStateTreeSchema::StaticClass()) ? SchemaClass : nullptr;
+}
@@ -0,0 +1,79 @@
+// StateTreeNodeTypeQueries.cpp - Listing of the task, condition and evaluator types
+// GetAvailableTaskTypes, GetAvailableConditionTypes, GetAvailableEvaluatorTypes, QueryNodeTypes
+
+#include "Services/StateTreeService.h"
+#include "Services/StateTreeNodeTypeCatalog.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeSchema.h"
+
+bool FStateTreeService::GetAvailableTaskTypes(TArray<TPair<FString, FString>>& OutTasks)
+{
+    int32 TotalCount = 0;
+    FString Error;
+    return QueryNodeTypes(EStateTreeNodeKind::Task, false, FStateTreeNodeTypeQuery(), OutTasks, TotalCount, Error);
+}
+
+bool FStateTreeService::GetAvailableConditionTypes(TArray<TPair<FString, FString>>& OutConditions)
+{
+    int32 TotalCount = 0;
+    FString Error;
+    return QueryNodeTypes(EStateTreeNodeKind::Condition, false, FStateTreeNodeTypeQuery(), OutConditions, TotalCount, Error);
+}
+
+bool FStateTreeService::GetAvailableEvaluatorTypes(TArray<TPair<FString, FString>>& OutEvaluators)
+{
+    int32 TotalCount = 0;
+    FString Error;
+    return QueryNodeTypes(EStateTreeNodeKind::Evaluator, false, FStateTreeNodeTypeQuery(), OutEvaluators, TotalCount, Error);
+}
+
+bool FStateTreeService::QueryNodeTypes(EStateTreeNodeKind Kind, bool bBlueprint, const FStateTreeNodeTypeQuery& Query, TArray<TPair<FString, FString>>& OutTypes, int32& OutTotalCount, FString& OutError)
+{
+    FStateTreeNodeTypeCatalog& Catalog = FStateTreeNodeTypeCatalog::Get();
+
+    const TArray<FStateTreeNodeTypeCatalog::FEntry>* Entries = nullptr;
+    if (bBlueprint)
+    {
+        Entries = &Catalog.GetBlueprintTypes(Kind);
+    }
+    else
+    {
+        // The schema decides which native structs a tree accepts
+        const UClass* SchemaClass = nullptr;
+        if (!Query.SchemaClass.IsEmpty())
+        {
+            SchemaClass = FStateTreeNodeTypeCatalog::FindSchemaClass(Query.SchemaClass);
+            if (!SchemaClass)
+            {
+                OutError = FString::Printf(TEXT("Schema class not found: '%s'"), *Query.SchemaClass);
+                return false;
+            }
+        }
+        else if (!Query.StateTreePath.IsEmpty())
+        {
+            UStateTree* StateTree = FindStateTree(Query.StateTreePath);
+            if (!StateTree)
+            {
+                OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Query.StateTreePath);
+                return false;
+            }
+            const UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+            if (EditorData && EditorData->Schema)
+            {
+                SchemaClass = EditorData->Schema->GetClass();
+            }
+        }
+        Entries = &Catalog.GetNativeTypes(Kind, SchemaClass);
+    }
+
+    TArray<const FStateTreeNodeTypeCatalog::FEntry*> Page;
+    OutTotalCount = FStateTreeNodeTypeCatalog::FilterEntries(*Entries, Query.Filter, Query.Offset, Query.Limit, Page);
+
+    OutTypes.Reserve(OutTypes.Num() + Page.Num());
+    for (const FStateTreeNodeTypeCatalog::FEntry* Entry : Page)
+    {
+        OutTypes.Add(TPair<FString, FString>(Entry->Path, Entry->Name));
+    }
+    return true;
+}
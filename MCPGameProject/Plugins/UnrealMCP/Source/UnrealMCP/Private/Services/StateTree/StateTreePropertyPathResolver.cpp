@@ -0,0 +1,48 @@
+#include "Services/StateTree/StateTreePropertyPathResolver.h"
+#include "UObject/UnrealType.h"
+
+const TArray<const FProperty*>* FStateTreePropertyPathResolver::Resolve(const UStruct* Struct, const FString& Path)
+{
+    if (!Struct || Path.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const TPair<const UStruct*, FString> Key(Struct, Path);
+    if (const TArray<const FProperty*>* Found = Chains.Find(Key))
+    {
+        return Found->Num() > 0 ? Found : nullptr;
+    }
+
+    TArray<FString> Segments;
+    Path.ParseIntoArray(Segments, TEXT("."));
+
+    TArray<const FProperty*> Chain;
+    const UStruct* Current = Struct;
+    for (const FString& Segment : Segments)
+    {
+        const FProperty* Property = Current ? FindFProperty<FProperty>(Current, FName(*Segment)) : nullptr;
+        if (!Property)
+        {
+            Chain.Reset();
+            break;
+        }
+        Chain.Add(Property);
+
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        Current = StructProperty ? StructProperty->Struct.Get() : nullptr;
+    }
+
+    const TArray<const FProperty*>& Added = Chains.Add(Key, MoveTemp(Chain));
+    return Added.Num() > 0 ? &Added : nullptr;
+}
+
+void* FStateTreePropertyPathResolver::GetValuePtr(const TArray<const FProperty*>& Chain, void* Container)
+{
+    void* ValuePtr = Container;
+    for (const FProperty* Property : Chain)
+    {
+        ValuePtr = Property->ContainerPtrToValuePtr<void>(ValuePtr);
+    }
+    return ValuePtr;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Resolves dotted property paths ("Duration", "Settings.Radius") of a struct or class to the
+ * chain of properties leading to the value, caching each type's paths so a batch that sets the
+ * same properties on many nodes of one type reflects the type once
+ *
+ * Only nested struct properties are followed; arrays, maps and sets are set as a whole. The cache
+ * holds raw FProperty pointers, so a resolver lives for one batch and must not outlast a reload
+ * or recompile of the types it resolved.
+ */
+class FStateTreePropertyPathResolver
+{
+public:
+    /**
+     * Resolve a path, from the cache when this type and path were resolved before
+     * @param Struct Struct or class the path starts from
+     * @param Path Property names separated by dots
+     * @return Properties from the outermost to the leaf, or null if the path does not exist
+     */
+    const TArray<const FProperty*>* Resolve(const UStruct* Struct, const FString& Path);
+
+    /** Address of a resolved leaf within an instance of the type the chain was resolved for */
+    static void* GetValuePtr(const TArray<const FProperty*>& Chain, void* Container);
+
+    /** Number of distinct type and path pairs reflected so far */
+    int32 GetResolvedCount() const { return Chains.Num(); }
+
+private:
+    /** Chains by type and path; an empty chain records a path that does not exist */
+    TMap<TPair<const UStruct*, FString>, TArray<const FProperty*>> Chains;
+};
@@ -0,0 +1,148 @@
+// StateTreeRevision.cpp - Per-state revisions the metadata diff compares against
+// HashStateMetadata, UpdateTreeRevision
+
+#include "Services/StateTreeService.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+
+uint32 FStateTreeService::HashStateMetadata(const UStateTreeState* State)
+{
+    // Covers every field BuildStateMetadata reports, so a revision advances exactly when a read would differ
+    uint32 Hash = GetTypeHash(State->Name);
+    Hash = HashCombine(Hash, GetTypeHash(State->ID));
+    Hash = HashCombine(Hash, GetTypeHash(State->bEnabled));
+    Hash = HashCombine(Hash, GetTypeHash(static_cast<int32>(State->Type)));
+    Hash = HashCombine(Hash, GetTypeHash(static_cast<int32>(State->SelectionBehavior)));
+    Hash = HashCombine(Hash, GetTypeHash(State->Parent ? State->Parent->ID : FGuid()));
+
+    for (const FStateTreeEditorNode& Task : State->Tasks)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Task.ID));
+        Hash = HashCombine(Hash, GetTypeHash(Task.Node.GetScriptStruct()));
+    }
+    for (const FStateTreeTransition& Transition : State->Transitions)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<int32>(Transition.Trigger)));
+        Hash = HashCombine(Hash, GetTypeHash(Transition.bDelayTransition));
+        Hash = HashCombine(Hash, GetTypeHash(Transition.DelayDuration));
+        Hash = HashCombine(Hash, GetTypeHash(static_cast<int32>(Transition.Priority)));
+        Hash = HashCombine(Hash, GetTypeHash(Transition.Conditions.Num()));
+    }
+    Hash = HashCombine(Hash, GetTypeHash(State->EnterConditions.Num()));
+
+    for (const UStateTreeState* Child : State->Children)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Child ? Child->ID : FGuid()));
+    }
+    return Hash;
+}
+
+FStateTreeService::FTreeRevision& FStateTreeService::UpdateTreeRevision(UStateTree* StateTree, UStateTreeEditorData* EditorData)
+{
+    FTreeRevision* Tree = TreeRevisions.Find(StateTree);
+    if (!Tree)
+    {
+        // Histories of StateTrees that were garbage collected are dropped before a new one is added
+        for (auto It = TreeRevisions.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Tree = &TreeRevisions.Add(StateTree);
+    }
+
+    // Every change one walk sees shares a single new revision, taken on the first change
+    int64 NewRevision = 0;
+    auto ChangedRevision = [this, &NewRevision]()
+    {
+        if (NewRevision == 0)
+        {
+            // Seeded from the wall clock in milliseconds, so a revision from an earlier session is
+            // older than any of this one and gets a full read
+            if (LastRevision == 0)
+            {
+                LastRevision = static_cast<int64>((FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds());
+            }
+            NewRevision = ++LastRevision;
+        }
+        return NewRevision;
+    };
+
+    uint32 GlobalsHash = GetTypeHash(EditorData->Schema ? EditorData->Schema->GetClass() : nullptr);
+    for (const FStateTreeEditorNode& Evaluator : EditorData->Evaluators)
+    {
+        GlobalsHash = HashCombine(GlobalsHash, GetTypeHash(Evaluator.ID));
+        GlobalsHash = HashCombine(GlobalsHash, GetTypeHash(Evaluator.Node.GetScriptStruct()));
+    }
+    if (Tree->Revision == 0 || GlobalsHash != Tree->GlobalsHash)
+    {
+        Tree->GlobalsHash = GlobalsHash;
+        Tree->GlobalsChangedAt = ChangedRevision();
+    }
+
+    Tree->StateCount = 0;
+    Tree->TaskCount = 0;
+    Tree->TransitionCount = 0;
+
+    TSet<FGuid> Seen;
+    Seen.Reserve(Tree->States.Num());
+    TArray<UStateTreeState*> Stack;
+    for (UStateTreeState* RootState : EditorData->SubTrees)
+    {
+        Stack.Add(RootState);
+    }
+    while (Stack.Num() > 0)
+    {
+        UStateTreeState* State = Stack.Pop(EAllowShrinking::No);
+        if (!State)
+        {
+            continue;
+        }
+
+        Tree->StateCount++;
+        Tree->TaskCount += State->Tasks.Num();
+        Tree->TransitionCount += State->Transitions.Num();
+        for (UStateTreeState* Child : State->Children)
+        {
+            Stack.Add(Child);
+        }
+
+        Seen.Add(State->ID);
+        const uint32 Hash = HashStateMetadata(State);
+        if (FStateRevision* Known = Tree->States.Find(State->ID))
+        {
+            if (Known->Hash != Hash)
+            {
+                Known->Hash = Hash;
+                Known->ChangedAt = ChangedRevision();
+            }
+        }
+        else
+        {
+            Tree->States.Add(State->ID, { Hash, ChangedRevision() });
+            Tree->RemovedAt.Remove(State->ID);
+        }
+    }
+
+    for (auto It = Tree->States.CreateIterator(); It; ++It)
+    {
+        if (!Seen.Contains(It.Key()))
+        {
+            Tree->RemovedAt.Add(It.Key(), ChangedRevision());
+            It.RemoveCurrent();
+        }
+    }
+
+    if (NewRevision != 0)
+    {
+        Tree->Revision = NewRevision;
+        if (Tree->FirstRevision == 0)
+        {
+            Tree->FirstRevision = NewRevision;
+        }
+    }
+    return *Tree;
+}
@@ -1,5 +1,9 @@
 #include "Services/StateTreeService.h"
 #include "Services/PropertyService.h"
+#include "Services/ReflectionTypeIndex.h"
+#include "Services/StateTreeNodeTypeCatalog.h"
+#include "Services/StateTreeTagIndex.h"
+#include "Services/StateTree/StateTreeBindingValidator.h"
 #include "StateTree.h"
 #include "StateTreeEditorData.h"
 #include "StateTreeState.h"
@@ -24,6 +28,7 @@
 #include "GameplayTagContainer.h"
 #include "Engine/Blueprint.h"
 #include "Modules/ModuleManager.h"
+#include "MCPSaveQueue.h"
 
 // Helper function to find UScriptStruct by path, handling both native (/Script/) and asset paths
 static UScriptStruct* FindScriptStructByPath(const FString& StructPath)
@@ -76,34 +81,18 @@ static UScriptStruct* FindScriptStructByPath(const FString& StructPath)
         }
 
         // Method 4: Try finding via StateTree's base struct hierarchy
-        UScriptStruct* StateTreeEvaluatorBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeEvaluatorBase"), EFindFirstObjectOptions::NativeFirst);
-        UScriptStruct* StateTreeTaskBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeTaskBase"), EFindFirstObjectOptions::NativeFirst);
-        UScriptStruct* StateTreeConditionBase = FindFirstObject<UScriptStruct>(TEXT("FStateTreeConditionBase"), EFindFirstObjectOptions::NativeFirst);
-
-        for (TObjectIterator<UScriptStruct> It; It; ++It)
+        for (const UScriptStruct* BaseStruct : { FStateTreeEvaluatorBase::StaticStruct(), FStateTreeTaskBase::StaticStruct(), FStateTreeConditionBase::StaticStruct() })
         {
-            UScriptStruct* TestStruct = *It;
-            if (TestStruct->GetName() == StructName)
+            for (UScriptStruct* TestStruct : FReflectionTypeIndex::Get().GetDerivedStructs(BaseStruct))
             {
-                // Check if this is a StateTree-related struct
-                if ((StateTreeEvaluatorBase && TestStruct->IsChildOf(StateTreeEvaluatorBase)) ||
-                    (StateTreeTaskBase && TestStruct->IsChildOf(StateTreeTaskBase)) ||
-                    (StateTreeConditionBase && TestStruct->IsChildOf(StateTreeConditionBase)))
+                if (TestStruct->GetName() == StructName)
                 {
                     return TestStruct;
                 }
             }
         }
 
-        // Method 5: Final fallback - iterate over all UScriptStructs to find a match by name
-        for (TObjectIterator<UScriptStruct> It; It; ++It)
-        {
-            if (It->GetName() == StructName)
-            {
-                return *It;
-            }
-        }
-
+        // Any other struct by that name was already ruled out by FindFirstObject above
         return nullptr;
     }
 
@@ -756,66 +745,8 @@ UStateTree* FStateTreeService::CreateStateTree(const FStateTreeCreationParams& P
     StateTree->EditorData = EditorData;
 
     // Find and set the schema class
-    UClass* SchemaClass = nullptr;
-    FString SchemaClassName = Params.SchemaClass;
-    FString TargetNameWithU = TEXT("U") + SchemaClassName;
-
-    // Try FindObject with exact name and U prefix
-    SchemaClass = FindObject<UClass>(nullptr, *SchemaClassName);
-    if (!SchemaClass)
-    {
-        SchemaClass = FindObject<UClass>(nullptr, *TargetNameWithU);
-    }
-
-    // Try LoadClass from common StateTree modules
-    if (!SchemaClass)
-    {
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/StateTreeModule.%s"), *SchemaClassName));
-    }
-    if (!SchemaClass)
-    {
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/StateTreeModule.U%s"), *SchemaClassName));
-    }
-    if (!SchemaClass)
-    {
-        // GameplayStateTreeModule is where AI and Component schemas live in UE5.7+
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/GameplayStateTreeModule.U%s"), *SchemaClassName));
-    }
-
-    // Try full script path format (e.g., "/Script/GameModule.UCustomStateTreeSchema")
-    if (!SchemaClass && SchemaClassName.StartsWith(TEXT("/Script/")))
-    {
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *SchemaClassName);
-    }
-
-    // Try game module (MCPGameProject) for project-specific schemas
-    if (!SchemaClass)
-    {
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/MCPGameProject.%s"), *SchemaClassName));
-    }
-    if (!SchemaClass)
-    {
-        SchemaClass = LoadClass<UStateTreeSchema>(nullptr, *FString::Printf(TEXT("/Script/MCPGameProject.U%s"), *SchemaClassName));
-    }
-
-    // Last resort: iterate through all loaded UStateTreeSchema subclasses and find by name
-    if (!SchemaClass)
-    {
-        for (TObjectIterator<UClass> It; It; ++It)
-        {
-            UClass* Class = *It;
-            if (Class && Class->IsChildOf(UStateTreeSchema::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract))
-            {
-                FString ClassName = Class->GetName();
-                if (ClassName.Equals(SchemaClassName, ESearchCase::IgnoreCase) ||
-                    ClassName.Equals(TargetNameWithU, ESearchCase::IgnoreCase))
-                {
-                    SchemaClass = Class;
-                    break;
-                }
-            }
-        }
-    }
+    const FString& SchemaClassName = Params.SchemaClass;
+    UClass* SchemaClass = FStateTreeNodeTypeCatalog::FindSchemaClass(SchemaClassName);
 
     if (SchemaClass && SchemaClass->IsChildOf(UStateTreeSchema::StaticClass()))
     {
@@ -889,83 +820,6 @@ UStateTree* FStateTreeService::FindStateTree(const FString& PathOrName)
     return nullptr;
 }
 
-bool FStateTreeService::CompileStateTree(UStateTree* StateTree, FString& OutError)
-{
-    if (!StateTree)
-    {
-        OutError = TEXT("StateTree is null");
-        return false;
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Compiling StateTree '%s'"), *StateTree->GetName());
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    // Check for basic validity first
-    if (EditorData->SubTrees.Num() == 0)
-    {
-        OutError = TEXT("StateTree has no subtrees defined");
-        UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::CompileStateTree: StateTree has no subtrees"));
-        return false;
-    }
-
-    // Mark dirty before compilation
-    StateTree->Modify();
-
-    // Use the actual UE5 StateTree compiler for proper validation
-    FStateTreeCompilerLog Log;
-    FStateTreeCompiler Compiler(Log);
-
-    bool bSuccess = Compiler.Compile(StateTree);
-
-    if (!bSuccess)
-    {
-        // Collect all error messages from the compiler log
-        TArray<TSharedRef<FTokenizedMessage>> Messages = Log.ToTokenizedMessages();
-
-        TArray<FString> ErrorMessages;
-        for (const TSharedRef<FTokenizedMessage>& Message : Messages)
-        {
-            if (Message->GetSeverity() == EMessageSeverity::Error || Message->GetSeverity() == EMessageSeverity::Warning)
-            {
-                ErrorMessages.Add(Message->ToText().ToString());
-            }
-        }
-
-        if (ErrorMessages.Num() > 0)
-        {
-            // Join all error messages with newlines
-            OutError = FString::Join(ErrorMessages, TEXT("\n"));
-        }
-        else
-        {
-            OutError = TEXT("Compilation failed with unknown error");
-        }
-
-        // Also log to output for debugging
-        Log.DumpToLog(LogTemp);
-
-        UE_LOG(LogTemp, Error, TEXT("FStateTreeService::CompileStateTree: Compilation failed for '%s': %s"),
-            *StateTree->GetName(), *OutError);
-        return false;
-    }
-
-    // Save after successful compilation
-    FString SaveError;
-    if (!SaveAsset(StateTree, SaveError))
-    {
-        UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::CompileStateTree: Failed to save after compilation: %s"), *SaveError);
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::CompileStateTree: Successfully compiled StateTree '%s'"), *StateTree->GetName());
-    return true;
-}
-
 UStateTree* FStateTreeService::DuplicateStateTree(const FString& SourcePath, const FString& DestPath, const FString& NewName, FString& OutError)
 {
     UStateTree* SourceTree = FindStateTree(SourcePath);
@@ -1027,33 +881,13 @@ bool FStateTreeService::AddState(const FAddStateParams& Params, FString& OutErro
     }
 
     // Create the new state
-    UStateTreeState* NewState = NewObject<UStateTreeState>(EditorData, FName(*Params.StateName), RF_Transactional);
+    UStateTreeState* NewState = CreateState(EditorData, ParentState, Params.StateName, Params.StateType, Params.SelectionBehavior, Params.bEnabled);
     if (!NewState)
     {
         OutError = TEXT("Failed to create state object");
         return false;
     }
 
-    NewState->Name = FName(*Params.StateName);
-    NewState->bEnabled = Params.bEnabled;
-
-    // Set state type
-    NewState->Type = static_cast<EStateTreeStateType>(ParseStateType(Params.StateType));
-
-    // Set selection behavior
-    NewState->SelectionBehavior = static_cast<EStateTreeStateSelectionBehavior>(ParseSelectionBehavior(Params.SelectionBehavior));
-
-    // Add to parent or root
-    if (ParentState)
-    {
-        ParentState->Children.Add(NewState);
-        NewState->Parent = ParentState;
-    }
-    else
-    {
-        EditorData->SubTrees.Add(NewState);
-    }
-
     // Mark dirty and save
     StateTree->Modify();
     SaveAsset(StateTree, OutError);
@@ -1094,6 +928,7 @@ bool FStateTreeService::RemoveState(const FRemoveStateParams& Params, FString& O
     {
         EditorData->SubTrees.Remove(State);
     }
+    InvalidateStateIndex(EditorData);
 
     StateTree->Modify();
     SaveAsset(StateTree, OutError);
@@ -1133,6 +968,7 @@ bool FStateTreeService::SetStateParameters(const FSetStateParametersParams& Para
         if (Params.Parameters->TryGetStringField(TEXT("name"), NewName))
         {
             State->Name = FName(*NewName);
+            InvalidateStateIndex(EditorData);
         }
 
         bool bEnabled;
@@ -1186,45 +1022,20 @@ bool FStateTreeService::AddTransition(const FAddTransitionParams& Params, FStrin
     UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Adding transition from '%s' in '%s'"),
         *Params.SourceStateName, *StateTree->GetName());
 
-    // Create the transition
-    FStateTreeTransition NewTransition;
-
-    // Set trigger type
-    NewTransition.Trigger = static_cast<EStateTreeTransitionTrigger>(ParseTransitionTrigger(Params.Trigger));
-
-    // Set target state if TargetStateName is provided
-    // The target state should be set regardless of TransitionType - if a target is specified, link to it
+    UStateTreeState* TargetState = nullptr;
     if (!Params.TargetStateName.IsEmpty())
     {
-        UStateTreeState* TargetState = FindStateByName(EditorData, Params.TargetStateName);
+        TargetState = FindStateByName(EditorData, Params.TargetStateName);
         if (!TargetState)
         {
             OutError = FString::Printf(TEXT("Target state not found: '%s'"), *Params.TargetStateName);
             return false;
         }
-        // FStateTreeStateLink holds the target state ID, LinkType, and Name
-        // LinkType MUST be set to GotoState for the transition to properly link to the target
-        NewTransition.State.ID = TargetState->ID;
-        NewTransition.State.LinkType = EStateTreeTransitionType::GotoState;
-        NewTransition.State.Name = FName(*Params.TargetStateName);
-
-        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Set target state '%s' (ID: %s, LinkType: GotoState)"),
-            *Params.TargetStateName, *TargetState->ID.ToString());
     }
 
-    // Set required event tag if OnEvent trigger
-    if (Params.Trigger == TEXT("OnEvent") && !Params.EventTag.IsEmpty())
-    {
-        // Event-based transitions use RequiredEvent in UE5.7
-        NewTransition.RequiredEvent.Tag = FGameplayTag::RequestGameplayTag(FName(*Params.EventTag), false);
-    }
-
-    // Set delay if specified
-    NewTransition.bDelayTransition = Params.bDelayTransition;
-    NewTransition.DelayDuration = Params.DelayDuration;
-
-    // Set priority
-    NewTransition.Priority = static_cast<EStateTreeTransitionPriority>(ParsePriority(Params.Priority));
+    // Create the transition
+    FStateTreeTransition NewTransition;
+    InitTransition(Params, TargetState, NewTransition);
 
     // Add the transition to the source state
     SourceState->Transitions.Add(NewTransition);
@@ -1609,62 +1420,6 @@ bool FStateTreeService::AddEvaluator(const FAddEvaluatorParams& Params, FString&
     return true;
 }
 
-bool FStateTreeService::GetStateTreeMetadata(UStateTree* StateTree, TSharedPtr<FJsonObject>& OutMetadata)
-{
-    if (!StateTree)
-    {
-        return false;
-    }
-
-    OutMetadata = MakeShared<FJsonObject>();
-    OutMetadata->SetStringField(TEXT("name"), StateTree->GetName());
-    OutMetadata->SetStringField(TEXT("path"), StateTree->GetPathName());
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (EditorData)
-    {
-        // Add schema info
-        if (EditorData->Schema)
-        {
-            OutMetadata->SetStringField(TEXT("schema"), EditorData->Schema->GetName());
-        }
-
-        // Add evaluators
-        TArray<TSharedPtr<FJsonValue>> EvaluatorArray;
-        for (const FStateTreeEditorNode& Evaluator : EditorData->Evaluators)
-        {
-            TSharedPtr<FJsonObject> EvalObj = MakeShared<FJsonObject>();
-            EvalObj->SetStringField(TEXT("id"), Evaluator.ID.ToString());
-            // Use struct name as the evaluator name in UE5.7 (InstanceName not available)
-            if (Evaluator.Node.GetScriptStruct())
-            {
-                EvalObj->SetStringField(TEXT("name"), Evaluator.Node.GetScriptStruct()->GetName());
-                EvalObj->SetStringField(TEXT("type"), Evaluator.Node.GetScriptStruct()->GetName());
-            }
-            else
-            {
-                EvalObj->SetStringField(TEXT("name"), TEXT("Unknown"));
-            }
-            EvaluatorArray.Add(MakeShared<FJsonValueObject>(EvalObj));
-        }
-        OutMetadata->SetArrayField(TEXT("evaluators"), EvaluatorArray);
-
-        // Add states (tree structure)
-        TArray<TSharedPtr<FJsonValue>> StatesArray;
-        for (UStateTreeState* RootState : EditorData->SubTrees)
-        {
-            if (RootState)
-            {
-                TSharedPtr<FJsonObject> StateObj = BuildStateMetadata(RootState);
-                StatesArray.Add(MakeShared<FJsonValueObject>(StateObj));
-            }
-        }
-        OutMetadata->SetArrayField(TEXT("states"), StatesArray);
-    }
-
-    return true;
-}
-
 bool FStateTreeService::GetStateTreeDiagnostics(UStateTree* StateTree, TSharedPtr<FJsonObject>& OutDiagnostics)
 {
     if (!StateTree)
@@ -1699,87 +1454,20 @@ bool FStateTreeService::GetStateTreeDiagnostics(UStateTree* StateTree, TSharedPt
     OutDiagnostics->SetBoolField(TEXT("is_valid"), bIsValid);
     OutDiagnostics->SetArrayField(TEXT("messages"), DiagnosticsArray);
 
-    // Get some basic stats (EditorData was already fetched above)
+    // The counts come from the walk that keeps the revision current, so they match the metadata's revision
     if (EditorData)
     {
-        int32 StateCount = 0;
-        int32 TaskCount = 0;
-        int32 TransitionCount = 0;
-
-        TFunction<void(UStateTreeState*)> CountRecursive = [&](UStateTreeState* State)
-        {
-            if (!State) return;
-            StateCount++;
-            TaskCount += State->Tasks.Num();
-            TransitionCount += State->Transitions.Num();
-            for (UStateTreeState* Child : State->Children)
-            {
-                CountRecursive(Child);
-            }
-        };
-
-        for (UStateTreeState* RootState : EditorData->SubTrees)
-        {
-            CountRecursive(RootState);
-        }
-
-        OutDiagnostics->SetNumberField(TEXT("state_count"), StateCount);
-        OutDiagnostics->SetNumberField(TEXT("task_count"), TaskCount);
-        OutDiagnostics->SetNumberField(TEXT("transition_count"), TransitionCount);
+        const FTreeRevision& Revision = UpdateTreeRevision(StateTree, EditorData);
+        OutDiagnostics->SetNumberField(TEXT("revision"), static_cast<double>(Revision.Revision));
+        OutDiagnostics->SetNumberField(TEXT("state_count"), Revision.StateCount);
+        OutDiagnostics->SetNumberField(TEXT("task_count"), Revision.TaskCount);
+        OutDiagnostics->SetNumberField(TEXT("transition_count"), Revision.TransitionCount);
         OutDiagnostics->SetNumberField(TEXT("evaluator_count"), EditorData->Evaluators.Num());
     }
 
     return true;
 }
 
-bool FStateTreeService::GetAvailableTaskTypes(TArray<TPair<FString, FString>>& OutTasks)
-{
-    // Find all task structs derived from FStateTreeTaskBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeTaskBase::StaticStruct()) && Struct != FStateTreeTaskBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutTasks.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
-    return true;
-}
-
-bool FStateTreeService::GetAvailableConditionTypes(TArray<TPair<FString, FString>>& OutConditions)
-{
-    // Find all condition structs derived from FStateTreeConditionBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeConditionBase::StaticStruct()) && Struct != FStateTreeConditionBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutConditions.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
-    return true;
-}
-
-bool FStateTreeService::GetAvailableEvaluatorTypes(TArray<TPair<FString, FString>>& OutEvaluators)
-{
-    // Find all evaluator structs derived from FStateTreeEvaluatorBase
-    for (TObjectIterator<UScriptStruct> It; It; ++It)
-    {
-        UScriptStruct* Struct = *It;
-        if (Struct && Struct->IsChildOf(FStateTreeEvaluatorBase::StaticStruct()) && Struct != FStateTreeEvaluatorBase::StaticStruct())
-        {
-            FString StructPath = Struct->GetPathName();
-            FString StructName = Struct->GetName();
-            OutEvaluators.Add(TPair<FString, FString>(StructPath, StructName));
-        }
-    }
-    return true;
-}
-
 // ============================================================================
 // Section 1: Property Binding Implementation
 // ============================================================================
@@ -2332,49 +2020,28 @@ bool FStateTreeService::GetBlueprintStateTreeTypes(TSharedPtr<FJsonObject>& OutT
 {
     OutTypes = MakeShared<FJsonObject>();
 
-    TArray<TSharedPtr<FJsonValue>> TasksArray;
-    TArray<TSharedPtr<FJsonValue>> ConditionsArray;
-    TArray<TSharedPtr<FJsonValue>> EvaluatorsArray;
-
-    // Search for Blueprint-based StateTree types
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    TArray<FAssetData> BlueprintAssets;
-    AssetRegistry.GetAssetsByClass(UBlueprint::StaticClass()->GetClassPathName(), BlueprintAssets);
-
-    for (const FAssetData& Asset : BlueprintAssets)
+    // Classified by native parent class through the type catalog, without loading the Blueprints
+    auto AddTypes = [this, &OutTypes](EStateTreeNodeKind Kind, const TCHAR* FieldName)
     {
-        UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
-        if (Blueprint && Blueprint->GeneratedClass)
-        {
-            UClass* GeneratedClass = Blueprint->GeneratedClass;
+        TArray<TPair<FString, FString>> Types;
+        int32 TotalCount = 0;
+        FString Error;
+        QueryNodeTypes(Kind, true, FStateTreeNodeTypeQuery(), Types, TotalCount, Error);
 
-            // Check if it's a task, condition, or evaluator Blueprint
-            // Note: Blueprint-based StateTree nodes typically inherit from specific base classes
+        TArray<TSharedPtr<FJsonValue>> TypesArray;
+        for (const TPair<FString, FString>& Type : Types)
+        {
             TSharedPtr<FJsonObject> TypeObj = MakeShared<FJsonObject>();
-            TypeObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
-            TypeObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
-
-            // Check parent classes to categorize
-            if (GeneratedClass->GetName().Contains(TEXT("Task")))
-            {
-                TasksArray.Add(MakeShared<FJsonValueObject>(TypeObj));
-            }
-            else if (GeneratedClass->GetName().Contains(TEXT("Condition")))
-            {
-                ConditionsArray.Add(MakeShared<FJsonValueObject>(TypeObj));
-            }
-            else if (GeneratedClass->GetName().Contains(TEXT("Evaluator")))
-            {
-                EvaluatorsArray.Add(MakeShared<FJsonValueObject>(TypeObj));
-            }
+            TypeObj->SetStringField(TEXT("path"), Type.Key);
+            TypeObj->SetStringField(TEXT("name"), Type.Value);
+            TypesArray.Add(MakeShared<FJsonValueObject>(TypeObj));
         }
-    }
+        OutTypes->SetArrayField(FieldName, TypesArray);
+    };
 
-    OutTypes->SetArrayField(TEXT("blueprint_tasks"), TasksArray);
-    OutTypes->SetArrayField(TEXT("blueprint_conditions"), ConditionsArray);
-    OutTypes->SetArrayField(TEXT("blueprint_evaluators"), EvaluatorsArray);
+    AddTypes(EStateTreeNodeKind::Task, TEXT("blueprint_tasks"));
+    AddTypes(EStateTreeNodeKind::Condition, TEXT("blueprint_conditions"));
+    AddTypes(EStateTreeNodeKind::Evaluator, TEXT("blueprint_evaluators"));
 
     return true;
 }
@@ -2581,6 +2248,7 @@ bool FStateTreeService::SetLinkedStateAsset(const FSetLinkedStateAssetParams& Pa
     }
 
     State->LinkedAsset = LinkedTree;
+    FStateTreeTagIndex::Get().Invalidate(StateTree);
 
     StateTree->Modify();
     SaveAsset(StateTree, OutError);
@@ -2709,7 +2377,10 @@ bool FStateTreeService::AddGameplayTagToState(const FAddGameplayTagToStateParams
     }
 
     // Add tag to state's tag container
+    const FGameplayTag OldTag = State->Tag;
+    State->Modify();
     State->Tag = Tag;
+    FStateTreeTagIndex::Get().HandleTagChanged(State, OldTag);
 
     StateTree->Modify();
     SaveAsset(StateTree, OutError);
@@ -2719,7 +2390,7 @@ bool FStateTreeService::AddGameplayTagToState(const FAddGameplayTagToStateParams
     return true;
 }
 
-bool FStateTreeService::QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates)
+bool FStateTreeService::QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates, TArray<FLinkedStateTagMatch>& OutLinkedStates)
 {
     UStateTree* StateTree = FindStateTree(Params.StateTreePath);
     if (!StateTree)
@@ -2739,67 +2410,28 @@ bool FStateTreeService::QueryStatesByTag(const FQueryStatesByTagParams& Params,
         return false;
     }
 
-    TFunction<void(UStateTreeState*)> SearchStates = [&](UStateTreeState* State)
-    {
-        if (!State) return;
+    // The tag index answers from the tree's distinct tags instead of walking every state
+    TArray<FStateTreeTagIndex::FMatch> Matches;
+    FStateTreeTagIndex::Get().FindStates(StateTree, SearchTag, Params.bExactMatch, Params.bIncludeLinked, Matches);
 
-        bool bMatches = false;
-        if (Params.bExactMatch)
+    for (const FStateTreeTagIndex::FMatch& Match : Matches)
+    {
+        if (Match.LinkDepth == 0)
         {
-            bMatches = (State->Tag == SearchTag);
+            OutStates.Add(Match.State->Name.ToString());
         }
         else
         {
-            bMatches = State->Tag.MatchesTag(SearchTag);
-        }
-
-        if (bMatches)
-        {
-            OutStates.Add(State->Name.ToString());
+            FLinkedStateTagMatch& LinkedMatch = OutLinkedStates.AddDefaulted_GetRef();
+            LinkedMatch.StateTreePath = Match.StateTree->GetPathName();
+            LinkedMatch.StateName = Match.State->Name.ToString();
+            LinkedMatch.StateId = Match.State->ID.ToString();
         }
-
-        for (UStateTreeState* Child : State->Children)
-        {
-            SearchStates(Child);
-        }
-    };
-
-    for (UStateTreeState* RootState : EditorData->SubTrees)
-    {
-        SearchStates(RootState);
     }
 
     return true;
 }
 
-// ============================================================================
-// Section 8: Runtime Inspection Implementation
-// ============================================================================
-
-bool FStateTreeService::GetActiveStateTreeStatus(const FString& StateTreePath, const FString& ActorPath, TSharedPtr<FJsonObject>& OutStatus)
-{
-    OutStatus = MakeShared<FJsonObject>();
-    OutStatus->SetStringField(TEXT("state_tree_path"), StateTreePath);
-    OutStatus->SetStringField(TEXT("actor_path"), ActorPath);
-
-    // Runtime inspection requires PIE and access to world actors
-    // This is a placeholder that would need game-time implementation
-    OutStatus->SetBoolField(TEXT("is_running"), false);
-    OutStatus->SetStringField(TEXT("note"), TEXT("Runtime inspection requires PIE context"));
-
-    return true;
-}
-
-bool FStateTreeService::GetCurrentActiveStates(const FString& StateTreePath, const FString& ActorPath, TArray<FString>& OutActiveStates)
-{
-    // Runtime state inspection requires PIE context
-    // This would iterate over StateTreeComponent instances in the world
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::GetCurrentActiveStates: Runtime inspection for '%s' on actor '%s'"),
-        *StateTreePath, *ActorPath);
-
-    return true;
-}
-
 // ============================================================================
 // Section 9: Utility AI Considerations Implementation
 // ============================================================================
@@ -2877,167 +2509,6 @@ bool FStateTreeService::AddConsideration(const FAddConsiderationParams& Params,
     return true;
 }
 
-// ============================================================================
-// Section 10: Task/Evaluator Modification Implementation
-// ============================================================================
-
-bool FStateTreeService::RemoveTaskFromState(const FRemoveTaskFromStateParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    UStateTreeState* State = FindStateByName(EditorData, Params.StateName);
-    if (!State)
-    {
-        OutError = FString::Printf(TEXT("State not found: '%s'"), *Params.StateName);
-        return false;
-    }
-
-    if (Params.TaskIndex < 0 || Params.TaskIndex >= State->Tasks.Num())
-    {
-        OutError = FString::Printf(TEXT("Invalid task index: %d (total: %d)"), Params.TaskIndex, State->Tasks.Num());
-        return false;
-    }
-
-    State->Tasks.RemoveAt(Params.TaskIndex);
-
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::RemoveTaskFromState: Removed task %d from state '%s'"),
-        Params.TaskIndex, *Params.StateName);
-    return true;
-}
-
-bool FStateTreeService::SetTaskProperties(const FSetTaskPropertiesParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    UStateTreeState* State = FindStateByName(EditorData, Params.StateName);
-    if (!State)
-    {
-        OutError = FString::Printf(TEXT("State not found: '%s'"), *Params.StateName);
-        return false;
-    }
-
-    if (Params.TaskIndex < 0 || Params.TaskIndex >= State->Tasks.Num())
-    {
-        OutError = FString::Printf(TEXT("Invalid task index: %d (total: %d)"), Params.TaskIndex, State->Tasks.Num());
-        return false;
-    }
-
-    FStateTreeEditorNode& TaskNode = State->Tasks[Params.TaskIndex];
-
-    // Apply properties from JSON
-    if (Params.Properties.IsValid())
-    {
-        // Note: InstanceName is not available in UE5.7 FStateTreeEditorNode
-        // Name changes would need to be done via the underlying struct properties
-
-        // Additional property setting would require reflection on the task struct
-        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::SetTaskProperties: Updated task %d in state '%s'"),
-            Params.TaskIndex, *Params.StateName);
-    }
-
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    return true;
-}
-
-bool FStateTreeService::RemoveEvaluator(const FRemoveEvaluatorParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    if (Params.EvaluatorIndex < 0 || Params.EvaluatorIndex >= EditorData->Evaluators.Num())
-    {
-        OutError = FString::Printf(TEXT("Invalid evaluator index: %d (total: %d)"), Params.EvaluatorIndex, EditorData->Evaluators.Num());
-        return false;
-    }
-
-    EditorData->Evaluators.RemoveAt(Params.EvaluatorIndex);
-
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::RemoveEvaluator: Removed evaluator %d"), Params.EvaluatorIndex);
-    return true;
-}
-
-bool FStateTreeService::SetEvaluatorProperties(const FSetEvaluatorPropertiesParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    if (Params.EvaluatorIndex < 0 || Params.EvaluatorIndex >= EditorData->Evaluators.Num())
-    {
-        OutError = FString::Printf(TEXT("Invalid evaluator index: %d (total: %d)"), Params.EvaluatorIndex, EditorData->Evaluators.Num());
-        return false;
-    }
-
-    FStateTreeEditorNode& EvaluatorNode = EditorData->Evaluators[Params.EvaluatorIndex];
-
-    // Apply properties from JSON
-    if (Params.Properties.IsValid())
-    {
-        // Note: InstanceName is not available in UE5.7 FStateTreeEditorNode
-        // Name changes would need to be done via the underlying struct properties
-        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::SetEvaluatorProperties: Properties provided (name changes require struct reflection)"));
-    }
-
-    StateTree->Modify();
-    SaveAsset(StateTree, OutError);
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::SetEvaluatorProperties: Updated evaluator %d"), Params.EvaluatorIndex);
-    return true;
-}
-
 // ============================================================================
 // Section 11: Condition Removal Implementation
 // ============================================================================
@@ -3533,110 +3004,6 @@ bool FStateTreeService::SetStateSelectionWeight(const FSetStateSelectionWeightPa
     return true;
 }
 
-// ============================================================================
-// Section 15: Batch Operations Implementation
-// ============================================================================
-
-bool FStateTreeService::BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    int32 AddedCount = 0;
-    for (const FBatchStateDefinition& StateDef : Params.States)
-    {
-        FAddStateParams AddParams;
-        AddParams.StateTreePath = Params.StateTreePath;
-        AddParams.StateName = StateDef.StateName;
-        AddParams.ParentStateName = StateDef.ParentStateName;
-        AddParams.StateType = StateDef.StateType;
-        AddParams.SelectionBehavior = StateDef.SelectionBehavior;
-        AddParams.bEnabled = StateDef.bEnabled;
-
-        FString LocalError;
-        if (AddState(AddParams, LocalError))
-        {
-            AddedCount++;
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddStates: Failed to add state '%s': %s"),
-                *StateDef.StateName, *LocalError);
-        }
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddStates: Added %d/%d states"), AddedCount, Params.States.Num());
-
-    if (AddedCount == 0)
-    {
-        OutError = TEXT("Failed to add any states");
-        return false;
-    }
-
-    return true;
-}
-
-bool FStateTreeService::BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError)
-{
-    UStateTree* StateTree = FindStateTree(Params.StateTreePath);
-    if (!StateTree)
-    {
-        OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
-        return false;
-    }
-
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
-    {
-        OutError = TEXT("StateTree has no editor data");
-        return false;
-    }
-
-    int32 AddedCount = 0;
-    for (const FBatchTransitionDefinition& TransDef : Params.Transitions)
-    {
-        FAddTransitionParams AddParams;
-        AddParams.StateTreePath = Params.StateTreePath;
-        AddParams.SourceStateName = TransDef.SourceStateName;
-        AddParams.TargetStateName = TransDef.TargetStateName;
-        AddParams.Trigger = TransDef.Trigger;
-        AddParams.TransitionType = TransDef.TransitionType;
-        AddParams.Priority = TransDef.Priority;
-
-        FString LocalError;
-        if (AddTransition(AddParams, LocalError))
-        {
-            AddedCount++;
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("FStateTreeService::BatchAddTransitions: Failed to add transition from '%s' to '%s': %s"),
-                *TransDef.SourceStateName, *TransDef.TargetStateName, *LocalError);
-        }
-    }
-
-    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BatchAddTransitions: Added %d/%d transitions"), AddedCount, Params.Transitions.Num());
-
-    if (AddedCount == 0)
-    {
-        OutError = TEXT("Failed to add any transitions");
-        return false;
-    }
-
-    return true;
-}
-
 // ============================================================================
 // Section 16: Validation and Debugging Implementation
 // ============================================================================
@@ -3649,96 +3016,94 @@ bool FStateTreeService::ValidateAllBindings(const FString& StateTreePath, TShare
         return false;
     }
 
-    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
-    if (!EditorData)
+    FStateTreeBindingValidator::FSnapshot Snapshot;
+    if (!FStateTreeBindingValidator::TakeSnapshot(StateTree, Snapshot))
     {
         return false;
     }
 
+    TArray<FStateTreeBindingValidator::FIssue> Issues;
+    FStateTreeBindingValidator::Validate(Snapshot, Issues);
+
     OutValidationResults = MakeShared<FJsonObject>();
     OutValidationResults->SetStringField(TEXT("state_tree"), StateTree->GetName());
+    OutValidationResults->SetBoolField(TEXT("has_valid_structure"), !Snapshot.bNoRootState);
+    OutValidationResults->SetNumberField(TEXT("binding_count"), Snapshot.Bindings.Num());
 
-    // Check if StateTree has valid editor data and can be compiled
-    bool bIsValid = EditorData != nullptr && EditorData->SubTrees.Num() > 0;
-
-    OutValidationResults->SetBoolField(TEXT("has_valid_structure"), bIsValid);
-
-    TArray<TSharedPtr<FJsonValue>> IssuesArray;
-
-    // Basic validation checks
-    if (EditorData->SubTrees.Num() == 0)
-    {
-        TSharedPtr<FJsonObject> Issue = MakeShared<FJsonObject>();
-        Issue->SetStringField(TEXT("type"), TEXT("error"));
-        Issue->SetStringField(TEXT("message"), TEXT("StateTree has no root states"));
-        IssuesArray.Add(MakeShared<FJsonValueObject>(Issue));
-    }
-
+    const TArray<TSharedPtr<FJsonValue>> IssuesArray = FStateTreeBindingValidator::IssuesToJson(Issues);
     OutValidationResults->SetArrayField(TEXT("issues"), IssuesArray);
     OutValidationResults->SetNumberField(TEXT("issue_count"), IssuesArray.Num());
 
     return true;
 }
 
-bool FStateTreeService::GetStateExecutionHistory(const FString& StateTreePath, const FString& ActorPath, int32 MaxEntries, TSharedPtr<FJsonObject>& OutHistory)
-{
-    OutHistory = MakeShared<FJsonObject>();
-    OutHistory->SetStringField(TEXT("state_tree_path"), StateTreePath);
-    OutHistory->SetStringField(TEXT("actor_path"), ActorPath);
-    OutHistory->SetNumberField(TEXT("max_entries"), MaxEntries);
-
-    // Execution history would require runtime inspection during PIE
-    // This would need access to StateTreeComponent execution context
-    TArray<TSharedPtr<FJsonValue>> HistoryArray;
-    OutHistory->SetArrayField(TEXT("history"), HistoryArray);
-    OutHistory->SetStringField(TEXT("note"), TEXT("Execution history requires PIE context with active StateTreeComponent"));
-
-    return true;
-}
-
 // Private helper methods
 
-UStateTreeState* FStateTreeService::FindStateByName(UStateTreeEditorData* EditorData, const FString& StateName)
+UStateTreeState* FStateTreeService::CreateState(UStateTreeEditorData* EditorData, UStateTreeState* ParentState, const FString& StateName,
+                                                const FString& StateType, const FString& SelectionBehavior, bool bEnabled)
 {
-    if (!EditorData)
+    UStateTreeState* NewState = NewObject<UStateTreeState>(EditorData, FName(*StateName), RF_Transactional);
+    if (!NewState)
     {
         return nullptr;
     }
 
-    for (UStateTreeState* RootState : EditorData->SubTrees)
+    NewState->Name = FName(*StateName);
+    NewState->bEnabled = bEnabled;
+
+    // Set state type
+    NewState->Type = static_cast<EStateTreeStateType>(ParseStateType(StateType));
+
+    // Set selection behavior
+    NewState->SelectionBehavior = static_cast<EStateTreeStateSelectionBehavior>(ParseSelectionBehavior(SelectionBehavior));
+
+    // Add to parent or root
+    if (ParentState)
     {
-        UStateTreeState* Found = FindStateByNameRecursive(RootState, StateName);
-        if (Found)
-        {
-            return Found;
-        }
+        ParentState->Children.Add(NewState);
+        NewState->Parent = ParentState;
+    }
+    else
+    {
+        EditorData->SubTrees.Add(NewState);
     }
+    InvalidateStateIndex(EditorData);
 
-    return nullptr;
+    return NewState;
 }
 
-UStateTreeState* FStateTreeService::FindStateByNameRecursive(UStateTreeState* State, const FString& StateName)
+void FStateTreeService::InitTransition(const FAddTransitionParams& Params, const UStateTreeState* TargetState, FStateTreeTransition& OutTransition)
 {
-    if (!State)
-    {
-        return nullptr;
-    }
+    // Set trigger type
+    OutTransition.Trigger = static_cast<EStateTreeTransitionTrigger>(ParseTransitionTrigger(Params.Trigger));
 
-    if (State->Name.ToString() == StateName)
+    // Set target state if one was given
+    // The target state should be set regardless of TransitionType - if a target is specified, link to it
+    if (TargetState)
     {
-        return State;
+        // FStateTreeStateLink holds the target state ID, LinkType, and Name
+        // LinkType MUST be set to GotoState for the transition to properly link to the target
+        OutTransition.State.ID = TargetState->ID;
+        OutTransition.State.LinkType = EStateTreeTransitionType::GotoState;
+        OutTransition.State.Name = FName(*Params.TargetStateName);
+
+        UE_LOG(LogTemp, Log, TEXT("FStateTreeService::AddTransition: Set target state '%s' (ID: %s, LinkType: GotoState)"),
+            *Params.TargetStateName, *TargetState->ID.ToString());
     }
 
-    for (UStateTreeState* Child : State->Children)
+    // Set required event tag if OnEvent trigger
+    if (Params.Trigger == TEXT("OnEvent") && !Params.EventTag.IsEmpty())
     {
-        UStateTreeState* Found = FindStateByNameRecursive(Child, StateName);
-        if (Found)
-        {
-            return Found;
-        }
+        // Event-based transitions use RequiredEvent in UE5.7
+        OutTransition.RequiredEvent.Tag = FGameplayTag::RequestGameplayTag(FName(*Params.EventTag), false);
     }
 
-    return nullptr;
+    // Set delay if specified
+    OutTransition.bDelayTransition = Params.bDelayTransition;
+    OutTransition.DelayDuration = Params.DelayDuration;
+
+    // Set priority
+    OutTransition.Priority = static_cast<EStateTreeTransitionPriority>(ParsePriority(Params.Priority));
 }
 
 TArray<UStateTreeState*> FStateTreeService::GetRootStates(UStateTreeEditorData* EditorData)
@@ -3757,67 +3122,6 @@ TArray<UStateTreeState*> FStateTreeService::GetRootStates(UStateTreeEditorData*
     return RootStates;
 }
 
-TSharedPtr<FJsonObject> FStateTreeService::BuildStateMetadata(UStateTreeState* State)
-{
-    TSharedPtr<FJsonObject> StateObj = MakeShared<FJsonObject>();
-
-    if (!State)
-    {
-        return StateObj;
-    }
-
-    StateObj->SetStringField(TEXT("name"), State->Name.ToString());
-    StateObj->SetStringField(TEXT("id"), State->ID.ToString());
-    StateObj->SetBoolField(TEXT("enabled"), State->bEnabled);
-    StateObj->SetNumberField(TEXT("type"), static_cast<int32>(State->Type));
-    StateObj->SetNumberField(TEXT("selection_behavior"), static_cast<int32>(State->SelectionBehavior));
-
-    // Add tasks
-    TArray<TSharedPtr<FJsonValue>> TasksArray;
-    for (const FStateTreeEditorNode& Task : State->Tasks)
-    {
-        TSharedPtr<FJsonObject> TaskObj = MakeShared<FJsonObject>();
-        TaskObj->SetStringField(TEXT("id"), Task.ID.ToString());
-        if (Task.Node.GetScriptStruct())
-        {
-            TaskObj->SetStringField(TEXT("type"), Task.Node.GetScriptStruct()->GetName());
-        }
-        TasksArray.Add(MakeShared<FJsonValueObject>(TaskObj));
-    }
-    StateObj->SetArrayField(TEXT("tasks"), TasksArray);
-
-    // Add transitions
-    TArray<TSharedPtr<FJsonValue>> TransitionsArray;
-    for (const FStateTreeTransition& Transition : State->Transitions)
-    {
-        TSharedPtr<FJsonObject> TransObj = MakeShared<FJsonObject>();
-        TransObj->SetNumberField(TEXT("trigger"), static_cast<int32>(Transition.Trigger));
-        TransObj->SetBoolField(TEXT("delay_transition"), Transition.bDelayTransition);
-        TransObj->SetNumberField(TEXT("delay_duration"), Transition.DelayDuration);
-        TransObj->SetNumberField(TEXT("priority"), static_cast<int32>(Transition.Priority));
-        TransObj->SetNumberField(TEXT("condition_count"), Transition.Conditions.Num());
-        TransitionsArray.Add(MakeShared<FJsonValueObject>(TransObj));
-    }
-    StateObj->SetArrayField(TEXT("transitions"), TransitionsArray);
-
-    // Add enter conditions count
-    StateObj->SetNumberField(TEXT("enter_condition_count"), State->EnterConditions.Num());
-
-    // Add children recursively
-    TArray<TSharedPtr<FJsonValue>> ChildrenArray;
-    for (UStateTreeState* Child : State->Children)
-    {
-        if (Child)
-        {
-            TSharedPtr<FJsonObject> ChildObj = BuildStateMetadata(Child);
-            ChildrenArray.Add(MakeShared<FJsonValueObject>(ChildObj));
-        }
-    }
-    StateObj->SetArrayField(TEXT("children"), ChildrenArray);
-
-    return StateObj;
-}
-
 int32 FStateTreeService::ParseStateType(const FString& StateTypeString)
 {
     if (StateTypeString == TEXT("State"))
@@ -3891,6 +3195,12 @@ bool FStateTreeService::SaveAsset(UObject* Asset, FString& OutError)
         return false;
     }
 
+    // Written together with the other saves of this batch (see FMCPSaveQueue)
+    if (FMCPSaveQueue::Get().Enqueue(Asset))
+    {
+        return true;
+    }
+
     FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
 
     FSavePackageArgs SaveArgs;
@@ -0,0 +1,290 @@
+// StateTreeSpecBuild.cpp - Declarative build of a StateTree from a spec
+// BuildStateTreeFromSpec
+
+#include "Services/StateTreeService.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "Dom/JsonObject.h"
+#include "MCPBatchEditScope.h"
+
+bool FBuildStateTreeFromSpecParams::IsValid(FString& OutError) const
+{
+    if (StateTreePath.IsEmpty() && !Creation.IsValid(OutError))
+    {
+        OutError = FString::Printf(TEXT("StateTreePath or a StateTree to create is required: %s"), *OutError);
+        return false;
+    }
+    for (const FStateTreeSpecState& SpecState : States)
+    {
+        if (SpecState.State.StateName.IsEmpty())
+        {
+            OutError = TEXT("Every state requires a name");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Appends one element result to the report of BuildStateTreeFromSpec
+static void AddSpecElementResult(TArray<TSharedPtr<FJsonValue>>& OutElements, int32& OutFailedCount, const TCHAR* Kind,
+                                 const FString& StateName, const FString& ElementName, bool bSucceeded, const FString& Error)
+{
+    TSharedPtr<FJsonObject> Element = MakeShared<FJsonObject>();
+    Element->SetStringField(TEXT("kind"), Kind);
+    if (!StateName.IsEmpty())
+    {
+        Element->SetStringField(TEXT("state"), StateName);
+    }
+    Element->SetStringField(TEXT("name"), ElementName);
+    Element->SetBoolField(TEXT("success"), bSucceeded);
+    if (!bSucceeded)
+    {
+        Element->SetStringField(TEXT("error"), Error.IsEmpty() ? TEXT("Unknown error") : Error);
+        OutFailedCount++;
+    }
+    OutElements.Add(MakeShared<FJsonValueObject>(Element));
+}
+
+bool FStateTreeService::BuildStateTreeFromSpec(const FBuildStateTreeFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError)
+{
+    // One undo step; the saves of every element below are queued and written once when the scope closes
+    FMCPBatchEditScope EditScope(FText::FromString(TEXT("MCP Build StateTree From Spec")));
+
+    UStateTree* StateTree = nullptr;
+    bool bCreated = false;
+    if (!Params.StateTreePath.IsEmpty())
+    {
+        StateTree = FindStateTree(Params.StateTreePath);
+        if (!StateTree)
+        {
+            OutError = FString::Printf(TEXT("StateTree not found: '%s'"), *Params.StateTreePath);
+            return false;
+        }
+    }
+    else
+    {
+        // Compiled once below, after the spec is built
+        FStateTreeCreationParams CreationParams = Params.Creation;
+        CreationParams.bCompileOnCreation = false;
+        StateTree = CreateStateTree(CreationParams, OutError);
+        if (!StateTree)
+        {
+            return false;
+        }
+        bCreated = true;
+    }
+
+    UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        OutError = TEXT("StateTree has no editor data");
+        return false;
+    }
+
+    const FString TreePath = StateTree->GetPathName();
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BuildStateTreeFromSpec: Building '%s' from %d state(s)"),
+        *TreePath, Params.States.Num());
+
+    TArray<TSharedPtr<FJsonValue>> Elements;
+    int32 FailedCount = 0;
+
+    StateTree->Modify();
+    EditorData->Modify();
+
+    // States first, so transitions and bindings can refer to states defined later in the spec
+    TMap<FString, UStateTreeState*> StatesByName;
+    CollectStatesByName(EditorData, StatesByName);
+    TSet<UStateTreeState*> ModifiedStates;
+
+    for (const FStateTreeSpecState& SpecState : Params.States)
+    {
+        const FAddStateParams& StateParams = SpecState.State;
+
+        UStateTreeState* ParentState = nullptr;
+        if (!StateParams.ParentStateName.IsEmpty())
+        {
+            UStateTreeState** FoundParent = StatesByName.Find(StateParams.ParentStateName);
+            if (!FoundParent)
+            {
+                AddSpecElementResult(Elements, FailedCount, TEXT("state"), FString(), StateParams.StateName, false,
+                    FString::Printf(TEXT("Parent state not found: '%s'"), *StateParams.ParentStateName));
+                continue;
+            }
+            ParentState = *FoundParent;
+
+            if (!ModifiedStates.Contains(ParentState))
+            {
+                ParentState->Modify();
+                ModifiedStates.Add(ParentState);
+            }
+        }
+
+        UStateTreeState* NewState = CreateState(EditorData, ParentState, StateParams.StateName, StateParams.StateType,
+            StateParams.SelectionBehavior, StateParams.bEnabled);
+        if (!NewState)
+        {
+            AddSpecElementResult(Elements, FailedCount, TEXT("state"), FString(), StateParams.StateName, false, TEXT("Failed to create state object"));
+            continue;
+        }
+
+        ModifiedStates.Add(NewState);
+        if (!StatesByName.Contains(StateParams.StateName))
+        {
+            StatesByName.Add(StateParams.StateName, NewState);
+        }
+        AddSpecElementResult(Elements, FailedCount, TEXT("state"), FString(), StateParams.StateName, true, FString());
+    }
+
+    // Then what each state holds
+    for (const FStateTreeSpecState& SpecState : Params.States)
+    {
+        const FString& StateName = SpecState.State.StateName;
+
+        for (const FAddTaskParams& TaskSpec : SpecState.Tasks)
+        {
+            FAddTaskParams TaskParams = TaskSpec;
+            TaskParams.StateTreePath = TreePath;
+            TaskParams.StateName = StateName;
+
+            FString Error;
+            const bool bAdded = AddTaskToState(TaskParams, Error);
+            AddSpecElementResult(Elements, FailedCount, TEXT("task"), StateName,
+                TaskParams.TaskName.IsEmpty() ? TaskParams.TaskStructPath : TaskParams.TaskName, bAdded, Error);
+        }
+
+        for (const FAddEnterConditionParams& ConditionSpec : SpecState.EnterConditions)
+        {
+            FAddEnterConditionParams ConditionParams = ConditionSpec;
+            ConditionParams.StateTreePath = TreePath;
+            ConditionParams.StateName = StateName;
+
+            FString Error;
+            const bool bAdded = AddEnterCondition(ConditionParams, Error);
+            AddSpecElementResult(Elements, FailedCount, TEXT("enter_condition"), StateName, ConditionParams.ConditionStructPath, bAdded, Error);
+        }
+
+        for (const FStateTreeSpecTransition& TransitionSpec : SpecState.Transitions)
+        {
+            FAddTransitionParams TransitionParams = TransitionSpec.Transition;
+            TransitionParams.StateTreePath = TreePath;
+            TransitionParams.SourceStateName = StateName;
+
+            const FString TransitionName = TransitionParams.TargetStateName.IsEmpty()
+                ? TransitionParams.Trigger
+                : FString::Printf(TEXT("%s -> %s"), *TransitionParams.Trigger, *TransitionParams.TargetStateName);
+
+            UStateTreeState** SourceState = StatesByName.Find(StateName);
+            if (!SourceState)
+            {
+                AddSpecElementResult(Elements, FailedCount, TEXT("transition"), StateName, TransitionName, false,
+                    FString::Printf(TEXT("Source state not found: '%s'"), *StateName));
+                continue;
+            }
+
+            UStateTreeState* TargetState = nullptr;
+            if (!TransitionParams.TargetStateName.IsEmpty())
+            {
+                UStateTreeState** FoundTarget = StatesByName.Find(TransitionParams.TargetStateName);
+                if (!FoundTarget)
+                {
+                    AddSpecElementResult(Elements, FailedCount, TEXT("transition"), StateName, TransitionName, false,
+                        FString::Printf(TEXT("Target state not found: '%s'"), *TransitionParams.TargetStateName));
+                    continue;
+                }
+                TargetState = *FoundTarget;
+            }
+
+            FStateTreeTransition NewTransition;
+            InitTransition(TransitionParams, TargetState, NewTransition);
+
+            if (!ModifiedStates.Contains(*SourceState))
+            {
+                (*SourceState)->Modify();
+                ModifiedStates.Add(*SourceState);
+            }
+            const int32 TransitionIndex = (*SourceState)->Transitions.Add(NewTransition);
+            AddSpecElementResult(Elements, FailedCount, TEXT("transition"), StateName, TransitionName, true, FString());
+
+            for (const FAddConditionParams& ConditionSpec : TransitionSpec.Conditions)
+            {
+                FAddConditionParams ConditionParams = ConditionSpec;
+                ConditionParams.StateTreePath = TreePath;
+                ConditionParams.SourceStateName = StateName;
+                ConditionParams.TransitionIndex = TransitionIndex;
+
+                FString Error;
+                const bool bAdded = AddConditionToTransition(ConditionParams, Error);
+                AddSpecElementResult(Elements, FailedCount, TEXT("transition_condition"), StateName,
+                    FString::Printf(TEXT("%s [%d]: %s"), *TransitionName, TransitionIndex, *ConditionParams.ConditionStructPath), bAdded, Error);
+            }
+        }
+    }
+
+    for (const FAddEvaluatorParams& EvaluatorSpec : Params.Evaluators)
+    {
+        FAddEvaluatorParams EvaluatorParams = EvaluatorSpec;
+        EvaluatorParams.StateTreePath = TreePath;
+
+        FString Error;
+        const bool bAdded = AddEvaluator(EvaluatorParams, Error);
+        AddSpecElementResult(Elements, FailedCount, TEXT("evaluator"), FString(),
+            EvaluatorParams.EvaluatorName.IsEmpty() ? EvaluatorParams.EvaluatorStructPath : EvaluatorParams.EvaluatorName, bAdded, Error);
+    }
+
+    for (const FAddGlobalTaskParams& TaskSpec : Params.GlobalTasks)
+    {
+        FAddGlobalTaskParams TaskParams = TaskSpec;
+        TaskParams.StateTreePath = TreePath;
+
+        FString Error;
+        const bool bAdded = AddGlobalTask(TaskParams, Error);
+        AddSpecElementResult(Elements, FailedCount, TEXT("global_task"), FString(),
+            TaskParams.TaskName.IsEmpty() ? TaskParams.TaskStructPath : TaskParams.TaskName, bAdded, Error);
+    }
+
+    // Bindings last, once every node they can refer to exists
+    for (const FBindPropertyParams& BindingSpec : Params.Bindings)
+    {
+        FBindPropertyParams BindingParams = BindingSpec;
+        BindingParams.StateTreePath = TreePath;
+
+        FString Error;
+        const bool bBound = BindProperty(BindingParams, Error);
+        AddSpecElementResult(Elements, FailedCount, TEXT("binding"), FString(),
+            FString::Printf(TEXT("%s.%s -> %s.%s"), *BindingParams.SourceNodeName, *BindingParams.SourcePropertyName,
+                *BindingParams.TargetNodeName, *BindingParams.TargetPropertyName), bBound, Error);
+    }
+
+    // One compile for the whole spec
+    bool bCompiled = false;
+    FString CompileError;
+    if (Params.bCompile)
+    {
+        bCompiled = CompileStateTree(StateTree, CompileError);
+    }
+
+    FString SaveError;
+    SaveAsset(StateTree, SaveError);
+
+    UE_LOG(LogTemp, Log, TEXT("FStateTreeService::BuildStateTreeFromSpec: Built '%s': %d element(s), %d failed"),
+        *TreePath, Elements.Num(), FailedCount);
+
+    OutReport = MakeShared<FJsonObject>();
+    OutReport->SetStringField(TEXT("state_tree_path"), TreePath);
+    OutReport->SetBoolField(TEXT("created"), bCreated);
+    OutReport->SetNumberField(TEXT("element_count"), Elements.Num());
+    OutReport->SetNumberField(TEXT("failed_count"), FailedCount);
+    OutReport->SetArrayField(TEXT("elements"), Elements);
+    OutReport->SetBoolField(TEXT("compile_requested"), Params.bCompile);
+    if (Params.bCompile)
+    {
+        OutReport->SetBoolField(TEXT("compiled"), bCompiled);
+        if (!bCompiled)
+        {
+            OutReport->SetStringField(TEXT("compile_error"), CompileError);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,147 @@
+// StateTreeStateIndex.cpp - Index of the states of an editor data by name and id
+// GetStateIndex, InvalidateStateIndex, IsStateInTree, FindStateByName, CollectStatesByName
+
+#include "Services/StateTreeService.h"
+#include "Services/StateTreeTagIndex.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+
+FStateTreeService::FStateIndex& FStateTreeService::GetStateIndex(UStateTreeEditorData* EditorData)
+{
+    FStateIndex* Index = StateIndices.Find(EditorData);
+    if (!Index)
+    {
+        // Indices of editor data that was garbage collected are dropped before a new one is added
+        for (auto It = StateIndices.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Index = &StateIndices.Add(EditorData);
+    }
+
+    if (Index->bBuilt)
+    {
+        return *Index;
+    }
+
+    Index->ByName.Reset();
+    Index->ById.Reset();
+
+    // Depth-first, children in order, so a duplicated name resolves to the state a tree walk finds first
+    TArray<UStateTreeState*> Stack;
+    for (int32 StateIndex = EditorData->SubTrees.Num() - 1; StateIndex >= 0; --StateIndex)
+    {
+        Stack.Add(EditorData->SubTrees[StateIndex]);
+    }
+
+    while (Stack.Num() > 0)
+    {
+        UStateTreeState* State = Stack.Pop(EAllowShrinking::No);
+        if (!State)
+        {
+            continue;
+        }
+
+        const FString StateName = State->Name.ToString();
+        if (!Index->ByName.Contains(StateName))
+        {
+            Index->ByName.Add(StateName, State);
+        }
+        Index->ById.Add(State->ID, State);
+
+        for (int32 ChildIndex = State->Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+        {
+            Stack.Add(State->Children[ChildIndex]);
+        }
+    }
+
+    Index->bBuilt = true;
+    return *Index;
+}
+
+void FStateTreeService::InvalidateStateIndex(UStateTreeEditorData* EditorData)
+{
+    if (FStateIndex* Index = StateIndices.Find(EditorData))
+    {
+        Index->bBuilt = false;
+    }
+    FStateTreeTagIndex::Get().Invalidate(EditorData ? EditorData->GetTypedOuter<UStateTree>() : nullptr);
+}
+
+bool FStateTreeService::IsStateInTree(UStateTreeEditorData* EditorData, const UStateTreeState* State) const
+{
+    const UStateTreeState* Current = State;
+    while (const UStateTreeState* Parent = Current->Parent)
+    {
+        if (!Parent->Children.Contains(Current))
+        {
+            return false;
+        }
+        Current = Parent;
+    }
+    return EditorData->SubTrees.Contains(Current);
+}
+
+UStateTreeState* FStateTreeService::FindStateByName(UStateTreeEditorData* EditorData, const FString& StateName)
+{
+    if (!EditorData)
+    {
+        return nullptr;
+    }
+
+    FGuid StateId;
+    const bool bIsId = FGuid::Parse(StateName, StateId);
+
+    auto Lookup = [&StateName, &StateId, bIsId](const FStateIndex& Index) -> UStateTreeState*
+    {
+        if (const TWeakObjectPtr<UStateTreeState>* Found = Index.ByName.Find(StateName))
+        {
+            UStateTreeState* State = Found->Get();
+            return State && State->Name.ToString() == StateName ? State : nullptr;
+        }
+        if (bIsId)
+        {
+            if (const TWeakObjectPtr<UStateTreeState>* Found = Index.ById.Find(StateId))
+            {
+                UStateTreeState* State = Found->Get();
+                return State && State->ID == StateId ? State : nullptr;
+            }
+        }
+        return nullptr;
+    };
+
+    FStateIndex& Index = GetStateIndex(EditorData);
+    UStateTreeState* State = Lookup(Index);
+    if (State && IsStateInTree(EditorData, State))
+    {
+        return State;
+    }
+
+    // The tree may have changed outside the service since the index was built
+    Index.bBuilt = false;
+    return Lookup(GetStateIndex(EditorData));
+}
+
+void FStateTreeService::CollectStatesByName(UStateTreeEditorData* EditorData, TMap<FString, UStateTreeState*>& OutStates)
+{
+    if (!EditorData)
+    {
+        return;
+    }
+
+    // A batch resolves every name from this map without checking it again, so it starts from a fresh walk
+    InvalidateStateIndex(EditorData);
+    const FStateIndex& Index = GetStateIndex(EditorData);
+    OutStates.Reserve(OutStates.Num() + Index.ByName.Num());
+    for (const TPair<FString, TWeakObjectPtr<UStateTreeState>>& Pair : Index.ByName)
+    {
+        if (UStateTreeState* State = Pair.Value.Get())
+        {
+            OutStates.Add(Pair.Key, State);
+        }
+    }
+}
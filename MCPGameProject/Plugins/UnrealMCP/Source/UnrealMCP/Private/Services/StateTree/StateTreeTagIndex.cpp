@@ -0,0 +1,286 @@
+#include "Services/StateTreeTagIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Editor.h"
+#include "MCPLogging.h"
+#include "StateTree.h"
+#include "StateTreeEditorData.h"
+#include "StateTreeState.h"
+#include "UObject/UObjectGlobals.h"
+
+FStateTreeTagIndex& FStateTreeTagIndex::Get()
+{
+    static FStateTreeTagIndex Instance;
+    return Instance;
+}
+
+void FStateTreeTagIndex::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FStateTreeTagIndex::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FStateTreeTagIndex::HandleUndoRedo);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("statetree_tag_index"), TEXT("index"), CacheCounters,
+        [this]() { return static_cast<int64>(Trees.Num()); });
+}
+
+void FStateTreeTagIndex::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("statetree_tag_index"));
+
+    Trees.Empty();
+}
+
+void FStateTreeTagIndex::FindStates(UStateTree* StateTree, const FGameplayTag& Tag, bool bExactMatch, bool bIncludeLinked, TArray<FMatch>& OutMatches)
+{
+    check(IsInGameThread());
+    if (!StateTree || !Tag.IsValid())
+    {
+        return;
+    }
+
+    // Breadth-first over the links, each tree once, so a tree linked from several states or in a cycle is searched once
+    TSet<const UStateTree*> Visited;
+    TArray<TPair<UStateTree*, int32>> Queue;
+    Queue.Emplace(StateTree, 0);
+    Visited.Add(StateTree);
+
+    for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+    {
+        UStateTree* Tree = Queue[QueueIndex].Key;
+        const int32 LinkDepth = Queue[QueueIndex].Value;
+
+        if (bInitialized && Trees.Contains(Tree))
+        {
+            CacheCounters.RecordHit();
+        }
+        else
+        {
+            CacheCounters.RecordMiss();
+        }
+
+        const int32 FirstMatch = OutMatches.Num();
+        if (!CollectMatches(Tree, GetTreeTags(Tree), Tag, bExactMatch, LinkDepth, OutMatches))
+        {
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("StateTree tag index: '%s' changed outside the service, rebuilding"), *Tree->GetPathName());
+            OutMatches.SetNum(FirstMatch);
+            Invalidate(Tree);
+            CollectMatches(Tree, GetTreeTags(Tree), Tag, bExactMatch, LinkDepth, OutMatches);
+        }
+
+        if (bIncludeLinked)
+        {
+            for (const TWeakObjectPtr<UStateTree>& LinkedTree : GetTreeTags(Tree).LinkedTrees)
+            {
+                UStateTree* Linked = LinkedTree.Get();
+                bool bAlreadyVisited = true;
+                if (Linked)
+                {
+                    Visited.Add(Linked, &bAlreadyVisited);
+                }
+                if (!bAlreadyVisited)
+                {
+                    Queue.Emplace(Linked, LinkDepth + 1);
+                }
+            }
+        }
+    }
+}
+
+void FStateTreeTagIndex::HandleTagChanged(UStateTreeState* State, const FGameplayTag& OldTag)
+{
+    if (!State || !bInitialized || !IsInGameThread())
+    {
+        return;
+    }
+
+    FTreeTags* Tags = Trees.Find(State->GetTypedOuter<UStateTree>());
+    if (!Tags)
+    {
+        return;
+    }
+
+    const int32* Position = Tags->Positions.Find(State);
+    if (!Position)
+    {
+        // A state the last walk did not see; the next query walks again
+        Invalidate(State->GetTypedOuter<UStateTree>());
+        return;
+    }
+
+    if (TArray<TPair<int32, TWeakObjectPtr<UStateTreeState>>>* OldStates = Tags->StatesByTag.Find(OldTag))
+    {
+        OldStates->RemoveAll([Position](const TPair<int32, TWeakObjectPtr<UStateTreeState>>& Entry) { return Entry.Key == *Position; });
+        if (OldStates->Num() == 0)
+        {
+            Tags->StatesByTag.Remove(OldTag);
+        }
+    }
+
+    if (State->Tag.IsValid())
+    {
+        // Kept in walk order so matches come back in tree order
+        TArray<TPair<int32, TWeakObjectPtr<UStateTreeState>>>& NewStates = Tags->StatesByTag.FindOrAdd(State->Tag);
+        const int32 InsertAt = Algo::LowerBoundBy(NewStates, *Position, [](const TPair<int32, TWeakObjectPtr<UStateTreeState>>& Entry) { return Entry.Key; });
+        NewStates.Insert(TPair<int32, TWeakObjectPtr<UStateTreeState>>(*Position, State), InsertAt);
+    }
+}
+
+void FStateTreeTagIndex::Invalidate(const UStateTree* StateTree)
+{
+    if (StateTree && IsInGameThread() && Trees.Remove(StateTree) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+const FStateTreeTagIndex::FTreeTags& FStateTreeTagIndex::GetTreeTags(UStateTree* StateTree)
+{
+    // Without the change handlers a kept index could go stale unnoticed
+    if (!bInitialized)
+    {
+        Build(StateTree, UncachedTags);
+        return UncachedTags;
+    }
+
+    if (const FTreeTags* Tags = Trees.Find(StateTree))
+    {
+        return *Tags;
+    }
+
+    // Indices of trees that were garbage collected are dropped before a new one is added
+    for (auto It = Trees.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    FTreeTags& Tags = Trees.Add(StateTree);
+    Build(StateTree, Tags);
+    return Tags;
+}
+
+void FStateTreeTagIndex::Build(UStateTree* StateTree, FTreeTags& OutTags)
+{
+    OutTags = FTreeTags();
+
+    const UStateTreeEditorData* EditorData = Cast<UStateTreeEditorData>(StateTree->EditorData);
+    if (!EditorData)
+    {
+        return;
+    }
+
+    // Depth-first, children in order, the order the tree editor lists states in
+    TArray<UStateTreeState*> Stack;
+    for (int32 Index = EditorData->SubTrees.Num() - 1; Index >= 0; --Index)
+    {
+        Stack.Add(EditorData->SubTrees[Index]);
+    }
+
+    int32 Position = 0;
+    while (Stack.Num() > 0)
+    {
+        UStateTreeState* State = Stack.Pop(EAllowShrinking::No);
+        if (!State)
+        {
+            continue;
+        }
+
+        OutTags.Positions.Add(State, Position);
+        if (State->Tag.IsValid())
+        {
+            OutTags.StatesByTag.FindOrAdd(State->Tag).Emplace(Position, State);
+        }
+        if (State->Type == EStateTreeStateType::LinkedAsset && State->LinkedAsset)
+        {
+            OutTags.LinkedTrees.AddUnique(State->LinkedAsset.Get());
+        }
+        Position++;
+
+        for (int32 ChildIndex = State->Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+        {
+            Stack.Add(State->Children[ChildIndex]);
+        }
+    }
+}
+
+bool FStateTreeTagIndex::CollectMatches(UStateTree* StateTree, const FTreeTags& Tags, const FGameplayTag& Tag, bool bExactMatch, int32 LinkDepth, TArray<FMatch>& OutMatches)
+{
+    // One list for an exact match; otherwise every distinct tag under the searched one, merged back into tree order
+    TArray<const TPair<int32, TWeakObjectPtr<UStateTreeState>>*> Hits;
+    for (const TPair<FGameplayTag, TArray<TPair<int32, TWeakObjectPtr<UStateTreeState>>>>& Pair : Tags.StatesByTag)
+    {
+        if (bExactMatch ? Pair.Key == Tag : Pair.Key.MatchesTag(Tag))
+        {
+            for (const TPair<int32, TWeakObjectPtr<UStateTreeState>>& Entry : Pair.Value)
+            {
+                Hits.Add(&Entry);
+            }
+        }
+    }
+    if (!bExactMatch)
+    {
+        Hits.Sort([](const TPair<int32, TWeakObjectPtr<UStateTreeState>>& A, const TPair<int32, TWeakObjectPtr<UStateTreeState>>& B) { return A.Key < B.Key; });
+    }
+
+    for (const TPair<int32, TWeakObjectPtr<UStateTreeState>>* Hit : Hits)
+    {
+        UStateTreeState* State = Hit->Value.Get();
+        const bool bStillMatches = State && (bExactMatch ? State->Tag == Tag : State->Tag.MatchesTag(Tag));
+        if (!bStillMatches || !IsStateInTree(State))
+        {
+            return false;
+        }
+        OutMatches.Add({ StateTree, State, LinkDepth });
+    }
+    return true;
+}
+
+bool FStateTreeTagIndex::IsStateInTree(const UStateTreeState* State)
+{
+    const UStateTreeState* Current = State;
+    while (const UStateTreeState* Parent = Current->Parent)
+    {
+        if (!Parent->Children.Contains(Current))
+        {
+            return false;
+        }
+        Current = Parent;
+    }
+
+    const UStateTreeEditorData* EditorData = Current->GetTypedOuter<UStateTreeEditorData>();
+    return EditorData && EditorData->SubTrees.Contains(Current);
+}
+
+void FStateTreeTagIndex::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // A tag, link or state-list edit in the details panel ends in PostEditChangeProperty on the state or editor data
+    if (Object && (Object->IsA<UStateTreeState>() || Object->IsA<UStateTreeEditorData>()))
+    {
+        Invalidate(Object->GetTypedOuter<UStateTree>());
+    }
+}
+
+void FStateTreeTagIndex::HandleUndoRedo()
+{
+    Trees.Empty();
+    CacheCounters.RecordInvalidation();
+}
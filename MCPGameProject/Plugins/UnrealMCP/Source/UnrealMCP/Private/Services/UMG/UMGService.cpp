@@ -4,7 +4,7 @@
 #include "Services/UMG/WidgetLayoutService.h"
 #include "Services/UMG/WidgetInputHandlerService.h"
 #include "Services/UMG/WidgetBindingService.h"
-#include "Services/PropertyService.h"
+#include "Services/PropertyAccessorCache.h"
 #include "Utils/UnrealMCPCommonUtils.h"
 #include "WidgetBlueprint.h"
 #include "Blueprint/UserWidget.h"
@@ -44,6 +44,7 @@
 #include "UObject/EnumProperty.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
+#include "MCPSaveQueue.h"
 
 FUMGService& FUMGService::Get()
 {
@@ -228,6 +229,24 @@ bool FUMGService::SetWidgetProperties(const FString& BlueprintName, const FStrin
         return false;
     }
 
+    ApplyWidgetProperties(WidgetBlueprint, Widget, Properties, OutSuccessProperties, OutFailedProperties);
+
+    // Save the blueprint if any properties were set
+    if (OutSuccessProperties.Num() > 0)
+    {
+        WidgetBlueprint->MarkPackageDirty();
+        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+        FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
+    }
+
+    return OutSuccessProperties.Num() > 0;
+}
+
+void FUMGService::ApplyWidgetProperties(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget, const TSharedPtr<FJsonObject>& Properties,
+                                       TArray<FString>& OutSuccessProperties, TArray<FString>& OutFailedProperties) const
+{
+    const FString ComponentName = Widget->GetName();
+
     OutSuccessProperties.Empty();
     OutFailedProperties.Empty();
 
@@ -415,31 +434,21 @@ bool FUMGService::SetWidgetProperties(const FString& BlueprintName, const FStrin
         RemainingProperties->RemoveField(PropToRemove);
     }
 
-    // Use PropertyService for remaining universal property setting
-    TArray<FString> SuccessProps;
-    TMap<FString, FString> FailedProps;
-
-    FPropertyService::Get().SetObjectProperties(Widget, RemainingProperties, SuccessProps, FailedProps);
-
-    // Append PropertyService results to output arrays (don't overwrite special-handled properties)
-    OutSuccessProperties.Append(SuccessProps);
-    for (const auto& FailedProp : FailedProps)
-    {
-        OutFailedProperties.Add(FailedProp.Key);
-        // Log detailed error message
-        UE_LOG(LogTemp, Warning, TEXT("UMGService: Failed to set property '%s': %s"), 
-               *FailedProp.Key, *FailedProp.Value);
-    }
-
-    // Save the blueprint if any properties were set
-    if (OutSuccessProperties.Num() > 0)
+    // Remaining properties by name or struct member path, resolved once per widget class
+    for (const auto& PropPair : RemainingProperties->Values)
     {
-        WidgetBlueprint->MarkPackageDirty();
-        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-        UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+        FString PropertyError;
+        if (FPropertyAccessorCache::Get().SetPropertyByPath(Widget, PropPair.Key, PropPair.Value, PropertyError))
+        {
+            OutSuccessProperties.Add(PropPair.Key);
+        }
+        else
+        {
+            OutFailedProperties.Add(PropPair.Key);
+            UE_LOG(LogTemp, Warning, TEXT("UMGService: Failed to set property '%s': %s"),
+                   *PropPair.Key, *PropertyError);
+        }
     }
-
-    return OutSuccessProperties.Num() > 0;
 }
 
 bool FUMGService::BindWidgetEvent(const FString& BlueprintName, const FString& ComponentName, 
@@ -636,7 +645,7 @@ bool FUMGService::SetWidgetPlacement(const FString& BlueprintName, const FString
     {
         WidgetBlueprint->MarkPackageDirty();
         FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-        UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+        FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
     }
 
     return bResult;
@@ -735,7 +744,7 @@ bool FUMGService::AddChildWidgetComponentToParent(const FString& BlueprintName,
     // Save the blueprint
     WidgetBlueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
 
     return true;
 }
@@ -952,9 +961,9 @@ bool FUMGService::SetWidgetProperty(UWidget* Widget, const FString& PropertyName
         return false;
     }
 
-    // Use PropertyService for universal property setting (supports enums, structs, all types)
+    // Use PropertyService conversion through the cached path (supports enums, structs, all types)
     FString ErrorMessage;
-    bool bSuccess = FPropertyService::Get().SetObjectProperty(Widget, PropertyName, PropertyValue, ErrorMessage);
+    bool bSuccess = FPropertyAccessorCache::Get().SetPropertyByPath(Widget, PropertyName, PropertyValue, ErrorMessage);
     
     if (!bSuccess)
     {
@@ -1073,7 +1082,7 @@ bool FUMGService::GetWidgetComponentLayout(const FString& BlueprintName, TShared
 }
 
 bool FUMGService::CaptureWidgetScreenshot(const FString& BlueprintName, int32 Width, int32 Height,
-                                         const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData)
+                                         const FMCPImageEncodeOptions& ImageOptions, TSharedPtr<FJsonObject>& OutScreenshotData)
 {
     UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName);
     if (!WidgetBlueprint)
@@ -1082,7 +1091,22 @@ bool FUMGService::CaptureWidgetScreenshot(const FString& BlueprintName, int32 Wi
         return false;
     }
 
-    return FWidgetLayoutService::CaptureWidgetScreenshot(WidgetBlueprint, Width, Height, Format, OutScreenshotData);
+    return FWidgetLayoutService::CaptureWidgetScreenshot(WidgetBlueprint, Width, Height, ImageOptions, OutScreenshotData);
+}
+
+void FUMGService::CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                              const FMCPImageEncodeOptions& ImageOptions,
+                                              TFunction<void(TSharedPtr<FJsonObject>)> OnCaptured)
+{
+    UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(BlueprintName);
+    if (!WidgetBlueprint)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UMGService: Widget blueprint '%s' not found"), *BlueprintName);
+        OnCaptured(nullptr);
+        return;
+    }
+
+    FWidgetLayoutService::CaptureWidgetScreenshotAsync(WidgetBlueprint, Width, Height, ImageOptions, MoveTemp(OnCaptured));
 }
 
 bool FUMGService::CreateWidgetInputHandler(const FString& WidgetName, const FString& ComponentName,
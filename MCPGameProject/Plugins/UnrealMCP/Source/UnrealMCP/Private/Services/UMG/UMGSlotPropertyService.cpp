@@ -2,6 +2,7 @@
 // SetSlotProperty implementation split from UMGService.cpp
 
 #include "Services/UMG/UMGService.h"
+#include "Services/PropertyAccessorCache.h"
 #include "Components/Widget.h"
 #include "Components/PanelSlot.h"
 #include "Components/CanvasPanelSlot.h"
@@ -437,8 +438,14 @@ bool FUMGService::SetSlotProperty(UWidget* Widget, const FString& PropertyName,
         }
     }
 
-    // Unknown slot type or property
-    OutError = FString::Printf(TEXT("Unsupported slot property '%s' for slot type '%s'"),
-                               *PropertyName, *Slot->GetClass()->GetName());
+    // Any other slot type or property, e.g. "Padding.Left" or OverlaySlot properties, through reflection
+    FString ReflectionError;
+    if (FPropertyAccessorCache::Get().SetPropertyByPath(Slot, PropertyName, PropertyValue, ReflectionError))
+    {
+        return true;
+    }
+
+    OutError = FString::Printf(TEXT("Unsupported slot property '%s' for slot type '%s': %s"),
+                               *PropertyName, *Slot->GetClass()->GetName(), *ReflectionError);
     return false;
 }
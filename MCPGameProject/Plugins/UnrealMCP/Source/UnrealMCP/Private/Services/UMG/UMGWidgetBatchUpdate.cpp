@@ -0,0 +1,161 @@
+// UMGWidgetBatchUpdate.cpp - Slot and property updates of many widgets in one call
+// UpdateWidgets, ApplyWidgetSpec
+
+#include "Services/UMG/UMGService.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Dom/JsonObject.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+
+bool FUMGService::UpdateWidgets(const FString& WidgetName, const TArray<TSharedPtr<FJsonObject>>& Updates,
+                                TSharedPtr<FJsonObject>& OutResult, FString& OutError)
+{
+    UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(WidgetName);
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        OutError = FString::Printf(TEXT("Widget blueprint '%s' not found"), *WidgetName);
+        return false;
+    }
+
+    // Resolve every widget first so that a misspelled name does not leave half the batch applied
+    TArray<UWidget*> Widgets;
+    Widgets.Reserve(Updates.Num());
+    for (const TSharedPtr<FJsonObject>& Update : Updates)
+    {
+        FString ComponentName;
+        if (!Update.IsValid() || !Update->TryGetStringField(TEXT("component_name"), ComponentName) || ComponentName.IsEmpty())
+        {
+            OutError = TEXT("Every update needs a 'component_name'");
+            return false;
+        }
+        UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(FName(*ComponentName));
+        if (!Widget)
+        {
+            OutError = FString::Printf(TEXT("Widget '%s' not found in '%s'"), *ComponentName, *WidgetName);
+            return false;
+        }
+        Widgets.Add(Widget);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> UpdatedWidgets;
+    int32 UpdatedCount = 0;
+    {
+        FMCPBatchEditScope BatchScope(FText::FromString(FString::Printf(TEXT("Update Widgets: %s"), *WidgetBlueprint->GetName())));
+        WidgetBlueprint->Modify();
+
+        for (int32 Index = 0; Index < Updates.Num(); ++Index)
+        {
+            UWidget* Widget = Widgets[Index];
+            Widget->Modify();
+            if (Widget->Slot)
+            {
+                Widget->Slot->Modify();
+            }
+
+            TSharedPtr<FJsonObject> WidgetResult = MakeShared<FJsonObject>();
+            WidgetResult->SetStringField(TEXT("component_name"), Widget->GetName());
+            if (ApplyWidgetSpec(WidgetBlueprint, Widget, Updates[Index], WidgetResult))
+            {
+                ++UpdatedCount;
+            }
+            UpdatedWidgets.Add(MakeShared<FJsonValueObject>(WidgetResult));
+        }
+
+        // One PostEditChange and designer refresh for the whole batch
+        if (UpdatedCount > 0)
+        {
+            FMCPBatchEditScope::MarkBlueprintAsModified(WidgetBlueprint);
+        }
+    }
+
+    if (UpdatedCount > 0)
+    {
+        WidgetBlueprint->MarkPackageDirty();
+        FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+        FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
+    }
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetStringField(TEXT("widget_name"), WidgetName);
+    OutResult->SetArrayField(TEXT("widgets"), UpdatedWidgets);
+    OutResult->SetNumberField(TEXT("widgets_updated"), UpdatedCount);
+
+    UE_LOG(LogTemp, Log, TEXT("FUMGService::UpdateWidgets - Updated %d of %d widgets in '%s'"), UpdatedCount, Updates.Num(), *WidgetName);
+    return true;
+}
+
+bool FUMGService::ApplyWidgetSpec(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget, const TSharedPtr<FJsonObject>& Spec,
+                                  const TSharedPtr<FJsonObject>& OutWidgetResult) const
+{
+    TArray<FString> SuccessProperties;
+    TArray<FString> FailedProperties;
+
+    // Canvas slot placement
+    const bool bHasPosition = Spec->HasField(TEXT("position"));
+    const bool bHasSize = Spec->HasField(TEXT("size"));
+    const bool bHasAlignment = Spec->HasField(TEXT("alignment"));
+    if (bHasPosition || bHasSize || bHasAlignment)
+    {
+        const FVector2D Position = FUnrealMCPCommonUtils::GetVector2DFromJson(Spec, TEXT("position"));
+        const FVector2D Size = FUnrealMCPCommonUtils::GetVector2DFromJson(Spec, TEXT("size"));
+        const FVector2D Alignment = FUnrealMCPCommonUtils::GetVector2DFromJson(Spec, TEXT("alignment"));
+        if (SetCanvasSlotPlacement(Widget, bHasPosition ? &Position : nullptr, bHasSize ? &Size : nullptr,
+                                   bHasAlignment ? &Alignment : nullptr))
+        {
+            SuccessProperties.Add(TEXT("placement"));
+        }
+        else
+        {
+            FailedProperties.Add(TEXT("placement"));
+        }
+    }
+
+    // Slot properties of whatever panel the widget is in
+    const TSharedPtr<FJsonObject>* SlotProperties = nullptr;
+    if (Spec->TryGetObjectField(TEXT("slot"), SlotProperties))
+    {
+        for (const auto& SlotProperty : (*SlotProperties)->Values)
+        {
+            FString SlotError;
+            const FString SlotPropertyName = FString::Printf(TEXT("Slot.%s"), *SlotProperty.Key);
+            if (SetSlotProperty(Widget, SlotProperty.Key, SlotProperty.Value, SlotError))
+            {
+                SuccessProperties.Add(SlotPropertyName);
+            }
+            else
+            {
+                FailedProperties.Add(SlotPropertyName);
+                UE_LOG(LogTemp, Warning, TEXT("UMGService: Failed to set slot property '%s' on '%s': %s"), *SlotProperty.Key, *Widget->GetName(), *SlotError);
+            }
+        }
+    }
+
+    const TSharedPtr<FJsonObject>* Properties = nullptr;
+    if (Spec->TryGetObjectField(TEXT("properties"), Properties))
+    {
+        TArray<FString> SetProperties;
+        TArray<FString> UnsetProperties;
+        ApplyWidgetProperties(WidgetBlueprint, Widget, *Properties, SetProperties, UnsetProperties);
+        SuccessProperties.Append(SetProperties);
+        FailedProperties.Append(UnsetProperties);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> SuccessJson;
+    for (const FString& Property : SuccessProperties)
+    {
+        SuccessJson.Add(MakeShared<FJsonValueString>(Property));
+    }
+    TArray<TSharedPtr<FJsonValue>> FailedJson;
+    for (const FString& Property : FailedProperties)
+    {
+        FailedJson.Add(MakeShared<FJsonValueString>(Property));
+    }
+    OutWidgetResult->SetArrayField(TEXT("success_properties"), SuccessJson);
+    OutWidgetResult->SetArrayField(TEXT("failed_properties"), FailedJson);
+
+    return SuccessProperties.Num() > 0;
+}
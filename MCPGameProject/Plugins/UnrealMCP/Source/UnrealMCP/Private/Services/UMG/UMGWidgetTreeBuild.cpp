@@ -0,0 +1,210 @@
+// UMGWidgetTreeBuild.cpp - One-shot construction of a widget hierarchy from a nested spec
+// BuildWidgetTree, ValidateWidgetTreeSpec, BuildWidgetSubtree
+
+#include "Services/UMG/UMGService.h"
+#include "Services/UMG/WidgetComponentService.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Dom/JsonObject.h"
+#include "MCPBatchEditScope.h"
+#include "MCPSaveQueue.h"
+
+bool FUMGService::BuildWidgetTree(const FString& WidgetName, const FString& ParentName,
+                                  const TSharedPtr<FJsonObject>& TreeSpec, TSharedPtr<FJsonObject>& OutResult,
+                                  FString& OutError)
+{
+    UWidgetBlueprint* WidgetBlueprint = FindWidgetBlueprint(WidgetName);
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        OutError = FString::Printf(TEXT("Widget blueprint '%s' not found"), *WidgetName);
+        return false;
+    }
+
+    if (!WidgetComponentService)
+    {
+        OutError = TEXT("Internal error: WidgetComponentService is null");
+        return false;
+    }
+
+    // Check the whole spec first so that a typo deep in the tree does not leave half a hierarchy behind
+    TSet<FString> SpecNames;
+    if (!ValidateWidgetTreeSpec(WidgetBlueprint, TreeSpec, SpecNames, OutError))
+    {
+        return false;
+    }
+
+    UWidget* ParentWidget = WidgetBlueprint->WidgetTree->RootWidget;
+    if (!ParentName.IsEmpty())
+    {
+        ParentWidget = WidgetBlueprint->WidgetTree->FindWidget(FName(*ParentName));
+        if (!ParentWidget)
+        {
+            OutError = FString::Printf(TEXT("Parent widget '%s' not found in '%s'"), *ParentName, *WidgetName);
+            return false;
+        }
+    }
+
+    // Inside execute_batch the batch decides whether to roll back; on its own, a failed build is undone
+    const bool bInBatch = FMCPBatchEditScope::IsActive();
+    TArray<TSharedPtr<FJsonValue>> CreatedWidgets;
+    bool bBuilt = false;
+    {
+        FMCPBatchEditScope BatchScope(FText::FromString(FString::Printf(TEXT("Build Widget Tree: %s"), *WidgetBlueprint->GetName())));
+        WidgetBlueprint->Modify();
+        WidgetBlueprint->WidgetTree->Modify();
+
+        bBuilt = BuildWidgetSubtree(WidgetBlueprint, TreeSpec, ParentWidget, CreatedWidgets, OutError);
+        if (bBuilt)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBlueprint);
+        }
+        else if (!bInBatch)
+        {
+            FMCPBatchEditScope::RequestRollback();
+        }
+    }
+
+    if (!bBuilt)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FUMGService::BuildWidgetTree - %s"), *OutError);
+        return false;
+    }
+
+    WidgetBlueprint->MarkPackageDirty();
+    FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
+
+    OutResult = MakeShared<FJsonObject>();
+    OutResult->SetStringField(TEXT("widget_name"), WidgetName);
+    OutResult->SetStringField(TEXT("root"), TreeSpec->GetStringField(TEXT("name")));
+    OutResult->SetArrayField(TEXT("widgets"), CreatedWidgets);
+    OutResult->SetNumberField(TEXT("widgets_created"), CreatedWidgets.Num());
+
+    UE_LOG(LogTemp, Log, TEXT("FUMGService::BuildWidgetTree - Created %d widgets in '%s'"), CreatedWidgets.Num(), *WidgetName);
+    return true;
+}
+
+bool FUMGService::ValidateWidgetTreeSpec(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& Spec,
+                                         TSet<FString>& InOutNames, FString& OutError) const
+{
+    if (!Spec.IsValid())
+    {
+        OutError = TEXT("Widget spec must be an object");
+        return false;
+    }
+
+    FString Name;
+    FString Type;
+    if (!Spec->TryGetStringField(TEXT("name"), Name) || Name.IsEmpty())
+    {
+        OutError = TEXT("Widget spec is missing 'name'");
+        return false;
+    }
+    if (!Spec->TryGetStringField(TEXT("type"), Type) || Type.IsEmpty())
+    {
+        OutError = FString::Printf(TEXT("Widget spec '%s' is missing 'type'"), *Name);
+        return false;
+    }
+
+    bool bAlreadyUsed = false;
+    InOutNames.Add(Name, &bAlreadyUsed);
+    if (bAlreadyUsed)
+    {
+        OutError = FString::Printf(TEXT("Widget name '%s' is used more than once in the spec"), *Name);
+        return false;
+    }
+    if (WidgetBlueprint->WidgetTree->FindWidget(FName(*Name)))
+    {
+        OutError = FString::Printf(TEXT("Widget '%s' already exists in '%s'"), *Name, *WidgetBlueprint->GetName());
+        return false;
+    }
+
+    if (!Spec->HasField(TEXT("children")))
+    {
+        return true;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+    if (!Spec->TryGetArrayField(TEXT("children"), Children))
+    {
+        OutError = FString::Printf(TEXT("'children' of widget '%s' must be an array"), *Name);
+        return false;
+    }
+
+    for (const TSharedPtr<FJsonValue>& Child : *Children)
+    {
+        const TSharedPtr<FJsonObject>* ChildSpec = nullptr;
+        if (!Child.IsValid() || !Child->TryGetObject(ChildSpec))
+        {
+            OutError = FString::Printf(TEXT("Children of widget '%s' must be objects"), *Name);
+            return false;
+        }
+        if (!ValidateWidgetTreeSpec(WidgetBlueprint, *ChildSpec, InOutNames, OutError))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FUMGService::BuildWidgetSubtree(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& Spec, UWidget* ParentWidget,
+                                     TArray<TSharedPtr<FJsonValue>>& OutWidgets, FString& OutError) const
+{
+    const FString Name = Spec->GetStringField(TEXT("name"));
+    const FString Type = Spec->GetStringField(TEXT("type"));
+
+    TSharedPtr<FJsonObject> Kwargs = MakeShared<FJsonObject>();
+    const TSharedPtr<FJsonObject>* KwargsObject = nullptr;
+    if (Spec->TryGetObjectField(TEXT("kwargs"), KwargsObject))
+    {
+        Kwargs = *KwargsObject;
+    }
+
+    UWidget* Widget = WidgetComponentService->ConstructWidgetComponent(WidgetBlueprint, Name, Type, Kwargs, OutError);
+    if (!Widget)
+    {
+        return false;
+    }
+
+    // Exposed as a variable by default, like widgets added with add_widget_component_to_widget
+    bool bIsVariable = true;
+    Spec->TryGetBoolField(TEXT("is_variable"), bIsVariable);
+    Widget->bIsVariable = bIsVariable;
+
+    if (ParentWidget)
+    {
+        if (!AddWidgetToParent(Widget, ParentWidget))
+        {
+            OutError = FString::Printf(TEXT("Failed to add widget '%s' to '%s'; the parent must be a panel or content widget"),
+                                       *Name, *ParentWidget->GetName());
+            return false;
+        }
+    }
+    else
+    {
+        WidgetBlueprint->WidgetTree->RootWidget = Widget;
+    }
+
+    TSharedPtr<FJsonObject> WidgetResult = MakeShared<FJsonObject>();
+    WidgetResult->SetStringField(TEXT("name"), Widget->GetName());
+    WidgetResult->SetStringField(TEXT("type"), Widget->GetClass()->GetName());
+    WidgetResult->SetStringField(TEXT("parent"), ParentWidget ? ParentWidget->GetName() : FString());
+    ApplyWidgetSpec(WidgetBlueprint, Widget, Spec, WidgetResult);
+    OutWidgets.Add(MakeShared<FJsonValueObject>(WidgetResult));
+
+    const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+    if (Spec->TryGetArrayField(TEXT("children"), Children))
+    {
+        for (const TSharedPtr<FJsonValue>& Child : *Children)
+        {
+            if (!BuildWidgetSubtree(WidgetBlueprint, Child->AsObject(), Widget, OutWidgets, OutError))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
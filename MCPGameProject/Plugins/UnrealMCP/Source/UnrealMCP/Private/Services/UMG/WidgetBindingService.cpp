@@ -9,6 +9,7 @@
 #include "K2Node_FunctionResult.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_ComponentBoundEvent.h"
+#include "MCPSaveQueue.h"
 
 bool FWidgetBindingService::CreateEventBinding(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget,
                                                const FString& WidgetVarName, const FString& EventName,
@@ -114,7 +115,7 @@ bool FWidgetBindingService::CreateEventBinding(UWidgetBlueprint* WidgetBlueprint
     // Save the blueprint
     WidgetBlueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
 
     return true;
 }
@@ -290,7 +291,7 @@ bool FWidgetBindingService::CreateTextBlockBindingFunction(UWidgetBlueprint* Wid
     // Save the blueprint
     WidgetBlueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
 
     return true;
 }
@@ -1,4 +1,5 @@
 #include "Services/UMG/WidgetComponentService.h"
+#include "Services/UMG/WidgetValidationCache.h"
 #include "Editor/UMGEditor/Public/WidgetBlueprint.h"
 #include "Blueprint/WidgetTree.h"
 #include "Components/TextBlock.h"
@@ -42,6 +43,7 @@
 #include "Components/NativeWidgetHost.h"
 #include "Components/BackgroundBlur.h"
 #include "Components/UniformGridPanel.h"
+#include "MCPSaveQueue.h"
 
 FWidgetComponentService::FWidgetComponentService()
 {
@@ -81,6 +83,39 @@ UWidget* FWidgetComponentService::CreateWidgetComponent(
     }
     UE_LOG(LogTemp, Log, TEXT("FWidgetComponentService::CreateWidgetComponent Received Kwargs for %s (%s): %s"), *ComponentName, *ComponentType, *JsonString);
 
+    UWidget* CreatedWidget = ConstructWidgetComponent(WidgetBlueprint, ComponentName, ComponentType, KwargsObject, OutError);
+    if (!CreatedWidget)
+    {
+        return nullptr;
+    }
+
+    // Add the widget to the widget tree
+    if (!AddWidgetToTree(WidgetBlueprint, CreatedWidget, Position, Size))
+    {
+        OutError = FString::Printf(TEXT("Failed to add widget '%s' to the widget tree. The widget was created but could not be added to the blueprint's root canvas."), *ComponentName);
+        UE_LOG(LogTemp, Error, TEXT("%s"), *OutError);
+        return nullptr;
+    }
+
+    // Adding to the tree modifies nothing the validation cache hears about
+    FWidgetValidationCache::Get().Invalidate(WidgetBlueprint);
+
+    // Save the blueprint
+    SaveWidgetBlueprint(WidgetBlueprint);
+
+    UE_LOG(LogTemp, Log, TEXT("Successfully created and added widget component: %s"), *ComponentName);
+    return CreatedWidget;
+}
+
+UWidget* FWidgetComponentService::ConstructWidgetComponent(
+    UWidgetBlueprint* WidgetBlueprint,
+    const FString& ComponentName,
+    const FString& ComponentType,
+    const TSharedPtr<FJsonObject>& KwargsObject,
+    FString& OutError)
+{
+    OutError.Empty();
+
     // Create the appropriate widget based on component type
     UWidget* CreatedWidget = nullptr;
 
@@ -297,18 +332,6 @@ UWidget* FWidgetComponentService::CreateWidgetComponent(
         return nullptr;
     }
 
-    // Add the widget to the widget tree
-    if (!AddWidgetToTree(WidgetBlueprint, CreatedWidget, Position, Size))
-    {
-        OutError = FString::Printf(TEXT("Failed to add widget '%s' to the widget tree. The widget was created but could not be added to the blueprint's root canvas."), *ComponentName);
-        UE_LOG(LogTemp, Error, TEXT("%s"), *OutError);
-        return nullptr;
-    }
-
-    // Save the blueprint
-    SaveWidgetBlueprint(WidgetBlueprint);
-
-    UE_LOG(LogTemp, Log, TEXT("Successfully created and added widget component: %s"), *ComponentName);
     return CreatedWidget;
 }
 
@@ -648,7 +671,7 @@ void FWidgetComponentService::SaveWidgetBlueprint(UWidgetBlueprint* WidgetBluepr
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
     
     // Save the asset
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
     
     UE_LOG(LogTemp, Log, TEXT("Saved widget blueprint: %s"), *WidgetBlueprint->GetName());
 }
@@ -10,6 +10,7 @@
 #include "K2Node_CallFunction.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "EdGraphSchema_K2.h"
+#include "MCPSaveQueue.h"
 
 bool FWidgetInputHandlerService::CreateWidgetInputHandler(UWidgetBlueprint* WidgetBlueprint, const FString& ComponentName,
                                                          const FString& InputType, const FString& InputEvent,
@@ -64,7 +65,7 @@ bool FWidgetInputHandlerService::CreateWidgetInputHandler(UWidgetBlueprint* Widg
     // Compile and save
     WidgetBlueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FWidgetInputHandlerService::CreateWidgetInputHandler - Successfully created input handler '%s'"), *HandlerName);
     return true;
@@ -105,7 +106,7 @@ bool FWidgetInputHandlerService::RemoveWidgetFunctionGraph(UWidgetBlueprint* Wid
     // Mark as modified and save
     WidgetBlueprint->MarkPackageDirty();
     FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-    UEditorAssetLibrary::SaveAsset(WidgetBlueprint->GetPathName(), false);
+    FMCPSaveQueue::Get().SaveOrEnqueue(WidgetBlueprint);
 
     UE_LOG(LogTemp, Log, TEXT("FWidgetInputHandlerService::RemoveWidgetFunctionGraph - Successfully removed function graph '%s'"), *FunctionName);
     return true;
@@ -15,12 +15,18 @@
 #include "Components/VerticalBox.h"
 #include "Components/VerticalBoxSlot.h"
 #include "Styling/SlateBrush.h"
+#include "Layout/ArrangedChildren.h"
+#include "Widgets/SWidget.h"
 
 // Includes for screenshot capture
 #include "Slate/WidgetRenderer.h"
 #include "Engine/TextureRenderTarget2D.h"
-#include "Misc/Base64.h"
-#include "ImageUtils.h"
+#include "Misc/CoreDelegates.h"
+#include "MCPImageEncoding.h"
+#include "MCPViewportCapture.h"
+#include "MCPAttachments.h"
+#include "Async/Async.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Engine/World.h"
 #include "Editor.h"
 
@@ -273,130 +279,440 @@ TSharedPtr<FJsonObject> FWidgetLayoutService::BuildWidgetHierarchy(UWidget* Widg
     return WidgetInfo;
 }
 
+namespace
+{
+    /**
+     * Render targets and the widget renderer kept between screenshots; game thread only
+     * Targets are pooled by exact size: the widget renderer maps the window onto the whole target,
+     * so a larger one can not stand in for a smaller one. Capturing many states of one widget
+     * reuses the same target instead of allocating a GPU texture per call.
+     */
+    class FWidgetCaptureResources
+    {
+    public:
+        static FWidgetCaptureResources& Get()
+        {
+            static FWidgetCaptureResources Resources;
+            return Resources;
+        }
+
+        FWidgetRenderer& GetRenderer()
+        {
+            if (!Renderer.IsValid())
+            {
+                Renderer = MakeUnique<FWidgetRenderer>(true, false);
+            }
+            return *Renderer;
+        }
+
+        /** Lease a cleared render target of the given size */
+        UTextureRenderTarget2D* Acquire(const FIntPoint& Size)
+        {
+            for (FPooledTarget& Target : Targets)
+            {
+                if (!Target.bInUse && Target.Size == Size && Target.RenderTarget.IsValid())
+                {
+                    Target.bInUse = true;
+                    Target.RenderTarget->UpdateResourceImmediate(true);
+                    return Target.RenderTarget.Get();
+                }
+            }
+
+            UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
+            RenderTarget->InitCustomFormat(Size.X, Size.Y, PF_B8G8R8A8, true);
+            RenderTarget->UpdateResourceImmediate(true);
+
+            FPooledTarget& Target = Targets.AddDefaulted_GetRef();
+            Target.RenderTarget.Reset(RenderTarget);
+            Target.Size = Size;
+            Target.bInUse = true;
+            return RenderTarget;
+        }
+
+        /** Return a leased render target, dropping the least recently used idle ones over the limit */
+        void Release(UTextureRenderTarget2D* RenderTarget)
+        {
+            for (FPooledTarget& Target : Targets)
+            {
+                if (Target.RenderTarget.Get() == RenderTarget)
+                {
+                    Target.bInUse = false;
+                    Target.LastUsedTime = FPlatformTime::Seconds();
+                }
+            }
+
+            int32 IdleCount = 0;
+            for (const FPooledTarget& Target : Targets)
+            {
+                IdleCount += Target.bInUse ? 0 : 1;
+            }
+            while (IdleCount > MaxIdleTargets)
+            {
+                int32 OldestIndex = INDEX_NONE;
+                for (int32 Index = 0; Index < Targets.Num(); ++Index)
+                {
+                    if (!Targets[Index].bInUse && (OldestIndex == INDEX_NONE || Targets[Index].LastUsedTime < Targets[OldestIndex].LastUsedTime))
+                    {
+                        OldestIndex = Index;
+                    }
+                }
+                Targets.RemoveAtSwap(OldestIndex);
+                --IdleCount;
+            }
+        }
+
+    private:
+        FWidgetCaptureResources()
+        {
+            // Strong object pointers must not outlive the object system at static destruction
+            FCoreDelegates::OnEnginePreExit.AddLambda([this]()
+            {
+                Targets.Empty();
+                Renderer.Reset();
+            });
+        }
+
+        struct FPooledTarget
+        {
+            TStrongObjectPtr<UTextureRenderTarget2D> RenderTarget;
+            FIntPoint Size = FIntPoint::ZeroValue;
+            bool bInUse = false;
+            double LastUsedTime = 0.0;
+        };
+
+        /** Idle targets kept for reuse; a handful covers the sizes an agent cycles through */
+        static constexpr int32 MaxIdleTargets = 4;
+
+        TArray<FPooledTarget> Targets;
+        TUniquePtr<FWidgetRenderer> Renderer;
+    };
+
+    /**
+     * Create a preview instance of a widget blueprint in the editor world and build its Slate widget
+     * @param Context Operation named in log messages
+     * @param OutSlateWidget Receives the instance's Slate widget
+     * @return The preview instance, to be removed and marked as garbage by the caller; nullptr on failure
+     */
+    UUserWidget* CreatePreviewWidget(UWidgetBlueprint* WidgetBlueprint, const TCHAR* Context, TSharedPtr<SWidget>& OutSlateWidget)
+    {
+        // Get the editor world
+        UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+        if (!EditorWorld)
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::%s - No editor world available"), Context);
+            return nullptr;
+        }
+
+        // Create a preview instance of the widget
+        UClass* GeneratedClass = WidgetBlueprint->GeneratedClass;
+        if (!GeneratedClass || !GeneratedClass->IsChildOf(UUserWidget::StaticClass()))
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::%s - Invalid or incompatible generated class"), Context);
+            return nullptr;
+        }
+        UUserWidget* PreviewWidget = CreateWidget<UUserWidget>(EditorWorld, GeneratedClass);
+        if (!PreviewWidget)
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::%s - Failed to create widget preview instance"), Context);
+            return nullptr;
+        }
+
+        // Get the Slate widget
+        OutSlateWidget = PreviewWidget->TakeWidget();
+        if (!OutSlateWidget.IsValid())
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::%s - Failed to get Slate widget"), Context);
+            PreviewWidget->RemoveFromParent();
+            PreviewWidget->MarkAsGarbage();
+            return nullptr;
+        }
+        return PreviewWidget;
+    }
+
+    /**
+     * Draw a preview instance of a widget blueprint into a pooled render target
+     * The widget is laid out at Width x Height and rendered at that size times the scale.
+     * @param OutRegion The part of the render target the image options select
+     * @return The leased render target with the draw enqueued, or nullptr on failure
+     */
+    UTextureRenderTarget2D* RenderWidget(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                         const FMCPImageEncodeOptions& ImageOptions, FIntRect& OutRegion)
+    {
+        if (!WidgetBlueprint)
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Widget blueprint is null"));
+            return nullptr;
+        }
+
+        UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Capturing screenshot for '%s' at %dx%d"),
+               *WidgetBlueprint->GetName(), Width, Height);
+
+        // Verify the widget has a generated class
+        if (!WidgetBlueprint->GeneratedClass)
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Widget blueprint '%s' has no generated class"), *WidgetBlueprint->GetName());
+            return nullptr;
+        }
+
+        FIntRect LayoutRegion;
+        FString RegionError;
+        if (!FMCPImageEncoding::ResolveRegion(ImageOptions.Region, FIntPoint(Width, Height), LayoutRegion, RegionError))
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - %s"), *RegionError);
+            return nullptr;
+        }
+
+        TSharedPtr<SWidget> SlateWidget;
+        UUserWidget* PreviewWidget = CreatePreviewWidget(WidgetBlueprint, TEXT("CaptureWidgetScreenshot"), SlateWidget);
+        if (!PreviewWidget)
+        {
+            return nullptr;
+        }
+
+        // Lay out at the requested size but render straight at the output scale, so downscaling
+        // saves the render and the readback as well as the encode
+        FWidgetCaptureResources& Resources = FWidgetCaptureResources::Get();
+        const FIntPoint RenderSize = FMCPImageEncoding::GetScaledSize(FIntPoint(Width, Height), ImageOptions.Scale);
+        UTextureRenderTarget2D* RenderTarget = Resources.Acquire(RenderSize);
+
+        // Render widget to texture; the draw is enqueued, so the preview instance can go at once
+        Resources.GetRenderer().DrawWidget(
+            RenderTarget,
+            SlateWidget.ToSharedRef(),
+            ImageOptions.Scale,
+            FVector2D(Width, Height),
+            0.0f);
+        PreviewWidget->RemoveFromParent();
+        PreviewWidget->MarkAsGarbage();
+
+        // Only the pixels of the region are read back
+        OutRegion = FIntRect(
+            FIntPoint(FMath::FloorToInt32(LayoutRegion.Min.X * ImageOptions.Scale), FMath::FloorToInt32(LayoutRegion.Min.Y * ImageOptions.Scale)),
+            FIntPoint(FMath::CeilToInt32(LayoutRegion.Max.X * ImageOptions.Scale), FMath::CeilToInt32(LayoutRegion.Max.Y * ImageOptions.Scale)));
+        OutRegion.Clip(FIntRect(FIntPoint::ZeroValue, RenderSize));
+        if (OutRegion.IsEmpty())
+        {
+            UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Region is empty at the requested scale"));
+            Resources.Release(RenderTarget);
+            return nullptr;
+        }
+        return RenderTarget;
+    }
+
+    TSharedPtr<FJsonObject> MakeScreenshotData(TArray64<uint8>&& CompressedImage, const FIntPoint& ImageSize, const FMCPImageEncodeOptions& ImageOptions)
+    {
+        const int64 ImageBytes = CompressedImage.Num();
+
+        // Build response; the image is sent as raw bytes to clients that read attachments, as base64 to the rest
+        TSharedPtr<FJsonObject> ScreenshotData = MakeShareable(new FJsonObject);
+        ScreenshotData->SetBoolField(TEXT("success"), true);
+        ScreenshotData->SetField(TEXT("image_base64"), FMCPAttachments::MakeReference(MoveTemp(CompressedImage)));
+        ScreenshotData->SetNumberField(TEXT("width"), ImageSize.X);
+        ScreenshotData->SetNumberField(TEXT("height"), ImageSize.Y);
+        ScreenshotData->SetStringField(TEXT("format"), ImageOptions.GetExtension());
+        ScreenshotData->SetNumberField(TEXT("image_size_bytes"), static_cast<double>(ImageBytes));
+
+        UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Screenshot captured successfully, %lld bytes"),
+               ImageBytes);
+        return ScreenshotData;
+    }
+}
+
 bool FWidgetLayoutService::CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
-                                                   const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData)
+                                                   const FMCPImageEncodeOptions& ImageOptions, TSharedPtr<FJsonObject>& OutScreenshotData)
 {
-    if (!WidgetBlueprint)
+    FIntRect Region;
+    UTextureRenderTarget2D* RenderTarget = RenderWidget(WidgetBlueprint, Width, Height, ImageOptions, Region);
+    if (!RenderTarget)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Widget blueprint is null"));
         return false;
     }
 
-    UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Capturing screenshot for '%s' at %dx%d"),
-           *WidgetBlueprint->GetName(), Width, Height);
+    // Flush rendering commands to ensure texture is ready
+    FlushRenderingCommands();
 
-    // Verify the widget has a generated class
-    if (!WidgetBlueprint->GeneratedClass)
+    // Read pixels from render target
+    FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
+    TArray<FColor> OutPixels;
+    const bool bRead = RTResource && RTResource->ReadPixels(OutPixels, FReadSurfaceDataFlags(), Region);
+    FWidgetCaptureResources::Get().Release(RenderTarget);
+    if (!bRead)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Widget blueprint '%s' has no generated class"), *WidgetBlueprint->GetName());
+        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to read pixels from render target"));
         return false;
     }
 
-    // Get the editor world
-    UWorld* EditorWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-    if (!EditorWorld)
+    TArray64<uint8> CompressedImage;
+    FString EncodeError;
+    if (!FMCPImageEncoding::Encode(OutPixels, Region.Size(), ImageOptions, CompressedImage, EncodeError))
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - No editor world available"));
+        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - %s"), *EncodeError);
         return false;
     }
 
-    // Create a preview instance of the widget
-    UClass* GeneratedClass = WidgetBlueprint->GeneratedClass;
-    if (!GeneratedClass || !GeneratedClass->IsChildOf(UUserWidget::StaticClass()))
+    OutScreenshotData = MakeScreenshotData(MoveTemp(CompressedImage), Region.Size(), ImageOptions);
+    return true;
+}
+
+void FWidgetLayoutService::CaptureWidgetScreenshotAsync(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                                        const FMCPImageEncodeOptions& ImageOptions,
+                                                        TFunction<void(TSharedPtr<FJsonObject>)> OnCaptured)
+{
+    FIntRect Region;
+    UTextureRenderTarget2D* RenderTarget = RenderWidget(WidgetBlueprint, Width, Height, ImageOptions, Region);
+    if (!RenderTarget)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Invalid or incompatible generated class"));
-        return false;
+        OnCaptured(nullptr);
+        return;
     }
-    UUserWidget* PreviewWidget = CreateWidget<UUserWidget>(EditorWorld, GeneratedClass);
-    if (!PreviewWidget)
+
+    // The render already applied the scale; the readback only crops
+    FMCPImageEncodeOptions ReadbackOptions = ImageOptions;
+    ReadbackOptions.Region = Region;
+    ReadbackOptions.Scale = 1.0f;
+
+    FMCPViewportCapture::CaptureRenderTarget(RenderTarget, ReadbackOptions,
+        [RenderTarget, ReadbackOptions, OnCaptured = MoveTemp(OnCaptured)](const FMCPViewportCaptureResult& Result)
+        {
+            AsyncTask(ENamedThreads::GameThread, [RenderTarget]()
+            {
+                FWidgetCaptureResources::Get().Release(RenderTarget);
+            });
+
+            if (!Result.bSuccess)
+            {
+                UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - %s"), *Result.Error);
+                OnCaptured(nullptr);
+                return;
+            }
+            TArray64<uint8> EncodedData = Result.EncodedData;
+            OnCaptured(MakeScreenshotData(MoveTemp(EncodedData), Result.Size, ReadbackOptions));
+        });
+}
+
+namespace
+{
+    TArray<TSharedPtr<FJsonValue>> MakeVectorArray(const FVector2D& Vector)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to create widget preview instance"));
-        return false;
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Add(MakeShared<FJsonValueNumber>(Vector.X));
+        Array.Add(MakeShared<FJsonValueNumber>(Vector.Y));
+        return Array;
     }
 
-    // Get the Slate widget
-    TSharedPtr<SWidget> SlateWidget = PreviewWidget->TakeWidget();
-    if (!SlateWidget.IsValid())
+    /** Arrange a Slate widget and its descendants, recording the geometry each one gets */
+    void CollectArrangedGeometry(const TSharedRef<SWidget>& Widget, const FGeometry& Geometry,
+                                 TMap<const SWidget*, FGeometry>& OutGeometry)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to get Slate widget"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
-        return false;
+        OutGeometry.Add(&Widget.Get(), Geometry);
+
+        // Hidden widgets take up space, so they are arranged with the rest
+        FArrangedChildren ArrangedChildren(EVisibility::All);
+        Widget->ArrangeChildren(Geometry, ArrangedChildren);
+        for (int32 Index = 0; Index < ArrangedChildren.Num(); ++Index)
+        {
+            const FArrangedWidget& Child = ArrangedChildren[Index];
+            CollectArrangedGeometry(Child.Widget, Child.Geometry, OutGeometry);
+        }
     }
 
-    // Create render target
-    UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>();
-    RenderTarget->InitCustomFormat(Width, Height, PF_B8G8R8A8, true);
-    RenderTarget->UpdateResourceImmediate(true);
+    /**
+     * Measured layout of a preview widget and its children
+     * @param MaxDepth Levels below Widget to include; INDEX_NONE for every level
+     */
+    TSharedPtr<FJsonObject> BuildMeasuredWidget(UWidget* Widget, const TMap<const SWidget*, FGeometry>& Geometry, int32 MaxDepth)
+    {
+        TSharedPtr<FJsonObject> WidgetInfo = MakeShared<FJsonObject>();
+        WidgetInfo->SetStringField(TEXT("name"), Widget->GetName());
+        WidgetInfo->SetStringField(TEXT("type"), Widget->GetClass()->GetName());
+        WidgetInfo->SetStringField(TEXT("visibility"), UEnum::GetValueAsString(Widget->GetVisibility()));
+
+        // Collapsed widgets and the inactive pages of switchers are never arranged
+        const TSharedPtr<SWidget> SlateWidget = Widget->GetCachedWidget();
+        const FGeometry* WidgetGeometry = SlateWidget.IsValid() ? Geometry.Find(SlateWidget.Get()) : nullptr;
+        if (SlateWidget.IsValid())
+        {
+            WidgetInfo->SetArrayField(TEXT("desired_size"), MakeVectorArray(FVector2D(SlateWidget->GetDesiredSize())));
+        }
+        WidgetInfo->SetBoolField(TEXT("arranged"), WidgetGeometry != nullptr);
+        if (WidgetGeometry)
+        {
+            WidgetInfo->SetArrayField(TEXT("position"), MakeVectorArray(FVector2D(WidgetGeometry->GetAbsolutePosition())));
+            WidgetInfo->SetArrayField(TEXT("size"), MakeVectorArray(FVector2D(WidgetGeometry->GetAbsoluteSize())));
+        }
 
-    // Render widget to texture
-    FWidgetRenderer WidgetRenderer(true, false);
-    WidgetRenderer.DrawWidget(
-        RenderTarget,
-        SlateWidget.ToSharedRef(),
-        FVector2D(Width, Height),
-        0.0f);
+        if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
+        {
+            if (MaxDepth == 0)
+            {
+                WidgetInfo->SetNumberField(TEXT("child_count"), PanelWidget->GetChildrenCount());
+                WidgetInfo->SetBoolField(TEXT("children_truncated"), true);
+                return WidgetInfo;
+            }
 
-    // Flush rendering commands to ensure texture is ready
-    FlushRenderingCommands();
+            TArray<TSharedPtr<FJsonValue>> ChildrenArray;
+            for (int32 Index = 0; Index < PanelWidget->GetChildrenCount(); ++Index)
+            {
+                if (UWidget* ChildWidget = PanelWidget->GetChildAt(Index))
+                {
+                    const int32 ChildDepth = MaxDepth == INDEX_NONE ? INDEX_NONE : MaxDepth - 1;
+                    ChildrenArray.Add(MakeShared<FJsonValueObject>(BuildMeasuredWidget(ChildWidget, Geometry, ChildDepth)));
+                }
+            }
+            WidgetInfo->SetArrayField(TEXT("children"), ChildrenArray);
+        }
 
-    // Read pixels from render target
-    FTextureRenderTargetResource* RTResource = RenderTarget->GameThread_GetRenderTargetResource();
-    if (!RTResource)
+        return WidgetInfo;
+    }
+}
+
+bool FWidgetLayoutService::MeasureWidgetLayout(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                               const FString& RootWidget, int32 MaxDepth, TSharedPtr<FJsonObject>& OutLayoutInfo)
+{
+    if (!WidgetBlueprint)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to get render target resource"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
+        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::MeasureWidgetLayout - Widget blueprint is null"));
         return false;
     }
 
-    TArray<FColor> OutPixels;
-    if (!RTResource->ReadPixels(OutPixels))
+    TSharedPtr<SWidget> SlateWidget;
+    UUserWidget* PreviewWidget = CreatePreviewWidget(WidgetBlueprint, TEXT("MeasureWidgetLayout"), SlateWidget);
+    if (!PreviewWidget)
     {
-        UE_LOG(LogTemp, Error, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Failed to read pixels from render target"));
-        PreviewWidget->RemoveFromParent();
-        PreviewWidget->MarkAsGarbage();
         return false;
     }
 
-    // Compress to PNG or JPEG
-    TArray<uint8> CompressedImage;
-    FString ActualFormat = Format.ToLower();
+    // Desired sizes come from the prepass and geometry from arranging the tree over the layout
+    // size, as a paint would do it; nothing is drawn or read back
+    SlateWidget->SlatePrepass(1.0f);
+    TMap<const SWidget*, FGeometry> Geometry;
+    CollectArrangedGeometry(SlateWidget.ToSharedRef(), FGeometry::MakeRoot(FVector2D(Width, Height), FSlateLayoutTransform()), Geometry);
+
+    // The whole tree is laid out; the report may start further down
+    UWidget* QueryRoot = nullptr;
+    if (PreviewWidget->WidgetTree)
+    {
+        QueryRoot = RootWidget.IsEmpty()
+            ? PreviewWidget->WidgetTree->RootWidget.Get()
+            : PreviewWidget->WidgetTree->FindWidget(FName(*RootWidget));
+    }
 
-    if (ActualFormat == TEXT("jpg") || ActualFormat == TEXT("jpeg"))
+    OutLayoutInfo = MakeShared<FJsonObject>();
+    OutLayoutInfo->SetNumberField(TEXT("width"), Width);
+    OutLayoutInfo->SetNumberField(TEXT("height"), Height);
+    if (QueryRoot)
     {
-        // JPEG compression - use thumbnail compression for JPEG
-        FImageUtils::ThumbnailCompressImageArray(Width, Height, OutPixels, CompressedImage);
+        OutLayoutInfo->SetObjectField(TEXT("root"), BuildMeasuredWidget(QueryRoot, Geometry, MaxDepth));
     }
     else
     {
-        // PNG compression (default)
-        ActualFormat = TEXT("png");
-        TArray64<uint8> CompressedImage64;
-        FImageUtils::PNGCompressImageArray(Width, Height, TArrayView64<const FColor>(OutPixels), CompressedImage64);
-        // Convert from TArray64 to TArray
-        CompressedImage.Append(CompressedImage64.GetData(), CompressedImage64.Num());
+        OutLayoutInfo->SetStringField(TEXT("message"), TEXT("No root widget"));
     }
 
-    // Encode as base64
-    FString Base64Image = FBase64::Encode(CompressedImage);
-
-    // Build response
-    OutScreenshotData = MakeShareable(new FJsonObject);
-    OutScreenshotData->SetBoolField(TEXT("success"), true);
-    OutScreenshotData->SetStringField(TEXT("image_base64"), Base64Image);
-    OutScreenshotData->SetNumberField(TEXT("width"), Width);
-    OutScreenshotData->SetNumberField(TEXT("height"), Height);
-    OutScreenshotData->SetStringField(TEXT("format"), ActualFormat);
-    OutScreenshotData->SetNumberField(TEXT("image_size_bytes"), CompressedImage.Num());
-
-    // Clean up
     PreviewWidget->RemoveFromParent();
     PreviewWidget->MarkAsGarbage();
-    RenderTarget->MarkAsGarbage();
-
-    UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::CaptureWidgetScreenshot - Screenshot captured successfully, %d bytes"),
-           CompressedImage.Num());
 
+    UE_LOG(LogTemp, Log, TEXT("WidgetLayoutService::MeasureWidgetLayout - Measured %d Slate widgets of '%s' at %dx%d"),
+           Geometry.Num(), *WidgetBlueprint->GetName(), Width, Height);
     return true;
 }
@@ -1,5 +1,6 @@
 #include "Services/UMG/WidgetMetadataBuilderService.h"
 #include "Services/UMG/IUMGService.h"
+#include "Services/UMG/WidgetLayoutService.h"
 #include "Utils/GraphUtils.h"
 #include "WidgetBlueprint.h"
 #include "Blueprint/WidgetTree.h"
@@ -20,21 +21,121 @@
 #include "K2Node_Event.h"
 #include "K2Node_FunctionEntry.h"
 
+namespace
+{
+    /** Levels left below a child of a widget that had MaxDepth levels left */
+    int32 ChildDepth(int32 MaxDepth)
+    {
+        return MaxDepth == INDEX_NONE ? INDEX_NONE : MaxDepth - 1;
+    }
+
+    /** Stand-in for children a query's depth left out: their number, so the caller can query further down */
+    void SetTruncatedChildren(const TSharedPtr<FJsonObject>& WidgetObj, const UPanelWidget* PanelWidget)
+    {
+        WidgetObj->SetNumberField(TEXT("child_count"), PanelWidget->GetChildrenCount());
+        WidgetObj->SetBoolField(TEXT("children_truncated"), true);
+    }
+}
+
 FWidgetMetadataBuilderService::FWidgetMetadataBuilderService(TSharedPtr<IUMGService> InUMGService)
     : UMGService(InUMGService)
 {
 }
 
-TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildComponentsInfo(UWidgetBlueprint* WidgetBlueprint) const
+UWidget* FWidgetMetadataBuilderService::FindQueryRoot(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const
+{
+    if (!WidgetBlueprint || !WidgetBlueprint->WidgetTree)
+    {
+        return nullptr;
+    }
+    return Query.RootWidget.IsEmpty()
+        ? WidgetBlueprint->WidgetTree->RootWidget
+        : WidgetBlueprint->WidgetTree->FindWidget(FName(*Query.RootWidget));
+}
+
+void FWidgetMetadataBuilderService::ProjectSection(const TSharedPtr<FJsonObject>& Section, const TArray<FString>& Keys)
+{
+    if (!Section.IsValid() || Keys.Num() == 0)
+    {
+        return;
+    }
+
+    // Tree entries keep their children, which are projected in turn
+    TFunction<void(const TSharedPtr<FJsonObject>&)> ProjectEntry;
+    ProjectEntry = [&Keys, &ProjectEntry](const TSharedPtr<FJsonObject>& Entry)
+    {
+        TArray<FString> EntryKeys;
+        Entry->Values.GetKeys(EntryKeys);
+        for (const FString& Key : EntryKeys)
+        {
+            if (Key == TEXT("children"))
+            {
+                for (const TSharedPtr<FJsonValue>& Child : Entry->Values[Key]->AsArray())
+                {
+                    if (Child.IsValid() && Child->Type == EJson::Object)
+                    {
+                        ProjectEntry(Child->AsObject());
+                    }
+                }
+            }
+            else if (!Keys.Contains(Key))
+            {
+                Entry->RemoveField(Key);
+            }
+        }
+    };
+
+    // Entries are the objects of the section's lists and its tree root
+    bool bHasEntries = false;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Section->Values)
+    {
+        if (!Field.Value.IsValid())
+        {
+            continue;
+        }
+        if (Field.Value->Type == EJson::Array)
+        {
+            bHasEntries = true;
+            for (const TSharedPtr<FJsonValue>& Element : Field.Value->AsArray())
+            {
+                if (Element.IsValid() && Element->Type == EJson::Object)
+                {
+                    ProjectEntry(Element->AsObject());
+                }
+            }
+        }
+        else if (Field.Value->Type == EJson::Object)
+        {
+            bHasEntries = true;
+            ProjectEntry(Field.Value->AsObject());
+        }
+    }
+
+    // Sections without entries (dimensions) are projected on their own keys
+    if (!bHasEntries)
+    {
+        TArray<FString> SectionKeys;
+        Section->Values.GetKeys(SectionKeys);
+        for (const FString& Key : SectionKeys)
+        {
+            if (!Keys.Contains(Key))
+            {
+                Section->RemoveField(Key);
+            }
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildComponentsInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const
 {
     TSharedPtr<FJsonObject> ComponentsInfo = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> ComponentsList;
 
-    // Collect all widgets
+    // Collect the widgets the query covers
     TArray<UWidget*> AllWidgets;
-    if (WidgetBlueprint->WidgetTree->RootWidget)
+    if (UWidget* QueryRoot = FindQueryRoot(WidgetBlueprint, Query))
     {
-        CollectAllWidgets(WidgetBlueprint->WidgetTree->RootWidget, AllWidgets);
+        CollectAllWidgets(QueryRoot, AllWidgets, Query.MaxDepth);
     }
 
     for (UWidget* Widget : AllWidgets)
@@ -66,22 +167,27 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildComponentsInfo(UWidg
 
     ComponentsInfo->SetArrayField(TEXT("components"), ComponentsList);
     ComponentsInfo->SetNumberField(TEXT("count"), ComponentsList.Num());
+    if (!Query.RootWidget.IsEmpty())
+    {
+        ComponentsInfo->SetStringField(TEXT("root_widget"), Query.RootWidget);
+    }
 
     return ComponentsInfo;
 }
 
-TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildLayoutInfo(UWidgetBlueprint* WidgetBlueprint) const
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildLayoutInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const
 {
     TSharedPtr<FJsonObject> LayoutInfo = MakeShared<FJsonObject>();
 
-    if (!WidgetBlueprint->WidgetTree->RootWidget)
+    UWidget* QueryRoot = FindQueryRoot(WidgetBlueprint, Query);
+    if (!QueryRoot)
     {
         LayoutInfo->SetStringField(TEXT("message"), TEXT("No root widget"));
         return LayoutInfo;
     }
 
     // Build hierarchical layout (reuse service's BuildWidgetHierarchy logic)
-    TSharedPtr<FJsonObject> HierarchyData = BuildWidgetInfo(WidgetBlueprint->WidgetTree->RootWidget);
+    TSharedPtr<FJsonObject> HierarchyData = BuildWidgetInfo(QueryRoot, Query.MaxDepth);
     if (HierarchyData.IsValid())
     {
         LayoutInfo->SetObjectField(TEXT("root"), HierarchyData);
@@ -131,18 +237,30 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildDimensionsInfo(UWidg
     return DimensionsInfo;
 }
 
-TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildHierarchyInfo(UWidgetBlueprint* WidgetBlueprint) const
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildMeasuredLayoutInfo(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height, const FWidgetTreeQuery& Query) const
+{
+    TSharedPtr<FJsonObject> MeasuredInfo;
+    if (!FWidgetLayoutService::MeasureWidgetLayout(WidgetBlueprint, Width, Height, Query.RootWidget, Query.MaxDepth, MeasuredInfo))
+    {
+        MeasuredInfo = MakeShared<FJsonObject>();
+        MeasuredInfo->SetStringField(TEXT("error"), TEXT("Failed to create a preview instance of the widget to measure"));
+    }
+    return MeasuredInfo;
+}
+
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildHierarchyInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const
 {
     TSharedPtr<FJsonObject> HierarchyInfo = MakeShared<FJsonObject>();
 
-    if (!WidgetBlueprint->WidgetTree->RootWidget)
+    UWidget* QueryRoot = FindQueryRoot(WidgetBlueprint, Query);
+    if (!QueryRoot)
     {
         HierarchyInfo->SetStringField(TEXT("message"), TEXT("No root widget"));
         return HierarchyInfo;
     }
 
     // Build simple hierarchy tree (names and types only, for quick overview)
-    TFunction<TSharedPtr<FJsonObject>(UWidget*)> BuildSimpleHierarchy = [&](UWidget* Widget) -> TSharedPtr<FJsonObject>
+    TFunction<TSharedPtr<FJsonObject>(UWidget*, int32)> BuildSimpleHierarchy = [&](UWidget* Widget, int32 MaxDepth) -> TSharedPtr<FJsonObject>
     {
         TSharedPtr<FJsonObject> WidgetObj = MakeShared<FJsonObject>();
         WidgetObj->SetStringField(TEXT("name"), Widget->GetName());
@@ -150,12 +268,18 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildHierarchyInfo(UWidge
 
         if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
         {
+            if (MaxDepth == 0)
+            {
+                SetTruncatedChildren(WidgetObj, PanelWidget);
+                return WidgetObj;
+            }
+
             TArray<TSharedPtr<FJsonValue>> ChildrenArray;
             for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
             {
                 if (UWidget* ChildWidget = PanelWidget->GetChildAt(i))
                 {
-                    TSharedPtr<FJsonObject> ChildObj = BuildSimpleHierarchy(ChildWidget);
+                    TSharedPtr<FJsonObject> ChildObj = BuildSimpleHierarchy(ChildWidget, ChildDepth(MaxDepth));
                     if (ChildObj.IsValid())
                     {
                         ChildrenArray.Add(MakeShared<FJsonValueObject>(ChildObj));
@@ -168,7 +292,7 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildHierarchyInfo(UWidge
         return WidgetObj;
     };
 
-    TSharedPtr<FJsonObject> RootHierarchy = BuildSimpleHierarchy(WidgetBlueprint->WidgetTree->RootWidget);
+    TSharedPtr<FJsonObject> RootHierarchy = BuildSimpleHierarchy(QueryRoot, Query.MaxDepth);
     if (RootHierarchy.IsValid())
     {
         HierarchyInfo->SetObjectField(TEXT("root"), RootHierarchy);
@@ -177,13 +301,33 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildHierarchyInfo(UWidge
     return HierarchyInfo;
 }
 
-TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildBindingsInfo(UWidgetBlueprint* WidgetBlueprint) const
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildBindingsInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const
 {
     TSharedPtr<FJsonObject> BindingsInfo = MakeShared<FJsonObject>();
     TArray<TSharedPtr<FJsonValue>> BindingsList;
 
+    // A subtree query reports only the bindings of the widgets it covers
+    TSet<FString> CoveredWidgets;
+    if (Query.IsSubtree())
+    {
+        TArray<UWidget*> Widgets;
+        if (UWidget* QueryRoot = FindQueryRoot(WidgetBlueprint, Query))
+        {
+            CollectAllWidgets(QueryRoot, Widgets, Query.MaxDepth);
+        }
+        for (const UWidget* Widget : Widgets)
+        {
+            CoveredWidgets.Add(Widget->GetName());
+        }
+    }
+
     for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
     {
+        if (Query.IsSubtree() && !CoveredWidgets.Contains(Binding.ObjectName))
+        {
+            continue;
+        }
+
         TSharedPtr<FJsonObject> BindingObj = MakeShared<FJsonObject>();
         BindingObj->SetStringField(TEXT("widget_name"), Binding.ObjectName);
         BindingObj->SetStringField(TEXT("property_name"), Binding.PropertyName.ToString());
@@ -494,7 +638,7 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildGraphWarningsInfo(UW
     return WarningsInfo;
 }
 
-void FWidgetMetadataBuilderService::CollectAllWidgets(UWidget* Widget, TArray<UWidget*>& OutWidgets) const
+void FWidgetMetadataBuilderService::CollectAllWidgets(UWidget* Widget, TArray<UWidget*>& OutWidgets, int32 MaxDepth) const
 {
     if (!Widget)
     {
@@ -503,16 +647,17 @@ void FWidgetMetadataBuilderService::CollectAllWidgets(UWidget* Widget, TArray<UW
 
     OutWidgets.Add(Widget);
 
-    if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
+    UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget);
+    if (PanelWidget && MaxDepth != 0)
     {
         for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
         {
-            CollectAllWidgets(PanelWidget->GetChildAt(i), OutWidgets);
+            CollectAllWidgets(PanelWidget->GetChildAt(i), OutWidgets, ChildDepth(MaxDepth));
         }
     }
 }
 
-TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildWidgetInfo(UWidget* Widget) const
+TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildWidgetInfo(UWidget* Widget, int32 MaxDepth) const
 {
     if (!Widget)
     {
@@ -625,12 +770,18 @@ TSharedPtr<FJsonObject> FWidgetMetadataBuilderService::BuildWidgetInfo(UWidget*
     // Children (for panel widgets)
     if (UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
     {
+        if (MaxDepth == 0)
+        {
+            SetTruncatedChildren(WidgetInfo, PanelWidget);
+            return WidgetInfo;
+        }
+
         TArray<TSharedPtr<FJsonValue>> ChildrenArray;
         for (int32 i = 0; i < PanelWidget->GetChildrenCount(); ++i)
         {
             if (UWidget* ChildWidget = PanelWidget->GetChildAt(i))
             {
-                TSharedPtr<FJsonObject> ChildInfo = BuildWidgetInfo(ChildWidget);
+                TSharedPtr<FJsonObject> ChildInfo = BuildWidgetInfo(ChildWidget, ChildDepth(MaxDepth));
                 if (ChildInfo.IsValid())
                 {
                     ChildrenArray.Add(MakeShared<FJsonValueObject>(ChildInfo));
@@ -0,0 +1,228 @@
+#include "Services/UMG/WidgetValidationCache.h"
+#include "Utils/UnrealMCPCommonUtils.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "Editor.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** Whether a cached blueprint is still the one a name refers to */
+    bool StillNamed(const UWidgetBlueprint* WidgetBlueprint, const FString& BlueprintName)
+    {
+        return BlueprintName.Equals(WidgetBlueprint->GetName(), ESearchCase::IgnoreCase)
+            || BlueprintName.Equals(WidgetBlueprint->GetPathName(), ESearchCase::IgnoreCase)
+            || BlueprintName.Equals(WidgetBlueprint->GetOutermost()->GetName(), ESearchCase::IgnoreCase);
+    }
+
+    void CollectComponentNames(const UWidgetBlueprint* WidgetBlueprint, TSet<FName>& OutNames)
+    {
+        if (!WidgetBlueprint->WidgetTree)
+        {
+            return;
+        }
+        WidgetBlueprint->WidgetTree->ForEachWidget([&OutNames](UWidget* Widget)
+        {
+            OutNames.Add(Widget->GetFName());
+        });
+    }
+}
+
+FWidgetValidationCache& FWidgetValidationCache::Get()
+{
+    static FWidgetValidationCache Instance;
+    return Instance;
+}
+
+void FWidgetValidationCache::Initialize()
+{
+    check(IsInGameThread());
+    if (bInitialized)
+    {
+        return;
+    }
+
+    ObjectModifiedHandle = FCoreUObjectDelegates::OnObjectModified.AddRaw(this, &FWidgetValidationCache::HandleObjectModified);
+    ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddRaw(this, &FWidgetValidationCache::HandleObjectPropertyChanged);
+    UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddRaw(this, &FWidgetValidationCache::HandleUndoRedo);
+    ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FWidgetValidationCache::HandleReloadComplete);
+    bInitialized = true;
+
+    FMCPCacheStatsRegistry::Get().Register(TEXT("widget_validation_cache"), TEXT("cache"), CacheCounters,
+        [this]() { return static_cast<int64>(ResolvedBlueprints.Num() + ComponentNames.Num() + ClassMembers.Num()); });
+}
+
+void FWidgetValidationCache::Shutdown()
+{
+    check(IsInGameThread());
+    if (!bInitialized)
+    {
+        return;
+    }
+
+    FCoreUObjectDelegates::OnObjectModified.Remove(ObjectModifiedHandle);
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(UndoRedoHandle);
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+    ObjectModifiedHandle.Reset();
+    ObjectPropertyChangedHandle.Reset();
+    UndoRedoHandle.Reset();
+    ReloadCompleteHandle.Reset();
+    bInitialized = false;
+    FMCPCacheStatsRegistry::Get().Unregister(TEXT("widget_validation_cache"));
+
+    ResolvedBlueprints.Empty();
+    ComponentNames.Empty();
+    ClassMembers.Empty();
+}
+
+UWidgetBlueprint* FWidgetValidationCache::FindWidgetBlueprint(const FString& BlueprintName)
+{
+    check(IsInGameThread());
+
+    if (const TWeakObjectPtr<UWidgetBlueprint>* Resolved = ResolvedBlueprints.Find(BlueprintName))
+    {
+        UWidgetBlueprint* WidgetBlueprint = Resolved->Get();
+        if (WidgetBlueprint && StillNamed(WidgetBlueprint, BlueprintName))
+        {
+            CacheCounters.RecordHit();
+            return WidgetBlueprint;
+        }
+        ResolvedBlueprints.Remove(BlueprintName);
+        CacheCounters.RecordInvalidation();
+    }
+    CacheCounters.RecordMiss();
+
+    // Misses are not kept: the blueprint may be created by the next command
+    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(FUnrealMCPCommonUtils::FindWidgetBlueprint(BlueprintName));
+    if (WidgetBlueprint && bInitialized)
+    {
+        ResolvedBlueprints.Add(BlueprintName, WidgetBlueprint);
+    }
+    return WidgetBlueprint;
+}
+
+bool FWidgetValidationCache::HasComponent(const UWidgetBlueprint* WidgetBlueprint, const FString& ComponentName)
+{
+    check(IsInGameThread());
+    if (!WidgetBlueprint)
+    {
+        return false;
+    }
+
+    // Without the change handlers a cached tree could go stale unnoticed
+    if (!bInitialized)
+    {
+        return WidgetBlueprint->WidgetTree && WidgetBlueprint->WidgetTree->FindWidget(FName(*ComponentName)) != nullptr;
+    }
+
+    TSet<FName>* Names = ComponentNames.Find(WidgetBlueprint);
+    if (Names)
+    {
+        CacheCounters.RecordHit();
+    }
+    else
+    {
+        CacheCounters.RecordMiss();
+        Names = &ComponentNames.Add(WidgetBlueprint);
+        CollectComponentNames(WidgetBlueprint, *Names);
+    }
+    return Names->Contains(FName(*ComponentName));
+}
+
+bool FWidgetValidationCache::HasProperty(const UClass* WidgetClass, const FString& PropertyName)
+{
+    return WidgetClass && GetClassMembers(WidgetClass).Properties.Contains(FName(*PropertyName));
+}
+
+bool FWidgetValidationCache::HasEvent(const UClass* WidgetClass, const FString& EventName)
+{
+    return WidgetClass && GetClassMembers(WidgetClass).Events.Contains(FName(*EventName));
+}
+
+void FWidgetValidationCache::Invalidate(const UBlueprint* Blueprint)
+{
+    if (!Blueprint || !IsInGameThread())
+    {
+        return;
+    }
+
+    for (auto It = ComponentNames.CreateIterator(); It; ++It)
+    {
+        const UWidgetBlueprint* CachedBlueprint = It.Key().Get();
+        if (!CachedBlueprint || CachedBlueprint == Blueprint)
+        {
+            It.RemoveCurrent();
+            CacheCounters.RecordInvalidation();
+        }
+    }
+}
+
+const FWidgetValidationCache::FClassMembers& FWidgetValidationCache::GetClassMembers(const UClass* WidgetClass)
+{
+    check(IsInGameThread());
+
+    FClassMembers* Members = bInitialized ? ClassMembers.Find(WidgetClass) : nullptr;
+    if (Members)
+    {
+        CacheCounters.RecordHit();
+        return *Members;
+    }
+    CacheCounters.RecordMiss();
+
+    Members = bInitialized ? &ClassMembers.Add(WidgetClass) : &UncachedMembers;
+    Members->Properties.Reset();
+    Members->Events.Reset();
+    for (TFieldIterator<FProperty> It(WidgetClass, EFieldIteratorFlags::IncludeSuper); It; ++It)
+    {
+        Members->Properties.Add(It->GetFName());
+        if (CastField<FMulticastDelegateProperty>(*It))
+        {
+            Members->Events.Add(It->GetFName());
+        }
+    }
+    return *Members;
+}
+
+void FWidgetValidationCache::HandleObjectModified(UObject* Object)
+{
+    if (ComponentNames.Num() == 0 || !Object)
+    {
+        return;
+    }
+
+    // Designer edits modify the widget or the tree; MCP edits usually the blueprint
+    const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Object);
+    if (!WidgetBlueprint && (Object->IsA<UWidget>() || Object->IsA<UWidgetTree>()))
+    {
+        WidgetBlueprint = Object->GetTypedOuter<UWidgetBlueprint>();
+    }
+    if (WidgetBlueprint && ComponentNames.Remove(WidgetBlueprint) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FWidgetValidationCache::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
+{
+    // FBlueprintEditorUtils::MarkBlueprintAsModified ends in PostEditChangeProperty
+    const UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Object);
+    if (WidgetBlueprint && ComponentNames.Remove(WidgetBlueprint) > 0)
+    {
+        CacheCounters.RecordInvalidation();
+    }
+}
+
+void FWidgetValidationCache::HandleUndoRedo()
+{
+    ComponentNames.Empty();
+    CacheCounters.RecordInvalidation();
+}
+
+void FWidgetValidationCache::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+    // Reloaded code replaces classes and the properties they declare
+    ClassMembers.Empty();
+    CacheCounters.RecordInvalidation();
+}
@@ -1,5 +1,5 @@
 #include "Services/UMG/WidgetValidationService.h"
-#include "Utils/UnrealMCPCommonUtils.h"
+#include "Services/UMG/WidgetValidationCache.h"
 #include "WidgetBlueprint.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/Widget.h"
@@ -605,17 +605,13 @@ FWidgetValidationResult FWidgetValidationService::ValidateSize(const FVector2D&
 
 bool FWidgetValidationService::DoesWidgetBlueprintExist(const FString& BlueprintName) const
 {
-    // Use the centralized FindWidgetBlueprint utility
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindWidgetBlueprint(BlueprintName);
-    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Blueprint);
-    return WidgetBlueprint != nullptr;
+    return FWidgetValidationCache::Get().FindWidgetBlueprint(BlueprintName) != nullptr;
 }
 
 bool FWidgetValidationService::DoesWidgetComponentExist(const FString& BlueprintName, const FString& ComponentName) const
 {
-    // Use the centralized FindWidgetBlueprint utility
-    UBlueprint* Blueprint = FUnrealMCPCommonUtils::FindWidgetBlueprint(BlueprintName);
-    UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(Blueprint);
+    FWidgetValidationCache& Cache = FWidgetValidationCache::Get();
+    UWidgetBlueprint* WidgetBlueprint = Cache.FindWidgetBlueprint(BlueprintName);
     
     if (!WidgetBlueprint)
     {
@@ -629,15 +625,7 @@ bool FWidgetValidationService::DoesWidgetComponentExist(const FString& Blueprint
         return false;
     }
     
-    UWidget* Widget = WidgetBlueprint->WidgetTree->FindWidget(FName(*ComponentName));
-    
-    if (!Widget)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("WidgetValidationService: Component '%s' not found in blueprint '%s'"), 
-               *ComponentName, *BlueprintName);
-    }
-    
-    return Widget != nullptr;
+    return Cache.HasComponent(WidgetBlueprint, ComponentName);
 }
 
 UClass* FWidgetValidationService::GetWidgetClass(const FString& ComponentType) const
@@ -693,23 +681,10 @@ UClass* FWidgetValidationService::GetWidgetClass(const FString& ComponentType) c
 
 bool FWidgetValidationService::DoesPropertyExist(UClass* WidgetClass, const FString& PropertyName) const
 {
-    if (!WidgetClass)
-    {
-        return false;
-    }
-
-    FProperty* Property = WidgetClass->FindPropertyByName(FName(*PropertyName));
-    return Property != nullptr;
+    return FWidgetValidationCache::Get().HasProperty(WidgetClass, PropertyName);
 }
 
 bool FWidgetValidationService::DoesEventExist(UClass* WidgetClass, const FString& EventName) const
 {
-    if (!WidgetClass)
-    {
-        return false;
-    }
-
-    FProperty* Property = WidgetClass->FindPropertyByName(FName(*EventName));
-    FMulticastDelegateProperty* DelegateProperty = CastField<FMulticastDelegateProperty>(Property);
-    return DelegateProperty != nullptr;
+    return FWidgetValidationCache::Get().HasEvent(WidgetClass, EventName);
 }
@@ -0,0 +1,110 @@
+#include "CoreMinimal.h"
+#include "MCPCborCodec.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+/**
+ * Test suite for FMCPCborCodec
+ * Verifies JSON object round trips and rejection of malformed documents
+ */
+namespace CborCodecTests
+{
+    static void Check(bool bCondition, const TCHAR* Description)
+    {
+        if (bCondition)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("✓ %s"), Description);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("✗ %s"), Description);
+        }
+    }
+
+    /**
+     * A request with nested params, integers, floats and unicode text survives an encode/decode round trip
+     */
+    void TestRoundTrip()
+    {
+        TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+        TArray<TSharedPtr<FJsonValue>> Location;
+        Location.Add(MakeShared<FJsonValueNumber>(100.0));
+        Location.Add(MakeShared<FJsonValueNumber>(-250.5));
+        Location.Add(MakeShared<FJsonValueNumber>(1.0e12));
+        Params->SetArrayField(TEXT("location"), Location);
+        Params->SetStringField(TEXT("name"), TEXT("Actor_é中"));
+        Params->SetBoolField(TEXT("visible"), true);
+        Params->SetField(TEXT("parent"), MakeShared<FJsonValueNull>());
+
+        TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+        Request->SetStringField(TEXT("type"), TEXT("spawn_actor"));
+        Request->SetObjectField(TEXT("params"), Params);
+
+        TArray<uint8> Bytes;
+        FMCPCborCodec::Encode(Request, Bytes);
+
+        FString Error;
+        TSharedPtr<FJsonObject> Decoded = FMCPCborCodec::Decode(Bytes.GetData(), Bytes.Num(), Error);
+        Check(Decoded.IsValid(), TEXT("Encoded request decodes"));
+        if (!Decoded.IsValid())
+        {
+            return;
+        }
+
+        const TSharedPtr<FJsonObject>* DecodedParams = nullptr;
+        Check(Decoded->GetStringField(TEXT("type")) == TEXT("spawn_actor"), TEXT("String field round-trips"));
+        Check(Decoded->TryGetObjectField(TEXT("params"), DecodedParams), TEXT("Nested object round-trips"));
+        if (DecodedParams)
+        {
+            const TArray<TSharedPtr<FJsonValue>>& DecodedLocation = (*DecodedParams)->GetArrayField(TEXT("location"));
+            Check(DecodedLocation.Num() == 3 && DecodedLocation[1]->AsNumber() == -250.5 && DecodedLocation[2]->AsNumber() == 1.0e12,
+                  TEXT("Integers and floats round-trip exactly"));
+            Check((*DecodedParams)->GetStringField(TEXT("name")) == TEXT("Actor_é中"), TEXT("Unicode text round-trips"));
+            Check((*DecodedParams)->GetBoolField(TEXT("visible")), TEXT("Booleans round-trip"));
+            Check((*DecodedParams)->HasTypedField<EJson::Null>(TEXT("parent")), TEXT("Null round-trips"));
+        }
+    }
+
+    /**
+     * Truncated documents and bogus container sizes are rejected without reading past the buffer
+     */
+    void TestMalformedRejected()
+    {
+        TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+        Request->SetStringField(TEXT("type"), TEXT("get_level_metadata"));
+
+        TArray<uint8> Bytes;
+        FMCPCborCodec::Encode(Request, Bytes);
+
+        FString Error;
+        Check(!FMCPCborCodec::Decode(Bytes.GetData(), Bytes.Num() - 3, Error).IsValid(), TEXT("Truncated document rejected"));
+
+        // Map header announcing 2^32 entries in a five byte document
+        const uint8 HugeMap[] = { 0xBA, 0xFF, 0xFF, 0xFF, 0xFF };
+        Check(!FMCPCborCodec::Decode(HugeMap, sizeof(HugeMap), Error).IsValid(), TEXT("Oversized map count rejected"));
+
+        const uint8 NotAMap[] = { 0x83, 0x01, 0x02, 0x03 };
+        Check(!FMCPCborCodec::Decode(NotAMap, sizeof(NotAMap), Error).IsValid(), TEXT("Top-level array rejected"));
+    }
+
+    /**
+     * Run all CBOR codec tests
+     */
+    void RunAllTests()
+    {
+        UE_LOG(LogTemp, Warning, TEXT("=== CBOR Codec Tests Started ==="));
+
+        TestRoundTrip();
+        TestMalformedRejected();
+
+        UE_LOG(LogTemp, Warning, TEXT("=== CBOR Codec Tests Completed ==="));
+    }
+}
+
+/**
+ * Main test function to run all CBOR codec tests
+ */
+void TestCborCodec()
+{
+    CborCodecTests::RunAllTests();
+}
@@ -1,217 +1,415 @@
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
 #include "Commands/UnrealMCPMainDispatcher.h"
-#include "HAL/RunnableThread.h"
-#include "HAL/Runnable.h"
-#include "Dom/JsonObject.h"
-#include "Misc/DateTime.h"
+#include "MCPMessageFraming.h"
+#include "MCPMetrics.h"
+#include "MCPLogging.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
 #include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/**
+ * Settings of one load test run, parsed from the mcp.LoadTest arguments
+ */
+struct FMCPLoadTestSettings
+{
+    /** Requests sent in total across all clients */
+    int32 Requests = 1000;
+    /** Clients sending at the same time, each on its own thread and connection */
+    int32 Concurrency = 8;
+    /** Share of requests that edit the level (spawn/delete actors); the rest only read */
+    int32 MutatePercent = 10;
+    /** Reuse one connection per client; otherwise every request opens and closes its own */
+    bool bKeepAlive = true;
+    int32 Port = 55557;
+    /** Longest wait for one response before the connection is given up */
+    double TimeoutSeconds = 30.0;
+};
 
 /**
- * Load test runner for testing concurrent command execution
+ * Load test that drives the MCP TCP bridge like real clients do
+ *
+ * Every client connects to the bridge's socket, sends length-prefixed requests and waits for each
+ * response, so requests go through framing, admission, the scheduler and the game thread exactly as
+ * they do for the Python server. The clients run on their own threads and never block the game
+ * thread, which stays free to execute the commands they send.
+ *
+ * Reads cycle through ping, get_level_metadata and search_assets; mutations spawn a StaticMeshActor
+ * and delete it again with the client's next mutation, so the level ends up as it started. Latency
+ * is measured around each request/response exchange.
  */
-class FMCPLoadTestRunner : public FRunnable
+class FMCPLoadTestRunner
 {
 public:
-    FMCPLoadTestRunner(int32 InNumCommands, int32 InConcurrentThreads)
-        : NumCommands(InNumCommands)
-        , ConcurrentThreads(InConcurrentThreads)
-        , CompletedCommands(0)
-        , FailedCommands(0)
-        , bStopRequested(false)
+    explicit FMCPLoadTestRunner(const FMCPLoadTestSettings& InSettings)
+        : Settings(InSettings)
     {
     }
 
-    virtual bool Init() override
+    /** Run all clients to completion and log the results; blocks the calling thread */
+    void Run()
     {
-        StartTime = FDateTime::Now();
-        return true;
+        UE_LOG(LogUnrealMCP, Display, TEXT("MCP load test: %d requests, %d clients, %d%% mutating, %s connections, port %d"),
+               Settings.Requests, Settings.Concurrency, Settings.MutatePercent,
+               Settings.bKeepAlive ? TEXT("keep-alive") : TEXT("per-request"), Settings.Port);
+
+        const double StartTime = FPlatformTime::Seconds();
+        TArray<TFuture<void>> Clients;
+        for (int32 ClientIndex = 0; ClientIndex < Settings.Concurrency; ++ClientIndex)
+        {
+            Clients.Add(Async(EAsyncExecution::Thread, [this, ClientIndex]()
+            {
+                RunClient(ClientIndex);
+            }));
+        }
+        for (TFuture<void>& Client : Clients)
+        {
+            Client.Wait();
+        }
+        LogResults(FPlatformTime::Seconds() - StartTime);
     }
 
-    virtual uint32 Run() override
+    /** Ask a running test to stop after the requests in flight */
+    static TAtomic<bool> bStopRequested;
+
+private:
+    /** Outcome of one request */
+    enum class EOutcome : uint8
     {
-        UE_LOG(LogTemp, Warning, TEXT("Starting load test: %d commands across %d threads"), NumCommands, ConcurrentThreads);
-        
-        // Create test commands
-        TArray<TSharedPtr<FJsonObject>> TestCommands;
-        CreateTestCommands(TestCommands);
-        
-        // Execute commands concurrently
-        TArray<TFuture<void>> Futures;
-        
-        int32 CommandsPerThread = NumCommands / ConcurrentThreads;
-        int32 RemainingCommands = NumCommands % ConcurrentThreads;
-        
-        int32 StartIndex = 0;
-        for (int32 ThreadIndex = 0; ThreadIndex < ConcurrentThreads; ++ThreadIndex)
-        {
-            int32 ThreadCommands = CommandsPerThread + (ThreadIndex < RemainingCommands ? 1 : 0);
-            int32 EndIndex = StartIndex + ThreadCommands;
-            
-            TFuture<void> Future = Async(EAsyncExecution::Thread, [this, TestCommands, StartIndex, EndIndex]()
-            {
-                ExecuteCommandBatch(TestCommands, StartIndex, EndIndex);
-            });
-            
-            Futures.Add(MoveTemp(Future));
-            StartIndex = EndIndex;
+        Succeeded,
+        Failed,
+        Busy
+    };
+
+    FMCPLoadTestSettings Settings;
+    TAtomic<int32> NextRequest{0};
+
+    TAtomic<int32> SucceededCount{0};
+    TAtomic<int32> FailedCount{0};
+    TAtomic<int32> BusyCount{0};
+    TAtomic<int32> TransportFailureCount{0};
+    TAtomic<int32> ConnectFailureCount{0};
+
+    FCriticalSection HistogramLock;
+    FMCPMetrics::FLatencyHistogram ReadLatency;
+    FMCPMetrics::FLatencyHistogram MutateLatency;
+
+    void RunClient(int32 ClientIndex)
+    {
+        FSocket* Socket = nullptr;
+        FMCPMessageFramer Framer;
+        TArray<FString> SpawnedActors;
+        int32 SpawnCounter = 0;
+
+        while (!bStopRequested)
+        {
+            const int32 RequestIndex = NextRequest++;
+            if (RequestIndex >= Settings.Requests)
+            {
+                break;
+            }
+
+            // Spread mutations evenly over the run rather than bunching them at its start
+            const bool bMutate = (RequestIndex * 37 + 11) % 100 < Settings.MutatePercent;
+            FString CommandType;
+            TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+            FString DeletedActor;
+            if (bMutate && SpawnedActors.Num() > 0)
+            {
+                DeletedActor = SpawnedActors.Pop();
+                CommandType = TEXT("delete_actor");
+                Params->SetStringField(TEXT("name"), DeletedActor);
+            }
+            else if (bMutate)
+            {
+                CommandType = TEXT("spawn_actor");
+                Params->SetStringField(TEXT("type"), TEXT("StaticMeshActor"));
+                Params->SetStringField(TEXT("name"), FString::Printf(TEXT("MCPLoadTest_%d_%d"), ClientIndex, SpawnCounter++));
+            }
+            else
+            {
+                MakeReadRequest(RequestIndex, CommandType, Params);
+            }
+
+            if (!Socket)
+            {
+                Socket = Connect();
+                if (!Socket)
+                {
+                    ++ConnectFailureCount;
+                    continue;
+                }
+                Framer.Reset();
+            }
+
+            const double RequestStartTime = FPlatformTime::Seconds();
+            TSharedPtr<FJsonObject> Response;
+            if (!Exchange(*Socket, Framer, CommandType, Params, Response))
+            {
+                ++TransportFailureCount;
+                CloseSocket(Socket);
+                continue;
+            }
+            const double Latency = FPlatformTime::Seconds() - RequestStartTime;
+
+            const EOutcome Outcome = Classify(Response);
+            switch (Outcome)
+            {
+            case EOutcome::Succeeded: ++SucceededCount; break;
+            case EOutcome::Busy: ++BusyCount; break;
+            default: ++FailedCount; break;
+            }
+            if (CommandType == TEXT("spawn_actor") && Outcome == EOutcome::Succeeded)
+            {
+                SpawnedActors.Add(Params->GetStringField(TEXT("name")));
+            }
+            else if (!DeletedActor.IsEmpty() && Outcome != EOutcome::Succeeded)
+            {
+                SpawnedActors.Add(DeletedActor);
+            }
+            {
+                FScopeLock Lock(&HistogramLock);
+                (bMutate ? MutateLatency : ReadLatency).Record(Latency);
+            }
+
+            if (!Settings.bKeepAlive)
+            {
+                CloseSocket(Socket);
+            }
         }
-        
-        // Wait for all threads to complete
-        for (auto& Future : Futures)
+
+        // Leave the level as it was; these deletes are not part of the results
+        for (const FString& ActorName : SpawnedActors)
         {
-            Future.Wait();
+            if (!Socket && !(Socket = Connect()))
+            {
+                break;
+            }
+            TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+            Params->SetStringField(TEXT("name"), ActorName);
+            TSharedPtr<FJsonObject> Response;
+            if (!Exchange(*Socket, Framer, TEXT("delete_actor"), Params, Response) || !Settings.bKeepAlive)
+            {
+                CloseSocket(Socket);
+            }
         }
-        
-        EndTime = FDateTime::Now();
-        LogResults();
-        
-        return 0;
+        CloseSocket(Socket);
     }
 
-    virtual void Stop() override
+    static void MakeReadRequest(int32 RequestIndex, FString& OutCommandType, const TSharedRef<FJsonObject>& OutParams)
     {
-        bStopRequested = true;
+        switch (RequestIndex % 3)
+        {
+        case 0:
+            OutCommandType = TEXT("ping");
+            break;
+        case 1:
+            OutCommandType = TEXT("get_level_metadata");
+            OutParams->SetNumberField(TEXT("limit"), 50);
+            break;
+        default:
+            OutCommandType = TEXT("search_assets");
+            OutParams->SetStringField(TEXT("asset_type"), TEXT("Blueprint"));
+            OutParams->SetNumberField(TEXT("max_results"), 50);
+            break;
+        }
     }
 
-    virtual void Exit() override
+    FSocket* Connect() const
     {
-        // Cleanup if needed
+        ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+        FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("MCPLoadTestClient"), false);
+        if (!Socket)
+        {
+            return nullptr;
+        }
+
+        TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr();
+        Address->SetIp(FIPv4Address(127, 0, 0, 1).Value);
+        Address->SetPort(Settings.Port);
+        if (!Socket->Connect(*Address))
+        {
+            SocketSubsystem->DestroySocket(Socket);
+            return nullptr;
+        }
+        Socket->SetNoDelay(true);
+        return Socket;
     }
 
-private:
-    int32 NumCommands;
-    int32 ConcurrentThreads;
-    FDateTime StartTime;
-    FDateTime EndTime;
-    
-    TAtomic<int32> CompletedCommands;
-    TAtomic<int32> FailedCommands;
-    TAtomic<bool> bStopRequested;
-    
-    void CreateTestCommands(TArray<TSharedPtr<FJsonObject>>& OutCommands)
+    static void CloseSocket(FSocket*& Socket)
     {
-        OutCommands.Reserve(NumCommands);
-        
-        for (int32 i = 0; i < NumCommands; ++i)
-        {
-            TSharedPtr<FJsonObject> Command = MakeShareable(new FJsonObject);
-            
-            // Vary command types for realistic testing
-            int32 CommandType = i % 4;
-            switch (CommandType)
-            {
-                case 0: // Create Blueprint
-                    Command->SetStringField(TEXT("command"), TEXT("create_blueprint"));
-                    Command->SetStringField(TEXT("name"), FString::Printf(TEXT("LoadTestBlueprint_%d"), i));
-                    Command->SetStringField(TEXT("parent_class"), TEXT("Actor"));
-                    break;
-                    
-                case 1: // Get available commands
-                    Command->SetStringField(TEXT("command"), TEXT("get_available_commands"));
-                    break;
-                    
-                case 2: // Component factory query
-                    Command->SetStringField(TEXT("command"), TEXT("get_component_types"));
-                    break;
-                    
-                case 3: // Invalid command (for error handling testing)
-                    Command->SetStringField(TEXT("command"), TEXT("invalid_test_command"));
-                    break;
-            }
-            
-            OutCommands.Add(Command);
+        if (Socket)
+        {
+            Socket->Close();
+            ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+            Socket = nullptr;
         }
     }
-    
-    void ExecuteCommandBatch(const TArray<TSharedPtr<FJsonObject>>& Commands, int32 StartIndex, int32 EndIndex)
+
+    /** Send one length-prefixed request and read its response */
+    bool Exchange(FSocket& Socket, FMCPMessageFramer& Framer, const FString& CommandType, const TSharedRef<FJsonObject>& Params,
+                  TSharedPtr<FJsonObject>& OutResponse) const
     {
-        FUnrealMCPMainDispatcher& Dispatcher = FUnrealMCPMainDispatcher::Get();
-        
-        for (int32 i = StartIndex; i < EndIndex && !bStopRequested; ++i)
-        {
-            if (i >= Commands.Num()) break;
-            
-            const TSharedPtr<FJsonObject>& Command = Commands[i];
-            FString CommandName = Command->GetStringField(TEXT("command"));
-            
-            try
-            {
-                TSharedPtr<FJsonObject> Response = Dispatcher.HandleCommand(CommandName, Command);
-                
-                if (Response.IsValid())
-                {
-                    CompletedCommands++;
-                }
-                else
-                {
-                    FailedCommands++;
-                    UE_LOG(LogTemp, Warning, TEXT("Load test command %d failed: No response"), i);
-                }
+        TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+        Request->SetStringField(TEXT("type"), CommandType);
+        Request->SetObjectField(TEXT("params"), Params);
+        Request->SetBoolField(TEXT("keep_alive"), Settings.bKeepAlive);
+
+        FString RequestText;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&RequestText);
+        FJsonSerializer::Serialize(Request, Writer);
+
+        FTCHARToUTF8 Utf8(*RequestText);
+        TArray<uint8> Bytes;
+        FMCPMessageFramer::EncodeMessage(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), EMCPFrameFormat::LengthPrefixed, Bytes);
+
+        int32 Offset = 0;
+        while (Offset < Bytes.Num())
+        {
+            int32 BytesSent = 0;
+            if (!Socket.Send(Bytes.GetData() + Offset, Bytes.Num() - Offset, BytesSent) || BytesSent <= 0)
+            {
+                return false;
+            }
+            Offset += BytesSent;
+        }
+
+        uint8 ReceiveBuffer[65536];
+        TArray<uint8> Payload;
+        EMCPFrameFormat Format;
+        FString FrameError;
+        while (true)
+        {
+            const EMCPFrameResult Result = Framer.TryExtractMessage(Payload, Format, FrameError);
+            if (Result == EMCPFrameResult::Complete)
+            {
+                break;
             }
-            catch (...)
+            if (Result == EMCPFrameResult::Error
+                || !Socket.Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(Settings.TimeoutSeconds)))
             {
-                FailedCommands++;
-                UE_LOG(LogTemp, Error, TEXT("Load test command %d threw exception"), i);
+                return false;
             }
+
+            int32 BytesRead = 0;
+            if (!Socket.Recv(ReceiveBuffer, sizeof(ReceiveBuffer), BytesRead) || BytesRead <= 0)
+            {
+                return false;
+            }
+            Framer.Append(ReceiveBuffer, BytesRead);
         }
+
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FMCPMessageFramer::PayloadToString(Payload));
+        return FJsonSerializer::Deserialize(Reader, OutResponse) && OutResponse.IsValid();
     }
-    
-    void LogResults()
+
+    static EOutcome Classify(const TSharedPtr<FJsonObject>& Response)
     {
-        FTimespan Duration = EndTime - StartTime;
-        double TotalSeconds = Duration.GetTotalSeconds();
-        double CommandsPerSecond = TotalSeconds > 0 ? NumCommands / TotalSeconds : 0;
-        
-        UE_LOG(LogTemp, Warning, TEXT("=== Load Test Results ==="));
-        UE_LOG(LogTemp, Warning, TEXT("Total Commands: %d"), NumCommands);
-        UE_LOG(LogTemp, Warning, TEXT("Concurrent Threads: %d"), ConcurrentThreads);
-        UE_LOG(LogTemp, Warning, TEXT("Completed Commands: %d"), CompletedCommands.Load());
-        UE_LOG(LogTemp, Warning, TEXT("Failed Commands: %d"), FailedCommands.Load());
-        UE_LOG(LogTemp, Warning, TEXT("Total Duration: %.2f seconds"), TotalSeconds);
-        UE_LOG(LogTemp, Warning, TEXT("Commands per Second: %.2f"), CommandsPerSecond);
-        UE_LOG(LogTemp, Warning, TEXT("Success Rate: %.2f%%"), 
-               NumCommands > 0 ? (CompletedCommands.Load() * 100.0f / NumCommands) : 0.0f);
+        bool bBusy = false;
+        if (Response->TryGetBoolField(TEXT("busy"), bBusy) && bBusy)
+        {
+            return EOutcome::Busy;
+        }
+        FString Status;
+        return Response->TryGetStringField(TEXT("status"), Status) && Status == TEXT("success") ? EOutcome::Succeeded : EOutcome::Failed;
     }
-};
 
-/**
- * Run load test with specified parameters
- */
-UFUNCTION(BlueprintCallable, Category = "MCP Testing")
-void RunMCPLoadTest(int32 NumCommands = 100, int32 ConcurrentThreads = 4)
-{
-    UE_LOG(LogTemp, Warning, TEXT("=== Starting MCP Load Test ==="));
-    
-    if (NumCommands <= 0 || ConcurrentThreads <= 0)
+    static void LogLatency(const TCHAR* Label, const FMCPMetrics::FLatencyHistogram& Histogram)
     {
-        UE_LOG(LogTemp, Error, TEXT("Invalid parameters: NumCommands=%d, ConcurrentThreads=%d"), 
-               NumCommands, ConcurrentThreads);
-        return;
+        if (Histogram.GetCount() == 0)
+        {
+            return;
+        }
+        UE_LOG(LogUnrealMCP, Display, TEXT("  %-7s %6llu requests  mean %8.2f ms  p50 %8.2f ms  p90 %8.2f ms  p99 %8.2f ms  max %8.2f ms"),
+               Label, Histogram.GetCount(),
+               Histogram.GetSumSeconds() * 1000.0 / Histogram.GetCount(),
+               Histogram.GetPercentileSeconds(0.5) * 1000.0,
+               Histogram.GetPercentileSeconds(0.9) * 1000.0,
+               Histogram.GetPercentileSeconds(0.99) * 1000.0,
+               Histogram.GetMaxSeconds() * 1000.0);
     }
-    
-    // Create and run load test
-    TUniquePtr<FMCPLoadTestRunner> LoadTestRunner = MakeUnique<FMCPLoadTestRunner>(NumCommands, ConcurrentThreads);
-    
-    FRunnableThread* LoadTestThread = FRunnableThread::Create(
-        LoadTestRunner.Get(), 
-        TEXT("MCPLoadTest"), 
-        0, 
-        TPri_Normal
-    );
-    
-    if (LoadTestThread)
+
+    void LogResults(double DurationSeconds)
     {
-        // Wait for completion
-        LoadTestThread->WaitForCompletion();
-        delete LoadTestThread;
+        const int32 Answered = SucceededCount + FailedCount + BusyCount;
+        UE_LOG(LogUnrealMCP, Display, TEXT("=== MCP Load Test Results ==="));
+        UE_LOG(LogUnrealMCP, Display, TEXT("  %d responses in %.2f s: %.1f requests/s"),
+               Answered, DurationSeconds, DurationSeconds > 0.0 ? Answered / DurationSeconds : 0.0);
+        UE_LOG(LogUnrealMCP, Display, TEXT("  succeeded %d, failed %d, rejected busy %d, connection lost %d, connect failed %d"),
+               SucceededCount.Load(), FailedCount.Load(), BusyCount.Load(), TransportFailureCount.Load(), ConnectFailureCount.Load());
+
+        FScopeLock Lock(&HistogramLock);
+        LogLatency(TEXT("read"), ReadLatency);
+        LogLatency(TEXT("mutate"), MutateLatency);
     }
-    else
+};
+
+TAtomic<bool> FMCPLoadTestRunner::bStopRequested(false);
+
+namespace
+{
+    TAtomic<bool> bLoadTestRunning(false);
+
+    /**
+     * mcp.LoadTest [Requests=1000] [Concurrency=8] [Mix=read|mixed|mutate] [MutatePercent=N] [KeepAlive=1] [Port=55557]
+     * mcp.LoadTest Stop
+     */
+    void StartMCPLoadTest(const TArray<FString>& Args)
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to create load test thread"));
+        const FString Command = FString::Join(Args, TEXT(" "));
+        const TCHAR* Cursor = *Command;
+        if (FParse::Command(&Cursor, TEXT("Stop")))
+        {
+            FMCPLoadTestRunner::bStopRequested = true;
+            return;
+        }
+        if (bLoadTestRunning.Exchange(true))
+        {
+            UE_LOG(LogUnrealMCP, Warning, TEXT("MCP load test: A test is already running; use 'mcp.LoadTest Stop' to end it"));
+            return;
+        }
+
+        FMCPLoadTestSettings Settings;
+        FParse::Value(*Command, TEXT("Requests="), Settings.Requests);
+        FParse::Value(*Command, TEXT("Concurrency="), Settings.Concurrency);
+        FParse::Value(*Command, TEXT("Port="), Settings.Port);
+        FParse::Bool(*Command, TEXT("KeepAlive="), Settings.bKeepAlive);
+
+        // Read-heavy by default; "mutate" flips the mix, MutatePercent sets it exactly
+        FString Mix;
+        if (FParse::Value(*Command, TEXT("Mix="), Mix))
+        {
+            Settings.MutatePercent = Mix == TEXT("mutate") ? 90 : Mix == TEXT("mixed") ? 50 : 10;
+        }
+        FParse::Value(*Command, TEXT("MutatePercent="), Settings.MutatePercent);
+
+        Settings.Requests = FMath::Max(Settings.Requests, 1);
+        Settings.Concurrency = FMath::Clamp(Settings.Concurrency, 1, 256);
+        Settings.MutatePercent = FMath::Clamp(Settings.MutatePercent, 0, 100);
+
+        // The clients must not run on the game thread, which has to execute what they send
+        FMCPLoadTestRunner::bStopRequested = false;
+        Async(EAsyncExecution::Thread, [Settings]()
+        {
+            FMCPLoadTestRunner Runner(Settings);
+            Runner.Run();
+            bLoadTestRunning = false;
+        });
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("=== MCP Load Test Completed ==="));
+
+    FAutoConsoleCommand MCPLoadTestCommand(
+        TEXT("mcp.LoadTest"),
+        TEXT("Drive the MCP TCP bridge with concurrent clients and log throughput and latency percentiles. ")
+        TEXT("Args: Requests=1000 Concurrency=8 Mix=read|mixed|mutate MutatePercent=N KeepAlive=1 Port=55557, or Stop"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&StartMCPLoadTest));
 }
 
 /**
@@ -0,0 +1,188 @@
+#include "CoreMinimal.h"
+#include "MCPMessageFraming.h"
+
+/**
+ * Test suite for FMCPMessageFramer
+ * Verifies length-prefixed and raw JSON extraction across fragmented input
+ */
+namespace MessageFramingTests
+{
+    static TArray<uint8> ToUTF8(const FString& Text)
+    {
+        FTCHARToUTF8 Converted(*Text);
+        return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+    }
+
+    static void Check(bool bCondition, const TCHAR* Description)
+    {
+        if (bCondition)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("✓ %s"), Description);
+        }
+        else
+        {
+            UE_LOG(LogTemp, Error, TEXT("✗ %s"), Description);
+        }
+    }
+
+    /**
+     * A length-prefixed frame delivered one byte at a time is reassembled exactly once
+     */
+    void TestFragmentedLengthPrefixedFrame()
+    {
+        const FString Message = TEXT("{\"type\":\"ping\",\"params\":{}}");
+        TArray<uint8> Payload = ToUTF8(Message);
+        TArray<uint8> Wire;
+        FMCPMessageFramer::EncodeMessage(Payload.GetData(), Payload.Num(), EMCPFrameFormat::LengthPrefixed, Wire);
+
+        FMCPMessageFramer Framer;
+        TArray<uint8> Out;
+        EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+        FString Error;
+        int32 CompleteCount = 0;
+
+        for (uint8 Byte : Wire)
+        {
+            Framer.Append(&Byte, 1);
+            if (Framer.TryExtractMessage(Out, Format, Error) == EMCPFrameResult::Complete)
+            {
+                ++CompleteCount;
+            }
+        }
+
+        Check(CompleteCount == 1, TEXT("Fragmented frame produces exactly one message"));
+        Check(Format == EMCPFrameFormat::LengthPrefixed, TEXT("Frame detected as length-prefixed"));
+        Check(FMCPMessageFramer::PayloadToString(Out) == Message, TEXT("Frame payload round-trips"));
+    }
+
+    /**
+     * Raw JSON larger than a single socket read, with braces inside strings, is delimited correctly
+     */
+    void TestLargeRawJsonMessage()
+    {
+        FString Rows;
+        for (int32 Index = 0; Index < 2000; ++Index)
+        {
+            Rows += FString::Printf(TEXT("%s{\"name\":\"Row_%d\",\"text\":\"brace } and \\\" quote\"}"), Index > 0 ? TEXT(",") : TEXT(""), Index);
+        }
+        const FString First = FString::Printf(TEXT("{\"type\":\"add_rows_to_datatable\",\"params\":{\"rows\":[%s]}}"), *Rows);
+        const FString Second = TEXT("{\"type\":\"ping\"}");
+        TArray<uint8> Wire = ToUTF8(First + TEXT("\n") + Second);
+
+        FMCPMessageFramer Framer;
+        TArray<uint8> Out;
+        EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+        FString Error;
+        TArray<FString> Messages;
+
+        const int32 ChunkSize = 8192;
+        for (int32 Offset = 0; Offset < Wire.Num(); Offset += ChunkSize)
+        {
+            Framer.Append(Wire.GetData() + Offset, FMath::Min(ChunkSize, Wire.Num() - Offset));
+            while (Framer.TryExtractMessage(Out, Format, Error) == EMCPFrameResult::Complete)
+            {
+                Messages.Add(FMCPMessageFramer::PayloadToString(Out));
+            }
+        }
+
+        Check(Messages.Num() == 2, TEXT("Two back-to-back raw JSON messages extracted"));
+        Check(Messages.Num() == 2 && Messages[0] == First, TEXT("Large raw JSON message reassembled intact"));
+        Check(Messages.Num() == 2 && Messages[1] == Second, TEXT("Following message extracted after whitespace"));
+        Check(Framer.GetBufferedBytes() == 0, TEXT("No bytes left in buffer"));
+    }
+
+    /**
+     * Oversized length headers are rejected instead of buffering unbounded data
+     */
+    void TestOversizedFrameRejected()
+    {
+        const uint8 Header[4] = { 0x7F, 0xFF, 0xFF, 0xFF };
+
+        FMCPMessageFramer Framer;
+        Framer.Append(Header, 4);
+
+        TArray<uint8> Out;
+        EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+        FString Error;
+        Check(Framer.TryExtractMessage(Out, Format, Error) == EMCPFrameResult::Error, TEXT("Oversized frame rejected"));
+    }
+
+    /**
+     * A length header whose first byte is a whitespace character (0x0A00001C, about 168 MB) is a
+     * legal length and must not be skipped as whitespace before the stream's format is known
+     */
+    void TestWhitespaceByteInLengthHeader()
+    {
+        const uint8 Wire[8] = { 0x0A, 0x00, 0x00, 0x1C, '{', '"', 'a', '"' };
+
+        FMCPMessageFramer Framer;
+        Framer.Append(Wire, 8);
+
+        TArray<uint8> Out;
+        EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+        FString Error;
+        Check(Framer.TryExtractMessage(Out, Format, Error) == EMCPFrameResult::NeedMoreData,
+            TEXT("Header starting with 0x0A waits for its payload"));
+        Check(Format == EMCPFrameFormat::LengthPrefixed, TEXT("Header starting with 0x0A detected as length-prefixed"));
+        Check(Framer.GetBufferedBytes() == 8, TEXT("Header byte 0x0A not consumed as whitespace"));
+    }
+
+    /**
+     * A compressed frame (flagged length header) is inflated back to the original payload
+     */
+    void TestCompressedFrame()
+    {
+        FString Message = TEXT("{\"type\":\"get_level_metadata\",\"params\":{\"filler\":\"");
+        for (int32 Index = 0; Index < 4000; ++Index)
+        {
+            Message += TEXT("repetitive metadata ");
+        }
+        Message += TEXT("\"}}");
+        TArray<uint8> Payload = ToUTF8(Message);
+
+        TArray<uint8> Body;
+        const bool bCompressed = FMCPMessageFramer::CompressPayload(Payload.GetData(), Payload.Num(), Body);
+        Check(bCompressed && Body.Num() < Payload.Num(), TEXT("Repetitive payload compresses"));
+        if (!bCompressed)
+        {
+            return;
+        }
+
+        uint8 Header[FMCPMessageFramer::HeaderSize];
+        FMCPMessageFramer::WriteHeader(static_cast<uint32>(Body.Num()), true, Header);
+
+        FMCPMessageFramer Framer;
+        Framer.Append(Header, FMCPMessageFramer::HeaderSize);
+        Framer.Append(Body.GetData(), Body.Num());
+
+        TArray<uint8> Out;
+        EMCPFrameFormat Format = EMCPFrameFormat::Unknown;
+        FString Error;
+        Check(Framer.TryExtractMessage(Out, Format, Error) == EMCPFrameResult::Complete, TEXT("Compressed frame extracted"));
+        Check(FMCPMessageFramer::PayloadToString(Out) == Message, TEXT("Compressed frame inflates to the original payload"));
+    }
+
+    /**
+     * Run all framing tests
+     */
+    void RunAllTests()
+    {
+        UE_LOG(LogTemp, Warning, TEXT("=== Message Framing Tests Started ==="));
+
+        TestFragmentedLengthPrefixedFrame();
+        TestLargeRawJsonMessage();
+        TestOversizedFrameRejected();
+        TestWhitespaceByteInLengthHeader();
+        TestCompressedFrame();
+
+        UE_LOG(LogTemp, Warning, TEXT("=== Message Framing Tests Completed ==="));
+    }
+}
+
+/**
+ * Main test function to run all message framing tests
+ */
+void TestMessageFraming()
+{
+    MessageFramingTests::RunAllTests();
+}
@@ -1,322 +1,504 @@
 #include "CoreMinimal.h"
-#include "Engine/Engine.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
 #include "Commands/UnrealMCPCommandRegistry.h"
-#include "Commands/UnrealMCPMainDispatcher.h"
-#include "Factories/ComponentFactory.h"
-#include "Factories/WidgetFactory.h"
-#include "Services/ComponentService.h"
+#include "Commands/MCPResponseWriter.h"
+#include "Services/DataTableService.h"
+#include "Services/NodeLayout/NodeLayoutService.h"
+#include "MCPMetrics.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/DataTable.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagsManager.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Dom/JsonObject.h"
-#include "HAL/PlatformMemory.h"
-
-// Forward declarations
-void BenchmarkCommandRegistryPerformance();
-void BenchmarkComponentFactoryPerformance();
-void BenchmarkWidgetFactoryPerformance();
-void BenchmarkServiceLayerPerformance();
-void BenchmarkEndToEndCommandPerformance();
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
 
 /**
- * Performance benchmark test for the refactored MCP system
- * Measures execution times and memory usage of various operations
+ * Benchmarks of the MCP server's hot paths, run by the automation framework
+ *
+ * Each benchmark times a fixed workload on fixtures built the same way on every run, appends its
+ * result to Saved/MCPBenchmarks/Results.csv, records it in Results.json and compares its median
+ * against Saved/MCPBenchmarks/Baselines.json. A median more than mcp.Benchmark.Tolerance above the
+ * baseline fails the test. A benchmark without a baseline records its result as the baseline;
+ * mcp.Benchmark.UpdateBaselines=1 replaces existing ones.
+ *
+ * Run with: Automation RunTests UnrealMCP.Benchmark
  */
-UFUNCTION(BlueprintCallable, Category = "MCP Testing")
-void RunPerformanceBenchmarkTest()
-{
-    UE_LOG(LogTemp, Warning, TEXT("=== Performance Benchmark Test Started ==="));
-    
-    // Get initial memory stats
-    FPlatformMemoryStats InitialMemory = FPlatformMemory::GetStats();
-    UE_LOG(LogTemp, Warning, TEXT("Initial Memory Usage: %.2f MB"), 
-           InitialMemory.UsedPhysical / (1024.0f * 1024.0f));
-    
-    // Benchmark 1: Command Registry Performance
-    BenchmarkCommandRegistryPerformance();
-    
-    // Benchmark 2: Component Factory Performance
-    BenchmarkComponentFactoryPerformance();
-    
-    // Benchmark 3: Widget Factory Performance
-    BenchmarkWidgetFactoryPerformance();
-    
-    // Benchmark 4: Service Layer Performance
-    BenchmarkServiceLayerPerformance();
-    
-    // Benchmark 5: End-to-End Command Performance
-    BenchmarkEndToEndCommandPerformance();
-    
-    // Get final memory stats
-    FPlatformMemoryStats FinalMemory = FPlatformMemory::GetStats();
-    UE_LOG(LogTemp, Warning, TEXT("Final Memory Usage: %.2f MB"), 
-           FinalMemory.UsedPhysical / (1024.0f * 1024.0f));
-    
-    float MemoryDelta = (FinalMemory.UsedPhysical - InitialMemory.UsedPhysical) / (1024.0f * 1024.0f);
-    UE_LOG(LogTemp, Warning, TEXT("Memory Delta: %.2f MB"), MemoryDelta);
-    
-    UE_LOG(LogTemp, Warning, TEXT("=== Performance Benchmark Test Completed ==="));
-}
 
-/**
- * Benchmark command registry performance
- */
-void BenchmarkCommandRegistryPerformance()
+static TAutoConsoleVariable<float> CVarMCPBenchmarkTolerance(
+    TEXT("mcp.Benchmark.Tolerance"),
+    0.25f,
+    TEXT("Fraction by which an UnrealMCP benchmark's median may exceed its baseline before the test fails."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarMCPBenchmarkUpdateBaselines(
+    TEXT("mcp.Benchmark.UpdateBaselines"),
+    false,
+    TEXT("Replace the stored baselines of UnrealMCP benchmarks with the results of this run."),
+    ECVF_Default);
+
+namespace MCPBenchmark
 {
-    UE_LOG(LogTemp, Warning, TEXT("--- Command Registry Performance Benchmark ---"));
-    
-    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
-    
-    // Test 1: Command lookup performance
-    const int32 NumLookups = 10000;
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < NumLookups; ++i)
+    constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter;
+
+    /** Timing of one benchmark, per call of its body */
+    struct FResult
+    {
+        FString Name;
+        int32 Samples = 0;
+        int32 CallsPerSample = 0;
+        double MeanMicroseconds = 0.0;
+        double P50Microseconds = 0.0;
+        double P90Microseconds = 0.0;
+        double MaxMicroseconds = 0.0;
+    };
+
+    FString GetOutputDir()
     {
-        Registry.IsCommandRegistered(TEXT("create_blueprint"));
-        Registry.IsCommandRegistered(TEXT("add_component_to_blueprint"));
-        Registry.IsCommandRegistered(TEXT("compile_blueprint"));
-        Registry.IsCommandRegistered(TEXT("create_umg_widget_blueprint"));
-        Registry.IsCommandRegistered(TEXT("add_widget_component_to_widget"));
+        return FPaths::ProjectSavedDir() / TEXT("MCPBenchmarks");
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan Duration = EndTime - StartTime;
-    double LookupsPerSecond = (NumLookups * 5) / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Command lookups: %.0f lookups/second (%.4f ms avg)"), 
-           LookupsPerSecond, Duration.GetTotalMilliseconds() / (NumLookups * 5));
-    
-    // Test 2: Get all commands performance
-    StartTime = FDateTime::Now();
-    for (int32 i = 0; i < 1000; ++i)
+
+    TSharedPtr<FJsonObject> LoadJsonFile(const FString& Path)
     {
-        TArray<FString> Commands = Registry.GetRegisteredCommandNames();
+        FString Text;
+        TSharedPtr<FJsonObject> Object;
+        if (FFileHelper::LoadFileToString(Text, *Path))
+        {
+            FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Object);
+        }
+        return Object.IsValid() ? Object : MakeShared<FJsonObject>();
     }
-    EndTime = FDateTime::Now();
-    Duration = EndTime - StartTime;
-    double GetAllPerSecond = 1000 / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Get all commands: %.0f calls/second (%.4f ms avg)"), 
-           GetAllPerSecond, Duration.GetTotalMilliseconds() / 1000);
-}
 
-/**
- * Benchmark component factory performance
- */
-void BenchmarkComponentFactoryPerformance()
-{
-    UE_LOG(LogTemp, Warning, TEXT("--- Component Factory Performance Benchmark ---"));
-    
-    FComponentFactory& Factory = FComponentFactory::Get();
-    
-    // Test 1: Component class lookup performance
-    const int32 NumLookups = 10000;
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < NumLookups; ++i)
+    bool SaveJsonFile(const FString& Path, const TSharedRef<FJsonObject>& Object)
+    {
+        FString Text;
+        FJsonSerializer::Serialize(Object, TJsonWriterFactory<>::Create(&Text));
+        return FFileHelper::SaveStringToFile(Text, *Path);
+    }
+
+    /**
+     * Time a workload
+     * Calls are timed in samples of CallsPerSample, so calls shorter than the histogram's
+     * microsecond resolution are still told apart. A tenth of the samples run first untimed.
+     * @param Prepare - Runs before each sample, outside the timing
+     */
+    FResult Measure(const TCHAR* Name, int32 Samples, int32 CallsPerSample, TFunctionRef<void()> Body,
+                    TFunctionRef<void()> Prepare = [](){})
+    {
+        for (int32 Warmup = 0; Warmup < FMath::Max(Samples / 10, 1); ++Warmup)
+        {
+            Prepare();
+            for (int32 Call = 0; Call < CallsPerSample; ++Call)
+            {
+                Body();
+            }
+        }
+
+        FMCPMetrics::FLatencyHistogram Histogram;
+        for (int32 Sample = 0; Sample < Samples; ++Sample)
+        {
+            Prepare();
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 Call = 0; Call < CallsPerSample; ++Call)
+            {
+                Body();
+            }
+            Histogram.Record(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+        }
+
+        const double ToMicroseconds = 1000000.0 / CallsPerSample;
+        FResult Result;
+        Result.Name = Name;
+        Result.Samples = Samples;
+        Result.CallsPerSample = CallsPerSample;
+        Result.MeanMicroseconds = Histogram.GetSumSeconds() / FMath::Max<uint64>(Histogram.GetCount(), 1) * ToMicroseconds;
+        Result.P50Microseconds = Histogram.GetPercentileSeconds(0.5) * ToMicroseconds;
+        Result.P90Microseconds = Histogram.GetPercentileSeconds(0.9) * ToMicroseconds;
+        Result.MaxMicroseconds = Histogram.GetMaxSeconds() * ToMicroseconds;
+        return Result;
+    }
+
+    /**
+     * Write a result to the results files and compare it against its baseline
+     * @return false if the median regressed beyond the tolerance
+     */
+    bool Report(FAutomationTestBase& Test, const FResult& Result)
+    {
+        const FString OutputDir = GetOutputDir();
+        IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+        const FString BaselinesPath = OutputDir / TEXT("Baselines.json");
+        TSharedPtr<FJsonObject> Baselines = LoadJsonFile(BaselinesPath);
+        const TSharedPtr<FJsonObject>* Baseline = nullptr;
+        double BaselineP50 = 0.0;
+        const bool bHasBaseline = Baselines->TryGetObjectField(Result.Name, Baseline)
+            && (*Baseline)->TryGetNumberField(TEXT("p50_us"), BaselineP50) && BaselineP50 > 0.0;
+
+        const double Tolerance = FMath::Max(CVarMCPBenchmarkTolerance.GetValueOnGameThread(), 0.0f);
+        const bool bRegressed = bHasBaseline && Result.P50Microseconds > BaselineP50 * (1.0 + Tolerance);
+        const TCHAR* Status = !bHasBaseline ? TEXT("new") : (bRegressed ? TEXT("regressed") : TEXT("ok"));
+
+        TSharedRef<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+        ResultObj->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+        ResultObj->SetNumberField(TEXT("samples"), Result.Samples);
+        ResultObj->SetNumberField(TEXT("calls_per_sample"), Result.CallsPerSample);
+        ResultObj->SetNumberField(TEXT("mean_us"), Result.MeanMicroseconds);
+        ResultObj->SetNumberField(TEXT("p50_us"), Result.P50Microseconds);
+        ResultObj->SetNumberField(TEXT("p90_us"), Result.P90Microseconds);
+        ResultObj->SetNumberField(TEXT("max_us"), Result.MaxMicroseconds);
+
+        const FString CsvPath = OutputDir / TEXT("Results.csv");
+        FString CsvLines;
+        if (!IFileManager::Get().FileExists(*CsvPath))
+        {
+            CsvLines = TEXT("timestamp,benchmark,samples,calls_per_sample,mean_us,p50_us,p90_us,max_us,baseline_p50_us,status\n");
+        }
+        CsvLines += FString::Printf(TEXT("%s,%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%s\n"),
+            *ResultObj->GetStringField(TEXT("timestamp")), *Result.Name, Result.Samples, Result.CallsPerSample,
+            Result.MeanMicroseconds, Result.P50Microseconds, Result.P90Microseconds, Result.MaxMicroseconds,
+            BaselineP50, Status);
+        FFileHelper::SaveStringToFile(CsvLines, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+            &IFileManager::Get(), FILEWRITE_Append);
+
+        const FString LatestPath = OutputDir / TEXT("Results.json");
+        TSharedPtr<FJsonObject> Latest = LoadJsonFile(LatestPath);
+        TSharedRef<FJsonObject> LatestEntry = MakeShared<FJsonObject>(*ResultObj);
+        LatestEntry->SetNumberField(TEXT("baseline_p50_us"), BaselineP50);
+        LatestEntry->SetStringField(TEXT("status"), Status);
+        Latest->SetObjectField(Result.Name, LatestEntry);
+        SaveJsonFile(LatestPath, Latest.ToSharedRef());
+
+        if (!bHasBaseline || CVarMCPBenchmarkUpdateBaselines.GetValueOnGameThread())
+        {
+            Baselines->SetObjectField(Result.Name, ResultObj);
+            SaveJsonFile(BaselinesPath, Baselines.ToSharedRef());
+        }
+
+        Test.AddInfo(FString::Printf(TEXT("%s: mean %.2f us, p50 %.2f us, p90 %.2f us, max %.2f us (baseline p50 %.2f us, %s)"),
+            *Result.Name, Result.MeanMicroseconds, Result.P50Microseconds, Result.P90Microseconds,
+            Result.MaxMicroseconds, BaselineP50, Status));
+        if (bRegressed)
+        {
+            Test.AddError(FString::Printf(TEXT("%s regressed: p50 %.2f us is more than %.0f%% above the baseline of %.2f us"),
+                *Result.Name, Result.P50Microseconds, Tolerance * 100.0, BaselineP50));
+        }
+        return !bRegressed;
+    }
+
+    /** Run a registered command once and fail the test if it did not succeed */
+    bool CheckCommand(FAutomationTestBase& Test, const FString& CommandName, const TSharedRef<FJsonObject>& Params)
+    {
+        FMCPResponseWriter Response;
+        if (!FUnrealMCPCommandRegistry::Get().ExecuteCommand(CommandName, Params, Response))
+        {
+            Test.AddError(FString::Printf(TEXT("Command '%s' is not registered"), *CommandName));
+            return false;
+        }
+        const TSharedPtr<FJsonObject> Result = Response.GetResultObject();
+        bool bSuccess = false;
+        if (!Result.IsValid() || (Result->TryGetBoolField(TEXT("success"), bSuccess) && !bSuccess))
+        {
+            Test.AddError(FString::Printf(TEXT("Command '%s' failed on the fixture: %s"), *CommandName, *Response.GetSerializedResult()));
+            return false;
+        }
+        return true;
+    }
+
+    constexpr int32 FixtureVariableCount = 16;
+    constexpr int32 FixtureNodeCount = 48;
+    constexpr int32 FixtureRowCount = 256;
+    const TCHAR* const FixtureBlueprintPath = TEXT("/Game/MCPBenchmark/BP_MCPBenchmarkFixture");
+
+    /**
+     * Actor Blueprint of FixtureVariableCount float variables and a chain of FixtureNodeCount
+     * PrintString calls in its event graph, all at the origin
+     * Created in memory on first use and never saved
+     */
+    UBlueprint* GetFixtureBlueprint()
+    {
+        const FString ObjectPath = FString::Printf(TEXT("%s.%s"), FixtureBlueprintPath, *FPaths::GetBaseFilename(FixtureBlueprintPath));
+        if (UBlueprint* Existing = FindObject<UBlueprint>(nullptr, *ObjectPath))
+        {
+            return Existing;
+        }
+
+        UPackage* Package = CreatePackage(FixtureBlueprintPath);
+        Package->SetFlags(RF_Transient);
+        UBlueprint* Blueprint = FKismetEditorUtilities::CreateBlueprint(AActor::StaticClass(), Package,
+            *FPaths::GetBaseFilename(FixtureBlueprintPath), BPTYPE_Normal, UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+        if (!Blueprint)
+        {
+            return nullptr;
+        }
+
+        FEdGraphPinType FloatType;
+        FloatType.PinCategory = UEdGraphSchema_K2::PC_Real;
+        FloatType.PinSubCategory = UEdGraphSchema_K2::PC_Float;
+        for (int32 Index = 0; Index < FixtureVariableCount; ++Index)
+        {
+            FBlueprintEditorUtils::AddMemberVariable(Blueprint, *FString::Printf(TEXT("BenchmarkValue%d"), Index), FloatType);
+        }
+
+        UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+        UFunction* PrintString = UKismetSystemLibrary::StaticClass()->FindFunctionByName(
+            GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString));
+        UEdGraphPin* PreviousThen = nullptr;
+        for (int32 Index = 0; EventGraph && PrintString && Index < FixtureNodeCount; ++Index)
+        {
+            FGraphNodeCreator<UK2Node_CallFunction> NodeCreator(*EventGraph);
+            UK2Node_CallFunction* Node = NodeCreator.CreateNode();
+            Node->SetFromFunction(PrintString);
+            NodeCreator.Finalize();
+
+            if (PreviousThen)
+            {
+                PreviousThen->MakeLinkTo(Node->GetExecPin());
+            }
+            PreviousThen = Node->GetThenPin();
+        }
+
+        FKismetEditorUtilities::CompileBlueprint(Blueprint);
+        return Blueprint;
+    }
+
+    /** Object shaped like a large command response: FixtureRowCount entries of mixed fields */
+    TSharedRef<FJsonObject> MakeFixtureJson()
     {
-        Factory.GetComponentClass(TEXT("StaticMeshComponent"));
-        Factory.GetComponentClass(TEXT("PointLightComponent"));
-        Factory.GetComponentClass(TEXT("SphereComponent"));
-        Factory.GetComponentClass(TEXT("BoxComponent"));
-        Factory.GetComponentClass(TEXT("CapsuleComponent"));
+        TArray<TSharedPtr<FJsonValue>> Entries;
+        Entries.Reserve(FixtureRowCount);
+        for (int32 Index = 0; Index < FixtureRowCount; ++Index)
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("name"), FString::Printf(TEXT("BenchmarkEntry_%d"), Index));
+            Entry->SetStringField(TEXT("path"), FString::Printf(TEXT("/Game/MCPBenchmark/Entries/BenchmarkEntry_%d"), Index));
+            Entry->SetNumberField(TEXT("index"), Index);
+            Entry->SetNumberField(TEXT("weight"), Index * 0.125);
+            Entry->SetBoolField(TEXT("enabled"), Index % 2 == 0);
+
+            TArray<TSharedPtr<FJsonValue>> Location;
+            Location.Add(MakeShared<FJsonValueNumber>(Index * 100.0));
+            Location.Add(MakeShared<FJsonValueNumber>(Index * -50.0));
+            Location.Add(MakeShared<FJsonValueNumber>(0.0));
+            Entry->SetArrayField(TEXT("location"), Location);
+            Entries.Add(MakeShared<FJsonValueObject>(Entry));
+        }
+
+        TSharedRef<FJsonObject> Fixture = MakeShared<FJsonObject>();
+        Fixture->SetBoolField(TEXT("success"), true);
+        Fixture->SetArrayField(TEXT("entries"), Entries);
+        return Fixture;
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan Duration = EndTime - StartTime;
-    double LookupsPerSecond = (NumLookups * 5) / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Component class lookups: %.0f lookups/second (%.4f ms avg)"), 
-           LookupsPerSecond, Duration.GetTotalMilliseconds() / (NumLookups * 5));
-    
-    // Test 2: Get available types performance
-    StartTime = FDateTime::Now();
-    for (int32 i = 0; i < 1000; ++i)
+
+    /** FixtureRowCount rows for a FGameplayTagTableRow table */
+    TArray<FDataTableRowParams> MakeFixtureRows()
     {
-        TArray<FString> Types = Factory.GetAvailableTypes();
+        TArray<FDataTableRowParams> Rows;
+        Rows.Reserve(FixtureRowCount);
+        for (int32 Index = 0; Index < FixtureRowCount; ++Index)
+        {
+            FDataTableRowParams& Row = Rows.AddDefaulted_GetRef();
+            Row.RowName = FString::Printf(TEXT("Row_%d"), Index);
+            Row.RowData = MakeShared<FJsonObject>();
+            Row.RowData->SetStringField(TEXT("Tag"), FString::Printf(TEXT("MCP.Benchmark.Row%d"), Index));
+            Row.RowData->SetStringField(TEXT("DevComment"), FString::Printf(TEXT("Benchmark row %d"), Index));
+        }
+        return Rows;
     }
-    EndTime = FDateTime::Now();
-    Duration = EndTime - StartTime;
-    double GetTypesPerSecond = 1000 / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Get available types: %.0f calls/second (%.4f ms avg)"), 
-           GetTypesPerSecond, Duration.GetTotalMilliseconds() / 1000);
 }
 
-/**
- * Benchmark widget factory performance
- */
-void BenchmarkWidgetFactoryPerformance()
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkRegistryDispatchTest, "UnrealMCP.Benchmark.RegistryDispatch", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkRegistryDispatchTest::RunTest(const FString& Parameters)
 {
-    UE_LOG(LogTemp, Warning, TEXT("--- Widget Factory Performance Benchmark ---"));
-    
-    FWidgetFactory& Factory = FWidgetFactory::Get();
-    
-    // Test 1: Get available widget types performance
-    const int32 NumCalls = 5000;
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < NumCalls; ++i)
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+
+    // A cheap command, so the time is the registry's lookup, execution bookkeeping and response handling
+    TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetStringField(TEXT("command"), TEXT("MCPBenchmarkUnknownCommand"));
+    if (!MCPBenchmark::CheckCommand(*this, TEXT("get_mcp_metrics"), Params))
     {
-        TArray<FString> Types = Factory.GetAvailableWidgetTypes();
+        return false;
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan Duration = EndTime - StartTime;
-    double CallsPerSecond = NumCalls / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Get widget types: %.0f calls/second (%.4f ms avg)"), 
-           CallsPerSecond, Duration.GetTotalMilliseconds() / NumCalls);
+
+    const MCPBenchmark::FResult Dispatch = MCPBenchmark::Measure(TEXT("RegistryDispatch"), 200, 50, [&Registry, &Params]()
+    {
+        FMCPResponseWriter Response;
+        Registry.ExecuteCommand(TEXT("get_mcp_metrics"), Params, Response);
+    });
+
+    const MCPBenchmark::FResult Lookup = MCPBenchmark::Measure(TEXT("RegistryLookup"), 200, 1000, [&Registry]()
+    {
+        Registry.IsCommandRegistered(TEXT("get_blueprint_metadata"));
+    });
+
+    const bool bDispatchOk = MCPBenchmark::Report(*this, Dispatch);
+    const bool bLookupOk = MCPBenchmark::Report(*this, Lookup);
+    return bDispatchOk && bLookupOk;
 }
 
-/**
- * Benchmark service layer performance
- */
-void BenchmarkServiceLayerPerformance()
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkJsonRoundTripTest, "UnrealMCP.Benchmark.JsonRoundTrip", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkJsonRoundTripTest::RunTest(const FString& Parameters)
 {
-    UE_LOG(LogTemp, Warning, TEXT("--- Service Layer Performance Benchmark ---"));
-    
-    FComponentService& ComponentService = FComponentService::Get();
-    
-    // Test 1: Component class resolution performance
-    const int32 NumCalls = 5000;
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < NumCalls; ++i)
+    const TSharedRef<FJsonObject> Fixture = MCPBenchmark::MakeFixtureJson();
+
+    FString Text;
+    FJsonSerializer::Serialize(Fixture, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Text));
+    TSharedPtr<FJsonObject> Parsed;
+    FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Parsed);
+    const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+    if (!Parsed.IsValid() || !Parsed->TryGetArrayField(TEXT("entries"), Entries) || Entries->Num() != MCPBenchmark::FixtureRowCount)
     {
-        ComponentService.GetComponentClass(TEXT("StaticMeshComponent"));
-        ComponentService.IsValidComponentType(TEXT("PointLightComponent"));
-        ComponentService.GetComponentClass(TEXT("SphereComponent"));
-        ComponentService.IsValidComponentType(TEXT("BoxComponent"));
+        AddError(TEXT("The JSON fixture did not survive a round trip"));
+        return false;
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan Duration = EndTime - StartTime;
-    double CallsPerSecond = (NumCalls * 4) / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Service layer calls: %.0f calls/second (%.4f ms avg)"), 
-           CallsPerSecond, Duration.GetTotalMilliseconds() / (NumCalls * 4));
+
+    const MCPBenchmark::FResult Result = MCPBenchmark::Measure(TEXT("JsonRoundTrip"), 100, 1, [&Fixture]()
+    {
+        FString Serialized;
+        FJsonSerializer::Serialize(Fixture, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized));
+        TSharedPtr<FJsonObject> Deserialized;
+        FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Serialized), Deserialized);
+    });
+    return MCPBenchmark::Report(*this, Result);
 }
 
-/**
- * Benchmark end-to-end command performance
- */
-void BenchmarkEndToEndCommandPerformance()
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkBlueprintMetadataTest, "UnrealMCP.Benchmark.BlueprintMetadata", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkBlueprintMetadataTest::RunTest(const FString& Parameters)
 {
-    UE_LOG(LogTemp, Warning, TEXT("--- End-to-End Command Performance Benchmark ---"));
-    
-    FUnrealMCPMainDispatcher& Dispatcher = FUnrealMCPMainDispatcher::Get();
-    
-    // Test 1: Simple command execution performance
-    TSharedPtr<FJsonObject> TestParams = MakeShareable(new FJsonObject);
-    
-    const int32 NumCommands = 100;
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < NumCommands; ++i)
+    if (!MCPBenchmark::GetFixtureBlueprint())
     {
-        // Test get available commands (lightweight operation)
-        TSharedPtr<FJsonObject> Response = Dispatcher.GetAvailableCommands();
+        AddError(TEXT("Failed to create the fixture Blueprint"));
+        return false;
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan Duration = EndTime - StartTime;
-    double CommandsPerSecond = NumCommands / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Lightweight commands: %.0f commands/second (%.4f ms avg)"), 
-           CommandsPerSecond, Duration.GetTotalMilliseconds() / NumCommands);
-    
-    // Test 2: Blueprint creation performance (heavier operation)
-    StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < 10; ++i)
+
+    TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetStringField(TEXT("blueprint_name"), MCPBenchmark::FixtureBlueprintPath);
+    if (!MCPBenchmark::CheckCommand(*this, TEXT("get_blueprint_metadata"), Params))
     {
-        TSharedPtr<FJsonObject> CreateParams = MakeShareable(new FJsonObject);
-        CreateParams->SetStringField(TEXT("name"), FString::Printf(TEXT("BP_PerfTest_%d"), i));
-        CreateParams->SetStringField(TEXT("parent_class"), TEXT("Actor"));
-        CreateParams->SetStringField(TEXT("folder_path"), TEXT("PerfTest"));
-        
-        TSharedPtr<FJsonObject> Response = Dispatcher.HandleCommand(TEXT("create_blueprint"), CreateParams);
+        return false;
     }
-    
-    EndTime = FDateTime::Now();
-    Duration = EndTime - StartTime;
-    double HeavyCommandsPerSecond = 10 / Duration.GetTotalSeconds();
-    
-    UE_LOG(LogTemp, Warning, TEXT("✓ Heavy commands (Blueprint creation): %.2f commands/second (%.2f ms avg)"), 
-           HeavyCommandsPerSecond, Duration.GetTotalMilliseconds() / 10);
+
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    const MCPBenchmark::FResult Result = MCPBenchmark::Measure(TEXT("BlueprintMetadata"), 50, 1, [&Registry, &Params]()
+    {
+        FMCPResponseWriter Response;
+        Registry.ExecuteCommand(TEXT("get_blueprint_metadata"), Params, Response);
+        Response.GetSerializedResult();
+    });
+    return MCPBenchmark::Report(*this, Result);
 }
 
-/**
- * Memory usage benchmark
- */
-UFUNCTION(BlueprintCallable, Category = "MCP Testing")
-void RunMemoryUsageBenchmark()
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkActionSearchTest, "UnrealMCP.Benchmark.ActionSearch", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkActionSearchTest::RunTest(const FString& Parameters)
 {
-    UE_LOG(LogTemp, Warning, TEXT("=== Memory Usage Benchmark Started ==="));
-    
-    FPlatformMemoryStats InitialStats = FPlatformMemory::GetStats();
-    UE_LOG(LogTemp, Warning, TEXT("Initial Memory: %.2f MB"), 
-           InitialStats.UsedPhysical / (1024.0f * 1024.0f));
-    
-    // Create many JSON objects to test memory management
-    TArray<TSharedPtr<FJsonObject>> TestObjects;
-    TestObjects.Reserve(10000);
-    
-    FDateTime StartTime = FDateTime::Now();
-    
-    for (int32 i = 0; i < 10000; ++i)
+    TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+    Params->SetStringField(TEXT("search_query"), TEXT("Print"));
+    Params->SetNumberField(TEXT("max_results"), 50);
+    if (!MCPBenchmark::CheckCommand(*this, TEXT("search_blueprint_actions"), Params))
     {
-        TSharedPtr<FJsonObject> TestObj = MakeShareable(new FJsonObject);
-        TestObj->SetStringField(TEXT("test_field"), FString::Printf(TEXT("test_value_%d"), i));
-        TestObj->SetNumberField(TEXT("test_number"), i);
-        TestObj->SetBoolField(TEXT("test_bool"), i % 2 == 0);
-        
-        // Add nested object
-        TSharedPtr<FJsonObject> NestedObj = MakeShareable(new FJsonObject);
-        NestedObj->SetStringField(TEXT("nested_field"), FString::Printf(TEXT("nested_%d"), i));
-        TestObj->SetObjectField(TEXT("nested"), NestedObj);
-        
-        TestObjects.Add(TestObj);
+        return false;
     }
-    
-    FDateTime EndTime = FDateTime::Now();
-    FTimespan CreationTime = EndTime - StartTime;
-    
-    FPlatformMemoryStats PeakStats = FPlatformMemory::GetStats();
-    UE_LOG(LogTemp, Warning, TEXT("Peak Memory: %.2f MB"), 
-           PeakStats.UsedPhysical / (1024.0f * 1024.0f));
-    
-    UE_LOG(LogTemp, Warning, TEXT("Object creation time: %.2f ms"), CreationTime.GetTotalMilliseconds());
-    
-    // Clear objects and measure cleanup
-    StartTime = FDateTime::Now();
-    TestObjects.Empty();
-    EndTime = FDateTime::Now();
-    FTimespan CleanupTime = EndTime - StartTime;
-    
-    // Force garbage collection
-    GEngine->ForceGarbageCollection(true);
-    
-    FPlatformMemoryStats FinalStats = FPlatformMemory::GetStats();
-    UE_LOG(LogTemp, Warning, TEXT("Final Memory: %.2f MB"), 
-           FinalStats.UsedPhysical / (1024.0f * 1024.0f));
-    
-    float MemoryDelta = (FinalStats.UsedPhysical - InitialStats.UsedPhysical) / (1024.0f * 1024.0f);
-    UE_LOG(LogTemp, Warning, TEXT("Memory Delta: %.2f MB"), MemoryDelta);
-    UE_LOG(LogTemp, Warning, TEXT("Cleanup time: %.2f ms"), CleanupTime.GetTotalMilliseconds());
-    
-    if (MemoryDelta < 5.0f)
+
+    FUnrealMCPCommandRegistry& Registry = FUnrealMCPCommandRegistry::Get();
+    const MCPBenchmark::FResult Result = MCPBenchmark::Measure(TEXT("ActionSearch"), 30, 1, [&Registry, &Params]()
+    {
+        FMCPResponseWriter Response;
+        Registry.ExecuteCommand(TEXT("search_blueprint_actions"), Params, Response);
+        Response.GetSerializedResult();
+    });
+    return MCPBenchmark::Report(*this, Result);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkDataTableImportTest, "UnrealMCP.Benchmark.DataTableImport", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkDataTableImportTest::RunTest(const FString& Parameters)
+{
+    UDataTable* DataTable = NewObject<UDataTable>(GetTransientPackage(), NAME_None, RF_Transient);
+    DataTable->RowStruct = FGameplayTagTableRow::StaticStruct();
+    TStrongObjectPtr<UDataTable> KeepAlive(DataTable);
+
+    FDataTableService DataTableService;
+    const TArray<FDataTableRowParams> Rows = MCPBenchmark::MakeFixtureRows();
+    TArray<FString> AddedRows;
+    TArray<FString> FailedRows;
+    DataTableService.ImportRowsToDataTable(DataTable, Rows, AddedRows, FailedRows);
+    if (AddedRows.Num() != Rows.Num())
     {
-        UE_LOG(LogTemp, Warning, TEXT("✓ Memory management: EXCELLENT (delta < 5MB)"));
+        AddError(FString::Printf(TEXT("Imported %d of %d fixture rows"), AddedRows.Num(), Rows.Num()));
+        return false;
     }
-    else if (MemoryDelta < 20.0f)
+
+    const MCPBenchmark::FResult Result = MCPBenchmark::Measure(TEXT("DataTableImport"), 50, 1,
+        [&DataTableService, DataTable, &Rows, &AddedRows, &FailedRows]()
+        {
+            DataTableService.ImportRowsToDataTable(DataTable, Rows, AddedRows, FailedRows);
+        },
+        [DataTable, &AddedRows, &FailedRows]()
+        {
+            DataTable->EmptyTable();
+            AddedRows.Reset();
+            FailedRows.Reset();
+        });
+    return MCPBenchmark::Report(*this, Result);
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMCPBenchmarkGraphLayoutTest, "UnrealMCP.Benchmark.GraphLayout", MCPBenchmark::TestFlags)
+
+bool FMCPBenchmarkGraphLayoutTest::RunTest(const FString& Parameters)
+{
+    UBlueprint* Blueprint = MCPBenchmark::GetFixtureBlueprint();
+    UEdGraph* EventGraph = Blueprint ? FBlueprintEditorUtils::FindEventGraph(Blueprint) : nullptr;
+    if (!EventGraph)
     {
-        UE_LOG(LogTemp, Warning, TEXT("✓ Memory management: GOOD (delta < 20MB)"));
+        AddError(TEXT("Failed to create the fixture Blueprint"));
+        return false;
     }
-    else
+
+    // Every sample lays out the same graph: all nodes back at the origin
+    auto ResetPositions = [EventGraph]()
+    {
+        for (UEdGraphNode* Node : EventGraph->Nodes)
+        {
+            Node->NodePosX = 0;
+            Node->NodePosY = 0;
+        }
+    };
+
+    int32 ArrangedCount = 0;
+    ResetPositions();
+    if (!FNodeLayoutService::AutoArrangeNodes(EventGraph, ArrangedCount) || ArrangedCount < MCPBenchmark::FixtureNodeCount)
     {
-        UE_LOG(LogTemp, Warning, TEXT("⚠️ Memory management: NEEDS ATTENTION (delta > 20MB)"));
+        AddError(FString::Printf(TEXT("Arranged %d of at least %d fixture nodes"), ArrangedCount, MCPBenchmark::FixtureNodeCount));
+        return false;
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("=== Memory Usage Benchmark Completed ==="));
-}
\ No newline at end of file
+
+    const MCPBenchmark::FResult Result = MCPBenchmark::Measure(TEXT("GraphLayout"), 50, 1,
+        [EventGraph, &ArrangedCount]()
+        {
+            FNodeLayoutService::AutoArrangeNodes(EventGraph, ArrangedCount);
+        },
+        ResetPositions);
+    return MCPBenchmark::Report(*this, Result);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -1,8 +1,63 @@
 #include "UnrealMCPBridge.h"
 #include "MCPServerRunnable.h"
+#include "MCPTransport.h"
+#include "MCPLocalTransport.h"
+#include "MCPCancellation.h"
+#include "MCPAttachments.h"
+#include "MCPRequestCoalescer.h"
+#include "MCPResponseCache.h"
+#include "MCPCacheBudget.h"
+#include "MCPAssetPrefetcher.h"
+#include "MCPCompileQueue.h"
+#include "MCPSaveQueue.h"
+#include "MCPAdmissionController.h"
+#include "MCPStartupWarmup.h"
+#include "MCPLevelEvents.h"
+#include "MCPMetrics.h"
+#include "MCPSlowCommandLog.h"
+#include "MCPRequestRecording.h"
+#include "MCPTrace.h"
+#include "MCPMemory.h"
+#include "UnrealMCPSettings.h"
+#include "Services/ObjectPoolManager.h"
+#include "Services/AssetDiscoveryService.h"
+#include "Services/BlueprintService.h"
+#include "Services/AssetSearchIndex.h"
+#include "Factories/ComponentFactory.h"
+#include "Services/ReflectionTypeIndex.h"
+#include "Services/ActorIndex.h"
+#include "Services/BlueprintCallSiteIndex.h"
+#include "Services/BlueprintSearchIndex.h"
+#include "Services/BlueprintChangeJournal.h"
+#include "Services/GraphReachabilityCache.h"
+#include "Services/GraphFingerprintCache.h"
+#include "Services/BlueprintCompileResultCache.h"
+#include "Services/BlueprintComponentLookupCache.h"
+#include "Services/UMG/WidgetValidationCache.h"
+#include "Services/PropertyAccessorCache.h"
+#include "Services/NiagaraModuleIndex.h"
+#include "Services/MaterialPaletteIndex.h"
+#include "Services/MetaSoundPaletteIndex.h"
+#include "Services/SoundWaveSummaryCache.h"
+#include "Services/StateTreeNodeTypeCatalog.h"
+#include "Services/StateTreeExecutionRecorder.h"
+#include "Services/StateTreeTagIndex.h"
+#include "Services/DataTableStructNameCache.h"
+#include "Services/DataTableFingerprintIndex.h"
+#include "Services/DataTableCatalog.h"
+#include "Services/BlueprintAction/BlueprintActionSearchIndex.h"
+#include "Services/BlueprintAction/BlueprintPinCompatibilityIndex.h"
+#include "Services/BlueprintAction/BlueprintClassSearchService.h"
+#include "Services/BlueprintAction/BlueprintNodePinInfoService.h"
+#include "Services/MacroDiscoveryService.h"
+#include "Services/MaterialExpressionService.h"
+#include "Services/NodeCreation/ActionSpawnerMatcher.h"
+#include "MCPLogging.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "HAL/RunnableThread.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 #include "Dom/JsonObject.h"
@@ -22,6 +77,7 @@
 #include "Engine/Selection.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
+#include "UObject/GarbageCollection.h"
 // Add Blueprint related includes
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -50,57 +106,141 @@
 #include "GameFramework/InputSettings.h"
 #include "EditorSubsystem.h"
 #include "Subsystems/EditorActorSubsystem.h"
-// Include our new command handler classes
-#include "Commands/Editor/UnrealMCPEditorCommands.h"
-#include "Commands/Blueprint/UnrealMCPBlueprintCommands.h"
-#include "Commands/BlueprintNode/UnrealMCPBlueprintNodeCommands.h"
-#include "Commands/Project/UnrealMCPProjectCommands.h"
 #include "Utils/UnrealMCPCommonUtils.h"
-#include "Commands/UMG/UnrealMCPUMGCommands.h"
-
-#include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommandsHandler.h"
+#include "Utils/JsonUtils.h"
 #include "Commands/EditorCommandRegistration.h"
 #include "Commands/DataTableCommandRegistration.h"
 
-// Default settings
-#define MCP_SERVER_HOST "127.0.0.1"
-#define MCP_SERVER_PORT 55557
+namespace
+{
+    /** Serialize a response envelope to condensed JSON text */
+    FString SerializeResponseJson(const TSharedRef<FJsonObject>& ResponseJson)
+    {
+        MCP_TRACE_SCOPE("MCP::SerializeResponse");
+        LLM_SCOPE_BYTAG(UnrealMCP_Json);
+        // Serialize into a pooled buffer that has already grown to response size, then copy the text
+        // out in one allocation
+        FScopedPooledStringBuffer SerializeBuffer;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SerializeBuffer.Get());
+        FJsonSerializer::Serialize(ResponseJson, Writer.Get());
+        return SerializeBuffer.Get();
+    }
+
+    /**
+     * Write the envelope of a failure that carries nothing but its message, {"status":"error","error":Message},
+     * straight from text; the same output SerializeResponseJson gives for that envelope
+     */
+    FString SerializeErrorResponse(FStringView Message)
+    {
+        MCP_TRACE_SCOPE("MCP::SerializeResponse");
+        static const FStringView Prefix = TEXTVIEW("{\"status\":\"error\",\"error\":");
+        FString Response;
+        Response.Reserve(Prefix.Len() + Message.Len() + 3);
+        Response.Append(Prefix);
+        FJsonUtils::AppendJsonString(Response, Message);
+        Response.AppendChar(TEXT('}'));
+        return Response;
+    }
+
+    /** Game-thread tick age beyond which health reports the game thread as stalled */
+    constexpr double GameThreadStallSeconds = 5.0;
+
+    /** @return Whether the bridge answers the command itself rather than a registered command */
+    bool IsBridgeCommand(const FString& CommandType)
+    {
+        return CommandType == TEXT("ping") || CommandType == TEXT("health");
+    }
+
+    /** @return The threads a command is dispatched to; the bridge's own commands answer on the transport thread */
+    EMCPThreadAffinity GetDispatchAffinity(const FString& CommandType)
+    {
+        return IsBridgeCommand(CommandType)
+            ? EMCPThreadAffinity::TransportThread
+            : FUnrealMCPCommandRegistry::Get().GetCommandThreadAffinity(CommandType);
+    }
+}
 
 UUnrealMCPBridge::UUnrealMCPBridge()
 {
-    EditorCommands = MakeShared<FUnrealMCPEditorCommands>();
-    BlueprintCommands = MakeShared<FUnrealMCPBlueprintCommands>();
-    BlueprintNodeCommands = MakeShared<FUnrealMCPBlueprintNodeCommands>();
-    ProjectCommands = MakeShared<FUnrealMCPProjectCommands>();
-    UMGCommands = MakeShared<FUnrealMCPUMGCommands>();
-    BlueprintActionCommands = MakeShared<FUnrealMCPBlueprintActionCommandsHandler>();
 }
 
 UUnrealMCPBridge::~UUnrealMCPBridge()
 {
-    EditorCommands.Reset();
-    BlueprintCommands.Reset();
-    BlueprintNodeCommands.Reset();
-    ProjectCommands.Reset();
-    UMGCommands.Reset();
-    BlueprintActionCommands.Reset();
 }
 
 // Initialize subsystem
 void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
 {
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Initializing"));
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Initializing"));
     
     bIsRunning = false;
     ListenerSocket = nullptr;
     ConnectionSocket = nullptr;
     ServerThread = nullptr;
-    Port = MCP_SERVER_PORT;
-    FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
+    ServerRunnable = nullptr;
+    LocalServerThread = nullptr;
+    LocalServerRunnable = nullptr;
+    const UUnrealMCPSettings* Settings = UUnrealMCPSettings::Get();
+    Port = static_cast<uint16>(FMath::Clamp(Settings->ServerPort, 1, 65535));
+    // -MCPPort= lets several editors, or headless UnrealMCPCommandlet hosts, run side by side
+    FParse::Value(FCommandLine::Get(), TEXT("MCPPort="), Port);
+    if (!FIPv4Address::Parse(Settings->BindAddress, ServerAddress))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("UnrealMCPBridge: Bind address '%s' is not an IPv4 address, using 127.0.0.1"), *Settings->BindAddress);
+        ServerAddress = FIPv4Address::InternalLoopback;
+    }
 
     // NOTE: Commands are registered by FUnrealMCPMainDispatcher via module initialization
     // Do NOT register commands here to avoid duplicate registration warnings
 
+    CommandScheduler = MakeShared<FMCPCommandScheduler>();
+    CommandScheduler->Start();
+    RequestCoalescer = MakeShared<FMCPRequestCoalescer>();
+    FMCPCacheBudget::Get().Initialize();
+    ResponseCache = MakeShared<FMCPResponseCache>();
+    ResponseCache->RegisterInvalidationHandlers();
+    FAssetSearchIndex::Get().Initialize();
+    FComponentFactory::Get().Initialize();
+    FReflectionTypeIndex::Get().Initialize();
+    FActorIndex::Get().Initialize();
+    FMCPLevelEvents::Get().Initialize();
+    FBlueprintCallSiteIndex::Get().Initialize();
+    FBlueprintSearchIndex::Get().Initialize();
+    FBlueprintChangeJournal::Get().Initialize();
+    FGraphFingerprintCache::Get().Initialize();
+    FGraphReachabilityCache::Get().Initialize();
+    FBlueprintCompileResultCache::Get().Initialize();
+    FBlueprintComponentLookupCache::Get().Initialize();
+    FWidgetValidationCache::Get().Initialize();
+    FPropertyAccessorCache::Get().Initialize();
+    FNiagaraModuleIndex::Get().Initialize();
+    FMaterialPaletteIndex::Get().Initialize();
+    FMetaSoundPaletteIndex::Get().Initialize();
+    FSoundWaveSummaryCache::Get().Initialize();
+    FStateTreeNodeTypeCatalog::Get().Initialize();
+    FStateTreeTagIndex::Get().Initialize();
+    FDataTableStructNameCache::Get().Initialize();
+    FDataTableFingerprintIndex::Get().Initialize();
+    FDataTableCatalog::Get().Initialize();
+    FBlueprintService::Get().WarmStartCache();
+    AdmissionController = MakeShared<FMCPAdmissionController>();
+    FMCPMetrics::Get().Initialize();
+    FMCPSlowCommandLog::Get().Initialize();
+    FMCPRequestRecorder::Get().Initialize();
+
+    // Listen right away, but hold commands back until the asset registry has scanned the project;
+    // meanwhile build what the first commands would otherwise build, while no commands are waiting
+    StartupWarmup = MakeShared<FMCPStartupWarmup>([this]() { return GetQueuedCommandCount() == 0; });
+    StartupWarmup->AddStep(TEXT("blueprint action search index"), false, []() { FBlueprintActionSearchIndex::Get().Prewarm(); });
+    StartupWarmup->AddStep(TEXT("blueprint pin compatibility index"), false, []() { FBlueprintPinCompatibilityIndex::Get().Prewarm(); });
+    StartupWarmup->AddStep(TEXT("action spawner index"), false, []() { FActionSpawnerMatcher::PrewarmSpawnerIndex(); });
+    StartupWarmup->AddStep(TEXT("asset search index"), true, []() { FAssetSearchIndex::Get().Prewarm(); });
+    StartupWarmup->AddStep(TEXT("DataTable catalog"), true, []() { FDataTableCatalog::Get().Prewarm(); });
+    StartupWarmup->Start();
+
+    // Load what the session is likely to ask for next while nothing is waiting
+    FMCPAssetPrefetcher::Get().Initialize([this]() { return GetQueuedCommandCount() == 0; });
+
     // Start the server automatically
     StartServer();
 }
@@ -108,12 +248,76 @@ void UUnrealMCPBridge::Initialize(FSubsystemCollectionBase& Collection)
 // Clean up resources when subsystem is destroyed
 void UUnrealMCPBridge::Deinitialize()
 {
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Shutting down"));
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Shutting down"));
 
     // NOTE: Command unregistration is handled by FUnrealMCPMainDispatcher::Shutdown()
     // Do NOT unregister commands here to maintain consistency with registration
 
     StopServer();
+    FMCPRequestReplayer::Get().Stop();
+
+    if (StartupWarmup.IsValid())
+    {
+        StartupWarmup->Stop();
+        StartupWarmup.Reset();
+    }
+    FMCPAssetPrefetcher::Get().Shutdown();
+
+    // Connections are gone; answer anything still queued before the scheduler goes away
+    if (CommandScheduler.IsValid())
+    {
+        CommandScheduler->Stop();
+        CommandScheduler.Reset();
+    }
+    FMCPRequestReplayer::Get().Shutdown();
+    FMCPRequestRecorder::Get().Shutdown();
+    RequestCoalescer.Reset();
+
+    if (ResponseCache.IsValid())
+    {
+        ResponseCache->UnregisterInvalidationHandlers();
+        ResponseCache.Reset();
+    }
+    AdmissionController.Reset();
+    FMCPMetrics::Get().Shutdown();
+    FMCPCacheBudget::Get().Shutdown();
+    FMCPSlowCommandLog::Get().Shutdown();
+    // Open material sessions recompile and save before the queues go away
+    FMaterialExpressionService::Get().EndAllEditSessions();
+    FMCPCompileQueue::Get().Shutdown();
+    FMCPSaveQueue::Get().Shutdown();
+    FAssetDiscoveryService::Get().Shutdown();
+    FAssetSearchIndex::Get().Shutdown();
+    FComponentFactory::Get().Shutdown();
+    FReflectionTypeIndex::Get().Shutdown();
+    FActorIndex::Get().Shutdown();
+    FMCPLevelEvents::Get().Shutdown();
+    FBlueprintCallSiteIndex::Get().Shutdown();
+    FBlueprintSearchIndex::Get().Shutdown();
+    FBlueprintChangeJournal::Get().Shutdown();
+    FGraphReachabilityCache::Get().Shutdown();
+    FGraphFingerprintCache::Get().Shutdown();
+    FBlueprintCompileResultCache::Get().Shutdown();
+    FBlueprintComponentLookupCache::Get().Shutdown();
+    FWidgetValidationCache::Get().Shutdown();
+    FPropertyAccessorCache::Get().Shutdown();
+    FNiagaraModuleIndex::Get().Shutdown();
+    FMaterialPaletteIndex::Get().Shutdown();
+    FMetaSoundPaletteIndex::Get().Shutdown();
+    FSoundWaveSummaryCache::Get().Shutdown();
+    FStateTreeNodeTypeCatalog::Get().Shutdown();
+    FStateTreeExecutionRecorder::Get().Shutdown();
+    FStateTreeTagIndex::Get().Shutdown();
+    FDataTableStructNameCache::Get().Shutdown();
+    FDataTableFingerprintIndex::Get().Shutdown();
+    FDataTableCatalog::Get().Shutdown();
+    FBlueprintActionSearchIndex::Get().Shutdown();
+    FBlueprintPinCompatibilityIndex::Get().Shutdown();
+    FActionSpawnerMatcher::ShutdownSpawnerIndex();
+    FBlueprintClassSearchService::ShutdownActionCache();
+    FMacroDiscoveryService::ShutdownMacroIndex();
+    FBlueprintNodePinInfoService::ShutdownPinInfoCache();
+    FBlueprintService::Get().SaveCacheState();
 }
 
 // Start the MCP server
@@ -121,7 +325,7 @@ void UUnrealMCPBridge::StartServer()
 {
     if (bIsRunning)
     {
-        UE_LOG(LogTemp, Warning, TEXT("UnrealMCPBridge: Server is already running"));
+        UE_LOG(LogUnrealMCP, Warning, TEXT("UnrealMCPBridge: Server is already running"));
         return;
     }
 
@@ -129,7 +333,7 @@ void UUnrealMCPBridge::StartServer()
     ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
     if (!SocketSubsystem)
     {
-        UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to get socket subsystem"));
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to get socket subsystem"));
         return;
     }
 
@@ -137,7 +341,7 @@ void UUnrealMCPBridge::StartServer()
     TSharedPtr<FSocket> NewListenerSocket = MakeShareable(SocketSubsystem->CreateSocket(NAME_Stream, TEXT("UnrealMCPListener"), false));
     if (!NewListenerSocket.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to create listener socket"));
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to create listener socket"));
         return;
     }
 
@@ -149,34 +353,63 @@ void UUnrealMCPBridge::StartServer()
     FIPv4Endpoint Endpoint(ServerAddress, Port);
     if (!NewListenerSocket->Bind(*Endpoint.ToInternetAddr()))
     {
-        UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to bind listener socket to %s:%d"), *ServerAddress.ToString(), Port);
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to bind listener socket to %s:%d"), *ServerAddress.ToString(), Port);
         return;
     }
 
-    // Start listening
-    if (!NewListenerSocket->Listen(5))
+    // Start listening - the backlog holds clients waiting for a free connection worker
+    if (!NewListenerSocket->Listen(FMCPServerRunnable::GetMaxConcurrentConnections() * 2))
     {
-        UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to start listening"));
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to start listening"));
         return;
     }
 
     ListenerSocket = NewListenerSocket;
     bIsRunning = true;
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Server started on %s:%d"), *ServerAddress.ToString(), Port);
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Server started on %s:%d"), *ServerAddress.ToString(), Port);
 
     // Start server thread
+    ServerRunnable = new FMCPServerRunnable(this, MakeShared<FMCPSocketListener>(ListenerSocket));
     ServerThread = FRunnableThread::Create(
-        new FMCPServerRunnable(this, ListenerSocket),
+        ServerRunnable,
         TEXT("UnrealMCPServerThread"),
         0, TPri_Normal
     );
 
     if (!ServerThread)
     {
-        UE_LOG(LogTemp, Error, TEXT("UnrealMCPBridge: Failed to create server thread"));
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to create server thread"));
         StopServer();
         return;
     }
+
+    // Same-host clients can skip the TCP stack through a local socket; TCP stays available for
+    // remote clients. The local socket is not supported on Windows, which serves TCP only
+#if !PLATFORM_WINDOWS
+    LocalListener = FMCPLocalListener::Create(FMCPLocalListener::GetDefaultPath(Port), FMCPServerRunnable::GetMaxConcurrentConnections() * 2);
+    if (!LocalListener.IsValid())
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("UnrealMCPBridge: Local socket transport unavailable, serving TCP only"));
+        return;
+    }
+
+    LocalServerRunnable = new FMCPServerRunnable(this, LocalListener);
+    LocalServerThread = FRunnableThread::Create(
+        LocalServerRunnable,
+        TEXT("UnrealMCPLocalServerThread"),
+        0, TPri_Normal
+    );
+
+    if (!LocalServerThread)
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPBridge: Failed to create local server thread, serving TCP only"));
+        delete LocalServerRunnable;
+        LocalServerRunnable = nullptr;
+        LocalListener.Reset();
+        return;
+    }
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Local server started on %s"), *LocalListener->GetDescription());
+#endif
 }
 
 // Stop the MCP server
@@ -189,13 +422,27 @@ void UUnrealMCPBridge::StopServer()
 
     bIsRunning = false;
 
-    // Clean up thread
+    // Clean up threads; each runnable stops its connection workers before its thread exits
     if (ServerThread)
     {
         ServerThread->Kill(true);
         delete ServerThread;
         ServerThread = nullptr;
     }
+    delete ServerRunnable;
+    ServerRunnable = nullptr;
+
+    if (LocalServerThread)
+    {
+        LocalServerThread->Kill(true);
+        delete LocalServerThread;
+        LocalServerThread = nullptr;
+    }
+    delete LocalServerRunnable;
+    LocalServerRunnable = nullptr;
+
+    // Releasing the local listener removes its socket file
+    LocalListener.Reset();
 
     // Close sockets
     if (ConnectionSocket.IsValid())
@@ -210,129 +457,260 @@ void UUnrealMCPBridge::StopServer()
         ListenerSocket.Reset();
     }
 
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Server stopped"));
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPBridge: Server stopped"));
 }
 
 // Execute a command received from a client
 FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
 {
-    UE_LOG(LogTemp, Display, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
+    // Callers take the response as text, so attachments are inlined as base64
+    FString Response = ExecuteCommandAsync(CommandType, Params).Get();
+    FMCPAttachments::InlineReferences(Response);
+    return Response;
+}
+
+TFuture<FString> UUnrealMCPBridge::ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+    uint32 ClientId, TOptional<EMCPCommandPriority> Priority)
+{
+    UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Executing command: %s"), *CommandType);
+    FMCPRequestRecorder::Get().Record(CommandType, Params, ClientId, Priority);
+    
+    // Metadata that hasn't changed since it was last built is answered from memory
+    FString CachedResponse;
+    if (ResponseCache.IsValid() && FUnrealMCPCommandRegistry::Get().IsCommandResultCacheable(CommandType)
+        && ResponseCache->Find(FMCPRequestCoalescer::MakeKey(CommandType, Params), CachedResponse))
+    {
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Served command %s from the response cache"), *CommandType);
+        FMCPMetrics::Get().RecordCacheHit(CommandType);
+        return MakeFulfilledPromise<FString>(MoveTemp(CachedResponse)).GetFuture();
+    }
+    
+    // Nothing but health checks is run until the startup asset scan is done; the client is told how long to wait
+    const bool bTransportThread = GetDispatchAffinity(CommandType) == EMCPThreadAffinity::TransportThread;
+    if (StartupWarmup.IsValid() && !bTransportThread && StartupWarmup->IsWarmingUp())
+    {
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Turned away command %s, editor is warming up"), *CommandType);
+        return MakeFulfilledPromise<FString>(SerializeResponseJson(StartupWarmup->MakeWarmingUpResponse())).GetFuture();
+    }
+    
+    // Reject work the editor can't keep up with right away, rather than letting it pile up; health
+    // checks stay exempt so clients can still check on a saturated server
+    if (!AdmissionController.IsValid() || bTransportThread)
+    {
+        return CoalesceOrDispatchCommand(CommandType, Params, CancellationToken, ClientId, Priority);
+    }
+    
+    int32 RetryAfterMs = 0;
+    if (!AdmissionController->TryAdmit(ClientId, RetryAfterMs))
+    {
+        UE_LOG(LogUnrealMCP, Warning, TEXT("UnrealMCPBridge: Rejected command %s from client %u, server busy (retry after %d ms)"), *CommandType, ClientId, RetryAfterMs);
+        return MakeFulfilledPromise<FString>(SerializeResponseJson(FMCPAdmissionController::MakeBusyResponse(RetryAfterMs))).GetFuture();
+    }
+    
+    TSharedPtr<FMCPAdmissionController> Admission = AdmissionController;
+    const double AdmitTime = FPlatformTime::Seconds();
+    return CoalesceOrDispatchCommand(CommandType, Params, CancellationToken, ClientId, Priority).Next(
+        [Admission, ClientId, AdmitTime](const FString& Response)
+        {
+            Admission->Release(ClientId, FPlatformTime::Seconds() - AdmitTime);
+            return Response;
+        });
+}
+
+int32 UUnrealMCPBridge::GetQueuedCommandCount() const
+{
+    return CommandScheduler.IsValid() ? CommandScheduler->GetQueuedCount() : 0;
+}
+
+int32 UUnrealMCPBridge::GetInFlightCommandCount() const
+{
+    return AdmissionController.IsValid() ? AdmissionController->GetInFlightCount() : 0;
+}
+
+TSharedRef<FJsonObject> UUnrealMCPBridge::MakeHealthSnapshot() const
+{
+    TSharedRef<FJsonObject> Health = MakeShared<FJsonObject>();
+
+    // Queue depth, so orchestrators can throttle before hitting the admission limits
+    Health->SetNumberField(TEXT("queued_commands"), GetQueuedCommandCount());
+    Health->SetNumberField(TEXT("in_flight_commands"), GetInFlightCommandCount());
+    const bool bWarmingUp = StartupWarmup.IsValid() && StartupWarmup->IsWarmingUp();
+    Health->SetBoolField(TEXT("warming_up"), bWarmingUp);
+    if (bWarmingUp)
+    {
+        Health->SetNumberField(TEXT("eta_ms"), StartupWarmup->GetEstimatedRemainingMs());
+    }
+
+    // A game thread busy compiling or loading stops ticking the scheduler; the process is still alive
+    const double SecondsSinceTick = CommandScheduler.IsValid() ? CommandScheduler->GetSecondsSinceLastTick() : -1.0;
+    const bool bStalled = SecondsSinceTick >= GameThreadStallSeconds;
+    Health->SetNumberField(TEXT("game_thread_tick_age_ms"), SecondsSinceTick >= 0.0 ? FMath::RoundToInt64(SecondsSinceTick * 1000.0) : -1);
+    Health->SetBoolField(TEXT("game_thread_stalled"), bStalled);
+    Health->SetStringField(TEXT("state"), bStalled ? TEXT("stalled") : bWarmingUp ? TEXT("warming_up") : TEXT("ok"));
+    return Health;
+}
+
+TFuture<FString> UUnrealMCPBridge::CoalesceOrDispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+    uint32 ClientId, TOptional<EMCPCommandPriority> Priority)
+{
+    if (!RequestCoalescer.IsValid() || !FUnrealMCPCommandRegistry::Get().IsCommandReadOnly(CommandType))
+    {
+        return DispatchCommand(CommandType, Params, CancellationToken, ClientId, Priority);
+    }
+    
+    // Identical read-only requests already in flight answer this one too
+    const FString CoalescingKey = FMCPRequestCoalescer::MakeKey(CommandType, Params);
+    TFuture<FString> SharedFuture;
+    if (RequestCoalescer->Join(CoalescingKey, CancellationToken, ClientId, SharedFuture))
+    {
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Coalesced command %s with an identical request in flight"), *CommandType);
+        return SharedFuture;
+    }
+    
+    TSharedPtr<FMCPRequestCoalescer> Coalescer = RequestCoalescer;
+    return DispatchCommand(CommandType, Params, CancellationToken, ClientId, Priority).Next(
+        [this, Coalescer, CoalescingKey, CommandType, Params, CancellationToken, Priority](const FString& Response)
+        {
+            const bool bLeaderCancelled = CancellationToken.IsValid() && CancellationToken->IsCancelled();
+            for (FMCPRequestCoalescer::FFollower& Follower : Coalescer->Complete(CoalescingKey))
+            {
+                const bool bFollowerCancelled = Follower.CancellationToken.IsValid() && Follower.CancellationToken->IsCancelled();
+                if (bLeaderCancelled && !bFollowerCancelled)
+                {
+                    // The leader's client gave up, so its response is only a "cancelled" error; run the
+                    // command again for followers that still want the result
+                    TSharedRef<TPromise<FString>> FollowerPromise = MakeShared<TPromise<FString>>(MoveTemp(Follower.Promise));
+                    DispatchCommand(CommandType, Params, Follower.CancellationToken, Follower.ClientId, Priority).Next([FollowerPromise](const FString& FollowerResponse)
+                    {
+                        FollowerPromise->SetValue(FollowerResponse);
+                    });
+                }
+                else
+                {
+                    Follower.Promise.SetValue(Response);
+                }
+            }
+            return Response;
+        });
+}
+
+TFuture<FString> UUnrealMCPBridge::DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+    uint32 ClientId, TOptional<EMCPCommandPriority> Priority)
+{
+    MCP_TRACE_SCOPE("MCP::Dispatch");
     
     // Create a promise to wait for the result
     TPromise<FString> Promise;
     TFuture<FString> Future = Promise.GetFuture();
+    const double DispatchTime = FPlatformTime::Seconds();
+    
+    // Commands that touch no editor state, or only wait for work they hand to the game thread, run
+    // on a worker so they don't wait behind, or hold up, the game thread; everything else waits its
+    // turn in the game-thread scheduler
+    const EMCPThreadAffinity Affinity = GetDispatchAffinity(CommandType);
+    
+    // Health checks answer right here, so their latency does not depend on any queue
+    if (Affinity == EMCPThreadAffinity::TransportThread)
+    {
+        Promise.SetValue(ExecuteCommandOnCurrentThread(CommandType, Params, CancellationToken, DispatchTime));
+        return Future;
+    }
+    
+    if (Affinity == EMCPThreadAffinity::GameThreadRequired && CommandScheduler.IsValid())
+    {
+        CommandScheduler->Enqueue(ClientId, Priority.Get(FMCPCommandScheduler::GetDefaultPriority(CommandType)),
+            [this, CommandType, Params, CancellationToken, DispatchTime, Promise = MoveTemp(Promise)]() mutable
+            {
+                Promise.SetValue(ExecuteCommandOnCurrentThread(CommandType, Params, CancellationToken, DispatchTime));
+            });
+        return Future;
+    }
+    
+    const ENamedThreads::Type Thread = Affinity == EMCPThreadAffinity::GameThreadRequired
+        ? ENamedThreads::GameThread
+        : ENamedThreads::AnyBackgroundThreadNormalTask;
+    
+    AsyncTask(Thread, [this, CommandType, Params, CancellationToken, Affinity, DispatchTime, Promise = MoveTemp(Promise)]() mutable
+    {
+        if (Affinity == EMCPThreadAffinity::AssetRegistryOnly)
+        {
+            // Asset registry queries are thread-safe, but the class lookups around them must not
+            // overlap garbage collection
+            FGCScopeGuard GCGuard;
+            Promise.SetValue(ExecuteCommandOnCurrentThread(CommandType, Params, CancellationToken, DispatchTime));
+        }
+        else
+        {
+            Promise.SetValue(ExecuteCommandOnCurrentThread(CommandType, Params, CancellationToken, DispatchTime));
+        }
+    });
+    
+    return Future;
+}
+
+FString UUnrealMCPBridge::ExecuteCommandOnCurrentThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+    double DispatchTime)
+{
+    MCP_TRACE_SCOPE("MCP::ExecuteCommand");
+    const double StartTime = FPlatformTime::Seconds();
+    const FMCPSlowCommandLog::FExecutionId SlowLogId = FMCPSlowCommandLog::Get().BeginExecution();
+    const int64 UsedMemoryBefore = FMCPMetrics::SampleUsedMemory();
+    TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
     
-    // Queue execution on Game Thread
-    AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
+    // Failures that are only a message (unknown commands, "not found" errors) skip the response object
+    // and are written from a template
+    bool bErrorOnly = false;
+    FString ErrorOnlyMessage;
+    
+    // Read before running, so a change made while the command runs keeps its response out of the cache
+    const uint64 CacheGeneration = ResponseCache.IsValid() ? ResponseCache->GetGeneration() : 0;
+    bool bCacheResponse = false;
+    
+    // Drop requests the client gave up on while they were queued behind other work
+    if (CancellationToken.IsValid() && CancellationToken->IsCancelled())
     {
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
+        UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Skipping command %s: %s"), *CommandType, *CancellationToken->GetReason());
+        ResponseJson = CancellationToken->MakeErrorResponse();
+    }
+    else
+    {
+        // Long-running commands poll FMCPCancellationToken::IsCurrentRequestCancelled() through this
+        FMCPCancellationScope CancellationScope(CancellationToken);
+        LLM_SCOPE_BYTAG(UnrealMCP_Commands);
         
         try
         {
             TSharedPtr<FJsonObject> ResultJson;
             
-            if (CommandType == TEXT("ping"))
+            if (IsBridgeCommand(CommandType))
             {
-                ResultJson = MakeShareable(new FJsonObject);
-                ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                ResultJson = MakeHealthSnapshot();
+                if (CommandType == TEXT("ping"))
+                {
+                    ResultJson->SetStringField(TEXT("message"), TEXT("pong"));
+                }
             }
             else
             {
-                // Define command arrays for better maintenance
-                static const TArray<FString> EditorCommands = {
-                    TEXT("spawn_actor"),
-                    TEXT("create_actor"),
-                    TEXT("delete_actor"),
-                    TEXT("set_actor_transform"),
-                    TEXT("get_actor_properties"),
-                    TEXT("set_actor_property"),
-                    TEXT("set_light_property"),
-                    TEXT("spawn_blueprint_actor"),
-                    TEXT("focus_viewport"),
-                    TEXT("take_screenshot"),
-                    TEXT("get_level_metadata")
-                };
-                
-                static const TArray<FString> BlueprintCommandsList = {
-                    TEXT("create_blueprint"), 
-                    TEXT("add_component_to_blueprint"), 
-                    TEXT("modify_blueprint_component_properties"), 
-                    TEXT("set_physics_properties"), 
-                    TEXT("compile_blueprint"), 
-                    TEXT("set_blueprint_property"), 
-                    TEXT("set_static_mesh_properties"),
-                    TEXT("set_pawn_properties"),
-                    TEXT("call_function_by_name"),
-                    TEXT("add_interface_to_blueprint"),
-                    TEXT("create_blueprint_interface"),
-                    TEXT("create_custom_blueprint_function")
-                };
-                
-                static const TArray<FString> BlueprintNodeCommandsList = {
-                    TEXT("connect_blueprint_nodes"), 
-                    TEXT("find_blueprint_nodes"),
-                    TEXT("add_blueprint_event_node"),
-                    // TEXT("add_blueprint_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
-                    // TEXT("add_enhanced_input_action_node"),  // REMOVED: Use create_node_by_action_name instead
-                    TEXT("add_blueprint_function_node"),
-                    TEXT("add_blueprint_get_component_node"),
-                    TEXT("add_blueprint_variable"),
-                    TEXT("add_blueprint_custom_event_node"),
-                    TEXT("get_variable_info"),
-                    TEXT("create_node_by_action_name")
-                };
-                
-                static const TArray<FString> ProjectCommandsList = {
-                    TEXT("create_input_mapping"),
-                    TEXT("create_enhanced_input_action"),
-                    TEXT("create_input_mapping_context"),
-                    TEXT("add_mapping_to_context"),
-                    TEXT("create_folder"),
-                    TEXT("create_struct"),
-                    TEXT("update_struct"),
-                    TEXT("get_project_dir"),
-                    TEXT("get_project_metadata")
-                };
-                
-                static const TArray<FString> UMGCommandsList = {
-                    TEXT("create_umg_widget_blueprint"),
-                    TEXT("bind_widget_component_event"),
-                    TEXT("set_text_block_widget_component_binding"),
-                    TEXT("add_child_widget_component_to_parent"),
-                    TEXT("set_widget_component_placement"),
-                    TEXT("add_widget_component_to_widget"),
-                    TEXT("set_widget_component_property"),
-                    TEXT("get_widget_blueprint_metadata"),
-                    TEXT("capture_widget_screenshot")
-                };
-                
-                static const TArray<FString> BlueprintActionCommandsList = {
-                    TEXT("get_actions_for_pin"),
-                    TEXT("get_actions_for_class"),
-                    TEXT("get_node_pin_info"),
-                    TEXT("create_node_by_action_name")
-                };
-                
-                // First check the new command registry system
-                FUnrealMCPCommandRegistry& CommandRegistry = FUnrealMCPCommandRegistry::Get();
-                if (CommandRegistry.IsCommandRegistered(CommandType))
+                // One lookup in the registry's dispatch table; legacy handler classes are registered
+                // there too. Hand the parsed params straight to the command; typed commands return their
+                // result object directly, string-based ones are serialized/parsed by the adapter
+                FMCPResponseWriter CommandResponse;
+                if (!FUnrealMCPCommandRegistry::Get().ExecuteCommand(CommandType, Params.ToSharedRef(), CommandResponse))
                 {
-                    // Convert TSharedPtr<FJsonObject> to JSON string for new command interface
-                    FString ParamsString;
-                    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ParamsString);
-                    FJsonSerializer::Serialize(Params.ToSharedRef(), Writer.Get());
-                    
-                    // Execute command through new registry
-                    FString CommandResult = CommandRegistry.ExecuteCommand(CommandType, ParamsString);
-                    
-                    // Parse result back to JSON object
-                    TSharedPtr<FJsonObject> ParsedResult;
-                    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CommandResult);
-                    if (FJsonSerializer::Deserialize(Reader, ParsedResult) && ParsedResult.IsValid())
-                    {
-                        ResultJson = ParsedResult;
-                    }
-                    else
+                    bErrorOnly = true;
+                    ErrorOnlyMessage = TEXT("Unknown command: ");
+                    ErrorOnlyMessage += CommandType;
+                }
+                else if (const FString* PlainError = CommandResponse.GetPlainError())
+                {
+                    bErrorOnly = true;
+                    ErrorOnlyMessage = *PlainError;
+                }
+                else
+                {
+                    ResultJson = CommandResponse.GetResultObject();
+                    if (!ResultJson.IsValid())
                     {
                         // If parsing fails, create error response
                         ResultJson = MakeShared<FJsonObject>();
@@ -340,92 +718,120 @@ FString UUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const TShar
                         ResultJson->SetStringField(TEXT("error"), TEXT("Failed to parse command result"));
                     }
                 }
-                // Fall back to legacy command handlers
-                else if (EditorCommands.Contains(CommandType))
-                {
-                    ResultJson = this->EditorCommands->HandleCommand(CommandType, Params);
-                }
-                else if (BlueprintCommandsList.Contains(CommandType))
-                {
-                    ResultJson = BlueprintCommands->HandleCommand(CommandType, Params);
-                }
-                else if (BlueprintNodeCommandsList.Contains(CommandType))
-                {
-                    ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
-                }
-                else if (ProjectCommandsList.Contains(CommandType))
+            }
+            
+            if (ResultJson.IsValid())
+            {
+                // Check if the result contains an error
+                bool bSuccess = true;
+                bool bHasErrorField = false;
+                FString ErrorMessage;
+                
+                if (ResultJson->HasField(TEXT("success")))
                 {
-                    ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
+                    bSuccess = ResultJson->GetBoolField(TEXT("success"));
+                    if (!bSuccess && ResultJson->HasField(TEXT("error")))
+                    {
+                        ErrorMessage = ResultJson->GetStringField(TEXT("error"));
+                        bHasErrorField = true;
+                    }
                 }
-                else if (UMGCommandsList.Contains(CommandType))
+                
+                if (!bSuccess && ResultJson->Values.Num() == (bHasErrorField ? 2 : 1))
                 {
-                    ResultJson = UMGCommands->HandleCommand(CommandType, Params);
+                    // Nothing beyond "success" and "error" to carry over
+                    bErrorOnly = true;
+                    ErrorOnlyMessage = MoveTemp(ErrorMessage);
                 }
-                else if (BlueprintActionCommandsList.Contains(CommandType))
+                else if (bSuccess)
                 {
-                    ResultJson = BlueprintActionCommands->HandleCommand(CommandType, Params);
+                    // Set success status and include the result
+                    ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
+                    ResponseJson->SetObjectField(TEXT("result"), ResultJson);
+                    bCacheResponse = FUnrealMCPCommandRegistry::Get().IsCommandResultCacheable(CommandType);
                 }
                 else
                 {
+                    // Set error status and preserve ALL fields from the command result
                     ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                    ResponseJson->SetStringField(TEXT("error"), FString::Printf(TEXT("Unknown command: %s"), *CommandType));
+                    ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
                     
-                    FString ResultString;
-                    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
-                    FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer.Get());
-                    Promise.SetValue(ResultString);
-                    return;
-                }
-            }
-            
-            // Check if the result contains an error
-            bool bSuccess = true;
-            FString ErrorMessage;
-            
-            if (ResultJson->HasField(TEXT("success")))
-            {
-                bSuccess = ResultJson->GetBoolField(TEXT("success"));
-                if (!bSuccess && ResultJson->HasField(TEXT("error")))
-                {
-                    ErrorMessage = ResultJson->GetStringField(TEXT("error"));
-                }
-            }
-            
-            if (bSuccess)
-            {
-                // Set success status and include the result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                ResponseJson->SetObjectField(TEXT("result"), ResultJson);
-            }
-            else
-            {
-                // Set error status and preserve ALL fields from the command result
-                ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-                ResponseJson->SetStringField(TEXT("error"), ErrorMessage);
-                
-                // Copy all additional fields from ResultJson to ResponseJson (e.g., compilation_errors)
-                for (const auto& Pair : ResultJson->Values)
-                {
-                    const FString& Key = Pair.Key;
-                    // Skip 'success' and 'error' as we already handled them
-                    if (Key != TEXT("success") && Key != TEXT("error"))
+                    // Copy all additional fields from ResultJson to ResponseJson (e.g., compilation_errors)
+                    ResponseJson->Values.Reserve(ResultJson->Values.Num());
+                    for (const auto& Pair : ResultJson->Values)
                     {
-                        ResponseJson->SetField(Key, Pair.Value);
+                        const FString& Key = Pair.Key;
+                        // Skip 'success' and 'error' as we already handled them
+                        if (Key != TEXT("success") && Key != TEXT("error"))
+                        {
+                            ResponseJson->SetField(Key, Pair.Value);
+                        }
                     }
                 }
             }
         }
         catch (const std::exception& e)
         {
-            ResponseJson->SetStringField(TEXT("status"), TEXT("error"));
-            ResponseJson->SetStringField(TEXT("error"), UTF8_TO_TCHAR(e.what()));
+            bErrorOnly = true;
+            ErrorOnlyMessage = UTF8_TO_TCHAR(e.what());
         }
         
-        FString ResultString;
-        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ResultString);
-        FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer.Get());
-        Promise.SetValue(ResultString);
-    });
+        // A command that stopped early because of cancellation may have left a partial result
+        if (CancellationToken.IsValid() && CancellationToken->IsCancelled())
+        {
+            UE_LOG(LogUnrealMCP, Verbose, TEXT("UnrealMCPBridge: Command %s finished after cancellation: %s"), *CommandType, *CancellationToken->GetReason());
+            ResponseJson = CancellationToken->MakeErrorResponse();
+            bCacheResponse = false;
+            bErrorOnly = false;
+        }
+        
+        // Anything that may have edited assets, even if it failed part-way, makes cached metadata stale
+        if (ResponseCache.IsValid() && !IsBridgeCommand(CommandType) && !FUnrealMCPCommandRegistry::Get().IsCommandReadOnly(CommandType))
+        {
+            ResponseCache->Invalidate();
+        }
+
+        // Journal the command's Blueprint edits under its name before the next request can ask for them
+        if (IsInGameThread() && !IsBridgeCommand(CommandType) && !FUnrealMCPCommandRegistry::Get().IsCommandReadOnly(CommandType))
+        {
+            FBlueprintChangeJournal::Get().FlushPendingChanges(CommandType);
+        }
+    }
     
-    return Future.Get();
-}
\ No newline at end of file
+    FMCPMetrics::Get().RecordMemory(CommandType, UsedMemoryBefore, FMCPMetrics::SampleUsedMemory());
+
+    const double SerializeStartTime = FPlatformTime::Seconds();
+    FString ResultString;
+    FString Status;
+    if (bErrorOnly)
+    {
+        ResultString = SerializeErrorResponse(ErrorOnlyMessage);
+        Status = TEXT("error");
+    }
+    else
+    {
+        ResultString = SerializeResponseJson(ResponseJson.ToSharedRef());
+        ResponseJson->TryGetStringField(TEXT("status"), Status);
+    }
+    FMCPSlowCommandLog::FTimings Timings;
+    Timings.QueueWaitSeconds = DispatchTime > 0.0 ? StartTime - DispatchTime : 0.0;
+    Timings.ExecuteSeconds = SerializeStartTime - StartTime;
+    Timings.SerializeSeconds = FPlatformTime::Seconds() - SerializeStartTime;
+    FMCPMetrics::Get().RecordExecution(CommandType, Timings.QueueWaitSeconds, Timings.ExecuteSeconds, Timings.SerializeSeconds,
+        Status != TEXT("success"));
+    FMCPSlowCommandLog::Get().EndExecution(SlowLogId, CommandType, Params, Timings, Status != TEXT("success"));
+    
+    if (bCacheResponse)
+    {
+        ResponseCache->Store(FMCPRequestCoalescer::MakeKey(CommandType, Params), ResultString, CacheGeneration);
+    }
+
+    FMCPAssetPrefetcher::Get().RecordAccess(Params);
+
+    // What the command cached counts against the budget before the next one runs
+    if (IsInGameThread())
+    {
+        FMCPCacheBudget::Get().EnforceBudget();
+    }
+    return ResultString;
+}
@@ -0,0 +1,102 @@
+#include "UnrealMCPCommandlet.h"
+#include "UnrealMCPBridge.h"
+#include "MCPLogging.h"
+#include "Editor.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Parse.h"
+#include "Tickable.h"
+#include "TickableEditorObject.h"
+
+UUnrealMCPCommandlet::UUnrealMCPCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+    ShowErrorCount = false;
+}
+
+int32 UUnrealMCPCommandlet::Main(const FString& Params)
+{
+    UUnrealMCPBridge* Bridge = GEditor ? GEditor->GetEditorSubsystem<UUnrealMCPBridge>() : nullptr;
+    if (!Bridge)
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPCommandlet: The MCP bridge subsystem is not available; run from UnrealEditor-Cmd"));
+        return 1;
+    }
+    if (!Bridge->IsRunning())
+    {
+        UE_LOG(LogUnrealMCP, Error, TEXT("UnrealMCPCommandlet: The MCP server failed to start; see the log for the bind error"));
+        return 1;
+    }
+
+    int32 TickIntervalMs = 5;
+    double MaxRuntime = 0.0;
+    double ExitWhenIdle = 0.0;
+    FParse::Value(*Params, TEXT("TickIntervalMs="), TickIntervalMs);
+    FParse::Value(*Params, TEXT("MaxRuntime="), MaxRuntime);
+    FParse::Value(*Params, TEXT("ExitWhenIdle="), ExitWhenIdle);
+    TickIntervalMs = FMath::Max(TickIntervalMs, 0);
+
+    // Commandlets don't scan the project on their own; the bridge holds commands back until the scan is done
+    if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+    {
+        AssetRegistry->SearchAllAssets(false);
+    }
+
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPCommandlet: Serving MCP commands headless (tick interval %d ms)"), TickIntervalMs);
+
+    const double StartTime = FPlatformTime::Seconds();
+    double LastTickTime = StartTime;
+    double LastBusyTime = StartTime;
+    bool bServedCommand = false;
+
+    while (!IsEngineExitRequested())
+    {
+        const double Now = FPlatformTime::Seconds();
+        const float DeltaTime = static_cast<float>(Now - LastTickTime);
+        LastTickTime = Now;
+
+        // What the editor's frame would otherwise tick: game thread tasks, the core ticker
+        // (command scheduler, compile and save queues, startup warmup) and the asset registry scan
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(DeltaTime);
+        FTickableGameObject::TickObjects(nullptr, LEVELTICK_All, false, DeltaTime);
+        FTickableEditorObject::TickObjects(DeltaTime);
+        if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+        {
+            AssetRegistry->Tick(DeltaTime);
+        }
+        GEngine->TickDeferredCommands();
+        FCoreDelegates::OnEndFrame.Broadcast();
+        GLog->FlushThreadedLogs();
+
+        if (Bridge->GetInFlightCommandCount() > 0 || Bridge->GetQueuedCommandCount() > 0)
+        {
+            bServedCommand = true;
+            LastBusyTime = Now;
+        }
+
+        if (MaxRuntime > 0.0 && Now - StartTime >= MaxRuntime)
+        {
+            UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPCommandlet: Reached the %.0f second runtime limit"), MaxRuntime);
+            break;
+        }
+        if (ExitWhenIdle > 0.0 && bServedCommand && Now - LastBusyTime >= ExitWhenIdle)
+        {
+            UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPCommandlet: Idle for %.0f seconds, exiting"), ExitWhenIdle);
+            break;
+        }
+
+        FPlatformProcess::Sleep(TickIntervalMs / 1000.0f);
+    }
+
+    // The bridge subsystem stops the server and flushes the compile and save queues on engine shutdown
+    UE_LOG(LogUnrealMCP, Display, TEXT("UnrealMCPCommandlet: Stopping after %.1f seconds"), FPlatformTime::Seconds() - StartTime);
+    return 0;
+}
@@ -1,7 +1,5 @@
 #include "UnrealMCPModule.h"
 #include "UnrealMCPBridge.h"
-#include "Factories/ComponentFactory.h"
-#include "Factories/WidgetFactory.h"
 #include "Services/ObjectPoolManager.h"
 #include "Commands/UnrealMCPMainDispatcher.h"
 #include "MCPLogging.h"
@@ -18,6 +16,7 @@ void FUnrealMCPModule::StartupModule()
 	FMCPLogger::SetDebugLoggingEnabled(true); // Enable debug logging for development
 	
 	UE_LOG_MCP_INFO("Unreal MCP Module startup initiated");
+	const double StartTime = FPlatformTime::Seconds();
 	
 	// Initialize the ObjectPoolManager for performance optimization
 	FObjectPoolManager& PoolManager = FObjectPoolManager::Get();
@@ -25,24 +24,13 @@ void FUnrealMCPModule::StartupModule()
 	
 	UE_LOG_MCP_INFO("ObjectPoolManager initialized with object pools");
 	
-	// Initialize the ComponentFactory with default types
-	FComponentFactory& ComponentFactory = FComponentFactory::Get();
-	ComponentFactory.InitializeDefaultTypes();
-	
-	UE_LOG_MCP_INFO("ComponentFactory initialized with default component types");
-	
-	// Initialize the WidgetFactory with default types
-	FWidgetFactory& WidgetFactory = FWidgetFactory::Get();
-	WidgetFactory.InitializeDefaultWidgetTypes();
-	
-	UE_LOG_MCP_INFO("WidgetFactory initialized with default widget types");
-	
-	// Initialize the command dispatcher and registry
+	// The component and widget factories register their default types on first lookup, and
+	// commands are registered by name and constructed on first use, so nothing else is built here
 	FUnrealMCPMainDispatcher& Dispatcher = FUnrealMCPMainDispatcher::Get();
 	Dispatcher.Initialize();
 	
 	UE_LOG_MCP_INFO("Command dispatcher initialized with registered commands");
-	UE_LOG_MCP_INFO("Unreal MCP Module startup completed successfully");
+	UE_LOG_MCP_INFO("Unreal MCP Module startup completed in %.1f ms", (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 void FUnrealMCPModule::ShutdownModule()
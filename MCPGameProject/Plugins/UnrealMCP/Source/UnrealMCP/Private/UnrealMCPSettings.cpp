@@ -0,0 +1,54 @@
+#include "UnrealMCPSettings.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+    template <typename ValueType>
+    void SetConsoleVariable(const TCHAR* Name, ValueType Value)
+    {
+        if (IConsoleVariable* ConsoleVariable = IConsoleManager::Get().FindConsoleVariable(Name))
+        {
+            // At project setting priority, so console commands and [ConsoleVariables] still override it
+            ConsoleVariable->Set(Value, ECVF_SetByProjectSetting);
+        }
+    }
+}
+
+UUnrealMCPSettings::UUnrealMCPSettings()
+    : ServerPort(55557)
+    , BindAddress(TEXT("127.0.0.1"))
+    , MaxConcurrentConnections(16)
+    , SocketBufferSizeKB(64)
+    , FrameBudgetMs(8.0f)
+    , MaxInFlightCommands(256)
+    , MaxInFlightCommandsPerClient(64)
+    , MaxParallelBatchOperations(4)
+    , ResponseCacheSizeMB(64)
+    , CacheMemoryBudgetMB(256)
+{
+}
+
+void UUnrealMCPSettings::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    if (HasAnyFlags(RF_ClassDefaultObject))
+    {
+        ApplyConsoleVariables();
+    }
+}
+
+#if WITH_EDITOR
+void UUnrealMCPSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    ApplyConsoleVariables();
+}
+#endif
+
+void UUnrealMCPSettings::ApplyConsoleVariables() const
+{
+    SetConsoleVariable(TEXT("mcp.FrameBudgetMs"), FrameBudgetMs);
+    SetConsoleVariable(TEXT("mcp.MaxInFlightCommands"), MaxInFlightCommands);
+    SetConsoleVariable(TEXT("mcp.MaxInFlightCommandsPerClient"), MaxInFlightCommandsPerClient);
+}
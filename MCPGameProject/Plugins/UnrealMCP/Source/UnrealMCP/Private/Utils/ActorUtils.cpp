@@ -1,7 +1,7 @@
 #include "Utils/ActorUtils.h"
 #include "GameFramework/Actor.h"
 #include "Editor.h"
-#include "EngineUtils.h"
+#include "Services/ActorIndex.h"
 
 TSharedPtr<FJsonValue> FActorUtils::ActorToJson(AActor* Actor)
 {
@@ -78,15 +78,7 @@ AActor* FActorUtils::FindActorByName(const FString& ActorName)
     UWorld* World = GEditor->GetEditorWorldContext().World();
     if (!World) return nullptr;
 
-    for (TActorIterator<AActor> It(World); It; ++It)
-    {
-        AActor* Actor = *It;
-        if (Actor && Actor->GetName() == ActorName)
-        {
-            return Actor;
-        }
-    }
-    return nullptr;
+    return FActorIndex::Get().FindActorByName(World, ActorName);
 }
 
 bool FActorUtils::CallFunctionByName(UObject* Target, const FString& FunctionName, const TArray<FString>& StringParams, FString& OutError)
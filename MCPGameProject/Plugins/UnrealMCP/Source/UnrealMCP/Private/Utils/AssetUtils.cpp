@@ -5,6 +5,7 @@
 #include "WidgetBlueprint.h"
 #include "Engine/Blueprint.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Services/AssetSearchIndex.h"
 
 // Helper method implementations
 TArray<FString> FAssetUtils::FindAssetsByType(const FString& AssetType, const FString& SearchPath)
@@ -37,6 +38,11 @@ TArray<FString> FAssetUtils::FindAssetsByName(const FString& AssetName, const FS
 {
     TArray<FString> FoundAssets;
 
+    if (FAssetSearchIndex::Get().FindObjectPaths(AssetName, {}, SearchPath, FoundAssets))
+    {
+        return FoundAssets;
+    }
+
     // Get the Asset Registry
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -67,6 +73,11 @@ TArray<FString> FAssetUtils::FindWidgetBlueprints(const FString& WidgetName, con
 {
     TArray<FString> FoundWidgets;
 
+    if (FAssetSearchIndex::Get().FindObjectPaths(WidgetName, { UWidgetBlueprint::StaticClass()->GetClassPathName() }, SearchPath, FoundWidgets))
+    {
+        return FoundWidgets;
+    }
+
     // Get the Asset Registry
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
@@ -5,9 +5,11 @@
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_VariableGet.h"
+#include "K2Node_FunctionResult.h"
 #include "EdGraphSchema_K2.h"
 #include "Engine/Blueprint.h"
 #include "Serialization/JsonSerializer.h"
+#include "Services/GraphReachabilityCache.h"
 
 bool FGraphUtils::ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode* SourceNode, const FString& SourcePinName,
                                    UEdGraphNode* TargetNode, const FString& TargetPinName)
@@ -231,233 +233,109 @@ bool FGraphUtils::IsPureNode(UEdGraphNode* Node)
     return true;
 }
 
-void FGraphUtils::TraceExecutionFlow(const TArray<UEdGraphNode*>& EntryPoints, TSet<UEdGraphNode*>& OutReachableNodes)
+bool FGraphUtils::DetectOrphanedNodes(UEdGraph* Graph, TArray<FString>& OutOrphanedNodeIds)
 {
-    OutReachableNodes.Empty();
-
-    // BFS to trace execution flow
-    TQueue<UEdGraphNode*> Queue;
+    OutOrphanedNodeIds.Empty();
 
-    // Add all entry points to the queue
-    for (UEdGraphNode* Entry : EntryPoints)
+    if (!Graph)
     {
-        if (Entry)
-        {
-            Queue.Enqueue(Entry);
-            OutReachableNodes.Add(Entry);
-        }
+        return false;
     }
 
-    while (!Queue.IsEmpty())
+    const FGraphReachabilityCache::FAnalysis& Analysis = FGraphReachabilityCache::Get().Analyze(Graph);
+    OutOrphanedNodeIds.Reserve(Analysis.OrphanedNodes.Num());
+    for (const FGraphReachabilityCache::FOrphanedNode& Orphan : Analysis.OrphanedNodes)
     {
-        UEdGraphNode* Current;
-        Queue.Dequeue(Current);
-
-        // Follow all output execution pins
-        for (UEdGraphPin* Pin : Current->Pins)
+        if (UEdGraphNode* Node = Orphan.Node.Get())
         {
-            if (Pin &&
-                Pin->Direction == EGPD_Output &&
-                Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-            {
-                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-                {
-                    if (LinkedPin)
-                    {
-                        UEdGraphNode* ConnectedNode = LinkedPin->GetOwningNode();
-                        if (ConnectedNode && !OutReachableNodes.Contains(ConnectedNode))
-                        {
-                            OutReachableNodes.Add(ConnectedNode);
-                            Queue.Enqueue(ConnectedNode);
-                        }
-                    }
-                }
-            }
+            OutOrphanedNodeIds.Add(GetReliableNodeId(Node));
         }
     }
-}
-
-void FGraphUtils::TraceDataDependencies(const TSet<UEdGraphNode*>& ExecReachableNodes, TSet<UEdGraphNode*>& OutDataDependencies)
-{
-    OutDataDependencies.Empty();
 
-    // For each exec-reachable node, trace backward through data pins
-    TQueue<UEdGraphNode*> Queue;
-    TSet<UEdGraphNode*> Visited;
-
-    // Start with all exec-reachable nodes
-    for (UEdGraphNode* Node : ExecReachableNodes)
-    {
-        Queue.Enqueue(Node);
-        Visited.Add(Node);
-    }
-
-    while (!Queue.IsEmpty())
-    {
-        UEdGraphNode* Current;
-        Queue.Dequeue(Current);
-
-        // Follow all input data pins (not exec pins)
-        for (UEdGraphPin* Pin : Current->Pins)
-        {
-            if (Pin &&
-                Pin->Direction == EGPD_Input &&
-                Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
-            {
-                for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-                {
-                    if (LinkedPin)
-                    {
-                        UEdGraphNode* ConnectedNode = LinkedPin->GetOwningNode();
-                        if (ConnectedNode && !Visited.Contains(ConnectedNode))
-                        {
-                            Visited.Add(ConnectedNode);
-                            // Add to dependencies if it's a pure node
-                            // (non-pure nodes should already be in ExecReachableNodes if reachable)
-                            if (IsPureNode(ConnectedNode))
-                            {
-                                OutDataDependencies.Add(ConnectedNode);
-                                // Continue tracing from this pure node
-                                Queue.Enqueue(ConnectedNode);
-                            }
-                        }
-                    }
-                }
-            }
-        }
-    }
+    return true;
 }
 
-bool FGraphUtils::DetectOrphanedNodes(UEdGraph* Graph, TArray<FString>& OutOrphanedNodeIds)
+bool FGraphUtils::GetOrphanedNodesInfo(UEdGraph* Graph, TArray<TSharedPtr<FJsonObject>>& OutOrphanedNodes)
 {
-    OutOrphanedNodeIds.Empty();
+    OutOrphanedNodes.Empty();
 
     if (!Graph)
     {
         return false;
     }
 
-    // Step 1: Find all entry points
-    TArray<UEdGraphNode*> EntryPoints;
-    for (UEdGraphNode* Node : Graph->Nodes)
-    {
-        if (Node && IsEntryPoint(Node))
-        {
-            EntryPoints.Add(Node);
-        }
-    }
-
-    // If no entry points found, we can't determine orphans
-    // (this might be a macro library or other special graph type)
-    if (EntryPoints.Num() == 0)
-    {
-        UE_LOG(LogTemp, Display, TEXT("DetectOrphanedNodes: No entry points found in graph '%s'"), *Graph->GetName());
-        return true;
-    }
-
-    // Step 2: Trace execution flow forward from entry points
-    TSet<UEdGraphNode*> ExecReachableNodes;
-    TraceExecutionFlow(EntryPoints, ExecReachableNodes);
-
-    // Step 3: Trace data dependencies backward from exec-reachable nodes
-    TSet<UEdGraphNode*> DataDependencies;
-    TraceDataDependencies(ExecReachableNodes, DataDependencies);
-
-    // Step 4: Combine all reachable nodes
-    TSet<UEdGraphNode*> AllReachableNodes = ExecReachableNodes;
-    AllReachableNodes.Append(DataDependencies);
-
-    // Step 5: Find orphaned nodes (not in reachable set)
-    for (UEdGraphNode* Node : Graph->Nodes)
+    const FGraphReachabilityCache::FAnalysis& Analysis = FGraphReachabilityCache::Get().Analyze(Graph);
+    for (const FGraphReachabilityCache::FOrphanedNode& Orphan : Analysis.OrphanedNodes)
     {
+        UEdGraphNode* Node = Orphan.Node.Get();
         if (!Node)
         {
             continue;
         }
 
-        // Skip comment nodes - they're not executable but not "orphaned"
-        FString NodeClassName = Node->GetClass()->GetName();
-        if (NodeClassName.Contains(TEXT("Comment")))
-        {
-            continue;
-        }
+        TSharedPtr<FJsonObject> NodeInfo = MakeShared<FJsonObject>();
+        NodeInfo->SetStringField(TEXT("node_id"), GetReliableNodeId(Node));
+        NodeInfo->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+        NodeInfo->SetStringField(TEXT("class"), Node->GetClass()->GetName());
+        NodeInfo->SetNumberField(TEXT("pos_x"), Node->NodePosX);
+        NodeInfo->SetNumberField(TEXT("pos_y"), Node->NodePosY);
+        NodeInfo->SetBoolField(TEXT("pure"), Orphan.bPure);
 
-        if (!AllReachableNodes.Contains(Node))
-        {
-            OutOrphanedNodeIds.Add(GetReliableNodeId(Node));
-        }
-    }
+        // Connection counts show whether it is linked to other orphans
+        NodeInfo->SetNumberField(TEXT("input_connections"), Orphan.InputConnections);
+        NodeInfo->SetNumberField(TEXT("output_connections"), Orphan.OutputConnections);
 
-    UE_LOG(LogTemp, Display, TEXT("DetectOrphanedNodes: Graph '%s' - %d entry points, %d exec-reachable, %d data deps, %d orphaned"),
-        *Graph->GetName(), EntryPoints.Num(), ExecReachableNodes.Num(), DataDependencies.Num(), OutOrphanedNodeIds.Num());
+        OutOrphanedNodes.Add(NodeInfo);
+    }
 
     return true;
 }
 
-bool FGraphUtils::GetOrphanedNodesInfo(UEdGraph* Graph, TArray<TSharedPtr<FJsonObject>>& OutOrphanedNodes)
+int32 FGraphUtils::DeleteOrphanedNodes(UEdGraph* Graph, bool bKeepDefaultReturnNodes, TArray<FString>& OutDeletedTitles)
 {
-    OutOrphanedNodes.Empty();
-
     if (!Graph)
     {
-        return false;
+        return 0;
     }
 
-    // Get orphaned node IDs
-    TArray<FString> OrphanedNodeIds;
-    if (!DetectOrphanedNodes(Graph, OrphanedNodeIds))
-    {
-        return false;
-    }
+    // Copied, since the first Modify below drops the cached analysis
+    const TArray<FGraphReachabilityCache::FOrphanedNode> Orphans = FGraphReachabilityCache::Get().Analyze(Graph).OrphanedNodes;
 
-    // Build a map of node IDs for quick lookup
-    TMap<FString, UEdGraphNode*> NodeIdMap;
-    for (UEdGraphNode* Node : Graph->Nodes)
+    int32 DeletedCount = 0;
+    for (const FGraphReachabilityCache::FOrphanedNode& Orphan : Orphans)
     {
-        if (Node)
+        UEdGraphNode* Node = Orphan.Node.Get();
+        if (!Node)
         {
-            NodeIdMap.Add(GetReliableNodeId(Node), Node);
+            continue;
         }
-    }
 
-    // Build info for each orphaned node
-    for (const FString& NodeId : OrphanedNodeIds)
-    {
-        UEdGraphNode** NodePtr = NodeIdMap.Find(NodeId);
-        if (NodePtr && *NodePtr)
+        // An unlinked Return Node at (0,0) is the one the editor created with the function
+        if (bKeepDefaultReturnNodes && Node->IsA<UK2Node_FunctionResult>() && Node->NodePosX == 0 && Node->NodePosY == 0
+            && Orphan.InputConnections == 0 && Orphan.OutputConnections == 0)
         {
-            UEdGraphNode* Node = *NodePtr;
-
-            TSharedPtr<FJsonObject> NodeInfo = MakeShared<FJsonObject>();
-            NodeInfo->SetStringField(TEXT("node_id"), NodeId);
-            NodeInfo->SetStringField(TEXT("title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
-            NodeInfo->SetStringField(TEXT("class"), Node->GetClass()->GetName());
-            NodeInfo->SetNumberField(TEXT("pos_x"), Node->NodePosX);
-            NodeInfo->SetNumberField(TEXT("pos_y"), Node->NodePosY);
-
-            // Count connections (for debugging - shows if it's connected to other orphans)
-            int32 InputConnections = 0;
-            int32 OutputConnections = 0;
-            for (UEdGraphPin* Pin : Node->Pins)
+            UE_LOG(LogTemp, Display, TEXT("DeleteOrphanedNodes: Skipping auto-generated Return Node at (0,0) in graph '%s'"), *Graph->GetName());
+            continue;
+        }
+
+        const FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+
+        Graph->Modify();
+        Node->Modify();
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin)
             {
-                if (Pin)
-                {
-                    if (Pin->Direction == EGPD_Input)
-                    {
-                        InputConnections += Pin->LinkedTo.Num();
-                    }
-                    else
-                    {
-                        OutputConnections += Pin->LinkedTo.Num();
-                    }
-                }
+                Pin->BreakAllPinLinks();
             }
-            NodeInfo->SetNumberField(TEXT("input_connections"), InputConnections);
-            NodeInfo->SetNumberField(TEXT("output_connections"), OutputConnections);
-
-            OutOrphanedNodes.Add(NodeInfo);
         }
+        Graph->RemoveNode(Node);
+
+        OutDeletedTitles.Add(FString::Printf(TEXT("%s [%s]"), *NodeTitle, *Graph->GetName()));
+        DeletedCount++;
+
+        UE_LOG(LogTemp, Display, TEXT("DeleteOrphanedNodes: Deleted '%s' from graph '%s'"), *NodeTitle, *Graph->GetName());
     }
 
-    return true;
+    return DeletedCount;
 }
@@ -1,4 +1,5 @@
 #include "Utils/JsonUtils.h"
+#include "Misc/Base64.h"
 
 TSharedPtr<FJsonObject> FJsonUtils::CreateErrorResponse(const FString& Message)
 {
@@ -59,6 +60,93 @@ void FJsonUtils::GetFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject
     }
 }
 
+bool FJsonUtils::GetPackedFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<float>& OutArray, FString& OutError)
+{
+    OutArray.Reset();
+
+    const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+    if (JsonObject->TryGetArrayField(FieldName, JsonArray))
+    {
+        OutArray.Reserve(JsonArray->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *JsonArray)
+        {
+            double Number = 0.0;
+            if (!Value.IsValid() || !Value->TryGetNumber(Number))
+            {
+                OutError = FString::Printf(TEXT("'%s' must contain only numbers"), *FieldName);
+                return false;
+            }
+            OutArray.Add(static_cast<float>(Number));
+        }
+        return true;
+    }
+
+    FString Encoded;
+    if (JsonObject->TryGetStringField(FieldName, Encoded))
+    {
+        TArray<uint8> Bytes;
+        if (!FBase64::Decode(Encoded, Bytes) || Bytes.Num() % sizeof(float) != 0)
+        {
+            OutError = FString::Printf(TEXT("'%s' is not a base64 buffer of float32 values"), *FieldName);
+            return false;
+        }
+
+        // Every platform the editor runs on is little-endian, so the bytes are the floats
+        OutArray.SetNumUninitialized(Bytes.Num() / sizeof(float));
+        FMemory::Memcpy(OutArray.GetData(), Bytes.GetData(), Bytes.Num());
+        return true;
+    }
+
+    OutError = FString::Printf(TEXT("Missing '%s' parameter"), *FieldName);
+    return false;
+}
+
+TSharedPtr<FJsonValue> FJsonUtils::CreatePackedFloatArrayValue(const TArray<float>& Values, bool bBase64)
+{
+    if (bBase64)
+    {
+        return MakeShared<FJsonValueString>(FBase64::Encode(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(float)));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> JsonArray;
+    JsonArray.Reserve(Values.Num());
+    for (float Value : Values)
+    {
+        JsonArray.Add(MakeShared<FJsonValueNumber>(Value));
+    }
+    return MakeShared<FJsonValueArray>(JsonArray);
+}
+
+void FJsonUtils::AppendJsonString(FString& Out, FStringView Value)
+{
+    Out.Reserve(Out.Len() + Value.Len() + 2);
+    Out.AppendChar(TEXT('"'));
+    for (const TCHAR Char : Value)
+    {
+        switch (Char)
+        {
+            case TEXT('"'): Out.Append(TEXT("\\\"")); break;
+            case TEXT('\\'): Out.Append(TEXT("\\\\")); break;
+            case TEXT('\n'): Out.Append(TEXT("\\n")); break;
+            case TEXT('\r'): Out.Append(TEXT("\\r")); break;
+            case TEXT('\t'): Out.Append(TEXT("\\t")); break;
+            case TEXT('\b'): Out.Append(TEXT("\\b")); break;
+            case TEXT('\f'): Out.Append(TEXT("\\f")); break;
+            default:
+                if (Char < TEXT(' '))
+                {
+                    Out.Appendf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+                }
+                else
+                {
+                    Out.AppendChar(Char);
+                }
+                break;
+        }
+    }
+    Out.AppendChar(TEXT('"'));
+}
+
 FVector2D FJsonUtils::GetVector2DFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName)
 {
     FVector2D Result(0.0f, 0.0f);
@@ -1,5 +1,6 @@
 #include "Utils/UnrealMCPCommonUtils.h"
 #include "Utils/GraphUtils.h"
+#include "MCPTrace.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "WidgetBlueprint.h"
@@ -25,6 +26,8 @@
 #include "Engine/Selection.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Services/AssetDiscoveryService.h"
+#include "Services/AssetSearchIndex.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "BlueprintNodeSpawner.h"
 #include "BlueprintActionDatabase.h"
@@ -82,6 +85,8 @@ UBlueprint* FUnrealMCPCommonUtils::FindBlueprint(const FString& BlueprintName)
 
 UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintName)
 {
+    MCP_TRACE_SCOPE("MCP::FindBlueprint");
+
     // Early exit for empty names
     if (BlueprintName.IsEmpty())
     {
@@ -89,6 +94,23 @@ UBlueprint* FUnrealMCPCommonUtils::FindBlueprintByName(const FString& BlueprintN
         return nullptr;
     }
 
+    // Short names are answered from the asset index instead of probing the guessed paths below
+    FSoftObjectPath IndexedPath;
+    const FAssetDiscoveryService::EAssetResolution Resolution =
+        FAssetDiscoveryService::Get().ResolveAssetPath(BlueprintName, UBlueprint::StaticClass(), IndexedPath);
+    if (Resolution == FAssetDiscoveryService::EAssetResolution::Found)
+    {
+        if (UBlueprint* Blueprint = Cast<UBlueprint>(IndexedPath.TryLoad()))
+        {
+            return Blueprint;
+        }
+    }
+    else if (Resolution == FAssetDiscoveryService::EAssetResolution::NotFound)
+    {
+        UE_LOG(LogTemp, Error, TEXT("Blueprint '%s' not found"), *BlueprintName);
+        return nullptr;
+    }
+
     // Step 1: Normalize the path
     FString NormalizedName = BlueprintName;
     
@@ -467,6 +489,11 @@ TArray<FString> FUnrealMCPCommonUtils::FindWidgetBlueprints(const FString& Widge
 TArray<FString> FUnrealMCPCommonUtils::FindBlueprints(const FString& BlueprintName, const FString& SearchPath)
 {
     TArray<FString> FoundBlueprints;
+
+    if (FAssetSearchIndex::Get().FindObjectPaths(BlueprintName, { FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("Blueprint")) }, SearchPath, FoundBlueprints))
+    {
+        return FoundBlueprints;
+    }
     
     // Get the Asset Registry
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -497,6 +524,11 @@ TArray<FString> FUnrealMCPCommonUtils::FindBlueprints(const FString& BlueprintNa
 TArray<FString> FUnrealMCPCommonUtils::FindDataTables(const FString& TableName, const FString& SearchPath)
 {
     TArray<FString> FoundTables;
+
+    if (FAssetSearchIndex::Get().FindObjectPaths(TableName, { FTopLevelAssetPath(TEXT("/Script/Engine"), TEXT("DataTable")) }, SearchPath, FoundTables))
+    {
+        return FoundTables;
+    }
     
     // Get the Asset Registry
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IAnimationBlueprintService.h"
+
+/**
+ * Command for building a whole state machine in Animation Blueprints from one spec:
+ * its states, entry state, transitions and their rules, in one transaction with one compile
+ */
+class UNREALMCP_API FBuildAnimStateMachineFromSpecCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBuildAnimStateMachineFromSpecCommand(IAnimationBlueprintService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IAnimationBlueprintService& Service;
+
+    bool ParseParameters(const FString& JsonString, FString& OutAnimBlueprintName, FAnimStateMachineSpecParams& OutSpec, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all Animation Blueprint-related commands
@@ -37,10 +38,11 @@ private:
     static void RegisterGetAnimBlueprintMetadataCommand();
     static void RegisterConfigureAnimSlotCommand();
     static void RegisterConnectAnimGraphNodesCommand();
+    static void RegisterBuildAnimStateMachineFromSpecCommand();
 
     /**
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
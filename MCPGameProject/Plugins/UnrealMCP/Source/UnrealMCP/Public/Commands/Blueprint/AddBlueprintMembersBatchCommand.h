@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command for adding many components, variables and custom functions to one Blueprint in one request
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * add_component_to_blueprint, add_blueprint_variable and create_custom_blueprint_function each mark
+ * the Blueprint structurally modified, which regenerates its skeleton class, so building a Blueprint
+ * with 80 variables used to regenerate it 80 times. Here every addition is applied first and the
+ * Blueprint is marked structurally modified and its nodes refreshed once, inside a single undo
+ * transaction. Components are added before variables, and variables before functions; a component
+ * may name one added earlier in the batch as its parent.
+ *
+ * Parameters:
+ *   blueprint_name: Name or path of the Blueprint (required)
+ *   components: Array of components, as add_component_to_blueprint takes them (optional)
+ *   variables: Array of {"variable_name", "variable_type", "is_exposed"} (optional)
+ *   functions: Array of functions, as create_custom_blueprint_function takes them (optional)
+ *   all_or_nothing: Leave the Blueprint unchanged unless every addition succeeds (optional, default false)
+ *
+ * At least one of components, variables and functions must be non-empty.
+ *
+ * Returns:
+ *   {
+ *     "blueprint_name": "BP_Player",
+ *     "components": [{"name": "Mesh", "success": true}],
+ *     "variables": [{"name": "Health", "success": false, "error": "..."}],
+ *     "functions": [{"name": "TakeDamage", "success": true}],
+ *     "succeeded": 2,
+ *     "failed": 1,
+ *     "rolled_back": false,
+ *     "success": false              // every addition was made
+ *   }
+ */
+class UNREALMCP_API FAddBlueprintMembersBatchCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InBlueprintService - Reference to the blueprint service for lookups
+     */
+    explicit FAddBlueprintMembersBatchCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the blueprint service */
+    IBlueprintService& BlueprintService;
+};
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 #include "Services/IBlueprintService.h"
+#include "EdGraph/EdGraphPin.h"
 
 /**
  * Command to add variable definitions to a Blueprint
@@ -21,6 +22,30 @@ public:
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
 
+    /**
+     * Resolve a variable type name ("Float", "String[]", "Map<Name, Integer>", "Class<UserWidget>",
+     * a struct, enum or class name or path) to a pin type
+     * @param VariableType - Type name as given to add_blueprint_variable
+     * @param OutResolvedType - Receives the pin type
+     * @param OutError - Receives the reason on failure
+     * @return Whether the type resolved
+     */
+    static bool ResolveVariableType(const FString& VariableType, FEdGraphPinType& OutResolvedType, FString& OutError);
+
+    /**
+     * Add a member variable to a Blueprint
+     * @param Blueprint - Blueprint to add to
+     * @param VariableName - Name of the new variable
+     * @param PinType - Type of the new variable
+     * @param bIsExposed - Whether the variable is instance editable
+     * @param bDeferStructuralUpdate - Leave marking the Blueprint structurally modified, and thus
+     *        regenerating its skeleton class, to the caller, which does it once for a batch
+     * @param OutError - Receives the reason on failure
+     * @return Whether the variable was added
+     */
+    static bool AddVariable(UBlueprint* Blueprint, const FString& VariableName, const FEdGraphPinType& PinType, bool bIsExposed,
+                            bool bDeferStructuralUpdate, FString& OutError);
+
 private:
     /** Reference to the blueprint service */
     IBlueprintService& BlueprintService;
@@ -23,6 +23,16 @@ public:
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
 
+    /**
+     * Parse one component description: component_name, component_type, and optionally location,
+     * rotation, scale, parent_component_name and component_properties
+     * @param JsonObject - Component description
+     * @param OutParams - Parsed component parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    static bool ParseComponentParams(const TSharedRef<FJsonObject>& JsonObject, FComponentCreationParams& OutParams, FString& OutError);
+
 private:
     /** Reference to the blueprint service */
     IBlueprintService& BlueprintService;
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command for calling one BlueprintCallable function on many actors in one request
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * call_blueprint_function finds one target and builds its parameters per call, so scripting a
+ * function across hundreds of actors in PIE took one round trip per actor. Here the targets come
+ * from the actor index (the union of the names, tag and class given; an actor matched several ways
+ * is called once), the function is resolved once per target class, and its parameters are
+ * converted from JSON once and copied for each call, all in one game thread visit.
+ *
+ * Targets whose class does not have the function, or has an unrelated one with a different
+ * signature, are reported as failed without stopping the others.
+ *
+ * Parameters:
+ *   function_name: Name of the BlueprintCallable function (required)
+ *   target_names: Actor names or labels (optional)
+ *   tag: Actor tag (optional)
+ *   class_name: Actor class, subclasses included; name or path (optional)
+ *   params: Function parameters by name, e.g. {"Damage": 10, "bCritical": true} (optional)
+ *   string_params: String parameters in order, as call_blueprint_function takes them (optional)
+ *   world: "auto" (PIE while playing, else the editor world), "pie" or "editor" (optional, default "auto")
+ *   include_return_values: Add each call's return value and output parameters, by name, to its
+ *     result (optional, default false)
+ *
+ * At least one of target_names, tag and class_name is required.
+ *
+ * Returns:
+ *   {
+ *     "function_name": "ApplyDamage",
+ *     "world": "pie",
+ *     "results": [{"target": "BP_Enemy_3", "success": true, "return_value": {"ReturnValue": 90}}],
+ *     "missing_targets": ["BP_Enemy_99"],
+ *     "called": 120,
+ *     "failed": 0,
+ *     "success": true               // every target was found and called
+ *   }
+ */
+class UNREALMCP_API FCallBlueprintFunctionBatchCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InBlueprintService - Reference to the blueprint service for operations
+     */
+    explicit FCallBlueprintFunctionBatchCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the blueprint service */
+    IBlueprintService& BlueprintService;
+};
@@ -7,6 +7,12 @@
 /**
  * Command for compiling Blueprint assets
  * Provides enhanced error reporting for compilation issues
+ *
+ * A Blueprint left up to date by its last compile_blueprint and not changed since is not compiled
+ * again; the response repeats that compile's status and warnings with "cached": true (see
+ * FBlueprintCompileResultCache). "force": true compiles regardless. "skeleton_only": true only
+ * regenerates the skeleton class, a quick check of variables, components and function signatures
+ * after structural changes; graphs are not compiled and the response carries "skeleton_only": true.
  */
 class UNREALMCP_API FCompileBlueprintCommand : public IUnrealMCPCommand
 {
@@ -30,10 +36,12 @@ private:
      * Parse JSON parameters for blueprint compilation
      * @param JsonString - JSON string containing parameters
      * @param OutBlueprintName - Name of the blueprint to compile
+     * @param bOutForce - Whether to compile even if the last result still holds
+     * @param bOutSkeletonOnly - Whether to regenerate the skeleton class only
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, bool& bOutForce, bool& bOutSkeletonOnly, FString& OutError) const;
     
     /**
      * Create success response JSON with compilation details
@@ -41,9 +49,11 @@ private:
      * @param CompilationTime - Time taken for compilation
      * @param Status - Compilation status message
      * @param Warnings - Array of warning messages (optional)
+     * @param bCached - Whether the result is the last compile's, not compiled again
+     * @param bSkeletonOnly - Whether only the skeleton class was compiled
      * @return JSON response string
      */
-    FString CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status = TEXT("compiled successfully"), const TArray<FString>& Warnings = TArray<FString>()) const;
+    FString CreateSuccessResponse(const FString& BlueprintName, float CompilationTime, const FString& Status = TEXT("compiled successfully"), const TArray<FString>& Warnings = TArray<FString>(), bool bCached = false, bool bSkeletonOnly = false) const;
     
     /**
      * Create error response JSON with detailed compilation errors
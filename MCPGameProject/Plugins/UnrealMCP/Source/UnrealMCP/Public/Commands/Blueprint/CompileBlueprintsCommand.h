@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command for compiling a set of Blueprints in one pass
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * The Blueprints are ordered so that each one comes after the Blueprints of the set it depends on
+ * (asset registry package dependencies, as reported by get_blueprint_dependencies, and the parent
+ * class), queued on FBlueprintCompilationManager in that order and compiled with a single flush,
+ * so shared reinstancing happens once instead of once per Blueprint.
+ *
+ * Parameters:
+ *   blueprint_names: Names or paths of the Blueprints to compile (required)
+ *
+ * Returns:
+ *   {
+ *     "order": ["BP_Base", "BP_Child"],
+ *     "results": [
+ *       {"blueprint_name": "BP_Base", "success": true, "status": "compiled successfully"},
+ *       {"blueprint_name": "BP_Child", "success": false, "status": "error", "compilation_errors": ["..."]}
+ *     ],
+ *     "not_found": [],
+ *     "total": 2,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "compilation_time_seconds": 0.42,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FCompileBlueprintsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InBlueprintService - Reference to the blueprint service for lookups
+     */
+    explicit FCompileBlueprintsCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the blueprint service */
+    IBlueprintService& BlueprintService;
+
+    /**
+     * Order Blueprints so that dependencies within the set come first; cycles keep input order
+     * @param Blueprints - Blueprints to compile, in request order
+     * @return The same Blueprints in compile order
+     */
+    static TArray<UBlueprint*> SortByDependencies(const TArray<UBlueprint*>& Blueprints);
+
+    /**
+     * Build the result entry of a compiled Blueprint from its status and node messages
+     * @param Blueprint - Compiled Blueprint
+     * @param bOutSucceeded - Set to false if the Blueprint has errors
+     * @return Result entry
+     */
+    static TSharedRef<FJsonObject> MakeResult(UBlueprint* Blueprint, bool& bOutSucceeded);
+};
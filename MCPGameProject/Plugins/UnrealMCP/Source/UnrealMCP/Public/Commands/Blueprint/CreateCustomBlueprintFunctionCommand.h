@@ -22,6 +22,18 @@ public:
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
 
+    /**
+     * Create a user-defined function graph with its entry and result nodes
+     * @param Blueprint - Blueprint to add the function to
+     * @param JsonObject - Function description: function_name, and optionally inputs, outputs
+     *        ([{"name", "type"}]), is_pure and category, as create_custom_blueprint_function takes them
+     * @param bDeferStructuralUpdate - Leave marking the Blueprint structurally modified and refreshing
+     *        its nodes to the caller, which does it once for a batch
+     * @param OutError - Receives the reason on failure
+     * @return Whether the function was created
+     */
+    static bool CreateFunction(UBlueprint* Blueprint, const TSharedRef<FJsonObject>& JsonObject, bool bDeferStructuralUpdate, FString& OutError);
+
 private:
     /** Reference to the blueprint service */
     IBlueprintService& BlueprintService;
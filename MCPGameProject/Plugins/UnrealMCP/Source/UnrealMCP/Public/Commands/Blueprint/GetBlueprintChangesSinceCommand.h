@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IBlueprintService.h"
+
+/**
+ * Command to list what changed in a Blueprint after a revision of its change journal
+ * (FBlueprintChangeJournal), instead of fetching its metadata again after every edit
+ *
+ * Parameters:
+ *   - blueprint_name (string, required): Name or path of the Blueprint
+ *   - since_revision (int, optional): Revision the caller has seen (default: 0, every retained change)
+ *
+ * Returns:
+ *   - revision (int): Current revision; pass it as since_revision next time
+ *   - changes (array): Changes after since_revision, oldest first, each with revision, source
+ *     (MCP command or "editor"), action, type, id, name, graph (nodes) and changed (modifications)
+ *   - truncated (bool): Changes after since_revision were already dropped; refetch the metadata
+ */
+class UNREALMCP_API FGetBlueprintChangesSinceCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetBlueprintChangesSinceCommand(IBlueprintService& InBlueprintService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    IBlueprintService& BlueprintService;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
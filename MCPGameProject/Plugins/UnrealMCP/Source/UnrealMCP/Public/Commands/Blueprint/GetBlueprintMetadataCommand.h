@@ -8,10 +8,34 @@
 class UBlueprint;
 class IBlueprintService;
 
+/**
+ * Sections and keys selected by the "fields" parameter
+ */
+struct FMetadataFieldSelection
+{
+    /** Sections to build, by their canonical name */
+    TArray<FString> Sections;
+    /** Keys kept per section, from "section.key" fields; a section missing here keeps every key */
+    TMap<FString, TArray<FString>> Projections;
+    /** Expensive sections that "*" left out */
+    TArray<FString> OmittedSections;
+    /** Fields naming no section */
+    TArray<FString> UnknownFields;
+};
+
 /**
  * Command to retrieve comprehensive metadata about a Blueprint
  * Supports selective field querying for performance optimization
  *
+ * Only the requested sections are built. "*" selects every section except the expensive ones
+ * (component_properties, orphaned_nodes, graph_warnings, graph_nodes), which walk every node, pin
+ * or property and are built only when named. "section.key" keeps only that key of the section's
+ * entries, e.g. ["variables.name", "variables.type"].
+ *
+ * graph_nodes is paged with max_nodes: nodes come in node GUID order and each page returns a
+ * next_cursor to pass as cursor for the next one. compact_pins encodes each pin as one string
+ * ("then->NodeId.execute", "Value=5") instead of an object holding linked node titles.
+ *
  * Uses BlueprintMetadataBuilderService for building the actual metadata JSON objects.
  */
 class UNREALMCP_API FGetBlueprintMetadataCommand : public IUnrealMCPCommand
@@ -27,18 +51,27 @@ private:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
+    virtual bool IsResultCacheable() const override { return true; }
 
 private:
     /**
      * Parse JSON parameters
      * @param JsonString - JSON parameters
      * @param OutBlueprintName - Parsed blueprint name
-     * @param OutFields - Requested metadata fields (* for all)
+     * @param OutSelection - Sections and keys selected by the fields parameter
      * @param OutFilter - Optional filters for graph_nodes field
      * @param OutError - Error message if parsing fails
      * @return True if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, TArray<FString>& OutFields, FGraphNodesFilter& OutFilter, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, FString& OutBlueprintName, FMetadataFieldSelection& OutSelection, FGraphNodesFilter& OutFilter, FString& OutError) const;
+
+    /**
+     * Resolve the fields parameter into sections and projections
+     * @param Fields - Requested fields: section names, "section.key" or "*"
+     * @param OutSelection - Resolved selection
+     */
+    static void ResolveFields(const TArray<FString>& Fields, FMetadataFieldSelection& OutSelection);
 
     /**
      * Find Blueprint by name or path
@@ -50,18 +83,19 @@ private:
     /**
      * Build metadata fields based on requested fields
      * @param Blueprint - Target Blueprint
-     * @param Fields - Requested field names (* for all)
+     * @param Selection - Sections to build and keys to keep
      * @param Filter - Optional filters for graph_nodes field
      * @return JSON object with requested fields
      */
-    TSharedPtr<FJsonObject> BuildMetadata(UBlueprint* Blueprint, const TArray<FString>& Fields, const FGraphNodesFilter& Filter) const;
+    TSharedPtr<FJsonObject> BuildMetadata(UBlueprint* Blueprint, const FMetadataFieldSelection& Selection, const FGraphNodesFilter& Filter) const;
 
     /**
      * Create success response
      * @param Metadata - Metadata JSON object
+     * @param Selection - Selection the metadata was built for; reports omitted sections and unknown fields
      * @return JSON response string
      */
-    FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const;
+    FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata, const FMetadataFieldSelection& Selection) const;
 
     /**
      * Create error response
@@ -73,8 +107,8 @@ private:
     /**
      * Check if field should be included
      * @param FieldName - Field to check
-     * @param RequestedFields - List of requested fields
+     * @param Selection - Resolved selection
      * @return True if field should be included
      */
-    bool ShouldIncludeField(const FString& FieldName, const TArray<FString>& RequestedFields) const;
+    bool ShouldIncludeField(const FString& FieldName, const FMetadataFieldSelection& Selection) const;
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 #include "Services/IBlueprintActionService.h"
+#include "Services/BlueprintSearchIndex.h"
 
 /**
  * Search types for find_in_blueprints command
@@ -17,23 +18,13 @@ enum class EBlueprintSearchType : uint8
 	Custom      // Search custom events only
 };
 
-/**
- * Result of a blueprint search match
- */
-struct FBlueprintSearchMatch
-{
-	FString BlueprintPath;    // Full path to the blueprint
-	FString BlueprintName;    // Name of the blueprint
-	FString GraphName;        // Name of the graph containing the match
-	FString NodeId;           // Unique node ID
-	FString NodeTitle;        // Node's display title
-	FString NodeClass;        // Node class name
-	FString MatchContext;     // Additional context about the match
-};
-
 /**
  * Command to search for function/variable/event usages across all blueprints
  * Similar to Unreal's "Find in Blueprints" feature
+ * Answers from FBlueprintSearchIndex, so only Blueprints it has not indexed yet are loaded; those
+ * are searched after the indexed ones, through FMCPAsyncAssetLoader, as each finishes loading
+ * Matches are added to the result per blueprint as they are found, and the search stops as soon
+ * as max_results is reached ("truncated": true)
  */
 class UNREALMCP_API FFindInBlueprintsCommand : public IUnrealMCPCommand
 {
@@ -46,16 +37,18 @@ public:
 
 	// IUnrealMCPCommand interface
 	virtual FString Execute(const FString& Parameters) override;
+	virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+	virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
 
 private:
 	/** Service for blueprint action operations */
 	TSharedPtr<IBlueprintActionService> BlueprintActionService;
 
 	/**
-	 * Parse parameters from JSON string
-	 * @param Parameters - JSON string containing parameters
+	 * Parse parameters from the request
+	 * @param Params - Request parameters
 	 * @param OutSearchQuery - Parsed search query
 	 * @param OutSearchType - Parsed search type
 	 * @param OutPath - Parsed search path
@@ -65,7 +58,7 @@ private:
 	 * @return true if parsing succeeded
 	 */
 	bool ParseParameters(
-		const FString& Parameters,
+		const TSharedRef<FJsonObject>& Params,
 		FString& OutSearchQuery,
 		EBlueprintSearchType& OutSearchType,
 		FString& OutPath,
@@ -80,47 +73,22 @@ private:
 	EBlueprintSearchType ParseSearchType(const FString& TypeString) const;
 
 	/**
-	 * Search a single blueprint for matches
-	 */
-	void SearchBlueprint(
-		class UBlueprint* Blueprint,
-		const FString& SearchQuery,
-		EBlueprintSearchType SearchType,
-		bool bCaseSensitive,
-		TArray<FBlueprintSearchMatch>& OutMatches,
-		int32 MaxResults
-	) const;
-
-	/**
-	 * Check if a node matches the search criteria
+	 * Match the indexed nodes of a single blueprint against the query, stopping after MaxMatches
+	 * Each match is appended to OutMatches, and the blueprint's group to OutGroups if it has any
+	 * @return Number of matches found
 	 */
-	bool MatchesSearchCriteria(
-		class UEdGraphNode* Node,
+	int32 SearchBlueprint(
+		const FBlueprintSearchIndex::FPackageEntry& Entry,
 		const FString& SearchQuery,
 		EBlueprintSearchType SearchType,
 		bool bCaseSensitive,
-		FString& OutMatchContext
+		int32 MaxMatches,
+		TArray<TSharedPtr<FJsonValue>>& OutMatches,
+		TArray<TSharedPtr<FJsonValue>>& OutGroups
 	) const;
 
 	/**
-	 * Check if node type matches the filter
-	 */
-	bool MatchesNodeTypeFilter(class UEdGraphNode* Node, EBlueprintSearchType SearchType) const;
-
-	/**
-	 * Create an error response JSON string
-	 * @param ErrorMessage - Error message
-	 * @return JSON string representing error response
+	 * Check if node kind matches the filter
 	 */
-	FString CreateErrorResponse(const FString& ErrorMessage) const;
-
-	/**
-	 * Create a success response with search results
-	 */
-	FString CreateSuccessResponse(
-		const TArray<FBlueprintSearchMatch>& Matches,
-		const FString& SearchQuery,
-		const FString& SearchType,
-		int32 BlueprintsSearched
-	) const;
+	bool MatchesNodeTypeFilter(EBlueprintSearchNodeKind Kinds, EBlueprintSearchType SearchType) const;
 };
@@ -20,6 +20,7 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     /** Service for blueprint action operations */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 class FUnrealMCPCommandRegistry;
 class IBlueprintActionService;
@@ -25,12 +26,13 @@ public:
     static void UnregisterAllBlueprintActionCommands();
 
 private:
-    /** Array to track registered commands for cleanup */
-    static TArray<TSharedPtr<class IUnrealMCPCommand>> RegisteredCommands;
+    /** Names of the registered commands, for cleanup */
+    static TArray<FString> RegisteredCommandNames;
 
     /**
      * Register and track a command for later cleanup
-     * @param Command - Command to register
+     * @param CommandName - Name the command reports
+     * @param Factory - Constructs the command on first use
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
\ No newline at end of file
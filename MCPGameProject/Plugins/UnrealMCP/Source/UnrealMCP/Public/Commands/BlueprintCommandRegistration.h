@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all Blueprint-related commands
@@ -33,21 +34,25 @@ private:
     static void RegisterAddBlueprintVariableCommand();
     static void RegisterSetComponentPropertyCommand();
     static void RegisterCompileBlueprintCommand();
+    static void RegisterCompileBlueprintsCommand();
     static void RegisterSetPhysicsPropertiesCommand();
     static void RegisterSetBlueprintPropertyCommand();
     static void RegisterSetStaticMeshPropertiesCommand();
     static void RegisterSetPawnPropertiesCommand();
     static void RegisterCallBlueprintFunctionCommand();
+    static void RegisterCallBlueprintFunctionBatchCommand();
     static void RegisterCreateBlueprintInterfaceCommand();
     static void RegisterAddInterfaceToBlueprintCommand();
     static void RegisterCreateCustomBlueprintFunctionCommand();
+    static void RegisterAddBlueprintMembersBatchCommand();
     static void RegisterGetBlueprintMetadataCommand();
     static void RegisterModifyBlueprintFunctionPropertiesCommand();
     static void RegisterDeleteBlueprintVariableCommand();
+    static void RegisterGetBlueprintChangesSinceCommand();
 
     /**
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class UBlueprint;
+class UEdGraph;
+
+/**
+ * Command for building a Blueprint graph from a declarative node and wire spec in one request
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Nodes are created as create_node_by_action_name would create them, with spawners found through
+ * the index FActionSpawnerMatcher keeps over the Blueprint Action Database. All nodes are created
+ * before any wire is made, the graph is laid out once, and the graph and Blueprint are notified
+ * once at the end.
+ *
+ * Parameters:
+ *   blueprint_name: Name or path of the Blueprint (required)
+ *   target_graph: Graph to build in, created if missing (optional, default "EventGraph")
+ *   nodes: Array of nodes (required), each containing:
+ *     - id: Spec id connections refer to (required)
+ *     - action: Action/function name, as for create_node_by_action_name (required)
+ *     - class_name: Class to disambiguate the function (optional)
+ *     - position: [x, y] (optional)
+ *     - params: Extra node parameters such as pin_values or kwargs (optional)
+ *   connections: Array of wires (optional), each containing:
+ *     - source / target: Spec id of a node in this request, or the node id of an existing node
+ *     - source_pin / target_pin: Pin names
+ *   auto_arrange: Lay the graph out after wiring (optional, default true except for the EventGraph);
+ *                 otherwise the created nodes without a position are placed next to their neighbours
+ *
+ * Returns:
+ *   {
+ *     "nodes": [{"id": "begin", "success": true, "node_id": "...", "node_title": "..."}],
+ *     "connections": [{"source": "begin", "target": "print", "success": true}],
+ *     "nodes_created": 2,
+ *     "connections_made": 1,
+ *     "failed": 0,
+ *     "arranged_count": 2,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FBuildBlueprintGraphCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /**
+     * Find a graph of the Blueprint by name
+     * @param Blueprint - Blueprint to search
+     * @param GraphName - Graph name
+     * @return The graph, or nullptr
+     */
+    static UEdGraph* FindGraph(UBlueprint* Blueprint, const FString& GraphName);
+};
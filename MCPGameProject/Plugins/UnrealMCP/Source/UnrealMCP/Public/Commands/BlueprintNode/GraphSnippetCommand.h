@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Commands for the node snippet library of FGraphSnippetService
+ * Implements the typed IUnrealMCPCommand interface; registered once per mode as
+ * save_graph_snippet, paste_graph_snippet and list_graph_snippets
+ *
+ * save_graph_snippet parameters:
+ *   blueprint_name: Name or path of the Blueprint (required)
+ *   graph_name: Graph the nodes are in (optional, default "EventGraph")
+ *   node_ids: Ids of the nodes to save (required)
+ *   snippet_name: Snippet name, letters, digits, '_' and '-' (required)
+ *   keys: Name of each node for paste overrides and results (optional, default "node0", "node1", ...)
+ *   description: Listed with the snippet (optional)
+ *   overwrite: Replace a snippet of the same name (optional, default false)
+ *
+ * paste_graph_snippet parameters:
+ *   blueprint_name: Name or path of the Blueprint (required)
+ *   graph_name: Graph to paste into (optional, default "EventGraph")
+ *   snippet_name: Snippet to paste (required)
+ *   position: [x, y] of the snippet's top left node (optional, default [0, 0])
+ *   overrides: Changes by node key (optional), each containing:
+ *     - pins: {pin name: default value}
+ *     - variable: Member variable a variable get/set node refers to instead
+ *
+ * list_graph_snippets takes no parameters.
+ *
+ * Returns:
+ *   save:  {"snippet": {...}, "success": true}
+ *   paste: {"nodes": [{"key": "...", "node_id": "..."}], "warnings": [...], "success": true}
+ *   list:  {"snippets": [{"name": "...", "description": "...", "schema": "...", "nodes": [...]}], "count": 1}
+ */
+class UNREALMCP_API FGraphSnippetCommand : public IUnrealMCPCommand
+{
+public:
+    enum class EMode : uint8
+    {
+        Save,
+        Paste,
+        List
+    };
+
+    explicit FGraphSnippetCommand(EMode InMode)
+        : Mode(InMode)
+    {
+    }
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return Mode == EMode::List; }
+
+private:
+    void ExecuteSave(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) const;
+    void ExecutePaste(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) const;
+    void ExecuteList(FMCPResponseWriter& Response) const;
+
+    EMode Mode;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Commands for connecting or disconnecting many pin pairs of one graph in one request
+ * Implements the typed IUnrealMCPCommand interface; registered once per mode as
+ * connect_pins_batch and disconnect_pins_batch
+ *
+ * Node ids are resolved through one lookup built for the request, every wire is validated before
+ * the graph is touched, and the nodes, graph and Blueprint are notified once for the whole batch,
+ * inside a single undo transaction.
+ *
+ * Parameters:
+ *   blueprint_name: Name or path of the Blueprint (required)
+ *   target_graph: Graph the nodes are in (optional, default "EventGraph")
+ *   wires: Array of wires (required), each containing:
+ *     - source_node_id / source_pin: Output pin
+ *     - target_node_id / target_pin: Input pin
+ *   all_or_nothing: Leave the graph unchanged unless every wire is valid (optional, default false)
+ *
+ * Returns:
+ *   {
+ *     "results": [{"source_node_id": "...", "source_pin": "...", "target_node_id": "...", "target_pin": "...", "success": true}],
+ *     "succeeded": 1,
+ *     "failed": 0,
+ *     "auto_inserted_nodes": [...],   // connect only, if conversion nodes were created
+ *     "success": true                 // every wire was made or broken
+ *   }
+ */
+class UNREALMCP_API FPinsBatchCommand : public IUnrealMCPCommand
+{
+public:
+    enum class EMode : uint8
+    {
+        Connect,
+        Disconnect
+    };
+
+    explicit FPinsBatchCommand(EMode InMode)
+        : Mode(InMode)
+    {
+    }
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    EMode Mode;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all Blueprint Node-related commands
@@ -38,11 +39,14 @@ private:
     static void RegisterAddBlueprintFunctionNodeCommand();
     static void RegisterAddBlueprintCustomEventNodeCommand();
     static void RegisterCreateNodeByActionNameCommand();
+    static void RegisterBuildBlueprintGraphCommand();
+    static void RegisterPinsBatchCommands();
+    static void RegisterGraphSnippetCommands();
     // static void RegisterAddEnhancedInputActionNodeCommand();  // REMOVED: Use create_node_by_action_name instead
     
     /**
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
\ No newline at end of file
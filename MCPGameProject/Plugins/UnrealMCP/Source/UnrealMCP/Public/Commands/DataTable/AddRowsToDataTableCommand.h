@@ -6,7 +6,8 @@
 
 /**
  * Command for adding rows to DataTable assets
- * Implements the IUnrealMCPCommand interface for standardized command execution
+ * Implements the typed IUnrealMCPCommand interface, so large row batches are not serialized and
+ * parsed again on their way in; "bulk" selects the service's bulk import path
  */
 class UNREALMCP_API FAddRowsToDataTableCommand : public IUnrealMCPCommand
 {
@@ -19,8 +20,10 @@ public:
 
     // IUnrealMCPCommand interface
     virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
 
 private:
     /** Reference to the DataTable service */
@@ -28,21 +31,22 @@ private:
     
     /**
      * Parse JSON parameters into DataTable path and row parameters
-     * @param JsonString - JSON string containing parameters
+     * @param Params - Command parameters
      * @param OutDataTablePath - Parsed DataTable path
      * @param OutRows - Parsed row parameters
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const;
+    bool ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const;
     
     /**
      * Create success response JSON
      * @param AddedRows - Names of successfully added rows
      * @param FailedRows - Names of rows that failed to add
-     * @return JSON response string
+     * @param bBulk - Whether the bulk import path was used
+     * @return Response object
      */
-    FString CreateSuccessResponse(const TArray<FString>& AddedRows, const TArray<FString>& FailedRows) const;
+    TSharedRef<FJsonObject> CreateSuccessResponse(const TArray<FString>& AddedRows, const TArray<FString>& FailedRows, bool bBulk) const;
     
     /**
      * Create error response JSON
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for exporting a whole DataTable to a packed column file on disk
+ * The rows are written from the row memory without going through JSON, and the response
+ * carries the column layout and counts only
+ */
+class UNREALMCP_API FExportDataTableToFileCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FExportDataTableToFileCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
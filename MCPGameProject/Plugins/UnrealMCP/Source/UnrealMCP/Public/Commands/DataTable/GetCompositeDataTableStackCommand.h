@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for inspecting the parent tables of a composite DataTable
+ * Lists the parents in merge order and, per row page, which parent the row comes from and
+ * which earlier parents it overrides
+ */
+class UNREALMCP_API FGetCompositeDataTableStackCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FGetCompositeDataTableStackCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for reading CurveTable rows in pages
+ * Each row is returned as packed time and value arrays with its interpolation mode
+ */
+class UNREALMCP_API FGetCurveTableRowsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FGetCurveTableRowsCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
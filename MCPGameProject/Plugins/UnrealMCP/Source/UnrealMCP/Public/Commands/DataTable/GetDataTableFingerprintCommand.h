@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for getting the content fingerprint of a DataTable asset
+ * Returns the table's Merkle root and optionally each row's hash, so clients can skip tables and
+ * rows that did not change since they last read them
+ */
+class UNREALMCP_API FGetDataTableFingerprintCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FGetDataTableFingerprintCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+};
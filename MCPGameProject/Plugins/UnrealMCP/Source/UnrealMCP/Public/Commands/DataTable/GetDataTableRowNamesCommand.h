@@ -22,6 +22,7 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     /** Reference to the DataTable service */
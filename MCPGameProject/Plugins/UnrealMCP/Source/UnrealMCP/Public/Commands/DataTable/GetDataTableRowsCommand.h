@@ -6,7 +6,10 @@
 
 /**
  * Command for getting rows from DataTable assets
- * Implements the IUnrealMCPCommand interface for standardized command execution
+ * Implements the typed IUnrealMCPCommand interface, so row data (often the largest payload a
+ * client asks for) goes into the response without extra serialize/parse passes
+ * offset/limit page through the rows, fields projects them and filters selects them, so big
+ * tables can be scanned a page at a time
  */
 class UNREALMCP_API FGetDataTableRowsCommand : public IUnrealMCPCommand
 {
@@ -19,29 +22,32 @@ public:
 
     // IUnrealMCPCommand interface
     virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     /** Reference to the DataTable service */
     IDataTableService& DataTableService;
     
     /**
-     * Parse JSON parameters into DataTable path and optional row names
-     * @param JsonString - JSON string containing parameters
+     * Parse JSON parameters into DataTable path and row query
+     * @param Params - Command parameters
      * @param OutDataTablePath - Parsed DataTable path
-     * @param OutRowNames - Parsed row names (empty for all rows)
+     * @param OutQuery - Parsed row names (empty for all rows), paging, fields and filters
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutDataTablePath, TArray<FString>& OutRowNames, FString& OutError) const;
+    bool ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, FDataTableRowQuery& OutQuery, FString& OutError) const;
     
     /**
      * Create success response JSON
      * @param RowsData - JSON object containing the rows data
-     * @return JSON response string
+     * @return Response object
      */
-    FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& RowsData) const;
+    TSharedRef<FJsonObject> CreateSuccessResponse(const TSharedPtr<FJsonObject>& RowsData) const;
     
     /**
      * Create error response JSON (deprecated - use FMCPErrorHandler instead)
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for syncing rows into DataTable assets
+ * Adds rows that do not exist and updates the fields that changed in the ones that do, so a
+ * table can be synced from an external source in one call instead of get, delete and add
+ */
+class UNREALMCP_API FUpsertDataTableRowsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FUpsertDataTableRowsCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+    
+    /**
+     * Parse JSON parameters into DataTable path and row parameters
+     * @param Params - Command parameters
+     * @param OutDataTablePath - Parsed DataTable path
+     * @param OutRows - Parsed row parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const TSharedRef<FJsonObject>& Params, FString& OutDataTablePath, TArray<FDataTableRowParams>& OutRows, FString& OutError) const;
+    
+    /**
+     * Create success response JSON
+     * @param Result - Outcome of the upsert
+     * @return Response object
+     */
+    TSharedRef<FJsonObject> CreateSuccessResponse(const FDataTableUpsertResult& Result) const;
+};
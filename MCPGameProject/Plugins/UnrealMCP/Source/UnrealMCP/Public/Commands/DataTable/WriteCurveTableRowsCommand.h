@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IDataTableService.h"
+
+/**
+ * Command for writing CurveTable rows in bulk
+ * Each row gives its keys as packed time and value arrays that replace the row's keys; rows
+ * that do not exist are added, and the table is saved once for the whole batch
+ */
+class UNREALMCP_API FWriteCurveTableRowsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InDataTableService - Reference to the DataTable service for operations
+     */
+    explicit FWriteCurveTableRowsCommand(IDataTableService& InDataTableService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** Reference to the DataTable service */
+    IDataTableService& DataTableService;
+    
+    /**
+     * Parse the rows parameter into curve row parameters
+     * @param Params - Command parameters
+     * @param OutRows - Parsed row parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseRows(const TSharedRef<FJsonObject>& Params, TArray<FCurveTableRowParams>& OutRows, FString& OutError) const;
+};
@@ -23,10 +23,11 @@ public:
 private:
     /**
      * Register a single command and track it for cleanup
-     * @param Command - Command to register
+     * @param CommandName - Name the command reports
+     * @param Factory - Constructs the command on first use
      */
-    static void RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
     
-    /** Array of registered commands for cleanup */
-    static TArray<TSharedPtr<IUnrealMCPCommand>> RegisteredCommands;
+    /** Names of the registered commands, for cleanup */
+    static TArray<FString> RegisteredCommandNames;
 };
@@ -7,9 +7,11 @@
 /**
  * Command for deleting multiple actors by name in a single operation
  * Implements the IUnrealMCPCommand interface for standardized command execution
+ * The actors are deleted in one editor call and one undo transaction
  *
  * Parameters:
  *   names: Array of actor names to delete
+ *   collect_garbage: Optional; request one full garbage collection on the next tick (default false)
  *
  * Returns:
  *   JSON object with results per actor:
@@ -46,10 +48,11 @@ private:
      * Parse JSON parameters
      * @param JsonString - JSON string containing parameters
      * @param OutActorNames - Parsed array of actor names
+     * @param bOutCollectGarbage - Whether to request a garbage collection after deleting
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, TArray<FString>& OutActorNames, bool& bOutCollectGarbage, FString& OutError) const;
 
     /**
      * Create success response JSON with detailed per-actor results
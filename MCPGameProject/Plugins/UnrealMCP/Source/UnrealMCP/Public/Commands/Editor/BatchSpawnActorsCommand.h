@@ -16,13 +16,22 @@
  *     - rotation: [Pitch, Yaw, Roll] spawn rotation (optional, default [0,0,0])
  *     - scale: [X, Y, Z] scale (optional, default [1,1,1])
  *     - (type-specific params like mesh_path, text_content, box_extent, etc.)
+ *   deferred: Spawn with deferred construction in one transaction, refreshing the editor once
+ *     at the end; for large procedural layouts (optional, default false)
+ *   include_details: Return full actor details per result instead of only its path
+ *     (optional, default true, or false when deferred)
+ *   instancing: "ism" or "hism" to place every StaticMeshActor config with a mesh_path as an
+ *     instance on a single actor, one instanced component per mesh; other configs spawn
+ *     normally (optional, default off)
+ *   instanced_actor_name: Name of the actor holding the instances (optional, default "InstancedMeshes")
  *
  * Returns:
  *   JSON object with results per actor:
  *   {
  *     "results": [
  *       {"name": "Actor1", "success": true, "actor": {...actor details...}},
- *       {"name": "Actor2", "success": false, "error": "Failed to spawn"}
+ *       {"name": "Actor2", "success": false, "error": "Failed to spawn"},
+ *       {"name": "Rock1", "success": true, "instanced_in": "InstancedMeshes", "component": "HISM_SM_Rock", "instance_index": 0}
  *     ],
  *     "total": 2,
  *     "succeeded": 1,
@@ -45,6 +54,16 @@ public:
     virtual bool ValidateParams(const FString& Parameters) const override;
 
 private:
+    /** Batch-wide options of a request */
+    struct FBatchSpawnOptions
+    {
+        bool bDeferred = false;
+        bool bIncludeDetails = true;
+        /** Empty, "ism" or "hism" */
+        FString Instancing;
+        FString InstancedActorName = TEXT("InstancedMeshes");
+    };
+
     /** Reference to the editor service */
     IEditorService& EditorService;
 
@@ -52,10 +71,11 @@ private:
      * Parse JSON parameters to extract actor configurations array
      * @param JsonString - JSON string containing parameters
      * @param OutActorConfigs - Parsed array of actor configuration JSON objects
+     * @param OutOptions - Parsed batch-wide options
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, TArray<TSharedPtr<FJsonObject>>& OutActorConfigs, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, TArray<TSharedPtr<FJsonObject>>& OutActorConfigs, FBatchSpawnOptions& OutOptions, FString& OutError) const;
 
     /**
      * Parse a single actor configuration into spawn params
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IEditorService.h"
+
+/**
+ * Command for replacing StaticMeshActors with instances on a single actor
+ * Implements the IUnrealMCPCommand interface for standardized command execution
+ *
+ * Parameters:
+ *   actor_names: Array of StaticMeshActor names to convert
+ *   instanced_actor_name: Name of the new actor holding the instances (optional, default "InstancedMeshes")
+ *   hierarchical: Use HierarchicalInstancedStaticMeshComponents instead of plain
+ *     InstancedStaticMeshComponents (optional, default true)
+ *   delete_source_actors: Delete the converted actors (optional, default true)
+ *
+ * Returns:
+ *   JSON object:
+ *   {
+ *     "instanced_actor": {...actor details...},
+ *     "converted": ["Rock1", "Rock2"],
+ *     "skipped": ["Light1: not a StaticMeshActor in the level"],
+ *     "source_actors_deleted": true,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FConvertActorsToInstancesCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InEditorService - Reference to the editor service for operations
+     */
+    explicit FConvertActorsToInstancesCommand(IEditorService& InEditorService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    /** Parsed request parameters */
+    struct FConvertParams
+    {
+        TArray<FString> ActorNames;
+        FString InstancedActorName = TEXT("InstancedMeshes");
+        bool bHierarchical = true;
+        bool bDeleteSourceActors = true;
+    };
+
+    /** Reference to the editor service */
+    IEditorService& EditorService;
+
+    /**
+     * Parse JSON parameters
+     * @param JsonString - JSON string containing parameters
+     * @param OutParams - Parsed parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const FString& JsonString, FConvertParams& OutParams, FString& OutError) const;
+
+    /**
+     * Create error response JSON
+     * @param ErrorMessage - Error message
+     * @return JSON response string
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for running a list of arbitrary registered commands in one request
+ * Implements the typed IUnrealMCPCommand interface; the whole batch runs in a single game-thread
+ * visit, so building a graph takes one round trip instead of one per node and connection
+ *
+ * Parameters:
+ *   operations: Array of operations, each containing:
+ *     - id: Operation id other operations refer to (optional, default "op<index>")
+ *     - command: Name of any registered command except execute_batch (required)
+ *     - params: Command parameters (optional)
+ *     - depends_on: Ids of operations that must succeed first (optional)
+ *   stop_on_failure: Skip every operation not yet run once one fails (optional, default false)
+ *   rollback_on_failure: Undo the whole batch if any operation failed or was skipped (optional, default false)
+ *
+ * A string parameter of the form "$<id>.<field>.<field>..." is replaced by that field of the
+ * named operation's result, keeping its JSON type (see FMCPBatchReferences). An operation
+ * implicitly depends on every operation it references.
+ *
+ * The operations run on UMCPBatchOperationHandler. They run in list order, except that one never
+ * runs before its dependencies; an operation whose dependency failed or was skipped is skipped.
+ * Consecutive operations whose commands are thread-safe (AnyThread and AssetRegistryOnly queries)
+ * run concurrently on worker threads, after the game-thread operation before them and before the
+ * one after them.
+ * The batch is one undo transaction, and blueprint/graph/editor notifications are sent once per
+ * asset at the end (FMCPBatchEditScope).
+ *
+ * Returns:
+ *   {
+ *     "results": [
+ *       {"id": "op0", "success": true, "result": {...command result...}},
+ *       {"id": "op1", "success": false, "error": "..."},
+ *       {"id": "op2", "success": false, "skipped": true, "error": "Dependency 'op1' did not succeed"}
+ *     ],
+ *     "total": 3,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "skipped": 1,
+ *     "rolled_back": false,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FExecuteBatchCommand : public IUnrealMCPCommand
+{
+public:
+    /** Most operations one batch may contain */
+    static constexpr int32 MaxOperations = 1000;
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /** One parsed entry of the operations array */
+    struct FOperation
+    {
+        FString Id;
+        FString Command;
+        TSharedPtr<FJsonObject> Params;
+        /** Indices of the operations this one waits for */
+        TArray<int32> Dependencies;
+    };
+
+    /**
+     * Parse the operations array and work out the execution order
+     * @param Params - Command parameters
+     * @param OutOperations - Parsed operations, in list order
+     * @param OutOrder - Operation indices in execution order
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseOperations(const TSharedRef<FJsonObject>& Params, TArray<FOperation>& OutOperations, TArray<int32>& OutOrder, FString& OutError) const;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for writing every package whose save MCP commands have queued (see FMCPSaveQueue)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters: none
+ *
+ * Returns:
+ *   {
+ *     "saved": 3,
+ *     "failed_packages": ["/Game/Data/DT_Items"],
+ *     "success": false
+ *   }
+ */
+class UNREALMCP_API FFlushSavesCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+};
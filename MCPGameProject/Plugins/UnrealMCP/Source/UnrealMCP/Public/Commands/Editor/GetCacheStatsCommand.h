@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for reading the hit and miss statistics of every cache, object pool and index (see FMCPCacheStatsRegistry)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters:
+ *   - name: Only report sources whose name contains this (optional)
+ *   - reset: Reset the reported sources' statistics after reporting them (optional, default false)
+ *   - trim: Evict every entry of the budgeted caches before reporting (optional, default false)
+ *
+ * Returns:
+ *   {
+ *     "sources": [{
+ *       "name": "asset_search_index", "kind": "index",
+ *       "hits": 120, "misses": 1, "requests": 121, "hit_ratio": 0.99,
+ *       "invalidations": 0, "entries": 5230
+ *     }, {
+ *       "name": "json_object_pool", "kind": "pool",
+ *       "hits": 900, "misses": 12, "requests": 912, "hit_ratio": 0.98, "entries": 10,
+ *       "max_pooled": 14, "max_pool_size": 50, "returns": 910, "discarded": 0
+ *     }],
+ *     "totals": {"hits": 1020, "misses": 13, "requests": 1033, "hit_ratio": 0.99},
+ *     "memory_budget": {
+ *       "budget_bytes": 268435456, "used_bytes": 1048576, "evicted_entries": 0, "evicted_bytes": 0,
+ *       "trims": 0, "caches": {"graph_reachability_cache": 524288, ...}
+ *     },
+ *     "success": true
+ *   }
+ *
+ * Read-only, so running it does not invalidate the response cache it reports on.
+ */
+class UNREALMCP_API FGetCacheStatsCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual bool IsReadOnly() const override { return true; }
+};
@@ -15,6 +15,22 @@
  * Parameters:
  * - fields: Array of field names to include (default: ["actors"])
  * - actor_filter: Optional pattern for actor name filtering (supports wildcards *)
+ * - spatial: Optional region restricting "actors" to those whose bounds overlap it, answered from
+ *   a spatial index instead of a sweep over every actor:
+ *   - {"shape": "box", "min": [X, Y, Z], "max": [X, Y, Z]}
+ *   - {"shape": "sphere", "center": [X, Y, Z], "radius": R}
+ *   - {"shape": "frustum", "origin": [X, Y, Z], "rotation": [Pitch, Yaw, Roll], "fov": 90,
+ *      "aspect_ratio": 1.777, "near_distance": 10, "far_distance": 10000}
+ *   - {"shape": "nearest", "point": [X, Y, Z], "count": 5, "max_distance": 0}; items are sorted
+ *     nearest first and carry a "distance" to the actor's bounds
+ * - class_filter, tag_filter, folder_filter: Optional class (spawn_actor type or class name,
+ *   subclasses included), actor tag and outliner folder (subfolders included), answered from the
+ *   actor index where possible
+ * - actor_fields: Per-actor fields to return, from name, class, location, rotation, scale, label,
+ *   path, folder, tags (default: name, class, location, rotation, scale)
+ * - limit: Maximum number of actors to return (default: all); with a limit, actors are ordered by
+ *   path and the response carries has_more and next_cursor
+ * - cursor: next_cursor of the previous page
  */
 class FGetLevelMetadataCommand : public IUnrealMCPCommand
 {
@@ -26,11 +42,42 @@ public:
     virtual FString Execute(const FString& Parameters) override;
 
 private:
+    /** Parsed options of the "actors" field */
+    struct FActorListOptions
+    {
+        FActorListFilter Filter;
+        /** Bitmask of the per-actor fields to serialize */
+        uint32 FieldMask = 0;
+        FString Cursor;
+        int32 Limit = 0;
+    };
+
     IEditorService& EditorService;
 
     /** Check if a specific field is requested */
     bool IsFieldRequested(const TArray<TSharedPtr<FJsonValue>>* FieldsArray, const FString& FieldName) const;
 
-    /** Build actors info with optional filtering */
-    TSharedPtr<FJsonObject> BuildActorsInfo(const FString& ActorFilter) const;
+    /**
+     * Parse the filters, projection and paging of the "actors" field
+     * @param JsonObject - Command parameters
+     * @param OutOptions - Parsed options
+     * @param OutError - Error message if an option is invalid
+     * @return true if parsing succeeded
+     */
+    bool ParseActorListOptions(const TSharedPtr<FJsonObject>& JsonObject, FActorListOptions& OutOptions, FString& OutError) const;
+
+    /**
+     * Parse the optional spatial region
+     * @param JsonObject - Command parameters
+     * @param OutQuery - Parsed region, left unset if none was given
+     * @param OutError - Error message if the region is invalid
+     * @return true if parsing succeeded
+     */
+    bool ParseSpatialQuery(const TSharedPtr<FJsonObject>& JsonObject, TOptional<FActorSpatialQuery>& OutQuery, FString& OutError) const;
+
+    /** Build actors info with filtering and paging; nullptr with OutError set if the query fails */
+    TSharedPtr<FJsonObject> BuildActorsInfo(const FActorListOptions& Options, FString& OutError) const;
+
+    /** Serialize an error response */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
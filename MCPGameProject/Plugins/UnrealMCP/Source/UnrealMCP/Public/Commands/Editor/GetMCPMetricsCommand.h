@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for reading the per-command latency histograms and counters of the server (see FMCPMetrics)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters:
+ *   - command: Only report this command, in the JSON format (optional)
+ *   - format: "json" (default) or "prometheus"
+ *   - reset: Drop everything recorded after reporting it (optional, default false)
+ *
+ * Returns:
+ *   {
+ *     "uptime_seconds": 812.4,
+ *     "commands": [{
+ *       "command": "get_blueprint_metadata",
+ *       "requests": 42, "errors": 1, "cache_hits": 30, "send_failures": 0,
+ *       "bytes_received": 5120, "bytes_sent": 1048576,
+ *       "stages": {"queue_wait": {"count": 12, "mean_ms": 0.4, "p50_ms": 0.2, "p90_ms": 1.1, "p99_ms": 3.9, "max_ms": 4.2},
+ *                  "execute": {...}, "serialize": {...}, "send": {...}}
+ *     }],
+ *     "success": true
+ *   }
+ *   or, for "prometheus", {"format": "prometheus", "text": "# HELP mcp_command_duration_seconds ...", "success": true}
+ *
+ * Answered on the transport thread: it only reads the metrics, which are thread-safe, so it is
+ * not held up by a busy game thread or worker pool.
+ */
+class UNREALMCP_API FGetMCPMetricsCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::TransportThread; }
+    virtual bool IsReadOnly() const override { return true; }
+};
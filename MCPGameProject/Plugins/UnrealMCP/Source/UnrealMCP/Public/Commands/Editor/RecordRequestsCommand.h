@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for starting and stopping the record of incoming requests (see FMCPRequestRecorder)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters:
+ *   - action: "start", "stop" or "status" (default)
+ *   - path: File to record to, for "start" (optional, default a timestamped file in Saved/UnrealMCP/Recordings)
+ *
+ * Returns:
+ *   {
+ *     "recording": true,
+ *     "path": "D:/Project/Saved/UnrealMCP/Recordings/Requests_20250101_120000.jsonl",
+ *     "requests": 128,
+ *     "elapsed_seconds": 95.2,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FRecordRequestsCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+    virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::AnyThread; }
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for replaying a request recording through the bridge (see FMCPRequestReplayer)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters:
+ *   - action: "start", "stop" or "status" (default)
+ *   - path: Recording made by record_requests, for "start"
+ *   - speed: Pace relative to the recording, for "start" (optional, default 1; 0 for as fast as possible)
+ *   - max_requests: Replay at most this many requests, for "start" (optional, default all)
+ *
+ * Returns:
+ *   {
+ *     "state": "running",
+ *     "path": "D:/Project/Saved/UnrealMCP/Recordings/Requests_20250101_120000.jsonl",
+ *     "speed": 4, "requests_total": 128, "requests_sent": 40, "responses": 39, "errors": 1, "busy": 0,
+ *     "recorded_seconds": 95.2, "elapsed_seconds": 7.9,
+ *     "latency": {"count": 39, "mean_ms": 12.5, "p50_ms": 4.1, "p90_ms": 30.2, "p99_ms": 88.0, "max_ms": 91.3},
+ *     "success": true
+ *   }
+ *
+ * The replay runs in the background; poll "status" until "state" is "finished" or "stopped",
+ * then compare get_mcp_metrics against the recorded session's.
+ */
+class UNREALMCP_API FReplayRequestsCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+};
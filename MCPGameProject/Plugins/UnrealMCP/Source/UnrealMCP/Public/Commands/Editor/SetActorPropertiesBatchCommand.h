@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IEditorService.h"
+
+/**
+ * Command for setting properties on many actors in a single operation
+ * All changes are one undo step; each actor gets one PostEditChange and the viewports redraw once
+ *
+ * Parameters:
+ *   updates: Array of {"name": "Actor1", "properties": {"PropertyName": value, ...}}
+ *
+ * Returns:
+ *   JSON object with results per update:
+ *   {
+ *     "results": [
+ *       {"name": "Actor1", "success": true},
+ *       {"name": "Actor2", "success": false, "error": "bHidden: Property not found"}
+ *     ],
+ *     "total": 2,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "success": true
+ *   }
+ *   Properties that were set stay set when another property of the same actor fails.
+ */
+class UNREALMCP_API FSetActorPropertiesBatchCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InEditorService - Reference to the editor service for operations
+     */
+    explicit FSetActorPropertiesBatchCommand(IEditorService& InEditorService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    /** Reference to the editor service */
+    IEditorService& EditorService;
+
+    /**
+     * Parse JSON parameters
+     * @param JsonString - JSON string containing parameters
+     * @param OutUpdates - Parsed property updates
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const FString& JsonString, TArray<FActorPropertyUpdate>& OutUpdates, FString& OutError) const;
+
+    /**
+     * Create success response JSON with a result per update
+     * @param Updates - Updates that were applied
+     * @param Errors - Error per update, empty where it succeeded
+     * @return JSON response string
+     */
+    FString CreateSuccessResponse(const TArray<FActorPropertyUpdate>& Updates, const TArray<FString>& Errors) const;
+
+    /**
+     * Create error response JSON
+     * @param ErrorMessage - Error message
+     * @return JSON response string
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
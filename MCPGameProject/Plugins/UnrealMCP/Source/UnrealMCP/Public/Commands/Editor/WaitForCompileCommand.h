@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for collecting the results of deferred compiles (see FMCPCompileQueue)
+ * Implements the typed IUnrealMCPCommand interface
+ *
+ * Parameters:
+ *   ticket: Ticket returned by a compile command called with "deferred": true
+ *   tickets: Array of tickets, instead of or in addition to ticket
+ *   wait: Compile still-queued tickets now instead of only reporting them (optional, default true)
+ *
+ * Returns:
+ *   {
+ *     "tickets": [
+ *       {"ticket": 3, "state": "finished", "result": {...compile command response...}},
+ *       {"ticket": 4, "state": "pending"},
+ *       {"ticket": 9, "state": "unknown"}
+ *     ],
+ *     "pending_compiles": 1,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FWaitForCompileCommand : public IUnrealMCPCommand
+{
+public:
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    /**
+     * Collect the requested tickets
+     * @param Params - Command parameters
+     * @param OutTickets - Requested tickets, in request order
+     * @return true if at least one ticket was given
+     */
+    bool ParseTickets(const TSharedRef<FJsonObject>& Params, TArray<int64>& OutTickets) const;
+};
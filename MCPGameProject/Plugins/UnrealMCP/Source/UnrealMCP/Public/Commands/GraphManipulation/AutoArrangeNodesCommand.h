@@ -10,6 +10,7 @@
  * Parameters:
  *   - blueprint_name (string, required): Name or path of the Blueprint
  *   - graph_name (string, optional): Name of the graph to arrange (default: "EventGraph")
+ *   - node_ids (array, optional): Only place these nodes next to their neighbours, leaving the rest in place
  *
  * Returns:
  *   - success (bool): Whether the operation succeeded
@@ -27,7 +27,7 @@ private:
     static void RegisterCleanupBlueprintGraphCommand();
     
     /** Helper to register and track a command */
-    static void RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
     
     /** Array to track registered command names for cleanup */
     static TArray<FString> RegisteredCommandNames;
@@ -2,10 +2,47 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include "Commands/MCPResponseWriter.h"
+
+class FJsonObject;
+
+/**
+ * Which threads a command may execute on
+ */
+enum class EMCPThreadAffinity : uint8
+{
+    /** Touches UObjects or editor state; runs on the game thread */
+    GameThreadRequired,
+
+    /** Touches no UObjects (paths, settings, registry metadata); runs on any thread */
+    AnyThread,
+
+    /** Only queries the asset registry and looks up existing classes; runs on a worker thread while garbage collection is held off */
+    AssetRegistryOnly,
+
+    /**
+     * Hands its work to the game thread and waits for it (viewport and widget captures); runs on a
+     * worker thread, except where the game thread is itself waiting for workers, such as a batch
+     * wave, where it runs on the game thread instead
+     */
+    WaitsOnGameThread,
+
+    /**
+     * Answers in constant time from thread-safe state (health, metrics); runs right away on the
+     * thread that received the request, ahead of every queue and exempt from admission and warm-up
+     */
+    TransportThread
+};
 
 /**
  * Interface for all MCP commands that can be executed by the UnrealMCP system.
  * Provides a standardized way to execute commands, validate parameters, and get command metadata.
+ *
+ * Commands come in two flavours. String-based commands implement Execute/ValidateParams on JSON
+ * text; the typed overloads adapt them by serializing the parameters. Typed commands override
+ * the FJsonObject overloads, so the request's parsed parameters and their result object flow
+ * through the registry and bridge without any JSON text in between, and implement the string
+ * versions with ExecuteFromString/ValidateParamsFromString.
  */
 class UNREALMCP_API IUnrealMCPCommand
 {
@@ -19,6 +56,13 @@ public:
      */
     virtual FString Execute(const FString& Parameters) = 0;
 
+    /**
+     * Execute the command with already-parsed parameters
+     * @param Params Command parameters
+     * @param Response Receives the command result
+     */
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response);
+
     /**
      * Get the name/identifier of this command
      * @return Command name used for registration and lookup
@@ -31,4 +75,56 @@ public:
      * @return True if parameters are valid, false otherwise
      */
     virtual bool ValidateParams(const FString& Parameters) const = 0;
+
+    /**
+     * Validate already-parsed parameters before execution
+     * @param Params Command parameters
+     * @return True if parameters are valid, false otherwise
+     */
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const;
+
+    /**
+     * Get the threads this command may execute on; only return something other than
+     * GameThreadRequired if none of the command's code, including its services, needs the game thread
+     * @return Thread affinity the dispatcher schedules the command with
+     */
+    virtual EMCPThreadAffinity GetThreadAffinity() const { return EMCPThreadAffinity::GameThreadRequired; }
+
+    /**
+     * Whether the command only reads editor state; identical concurrent read-only requests may be
+     * answered with a single execution
+     * @return True if executing the command changes nothing
+     */
+    virtual bool IsReadOnly() const { return false; }
+
+    /**
+     * Whether a successful response may be served again until editor state changes; only meaningful
+     * for read-only commands whose response depends on nothing but their parameters and loaded assets
+     * @return True if the dispatcher may cache the command's responses
+     */
+    virtual bool IsResultCacheable() const { return false; }
+
+protected:
+    /**
+     * String adapter for typed commands: parse the parameters and run the typed Execute
+     * @param Parameters JSON string containing command parameters
+     * @return JSON string containing the command result
+     */
+    FString ExecuteFromString(const FString& Parameters);
+
+    /**
+     * String adapter for typed commands: parse the parameters and run the typed ValidateParams
+     * @param Parameters JSON string containing command parameters
+     * @return True if parameters are valid, false otherwise
+     */
+    bool ValidateParamsFromString(const FString& Parameters) const;
+
+    /** Serialize parameters for the string-based overloads */
+    static FString SerializeParams(const TSharedRef<FJsonObject>& Params);
+
+    /** Parse string parameters for the typed overloads; nullptr if they are not a JSON object */
+    static TSharedPtr<FJsonObject> ParseParams(const FString& Parameters);
 };
+
+/** Constructs a command the first time it is used; see FUnrealMCPCommandRegistry::RegisterLazyCommand */
+using FMCPCommandFactory = TFunction<TSharedPtr<IUnrealMCPCommand>()>;
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Registers one command of a legacy HandleCommand(CommandType, Params) handler class in the
+ * command registry, so legacy handlers are dispatched through the same table as every other
+ * command instead of through per-handler name lists.
+ *
+ * The handler validates its own parameters; its result object is passed through unchanged.
+ */
+class UNREALMCP_API FMCPLegacyHandlerCommand : public IUnrealMCPCommand
+{
+public:
+    /** Signature of a legacy handler's HandleCommand */
+    typedef TFunction<TSharedPtr<FJsonObject>(const FString&, const TSharedPtr<FJsonObject>&)> FHandler;
+
+    /**
+     * @param InCommandName Command name the handler answers to
+     * @param InHandler Handler entry point; called with InCommandName as the command type
+     */
+    FMCPLegacyHandlerCommand(const FString& InCommandName, FHandler InHandler);
+
+    /**
+     * Register a handler for each of the given names that no other command has claimed
+     * @param CommandNames Command names the handler answers to
+     * @param Handler Handler entry point
+     * @return Registered commands, for unregistration at shutdown
+     */
+    static TArray<TSharedPtr<IUnrealMCPCommand>> RegisterHandler(const TArray<FString>& CommandNames, const FHandler& Handler);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual void Execute(const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool ValidateParams(const TSharedRef<FJsonObject>& Params) const override;
+
+private:
+    FString CommandName;
+    FHandler Handler;
+};
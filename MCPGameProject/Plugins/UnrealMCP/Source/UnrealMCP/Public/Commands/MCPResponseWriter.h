@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+struct FMCPError;
+
+/**
+ * Receives the result of an IUnrealMCPCommand
+ *
+ * Commands on the typed path hand over their result object as-is; commands that still build
+ * JSON text hand over the string. Either form is converted only when the consumer asks for the
+ * other one, so a typed command's result reaches the bridge's response envelope without being
+ * serialized and re-parsed.
+ *
+ * The result has the same shape in both forms: the command's fields, with "success": false
+ * and "error" on failure. A plain SetError(Message) keeps only the message until one of the
+ * forms is asked for, so the bridge can write the error response from it directly.
+ */
+class UNREALMCP_API FMCPResponseWriter
+{
+public:
+    FMCPResponseWriter();
+
+    /**
+     * Set the result object
+     * @param Result Command result; held by reference, not copied
+     */
+    void SetResult(const TSharedRef<FJsonObject>& Result);
+
+    /**
+     * Set the result as serialized JSON text (string-based commands)
+     * @param ResultJson Command result text
+     */
+    void SetSerializedResult(const FString& ResultJson);
+
+    /**
+     * Set a {"success": false, "error": Message} result
+     * @param Message Error message
+     */
+    void SetError(const FString& Message);
+
+    /**
+     * Set a structured error result (see FMCPErrorHandler::CreateStructuredErrorObject)
+     * @param Error Error to report
+     */
+    void SetError(const FMCPError& Error);
+
+    /** @return true once a result has been set */
+    bool HasResult() const { return ResultObject.IsValid() || bHasSerializedResult || bHasPlainError; }
+
+    /**
+     * Get the message of a result set with SetError(Message)
+     * @return The message, or nullptr if the result is anything else
+     */
+    const FString* GetPlainError() const { return bHasPlainError ? &PlainError : nullptr; }
+
+    /**
+     * Get the result as an object, parsing serialized text on first use
+     * @return Result object, or nullptr if no result was set or the text is not a JSON object
+     */
+    TSharedPtr<FJsonObject> GetResultObject();
+
+    /**
+     * Get the result as JSON text, serializing the object on first use
+     * @return Result text, or an empty string if no result was set
+     */
+    FString GetSerializedResult();
+
+private:
+    TSharedPtr<FJsonObject> ResultObject;
+    FString SerializedResult;
+    bool bHasSerializedResult;
+    FString PlainError;
+    bool bHasPlainError;
+};
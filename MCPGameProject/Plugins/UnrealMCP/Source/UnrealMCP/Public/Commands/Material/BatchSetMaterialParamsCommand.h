@@ -3,10 +3,14 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class FJsonObject;
 class IMaterialService;
+struct FMaterialInstanceParameterBatch;
 
 /**
  * Command for setting multiple parameters on a Material Instance in a single operation.
+ * With "material_instances", "folder" or "parent_material" it sets the same parameters on many
+ * instances, each updated and saved once.
  */
 class UNREALMCP_API FBatchSetMaterialParamsCommand : public IUnrealMCPCommand
 {
@@ -21,6 +25,9 @@ public:
 private:
     IMaterialService& MaterialService;
 
+    /** Apply the parameters to every instance named or matched by the request */
+    FString ExecuteForInstances(const TSharedPtr<FJsonObject>& JsonObject, const FMaterialInstanceParameterBatch& Batch) const;
+
     FString CreateSuccessResponse(const FString& MaterialPath, const TArray<FString>& ScalarParams, const TArray<FString>& VectorParams, const TArray<FString>& TextureParams) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
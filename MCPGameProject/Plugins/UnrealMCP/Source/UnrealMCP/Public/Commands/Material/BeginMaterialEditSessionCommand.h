@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for opening an edit session on a material, deferring recompiles and saves of expression edits until the session ends
+ */
+class UNREALMCP_API FBeginMaterialEditSessionCommand : public IUnrealMCPCommand
+{
+public:
+    FBeginMaterialEditSessionCommand();
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
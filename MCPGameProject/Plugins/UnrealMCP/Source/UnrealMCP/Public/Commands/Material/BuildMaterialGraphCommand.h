@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for building a material graph from one declarative spec: expressions, connections
+ * and output bindings, with one graph rebuild and one compile
+ */
+class UNREALMCP_API FBuildMaterialGraphCommand : public IUnrealMCPCommand
+{
+public:
+    FBuildMaterialGraphCommand();
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for ending a material edit session, recompiling and saving the material once for all edits made in it
+ */
+class UNREALMCP_API FEndMaterialEditSessionCommand : public IUnrealMCPCommand
+{
+public:
+    FEndMaterialEditSessionCommand();
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for polling a material compile started with compile_material "async": true
+ */
+class UNREALMCP_API FGetMaterialCompileStatusCommand : public IUnrealMCPCommand
+{
+public:
+    FGetMaterialCompileStatusCommand();
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    // Not cacheable: the status changes while shaders compile, without any editor edit
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -15,6 +15,8 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
+    virtual bool IsResultCacheable() const override { return true; }
 
 private:
     IMaterialService& MaterialService;
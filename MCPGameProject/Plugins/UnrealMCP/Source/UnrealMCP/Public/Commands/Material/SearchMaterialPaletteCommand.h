@@ -5,7 +5,7 @@
 
 /**
  * Command to search the Material Palette for expressions and functions.
- * Uses UE's built-in MaterialExpressionClasses and Asset Registry.
+ * Answers ranked, paged searches from FMaterialPaletteIndex.
  */
 class UNREALMCP_API FSearchMaterialPaletteCommand : public IUnrealMCPCommand
 {
@@ -15,6 +15,7 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     FString CreateErrorResponse(const FString& ErrorMessage) const;
@@ -23,12 +23,13 @@ public:
     static void UnregisterAllCommands();
 
 private:
-    /** Array to track registered commands for cleanup */
-    static TArray<TSharedPtr<class IUnrealMCPCommand>> RegisteredCommands;
+    /** Names of the registered commands, for cleanup */
+    static TArray<FString> RegisteredCommandNames;
 
     /**
      * Register a command and track it for cleanup
-     * @param Command - Command to register
+     * @param CommandName - Name the command reports
+     * @param Factory - Constructs the command on first use
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for exporting every Blueprint in a folder, one JSON file per asset plus a manifest.
+ * Output goes to Saved/UnrealMCP/Exports/bulk_<timestamp>/, mirroring the package paths.
+ *
+ * Blueprints are loaded through FMCPAsyncAssetLoader, several packages at once. Each is copied into
+ * an FBlueprintGraphExportWriter snapshot on the game thread as soon as it has loaded, and the
+ * snapshots are written on worker threads while the loader works on the next Blueprints.
+ *
+ * Parameters:
+ *   - folder_path (string, required): Content folder to export, e.g. "/Game/Blueprints"
+ *   - recursive (bool, optional): Include subfolders (default: true)
+ *   - include_components (bool, optional): Include component hierarchy (default: true)
+ *   - compress (bool, optional): Write gzip .json.gz files (default: false)
+ *
+ * Returns:
+ *   - success (bool): Whether the export ran
+ *   - output_directory (string): Directory holding the exported files
+ *   - manifest_path (string): Full path to manifest.json, listing every asset with its file or error
+ *   - asset_count (int): Number of Blueprints found
+ *   - exported_count (int): Number of Blueprints exported
+ *   - failed_count (int): Number of Blueprints that failed to load or write
+ *   - cancelled (bool): Whether the client cancelled before every asset was exported
+ */
+class UNREALMCP_API FBatchExportBlueprintGraphsCommand : public IUnrealMCPCommand
+{
+public:
+    FBatchExportBlueprintGraphsCommand() = default;
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("batch_export_blueprint_graphs"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+    /** Snapshots kept waiting for their file write before the next Blueprint is snapshotted */
+    static constexpr int32 MaxPendingWrites = 16;
+
+private:
+    /**
+     * Create error response JSON
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/Migration/BlueprintGraphExportWriter.h"
+
+class FJsonObject;
+class UBlueprint;
+
+/**
+ * Node-level diff of two Blueprint snapshots, for reviewing edits made to a Blueprint.
+ *
+ * Both sides are FBlueprintGraphExportWriter snapshots, so the baseline can be the live Blueprint
+ * captured earlier, an export file written by export_blueprint_graph, or the package as saved on
+ * disk. Graphs are matched by name and nodes by GUID. Every node is reduced to a few hashes (header,
+ * position, comment, pins, pin defaults) and every link to a key, so the diff is one pass over each
+ * side; only the nodes whose hashes differ are reported, with the parts that changed.
+ *
+ * Game thread only where a Blueprint is captured; the diff itself reads nothing but the snapshots.
+ */
+class UNREALMCP_API FBlueprintGraphDiff
+{
+public:
+    using FBlueprintSnapshot = FBlueprintGraphExportWriter::FBlueprintSnapshot;
+
+    struct FOptions
+    {
+        /** Only graphs whose name contains this, as export_blueprint_graph filters them; empty for all */
+        FString GraphName;
+
+        /** Leave nodes that only moved out of the modified ones */
+        bool bIgnorePositions = false;
+    };
+
+    /**
+     * Read an export_blueprint_graph file back into a snapshot
+     * @param FilePath Export file, .json or .json.gz
+     * @param OutBlueprint Receives the Blueprint's name, path and graphs
+     * @param OutError Set when the file cannot be read or is not an export
+     * @return true if the file was read
+     */
+    static bool ReadExport(const FString& FilePath, FBlueprintSnapshot& OutBlueprint, FString& OutError);
+
+    /**
+     * Capture the graphs of a Blueprint as its package was last saved, without touching the loaded one
+     * @param Blueprint Loaded Blueprint
+     * @param OutBlueprint Receives the saved Blueprint's graphs
+     * @param OutError Set when the package was never saved or cannot be loaded
+     * @return true if the saved graphs were captured
+     */
+    static bool CaptureSavedBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutBlueprint, FString& OutError);
+
+    /** Capture the graphs of a loaded Blueprint; game thread only */
+    static void CaptureBlueprint(UBlueprint* Blueprint, FBlueprintSnapshot& OutBlueprint);
+
+    /**
+     * Diff two snapshots
+     * @param Baseline Earlier state
+     * @param Current Later state
+     * @param Options Graph filter and what counts as a change
+     * @return "graphs" with each changed graph's added, removed and modified nodes and added and
+     *         removed links, "summary" with their totals, and "identical"
+     */
+    static TSharedPtr<FJsonObject> Diff(const FBlueprintSnapshot& Baseline, const FBlueprintSnapshot& Current, const FOptions& Options);
+};
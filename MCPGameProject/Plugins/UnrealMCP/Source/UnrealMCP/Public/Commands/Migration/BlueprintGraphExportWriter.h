@@ -0,0 +1,165 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+class FJsonObject;
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/**
+ * Streams a JSON document into Saved/UnrealMCP/Exports/ without building it in memory first.
+ *
+ * Graphs, nodes and pins are written as UTF-8 straight into a chunked file archive, so a large
+ * Blueprint costs one chunk of output instead of a JSON object tree plus its full text. With
+ * compression, every chunk becomes one gzip member; concatenated members are a valid .gz file
+ * that gzip tools and Python's gzip module read as a single stream.
+ *
+ * Everything is written from snapshots: plain copies of what the export says about a Blueprint. The
+ * UObject overloads capture and write one node at a time on the game thread; a whole snapshot, taken
+ * on the game thread, can be written from any thread (batch_export_blueprint_graphs does so).
+ *
+ * Used by export_blueprint_graph, batch_export_blueprint_graphs and by the backups of the migration
+ * commands that edit Blueprints.
+ */
+class UNREALMCP_API FBlueprintGraphExportWriter
+{
+public:
+    using FJsonWriter = TJsonWriter<UTF8CHAR, TPrettyJsonPrintPolicy<UTF8CHAR>>;
+
+    struct FPinSnapshot
+    {
+        FString Name;
+        bool bIsInput = true;
+        FString Category;
+        FString SubCategory;
+        bool bIsArray = false;
+        bool bIsReference = false;
+        bool bIsConst = false;
+        FString DefaultValue;
+        FString DefaultObject;
+        FString DefaultText;
+        /** GUID of each linked node and the pin's name on it */
+        TArray<TPair<FString, FString>> Connections;
+    };
+
+    struct FNodeSnapshot
+    {
+        FString Guid;
+        FString Class;
+        FString Title;
+        int32 PosX = 0;
+        int32 PosY = 0;
+        FString Comment;
+        bool bCommentBubbleVisible = false;
+        /** node_type and the fields specific to it, in output order */
+        TArray<TPair<FString, FString>> TypeFields;
+        /** Set for function calls */
+        TOptional<bool> bIsPure;
+        TArray<FPinSnapshot> Pins;
+    };
+
+    struct FGraphSnapshot
+    {
+        FString Name;
+        FString Class;
+        TArray<FNodeSnapshot> Nodes;
+    };
+
+    struct FComponentSnapshot
+    {
+        FString Name;
+        FString Class;
+        FString Parent;
+    };
+
+    struct FVariableSnapshot
+    {
+        FString Name;
+        FString Type;
+        FString SubType;
+        bool bIsExposed = false;
+    };
+
+    struct FBlueprintSnapshot
+    {
+        FString Name;
+        FString Path;
+        FString ParentClass;
+        FString ParentClassPath;
+        TArray<FGraphSnapshot> Graphs;
+        /** Unset when components were not requested */
+        TOptional<TArray<FComponentSnapshot>> Components;
+        TArray<FVariableSnapshot> Variables;
+    };
+
+    /** Bytes of JSON buffered before they are written (and compressed) */
+    static constexpr int32 ChunkBytes = 256 * 1024;
+
+    FBlueprintGraphExportWriter();
+    ~FBlueprintGraphExportWriter();
+
+    /**
+     * Create the file; the caller then writes one root value through GetJsonWriter()
+     * @param FileName File name inside the export directory; ".gz" is appended when compressing
+     * @param bCompress Write gzip instead of plain JSON
+     * @return false if the file could not be created
+     */
+    bool Open(const FString& FileName, bool bCompress = false);
+
+    /** Writer for the document; valid between Open and Close */
+    TSharedRef<FJsonWriter> GetJsonWriter() const { return JsonWriter.ToSharedRef(); }
+
+    /**
+     * Flush and close the file; a file that failed to write is deleted
+     * @return Full path of the written file, or an empty string on failure
+     */
+    FString Close();
+
+    /** Copy a pin, node or graph; game thread only */
+    static void CapturePin(UEdGraphPin* Pin, FPinSnapshot& OutPin);
+    static void CaptureNode(UEdGraphNode* Node, FNodeSnapshot& OutNode);
+    static void CaptureGraph(UEdGraph* Graph, FGraphSnapshot& OutGraph);
+
+    /** Copy a Blueprint's name, parent class, components and variables, but not its graphs; game thread only */
+    static void CaptureBlueprint(UBlueprint* Blueprint, bool bIncludeComponents, FBlueprintSnapshot& OutBlueprint);
+
+    /** Write a pin or node as an array element */
+    static void WritePin(FJsonWriter& Writer, const FPinSnapshot& Pin);
+    static void WriteNode(FJsonWriter& Writer, const FNodeSnapshot& Node);
+
+    /** Write a graph's name, class and nodes into the object being written */
+    static void WriteGraphFields(FJsonWriter& Writer, const FGraphSnapshot& Graph);
+
+    /** As above, capturing one node at a time so the graph is never copied whole; game thread only */
+    static void WriteGraphFields(FJsonWriter& Writer, UEdGraph* Graph);
+
+    /** Write a Blueprint as the root object, graphs included */
+    static void WriteBlueprint(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint);
+
+    /**
+     * Write a Blueprint as the root object in two halves, so the caller can stream the elements of
+     * the "graphs" array in between: the start opens the object and the array, the end closes them
+     */
+    static void WriteBlueprintStart(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint);
+    static void WriteBlueprintEnd(FJsonWriter& Writer, const FBlueprintSnapshot& Blueprint);
+
+    /**
+     * Write a small, already built document (e.g. a reparent backup) to a file
+     * @return Full path of the written file, or an empty string on failure
+     */
+    static FString WriteJsonFile(const FString& FileName, const TSharedRef<FJsonObject>& Content, bool bCompress = false);
+
+    /** @return Saved/UnrealMCP/Exports/, created if missing */
+    static FString GetExportDirectory();
+
+private:
+    class FChunkedFileArchive;
+
+    TUniquePtr<FChunkedFileArchive> Archive;
+    TSharedPtr<FJsonWriter> JsonWriter;
+    FString FilePath;
+};
@@ -33,31 +33,6 @@ public:
     virtual bool ValidateParams(const FString& Parameters) const override;
 
 private:
-    /**
-     * Get the export directory path for backups.
-     */
-    FString GetExportDirectory();
-
-    /**
-     * Write JSON content to a temp file.
-     */
-    FString WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent);
-
-    /**
-     * Serialize a Blueprint graph to JSON for backup.
-     */
-    TSharedPtr<FJsonObject> SerializeGraph(class UEdGraph* Graph, bool bIncludeDefaults);
-
-    /**
-     * Serialize a graph node to JSON.
-     */
-    TSharedPtr<FJsonObject> SerializeNode(class UEdGraphNode* Node);
-
-    /**
-     * Serialize a pin to JSON.
-     */
-    TSharedPtr<FJsonObject> SerializePin(class UEdGraphPin* Pin, bool bIncludeConnections);
-
     /**
      * Create error response JSON
      */
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for comparing a Blueprint's graphs with an earlier export or with the saved package.
+ * Nodes are matched by GUID and compared by hash (see FBlueprintGraphDiff), so only what changed
+ * is returned instead of two full exports.
+ *
+ * Parameters:
+ *   - blueprint_path (string, required): Path to the Blueprint
+ *   - export_path (string, optional): export_blueprint_graph file to compare with; a bare file name
+ *     is looked up in Saved/UnrealMCP/Exports/. When omitted, the package as saved on disk is used
+ *   - graph_name (string, optional): Only graphs whose name contains this
+ *   - ignore_positions (bool, optional): Do not report nodes that only moved (default: false)
+ *
+ * Returns:
+ *   - success (bool): Whether the diff was made
+ *   - baseline (string): "export" or "saved_package"
+ *   - identical (bool): Whether no graph changed
+ *   - graphs (array): Changed graphs with added_nodes, removed_nodes, modified_nodes (with the
+ *     changed parts: header, position, comment, pins, defaults), added_links and removed_links
+ *   - summary (object): Totals of the above
+ */
+class UNREALMCP_API FDiffBlueprintGraphsCommand : public IUnrealMCPCommand
+{
+public:
+    FDiffBlueprintGraphsCommand() = default;
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("diff_blueprint_graphs"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
+
+private:
+    /**
+     * Create error response JSON
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -6,12 +6,14 @@
 /**
  * Command for exporting complete Blueprint graphs to JSON files.
  * Outputs to Saved/UnrealMCP/Exports/ to avoid socket buffer issues with complex Blueprints.
+ * The file is streamed by FBlueprintGraphExportWriter as the graphs are walked.
  *
  * Parameters:
  *   - blueprint_path (string, required): Path to the Blueprint
  *   - graph_name (string, optional): Filter to specific graph name
  *   - include_components (bool, optional): Include component hierarchy (default: true)
  *   - include_defaults (bool, optional): Include default values (default: false)
+ *   - compress (bool, optional): Write gzip to a .json.gz file (default: false)
  *
  * Returns:
  *   - success (bool): Whether the export succeeded
@@ -30,36 +32,11 @@ public:
     virtual bool ValidateParams(const FString& Parameters) const override;
 
 private:
-    /**
-     * Serialize a Blueprint graph to JSON.
-     */
-    TSharedPtr<FJsonObject> SerializeGraph(class UEdGraph* Graph, bool bIncludeDefaults);
-
-    /**
-     * Serialize a graph node to JSON.
-     */
-    TSharedPtr<FJsonObject> SerializeNode(class UEdGraphNode* Node);
-
-    /**
-     * Serialize a pin to JSON.
-     */
-    TSharedPtr<FJsonObject> SerializePin(class UEdGraphPin* Pin, bool bIncludeConnections);
-
-    /**
-     * Get the export directory path.
-     */
-    FString GetExportDirectory();
-
     /**
      * Generate a timestamped filename for exports.
      */
     FString GenerateExportFileName(const FString& BlueprintName);
 
-    /**
-     * Write JSON content to a temp file in Saved/UnrealMCP/Exports/
-     */
-    FString WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent);
-
     /**
      * Create success response JSON
      */
@@ -7,6 +7,9 @@
  * Command for finding all assets/Blueprints that reference a given Blueprint or function.
  * Useful for understanding impact before migrating Blueprint functionality to C++.
  *
+ * Referencers come from the asset registry; their function call nodes come from
+ * FBlueprintCallSiteIndex, so a referencer is only loaded and scanned by the first lookup that needs it.
+ *
  * Parameters:
  *   - target_path (string, required): Path to the target Blueprint
  *   - target_function (string, optional): Function name to find specific references to
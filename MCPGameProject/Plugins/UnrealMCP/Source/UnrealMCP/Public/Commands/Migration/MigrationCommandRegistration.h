@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all Blueprint Migration commands
@@ -33,16 +34,18 @@ private:
      * Register individual Migration commands
      */
     static void RegisterExportBlueprintGraphCommand();
+    static void RegisterBatchExportBlueprintGraphsCommand();
     static void RegisterGetBlueprintDependenciesCommand();
     static void RegisterFindBlueprintReferencesCommand();
     static void RegisterRedirectFunctionCallCommand();
     static void RegisterDeleteBlueprintFunctionCommand();
     static void RegisterSetBlueprintParentClassCommand();
     static void RegisterGetBlueprintFunctionsCommand();
+    static void RegisterDiffBlueprintGraphsCommand();
 
     /**
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
@@ -36,16 +36,6 @@ public:
     virtual bool ValidateParams(const FString& Parameters) const override;
 
 private:
-    /**
-     * Get the export directory path for backups.
-     */
-    FString GetExportDirectory();
-
-    /**
-     * Write JSON content to a temp file.
-     */
-    FString WriteJsonToTempFile(const FString& FileName, const TSharedPtr<FJsonObject>& JsonContent);
-
     /**
      * Create error response JSON
      */
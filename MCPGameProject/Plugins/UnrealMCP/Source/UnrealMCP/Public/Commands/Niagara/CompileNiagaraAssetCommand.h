@@ -22,9 +22,12 @@ private:
     struct FCompileParams
     {
         FString AssetPath;
+        /** Start the compile and return a job for get_compile_status instead of waiting */
+        bool bAsync = false;
     };
 
     bool ParseParameters(const FString& JsonString, FCompileParams& OutParams, FString& OutError) const;
     FString CreateSuccessResponse(const FString& Warnings = TEXT("")) const;
+    FString CreateAsyncResponse(const FString& AssetPath, int64 JobId) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for reading the results of start_bulk_niagara_diagnostics
+ * Returns the systems finished since the caller's cursor, so results can be consumed while the job runs
+ */
+class UNREALMCP_API FGetBulkNiagaraDiagnosticsCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetBulkNiagaraDiagnosticsCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("get_bulk_niagara_diagnostics"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
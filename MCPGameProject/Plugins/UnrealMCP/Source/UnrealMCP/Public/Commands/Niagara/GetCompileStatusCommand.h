@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for polling a Niagara compile started with "async": true
+ * Reports per-emitter script progress and, once finished, the compile result
+ */
+class UNREALMCP_API FGetCompileStatusCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetCompileStatusCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("get_compile_status"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
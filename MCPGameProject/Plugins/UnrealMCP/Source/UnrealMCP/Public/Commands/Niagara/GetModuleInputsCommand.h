@@ -20,6 +20,6 @@ private:
     INiagaraService& NiagaraService;
 
     bool ParseParameters(const FString& JsonString, FString& OutSystemPath, FString& OutEmitterName,
-                        FString& OutModuleName, FString& OutStage, FString& OutError) const;
+                        FString& OutModuleName, FString& OutStage, ENiagaraCurveDataFormat& OutCurveFormat, FString& OutError) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for getting a whole Niagara System in one response: modules and inputs per stage,
+ * renderers and data interfaces of every emitter, with optional field projection
+ */
+class UNREALMCP_API FGetNiagaraSystemSnapshotCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetNiagaraSystemSnapshotCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("get_niagara_system_snapshot"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
+    virtual bool IsResultCacheable() const override { return true; }
+
+private:
+    INiagaraService& NiagaraService;
+
+    struct FSnapshotParams
+    {
+        FString SystemPath;
+        TArray<FString> Fields;
+        FString EmitterName;
+        ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes;
+    };
+
+    bool ParseParameters(const FString& JsonString, FSnapshotParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
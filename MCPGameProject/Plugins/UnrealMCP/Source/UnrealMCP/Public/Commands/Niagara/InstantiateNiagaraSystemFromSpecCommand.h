@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for building a whole Niagara System from a declarative spec in one call
+ * The system is created, then its user parameters, emitters, renderers, modules, module inputs
+ * and data interfaces are added by the matching single-step commands inside one batch edit scope,
+ * so the build is one undo step and the system is compiled once at the end instead of once per
+ * emitter, renderer and property. Steps run in spec order and stop at the first failure.
+ */
+class UNREALMCP_API FInstantiateNiagaraSystemFromSpecCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FInstantiateNiagaraSystemFromSpecCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("instantiate_niagara_system_from_spec"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    /** Single-step commands the spec is applied with */
+    TSharedRef<IUnrealMCPCommand> CreateSystemCommand;
+    TSharedRef<IUnrealMCPCommand> AddParameterCommand;
+    TSharedRef<IUnrealMCPCommand> AddEmitterCommand;
+    TSharedRef<IUnrealMCPCommand> SetEmitterEnabledCommand;
+    TSharedRef<IUnrealMCPCommand> AddRendererCommand;
+    TSharedRef<IUnrealMCPCommand> SetRendererPropertyCommand;
+    TSharedRef<IUnrealMCPCommand> AddModuleCommand;
+    TSharedRef<IUnrealMCPCommand> SetModuleInputsCommand;
+    TSharedRef<IUnrealMCPCommand> AddDataInterfaceCommand;
+    TSharedRef<IUnrealMCPCommand> SetDataInterfacePropertyCommand;
+
+    /**
+     * Run one step and record it in the step list
+     * @param Command - Command the step is run with
+     * @param StepParams - Parameters of the command
+     * @param Label - What the step does, for the step list (e.g. "emitter 'Sparks'")
+     * @param OutSteps - Step list the step is appended to
+     * @param OutResult - Response of the command, without its success field
+     * @param OutError - Error of the step if it failed
+     * @return true if the step succeeded
+     */
+    bool RunStep(IUnrealMCPCommand& Command, const TSharedPtr<FJsonObject>& StepParams, const FString& Label,
+                 TArray<TSharedPtr<FJsonValue>>& OutSteps, TSharedPtr<FJsonObject>& OutResult, FString& OutError) const;
+
+    /**
+     * Add one emitter of the spec with its renderers, modules and data interfaces
+     * @param SystemPath - System the emitter is added to
+     * @param EmitterSpec - Emitter entry of the spec
+     * @param OutSteps - Step list the emitter's steps are appended to
+     * @param OutEmitterName - Name the emitter got in the system
+     * @param OutError - Error of the failed step
+     * @return true if every step of the emitter succeeded
+     */
+    bool AddEmitterFromSpec(const FString& SystemPath, const TSharedPtr<FJsonObject>& EmitterSpec,
+                            TArray<TSharedPtr<FJsonValue>>& OutSteps, FString& OutEmitterName, FString& OutError) const;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
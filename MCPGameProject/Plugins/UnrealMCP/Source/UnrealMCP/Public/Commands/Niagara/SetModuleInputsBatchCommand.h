@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for applying many module input overrides across modules and emitters in one call
+ * Each entry is handled by the matching single-input command (set_module_input,
+ * set_module_curve_input, ...) inside one batch edit scope, so the whole batch is one undo step
+ * and each touched system is compiled once at the end instead of once per input
+ */
+class UNREALMCP_API FSetModuleInputsBatchCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FSetModuleInputsBatchCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("set_module_inputs_batch"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    /** Single-input commands by entry "type" */
+    TMap<FString, TSharedRef<IUnrealMCPCommand>> InputCommands;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
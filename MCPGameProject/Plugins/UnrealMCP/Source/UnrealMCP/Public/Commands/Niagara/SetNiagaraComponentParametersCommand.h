@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for setting many user parameters on the Niagara components of many placed actors
+ * Actors are found by name, tag or class through the actor index; every parameter of every
+ * targeted component is set in one call and one undo step, with one refresh per component
+ */
+class UNREALMCP_API FSetNiagaraComponentParametersCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FSetNiagaraComponentParametersCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("set_niagara_component_parameters"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    bool ParseParameters(const FString& JsonString, FNiagaraComponentParametersParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
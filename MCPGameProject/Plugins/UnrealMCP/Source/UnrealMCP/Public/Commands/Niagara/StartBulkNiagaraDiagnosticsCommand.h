@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/INiagaraService.h"
+
+/**
+ * Command for collecting compile diagnostics of many Niagara Systems at once
+ * Loads the systems asynchronously, several at a time, and returns a job to read the results from
+ * with get_bulk_niagara_diagnostics as they complete
+ */
+class UNREALMCP_API FStartBulkNiagaraDiagnosticsCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStartBulkNiagaraDiagnosticsCommand(INiagaraService& InNiagaraService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("start_bulk_niagara_diagnostics"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    INiagaraService& NiagaraService;
+
+    struct FBulkDiagnosticsParams
+    {
+        TArray<FString> SystemPaths;
+        FString PackagePath;
+        bool bCompile = false;
+        int32 MaxInFlight = 8;
+    };
+
+    bool ParseParameters(const FString& JsonString, FBulkDiagnosticsParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Command for moving, renaming, duplicating or deleting many assets in one call
+ * Moves and renames go through one IAssetTools::RenameAssets call for the whole list, followed by
+ * one redirector fixup pass; deletes go through one ObjectTools::ForceDeleteObjects call.
+ *
+ * Parameters:
+ *   operation: "move", "rename", "duplicate" or "delete"
+ *   assets: Array of asset paths, or of {"asset_path", "destination_folder", "new_name"} objects
+ *   destination_folder: Optional folder for the assets that name none (move, duplicate)
+ *   fixup_redirectors: Optional, default true; whether moves and renames fix up referencers
+ *                      and delete the redirectors left behind
+ *
+ * Returns:
+ *   {
+ *     "operation": "move",
+ *     "results": [
+ *       {"asset_path": "/Game/Old/BP_Door", "new_asset_path": "/Game/New/BP_Door", "success": true},
+ *       {"asset_path": "/Game/Old/BP_Gone", "success": false, "error": "..."}
+ *     ],
+ *     "total": 2,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "redirectors_fixed": 1,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FBatchAssetOperationCommand : public IUnrealMCPCommand
+{
+public:
+    FBatchAssetOperationCommand(TSharedPtr<IProjectService> InProjectService);
+    virtual ~FBatchAssetOperationCommand() = default;
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("batch_asset_operation"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+
+    struct FParams
+    {
+        FString Operation;
+        TArray<FAssetBatchEntry> Assets;
+        bool bFixupRedirectors = true;
+    };
+
+    /**
+     * Parse JSON parameters
+     * @param Parameters - JSON string containing parameters
+     * @param OutParams - Parsed parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const;
+
+    /**
+     * Create error response JSON
+     * @param ErrorMessage - Error message
+     * @return JSON response string
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Command for creating many DataAssets of one class, with their property values, in one call
+ * Meant for item databases and similar sets of thousands of assets: every row is created and
+ * populated in one pass and the packages are saved together at the end, optionally serialized
+ * in parallel.
+ *
+ * Parameters:
+ *   asset_class: DataAsset subclass of every row (e.g. "PrimaryDataAsset", "UItemDefinition")
+ *   rows: Array of {"name", "folder_path", "properties"}; properties maps property paths
+ *         ("Damage", "Stats.MaxHealth") to values
+ *   folder_path: Optional folder of the rows that name none (default /Game/Data)
+ *   save: Optional, default true; whether the created packages are saved
+ *   parallel_save: Optional, default false; whether the packages are serialized on worker
+ *                  threads instead of one after another on the game thread
+ *
+ * Returns:
+ *   {
+ *     "asset_class": "ItemDefinition",
+ *     "rows": [
+ *       {"name": "DA_Sword", "asset_path": "/Game/Data/Items/DA_Sword", "created": true},
+ *       {"name": "DA_Bow", "asset_path": "/Game/Data/Items/DA_Bow", "created": true,
+ *        "property_errors": ["Rangee: ..."]}
+ *     ],
+ *     "created": 2,
+ *     "failed": 0,
+ *     "property_errors": 1,
+ *     "unsaved_packages": [],
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FBatchCreateDataAssetsCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBatchCreateDataAssetsCommand(TSharedPtr<IProjectService> InProjectService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("batch_create_data_assets"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+
+    bool ParseParameters(const FString& Parameters, FBulkDataAssetParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
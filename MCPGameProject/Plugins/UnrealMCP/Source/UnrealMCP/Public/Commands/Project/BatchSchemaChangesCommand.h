@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Command for applying many member changes to a user-defined struct or enum in one call
+ * All changes are made to the asset before it is recompiled, so the Blueprints, DataTables and
+ * structs that depend on it are regenerated once for the whole list instead of once per change.
+ *
+ * Parameters:
+ *   asset_path: Path of the struct or enum asset
+ *   changes: Array of changes, applied in order:
+ *     {"operation": "add", "name": "Health", "type": "Float", "description": "..."}
+ *     {"operation": "remove", "name": "Armor"}
+ *     {"operation": "rename", "name": "Speed", "new_name": "MoveSpeed"}
+ *     {"operation": "set_type", "name": "Ammo", "type": "Integer"}      (structs only)
+ *     {"operation": "set_description", "name": "Health", "description": "..."}
+ *   Enum changes name enumerators by display name; "type" is ignored.
+ *
+ * Returns:
+ *   {
+ *     "asset_path": "/Game/Data/S_Weapon",
+ *     "asset_kind": "struct",
+ *     "results": [
+ *       {"operation": "add", "name": "Health", "success": true},
+ *       {"operation": "remove", "name": "Gone", "success": false, "error": "..."}
+ *     ],
+ *     "total": 2,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FBatchSchemaChangesCommand : public IUnrealMCPCommand
+{
+public:
+    FBatchSchemaChangesCommand(TSharedPtr<IProjectService> InProjectService);
+    virtual ~FBatchSchemaChangesCommand() = default;
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("batch_schema_changes"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+
+    struct FParams
+    {
+        FString AssetPath;
+        TArray<FSchemaChange> Changes;
+    };
+
+    /**
+     * Parse JSON parameters
+     * @param Parameters - JSON string containing parameters
+     * @param OutParams - Parsed parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const;
+
+    /**
+     * Create error response JSON
+     * @param ErrorMessage - Error message
+     * @return JSON response string
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -3,9 +3,15 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 
+class FViewport;
+
 /**
  * Command for capturing a screenshot of the active editor viewport.
  * Saves the image to a specified path and returns the file location.
+ *
+ * Runs on a worker: the viewport is read back asynchronously (FMCPViewportCapture) and the PNG
+ * is encoded off the game thread, so the editor keeps rendering while the command waits. When
+ * executed on the game thread (e.g. inside execute_batch) it captures synchronously instead.
  */
 class UNREALMCP_API FCaptureViewportScreenshotCommand : public IUnrealMCPCommand
 {
@@ -17,4 +23,19 @@ public:
 	virtual FString Execute(const FString& Parameters) override;
 	virtual FString GetCommandName() const override { return TEXT("capture_viewport_screenshot"); }
 	virtual bool ValidateParams(const FString& Parameters) const override;
+	virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::WaitsOnGameThread; }
+
+private:
+	/** Seconds a worker waits for the capture before giving up */
+	static constexpr double CaptureTimeoutSeconds = 30.0;
+
+	/**
+	 * Find the first active level editor viewport; game thread only
+	 * @param OutError Error message if there is none
+	 * @return The viewport, or nullptr
+	 */
+	static FViewport* FindActiveViewport(FString& OutError);
+
+	/** Serialize an error response */
+	static FString CreateErrorResponse(const FString& ErrorMessage);
 };
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Command for creating a whole Enhanced Input setup in one call
+ * Creates the input actions, the mapping contexts and their key mappings with modifiers and
+ * triggers, and saves the created packages once at the end.
+ *
+ * Parameters:
+ *   actions: Array of {"name", "path", "value_type", "description", "modifiers", "triggers"}
+ *   contexts: Array of {"name", "path", "description", "mappings"}, each mapping
+ *             {"action", "key", "modifiers", "triggers"}; "action" names an action of this
+ *             setup or is an existing action's asset path
+ *   action_path: Optional folder of the actions that name none (default /Game/Input/Actions)
+ *   context_path: Optional folder of the contexts that name none (default /Game/Input)
+ *   save: Optional, default true; whether the created packages are saved
+ *   Modifiers and triggers are class names ("Negate", "SwizzleAxis", "Hold", "Pressed") or
+ *   {"type": "DeadZone", "properties": {"LowerThreshold": 0.25}} objects.
+ *
+ * Returns:
+ *   {
+ *     "actions": [{"name": "IA_Jump", "asset_path": "/Game/Input/Actions/IA_Jump", "created": true}],
+ *     "contexts": [{"name": "IMC_Default", "asset_path": "/Game/Input/IMC_Default", "created": true,
+ *                   "mappings_added": 4, "mapping_errors": ["mappings[2]: invalid key 'Spce'"]}],
+ *     "created": 2,
+ *     "failed": 0,
+ *     "mappings_added": 4,
+ *     "unsaved_packages": [],
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FCreateInputSetupCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FCreateInputSetupCommand(TSharedPtr<IProjectService> InProjectService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("create_input_setup"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+
+    bool ParseParameters(const FString& Parameters, FInputSetupParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
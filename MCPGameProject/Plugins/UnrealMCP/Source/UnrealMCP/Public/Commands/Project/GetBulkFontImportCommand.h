@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IProjectService;
+
+/**
+ * Command to read the progress and the per-font results of a bulk font import, one page of
+ * results at a time
+ */
+class UNREALMCP_API FGetBulkFontImportCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetBulkFontImportCommand(TSharedPtr<IProjectService> InProjectService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -17,6 +17,8 @@ public:
     virtual FString Execute(const FString& Parameters) override;
     virtual FString GetCommandName() const override { return TEXT("get_project_dir"); }
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::AnyThread; }
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     TSharedPtr<IProjectService> ProjectService;
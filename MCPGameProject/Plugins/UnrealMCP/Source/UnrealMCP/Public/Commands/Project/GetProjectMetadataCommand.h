@@ -25,6 +25,7 @@ public:
     virtual FString GetCommandName() const override;
     virtual FString Execute(const FString& Parameters) override;
     virtual bool ValidateParams(const FString& Parameters) const override;
+    virtual bool IsReadOnly() const override { return true; }
 
 private:
     TSharedPtr<IProjectService> ProjectService;
@@ -5,7 +5,9 @@
 
 /**
  * Command for searching assets by name and/or type.
- * Uses UE's Asset Registry for efficient querying.
+ * Searches under /Game go through FAssetSearchIndex once it is built; other folders, and
+ * searches before that, query UE's Asset Registry. Results are paged with offset/max_results;
+ * total_matches and has_more describe the pages left.
  */
 class UNREALMCP_API FSearchAssetsCommand : public IUnrealMCPCommand
 {
@@ -17,4 +19,6 @@ public:
 	virtual FString Execute(const FString& Parameters) override;
 	virtual FString GetCommandName() const override { return TEXT("search_assets"); }
 	virtual bool ValidateParams(const FString& Parameters) const override;
+	virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::AssetRegistryOnly; }
+	virtual bool IsReadOnly() const override { return true; }
 };
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+/**
+ * Command for setting one property to one value on many assets and blueprint component templates
+ * The property is resolved once per class and the value converted once (see
+ * FPropertyService::SetPropertyOnObjects). All changes are one undo step, each blueprint is marked
+ * modified once, and modified assets are saved together.
+ *
+ * Parameters:
+ *   property_name: Property name, or dot-separated path through struct members ("Padding.Left")
+ *   property_value: Value to set, in the forms set_data_asset_property accepts
+ *   asset_paths: Optional array of asset paths, e.g. DataAssets ("/Game/Data/DA_Goblin")
+ *   components: Optional array of {"blueprint_name": "BP_Enemy", "component_name": "Mesh"}
+ *   save: Optional, default true; whether modified assets are saved
+ *
+ * Returns:
+ *   {
+ *     "targets": [
+ *       {"kind": "asset", "name": "/Game/Data/DA_Goblin", "success": true},
+ *       {"kind": "component", "name": "BP_Enemy.Mesh", "success": false, "error": "..."}
+ *     ],
+ *     "total": 2,
+ *     "succeeded": 1,
+ *     "failed": 1,
+ *     "success": true
+ *   }
+ */
+class UNREALMCP_API FSetPropertyOnObjectsCommand : public IUnrealMCPCommand
+{
+public:
+    FSetPropertyOnObjectsCommand() = default;
+    virtual ~FSetPropertyOnObjectsCommand() = default;
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override { return TEXT("set_property_on_objects"); }
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    struct FComponentTarget
+    {
+        FString BlueprintName;
+        FString ComponentName;
+    };
+
+    struct FParams
+    {
+        FString PropertyName;
+        TSharedPtr<FJsonValue> PropertyValue;
+        TArray<FString> AssetPaths;
+        TArray<FComponentTarget> Components;
+        bool bSave = true;
+    };
+
+    /**
+     * Parse JSON parameters
+     * @param Parameters - JSON string containing parameters
+     * @param OutParams - Parsed parameters
+     * @param OutError - Error message if parsing fails
+     * @return true if parsing succeeded
+     */
+    bool ParseParameters(const FString& Parameters, FParams& OutParams, FString& OutError) const;
+
+    /**
+     * Create error response JSON
+     * @param ErrorMessage - Error message
+     * @return JSON response string
+     */
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
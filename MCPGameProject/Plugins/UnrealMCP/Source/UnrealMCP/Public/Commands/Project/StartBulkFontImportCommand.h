@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Command to start creating many fonts, TTF/OTF imports and offline bitmap fonts, in one run
+ * Font files and metrics files are read on worker threads and the assets created across editor
+ * ticks; read the progress and per-font results with get_bulk_font_import.
+ */
+class UNREALMCP_API FStartBulkFontImportCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStartBulkFontImportCommand(TSharedPtr<IProjectService> InProjectService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    TSharedPtr<IProjectService> ProjectService;
+
+    bool ParseParameters(const FString& JsonString, FBulkFontImportParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
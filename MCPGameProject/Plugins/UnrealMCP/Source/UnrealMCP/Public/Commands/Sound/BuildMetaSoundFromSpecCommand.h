@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/ISoundService.h"
+
+/**
+ * Command for building a MetaSound graph (graph inputs and outputs, nodes, input defaults and
+ * connections) from one declarative spec
+ * Built by ISoundService::BuildMetaSoundFromSpec with one document builder, one editor graph
+ * synchronization, one compile and one save, instead of one of each per single-step command.
+ */
+class UNREALMCP_API FBuildMetaSoundFromSpecCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBuildMetaSoundFromSpecCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    ISoundService& SoundService;
+
+    bool ParseParameters(const FString& JsonString, FBuildMetaSoundFromSpecParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/ISoundService.h"
+
+/**
+ * Command for building a Sound Cue graph (nodes, node properties and connections) from one
+ * declarative spec
+ * Built by ISoundService::BuildSoundCueFromSpec with one editor graph link, one compile and one
+ * save, instead of one of each per add/connect/set command.
+ */
+class UNREALMCP_API FBuildSoundCueFromSpecCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBuildSoundCueFromSpecCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    ISoundService& SoundService;
+
+    bool ParseParameters(const FString& JsonString, FBuildSoundCueFromSpecParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class ISoundService;
+
+/**
+ * Command to read the progress and the per-file results of a bulk sound import, one page of
+ * results at a time
+ */
+class UNREALMCP_API FGetBulkSoundImportCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetBulkSoundImportCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    ISoundService& SoundService;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
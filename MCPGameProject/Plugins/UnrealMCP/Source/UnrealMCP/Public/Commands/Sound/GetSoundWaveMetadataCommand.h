@@ -7,8 +7,9 @@
 class ISoundService;
 
 /**
- * Command to get metadata about a sound wave asset
- * Returns duration, sample rate, channels, and other audio properties
+ * Command to get metadata about a sound wave asset, or about many in one call
+ * Returns duration, sample rate, channels, levels, and other audio properties, from the kept
+ * summary of each wave where there is one (see FSoundWaveSummaryCache)
  */
 class UNREALMCP_API FGetSoundWaveMetadataCommand : public IUnrealMCPCommand
 {
@@ -29,14 +30,25 @@ private:
     /** Reference to sound service for operations */
     ISoundService& SoundService;
 
+    /** Parsed command parameters */
+    struct FParams
+    {
+        /** sound_wave_path, or every entry of sound_wave_paths */
+        TArray<FString> SoundWavePaths;
+        /** Whether sound_wave_paths was given, which answers with a list */
+        bool bBatch = false;
+        bool bAllowLoad = true;
+        bool bIncludeEnvelope = false;
+    };
+
     /**
      * Parse command parameters from JSON
      * @param JsonString - JSON parameters string
-     * @param OutSoundWavePath - Extracted sound wave path
+     * @param OutParams - Extracted parameters
      * @param OutError - Error message if parsing fails
      * @return true if parsing succeeded
      */
-    bool ParseParameters(const FString& JsonString, FString& OutSoundWavePath, FString& OutError) const;
+    bool ParseParameters(const FString& JsonString, FParams& OutParams, FString& OutError) const;
 
     /**
      * Create a success response with metadata
@@ -45,6 +57,14 @@ private:
      */
     FString CreateSuccessResponse(const TSharedPtr<FJsonObject>& Metadata) const;
 
+    /**
+     * Create a response listing the metadata or error of each requested wave
+     * @param Entries - One object per requested path, in request order
+     * @param FoundCount - Number of waves whose metadata was read
+     * @return JSON response string
+     */
+    FString CreateBatchResponse(const TArray<TSharedPtr<FJsonValue>>& Entries, int32 FoundCount) const;
+
     /**
      * Create an error response
      * @param ErrorMessage - Error message to include
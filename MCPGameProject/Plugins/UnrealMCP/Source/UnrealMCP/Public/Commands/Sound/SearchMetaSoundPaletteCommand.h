@@ -2,11 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
-
-class ISoundService;
+#include "Services/ISoundService.h"
 
 /**
  * Command to search the MetaSound node palette for available node classes
+ * Ranked and paged; can require node classes with inputs and outputs of given data types.
  */
 class UNREALMCP_API FSearchMetaSoundPaletteCommand : public IUnrealMCPCommand
 {
@@ -20,7 +20,7 @@ public:
 private:
     ISoundService& SoundService;
 
-    bool ParseParameters(const FString& JsonString, FString& OutSearchQuery, int32& OutMaxResults, FString& OutError) const;
-    FString CreateSuccessResponse(const TArray<TSharedPtr<FJsonObject>>& Results) const;
+    bool ParseParameters(const FString& JsonString, FMetaSoundPaletteQuery& OutQuery, FString& OutError) const;
+    FString CreateSuccessResponse(const FMetaSoundPaletteQuery& Query, const TArray<TSharedPtr<FJsonObject>>& Results, int32 TotalCount) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
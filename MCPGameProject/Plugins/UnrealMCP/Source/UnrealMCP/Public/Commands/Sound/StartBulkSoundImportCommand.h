@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/ISoundService.h"
+
+/**
+ * Command to start importing many audio files as sound waves
+ * Files are validated on worker threads and imported in batches across editor ticks; read the
+ * progress and per-file results with get_bulk_sound_import.
+ */
+class UNREALMCP_API FStartBulkSoundImportCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStartBulkSoundImportCommand(ISoundService& InSoundService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    ISoundService& SoundService;
+
+    bool ParseParameters(const FString& JsonString, FBulkSoundImportParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -25,10 +25,11 @@ public:
 private:
     /**
      * Helper to register and track a command
-     * @param Command - Command to register
+     * @param CommandName - Name the command reports
+     * @param Factory - Constructs the command on first use
      */
-    static void RegisterAndTrackCommand(TSharedPtr<IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 
-    /** Array of registered commands for cleanup */
-    static TArray<TSharedPtr<IUnrealMCPCommand>> RegisteredCommands;
+    /** Names of the registered commands, for cleanup */
+    static TArray<FString> RegisteredCommandNames;
 };
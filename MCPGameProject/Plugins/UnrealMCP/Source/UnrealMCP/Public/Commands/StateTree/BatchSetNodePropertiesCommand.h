@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IStateTreeService.h"
+
+/**
+ * Command for setting properties on many tasks, global tasks and evaluators of a StateTree in one
+ * call, with one save and property paths reflected once per node type
+ */
+class UNREALMCP_API FBatchSetNodePropertiesCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBatchSetNodePropertiesCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+
+    bool ParseParameters(const FString& JsonString, FBatchSetNodePropertiesParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
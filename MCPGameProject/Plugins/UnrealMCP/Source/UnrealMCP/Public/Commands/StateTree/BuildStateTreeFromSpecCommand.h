@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Services/IStateTreeService.h"
+
+/**
+ * Command for building a whole StateTree (states, tasks, conditions, transitions, evaluators,
+ * global tasks and bindings) from one declarative spec
+ * States nest through "children"; the spec is flattened parents first and built by
+ * IStateTreeService::BuildStateTreeFromSpec with one save and one compile.
+ */
+class UNREALMCP_API FBuildStateTreeFromSpecCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FBuildStateTreeFromSpecCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+
+    bool ParseParameters(const FString& JsonString, FBuildStateTreeFromSpecParams& OutParams, FString& OutError) const;
+
+    /**
+     * Parse a spec state and its children, appending them parents first
+     * @param StateObj - State entry of the spec
+     * @param ParentStateName - Name of the enclosing spec state, empty for a root state
+     * @param OutStates - States the state and its children are appended to
+     */
+    void ParseState(const TSharedPtr<FJsonObject>& StateObj, const FString& ParentStateName, TArray<FStateTreeSpecState>& OutStates) const;
+
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -6,6 +6,8 @@
 
 /**
  * Command for compiling a StateTree for runtime use
+ * "validate_only" checks the tree without changing its compiled data or saving it; a compile of
+ * a tree whose editor data is unchanged since its last successful compile is skipped unless "force" is set.
  */
 class UNREALMCP_API FCompileStateTreeCommand : public IUnrealMCPCommand
 {
@@ -19,6 +21,6 @@ public:
 private:
     IStateTreeService& Service;
 
-    FString CreateSuccessResponse(const FString& StateTreeName) const;
+    FString CreateSuccessResponse(const FString& StateTreeName, bool bValidateOnly, bool bUpToDate, const TArray<FString>& Messages) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
@@ -6,6 +6,8 @@
 
 /**
  * Command for listing available StateTree condition types
+ * Served from the cached type catalog; optionally filtered by text and by the schema of a class
+ * or StateTree, and paged with offset/limit.
  */
 class UNREALMCP_API FGetAvailableConditionsCommand : public IUnrealMCPCommand
 {
@@ -19,5 +21,6 @@ public:
 private:
     IStateTreeService& Service;
 
+    bool ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
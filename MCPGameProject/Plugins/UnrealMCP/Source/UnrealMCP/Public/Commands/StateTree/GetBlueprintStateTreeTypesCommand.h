@@ -4,9 +4,12 @@
 #include "Commands/IUnrealMCPCommand.h"
 
 class IStateTreeService;
+struct FStateTreeNodeTypeQuery;
 
 /**
  * Command to get Blueprint-based StateTree types (tasks, conditions, evaluators)
+ * Served from the cached type catalog, which classifies the Blueprints without loading them;
+ * filter, offset and limit apply to each category separately.
  */
 class UNREALMCP_API FGetBlueprintStateTreeTypesCommand : public IUnrealMCPCommand
 {
@@ -19,5 +22,6 @@ public:
 
 private:
     IStateTreeService& Service;
+    bool ParseParameters(const FString& JsonString, FStateTreeNodeTypeQuery& OutQuery, FString& OutError) const;
     FString CreateErrorResponse(const FString& ErrorMessage) const;
 };
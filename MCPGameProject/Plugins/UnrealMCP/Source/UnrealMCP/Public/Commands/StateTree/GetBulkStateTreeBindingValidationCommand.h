@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IStateTreeService;
+
+/**
+ * Command to read the progress and the per-tree results of a bulk binding validation, one page
+ * of results at a time
+ */
+class UNREALMCP_API FGetBulkStateTreeBindingValidationCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FGetBulkStateTreeBindingValidationCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IStateTreeService;
+
+/**
+ * Command to start validating the property bindings of many StateTrees; the trees load
+ * asynchronously, their bindings are checked on worker threads, and the results are read back
+ * with get_bulk_state_tree_binding_validation
+ */
+class UNREALMCP_API FStartBulkStateTreeBindingValidationCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStartBulkStateTreeBindingValidationCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+
+    struct FBulkBindingValidationParams
+    {
+        TArray<FString> StateTreePaths;
+        FString PackagePath;
+        int32 MaxInFlight = 8;
+    };
+
+    bool ParseParameters(const FString& JsonString, FBulkBindingValidationParams& OutParams, FString& OutError) const;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
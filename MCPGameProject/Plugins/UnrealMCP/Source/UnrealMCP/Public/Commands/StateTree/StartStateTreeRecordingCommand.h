@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IStateTreeService;
+
+/**
+ * Command to start recording the state enter, exit and transition events of StateTrees in PIE,
+ * which get_state_execution_history then returns in exact order
+ */
+class UNREALMCP_API FStartStateTreeRecordingCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStartStateTreeRecordingCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
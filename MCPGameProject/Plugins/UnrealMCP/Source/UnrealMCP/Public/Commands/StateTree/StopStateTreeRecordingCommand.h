@@ -0,0 +1,23 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+
+class IStateTreeService;
+
+/**
+ * Command to stop recording StateTree execution events; the recorded events stay queryable
+ */
+class UNREALMCP_API FStopStateTreeRecordingCommand : public IUnrealMCPCommand
+{
+public:
+    explicit FStopStateTreeRecordingCommand(IStateTreeService& InService);
+
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    IStateTreeService& Service;
+    FString CreateErrorResponse(const FString& ErrorMessage) const;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all StateTree-related commands
@@ -112,14 +113,20 @@ private:
     // Section 15 - Batch Operations Commands
     static void RegisterBatchAddStatesCommand();
     static void RegisterBatchAddTransitionsCommand();
+    static void RegisterBuildStateTreeFromSpecCommand();
+    static void RegisterBatchSetNodePropertiesCommand();
 
     // Section 16 - Validation and Debugging Commands
     static void RegisterValidateAllBindingsCommand();
+    static void RegisterStartBulkStateTreeBindingValidationCommand();
+    static void RegisterGetBulkStateTreeBindingValidationCommand();
     static void RegisterGetStateExecutionHistoryCommand();
+    static void RegisterStartStateTreeRecordingCommand();
+    static void RegisterStopStateTreeRecordingCommand();
 
     /**
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Dom/JsonObject.h"
+
+// Forward declarations
+class IUMGService;
+struct FMCPError;
+
+/**
+ * Command for updating the slot, placement and properties of many widgets in one request
+ * The updates are one undo transaction, and the blueprint is marked modified, compiled and saved
+ * once instead of once per widget
+ *
+ * Parameters:
+ *   widget_name: Name of the target Widget Blueprint (required)
+ *   updates: Widget updates (required), each containing:
+ *     - component_name: Widget to update (required)
+ *     - properties: Widget properties, as for set_widget_component_property, "Slot."-prefixed keys included (optional)
+ *     - slot: Properties of the widget's slot, e.g. Padding, HorizontalAlignment (optional)
+ *     - position, size, alignment: Canvas slot placement as [x, y] (optional)
+ */
+class UNREALMCP_API FBatchUpdateWidgetsCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InUMGService - Shared pointer to the UMG service for operations
+     */
+    explicit FBatchUpdateWidgetsCommand(TSharedPtr<IUMGService> InUMGService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    /** Shared pointer to the UMG service */
+    TSharedPtr<IUMGService> UMGService;
+
+    /**
+     * Internal execution with JSON objects
+     * @param Params - JSON parameters
+     * @return JSON response object
+     */
+    TSharedPtr<FJsonObject> ExecuteInternal(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Internal validation with JSON objects
+     * @param Params - JSON parameters
+     * @param OutError - Error message if validation fails
+     * @return true if validation passes
+     */
+    bool ValidateParamsInternal(const TSharedPtr<FJsonObject>& Params, FString& OutError) const;
+
+    /**
+     * Create error response JSON object from MCP error
+     */
+    TSharedPtr<FJsonObject> CreateErrorResponse(const FMCPError& Error) const;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
+#include "Dom/JsonObject.h"
+
+// Forward declarations
+class IUMGService;
+struct FMCPError;
+
+/**
+ * Command for building a whole widget hierarchy from a nested spec in one request
+ * The tree is one undo transaction, and the blueprint is marked structurally modified, compiled
+ * and saved once instead of once per widget
+ *
+ * Parameters:
+ *   widget_name: Name of the target Widget Blueprint (required)
+ *   parent_name: Existing widget to add the tree to (optional, default the root widget)
+ *   root: Widget spec (required), each containing:
+ *     - name, type: Widget name and component type, as for add_widget_component_to_widget (required)
+ *     - kwargs: Creation parameters passed to the widget factory (optional)
+ *     - properties: Widget properties, as for set_widget_component_property (optional)
+ *     - slot: Properties of the slot the widget ends up in, e.g. Padding, HorizontalAlignment (optional)
+ *     - position, size, alignment: Canvas slot placement as [x, y] (optional)
+ *     - is_variable: Expose the widget as a blueprint variable (optional, default true)
+ *     - children: Child widget specs (optional)
+ */
+class UNREALMCP_API FBuildWidgetTreeCommand : public IUnrealMCPCommand
+{
+public:
+    /**
+     * Constructor
+     * @param InUMGService - Shared pointer to the UMG service for operations
+     */
+    explicit FBuildWidgetTreeCommand(TSharedPtr<IUMGService> InUMGService);
+
+    // IUnrealMCPCommand interface
+    virtual FString Execute(const FString& Parameters) override;
+    virtual FString GetCommandName() const override;
+    virtual bool ValidateParams(const FString& Parameters) const override;
+
+private:
+    /** Shared pointer to the UMG service */
+    TSharedPtr<IUMGService> UMGService;
+
+    /**
+     * Internal execution with JSON objects
+     * @param Params - JSON parameters
+     * @return JSON response object
+     */
+    TSharedPtr<FJsonObject> ExecuteInternal(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Internal validation with JSON objects
+     * @param Params - JSON parameters
+     * @param OutError - Error message if validation fails
+     * @return true if validation passes
+     */
+    bool ValidateParamsInternal(const TSharedPtr<FJsonObject>& Params, FString& OutError) const;
+
+    /**
+     * Create error response JSON object from MCP error
+     */
+    TSharedPtr<FJsonObject> CreateErrorResponse(const FMCPError& Error) const;
+};
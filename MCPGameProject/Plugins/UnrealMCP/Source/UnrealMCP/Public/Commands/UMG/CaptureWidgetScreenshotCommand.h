@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Commands/IUnrealMCPCommand.h"
 #include "Dom/JsonObject.h"
+#include "MCPImageEncoding.h"
 
 // Forward declarations
 class IUMGService;
@@ -16,13 +17,17 @@ struct FWidgetScreenshotParams
 	FString WidgetName;
 	int32 Width;
 	int32 Height;
-	FString Format;  // "png" or "jpg"
+	FMCPImageEncodeOptions ImageOptions;  // format, quality, scale and region
 };
 
 /**
  * Command for capturing a screenshot of a UMG Widget Blueprint preview
  * Renders the widget to a texture and returns as base64-encoded image data
  * This allows AI to visually inspect the widget layout
+ *
+ * Runs on a worker: the widget is rendered on the game thread, then read back and encoded
+ * asynchronously while the command waits. On the game thread (e.g. inside execute_batch)
+ * it captures synchronously instead.
  */
 class UNREALMCP_API FCaptureWidgetScreenshotCommand : public IUnrealMCPCommand
 {
@@ -37,8 +42,12 @@ public:
 	virtual FString Execute(const FString& Parameters) override;
 	virtual FString GetCommandName() const override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+	virtual EMCPThreadAffinity GetThreadAffinity() const override { return EMCPThreadAffinity::WaitsOnGameThread; }
 
 private:
+	/** Seconds a worker waits for the capture before giving up */
+	static constexpr double CaptureTimeoutSeconds = 30.0;
+
 	/** Shared pointer to the UMG service */
 	TSharedPtr<IUMGService> UMGService;
 
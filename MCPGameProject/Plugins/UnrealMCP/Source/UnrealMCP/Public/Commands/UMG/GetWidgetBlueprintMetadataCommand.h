@@ -25,7 +25,19 @@ class IUMGService;
  * - "functions" - Blueprint functions
  * - "orphaned_nodes" - Nodes with no connections in blueprint graphs
  * - "graph_warnings" - Cast nodes with disconnected exec pins and other issues
- * - "*" - Return all available fields
+ * - "measured_layout" - Desired size, position and size of every widget of a preview instance
+ *   laid out at width x height (default 800x600), without rendering it; not part of "*"
+ * - "*" - Return all available fields except measured_layout
+ *
+ * A field "section.key" returns only that key of each entry of the section, e.g.
+ * "components.name" or "layout.slot"; tree entries keep their children. Unknown fields are
+ * reported in unknown_fields.
+ *
+ * root_widget starts the components, layout, measured_layout, hierarchy and bindings sections at
+ * that widget, and depth limits them to that many levels below it; panels cut off by the depth
+ * report their child_count and children_truncated instead of children.
+ *
+ * Responses are cached until the next editor change, like get_blueprint_metadata.
  *
  * Uses WidgetMetadataBuilderService for building the actual metadata JSON objects.
  */
@@ -39,6 +51,8 @@ public:
 	virtual FString GetCommandName() const override;
 	virtual FString Execute(const FString& Parameters) override;
 	virtual bool ValidateParams(const FString& Parameters) const override;
+	virtual bool IsReadOnly() const override { return true; }
+	virtual bool IsResultCacheable() const override { return true; }
 
 private:
 	/** UMG Service for widget operations */
@@ -56,6 +70,15 @@ private:
 	/** Check if a field is requested */
 	bool ShouldIncludeField(const TArray<FString>& RequestedFields, const FString& FieldName) const;
 
+	/**
+	 * Split requested fields into sections and the keys projected out of them
+	 * @param Fields - Lowercase fields as requested
+	 * @param OutSections - Receives the requested sections, or "*"
+	 * @param OutProjections - Receives the keys to keep per section; sections also requested whole are absent
+	 * @param OutUnknownFields - Receives the fields naming no section
+	 */
+	static void ResolveFields(const TArray<FString>& Fields, TArray<FString>& OutSections, TMap<FString, TArray<FString>>& OutProjections, TArray<FString>& OutUnknownFields);
+
 	/**
 	 * Find and load widget blueprint with retry mechanism.
 	 * Handles transient asset loading issues by retrying after a brief delay.
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Commands/IUnrealMCPCommand.h"
 
 /**
  * Static class responsible for registering all UMG-related commands
@@ -41,6 +42,8 @@ private:
     static void RegisterReorderWidgetChildrenCommand();
     static void RegisterSetWidgetDesignSizeCommand();
     static void RegisterSetWidgetParentClassCommand();
+    static void RegisterBuildWidgetTreeCommand();
+    static void RegisterBatchUpdateWidgetsCommand();
 
     // Widget-specific add commands
     static void RegisterAddWidgetSwitcherCommand();
@@ -68,5 +71,5 @@ private:
      * Helper to register a command and track it for cleanup
      * @param Command - Command to register
      */
-    static void RegisterAndTrackCommand(TSharedPtr<class IUnrealMCPCommand> Command);
+    static void RegisterAndTrackCommand(const FString& CommandName, FMCPCommandFactory Factory);
 };
\ No newline at end of file
@@ -6,6 +6,24 @@
 /**
  * Registry for all MCP commands
  * Provides centralized command registration, discovery, and execution
+ *
+ * The registry is the single dispatch table for the bridge: commands are keyed by FName, so a
+ * lookup is one hash probe on the name's precomputed index (case-insensitive, like the old
+ * string lists), and names that were never registered are rejected without touching the table.
+ * Legacy handler classes are registered into the same table through FMCPLegacyHandlerCommand.
+ *
+ * Most commands are registered with RegisterLazyCommand: the registry keeps only the name and a
+ * factory, and the command (with the service singletons it takes) is constructed the first time it
+ * is executed or its metadata is asked for on the game thread, so module startup does not construct
+ * every command. Off the game thread, a command that is not constructed yet is reported as needing
+ * the game thread, not read-only and not cacheable, which routes its first request to the game
+ * thread, where it is constructed.
+ *
+ * Registration only happens at module startup and shutdown, so lookups never lock: each change
+ * publishes an immutable snapshot of the table, together with the sorted name list and the help
+ * JSON, and readers load the current snapshot pointer atomically. Replaced snapshots are kept
+ * until the registry is destroyed, because a reader may still be using one; wrap bulk changes in
+ * BeginBatchUpdate/EndBatchUpdate so they publish a single snapshot.
  */
 class UNREALMCP_API FUnrealMCPCommandRegistry
 {
@@ -16,12 +34,24 @@ public:
      */
     static FUnrealMCPCommandRegistry& Get();
     
+    ~FUnrealMCPCommandRegistry();
+    
     /**
      * Register a command with the registry
      * @param Command - Shared pointer to the command to register
+     * @param bReplaceExisting - Whether to replace a command already registered under the same name
      * @return true if command was registered successfully
      */
-    bool RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command);
+    bool RegisterCommand(TSharedPtr<IUnrealMCPCommand> Command, bool bReplaceExisting = true);
+    
+    /**
+     * Register a command to be constructed on first use
+     * @param CommandName - Name the command reports from GetCommandName
+     * @param Factory - Constructs the command; called at most once, with no registry lock held
+     * @param bReplaceExisting - Whether to replace a command already registered under the same name
+     * @return true if command was registered successfully
+     */
+    bool RegisterLazyCommand(const FString& CommandName, FMCPCommandFactory Factory, bool bReplaceExisting = true);
     
     /**
      * Unregister a command from the registry
@@ -38,6 +68,15 @@ public:
      */
     FString ExecuteCommand(const FString& CommandName, const FString& Parameters);
     
+    /**
+     * Execute a command by name with already-parsed parameters
+     * @param CommandName - Name of the command to execute
+     * @param Params - Parsed parameters for the command
+     * @param Response - Receives the command result, or an error result
+     * @return false if no command is registered under CommandName
+     */
+    bool ExecuteCommand(const FString& CommandName, const TSharedRef<FJsonObject>& Params, FMCPResponseWriter& Response);
+    
     /**
      * Check if a command is registered
      * @param CommandName - Name of the command to check
@@ -45,6 +84,27 @@ public:
      */
     bool IsCommandRegistered(const FString& CommandName) const;
     
+    /**
+     * Get the thread affinity of a command
+     * @param CommandName - Name of the command
+     * @return The command's affinity, or GameThreadRequired if it is not registered
+     */
+    EMCPThreadAffinity GetCommandThreadAffinity(const FString& CommandName) const;
+    
+    /**
+     * Check if a command only reads editor state
+     * @param CommandName - Name of the command
+     * @return true if the command is registered and read-only
+     */
+    bool IsCommandReadOnly(const FString& CommandName) const;
+    
+    /**
+     * Check if a command's responses may be cached until editor state changes
+     * @param CommandName - Name of the command
+     * @return true if the command is registered, read-only and cacheable
+     */
+    bool IsCommandResultCacheable(const FString& CommandName) const;
+    
     /**
      * Get all registered command names
      * @return Array of registered command names
@@ -64,21 +124,108 @@ public:
      */
     FString GetAllCommandsHelp() const;
     
+    /**
+     * Get how many registered commands have been constructed
+     * @return Commands registered as instances plus lazy commands constructed so far
+     */
+    int32 GetConstructedCommandCount() const;
+    
     /**
      * Clear all registered commands
      */
     void ClearRegistry();
+    
+    /**
+     * Defer publishing registry changes until the matching EndBatchUpdate; calls may nest
+     */
+    void BeginBatchUpdate();
+    
+    /**
+     * Publish the changes made since the outermost BeginBatchUpdate
+     */
+    void EndBatchUpdate();
 
 private:
+    /** A registered command, shared by every snapshot it is in */
+    struct FCommandEntry
+    {
+        /** Name the command was registered under, spelled as the command reports it */
+        FString CommandName;
+        
+        /** Constructs the command; kept after it has run, as its captures may own what the command references */
+        FMCPCommandFactory Factory;
+        
+        /** The command; only read once bConstructed is set */
+        TSharedPtr<IUnrealMCPCommand> Command;
+        
+        /** Whether Command is final */
+        TAtomic<bool> bConstructed { false };
+    };
+    
+    /**
+     * Find a registered command
+     * @param CommandName - Name of the command
+     * @param bConstruct - Whether to construct a lazy command that has not been used yet
+     * @return The command, or nullptr if not registered or not constructed
+     */
+    TSharedPtr<IUnrealMCPCommand> FindCommand(const FString& CommandName, bool bConstruct = true) const;
+    
+    /** Add an entry to the writers' table and publish it */
+    bool AddEntry(const TSharedRef<FCommandEntry>& Entry, bool bReplaceExisting);
+    
+    /** Run a lazy entry's factory; serialized by ConstructionLock */
+    void ConstructCommand(FCommandEntry& Entry) const;
+    
+    /**
+     * Get the table key for a command name without adding it to the name table
+     * @param CommandName - Name of the command
+     * @return Key, or NAME_None if no command can be registered under this name
+     */
+    static FName FindCommandKey(const FString& CommandName);
+    
     /** Private constructor for singleton pattern */
-    FUnrealMCPCommandRegistry() = default;
+    FUnrealMCPCommandRegistry();
+    
+    /** Immutable view of the registry that lookups read without locking */
+    struct FSnapshot
+    {
+        /** Map of command names to command entries */
+        TMap<FName, TSharedRef<FCommandEntry>> Commands;
+        
+        /** Command names, spelled as the commands report them, sorted */
+        TArray<FString> SortedCommandNames;
+        
+        /** GetAllCommandsHelp result */
+        FString AllCommandsHelp;
+    };
+    
+    /**
+     * Publish a snapshot of RegisteredCommands, unless a batch update is open
+     * Must be called with RegistryLock held
+     */
+    void PublishSnapshot();
+    
+    /** Build the GetAllCommandsHelp JSON for the given sorted names */
+    static FString BuildAllCommandsHelp(const TArray<FString>& SortedCommandNames);
+    
+    /** Map of command names to command entries; the writers' copy, guarded by RegistryLock */
+    TMap<FName, TSharedRef<FCommandEntry>> RegisteredCommands;
     
-    /** Map of command names to command instances */
-    TMap<FString, TSharedPtr<IUnrealMCPCommand>> RegisteredCommands;
+    /** Snapshot readers use; never null */
+    TAtomic<const FSnapshot*> CurrentSnapshot;
     
-    /** Critical section for thread safety */
+    /** Snapshots replaced by a later publish, freed with the registry */
+    TArray<TUniquePtr<const FSnapshot>> RetiredSnapshots;
+    
+    /** Open BeginBatchUpdate calls */
+    int32 BatchUpdateDepth;
+    
+    /** Critical section serializing writers */
     mutable FCriticalSection RegistryLock;
     
+    /** Critical section serializing lazy construction, so service singletons are created one at a time */
+    mutable FCriticalSection ConstructionLock;
+    
     /**
      * Create error response JSON
      * @param ErrorMessage - Error message
@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class IUnrealMCPCommand;
+class FUnrealMCPBlueprintActionCommandsHandler;
+
 /**
  * Main command dispatcher that routes commands through the registry system
  * Provides backward compatibility with the existing JSON-based command interface
@@ -84,4 +87,16 @@ private:
      * This includes Blueprint, Project, DataTable, Editor, and UMG commands
      */
     void RegisterAllCommands();
+    
+    /**
+     * Register the legacy handler classes into the registry for the names no command class claims
+     * Runs after RegisterAllCommands so dedicated command classes take precedence
+     */
+    void RegisterLegacyHandlerCommands();
+    
+    /** Legacy handler instances backing the registered legacy commands */
+    TSharedPtr<FUnrealMCPBlueprintActionCommandsHandler> BlueprintActionHandler;
+    
+    /** Commands registered by RegisterLegacyHandlerCommands */
+    TArray<TSharedPtr<IUnrealMCPCommand>> LegacyHandlerCommands;
 };
@@ -2,11 +2,28 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/SoftObjectPath.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
 
 /**
  * Factory class for creating and managing Unreal Engine component types
  * Implements the Factory pattern to centralize component creation logic
  * and provide type-safe component instantiation
+ *
+ * The one registry component type names resolve through, for the factory's own users and for
+ * FComponentService. A name is looked up, in order, among the registered types and their short
+ * aliases ("StaticMesh"), the native component classes known to reflection ("StaticMeshComponent"
+ * or "UStaticMeshComponent"), and the Blueprint component classes the asset registry knows by
+ * asset name ("BP_Health" or "BP_Health_C"). Object and package paths load exactly what they name.
+ * No location is guessed, so a name that resolves to nothing costs map lookups only.
+ *
+ * Native classes are indexed the first time a name is not registered, and again after modules
+ * change; Blueprint components are indexed from the asset registry once its scan has completed,
+ * and again after assets are added, removed or renamed. Resolved names are kept until their class
+ * goes away. Thread-safe; names that have to load a class resolve on the game thread only.
  */
 class UNREALMCP_API FComponentFactory
 {
@@ -31,6 +48,12 @@ public:
      */
     UClass* GetComponentClass(const FString& TypeName) const;
 
+    /** Start following module and asset registry changes and report the registry's statistics */
+    void Initialize();
+
+    /** Stop following changes and drop the indexes and resolved names */
+    void Shutdown();
+
     /**
      * Get all available component type names
      * @return Array of registered component type names
@@ -47,12 +70,55 @@ private:
     /** Private constructor for singleton pattern */
     FComponentFactory() = default;
 
+    /** Resolve a name that is not in ResolvedClasses (must be called with lock held) */
+    UClass* ResolveComponentClass(const FString& TypeName) const;
+
+    /** Load the class an object or package path names (must be called with lock held) */
+    UClass* LoadComponentClassByPath(const FString& Path) const;
+
+    /** Index the native component classes if needed (must be called with lock held) */
+    void EnsureNativeIndex() const;
+
+    /** Index the Blueprint component classes if needed (must be called with lock held) */
+    void EnsureBlueprintIndex() const;
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
     /** Map of component type names to their corresponding UClass pointers */
     TMap<FString, UClass*> ComponentTypeMap;
 
+    /** Short names for registered types, e.g. "StaticMesh" -> "StaticMeshComponent" */
+    TMap<FString, FString> TypeAliases;
+
+    /** Native component classes by class name, without the U prefix */
+    mutable TMap<FName, TWeakObjectPtr<UClass>> NativeClasses;
+
+    /** Generated class paths of Blueprint components by Blueprint asset name */
+    mutable TMap<FName, FSoftObjectPath> BlueprintClasses;
+
+    /** Blueprint generated class paths by Blueprint package, for package paths */
+    mutable TMap<FName, FSoftObjectPath> BlueprintClassesByPackage;
+
+    /** Names already resolved, as they were asked for */
+    mutable TMap<FString, TWeakObjectPtr<UClass>> ResolvedClasses;
+
+    mutable bool bNativeIndexBuilt = false;
+    mutable bool bBlueprintIndexBuilt = false;
+
+    /** Lookups answered from ResolvedClasses or not */
+    mutable FMCPCacheCounters CacheCounters;
+
     /** Flag to track if default types have been initialized */
     bool bDefaultTypesInitialized = false;
 
+    bool bInitialized = false;
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+
     /** Critical section for thread safety */
     mutable FCriticalSection ComponentMapLock;
 };
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Bounds how many commands may be in flight, globally and per client
+ *
+ * Nothing used to limit how much work could pile up behind the game thread: a runaway agent loop
+ * could queue commands, each holding its parameter DOM, faster than the editor ran them. A command
+ * is now admitted only while fewer than mcp.MaxInFlightCommands commands are in flight overall and
+ * fewer than mcp.MaxInFlightCommandsPerClient for its client; otherwise it is rejected straight
+ * away with a "busy" error that tells the client when to retry.
+ *
+ * A command is in flight from admission until its response is ready, whether it is queued, running
+ * or waiting on an identical request.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPAdmissionController
+{
+public:
+    FMCPAdmissionController();
+
+    /**
+     * Admit a command if the limits allow it
+     * @param ClientId Connection the request came from; 0 for requests not tied to a connection, which only count against the global limit
+     * @param OutRetryAfterMs Receives the suggested wait before retrying when the command is rejected
+     * @return true if the command was admitted and Release must be called once it finishes
+     */
+    bool TryAdmit(uint32 ClientId, int32& OutRetryAfterMs);
+
+    /**
+     * Finish an admitted command
+     * @param ClientId Client passed to TryAdmit
+     * @param DurationSeconds Time from admission to completion, for the retry estimate
+     */
+    void Release(uint32 ClientId, double DurationSeconds);
+
+    /** @return Commands in flight across all clients */
+    int32 GetInFlightCount() const;
+
+    /** @return Commands in flight for one client */
+    int32 GetInFlightCount(uint32 ClientId) const;
+
+    /**
+     * Build the response sent for a rejected command
+     * @param RetryAfterMs Suggested wait from TryAdmit
+     * @return {"status": "error", "error": ..., "busy": true, "retry_after_ms": RetryAfterMs}
+     */
+    static TSharedRef<class FJsonObject> MakeBusyResponse(int32 RetryAfterMs);
+
+private:
+    /** Suggested wait until ExcessCommands of InFlightCommands have completed; lock must be held */
+    int32 EstimateRetryAfterMs(int32 ExcessCommands, int32 InFlightCommands) const;
+
+    TMap<uint32, int32> InFlightPerClient;
+    int32 TotalInFlight;
+
+    /** Moving average of how long admitted commands stay in flight */
+    double AverageDurationSeconds;
+
+    mutable FCriticalSection Lock;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "MCPCacheStats.h"
+
+class FJsonObject;
+struct FSoftObjectPath;
+
+/**
+ * Loads the assets a session is likely to ask for next while the editor has nothing else to do
+ *
+ * Clients tend to work through assets in the same order: a Blueprint, then the Blueprints its
+ * functions call, then the widget showing its state. Each command's asset (blueprint_name,
+ * anim_blueprint_name, blueprint_path or asset_path) is recorded, and every change of asset counts
+ * one transition from the previous to the new one. After an access, the successors seen at least
+ * MinTransitionCount times are queued; from the core ticker, one per mcp.PrefetchIntervalSeconds
+ * and only while no commands are waiting, each is loaded with LoadPackageAsync. Once loaded (and
+ * for the asset just used), a Blueprint has its name lookup, graph fingerprints and reachability
+ * cached, and the pin compatibility index builds the function list of its parent class.
+ *
+ * Transitions are saved to Saved/UnrealMCP/AccessPatterns.json at shutdown; counts are halved
+ * when loaded, so patterns of past sessions fade unless they repeat. get_cache_stats reports
+ * accesses to a prefetched asset as hits and to any other asset as misses.
+ *
+ * RecordAccess is thread-safe; Initialize and Shutdown are game thread only.
+ */
+class UNREALMCP_API FMCPAssetPrefetcher
+{
+public:
+    static FMCPAssetPrefetcher& Get();
+
+    /**
+     * Restore the transitions of past sessions and start prefetching
+     * @param InCanPrefetch Whether the editor has time for a prefetch this tick, e.g. no commands queued
+     */
+    void Initialize(TFunction<bool()> InCanPrefetch);
+
+    /** Stop prefetching and save the transitions */
+    void Shutdown();
+
+    /** Record the asset a command has just used, if it names one, and queue its likely successors */
+    void RecordAccess(const TSharedPtr<FJsonObject>& Params);
+
+    /** @return The asset a command's params name: a short name or package path, or empty */
+    static FString GetAssetKey(const TSharedPtr<FJsonObject>& Params);
+
+    /** Times a transition must have been seen before its target is prefetched */
+    static constexpr int32 MinTransitionCount = 2;
+
+    /** Most likely successors queued after each access */
+    static constexpr int32 MaxPrefetchesPerAccess = 2;
+
+private:
+    FMCPAssetPrefetcher() = default;
+
+    struct FSuccessor
+    {
+        FString Key;
+        int32 Count = 0;
+    };
+
+    /** Count one transition; caller holds Lock */
+    void AddTransition(const FString& From, const FString& To);
+
+    bool Tick(float DeltaTime);
+
+    /** Start loading an asset's package, or queue its warm-up if it is loaded */
+    void Prefetch(const FString& Key);
+
+    /** Fill the caches the commands on a loaded Blueprint read */
+    void Warm(const FString& Key);
+
+    /** @return The asset a key names; fails for short names the asset index does not know */
+    static bool ResolveKey(const FString& Key, FSoftObjectPath& OutPath);
+
+    static FString GetPersistentStatePath();
+    int32 LoadPersistentState();
+    void SavePersistentState() const;
+
+    /** Successors kept per asset; a new one replaces the least seen */
+    static constexpr int32 MaxSuccessors = 8;
+
+    /** Assets transitions are kept from */
+    static constexpr int32 MaxSources = 1024;
+
+    /** Prefetched assets not accessed yet that still count as a hit */
+    static constexpr int32 MaxPrefetched = 16;
+
+    mutable FCriticalSection Lock;
+    TMap<FString, TArray<FSuccessor>> Transitions;
+    FString LastKey;
+    TArray<FString> PendingPrefetches;
+    TArray<FString> PendingWarms;
+    /** Oldest first */
+    TArray<FString> Prefetched;
+    bool bDirty = false;
+    bool bInitialized = false;
+
+    TFunction<bool()> CanPrefetch;
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    FMCPCacheCounters CacheCounters;
+    int64 PackagesRequested = 0;
+    int64 PackagesLoaded = 0;
+    int64 Warms = 0;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+
+/**
+ * Loads a set of assets for a command that processes them one at a time
+ *
+ * Rather than a blocking LoadObject per asset, the packages of up to mcp.AsyncLoadMaxInFlight
+ * assets are requested from the async loader at once and each asset is handed to the callback on
+ * the game thread as soon as its package has loaded, while the others keep loading. Assets that
+ * are already loaded are handed over first, without a request.
+ *
+ * When available physical memory drops below mcp.AsyncLoadMinFreeMemoryMB, garbage is collected
+ * between assets, so the packages the callback is done with are reclaimed before more are loaded.
+ * A callback must therefore not keep pointers to earlier assets; it copies out what it needs.
+ *
+ * Loading stops early when the callback returns false or the current request is cancelled.
+ * Packages still in flight finish loading in the background.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FMCPAsyncAssetLoader
+{
+public:
+    /** What LoadEach did */
+    struct FStats
+    {
+        /** Assets that were loaded already */
+        int32 AlreadyLoaded = 0;
+        /** Assets whose package was requested from the async loader */
+        int32 Requested = 0;
+        /** Requested assets that loaded */
+        int32 Loaded = 0;
+        /** Requested assets whose package or object could not be loaded */
+        int32 Failed = 0;
+        /** Garbage collections run because memory was low */
+        int32 GarbageCollections = 0;
+        /** Whether the callback or a cancellation stopped loading before every asset was handed over */
+        bool bStopped = false;
+    };
+
+    /**
+     * Called for each asset
+     * @param Index - Index of the asset in the paths passed to LoadEach
+     * @param Asset - The asset, or nullptr if it could not be loaded
+     * @return false to stop loading
+     */
+    using FOnAssetLoaded = TFunctionRef<bool(int32 Index, UObject* Asset)>;
+
+    /**
+     * Load assets and call OnLoaded for each, in the order they finish loading
+     * @param Paths - Object paths of the assets
+     * @param OnLoaded - Callback for each asset
+     * @param MaxInFlight - Packages loading at once; 0 for mcp.AsyncLoadMaxInFlight
+     * @return What was loaded
+     */
+    static FStats LoadEach(const TArray<FSoftObjectPath>& Paths, FOnAssetLoaded OnLoaded, int32 MaxInFlight = 0);
+
+    /** Assets handed over between memory checks that may collect garbage */
+    static constexpr int32 AssetsBetweenCollections = 8;
+
+    /** Longest wait for a load to land before the request's cancellation is checked again */
+    static constexpr double WaitSliceSeconds = 0.25;
+};
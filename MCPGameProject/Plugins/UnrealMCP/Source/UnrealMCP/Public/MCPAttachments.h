@@ -0,0 +1,72 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonValue;
+
+/**
+ * Bytes attached to a response
+ */
+struct FMCPAttachment
+{
+    /** Id the response refers to the bytes by */
+    FString Id;
+
+    /** The bytes; shared, since a coalesced response may be sent to several clients */
+    TSharedPtr<const TArray64<uint8>, ESPMode::ThreadSafe> Data;
+};
+
+/**
+ * Binary attachments of MCP responses
+ *
+ * Commands that return binary data (encoded screenshots) hand it over here instead of
+ * base64-encoding it into the result, and put the reference MakeReference returns where the
+ * data belongs: {"$attachment": "att-7"}. The bytes stay in a process-wide store, so a result
+ * can be cached or coalesced like any other, until LifetimeSeconds have passed or MaxHeldBytes
+ * are exceeded.
+ *
+ * Whoever sends the response resolves the references. A connection that negotiated attachments
+ * in its handshake sends the bytes in the response's frame, straight from the encoded buffer
+ * (see FMCPMessageFramer::AttachmentsFlag); everything else gets InlineReferences, which puts
+ * the base64 string in place of each reference, as the commands returned it before. A
+ * reference to bytes no longer held becomes null.
+ *
+ * References are found in serialized responses by their exact condensed form, so a result that
+ * embeds another one as a string (rather than as an object) must inline it first.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPAttachments
+{
+public:
+    /** Seconds attached bytes are held after they were added */
+    static constexpr double LifetimeSeconds = 60.0;
+
+    /** Bytes held before the oldest attachments are dropped early */
+    static constexpr int64 MaxHeldBytes = 256ll * 1024 * 1024;
+
+    /**
+     * Hold bytes for a response and get the value that refers to them
+     * @param Data Bytes to attach, e.g. an encoded image; moved, not copied
+     * @return {"$attachment": "<id>"}, to put where the data belongs in the result
+     */
+    static TSharedRef<FJsonValue> MakeReference(TArray64<uint8>&& Data);
+
+    /**
+     * Find the attachments a serialized response refers to
+     * @param Response Serialized response
+     * @param OutAttachments Held attachments, in order of first reference, each listed once
+     * @return false if the response refers to bytes that are no longer held
+     */
+    static bool FindReferences(const FString& Response, TArray<FMCPAttachment>& OutAttachments);
+
+    /**
+     * Replace every reference in a serialized response with the base64 string of its bytes
+     * @param Response Serialized response, rewritten in place
+     * @return true if the response had references
+     */
+    static bool InlineReferences(FString& Response);
+
+    /** @return true if the serialized response may contain references */
+    static bool HasReferences(const FString& Response);
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FScopedTransaction;
+class UBlueprint;
+class UEdGraph;
+
+/**
+ * Groups the edits of a batch of MCP commands into one undo transaction and one round of
+ * notifications per touched asset
+ *
+ * While a scope is open on the game thread, the notification helpers below record what they were
+ * asked to do instead of doing it, and the outermost scope performs each recorded notification
+ * once when it closes, still inside its transaction:
+ *
+ * - MarkBlueprintAsModified: once per blueprint (PostEditChange, editor refresh)
+ * - NotifyGraphChanged: once per graph (graph editor widget rebuild)
+ * - Defer: once per asset and kind (e.g. reopening the DataTable editor)
+ *
+ * Structural blueprint changes and node reconstruction are not deferred: later commands in the
+ * batch may rely on the regenerated skeleton class and pins. Compiles queued with FMCPCompileQueue
+ * and then saves queued with FMCPSaveQueue run after the outermost scope's transaction closes.
+ *
+ * Outside a scope, or off the game thread, the helpers act immediately, so services call them
+ * unconditionally. Scopes nest; inner scopes only add to the outermost one.
+ *
+ * RequestRollback makes the outermost scope undo its transaction once it closes, restoring every
+ * object the batch modified from the transaction buffer, however many operations changed it.
+ */
+class UNREALMCP_API FMCPBatchEditScope
+{
+public:
+    /**
+     * Open a scope, and its undo transaction if it is the outermost one
+     * @param Description Undo history entry for the whole batch
+     */
+    explicit FMCPBatchEditScope(const FText& Description);
+
+    /** Close the scope; the outermost one flushes the deferred notifications */
+    ~FMCPBatchEditScope();
+
+    FMCPBatchEditScope(const FMCPBatchEditScope&) = delete;
+    FMCPBatchEditScope& operator=(const FMCPBatchEditScope&) = delete;
+
+    /** @return true if a scope is open and the caller is on the game thread */
+    static bool IsActive();
+
+    /**
+     * FBlueprintEditorUtils::MarkBlueprintAsModified, deferred while a scope is open
+     * @param Blueprint Modified blueprint
+     */
+    static void MarkBlueprintAsModified(UBlueprint* Blueprint);
+
+    /**
+     * UEdGraph::NotifyGraphChanged, deferred while a scope is open
+     * @param Graph Changed graph
+     */
+    static void NotifyGraphChanged(UEdGraph* Graph);
+
+    /**
+     * Run a notification now, or once when the outermost scope closes
+     * @param Asset Asset the notification is for; skipped at flush if it was destroyed meanwhile
+     * @param Kind Distinguishes notifications for the same asset; only the first one of a kind is kept
+     * @param Notification Notification to run
+     */
+    static void Defer(UObject* Asset, FName Kind, TFunction<void()> Notification);
+
+    /**
+     * Undo the outermost scope's transaction when it closes, before queued compiles and saves run
+     * Does nothing outside a scope.
+     */
+    static void RequestRollback();
+
+private:
+    /** Run and clear every recorded notification */
+    static void Flush();
+
+    /** Undo the outermost scope's transaction, if it recorded one */
+    void UndoTransaction() const;
+
+    /** Transaction of the outermost scope */
+    TUniquePtr<FScopedTransaction> Transaction;
+
+    /** Undo history entry that was current before the outermost scope opened */
+    FGuid PreviousTransactionId;
+};
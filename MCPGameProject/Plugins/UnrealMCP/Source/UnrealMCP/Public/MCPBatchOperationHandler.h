@@ -4,6 +4,8 @@
 #include "MCPOperationContext.h"
 #include "MCPBatchOperationHandler.generated.h"
 
+class FJsonObject;
+
 /**
  * Structure representing a single operation in a batch
  */
@@ -24,10 +26,21 @@ struct UNREALMCP_API FMCPBatchOperation
     UPROPERTY(BlueprintReadOnly)
     FString Parameters;
 
+    /**
+     * Parameters as a JSON object, used instead of Parameters when set. String values may refer to
+     * the results of other operations of the batch (see FMCPBatchReferences); an operation depends
+     * on every operation it refers to
+     */
+    TSharedPtr<FJsonObject> Params;
+
     /** Whether this operation depends on previous operations */
     UPROPERTY(BlueprintReadOnly)
     TArray<FString> Dependencies;
 
+    /** Operations that must have finished, whether or not they succeeded, before this one runs */
+    UPROPERTY(BlueprintReadOnly)
+    TArray<FString> RunAfter;
+
     /** Priority of the operation (higher numbers execute first) */
     UPROPERTY(BlueprintReadOnly)
     int32 Priority;
@@ -73,13 +86,20 @@ struct UNREALMCP_API FMCPBatchOperationResult
     UPROPERTY(BlueprintReadOnly)
     bool bSuccess;
 
+    /** Whether the operation was not run because a dependency did not succeed */
+    UPROPERTY(BlueprintReadOnly)
+    bool bSkipped;
+
     /** Result data from the operation */
     UPROPERTY(BlueprintReadOnly)
     FString ResultData;
 
-    /** Operation context with errors and warnings */
+    /** The command's result; null if the operation did not run or its command returned none */
+    TSharedPtr<FJsonObject> ResultObject;
+
+    /** Operation context with errors and warnings, stored inline in the result */
     UPROPERTY(BlueprintReadOnly)
-    UMCPOperationContext* OperationContext;
+    FMCPOperationContext OperationContext;
 
     /** Execution time for this operation */
     UPROPERTY(BlueprintReadOnly)
@@ -88,16 +108,55 @@ struct UNREALMCP_API FMCPBatchOperationResult
     FMCPBatchOperationResult()
         : Operation()
         , bSuccess(false)
+        , bSkipped(false)
         , ResultData(TEXT(""))
-        , OperationContext(nullptr)
+        , OperationContext()
         , ExecutionTime(0.0f)
     {
     }
 };
 
+/**
+ * Timing of one dependency wave of a batch
+ */
+USTRUCT(BlueprintType)
+struct UNREALMCP_API FMCPBatchWaveStats
+{
+    GENERATED_BODY()
+
+    /** Number of operations executed in the wave */
+    UPROPERTY(BlueprintReadOnly)
+    int32 OperationCount;
+
+    /** How many of them ran on worker threads */
+    UPROPERTY(BlueprintReadOnly)
+    int32 WorkerOperationCount;
+
+    /** Wall time of the wave in seconds */
+    UPROPERTY(BlueprintReadOnly)
+    float Duration;
+
+    FMCPBatchWaveStats()
+        : OperationCount(0)
+        , WorkerOperationCount(0)
+        , Duration(0.0f)
+    {
+    }
+};
+
 /**
  * Handler for executing multiple MCP operations in batch with error aggregation
  * Provides dependency management, error handling, and rollback capabilities
+ *
+ * Operations execute through the command registry in dependency waves: every operation whose
+ * dependencies have all succeeded, and whose RunAfter operations have finished, runs in the next
+ * wave. Within a wave, commands whose thread affinity allows it run concurrently on worker threads
+ * (up to MaxParallelOperations at a time) while the game-thread commands run one after another on
+ * the calling thread. An operation whose dependency failed or was skipped is reported as not
+ * satisfied without running. References in an operation's Params are resolved before its wave, from
+ * the results of the waves before it.
+ *
+ * Execute batches on the game thread.
  */
 UCLASS(BlueprintType)
 class UNREALMCP_API UMCPBatchOperationHandler : public UObject
@@ -188,7 +247,39 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "State")
     bool bBatchExecuted;
 
+    /** Timing of each dependency wave of the last execution */
+    UPROPERTY(BlueprintReadOnly, Category = "Results")
+    TArray<FMCPBatchWaveStats> WaveStats;
+
 private:
+    /** Outcome of running an operation's command; free of UObjects so it can be built on a worker */
+    struct FOperationOutcome
+    {
+        bool bSuccess = false;
+        FString ResultData;
+        TSharedPtr<FJsonObject> ResultObject;
+        float ExecutionTime = 0.0f;
+    };
+
+    /**
+     * Run an operation's command on the calling thread
+     * @param Operation - Operation to run
+     * @param Params - Its parameters, with references resolved
+     */
+    static FOperationOutcome RunOperation(const FMCPBatchOperation& Operation, const TSharedRef<FJsonObject>& Params);
+
+    /** @return An operation's parameters: Params, or Parameters parsed; empty if there are none */
+    static TSharedRef<FJsonObject> GetParamsObject(const FMCPBatchOperation& Operation);
+
+    /** Build the result of an operation from its outcome */
+    static FMCPBatchOperationResult MakeResult(const FMCPBatchOperation& Operation, const FOperationOutcome& Outcome);
+
+    /** Build the result of an operation that was not run because a dependency did not succeed */
+    static FMCPBatchOperationResult MakeDependencyFailedResult(const FMCPBatchOperation& Operation);
+
+    /** Ids of operations that completed successfully in the current execution */
+    TSet<FString> SucceededOperationIds;
+
     /** Sort operations by priority and dependencies */
     void SortOperationsByPriorityAndDependencies();
 
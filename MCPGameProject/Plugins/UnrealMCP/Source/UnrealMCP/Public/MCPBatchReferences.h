@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+
+/**
+ * References from a batch operation's parameters to the results of other operations
+ *
+ * A string parameter of the form "$<id>.<field>.<field>..." stands for that field of the named
+ * operation's result, keeping its JSON type ("$<id>" alone is the whole result; array elements
+ * are addressed by index). A string starting with "$$" stands for the literal text with one "$"
+ * removed; "$" followed by anything other than an operation id is left as is.
+ *
+ * Operation ids therefore must not be empty, contain '.' or start with '$'.
+ */
+class UNREALMCP_API FMCPBatchReferences
+{
+public:
+    /**
+     * Add the operations a parameter value references
+     * @param Value - Parameter value to scan
+     * @param OperationIds - Operation ids in the batch
+     * @param OutIds - Receives each referenced operation id once
+     */
+    static void Collect(const TSharedPtr<FJsonValue>& Value, const TSet<FString>& OperationIds, TArray<FString>& OutIds);
+
+    /**
+     * Replace the references in a parameter value with the referenced results
+     * @param Value - Parameter value to resolve
+     * @param OperationIds - Operation ids in the batch
+     * @param Results - Results of the operations that succeeded so far, by operation id
+     * @param OutError - Error message if a referenced result or field does not exist
+     * @return Resolved value, or nullptr on error
+     */
+    static TSharedPtr<FJsonValue> Resolve(const TSharedPtr<FJsonValue>& Value, const TSet<FString>& OperationIds, const TMap<FString, TSharedPtr<FJsonObject>>& Results, FString& OutError);
+
+    /**
+     * Split "$<id>.<path>" into the referenced operation and the field path
+     * @param Text - String parameter
+     * @param OperationIds - Operation ids in the batch
+     * @param OutId - Referenced operation id
+     * @param OutPath - Field path below the result, possibly empty
+     * @return true if Text is a reference to an operation in the batch
+     */
+    static bool Parse(const FString& Text, const TSet<FString>& OperationIds, FString& OutId, TArray<FString>& OutPath);
+};
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonObject;
+
+/** When an entry of a budgeted cache was last used, and about how many bytes it holds */
+struct FMCPCacheUse
+{
+    uint64 LastUse = 0;
+    int64 Bytes = 0;
+};
+
+/**
+ * A cache whose entries FMCPCacheBudget may evict
+ *
+ * Each entry keeps the FMCPCacheBudget::NextUse() stamp of its last lookup and an estimate of the
+ * memory it holds, and the cache keeps the running total of those estimates (AddUsedBytes on
+ * insert, subtracted on removal), so checking the budget costs one read per cache. Only when the
+ * total is over budget does the budget ask every cache for its entries, find the stamp below which
+ * evicting the least recently used entries of all caches together brings them back under budget,
+ * and have each cache drop its entries used before it. An evicted entry is recomputed by its next
+ * lookup, as if it had been invalidated.
+ *
+ * Both functions are only called on the game thread; a cache that is read from other threads takes
+ * its own lock in them.
+ */
+class UNREALMCP_API IMCPBudgetedCache
+{
+public:
+    virtual ~IMCPBudgetedCache() = default;
+
+    /** Add the last use and size of every entry */
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const = 0;
+
+    /**
+     * Drop every entry last used before a stamp
+     * @param Stamp Entries with a lower LastUse go; MAX_uint64 drops them all
+     * @return Bytes freed
+     */
+    virtual int64 EvictUsedBefore(uint64 Stamp) = 0;
+
+    /** @return Estimated bytes held by all entries; thread-safe */
+    int64 GetUsedBytes() const { return UsedBytes.Load(); }
+
+protected:
+    /** Count the bytes of an entry added (positive) or removed (negative) */
+    void AddUsedBytes(int64 Bytes) { UsedBytes += Bytes; }
+
+    /** Forget every entry's bytes, when the cache has emptied all of them */
+    void ResetUsedBytes() { UsedBytes = 0; }
+
+    /** @return Heap bytes held by an array of strings */
+    static int64 GetStringsSize(const TArray<FString>& Strings)
+    {
+        int64 Bytes = Strings.GetAllocatedSize();
+        for (const FString& String : Strings)
+        {
+            Bytes += String.GetAllocatedSize();
+        }
+        return Bytes;
+    }
+
+    /** GetCacheUses of a map whose values have LastUse and Bytes members */
+    template <typename MapType>
+    static void GetMapUses(const MapType& Map, TArray<FMCPCacheUse>& OutUses)
+    {
+        OutUses.Reserve(OutUses.Num() + Map.Num());
+        for (const auto& Pair : Map)
+        {
+            OutUses.Add({ Pair.Value.LastUse, Pair.Value.Bytes });
+        }
+    }
+
+    /** EvictUsedBefore of a map whose values have LastUse and Bytes members */
+    template <typename MapType>
+    int64 EvictMapUsedBefore(MapType& Map, uint64 Stamp)
+    {
+        int64 Freed = 0;
+        for (auto It = Map.CreateIterator(); It; ++It)
+        {
+            if (It.Value().LastUse < Stamp)
+            {
+                Freed += It.Value().Bytes;
+                It.RemoveCurrent();
+            }
+        }
+        AddUsedBytes(-Freed);
+        return Freed;
+    }
+
+    /**
+     * Remove one entry of a map whose values have a Bytes member, uncounting its bytes
+     * @return Whether the key was cached
+     */
+    template <typename MapType, typename KeyType>
+    bool RemoveMapEntry(MapType& Map, const KeyType& Key)
+    {
+        if (const auto* Value = Map.Find(Key))
+        {
+            AddUsedBytes(-Value->Bytes);
+            Map.Remove(Key);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    TAtomic<int64> UsedBytes { 0 };
+};
+
+/**
+ * Memory budget shared by the plugin's caches (UUnrealMCPSettings::CacheMemoryBudgetMB)
+ *
+ * Per-key caches that grow with every asset, graph or request a session touches register here.
+ * After each command the bridge calls EnforceBudget, which sums the caches' running totals and,
+ * only when they are over budget, evicts the least recently used entries across all of them until
+ * their estimated total is back under budget. Everything is evicted when the engine asks for
+ * memory back (FCoreDelegates::GetMemoryTrimDelegate) and, at most once per
+ * LowMemoryTrimIntervalSeconds, when the machine runs low on physical memory.
+ *
+ * Indexes sized by the project rather than the session (asset search, action database, ...) are
+ * not budgeted: they are rebuilt at a cost, and never grow past the project they index.
+ *
+ * Registration is thread-safe; enforcement and trimming run on the game thread.
+ */
+class UNREALMCP_API FMCPCacheBudget
+{
+public:
+    static FMCPCacheBudget& Get();
+
+    /** Follow memory trim requests and report to get_cache_stats */
+    void Initialize();
+
+    /** Stop following memory trim requests */
+    void Shutdown();
+
+    /**
+     * Register a cache, replacing any registered under the same name
+     * @param Name Name reported by get_cache_stats, e.g. "graph_reachability_cache"
+     * @param Cache Must stay valid until it is unregistered
+     */
+    void Register(const FString& Name, IMCPBudgetedCache& Cache);
+
+    void Unregister(const FString& Name);
+
+    /** @return A stamp later than every one returned before; thread-safe */
+    static uint64 NextUse() { return ++UseCounter; }
+
+    /** Evict least recently used entries until the caches fit the budget; game thread */
+    void EnforceBudget();
+
+    /** Evict every entry of every cache; game thread */
+    void TrimAll();
+
+    /**
+     * Report the budget and what each cache holds
+     * {"budget_bytes", "used_bytes", "evicted_entries", "evicted_bytes", "trims", "caches": {name: bytes}}
+     */
+    TSharedRef<FJsonObject> MakeReport() const;
+
+    /** @return Budget in bytes, or 0 for no limit */
+    static int64 GetBudgetBytes();
+
+    /** @return Estimated bytes held by all registered caches */
+    int64 GetUsedBytes() const;
+
+    /** Available physical memory below which EnforceBudget evicts everything */
+    static constexpr uint64 LowMemoryBytes = 512ull * 1024 * 1024;
+
+    /** Least time between two low memory evictions, so caches are not emptied on every command */
+    static constexpr double LowMemoryTrimIntervalSeconds = 30.0;
+
+    /** Least time between two reads of the available physical memory */
+    static constexpr double LowMemoryCheckIntervalSeconds = 1.0;
+
+private:
+    FMCPCacheBudget() = default;
+
+    /** Evict entries until the caches hold at most TargetBytes */
+    void EvictDownTo(int64 TargetBytes);
+
+    void HandleMemoryTrim();
+
+    mutable FCriticalSection Lock;
+    TMap<FString, IMCPBudgetedCache*> Caches;
+
+    static TAtomic<uint64> UseCounter;
+
+    double LastLowMemoryCheckTime = 0.0;
+    double LastLowMemoryTrimTime = -LowMemoryTrimIntervalSeconds;
+    int64 EvictedEntries = 0;
+    int64 EvictedBytes = 0;
+    int32 Trims = 0;
+
+    FDelegateHandle MemoryTrimHandle;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonObject;
+
+/**
+ * Hit, miss and invalidation counts of a cache, pool or index
+ *
+ * Kept by the structure itself and read through FMCPCacheStatsRegistry. Thread-safe.
+ */
+struct UNREALMCP_API FMCPCacheCounters
+{
+    /** A lookup was answered from what was cached */
+    void RecordHit() { ++Hits; }
+
+    /** A lookup had to compute, load or (re)build what it asked for */
+    void RecordMiss() { ++Misses; }
+
+    /** Some or all of what was cached was dropped */
+    void RecordInvalidation() { ++Invalidations; }
+
+    void Reset()
+    {
+        Hits = 0;
+        Misses = 0;
+        Invalidations = 0;
+    }
+
+    TAtomic<int64> Hits { 0 };
+    TAtomic<int64> Misses { 0 };
+    TAtomic<int64> Invalidations { 0 };
+};
+
+/**
+ * One place to read the statistics of every cache, object pool and index of the plugin
+ *
+ * Each structure registers under a unique name with a function filling in its current numbers and
+ * one resetting them; the get_cache_stats command reports all of them side by side, with hit
+ * ratios, and can reset them to measure a fresh window. Structures keeping an FMCPCacheCounters
+ * register it directly; those with their own statistics (object pools, FBlueprintCache) convert
+ * them.
+ *
+ * Sources are only read and reset on the game thread, so a source function may read the entry
+ * count of a game-thread-only structure without locking it. Registration is thread-safe.
+ */
+class UNREALMCP_API FMCPCacheStatsRegistry
+{
+public:
+    /** Numbers a source reports */
+    struct FStats
+    {
+        int64 Hits = 0;
+        int64 Misses = 0;
+        /** Times some or all entries were dropped; -1 if the source does not count them */
+        int64 Invalidations = -1;
+        /** Entries currently held; -1 if the source does not know */
+        int64 Entries = -1;
+        /** Source-specific numbers, added to its report as they are */
+        TSharedPtr<FJsonObject> Details;
+    };
+
+    using FGetStats = TFunction<void(FStats&)>;
+    using FResetStats = TFunction<void()>;
+
+    static FMCPCacheStatsRegistry& Get();
+
+    /**
+     * Register a source, replacing any registered under the same name
+     * @param Name - Unique name reported for the source, e.g. "asset_search_index"
+     * @param Kind - "cache", "pool" or "index"
+     */
+    void Register(const FString& Name, const TCHAR* Kind, FGetStats GetStats, FResetStats ResetStats);
+
+    /**
+     * Register a source that keeps an FMCPCacheCounters
+     * @param Counters - Must outlive the registration
+     * @param GetEntries - Entries currently held; may be empty if unknown
+     */
+    void Register(const FString& Name, const TCHAR* Kind, FMCPCacheCounters& Counters, TFunction<int64()> GetEntries);
+
+    void Unregister(const FString& Name);
+
+    /**
+     * Report registered sources, sorted by name
+     * {"sources": [{"name", "kind", "hits", "misses", "requests", "hit_ratio", "invalidations"?, "entries"?, ...details}],
+     *  "totals": {"hits", "misses", "requests", "hit_ratio"}}
+     * @param NameFilter - Only report sources whose name contains this; all if empty
+     */
+    TSharedRef<FJsonObject> MakeReport(const FString& NameFilter) const;
+
+    /**
+     * Reset the statistics of registered sources
+     * @param NameFilter - Only reset sources whose name contains this; all if empty
+     * @return Number of sources reset
+     */
+    int32 ResetStats(const FString& NameFilter);
+
+private:
+    FMCPCacheStatsRegistry() = default;
+
+    struct FSource
+    {
+        FString Kind;
+        FGetStats GetStats;
+        FResetStats ResetStats;
+    };
+
+    mutable FCriticalSection Lock;
+    TMap<FString, FSource> Sources;
+};
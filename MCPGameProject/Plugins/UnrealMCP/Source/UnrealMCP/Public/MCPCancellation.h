@@ -0,0 +1,70 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Cancellation state of a single MCP request
+ *
+ * Created by the connection for requests that carry a "deadline_ms" or may be cancelled with a
+ * "cancel" message, and shared with the game-thread task that runs the command. A request whose
+ * token is cancelled before it starts is dropped without running; a running command can poll
+ * IsCurrentRequestCancelled() in its long loops and return early. Either way the client receives
+ * a "cancelled" error instead of the command's result.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPCancellationToken
+{
+public:
+    /**
+     * @param DeadlineMs Milliseconds from now after which the request counts as cancelled; 0 for none
+     */
+    explicit FMCPCancellationToken(int64 DeadlineMs = 0);
+
+    /** Cancel the request explicitly */
+    void Cancel();
+
+    /** @return true if the request was cancelled or its deadline has passed */
+    bool IsCancelled() const;
+
+    /** @return true if a deadline was set */
+    bool HasDeadline() const { return DeadlineSeconds > 0.0; }
+
+    /** @return Seconds left until the deadline (negative once it passed), or a large value without one */
+    double GetRemainingSeconds() const;
+
+    /** @return Why the request was cancelled, for the error response */
+    FString GetReason() const;
+
+    /** @return Error response sent instead of the command's result: status, error and "cancelled": true */
+    TSharedRef<FJsonObject> MakeErrorResponse() const;
+
+    /**
+     * Check the token of the command currently executing on this thread
+     * @return true if that request was cancelled; false when no request is executing
+     */
+    static bool IsCurrentRequestCancelled();
+
+private:
+    /** Absolute deadline in FPlatformTime::Seconds(), 0 for none */
+    double DeadlineSeconds;
+
+    TAtomic<bool> bCancelled;
+};
+
+typedef TSharedPtr<FMCPCancellationToken, ESPMode::ThreadSafe> FMCPCancellationTokenPtr;
+
+/**
+ * Makes a token the current one for commands executing on this thread while in scope
+ */
+class UNREALMCP_API FMCPCancellationScope
+{
+public:
+    explicit FMCPCancellationScope(const FMCPCancellationTokenPtr& Token);
+    ~FMCPCancellationScope();
+
+private:
+    const FMCPCancellationToken* PreviousToken;
+};
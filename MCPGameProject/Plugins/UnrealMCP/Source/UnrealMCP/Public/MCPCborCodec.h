@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Payload encoding used for messages on an MCP connection
+ */
+enum class EMCPPayloadEncoding : uint8
+{
+    /** UTF-8 JSON text (default, and the only encoding for raw JSON framing) */
+    Json,
+    /** CBOR (RFC 8949) binary document with the same structure as the JSON message */
+    Cbor
+};
+
+/**
+ * Binary codec for the MCP bridge protocol
+ *
+ * Converts between the FJsonObject model used by the commands and CBOR, so a client
+ * that negotiated CBOR in the connection handshake sends numbers as native integers
+ * and doubles instead of decimal text. Numeric-heavy payloads (curve keys, transforms
+ * in batch_spawn_actors, DataTable rows) get smaller and skip text parsing.
+ *
+ * Supported subset: maps with text keys, arrays, text strings, integers, floats
+ * (half, single and double precision on decode, double on encode), booleans and null.
+ * Only definite-length items are accepted, matching what the encoder produces.
+ */
+class UNREALMCP_API FMCPCborCodec
+{
+public:
+    /** Nesting depth beyond which a document is rejected */
+    static constexpr int32 MaxDepth = 128;
+
+    /**
+     * Encode a JSON object as CBOR
+     * @param Object Object to encode
+     * @param OutBytes Receives the CBOR bytes
+     */
+    static void Encode(const TSharedRef<FJsonObject>& Object, TArray<uint8>& OutBytes);
+
+    /**
+     * Decode a CBOR document whose top-level item is a map
+     * @param Data CBOR bytes
+     * @param NumBytes Number of bytes
+     * @param OutError Receives a description on failure
+     * @return Decoded object, or nullptr if the document is malformed or unsupported
+     */
+    static TSharedPtr<FJsonObject> Decode(const uint8* Data, int32 NumBytes, FString& OutError);
+
+    /** @return Wire name of an encoding as used in the handshake ("json", "cbor") */
+    static const TCHAR* GetEncodingName(EMCPPayloadEncoding Encoding);
+
+    /**
+     * Look up an encoding by its wire name
+     * @return true if the name is a supported encoding
+     */
+    static bool ParseEncodingName(const FString& Name, EMCPPayloadEncoding& OutEncoding);
+};
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "MCPTransport.h"
+
+class UUnrealMCPBridge;
+class FRunnableThread;
+class FEvent;
+class FJsonObject;
+struct FMCPConnectionSharedState;
+class FMCPLevelEventSubscription;
+enum class EMCPFrameFormat : uint8;
+enum class EMCPPayloadEncoding : uint8;
+enum class EMCPCommandPriority : uint8;
+
+/**
+ * How a single message is put on the wire
+ */
+struct FMCPWireFormat
+{
+	/** Framing the request arrived in; its response uses the same */
+	EMCPFrameFormat Framing;
+
+	/** Payload encoding; binary encodings are only used with length-prefixed framing */
+	EMCPPayloadEncoding Encoding;
+
+	/** Compress large responses; only used with length-prefixed framing */
+	bool bCompress;
+
+	/** Send attachments as bytes in the response frame; otherwise they are inlined as base64 */
+	bool bAttachments;
+};
+
+/**
+ * Worker serving a single accepted MCP client connection on its own thread
+ *
+ * The connection runs over an IMCPTransport, so TCP and same-host local socket clients
+ * share the same protocol handling.
+ *
+ * Receives and frames requests, parses them, hands execution to the bridge and
+ * serializes/sends the response. Socket I/O and JSON work for different clients
+ * therefore overlap; only the game-thread part, which the bridge's command scheduler
+ * runs, is serialized.
+ *
+ * A connection either follows the legacy single request-response model (close after
+ * the response), or, when the request envelope carries "keep_alive": true, stays open
+ * and serves further requests until the client disconnects or the connection has been
+ * idle for longer than IdleTimeoutSeconds.
+ *
+ * On a keep-alive connection, requests carrying an "id" are pipelined: the client may send
+ * several without waiting, and each response is tagged with its request's id and sent as
+ * soon as that command finishes, so responses can arrive out of order. Requests without an
+ * id keep the strict one-at-a-time behaviour.
+ *
+ * A client may open with {"type": "handshake", "params": {"encodings": ["cbor", "json"]}}
+ * to switch the payloads of later framed messages in both directions to a binary
+ * encoding (see FMCPCborCodec), and with "compression": ["zlib"] to have large responses
+ * sent as compressed frames. Clients that skip the handshake get uncompressed JSON.
+ * "attachments": true has binary results (screenshots) sent as raw bytes after the message in
+ * the same frame instead of as base64 strings (see FMCPAttachments).
+ *
+ * A request may carry "deadline_ms": if it is still queued for the game thread when the deadline
+ * passes it is dropped, and a one-at-a-time request is answered with a "cancelled" error as soon
+ * as it expires. {"type": "cancel", "params": {"id": <id>}} cancels an in-flight pipelined request
+ * the same way; long-running commands see both through FMCPCancellationToken.
+ *
+ * A request may also carry "priority": "interactive" or "bulk" to choose its scheduling class on
+ * the game thread (see FMCPCommandScheduler); the connection id keys per-client fairness.
+ *
+ * A keep-alive client may send {"type": "subscribe", "params": {"topic": "level_actors",
+ * "min_interval_ms": 250}} to have the worker push {"type": "event", ...} messages describing
+ * the actors added, updated and removed in the editor level (see FMCPLevelEvents), at most one
+ * per interval, until it sends "unsubscribe" or disconnects. Events are not tagged with an id and
+ * are not ordered with respect to responses. A subscribed connection is not closed for being idle.
+ */
+class FMCPClientConnection : public FRunnable
+{
+public:
+	/**
+	 * @param InBridge Bridge that executes the commands
+	 * @param InTransport Accepted client transport
+	 * @param InConnectionId Identifier used in logs and per-client bookkeeping
+	 * @param InFinishedEvent Optional event triggered when the worker finishes (not owned)
+	 */
+	FMCPClientConnection(UUnrealMCPBridge* InBridge, FMCPTransportPtr InTransport, uint32 InConnectionId, FEvent* InFinishedEvent = nullptr);
+	virtual ~FMCPClientConnection();
+
+	/**
+	 * Start the worker thread for this connection
+	 * @return true if the thread was created
+	 */
+	bool Start();
+
+	/**
+	 * Request the worker to stop and wait for its thread to finish
+	 */
+	void StopAndWait();
+
+	/** @return true once the worker has finished serving the connection */
+	bool IsFinished() const { return bFinished; }
+
+	/** @return Identifier of this connection, unique for the lifetime of the server */
+	uint32 GetConnectionId() const { return ConnectionId; }
+
+	// FRunnable interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	/** Seconds a keep-alive connection may sit idle between requests before it is closed */
+	static constexpr double IdleTimeoutSeconds = 120.0;
+
+	/** Seconds to wait for the first request on a freshly accepted connection */
+	static constexpr double FirstRequestTimeoutSeconds = 30.0;
+
+	/** Longest single blocking wait on the socket, bounding how long Stop() takes to be noticed */
+	static constexpr double StopCheckIntervalSeconds = 0.25;
+
+	/** Pipelined requests a client may have in flight before the worker stops reading new ones */
+	static constexpr int32 MaxPipelinedRequests = 32;
+
+protected:
+	/**
+	 * Serve requests on a client connection until it closes, errors or times out
+	 * @param InClient Accepted client transport
+	 */
+	void HandleClientConnection(FMCPTransportPtr InClient);
+
+	/**
+	 * Decode a request payload into its envelope object
+	 * @param Payload Request payload bytes
+	 * @param Wire Wire format the request arrived in
+	 * @return Envelope object, or nullptr if the payload is malformed
+	 */
+	TSharedPtr<FJsonObject> DecodeMessage(const TArray<uint8>& Payload, const FMCPWireFormat& Wire) const;
+
+	/**
+	 * Decode and execute a single request message and send the response
+	 * @param Client Transport to send the response on
+	 * @param Payload Request payload bytes
+	 * @param Wire Wire format the request arrived in, used for the response
+	 * @param bOutKeepAlive Set to true when the client asked for the connection to stay open
+	 * @return false on a protocol error that should close the connection
+	 */
+	bool ProcessMessage(FMCPTransportPtr Client, const TArray<uint8>& Payload, const FMCPWireFormat& Wire, bool& bOutKeepAlive);
+
+	/**
+	 * Answer a handshake request and switch the connection to the negotiated encoding
+	 * @param Client Transport to send the response on
+	 * @param Params Handshake parameters ("encodings" / "compression": accepted values, best first;
+	 *        "attachments": whether the client reads attachment frames)
+	 * @param Wire Wire format the handshake arrived in
+	 * @param RequestIdJson Serialized request id, or empty
+	 */
+	void HandleHandshake(FMCPTransportPtr Client, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson);
+
+	/**
+	 * Cancel an in-flight pipelined request of this connection and acknowledge the cancel message
+	 * @param Client Transport to send the acknowledgement on
+	 * @param Params Cancel parameters ("id": id of the request to cancel)
+	 * @param Wire Wire format the cancel message arrived in
+	 * @param RequestIdJson Serialized id of the cancel message itself, or empty
+	 */
+	void HandleCancel(FMCPTransportPtr Client, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson);
+
+	/**
+	 * Start or stop pushing level events to this connection and acknowledge the request
+	 * @param Client Transport to send the acknowledgement on
+	 * @param bSubscribe true for "subscribe", false for "unsubscribe"
+	 * @param Params Subscribe parameters ("topic", "min_interval_ms")
+	 * @param Wire Wire format the request arrived in; events are framed the same way
+	 * @param RequestIdJson Serialized request id, or empty
+	 * @param bKeepAlive Whether the connection stays open; events need a keep-alive connection
+	 */
+	void HandleSubscription(FMCPTransportPtr Client, bool bSubscribe, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson, bool bKeepAlive);
+
+	/**
+	 * Send the level event that is due on a subscribed connection, if any
+	 * @param Client Transport to send the event on
+	 */
+	void SendLevelEvents(const FMCPTransportPtr& Client);
+
+	/** Stop pushing level events to this connection */
+	void Unsubscribe();
+
+	/**
+	 * Wire format for a message sent in the given framing with the options negotiated so far
+	 * @param Framing Framing of the message
+	 */
+	FMCPWireFormat GetWireFormat(EMCPFrameFormat Framing) const;
+
+	/**
+	 * Queue a pipelined request and return without waiting; the response is sent when it completes
+	 * @param Client Transport to send the response on
+	 * @param CommandType Command name
+	 * @param Params Command parameters
+	 * @param Wire Wire format to encode the response in
+	 * @param RequestIdJson Serialized request id the response is tagged with
+	 * @param DeadlineMs Deadline from the request envelope, 0 for none
+	 * @param Priority Scheduling class from the request envelope, if it names one
+	 */
+	void DispatchPipelinedRequest(FMCPTransportPtr Client, const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPWireFormat& Wire, const FString& RequestIdJson, int64 DeadlineMs, TOptional<EMCPCommandPriority> Priority);
+
+	/** Wait for pipelined requests still in flight so their responses reach the client */
+	void WaitForPipelinedRequests();
+
+	/** Cancel every pipelined request that is still in flight */
+	void CancelPipelinedRequests();
+
+	/**
+	 * Send a response fully on the client socket
+	 * @param Client Transport to send on
+	 * @param Response Response text
+	 * @param Wire Wire format to encode the response in
+	 * @return true if all bytes were sent
+	 */
+	bool SendResponse(const FMCPTransportPtr& Client, const FString& Response, const FMCPWireFormat& Wire);
+
+private:
+	UUnrealMCPBridge* Bridge;
+	FMCPTransportPtr Transport;
+	uint32 ConnectionId;
+	FEvent* FinishedEvent;
+	TSharedPtr<FMCPConnectionSharedState, ESPMode::ThreadSafe> SharedState;
+
+	/** Encoding negotiated by the handshake for framed messages; worker thread only */
+	EMCPPayloadEncoding PayloadEncoding;
+
+	/** Whether the handshake enabled response compression; worker thread only */
+	bool bCompressionEnabled;
+
+	/** Whether the handshake enabled attachment frames; worker thread only */
+	bool bAttachmentsEnabled;
+
+	/** Level changes recorded for this connection while it is subscribed; worker thread only */
+	TSharedPtr<FMCPLevelEventSubscription, ESPMode::ThreadSafe> LevelEvents;
+
+	/** Framing of the subscribe request, used for the events; worker thread only */
+	EMCPFrameFormat LevelEventFraming;
+	FRunnableThread* Thread;
+	TAtomic<bool> bRunning;
+	TAtomic<bool> bFinished;
+};
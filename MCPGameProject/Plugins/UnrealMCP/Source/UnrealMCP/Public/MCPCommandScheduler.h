@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Scheduling class of a queued game-thread command
+ */
+enum class EMCPCommandPriority : uint8
+{
+    /** Queries and single edits an agent is waiting on; always run before bulk work */
+    Interactive,
+
+    /** Batch operations and other bulk work */
+    Bulk,
+
+    Num
+};
+
+/**
+ * Runs queued MCP commands on the game thread within a per-frame time budget
+ *
+ * Commands used to be posted to the game thread as independent tasks, so a burst from one client
+ * could run back to back in a single frame and stall the editor. The scheduler drains its queue
+ * from a core ticker instead: each frame it runs commands until the budget (mcp.FrameBudgetMs) is
+ * used up, always at least one so the queue keeps moving. A single command is never interrupted,
+ * so one slow command can still overrun the budget on its own.
+ *
+ * Interactive commands run before bulk ones. Within a priority class the queued clients take turns,
+ * one command each, so a client with a long queue does not hold up the others.
+ *
+ * Enqueue is thread-safe; the work runs on the game thread.
+ */
+class UNREALMCP_API FMCPCommandScheduler
+{
+public:
+    FMCPCommandScheduler();
+    ~FMCPCommandScheduler();
+
+    /** Start draining the queue from the core ticker */
+    void Start();
+
+    /** Stop ticking and run whatever is still queued, so every caller's promise is fulfilled */
+    void Stop();
+
+    /**
+     * Queue work for the game thread
+     * @param ClientId Client the work belongs to, for fairness; 0 for work not tied to a connection
+     * @param Priority Scheduling class
+     * @param Work Work to run on the game thread
+     */
+    void Enqueue(uint32 ClientId, EMCPCommandPriority Priority, TUniqueFunction<void()> Work);
+
+    /** @return Number of queued commands that have not started yet */
+    int32 GetQueuedCount() const;
+
+    /**
+     * Game-thread liveness: the ticker runs every frame, so this grows while the game thread is
+     * stuck in a long compile, a load or a hitch
+     * @return Seconds since the scheduler last ticked, or a negative value if it never has
+     */
+    double GetSecondsSinceLastTick() const;
+
+    /**
+     * Priority a command gets when the request does not ask for one
+     * @param CommandType Command name
+     * @return Bulk for batch_* commands, Interactive otherwise
+     */
+    static EMCPCommandPriority GetDefaultPriority(const FString& CommandType);
+
+    /**
+     * Parse a request's "priority" field
+     * @param Value "interactive" or "bulk"
+     * @param OutPriority Receives the parsed priority
+     * @return false if the value is not a known priority
+     */
+    static bool ParsePriority(const FString& Value, EMCPCommandPriority& OutPriority);
+
+private:
+    /** Queued work of one client within one priority class, oldest first */
+    struct FClientQueue
+    {
+        uint32 ClientId;
+        TArray<TUniqueFunction<void()>> Work;
+    };
+
+    /** Ticker callback; runs queued work until the frame budget is spent */
+    bool Tick(float DeltaTime);
+
+    /**
+     * Take the next work item: highest priority class first, clients of a class in turn
+     * @param OutWork Receives the work
+     * @return false if nothing is queued
+     */
+    bool Dequeue(TUniqueFunction<void()>& OutWork);
+
+    /** Clients with queued work, per priority class, in turn order */
+    TArray<FClientQueue> Queues[(int32)EMCPCommandPriority::Num];
+
+    /** Index of the client whose turn is next, per priority class */
+    int32 NextClientIndex[(int32)EMCPCommandPriority::Num];
+
+    /** Number of queued work items across all classes */
+    int32 QueuedCount;
+
+    mutable FCriticalSection QueueLock;
+
+    /** FPlatformTime::Cycles64() at the start of the last tick; 0 before the first */
+    TAtomic<uint64> LastTickCycles { 0 };
+
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FJsonObject;
+
+/**
+ * Debounced compilation for the compile_* commands
+ *
+ * A compile command called with "deferred": true does not compile; it queues itself under its
+ * command name and asset and answers with a ticket. Further deferred requests for the same asset
+ * return the same ticket until it runs, so an agent that compiles after every edit compiles each
+ * asset once. A queued compile runs, as the original command with "deferred" removed:
+ *
+ * - when the outermost FMCPBatchEditScope closes (end of execute_batch)
+ * - after mcp.CompileIdleSeconds without a new request for the asset and outside a batch
+ * - when a client waits for its ticket (wait_for_compile)
+ *
+ * The ticket's result is the command's normal response. Finished results are kept for the last
+ * MaxFinishedTickets tickets.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FMCPCompileQueue
+{
+public:
+    /** Possible states of a ticket */
+    enum class ETicketState : uint8
+    {
+        Unknown,
+        Pending,
+        Finished
+    };
+
+    /** Finished tickets whose results are kept */
+    static constexpr int32 MaxFinishedTickets = 256;
+
+    static FMCPCompileQueue& Get();
+
+    /**
+     * Queue a compile command if its parameters ask for deferral
+     * @param CommandName Compile command
+     * @param AssetKey Asset the command compiles, as given in its parameters
+     * @param Parameters Command parameters
+     * @param OutResponse Receives {"success": true, "deferred": true, "ticket": N} when queued
+     * @return true if the command was queued and should return OutResponse instead of compiling
+     */
+    bool TryDefer(const FString& CommandName, const FString& AssetKey, const FString& Parameters, FString& OutResponse);
+
+    /**
+     * Run a pending ticket's compile now, if it has not run yet
+     * @param Ticket Ticket from TryDefer
+     * @return State of the ticket afterwards
+     */
+    ETicketState Complete(int64 Ticket);
+
+    /**
+     * Get a ticket's state without compiling
+     * @param Ticket Ticket from TryDefer
+     * @param OutResponse Receives the compile command's response once finished
+     * @return State of the ticket
+     */
+    ETicketState GetState(int64 Ticket, FString& OutResponse) const;
+
+    /** Run every queued compile */
+    void Flush();
+
+    /** @return Number of queued compiles */
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+    /** Drop queued compiles without running them and stop the idle timer */
+    void Shutdown();
+
+private:
+    struct FPendingCompile
+    {
+        int64 Ticket;
+        FString CommandName;
+        TSharedPtr<FJsonObject> Params;
+        double LastRequestTime;
+    };
+
+    /** Idle timer: run queued compiles nobody has asked for again within the idle window */
+    bool Tick(float DeltaTime);
+
+    /** Run one queued compile and record its result */
+    void Run(const FString& Key);
+
+    /** Pending compiles by command name and asset */
+    TMap<FString, FPendingCompile> Pending;
+
+    /** Finished results by ticket, and tickets in the order they finished */
+    TMap<int64, FString> Finished;
+    TArray<int64> FinishedOrder;
+
+    int64 NextTicket = 1;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -5,6 +5,7 @@
 
 // Forward declarations
 class UMCPOperationContext;
+class FJsonObject;
 struct FMCPEnhancedError;
 enum class EMCPErrorSeverity : uint8;
 
@@ -124,6 +125,17 @@ public:
                                                const FString& RequestId = TEXT(""), 
                                                const TMap<FString, FString>& AdditionalContext = TMap<FString, FString>());
 
+    /**
+     * Create a structured error response as a JSON object, for commands that build their result as an object
+     * @param Error The error to format
+     * @param RequestId Optional request ID for tracking
+     * @param AdditionalContext Additional context information
+     * @return Error response object with the same fields as CreateStructuredErrorResponse
+     */
+    static TSharedRef<FJsonObject> CreateStructuredErrorObject(const FMCPError& Error, 
+                                                             const FString& RequestId = TEXT(""), 
+                                                             const TMap<FString, FString>& AdditionalContext = TMap<FString, FString>());
+
     /**
      * Aggregate multiple errors into a single response
      * @param Errors Array of errors to aggregate
@@ -148,8 +160,8 @@ public:
     static void HandleContextErrors(UMCPOperationContext* Context, bool bShouldCrash = false);
 
 private:
-    /** Get the next available error code for a given error type */
-    static int32 GetNextErrorCode(EMCPErrorType ErrorType);
+    /** Get the error code for a given error type (type * 1000 + 1, the same for every error of the type) */
+    static int32 GetErrorCode(EMCPErrorType ErrorType);
 
     /** Convert error type to default severity level */
     static EMCPErrorSeverity GetDefaultSeverityForErrorType(EMCPErrorType ErrorType);
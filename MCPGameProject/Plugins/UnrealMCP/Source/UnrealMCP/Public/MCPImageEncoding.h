@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/** Container format of an encoded screenshot */
+enum class EMCPImageFormat : uint8
+{
+    PNG,
+    JPEG
+};
+
+/**
+ * How a screenshot is cropped, scaled and compressed
+ *
+ * Agents that look at the scene after every edit rarely need a lossless full-resolution image;
+ * a downscaled JPEG of the area they changed is a fraction of the bytes and encodes many times
+ * faster. The crop is applied first, in source pixels, then the scale.
+ */
+struct UNREALMCP_API FMCPImageEncodeOptions
+{
+    EMCPImageFormat Format = EMCPImageFormat::PNG;
+
+    /** JPEG quality, 1-100; ignored for PNG */
+    int32 Quality = 85;
+
+    /** Output size as a fraction of the (cropped) source, in (0, 1] */
+    float Scale = 1.0f;
+
+    /** Source pixels to keep; empty keeps the whole image */
+    FIntRect Region;
+
+    /**
+     * Read format, quality, scale and region from command parameters
+     * Accepts format "png", "jpg" or "jpeg", quality 1-100, scale in (0, 1] and region as
+     * [x, y, width, height]. Absent fields keep their current values.
+     * @param Params Command parameters
+     * @param OutOptions Options to update
+     * @param OutError Error message if a field is invalid
+     * @return true if every present field was valid
+     */
+    static bool FromJson(const TSharedPtr<FJsonObject>& Params, FMCPImageEncodeOptions& OutOptions, FString& OutError);
+
+    /** File extension for the format, without the dot; also its name in responses */
+    const TCHAR* GetExtension() const;
+};
+
+/**
+ * Crop, resize and compression helpers shared by the screenshot commands; any thread
+ */
+class UNREALMCP_API FMCPImageEncoding
+{
+public:
+    /**
+     * Clip a requested region to an image
+     * @param Region Requested region; empty selects the whole image
+     * @param ImageSize Size of the image
+     * @param OutRegion The part of the image to keep
+     * @param OutError Error message if the region lies outside the image
+     * @return true if the clipped region is not empty
+     */
+    static bool ResolveRegion(const FIntRect& Region, const FIntPoint& ImageSize, FIntRect& OutRegion, FString& OutError);
+
+    /** Size of a source of the given size after scaling, at least one pixel per side */
+    static FIntPoint GetScaledSize(const FIntPoint& SourceSize, float Scale);
+
+    /**
+     * Copy out part of an image
+     * @param Pixels Image pixels, row by row; replaced by the cropped pixels
+     * @param Size Image size; replaced by the region size
+     * @param Region Region inside the image
+     */
+    static void Crop(TArray<FColor>& Pixels, FIntPoint& Size, const FIntRect& Region);
+
+    /**
+     * Resample an image to a new size
+     * @param Pixels Image pixels, row by row; replaced by the resized pixels
+     * @param Size Image size; replaced by NewSize
+     * @param NewSize Target size
+     */
+    static void Resize(TArray<FColor>& Pixels, FIntPoint& Size, const FIntPoint& NewSize);
+
+    /**
+     * Compress an image; alpha is forced opaque
+     * @param Pixels Image pixels, row by row
+     * @param Size Image size
+     * @param Options Format and quality
+     * @param OutData Compressed bytes
+     * @param OutError Error message if compression failed
+     * @return true if the image was compressed
+     */
+    static bool Encode(TArray<FColor>& Pixels, const FIntPoint& Size, const FMCPImageEncodeOptions& Options, TArray64<uint8>& OutData, FString& OutError);
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class FJsonObject;
+
+/**
+ * One subscriber's coalesced view of what changed in the editor level since its last event
+ *
+ * FMCPLevelEvents records changes into every subscription on the game thread as they happen;
+ * the connection that owns the subscription takes them as one event message at most once per
+ * MinIntervalSeconds. Several changes of one actor between two events collapse into one entry:
+ * an update after an add is still an add (with the new state), a remove after an add drops the
+ * actor altogether, and only the last transform of a drag is kept.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPLevelEventSubscription
+{
+public:
+    explicit FMCPLevelEventSubscription(double InMinIntervalSeconds);
+
+    /** @return Shortest time between two events of this subscription */
+    double GetMinIntervalSeconds() const { return MinIntervalSeconds; }
+
+    /**
+     * Take the changes recorded since the last event, if there are any and the interval has passed
+     * @param Now Current FPlatformTime::Seconds()
+     * @return Event message, or nullptr if nothing is due
+     */
+    TSharedPtr<FJsonObject> TakeEvent(double Now);
+
+    /** Changes an actor can go through between two events */
+    enum class EChangeKind : uint8
+    {
+        Added,
+        Updated,
+        Removed
+    };
+
+    /** Latest known state of a changed actor */
+    struct FActorChange
+    {
+        EChangeKind Kind = EChangeKind::Updated;
+        FString Label;
+        FString ClassName;
+        FTransform Transform;
+    };
+
+    /** Pending changes above which an event only asks the client to resync */
+    static constexpr int32 MaxPendingChanges = 10000;
+
+private:
+    friend class FMCPLevelEvents;
+
+    /** Merge a change into the pending set; called with Lock held */
+    void AddChange(const FString& ActorName, const FActorChange& Change);
+
+    /** Drop the pending changes and ask the client to re-read the level; called with Lock held */
+    void RequestResync();
+
+    const double MinIntervalSeconds;
+
+    FCriticalSection Lock;
+    TMap<FString, FActorChange> PendingChanges;
+    bool bResyncPending = false;
+    int64 NextSequence = 1;
+    double LastEventTime = 0.0;
+};
+
+using FMCPLevelEventSubscriptionPtr = TSharedPtr<FMCPLevelEventSubscription, ESPMode::ThreadSafe>;
+
+/**
+ * Follows actor additions, deletions, moves and relabels in the editor world for clients that
+ * subscribed to them, so they can keep a mirror of the level instead of polling get_level_metadata
+ *
+ * Only the editor world is followed; PIE worlds and transient actors are not reported. Changes
+ * the engine makes without these notifications (undo/redo, a map change, level streaming) can't
+ * be described actor by actor, so they turn into a "resync" event telling the client to re-read
+ * the level.
+ *
+ * Subscribe and Unsubscribe may be called from any thread; Initialize and Shutdown from the
+ * game thread.
+ */
+class UNREALMCP_API FMCPLevelEvents
+{
+public:
+    static FMCPLevelEvents& Get();
+
+    /** Start following editor actor changes */
+    void Initialize();
+
+    /** Stop following changes and drop every subscription */
+    void Shutdown();
+
+    /**
+     * Start recording changes for a client
+     * @param MinIntervalSeconds Shortest time between two of the client's events
+     * @return The subscription to take events from
+     */
+    FMCPLevelEventSubscriptionPtr Subscribe(double MinIntervalSeconds);
+
+    /** Stop recording changes for a subscription */
+    void Unsubscribe(const FMCPLevelEventSubscriptionPtr& Subscription);
+
+    /** Default and allowed range of the time between two events, in milliseconds */
+    static constexpr double DefaultMinIntervalMs = 250.0;
+    static constexpr double MinAllowedIntervalMs = 50.0;
+    static constexpr double MaxAllowedIntervalMs = 60000.0;
+
+private:
+    FMCPLevelEvents() = default;
+
+    /** @return true if the actor lives in the editor world and is worth reporting */
+    static bool IsReportedActor(const AActor* Actor);
+
+    /** Record a change of an actor into every subscription */
+    void RecordChange(AActor* Actor, FMCPLevelEventSubscription::EChangeKind Kind);
+
+    /** Ask every subscription to resync */
+    void RequestResync();
+
+    void HandleActorAdded(AActor* Actor);
+    void HandleActorDeleted(AActor* Actor);
+    void HandleActorMoved(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleUndoRedo();
+    void HandleMapChange(uint32 MapChangeFlags);
+
+    FCriticalSection SubscriptionsLock;
+    TArray<FMCPLevelEventSubscriptionPtr> Subscriptions;
+
+    /** Lets the notification handlers skip the lock while nobody is subscribed */
+    TAtomic<int32> SubscriptionCount { 0 };
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle MapChangeHandle;
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPTransport.h"
+
+/**
+ * Same-host transport over a Unix domain socket (AF_UNIX)
+ *
+ * Clients on the editor's machine skip the TCP loopback stack, and closing needs no
+ * linger/RST workaround. The TCP listener keeps serving remote clients.
+ *
+ * Windows is not supported: this transport is compiled out there and every client uses TCP.
+ */
+class UNREALMCP_API FMCPLocalTransport : public IMCPTransport
+{
+public:
+    /** Native socket handle */
+    typedef UPTRINT FNativeHandle;
+
+    explicit FMCPLocalTransport(FNativeHandle InHandle);
+    virtual ~FMCPLocalTransport();
+
+    // IMCPTransport interface
+    virtual void Configure() override;
+    virtual bool WaitForRead(const FTimespan& WaitTime) override;
+    virtual bool WaitForWrite(const FTimespan& WaitTime) override;
+    virtual EMCPIoResult Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) override;
+    virtual EMCPIoResult Send(const uint8* Data, int32 Count, int32& OutBytesSent) override;
+    virtual bool IsConnectionLost() override;
+    virtual void CloseGracefully() override;
+    virtual void Close() override;
+    virtual FString GetLastErrorDescription() const override;
+    virtual FString GetPeerDescription() const override;
+
+private:
+    /** Map the last native error to a result, remembering real errors */
+    EMCPIoResult TranslateLastError();
+
+    FNativeHandle Handle;
+    int32 LastError;
+    bool bConnectionLost;
+};
+
+/**
+ * Accepts same-host clients on a Unix domain socket path; not supported on Windows
+ */
+class UNREALMCP_API FMCPLocalListener : public IMCPListener
+{
+public:
+    virtual ~FMCPLocalListener();
+
+    /**
+     * Create the socket file and start listening
+     * @param Path Socket path; a stale file from a previous editor session is replaced
+     * @param Backlog Listen backlog
+     * @return Listener, or nullptr if the platform lacks AF_UNIX support or binding failed
+     */
+    static TSharedPtr<FMCPLocalListener> Create(const FString& Path, int32 Backlog);
+
+    /**
+     * Default socket path: UNREAL_MCP_SOCKET_PATH if set, otherwise unreal-mcp-<port>.sock in the
+     * user temp directory (kept short because socket paths are limited to ~100 characters)
+     */
+    static FString GetDefaultPath(uint16 Port);
+
+    // IMCPListener interface
+    virtual FMCPTransportPtr WaitAndAccept(const FTimespan& WaitTime) override;
+    virtual FString GetDescription() const override;
+
+private:
+    FMCPLocalListener(FMCPLocalTransport::FNativeHandle InHandle, const FString& InPath);
+
+    FMCPLocalTransport::FNativeHandle Handle;
+    FString Path;
+};
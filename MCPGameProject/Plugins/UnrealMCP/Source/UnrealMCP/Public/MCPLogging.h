@@ -3,15 +3,24 @@
 #include "CoreMinimal.h"
 #include "Logging/LogMacros.h"
 #include "Misc/DateTime.h"
+#include "HAL/PlatformTime.h"
 #include "HAL/PlatformFilemanager.h"
 
 // Forward declarations
 class UMCPOperationContext;
 
 /**
- * Declare the main UnrealMCP log category with all verbosity levels
+ * Most verbose UnrealMCP messages compiled in; anything more verbose is stripped at compile time.
+ * Override from the build (e.g. PublicDefinitions.Add("UNREALMCP_COMPILED_LOG_VERBOSITY=Log"))
  */
-DECLARE_LOG_CATEGORY_EXTERN(LogUnrealMCP, Log, All);
+#ifndef UNREALMCP_COMPILED_LOG_VERBOSITY
+#define UNREALMCP_COMPILED_LOG_VERBOSITY All
+#endif
+
+/**
+ * Declare the main UnrealMCP log category
+ */
+DECLARE_LOG_CATEGORY_EXTERN(LogUnrealMCP, Log, UNREALMCP_COMPILED_LOG_VERBOSITY);
 
 /**
  * Declare specialized log categories for different MCP subsystems
@@ -37,51 +46,79 @@ enum class EMCPLogOperationType : uint8
 };
 
 /**
- * Structure for operation timing and performance logging
+ * Timing and metadata of one operation
+ *
+ * Cheap enough to leave enabled in production: times come from the cycle counter instead of the
+ * wall clock, metadata goes into a fixed number of inline slots under literal keys with numbers
+ * kept unformatted, and nothing is formatted until ToString(), i.e. only when a line is written.
  */
 struct UNREALMCP_API FMCPPerformanceLog
 {
+    /** Metadata slots; entries added once they are full are counted but not kept */
+    static constexpr int32 MaxMetadata = 8;
+
     FString OperationName;
     FString OperationId;
-    FDateTime StartTime;
-    FDateTime EndTime;
-    float Duration;
-    TMap<FString, FString> Metadata;
-    
+    uint64 StartCycles;
+    /** 0 until Complete() */
+    uint64 EndCycles;
+
     FMCPPerformanceLog()
-        : OperationName(TEXT(""))
-        , OperationId(TEXT(""))
-        , StartTime(FDateTime::Now())
-        , EndTime(FDateTime::MinValue())
-        , Duration(0.0f)
+        : StartCycles(FPlatformTime::Cycles64())
+        , EndCycles(0)
     {
     }
-    
-    FMCPPerformanceLog(const FString& InOperationName, const FString& InOperationId = TEXT(""))
+
+    explicit FMCPPerformanceLog(const FString& InOperationName, const FString& InOperationId = FString())
         : OperationName(InOperationName)
         , OperationId(InOperationId)
-        , StartTime(FDateTime::Now())
-        , EndTime(FDateTime::MinValue())
-        , Duration(0.0f)
+        , StartCycles(FPlatformTime::Cycles64())
+        , EndCycles(0)
     {
     }
-    
+
     void Complete()
     {
-        EndTime = FDateTime::Now();
-        Duration = (EndTime - StartTime).GetTotalSeconds();
+        EndCycles = FPlatformTime::Cycles64();
     }
-    
-    void AddMetadata(const FString& Key, const FString& Value)
+
+    bool IsComplete() const
     {
-        Metadata.Add(Key, Value);
+        return EndCycles != 0;
     }
-    
-    FString ToString() const
+
+    /** Seconds from construction to Complete(), or to now while the operation still runs */
+    double GetDurationSeconds() const
+    {
+        return FPlatformTime::ToSeconds64((EndCycles != 0 ? EndCycles : FPlatformTime::Cycles64()) - StartCycles);
+    }
+
+    /**
+     * @param Key - Must outlive the log, e.g. a TEXT() literal
+     */
+    void AddMetadata(const TCHAR* Key, const FString& Value);
+    void AddMetadata(const TCHAR* Key, double Value);
+
+    /** Metadata entries that did not fit into MaxMetadata slots */
+    int32 GetDroppedMetadataCount() const
     {
-        return FString::Printf(TEXT("Operation: %s [%s] Duration: %.3fs"), 
-                              *OperationName, *OperationId, Duration);
+        return DroppedMetadataCount;
     }
+
+    /** "Operation: Name [Id] Duration: 0.012s (key=value, ...)" */
+    FString ToString() const;
+
+private:
+    struct FMetadataEntry
+    {
+        const TCHAR* Key = nullptr;
+        FString Text;
+        double Number = 0.0;
+        bool bIsNumber = false;
+    };
+
+    TArray<FMetadataEntry, TInlineAllocator<MaxMetadata>> Metadata;
+    int32 DroppedMetadataCount = 0;
 };
 
 /**
@@ -272,14 +309,38 @@ private:
     static FString GetLogFilePath(const FString& Category);
 };
 
+/**
+ * Bounded logging of request and response payloads
+ *
+ * Responses can be megabytes; logging them whole costs more than executing most commands.
+ * Payloads are cut to mcp.LogPayloadMaxChars characters and only every mcp.LogPayloadSampleRate-th
+ * payload is logged, so the cost of payload logging no longer grows with response size.
+ */
+struct UNREALMCP_API FMCPLogPayload
+{
+    /**
+     * Cut a payload for logging
+     * @param Payload Full payload text
+     * @return At most mcp.LogPayloadMaxChars characters of the payload, noting the full length when cut
+     */
+    static FString Truncate(const FString& Payload);
+
+    /**
+     * Advance the payload sample counter
+     * @return true if this payload should be logged, per mcp.LogPayloadSampleRate
+     */
+    static bool ShouldSample();
+};
+
 /**
  * RAII class for automatic operation timing and logging
+ * Writes one line to LogMCPPerformance at Verbose when it goes out of scope; formats nothing when
+ * that verbosity is off
  */
 class UNREALMCP_API FMCPScopedOperationLogger
 {
 public:
-    FMCPScopedOperationLogger(const FString& OperationName, const FString& OperationId = TEXT(""),
-                             const TMap<FString, FString>& Parameters = TMap<FString, FString>());
+    FMCPScopedOperationLogger(const FString& OperationName, const FString& OperationId = FString());
     
     ~FMCPScopedOperationLogger();
 
@@ -289,8 +350,9 @@ public:
     /** Add result summary */
     void SetResultSummary(const FString& Summary);
 
-    /** Add metadata to the operation log */
-    void AddMetadata(const FString& Key, const FString& Value);
+    /** Add metadata to the operation log; Key must outlive the logger, e.g. a TEXT() literal */
+    void AddMetadata(const TCHAR* Key, const FString& Value);
+    void AddMetadata(const TCHAR* Key, double Value);
 
 private:
     FMCPPerformanceLog PerformanceLog;
@@ -384,6 +446,15 @@ private:
 #define UE_LOG_MCP_OPERATION_VERBOSE(Format, ...) \
     UE_LOG(LogMCPOperations, Verbose, TEXT("[OP] ") Format, ##__VA_ARGS__)
 
+// Payload logging macro; pass payloads through FMCPLogPayload::Truncate. Arguments are only
+// evaluated when the verbosity is enabled and the payload is sampled
+#define UE_LOG_MCP_PAYLOAD(Verbosity, Format, ...) \
+    do { \
+        if (UE_LOG_ACTIVE(LogUnrealMCP, Verbosity) && FMCPLogPayload::ShouldSample()) { \
+            UE_LOG(LogUnrealMCP, Verbosity, TEXT("[MCP] ") Format, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
 // Structured logging macros with context
 #define UE_LOG_MCP_STRUCTURED(Category, Verbosity, OperationType, OperationId, Message, Details, Context) \
     FMCPLogger::LogStructured(Category, ELogVerbosity::Verbosity, OperationType, OperationId, Message, Details, Context)
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Low Level Memory tracker tags of the MCP server
+ *
+ * Allocations made in a scope of one of these tags are reported under UnrealMCP in LLM's stats,
+ * memreport and Memory Insights, split into:
+ * - Transport: everything the connection threads allocate, i.e. framing and socket buffers
+ * - Json: request parsing and response serialization
+ * - Caches: the response cache and the search indexes and palettes
+ * - ObjectPools: objects created by TObjectPool
+ * - Commands: whatever a command allocates while it runs, unless the engine tags it otherwise
+ *
+ * Record with -llm (and -trace=memory,cpu,bookmark,unrealmcp to see allocations per request in
+ * Insights). Everything compiles away in builds without LLM.
+ */
+LLM_DECLARE_TAG_API(UnrealMCP, UNREALMCP_API);
+LLM_DECLARE_TAG_API(UnrealMCP_Transport, UNREALMCP_API);
+LLM_DECLARE_TAG_API(UnrealMCP_Json, UNREALMCP_API);
+LLM_DECLARE_TAG_API(UnrealMCP_Caches, UNREALMCP_API);
+LLM_DECLARE_TAG_API(UnrealMCP_ObjectPools, UNREALMCP_API);
+LLM_DECLARE_TAG_API(UnrealMCP_Commands, UNREALMCP_API);
+
+namespace MCPMemory
+{
+    /**
+     * Bytes currently tracked under each UnrealMCP tag, as of LLM's last per-frame update
+     * @return false if LLM is not enabled
+     */
+    UNREALMCP_API bool GetTagAmounts(TArray<TPair<FString, int64>>& OutAmounts);
+}
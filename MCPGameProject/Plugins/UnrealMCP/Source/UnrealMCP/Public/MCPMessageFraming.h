@@ -0,0 +1,178 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Wire format detected for a message on an MCP connection
+ */
+enum class EMCPFrameFormat : uint8
+{
+    /** Not yet known - no bytes of the next message have arrived */
+    Unknown,
+    /** 4-byte big-endian payload length followed by the UTF-8 JSON payload */
+    LengthPrefixed,
+    /** Bare JSON document (legacy clients), delimited by matching the outer braces */
+    RawJson
+};
+
+/**
+ * Result of trying to pull one message out of the receive buffer
+ */
+enum class EMCPFrameResult : uint8
+{
+    /** A complete message was extracted */
+    Complete,
+    /** More bytes are required before a message is complete */
+    NeedMoreData,
+    /** The stream is malformed or a frame exceeds the size limit - the connection should be closed */
+    Error
+};
+
+/**
+ * Incremental message framer for the MCP bridge protocol
+ *
+ * Bytes are appended as they arrive from the socket into a growable buffer, and complete
+ * messages are extracted in one pass regardless of how the stream was fragmented, so
+ * multi-megabyte batch payloads parse exactly like small ones.
+ *
+ * Two formats are accepted and detected per message from its first byte:
+ * - Length-prefixed: [uint32 big-endian length][length bytes of UTF-8 JSON]
+ * - Raw JSON (legacy): a bare JSON object; its end is found by brace matching that
+ *   skips string literals and escapes
+ *
+ * A length prefix whose first byte is '{' would announce a payload of at least 1.9 GB,
+ * which is rejected by MaxFrameSize, so a '{' always starts a raw JSON message. Whitespace is
+ * not as clear: a header starting with 0x09, 0x0A or 0x0D announces a legal payload of 151 to
+ * 218 MB. Whitespace between messages is therefore only skipped once a raw JSON message has
+ * been seen on the connection; until then every byte that is not '{' starts a length header.
+ *
+ * The top bit of the length (CompressedFlag) marks a compressed frame, whose payload is
+ * [uint32 big-endian uncompressed size][zlib stream]; such frames are inflated here, so
+ * callers always see the original payload.
+ *
+ * The next bit (AttachmentsFlag) marks a response frame that carries binary attachments
+ * (see FMCPAttachments). Its body is [uint32 big-endian message size][message payload] followed,
+ * for each attachment, by [uint8 id length][id][uint32 big-endian data size][data]. Only the
+ * server sends these, to clients that asked for them in the handshake; they are never compressed.
+ *
+ * Not thread-safe; each connection owns its own framer.
+ */
+class UNREALMCP_API FMCPMessageFramer
+{
+public:
+    /** Hard upper bound for the payload of a single message */
+    static constexpr uint32 MaxFrameSize = 256u * 1024u * 1024u;
+
+    /** Size of the length header in bytes */
+    static constexpr int32 HeaderSize = 4;
+
+    /** Set in the length header of a frame whose payload is compressed */
+    static constexpr uint32 CompressedFlag = 0x80000000u;
+
+    /** Set in the length header of a response frame whose body carries attachments */
+    static constexpr uint32 AttachmentsFlag = 0x40000000u;
+
+    /** Payloads smaller than this are sent uncompressed even when compression was negotiated */
+    static constexpr int32 CompressionThreshold = 16 * 1024;
+
+    FMCPMessageFramer();
+
+    /**
+     * Append received bytes to the buffer
+     * @param Data Received bytes
+     * @param NumBytes Number of bytes
+     */
+    void Append(const uint8* Data, int32 NumBytes);
+
+    /**
+     * Try to extract the next complete message
+     * @param OutPayload Receives the UTF-8 payload bytes (without header) on success
+     * @param OutFormat Receives the format the message was sent in
+     * @param OutError Receives a description when the result is Error
+     * @return Complete, NeedMoreData or Error
+     */
+    EMCPFrameResult TryExtractMessage(TArray<uint8>& OutPayload, EMCPFrameFormat& OutFormat, FString& OutError);
+
+    /** @return Number of buffered bytes that have not been consumed yet */
+    int32 GetBufferedBytes() const { return Buffer.Num() - ReadOffset; }
+
+    /** Drop all buffered data and reset the scanner state */
+    void Reset();
+
+    /**
+     * Encode a payload for sending in the given format
+     * @param Payload UTF-8 payload bytes
+     * @param PayloadSize Number of payload bytes
+     * @param Format LengthPrefixed prepends the header, RawJson sends the payload as-is
+     * @param OutBytes Receives the bytes to send
+     */
+    static void EncodeMessage(const uint8* Payload, int32 PayloadSize, EMCPFrameFormat Format, TArray<uint8>& OutBytes);
+
+    /**
+     * Compress a payload into the body of a compressed frame
+     * @param Payload Payload bytes
+     * @param PayloadSize Number of payload bytes
+     * @param OutBody Receives [uint32 big-endian PayloadSize][zlib stream]
+     * @return true if compression succeeded and the body is smaller than the payload
+     */
+    static bool CompressPayload(const uint8* Payload, int32 PayloadSize, TArray<uint8>& OutBody);
+
+    /**
+     * Write a length header
+     * @param PayloadSize Size of the frame body
+     * @param bCompressed Whether the body is a compressed frame body
+     * @param OutHeader Receives the header bytes
+     */
+    static void WriteHeader(uint32 PayloadSize, bool bCompressed, uint8 (&OutHeader)[HeaderSize]);
+
+    /**
+     * Write a length header with flag bits
+     * @param PayloadSize Size of the frame body
+     * @param Flags CompressedFlag and/or AttachmentsFlag
+     * @param OutHeader Receives the header bytes
+     */
+    static void WriteHeaderWithFlags(uint32 PayloadSize, uint32 Flags, uint8 (&OutHeader)[HeaderSize]);
+
+    /**
+     * Decode a UTF-8 payload into an FString without requiring null termination
+     * @param Payload UTF-8 payload bytes
+     * @return Decoded string
+     */
+    static FString PayloadToString(const TArray<uint8>& Payload);
+
+    /**
+     * View a UTF-8 payload in place, for parsers that read UTF-8 directly
+     * @param Payload UTF-8 payload bytes; must outlive the view
+     * @return View of the payload bytes
+     */
+    static FUtf8StringView PayloadToView(const TArray<uint8>& Payload);
+
+private:
+    /** Consume whitespace between raw JSON messages */
+    void SkipWhitespace();
+
+    /** Extract a length-prefixed message starting at ReadOffset */
+    EMCPFrameResult ExtractLengthPrefixed(TArray<uint8>& OutPayload, FString& OutError);
+
+    /** Extract a raw JSON message starting at ReadOffset, resuming the brace scan where it stopped */
+    EMCPFrameResult ExtractRawJson(TArray<uint8>& OutPayload, FString& OutError);
+
+    /** Inflate a compressed frame body of NumBytes at ReadOffset into OutPayload and consume it */
+    bool DecompressInto(int32 NumBytes, TArray<uint8>& OutPayload, FString& OutError);
+
+    /** Copy bytes [ReadOffset, ReadOffset + NumBytes) to OutPayload and consume them */
+    void ConsumeInto(int32 NumBytes, TArray<uint8>& OutPayload);
+
+    /** Receive buffer; bytes before ReadOffset have already been consumed */
+    TArray<uint8> Buffer;
+    int32 ReadOffset;
+
+    /** Incremental raw JSON scanner state, relative to ReadOffset */
+    int32 ScanOffset;
+    int32 BraceDepth;
+    bool bInString;
+    bool bEscaped;
+
+    /** Whether a raw JSON message has been extracted, after which whitespace separates messages */
+    bool bSeenRawJson;
+};
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+class FJsonObject;
+class IHttpRouter;
+struct FHttpRouteHandleInternal;
+
+/**
+ * Per-command latency histograms and counters of the MCP server
+ *
+ * Connections and the bridge used to time parsing, execution and sending, but only logged the
+ * durations. Every request now also records, under its command name, how long it waited for its
+ * turn on the game thread (or a worker), how long the command ran, how long its response took to
+ * serialize and how long it took to send, plus counters for requests, error responses, response
+ * cache hits, failed sends and bytes received and sent.
+ *
+ * With mcp.MemoryAccounting on, the process's physical memory use is also sampled around every
+ * command. Growth is attributed to the command it happened in, so commands that leave memory
+ * behind stand out over a long session. Other threads' allocations can land in the same window,
+ * so only sums over many requests are meaningful. Snapshots also carry the bytes LLM tracks under
+ * the UnrealMCP tags when it is enabled (see MCPMemory.h).
+ *
+ * Durations go into log-linear histograms with 16 buckets per power of two of microseconds, so any
+ * percentile is reported within about 6% of the true value at a fixed cost per command. The
+ * get_mcp_metrics command reads them as JSON or Prometheus text; when mcp.MetricsPort is set at
+ * startup the Prometheus text is also served over HTTP at /metrics on that port.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPMetrics
+{
+public:
+    /** Part of a request a duration was measured for */
+    enum class EStage : uint8
+    {
+        /** From dispatch until the command started running */
+        QueueWait,
+        /** Running the command */
+        Execute,
+        /** Serializing the response */
+        Serialize,
+        /** Encoding and sending the response on the connection */
+        Send,
+        Num
+    };
+
+    /** Log-linear histogram of durations */
+    class UNREALMCP_API FLatencyHistogram
+    {
+    public:
+        void Record(double Seconds);
+
+        uint64 GetCount() const { return Count; }
+        double GetSumSeconds() const { return SumSeconds; }
+        double GetMaxSeconds() const { return MaxSeconds; }
+
+        /**
+         * @param Fraction - Percentile as a fraction, e.g. 0.99
+         * @return Upper bound of the bucket holding that percentile, in seconds; 0 if empty
+         */
+        double GetPercentileSeconds(double Fraction) const;
+
+        /** Bucket of a duration in microseconds */
+        static int32 GetBucketIndex(uint64 Microseconds);
+
+        /** Largest duration in microseconds that falls into a bucket */
+        static uint64 GetBucketUpperBound(int32 BucketIndex);
+
+        static constexpr int32 SubBucketBits = 4;
+        static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+        /** Durations up to 2^40 us (about 12 days) are told apart; longer ones share the last bucket */
+        static constexpr int32 MaxMagnitudeBits = 40;
+        static constexpr int32 BucketCount = SubBucketCount * (MaxMagnitudeBits - SubBucketBits + 2);
+
+    private:
+        /** Allocated on first use, since most commands never record most stages */
+        TArray<uint32> Buckets;
+        uint64 Count = 0;
+        double SumSeconds = 0.0;
+        double MaxSeconds = 0.0;
+    };
+
+    static FMCPMetrics& Get();
+
+    /** Serve the Prometheus text over HTTP if mcp.MetricsPort is set */
+    void Initialize();
+
+    /** Stop serving the Prometheus text */
+    void Shutdown();
+
+    /** A request for a command was received */
+    void RecordRequest(const FString& CommandType, int64 BytesReceived);
+
+    /**
+     * A command ran and its response was serialized
+     * @param QueueWaitSeconds - Time from dispatch until it started running
+     * @param ExecuteSeconds - Time it ran
+     * @param SerializeSeconds - Time its response took to serialize
+     * @param bError - Whether the response is an error
+     */
+    void RecordExecution(const FString& CommandType, double QueueWaitSeconds, double ExecuteSeconds, double SerializeSeconds, bool bError);
+
+    /**
+     * Physical memory in use, for RecordMemory
+     * @return -1 if mcp.MemoryAccounting is off
+     */
+    static int64 SampleUsedMemory();
+
+    /**
+     * Memory in use before and after a command ran, from SampleUsedMemory
+     * Ignored if either sample is -1
+     */
+    void RecordMemory(const FString& CommandType, int64 UsedBefore, int64 UsedAfter);
+
+    /** A request was answered from the response cache without running its command */
+    void RecordCacheHit(const FString& CommandType);
+
+    /** The response to a command was sent, or failed to send */
+    void RecordSend(const FString& CommandType, double SendSeconds, int64 BytesSent, bool bSucceeded);
+
+    /**
+     * Snapshot of everything recorded
+     * @param CommandFilter - Only this command if not empty
+     * @return {"uptime_seconds", "memory": {...}, "commands": [{"command", "requests", ..., "stages": {...}, "memory": {...}}]},
+     *         busiest command first
+     */
+    TSharedRef<FJsonObject> MakeSnapshot(const FString& CommandFilter = FString()) const;
+
+    /** Everything recorded in the Prometheus text exposition format */
+    FString MakePrometheusText() const;
+
+    /** Drop everything recorded so far */
+    void Reset();
+
+    /** Section name of a stage in snapshots and labels, e.g. "queue_wait" */
+    static const TCHAR* GetStageName(EStage Stage);
+
+private:
+    FMCPMetrics();
+
+    struct FCommandMetrics
+    {
+        FLatencyHistogram Stages[static_cast<int32>(EStage::Num)];
+        uint64 Requests = 0;
+        uint64 Errors = 0;
+        uint64 CacheHits = 0;
+        uint64 SendFailures = 0;
+        uint64 BytesReceived = 0;
+        uint64 BytesSent = 0;
+        /** Sum of all memory deltas, negative if the command freed more than it kept */
+        int64 MemoryNetBytes = 0;
+        /** Sum and count of the deltas that grew memory, and the largest one */
+        uint64 MemoryGrowthBytes = 0;
+        uint64 MemoryGrowths = 0;
+        uint64 MaxMemoryGrowthBytes = 0;
+    };
+
+    /** Metrics of a command, added on first use; lock must be held */
+    FCommandMetrics& FindOrAddCommand(const FString& CommandType);
+
+    mutable FCriticalSection Lock;
+    TMap<FString, TUniquePtr<FCommandMetrics>> Commands;
+    double StartTime;
+
+    TSharedPtr<IHttpRouter> HttpRouter;
+    TSharedPtr<FHttpRouteHandleInternal> MetricsRouteHandle;
+};
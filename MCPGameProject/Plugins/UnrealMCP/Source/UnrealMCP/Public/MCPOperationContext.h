@@ -90,6 +90,100 @@ struct UNREALMCP_API FMCPEnhancedError
 
 /**
  * Operation context for tracking MCP operations and aggregating errors
+ *
+ * Plain struct, so per-operation contexts (one per batch result) can live inline in their owner
+ * instead of being separate UObjects for the garbage collector to track and collect.
+ * UMCPOperationContext wraps one for Blueprint callers.
+ */
+USTRUCT(BlueprintType)
+struct UNREALMCP_API FMCPOperationContext
+{
+    GENERATED_BODY()
+
+    /** Name of the operation being tracked */
+    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
+    FString OperationName;
+
+    /** Unique identifier for this operation */
+    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
+    FString OperationId;
+
+    /** Timestamp when the operation started */
+    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
+    FDateTime StartTime;
+
+    /** Timestamp when the operation completed */
+    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
+    FDateTime EndTime;
+
+    /** Whether the operation has been completed */
+    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
+    bool bOperationCompleted;
+
+    /** Collection of all errors encountered during the operation */
+    UPROPERTY(BlueprintReadOnly, Category = "Errors")
+    TArray<FMCPEnhancedError> Errors;
+
+    /** Context information that applies to the entire operation */
+    UPROPERTY(BlueprintReadOnly, Category = "Context")
+    TMap<FString, FString> OperationContext;
+
+    FMCPOperationContext();
+
+    /** Initialize the operation context with operation details */
+    void Initialize(const FString& InOperationName, const FString& InOperationId = TEXT(""));
+
+    /** Add an error to the operation context */
+    void AddError(const FMCPError& Error, EMCPErrorSeverity Severity = EMCPErrorSeverity::Error, const FString& SourceLocation = TEXT(""));
+
+    /** Add an enhanced error to the operation context */
+    void AddEnhancedError(const FMCPEnhancedError& Error);
+
+    /** Add a warning to the operation context */
+    void AddWarning(const FString& Warning, const FString& Details = TEXT(""), const FString& SourceLocation = TEXT(""));
+
+    /** Add informational message to the operation context */
+    void AddInfo(const FString& Info, const FString& Details = TEXT(""));
+
+    /** Add context information that applies to the entire operation */
+    void AddOperationContext(const FString& Key, const FString& Value);
+
+    /** Check if the operation has any errors */
+    bool HasErrors() const;
+
+    /** Check if the operation has any warnings */
+    bool HasWarnings() const;
+
+    /** Get the count of errors by severity */
+    int32 GetErrorCount(EMCPErrorSeverity Severity = EMCPErrorSeverity::Error) const;
+
+    /** Get all errors of a specific severity */
+    TArray<FMCPEnhancedError> GetErrorsBySeverity(EMCPErrorSeverity Severity) const;
+
+    /** Get the most severe error in the context */
+    FMCPEnhancedError GetMostSevereError() const;
+
+    /** Create a comprehensive response object from the operation context */
+    FString CreateResponse(const FString& SuccessData = TEXT(""), const FString& Metadata = TEXT("")) const;
+
+    /** Create a summary of all errors and warnings */
+    FString CreateErrorSummary() const;
+
+    /** Clear all errors and warnings from the context */
+    void Clear();
+
+    /** Get operation timing information */
+    float GetOperationDuration() const;
+
+    /** Mark the operation as completed */
+    void CompleteOperation();
+
+    /** Get operation statistics */
+    FString GetOperationStats() const;
+};
+
+/**
+ * Blueprint-facing wrapper around FMCPOperationContext
  * Provides comprehensive error handling, logging, and debugging capabilities
  */
 UCLASS(BlueprintType)
@@ -168,41 +262,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MCP Operation Context")
     FString GetOperationStats() const;
 
-protected:
-    /** Name of the operation being tracked */
-    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
-    FString OperationName;
-
-    /** Unique identifier for this operation */
-    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
-    FString OperationId;
+    /** Get the wrapped context */
+    const FMCPOperationContext& GetContext() const { return Context; }
 
-    /** Timestamp when the operation started */
-    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
-    FDateTime StartTime;
-
-    /** Timestamp when the operation completed */
-    UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
-    FDateTime EndTime;
+    /** Replace the wrapped context, e.g. with a batch result's context */
+    UFUNCTION(BlueprintCallable, Category = "MCP Operation Context")
+    void SetContext(const FMCPOperationContext& InContext) { Context = InContext; }
 
-    /** Whether the operation has been completed */
+protected:
+    /** The wrapped operation context */
     UPROPERTY(BlueprintReadOnly, Category = "Operation Info")
-    bool bOperationCompleted;
-
-    /** Collection of all errors encountered during the operation */
-    UPROPERTY(BlueprintReadOnly, Category = "Errors")
-    TArray<FMCPEnhancedError> Errors;
-
-    /** Context information that applies to the entire operation */
-    UPROPERTY(BlueprintReadOnly, Category = "Context")
-    TMap<FString, FString> OperationContext;
-
-private:
-    /** Generate a unique operation ID */
-    FString GenerateOperationId() const;
-
-    /** Convert severity enum to string for logging */
-    FString SeverityToString(EMCPErrorSeverity Severity) const;
+    FMCPOperationContext Context;
 };
 
 /**
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+class FArchive;
+
+/**
+ * Versioned binary files in Intermediate/UnrealMCP for indexes that come out the same across editor
+ * sessions, so a warm start can restore them instead of rebuilding
+ *
+ * A file holds a header and the owner's payload. The header records:
+ *   - the file format
+ *   - the owner's own version
+ *   - a key of the engine build
+ *   - a 64-bit content key the owner derives from what the index was built from (e.g. the asset
+ *     registry state it indexed)
+ *   - the payload size and checksum
+ *
+ * Load maps the file into memory and hands the payload to the owner only if the format, the
+ * version and the engine build all match and the checksum is right. Comparing the content key is
+ * up to the owner, as it may only be computable later, e.g. once the asset registry has scanned.
+ * Anything else is treated as no file, and the index is built as before.
+ *
+ * Thread-safe; each owner uses its own file name.
+ */
+class UNREALMCP_API FMCPPersistentCache
+{
+public:
+    /** @return Path of the cache file with the given name */
+    static FString GetPath(const TCHAR* Name);
+
+    /**
+     * Write a cache file, replacing the previous one
+     * @param Name File name, unique per owner
+     * @param Version Owner's payload version; bump when the payload layout changes
+     * @param ContentKey Key of what the payload was built from
+     * @param WritePayload Writes the payload
+     * @return Whether the file was written
+     */
+    static bool Save(const TCHAR* Name, uint32 Version, uint64 ContentKey, TFunctionRef<void(FArchive&)> WritePayload);
+
+    /**
+     * Read a cache file written by this engine build with this version
+     * @param Name File name, unique per owner
+     * @param Version Owner's payload version
+     * @param OutContentKey Receives the content key the file was saved with
+     * @param ReadPayload Reads the payload; returns false, or leaves the archive in error, if it is unusable
+     * @return Whether the file existed, matched and its payload was read
+     */
+    static bool Load(const TCHAR* Name, uint32 Version, uint64& OutContentKey, TFunctionRef<bool(FArchive&)> ReadPayload);
+
+    /** @return Key of the running engine build; files from other builds are ignored */
+    static uint64 GetEngineBuildKey();
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "MCPCancellation.h"
+
+class FJsonObject;
+
+/**
+ * Single-flight bookkeeping for identical read-only requests
+ *
+ * Several tool servers often ask for the same metadata within milliseconds. The first request for
+ * a key leads and executes; identical requests arriving while it is in flight join it and receive
+ * the leader's response instead of queueing another execution on the game thread.
+ *
+ * Requests are identical when the command and its parameters match; parameters are compared in
+ * canonical form, so key order does not matter.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPRequestCoalescer
+{
+public:
+    /** A request waiting for the leader's response */
+    struct FFollower
+    {
+        TPromise<FString> Promise;
+        FMCPCancellationTokenPtr CancellationToken;
+        uint32 ClientId;
+    };
+
+    /**
+     * Build the coalescing key of a request
+     * @param CommandType Command name
+     * @param Params Command parameters
+     * @return Key that is equal for requests with the same command and parameters
+     */
+    static FString MakeKey(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Join an identical in-flight request, or lead a new one
+     * @param Key Request key from MakeKey
+     * @param CancellationToken Joining request's token, kept for the leader's completion
+     * @param ClientId Joining request's connection
+     * @param OutFuture Receives the future of the leader's response when joining
+     * @return true if the request joined one in flight; false if the caller leads and must call Complete
+     */
+    bool Join(const FString& Key, const FMCPCancellationTokenPtr& CancellationToken, uint32 ClientId, TFuture<FString>& OutFuture);
+
+    /**
+     * Finish the leader's request; identical requests after this start a new execution
+     * @param Key Request key of the leader
+     * @return Requests that joined the leader, to be answered by the caller
+     */
+    TArray<FFollower> Complete(const FString& Key);
+
+private:
+    /** Followers per in-flight key; a key is present while its leader runs */
+    TMap<FString, TArray<FFollower>> InFlightRequests;
+
+    FCriticalSection Lock;
+};
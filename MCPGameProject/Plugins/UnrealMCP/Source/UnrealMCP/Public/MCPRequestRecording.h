@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Async/Future.h"
+#include "MCPMetrics.h"
+
+class FArchive;
+class FJsonObject;
+class UUnrealMCPBridge;
+enum class EMCPCommandPriority : uint8;
+
+/**
+ * Opt-in record of every request the bridge is asked to run
+ *
+ * Each request is appended as one JSON line, {"t": <seconds since the recording started>,
+ * "c": <connection id>, "type": ..., "params": {...}} plus "priority" when the client chose one,
+ * after a {"format": "unrealmcp-requests", "version": 1, "started": ...} header line. Lines are
+ * flushed as they are written, so a recording survives an editor crash.
+ *
+ * Started by the record_requests command, or at startup into Saved/UnrealMCP/Recordings when
+ * mcp.RecordRequests is set. Requests sent by FMCPRequestReplayer and the recording and replay
+ * commands themselves are not recorded.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPRequestRecorder
+{
+public:
+    static FMCPRequestRecorder& Get();
+
+    /** Start recording if mcp.RecordRequests is set */
+    void Initialize();
+
+    /** Stop recording */
+    void Shutdown();
+
+    /**
+     * Start a recording, replacing the file if it exists
+     * @param InPath - File to write; a timestamped file under GetDefaultDirectory() if empty
+     * @param OutPath - Receives the file written to
+     * @return false with OutError set if already recording or the file cannot be opened
+     */
+    bool Start(const FString& InPath, FString& OutPath, FString& OutError);
+
+    /**
+     * Stop recording and close the file
+     * @return false if nothing was being recorded
+     */
+    bool Stop();
+
+    /** Record a request if a recording is running */
+    void Record(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, uint32 ClientId, TOptional<EMCPCommandPriority> Priority);
+
+    /** {"recording", "path", "requests", "elapsed_seconds"} */
+    TSharedRef<FJsonObject> MakeStatus() const;
+
+    /** Saved/UnrealMCP/Recordings */
+    static FString GetDefaultDirectory();
+
+private:
+    FMCPRequestRecorder() = default;
+
+    mutable FCriticalSection Lock;
+    TUniquePtr<FArchive> Writer;
+    FString Path;
+    double StartTime = 0.0;
+    int64 RecordedCount = 0;
+    TAtomic<bool> bRecording { false };
+};
+
+/**
+ * Feeds a recording made by FMCPRequestRecorder back through the bridge
+ *
+ * Requests are sent from a worker thread in recorded order, each no earlier than its recorded
+ * time divided by the speed (0 sends them as fast as possible). A request also waits for the
+ * response to the previous request of its recorded connection, so each connection's requests keep
+ * their order and dependencies, as they had in the original session.
+ *
+ * Replayed requests go through admission, coalescing, the response cache and the scheduler like
+ * any other, so get_mcp_metrics after a replay compares directly against the metrics of the
+ * recorded session. Their client ids have ClientIdFlag set, so they are kept apart from live
+ * clients in the scheduler. One replay runs at a time.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPRequestReplayer
+{
+public:
+    /** Set in the client id of every replayed request */
+    static constexpr uint32 ClientIdFlag = 0x80000000u;
+
+    static FMCPRequestReplayer& Get();
+
+    /**
+     * Start replaying a recording
+     * @param Speed - Pace relative to the recording, e.g. 2 for twice as fast; 0 for as fast as possible
+     * @param MaxRequests - Stop after this many requests; 0 for all
+     * @return false with OutError set if a replay is running or the recording cannot be read
+     */
+    bool Start(UUnrealMCPBridge* Bridge, const FString& InPath, double Speed, int32 MaxRequests, FString& OutError);
+
+    /** Stop sending requests; those already sent still finish */
+    void Stop();
+
+    /** Stop and wait for the replay thread */
+    void Shutdown();
+
+    /**
+     * Progress of the running or last replay
+     * {"state": "idle"|"running"|"finished"|"stopped", "path", "speed", "requests_total", "requests_sent",
+     *  "responses", "errors", "busy", "recorded_seconds", "elapsed_seconds", "latency": {p50_ms, ...}}
+     */
+    TSharedRef<FJsonObject> MakeStatus() const;
+
+private:
+    FMCPRequestReplayer() = default;
+
+    /** Request of a recording */
+    struct FRecordedRequest
+    {
+        double Time = 0.0;
+        uint32 ClientId = 0;
+        FString CommandType;
+        TSharedPtr<FJsonObject> Params;
+        TOptional<EMCPCommandPriority> Priority;
+    };
+
+    /**
+     * Read a recording
+     * @return false with OutError set if it is missing or not a recording
+     */
+    static bool LoadRecording(const FString& InPath, TArray<FRecordedRequest>& OutRequests, FString& OutError);
+
+    /** Replay thread body */
+    void Run(UUnrealMCPBridge* Bridge, TArray<FRecordedRequest> Requests);
+
+    /** A replayed request was answered */
+    void RecordResponse(const FString& Response, double LatencySeconds);
+
+    mutable FCriticalSection Lock;
+    TFuture<void> ReplayTask;
+    TAtomic<bool> bStopRequested { false };
+
+    FString State = TEXT("idle");
+    FString Path;
+    double Speed = 1.0;
+    int32 RequestsTotal = 0;
+    int32 RequestsSent = 0;
+    int32 Responses = 0;
+    int32 Errors = 0;
+    int32 BusyResponses = 0;
+    double RecordedSeconds = 0.0;
+    double StartTime = 0.0;
+    double EndTime = 0.0;
+    FMCPMetrics::FLatencyHistogram Latency;
+};
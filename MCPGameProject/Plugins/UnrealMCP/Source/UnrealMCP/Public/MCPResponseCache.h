@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+struct FAssetData;
+struct FPropertyChangedEvent;
+
+/**
+ * Cache of responses to read-only metadata commands, invalidated whenever editor state changes
+ *
+ * Entries are keyed like coalesced requests (command plus canonical parameters) and stamped with
+ * the editor state generation read just before the command ran. Any change bumps the generation
+ * and drops every entry:
+ *
+ * - objects being modified or having a property changed (transient objects such as the editor
+ *   selection are ignored)
+ * - packages being saved, objects being replaced by a blueprint recompile, undo/redo
+ * - assets being added, removed or renamed in the asset registry
+ * - any MCP command that is not read-only finishing
+ *
+ * A single generation for the whole editor means one edit invalidates all metadata, but it needs
+ * no knowledge of which assets a command read, so a cached response is never stale.
+ *
+ * When the responses outgrow MaxCachedChars, or FMCPCacheBudget evicts, the least recently used
+ * responses are dropped first.
+ *
+ * Thread-safe; the invalidation handlers are registered and receive events on the game thread.
+ */
+class UNREALMCP_API FMCPResponseCache : public IMCPBudgetedCache
+{
+public:
+    FMCPResponseCache();
+    ~FMCPResponseCache();
+
+    /** Start listening for editor changes */
+    void RegisterInvalidationHandlers();
+
+    /** Stop listening for editor changes */
+    void UnregisterInvalidationHandlers();
+
+    /** @return Current editor state generation; read it before running a command whose response will be stored */
+    uint64 GetGeneration() const { return Generation.Load(); }
+
+    /** Record that editor state changed: bump the generation and drop every entry */
+    void Invalidate();
+
+    /**
+     * Look up a cached response
+     * @param Key Request key (FMCPRequestCoalescer::MakeKey)
+     * @param OutResponse Receives the cached response
+     * @return true on a hit
+     */
+    bool Find(const FString& Key, FString& OutResponse) const;
+
+    /**
+     * Store a response
+     * @param Key Request key (FMCPRequestCoalescer::MakeKey)
+     * @param Response Serialized response
+     * @param ResponseGeneration Generation read before the command ran; the response is dropped if
+     *        editor state changed since
+     */
+    void Store(const FString& Key, const FString& Response, uint64 ResponseGeneration);
+
+    /** Total response characters the cache holds before evicting the least recently used (UUnrealMCPSettings::ResponseCacheSizeMB) */
+    const int64 MaxCachedChars;
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Invalidate for a change to Object, unless it is transient */
+    void InvalidateForObject(const UObject* Object);
+
+    struct FEntry
+    {
+        FString Response;
+        uint64 Generation;
+        /** FMCPCacheBudget::NextUse() of the last Store or hit */
+        mutable uint64 LastUse;
+        int64 Bytes;
+    };
+
+    /** Evict the least recently used entries until at most MaxChars characters are cached; call with the lock held */
+    void EvictDownToChars(int64 MaxChars);
+
+    TMap<FString, FEntry> Entries;
+    int64 CachedChars;
+    TAtomic<uint64> Generation;
+    mutable FCriticalSection Lock;
+    /** Invalidations only count the times entries were dropped */
+    mutable FMCPCacheCounters CacheCounters;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle ObjectsReplacedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
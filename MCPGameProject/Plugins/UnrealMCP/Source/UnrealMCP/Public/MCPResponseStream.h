@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMCPTransport;
+struct FMCPAttachment;
+enum class EMCPFrameFormat : uint8;
+
+/**
+ * Streams a response message onto a client transport in bounded chunks
+ *
+ * The response text is converted to UTF-8 a slice at a time into a fixed scratch buffer
+ * and each slice is sent as soon as it is converted, so sending a multi-megabyte
+ * response (export_blueprint_graph, get_level_metadata on a big level, ...) needs no
+ * full UTF-8 copy or framed copy of it, and the client starts receiving while the rest
+ * is still being encoded.
+ *
+ * When compression is enabled, length-prefixed payloads of at least
+ * FMCPMessageFramer::CompressionThreshold bytes are sent as compressed frames instead;
+ * those are encoded in full before sending.
+ *
+ * A message with attachments goes out as one attachments frame (FMCPMessageFramer::AttachmentsFlag):
+ * the message is still sliced, and each attachment is sent from the buffer that holds it.
+ *
+ * Sends handle partial writes and full buffers on the non-blocking transport by waiting
+ * for it to become writable, up to SendTimeoutSeconds without progress.
+ *
+ * Not thread-safe; callers serialize sends on the transport.
+ */
+class UNREALMCP_API FMCPResponseStream
+{
+public:
+    /** Characters converted per slice; a slice is at most four UTF-8 bytes per character */
+    static constexpr int32 SliceChars = 16 * 1024;
+
+    /** Longest time a send may make no progress before it is abandoned */
+    static constexpr double SendTimeoutSeconds = 30.0;
+
+    /**
+     * @param InTransport Connected client transport
+     * @param InFormat Wire format of the message (length-prefixed or raw JSON)
+     * @param bInCompress Compress large length-prefixed payloads (negotiated per connection)
+     * @param InScratch Optional scratch buffer kept by the caller across responses, so steady-state
+     *        sends allocate nothing; the caller must serialize sends that share it
+     */
+    FMCPResponseStream(IMCPTransport& InTransport, EMCPFrameFormat InFormat, bool bInCompress = false, TArray<uint8>* InScratch = nullptr);
+
+    /**
+     * Frame and send one complete message
+     * @param Message Message text
+     * @return true if every byte was sent
+     */
+    bool SendMessage(const FString& Message);
+
+    /**
+     * Frame and send one message that is already encoded (e.g. CBOR)
+     * @param Payload Encoded payload bytes
+     * @param NumBytes Number of payload bytes
+     * @return true if every byte was sent
+     */
+    bool SendPayload(const uint8* Payload, int32 NumBytes);
+
+    /**
+     * Send one message and the attachments it refers to in an attachments frame; length-prefixed only
+     * @param Message Message text
+     * @param Attachments Attachments to send after the message
+     * @return true if every byte was sent
+     */
+    bool SendMessage(const FString& Message, TConstArrayView<FMCPAttachment> Attachments);
+
+    /**
+     * Send one encoded message and the attachments it refers to in an attachments frame; length-prefixed only
+     * @param Payload Encoded payload bytes
+     * @param NumBytes Number of payload bytes
+     * @param Attachments Attachments to send after the message
+     * @return true if every byte was sent
+     */
+    bool SendPayload(const uint8* Payload, int32 NumBytes, TConstArrayView<FMCPAttachment> Attachments);
+
+    /** @return Total bytes written to the socket by this stream, including headers */
+    int64 GetBytesSent() const { return BytesSent; }
+
+    /** @return Description of the last failure, or an empty string */
+    const FString& GetLastError() const { return LastError; }
+
+private:
+    /** Send the length header when the format is length-prefixed */
+    bool SendHeader(int64 PayloadSize, uint32 Flags = 0);
+
+    /** Convert message text to UTF-8 a slice at a time and send each slice */
+    bool SendText(const TCHAR* Chars, int32 NumChars);
+
+    /**
+     * Send an attachments frame
+     * @param MessageSize UTF-8 or encoded size of the message
+     * @param SendMessageBody Sends exactly MessageSize bytes of message
+     */
+    bool SendAttachmentsFrame(int64 MessageSize, TFunctionRef<bool()> SendMessageBody, TConstArrayView<FMCPAttachment> Attachments);
+
+    /** @return true if a payload of this size should go out as a compressed frame */
+    bool ShouldCompress(int64 PayloadSize) const;
+
+    /**
+     * Send a buffer completely, waiting for the socket to drain when it is full
+     * @return false on a socket error or timeout
+     */
+    bool SendAll(const uint8* Data, int32 NumBytes);
+
+    IMCPTransport& Transport;
+    EMCPFrameFormat Format;
+    bool bCompress;
+    TArray<uint8> OwnedScratch;
+    TArray<uint8>& Scratch;
+    int64 BytesSent;
+    FString LastError;
+};
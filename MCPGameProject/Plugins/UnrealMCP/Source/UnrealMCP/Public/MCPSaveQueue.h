@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class UPackage;
+
+/**
+ * Coalesces the package saves MCP commands do after each modification
+ *
+ * Services hand the asset they would save to Enqueue. While saves are being queued, the asset's
+ * package is only marked dirty and remembered; every remembered package is then written in one
+ * UEditorLoadingAndSavingUtils::SavePackages call, so a run of row or node edits hits disk and
+ * source control once instead of once per edit. The queue is flushed:
+ *
+ * - when the outermost FMCPBatchEditScope closes (end of execute_batch)
+ * - mcp.SaveFlushDelaySeconds after the last queued save
+ * - on the flush_saves command
+ * - when the bridge shuts down
+ *
+ * Saves are queued inside a batch scope always, and outside one while mcp.SaveFlushDelaySeconds
+ * is above zero; with 0, services save immediately as before.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FMCPSaveQueue
+{
+public:
+    static FMCPSaveQueue& Get();
+
+    /**
+     * Queue the save of an asset's package
+     * @param Asset Asset to save
+     * @return true if the save was queued; false if saves are not being queued and the caller
+     *         should save the asset itself
+     */
+    bool Enqueue(UObject* Asset);
+
+    /**
+     * Queue the save of an asset's package, or save it now (UEditorAssetLibrary::SaveLoadedAsset)
+     * when saves are not being queued
+     * @param Asset Asset to save
+     * @return true if the save was queued or succeeded
+     */
+    bool SaveOrEnqueue(UObject* Asset);
+
+    /**
+     * Save every queued package
+     * @param OutFailedPackages Receives the names of packages that were queued but are not saved
+     * @return Number of packages that were queued
+     */
+    int32 Flush(TArray<FString>* OutFailedPackages = nullptr);
+
+    /** @return Number of queued packages */
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+    /** Save what is queued and stop the flush timer */
+    void Shutdown();
+
+private:
+    /** Flush timer */
+    bool Tick(float DeltaTime);
+
+    TArray<TWeakObjectPtr<UPackage>> Pending;
+    double LastEnqueueTime = 0.0;
+    FTSTicker::FDelegateHandle TickerHandle;
+};
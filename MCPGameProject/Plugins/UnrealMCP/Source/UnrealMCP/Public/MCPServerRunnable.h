@@ -2,18 +2,28 @@
 
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
-#include "Sockets.h"
-#include "Interfaces/IPv4/IPv4Address.h"
+#include "MCPTransport.h"
 
 class UUnrealMCPBridge;
+class FMCPClientConnection;
+class FEvent;
 
 /**
- * Runnable class for the MCP server thread
+ * Runnable class for the MCP server accept thread
+ *
+ * Accepts client connections and hands each one to its own FMCPClientConnection
+ * worker, so several MCP clients (blueprint, niagara, umg, ... servers) are served
+ * concurrently instead of queueing behind each other. Up to GetMaxConcurrentConnections()
+ * are served at once; further clients wait in the listen backlog until a worker
+ * finishes.
+ *
+ * The bridge runs one accept thread per listener (TCP, and a local socket for clients on
+ * the same machine); each thread has its own connection limit.
  */
 class FMCPServerRunnable : public FRunnable
 {
 public:
-	FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<FSocket> InListenerSocket);
+	FMCPServerRunnable(UUnrealMCPBridge* InBridge, TSharedPtr<IMCPListener> InListener);
 	virtual ~FMCPServerRunnable();
 
 	// FRunnable interface
@@ -22,13 +32,31 @@ public:
 	virtual void Stop() override;
 	virtual void Exit() override;
 
+	/** @return Maximum number of client connections served concurrently (UUnrealMCPSettings::MaxConcurrentConnections) */
+	static int32 GetMaxConcurrentConnections();
+
+	/** Longest single blocking wait for a connection, bounding how long Stop() takes to be noticed */
+	static constexpr double StopCheckIntervalSeconds = 0.25;
+
+	/** @return Number of connections currently being served */
+	int32 GetActiveConnectionCount() const;
+
 protected:
-	void HandleClientConnection(TSharedPtr<FSocket> ClientSocket);
-	void ProcessMessage(TSharedPtr<FSocket> Client, const FString& Message);
+	/** Destroy workers whose connections have closed */
+	void ReapFinishedConnections();
+
+	/** Stop all workers and wait for them to exit */
+	void StopAllConnections();
 
 private:
 	UUnrealMCPBridge* Bridge;
-	TSharedPtr<FSocket> ListenerSocket;
-	TSharedPtr<FSocket> ClientSocket;
-	bool bRunning;
-}; 
+	TSharedPtr<IMCPListener> Listener;
+	TAtomic<bool> bRunning;
+
+	/** Live connection workers; only touched by the accept thread except for the count query */
+	TArray<TUniquePtr<FMCPClientConnection>> Connections;
+	mutable FCriticalSection ConnectionsLock;
+
+	/** Triggered by workers when they finish, waking the accept loop when it is at capacity */
+	FEvent* ConnectionFinishedEvent;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+
+class FJsonObject;
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Record of the commands that took longer than mcp.SlowCommandThresholdMs
+ *
+ * FMCPMetrics keeps only aggregates, so a single hitch cannot be told apart from the rest
+ * afterwards. Every command the bridge runs is registered here while it runs; once it has been
+ * running for a quarter of the threshold, a sampler thread captures the stack of the thread it runs
+ * on every mcp.SlowCommandSampleIntervalMs. A command that ends up over the threshold is written,
+ * with its parameters (truncated), its time breakdown and its most frequent stacks, as one JSON line
+ * to Saved/UnrealMCP/SlowCommands/SlowCommands.jsonl. That file rolls over to SlowCommands.1.jsonl
+ * (and so on, keeping MaxRolledFiles) once it exceeds mcp.SlowCommandLogMaxKB.
+ *
+ * Symbolizing and writing happen on the sampler thread, so the command's thread only pays for
+ * serializing the parameters of slow commands. A threshold of 0 disables the log.
+ *
+ * Thread-safe.
+ */
+class UNREALMCP_API FMCPSlowCommandLog : public FRunnable
+{
+public:
+    /** Identifies a command between BeginExecution and EndExecution; 0 if it is not tracked */
+    using FExecutionId = uint64;
+
+    /** Time breakdown of a finished command, in seconds */
+    struct FTimings
+    {
+        double QueueWaitSeconds = 0.0;
+        double ExecuteSeconds = 0.0;
+        double SerializeSeconds = 0.0;
+    };
+
+    static FMCPSlowCommandLog& Get();
+
+    /** Start the sampler thread if the log is enabled */
+    void Initialize();
+
+    /** Stop the sampler thread after writing the records still queued */
+    void Shutdown();
+
+    /** A command starts running on the calling thread */
+    FExecutionId BeginExecution();
+
+    /**
+     * The command ended; record it if it was slow
+     * @param Params - Parameters it ran with; only serialized if it was slow
+     */
+    void EndExecution(FExecutionId ExecutionId, const FString& CommandType, const TSharedPtr<FJsonObject>& Params,
+                      const FTimings& Timings, bool bError);
+
+    /** Directory the log files are written to */
+    static FString GetLogDirectory();
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+    static constexpr int32 MaxStackDepth = 48;
+    static constexpr int32 MaxRolledFiles = 4;
+
+private:
+    FMCPSlowCommandLog() = default;
+
+    /** Distinct stack seen while sampling a command */
+    struct FStackSample
+    {
+        TArray<uint64> Frames;
+        int32 Count = 0;
+    };
+
+    /** Command being run */
+    struct FActiveExecution
+    {
+        uint32 ThreadId = 0;
+        uint64 StartCycles = 0;
+        int32 SampleCount = 0;
+        /** By CRC of the frames */
+        TMap<uint32, FStackSample> Stacks;
+    };
+
+    /** Slow command waiting to be written */
+    struct FSlowCommandRecord
+    {
+        FString CommandType;
+        FString Params;
+        bool bParamsTruncated = false;
+        bool bError = false;
+        FTimings Timings;
+        double ThresholdSeconds = 0.0;
+        FDateTime Timestamp;
+        int32 SampleCount = 0;
+        TArray<FStackSample> Stacks;
+    };
+
+    /** Capture a stack of each command that has run long enough */
+    void SampleActiveExecutions();
+
+    /** Symbolize and append the queued records */
+    void WritePendingRecords();
+
+    /** Move the current file to .1 and older ones up by one */
+    void RollFiles(const FString& LogPath) const;
+
+    FCriticalSection Lock;
+    TMap<FExecutionId, FActiveExecution> ActiveExecutions;
+    FExecutionId NextExecutionId = 1;
+
+    TQueue<FSlowCommandRecord, EQueueMode::Mpsc> PendingRecords;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    TAtomic<bool> bRunning { false };
+};
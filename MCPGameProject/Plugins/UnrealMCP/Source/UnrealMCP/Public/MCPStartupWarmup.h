@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+struct FFileLoadProgressUpdateData;
+
+/**
+ * Startup phase of the bridge, from subsystem init until the editor can answer commands promptly
+ *
+ * The server used to start taking commands during subsystem init, while the editor was still
+ * loading, so the first commands sat behind asset registry waits and action database builds.
+ * The server now listens right away, but until the asset registry has finished its initial scan
+ * every command except ping is answered with a "warming_up" error that carries an estimate of
+ * when the scan finishes, extrapolated from the registry's progress updates.
+ *
+ * Meanwhile the steps added with AddStep (building the action database, indexes and caches the
+ * first commands would otherwise build) run from the core ticker, at most one per
+ * mcp.WarmupStepIntervalSeconds and only while no commands are waiting; a step can ask to wait
+ * for the scan. A command that needs one before it has run simply builds it itself.
+ *
+ * Start, Stop and AddStep are game thread only; IsWarmingUp and the response are thread-safe.
+ */
+class UNREALMCP_API FMCPStartupWarmup
+{
+public:
+    /**
+     * @param InCanRunStep Whether the editor has time for a step this tick, e.g. no commands queued
+     */
+    explicit FMCPStartupWarmup(TFunction<bool()> InCanRunStep);
+    ~FMCPStartupWarmup();
+
+    /**
+     * Add a pre-warm step; steps run in the order they were added
+     * @param Name Name for the log
+     * @param bNeedsAssetScan Whether the step waits until the asset registry scan has completed
+     * @param Run The step
+     */
+    void AddStep(const FString& Name, bool bNeedsAssetScan, TFunction<void()> Run);
+
+    /** Start following the asset registry scan and running steps */
+    void Start();
+
+    /** Stop running steps and following the scan; steps that have not run are dropped */
+    void Stop();
+
+    /** @return Whether commands are still answered with "warming_up" */
+    bool IsWarmingUp() const;
+
+    /** @return Estimated milliseconds until the scan completes; 0 once warmed up */
+    int32 GetEstimatedRemainingMs() const;
+
+    /**
+     * Build the response sent for a command that arrives while warming up
+     * @return {"status": "error", "error": ..., "warming_up": true, "eta_ms": ..., "retry_after_ms": ...}
+     */
+    TSharedRef<class FJsonObject> MakeWarmingUpResponse() const;
+
+private:
+    struct FStep
+    {
+        FString Name;
+        bool bNeedsAssetScan = false;
+        TFunction<void()> Run;
+    };
+
+    bool Tick(float DeltaTime);
+    void FinishAssetScan();
+    void HandleFilesLoaded();
+    void HandleFileLoadProgress(const FFileLoadProgressUpdateData& ProgressData);
+
+    /** Estimate used before the registry has reported progress */
+    static constexpr int32 DefaultEstimateMs = 2000;
+
+    /** Longest wait a client is asked to make before retrying */
+    static constexpr int32 MaxRetryAfterMs = 5000;
+
+    TFunction<bool()> CanRunStep;
+    TArray<FStep> Steps;
+    int32 NextStep = 0;
+
+    TAtomic<bool> bAssetScanComplete;
+    TAtomic<int32> EstimatedRemainingMs;
+    TAtomic<int32> AssetsProcessed;
+    TAtomic<int32> AssetsTotal;
+
+    /** First progress update, the base of the scan rate */
+    double FirstProgressTime = 0.0;
+    int32 FirstProgressProcessed = INDEX_NONE;
+    double StartTime = 0.0;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle FileLoadProgressHandle;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+/**
+ * Unreal Insights trace channel of the MCP server
+ *
+ * The log only says what a command did; Insights shows where its time went on which thread, next
+ * to the editor frames it stalled. Dispatch, each command's execution (under the command's name),
+ * JSON parsing and serialization, sends, Blueprint loads and compiles and queued saves get CPU
+ * scopes on this channel, and every request leaves a bookmark with its command and request id.
+ *
+ * Record with -trace=cpu,bookmark,unrealmcp (or "Trace.Enable UnrealMCP" in a running editor).
+ * Everything compiles away in builds without tracing.
+ */
+UE_TRACE_CHANNEL_EXTERN(UnrealMCPChannel, UNREALMCP_API)
+
+/** CPU scope with a literal name on the UnrealMCP channel, e.g. MCP_TRACE_SCOPE("MCP::Dispatch") */
+#define MCP_TRACE_SCOPE(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, UnrealMCPChannel)
+
+/** CPU scope named by a run-time TCHAR string on the UnrealMCP channel, e.g. a command name */
+#define MCP_TRACE_SCOPE_TEXT(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Name, UnrealMCPChannel)
+
+/** Bookmark on the Insights timeline; the format must be a string literal */
+#define MCP_TRACE_BOOKMARK(Format, ...) \
+    TRACE_BOOKMARK(Format, ##__VA_ARGS__)
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Timespan.h"
+
+class FSocket;
+
+/**
+ * Outcome of a non-blocking transport read or write
+ */
+enum class EMCPIoResult : uint8
+{
+    /** Bytes were transferred */
+    Ok,
+    /** Nothing could be transferred right now; wait and retry */
+    WouldBlock,
+    /** The peer closed the connection */
+    Closed,
+    /** The connection failed; see IMCPTransport::GetLastErrorDescription */
+    Error
+};
+
+/**
+ * Byte stream between the bridge and one MCP client
+ *
+ * Connection workers only talk to this interface, so the same framing, pipelining and
+ * response streaming run over TCP for remote clients and over a local domain socket for
+ * clients on the same machine. Implementations are non-blocking; Wait* block with a timeout.
+ * Sends and receives may run on different threads, but each direction is used by one
+ * thread at a time.
+ */
+class UNREALMCP_API IMCPTransport
+{
+public:
+    virtual ~IMCPTransport() {}
+
+    /** Apply per-connection options after accept and switch to non-blocking mode */
+    virtual void Configure() = 0;
+
+    /**
+     * Block until data can be read, the peer hangs up, or the timeout expires
+     * @return true if a read will not block
+     */
+    virtual bool WaitForRead(const FTimespan& WaitTime) = 0;
+
+    /**
+     * Block until data can be written or the timeout expires
+     * @return true if a write will not block
+     */
+    virtual bool WaitForWrite(const FTimespan& WaitTime) = 0;
+
+    /** Read up to BufferSize bytes */
+    virtual EMCPIoResult Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) = 0;
+
+    /** Write up to Count bytes; OutBytesSent may be less than Count */
+    virtual EMCPIoResult Send(const uint8* Data, int32 Count, int32& OutBytesSent) = 0;
+
+    /** @return true once the connection is known to be broken */
+    virtual bool IsConnectionLost() = 0;
+
+    /** Finish sending and close, giving the peer a chance to read what is buffered */
+    virtual void CloseGracefully() = 0;
+
+    /** Close immediately */
+    virtual void Close() = 0;
+
+    /** @return Human-readable description of the last error */
+    virtual FString GetLastErrorDescription() const = 0;
+
+    /** @return Description of the peer for logs */
+    virtual FString GetPeerDescription() const = 0;
+};
+
+/** Transports are shared between a connection worker and its in-flight pipelined responses */
+typedef TSharedPtr<IMCPTransport, ESPMode::ThreadSafe> FMCPTransportPtr;
+
+/**
+ * Source of accepted client transports, driven by FMCPServerRunnable
+ */
+class UNREALMCP_API IMCPListener
+{
+public:
+    virtual ~IMCPListener() {}
+
+    /**
+     * Wait up to WaitTime for a client and accept it
+     * @return Accepted transport, or nullptr if none arrived or accepting failed
+     */
+    virtual FMCPTransportPtr WaitAndAccept(const FTimespan& WaitTime) = 0;
+
+    /** @return Description of what is being listened on, for logs */
+    virtual FString GetDescription() const = 0;
+};
+
+/**
+ * TCP transport over an accepted FSocket
+ */
+class UNREALMCP_API FMCPSocketTransport : public IMCPTransport
+{
+public:
+    explicit FMCPSocketTransport(TSharedPtr<FSocket> InSocket);
+    virtual ~FMCPSocketTransport();
+
+    // IMCPTransport interface
+    virtual void Configure() override;
+    virtual bool WaitForRead(const FTimespan& WaitTime) override;
+    virtual bool WaitForWrite(const FTimespan& WaitTime) override;
+    virtual EMCPIoResult Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) override;
+    virtual EMCPIoResult Send(const uint8* Data, int32 Count, int32& OutBytesSent) override;
+    virtual bool IsConnectionLost() override;
+    virtual void CloseGracefully() override;
+    virtual void Close() override;
+    virtual FString GetLastErrorDescription() const override;
+    virtual FString GetPeerDescription() const override;
+
+private:
+    /** Map the socket subsystem's last error to a result, remembering real errors */
+    EMCPIoResult TranslateLastError();
+
+    TSharedPtr<FSocket> Socket;
+    int32 LastError;
+};
+
+/**
+ * Accepts TCP clients on a listening FSocket owned by the bridge
+ */
+class UNREALMCP_API FMCPSocketListener : public IMCPListener
+{
+public:
+    explicit FMCPSocketListener(TSharedPtr<FSocket> InListenerSocket);
+
+    // IMCPListener interface
+    virtual FMCPTransportPtr WaitAndAccept(const FTimespan& WaitTime) override;
+    virtual FString GetDescription() const override;
+
+private:
+    TSharedPtr<FSocket> ListenerSocket;
+};
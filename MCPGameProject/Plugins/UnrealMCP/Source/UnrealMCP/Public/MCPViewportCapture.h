@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPImageEncoding.h"
+
+class FViewport;
+class UTextureRenderTarget2D;
+
+/** Outcome of a viewport capture */
+struct FMCPViewportCaptureResult
+{
+    bool bSuccess = false;
+    FString Error;
+    FString FilePath;
+
+    /** Size of the written image, after cropping and scaling */
+    FIntPoint Size = FIntPoint::ZeroValue;
+
+    /** Encoded image, as written to the file */
+    TArray64<uint8> EncodedData;
+};
+
+/**
+ * Viewport and render target screenshots that do not stall the editor
+ *
+ * CaptureToFile copies the viewport's render target into an FRHIGPUTextureReadback on the render
+ * thread and returns at once. A core ticker polls the readback once per frame; when the GPU has
+ * finished the copy the pixels are mapped on the render thread, and a worker converts, scales and
+ * compresses them and writes the file. No step waits for the GPU or flushes rendering. A crop
+ * region is applied to the GPU copy itself, so only those pixels are read back.
+ *
+ * Readbacks support 8-bit BGRA/RGBA, 10-bit RGB and half-float RGBA targets, which covers
+ * SDR and HDR editor viewports.
+ *
+ * CaptureToFileBlocking is the synchronous ReadPixels path, for callers already on the game
+ * thread that must have the file before they return.
+ */
+class UNREALMCP_API FMCPViewportCapture
+{
+public:
+    /** Called once the file is written or the capture failed; on a worker or the render thread */
+    using FOnCaptured = TFunction<void(const FMCPViewportCaptureResult&)>;
+
+    /**
+     * Start capturing a viewport to an image file; game thread only
+     * @param Viewport Viewport to capture
+     * @param FilePath Absolute path of the image to write
+     * @param Options Crop, scale and compression of the image
+     * @param OnCaptured Receives the result
+     */
+    static void CaptureToFile(FViewport* Viewport, const FString& FilePath, const FMCPImageEncodeOptions& Options, FOnCaptured OnCaptured);
+
+    /**
+     * Start reading back and encoding a render target; game thread only
+     * Nothing is written to disk: the encoded image is in the result. The render target must stay
+     * alive and unchanged until OnCaptured runs.
+     * @param RenderTarget Render target to capture, with rendering already enqueued
+     * @param Options Crop, scale and compression of the image
+     * @param OnCaptured Receives the result
+     */
+    static void CaptureRenderTarget(UTextureRenderTarget2D* RenderTarget, const FMCPImageEncodeOptions& Options, FOnCaptured OnCaptured);
+
+    /**
+     * Capture a viewport to an image file before returning; game thread only
+     * @param Viewport Viewport to capture
+     * @param FilePath Absolute path of the image to write
+     * @param Options Crop, scale and compression of the image
+     * @return The result
+     */
+    static FMCPViewportCaptureResult CaptureToFileBlocking(FViewport* Viewport, const FString& FilePath, const FMCPImageEncodeOptions& Options);
+
+    /**
+     * Scale and compress captured pixels and write them; any thread
+     * @param Pixels Cropped pixels, row by row; alpha is ignored
+     * @param Size Size of the cropped pixels
+     * @param FilePath Path of the image to write; empty only encodes
+     * @param Options Scale and compression of the image
+     * @return The result
+     */
+    static FMCPViewportCaptureResult SaveImage(TArray<FColor>& Pixels, const FIntPoint& Size, const FString& FilePath, const FMCPImageEncodeOptions& Options);
+};
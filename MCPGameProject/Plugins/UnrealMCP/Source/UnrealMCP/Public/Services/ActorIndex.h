@@ -0,0 +1,211 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class AActor;
+class UClass;
+class ULevel;
+class UWorld;
+struct FConvexVolume;
+struct FPropertyChangedEvent;
+
+/**
+ * Per-world actor lookups for the editor services, without sweeping every actor per request
+ *
+ * - By name: actors are named uniquely within their level, so each level's object hash finds them
+ * - By label, class and tag: an index built on the first lookup in a world and kept current with
+ *   OnLevelActorAdded/Deleted, actor label changes and edits of an actor's Tags
+ * - By region: a uniform grid over actor bounds, built on the first spatial query in a world and
+ *   kept current with the same notifications plus OnActorMoved and property edits of an actor or
+ *   its components. Actors spanning too many cells (landscapes, sky spheres) are kept in a list
+ *   that every query checks
+ *
+ * Changes that bypass those notifications (level streaming, World Partition loading, ...) change
+ * the number of actor slots in the world's levels, which makes the next lookup rebuild the index;
+ * reinstancing after a Blueprint compile and undo/redo drop every index. Matches are checked
+ * against the actor before they are returned, so a stale entry is never reported. An actor moved
+ * without any notification can be missed by a spatial query until it is next reindexed.
+ *
+ * FString comparisons are case-insensitive, as in the sweeps this replaces.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FActorIndex
+{
+public:
+    static FActorIndex& Get();
+
+    /** Start following actor changes */
+    void Initialize();
+
+    /** Stop following actor changes and drop every index */
+    void Shutdown();
+
+    /**
+     * Find an actor by object name
+     * @param World World to search
+     * @param ActorName Object name of the actor
+     * @return The actor, or nullptr
+     */
+    AActor* FindActorByName(UWorld* World, const FString& ActorName) const;
+
+    /**
+     * Find an actor by editor label
+     * @param World World to search
+     * @param ActorLabel Label shown in the outliner
+     * @return The first actor with that label, or nullptr
+     */
+    AActor* FindActorByLabel(UWorld* World, const FString& ActorLabel);
+
+    /**
+     * Find the actors of a class
+     * @param World World to search
+     * @param ActorClass Class; subclasses match too
+     * @param OutActors Receives the actors
+     */
+    void FindActorsOfClass(UWorld* World, const UClass* ActorClass, TArray<AActor*>& OutActors);
+
+    /**
+     * Find the actors carrying a tag
+     * @param World World to search
+     * @param Tag Actor tag
+     * @param OutActors Receives the actors
+     */
+    void FindActorsWithTag(UWorld* World, FName Tag, TArray<AActor*>& OutActors);
+
+    /**
+     * Find the actors whose bounds overlap a box
+     * @param World World to search
+     * @param Box World-space box
+     * @param OutActors Receives the actors
+     */
+    void FindActorsInBox(UWorld* World, const FBox& Box, TArray<AActor*>& OutActors);
+
+    /**
+     * Find the actors whose bounds overlap a sphere
+     * @param World World to search
+     * @param Center Sphere center
+     * @param Radius Sphere radius
+     * @param OutActors Receives the actors
+     */
+    void FindActorsInSphere(UWorld* World, const FVector& Center, double Radius, TArray<AActor*>& OutActors);
+
+    /**
+     * Find the actors whose bounds overlap a convex volume such as a view frustum
+     * @param World World to search
+     * @param Volume Volume with outward-facing planes
+     * @param VolumeBounds Box around the volume, limiting the cells visited
+     * @param OutActors Receives the actors
+     */
+    void FindActorsInVolume(UWorld* World, const FConvexVolume& Volume, const FBox& VolumeBounds, TArray<AActor*>& OutActors);
+
+    /**
+     * Find the actors whose bounds are closest to a point
+     * @param World World to search
+     * @param Point Point to measure from
+     * @param Count Number of actors to return
+     * @param MaxDistance Ignore actors farther than this; 0 for no limit
+     * @param OutActors Receives the actors and their distances, nearest first
+     */
+    void FindNearestActors(UWorld* World, const FVector& Point, int32 Count, double MaxDistance, TArray<TPair<AActor*, double>>& OutActors);
+
+private:
+    FActorIndex() = default;
+
+    /** What an actor was indexed under, to take it out again */
+    struct FIndexedActor
+    {
+        FString Label;
+        const UClass* Class = nullptr;
+        TArray<FName> Tags;
+    };
+
+    /** Grid cells each actor's bounds touch */
+    struct FSpatialIndex
+    {
+        bool bBuilt = false;
+        TMap<TWeakObjectPtr<AActor>, FBox> Bounds;
+        TMap<FIntVector, TArray<TWeakObjectPtr<AActor>>> Cells;
+        /** Actors spanning more than MaxCellsPerActor cells */
+        TArray<TWeakObjectPtr<AActor>> Oversized;
+        /** Union of every bounds indexed so far; only grows */
+        FBox Extent = FBox(ForceInit);
+    };
+
+    struct FWorldIndex
+    {
+        TMap<TWeakObjectPtr<AActor>, FIndexedActor> Actors;
+        TMap<FString, TArray<TWeakObjectPtr<AActor>>> ActorsByLabel;
+        TMap<const UClass*, TArray<TWeakObjectPtr<AActor>>> ActorsByClass;
+        TMap<FName, TArray<TWeakObjectPtr<AActor>>> ActorsByTag;
+        /** Actor slots across the world's levels when the index was last known current */
+        int32 ActorSlotCount = 0;
+        FSpatialIndex Spatial;
+    };
+
+    /** Edge length of a grid cell, in world units */
+    static constexpr double SpatialCellSize = 2000.0;
+
+    /** Actors touching more cells than this are checked by every query instead */
+    static constexpr int32 MaxCellsPerActor = 64;
+
+    /** Get a world's index, building it if missing or stale */
+    FWorldIndex& GetWorldIndex(UWorld* World);
+
+    /** @return Number of actor slots across a world's levels */
+    static int32 CountActorSlots(UWorld* World);
+
+    /** Get a world's index with its spatial grid built */
+    FSpatialIndex& GetSpatialIndex(UWorld* World);
+
+    /** @return The actor's component bounds, or a point at its location if it has none */
+    static FBox GetActorSpatialBounds(const AActor* Actor);
+
+    /** Get the inclusive range of grid cells a box touches */
+    static void GetCellRange(const FBox& Box, FIntVector& OutMin, FIntVector& OutMax);
+
+    static void AddActorBounds(FSpatialIndex& Spatial, AActor* Actor);
+    static void RemoveActorBounds(FSpatialIndex& Spatial, AActor* Actor);
+
+    /**
+     * Visit the live actors whose cells touch a region, with their current bounds
+     * @param Overlaps Whether an actor's current bounds count as a match
+     * @param OutMatches Receives the matching actors and their current bounds
+     */
+    void QueryRegion(UWorld* World, const FBox& Region, TFunctionRef<bool(const FBox&)> Overlaps, TArray<TPair<AActor*, FBox>>& OutMatches);
+
+    static bool IsLiveActor(const AActor* Actor);
+    static void AddActor(FWorldIndex& Index, AActor* Actor);
+    static void RemoveActor(FWorldIndex& Index, AActor* Actor);
+
+    /** Index of the world an actor belongs to, if that world is indexed */
+    FWorldIndex* FindIndexForActor(AActor* Actor);
+
+    /** Index an already indexed actor again under its current label and tags */
+    void ReindexActor(AActor* Actor);
+
+    void HandleActorAdded(AActor* Actor);
+    void HandleActorDeleted(AActor* Actor);
+    void HandleActorLabelChanged(AActor* Actor);
+    void HandleActorMoved(AActor* Actor);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& Event);
+    void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+    void HandleUndoRedo();
+    void HandleWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+    TMap<TWeakObjectPtr<UWorld>, FWorldIndex> WorldIndices;
+
+    /** Lookups that found their world's index current or had to build it */
+    FMCPCacheCounters CacheCounters;
+
+    FDelegateHandle ActorAddedHandle;
+    FDelegateHandle ActorDeletedHandle;
+    FDelegateHandle ActorLabelChangedHandle;
+    FDelegateHandle ActorMovedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle ObjectsReplacedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle WorldCleanupHandle;
+};
@@ -33,6 +33,7 @@ public:
     virtual bool AddStateToStateMachine(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, const FAnimStateParams& Params, FString& OutError) override;
     virtual bool AddStateTransition(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, const FAnimTransitionParams& Params, FString& OutError) override;
     virtual bool GetStateMachineStates(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, TArray<FString>& OutStates) override;
+    virtual bool BuildStateMachineFromSpec(UAnimBlueprint* AnimBlueprint, const FAnimStateMachineSpecParams& Spec, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
 
     // Animation Variables
     virtual bool AddAnimVariable(UAnimBlueprint* AnimBlueprint, const FString& VariableName, const FString& VariableType, const FString& DefaultValue, FString& OutError) override;
@@ -3,7 +3,11 @@
 #include "CoreMinimal.h"
 #include "Engine/Blueprint.h"
 #include "WidgetBlueprint.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
 
+struct FAssetData;
+class IAssetRegistry;
 
 /**
  * Service for discovering and loading assets in the project
@@ -12,8 +16,38 @@
 class UNREALMCP_API FAssetDiscoveryService
 {
 public:
+    /** Outcome of a lookup in the asset resolution cache */
+    enum class EAssetResolution : uint8
+    {
+        /** The cache cannot answer (not a short name, asset registry still scanning, off the game thread) */
+        Unknown,
+        /** No asset of the class has that name under /Game */
+        NotFound,
+        /** The asset was found */
+        Found
+    };
+
     static FAssetDiscoveryService& Get();
 
+    /**
+     * Resolve a short asset name to the asset's object path without loading anything
+     * The first lookup for a class indexes every asset of that class and its subclasses under /Game
+     * from the asset registry. The index is kept current from OnAssetAdded/Removed/Renamed, so a
+     * lookup is one hash probe, and a name missing from the index is a definite miss that needs no
+     * guessed-path loads. Names match case-insensitively, preferring an exact-case match.
+     * @param AssetName Asset name without a path; an object name suffix (".Name") is ignored
+     * @param AssetClass Asset class, e.g. UBlueprint::StaticClass()
+     * @param OutPath Receives the asset's object path when found
+     * @return Found or NotFound, or Unknown if the caller has to search itself
+     */
+    EAssetResolution ResolveAssetPath(const FString& AssetName, const UClass* AssetClass, FSoftObjectPath& OutPath);
+
+    /** Drop every asset index; the next lookup for a class rebuilds it */
+    void InvalidateAssetResolutionCache();
+
+    /** Stop listening to the asset registry and drop the asset indices */
+    void Shutdown();
+
     // Asset discovery methods
     TArray<FString> FindAssetsByType(const FString& AssetType, const FString& SearchPath = TEXT("/Game"));
     TArray<FString> FindAssetsByName(const FString& AssetName, const FString& SearchPath = TEXT("/Game"));
@@ -47,6 +81,36 @@ private:
     FAssetDiscoveryService() = default;
     ~FAssetDiscoveryService() = default;
 
+    /** Asset names of one asset class, for ResolveAssetPath */
+    struct FAssetIndex
+    {
+        /** Asset classes the index covers: the indexed class and its subclasses */
+        TSet<FTopLevelAssetPath> ClassPaths;
+
+        /** Object paths by lowercase asset name */
+        TMap<FString, TArray<FSoftObjectPath>> PathsByName;
+    };
+
+    /** Index every asset of a class under /Game, registering the asset registry handlers on first use */
+    FAssetIndex& BuildAssetIndex(IAssetRegistry& AssetRegistry, const FTopLevelAssetPath& ClassPath);
+
+    /** Add an asset to every index covering its class */
+    void AddToAssetIndices(const FAssetData& AssetData);
+
+    /** Remove an object path from every index */
+    void RemoveFromAssetIndices(const FSoftObjectPath& ObjectPath);
+
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Asset indices by indexed class; game thread only */
+    TMap<FTopLevelAssetPath, FAssetIndex> AssetIndices;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+
     // Helper methods
     FString BuildGamePath(const FString& Path);
     FString BuildEnginePath(const FString& Path);
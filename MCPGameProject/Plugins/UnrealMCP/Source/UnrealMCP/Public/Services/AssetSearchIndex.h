@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
+
+/**
+ * In-memory index of the asset names under /Game, for name-fragment searches
+ *
+ * Lowercase names are indexed by trigram, so a fragment of three or more characters is only
+ * checked against the assets that contain its rarest trigram instead of every asset in the project.
+ * Shorter fragments and class-only searches walk the class partitions of the index. Matches come
+ * in a stable order (the order assets entered the index) and can be paged.
+ *
+ * The index is built on the game thread the first time a search finds it missing, once the asset
+ * registry has finished its initial scan, and follows OnAssetAdded/Removed/Renamed afterwards.
+ * Until it is built, Search returns false and callers query the asset registry as before.
+ *
+ * The index is saved to Intermediate/UnrealMCP (FMCPPersistentCache) on shutdown and restored on
+ * startup when the engine build is the same, so searches are answered during the next session's
+ * initial scan too. Once the scan is done, the restored index is kept if the registry lists exactly
+ * the assets it was saved with (object paths and classes), and rebuilt otherwise.
+ *
+ * Search may be called from any thread; Initialize and Shutdown are game thread only.
+ */
+class UNREALMCP_API FAssetSearchIndex
+{
+public:
+    /** One indexed asset */
+    struct FEntry
+    {
+        FSoftObjectPath ObjectPath;
+        FName AssetName;
+        FName PackagePath;
+        FTopLevelAssetPath ClassPath;
+    };
+
+    /** Search criteria */
+    struct FQuery
+    {
+        /** Case-insensitive name fragment; empty matches every name */
+        FString NameFilter;
+        /** Asset classes; empty matches every class */
+        TArray<FTopLevelAssetPath> ClassPaths;
+        /** Whether subclasses of ClassPaths match too */
+        bool bRecursiveClasses = true;
+        /** Folder searched recursively; must be /Game or below it */
+        FString PackagePath = TEXT("/Game");
+        /** Matches skipped before the returned page */
+        int32 Offset = 0;
+        /** Most matches returned */
+        int32 Limit = MAX_int32;
+    };
+
+    static FAssetSearchIndex& Get();
+
+    /** Start following the asset registry; the index itself is built by the first search */
+    void Initialize();
+
+    /** Stop following the asset registry and drop the index */
+    void Shutdown();
+
+    /** Build the index now rather than on the first search; does nothing while the asset registry is still scanning */
+    void Prewarm();
+
+    /**
+     * Search the index
+     * @param Query Search criteria
+     * @param OutMatches Receives one page of matches
+     * @param OutTotalMatches Receives the number of matches across all pages
+     * @return false if the index cannot answer (not built yet, or a folder outside /Game); the caller queries the asset registry
+     */
+    bool Search(const FQuery& Query, TArray<FEntry>& OutMatches, int32& OutTotalMatches);
+
+    /**
+     * Object paths of every asset matching a name fragment, for the find_* helpers
+     * @param NameFilter Case-insensitive name fragment
+     * @param ClassPaths Asset classes, exact match; empty matches every class
+     * @param PackagePath Folder searched recursively
+     * @param OutPaths Receives the object paths
+     * @return false if the index cannot answer
+     */
+    bool FindObjectPaths(const FString& NameFilter, const TArray<FTopLevelAssetPath>& ClassPaths, const FString& PackagePath, TArray<FString>& OutPaths);
+
+private:
+    FAssetSearchIndex() = default;
+
+    /** Index contents; replaced as a whole when built */
+    struct FIndexData
+    {
+        /** Entries by slot; a removed asset leaves its slot behind with a null ObjectPath */
+        TArray<FEntry> Entries;
+        /** Lowercase asset names by slot */
+        TArray<FString> LowerNames;
+        /** Slots by object path */
+        TMap<FSoftObjectPath, int32> SlotsByPath;
+        /** Slots by lowercase name trigram, ascending */
+        TMap<uint64, TArray<int32>> SlotsByTrigram;
+        /** Slots by asset class, ascending */
+        TMap<FTopLevelAssetPath, TArray<int32>> SlotsByClass;
+        /** Slots left behind by removed assets */
+        int32 RemovedCount = 0;
+    };
+
+    /** Removed slots tolerated before the index is dropped and rebuilt by the next search */
+    static constexpr int32 MaxRemovedSlots = 4096;
+
+    /** Payload version of the persistent cache file */
+    static constexpr uint32 PersistentCacheVersion = 1;
+
+    /** Queue a build on the game thread, unless one is queued already */
+    void RequestBuild();
+
+    /** Build the index from the asset registry; game thread */
+    void Build();
+
+    static void AddEntry(FIndexData& Data, const FAssetData& AssetData);
+    static void AddEntry(FIndexData& Data, const FSoftObjectPath& ObjectPath, FName AssetName, FName PackagePath, const FTopLevelAssetPath& ClassPath);
+    static void RemoveEntry(FIndexData& Data, const FSoftObjectPath& ObjectPath);
+
+    /** Trigram key of the three characters at Name[Start] */
+    static uint64 MakeTrigram(const FString& Name, int32 Start);
+
+    /** Content key term of one asset; terms are summed, so the key does not depend on asset order */
+    static uint64 HashAsset(const FSoftObjectPath& ObjectPath, const FTopLevelAssetPath& ClassPath);
+
+    /** @return Content key of a sum of asset terms over a number of assets */
+    static uint64 FinishContentKey(uint64 Sum, int32 NumAssets);
+
+    /** Restore the index saved by the last session, if it was saved by this engine build */
+    void LoadPersistentState();
+
+    /** Save the index for the next session, unless it is an unchecked restored one */
+    void SavePersistentState();
+
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TUniquePtr<FIndexData> Index;
+    FRWLock IndexLock;
+    /** Set while Index is the last session's and has not been checked against the finished scan */
+    TAtomic<bool> bIndexRestored{ false };
+    /** Content key the restored index was saved with */
+    uint64 RestoredContentKey = 0;
+    TAtomic<bool> bBuildQueued{ false };
+    /** Searches answered by the index, or falling back while it is built */
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -30,6 +30,29 @@ struct FGraphNodesFilter
     FString EventType;
     FString ComponentName;  // For component_properties field
     EGraphNodesDetailLevel DetailLevel = EGraphNodesDetailLevel::Flow;
+    int32 MaxNodes = 0;     // Nodes per page; 0 for every node
+    FString Cursor;         // next_cursor of the previous page; empty for the first page
+    bool bCompactPins = false;  // Pins as "Name->NodeId.Pin" strings instead of an object
+    FString IfGraphHash;    // graph_hash the caller already holds nodes for; a graph still at it is listed without nodes
+};
+
+/**
+ * Rough cost of building a metadata section.
+ */
+enum class EMetadataSectionCost
+{
+    Cheap,      // Reads a few Blueprint fields
+    Moderate,   // Walks variables, functions, interfaces or the graph list
+    Expensive   // Walks every node, pin or property; only built when requested by name
+};
+
+/**
+ * A metadata section and its cost class.
+ */
+struct FMetadataSectionInfo
+{
+    const TCHAR* Name;
+    EMetadataSectionCost Cost;
 };
 
 /**
@@ -58,8 +81,26 @@ public:
     TSharedPtr<FJsonObject> BuildAssetInfo(UBlueprint* Blueprint) const;
     TSharedPtr<FJsonObject> BuildOrphanedNodesInfo(UBlueprint* Blueprint) const;
     TSharedPtr<FJsonObject> BuildGraphWarningsInfo(UBlueprint* Blueprint) const;
+    /**
+     * Build the graph_nodes section. Nodes are listed per graph in node GUID order, so a page cursor
+     * ("<graph>|<last node GUID>") stays valid while nodes are added or removed between pages.
+     */
     TSharedPtr<FJsonObject> BuildGraphNodesInfo(UBlueprint* Blueprint, const FGraphNodesFilter& Filter) const;
 
+    /** Every section, in response order */
+    static TConstArrayView<FMetadataSectionInfo> GetSections();
+
+    /** @return The section of that name, or nullptr */
+    static const FMetadataSectionInfo* FindSection(const FString& SectionName);
+
+    /**
+     * Keep only some keys of a built section: of each object in the section's arrays, or of the
+     * section itself when it holds no arrays
+     * @param Section - Section built by one of the builders above
+     * @param Keys - Keys to keep
+     */
+    static void ProjectSection(const TSharedPtr<FJsonObject>& Section, const TArray<FString>& Keys);
+
     // Helper methods
     FString GetPinTypeAsString(const FEdGraphPinType& PinType) const;
     bool MatchesNodeTypeFilter(UEdGraphNode* Node, const FString& NodeType) const;
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class UBlueprint;
+class UPackage;
+struct FAssetData;
+struct FObjectPostSaveContext;
+
+/**
+ * Function-level reference graph of the project's Blueprints: which function call nodes each
+ * Blueprint package holds, for the migration commands that ask who calls a function
+ *
+ * Call sites are not part of a Blueprint's asset registry tags, so a package is scanned once, the
+ * first time a lookup needs it, and answered from the index afterwards without loading it again.
+ * An entry is dropped when its package is saved, removed or renamed, and scanned again while its
+ * Blueprint has unsaved edits, so lookups always reflect the graphs as they are in the editor.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FBlueprintCallSiteIndex
+{
+public:
+    /** One function call node */
+    struct FCallSite
+    {
+        FString FunctionName;
+        /** Empty if the function has no owner class */
+        FString OwnerClassName;
+        FString OwnerClassPath;
+        FString GraphName;
+        FGuid NodeGuid;
+        FString NodeTitle;
+        int32 PosX = 0;
+        int32 PosY = 0;
+    };
+
+    /** Call sites of one Blueprint package */
+    struct FPackageCallSites
+    {
+        FString BlueprintName;
+        TArray<FCallSite> CallSites;
+    };
+
+    static FBlueprintCallSiteIndex& Get();
+
+    /** Start following package saves and the asset registry */
+    void Initialize();
+
+    /** Stop following changes and drop the index */
+    void Shutdown();
+
+    /**
+     * Call sites of the Blueprint in a package, loading and scanning it if not indexed
+     * @param PackageName Long package name, e.g. "/Game/Blueprints/BP_Player"
+     * @return The call sites, valid until the next lookup; nullptr if the package holds no Blueprint
+     */
+    const FPackageCallSites* FindPackage(FName PackageName);
+
+    /**
+     * Call sites of a loaded Blueprint, scanning it if not indexed
+     * @param Blueprint Blueprint to look up
+     * @return The call sites, valid until the next lookup
+     */
+    const FPackageCallSites& FindBlueprint(UBlueprint* Blueprint);
+
+private:
+    FBlueprintCallSiteIndex() = default;
+
+    struct FIndexedPackage
+    {
+        FPackageCallSites CallSites;
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        /** Scanned while the package had unsaved edits */
+        bool bScannedDirty = false;
+    };
+
+    /** @return Whether an entry still matches its Blueprint's graphs */
+    static bool IsCurrent(const FIndexedPackage& Indexed);
+
+    /** Index a Blueprint's call sites, replacing its package's entry */
+    FIndexedPackage& Scan(UBlueprint* Blueprint);
+
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FName, FIndexedPackage> Packages;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+struct FAssetData;
+
+/**
+ * Per-Blueprint journal of node, graph, variable and component changes, so agents can ask what
+ * changed since they last looked instead of fetching the whole metadata again
+ *
+ * A Blueprint is tracked from the first time one of its objects is modified (OnObjectModified fires
+ * before the change, so the state before it becomes the baseline) or its journal is queried. Edits
+ * are not decoded from the events: the Blueprint is snapshotted again once they settle and compared
+ * with the previous snapshot, so MCP commands, editor edits and undo/redo all land in the journal
+ * the same way. Pending changes are recorded after every MCP command that is not read-only,
+ * attributed to that command, and otherwise on the next editor tick, attributed to the editor.
+ *
+ * Each batch of changes gets the Blueprint's next revision. The oldest changes are dropped once a
+ * journal holds MaxChangesPerBlueprint; a query reaching back further is reported as truncated.
+ *
+ * Changes made to a Blueprint before it was tracked, or without any object being modified, appear
+ * with the next change that is detected.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FBlueprintChangeJournal
+{
+public:
+    /** One recorded change */
+    struct FChange
+    {
+        int32 Revision = 0;
+        /** MCP command that made the change, or "editor" */
+        FString Source;
+        /** "added", "removed" or "modified" */
+        FString Action;
+        /** "node", "graph", "variable" or "component" */
+        FString Type;
+        /** Node, graph, variable or component GUID */
+        FString Id;
+        /** Node title, or graph, variable or component name */
+        FString Name;
+        /** Graph holding the node; nodes only */
+        FString Graph;
+        /** What a modification changed, e.g. "position", "pins", "name" */
+        TArray<FString> Changed;
+    };
+
+    /** Changes recorded per Blueprint before the oldest ones are dropped */
+    static constexpr int32 MaxChangesPerBlueprint = 2000;
+
+    static FBlueprintChangeJournal& Get();
+
+    /** Start following object modifications, undo/redo and the asset registry */
+    void Initialize();
+
+    /** Stop following changes and drop every journal */
+    void Shutdown();
+
+    /**
+     * Note that an MCP command modified a Blueprint; tracks it if it was not tracked yet
+     * @param Blueprint Modified Blueprint
+     */
+    void NoteModified(UBlueprint* Blueprint);
+
+    /**
+     * Record the changes of every Blueprint with pending modifications
+     * @param Source MCP command name, or "editor"
+     */
+    void FlushPendingChanges(const FString& Source);
+
+    /**
+     * Changes of a Blueprint after a revision; starts tracking the Blueprint if needed
+     * @param Blueprint Blueprint to query
+     * @param SinceRevision Revision the caller has seen; 0 for every retained change
+     * @param OutChanges Receives the changes with a later revision, oldest first
+     * @param OutRevision Receives the Blueprint's current revision
+     * @param bOutTruncated Receives whether changes after SinceRevision were already dropped
+     */
+    void GetChangesSince(UBlueprint* Blueprint, int32 SinceRevision, TArray<FChange>& OutChanges, int32& OutRevision, bool& bOutTruncated);
+
+private:
+    FBlueprintChangeJournal() = default;
+
+    struct FNodeState
+    {
+        FString Graph;
+        FString Title;
+        FIntPoint Position = FIntPoint::ZeroValue;
+        /** Pin names, defaults and links */
+        uint32 PinsHash = 0;
+        FString Comment;
+    };
+
+    struct FNamedState
+    {
+        FString Name;
+        /** Type, defaults and flags of a variable; class and parent of a component */
+        uint32 DetailsHash = 0;
+    };
+
+    /** What the journal compares between two points in time */
+    struct FSnapshot
+    {
+        TMap<FGuid, FNodeState> Nodes;
+        TMap<FGuid, FNamedState> Graphs;
+        TMap<FGuid, FNamedState> Variables;
+        TMap<FGuid, FNamedState> Components;
+    };
+
+    struct FJournal
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        FSnapshot Snapshot;
+        TArray<FChange> Changes;
+        int32 Revision = 0;
+        /** Revision of the oldest retained change, or of the next one when none is retained */
+        int32 OldestRevision = 1;
+    };
+
+    /** @return The Blueprint's journal, tracking it from its current state if needed */
+    FJournal& FindOrStartJournal(UBlueprint* Blueprint);
+
+    /** Snapshot a Blueprint again and record how it differs from the previous snapshot */
+    void RecordChanges(FJournal& Journal, const FString& Source);
+
+    static void TakeSnapshot(UBlueprint* Blueprint, FSnapshot& OutSnapshot);
+
+    /** Add the adds and removes between two maps, and the modifications Compare reports */
+    template <typename StateType, typename CompareType>
+    static void DiffStates(const TMap<FGuid, StateType>& Before, const TMap<FGuid, StateType>& After, const TCHAR* Type, CompareType Compare, TArray<FChange>& OutChanges);
+
+    /** @return The Blueprint an object belongs to, or nullptr for objects outside Blueprints */
+    static UBlueprint* FindOwningBlueprint(UObject* Object);
+
+    void MarkPending(UBlueprint* Blueprint);
+    bool HandleTick(float DeltaTime);
+    void HandleObjectModified(UObject* Object);
+    void HandleUndoRedo();
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Journals by Blueprint object path */
+    TMap<FString, FJournal> Journals;
+    /** Object paths of Blueprints modified since their last recording */
+    TSet<FString> PendingPaths;
+    bool bInitialized = false;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Blueprint.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+class UObject;
+struct FPropertyChangedEvent;
+
+/**
+ * Outcome of the last compile_blueprint of each Blueprint, so compiling one that has not changed
+ * since answers from it instead of compiling again
+ *
+ * Agents call compile_blueprint after every edit, and again just to check the status. A result is
+ * only kept for a Blueprint its compile left up to date (with or without warnings), and is used
+ * only while the Blueprint still has that status: editing a Blueprint marks it dirty, as does a
+ * structural change to a Blueprint it depends on. A result is also dropped when one of the
+ * Blueprint's objects is modified, when an MCP command marks it as modified, and on undo/redo,
+ * which covers edits that do not touch the status.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FBlueprintCompileResultCache : public IMCPBudgetedCache
+{
+public:
+    /** What compile_blueprint reported for a compile */
+    struct FResult
+    {
+        /** Status the compile left the Blueprint in */
+        TEnumAsByte<EBlueprintStatus> Status = BS_Unknown;
+        /** "compiled successfully" or "compiled with warnings" */
+        FString StatusMessage;
+        TArray<FString> Warnings;
+        float CompilationTime = 0.0f;
+    };
+
+    static FBlueprintCompileResultCache& Get();
+
+    /** Start following modifications and undo/redo */
+    void Initialize();
+
+    /** Stop following changes and drop every result */
+    void Shutdown();
+
+    /**
+     * Result of the Blueprint's last compile, if nothing has changed since
+     * @param Blueprint Blueprint about to be compiled
+     * @return The result, valid until the next Store or edit; nullptr if the Blueprint has to be compiled
+     */
+    const FResult* Find(UBlueprint* Blueprint);
+
+    /**
+     * Keep the result of a compile that just ran; results that leave the Blueprint out of date are not kept
+     * @param Blueprint Compiled Blueprint
+     * @param Result What the compile reported
+     */
+    void Store(UBlueprint* Blueprint, const FResult& Result);
+
+    /**
+     * Drop the Blueprint's result
+     * @param Blueprint Modified Blueprint
+     */
+    void Invalidate(UBlueprint* Blueprint);
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    FBlueprintCompileResultCache() = default;
+
+    struct FCachedResult
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        FResult Result;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    /** @return The Blueprint an object belongs to, or nullptr for objects outside Blueprints */
+    static UBlueprint* FindOwningBlueprint(UObject* Object);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+
+    TMap<const UBlueprint*, FCachedResult> Results;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+class UActorComponent;
+class UBlueprint;
+class UObject;
+class USCS_Node;
+struct FPropertyChangedEvent;
+
+/**
+ * Component name -> template map for each Blueprint, so component commands find a component
+ * without walking the construction script and the class default object on every call
+ *
+ * A Blueprint's map holds, by name (FName, so case-insensitive):
+ *   - its own construction script nodes, by variable name
+ *   - construction script nodes inherited from parent Blueprints, with the template this
+ *     Blueprint overrides them with, if any
+ *   - native components of the class default object, by object name
+ * An earlier source wins when names collide, as the lookups this replaces searched in that order.
+ *
+ * A map is dropped when its Blueprint, or a parent Blueprint it took nodes from, has its
+ * construction script, a node or the Blueprint itself modified, when an MCP command marks it as
+ * modified, and on undo/redo and reinstancing. Entries are also checked on use (the node still has
+ * that name and template, the native component still belongs to the current default object), and a
+ * name that is not found rebuilds the map once before reporting it missing.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FBlueprintComponentLookupCache : public IMCPBudgetedCache
+{
+public:
+    /** A component found by name */
+    struct FComponent
+    {
+        /** Template to read or edit; the override for inherited nodes the Blueprint overrides */
+        UActorComponent* Template = nullptr;
+        /** Construction script node the component comes from; nullptr for native components */
+        USCS_Node* Node = nullptr;
+        /** True when the node belongs to a parent Blueprint's construction script */
+        bool bInherited = false;
+    };
+
+    static FBlueprintComponentLookupCache& Get();
+
+    /** Start following modifications, undo/redo and reinstancing */
+    void Initialize();
+
+    /** Stop following changes and drop every map */
+    void Shutdown();
+
+    /**
+     * Find a component of the Blueprint by name
+     * @param Blueprint Blueprint to search
+     * @param ComponentName Variable name of a construction script node, or name of a native component
+     * @param OutComponent The component, when found
+     * @return Whether the Blueprint has a component of that name
+     */
+    bool Find(UBlueprint* Blueprint, const FString& ComponentName, FComponent& OutComponent);
+
+    /**
+     * Find a component by name and return its template
+     * @return The template, or nullptr if the Blueprint has no component of that name
+     */
+    UActorComponent* FindTemplate(UBlueprint* Blueprint, const FString& ComponentName);
+
+    /**
+     * Find one of the Blueprint's own construction script nodes by variable name
+     * @return The node, or nullptr for unknown names, inherited nodes and native components
+     */
+    USCS_Node* FindOwnNode(UBlueprint* Blueprint, const FString& ComponentName);
+
+    /**
+     * Drop the Blueprint's map, and the maps of Blueprints that inherit nodes from it
+     * @param Blueprint Modified Blueprint
+     */
+    void Invalidate(UBlueprint* Blueprint);
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    FBlueprintComponentLookupCache() = default;
+
+    struct FEntry
+    {
+        TWeakObjectPtr<UActorComponent> Template;
+        TWeakObjectPtr<USCS_Node> Node;
+        bool bInherited = false;
+    };
+
+    struct FComponentMap
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        /** Parent Blueprints the inherited nodes come from */
+        TArray<TWeakObjectPtr<UBlueprint>> Parents;
+        /** Default object the native entries were taken from */
+        TWeakObjectPtr<UObject> DefaultObject;
+        TMap<FName, FEntry> Components;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    /**
+     * @param bOutBuilt Set when the map was (re)built by this call
+     * @return The Blueprint's map, built if missing or out of date
+     */
+    FComponentMap& GetMap(UBlueprint* Blueprint, bool bForceRebuild, bool& bOutBuilt);
+
+    static void BuildMap(UBlueprint* Blueprint, FComponentMap& OutMap);
+
+    /** @return Whether the entry still describes the component it was built from */
+    static bool IsEntryValid(const FComponentMap& Map, FName Name, const FEntry& Entry);
+
+    /** @return The Blueprint an object belongs to, or nullptr for objects outside Blueprints */
+    static UBlueprint* FindOwningBlueprint(UObject* Object);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+    void HandleObjectsReplaced(const TMap<UObject*, UObject*>& ReplacementMap);
+    void Clear();
+
+    TMap<const UBlueprint*, FComponentMap> Maps;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle ObjectsReplacedHandle;
+};
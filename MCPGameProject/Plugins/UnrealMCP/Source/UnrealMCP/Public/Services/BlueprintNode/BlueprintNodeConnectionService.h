@@ -86,6 +86,37 @@ public:
     bool ConnectBlueprintNodesEnhanced(UBlueprint* Blueprint, const TArray<FBlueprintNodeConnectionParams>& Connections,
                                        const FString& TargetGraph, TArray<FConnectionResultInfo>& OutResults);
 
+    /**
+     * Connect a batch of wires in one graph
+     * Every node id is resolved once, every wire is validated with the graph schema before any is
+     * made, and the nodes, graph and Blueprint are notified once after the whole batch. Wires whose
+     * pin types differ are connected through the conversion node the schema offers.
+     * @param Blueprint - Target Blueprint
+     * @param TargetGraph - Graph name to connect nodes in
+     * @param Wires - Wires to make, output pin to input pin
+     * @param bAllOrNothing - Make no wire unless every wire is valid
+     * @param OutResults - Result of each wire, in order
+     * @param OutError - Set if the graph cannot be found
+     * @return true if every wire was made
+     */
+    bool ConnectPinsBatch(UBlueprint* Blueprint, const FString& TargetGraph, const TArray<FBlueprintNodeConnectionParams>& Wires,
+                          bool bAllOrNothing, TArray<FConnectionResultInfo>& OutResults, FString& OutError);
+
+    /**
+     * Break a batch of wires in one graph
+     * Every node id is resolved once, every wire is checked to exist before any is broken, and the
+     * nodes, graph and Blueprint are notified once after the whole batch.
+     * @param Blueprint - Target Blueprint
+     * @param TargetGraph - Graph name the nodes are in
+     * @param Wires - Wires to break, output pin to input pin
+     * @param bAllOrNothing - Break no wire unless every wire exists
+     * @param OutResults - Result of each wire, in order
+     * @param OutError - Set if the graph cannot be found
+     * @return true if every wire was broken
+     */
+    bool DisconnectPinsBatch(UBlueprint* Blueprint, const FString& TargetGraph, const TArray<FBlueprintNodeConnectionParams>& Wires,
+                             bool bAllOrNothing, TArray<FConnectionResultInfo>& OutResults, FString& OutError);
+
     /**
      * Check if two pins can be connected (uses Unreal's schema validation)
      * This is the same validation Unreal uses in the UI when you try to connect pins.
@@ -147,6 +178,11 @@ private:
     /** Private constructor for singleton pattern */
     FBlueprintNodeConnectionService() = default;
 
+    /**
+     * Find the graph a connection request targets; the EventGraph is created if missing
+     */
+    static UEdGraph* FindTargetGraph(UBlueprint* Blueprint, const FString& TargetGraph);
+
     /**
      * Check if two pin types are compatible or need a cast
      */
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+/**
+ * A saved group of nodes, in the text form the graph editor copies nodes to the clipboard in
+ */
+struct UNREALMCP_API FGraphSnippet
+{
+    /** A node of the snippet */
+    struct FNode
+    {
+        /** Name paste overrides and results refer to the node by */
+        FString Key;
+        /** NodeGuid of the copied node, which the text keeps */
+        FGuid Guid;
+        FString Title;
+        FString Class;
+    };
+
+    FString Name;
+    FString Description;
+    /** Path of the schema class of the graph the nodes were copied from */
+    FString SchemaClass;
+    /** FEdGraphUtilities::ExportNodesToText output */
+    FString Text;
+    TArray<FNode> Nodes;
+};
+
+/**
+ * Changes made to one node of a snippet as it is pasted
+ */
+struct UNREALMCP_API FGraphSnippetNodeOverride
+{
+    /** Pin name to default value, in the form the schema takes it (TrySetDefaultValue) */
+    TMap<FString, FString> PinValues;
+    /** Member variable a variable get/set node refers to instead; empty to keep it */
+    FString Variable;
+};
+
+/**
+ * A snippet node as pasted
+ */
+struct UNREALMCP_API FPastedSnippetNode
+{
+    FString Key;
+    UEdGraphNode* Node = nullptr;
+};
+
+/**
+ * Library of node snippets, saved with save_graph_snippet and pasted with paste_graph_snippet
+ *
+ * Saving copies nodes as the graph editor's Copy does (PrepareForCopying, ExportNodesToText,
+ * PostCopyNode) and pasting imports them as its Paste does (ImportNodesFromText, new GUIDs, moved
+ * to the requested position), so a pattern of several nodes and their links is recreated in one
+ * import instead of node by node through the action spawners. Links to nodes outside the snippet
+ * are dropped on paste.
+ *
+ * Snippets are kept in memory and written to Saved/UnrealMCP/Snippets/<name>.json, which are read
+ * the first time the library is used, so they outlive the editor session.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FGraphSnippetService
+{
+public:
+    static FGraphSnippetService& Get();
+
+    /**
+     * Save nodes of a graph as a snippet
+     * @param Graph Graph holding the nodes
+     * @param Nodes Nodes to save; nodes that cannot be duplicated (function entries, ...) are refused
+     * @param Keys Key of each node, or empty for "node0", "node1", ...
+     * @param Name Snippet name: letters, digits, '_' and '-'
+     * @param Description Free text listed with the snippet
+     * @param bOverwrite Replace a snippet of the same name
+     * @param OutError Set on failure
+     * @return The saved snippet, or nullptr on failure
+     */
+    const FGraphSnippet* SaveSnippet(UEdGraph* Graph, const TArray<UEdGraphNode*>& Nodes, const TArray<FString>& Keys,
+        const FString& Name, const FString& Description, bool bOverwrite, FString& OutError);
+
+    /**
+     * Paste a snippet into a graph, in one FMCPBatchEditScope
+     * @param Graph Graph to paste into
+     * @param Snippet Snippet to paste
+     * @param Position Where the snippet's top left node goes
+     * @param Overrides Changes by node key
+     * @param OutNodes The pasted nodes in snippet order; a node the graph refused is left out
+     * @param OutWarnings Overrides that could not be applied
+     * @param OutError Set on failure
+     * @return true if the snippet was pasted
+     */
+    bool PasteSnippet(UEdGraph* Graph, const FGraphSnippet& Snippet, const FIntPoint& Position,
+        const TMap<FString, FGraphSnippetNodeOverride>& Overrides, TArray<FPastedSnippetNode>& OutNodes,
+        TArray<FString>& OutWarnings, FString& OutError);
+
+    /** @return The snippet of that name, or nullptr */
+    const FGraphSnippet* FindSnippet(const FString& Name);
+
+    /** @return Every snippet, sorted by name */
+    TArray<const FGraphSnippet*> GetSnippets();
+
+    /** @return Saved/UnrealMCP/Snippets/ */
+    static FString GetSnippetDirectory();
+
+private:
+    FGraphSnippetService() = default;
+
+    /** Read the snippet files on first use */
+    void EnsureLoaded();
+
+    static bool IsValidName(const FString& Name);
+    static bool WriteSnippetFile(const FGraphSnippet& Snippet);
+    static bool ReadSnippetFile(const FString& FilePath, FGraphSnippet& OutSnippet);
+
+    TMap<FString, FGraphSnippet> Snippets;
+    bool bLoaded = false;
+};
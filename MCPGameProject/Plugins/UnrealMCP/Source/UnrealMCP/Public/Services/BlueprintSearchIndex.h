@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPCacheStats.h"
+
+class UBlueprint;
+class UEdGraphNode;
+class UPackage;
+struct FAssetData;
+struct FObjectPostSaveContext;
+
+/**
+ * Kinds of node find_in_blueprints can be restricted to
+ */
+enum class EBlueprintSearchNodeKind : uint8
+{
+    None = 0,
+    Function = 1 << 0,
+    Variable = 1 << 1,
+    Event = 1 << 2,
+    CustomEvent = 1 << 3,
+    Comment = 1 << 4
+};
+ENUM_CLASS_FLAGS(EBlueprintSearchNodeKind);
+
+/**
+ * Searchable text of every node of the project's Blueprints, for find_in_blueprints
+ *
+ * A package is indexed from its loaded Blueprint the first time a search reaches it: each node's
+ * titles, the function, variable and event it references, its comment and its pins' default values.
+ * Searches answer from the index afterwards without loading the Blueprint again. An entry is kept
+ * with its package file's timestamp and not used once the file changes; saving a Blueprint in the
+ * editor re-indexes it right away. Blueprints with unsaved edits are indexed from the editor's copy
+ * on every search and not kept, so results always reflect the graphs as they are in the editor.
+ *
+ * Entries persist across sessions in Saved/UnrealMCP/BlueprintSearchIndex.json, read by Initialize
+ * and written by Shutdown.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FBlueprintSearchIndex
+{
+public:
+    /** One graph node */
+    struct FNode
+    {
+        /** Index into FPackageEntry::GraphNames */
+        int32 GraphIndex = 0;
+        FString NodeId;
+        FString NodeClass;
+        EBlueprintSearchNodeKind Kinds = EBlueprintSearchNodeKind::None;
+        /** Text a query is matched against; the first is the node's list view title */
+        TArray<FString> SearchableStrings;
+    };
+
+    /** Nodes of the Blueprint in one package */
+    struct FPackageEntry
+    {
+        FString BlueprintPath;
+        FString BlueprintName;
+        TArray<FString> GraphNames;
+        TArray<FNode> Nodes;
+    };
+
+    static FBlueprintSearchIndex& Get();
+
+    /** Read the entries of the last session and start following package saves and the asset registry */
+    void Initialize();
+
+    /** Stop following changes, write the entries that are still current and drop them */
+    void Shutdown();
+
+    /**
+     * Nodes of a Blueprint if they can be had without loading it: from a current entry, or by
+     * indexing the Blueprint if it is loaded already
+     * @param BlueprintPath - Object path, e.g. "/Game/Blueprints/BP_Player.BP_Player"
+     * @return The entry, valid until the next lookup; nullptr if the Blueprint has to be loaded first
+     */
+    const FPackageEntry* FindWithoutLoading(const FString& BlueprintPath);
+
+    /**
+     * Nodes of a loaded Blueprint, indexing it if no current entry is kept
+     * @return The entry, valid until the next lookup
+     */
+    const FPackageEntry& FindOrIndex(UBlueprint* Blueprint);
+
+private:
+    FBlueprintSearchIndex() = default;
+
+    struct FIndexedPackage
+    {
+        FPackageEntry Entry;
+        /** Package file timestamp the entry was indexed against */
+        FDateTime PackageTimestamp;
+    };
+
+    /** @return The package's entry if it is still current; a stale entry is dropped */
+    const FPackageEntry* FindCurrent(FName PackageName);
+
+    /** Fill an entry from a loaded Blueprint */
+    static void IndexBlueprint(UBlueprint* Blueprint, FPackageEntry& OutEntry);
+
+    /** Collect what a node can be found by */
+    static void IndexNode(UEdGraphNode* Node, FNode& OutNode);
+
+    /** @return Whether the package has a file, and if so set its timestamp */
+    static bool GetPackageTimestamp(FName PackageName, FDateTime& OutTimestamp);
+
+    static FString GetPersistentStatePath();
+    int32 LoadPersistentState();
+    void SavePersistentState() const;
+
+    void HandlePackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext ObjectSaveContext);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FName, FIndexedPackage> Packages;
+    /** Result for Blueprints that cannot be kept: unsaved, or indexed before Initialize */
+    FPackageEntry UncachedEntry;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+    bool bDirty = false;
+
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
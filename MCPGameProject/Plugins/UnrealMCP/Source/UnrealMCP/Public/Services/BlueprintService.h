@@ -29,6 +29,7 @@ public:
     virtual UBlueprint* CreateBlueprint(const FBlueprintCreationParams& Params) override;
     virtual bool AddComponentToBlueprint(UBlueprint* Blueprint, const FComponentCreationParams& Params, FString& OutErrorMessage) override;
     virtual bool CompileBlueprint(UBlueprint* Blueprint, FString& OutError) override;
+    virtual bool CompileBlueprintSkeleton(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings) override;
     virtual UBlueprint* FindBlueprint(const FString& BlueprintName) override;
     virtual bool AddVariableToBlueprint(UBlueprint* Blueprint, const FString& VariableName, const FString& VariableType, bool bIsExposed = false) override;
     virtual bool SetBlueprintProperty(UBlueprint* Blueprint, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutErrorMessage) override;
@@ -51,6 +52,17 @@ public:
      */
     bool ConvertStringToPinType(const FString& TypeString, FEdGraphPinType& OutPinType) const;
 
+    /**
+     * Restore the blueprint lookups of the last editor session and preload its recent blueprints
+     * Call once at startup, on the game thread
+     */
+    void WarmStartCache();
+
+    /**
+     * Save the blueprint lookups of this session for the next warm start
+     */
+    void SaveCacheState() const;
+
 private:
     /** Private constructor for singleton pattern */
     FBlueprintService();
@@ -4,144 +4,6 @@
 #include "Services/IComponentService.h"
 #include "Engine/Blueprint.h"
 
-/**
- * Component type cache statistics for monitoring performance
- */
-struct UNREALMCP_API FComponentTypeCacheStats
-{
-    /** Total number of cache requests */
-    int32 TotalRequests = 0;
-    
-    /** Number of cache hits */
-    int32 CacheHits = 0;
-    
-    /** Number of cache misses */
-    int32 CacheMisses = 0;
-    
-    /** Number of cached component types */
-    int32 CachedCount = 0;
-    
-    /** Number of cache refreshes */
-    int32 RefreshCount = 0;
-    
-    /** Cache hit ratio (0.0 to 1.0) */
-    float GetHitRatio() const
-    {
-        return TotalRequests > 0 ? static_cast<float>(CacheHits) / static_cast<float>(TotalRequests) : 0.0f;
-    }
-    
-    /** Reset all statistics */
-    void Reset()
-    {
-        TotalRequests = 0;
-        CacheHits = 0;
-        CacheMisses = 0;
-        CachedCount = 0;
-        RefreshCount = 0;
-    }
-};
-
-/**
- * Component type cache for performance optimization
- * Thread-safe caching of component class lookups with automatic refresh and lazy loading
- */
-class UNREALMCP_API FComponentTypeCache
-{
-public:
-    /**
-     * Get a cached component class by type string
-     * @param ComponentType - String representation of component type
-     * @return Cached UClass pointer or nullptr if not found
-     */
-    UClass* GetComponentClass(const FString& ComponentType);
-    
-    /**
-     * Cache a component class for future lookups
-     * @param ComponentType - String representation of component type
-     * @param ComponentClass - UClass pointer to cache
-     */
-    void CacheComponentClass(const FString& ComponentType, UClass* ComponentClass);
-    
-    /**
-     * Refresh the cache with current module state
-     * Called automatically when modules are loaded/unloaded
-     */
-    void RefreshCache();
-    
-    /**
-     * Preload common component types into cache
-     */
-    void PreloadCommonComponentTypes();
-    
-    /**
-     * Check if a component type is cached
-     * @param ComponentType - String representation of component type
-     * @return true if the component type is cached
-     */
-    bool IsCached(const FString& ComponentType) const;
-    
-    /**
-     * Clear all cached component types
-     */
-    void ClearCache();
-    
-    /**
-     * Get cache statistics for monitoring
-     * @return Current cache statistics
-     */
-    FComponentTypeCacheStats GetCacheStats() const;
-    
-    /**
-     * Reset cache statistics
-     */
-    void ResetCacheStats();
-    
-    /**
-     * Get the number of cached component types
-     * @return Number of currently cached component types
-     */
-    int32 GetCachedCount() const;
-
-private:
-    /** Map of component type strings to weak class pointers */
-    TMap<FString, TWeakObjectPtr<UClass>> CachedComponentClasses;
-    
-    /** Cache statistics for monitoring */
-    mutable FComponentTypeCacheStats CacheStats;
-    
-    /** Critical section for thread safety */
-    mutable FCriticalSection CacheLock;
-    
-    /** Flag to track if cache needs refresh */
-    bool bNeedsRefresh = true;
-    
-    /**
-     * Update cache statistics (must be called with lock held)
-     * @param bWasHit - Whether this was a cache hit or miss
-     */
-    void UpdateStats(bool bWasHit) const;
-    
-    /**
-     * Lazy load component class if not cached
-     * @param ComponentType - String representation of component type
-     * @return UClass pointer or nullptr if not found
-     */
-    UClass* LazyLoadComponentClass(const FString& ComponentType);
-    
-    /**
-     * Get supported component types mapping
-     * @return Map of component type strings to their full class names
-     */
-    TMap<FString, FString> GetSupportedComponentTypes() const;
-    
-    /**
-     * Resolve component class from type string (internal implementation)
-     * @param ComponentType - String representation of component type
-     * @return UClass pointer or nullptr if not found
-     */
-    UClass* ResolveComponentClassInternal(const FString& ComponentType) const;
-};
-
 /**
  * Concrete implementation of IComponentService
  * Provides component creation, modification, and management functionality
@@ -163,6 +25,17 @@ public:
     virtual bool IsValidComponentType(const FString& ComponentType) override;
     virtual UClass* GetComponentClass(const FString& ComponentType) override;
     
+    /**
+     * Add a component to a blueprint's construction script
+     * @param Blueprint - Target blueprint
+     * @param Params - Component to add
+     * @param OutErrorMessage - Receives the reason on failure
+     * @param bDeferStructuralUpdate - Leave marking the blueprint structurally modified and refreshing
+     *        its nodes to the caller, which does it once for a batch of components
+     * @return True if the component was added
+     */
+    bool AddComponentToBlueprint(UBlueprint* Blueprint, const FComponentCreationParams& Params, FString& OutErrorMessage, bool bDeferStructuralUpdate);
+    
     /**
      * Set physics properties on a component
      * @param Blueprint - Target blueprint
@@ -185,22 +58,6 @@ private:
     /** Private constructor for singleton pattern */
     FComponentService() = default;
     
-    /** Component type cache for performance optimization */
-    FComponentTypeCache ComponentTypeCache;
-    
-    /**
-     * Get supported component types mapping
-     * @return Map of component type strings to their full class names
-     */
-    TMap<FString, FString> GetSupportedComponentTypes() const;
-    
-    /**
-     * Resolve component class from type string
-     * @param ComponentType - String representation of component type
-     * @return UClass pointer or nullptr if not found
-     */
-    UClass* ResolveComponentClass(const FString& ComponentType) const;
-    
     /**
      * Set transform properties on a scene component
      * @param SceneComponent - Target scene component
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
+
+/**
+ * Asset registry catalog of DataTables, so FindDataTable resolves a name with a map lookup
+ * instead of loading guessed paths one after the other
+ *
+ * One registry query lists every DataTable (composite tables included) with its object path and
+ * the row struct from its RowStructure tag; a name then resolves without loading anything, and a
+ * table's row struct is known before the table is loaded. The catalog is dropped when a DataTable
+ * asset is added, removed, renamed or updated, and is not built while the registry is still
+ * scanning, when lookups answer Unknown and callers fall back to probing.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FDataTableCatalog
+{
+public:
+    /** One DataTable asset */
+    struct FEntry
+    {
+        FSoftObjectPath ObjectPath;
+        /** Path of the row struct, or its short name for tables saved by engines that wrote one */
+        FString RowStructPath;
+    };
+
+    /** Result of resolving a name */
+    enum class EResolution : uint8
+    {
+        /** The catalog cannot answer (registry still scanning, off the game thread) */
+        Unknown,
+        /** No DataTable has that name or path */
+        NotFound,
+        /** The DataTable was found */
+        Found
+    };
+
+    static FDataTableCatalog& Get();
+
+    /** Start following asset registry changes */
+    void Initialize();
+
+    /** Stop following changes and drop the catalog */
+    void Shutdown();
+
+    /** List the DataTables now rather than on the first lookup; does nothing while the asset registry is still scanning */
+    void Prewarm();
+
+    /**
+     * Find a DataTable by name or path
+     * Short names ("ItemTable") prefer /Game/Data, then /Game/DataTables, then the /Game root,
+     * then the first path in alphabetical order, as FindDataTable's path guesses did.
+     * @param NameOrPath Short name, package path or object path, compared case-insensitively
+     * @param OutEntry Receives the table's entry when found
+     * @return Whether the name resolved
+     */
+    EResolution Resolve(const FString& NameOrPath, FEntry& OutEntry);
+
+private:
+    FDataTableCatalog() = default;
+
+    /** List every DataTable from the asset registry, if not done since the last invalidation */
+    bool EnsureBuilt();
+
+    /** @return Lower preference first: how well a table's folder matches where short names were looked for */
+    static int32 GetFolderRank(const FSoftObjectPath& ObjectPath);
+
+    void Invalidate();
+
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TArray<FEntry> Entries;
+    /** Entry of each lowercase short name, best-ranked table first */
+    TMap<FString, int32> EntryByName;
+    /** Entry of each lowercase object path and package path */
+    TMap<FString, int32> EntryByPath;
+    bool bBuilt = false;
+
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "MCPCacheStats.h"
+
+class UDataTable;
+class UObject;
+struct FPropertyChangedEvent;
+
+/**
+ * Content hashes of DataTable rows and a Merkle root per table, for get_datatable_fingerprint
+ *
+ * A row's hash is the 64-bit xxHash of its name and its tagged property serialization, with
+ * object references written as paths, so it only depends on the row's values. The table's root
+ * hashes the row hashes pairwise, in row map order, up to a single hash, and includes the row
+ * struct's path; two tables with the same root hold the same rows.
+ *
+ * Hashes are kept per table and dropped when the table is modified (Modify, which every edit
+ * path calls before writing rows), when one of its properties changes and on undo/redo, so a
+ * table that did not change is fingerprinted without reading its rows again. A row count or row
+ * struct size that no longer matches also drops them.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FDataTableFingerprintIndex
+{
+public:
+    /** Hashes of one table */
+    struct FFingerprint
+    {
+        /** Row names and their hashes, in row map order */
+        TArray<TPair<FName, uint64>> RowHashes;
+        uint64 RootHash = 0;
+        /** Row struct size when the hashes were built, which a struct edit usually changes */
+        int32 StructureSize = 0;
+    };
+
+    static FDataTableFingerprintIndex& Get();
+
+    /** Start following object modifications and undo/redo */
+    void Initialize();
+
+    /** Stop following changes and drop every table's hashes */
+    void Shutdown();
+
+    /**
+     * Hashes of a table
+     * @param DataTable Table to fingerprint
+     * @param bOutWasCached Set to whether the hashes were kept from an earlier call
+     * @return The hashes, which stay valid while held even if the table changes
+     */
+    TSharedRef<const FFingerprint> GetFingerprint(const UDataTable* DataTable, bool& bOutWasCached);
+
+    /** Drop the hashes of a table after it changed */
+    void Invalidate(const UDataTable* DataTable);
+
+    /** @return A hash as 16 lowercase hex digits */
+    static FString HashToString(uint64 Hash);
+
+private:
+    FDataTableFingerprintIndex() = default;
+
+    static TSharedRef<const FFingerprint> Build(const UDataTable* DataTable);
+
+    /** @return The hash of one row's name and values */
+    static uint64 HashRow(const UScriptStruct* RowStruct, const FName& RowName, uint8* RowPtr, TArray<uint8>& Scratch);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+
+    TMap<TObjectKey<UDataTable>, TSharedRef<const FFingerprint>> Fingerprints;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+};
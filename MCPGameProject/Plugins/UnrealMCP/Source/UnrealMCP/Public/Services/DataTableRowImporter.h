@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+class FJsonValue;
+class FProperty;
+class UScriptStruct;
+
+/**
+ * Converts JSON rows into DataTable row memory for bulk imports
+ *
+ * Everything add_rows_to_datatable works out again for every row is worked out once per row
+ * struct here: the properties each accepted field name writes (GUID name, authored name and
+ * friendly name, compared case-insensitively), and for arrays of structs the renames that turn
+ * GUID-named element fields into the names the JSON converter expects. Converting a row is then
+ * one lookup and one JsonValueToUProperty per field, written straight into the row.
+ *
+ * Fields the row does not name keep the struct defaults, which is what FillMissingFields'
+ * placeholders amount to; unknown fields are ignored, as JsonAttributesToUStruct ignores them.
+ *
+ * The importer is built on the game thread. ConvertRow only reads it afterwards, so rows of a
+ * struct without object references can be converted on worker threads; see CanConvertOffGameThread.
+ */
+class UNREALMCP_API FDataTableRowImporter
+{
+public:
+    explicit FDataTableRowImporter(const UScriptStruct* InRowStruct);
+
+    /**
+     * Write one row's fields over row memory initialized for the row struct
+     * @param RowData Field values of the row
+     * @param RowMemory Initialized row
+     * @param OutError Fields that could not be converted
+     * @return true if every known field converted
+     */
+    bool ConvertRow(const FJsonObject& RowData, uint8* RowMemory, FString& OutError) const;
+
+    /**
+     * Find the field a column or key name writes
+     * @param Name Field name, compared case-insensitively
+     * @return Field index for ImportFieldText, or INDEX_NONE
+     */
+    int32 FindField(const FString& Name) const;
+
+    /**
+     * Import a field from property text, as the editor's CSV import does
+     * @param FieldIndex Field index from FindField
+     * @param Text Property text of the value
+     * @param RowMemory Initialized row
+     * @return true if the text was imported
+     */
+    bool ImportFieldText(int32 FieldIndex, const FString& Text, uint8* RowMemory) const;
+
+    const UScriptStruct* GetRowStruct() const { return RowStruct; }
+
+    /**
+     * Whether ConvertRow may run on worker threads. It may not when the struct holds object,
+     * class or interface references or natively imported structs anywhere, as importing those
+     * may find or load objects.
+     */
+    bool CanConvertOffGameThread() const { return bThreadSafe; }
+
+private:
+    /** One property of the row struct */
+    struct FFieldHandler
+    {
+        FProperty* Property = nullptr;
+        /** Element field renames of an array of structs, GUID name to authored name; empty for other properties */
+        TMap<FString, FString> ElementRenames;
+    };
+
+    /** Field name a row may use for a handler */
+    struct FFieldKey
+    {
+        int32 HandlerIndex = INDEX_NONE;
+        /** The property's own (GUID) name, which wins over its friendly names in the same row */
+        bool bExactName = false;
+    };
+
+    /** @return true if importing a value of the property never resolves an object */
+    static bool IsThreadSafeProperty(const FProperty* Property, TSet<const UStruct*>& VisitedStructs);
+
+    /** @return The value to convert, with array elements renamed if the handler needs it */
+    static TSharedPtr<FJsonValue> RenameElementFields(const FFieldHandler& Handler, const TSharedPtr<FJsonValue>& Value);
+
+    const UScriptStruct* RowStruct = nullptr;
+    TArray<FFieldHandler> Handlers;
+    /** Accepted field names; FString keys compare case-insensitively */
+    TMap<FString, FFieldKey> Keys;
+    bool bThreadSafe = true;
+};
@@ -17,14 +17,30 @@ public:
     virtual UDataTable* CreateDataTable(const FDataTableCreationParams& Params) override;
     virtual UDataTable* FindDataTable(const FString& DataTableName) override;
     virtual bool AddRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows) override;
+    virtual bool ImportRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows) override;
+    virtual bool ImportRowsFromFile(UDataTable* DataTable, const FDataTableFileImportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
+    virtual bool ExportDataTableToFile(const UDataTable* DataTable, const FDataTableFileExportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
     virtual bool UpdateRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutUpdatedRows, TArray<FString>& OutFailedRows) override;
+    virtual bool UpsertRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, FDataTableUpsertResult& OutResult) override;
     virtual bool DeleteRowsFromDataTable(UDataTable* DataTable, const TArray<FString>& RowNames, TArray<FString>& OutDeletedRows, TArray<FString>& OutFailedRows) override;
     virtual TSharedPtr<FJsonObject> GetDataTableRows(const UDataTable* DataTable, const TArray<FString>& RowNames = TArray<FString>()) override;
+    virtual bool QueryDataTableRows(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) override;
     virtual bool GetDataTableRowNames(const UDataTable* DataTable, TArray<FString>& OutRowNames, TArray<FString>& OutFieldNames) override;
     virtual TSharedPtr<FJsonObject> GetDataTablePropertyMap(const UDataTable* DataTable) override;
+    virtual TSharedPtr<FJsonObject> GetDataTablePropertyMap(const FString& DataTableName) override;
     virtual bool ValidateRowData(const UDataTable* DataTable, const TSharedPtr<FJsonObject>& RowData, FString& OutError) override;
+    virtual UCurveTable* FindCurveTable(const FString& CurveTableName) override;
+    virtual bool QueryCurveTableRows(const UCurveTable* CurveTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) override;
+    virtual bool WriteCurveTableRows(UCurveTable* CurveTable, const TArray<FCurveTableRowParams>& Rows, FDataTableUpsertResult& OutResult) override;
+    virtual bool GetCompositeDataTableStack(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) override;
 
 private:
+    /** Bulk imports smaller than this convert their rows on the game thread */
+    static constexpr int32 BulkImportParallelMinRows = 256;
+    
+    /** Rows a worker converts per batch of a parallel bulk import */
+    static constexpr int32 BulkImportParallelBatchSize = 32;
+    
     /**
      * Find struct by trying multiple path variations
      * @param StructName - Name or path of the struct
@@ -57,6 +73,13 @@ private:
      */
     TSharedPtr<FJsonObject> AutoTransformFromGuidNames(const TSharedPtr<FJsonObject>& InJson, const UScriptStruct* RowStruct);
     
+    /**
+     * Map each field's authored name to its property name
+     * @param RowStruct - Row struct to describe
+     * @return JSON object containing the property mapping
+     */
+    TSharedPtr<FJsonObject> BuildPropertyMap(const UScriptStruct* RowStruct);
+    
     /**
      * Convert a single row to JSON
      * @param DataTable - Source DataTable
@@ -65,6 +88,37 @@ private:
      */
     TSharedPtr<FJsonObject> RowToJson(const UDataTable* DataTable, const FName& RowName);
     
+    /**
+     * Convert some fields of a single row to JSON, named as RowToJson names them
+     * @param DataTable - Source DataTable
+     * @param RowName - Name of the row to convert
+     * @param RowPtr - Memory of the row
+     * @param Fields - Properties of the row struct to convert
+     * @return JSON representation of the row with only those fields in row_data
+     */
+    TSharedPtr<FJsonObject> ProjectedRowToJson(const UDataTable* DataTable, const FName& RowName, const uint8* RowPtr, const TArray<const FProperty*>& Fields);
+    
+    /**
+     * Give a bulk-imported row to a DataTable's row map, replacing any row of the same name
+     * @param RowMap - Row map of the DataTable
+     * @param RowStruct - Row struct of the DataTable
+     * @param RowName - Name of the row
+     * @param RowMemory - Row allocated with FMemory::Malloc and initialized; owned by the table afterwards
+     */
+    void HandOverImportedRow(TMap<FName, uint8*>& RowMap, const UScriptStruct* RowStruct, const FName& RowName, uint8* RowMemory);
+    
+    /**
+     * Notify and save a CurveTable once after a batch of row writes
+     * @param CurveTable - CurveTable rows were written to
+     */
+    void FinishCurveTableWrite(UCurveTable* CurveTable);
+    
+    /**
+     * Notify, save and refresh a DataTable once after a bulk import
+     * @param DataTable - DataTable rows were imported into
+     */
+    void FinishBulkImport(UDataTable* DataTable);
+    
     /**
      * Refresh DataTable editor UI
      * @param DataTable - DataTable to refresh
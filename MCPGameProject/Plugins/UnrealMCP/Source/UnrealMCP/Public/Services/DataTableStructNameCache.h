@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+class FProperty;
+class UScriptStruct;
+
+/**
+ * GUID and friendly field names of DataTable row structs, worked out once per struct
+ *
+ * User-defined structs name their properties "Name_<n>_<guid>"; the DataTable transforms map
+ * those to friendly names and back for every row, and for every element of a nested struct
+ * array. The maps only change when the struct does, so they are kept per struct and checked
+ * against the struct's GUID on each lookup. FStructureEditorUtils change notifications drop a
+ * user-defined struct's maps when it is edited; native structs do not change while the editor
+ * runs.
+ *
+ * FString keys compare case-insensitively, as in the maps this replaces.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FDataTableStructNameCache : public IMCPBudgetedCache
+{
+public:
+    /** Field names of one struct */
+    struct FStructNames
+    {
+        /** Property (GUID) name to friendly name */
+        TMap<FString, FString> GuidToFriendly;
+        /** Property name to the camelCase friendly name the transforms emit */
+        TMap<FString, FString> GuidToCamelCaseFriendly;
+        /** Friendly name to property name */
+        TMap<FString, FString> FriendlyToGuid;
+        /** Property name to authored name */
+        TMap<FString, FString> GuidToAuthored;
+        /** Properties by property name */
+        TMap<FString, FProperty*> PropertiesByName;
+        /** Properties by property, friendly or authored name; property names win over the others */
+        TMap<FString, FProperty*> PropertiesByFieldName;
+    };
+
+    static FDataTableStructNameCache& Get();
+
+    /** Start following user-defined struct edits */
+    void Initialize();
+
+    /** Stop following edits and drop every struct's names */
+    void Shutdown();
+
+    /**
+     * Field names of a struct
+     * @param Struct Struct to describe
+     * @return The names, which stay valid while held even if the struct changes
+     */
+    TSharedRef<const FStructNames> GetNames(const UScriptStruct* Struct);
+
+    /** Drop the names of a struct after it changed */
+    void Invalidate(const UScriptStruct* Struct);
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    FDataTableStructNameCache() = default;
+
+    struct FEntry
+    {
+        /** GetCustomGuid of the struct when the names were built */
+        FGuid StructGuid;
+        TSharedRef<const FStructNames> Names;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    static TSharedRef<const FStructNames> Build(const UScriptStruct* Struct);
+
+    /** @return About how many bytes a struct's names hold */
+    static int64 GetNamesSize(const FStructNames& Names);
+
+    TMap<TObjectKey<UScriptStruct>, FEntry> Entries;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    /** FStructureEditorUtils listener; registers itself while it exists */
+    class FStructChangeListener;
+    TUniquePtr<FStructChangeListener> StructChangeListener;
+};
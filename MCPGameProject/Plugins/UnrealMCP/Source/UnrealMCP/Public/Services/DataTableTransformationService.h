@@ -6,6 +6,7 @@
 
 /**
  * Service responsible for transforming DataTable field names between GUID and friendly formats
+ * The name maps of each struct come from FDataTableStructNameCache
  */
 class UNREALMCP_API FDataTableTransformationService
 {
@@ -27,27 +28,12 @@ public:
      */
     static bool IsGuidField(const FString& FieldName);
 
-private:
-    /**
-     * Build mapping from friendly names to GUID names for a struct
-     */
-    static TMap<FString, FString> BuildFriendlyToGuidMap(const UScriptStruct* Struct);
-
-    /**
-     * Build mapping from GUID names to friendly names for a struct
-     */
-    static TMap<FString, FString> BuildGuidToFriendlyMap(const UScriptStruct* Struct);
-
-    /**
-     * Convert PascalCase to camelCase for better API compatibility
-     */
-    static FString ConvertToCamelCase(const FString& PascalCase);
-
     /**
      * Extract friendly name from GUID field name by removing GUID suffix
      */
     static FString ExtractFriendlyName(const FString& GuidFieldName);
 
+private:
     /**
      * Transform array elements recursively for nested structs
      */
@@ -27,12 +27,20 @@ public:
     // IEditorService interface implementation
     virtual TArray<AActor*> GetActorsInLevel() override;
     virtual TArray<AActor*> FindActorsByName(const FString& Pattern) override;
+    virtual bool QueryActorsSpatial(const FActorSpatialQuery& Query, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError) override;
+    virtual bool FindActors(const FActorListFilter& Filter, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError) override;
     virtual AActor* SpawnActor(const FActorSpawnParams& Params, FString& OutError) override;
+    virtual TArray<AActor*> SpawnActorsDeferred(const TArray<FActorSpawnParams>& Params, TArray<FString>& OutErrors) override;
+    virtual AActor* SpawnInstancedMeshActor(const FString& Name, const TArray<FInstancedMeshGroup>& Groups, bool bHierarchical, TArray<FString>& OutComponentNames, FString& OutError) override;
+    virtual AActor* ConvertActorsToInstances(const TArray<FString>& ActorNames, const FString& InstancedActorName, bool bHierarchical, bool bDeleteSourceActors, TArray<FString>& OutConvertedActors, TArray<FString>& OutSkippedActors, FString& OutError) override;
     virtual AActor* SpawnBlueprintActor(const FBlueprintActorSpawnParams& Params, FString& OutError) override;
     virtual bool DeleteActor(const FString& ActorName, FString& OutError) override;
+    virtual int32 DeleteActors(const TArray<FString>& ActorNames, bool bCollectGarbage, TArray<FString>& OutErrors) override;
     virtual AActor* FindActorByName(const FString& ActorName) override;
     virtual bool SetActorTransform(AActor* Actor, const FVector* Location = nullptr, const FRotator* Rotation = nullptr, const FVector* Scale = nullptr) override;
     virtual bool SetActorProperty(AActor* Actor, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) override;
+    virtual int32 SetActorTransforms(const TArray<FActorTransformUpdate>& Updates, TArray<FString>& OutErrors) override;
+    virtual int32 SetActorProperties(const TArray<FActorPropertyUpdate>& Updates, TArray<FString>& OutErrors) override;
     virtual bool SetLightProperty(AActor* Actor, const FString& PropertyName, const FString& PropertyValue, FString& OutError) override;
     virtual bool FocusViewport(AActor* TargetActor = nullptr, const FVector* Location = nullptr, float Distance = 1000.0f, const FRotator* Orientation = nullptr, FString* OutError = nullptr) override;
     virtual bool TakeScreenshot(const FString& FilePath, FString& OutError) override;
@@ -65,6 +73,13 @@ private:
      */
     AActor* SpawnActorOfType(UClass* ActorClass, const FString& Name, const FVector& Location, const FRotator& Rotation, const FVector& Scale, const FActorSpawnParams& Params, FString& OutError);
 
+    /**
+     * Apply the defaults that special actor types imply, such as InvisibleWall's mesh and collision
+     * @param Params - Spawn parameters as requested
+     * @return Spawn parameters with the type's defaults filled in
+     */
+    FActorSpawnParams ApplySpawnTypeDefaults(const FActorSpawnParams& Params) const;
+
     /**
      * Configure spawned actor with type-specific settings
      * @param NewActor - The spawned actor to configure
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UObject;
+struct FEdGraphEditAction;
+struct FPropertyChangedEvent;
+
+/**
+ * Content fingerprints of Blueprint graphs, for change detection and as keys of per-graph caches
+ *
+ * A graph's fingerprint is a 64-bit hash of its nodes: class, guid, position, comment and enabled
+ * state, and every pin's name, direction, type, default value and links (by the linked pin's id).
+ * Node hashes are combined in sorted order, so the fingerprint does not depend on the order of
+ * Graph->Nodes, and it is the same for the same content in every session.
+ *
+ * Fingerprints are kept per node and updated incrementally: a graph change notification naming
+ * nodes, or a node being modified, rehashes only those nodes on the next query. A notification
+ * without nodes, a modification of the graph's Blueprint (MarkBlueprintAsModified, which also
+ * follows links made without Modify), Invalidate and undo/redo rehash every node of the graph.
+ * A node count that no longer matches the graph updates the set of nodes.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FGraphFingerprintCache : public IMCPBudgetedCache
+{
+public:
+    static FGraphFingerprintCache& Get();
+
+    /** Start following modifications and undo/redo */
+    void Initialize();
+
+    /** Stop following changes and drop every fingerprint */
+    void Shutdown();
+
+    /**
+     * Fingerprint of a graph, computed if not current
+     * @param Graph Graph to fingerprint
+     * @return The graph's fingerprint
+     */
+    uint64 GetFingerprint(UEdGraph* Graph);
+
+    /** @return The fingerprint as the 16 hex digits metadata reports as graph_hash */
+    static FString ToString(uint64 Fingerprint);
+
+    /**
+     * Rehash every node of a graph on its next query, for edits made without notifications
+     * @param Graph Edited graph
+     */
+    void Invalidate(UEdGraph* Graph);
+
+    /**
+     * Rehash every node of a Blueprint's graphs on their next query
+     * @param Blueprint Modified Blueprint
+     */
+    void Invalidate(UBlueprint* Blueprint);
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    FGraphFingerprintCache() = default;
+
+    struct FGraphEntry
+    {
+        TWeakObjectPtr<UEdGraph> Graph;
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        /** Hashes of the nodes not changed since they were hashed */
+        TMap<const UEdGraphNode*, uint64> NodeHashes;
+        uint64 Fingerprint = 0;
+        int32 NodeCount = 0;
+        bool bCurrent = false;
+        FDelegateHandle GraphChangedHandle;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    static uint64 HashNode(const UEdGraphNode* Node);
+
+    /** Mark an entry for a full rehash */
+    void Reset(FGraphEntry& Entry);
+
+    void HandleGraphChanged(const FEdGraphEditAction& Action);
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+
+    TMap<const UEdGraph*, FGraphEntry> Entries;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+#include "MCPCacheBudget.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UObject;
+struct FPropertyChangedEvent;
+
+/**
+ * Reachability analysis of Blueprint graphs, computed in one pass and kept until the graph changes
+ *
+ * One walk over a graph's nodes and pins finds everything the orphan commands and the
+ * orphaned_nodes metadata section need: the nodes execution reaches from the entry points, the
+ * pure nodes feeding them, the orphaned nodes left over, which of those are dead pure chains, and
+ * the nodes still carrying orphaned pins after a reconstruction. Each node and link is visited a
+ * bounded number of times, so a pass is O(nodes + pins).
+ *
+ * An analysis is dropped when the graph, one of its nodes or its Blueprint is modified, when an
+ * MCP command marks the Blueprint as modified, on undo/redo, and when the graph's fingerprint
+ * (FGraphFingerprintCache) no longer matches the one it was computed for.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FGraphReachabilityCache : public IMCPBudgetedCache
+{
+public:
+    /** A node no entry point reaches */
+    struct FOrphanedNode
+    {
+        TWeakObjectPtr<UEdGraphNode> Node;
+        /** No exec pins: a pure chain whose result nothing uses */
+        bool bPure = false;
+        int32 InputConnections = 0;
+        int32 OutputConnections = 0;
+    };
+
+    /** A node with pins UEdGraphNode reconstruction kept as orphaned because they were still linked */
+    struct FOrphanedPinNode
+    {
+        TWeakObjectPtr<UEdGraphNode> Node;
+        TArray<FString> PinNames;
+    };
+
+    struct FAnalysis
+    {
+        /** Graphs without entry points (macros, ...) have no orphaned nodes */
+        int32 EntryPointCount = 0;
+        int32 ExecReachableCount = 0;
+        int32 DataDependencyCount = 0;
+        /** Orphaned nodes in graph order; comments are never orphaned */
+        TArray<FOrphanedNode> OrphanedNodes;
+        TArray<FOrphanedPinNode> OrphanedPinNodes;
+    };
+
+    static FGraphReachabilityCache& Get();
+
+    /** Start following modifications and undo/redo */
+    void Initialize();
+
+    /** Stop following changes and drop every analysis */
+    void Shutdown();
+
+    /**
+     * Analysis of a graph, computed if not cached
+     * @param Graph Graph to analyze
+     * @return The analysis, valid until the next Analyze or edit; copy what a caller keeps while editing the graph
+     */
+    const FAnalysis& Analyze(UEdGraph* Graph);
+
+    /**
+     * Drop the analyses of a Blueprint's graphs
+     * @param Blueprint Modified Blueprint
+     */
+    void Invalidate(UBlueprint* Blueprint);
+
+    // IMCPBudgetedCache interface
+    virtual void GetCacheUses(TArray<FMCPCacheUse>& OutUses) const override;
+    virtual int64 EvictUsedBefore(uint64 Stamp) override;
+
+private:
+    FGraphReachabilityCache() = default;
+
+    struct FCachedAnalysis
+    {
+        TWeakObjectPtr<UEdGraph> Graph;
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        uint64 Fingerprint = 0;
+        FAnalysis Analysis;
+        uint64 LastUse = 0;
+        int64 Bytes = 0;
+    };
+
+    static void Compute(UEdGraph* Graph, FAnalysis& OutAnalysis);
+
+    /** @return About how many bytes an analysis holds */
+    static int64 GetAnalysisSize(const FAnalysis& Analysis);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+
+    TMap<const UEdGraph*, FCachedAnalysis> Analyses;
+    /** Result for callers before Initialize, when changes are not followed */
+    FAnalysis UncachedAnalysis;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+};
@@ -98,12 +98,51 @@ struct UNREALMCP_API FAnimTransitionParams
     /** Variable name for bool-based transitions */
     FString ConditionVariableName;
 
+    /** Whether a bool-based transition is taken while the variable is false instead */
+    bool bNegateCondition = false;
+
     /** Default constructor */
     FAnimTransitionParams()
     {
     }
 };
 
+/**
+ * Parameters for building a state machine from a spec
+ */
+struct UNREALMCP_API FAnimStateMachineSpecParams
+{
+    /** Name of the state machine; created in the AnimGraph if missing */
+    FString StateMachineName;
+
+    /** States to add; states that already exist are kept as they are */
+    TArray<FAnimStateParams> States;
+
+    /** Transitions to add, between states of the spec or already in the state machine */
+    TArray<FAnimTransitionParams> Transitions;
+
+    /** State the entry node leads to; empty uses the first state marked as default, if any */
+    FString EntryStateName;
+
+    /** Whether to connect the state machine's pose to the AnimGraph output pose */
+    bool bConnectToOutputPose = false;
+
+    /** Whether to compile the Animation Blueprint once everything is added */
+    bool bCompile = true;
+
+    /** Default constructor */
+    FAnimStateMachineSpecParams()
+    {
+    }
+
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
 /**
  * Interface for Animation Blueprint service operations
  */
@@ -201,6 +240,16 @@ public:
      */
     virtual bool GetStateMachineStates(UAnimBlueprint* AnimBlueprint, const FString& StateMachineName, TArray<FString>& OutStates) = 0;
 
+    /**
+     * Build a state machine's states, entry, transitions and rules in one transaction, compiling once
+     * @param AnimBlueprint - Target Animation Blueprint
+     * @param Spec - State machine spec
+     * @param OutReport - JSON object with the state machine name, whether it was created, and the result of each element
+     * @param OutError - Error message if the state machine could not be found or created
+     * @return true if the spec was applied, even if some of its elements failed
+     */
+    virtual bool BuildStateMachineFromSpec(UAnimBlueprint* AnimBlueprint, const FAnimStateMachineSpecParams& Spec, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+
     // ============================================================================
     // Animation Variables
     // ============================================================================
@@ -2,6 +2,21 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * One pin lookup of a batched get_node_pin_info request
+ */
+struct UNREALMCP_API FNodePinQuery
+{
+    /** Name of the Blueprint node (e.g., "Create Widget", "Map Add") */
+    FString NodeName;
+
+    /** Name of the pin on that node */
+    FString PinName;
+
+    /** Optional class name to disambiguate library functions */
+    FString ClassName;
+};
+
 /**
  * Interface for Blueprint Action services
  * Provides methods for discovering and managing Blueprint actions
@@ -63,6 +78,13 @@ public:
      */
     virtual FString GetNodePinInfo(const FString& NodeName, const FString& PinName, const FString& ClassName = TEXT("")) = 0;
 
+    /**
+     * Get pin information for several nodes in one request
+     * @param Queries - Node, pin and optional class name of each lookup
+     * @return JSON string with a results array holding one GetNodePinInfo result per query, in order
+     */
+    virtual FString GetNodePinInfoBatch(const TArray<FNodePinQuery>& Queries) = 0;
+
     /**
      * Create a blueprint node by discovered action/function name
      * @param BlueprintName - Name of the target Blueprint
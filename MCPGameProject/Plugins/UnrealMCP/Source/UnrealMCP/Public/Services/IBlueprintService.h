@@ -69,6 +69,15 @@ public:
      */
     virtual bool CompileBlueprint(UBlueprint* Blueprint, FString& OutError) = 0;
     
+    /**
+     * Regenerate a Blueprint's skeleton class only, without compiling its graphs
+     * @param Blueprint - Blueprint to compile
+     * @param OutErrors - Errors reported for the Blueprint's variables, functions and signatures
+     * @param OutWarnings - Warnings reported alongside them
+     * @return true if the skeleton compiled without errors
+     */
+    virtual bool CompileBlueprintSkeleton(UBlueprint* Blueprint, TArray<FString>& OutErrors, TArray<FString>& OutWarnings) = 0;
+    
     /**
      * Find a Blueprint by name
      * @param BlueprintName - Name of the Blueprint to find
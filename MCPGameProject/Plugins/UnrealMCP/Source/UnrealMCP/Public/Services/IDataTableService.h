@@ -4,6 +4,8 @@
 #include "Engine/DataTable.h"
 #include "Dom/JsonObject.h"
 
+class UCurveTable;
+
 /**
  * Parameters for DataTable creation operations
  */
@@ -55,6 +57,148 @@ struct UNREALMCP_API FDataTableRowParams
     bool IsValid(const UDataTable* DataTable, FString& OutError) const;
 };
 
+/**
+ * Parameters for importing DataTable rows from a file on disk
+ */
+struct UNREALMCP_API FDataTableFileImportParams
+{
+    /** Absolute path of the file, or relative to the project directory */
+    FString FilePath;
+    
+    /** "csv" or "jsonl"; empty picks by file extension */
+    FString Format;
+    
+    /** Most failed rows listed in the report; the count covers all of them */
+    int32 MaxReportedFailures = 100;
+    
+    /** Default constructor */
+    FDataTableFileImportParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Outcome of upserting rows into a DataTable
+ */
+struct UNREALMCP_API FDataTableUpsertResult
+{
+    /** Rows that did not exist and were added */
+    TArray<FString> AddedRows;
+    
+    /** Existing rows with at least one changed field */
+    TArray<FString> UpdatedRows;
+    
+    /** Existing rows whose fields already had the given values */
+    TArray<FString> UnchangedRows;
+    
+    /** Rows that failed, as "name: reason" */
+    TArray<FString> FailedRows;
+    
+    /** Fields written across all updated rows */
+    int32 ChangedFieldCount = 0;
+};
+
+/**
+ * Parameters for exporting a DataTable to a packed column file on disk
+ */
+struct UNREALMCP_API FDataTableFileExportParams
+{
+    /** Absolute path of the file, or relative to the project directory; replaced if it exists */
+    FString FilePath;
+    
+    /** Fields exported as columns; empty exports every field */
+    TArray<FString> Fields;
+    
+    /** Default constructor */
+    FDataTableFileExportParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Predicate on one field of a DataTable row
+ */
+struct UNREALMCP_API FDataTableRowFilter
+{
+    /** Friendly, authored or property name of the field; "row_name" tests the row name */
+    FString Field;
+    
+    /** "eq", "ne", "lt", "le", "gt", "ge" or "contains" */
+    FString Operator = TEXT("eq");
+    
+    /** Value the field is compared with: a number, bool or string */
+    TSharedPtr<FJsonValue> Value;
+};
+
+/**
+ * Parameters for paged, projected and filtered DataTable row reads
+ */
+struct UNREALMCP_API FDataTableRowQuery
+{
+    /** Rows to read, in this order; empty reads every row in row map order */
+    TArray<FString> RowNames;
+    
+    /** Matching rows skipped before the page */
+    int32 Offset = 0;
+    
+    /** Most rows returned; 0 for no limit */
+    int32 Limit = 0;
+    
+    /** Fields returned per row; empty returns every field */
+    TArray<FString> Fields;
+    
+    /** Predicates a row must all pass */
+    TArray<FDataTableRowFilter> Filters;
+    
+    /** Default constructor */
+    FDataTableRowQuery() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Keys of one CurveTable row, as packed parallel arrays
+ */
+struct UNREALMCP_API FCurveTableRowParams
+{
+    /** Name of the row */
+    FString RowName;
+    
+    /** Key times; sorted before they are written */
+    TArray<float> Times;
+    
+    /** Key values, one per time */
+    TArray<float> Values;
+    
+    /** "linear", "constant" or "cubic"; empty keeps the row's mode, or linear for a new row */
+    FString InterpMode;
+    
+    /** Default constructor */
+    FCurveTableRowParams() = default;
+    
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
 /**
  * Interface for DataTable service operations
  * Provides abstraction for DataTable creation, modification, and management
@@ -88,6 +232,45 @@ public:
      */
     virtual bool AddRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows) = 0;
     
+    /**
+     * Add rows to a DataTable through the bulk import path
+     * Field names are mapped once per row struct, rows are written straight into the table's row
+     * map and nothing is logged per row; fields a row omits keep the struct defaults.
+     * @param DataTable - Target DataTable
+     * @param Rows - Array of row parameters to add; existing rows of the same name are replaced
+     * @param OutAddedRows - Names of successfully added rows
+     * @param OutFailedRows - Names of rows that failed to add, with the reason
+     * @return true if at least one row was added successfully
+     */
+    virtual bool ImportRowsToDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutAddedRows, TArray<FString>& OutFailedRows) = 0;
+    
+    /**
+     * Import rows into a DataTable from a CSV or JSON Lines file, streamed through a bounded buffer
+     * CSV: the first record names the columns; the "Name", "row_name" or "---" column (else the
+     * first) holds row names, other columns are matched to fields and their cells imported as
+     * property text. JSON Lines: one object per line, either {row_name, row_data} or the fields
+     * themselves with a "row_name" or "Name" field.
+     * @param DataTable - Target DataTable; existing rows of the same name are replaced
+     * @param Params - File import parameters
+     * @param OutReport - Counts, unknown columns and the first failed rows; never the imported rows
+     * @param OutError - Error message if the file could not be read
+     * @return true if the file was read, even if some rows failed
+     */
+    virtual bool ImportRowsFromFile(UDataTable* DataTable, const FDataTableFileImportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+    
+    /**
+     * Export a DataTable to a packed column file, read straight from the row memory
+     * One column per field plus the row names, each stored contiguously: numeric and bool fields
+     * as their raw values, every other field as UTF-8 text with a row offset table. The layout is
+     * described in Docs/Tools/datatable_tools.md.
+     * @param DataTable - Source DataTable
+     * @param Params - File export parameters
+     * @param OutReport - Row and column counts, column types and file size
+     * @param OutError - Error message if a field is unknown or the file could not be written
+     * @return true if the file was written
+     */
+    virtual bool ExportDataTableToFile(const UDataTable* DataTable, const FDataTableFileExportParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+    
     /**
      * Update rows in a DataTable
      * @param DataTable - Target DataTable
@@ -98,6 +281,18 @@ public:
      */
     virtual bool UpdateRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, TArray<FString>& OutUpdatedRows, TArray<FString>& OutFailedRows) = 0;
     
+    /**
+     * Add rows that do not exist and update the ones that do, writing only the fields that changed
+     * Each row is converted over a copy of the existing row, so fields the row data leaves out keep
+     * their current values, and compared with the existing row field by field. The table is
+     * notified, saved and refreshed once at the end, and only if something was written.
+     * @param DataTable - Target DataTable
+     * @param Rows - Array of row parameters to add or update
+     * @param OutResult - Added, updated, unchanged and failed rows
+     * @return true if no row failed
+     */
+    virtual bool UpsertRowsInDataTable(UDataTable* DataTable, const TArray<FDataTableRowParams>& Rows, FDataTableUpsertResult& OutResult) = 0;
+    
     /**
      * Delete rows from a DataTable
      * @param DataTable - Target DataTable
@@ -116,6 +311,18 @@ public:
      */
     virtual TSharedPtr<FJsonObject> GetDataTableRows(const UDataTable* DataTable, const TArray<FString>& RowNames = TArray<FString>()) = 0;
     
+    /**
+     * Read one page of the rows of a DataTable that pass a query's filters
+     * Filters are tested on the row memory, so only the rows on the page are converted to JSON,
+     * and only their projected fields.
+     * @param DataTable - Source DataTable
+     * @param Query - Rows, paging, projected fields and filters
+     * @param OutResult - rows, plus total_rows, matched_count, offset, returned_count, has_more and next_offset
+     * @param OutError - Error message if a field is unknown or a filter cannot apply to its field
+     * @return true if the query ran
+     */
+    virtual bool QueryDataTableRows(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) = 0;
+    
     /**
      * Get row names and field names from a DataTable
      * @param DataTable - Target DataTable
@@ -132,6 +339,14 @@ public:
      */
     virtual TSharedPtr<FJsonObject> GetDataTablePropertyMap(const UDataTable* DataTable) = 0;
     
+    /**
+     * Get property mapping for a DataTable by name, without loading the table when its row struct
+     * is known from the asset registry
+     * @param DataTableName - Name or path of the DataTable
+     * @return JSON object containing the property mapping, or nullptr if the table is not found
+     */
+    virtual TSharedPtr<FJsonObject> GetDataTablePropertyMap(const FString& DataTableName) = 0;
+    
     /**
      * Validate row data against DataTable structure
      * @param DataTable - Target DataTable
@@ -141,6 +356,44 @@ public:
      */
     virtual bool ValidateRowData(const UDataTable* DataTable, const TSharedPtr<FJsonObject>& RowData, FString& OutError) = 0;
     
+    /**
+     * Find a CurveTable by name or path
+     * @param CurveTableName - Name or path of the CurveTable
+     * @return Found CurveTable or nullptr
+     */
+    virtual UCurveTable* FindCurveTable(const FString& CurveTableName) = 0;
+    
+    /**
+     * Read one page of the rows of a CurveTable, each as packed time and value arrays
+     * @param CurveTable - Source CurveTable
+     * @param Query - Rows and paging; fields and filters do not apply to curve rows
+     * @param OutResult - rows, curve_table_mode, plus total_rows, offset, returned_count, has_more and next_offset
+     * @param OutError - Error message if the query does not apply
+     * @return true if the query ran
+     */
+    virtual bool QueryCurveTableRows(const UCurveTable* CurveTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) = 0;
+    
+    /**
+     * Replace the keys of CurveTable rows, adding the rows that do not exist
+     * The table is marked modified, notified and saved once for the whole batch, and only if a row changed.
+     * @param CurveTable - Target CurveTable
+     * @param Rows - Rows to write
+     * @param OutResult - Added, updated, unchanged and failed rows; ChangedFieldCount counts written keys
+     * @return true if at least one row was added or updated
+     */
+    virtual bool WriteCurveTableRows(UCurveTable* CurveTable, const TArray<FCurveTableRowParams>& Rows, FDataTableUpsertResult& OutResult) = 0;
+    
+    /**
+     * Describe the parent tables of a composite DataTable and which parent each row comes from
+     * Later parents override the rows of earlier ones, as the composite table merges them.
+     * @param DataTable - Composite DataTable
+     * @param Query - Rows and paging of the row sources; fields and filters do not apply
+     * @param OutResult - parents, rows with source_table and overridden_tables, plus paging fields
+     * @param OutError - Error message if the table is not composite or the query does not apply
+     * @return true if the table was inspected
+     */
+    virtual bool GetCompositeDataTableStack(const UDataTable* DataTable, const FDataTableRowQuery& Query, TSharedPtr<FJsonObject>& OutResult, FString& OutError) = 0;
+    
     /**
      * Get detailed error message from the last failed operation
      * @return Last error message with details
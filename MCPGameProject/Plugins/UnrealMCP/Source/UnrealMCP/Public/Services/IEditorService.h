@@ -108,6 +108,120 @@ struct UNREALMCP_API FActorSpawnParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Static mesh instances that share one instanced mesh component
+ */
+struct UNREALMCP_API FInstancedMeshGroup
+{
+    /** Path to the static mesh asset */
+    FString MeshPath;
+
+    /** Override materials by slot; empty entries and missing slots keep the mesh's materials */
+    TArray<FString> MaterialPaths;
+
+    /** World transforms of the instances */
+    TArray<FTransform> Transforms;
+};
+
+/**
+ * One actor's part of a bulk transform update; unset parts keep their current value
+ */
+struct UNREALMCP_API FActorTransformUpdate
+{
+    /** Name of the actor to move */
+    FString ActorName;
+
+    TOptional<FVector> Location;
+    TOptional<FRotator> Rotation;
+    TOptional<FVector> Scale;
+};
+
+/**
+ * One actor's part of a bulk property update
+ */
+struct UNREALMCP_API FActorPropertyUpdate
+{
+    /** Name of the actor to change */
+    FString ActorName;
+
+    /** Property names and values, applied in order */
+    TArray<TPair<FString, TSharedPtr<FJsonValue>>> Properties;
+};
+
+/**
+ * Region of a spatial actor query
+ */
+enum class EActorSpatialShape : uint8
+{
+    /** Actors whose bounds overlap an axis-aligned box */
+    Box,
+    /** Actors whose bounds overlap a sphere */
+    Sphere,
+    /** Actors whose bounds overlap a camera frustum */
+    Frustum,
+    /** The actors whose bounds are closest to a point */
+    Nearest
+};
+
+/**
+ * Parameters for spatial actor queries
+ */
+struct UNREALMCP_API FActorSpatialQuery
+{
+    EActorSpatialShape Shape = EActorSpatialShape::Box;
+
+    /** Box: opposite corners */
+    FVector Min = FVector::ZeroVector;
+    FVector Max = FVector::ZeroVector;
+
+    /** Sphere: center; Nearest: the point to measure from */
+    FVector Center = FVector::ZeroVector;
+
+    /** Sphere: radius; Nearest: maximum distance, 0 for unlimited */
+    double Radius = 0.0;
+
+    /** Nearest: number of actors to return */
+    int32 Count = 1;
+
+    /** Frustum: camera location and rotation */
+    FVector Origin = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    /** Frustum: horizontal field of view in degrees, width / height, and clip distances */
+    float FOV = 90.0f;
+    float AspectRatio = 16.0f / 9.0f;
+    float NearDistance = 10.0f;
+    float FarDistance = 10000.0f;
+
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Server-side filters for listing level actors; every filter that is set must match
+ */
+struct UNREALMCP_API FActorListFilter
+{
+    /** Object name wildcard pattern (e.g. "*Light*") */
+    FString NamePattern;
+
+    /** Actor class, as accepted by spawn_actor's type or a loaded class name; subclasses match too */
+    FString ClassName;
+
+    /** Actor tag */
+    FString Tag;
+
+    /** Outliner folder; actors in its subfolders match too */
+    FString Folder;
+
+    /** Region the actor's bounds must overlap */
+    TOptional<FActorSpatialQuery> Region;
+};
+
 /**
  * Parameters for Blueprint actor spawning operations
  */
@@ -161,6 +275,26 @@ public:
      */
     virtual TArray<AActor*> FindActorsByName(const FString& Pattern) = 0;
     
+    /**
+     * Find the actors whose bounds overlap a region, without sweeping every actor in the level
+     * @param Query - Region to search
+     * @param OutActors - Matching actors; nearest first for Nearest queries
+     * @param OutDistances - Distance from the query point to each actor's bounds (Nearest queries only)
+     * @param OutError - Error message if the query is invalid
+     * @return true if the query ran
+     */
+    virtual bool QueryActorsSpatial(const FActorSpatialQuery& Query, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError) = 0;
+    
+    /**
+     * Find the actors matching every filter, starting from the actor index for class, tag and region filters
+     * @param Filter - Filters to apply
+     * @param OutActors - Matching actors; nearest first for Nearest regions
+     * @param OutDistances - Distance from the query point to each actor's bounds (Nearest regions only)
+     * @param OutError - Error message if a filter is invalid
+     * @return true if the query ran
+     */
+    virtual bool FindActors(const FActorListFilter& Filter, TArray<AActor*>& OutActors, TArray<double>& OutDistances, FString& OutError) = 0;
+    
     /**
      * Spawn a new actor
      * @param Params - Actor spawn parameters
@@ -169,6 +303,40 @@ public:
      */
     virtual AActor* SpawnActor(const FActorSpawnParams& Params, FString& OutError) = 0;
     
+    /**
+     * Spawn many actors with deferred construction, as one undo transaction
+     * Every actor is spawned and configured before any construction script runs, and the level
+     * editor is refreshed once at the end instead of per actor.
+     * @param Params - Actor spawn parameters
+     * @param OutErrors - One entry per parameter; empty for an actor that spawned
+     * @return One entry per parameter; nullptr for an actor that failed
+     */
+    virtual TArray<AActor*> SpawnActorsDeferred(const TArray<FActorSpawnParams>& Params, TArray<FString>& OutErrors) = 0;
+    
+    /**
+     * Spawn one actor holding every group of mesh instances, one instanced component per group
+     * @param Name - Name of the actor
+     * @param Groups - Mesh, materials and instance transforms of each component
+     * @param bHierarchical - Use hierarchical instanced components (culling and LOD per cluster) instead of plain ones
+     * @param OutComponentNames - Name of each group's component, in group order
+     * @param OutError - Error message if spawning fails
+     * @return Spawned actor or nullptr if failed
+     */
+    virtual AActor* SpawnInstancedMeshActor(const FString& Name, const TArray<FInstancedMeshGroup>& Groups, bool bHierarchical, TArray<FString>& OutComponentNames, FString& OutError) = 0;
+    
+    /**
+     * Replace static mesh actors with instances of one instanced mesh actor, one component per mesh and materials
+     * @param ActorNames - Static mesh actors to convert
+     * @param InstancedActorName - Name of the actor that receives the instances
+     * @param bHierarchical - Use hierarchical instanced components
+     * @param bDeleteSourceActors - Delete the converted actors
+     * @param OutConvertedActors - Actors whose meshes became instances
+     * @param OutSkippedActors - Actors that were not converted, as "name: reason"
+     * @param OutError - Error message if nothing could be converted
+     * @return The instanced mesh actor, or nullptr if failed
+     */
+    virtual AActor* ConvertActorsToInstances(const TArray<FString>& ActorNames, const FString& InstancedActorName, bool bHierarchical, bool bDeleteSourceActors, TArray<FString>& OutConvertedActors, TArray<FString>& OutSkippedActors, FString& OutError) = 0;
+    
     /**
      * Spawn a Blueprint actor
      * @param Params - Blueprint actor spawn parameters
@@ -184,6 +352,17 @@ public:
      * @return true if actor was deleted successfully
      */
     virtual bool DeleteActor(const FString& ActorName, FString& OutError) = 0;
+
+    /**
+     * Delete many actors as one undo step
+     * The actors go to the editor in one call, so the selection, outliner and level are updated
+     * once rather than per actor
+     * @param ActorNames - Names of the actors to delete
+     * @param bCollectGarbage - Request a full garbage collection on the next tick to reclaim the actors
+     * @param OutErrors - Error per name, empty where the actor was deleted
+     * @return Number of actors deleted
+     */
+    virtual int32 DeleteActors(const TArray<FString>& ActorNames, bool bCollectGarbage, TArray<FString>& OutErrors) = 0;
     
     /**
      * Find an actor by name
@@ -211,6 +390,24 @@ public:
      * @return true if property was set successfully
      */
     virtual bool SetActorProperty(AActor* Actor, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) = 0;
+
+    /**
+     * Move many actors as one undo step
+     * Each actor gets one PostEditMove, and the viewports redraw once at the end
+     * @param Updates - Transform per actor
+     * @param OutErrors - Error per update, empty where it succeeded
+     * @return Number of actors updated
+     */
+    virtual int32 SetActorTransforms(const TArray<FActorTransformUpdate>& Updates, TArray<FString>& OutErrors) = 0;
+
+    /**
+     * Set properties on many actors as one undo step
+     * Each actor gets one PostEditChange however many of its properties change
+     * @param Updates - Properties per actor
+     * @param OutErrors - Error per update, empty where every property was set
+     * @return Number of actors whose properties were all set
+     */
+    virtual int32 SetActorProperties(const TArray<FActorPropertyUpdate>& Updates, TArray<FString>& OutErrors) = 0;
     
     /**
      * Set a property on a light component
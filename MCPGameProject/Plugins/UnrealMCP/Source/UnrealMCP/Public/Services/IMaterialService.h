@@ -144,6 +144,47 @@ struct UNREALMCP_API FMaterialParameterSetParams
     }
 };
 
+/**
+ * Parameter values to set on a set of Material Instances, each instance updated once for all of them
+ */
+struct UNREALMCP_API FMaterialInstanceParameterBatch
+{
+    /** Scalar values by parameter name */
+    TMap<FString, float> ScalarParams;
+
+    /** Vector values by parameter name */
+    TMap<FString, FLinearColor> VectorParams;
+
+    /** Texture asset paths by parameter name */
+    TMap<FString, FString> TextureParams;
+
+    /** @return true if there is nothing to set */
+    bool IsEmpty() const
+    {
+        return ScalarParams.Num() == 0 && VectorParams.Num() == 0 && TextureParams.Num() == 0;
+    }
+};
+
+/**
+ * Outcome of a parameter batch on one Material Instance
+ */
+struct UNREALMCP_API FMaterialInstanceParameterResult
+{
+    /** Path of the instance */
+    FString InstancePath;
+
+    /** Parameters set, by type */
+    TArray<FString> SetScalarParams;
+    TArray<FString> SetVectorParams;
+    TArray<FString> SetTextureParams;
+
+    /** Parameters the instance's material does not have; left unset */
+    TArray<FString> MissingParams;
+
+    /** Why the instance was not updated; empty on success */
+    FString Error;
+};
+
 /**
  * Interface for Material service operations
  * Provides abstraction for material creation, modification, and parameter management
@@ -269,4 +310,27 @@ public:
      * @return true if material instance was duplicated successfully
      */
     virtual bool DuplicateMaterialInstance(const FString& SourcePath, const FString& NewName, const FString& FolderPath, FString& OutAssetPath, FString& OutParentMaterial, FString& OutError) = 0;
+
+    /**
+     * Find Material Instance Constants from the asset registry, without loading them
+     * @param FolderPath - Content folder to search (empty for all content)
+     * @param ParentMaterialPath - Only instances derived from this material or instance, directly or through other instances (empty for any)
+     * @param bRecursive - Include subfolders of FolderPath
+     * @param OutInstancePaths - Object paths of the matching instances
+     * @param OutError - Error message if the parent material is not found
+     * @return true if the search ran
+     */
+    virtual bool FindMaterialInstances(const FString& FolderPath, const FString& ParentMaterialPath, bool bRecursive, TArray<FString>& OutInstancePaths, FString& OutError) = 0;
+
+    /**
+     * Set the same parameters on many Material Instance Constants: one PostEditChange per instance
+     * for all its parameters, and the saves written together when the batch ends
+     * @param InstancePaths - Instances to update
+     * @param Batch - Parameter values to set
+     * @param bSave - Save the updated instances
+     * @param OutResults - One result per instance path, in order
+     * @param OutError - Error message if the batch could not start (e.g. a texture does not exist)
+     * @return Number of instances updated, or INDEX_NONE if the batch could not start
+     */
+    virtual int32 SetMaterialInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialInstanceParameterBatch& Batch, bool bSave, TArray<FMaterialInstanceParameterResult>& OutResults, FString& OutError) = 0;
 };
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Services/NiagaraServiceTypes.h"
+#include "Services/Niagara/NiagaraComponentParameterTypes.h"
 
 /**
  * Interface for Niagara VFX service operations
@@ -100,9 +101,10 @@ public:
      * @param ModuleName - Name of the module
      * @param Stage - Stage the module is in ("Spawn", "Update", "Event")
      * @param OutInputs - Output JSON object with module inputs
+     * @param CurveFormat - How the keys of curve inputs are written
      * @return true if inputs were retrieved successfully
      */
-    virtual bool GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs) = 0;
+    virtual bool GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs, ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes) = 0;
 
     /**
      * Get all modules in an emitter organized by stage
@@ -113,6 +115,19 @@ public:
      */
     virtual bool GetEmitterModules(const FString& SystemPath, const FString& EmitterName, TSharedPtr<FJsonObject>& OutModules) = 0;
 
+    /**
+     * Get modules with their inputs, renderers and data interfaces of every emitter in one pass
+     * @param SystemPath - Path to the Niagara System
+     * @param Fields - Optional sections to include (nullptr = all): "modules", "inputs", "input_options",
+     *                 "renderers", "renderer_properties", "data_interfaces", and the system-level "status" and "parameters"
+     * @param EmitterName - Optional emitter to limit the snapshot to
+     * @param OutSnapshot - Output JSON object with the snapshot
+     * @param OutError - Error message if the system or emitter is not found
+     * @param CurveFormat - How the keys of curve inputs are written
+     * @return true if the snapshot was built
+     */
+    virtual bool GetSystemSnapshot(const FString& SystemPath, const TArray<FString>* Fields, const FString& EmitterName, TSharedPtr<FJsonObject>& OutSnapshot, FString& OutError, ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes) = 0;
+
     /**
      * Compile a Niagara System or Emitter
      * @param AssetPath - Path to the asset to compile
@@ -121,6 +136,48 @@ public:
      */
     virtual bool CompileAsset(const FString& AssetPath, FString& OutError) = 0;
 
+    /**
+     * Start compiling a Niagara System without waiting for it
+     * @param AssetPath - Path to the system to compile
+     * @param OutJobId - Job to poll with GetCompileStatus; the running job if the system is already compiling
+     * @param OutError - Error message if the compile could not be started
+     * @return true if the compile was started
+     */
+    virtual bool StartCompileAsync(const FString& AssetPath, int64& OutJobId, FString& OutError) = 0;
+
+    /**
+     * Get the progress of a compile started by StartCompileAsync, finishing it once every script is compiled
+     * @param JobId - Job returned by StartCompileAsync
+     * @param OutStatus - Output JSON object with the job state, per-emitter script progress and, once finished, the compile result
+     * @param OutError - Error message if the job is unknown
+     * @return true if the job was found
+     */
+    virtual bool GetCompileStatus(int64 JobId, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) = 0;
+
+    /**
+     * Start collecting compile diagnostics of many systems, loading them asynchronously several at a time
+     * @param SystemPaths - Systems to check, by path or name
+     * @param PackagePath - Optional folder whose systems are checked too, recursively
+     * @param bCompile - Request a compile of every system instead of reporting its last compile
+     * @param MaxInFlight - Most systems loading or compiling at once
+     * @param OutJobId - Job to poll with GetBulkDiagnostics
+     * @param OutSystemCount - Number of systems the job checks
+     * @param OutError - Error message if no system was found
+     * @return true if the job was started
+     */
+    virtual bool StartBulkDiagnostics(const TArray<FString>& SystemPaths, const FString& PackagePath, bool bCompile, int32 MaxInFlight, int64& OutJobId, int32& OutSystemCount, FString& OutError) = 0;
+
+    /**
+     * Get the diagnostics a StartBulkDiagnostics job has collected so far
+     * @param JobId - Job returned by StartBulkDiagnostics
+     * @param Cursor - Number of results already read; results are kept in completion order
+     * @param MaxResults - Most results returned
+     * @param OutStatus - Output JSON object with the job progress and the results after Cursor
+     * @param OutError - Error message if the job is unknown
+     * @return true if the job was found
+     */
+    virtual bool GetBulkDiagnostics(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) = 0;
+
     /**
      * Duplicate a Niagara System
      * @param SourcePath - Path to the source system
@@ -316,6 +373,15 @@ public:
      */
     virtual ANiagaraActor* SpawnActor(const FNiagaraActorSpawnParams& Params, FString& OutActorName, FString& OutError) = 0;
 
+    /**
+     * Set user parameters on the Niagara components of many placed actors
+     * @param Params - Target actors and parameter values
+     * @param OutResult - Output JSON object with the results per component
+     * @param OutError - Error message if no actor matched
+     * @return true if at least one component was found
+     */
+    virtual bool SetComponentParameters(const FNiagaraComponentParametersParams& Params, TSharedPtr<FJsonObject>& OutResult, FString& OutError) = 0;
+
     // ========================================================================
     // Utility Methods
     // ========================================================================
@@ -339,4 +405,10 @@ public:
      * @param Asset - The asset to refresh editors for
      */
     virtual void RefreshEditors(UObject* Asset) = 0;
+
+    /**
+     * Recompile a system and wait for it; while an FMCPBatchEditScope is open, once when the scope closes
+     * @param System - The system to recompile
+     */
+    virtual void RequestRecompile(UNiagaraSystem* System) = 0;
 };
@@ -3,6 +3,293 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+/**
+ * One asset of a batch asset operation
+ */
+struct UNREALMCP_API FAssetBatchEntry
+{
+    /** Asset to move, rename, duplicate or delete */
+    FString AssetPath;
+
+    /** Folder the asset goes to; its current folder if empty (move, rename, duplicate) */
+    FString DestinationFolder;
+
+    /** Name the asset gets; its current name if empty (move, rename, duplicate) */
+    FString NewName;
+};
+
+/**
+ * Outcome for one asset of a batch asset operation
+ */
+struct UNREALMCP_API FAssetBatchResult
+{
+    FString AssetPath;
+
+    /** Path the asset has afterwards; empty for deletes and failures */
+    FString NewAssetPath;
+
+    bool bSuccess = false;
+    FString Error;
+};
+
+/**
+ * One member change of a batched struct or enum schema change
+ */
+struct UNREALMCP_API FSchemaChange
+{
+    /** "add", "remove", "rename", "set_type" (structs only) or "set_description" */
+    FString Operation;
+
+    /** Member the change applies to, by display name; the new member's name for "add" */
+    FString Name;
+
+    /** For "rename": the member's new display name */
+    FString NewName;
+
+    /** For struct "add" and "set_type": the member type, as create_struct takes it */
+    FString Type;
+
+    /** For "add" and "set_description": the member's tooltip */
+    FString Description;
+};
+
+/**
+ * Outcome of one change of a batched schema change
+ */
+struct UNREALMCP_API FSchemaChangeResult
+{
+    FString Operation;
+    FString Name;
+    bool bSuccess = false;
+    FString Error;
+};
+
+/**
+ * One font of a bulk font import
+ */
+struct UNREALMCP_API FBulkFontImportEntry
+{
+    /** Name of the font asset */
+    FString FontName;
+
+    /** "ttf" to import a TTF/OTF file as FontFace + Font, "offline" for a bitmap font from an atlas */
+    FString SourceType;
+
+    /** Content folder of this font; the import's folder if empty */
+    FString Path;
+
+    /** For "ttf": absolute path to the font file on disk */
+    FString TTFFilePath;
+
+    /** For "ttf": optional ascender/descender overrides */
+    TSharedPtr<FJsonObject> FontMetrics;
+
+    /** For "offline": texture atlas asset in UE */
+    FString AtlasTexturePath;
+
+    /** For "offline": absolute path to the metrics JSON on disk */
+    FString MetricsFilePath;
+};
+
+/**
+ * Parameters for importing many fonts in one run
+ */
+struct UNREALMCP_API FBulkFontImportParams
+{
+    /** Fonts to create */
+    TArray<FBulkFontImportEntry> Fonts;
+
+    /** Content folder of the fonts that name none */
+    FString Path = TEXT("/Game/Fonts");
+
+    /** Whether the created packages are saved once the import finishes */
+    bool bSave = true;
+
+    /** Most fonts prepared on worker threads at once */
+    int32 MaxInFlight = 8;
+
+    FBulkFontImportParams() = default;
+
+    bool IsValid(FString& OutError) const
+    {
+        if (Fonts.Num() == 0)
+        {
+            OutError = TEXT("'fonts' must list at least one font");
+            return false;
+        }
+        for (int32 Index = 0; Index < Fonts.Num(); ++Index)
+        {
+            const FBulkFontImportEntry& Font = Fonts[Index];
+            if (Font.FontName.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("fonts[%d] is missing 'font_name'"), Index);
+                return false;
+            }
+            if (Font.SourceType == TEXT("ttf"))
+            {
+                if (Font.TTFFilePath.IsEmpty())
+                {
+                    OutError = FString::Printf(TEXT("fonts[%d] ('%s') is missing 'ttf_file_path'"), Index, *Font.FontName);
+                    return false;
+                }
+            }
+            else if (Font.SourceType == TEXT("offline"))
+            {
+                if (Font.AtlasTexturePath.IsEmpty() || Font.MetricsFilePath.IsEmpty())
+                {
+                    OutError = FString::Printf(TEXT("fonts[%d] ('%s') needs 'atlas_texture' and 'metrics_file'"), Index, *Font.FontName);
+                    return false;
+                }
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("fonts[%d] ('%s') has source_type '%s'; expected 'ttf' or 'offline'"), Index, *Font.FontName, *Font.SourceType);
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * One key mapping of an input setup
+ */
+struct UNREALMCP_API FInputSetupMapping
+{
+    /** Action of the setup by name (with or without the IA_ prefix), or an existing action's asset path */
+    FString Action;
+
+    /** Key name, e.g. "SpaceBar", "Gamepad_FaceButton_Bottom" */
+    FString Key;
+
+    /** Modifiers and triggers: class names ("Negate", "Hold") or {"type", "properties"} objects */
+    TArray<TSharedPtr<FJsonValue>> Modifiers;
+    TArray<TSharedPtr<FJsonValue>> Triggers;
+};
+
+/**
+ * One input action of an input setup
+ */
+struct UNREALMCP_API FInputSetupAction
+{
+    FString Name;
+
+    /** Content folder; the setup's action folder if empty */
+    FString Path;
+
+    /** "Digital", "Analog", "Axis2D" or "Axis3D" */
+    FString ValueType = TEXT("Digital");
+
+    FString Description;
+
+    /** Modifiers and triggers applied to every mapping of the action */
+    TArray<TSharedPtr<FJsonValue>> Modifiers;
+    TArray<TSharedPtr<FJsonValue>> Triggers;
+};
+
+/**
+ * One input mapping context of an input setup
+ */
+struct UNREALMCP_API FInputSetupContext
+{
+    FString Name;
+
+    /** Content folder; the setup's context folder if empty */
+    FString Path;
+
+    FString Description;
+
+    TArray<FInputSetupMapping> Mappings;
+};
+
+/**
+ * Input actions, mapping contexts and their mappings to create in one pass
+ */
+struct UNREALMCP_API FInputSetupParams
+{
+    TArray<FInputSetupAction> Actions;
+    TArray<FInputSetupContext> Contexts;
+
+    /** Content folder of the actions that name none */
+    FString ActionPath = TEXT("/Game/Input/Actions");
+
+    /** Content folder of the contexts that name none */
+    FString ContextPath = TEXT("/Game/Input");
+
+    /** Whether the created packages are saved, in one call, at the end */
+    bool bSave = true;
+};
+
+/**
+ * What an input setup created
+ */
+struct UNREALMCP_API FInputSetupResult
+{
+    /** Per action and per context: name, asset_path, created, error; contexts also mappings_added and mapping errors */
+    TArray<TSharedPtr<FJsonObject>> Actions;
+    TArray<TSharedPtr<FJsonObject>> Contexts;
+
+    int32 CreatedCount = 0;
+    int32 FailedCount = 0;
+    int32 MappingCount = 0;
+
+    /** Packages that were created but could not be saved */
+    TArray<FString> UnsavedPackages;
+};
+
+/**
+ * One data asset of a bulk data asset creation
+ */
+struct UNREALMCP_API FBulkDataAssetRow
+{
+    /** Name of the data asset */
+    FString Name;
+
+    /** Content folder; the creation's folder if empty */
+    FString FolderPath;
+
+    /** Property values by property path ("Damage", "Stats.MaxHealth"); may be null */
+    TSharedPtr<FJsonObject> Properties;
+};
+
+/**
+ * Parameters for creating many data assets of one class in one call
+ */
+struct UNREALMCP_API FBulkDataAssetParams
+{
+    /** DataAsset subclass of every row */
+    FString AssetClass;
+
+    /** Content folder of the rows that name none */
+    FString FolderPath = TEXT("/Game/Data");
+
+    TArray<FBulkDataAssetRow> Rows;
+
+    /** Whether the created packages are saved once every row was created */
+    bool bSave = true;
+
+    /** Whether the packages are serialized in parallel (UPackage::SaveConcurrent) rather than one by one */
+    bool bParallelSave = false;
+};
+
+/**
+ * What a bulk data asset creation did
+ */
+struct UNREALMCP_API FBulkDataAssetResult
+{
+    /** Per row: name, asset_path, created, error, property_errors */
+    TArray<TSharedPtr<FJsonObject>> Rows;
+
+    int32 CreatedCount = 0;
+    int32 FailedCount = 0;
+
+    /** Property values that were not set, over all rows */
+    int32 PropertyErrorCount = 0;
+
+    /** Packages that were created but could not be saved */
+    TArray<FString> UnsavedPackages;
+};
+
 /**
  * Interface for Project-related operations
  * Handles input mappings, folder creation, struct management, and enhanced input
@@ -28,6 +315,11 @@ public:
     // ValueDescriptions is a map from value name to its description (optional)
     virtual bool CreateEnum(const FString& EnumName, const FString& Path, const FString& Description, const TArray<FString>& Values, const TMap<FString, FString>& ValueDescriptions, FString& OutFullPath, FString& OutError) = 0;
     virtual bool UpdateEnum(const FString& EnumName, const FString& Path, const FString& Description, const TArray<FString>& Values, const TMap<FString, FString>& ValueDescriptions, FString& OutError) = 0;
+
+    // Batched schema changes - every member change of one struct or enum in a single change, so
+    // dependent Blueprints recompile and DataTables reinstance once; OutResults follows Changes;
+    // false if the asset is not a user-defined struct or enum or no change could be applied
+    virtual bool ApplySchemaChanges(const FString& AssetPath, const TArray<FSchemaChange>& Changes, FString& OutAssetKind, TArray<FSchemaChangeResult>& OutResults, FString& OutError) = 0;
     
     // Enhanced Input operations
     virtual bool CreateEnhancedInputAction(const FString& ActionName, const FString& Path, const FString& Description, const FString& ValueType, FString& OutAssetPath, FString& OutError) = 0;
@@ -35,6 +327,10 @@ public:
     virtual bool AddMappingToContext(const FString& ContextPath, const FString& ActionPath, const FString& Key, const TSharedPtr<FJsonObject>& Modifiers, FString& OutError) = 0;
     virtual TArray<TSharedPtr<FJsonObject>> ListInputActions(const FString& Path, bool& bOutSuccess, FString& OutError) = 0;
     virtual TArray<TSharedPtr<FJsonObject>> ListInputMappingContexts(const FString& Path, bool& bOutSuccess, FString& OutError) = 0;
+
+    // Bulk Enhanced Input setup - every action, context and mapping of Params created in one pass
+    // and saved in one call; false only if Params is invalid, per-asset failures are in OutResult
+    virtual bool CreateInputSetup(const FInputSetupParams& Params, FInputSetupResult& OutResult, FString& OutError) = 0;
     
     // Utility operations
     virtual FString GetProjectDirectory() const = 0;
@@ -46,11 +342,21 @@ public:
     virtual bool MoveAsset(const FString& AssetPath, const FString& DestinationFolder, FString& OutNewAssetPath, FString& OutError) = 0;
     virtual TArray<TSharedPtr<FJsonObject>> SearchAssets(const FString& Pattern, const FString& AssetClass, const FString& Folder, bool& bOutSuccess, FString& OutError) = 0;
 
+    // Batch asset operations - one asset tools call for the whole list; OutResults follows Entries;
+    // false only if the list is empty
+    virtual bool RenameAssets(const TArray<FAssetBatchEntry>& Entries, bool bFixupRedirectors, TArray<FAssetBatchResult>& OutResults, int32& OutFixedRedirectors, FString& OutError) = 0;
+    virtual bool DuplicateAssets(const TArray<FAssetBatchEntry>& Entries, TArray<FAssetBatchResult>& OutResults, FString& OutError) = 0;
+    virtual bool DeleteAssets(const TArray<FString>& AssetPaths, TArray<FAssetBatchResult>& OutResults, FString& OutError) = 0;
+
     // DataAsset operations
     virtual bool CreateDataAsset(const FString& Name, const FString& AssetClass, const FString& FolderPath, const TSharedPtr<FJsonObject>& Properties, FString& OutAssetPath, FString& OutError) = 0;
     virtual bool SetDataAssetProperty(const FString& AssetPath, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) = 0;
     virtual TSharedPtr<FJsonObject> GetDataAssetMetadata(const FString& AssetPath, FString& OutError) = 0;
 
+    // Bulk DataAsset creation - every row created and populated, then saved together; OutResult
+    // follows Params.Rows; false only if the class or the rows are invalid
+    virtual bool CreateDataAssets(const FBulkDataAssetParams& Params, FBulkDataAssetResult& OutResult, FString& OutError) = 0;
+
     // Font Face operations (for TTF-based fonts)
     virtual bool CreateFontFace(const FString& FontName, const FString& Path, const FString& SourceTexturePath, bool bUseSDF, int32 DistanceFieldSpread, const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutError) = 0;
     virtual bool SetFontFaceProperties(const FString& FontPath, const TSharedPtr<FJsonObject>& Properties, TArray<FString>& OutSuccessProperties, TArray<FString>& OutFailedProperties, FString& OutError) = 0;
@@ -64,4 +370,9 @@ public:
     // MetricsFilePath: Absolute file path to the metrics JSON file on disk (not an Unreal asset path)
     virtual bool CreateOfflineFont(const FString& FontName, const FString& Path, const FString& TexturePath, const FString& MetricsFilePath, FString& OutAssetPath, FString& OutError) = 0;
     virtual TSharedPtr<FJsonObject> GetFontMetadata(const FString& FontPath, FString& OutError) = 0;
+
+    // Bulk font import - font files and offline glyph tables are read on worker threads, assets
+    // are created across editor ticks; poll progress and per-font results with GetBulkFontImport
+    virtual bool StartBulkFontImport(const FBulkFontImportParams& Params, int64& OutJobId, int32& OutFontCount, FString& OutError) = 0;
+    virtual bool GetBulkFontImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) = 0;
 };
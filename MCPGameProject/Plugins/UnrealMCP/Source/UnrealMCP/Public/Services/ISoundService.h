@@ -45,6 +45,51 @@ struct UNREALMCP_API FSoundWaveImportParams
     }
 };
 
+/**
+ * Parameters for importing many audio files as sound waves
+ */
+struct UNREALMCP_API FBulkSoundImportParams
+{
+    /** Audio files to import */
+    TArray<FString> SourceFilePaths;
+
+    /** Optional directory whose audio files are imported too */
+    FString SourceDirectory;
+
+    /** Whether SourceDirectory is searched recursively */
+    bool bRecursive = true;
+
+    /** Content folder the sound waves are created in */
+    FString FolderPath = TEXT("/Game/Audio");
+
+    /** Prefix of the asset names, which are otherwise the file names */
+    FString AssetPrefix;
+
+    /** Whether an existing asset of the same name is replaced */
+    bool bReplaceExisting = true;
+
+    /** Whether the imported packages are saved once the import finishes */
+    bool bSave = true;
+
+    /** Files imported by one import task call */
+    int32 BatchSize = 32;
+
+    /** Most files validated on worker threads at once */
+    int32 MaxInFlight = 16;
+
+    FBulkSoundImportParams() = default;
+
+    bool IsValid(FString& OutError) const
+    {
+        if (SourceFilePaths.Num() == 0 && SourceDirectory.IsEmpty())
+        {
+            OutError = TEXT("Either 'source_file_paths' or 'source_directory' is required");
+            return false;
+        }
+        return true;
+    }
+};
+
 /**
  * Parameters for spawning an ambient sound actor
  */
@@ -191,6 +236,89 @@ struct UNREALMCP_API FSoundCueNodeParams
     }
 };
 
+/**
+ * One node of a Sound Cue spec
+ */
+struct UNREALMCP_API FSoundCueSpecNode
+{
+    /** Name the spec's connections use for this node; the node's object name is assigned in the cue */
+    FString Key;
+
+    /** Node type, as for add_sound_cue_node */
+    FString NodeType;
+
+    /** Optional sound wave path (for WavePlayer nodes) */
+    FString SoundWavePath;
+
+    /** Editor graph position */
+    int32 PosX = 0;
+    int32 PosY = 0;
+
+    /** Node properties by name, as for set_sound_cue_node_property */
+    TSharedPtr<FJsonObject> Properties;
+};
+
+/**
+ * One connection of a Sound Cue spec
+ * Either end is a spec node key or the ID of a node already in the cue; the target may also be
+ * "Output", the cue's root.
+ */
+struct UNREALMCP_API FSoundCueSpecConnection
+{
+    FString SourceNode;
+    FString TargetNode;
+    int32 TargetPinIndex = 0;
+};
+
+/**
+ * Parameters for building a Sound Cue graph from a declarative spec
+ */
+struct UNREALMCP_API FBuildSoundCueFromSpecParams
+{
+    /** Existing Sound Cue to build into; empty to create the one described by Creation */
+    FString SoundCuePath;
+
+    /** Sound Cue to create when SoundCuePath is empty */
+    FSoundCueCreationParams Creation;
+
+    /** Nodes with their properties */
+    TArray<FSoundCueSpecNode> Nodes;
+
+    /** Connections, made once every node exists */
+    TArray<FSoundCueSpecConnection> Connections;
+
+    /** Whether to compile the cue once everything is added */
+    bool bCompile = true;
+
+    FBuildSoundCueFromSpecParams() = default;
+
+    bool IsValid(FString& OutError) const
+    {
+        if (SoundCuePath.IsEmpty() && !Creation.IsValid(OutError))
+        {
+            OutError = TEXT("Either sound_cue_path or asset_name is required");
+            return false;
+        }
+
+        TSet<FString> Keys;
+        for (const FSoundCueSpecNode& Node : Nodes)
+        {
+            if (Node.Key.IsEmpty())
+            {
+                continue;
+            }
+            bool bAlreadyUsed = false;
+            Keys.Add(Node.Key, &bAlreadyUsed);
+            if (bAlreadyUsed)
+            {
+                OutError = FString::Printf(TEXT("Duplicate node key: %s"), *Node.Key);
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
 /**
  * Parameters for creating a Sound Class
  */
@@ -389,6 +517,111 @@ struct UNREALMCP_API FMetaSoundOutputParams
     }
 };
 
+/**
+ * One node of a MetaSound spec
+ */
+struct UNREALMCP_API FMetaSoundSpecNode
+{
+    /** Name the spec's edges refer to the node by */
+    FString Key;
+
+    /** Node to add; its MetaSoundPath is not used */
+    FMetaSoundNodeParams Node;
+
+    /** Input defaults by input name: numbers, booleans or strings */
+    TSharedPtr<FJsonObject> InputDefaults;
+};
+
+/**
+ * One connection of a MetaSound spec
+ * An end is a spec node key, a graph input or output name (of the spec or already in the
+ * MetaSound), or a node ID. The pin may be left empty on a graph input or output, whose
+ * node has a single pin named after it.
+ */
+struct UNREALMCP_API FMetaSoundSpecEdge
+{
+    FString FromNode;
+    FString FromPin;
+    FString ToNode;
+    FString ToPin;
+};
+
+/**
+ * Parameters for building a MetaSound graph from a declarative spec
+ */
+struct UNREALMCP_API FBuildMetaSoundFromSpecParams
+{
+    /** Existing MetaSound to build into; empty to create the one described by Creation */
+    FString MetaSoundPath;
+
+    /** MetaSound Source to create when MetaSoundPath is empty */
+    FMetaSoundSourceParams Creation;
+
+    /** Graph inputs and outputs; their MetaSoundPath is not used */
+    TArray<FMetaSoundInputParams> Inputs;
+    TArray<FMetaSoundOutputParams> Outputs;
+
+    /** Nodes with their input defaults */
+    TArray<FMetaSoundSpecNode> Nodes;
+
+    /** Connections, made once every input, output and node exists */
+    TArray<FMetaSoundSpecEdge> Edges;
+
+    /** Whether to register the graph for execution once everything is added */
+    bool bCompile = true;
+
+    FBuildMetaSoundFromSpecParams() = default;
+
+    bool IsValid(FString& OutError) const
+    {
+        if (MetaSoundPath.IsEmpty() && !Creation.IsValid(OutError))
+        {
+            OutError = TEXT("Either metasound_path or asset_name is required");
+            return false;
+        }
+
+        TSet<FString> Keys;
+        for (const FMetaSoundSpecNode& Node : Nodes)
+        {
+            if (Node.Key.IsEmpty())
+            {
+                continue;
+            }
+            bool bAlreadyUsed = false;
+            Keys.Add(Node.Key, &bAlreadyUsed);
+            if (bAlreadyUsed)
+            {
+                OutError = FString::Printf(TEXT("Duplicate node key: %s"), *Node.Key);
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * Parameters for searching the MetaSound node palette
+ */
+struct UNREALMCP_API FMetaSoundPaletteQuery
+{
+    /** Words that must all match a node class; empty lists every class */
+    FString SearchQuery;
+
+    /** Data types the node class must each have an input of, e.g. "Float" */
+    TArray<FString> InputTypes;
+
+    /** Data types the node class must each have an output of, e.g. "Trigger" */
+    TArray<FString> OutputTypes;
+
+    /** Index of the first result to return, in ranked order */
+    int32 Offset = 0;
+
+    /** Maximum number of results to return; 0 or less for all */
+    int32 MaxResults = 50;
+
+    FMetaSoundPaletteQuery() = default;
+};
+
 /**
  * Interface for Sound service operations
  * Provides abstraction for audio asset creation, modification, and management
@@ -412,13 +645,39 @@ public:
     virtual bool ImportSoundFile(const FSoundWaveImportParams& Params, FString& OutAssetPath, FString& OutError) = 0;
 
     /**
-     * Get metadata about a sound wave asset
+     * Start importing many audio files as sound waves, in batches across editor ticks
+     * Each file is read and its header validated on a worker thread; the files that pass are
+     * imported BatchSize at a time with one asset import task call, and every imported package
+     * is saved in one call at the end.
+     * @param Params - Files, destination and batching of the import
+     * @param OutJobId - Job to poll with GetBulkSoundImport
+     * @param OutFileCount - Number of files the job imports
+     * @param OutError - Error message if there is no file to import
+     * @return true if the job was started
+     */
+    virtual bool StartBulkSoundImport(const FBulkSoundImportParams& Params, int64& OutJobId, int32& OutFileCount, FString& OutError) = 0;
+
+    /**
+     * Get the results a StartBulkSoundImport job has produced so far
+     * @param JobId - Job returned by StartBulkSoundImport
+     * @param Cursor - Number of results already read; results are kept in completion order
+     * @param MaxResults - Most results returned
+     * @param OutStatus - JSON object with the job progress and the results after Cursor
+     * @param OutError - Error message if the job is unknown
+     * @return true if the job was found
+     */
+    virtual bool GetBulkSoundImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) = 0;
+
+    /**
+     * Get metadata about a sound wave asset, from its kept summary when the wave is not loaded
      * @param SoundWavePath - Path to the sound wave
-     * @param OutMetadata - Output JSON with duration, channels, sample rate, etc.
+     * @param bAllowLoad - Whether a wave without a kept summary may be loaded to compute one; if not, it is described from its asset registry tags
+     * @param bIncludeEnvelope - Whether to add the peak envelope of the summary
+     * @param OutMetadata - Output JSON with duration, channels, sample rate, levels, and where they were read from
      * @param OutError - Error message if operation fails
      * @return true if successful
      */
-    virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) = 0;
+    virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, bool bAllowLoad, bool bIncludeEnvelope, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) = 0;
 
     /**
      * Set properties on a sound wave
@@ -549,6 +808,18 @@ public:
      */
     virtual bool CompileSoundCue(const FString& SoundCuePath, FString& OutError) = 0;
 
+    /**
+     * Build a Sound Cue graph from a spec: nodes, their properties and connections
+     * Every edit is made on the sound nodes first; the editor graph is linked, the cue compiled
+     * and the asset saved once, at the end. A failing element is reported and skipped; the rest
+     * of the spec is still built.
+     * @param Params - Spec to build
+     * @param OutReport - JSON object with the Sound Cue path, the node IDs by spec key, a per-element result list and the compile result
+     * @param OutError - Error message if the Sound Cue could not be found or created
+     * @return true if the Sound Cue was found or created, whether or not every element succeeded
+     */
+    virtual bool BuildSoundCueFromSpec(const FBuildSoundCueFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+
     // ========================================================================
     // Sound Class/Mix Operations (Phase 4 - Music System)
     // ========================================================================
@@ -663,14 +934,27 @@ public:
     virtual bool CompileMetaSound(const FString& MetaSoundPath, FString& OutError) = 0;
 
     /**
-     * Search the MetaSound node palette for available node classes
-     * @param SearchQuery - Query string to filter nodes (searches name, namespace, keywords, category)
-     * @param MaxResults - Maximum number of results to return
-     * @param OutResults - Array of JSON objects with node class info (namespace, name, variant, display_name, description, category)
+     * Build a MetaSound graph from a spec: graph inputs and outputs, nodes and their input
+     * defaults, then the connections between them
+     * One document builder makes every edit; the editor graph is synchronized, the graph
+     * registered for execution and the asset saved once, at the end. A failing element is
+     * reported and skipped; the rest of the spec is still built.
+     * @param Params - Spec to build
+     * @param OutReport - JSON object with the MetaSound path, the node IDs by spec key, a per-element result list and the compile result
+     * @param OutError - Error message if the MetaSound could not be found or created
+     * @return true if the MetaSound was found or created, whether or not every element succeeded
+     */
+    virtual bool BuildMetaSoundFromSpec(const FBuildMetaSoundFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+
+    /**
+     * Search the MetaSound node palette for available node classes, best match first
+     * @param Query - Search words, required input and output types, and the page to return
+     * @param OutResults - Array of JSON objects with node class info (namespace, name, variant, display_name, description, category, inputs, outputs)
+     * @param OutTotalCount - Number of matching node classes before paging
      * @param OutError - Error message if operation fails
      * @return true if successful
      */
-    virtual bool SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) = 0;
+    virtual bool SearchMetaSoundPalette(const FMetaSoundPaletteQuery& Query, TArray<TSharedPtr<FJsonObject>>& OutResults, int32& OutTotalCount, FString& OutError) = 0;
 
     /**
      * Find a MetaSound Source by path
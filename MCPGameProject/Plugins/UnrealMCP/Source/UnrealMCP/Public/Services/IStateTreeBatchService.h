@@ -0,0 +1,175 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Services/StateTreeNodeTypeCatalog.h"
+
+struct FBuildStateTreeFromSpecParams;
+
+/**
+ * Parameters for listing node types from the type catalog
+ */
+struct UNREALMCP_API FStateTreeNodeTypeQuery
+{
+    /** Case-insensitive text the type name or path must contain (optional) */
+    FString Filter;
+
+    /** Schema class the native types must be allowed by (optional) */
+    FString SchemaClass;
+
+    /** StateTree whose schema the native types must be allowed by, when SchemaClass is empty (optional) */
+    FString StateTreePath;
+
+    /** Matching types skipped before the returned page */
+    int32 Offset = 0;
+
+    /** Most types returned; 0 for every match */
+    int32 Limit = 0;
+
+    FStateTreeNodeTypeQuery() = default;
+};
+
+/**
+ * Parameters for reading a StateTree's metadata, whole or in part
+ */
+struct UNREALMCP_API FStateTreeMetadataQuery
+{
+    /** State, by name or ID, whose subtree is returned; empty for every root state (optional) */
+    FString StateName;
+
+    /** Levels of children returned below the starting states; negative for every level */
+    int32 MaxDepth = -1;
+
+    /** Fields returned per state and for the tree; empty for every field, "name" and "id" are always returned */
+    TArray<FString> Fields;
+
+    /** Revision the caller last read; only what changed after it is returned. Negative for a full read */
+    int64 SinceRevision = -1;
+
+    FStateTreeMetadataQuery() = default;
+};
+
+/**
+ * Properties to set on one task, global task or evaluator
+ */
+struct UNREALMCP_API FNodePropertyEdit
+{
+    /** "task", "global_task" or "evaluator" */
+    FString NodeType = TEXT("task");
+
+    /** State containing the task; tasks only */
+    FString StateName;
+
+    /** Index of the node among the state's tasks, the global tasks or the evaluators; used when NodeName is empty */
+    int32 NodeIndex = 0;
+
+    /** Node ID, node name or struct name of the node (optional) */
+    FString NodeName;
+
+    /** Property paths ("Duration", "Settings.Radius") and their values */
+    TSharedPtr<FJsonObject> Properties;
+};
+
+/**
+ * Parameters for setting the properties of many nodes at once
+ */
+struct UNREALMCP_API FBatchSetNodePropertiesParams
+{
+    /** Path to the StateTree asset */
+    FString StateTreePath;
+
+    /** Edits, applied in order */
+    TArray<FNodePropertyEdit> Edits;
+
+    FBatchSetNodePropertiesParams() = default;
+
+    bool IsValid(FString& OutError) const;
+};
+
+/**
+ * Interface for StateTree operations that span many nodes, states or trees:
+ * catalog queries, batched edits, spec builds, bulk validation and PIE recording
+ */
+class UNREALMCP_API IStateTreeBatchService
+{
+public:
+    virtual ~IStateTreeBatchService() = default;
+
+    /**
+     * List one page of node types from the cached type catalog
+     * Blueprint types are not filtered by schema; that would load every Blueprint.
+     * @param Kind - Kind of node to list
+     * @param bBlueprint - List Blueprint types instead of native ones
+     * @param Query - Filter, schema and page
+     * @param OutTypes - Page of type paths and names, sorted by name
+     * @param OutTotalCount - Number of matching types before paging
+     * @param OutError - Error message if the schema cannot be resolved
+     * @return true if the types were listed
+     */
+    virtual bool QueryNodeTypes(EStateTreeNodeKind Kind, bool bBlueprint, const FStateTreeNodeTypeQuery& Query, TArray<TPair<FString, FString>>& OutTypes, int32& OutTotalCount, FString& OutError) = 0;
+
+    /**
+     * Set properties on many tasks, global tasks and evaluators in one operation
+     * Each path is looked up in the node's instance data, then in the node itself; paths are
+     * reflected once per node type for the whole batch. One undo transaction and one save.
+     * A failing edit or property is reported and skipped; the rest are still applied.
+     * @param Params - Edits to apply
+     * @param OutReport - JSON object with a per-edit list of the properties set and failed
+     * @param OutError - Error message if the StateTree could not be found
+     * @return true if the StateTree was found, whether or not every property was set
+     */
+    virtual bool BatchSetNodeProperties(const FBatchSetNodePropertiesParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+
+    /**
+     * Build a StateTree from a declarative spec in one pass
+     * States are added first so transitions and bindings can refer to any of them, then each state's
+     * tasks, enter conditions and transitions, the evaluators, the global tasks and the bindings.
+     * Every edit is one undo transaction with one save, and the tree is compiled once at the end.
+     * A failing element is reported and skipped; the rest of the spec is still built.
+     * @param Params - Spec to build
+     * @param OutReport - JSON object with the tree path, a per-element result list and the compile result
+     * @param OutError - Error message if the StateTree could not be found or created
+     * @return true if the StateTree was found or created, whether or not every element succeeded
+     */
+    virtual bool BuildStateTreeFromSpec(const FBuildStateTreeFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) = 0;
+
+    /**
+     * Start validating the bindings of many StateTrees, loading them asynchronously several at a time
+     * Each loaded tree's bindings are snapshotted on the game thread and checked on a worker thread.
+     * @param StateTreePaths - StateTrees to check, by path or name
+     * @param PackagePath - Optional folder whose StateTrees are checked too, recursively
+     * @param MaxInFlight - Most trees loading or being checked at once
+     * @param OutJobId - Job to poll with GetBulkBindingValidation
+     * @param OutTreeCount - Number of trees the job checks
+     * @param OutError - Error message if no StateTree was found
+     * @return true if the job was started
+     */
+    virtual bool StartBulkBindingValidation(const TArray<FString>& StateTreePaths, const FString& PackagePath, int32 MaxInFlight, int64& OutJobId, int32& OutTreeCount, FString& OutError) = 0;
+
+    /**
+     * Get the results a StartBulkBindingValidation job has produced so far
+     * @param JobId - Job returned by StartBulkBindingValidation
+     * @param Cursor - Number of results already read; results are kept in completion order
+     * @param MaxResults - Most results returned
+     * @param OutStatus - JSON object with the job progress and the results after Cursor
+     * @param OutError - Error message if the job is unknown
+     * @return true if the job was found
+     */
+    virtual bool GetBulkBindingValidation(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) = 0;
+
+    /**
+     * Start recording the state enter, exit and transition events of StateTrees running in PIE
+     * Drops the events of any earlier recording.
+     * @param StateTreePath - Only record this StateTree (optional; empty records every StateTree)
+     * @param Capacity - Events kept per running instance before the oldest are overwritten (0 for the default)
+     * @param OutError - Error message if recording cannot start
+     * @return true if recording started
+     */
+    virtual bool StartStateTreeRecording(const FString& StateTreePath, int32 Capacity, FString& OutError) = 0;
+
+    /**
+     * Stop recording StateTree execution events; the recorded events stay queryable
+     * @return true if a recording was running
+     */
+    virtual bool StopStateTreeRecording() = 0;
+};
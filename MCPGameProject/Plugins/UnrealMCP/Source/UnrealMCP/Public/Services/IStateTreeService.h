@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Services/IStateTreeBatchService.h"
 
 // Forward declarations
 class UStateTree;
@@ -483,11 +484,29 @@ struct UNREALMCP_API FQueryStatesByTagParams
     /** Whether to match exact tag or include children */
     bool bExactMatch = false;
 
+    /** Whether to also search the StateTrees run by LinkedAsset states, recursively */
+    bool bIncludeLinked = true;
+
     FQueryStatesByTagParams() = default;
 
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * State of a linked StateTree matched by a tag query
+ */
+struct UNREALMCP_API FLinkedStateTagMatch
+{
+    /** Path to the linked StateTree asset */
+    FString StateTreePath;
+
+    /** Name of the matched state */
+    FString StateName;
+
+    /** ID of the matched state */
+    FString StateId;
+};
+
 // ============================================================================
 // Section 9: Utility AI Consideration Params
 // ============================================================================
@@ -868,10 +887,61 @@ struct UNREALMCP_API FBatchAddTransitionsParams
     bool IsValid(FString& OutError) const;
 };
 
+/**
+ * Transition of a spec state with the conditions added to it
+ * StateTreePath, SourceStateName and TransitionIndex are filled in while building
+ */
+struct UNREALMCP_API FStateTreeSpecTransition
+{
+    FAddTransitionParams Transition;
+    TArray<FAddConditionParams> Conditions;
+};
+
+/**
+ * State of a spec with the nodes and transitions added to it
+ * StateTreePath and the state name of the nested params are filled in while building
+ */
+struct UNREALMCP_API FStateTreeSpecState
+{
+    FAddStateParams State;
+    TArray<FAddTaskParams> Tasks;
+    TArray<FAddEnterConditionParams> EnterConditions;
+    TArray<FStateTreeSpecTransition> Transitions;
+};
+
+/**
+ * Parameters for building a whole StateTree from a declarative spec
+ */
+struct UNREALMCP_API FBuildStateTreeFromSpecParams
+{
+    /** Existing StateTree to build into; empty to create the one described by Creation */
+    FString StateTreePath;
+
+    /** StateTree to create when StateTreePath is empty */
+    FStateTreeCreationParams Creation;
+
+    /** States, every parent before its children */
+    TArray<FStateTreeSpecState> States;
+
+    /** Evaluators and global tasks of the tree */
+    TArray<FAddEvaluatorParams> Evaluators;
+    TArray<FAddGlobalTaskParams> GlobalTasks;
+
+    /** Property bindings, applied once every state and node exists */
+    TArray<FBindPropertyParams> Bindings;
+
+    /** Whether to compile the tree once everything is added */
+    bool bCompile = true;
+
+    FBuildStateTreeFromSpecParams() = default;
+
+    bool IsValid(FString& OutError) const;
+};
+
 /**
  * Interface for StateTree service operations
  */
-class UNREALMCP_API IStateTreeService
+class UNREALMCP_API IStateTreeService : public IStateTreeBatchService
 {
 public:
     virtual ~IStateTreeService() = default;
@@ -897,11 +967,30 @@ public:
 
     /**
      * Compile a StateTree for runtime use
+     * The compile and its save are skipped when the editor data is unchanged since the last successful compile.
      * @param StateTree - StateTree to compile
      * @param OutError - Error message if compilation fails
-     * @return true if compilation succeeded
+     * @param bForce - Compile even if the compiled data is up to date
+     * @return true if compilation succeeded or was up to date
+     */
+    virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError, bool bForce = false) = 0;
+
+    /**
+     * Check whether a StateTree's compiled data matches its editor data
+     * @param StateTree - StateTree to check
+     * @return true if the editor data is unchanged since the last successful compile in this session
+     */
+    virtual bool IsStateTreeCompileUpToDate(UStateTree* StateTree) = 0;
+
+    /**
+     * Validate a StateTree (schema, bindings, node data) without changing or saving it
+     * The tree is compiled as a transient copy, so the asset's compiled data is left as it is.
+     * @param StateTree - StateTree to validate
+     * @param OutMessages - Errors and warnings the compiler reported
+     * @param OutError - Error message if validation fails
+     * @return true if the StateTree would compile
      */
-    virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError) = 0;
+    virtual bool ValidateStateTree(UStateTree* StateTree, TArray<FString>& OutMessages, FString& OutError) = 0;
 
     /**
      * Duplicate a StateTree asset
@@ -1003,11 +1092,15 @@ public:
 
     /**
      * Get StateTree metadata as JSON
+     * Every result carries the tree's revision, which advances whenever anything the metadata
+     * reports changes; a query since a known revision returns only the states changed after it.
      * @param StateTree - StateTree to query
+     * @param Query - Subtree, depth, fields and revision to read
      * @param OutMetadata - JSON object containing metadata
+     * @param OutError - Error message if the query failed
      * @return true if metadata was retrieved successfully
      */
-    virtual bool GetStateTreeMetadata(UStateTree* StateTree, TSharedPtr<FJsonObject>& OutMetadata) = 0;
+    virtual bool GetStateTreeMetadata(UStateTree* StateTree, const FStateTreeMetadataQuery& Query, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) = 0;
 
     /**
      * Get StateTree compilation diagnostics
@@ -1192,10 +1285,11 @@ public:
     /**
      * Query states by gameplay tag
      * @param Params - Query parameters
-     * @param OutStates - Array of state names matching the tag
+     * @param OutStates - Array of state names matching the tag, in tree order
+     * @param OutLinkedStates - States matching the tag in linked StateTrees, if Params.bIncludeLinked
      * @return true if query was successful
      */
-    virtual bool QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates) = 0;
+    virtual bool QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates, TArray<FLinkedStateTagMatch>& OutLinkedStates) = 0;
 
     // ============================================================================
     // Section 8: Runtime Inspection (PIE)
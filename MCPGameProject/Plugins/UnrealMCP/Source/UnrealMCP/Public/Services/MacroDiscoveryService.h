@@ -54,7 +54,15 @@ public:
      */
     static FString MapFunctionNameToMacroGraphName(const FString& FunctionName);
 
+    /**
+     * Drop the macro library index and stop following asset changes; the next lookup rebuilds it
+     */
+    static void ShutdownMacroIndex();
+
 private:
+    /** Macro graphs of every macro library by graph name; defined in the .cpp */
+    class FMacroLibraryIndex;
+
     /**
      * Try to load a macro blueprint from various common locations
      * @param MacroName - Name of the macro blueprint
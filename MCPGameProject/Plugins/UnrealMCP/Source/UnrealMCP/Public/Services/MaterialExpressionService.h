@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialExpression.h"
 #include "Dom/JsonObject.h"
@@ -100,9 +101,83 @@ struct UNREALMCP_API FMaterialExpressionConnectionParams
     }
 };
 
+/**
+ * Declarative description of expressions to add to a material, wired together and to the
+ * material outputs, for FMaterialExpressionService::BuildMaterialGraph
+ *
+ * Connections and outputs refer to expressions by the spec's own ids; an id that is not one of
+ * the spec's expressions may be the GUID of an expression already in the material.
+ */
+struct UNREALMCP_API FMaterialGraphBuildSpec
+{
+    /** An expression to create */
+    struct FExpression
+    {
+        /** Id the connections and outputs of the spec use for this expression */
+        FString Id;
+
+        /** Type of expression to create (e.g., "Constant3Vector", "Add", "TextureSample") */
+        FString ExpressionType;
+
+        /** Position in the graph; laid out automatically if unset */
+        TOptional<FVector2D> Position;
+
+        /** Expression-specific properties as JSON */
+        TSharedPtr<FJsonObject> Properties;
+    };
+
+    /** A wire from an expression output to another expression's input */
+    struct FConnection
+    {
+        FString SourceId;
+        int32 SourceOutputIndex = 0;
+        FString TargetId;
+        FString TargetInputName;
+    };
+
+    /** A wire from an expression output to a material property (e.g., "BaseColor") */
+    struct FOutputBinding
+    {
+        FString SourceId;
+        int32 SourceOutputIndex = 0;
+        FString MaterialProperty;
+    };
+
+    /** Path to the material to modify */
+    FString MaterialPath;
+
+    TArray<FExpression> Expressions;
+    TArray<FConnection> Connections;
+    TArray<FOutputBinding> Outputs;
+
+    /** Place expressions without a position in columns by their distance from the outputs */
+    bool bAutoLayout = true;
+
+    /** Compile the material once the graph is built */
+    bool bCompile = true;
+
+    /**
+     * Read a spec from build_material_graph parameters
+     * @param Params - Command parameters
+     * @param OutSpec - Parsed spec
+     * @param OutError - Error message if the parameters are malformed
+     * @return true if parsed
+     */
+    static bool FromJson(const TSharedPtr<FJsonObject>& Params, FMaterialGraphBuildSpec& OutSpec, FString& OutError);
+};
+
 /**
  * Service for material expression operations
  * Handles creation, connection, and management of material expression nodes
+ *
+ * Edits that need a recompile (deleting an expression, setting an expression property) recompile
+ * and save the material right away, unless it has an open edit session or an FMCPBatchEditScope is
+ * open. In both cases the edit only refreshes the graph and marks the material dirty:
+ * - with a session, one recompile and save happen on compile_material (recompile only) or when
+ *   the session ends, either on request or after mcp.MaterialEditSessionIdleSeconds without edits
+ * - in a batch, one recompile happens when the outermost scope closes, and the save is queued
+ *   with FMCPSaveQueue
+ * So a material built from dozens of expression commands is compiled once, not once per command.
  */
 class UNREALMCP_API FMaterialExpressionService
 {
@@ -223,7 +298,143 @@ public:
         TSharedPtr<FJsonObject>& OutResult,
         FString& OutError);
 
+    /**
+     * Start compiling a material without waiting for its shaders
+     * Shader compilation runs on the shader compiling workers; poll GetCompileJobStatus for the outcome.
+     * @param MaterialPath - Path to the material
+     * @param OutResult - Output JSON with the job id
+     * @param OutError - Error message if the material is not found
+     * @return true if the compile was started
+     */
+    bool StartCompileMaterial(
+        const FString& MaterialPath,
+        TSharedPtr<FJsonObject>& OutResult,
+        FString& OutError);
+
+    /**
+     * Report the progress of a compile started with StartCompileMaterial, and its errors once finished
+     * @param JobId - Job id from StartCompileMaterial
+     * @param OutResult - Output JSON with the job status, and compile and per-expression errors once finished
+     * @param OutError - Error message if the job is unknown
+     * @return true if the job was found
+     */
+    bool GetCompileJobStatus(
+        int64 JobId,
+        TSharedPtr<FJsonObject>& OutResult,
+        FString& OutError);
+
+    /**
+     * Create a set of expressions, connect them and bind them to material outputs in one edit:
+     * one graph rebuild and at most one compile, however many expressions the spec holds.
+     * If any part of the spec fails, the expressions created so far are removed again.
+     * @param Spec - Expressions, connections and output bindings to build
+     * @param OutResult - Output JSON mapping spec ids to expression GUIDs, plus the compile result
+     * @param OutError - Error message if the build fails
+     * @return true if the whole spec was built
+     */
+    bool BuildMaterialGraph(
+        const FMaterialGraphBuildSpec& Spec,
+        TSharedPtr<FJsonObject>& OutResult,
+        FString& OutError);
+
+    /**
+     * Open an edit session on a material; opening an already open session only extends it
+     * @param MaterialPath - Path to the material
+     * @param OutError - Error message if the material is not found
+     * @return true if the session is open
+     */
+    bool BeginEditSession(
+        const FString& MaterialPath,
+        FString& OutError);
+
+    /**
+     * End a material's edit session, recompiling and saving the material once if it was edited
+     * @param MaterialPath - Path to the material
+     * @param OutResult - Output JSON: the compile result when recompiled, plus session info
+     * @param OutError - Error message if the material has no session or fails to compile
+     * @return true if the session ended
+     */
+    bool EndEditSession(
+        const FString& MaterialPath,
+        TSharedPtr<FJsonObject>& OutResult,
+        FString& OutError);
+
+    /**
+     * End every edit session, recompiling and saving what was edited
+     */
+    void EndAllEditSessions();
+
 private:
+    /** Deferred work of a material with an open edit session */
+    struct FEditSession
+    {
+        /** Edits since the material was last recompiled */
+        int32 PendingEdits = 0;
+
+        /** Whether an edit skipped saving the package */
+        bool bNeedsSave = false;
+
+        /** FPlatformTime::Seconds() of the last edit, or of the session start */
+        double LastEditTime = 0.0;
+    };
+
+    /** Open edit sessions by material asset (never the Material Editor's transient copy) */
+    TMap<TWeakObjectPtr<UMaterial>, FEditSession> EditSessions;
+
+    /** Ends sessions left idle */
+    FTSTicker::FDelegateHandle EditSessionTickerHandle;
+
+    /** Idle timer for the edit sessions */
+    bool TickEditSessions(float DeltaTime);
+
+    /**
+     * Recompile and save a material after an edit, or leave both to its edit session or the open batch
+     * @param Material - Edited material asset
+     */
+    void CommitMaterialEdit(UMaterial* Material);
+
+    /**
+     * Count an edit that leaves the recompile to compile_material toward a material's edit session
+     * @param MaterialPath - Path to the edited material
+     */
+    void NoteEditInSession(const FString& MaterialPath);
+
+    /**
+     * Save a material's package to disk
+     * @param Material - Material to save
+     */
+    void SaveMaterialPackage(UMaterial* Material);
+
+    /** A compile started by StartCompileMaterial */
+    struct FCompileJob
+    {
+        TWeakObjectPtr<UMaterial> Material;
+        FString MaterialPath;
+        double StartTime = 0.0;
+
+        /** Set once the shaders finished: the status reported from then on */
+        TSharedPtr<FJsonObject> FinishedResult;
+    };
+
+    /** Compile jobs kept for status queries; the oldest are dropped beyond this */
+    static constexpr int32 MaxCompileJobs = 256;
+
+    /** Compile jobs by id, in the order they started */
+    TMap<int64, FCompileJob> CompileJobs;
+    int64 NextCompileJobId = 1;
+
+    /**
+     * Gather the shader compile errors of a material's resources for the current shader platform
+     * @param Material - Compiled material
+     * @param OutCompileErrors - Receives one entry per error and quality level
+     * @param OutExpressionErrors - Receives one entry per expression that raised an error
+     * @return true if there were compile errors
+     */
+    bool CollectCompileErrors(
+        UMaterial* Material,
+        TArray<TSharedPtr<FJsonValue>>& OutCompileErrors,
+        TArray<TSharedPtr<FJsonValue>>& OutExpressionErrors);
+
     /** Singleton instance */
     static TUniquePtr<FMaterialExpressionService> Instance;
 
@@ -272,6 +483,25 @@ private:
      */
     UMaterialExpression* CreateExpressionByType(UMaterial* Material, const FString& TypeName);
 
+    /**
+     * Create an expression, apply its properties and add it to the material, without rebuilding
+     * the graph; with an open Material Editor the editor creates the node as well
+     * @param Material - Working material to add the expression to
+     * @param MaterialEditor - Material Editor open on the material, if any
+     * @param ExpressionType - Type name (e.g., "Constant3Vector", "Add")
+     * @param Position - Position in the graph
+     * @param Properties - Expression-specific properties, may be null
+     * @param OutError - Error message if creation fails
+     * @return Created expression or nullptr if failed
+     */
+    UMaterialExpression* CreateExpressionInMaterial(
+        UMaterial* Material,
+        const TSharedPtr<class IMaterialEditor>& MaterialEditor,
+        const FString& ExpressionType,
+        const FVector2D& Position,
+        const TSharedPtr<FJsonObject>& Properties,
+        FString& OutError);
+
     /**
      * Get expression type class from string name
      * @param TypeName - Type name string
@@ -308,6 +538,12 @@ private:
      */
     void RecompileMaterial(UMaterial* Material);
 
+    /**
+     * Rebuild a material's graph from its expressions and refresh an open Material Editor, without recompiling
+     * @param Material - Modified material
+     */
+    void RefreshMaterialGraph(UMaterial* Material);
+
     /**
      * Get input pin info for an expression
      * @param Expression - Expression to query
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/UObjectGlobals.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
+
+/**
+ * In-memory material palette for search_material_palette
+ *
+ * Holds the placeable material expression classes and the material functions exposed to the
+ * library, each with its display name, categories, keywords and description. Expressions are read
+ * from their class default objects by the first search and again after a code reload. Functions
+ * are read from the asset registry tags UMaterialFunction writes, so none is loaded; they are
+ * indexed once the initial scan finishes, or by the first search after that, and follow
+ * OnAssetAdded/Removed/Renamed/Updated afterwards. A search made while the initial scan is still
+ * running is answered from the functions found so far, without keeping them.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FMaterialPaletteIndex
+{
+public:
+    /** One palette item */
+    struct FEntry
+    {
+        bool bIsFunction = false;
+        FString Name;
+        /** Expression class name; empty for functions */
+        FString ClassName;
+        /** Function object path; empty for expressions */
+        FString Path;
+        TArray<FString> Categories;
+        FString Description;
+
+        /** Lowercase copies the search compares against */
+        FString LowerName;
+        FString LowerClassName;
+        FString LowerPath;
+        TArray<FString> LowerCategories;
+        TArray<FString> LowerKeywords;
+        FString LowerDescription;
+    };
+
+    /** One search result */
+    struct FMatch
+    {
+        const FEntry* Entry = nullptr;
+        int32 Score = 0;
+    };
+
+    static FMaterialPaletteIndex& Get();
+
+    /** Start following the asset registry; indexes the functions if its initial scan is done */
+    void Initialize();
+
+    /** Stop following the asset registry and drop the palette */
+    void Shutdown();
+
+    /**
+     * Search the palette, best match first; expressions before functions on equal scores
+     * @param Query Case-insensitive words, all of which must match the name, class name, keywords, category, path or description; empty matches everything
+     * @param CategoryFilter Case-insensitive substring of one of the item's categories, or empty for all
+     * @param bExpressions Whether to search the expression classes
+     * @param bFunctions Whether to search the material functions
+     * @param OutMatches Receives every match, valid until the palette next changes
+     */
+    void Search(const FString& Query, const FString& CategoryFilter, bool bExpressions, bool bFunctions, TArray<FMatch>& OutMatches);
+
+    /** @return The categories of every expression class, sorted */
+    const TArray<FString>& GetExpressionCategories();
+
+private:
+    FMaterialPaletteIndex() = default;
+
+    /** Read the expression classes, unless they are read already */
+    void BuildExpressions();
+
+    /** Index the functions from the asset registry, unless they are indexed or the initial scan is running */
+    void BuildFunctions();
+
+    /** Read the functions the asset registry currently knows into a map of entries */
+    static void CollectFunctions(TMap<FSoftObjectPath, FEntry>& OutEntries);
+
+    /** @return Whether the asset is a library material function, and if so fill its entry */
+    static bool MakeFunctionEntry(const FAssetData& AssetData, FEntry& OutEntry);
+
+    /** @return The entry's score for one lowercase query word; 0 if the word does not match it */
+    static int32 ScoreWord(const FEntry& Entry, const FString& Word);
+
+    /** Fill the entry's lowercase copies */
+    static void MakeLowerCopies(FEntry& Entry);
+
+    void HandleFilesLoaded();
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    TArray<FEntry> Expressions;
+    TArray<FString> ExpressionCategories;
+    bool bExpressionsBuilt = false;
+
+    TMap<FSoftObjectPath, FEntry> Functions;
+    /** Functions of the last search made before they were indexed */
+    TMap<FSoftObjectPath, FEntry> PartialFunctions;
+    bool bFunctionsBuilt = false;
+    /** Searches that found what they searched built, or had to build or scan it */
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
@@ -35,6 +35,8 @@ public:
     virtual bool GetTextureParameter(const FString& MaterialPath, const FString& ParameterName, FString& OutTexturePath, FString& OutError) override;
     virtual bool ApplyMaterialToActor(const FString& ActorName, const FString& MaterialPath, int32 SlotIndex, const FString& ComponentName, FString& OutError) override;
     virtual bool DuplicateMaterialInstance(const FString& SourcePath, const FString& NewName, const FString& FolderPath, FString& OutAssetPath, FString& OutParentMaterial, FString& OutError) override;
+    virtual bool FindMaterialInstances(const FString& FolderPath, const FString& ParentMaterialPath, bool bRecursive, TArray<FString>& OutInstancePaths, FString& OutError) override;
+    virtual int32 SetMaterialInstanceParameters(const TArray<FString>& InstancePaths, const FMaterialInstanceParameterBatch& Batch, bool bSave, TArray<FMaterialInstanceParameterResult>& OutResults, FString& OutError) override;
 
 private:
     /** Singleton instance */
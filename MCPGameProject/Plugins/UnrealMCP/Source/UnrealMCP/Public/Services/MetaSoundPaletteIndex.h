@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPCacheStats.h"
+
+/**
+ * In-memory MetaSound node palette for search_metasound_palette
+ *
+ * Holds every registered MetaSound node class (deprecated versions excluded) with its class name,
+ * display name, category, keywords, description and input and output vertices. The classes are
+ * read from the frontend search engine by the first search, and again by the first search after
+ * the node class registry reports a registration or unregistration, so a search is a scan of
+ * prepared entries instead of a registry query and string building per class.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FMetaSoundPaletteIndex
+{
+public:
+    /** One input or output vertex of a node class */
+    struct FVertex
+    {
+        FString Name;
+        FString Type;
+    };
+
+    /** One node class */
+    struct FEntry
+    {
+        FString Namespace;
+        FString Name;
+        FString Variant;
+        FString DisplayName;
+        FString Description;
+        /** Category hierarchy joined with " > " */
+        FString Category;
+        /** "Namespace::Name (Variant)" */
+        FString FullName;
+        TArray<FVertex> Inputs;
+        TArray<FVertex> Outputs;
+
+        /** Vertex type names; FName comparison makes type lookups case-insensitive */
+        TSet<FName> InputTypes;
+        TSet<FName> OutputTypes;
+
+        /** Lowercase copies the search compares against */
+        FString LowerName;
+        FString LowerDisplayName;
+        FString LowerFullName;
+        FString LowerCategory;
+        FString LowerDescription;
+        TArray<FString> LowerKeywords;
+    };
+
+    /** One search result */
+    struct FMatch
+    {
+        const FEntry* Entry = nullptr;
+        int32 Score = 0;
+    };
+
+    static FMetaSoundPaletteIndex& Get();
+
+    ~FMetaSoundPaletteIndex();
+
+    /** Start following the node class registry */
+    void Initialize();
+
+    /** Stop following the node class registry and drop the palette */
+    void Shutdown();
+
+    /**
+     * Search the palette, best match first
+     * @param Query - Case-insensitive words, all of which must match the name, display name, full name, keywords, category or description; empty matches everything
+     * @param InputTypes - Data types the node class must each have an input of; empty for any
+     * @param OutputTypes - Data types the node class must each have an output of; empty for any
+     * @param OutMatches - Receives every match, valid until the palette next changes
+     */
+    void Search(const FString& Query, const TArray<FName>& InputTypes, const TArray<FName>& OutputTypes, TArray<FMatch>& OutMatches);
+
+private:
+    FMetaSoundPaletteIndex() = default;
+
+    /** Read the node classes, unless they are read and the registry has not changed since */
+    void Build();
+
+    /** @return The entry's score for one lowercase query word; 0 if the word does not match it */
+    static int32 ScoreWord(const FEntry& Entry, const FString& Word);
+
+    /** Node class registry transactions, defined where the frontend headers are included */
+    struct FRegistryWatch;
+    TUniquePtr<FRegistryWatch> RegistryWatch;
+
+    TArray<FEntry> Entries;
+    bool bBuilt = false;
+    /** Searches that found the palette built, or had to read it */
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+};
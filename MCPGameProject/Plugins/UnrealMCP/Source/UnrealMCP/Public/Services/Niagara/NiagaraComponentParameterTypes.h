@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Curve data formats of get_module_inputs and get_niagara_system_snapshot, and the values
+// set_niagara_component_parameters applies to placed components
+
+/**
+ * How the keys of curve inputs are written in module input results
+ */
+enum class ENiagaraCurveDataFormat : uint8
+{
+    /** "keyframes": one object per key */
+    Keyframes,
+    /** "times" and "values" (or RGBA "colors") as parallel number arrays */
+    Arrays,
+    /** "times" and "values" (or RGBA "colors") as base64 strings of little-endian float32 values */
+    Base64
+};
+
+/**
+ * Parse a curve data format name
+ * @param Name - "keyframes", "arrays" or "base64", case-insensitive
+ * @param OutFormat - Receives the format
+ * @return true if the name is a known format
+ */
+inline bool ParseNiagaraCurveDataFormat(const FString& Name, ENiagaraCurveDataFormat& OutFormat)
+{
+    if (Name.Equals(TEXT("keyframes"), ESearchCase::IgnoreCase))
+    {
+        OutFormat = ENiagaraCurveDataFormat::Keyframes;
+        return true;
+    }
+    if (Name.Equals(TEXT("arrays"), ESearchCase::IgnoreCase))
+    {
+        OutFormat = ENiagaraCurveDataFormat::Arrays;
+        return true;
+    }
+    if (Name.Equals(TEXT("base64"), ESearchCase::IgnoreCase))
+    {
+        OutFormat = ENiagaraCurveDataFormat::Base64;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * A user parameter value to set on placed Niagara components
+ */
+struct UNREALMCP_API FNiagaraComponentParameterValue
+{
+    /** Name of the user parameter, with or without the "User." prefix */
+    FString Name;
+
+    /** Value components: one for float, int and bool, two to four for vectors and colors */
+    TArray<double> Components;
+
+    /** Default constructor */
+    FNiagaraComponentParameterValue() = default;
+};
+
+/**
+ * Parameters for setting user parameters on the Niagara components of many placed actors
+ * Actors are matched by name or label, tag and class; an actor matching any of them is targeted
+ */
+struct UNREALMCP_API FNiagaraComponentParametersParams
+{
+    /** Object names or labels of the actors */
+    TArray<FString> ActorNames;
+
+    /** Actor tag */
+    FString Tag;
+
+    /** Actor class name or path */
+    FString ClassName;
+
+    /** Parameters set on every targeted component */
+    TArray<FNiagaraComponentParameterValue> Parameters;
+
+    /** Default constructor */
+    FNiagaraComponentParametersParams() = default;
+
+    /**
+     * Validate the parameters
+     * @param OutError - Error message if validation fails
+     * @return true if parameters are valid
+     */
+    bool IsValid(FString& OutError) const
+    {
+        if (ActorNames.Num() == 0 && Tag.IsEmpty() && ClassName.IsEmpty())
+        {
+            OutError = TEXT("At least one of actors, tag or class is required");
+            return false;
+        }
+        if (Parameters.Num() == 0)
+        {
+            OutError = TEXT("Parameters cannot be empty");
+            return false;
+        }
+        return true;
+    }
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
+
+/**
+ * In-memory index of the project's Niagara module scripts, for search_niagara_modules
+ *
+ * Entries are read from the asset registry tags UNiagaraScript writes (usage, module usage
+ * bitmask, category, description, keywords), so no script is loaded to index or search it.
+ * The index is built once the asset registry finishes its initial scan, or by the first search
+ * after that, and follows OnAssetAdded/Removed/Renamed/Updated afterwards. A search made while
+ * the initial scan is still running is answered from the assets found so far, without keeping
+ * the partial index.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FNiagaraModuleIndex
+{
+public:
+    /** One indexed module script */
+    struct FEntry
+    {
+        FSoftObjectPath ObjectPath;
+        FString Name;
+        FString Category;
+        FString Description;
+        /** Bit per ENiagaraScriptUsage the module may be used in; 0 if the tag is missing */
+        int32 UsageBitmask = 0;
+        bool bDeprecated = false;
+
+        /** Lowercase copies the search compares against */
+        FString LowerName;
+        FString LowerCategory;
+        FString LowerDescription;
+        TArray<FString> LowerKeywords;
+    };
+
+    /** One search result */
+    struct FMatch
+    {
+        const FEntry* Entry = nullptr;
+        int32 Score = 0;
+    };
+
+    static FNiagaraModuleIndex& Get();
+
+    /** Start following the asset registry; builds the index if its initial scan is done */
+    void Initialize();
+
+    /** Stop following the asset registry and drop the index */
+    void Shutdown();
+
+    /**
+     * Search the module scripts, best match first
+     * @param Query Case-insensitive words, all of which must match the name, keywords, category or description; empty matches every module
+     * @param UsageBitmask Bit per ENiagaraScriptUsage; a module matches if it allows any of them; 0 matches every module
+     * @param MaxResults Most matches returned
+     * @param OutMatches Receives the matches, valid until the index next changes
+     * @param OutTotalMatches Receives the number of matches before MaxResults was applied
+     */
+    void Search(const FString& Query, int32 UsageBitmask, int32 MaxResults, TArray<FMatch>& OutMatches, int32& OutTotalMatches);
+
+private:
+    FNiagaraModuleIndex() = default;
+
+    /** Build the index from the asset registry, unless it is built or the initial scan is running */
+    void Build();
+
+    /** Read the assets the asset registry currently knows into a map of entries */
+    static void CollectEntries(TMap<FSoftObjectPath, FEntry>& OutEntries);
+
+    /** @return Whether the asset is a Niagara module script, and if so fill its entry */
+    static bool MakeEntry(const FAssetData& AssetData, FEntry& OutEntry);
+
+    /** @return The entry's score for one lowercase query word; 0 if the word does not match it */
+    static int32 ScoreWord(const FEntry& Entry, const FString& Word);
+
+    void HandleFilesLoaded();
+    void HandleAssetAdded(const FAssetData& AssetData);
+    void HandleAssetRemoved(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TMap<FSoftObjectPath, FEntry> Entries;
+    /** Entries of the last search made before the index was built */
+    TMap<FSoftObjectPath, FEntry> PartialEntries;
+    bool bBuilt = false;
+    /** Searches that found the index built, or had to build it or scan the asset registry */
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle FilesLoadedHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+};
@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Services/INiagaraService.h"
+#include "Containers/Ticker.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/WeakObjectPtr.h"
 
 // Log category for Niagara service - shared across all split implementation files
 DECLARE_LOG_CATEGORY_EXTERN(LogNiagaraService, Log, All);
@@ -13,6 +17,8 @@ struct FVersionedNiagaraEmitterData;
 class UNiagaraRendererProperties;
 class UNiagaraDataInterface;
 class UNiagaraNodeFunctionCall;
+class UNiagaraScript;
+class UNiagaraGraph;
 struct FNiagaraEmitterHandle;
 
 /**
@@ -46,9 +52,14 @@ public:
     virtual bool SetEmitterProperty(const FNiagaraEmitterPropertyParams& Params, FString& OutError) override;
     virtual bool GetEmitterProperties(const FString& SystemPath, const FString& EmitterName, TSharedPtr<FJsonObject>& OutProperties, FString& OutError) override;
     virtual bool GetMetadata(const FString& AssetPath, const TArray<FString>* Fields, TSharedPtr<FJsonObject>& OutMetadata, const FString& EmitterName = TEXT(""), const FString& Stage = TEXT("")) override;
-    virtual bool GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs) override;
+    virtual bool GetModuleInputs(const FString& SystemPath, const FString& EmitterName, const FString& ModuleName, const FString& Stage, TSharedPtr<FJsonObject>& OutInputs, ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes) override;
     virtual bool GetEmitterModules(const FString& SystemPath, const FString& EmitterName, TSharedPtr<FJsonObject>& OutModules) override;
+    virtual bool GetSystemSnapshot(const FString& SystemPath, const TArray<FString>* Fields, const FString& EmitterName, TSharedPtr<FJsonObject>& OutSnapshot, FString& OutError, ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes) override;
     virtual bool CompileAsset(const FString& AssetPath, FString& OutError) override;
+    virtual bool StartCompileAsync(const FString& AssetPath, int64& OutJobId, FString& OutError) override;
+    virtual bool GetCompileStatus(int64 JobId, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) override;
+    virtual bool StartBulkDiagnostics(const TArray<FString>& SystemPaths, const FString& PackagePath, bool bCompile, int32 MaxInFlight, int64& OutJobId, int32& OutSystemCount, FString& OutError) override;
+    virtual bool GetBulkDiagnostics(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) override;
     virtual bool DuplicateSystem(const FString& SourcePath, const FString& NewName, const FString& FolderPath, FString& OutNewPath, FString& OutError) override;
 
     // ========================================================================
@@ -93,6 +104,7 @@ public:
     // ========================================================================
 
     virtual ANiagaraActor* SpawnActor(const FNiagaraActorSpawnParams& Params, FString& OutActorName, FString& OutError) override;
+    virtual bool SetComponentParameters(const FNiagaraComponentParametersParams& Params, TSharedPtr<FJsonObject>& OutResult, FString& OutError) override;
 
     // ========================================================================
     // INiagaraService interface implementation - Utility Methods
@@ -101,15 +113,124 @@ public:
     virtual UNiagaraSystem* FindSystem(const FString& SystemPath) override;
     virtual UNiagaraEmitter* FindEmitter(const FString& EmitterPath) override;
     virtual void RefreshEditors(UObject* Asset) override;
+    virtual void RequestRecompile(UNiagaraSystem* System) override;
 
 private:
     /** Singleton instance */
     static TUniquePtr<FNiagaraService> Instance;
 
+    /** Compile started by StartCompileAsync */
+    struct FCompileJob
+    {
+        FString AssetPath;
+        TWeakObjectPtr<UNiagaraSystem> System;
+        double StartTime = 0.0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+        bool bSucceeded = false;
+        /** Warnings on success, errors on failure, as CompileAsset reports them */
+        FString Message;
+    };
+
+    /** Finished compile jobs whose results are kept */
+    static constexpr int32 MaxFinishedCompileJobs = 64;
+
+    /** Compile jobs by id, game thread only */
+    TMap<int64, FCompileJob> CompileJobs;
+    int64 NextCompileJobId = 1;
+
+    /** System of a bulk diagnostics job that is loaded and waiting for its compile */
+    struct FBulkDiagnosticsSystem
+    {
+        FSoftObjectPath Path;
+        /** Keeps the system from being collected until its diagnostics are taken */
+        TStrongObjectPtr<UNiagaraSystem> System;
+        double StartTime = 0.0;
+    };
+
+    /** Diagnostics run started by StartBulkDiagnostics */
+    struct FBulkDiagnosticsJob
+    {
+        /** Systems to check, in request order */
+        TArray<FSoftObjectPath> Queue;
+        /** Systems in Queue plus the requested names that matched no system */
+        int32 SystemCount = 0;
+        /** Index in Queue of the next system to load */
+        int32 NextQueued = 0;
+        int32 LoadsInFlight = 0;
+        TArray<FBulkDiagnosticsSystem> Compiling;
+        int32 MaxInFlight = 8;
+        bool bCompile = false;
+        double StartTime = 0.0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+        /** Diagnostics per system, in completion order */
+        TArray<TSharedPtr<FJsonObject>> Results;
+        /** Systems that failed to load or are invalid */
+        int32 FailedCount = 0;
+    };
+
+    /** Finished bulk diagnostics jobs whose results are kept; results of thousands of systems are large */
+    static constexpr int32 MaxFinishedBulkDiagnosticsJobs = 4;
+
+    /** Bulk diagnostics jobs by id, game thread only */
+    TMap<int64, FBulkDiagnosticsJob> BulkDiagnosticsJobs;
+    int64 NextBulkDiagnosticsJobId = 1;
+
+    /** Ticks the bulk diagnostics jobs while any is running */
+    FTSTicker::FDelegateHandle BulkDiagnosticsTickerHandle;
+
     // ========================================================================
     // Internal Helper Methods
     // ========================================================================
 
+    /**
+     * Check a system whose compile has completed and collect its module warnings or compile errors
+     * @param System - Compiled system
+     * @param AssetPath - Path the compile was requested for, for logging
+     * @param OutMessage - Warnings if the system is valid, errors otherwise
+     * @return true if the system is valid
+     */
+    bool FinishCompile(UNiagaraSystem* System, const FString& AssetPath, FString& OutMessage) const;
+
+    /** Drop the oldest finished compile jobs beyond MaxFinishedCompileJobs */
+    void PruneFinishedCompileJobs();
+
+    /**
+     * Collect what CompileAsset reports about a compiled system, whether or not it is valid
+     * @param System - Compiled system
+     * @param OutCompileMessages - Receives script compile errors and warnings and renderer feedback
+     * @param OutModuleWarnings - Receives deprecated, experimental and note messages of the modules
+     */
+    void CollectCompileDiagnostics(UNiagaraSystem* System, TArray<FString>& OutCompileMessages, TArray<FString>& OutModuleWarnings) const;
+
+    /** Start loads up to each job's limit and take the diagnostics of systems done compiling */
+    bool TickBulkDiagnostics(float DeltaTime);
+
+    /** Take a loaded system of a bulk diagnostics job, or record that it failed to load */
+    void HandleBulkDiagnosticsLoaded(int64 JobId, const FSoftObjectPath& Path, bool bSucceeded);
+
+    /**
+     * Build the inputs of a module with their current values, as get_module_inputs reports them
+     * @param System - System owning the emitter
+     * @param EmitterHandle - Emitter the module belongs to
+     * @param Script - Stage script holding the module
+     * @param Graph - Graph of the stage script
+     * @param ModuleNode - Module function call node
+     * @param Usage - ENiagaraScriptUsage of the stage
+     * @param OutInputs - Receives one object per input
+     * @param CurveFormat - How the keys of curve inputs are written
+     */
+    void BuildModuleInputs(UNiagaraSystem* System, const FNiagaraEmitterHandle& EmitterHandle, UNiagaraScript* Script, UNiagaraGraph* Graph, UNiagaraNodeFunctionCall* ModuleNode, uint8 Usage, TArray<TSharedPtr<FJsonValue>>& OutInputs, ENiagaraCurveDataFormat CurveFormat = ENiagaraCurveDataFormat::Keyframes) const;
+
+    /**
+     * Serialize the editable properties of a renderer
+     * @param Renderer - Renderer to serialize
+     * @param OutProperties - Receives the property values by name
+     * @param OutBindings - Receives the attribute bindings by property name
+     */
+    void SerializeRendererProperties(UNiagaraRendererProperties* Renderer, TSharedPtr<FJsonObject>& OutProperties, TSharedPtr<FJsonObject>& OutBindings) const;
+
     /**
      * Get ENiagaraScriptUsage from stage string
      * @param Stage - "Spawn", "Update", or "Event"
@@ -143,6 +264,16 @@ private:
      */
     int32 FindEmitterHandleIndex(UNiagaraSystem* System, const FString& EmitterName) const;
 
+    /**
+     * Find a module in one stage of an emitter's graph, exact name first, then partial; spaces
+     * and case are ignored. The stage's modules are cached until the graph changes
+     * @param Graph - Emitter graph holding the stage
+     * @param Usage - ENiagaraScriptUsage of the stage
+     * @param ModuleName - Name of the module to find
+     * @return Module node or nullptr if not found
+     */
+    UNiagaraNodeFunctionCall* FindModuleNode(UNiagaraGraph* Graph, uint8 Usage, const FString& ModuleName) const;
+
     /**
      * Get versioned emitter data from a handle
      * @param Handle - Emitter handle
@@ -12,22 +12,39 @@ class UNREALMCP_API FNodeLayoutService
 {
 public:
     // Layout constants
-    static constexpr int32 HORIZONTAL_SPACING = 350;   // Space between layers (left-to-right)
-    static constexpr int32 VERTICAL_SPACING = 200;     // Space between nodes in same layer (increased)
-    static constexpr int32 NODE_WIDTH_ESTIMATE = 200;  // Estimated node width
-    static constexpr int32 NODE_HEIGHT_ESTIMATE = 120; // Estimated node height (increased)
-    static constexpr int32 PURE_NODE_OFFSET_X = -200;  // Pure nodes offset left of consumer
-    static constexpr int32 PURE_NODE_OFFSET_Y = -50;   // Pure nodes offset above consumer
-    static constexpr int32 PURE_NODE_VERTICAL_GAP = 140; // Vertical gap between stacked pure nodes
+    static constexpr int32 LAYER_GAP = 120;           // Gap between a layer's widest node and the next layer
+    static constexpr int32 NODE_GAP = 40;             // Vertical gap between nodes in the same layer
+    static constexpr int32 COMPONENT_GAP = 160;       // Vertical gap between unconnected parts of the graph
+    static constexpr int32 NODE_MIN_WIDTH = 96;       // Estimated width bounds for nodes without a stored size
+    static constexpr int32 NODE_MAX_WIDTH = 640;
+    static constexpr int32 NODE_HEADER_HEIGHT = 36;   // Title bar above the first row of pins
+    static constexpr int32 PIN_ROW_HEIGHT = 26;       // Height of one row of pins
+    static constexpr int32 CHAR_WIDTH_ESTIMATE = 7;   // Average width of a title or pin label character
+    static constexpr int32 OVERLAP_GRID_CELL = 256;   // Cell size of the grid used for overlap checks
 
     /**
-     * Auto-arrange all nodes in a graph using connection-aware horizontal flow layout.
+     * Auto-arrange all nodes in a graph with a layered left-to-right layout (see FLayeredGraphLayout).
+     * Pure nodes sit in the column before their nearest consumer; comment nodes are left alone.
+     * A graph whose fingerprint (FGraphFingerprintCache) still matches the one it had right after
+     * its last arrangement is not arranged again.
      * @param Graph The graph to arrange
      * @param OutArrangedCount Number of nodes that were arranged
      * @return True if arrangement was successful
      */
     static bool AutoArrangeNodes(UEdGraph* Graph, int32& OutArrangedCount);
 
+    /**
+     * Place only the given nodes, next to the nodes they connect to, in free space; every other node stays put.
+     * A node follows its placed inputs (pure nodes lead their placed consumers instead) and moves up or down
+     * the least it must to keep NODE_GAP clear of the nodes around it. Nodes with no placed neighbour keep
+     * their position unless something already sits there.
+     * @param Graph The graph holding the nodes
+     * @param NewNodes The nodes to place; nodes outside the graph and comment nodes are skipped
+     * @param OutArrangedCount Number of nodes that were placed
+     * @return True if placement was successful
+     */
+    static bool ArrangeNewNodes(UEdGraph* Graph, const TArray<UEdGraphNode*>& NewNodes, int32& OutArrangedCount);
+
     /**
      * Get layout information for a graph including node positions and overlap detection.
      * @param Graph The graph to analyze
@@ -40,52 +57,31 @@ public:
         TArray<TPair<FString, FString>>& OutOverlappingPairs);
 
 private:
-    /**
-     * Find root nodes (nodes with no incoming execution connections).
-     * These are typically Event nodes, entry points, etc.
-     */
-    static TArray<UEdGraphNode*> FindRootNodes(UEdGraph* Graph);
-
-    /**
-     * Find pure nodes (nodes with no execution pins - getters, math, etc.)
-     */
-    static TArray<UEdGraphNode*> FindPureNodes(UEdGraph* Graph);
-
-    /**
-     * Check if a node has any incoming execution connections.
-     */
-    static bool HasIncomingExecConnection(UEdGraphNode* Node);
-
     /**
      * Check if a node is a "pure" node (no execution pins).
      */
     static bool IsPureNode(UEdGraphNode* Node);
 
     /**
-     * Assign layer indices to nodes based on their distance from root nodes.
-     * @param RootNodes Starting nodes (layer 0)
-     * @param OutNodeLayers Map of node to layer index
-     */
-    static void AssignLayers(const TArray<UEdGraphNode*>& RootNodes,
-        TMap<UEdGraphNode*, int32>& OutNodeLayers);
-
-    /**
-     * Get nodes connected via outgoing execution pins.
+     * Get estimated bounds for a node.
      */
-    static TArray<UEdGraphNode*> GetOutgoingExecConnectedNodes(UEdGraphNode* Node);
+    static FIntRect GetNodeBounds(UEdGraphNode* Node);
 
     /**
-     * Get the node that consumes a pure node's output (for positioning pure nodes).
+     * Estimate the size a node is drawn at from its title and visible pins, unless it stores one.
+     * @param Node The node to measure
+     * @param OutPinOffsets Optional map receiving each visible pin's height below the top of the node
+     * @return Width and height
      */
-    static UEdGraphNode* GetPureNodeConsumer(UEdGraphNode* PureNode);
+    static FIntPoint EstimateNodeSize(UEdGraphNode* Node, TMap<const UEdGraphPin*, int32>* OutPinOffsets = nullptr);
 
     /**
-     * Check if two node bounds overlap.
+     * Move each node down until it no longer overlaps the nodes handled before it.
+     * @param Rects Node bounds, handled in order and updated in place
+     * @return Number of nodes moved
      */
-    static bool DoNodeBoundsOverlap(UEdGraphNode* NodeA, UEdGraphNode* NodeB);
+    static int32 ResolveOverlaps(TArray<FIntRect>& Rects);
 
-    /**
-     * Get estimated bounds for a node.
-     */
-    static FIntRect GetNodeBounds(UEdGraphNode* Node);
+    /** @return Whether two rectangles are closer than NODE_GAP */
+    static bool AreTooClose(const FIntRect& A, const FIntRect& B);
 };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/LockFreeList.h"
+#include "MCPMemory.h"
 
 /**
  * Statistics for monitoring object pool performance
@@ -47,10 +49,27 @@ struct UNREALMCP_API FObjectPoolStats
     }
 };
 
+namespace MCPObjectPool
+{
+    /** Id for a new pool; ids are never reused, so a thread's cache of a destroyed pool is never looked up again */
+    UNREALMCP_API uint32 AllocatePoolId();
+
+    /** The calling thread's cache of a pool, nullptr until the thread first uses the pool */
+    UNREALMCP_API void*& GetThreadCacheSlot(uint32 PoolId);
+}
+
 /**
  * Generic thread-safe object pool template
  * Provides efficient reuse of frequently created objects with automatic cleanup
- * 
+ *
+ * Each thread keeps two magazines (small arrays of objects) of its own, so most gets and returns
+ * touch no shared state at all. Only when both of a thread's magazines are empty (or full) does it
+ * trade a whole magazine with the shared depot, a lock-free list of full magazines. MaxPoolSize
+ * bounds the objects in the depot; each thread that uses the pool holds up to two more magazines.
+ *
+ * Statistics are counted per thread and summed when read. MaxPooledCount is sampled when magazines
+ * move to the depot and when statistics are read, so it can miss short peaks.
+ *
  * @param T - Type of objects to pool (must have default constructor and Reset() method)
  */
 template<typename T>
@@ -59,74 +78,112 @@ class UNREALMCP_API TObjectPool
 public:
     /**
      * Constructor
-     * @param InMaxPoolSize - Maximum number of objects to keep in pool
+     * @param InMaxPoolSize - Maximum number of objects to keep in the depot
      * @param InInitialPoolSize - Number of objects to pre-allocate
      */
     explicit TObjectPool(int32 InMaxPoolSize = 50, int32 InInitialPoolSize = 10)
-        : MaxPoolSize(InMaxPoolSize)
+        : PoolId(MCPObjectPool::AllocatePoolId())
+        , MagazineSize(FMath::Clamp(InMaxPoolSize / 4, 1, MaxMagazineSize))
+        , MaxPoolSize(InMaxPoolSize)
     {
-        // Pre-allocate initial objects
-        for (int32 i = 0; i < InInitialPoolSize; ++i)
+        LLM_SCOPE_BYTAG(UnrealMCP_ObjectPools);
+        // Pre-allocate initial objects into the depot
+        for (int32 Remaining = InInitialPoolSize; Remaining > 0; Remaining -= MagazineSize)
         {
-            TSharedPtr<T> NewObject = MakeShared<T>();
-            AvailableObjects.Add(NewObject);
+            FMagazine* Magazine = AllocateMagazine();
+            for (int32 i = 0; i < FMath::Min(Remaining, MagazineSize); ++i)
+            {
+                Magazine->Objects.Add(MakeShared<T>());
+            }
+            DepotObjectCount += Magazine->Objects.Num();
+            FullMagazines.Push(Magazine);
         }
-        
-        Stats.PooledCount = AvailableObjects.Num();
-        Stats.MaxPooledCount = Stats.PooledCount;
-        
-        UE_LOG(LogTemp, Log, TEXT("TObjectPool: Created pool with %d pre-allocated objects (max: %d)"), 
-            InInitialPoolSize, InMaxPoolSize);
+
+        MaxPooledCount = DepotObjectCount.Load();
+
+        UE_LOG(LogTemp, Log, TEXT("TObjectPool: Created pool with %d pre-allocated objects (max: %d, magazine: %d)"),
+            InInitialPoolSize, InMaxPoolSize, MagazineSize);
     }
-    
+
     /**
      * Destructor - cleans up all pooled objects
+     * No thread may use the pool while it is destroyed
      */
     ~TObjectPool()
     {
-        FScopeLock Lock(&PoolLock);
-        int32 CleanedCount = AvailableObjects.Num();
-        AvailableObjects.Empty();
+        int32 CleanedCount = GetAvailableCount();
+
+        FScopeLock Lock(&ThreadCachesLock);
+        for (FThreadCache* Cache : ThreadCaches)
+        {
+            delete Cache->Loaded;
+            delete Cache->Previous;
+            delete Cache;
+        }
+        ThreadCaches.Empty();
+
+        while (FMagazine* Magazine = FullMagazines.Pop())
+        {
+            delete Magazine;
+        }
+        while (FMagazine* Magazine = EmptyMagazines.Pop())
+        {
+            delete Magazine;
+        }
+
         UE_LOG(LogTemp, Log, TEXT("TObjectPool: Destroyed pool, cleaned up %d objects"), CleanedCount);
     }
-    
+
     /**
      * Get an object from the pool (reused if available, created if not)
      * @return Shared pointer to object ready for use
      */
     TSharedPtr<T> GetObject()
     {
-        FScopeLock Lock(&PoolLock);
-        
-        Stats.TotalRequests++;
-        
-        if (AvailableObjects.Num() > 0)
+        FThreadCache& Cache = GetThreadCache();
+        Increment(Cache.Requests);
+
+        if (Cache.Loaded->Objects.Num() == 0)
+        {
+            if (Cache.Previous->Objects.Num() > 0)
+            {
+                Swap(Cache.Loaded, Cache.Previous);
+            }
+            else if (FMagazine* Full = FullMagazines.Pop())
+            {
+                // Both magazines are empty: trade one for a full magazine from the depot
+                DepotObjectCount -= Full->Objects.Num();
+                EmptyMagazines.Push(Cache.Previous);
+                Cache.Previous = Cache.Loaded;
+                Cache.Loaded = Full;
+            }
+        }
+
+        if (Cache.Loaded->Objects.Num() > 0)
         {
             // Reuse existing object
-            TSharedPtr<T> ReusedObject = AvailableObjects.Pop();
-            Stats.PoolHits++;
-            Stats.PooledCount = AvailableObjects.Num();
-            
+            TSharedPtr<T> ReusedObject = Cache.Loaded->Objects.Pop(EAllowShrinking::No);
+            Increment(Cache.Hits);
+            UpdateCachedCount(Cache);
+
             // Reset the object to clean state
             if (ReusedObject.IsValid())
             {
                 ResetObject(ReusedObject.Get());
             }
-            
-            UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Reused object from pool (%d remaining)"), AvailableObjects.Num());
+
             return ReusedObject;
         }
-        else
-        {
-            // Create new object
-            TSharedPtr<T> NewObject = MakeShared<T>();
-            Stats.PoolMisses++;
-            
-            UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Created new object (pool empty)"));
-            return NewObject;
-        }
+
+        // Create new object
+        LLM_SCOPE_BYTAG(UnrealMCP_ObjectPools);
+        TSharedPtr<T> NewObject = MakeShared<T>();
+        Increment(Cache.Misses);
+
+        UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Created new object (pool empty)"));
+        return NewObject;
     }
-    
+
     /**
      * Return an object to the pool for reuse
      * @param Object - Object to return to pool
@@ -137,116 +194,306 @@ public:
         {
             return;
         }
-        
-        FScopeLock Lock(&PoolLock);
-        
-        Stats.TotalReturns++;
-        
-        if (AvailableObjects.Num() < MaxPoolSize)
-        {
-            // Add to pool for reuse
-            AvailableObjects.Add(Object);
-            Stats.PooledCount = AvailableObjects.Num();
-            Stats.MaxPooledCount = FMath::Max(Stats.MaxPooledCount, Stats.PooledCount);
-            
-            UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Returned object to pool (%d total)"), AvailableObjects.Num());
-        }
-        else
+
+        FThreadCache& Cache = GetThreadCache();
+        Increment(Cache.Returns);
+
+        if (Cache.Loaded->Objects.Num() >= MagazineSize)
         {
-            // Pool is full, discard object
-            Stats.DiscardedCount++;
-            UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Discarded object (pool full at %d)"), MaxPoolSize);
+            if (Cache.Previous->Objects.Num() < MagazineSize)
+            {
+                Swap(Cache.Loaded, Cache.Previous);
+            }
+            else
+            {
+                // Both magazines are full: hand one to the depot and continue with an empty one
+                PushToDepot(Cache, Cache.Previous);
+                Cache.Previous = Cache.Loaded;
+                Cache.Loaded = PopEmptyMagazine();
+            }
         }
+
+        Cache.Loaded->Objects.Add(MoveTemp(Object));
+        UpdateCachedCount(Cache);
     }
-    
+
     /**
      * Clear all objects from the pool
+     * Other threads drop the objects in their own magazines the next time they use the pool
      */
     void ClearPool()
     {
-        FScopeLock Lock(&PoolLock);
-        int32 ClearedCount = AvailableObjects.Num();
-        AvailableObjects.Empty();
-        Stats.PooledCount = 0;
+        FThreadCache& CallerCache = GetThreadCache();
+        ++Generation;
+
+        int32 ClearedCount = 0;
+        while (FMagazine* Magazine = FullMagazines.Pop())
+        {
+            DepotObjectCount -= Magazine->Objects.Num();
+            ClearedCount += Magazine->Objects.Num();
+            Magazine->Objects.Reset();
+            EmptyMagazines.Push(Magazine);
+        }
+
+        // The calling thread's magazines can be dropped right away
+        ClearedCount += FlushIfStale(CallerCache);
+
         UE_LOG(LogTemp, Log, TEXT("TObjectPool: Cleared pool, removed %d objects"), ClearedCount);
     }
-    
+
     /**
      * Get current pool statistics
      * @return Copy of current statistics
      */
     FObjectPoolStats GetStats() const
     {
-        FScopeLock Lock(&PoolLock);
-        FObjectPoolStats StatsCopy = Stats;
-        StatsCopy.PooledCount = AvailableObjects.Num();
+        FScopeLock Lock(&ThreadCachesLock);
+        FObjectPoolStats StatsCopy = SumStats();
+        StatsCopy.TotalRequests -= ResetBaseline.TotalRequests;
+        StatsCopy.PoolHits -= ResetBaseline.PoolHits;
+        StatsCopy.PoolMisses -= ResetBaseline.PoolMisses;
+        StatsCopy.TotalReturns -= ResetBaseline.TotalReturns;
+        StatsCopy.DiscardedCount -= ResetBaseline.DiscardedCount;
+        SampleMaxPooledCount(StatsCopy.PooledCount);
+        StatsCopy.MaxPooledCount = MaxPooledCount.Load();
         return StatsCopy;
     }
-    
+
     /**
      * Reset pool statistics
      */
     void ResetStats()
     {
-        FScopeLock Lock(&PoolLock);
-        Stats.Reset();
-        Stats.PooledCount = AvailableObjects.Num();
-        Stats.MaxPooledCount = Stats.PooledCount;
+        FScopeLock Lock(&ThreadCachesLock);
+        ResetBaseline = SumStats();
+        MaxPooledCount = ResetBaseline.PooledCount;
         UE_LOG(LogTemp, Log, TEXT("TObjectPool: Statistics reset"));
     }
-    
+
     /**
      * Get current number of available objects in pool
-     * @return Number of objects ready for reuse
+     * @return Number of objects ready for reuse, in the depot and in every thread's magazines
      */
     int32 GetAvailableCount() const
     {
-        FScopeLock Lock(&PoolLock);
-        return AvailableObjects.Num();
+        FScopeLock Lock(&ThreadCachesLock);
+        return SumStats().PooledCount;
     }
-    
+
     /**
      * Get maximum pool size
-     * @return Maximum number of objects that can be pooled
+     * @return Maximum number of objects that can be pooled in the depot
      */
     int32 GetMaxPoolSize() const
     {
-        return MaxPoolSize;
+        return MaxPoolSize.Load();
     }
-    
+
     /**
-     * Set maximum pool size (will trim pool if necessary)
+     * Set maximum pool size (will trim the depot if necessary)
      * @param NewMaxSize - New maximum pool size
      */
     void SetMaxPoolSize(int32 NewMaxSize)
     {
-        FScopeLock Lock(&PoolLock);
         MaxPoolSize = NewMaxSize;
-        
-        // Trim pool if it's now too large
-        while (AvailableObjects.Num() > MaxPoolSize)
+
+        // Trim the depot if it's now too large
+        int32 TrimmedCount = 0;
+        while (DepotObjectCount.Load() > NewMaxSize)
         {
-            AvailableObjects.Pop();
-            Stats.DiscardedCount++;
+            FMagazine* Magazine = FullMagazines.Pop();
+            if (!Magazine)
+            {
+                break;
+            }
+            DepotObjectCount -= Magazine->Objects.Num();
+            TrimmedCount += Magazine->Objects.Num();
+            Magazine->Objects.Reset();
+            EmptyMagazines.Push(Magazine);
         }
-        
-        Stats.PooledCount = AvailableObjects.Num();
-        UE_LOG(LogTemp, Log, TEXT("TObjectPool: Set max pool size to %d (current: %d)"), NewMaxSize, Stats.PooledCount);
+        DepotDiscardedCount += TrimmedCount;
+
+        UE_LOG(LogTemp, Log, TEXT("TObjectPool: Set max pool size to %d (trimmed: %d)"), NewMaxSize, TrimmedCount);
     }
 
 private:
-    /** Array of available objects for reuse */
-    TArray<TSharedPtr<T>> AvailableObjects;
-    
-    /** Maximum number of objects to keep in pool */
-    int32 MaxPoolSize;
-    
-    /** Pool statistics */
-    mutable FObjectPoolStats Stats;
-    
-    /** Critical section for thread safety */
-    mutable FCriticalSection PoolLock;
-    
+    /** Upper bound of MagazineSize */
+    static constexpr int32 MaxMagazineSize = 16;
+
+    /** Batch of objects traded between a thread and the depot as a whole */
+    struct FMagazine
+    {
+        TArray<TSharedPtr<T>> Objects;
+    };
+
+    /**
+     * A thread's magazines and counters
+     * Only the owning thread changes them; the counters are atomic so GetStats can read them from any thread
+     */
+    struct FThreadCache
+    {
+        FMagazine* Loaded = nullptr;
+        FMagazine* Previous = nullptr;
+
+        /** Value of Generation the magazines were last checked against */
+        uint32 SeenGeneration = 0;
+
+        TAtomic<int32> CachedCount { 0 };
+        TAtomic<int32> Requests { 0 };
+        TAtomic<int32> Hits { 0 };
+        TAtomic<int32> Misses { 0 };
+        TAtomic<int32> Returns { 0 };
+        TAtomic<int32> Discarded { 0 };
+    };
+
+    /** Add to a counter only its owning thread writes, without a read-modify-write */
+    static void Increment(TAtomic<int32>& Counter, int32 Amount = 1)
+    {
+        Counter.Store(Counter.Load(EMemoryOrder::Relaxed) + Amount, EMemoryOrder::Relaxed);
+    }
+
+    static void UpdateCachedCount(FThreadCache& Cache)
+    {
+        Cache.CachedCount.Store(Cache.Loaded->Objects.Num() + Cache.Previous->Objects.Num(), EMemoryOrder::Relaxed);
+    }
+
+    FMagazine* AllocateMagazine() const
+    {
+        LLM_SCOPE_BYTAG(UnrealMCP_ObjectPools);
+        FMagazine* Magazine = new FMagazine();
+        Magazine->Objects.Reserve(MagazineSize);
+        return Magazine;
+    }
+
+    FMagazine* PopEmptyMagazine()
+    {
+        FMagazine* Magazine = EmptyMagazines.Pop();
+        return Magazine ? Magazine : AllocateMagazine();
+    }
+
+    /** The calling thread's cache, created on its first use of the pool */
+    FThreadCache& GetThreadCache()
+    {
+        void*& Slot = MCPObjectPool::GetThreadCacheSlot(PoolId);
+        if (Slot == nullptr)
+        {
+            FThreadCache* NewCache = new FThreadCache();
+            NewCache->Loaded = PopEmptyMagazine();
+            NewCache->Previous = PopEmptyMagazine();
+            NewCache->SeenGeneration = Generation.Load();
+
+            FScopeLock Lock(&ThreadCachesLock);
+            ThreadCaches.Add(NewCache);
+            Slot = NewCache;
+        }
+
+        FThreadCache& Cache = *static_cast<FThreadCache*>(Slot);
+        FlushIfStale(Cache);
+        return Cache;
+    }
+
+    /**
+     * Drop the thread's objects if ClearPool ran since it last looked
+     * @return Number of objects dropped
+     */
+    int32 FlushIfStale(FThreadCache& Cache)
+    {
+        const uint32 CurrentGeneration = Generation.Load(EMemoryOrder::Relaxed);
+        if (Cache.SeenGeneration == CurrentGeneration)
+        {
+            return 0;
+        }
+
+        Cache.SeenGeneration = CurrentGeneration;
+        const int32 DroppedCount = Cache.Loaded->Objects.Num() + Cache.Previous->Objects.Num();
+        Cache.Loaded->Objects.Reset();
+        Cache.Previous->Objects.Reset();
+        UpdateCachedCount(Cache);
+        return DroppedCount;
+    }
+
+    /** Move a full magazine to the depot, or discard its objects if the depot is at MaxPoolSize */
+    void PushToDepot(FThreadCache& Cache, FMagazine* Magazine)
+    {
+        const int32 Count = Magazine->Objects.Num();
+        const int32 NewDepotCount = (DepotObjectCount += Count);
+        if (NewDepotCount <= MaxPoolSize.Load(EMemoryOrder::Relaxed))
+        {
+            FullMagazines.Push(Magazine);
+            SampleMaxPooledCount(NewDepotCount + Cache.CachedCount.Load(EMemoryOrder::Relaxed));
+            return;
+        }
+
+        // Depot is full, discard the magazine's objects
+        DepotObjectCount -= Count;
+        Increment(Cache.Discarded, Count);
+        Magazine->Objects.Reset();
+        EmptyMagazines.Push(Magazine);
+        UE_LOG(LogTemp, VeryVerbose, TEXT("TObjectPool: Discarded %d objects (pool full at %d)"), Count, MaxPoolSize.Load());
+    }
+
+    void SampleMaxPooledCount(int32 PooledCount) const
+    {
+        int32 Current = MaxPooledCount.Load(EMemoryOrder::Relaxed);
+        while (PooledCount > Current && !MaxPooledCount.CompareExchange(Current, PooledCount))
+        {
+        }
+    }
+
+    /** Raw totals over all threads; ThreadCachesLock must be held */
+    FObjectPoolStats SumStats() const
+    {
+        FObjectPoolStats Totals;
+        Totals.PooledCount = DepotObjectCount.Load();
+        Totals.DiscardedCount = DepotDiscardedCount.Load();
+        for (const FThreadCache* Cache : ThreadCaches)
+        {
+            Totals.TotalRequests += Cache->Requests.Load(EMemoryOrder::Relaxed);
+            Totals.PoolHits += Cache->Hits.Load(EMemoryOrder::Relaxed);
+            Totals.PoolMisses += Cache->Misses.Load(EMemoryOrder::Relaxed);
+            Totals.TotalReturns += Cache->Returns.Load(EMemoryOrder::Relaxed);
+            Totals.DiscardedCount += Cache->Discarded.Load(EMemoryOrder::Relaxed);
+            Totals.PooledCount += Cache->CachedCount.Load(EMemoryOrder::Relaxed);
+        }
+        return Totals;
+    }
+
+    /** Key of this pool's per-thread caches */
+    const uint32 PoolId;
+
+    /** Number of objects per magazine */
+    const int32 MagazineSize;
+
+    /** Maximum number of objects to keep in the depot */
+    TAtomic<int32> MaxPoolSize;
+
+    /** Full magazines shared by all threads */
+    TLockFreePointerListUnordered<FMagazine, PLATFORM_CACHE_LINE_SIZE> FullMagazines;
+
+    /** Empty magazines, reused before new ones are allocated */
+    TLockFreePointerListUnordered<FMagazine, PLATFORM_CACHE_LINE_SIZE> EmptyMagazines;
+
+    /** Objects in FullMagazines */
+    TAtomic<int32> DepotObjectCount { 0 };
+
+    /** Objects discarded when trimming the depot */
+    TAtomic<int32> DepotDiscardedCount { 0 };
+
+    /** Bumped by ClearPool so threads drop their magazines */
+    TAtomic<uint32> Generation { 0 };
+
+    /** Sampled high-water mark of pooled objects */
+    mutable TAtomic<int32> MaxPooledCount { 0 };
+
+    /** Every thread cache of the pool, for statistics and cleanup */
+    TArray<FThreadCache*> ThreadCaches;
+
+    /** Totals at the last ResetStats */
+    FObjectPoolStats ResetBaseline;
+
+    /** Guards ThreadCaches and ResetBaseline; not taken by GetObject or ReturnObject once a thread has its cache */
+    mutable FCriticalSection ThreadCachesLock;
+
     /**
      * Reset an object to clean state for reuse
      * Calls Reset() method if available, otherwise does nothing
@@ -21,18 +21,23 @@ struct UNREALMCP_API FObjectPoolManagerStats
     /** Statistics for JSON value pool */
     FObjectPoolStats JsonValueStats;
     
+    /** Statistics for string buffer pool */
+    FObjectPoolStats StringBufferStats;
+    
     /** Total number of requests across all pools */
     int32 GetTotalRequests() const
     {
         return JsonObjectStats.TotalRequests + MCPResponseStats.TotalRequests + 
-               ParameterValidatorStats.TotalRequests + JsonValueStats.TotalRequests;
+               ParameterValidatorStats.TotalRequests + JsonValueStats.TotalRequests +
+               StringBufferStats.TotalRequests;
     }
     
     /** Total number of hits across all pools */
     int32 GetTotalHits() const
     {
         return JsonObjectStats.PoolHits + MCPResponseStats.PoolHits + 
-               ParameterValidatorStats.PoolHits + JsonValueStats.PoolHits;
+               ParameterValidatorStats.PoolHits + JsonValueStats.PoolHits +
+               StringBufferStats.PoolHits;
     }
     
     /** Overall hit ratio across all pools */
@@ -46,7 +51,8 @@ struct UNREALMCP_API FObjectPoolManagerStats
     int32 GetTotalPooledObjects() const
     {
         return JsonObjectStats.PooledCount + MCPResponseStats.PooledCount + 
-               ParameterValidatorStats.PooledCount + JsonValueStats.PooledCount;
+               ParameterValidatorStats.PooledCount + JsonValueStats.PooledCount +
+               StringBufferStats.PooledCount;
     }
 };
 
@@ -121,6 +127,18 @@ public:
      */
     void ReturnJsonValue(TSharedPtr<FPoolableJsonValue> Value);
     
+    /**
+     * Get an empty string buffer from the pool
+     * @return Shared pointer to poolable string buffer
+     */
+    TSharedPtr<FPoolableStringBuffer> GetStringBuffer();
+    
+    /**
+     * Return a string buffer to the pool
+     * @param Buffer - Buffer to return to pool
+     */
+    void ReturnStringBuffer(TSharedPtr<FPoolableStringBuffer> Buffer);
+    
     /**
      * Get combined statistics for all pools
      * @return Combined statistics
@@ -143,11 +161,13 @@ public:
      * @param MCPResponsePoolSize - Max size for MCP response pool
      * @param ParameterValidatorPoolSize - Max size for parameter validator pool
      * @param JsonValuePoolSize - Max size for JSON value pool
+     * @param StringBufferPoolSize - Max size for string buffer pool
      */
     void ConfigurePoolSizes(int32 JsonObjectPoolSize = 50, 
                            int32 MCPResponsePoolSize = 100, 
                            int32 ParameterValidatorPoolSize = 30,
-                           int32 JsonValuePoolSize = 200);
+                           int32 JsonValuePoolSize = 200,
+                           int32 StringBufferPoolSize = 16);
     
     /**
      * Get current pool sizes
@@ -155,11 +175,13 @@ public:
      * @param OutMCPResponsePoolSize - Current MCP response pool size
      * @param OutParameterValidatorPoolSize - Current parameter validator pool size
      * @param OutJsonValuePoolSize - Current JSON value pool size
+     * @param OutStringBufferPoolSize - Current string buffer pool size
      */
     void GetPoolSizes(int32& OutJsonObjectPoolSize, 
                      int32& OutMCPResponsePoolSize, 
                      int32& OutParameterValidatorPoolSize,
-                     int32& OutJsonValuePoolSize) const;
+                     int32& OutJsonValuePoolSize,
+                     int32& OutStringBufferPoolSize) const;
     
     /**
      * Check if pools are initialized
@@ -186,9 +208,45 @@ private:
     /** JSON value pool */
     TUniquePtr<TObjectPool<FPoolableJsonValue>> JsonValuePool;
     
+    /** String buffer pool */
+    TUniquePtr<TObjectPool<FPoolableStringBuffer>> StringBufferPool;
+    
     /** Whether pools are initialized */
     bool bInitialized = false;
     
-    /** Critical section for thread safety */
-    mutable FCriticalSection ManagerLock;
+    /**
+     * Guards bInitialized and the pool pointers
+     * Getting and returning objects only read them, so they share the lock; the pools are thread-safe themselves
+     */
+    mutable FRWLock ManagerLock;
+};
+
+/**
+ * String buffer borrowed from FObjectPoolManager for the current scope
+ * Serialize into Get(), copy out the finished text, and the buffer goes back to the pool on destruction
+ */
+class UNREALMCP_API FScopedPooledStringBuffer
+{
+public:
+    FScopedPooledStringBuffer()
+        : PooledBuffer(FObjectPoolManager::Get().GetStringBuffer())
+    {
+    }
+    
+    ~FScopedPooledStringBuffer()
+    {
+        FObjectPoolManager::Get().ReturnStringBuffer(MoveTemp(PooledBuffer));
+    }
+    
+    FScopedPooledStringBuffer(const FScopedPooledStringBuffer&) = delete;
+    FScopedPooledStringBuffer& operator=(const FScopedPooledStringBuffer&) = delete;
+    
+    /** @return The borrowed buffer, empty when the scope starts */
+    FString& Get()
+    {
+        return PooledBuffer->GetBuffer();
+    }
+
+private:
+    TSharedPtr<FPoolableStringBuffer> PooledBuffer;
 };
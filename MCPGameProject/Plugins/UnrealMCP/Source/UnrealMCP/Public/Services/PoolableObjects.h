@@ -361,3 +361,49 @@ private:
     /** The underlying JSON value */
     TSharedPtr<FJsonValue> JsonValue;
 };
+
+/**
+ * Poolable string buffer for serializing responses
+ * Keeps its allocation between uses, so serializing into it stops reallocating once it has grown
+ * to the size of typical responses
+ */
+class UNREALMCP_API FPoolableStringBuffer
+{
+public:
+    /** Largest allocation, in characters, a buffer keeps when it is reset; one huge response shouldn't pin its memory */
+    static constexpr int32 MaxRetainedChars = 1024 * 1024;
+
+    /** Default constructor */
+    FPoolableStringBuffer() = default;
+    
+    /** Destructor */
+    ~FPoolableStringBuffer() = default;
+    
+    /**
+     * Reset the buffer to empty, keeping its allocation unless it is oversized
+     */
+    void Reset()
+    {
+        if (Buffer.GetCharArray().Max() > MaxRetainedChars)
+        {
+            Buffer.Empty();
+        }
+        else
+        {
+            Buffer.Reset();
+        }
+    }
+    
+    /**
+     * Get the underlying string
+     * @return Reference to the buffer
+     */
+    FString& GetBuffer()
+    {
+        return Buffer;
+    }
+
+private:
+    /** The underlying string */
+    FString Buffer;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Services/IProjectService.h"
 
 /**
  * Service for general asset management operations.
@@ -85,6 +86,51 @@ public:
         bool& bOutSuccess,
         FString& OutError);
 
+    /**
+     * Move and/or rename many assets with one IAssetTools::RenameAssets call.
+     * Every entry is checked first; the valid ones are renamed together, so referencers are
+     * loaded and updated once for the whole set, and the redirectors left at the old paths are
+     * fixed up in one pass at the end.
+     * @param Entries - Assets with their destination folder and/or new name
+     * @param bFixupRedirectors - Whether to fix up referencers and delete the redirectors left behind
+     * @param OutResults - Output: result per entry, in entry order
+     * @param OutFixedRedirectors - Output: number of redirectors handed to the fixup pass
+     * @param OutError - Output: error message if no entries were given
+     * @return true if the batch ran; check each result
+     */
+    bool RenameAssets(
+        const TArray<FAssetBatchEntry>& Entries,
+        bool bFixupRedirectors,
+        TArray<FAssetBatchResult>& OutResults,
+        int32& OutFixedRedirectors,
+        FString& OutError);
+
+    /**
+     * Duplicate many assets.
+     * Entries are checked against existing assets and each other before any copy is made.
+     * @param Entries - Assets with the folder and/or name of their copy
+     * @param OutResults - Output: result per entry, in entry order
+     * @param OutError - Output: error message if no entries were given
+     * @return true if the batch ran; check each result
+     */
+    bool DuplicateAssets(
+        const TArray<FAssetBatchEntry>& Entries,
+        TArray<FAssetBatchResult>& OutResults,
+        FString& OutError);
+
+    /**
+     * Delete many assets with one ObjectTools::ForceDeleteObjects call, so references to the
+     * whole set are cleared in one pass.
+     * @param AssetPaths - Assets to delete
+     * @param OutResults - Output: result per asset, in input order
+     * @param OutError - Output: error message if no assets were given
+     * @return true if the batch ran; check each result
+     */
+    bool DeleteAssets(
+        const TArray<FString>& AssetPaths,
+        TArray<FAssetBatchResult>& OutResults,
+        FString& OutError);
+
 private:
     FProjectAssetOperations() = default;
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
+#include "Services/IProjectService.h"
 
 /**
  * Service for creating and managing DataAsset instances.
@@ -58,6 +59,21 @@ public:
         const FString& AssetPath,
         FString& OutError);
 
+    /**
+     * Create many DataAssets of one class and set their properties.
+     * Property paths are resolved once per class through FPropertyAccessorCache, the asset
+     * registry is told about the new assets as they are created, and the packages are saved
+     * together at the end.
+     * @param Params - Class, rows and save options
+     * @param OutResult - Output: per row, whether it was created and the properties that were not set
+     * @param OutError - Output: error message if the class or the rows are invalid
+     * @return true if the rows were processed
+     */
+    bool CreateDataAssets(
+        const FBulkDataAssetParams& Params,
+        FBulkDataAssetResult& OutResult,
+        FString& OutError);
+
 private:
     FProjectDataAssetService() = default;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Services/IProjectService.h"
 
 class UUserDefinedEnum;
 
@@ -54,6 +55,24 @@ public:
         const TMap<FString, FString>& ValueDescriptions,
         FString& OutError);
 
+    /**
+     * Apply enumerator changes to an enum as one change: the enumerators are set once and the
+     * change broadcast once, so dependent Blueprints and DataTables are updated once rather than
+     * after every FEnumEditorUtils call. Enumerators are found by display name; "rename" changes
+     * the display name, as the enum editor does. A change that does not apply is reported and the
+     * others still go through.
+     * @param Enum - Enum to change
+     * @param Changes - Changes in the order they apply ("add", "remove", "rename", "set_description")
+     * @param OutResults - Output: outcome of each change, following Changes
+     * @param OutError - Output: error message if nothing could be applied
+     * @return true if at least one change was applied
+     */
+    bool ApplyEnumChanges(
+        UUserDefinedEnum* Enum,
+        const TArray<FSchemaChange>& Changes,
+        TArray<FSchemaChangeResult>& OutResults,
+        FString& OutError);
+
 private:
     FProjectEnumService() = default;
 };
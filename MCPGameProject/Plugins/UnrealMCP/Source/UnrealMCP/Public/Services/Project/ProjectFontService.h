@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Services/IProjectService.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Engine/Font.h"
 
 /**
  * Service for creating and managing font assets.
@@ -105,6 +109,132 @@ public:
      */
     TSharedPtr<FJsonObject> GetFontMetadata(const FString& FontPath, FString& OutError);
 
+    /**
+     * Start creating many fonts across editor ticks.
+     * Font files are read and checked, and offline glyph tables built from their metrics files, on
+     * worker threads; the assets are created on the game thread as the data arrives and saved
+     * together once every font is done.
+     * @param Params - Fonts to create
+     * @param OutJobId - Output: id to poll with GetBulkFontImport
+     * @param OutFontCount - Output: number of fonts the job reports on
+     * @param OutError - Output: error message if the job was not started
+     * @return true if the job was started
+     */
+    bool StartBulkFontImport(const FBulkFontImportParams& Params, int64& OutJobId, int32& OutFontCount, FString& OutError);
+
+    /**
+     * Get progress and a page of per-font results of a bulk font import.
+     * @param JobId - Job returned by StartBulkFontImport
+     * @param Cursor - Index of the first result to return
+     * @param MaxResults - Most results to return
+     * @param OutStatus - Output: job status
+     * @param OutError - Output: error message if the job is unknown
+     * @return true if the job was found
+     */
+    bool GetBulkFontImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError);
+
 private:
     FProjectFontService() = default;
+
+    /** Characters of an offline font, built from its metrics file */
+    struct FOfflineGlyphTable
+    {
+        int32 AtlasWidth = 0;
+        int32 AtlasHeight = 0;
+        int32 LineHeight = 0;
+        int32 Baseline = 0;
+        /** Whether the metrics name a character map; the font is remapped only then */
+        bool bHasCharacters = false;
+        TArray<FFontCharacter> Characters;
+        /** Character code and index in Characters */
+        TArray<TPair<uint16, uint16>> CharRemap;
+    };
+
+    /**
+     * Read a TTF/OTF file and check that it holds a font. Safe on any thread.
+     * @return true if the file was read and starts with a TrueType, OpenType or collection signature
+     */
+    static bool ReadFontFile(const FString& TTFFilePath, TArray<uint8>& OutFontData, FString& OutError);
+
+    /**
+     * Read and parse the metrics JSON of an offline font into its glyph table. Safe on any thread.
+     * @return true if the metrics file was read and parsed
+     */
+    static bool BuildOfflineGlyphTable(const FString& MetricsFilePath, FOfflineGlyphTable& OutGlyphTable, FString& OutError);
+
+    /**
+     * Create the FontFace holding a font file and the UFont using it, without saving them.
+     * @param OutPackages - Output: packages of the created FontFace and Font
+     * @return true if both assets were created
+     */
+    bool CreateTTFFontAssets(const FString& FontName, const FString& Path, const FString& TTFFilePath, TArray<uint8>&& FontData,
+        const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutFontFacePath, TArray<UPackage*>& OutPackages, FString& OutError);
+
+    /**
+     * Create an offline UFont from a texture atlas and its glyph table, without saving it.
+     * @param OutPackage - Output: package of the created font
+     * @param OutCharacterCount - Output: number of characters of the font
+     * @return true if the font was created
+     */
+    bool CreateOfflineFontAsset(const FString& FontName, const FString& Path, const FString& TexturePath, FOfflineGlyphTable&& GlyphTable,
+        FString& OutAssetPath, UPackage*& OutPackage, int32& OutCharacterCount, FString& OutError);
+
+    /** What a worker thread read for one font of a bulk import */
+    struct FBulkFontImportPrepared
+    {
+        FString Error;
+        /** Contents of the font file of a "ttf" font */
+        TArray<uint8> FontData;
+        /** Glyph table of an "offline" font */
+        FOfflineGlyphTable GlyphTable;
+    };
+
+    /** Font of a bulk import being prepared on a worker thread */
+    struct FBulkFontImportPreparing
+    {
+        int32 FontIndex = INDEX_NONE;
+        TFuture<FBulkFontImportPrepared> Result;
+    };
+
+    /** Import run started by StartBulkFontImport */
+    struct FBulkFontImportJob
+    {
+        /** Fonts to create, in request order, each with its content folder */
+        TArray<FBulkFontImportEntry> Fonts;
+        /** Fonts plus the requested fonts rejected before preparation */
+        int32 FontCount = 0;
+        /** Index in Fonts of the next font to prepare */
+        int32 NextQueued = 0;
+        TArray<FBulkFontImportPreparing> Preparing;
+        bool bSave = true;
+        int32 MaxInFlight = 8;
+        /** Packages of the created assets, saved together when the job finishes */
+        TArray<TWeakObjectPtr<UPackage>> CreatedPackages;
+        double StartTime = 0.0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+        /** Result per font, in completion order */
+        TArray<TSharedPtr<FJsonObject>> Results;
+        int32 CreatedCount = 0;
+        /** Fonts that failed preparation or creation */
+        int32 FailedCount = 0;
+        /** Packages the final save could not write */
+        TArray<FString> UnsavedPackages;
+    };
+
+    /** Finished bulk import jobs whose results are kept */
+    static constexpr int32 MaxFinishedBulkFontImportJobs = 4;
+
+    /** Bulk import jobs by id, game thread only */
+    TMap<int64, FBulkFontImportJob> BulkFontImportJobs;
+    int64 NextBulkFontImportJobId = 1;
+
+    /** Ticks the bulk import jobs while any is running */
+    FTSTicker::FDelegateHandle BulkFontImportTickerHandle;
+
+    /** Start preparations up to each job's limit, and create the fonts whose data has arrived */
+    bool TickBulkFontImport(float DeltaTime);
+
+    /** Create the assets of one prepared font of a job and record its result */
+    void CreateBulkFont(FBulkFontImportJob& Job, int32 FontIndex, FBulkFontImportPrepared&& Prepared);
 };
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Services/IProjectService.h"
+
+/**
+ * Service for setting up Enhanced Input in bulk
+ * Creates the input actions and mapping contexts of a setup, maps the keys with their modifiers
+ * and triggers, and saves every created package in one UEditorLoadingAndSavingUtils::SavePackages
+ * call, instead of one create_enhanced_input_action / create_input_mapping_context /
+ * add_mapping_to_context round trip per asset and mapping.
+ */
+class UNREALMCP_API FProjectInputService
+{
+public:
+    /**
+     * Get the singleton instance
+     */
+    static FProjectInputService& Get();
+
+    /**
+     * Create the actions, then the contexts and their mappings, of an input setup
+     * Actions and contexts that already exist are not changed and are reported as failed; a
+     * mapping whose action or key is unknown is skipped and reported with its context.
+     * @param Params - Actions, contexts and mappings to create
+     * @param OutResult - Output: what was created, per action and context
+     * @param OutError - Output: error message if the setup is empty
+     * @return true if the setup was run
+     */
+    bool CreateInputSetup(const FInputSetupParams& Params, FInputSetupResult& OutResult, FString& OutError);
+
+private:
+    FProjectInputService() = default;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
+#include "Services/IProjectService.h"
 
 class UUserDefinedStruct;
 
@@ -51,6 +52,23 @@ public:
         const TArray<TSharedPtr<FJsonObject>>& Properties,
         FString& OutError);
 
+    /**
+     * Apply member changes to a struct as one change: the editor data is edited directly and
+     * the struct compiled once at the end, so dependent Blueprints recompile and DataTables
+     * reinstance once rather than after every FStructureEditorUtils call. Members are found by
+     * display name; a change that does not apply is reported and the others still go through.
+     * @param Struct - Struct to change
+     * @param Changes - Changes in the order they apply
+     * @param OutResults - Output: outcome of each change, following Changes
+     * @param OutError - Output: error message if nothing could be applied
+     * @return true if at least one change was applied
+     */
+    bool ApplyStructChanges(
+        UUserDefinedStruct* Struct,
+        const TArray<FSchemaChange>& Changes,
+        TArray<FSchemaChangeResult>& OutResults,
+        FString& OutError);
+
     /**
      * Get struct variable information including GUID-based pin names.
      * @param StructName - Name or path of the struct
@@ -22,22 +22,28 @@ public:
     virtual TArray<TSharedPtr<FJsonObject>> ShowStructVariables(const FString& StructName, const FString& Path, bool& bOutSuccess, FString& OutError) override;
     virtual bool CreateEnum(const FString& EnumName, const FString& Path, const FString& Description, const TArray<FString>& Values, const TMap<FString, FString>& ValueDescriptions, FString& OutFullPath, FString& OutError) override;
     virtual bool UpdateEnum(const FString& EnumName, const FString& Path, const FString& Description, const TArray<FString>& Values, const TMap<FString, FString>& ValueDescriptions, FString& OutError) override;
+    virtual bool ApplySchemaChanges(const FString& AssetPath, const TArray<FSchemaChange>& Changes, FString& OutAssetKind, TArray<FSchemaChangeResult>& OutResults, FString& OutError) override;
     virtual bool CreateEnhancedInputAction(const FString& ActionName, const FString& Path, const FString& Description, const FString& ValueType, FString& OutAssetPath, FString& OutError) override;
     virtual bool CreateInputMappingContext(const FString& ContextName, const FString& Path, const FString& Description, FString& OutAssetPath, FString& OutError) override;
     virtual bool AddMappingToContext(const FString& ContextPath, const FString& ActionPath, const FString& Key, const TSharedPtr<FJsonObject>& Modifiers, FString& OutError) override;
     virtual TArray<TSharedPtr<FJsonObject>> ListInputActions(const FString& Path, bool& bOutSuccess, FString& OutError) override;
     virtual TArray<TSharedPtr<FJsonObject>> ListInputMappingContexts(const FString& Path, bool& bOutSuccess, FString& OutError) override;
+    virtual bool CreateInputSetup(const FInputSetupParams& Params, FInputSetupResult& OutResult, FString& OutError) override;
     virtual FString GetProjectDirectory() const override;
     virtual bool DuplicateAsset(const FString& SourcePath, const FString& DestinationPath, const FString& NewName, FString& OutNewAssetPath, FString& OutError) override;
     virtual bool DeleteAsset(const FString& AssetPath, FString& OutError) override;
     virtual bool RenameAsset(const FString& AssetPath, const FString& NewName, FString& OutNewAssetPath, FString& OutError) override;
     virtual bool MoveAsset(const FString& AssetPath, const FString& DestinationFolder, FString& OutNewAssetPath, FString& OutError) override;
     virtual TArray<TSharedPtr<FJsonObject>> SearchAssets(const FString& Pattern, const FString& AssetClass, const FString& Folder, bool& bOutSuccess, FString& OutError) override;
+    virtual bool RenameAssets(const TArray<FAssetBatchEntry>& Entries, bool bFixupRedirectors, TArray<FAssetBatchResult>& OutResults, int32& OutFixedRedirectors, FString& OutError) override;
+    virtual bool DuplicateAssets(const TArray<FAssetBatchEntry>& Entries, TArray<FAssetBatchResult>& OutResults, FString& OutError) override;
+    virtual bool DeleteAssets(const TArray<FString>& AssetPaths, TArray<FAssetBatchResult>& OutResults, FString& OutError) override;
 
     // DataAsset operations
     virtual bool CreateDataAsset(const FString& Name, const FString& AssetClass, const FString& FolderPath, const TSharedPtr<FJsonObject>& Properties, FString& OutAssetPath, FString& OutError) override;
     virtual bool SetDataAssetProperty(const FString& AssetPath, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) override;
     virtual TSharedPtr<FJsonObject> GetDataAssetMetadata(const FString& AssetPath, FString& OutError) override;
+    virtual bool CreateDataAssets(const FBulkDataAssetParams& Params, FBulkDataAssetResult& OutResult, FString& OutError) override;
 
     // Font Face operations (for TTF-based fonts)
     virtual bool CreateFontFace(const FString& FontName, const FString& Path, const FString& SourceTexturePath, bool bUseSDF, int32 DistanceFieldSpread, const TSharedPtr<FJsonObject>& FontMetrics, FString& OutAssetPath, FString& OutError) override;
@@ -51,6 +57,10 @@ public:
     virtual bool CreateOfflineFont(const FString& FontName, const FString& Path, const FString& TexturePath, const FString& MetricsFilePath, FString& OutAssetPath, FString& OutError) override;
     virtual TSharedPtr<FJsonObject> GetFontMetadata(const FString& FontPath, FString& OutError) override;
 
+    // Bulk font import
+    virtual bool StartBulkFontImport(const FBulkFontImportParams& Params, int64& OutJobId, int32& OutFontCount, FString& OutError) override;
+    virtual bool GetBulkFontImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) override;
+
 private:
     // Helper methods for struct operations
     bool CreateStructProperty(class UUserDefinedStruct* Struct, const TSharedPtr<FJsonObject>& PropertyObj) const;
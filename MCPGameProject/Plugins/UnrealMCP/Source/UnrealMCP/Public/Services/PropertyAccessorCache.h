@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class FJsonValue;
+class FProperty;
+class UObject;
+class UStruct;
+
+/**
+ * Property paths of classes and structs, resolved once per type into accessors
+ *
+ * A path is a property name, or a chain through struct members such as "Padding.Left" or
+ * "Font.OutlineSettings.OutlineSize". The first use of a path on a type resolves its chain of
+ * FProperty and picks a typed setter for the property it ends at; later uses only walk the cached
+ * chain to the value. Bools, numbers, enums, FVector, FRotator, FLinearColor, FColor and plain
+ * object references given in their usual JSON form are written directly; any other property or
+ * JSON form goes through FPropertyService's reflection-based conversion.
+ *
+ * Only chains made of native properties are kept, since a blueprint compile regenerates the
+ * properties of its class in place; paths through blueprint-declared properties or user-defined
+ * structs are resolved on every use. Paths that do not resolve are kept too, so repeated typos
+ * cost one lookup. Everything is dropped on a code reload.
+ *
+ * Paths used off the game thread or before Initialize are resolved on every use.
+ */
+class UNREALMCP_API FPropertyAccessorCache
+{
+public:
+    /** Direct setter picked for the property a path ends at */
+    enum class EFastSetter : uint8
+    {
+        /** Reflection-based conversion only */
+        None,
+        Bool,
+        Float,
+        Double,
+        Integer,
+        Enum,
+        ByteEnum,
+        Vector,
+        Rotator,
+        LinearColor,
+        Color,
+        Object
+    };
+
+    /** Properties from the owner type down to the value a path names; empty if the path does not resolve */
+    struct FAccessor
+    {
+        TArray<FProperty*> Chain;
+        EFastSetter FastSetter = EFastSetter::None;
+        FString Error;
+
+        bool IsValid() const { return Chain.Num() > 0; }
+
+        /** Property the path ends at; only valid if IsValid */
+        FProperty* GetProperty() const { return Chain.Last(); }
+
+        /** @return Pointer to the named value inside a container of the owner type */
+        void* GetValuePtr(void* Container) const;
+    };
+
+    static FPropertyAccessorCache& Get();
+
+    /** Start following code reloads */
+    void Initialize();
+
+    /** Stop following code reloads and drop every resolved path */
+    void Shutdown();
+
+    /**
+     * Accessor for a path on a class or struct, resolved if not cached
+     * @param Owner - Class or struct the path starts at
+     * @param PropertyPath - Property name, or dot-separated chain through struct members
+     * @return The accessor; check IsValid, Error says why the path does not resolve
+     */
+    TSharedRef<const FAccessor> Resolve(const UStruct* Owner, const FString& PropertyPath);
+
+    /**
+     * Convert a JSON value into the value an accessor names
+     * @param Accessor - Valid accessor resolved on the container's type
+     * @param Container - Object or struct memory of the type the accessor was resolved on
+     * @param Outer - Object that owns the value, used as outer for instanced subobjects; may be null
+     * @param PropertyValue - JSON value to convert
+     * @param OutError - Error message if the value does not convert
+     * @return true if the value was set
+     */
+    static bool SetValue(const FAccessor& Accessor, void* Container, UObject* Outer,
+                         const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError);
+
+    /**
+     * Convert a JSON value into memory holding a value of the property an accessor ends at
+     * @param Accessor - Valid accessor
+     * @param ValuePtr - Initialized value of the accessor's property, inside a container or on its own
+     * @param Outer - Object that owns the value, used as outer for instanced subobjects; may be null
+     * @param PropertyValue - JSON value to convert
+     * @param OutError - Error message if the value does not convert
+     * @return true if the value was set
+     */
+    static bool ConvertValue(const FAccessor& Accessor, void* ValuePtr, UObject* Outer,
+                             const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError);
+
+    /**
+     * Set a property of an object by path
+     * @param Object - Object to modify
+     * @param PropertyPath - Property name, or dot-separated chain through struct members
+     * @param PropertyValue - JSON value to convert into the property
+     * @param OutError - Error message if the path does not resolve or the value does not convert
+     * @return true if the property was set
+     */
+    bool SetPropertyByPath(UObject* Object, const FString& PropertyPath, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError);
+
+private:
+    FPropertyAccessorCache() = default;
+
+    /** Resolve a path on a type and report whether the result may be kept */
+    static bool ResolvePath(const UStruct* Owner, const FString& PropertyPath, FAccessor& OutAccessor);
+
+    /** Direct setter for a property, or None if it only converts through reflection */
+    static EFastSetter PickFastSetter(const FProperty* Property);
+
+    /**
+     * Write a JSON value with a direct setter
+     * @return false if the setter does not take this JSON form and the value must be converted instead
+     */
+    static bool TrySetFast(EFastSetter FastSetter, FProperty* Property, void* ValuePtr,
+                           const FJsonValue& PropertyValue, bool& bOutSet, FString& OutError);
+
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    /** Accessors are shared so a caller's survives entries added while it converts nested values */
+    TMap<TWeakObjectPtr<const UStruct>, TMap<FName, TSharedRef<const FAccessor>>> Accessors;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ReloadCompleteHandle;
+};
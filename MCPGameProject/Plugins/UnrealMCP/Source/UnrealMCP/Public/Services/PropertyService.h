@@ -28,6 +28,36 @@ public:
     virtual bool HasProperty(UObject* Object, const FString& PropertyName) override;
     virtual TArray<FString> GetObjectPropertyNames(UObject* Object) override;
 
+    /**
+     * Set a property that was already resolved, e.g. from a cached property path
+     * @param Object - Object that owns the property data, used as outer for instanced subobjects
+     * @param Property - Property to set
+     * @param PropertyData - Pointer to the property's value inside Object
+     * @param PropertyValue - JSON value to convert and set
+     * @param OutError - Error message if conversion fails
+     * @return true if property was set successfully
+     */
+    bool SetResolvedProperty(UObject* Object, FProperty* Property, void* PropertyData,
+                             const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) const;
+
+    /**
+     * Set the same property to the same value on many objects
+     * Objects are grouped by class; each class resolves the path once, and unless the value must be
+     * converted per object (a JSON object, which may name only some struct fields, or a property
+     * holding instanced subobjects) converts the JSON once and copies the native value into every
+     * object. Each object gets Modify, PreEditChange and a PostEditChangeProperty whose event lists
+     * every object of its class group as the edited objects.
+     * Paths that do not resolve on a class fall back to SetObjectProperty for its objects, which
+     * covers the collision settings of primitive components.
+     * @param Objects - Objects to modify
+     * @param PropertyPath - Property name, or dot-separated chain through struct members
+     * @param PropertyValue - JSON value to convert and set
+     * @param OutErrors - Error per object, empty where it was set
+     * @return Number of objects the property was set on
+     */
+    int32 SetPropertyOnObjects(const TArray<UObject*>& Objects, const FString& PropertyPath,
+                               const TSharedPtr<FJsonValue>& PropertyValue, TArray<FString>& OutErrors);
+
 private:
     /** Private constructor for singleton pattern */
     FPropertyService() = default;
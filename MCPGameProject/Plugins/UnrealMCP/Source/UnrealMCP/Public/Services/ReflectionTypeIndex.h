@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "MCPCacheStats.h"
+
+class FProperty;
+class UClass;
+class UPackage;
+class UScriptStruct;
+
+/**
+ * Index of native reflection data that services would otherwise find with TObjectIterator scans
+ *
+ * - Structs by base struct: every native struct deriving from a base, for the StateTree
+ *   task/condition/evaluator discovery
+ * - Blueprint-visible native properties by name: property name, name without the bool "b"
+ *   prefix and display name without spaces, all lowercase
+ *
+ * Classes by parent and fields by name need no index of ours: GetDerivedClasses and
+ * FindFirstObject already use the engine's class tree and name hash.
+ *
+ * Native types only change when modules load or reload, so the index is built by the first
+ * lookup, extended with a module's package when the module loads, and dropped when a module
+ * unloads or code is reloaded. Types declared by Blueprints or other assets are not indexed.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FReflectionTypeIndex
+{
+public:
+    static FReflectionTypeIndex& Get();
+
+    /** Follow module loads and code reloads */
+    void Initialize();
+
+    /** Stop following module changes and drop the index */
+    void Shutdown();
+
+    /**
+     * Native structs deriving from a base struct
+     * @param BaseStruct Base struct; not part of the result
+     * @return Derived structs in registration order
+     */
+    const TArray<UScriptStruct*>& GetDerivedStructs(const UScriptStruct* BaseStruct);
+
+    /**
+     * Blueprint-visible properties of native classes that go by a name
+     * @param Name Property name, name without the bool "b" prefix, or display name without spaces; any case
+     * @return Matching properties, each under the native class that declares it
+     */
+    const TArray<FProperty*>& FindBlueprintProperties(const FString& Name);
+
+private:
+    FReflectionTypeIndex() = default;
+
+    /** Index every loaded native type, if not done since the last invalidation */
+    void EnsureBuilt();
+
+    /** Add one package's native types */
+    void AddPackage(UPackage* Package);
+
+    void AddStruct(UScriptStruct* Struct);
+    void AddClass(UClass* Class);
+
+    /** Drop the index; the next lookup rebuilds it */
+    void Invalidate();
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    TMap<const UScriptStruct*, TArray<UScriptStruct*>> StructsByBase;
+    TMap<FString, TArray<FProperty*>> PropertiesByName;
+    bool bBuilt = false;
+    /** Lookups that found the index built, or had to build it */
+    FMCPCacheCounters CacheCounters;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
@@ -2,6 +2,9 @@
 
 #include "CoreMinimal.h"
 #include "Services/ISoundService.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "UObject/SoftObjectPath.h"
 
 // Log category for Sound service
 DECLARE_LOG_CATEGORY_EXTERN(LogSoundService, Log, All);
@@ -30,7 +33,9 @@ public:
     // ========================================================================
 
     virtual bool ImportSoundFile(const FSoundWaveImportParams& Params, FString& OutAssetPath, FString& OutError) override;
-    virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) override;
+    virtual bool StartBulkSoundImport(const FBulkSoundImportParams& Params, int64& OutJobId, int32& OutFileCount, FString& OutError) override;
+    virtual bool GetBulkSoundImport(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) override;
+    virtual bool GetSoundWaveMetadata(const FString& SoundWavePath, bool bAllowLoad, bool bIncludeEnvelope, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) override;
     virtual bool SetSoundWaveProperties(const FString& SoundWavePath, bool bLooping, float Volume, float Pitch, FString& OutError) override;
 
     // ========================================================================
@@ -58,6 +63,7 @@ public:
     virtual bool SetSoundCueNodeProperty(const FString& SoundCuePath, const FString& NodeId, const FString& PropertyName, const TSharedPtr<FJsonValue>& PropertyValue, FString& OutError) override;
     virtual bool RemoveSoundCueNode(const FString& SoundCuePath, const FString& NodeId, FString& OutError) override;
     virtual bool CompileSoundCue(const FString& SoundCuePath, FString& OutError) override;
+    virtual bool BuildSoundCueFromSpec(const FBuildSoundCueFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
 
     // ========================================================================
     // ISoundService interface implementation - Sound Class/Mix Operations
@@ -79,7 +85,8 @@ public:
     virtual bool AddMetaSoundInput(const FMetaSoundInputParams& Params, FString& OutInputNodeId, FString& OutError) override;
     virtual bool AddMetaSoundOutput(const FMetaSoundOutputParams& Params, FString& OutOutputNodeId, FString& OutError) override;
     virtual bool CompileMetaSound(const FString& MetaSoundPath, FString& OutError) override;
-    virtual bool SearchMetaSoundPalette(const FString& SearchQuery, int32 MaxResults, TArray<TSharedPtr<FJsonObject>>& OutResults, FString& OutError) override;
+    virtual bool BuildMetaSoundFromSpec(const FBuildMetaSoundFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
+    virtual bool SearchMetaSoundPalette(const FMetaSoundPaletteQuery& Query, TArray<TSharedPtr<FJsonObject>>& OutResults, int32& OutTotalCount, FString& OutError) override;
     virtual UMetaSoundSource* FindMetaSoundSource(const FString& MetaSoundPath) override;
 
     // ========================================================================
@@ -93,6 +100,77 @@ private:
     /** Singleton instance */
     static TUniquePtr<FSoundService> Instance;
 
+    /** What a worker thread found reading an audio file of a bulk import */
+    struct FBulkSoundImportValidation
+    {
+        FString Error;
+        /** Header values, read from WAV files only */
+        int32 NumChannels = 0;
+        int32 SampleRate = 0;
+    };
+
+    /** One file of a bulk import */
+    struct FBulkSoundImportFile
+    {
+        FString SourceFilePath;
+        FString AssetName;
+    };
+
+    /** File of a bulk import being validated on a worker thread */
+    struct FBulkSoundImportValidating
+    {
+        int32 FileIndex = INDEX_NONE;
+        TFuture<FBulkSoundImportValidation> Result;
+    };
+
+    /** Import run started by StartBulkSoundImport */
+    struct FBulkSoundImportJob
+    {
+        /** Files to import, in request order */
+        TArray<FBulkSoundImportFile> Files;
+        /** Files plus the requested files rejected before validation */
+        int32 FileCount = 0;
+        /** Index in Files of the next file to validate */
+        int32 NextQueued = 0;
+        TArray<FBulkSoundImportValidating> Validating;
+        /** Validated files waiting for the next import batch, with their header values */
+        TArray<TPair<int32, FBulkSoundImportValidation>> ReadyToImport;
+        FString FolderPath;
+        bool bReplaceExisting = true;
+        bool bSave = true;
+        int32 BatchSize = 32;
+        int32 MaxInFlight = 16;
+        int32 BatchCount = 0;
+        /** Packages of the imported sound waves, saved together when the job finishes */
+        TArray<TWeakObjectPtr<UPackage>> ImportedPackages;
+        double StartTime = 0.0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+        /** Result per file, in completion order */
+        TArray<TSharedPtr<FJsonObject>> Results;
+        int32 ImportedCount = 0;
+        /** Files that failed validation or import */
+        int32 FailedCount = 0;
+        /** Packages the final save could not write */
+        TArray<FString> UnsavedPackages;
+    };
+
+    /** Finished bulk import jobs whose results are kept */
+    static constexpr int32 MaxFinishedBulkSoundImportJobs = 4;
+
+    /** Bulk import jobs by id, game thread only */
+    TMap<int64, FBulkSoundImportJob> BulkSoundImportJobs;
+    int64 NextBulkSoundImportJobId = 1;
+
+    /** Ticks the bulk import jobs while any is running */
+    FTSTicker::FDelegateHandle BulkSoundImportTickerHandle;
+
+    /** Start validations up to each job's limit, and import one batch of validated files per job */
+    bool TickBulkSoundImport(float DeltaTime);
+
+    /** Import the validated files of a job waiting for a batch */
+    void ImportBulkSoundBatch(FBulkSoundImportJob& Job);
+
     // ========================================================================
     // Internal Helper Methods
     // ========================================================================
@@ -115,6 +193,14 @@ private:
      */
     bool SaveAsset(UObject* Asset, FString& OutError) const;
 
+    /**
+     * Describe an unloaded sound wave from its asset registry tags
+     * @param ObjectPath - Object path of the sound wave
+     * @param OutMetadata - Receives the duration, channels, sample rate and looping the tags hold
+     * @return true if the registry knows a sound wave at that path
+     */
+    bool DescribeSoundWaveFromRegistry(const FSoftObjectPath& ObjectPath, TSharedPtr<FJsonObject>& OutMetadata) const;
+
     /**
      * Get attenuation function enum from string
      * @param FunctionName - "Linear", "Logarithmic", etc.
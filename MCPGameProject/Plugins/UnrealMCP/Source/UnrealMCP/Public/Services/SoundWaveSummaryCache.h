@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPCacheStats.h"
+
+class UObject;
+class USoundWave;
+struct FPropertyChangedEvent;
+
+/**
+ * Compact per-wave metadata and loudness summaries for get_sound_wave_metadata
+ *
+ * A summary holds what the metadata query reports about a sound wave (duration, channels, sample
+ * rate, looping, volume, pitch, streaming) plus the peak and RMS level of its imported PCM and a
+ * small peak envelope, so answering from it needs neither the wave object nor its audio data.
+ * Summaries are computed from a loaded wave and kept per package with the package file's
+ * timestamp; one whose package file changed, for example after a reimport saved it or a source
+ * control sync, is not used. They are also dropped when the wave's properties change in the editor.
+ *
+ * Summaries persist across sessions in Saved/UnrealMCP/SoundWaveSummaries.json, read by Initialize
+ * and written by Shutdown. Waves whose package has unsaved changes or no file yet are summarized
+ * but not kept.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FSoundWaveSummaryCache
+{
+public:
+    /** Number of buckets in a summary's peak envelope */
+    static constexpr int32 EnvelopeBuckets = 64;
+
+    /** What is known about one sound wave */
+    struct FSummary
+    {
+        float Duration = 0.0f;
+        int32 SampleRate = 0;
+        int32 NumChannels = 0;
+        bool bLooping = false;
+        float Volume = 1.0f;
+        float Pitch = 1.0f;
+        bool bStreaming = false;
+
+        /** Whether the imported PCM was read; the levels and envelope are unset otherwise */
+        bool bHasLevels = false;
+        /** Largest absolute sample, 0 to 1 */
+        float Peak = 0.0f;
+        /** RMS of every sample of every channel, 0 to 1 */
+        float Rms = 0.0f;
+        /** Largest absolute sample of each of EnvelopeBuckets equal time slices, scaled to 0-255 */
+        TArray<uint8> Envelope;
+    };
+
+    static FSoundWaveSummaryCache& Get();
+
+    /** Read the summaries of the last session and start following property changes */
+    void Initialize();
+
+    /** Stop following changes, write the summaries that are still current and drop them */
+    void Shutdown();
+
+    /**
+     * Summary of a wave that is not loaded, if a current one is kept
+     * @param PackageName - Long package name of the wave
+     * @return The summary, or nullptr if none is kept or its package file changed since
+     */
+    const FSummary* Find(const FString& PackageName);
+
+    /**
+     * Summary of a loaded wave, computed from its imported PCM if no current one is kept
+     * @param SoundWave - Wave to summarize
+     * @param bOutWasCached - Set to whether the summary was kept from an earlier call
+     * @return The summary, valid until the cache next changes
+     */
+    const FSummary& FindOrCompute(const USoundWave& SoundWave, bool& bOutWasCached);
+
+    /** @return Level as dBFS, floored at -120 */
+    static float ToDecibels(float Level);
+
+private:
+    FSoundWaveSummaryCache() = default;
+
+    struct FEntry
+    {
+        FSummary Summary;
+        /** Package file timestamp the summary was computed against */
+        FDateTime PackageTimestamp;
+    };
+
+    /** Fill a summary from a loaded wave, reading its imported PCM where the editor keeps it */
+    static void ComputeSummary(const USoundWave& SoundWave, FSummary& OutSummary);
+
+    /** @return Whether the package has a file, and if so set its timestamp */
+    static bool GetPackageTimestamp(const FString& PackageName, FDateTime& OutTimestamp);
+
+    static FString GetPersistentStatePath();
+    int32 LoadPersistentState();
+    void SavePersistentState() const;
+
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+
+    TMap<FString, FEntry> Entries;
+    /** Result for waves that cannot be kept: unsaved, or summarized before Initialize */
+    FSummary UncachedSummary;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+    bool bDirty = false;
+
+    FDelegateHandle ObjectPropertyChangedHandle;
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/Atomic.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UStateTree;
+struct FStateTreeExecutionContext;
+struct FStateTreeStateHandle;
+struct FStateTreeTransitionResult;
+
+/**
+ * Opt-in recorder of the state enter, exit and transition events of StateTrees running in PIE,
+ * so execution history shows the exact sequence between two queries instead of what a poll saw
+ *
+ * While recording, the recorder listens to the StateTree debug events (builds with
+ * WITH_STATETREE_DEBUG, which includes the editor) and appends each event of a PIE world to the
+ * ring buffer of its instance, one instance per owner and StateTree. Appending is lock-free: the
+ * writer claims a slot with an atomic counter and publishes it with the slot's sequence number,
+ * and readers skip slots that are being overwritten. The buffer map is only locked shared while
+ * appending, so writers never wait on each other; it is locked exclusively when an instance is
+ * first seen and when a recording starts. Nothing is bound while recording is off.
+ *
+ * Buffers are kept after PIE ends so the last session can still be queried; starting a new
+ * recording drops them.
+ */
+class UNREALMCP_API FStateTreeExecutionRecorder
+{
+public:
+    /** What a recorded event was */
+    enum class EEventType : uint8
+    {
+        Enter,
+        Exit,
+        Transition
+    };
+
+    /** One event as returned by a query, oldest first */
+    struct FEvent
+    {
+        EEventType Type = EEventType::Enter;
+        /** Entered or exited state; source state of a transition */
+        FName State;
+        /** Target state of a transition */
+        FName TargetState;
+        /** World time of the event */
+        double WorldTime = 0.0;
+        uint64 Frame = 0;
+        /** Position of the event in its instance's sequence, from 0 */
+        uint64 Sequence = 0;
+    };
+
+    /** Events of one owner running one StateTree */
+    struct FInstanceHistory
+    {
+        FString OwnerPath;
+        FString OwnerName;
+        FString StateTreePath;
+        TArray<FEvent> Events;
+        /** Events recorded in total, including the ones the ring buffer dropped */
+        uint64 RecordedCount = 0;
+    };
+
+    /** Events kept per instance when a recording does not ask for a size */
+    static constexpr int32 DefaultCapacity = 1024;
+
+    static FStateTreeExecutionRecorder& Get();
+
+    /** Stop recording and drop every buffer */
+    void Shutdown();
+
+    /**
+     * Start recording, dropping the buffers of any earlier recording
+     * @param StateTree Only record this StateTree; null records every StateTree
+     * @param Capacity Events kept per instance before the oldest are overwritten
+     * @param OutError Why recording could not start
+     * @return true if recording started
+     */
+    bool Start(const UStateTree* StateTree, int32 Capacity, FString& OutError);
+
+    /** Stop recording; the recorded events stay queryable */
+    void Stop();
+
+    bool IsRecording() const { return bRecording; }
+    int32 GetCapacity() const { return Capacity; }
+
+    /**
+     * Recorded events of the instances matching a StateTree and an owner
+     * @param StateTreePath StateTree the instances run; empty matches every StateTree
+     * @param OwnerPath Path or name of the owner; empty matches every owner
+     * @param MaxEvents Most recent events returned per instance; 0 or less for every retained event
+     * @param OutHistories Receives one history per matching instance
+     */
+    void GetHistory(const FString& StateTreePath, const FString& OwnerPath, int32 MaxEvents, TArray<FInstanceHistory>& OutHistories) const;
+
+private:
+    FStateTreeExecutionRecorder() = default;
+
+    /** Slot of a ring buffer; Sequence is published last, as the slot's event sequence plus one */
+    struct FSlot
+    {
+        TAtomic<uint64> Sequence{ 0 };
+        EEventType Type = EEventType::Enter;
+        FName State;
+        FName TargetState;
+        double WorldTime = 0.0;
+        uint64 Frame = 0;
+    };
+
+    struct FInstanceBuffer
+    {
+        FString OwnerPath;
+        FString OwnerName;
+        FString StateTreePath;
+        TArray<FSlot> Slots;
+        TAtomic<uint64> WriteCount{ 0 };
+    };
+
+    /** @return The buffer of an execution context's instance, created on first use */
+    FInstanceBuffer* FindOrAddBuffer(const FStateTreeExecutionContext& Context);
+
+    /** Append one event of a context to its instance's buffer, if it is recorded */
+    void Record(const FStateTreeExecutionContext& Context, EEventType Type, FName State, FName TargetState);
+
+    /** Name of a state handle in the StateTree the context is processing */
+    static FName GetStateName(const FStateTreeExecutionContext& Context, const FStateTreeStateHandle& Handle);
+
+    void BindEvents();
+    void UnbindEvents();
+
+    void HandleEnterState(const FStateTreeExecutionContext& Context, FStateTreeStateHandle StateHandle);
+    void HandleExitState(const FStateTreeExecutionContext& Context, FStateTreeStateHandle StateHandle);
+    void HandleTransition(const FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition);
+
+    /** Buffers by owner and StateTree */
+    TMap<TPair<FObjectKey, FObjectKey>, TUniquePtr<FInstanceBuffer>> Buffers;
+    mutable FRWLock BuffersLock;
+
+    /** Only StateTree recorded, when the recording asked for one */
+    FObjectKey RecordedStateTree;
+    bool bFilterStateTree = false;
+
+    int32 Capacity = DefaultCapacity;
+    TAtomic<bool> bRecording{ false };
+
+    FDelegateHandle EnterStateHandle;
+    FDelegateHandle ExitStateHandle;
+    FDelegateHandle TransitionHandle;
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectKey.h"
+#include "MCPCacheStats.h"
+
+struct FAssetData;
+class UClass;
+
+/** Kind of StateTree node a catalog lists */
+enum class EStateTreeNodeKind : uint8
+{
+    Task,
+    Condition,
+    Evaluator
+};
+
+/**
+ * Catalog of the StateTree task, condition and evaluator types, for get_available_* and
+ * get_blueprint_state_tree_types
+ *
+ * Native types come from FReflectionTypeIndex and are kept per schema class, already filtered
+ * with the schema's IsStructAllowed and sorted by name, so a schema's lists are built by its
+ * first lookup; they are dropped when a module loads or unloads or code is reloaded.
+ * Blueprint types are found through the asset registry's native parent class tag, so no
+ * Blueprint is loaded to list them; that list is dropped when a Blueprint asset is added,
+ * removed, renamed or updated and when any Blueprint compiles (loaded Blueprints are classified
+ * by their generated class, which a reparent changes before the asset is saved).
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FStateTreeNodeTypeCatalog
+{
+public:
+    /** One listed node type */
+    struct FEntry
+    {
+        /** Struct path of a native type, asset object path of a Blueprint type */
+        FString Path;
+        FString Name;
+        /** Lowercase copies the filter compares against */
+        FString LowerPath;
+        FString LowerName;
+    };
+
+    static FStateTreeNodeTypeCatalog& Get();
+
+    /** Follow module, asset registry and Blueprint compile changes */
+    void Initialize();
+
+    /** Stop following changes and drop the catalog */
+    void Shutdown();
+
+    /**
+     * Native node types of a kind
+     * @param Kind Kind of node
+     * @param SchemaClass Schema the types must be allowed by; null lists every type
+     * @return Types sorted by name, valid until the catalog next changes
+     */
+    const TArray<FEntry>& GetNativeTypes(EStateTreeNodeKind Kind, const UClass* SchemaClass);
+
+    /**
+     * Blueprint node types of a kind
+     * Not filtered by schema: asking a schema about a class would load every Blueprint.
+     * @param Kind Kind of node
+     * @return Types sorted by name, valid until the catalog next changes
+     */
+    const TArray<FEntry>& GetBlueprintTypes(EStateTreeNodeKind Kind);
+
+    /**
+     * Pick one page of a list of entries
+     * @param Entries Entries to filter, as returned above
+     * @param Filter Case-insensitive text the name or path must contain; empty matches every entry
+     * @param Offset Matches skipped before the page
+     * @param Limit Most matches on the page; 0 or less for no limit
+     * @param OutPage Receives the page
+     * @return Number of matches before paging
+     */
+    static int32 FilterEntries(const TArray<FEntry>& Entries, const FString& Filter, int32 Offset, int32 Limit, TArray<const FEntry*>& OutPage);
+
+    /**
+     * Find a StateTree schema class
+     * @param SchemaClassName Class name, with or without the U prefix ("StateTreeComponentSchema"), or
+     *        path ("/Script/GameModule.UCustomStateTreeSchema")
+     * @return The schema class, or null if none is found
+     */
+    static UClass* FindSchemaClass(const FString& SchemaClassName);
+
+private:
+    FStateTreeNodeTypeCatalog() = default;
+
+    /** Native lists of one schema class, by kind */
+    struct FSchemaLists
+    {
+        TArray<FEntry> Native[3];
+    };
+
+    /** Read every Blueprint node type from the asset registry, if not done since the last invalidation */
+    void EnsureBlueprintTypesBuilt();
+
+    /** @return The kind of node a Blueprint asset's class is, if it is one */
+    static bool GetBlueprintNodeKind(const FAssetData& AssetData, EStateTreeNodeKind& OutKind, FString& OutClassPath);
+
+    static void SortEntries(TArray<FEntry>& Entries);
+    static FEntry MakeEntry(const FString& Path, const FString& Name);
+
+    void InvalidateNative();
+    void InvalidateBlueprints();
+
+    void HandleModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+    void HandleAssetChanged(const FAssetData& AssetData);
+    void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    void HandleBlueprintCompiled();
+
+    /** Native lists per schema class; the null class key holds the unfiltered lists */
+    TMap<TObjectKey<UClass>, FSchemaLists> NativeListsBySchema;
+
+    /** Blueprint node types by kind */
+    TArray<FEntry> BlueprintTypes[3];
+    bool bBlueprintTypesBuilt = false;
+
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle ReloadCompleteHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+    FDelegateHandle AssetUpdatedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+};
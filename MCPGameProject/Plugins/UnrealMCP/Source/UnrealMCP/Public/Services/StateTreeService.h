@@ -1,8 +1,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/StrongObjectPtr.h"
 #include "Services/IStateTreeService.h"
 
+class UStateTreeEditorData;
+
 /**
  * Implementation of StateTree service operations
  */
@@ -21,7 +28,9 @@ public:
 
     virtual UStateTree* CreateStateTree(const FStateTreeCreationParams& Params, FString& OutError) override;
     virtual UStateTree* FindStateTree(const FString& PathOrName) override;
-    virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError) override;
+    virtual bool CompileStateTree(UStateTree* StateTree, FString& OutError, bool bForce = false) override;
+    virtual bool IsStateTreeCompileUpToDate(UStateTree* StateTree) override;
+    virtual bool ValidateStateTree(UStateTree* StateTree, TArray<FString>& OutMessages, FString& OutError) override;
     virtual UStateTree* DuplicateStateTree(const FString& SourcePath, const FString& DestPath, const FString& NewName, FString& OutError) override;
 
     // ============================================================================
@@ -52,11 +61,12 @@ public:
     // IStateTreeService Implementation - Introspection
     // ============================================================================
 
-    virtual bool GetStateTreeMetadata(UStateTree* StateTree, TSharedPtr<FJsonObject>& OutMetadata) override;
+    virtual bool GetStateTreeMetadata(UStateTree* StateTree, const FStateTreeMetadataQuery& Query, TSharedPtr<FJsonObject>& OutMetadata, FString& OutError) override;
     virtual bool GetStateTreeDiagnostics(UStateTree* StateTree, TSharedPtr<FJsonObject>& OutDiagnostics) override;
     virtual bool GetAvailableTaskTypes(TArray<TPair<FString, FString>>& OutTasks) override;
     virtual bool GetAvailableConditionTypes(TArray<TPair<FString, FString>>& OutConditions) override;
     virtual bool GetAvailableEvaluatorTypes(TArray<TPair<FString, FString>>& OutEvaluators) override;
+    virtual bool QueryNodeTypes(EStateTreeNodeKind Kind, bool bBlueprint, const FStateTreeNodeTypeQuery& Query, TArray<TPair<FString, FString>>& OutTypes, int32& OutTotalCount, FString& OutError) override;
 
     // ============================================================================
     // IStateTreeService Implementation - Property Binding (Section 1)
@@ -107,7 +117,7 @@ public:
     // ============================================================================
 
     virtual bool AddGameplayTagToState(const FAddGameplayTagToStateParams& Params, FString& OutError) override;
-    virtual bool QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates) override;
+    virtual bool QueryStatesByTag(const FQueryStatesByTagParams& Params, TArray<FString>& OutStates, TArray<FLinkedStateTagMatch>& OutLinkedStates) override;
 
     // ============================================================================
     // IStateTreeService Implementation - Runtime Inspection (Section 8)
@@ -167,26 +177,168 @@ public:
 
     virtual bool BatchAddStates(const FBatchAddStatesParams& Params, FString& OutError) override;
     virtual bool BatchAddTransitions(const FBatchAddTransitionsParams& Params, FString& OutError) override;
+    virtual bool BatchSetNodeProperties(const FBatchSetNodePropertiesParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
+    virtual bool BuildStateTreeFromSpec(const FBuildStateTreeFromSpecParams& Params, TSharedPtr<FJsonObject>& OutReport, FString& OutError) override;
 
     // ============================================================================
     // IStateTreeService Implementation - Validation and Debugging (Section 16)
     // ============================================================================
 
     virtual bool ValidateAllBindings(const FString& StateTreePath, TSharedPtr<FJsonObject>& OutValidationResults) override;
+    virtual bool StartBulkBindingValidation(const TArray<FString>& StateTreePaths, const FString& PackagePath, int32 MaxInFlight, int64& OutJobId, int32& OutTreeCount, FString& OutError) override;
+    virtual bool GetBulkBindingValidation(int64 JobId, int32 Cursor, int32 MaxResults, TSharedPtr<FJsonObject>& OutStatus, FString& OutError) override;
     virtual bool GetStateExecutionHistory(const FString& StateTreePath, const FString& ActorPath, int32 MaxEntries, TSharedPtr<FJsonObject>& OutHistory) override;
+    virtual bool StartStateTreeRecording(const FString& StateTreePath, int32 Capacity, FString& OutError) override;
+    virtual bool StopStateTreeRecording() override;
 
 private:
-    /** Helper to find a state by name within editor data */
-    class UStateTreeState* FindStateByName(class UStateTreeEditorData* EditorData, const FString& StateName);
-
-    /** Helper to find a state recursively */
-    class UStateTreeState* FindStateByNameRecursive(class UStateTreeState* State, const FString& StateName);
+    /** Name and ID lookup of the states of one editor data */
+    struct FStateIndex
+    {
+        /** First state of each name in depth-first order; names compare case-insensitively */
+        TMap<FString, TWeakObjectPtr<class UStateTreeState>> ByName;
+        TMap<FGuid, TWeakObjectPtr<class UStateTreeState>> ById;
+        bool bBuilt = false;
+    };
+
+    /**
+     * State indices per editor data, built on first lookup
+     * The service invalidates an index when it adds, removes or renames a state; a lookup that
+     * misses, or hits a state that was renamed or detached elsewhere (editor, undo), rebuilds it.
+     */
+    TMap<TObjectKey<UStateTreeEditorData>, FStateIndex> StateIndices;
+
+    /** Editor data hash of each StateTree at its last successful compile */
+    TMap<TObjectKey<UStateTree>, uint32> LastCompiledHashes;
+
+    /** Metadata hash of one state and the revision it last changed at */
+    struct FStateRevision
+    {
+        uint32 Hash = 0;
+        int64 ChangedAt = 0;
+    };
+
+    /**
+     * Revision history of one StateTree's metadata
+     * Brought up to date by each metadata or diagnostics query, which compares the hash of what it
+     * reports for every state with the last one seen, so edits made in the editor count as well.
+     */
+    struct FTreeRevision
+    {
+        int64 Revision = 0;
+        /** Revision the tree was first seen at; what changed before it is unknown */
+        int64 FirstRevision = 0;
+        uint32 GlobalsHash = 0;
+        int64 GlobalsChangedAt = 0;
+        TMap<FGuid, FStateRevision> States;
+        /** Revision each state that left the tree was removed at */
+        TMap<FGuid, int64> RemovedAt;
+        int32 StateCount = 0;
+        int32 TaskCount = 0;
+        int32 TransitionCount = 0;
+    };
+
+    /** Revision history per StateTree */
+    TMap<TObjectKey<UStateTree>, FTreeRevision> TreeRevisions;
+
+    /** Last revision handed out; revisions are shared by every tree and start from the wall clock */
+    int64 LastRevision = 0;
+
+    /** StateTree of a bulk binding validation job whose bindings are being checked on a worker thread */
+    struct FBulkBindingValidationTree
+    {
+        FSoftObjectPath Path;
+        /** Keeps the tree, and the node types its snapshot points at, loaded until the check is done */
+        TStrongObjectPtr<UStateTree> StateTree;
+        TFuture<TSharedPtr<FJsonObject>> Result;
+    };
+
+    /** Validation run started by StartBulkBindingValidation */
+    struct FBulkBindingValidationJob
+    {
+        /** Trees to check, in request order */
+        TArray<FSoftObjectPath> Queue;
+        /** Trees in Queue plus the requested names that matched no tree */
+        int32 TreeCount = 0;
+        /** Index in Queue of the next tree to load */
+        int32 NextQueued = 0;
+        int32 LoadsInFlight = 0;
+        TArray<FBulkBindingValidationTree> Validating;
+        int32 MaxInFlight = 8;
+        double StartTime = 0.0;
+        double FinishTime = 0.0;
+        bool bFinished = false;
+        /** Result per tree, in completion order */
+        TArray<TSharedPtr<FJsonObject>> Results;
+        /** Trees that failed to load or have binding errors */
+        int32 FailedCount = 0;
+    };
+
+    /** Finished bulk validation jobs whose results are kept */
+    static constexpr int32 MaxFinishedBulkBindingValidationJobs = 4;
+
+    /** Bulk validation jobs by id, game thread only */
+    TMap<int64, FBulkBindingValidationJob> BulkBindingValidationJobs;
+    int64 NextBulkBindingValidationJobId = 1;
+
+    /** Ticks the bulk validation jobs while any is running */
+    FTSTicker::FDelegateHandle BulkBindingValidationTickerHandle;
+
+    /** Start loads up to each job's limit and take the results of finished checks */
+    bool TickBulkBindingValidation(float DeltaTime);
+
+    /** Snapshot a loaded tree of a bulk validation job and check it on a worker, or record that it failed to load */
+    void HandleBulkBindingValidationLoaded(int64 JobId, const FSoftObjectPath& Path, bool bSucceeded);
+
+    /** Helper to hash a StateTree's editor data, states and nodes included */
+    uint32 CalculateEditorDataHash(UStateTree* StateTree) const;
+
+    /** Helper to get the state index of editor data, building it if needed */
+    FStateIndex& GetStateIndex(UStateTreeEditorData* EditorData);
+
+    /** Helper to drop the state index of editor data after its states changed */
+    void InvalidateStateIndex(UStateTreeEditorData* EditorData);
+
+    /** Helper to check that a state is still reachable from the editor data's subtrees */
+    bool IsStateInTree(UStateTreeEditorData* EditorData, const class UStateTreeState* State) const;
+
+    /** Helper to find a state by name, or by ID string, within editor data */
+    class UStateTreeState* FindStateByName(UStateTreeEditorData* EditorData, const FString& StateName);
+
+    /** Helper to map every state name to its state, first match in FindStateByName order */
+    void CollectStatesByName(UStateTreeEditorData* EditorData, TMap<FString, class UStateTreeState*>& OutStates);
+
+    /** Helper to create a state under a parent, or as a root state if ParentState is null */
+    class UStateTreeState* CreateState(class UStateTreeEditorData* EditorData, class UStateTreeState* ParentState, const FString& StateName,
+                                       const FString& StateType, const FString& SelectionBehavior, bool bEnabled);
+
+    /** Helper to fill a transition from its parameters; TargetState is null when no target is given */
+    void InitTransition(const FAddTransitionParams& Params, const class UStateTreeState* TargetState, struct FStateTreeTransition& OutTransition);
 
     /** Helper to get all root states from editor data */
     TArray<class UStateTreeState*> GetRootStates(class UStateTreeEditorData* EditorData);
 
-    /** Helper to build state metadata recursively */
-    TSharedPtr<FJsonObject> BuildStateMetadata(class UStateTreeState* State);
+    /**
+     * Helper to build state metadata, with its children down to the query's depth
+     * @param Depth Levels below the starting state
+     * @param bFlat List children by ID instead of nesting them
+     */
+    TSharedPtr<FJsonObject> BuildStateMetadata(class UStateTreeState* State, const FStateTreeMetadataQuery& Query, int32 Depth, bool bFlat);
+
+    /**
+     * Helper to set JSON properties on a node's instance data, or on the node where the instance has no such property
+     * @param Resolver Path cache shared by every node of the caller's batch
+     * @param OutSet Receives the paths that were set
+     * @param OutFailed Receives the paths that failed and why
+     */
+    static void ApplyNodeProperties(struct FStateTreeEditorNode& Node, const TSharedPtr<FJsonObject>& Properties,
+                                    class FStateTreePropertyPathResolver& Resolver, TArray<FString>& OutSet, TMap<FString, FString>& OutFailed);
+
+    /** Helper to hash everything BuildStateMetadata reports for a state, children by ID */
+    static uint32 HashStateMetadata(const class UStateTreeState* State);
+
+    /** Helper to bring a StateTree's revision history up to date with its editor data */
+    FTreeRevision& UpdateTreeRevision(UStateTree* StateTree, UStateTreeEditorData* EditorData);
 
     /** Helper to parse state type string to enum */
     int32 ParseStateType(const FString& StateTypeString);
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class UStateTree;
+class UStateTreeState;
+class UObject;
+struct FPropertyChangedEvent;
+
+/**
+ * Gameplay tag to state index of StateTrees, for query_states_by_tag
+ *
+ * One walk over a tree's states records the states of each tag, in tree order, and the trees its
+ * LinkedAsset states run; a query then only looks at the tree's distinct tags, and follows the
+ * linked trees through their own indices, so no hierarchy is walked again until it changes.
+ *
+ * The service updates an index in place when it sets a state's tag and drops it when it adds,
+ * removes or relinks states. Edits made elsewhere drop it too: property changes of a tree's states
+ * or editor data (the details panel) and undo/redo. A hit whose state no longer carries the tag or
+ * left the tree also rebuilds the index, which catches structural edits made without a property
+ * change.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FStateTreeTagIndex
+{
+public:
+    /** One state a query matched */
+    struct FMatch
+    {
+        UStateTree* StateTree = nullptr;
+        UStateTreeState* State = nullptr;
+        /** Linked trees followed from the queried tree to reach this one; 0 for the queried tree */
+        int32 LinkDepth = 0;
+    };
+
+    static FStateTreeTagIndex& Get();
+
+    /** Start following property changes and undo/redo */
+    void Initialize();
+
+    /** Stop following changes and drop every index */
+    void Shutdown();
+
+    /**
+     * States carrying a tag
+     * @param StateTree Tree to search
+     * @param Tag Tag to find
+     * @param bExactMatch Only the tag itself; otherwise the tag and its child tags
+     * @param bIncludeLinked Also search the trees of LinkedAsset states, recursively
+     * @param OutMatches Receives the matches, each tree's in tree order, the queried tree first
+     */
+    void FindStates(UStateTree* StateTree, const FGameplayTag& Tag, bool bExactMatch, bool bIncludeLinked, TArray<FMatch>& OutMatches);
+
+    /**
+     * Move a state to its new tag after the service set it
+     * @param State State whose Tag changed
+     * @param OldTag Tag the state had before
+     */
+    void HandleTagChanged(UStateTreeState* State, const FGameplayTag& OldTag);
+
+    /** Drop the index of a tree after its states changed */
+    void Invalidate(const UStateTree* StateTree);
+
+private:
+    FStateTreeTagIndex() = default;
+
+    /** Index of one tree */
+    struct FTreeTags
+    {
+        /** States of each tag, by their position in a depth-first walk */
+        TMap<FGameplayTag, TArray<TPair<int32, TWeakObjectPtr<UStateTreeState>>>> StatesByTag;
+        /** Position of every state in the walk */
+        TMap<TObjectKey<UStateTreeState>, int32> Positions;
+        /** Trees run by LinkedAsset states, once each */
+        TArray<TWeakObjectPtr<UStateTree>> LinkedTrees;
+    };
+
+    /** @return The index of a tree, built if needed */
+    const FTreeTags& GetTreeTags(UStateTree* StateTree);
+
+    static void Build(UStateTree* StateTree, FTreeTags& OutTags);
+
+    /**
+     * Append the matches of one tree
+     * @return false if a hit was stale and the index must be rebuilt
+     */
+    static bool CollectMatches(UStateTree* StateTree, const FTreeTags& Tags, const FGameplayTag& Tag, bool bExactMatch, int32 LinkDepth, TArray<FMatch>& OutMatches);
+
+    /** @return true if the state is still reachable from its editor data's subtrees */
+    static bool IsStateInTree(const UStateTreeState* State);
+
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+
+    TMap<TObjectKey<UStateTree>, FTreeTags> Trees;
+    /** Index for callers before Initialize, when changes are not followed */
+    FTreeTags UncachedTags;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+};
@@ -6,6 +6,7 @@
 // Forward declarations
 class UWidgetBlueprint;
 class UWidget;
+struct FMCPImageEncodeOptions;
 
 /**
  * Interface for UMG (Widget Blueprint) operations
@@ -146,14 +147,28 @@ public:
      * Capture a screenshot of a widget blueprint preview
      * Renders the widget to a texture and returns as base64-encoded image data
      * @param BlueprintName - Name of the target widget blueprint
-     * @param Width - Width of the screenshot in pixels
-     * @param Height - Height of the screenshot in pixels
-     * @param Format - Image format ("png" or "jpg")
+     * @param Width - Layout width of the widget in pixels
+     * @param Height - Layout height of the widget in pixels
+     * @param ImageOptions - Crop region (in layout pixels), scale, format and quality of the image
      * @param OutScreenshotData - Output JSON object containing base64-encoded image and metadata
      * @return true if screenshot was captured successfully
      */
     virtual bool CaptureWidgetScreenshot(const FString& BlueprintName, int32 Width, int32 Height,
-                                        const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData) = 0;
+                                        const FMCPImageEncodeOptions& ImageOptions, TSharedPtr<FJsonObject>& OutScreenshotData) = 0;
+
+    /**
+     * Start capturing a screenshot of a widget blueprint preview; game thread only
+     * Same result as CaptureWidgetScreenshot, but the GPU readback and encoding happen
+     * asynchronously, so the game thread never waits on the GPU
+     * @param BlueprintName - Name of the target widget blueprint
+     * @param Width - Layout width of the widget in pixels
+     * @param Height - Layout height of the widget in pixels
+     * @param ImageOptions - Crop region (in layout pixels), scale, format and quality of the image
+     * @param OnCaptured - Receives the screenshot data, or nullptr on failure; called on any thread
+     */
+    virtual void CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                             const FMCPImageEncodeOptions& ImageOptions,
+                                             TFunction<void(TSharedPtr<FJsonObject>)> OnCaptured) = 0;
 
     /**
      * Create an input event handler in a Widget Blueprint
@@ -205,6 +220,35 @@ public:
     virtual bool ReorderWidgetChildren(const FString& WidgetName, const FString& ContainerName,
                                       const TArray<FString>& ChildOrder) = 0;
 
+    /**
+     * Build a whole widget hierarchy from a nested spec in one transaction
+     * Every widget is created, parented, placed and configured before the blueprint is marked
+     * structurally modified, compiled and saved once.
+     * @param WidgetName - Name of the target Widget Blueprint
+     * @param ParentName - Existing widget to add the spec's root to; empty for the tree's root widget
+     *                     (the spec's root becomes the root widget if the tree has none)
+     * @param TreeSpec - Root widget spec: {name, type, kwargs, properties, slot, position, size, alignment, is_variable, children}
+     * @param OutResult - Created widgets, in creation order
+     * @param OutError - Error message if the tree could not be built
+     * @return true if every widget in the spec was created
+     */
+    virtual bool BuildWidgetTree(const FString& WidgetName, const FString& ParentName,
+                                const TSharedPtr<FJsonObject>& TreeSpec, TSharedPtr<FJsonObject>& OutResult,
+                                FString& OutError) = 0;
+
+    /**
+     * Update the placement, slot and properties of many widgets of a Widget Blueprint in one transaction
+     * Every widget is updated before the blueprint is marked modified, compiled and saved once,
+     * so the designer refreshes once for the whole batch.
+     * @param WidgetName - Name of the target Widget Blueprint
+     * @param Updates - Widget updates: {component_name, properties, slot, position, size, alignment}
+     * @param OutResult - Result entry per update, in request order
+     * @param OutError - Error message if a widget blueprint or widget was not found; nothing is changed then
+     * @return true if every named widget was found and its update applied
+     */
+    virtual bool UpdateWidgets(const FString& WidgetName, const TArray<TSharedPtr<FJsonObject>>& Updates,
+                              TSharedPtr<FJsonObject>& OutResult, FString& OutError) = 0;
+
     /**
      * Set the design size mode for a widget blueprint
      * @param WidgetName - Name of the widget blueprint
@@ -56,7 +56,11 @@ public:
     virtual bool GetWidgetComponentLayout(const FString& BlueprintName, TSharedPtr<FJsonObject>& OutLayoutInfo) override;
 
     virtual bool CaptureWidgetScreenshot(const FString& BlueprintName, int32 Width, int32 Height,
-                                        const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData) override;
+                                        const FMCPImageEncodeOptions& ImageOptions, TSharedPtr<FJsonObject>& OutScreenshotData) override;
+
+    virtual void CaptureWidgetScreenshotAsync(const FString& BlueprintName, int32 Width, int32 Height,
+                                             const FMCPImageEncodeOptions& ImageOptions,
+                                             TFunction<void(TSharedPtr<FJsonObject>)> OnCaptured) override;
 
     virtual bool CreateWidgetInputHandler(const FString& WidgetName, const FString& ComponentName,
                                          const FString& InputType, const FString& InputEvent,
@@ -68,6 +72,13 @@ public:
     virtual bool ReorderWidgetChildren(const FString& WidgetName, const FString& ContainerName,
                                       const TArray<FString>& ChildOrder) override;
 
+    virtual bool BuildWidgetTree(const FString& WidgetName, const FString& ParentName,
+                                const TSharedPtr<FJsonObject>& TreeSpec, TSharedPtr<FJsonObject>& OutResult,
+                                FString& OutError) override;
+
+    virtual bool UpdateWidgets(const FString& WidgetName, const TArray<TSharedPtr<FJsonObject>>& Updates,
+                              TSharedPtr<FJsonObject>& OutResult, FString& OutError) override;
+
     /**
      * Set the design size mode for a widget blueprint
      * @param WidgetName - Name of the widget blueprint
@@ -168,4 +179,50 @@ private:
      * Add a widget as a child to another widget (parent must be a panel widget)
      */
     bool AddWidgetToParent(UWidget* ChildWidget, UWidget* ParentWidget) const;
+
+    /**
+     * Apply properties to a widget without compiling or saving: TextBlock font properties,
+     * "Slot."-prefixed slot properties, then everything else through PropertyService
+     * @param WidgetBlueprint - Blueprint that owns the widget
+     * @param Widget - The widget to modify
+     * @param Properties - Properties to set
+     * @param OutSuccessProperties - Properties that were set
+     * @param OutFailedProperties - Properties that could not be set
+     */
+    void ApplyWidgetProperties(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget, const TSharedPtr<FJsonObject>& Properties,
+                               TArray<FString>& OutSuccessProperties, TArray<FString>& OutFailedProperties) const;
+
+    /**
+     * Check a build_widget_tree spec before anything is created
+     * @param WidgetBlueprint - Target widget blueprint
+     * @param Spec - Widget spec to check, with its children
+     * @param InOutNames - Widget names used so far in the spec
+     * @param OutError - Error message if the spec is invalid
+     * @return true if the spec and all its children are valid
+     */
+    bool ValidateWidgetTreeSpec(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& Spec,
+                                TSet<FString>& InOutNames, FString& OutError) const;
+
+    /**
+     * Apply the placement, slot and properties of a widget spec or update, without compiling or saving
+     * @param WidgetBlueprint - Blueprint that owns the widget
+     * @param Widget - The widget to modify
+     * @param Spec - Spec with optional position, size, alignment, slot and properties
+     * @param OutWidgetResult - Receives the success_properties and failed_properties arrays
+     * @return true if anything was set
+     */
+    bool ApplyWidgetSpec(UWidgetBlueprint* WidgetBlueprint, UWidget* Widget, const TSharedPtr<FJsonObject>& Spec,
+                         const TSharedPtr<FJsonObject>& OutWidgetResult) const;
+
+    /**
+     * Create one widget of a build_widget_tree spec and, recursively, its children
+     * @param WidgetBlueprint - Target widget blueprint
+     * @param Spec - Widget spec
+     * @param ParentWidget - Widget to add the new widget to; nullptr makes it the root widget
+     * @param OutWidgets - Receives a result entry per created widget
+     * @param OutError - Error message if a widget could not be created or parented
+     * @return true if the widget and all its children were created
+     */
+    bool BuildWidgetSubtree(UWidgetBlueprint* WidgetBlueprint, const TSharedPtr<FJsonObject>& Spec, UWidget* ParentWidget,
+                            TArray<TSharedPtr<FJsonValue>>& OutWidgets, FString& OutError) const;
 };
@@ -40,6 +40,22 @@ public:
         const TSharedPtr<FJsonObject>& KwargsObject,
         FString& OutError);
 
+    /**
+     * Creates a widget component of the specified type without adding it to the widget tree or saving
+     * @param WidgetBlueprint - The widget blueprint whose widget tree owns the component
+     * @param ComponentName - Name for the new component
+     * @param ComponentType - Type of the component to create
+     * @param KwargsObject - Additional parameters for the component
+     * @param OutError - Output error message if creation failed
+     * @return Created widget or nullptr if creation failed
+     */
+    UWidget* ConstructWidgetComponent(
+        UWidgetBlueprint* WidgetBlueprint,
+        const FString& ComponentName,
+        const FString& ComponentType,
+        const TSharedPtr<FJsonObject>& KwargsObject,
+        FString& OutError);
+
     /**
      * Get the list of supported component types
      * @return Array of supported component type names
@@ -6,6 +6,7 @@
 // Forward declarations
 class UWidgetBlueprint;
 class UWidget;
+struct FMCPImageEncodeOptions;
 
 /**
  * Service for widget layout inspection and screenshot capture
@@ -24,15 +25,46 @@ public:
 
     /**
      * Capture a screenshot of a widget blueprint
+     * The widget is laid out at Width x Height and rendered at that size times the scale, so a
+     * downscaled capture costs less to render as well as to encode
      * @param WidgetBlueprint - Widget blueprint to capture
-     * @param Width - Screenshot width in pixels
-     * @param Height - Screenshot height in pixels
-     * @param Format - Image format ("png" or "jpg")
+     * @param Width - Layout width in pixels
+     * @param Height - Layout height in pixels
+     * @param ImageOptions - Crop region (in layout pixels), scale, format and quality of the image
      * @param OutScreenshotData - Output JSON object containing base64 encoded image
      * @return true if screenshot was captured successfully
      */
     static bool CaptureWidgetScreenshot(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
-                                       const FString& Format, TSharedPtr<FJsonObject>& OutScreenshotData);
+                                       const FMCPImageEncodeOptions& ImageOptions, TSharedPtr<FJsonObject>& OutScreenshotData);
+
+    /**
+     * Start capturing a screenshot of a widget blueprint without waiting for the GPU
+     * Renders on the game thread like CaptureWidgetScreenshot, then reads the pixels back
+     * asynchronously and encodes them on a worker
+     * @param WidgetBlueprint - Widget blueprint to capture
+     * @param Width - Layout width in pixels
+     * @param Height - Layout height in pixels
+     * @param ImageOptions - Crop region (in layout pixels), scale, format and quality of the image
+     * @param OnCaptured - Receives the screenshot data, or nullptr on failure; called on any thread
+     */
+    static void CaptureWidgetScreenshotAsync(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                             const FMCPImageEncodeOptions& ImageOptions,
+                                             TFunction<void(TSharedPtr<FJsonObject>)> OnCaptured);
+
+    /**
+     * Measure the layout of a widget blueprint without rendering it
+     * A preview instance is laid out at Width x Height with a Slate prepass and an arrange pass,
+     * which give every widget's desired size and geometry at a fraction of a screenshot's cost
+     * @param WidgetBlueprint - Widget blueprint to measure
+     * @param Width - Layout width in pixels
+     * @param Height - Layout height in pixels
+     * @param RootWidget - Widget the report starts at; empty for the tree's root widget
+     * @param MaxDepth - Levels below the report's first widget to include; INDEX_NONE for every level
+     * @param OutLayoutInfo - Output JSON object with the measured widget tree
+     * @return true if the widget could be instantiated and measured
+     */
+    static bool MeasureWidgetLayout(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height,
+                                    const FString& RootWidget, int32 MaxDepth, TSharedPtr<FJsonObject>& OutLayoutInfo);
 
 private:
     /**
@@ -8,6 +8,20 @@ class UWidgetBlueprint;
 class UWidget;
 class IUMGService;
 
+/**
+ * Part of the widget tree the components, layout, measured_layout, hierarchy and bindings sections describe
+ */
+struct FWidgetTreeQuery
+{
+    /** Widget the sections start at; empty for the tree's root widget */
+    FString RootWidget;
+    /** Levels below the start widget to include; INDEX_NONE for every level */
+    int32 MaxDepth = INDEX_NONE;
+
+    /** @return Whether the query covers less than the whole tree */
+    bool IsSubtree() const { return !RootWidget.IsEmpty() || MaxDepth != INDEX_NONE; }
+};
+
 /**
  * Service for building Widget Blueprint metadata JSON objects.
  * Handles the construction of various metadata sections like components, layout,
@@ -20,21 +34,34 @@ class UNREALMCP_API FWidgetMetadataBuilderService
 public:
     FWidgetMetadataBuilderService(TSharedPtr<IUMGService> InUMGService);
 
-    // Metadata section builders
-    TSharedPtr<FJsonObject> BuildComponentsInfo(UWidgetBlueprint* WidgetBlueprint) const;
-    TSharedPtr<FJsonObject> BuildLayoutInfo(UWidgetBlueprint* WidgetBlueprint) const;
+    // Metadata section builders; the tree sections cover the part of the tree the query selects
+    TSharedPtr<FJsonObject> BuildComponentsInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query = FWidgetTreeQuery()) const;
+    TSharedPtr<FJsonObject> BuildLayoutInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query = FWidgetTreeQuery()) const;
     TSharedPtr<FJsonObject> BuildDimensionsInfo(UWidgetBlueprint* WidgetBlueprint, const FString& ContainerName) const;
-    TSharedPtr<FJsonObject> BuildHierarchyInfo(UWidgetBlueprint* WidgetBlueprint) const;
-    TSharedPtr<FJsonObject> BuildBindingsInfo(UWidgetBlueprint* WidgetBlueprint) const;
+    /** Desired sizes and arranged geometry of a preview instance laid out at Width x Height */
+    TSharedPtr<FJsonObject> BuildMeasuredLayoutInfo(UWidgetBlueprint* WidgetBlueprint, int32 Width, int32 Height, const FWidgetTreeQuery& Query = FWidgetTreeQuery()) const;
+    TSharedPtr<FJsonObject> BuildHierarchyInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query = FWidgetTreeQuery()) const;
+    TSharedPtr<FJsonObject> BuildBindingsInfo(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query = FWidgetTreeQuery()) const;
     TSharedPtr<FJsonObject> BuildEventsInfo(UWidgetBlueprint* WidgetBlueprint) const;
     TSharedPtr<FJsonObject> BuildVariablesInfo(UWidgetBlueprint* WidgetBlueprint) const;
     TSharedPtr<FJsonObject> BuildFunctionsInfo(UWidgetBlueprint* WidgetBlueprint) const;
     TSharedPtr<FJsonObject> BuildOrphanedNodesInfo(UWidgetBlueprint* WidgetBlueprint) const;
     TSharedPtr<FJsonObject> BuildGraphWarningsInfo(UWidgetBlueprint* WidgetBlueprint) const;
 
-    // Helper methods
-    void CollectAllWidgets(UWidget* Widget, TArray<UWidget*>& OutWidgets) const;
-    TSharedPtr<FJsonObject> BuildWidgetInfo(UWidget* Widget) const;
+    /**
+     * Keep only some keys of a built section: of each widget entry, the children of tree entries
+     * included, or of the section itself when it holds no entries
+     * @param Section - Section built by one of the builders above
+     * @param Keys - Keys to keep
+     */
+    static void ProjectSection(const TSharedPtr<FJsonObject>& Section, const TArray<FString>& Keys);
+
+    /** @return The widget a query starts at, or nullptr if the tree has no such widget */
+    UWidget* FindQueryRoot(UWidgetBlueprint* WidgetBlueprint, const FWidgetTreeQuery& Query) const;
+
+    // Helper methods; MaxDepth counts levels below Widget, INDEX_NONE for every level
+    void CollectAllWidgets(UWidget* Widget, TArray<UWidget*>& OutWidgets, int32 MaxDepth = INDEX_NONE) const;
+    TSharedPtr<FJsonObject> BuildWidgetInfo(UWidget* Widget, int32 MaxDepth = INDEX_NONE) const;
     TArray<FString> GetAvailableDelegateEvents(UWidget* Widget) const;
 
 private:
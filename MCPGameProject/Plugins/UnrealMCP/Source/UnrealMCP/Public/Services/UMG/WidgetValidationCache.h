@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+#include "MCPCacheStats.h"
+
+class UBlueprint;
+class UClass;
+class UObject;
+class UWidgetBlueprint;
+struct FPropertyChangedEvent;
+
+/**
+ * Lookups FWidgetValidationService repeats for every widget it validates, resolved once
+ *
+ * Keeps the widget blueprint each name resolved to, the component names of each widget
+ * blueprint's tree, and the property and event names of each widget class, so the existence checks
+ * of a validation are set lookups instead of an asset search and a widget tree walk each.
+ *
+ * A blueprint's component names are dropped when the blueprint, its widget tree or one of its
+ * widgets is modified, when the blueprint is marked as modified, when an MCP command changes its
+ * tree (see Invalidate), and on undo/redo. A resolved name is used only while the blueprint is
+ * alive and still has that name. Class members are dropped on a code reload.
+ *
+ * Game thread only.
+ */
+class UNREALMCP_API FWidgetValidationCache
+{
+public:
+    static FWidgetValidationCache& Get();
+
+    /** Start following modifications, undo/redo and code reloads */
+    void Initialize();
+
+    /** Stop following changes and drop every cached lookup */
+    void Shutdown();
+
+    /**
+     * Widget blueprint a name or path refers to, resolved if not cached
+     * @param BlueprintName - Widget blueprint name or path
+     * @return The widget blueprint, or nullptr if there is none
+     */
+    UWidgetBlueprint* FindWidgetBlueprint(const FString& BlueprintName);
+
+    /**
+     * Whether a widget blueprint's tree holds a widget
+     * @param WidgetBlueprint - Widget blueprint to look in
+     * @param ComponentName - Widget name
+     * @return true if the tree has a widget of that name
+     */
+    bool HasComponent(const UWidgetBlueprint* WidgetBlueprint, const FString& ComponentName);
+
+    /**
+     * Whether a widget class has a property, its own or inherited
+     * @param WidgetClass - Widget class
+     * @param PropertyName - Property name
+     * @return true if the property exists
+     */
+    bool HasProperty(const UClass* WidgetClass, const FString& PropertyName);
+
+    /**
+     * Whether a widget class has a multicast delegate property, its own or inherited
+     * @param WidgetClass - Widget class
+     * @param EventName - Event name
+     * @return true if the event exists
+     */
+    bool HasEvent(const UClass* WidgetClass, const FString& EventName);
+
+    /**
+     * Drop the component names of a widget blueprint whose tree changed
+     * @param Blueprint - Modified blueprint
+     */
+    void Invalidate(const UBlueprint* Blueprint);
+
+private:
+    FWidgetValidationCache() = default;
+
+    struct FClassMembers
+    {
+        TSet<FName> Properties;
+        TSet<FName> Events;
+    };
+
+    /** Members of a widget class, read if not cached */
+    const FClassMembers& GetClassMembers(const UClass* WidgetClass);
+
+    void HandleObjectModified(UObject* Object);
+    void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+    void HandleUndoRedo();
+    void HandleReloadComplete(EReloadCompleteReason Reason);
+
+    TMap<FString, TWeakObjectPtr<UWidgetBlueprint>> ResolvedBlueprints;
+    TMap<TWeakObjectPtr<const UWidgetBlueprint>, TSet<FName>> ComponentNames;
+    TMap<TWeakObjectPtr<const UClass>, FClassMembers> ClassMembers;
+    /** Result for callers before Initialize, when changes are not followed */
+    FClassMembers UncachedMembers;
+    FMCPCacheCounters CacheCounters;
+    bool bInitialized = false;
+
+    FDelegateHandle ObjectModifiedHandle;
+    FDelegateHandle ObjectPropertyChangedHandle;
+    FDelegateHandle UndoRedoHandle;
+    FDelegateHandle ReloadCompleteHandle;
+};
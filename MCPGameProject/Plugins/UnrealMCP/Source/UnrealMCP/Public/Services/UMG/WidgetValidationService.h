@@ -42,6 +42,7 @@ struct UNREALMCP_API FWidgetValidationResult
 /**
  * Service for validating UMG widget operations and parameters
  * Provides comprehensive validation for widget creation, modification, and hierarchy
+ * Blueprint, component, property and event existence checks are answered by FWidgetValidationCache
  */
 class UNREALMCP_API FWidgetValidationService
 {
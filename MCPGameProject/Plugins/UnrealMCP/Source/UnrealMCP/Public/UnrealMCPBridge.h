@@ -8,23 +8,24 @@
 #include "Json.h"
 #include "Interfaces/IPv4/IPv4Address.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
-#include "Commands/Editor/UnrealMCPEditorCommands.h"
-#include "Commands/Blueprint/UnrealMCPBlueprintCommands.h"
-#include "Commands/BlueprintNode/UnrealMCPBlueprintNodeCommands.h"
-#include "Commands/Project/UnrealMCPProjectCommands.h"
-#include "Commands/UMG/UnrealMCPUMGCommands.h"
-
-#include "Commands/BlueprintAction/UnrealMCPBlueprintActionCommandsHandler.h"
 #include "Commands/UnrealMCPCommandRegistry.h"
+#include "MCPCancellation.h"
+#include "MCPCommandScheduler.h"
 #include "UnrealMCPBridge.generated.h"
 
 class FMCPServerRunnable;
+class FMCPLocalListener;
+class FMCPRequestCoalescer;
+class FMCPResponseCache;
+class FMCPAdmissionController;
+class FMCPStartupWarmup;
 
 /**
  * Editor subsystem for MCP Bridge
  * Handles communication between external tools and the Unreal Editor
- * through a TCP socket connection. Commands are received as JSON and
- * routed to appropriate command handlers.
+ * through a TCP socket connection, plus a local domain socket for tools on
+ * the same machine. Commands are received as JSON and routed to appropriate
+ * command handlers.
  */
 UCLASS()
 class UNREALMCP_API UUnrealMCPBridge : public UEditorSubsystem
@@ -47,22 +48,94 @@ public:
 	// Command execution
 	FString ExecuteCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Queue a command for execution without waiting for it; it runs on the game thread, through the
+	 * budgeted command scheduler, unless its thread affinity (IUnrealMCPCommand::GetThreadAffinity)
+	 * allows a worker thread. A read-only command that is identical to one already in flight shares
+	 * that request's execution and response, and a cacheable one may be answered from the response cache.
+	 * When too many commands are in flight (FMCPAdmissionController) the future is fulfilled at once with
+	 * a "busy" error carrying retry_after_ms, and until the editor has finished its startup asset scan
+	 * (FMCPStartupWarmup) with a "warming_up" error carrying eta_ms. Health checks (ping, health and
+	 * commands with EMCPThreadAffinity::TransportThread) are exempt from both and run on the calling
+	 * thread, so the future is already fulfilled when it is returned
+	 * @param CommandType Command name
+	 * @param Params Command parameters
+	 * @param CancellationToken Optional token; a request cancelled before it starts is not run, and a cancelled one is answered with a "cancelled" error
+	 * @param ClientId Connection the request came from, so clients take turns on the game thread; 0 for none
+	 * @param Priority Scheduling class; FMCPCommandScheduler::GetDefaultPriority when unset
+	 * @return Future that is fulfilled with the serialized response once the command has run
+	 */
+	TFuture<FString> ExecuteCommandAsync(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken = nullptr,
+		uint32 ClientId = 0, TOptional<EMCPCommandPriority> Priority = TOptional<EMCPCommandPriority>());
+
+	/** @return Game-thread commands queued in the scheduler that have not started yet */
+	int32 GetQueuedCommandCount() const;
+
+	/** @return Admitted commands whose response is not ready yet */
+	int32 GetInFlightCommandCount() const;
+
+	/**
+	 * Result of ping and health: queue depth, warm-up and game-thread liveness; thread-safe
+	 * @return {"queued_commands", "in_flight_commands", "warming_up", "eta_ms" while warming up,
+	 *          "game_thread_tick_age_ms" (-1 before the first tick), "game_thread_stalled",
+	 *          "state": "ok", "warming_up" or "stalled"}
+	 */
+	TSharedRef<FJsonObject> MakeHealthSnapshot() const;
+
 private:
+	/**
+	 * Share an identical in-flight read-only request's execution, or dispatch the command
+	 * @see ExecuteCommandAsync
+	 */
+	TFuture<FString> CoalesceOrDispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+		uint32 ClientId, TOptional<EMCPCommandPriority> Priority);
+
+	/**
+	 * Queue a command on the thread its affinity calls for, without coalescing
+	 * @see ExecuteCommandAsync
+	 */
+	TFuture<FString> DispatchCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+		uint32 ClientId, TOptional<EMCPCommandPriority> Priority);
+
+	/**
+	 * Run a command on the calling thread and build its response envelope
+	 * @param CommandType Command name
+	 * @param Params Command parameters
+	 * @param CancellationToken Optional token, as for ExecuteCommandAsync
+	 * @param DispatchTime When the command was handed to a thread, for its queue wait in FMCPMetrics; 0 if unknown
+	 * @return Serialized response
+	 */
+	FString ExecuteCommandOnCurrentThread(const FString& CommandType, const TSharedPtr<FJsonObject>& Params, const FMCPCancellationTokenPtr& CancellationToken,
+		double DispatchTime = 0.0);
+
 	// Server state
 	bool bIsRunning;
 	TSharedPtr<FSocket> ListenerSocket;
 	TSharedPtr<FSocket> ConnectionSocket;
 	FRunnableThread* ServerThread;
+	FMCPServerRunnable* ServerRunnable;
+
+	// Same-host local socket transport; not available on every platform
+	TSharedPtr<FMCPLocalListener> LocalListener;
+	FRunnableThread* LocalServerThread;
+	FMCPServerRunnable* LocalServerRunnable;
+
+	// Runs game-thread commands within a per-frame budget
+	TSharedPtr<FMCPCommandScheduler> CommandScheduler;
+
+	// Shares one execution between identical concurrent read-only requests
+	TSharedPtr<FMCPRequestCoalescer> RequestCoalescer;
+
+	// Responses of cacheable metadata commands, dropped whenever editor state changes
+	TSharedPtr<FMCPResponseCache> ResponseCache;
+
+	// Bounds the commands in flight, globally and per client
+	TSharedPtr<FMCPAdmissionController> AdmissionController;
+
+	// Turns commands away while the editor is still starting up and pre-warms the caches meanwhile
+	TSharedPtr<FMCPStartupWarmup> StartupWarmup;
 
 	// Server configuration
 	FIPv4Address ServerAddress;
 	uint16 Port;
-
-	// Command handler instances
-	TSharedPtr<FUnrealMCPEditorCommands> EditorCommands;
-	TSharedPtr<FUnrealMCPBlueprintCommands> BlueprintCommands;
-	TSharedPtr<FUnrealMCPBlueprintNodeCommands> BlueprintNodeCommands;
-	TSharedPtr<FUnrealMCPProjectCommands> ProjectCommands;
-	TSharedPtr<FUnrealMCPUMGCommands> UMGCommands;
-	TSharedPtr<FUnrealMCPBlueprintActionCommandsHandler> BlueprintActionCommands;
 }; 
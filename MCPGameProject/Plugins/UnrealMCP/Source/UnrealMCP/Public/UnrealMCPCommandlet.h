@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "UnrealMCPCommandlet.generated.h"
+
+/**
+ * Headless host for the MCP bridge, for bulk content jobs that don't need the editor UI
+ *
+ * The bridge subsystem starts with the editor engine as it does in the editor; this commandlet
+ * scans the asset registry and then keeps the game thread ticking (task graph, core ticker,
+ * asset registry) so the command scheduler, compile and save queues run without Slate or a
+ * viewport. Run several on one machine by giving each its own port:
+ *
+ *   UnrealEditor-Cmd Project.uproject -run=UnrealMCP -MCPPort=55560 -nullrhi -unattended -nosplash
+ *
+ * Parameters:
+ *   -TickIntervalMs=N: Sleep between ticks, in milliseconds (default 5)
+ *   -MaxRuntime=N: Exit after N seconds (default 0, run until the engine is asked to exit)
+ *   -ExitWhenIdle=N: Exit once no command has been in flight or queued for N seconds, after the
+ *     first command (default 0, never)
+ *
+ * Commands that need a viewport or Slate (screenshots, opening asset editors) fail under -nullrhi.
+ */
+UCLASS()
+class UNREALMCP_API UUnrealMCPCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UUnrealMCPCommandlet();
+
+	// UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "UnrealMCPSettings.generated.h"
+
+/**
+ * Project settings for the MCP bridge (Project Settings > Plugins > Unreal MCP, stored in
+ * DefaultEditor.ini under [/Script/UnrealMCP.UnrealMCPSettings])
+ *
+ * Server settings (port, bind address, connections, socket buffers) are read when the server
+ * starts; the scheduling limits are applied to their console variables (mcp.FrameBudgetMs,
+ * mcp.MaxInFlightCommands, mcp.MaxInFlightCommandsPerClient) at startup and whenever they are
+ * edited, so a console or ini override still wins. -MCPPort= on the command line overrides ServerPort.
+ */
+UCLASS(Config = Editor, DefaultConfig, meta = (DisplayName = "Unreal MCP"))
+class UNREALMCP_API UUnrealMCPSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UUnrealMCPSettings();
+
+	static const UUnrealMCPSettings* Get() { return GetDefault<UUnrealMCPSettings>(); }
+
+	/** TCP port the server listens on; the local socket is named after it */
+	UPROPERTY(Config, EditAnywhere, Category = "Server", meta = (ClampMin = "1", ClampMax = "65535", ConfigRestartRequired = true))
+	int32 ServerPort;
+
+	/** IPv4 address the server binds to; 0.0.0.0 accepts clients from other machines */
+	UPROPERTY(Config, EditAnywhere, Category = "Server", meta = (ConfigRestartRequired = true))
+	FString BindAddress;
+
+	/** Client connections served at once, each on a worker thread of its own, per listener */
+	UPROPERTY(Config, EditAnywhere, Category = "Server", meta = (ClampMin = "1", ClampMax = "256", ConfigRestartRequired = true))
+	int32 MaxConcurrentConnections;
+
+	/** Socket send and receive buffer size, and the size of each read, in KB; raise for large payloads */
+	UPROPERTY(Config, EditAnywhere, Category = "Server", meta = (ClampMin = "4", ClampMax = "16384", Units = "KB"))
+	int32 SocketBufferSizeKB;
+
+	/** Game-thread milliseconds per frame the command scheduler may spend running commands (mcp.FrameBudgetMs) */
+	UPROPERTY(Config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0.1", Units = "ms"))
+	float FrameBudgetMs;
+
+	/** Most commands in flight across all clients; 0 for no limit (mcp.MaxInFlightCommands) */
+	UPROPERTY(Config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0"))
+	int32 MaxInFlightCommands;
+
+	/** Most commands one client may have in flight; 0 for no limit (mcp.MaxInFlightCommandsPerClient) */
+	UPROPERTY(Config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "0"))
+	int32 MaxInFlightCommandsPerClient;
+
+	/** Thread-safe operations of one batch run on at most this many worker threads at once */
+	UPROPERTY(Config, EditAnywhere, Category = "Scheduling", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 MaxParallelBatchOperations;
+
+	/** Memory for cached responses of metadata commands, in MB, before the least recently used are evicted */
+	UPROPERTY(Config, EditAnywhere, Category = "Caches", meta = (ClampMin = "1", Units = "MB", ConfigRestartRequired = true))
+	int32 ResponseCacheSizeMB;
+
+	/** Estimated memory all budgeted caches together may hold, in MB, before their least recently used entries are evicted; 0 for no limit */
+	UPROPERTY(Config, EditAnywhere, Category = "Caches", meta = (ClampMin = "0", Units = "MB"))
+	int32 CacheMemoryBudgetMB;
+
+	/** @return SocketBufferSizeKB in bytes */
+	int32 GetSocketBufferSize() const { return FMath::Clamp(SocketBufferSizeKB, 4, 16384) * 1024; }
+
+	// UDeveloperSettings interface
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+
+	// UObject interface
+	virtual void PostInitProperties() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** Set the console variables the scheduling settings stand for */
+	void ApplyConsoleVariables() const;
+};
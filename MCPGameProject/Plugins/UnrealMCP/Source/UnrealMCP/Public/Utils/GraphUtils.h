@@ -95,6 +95,7 @@ public:
      * 2. Trace execution flow forward via exec pins
      * 3. For each exec-reachable node, trace data dependencies backward via data pins
      * 4. Any node not touched in steps 2-3 is orphaned
+     * The analysis is shared with the other orphan queries through FGraphReachabilityCache.
      *
      * @param Graph - Graph to analyze
      * @param OutOrphanedNodeIds - Array to receive IDs of orphaned nodes
@@ -105,12 +106,20 @@ public:
     /**
      * Get detailed information about orphaned nodes in a graph
      * @param Graph - Graph to analyze
-     * @param OutOrphanedNodes - Array to receive orphaned node info (ID, Title, Class)
+     * @param OutOrphanedNodes - Array to receive orphaned node info (ID, Title, Class, whether it is a dead pure chain)
      * @return true if analysis completed successfully
      */
     static bool GetOrphanedNodesInfo(UEdGraph* Graph, TArray<TSharedPtr<FJsonObject>>& OutOrphanedNodes);
 
-private:
+    /**
+     * Delete the orphaned nodes of a graph, breaking their links first
+     * @param Graph - Graph to clean up
+     * @param bKeepDefaultReturnNodes - Keep unlinked Return Nodes at (0,0), which the editor creates with a function
+     * @param OutDeletedTitles - Receives "Title [Graph]" of each deleted node
+     * @return Number of nodes deleted
+     */
+    static int32 DeleteOrphanedNodes(UEdGraph* Graph, bool bKeepDefaultReturnNodes, TArray<FString>& OutDeletedTitles);
+
     /**
      * Check if a node is an entry point (Event, FunctionEntry, CustomEvent)
      */
@@ -120,19 +129,4 @@ private:
      * Check if a node is pure (has no execution pins)
      */
     static bool IsPureNode(UEdGraphNode* Node);
-
-    /**
-     * Trace execution flow forward from entry points, marking reachable nodes
-     * @param EntryPoints - Starting nodes
-     * @param OutReachableNodes - Set to receive all nodes reachable via execution flow
-     */
-    static void TraceExecutionFlow(const TArray<UEdGraphNode*>& EntryPoints, TSet<UEdGraphNode*>& OutReachableNodes);
-
-    /**
-     * Trace data dependencies backward from a set of nodes
-     * For each node, follow input data pins to find connected pure nodes
-     * @param ExecReachableNodes - Nodes known to be on execution path
-     * @param OutDataDependencies - Set to receive nodes that are data dependencies
-     */
-    static void TraceDataDependencies(const TSet<UEdGraphNode*>& ExecReachableNodes, TSet<UEdGraphNode*>& OutDataDependencies);
 };
@@ -41,6 +41,31 @@ public:
      */
     static void GetFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<float>& OutArray);
 
+    /**
+     * Extract a packed float array from JSON object
+     * @param JsonObject - JSON object to read from
+     * @param FieldName - Name of the field, a number array or a base64 string of little-endian float32 values
+     * @param OutArray - Output array of floats
+     * @param OutError - Error message if the field is missing or malformed
+     * @return true if the field was read
+     */
+    static bool GetPackedFloatArrayFromJson(const TSharedPtr<FJsonObject>& JsonObject, const FString& FieldName, TArray<float>& OutArray, FString& OutError);
+
+    /**
+     * Create a packed float array JSON value
+     * @param Values - Floats to write
+     * @param bBase64 - Write a base64 string of little-endian float32 values instead of a number array
+     * @return JSON value holding the floats
+     */
+    static TSharedPtr<FJsonValue> CreatePackedFloatArrayValue(const TArray<float>& Values, bool bBase64);
+
+    /**
+     * Append a string as a quoted, escaped JSON string value, for responses assembled from text
+     * @param Out - Text to append to
+     * @param Value - String to write
+     */
+    static void AppendJsonString(FString& Out, FStringView Value);
+
     /**
      * Extract FVector2D from JSON object
      * @param JsonObject - JSON object to read from
@@ -90,7 +90,8 @@ public class UnrealMCP : ModuleRules
 				"NavigationSystem",        // For ANavMeshBoundsVolume
 				"AnimGraph",               // For Animation Blueprint nodes
 				"AnimationBlueprintLibrary", // For Animation Blueprint utilities
-				"GameplayTags"             // For FGameplayTag in animation variables
+				"GameplayTags",            // For FGameplayTag in animation variables
+				"HTTPServer"               // For the optional Prometheus /metrics endpoint
 			}
 		);
 		
@@ -123,6 +124,9 @@ public class UnrealMCP : ModuleRules
 			);
 		}
 		
+		// For reading gzip-compressed graph exports back (FBlueprintGraphDiff)
+		AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
@@ -9,7 +9,7 @@ animation layers, and animation variables.
 
 import asyncio
 import json
-from typing import Any, Dict, List
+from typing import Any, Dict, List, Optional
 
 from fastmcp import FastMCP
 
@@ -276,7 +276,8 @@ async def add_anim_transition(
     to_state: str,
     transition_rule_type: str = "CrossfadeBlend",
     blend_duration: float = 0.2,
-    condition_variable: str = ""
+    condition_variable: str = "",
+    negate_condition: bool = False
 ) -> Dict[str, Any]:
     """
     Add a transition between two states in a state machine.
@@ -291,12 +292,13 @@ async def add_anim_transition(
         to_state: Destination state name
         transition_rule_type: Type of transition rule:
             - "TimeRemaining": Transitions when animation time remaining is below threshold
-            - "BoolVariable": Transitions when a bool variable is true (requires manual graph setup)
+            - "BoolVariable": Transitions while condition_variable is true (false with negate_condition)
             - "CrossfadeBlend": Simple crossfade blend (default)
             - "Inertialization": Use inertialization for smoother state transitions
             - "Custom": Custom transition logic (requires manual setup)
         blend_duration: Duration of the blend transition in seconds (default: 0.2)
-        condition_variable: Variable name for bool-based transitions
+        condition_variable: Bool variable of the Animation Blueprint for bool-based transitions
+        negate_condition: Take a bool-based transition while the variable is false instead
 
     Returns:
         Dictionary containing:
@@ -317,10 +319,77 @@ async def add_anim_transition(
         params["blend_duration"] = blend_duration
     if condition_variable:
         params["condition_variable"] = condition_variable
+    if negate_condition:
+        params["negate_condition"] = True
 
     return await send_tcp_command("add_anim_transition", params)
 
 
+@app.tool()
+async def build_anim_state_machine_from_spec(
+    anim_blueprint_name: str,
+    state_machine_name: str,
+    states: List[Dict[str, Any]] = None,
+    transitions: List[Dict[str, Any]] = None,
+    entry_state: str = "",
+    connect_to_output_pose: bool = False,
+    compile: bool = True
+) -> Dict[str, Any]:
+    """
+    Build a whole state machine in one call: states, entry state, transitions and rules.
+
+    Everything is added in one undo transaction and the Animation Blueprint is compiled
+    once at the end, instead of once per add_anim_state/add_anim_transition call.
+    The state machine is created if it does not exist; states that already exist are
+    kept and can be used by transitions.
+
+    Args:
+        anim_blueprint_name: Name of the target Animation Blueprint
+        state_machine_name: Name of the state machine
+        states: States, each with the fields of add_anim_state:
+            {"state_name": "Idle", "animation_asset_path": "/Game/Anims/Idle",
+             "is_default_state": true, "node_position_x": 300, "node_position_y": 0}
+            States without a position are laid out in a row.
+        transitions: Transitions, each with the fields of add_anim_transition:
+            {"from_state": "Idle", "to_state": "Walk", "transition_rule_type": "BoolVariable",
+             "condition_variable": "bIsMoving", "negate_condition": false, "blend_duration": 0.2}
+        entry_state: State the entry node leads to (default: the first state marked is_default_state)
+        connect_to_output_pose: Connect the state machine's pose to the AnimGraph output pose
+        compile: Compile the Animation Blueprint once everything is added (default: True)
+
+    Returns:
+        Dictionary containing:
+        - success: Whether every element was added (and the blueprint compiled, if requested)
+        - state_machine_created: Whether the state machine was created
+        - entry_state: State the entry node leads to
+        - element_count / failed_count: Number of elements and failures
+        - elements: Per element {kind: state|entry|transition|output_pose, name, success, error}
+        - compiled / compile_error: Compile result, when compile is True
+
+    Example:
+        build_anim_state_machine_from_spec(
+            anim_blueprint_name="ABP_Hero",
+            state_machine_name="Locomotion",
+            states=[{"state_name": "Idle", "animation_asset_path": "/Game/Anims/Idle", "is_default_state": True},
+                    {"state_name": "Run", "animation_asset_path": "/Game/Anims/Run"}],
+            transitions=[{"from_state": "Idle", "to_state": "Run", "transition_rule_type": "BoolVariable", "condition_variable": "bIsMoving"},
+                         {"from_state": "Run", "to_state": "Idle", "transition_rule_type": "BoolVariable", "condition_variable": "bIsMoving", "negate_condition": True}],
+            connect_to_output_pose=True)
+    """
+    params = {
+        "anim_blueprint_name": anim_blueprint_name,
+        "state_machine_name": state_machine_name,
+        "states": states or [],
+        "transitions": transitions or [],
+        "connect_to_output_pose": connect_to_output_pose,
+        "compile": compile
+    }
+    if entry_state:
+        params["entry_state"] = entry_state
+
+    return await send_tcp_command("build_anim_state_machine_from_spec", params)
+
+
 # ============================================================================
 # Animation Variables
 # ============================================================================
@@ -219,9 +219,10 @@ def register_blueprint_action_tools(mcp: FastMCP):
     @mcp.tool()
     def inspect_node_pin_connection(
         ctx: Context,
-        node_name: str,
-        pin_name: str,
-        class_name: str = ""
+        node_name: str = "",
+        pin_name: str = "",
+        class_name: str = "",
+        queries: List[Dict[str, str]] = None
     ) -> Dict[str, Any]:
         """
         Inspect Blueprint node pin connection details including expected types and compatibility info.
@@ -230,6 +231,8 @@ def register_blueprint_action_tools(mcp: FastMCP):
             node_name: Name of the Blueprint node (e.g., "Create Widget", "Get Controller", "Map Add")
             pin_name: Name of the specific pin (e.g., "Owning Player", "Class", "TargetMap", "Key")
             class_name: Optional class name to disambiguate library functions (e.g., "BlueprintMapLibrary")
+            queries: Optional list of {"node_name", "pin_name", "class_name"} lookups to answer in one
+                request; use it instead of the single-pin arguments when inspecting many pins
 
         Returns:
             Dict containing:
@@ -247,6 +250,7 @@ def register_blueprint_action_tools(mcp: FastMCP):
                 - message: Status message
                 - available_pins: List of available pins if the node is known but pin is not found
                 - hint: Usage hints for special pins (wildcard, container operations)
+            With queries, a "results" list holding one such dict per query, plus found_count.
 
         Examples:
             # Inspect the Class pin on Create Widget node
@@ -268,8 +272,14 @@ def register_blueprint_action_tools(mcp: FastMCP):
                 pin_name="TargetArray",
                 class_name="KismetArrayLibrary"
             )
+
+            # Inspect several pins in one request
+            inspect_node_pin_connection(queries=[
+                {"node_name": "Map Add", "pin_name": "Key", "class_name": "BlueprintMapLibrary"},
+                {"node_name": "Map Add", "pin_name": "Value", "class_name": "BlueprintMapLibrary"}
+            ])
         """
-        return inspect_node_pin_connection_impl(ctx, node_name, pin_name, class_name)
+        return inspect_node_pin_connection_impl(ctx, node_name, pin_name, class_name, queries)
 
     @mcp.tool()
     def create_node_by_action_name(
@@ -532,6 +542,11 @@ def register_blueprint_action_tools(mcp: FastMCP):
         to find where a function is called, where a variable is used, or where
         an event is defined.
 
+        Node titles, referenced function/variable/event names, comments and pin
+        default values are searched. Results come from an index kept across
+        sessions, so only blueprints that changed or were never searched are
+        loaded.
+
         Args:
             search_query: Text to search for (function names, variable names, event names, etc.)
             search_type: Type of nodes to search. Options:
@@ -551,6 +566,9 @@ def register_blueprint_action_tools(mcp: FastMCP):
                 - search_query: The search query used
                 - search_type: The type filter applied
                 - blueprints_searched: Number of blueprints searched
+                - blueprints_loaded: Number of blueprints loaded because they were not indexed yet
+                - truncated: True if the search stopped at max_results; narrow the
+                  query or path, or raise max_results, to see more
                 - match_count: Number of matches found
                 - matches: Array of match objects with:
                     - blueprint_path: Full path to the blueprint
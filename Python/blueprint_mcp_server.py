@@ -58,7 +58,12 @@ async def create_blueprint(name: str, parent_class: str, folder_path: str = "")
 
 
 @app.tool()
-async def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
+async def compile_blueprint(
+    blueprint_name: str,
+    deferred: bool = False,
+    force: bool = False,
+    skeleton_only: bool = False
+) -> Dict[str, Any]:
     """
     Compile a Blueprint with enhanced error reporting.
 
@@ -70,17 +75,58 @@ async def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
 
     Args:
         blueprint_name: Name of the target Blueprint
+        deferred: Queue the compile instead of running it now. Repeated deferred
+            compiles of the same Blueprint share one compile, which runs at the end
+            of an execute_batch, after a short idle period, or when wait_for_compile
+            is called with the returned ticket.
+        force: Compile even if the Blueprint has not changed since its last compile.
+            Otherwise an unchanged, up-to-date Blueprint is not compiled again and the
+            last compile's status and warnings are returned with cached=True.
+        skeleton_only: Only regenerate the skeleton class, a quick check of variables,
+            components and function signatures after structural changes. Graphs are not
+            compiled, so a full compile is still needed before playing.
 
     Returns:
         Dictionary containing compilation results with detailed error information:
         - For successful compilation: success=True, compilation_time_seconds, status
         - For failed compilation: success=False, error message, compilation_errors array
         - For compilation with warnings: success=True, warnings array
+        - For deferred compilation: success=True, deferred=True, ticket
+        - cached=True when the Blueprint was unchanged and not compiled again
+        - skeleton_only=True for a skeleton-only compile
     """
     params = {"blueprint_name": blueprint_name}
+    if deferred:
+        params["deferred"] = True
+    if force:
+        params["force"] = True
+    if skeleton_only:
+        params["skeleton_only"] = True
     return await send_tcp_command("compile_blueprint", params)
 
 
+@app.tool()
+async def compile_blueprints(blueprint_names: List[str]) -> Dict[str, Any]:
+    """
+    Compile several Blueprints in one pass.
+
+    The Blueprints are ordered so that parents and other dependencies in the set
+    compile first, then compiled together with a single reinstancing step, which
+    is much faster than calling compile_blueprint for each one.
+
+    Args:
+        blueprint_names: Names or paths of the Blueprints to compile
+
+    Returns:
+        Dictionary containing:
+        - order: Blueprint names in the order they were compiled
+        - results: Per-Blueprint success, status, compilation_errors and warnings
+        - not_found: Names that did not resolve to a Blueprint
+        - total, succeeded, failed, compilation_time_seconds
+    """
+    return await send_tcp_command("compile_blueprints", {"blueprint_names": blueprint_names})
+
+
 @app.tool()
 async def add_blueprint_variable(
     blueprint_name: str,
@@ -125,6 +171,34 @@ async def delete_blueprint_variable(
     return await send_tcp_command("delete_blueprint_variable", params)
 
 
+@app.tool()
+async def get_blueprint_changes_since(
+    blueprint_name: str,
+    since_revision: int = 0
+) -> Dict[str, Any]:
+    """
+    List what changed in a Blueprint after a revision, instead of fetching its metadata again.
+
+    Nodes, graphs, variables and components that were added, removed or modified, by MCP
+    commands, editor edits or undo/redo. A Blueprint is tracked from its first modification or
+    first query; call once to get its revision, then pass that revision after your edits.
+
+    Args:
+        blueprint_name: Name or path of the Blueprint
+        since_revision: Revision you have seen (default 0: every retained change)
+
+    Returns:
+        Dictionary with "revision" (pass it as since_revision next time), "changes" (each with
+        revision, source, action, type, id, name, graph and changed) and "truncated" (older
+        changes were dropped; refetch the metadata)
+    """
+    params = {
+        "blueprint_name": blueprint_name,
+        "since_revision": since_revision
+    }
+    return await send_tcp_command("get_blueprint_changes_since", params)
+
+
 
 @app.tool()
 async def add_component_to_blueprint(
@@ -281,7 +355,11 @@ async def get_blueprint_metadata(
     node_type: str = None,
     event_type: str = None,
     detail_level: str = None,
-    component_name: str = None
+    component_name: str = None,
+    max_nodes: int = None,
+    cursor: str = None,
+    compact_pins: bool = None,
+    if_graph_hash: str = None
 ) -> Dict[str, Any]:
     """
     Get comprehensive metadata about a Blueprint with selective field querying.
@@ -295,7 +373,10 @@ async def get_blueprint_metadata(
 
     Args:
         blueprint_name: Name or path of the Blueprint
-        fields: List of metadata fields to retrieve. If None or ["*"], returns all.
+        fields: List of metadata fields to retrieve. ["*"] returns every section except the
+                expensive ones (component_properties, orphaned_nodes, graph_warnings, graph_nodes),
+                which are only built when named. "section.key" keeps only that key of the
+                section's entries, e.g. ["variables.name", "variables.type"].
                 Options:
                 - "parent_class": Parent class name and path
                 - "interfaces": Implemented interfaces and their functions
@@ -309,6 +390,7 @@ async def get_blueprint_metadata(
                 - "timelines": Timeline components
                 - "asset_info": Asset path, size, and modification date
                 - "orphaned_nodes": Detects disconnected nodes in all graphs
+                - "graph_warnings": Cast nodes with disconnected exec pins
                 - "graph_nodes": Detailed node info with pin connections and default values
         graph_name: Optional graph name filter for "graph_nodes" field.
                    When specified, only returns nodes from that specific graph.
@@ -323,9 +405,17 @@ async def get_blueprint_metadata(
                      - "full": Everything including all data pin connections and default values
         component_name: Required when using "component_properties" field. Specifies which
                        component to get properties for (e.g., "ProjectileMovement", "CollisionSphere").
+        max_nodes: Optional page size for "graph_nodes". Nodes come in node GUID order; when
+                  more remain, the section has has_more=true and a next_cursor.
+        cursor: next_cursor of the previous "graph_nodes" page, to get the next one.
+        compact_pins: Encode each "graph_nodes" pin as one string, e.g. "then->NodeId.execute"
+                     or "Value=5", instead of an object with linked node titles.
+        if_graph_hash: graph_hash of a "graph_nodes" response already held. If the graph is
+                      unchanged, it comes back with unchanged=true and no nodes.
 
     Returns:
-        Dictionary containing requested metadata fields
+        Dictionary containing requested metadata fields, plus "omitted_sections" when "*" left
+        expensive sections out and "unknown_fields" for fields naming no section
 
     Example:
         get_blueprint_metadata(blueprint_name="BP_MyActor", fields=["components"])
@@ -343,6 +433,14 @@ async def get_blueprint_metadata(
         params["detail_level"] = detail_level
     if component_name is not None:
         params["component_name"] = component_name
+    if max_nodes is not None:
+        params["max_nodes"] = max_nodes
+    if cursor is not None:
+        params["cursor"] = cursor
+    if compact_pins is not None:
+        params["compact_pins"] = compact_pins
+    if if_graph_hash is not None:
+        params["if_graph_hash"] = if_graph_hash
     return await send_tcp_command("get_blueprint_metadata", params)
 
 
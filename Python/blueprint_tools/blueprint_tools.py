@@ -10,6 +10,7 @@ from mcp.server.fastmcp import FastMCP, Context
 from utils.blueprints.blueprint_operations import (
     create_blueprint as create_blueprint_impl,
     add_component_to_blueprint as add_component_to_blueprint_impl,
+    add_blueprint_members_batch as add_blueprint_members_batch_impl,
     set_static_mesh_properties as set_static_mesh_properties_impl,
     set_component_property as set_component_property_impl,
     set_physics_properties as set_physics_properties_impl,
@@ -22,6 +23,7 @@ from utils.blueprints.blueprint_operations import (
     create_blueprint_interface as create_blueprint_interface_impl,
     create_custom_blueprint_function as create_custom_blueprint_function_impl,
     call_blueprint_function as call_blueprint_function_impl,
+    call_blueprint_function_batch as call_blueprint_function_batch_impl,
     get_blueprint_metadata as get_blueprint_metadata_impl,
     modify_blueprint_function_properties as modify_blueprint_function_properties_impl,
     capture_blueprint_graph_screenshot as capture_blueprint_graph_screenshot_impl,
@@ -214,6 +216,53 @@ def register_blueprint_tools(mcp: FastMCP):
             component_properties
         )
     
+    @mcp.tool()
+    def add_blueprint_members_batch(
+        ctx: Context,
+        blueprint_name: str,
+        components: List[Dict[str, Any]] = None,
+        variables: List[Dict[str, Any]] = None,
+        functions: List[Dict[str, Any]] = None,
+        all_or_nothing: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Add many components, variables and custom functions to one Blueprint in a single call.
+
+        Much faster than one add_component_to_blueprint, add_blueprint_variable or
+        create_custom_blueprint_function call per member: every addition is applied first and
+        the Blueprint's skeleton class is regenerated once, instead of once per member.
+        Components are added first, then variables, then functions.
+
+        Args:
+            blueprint_name: Name or path of the target Blueprint
+            components: Components, each with component_name, component_type and optionally
+                location, rotation, scale, parent_component_name, component_properties
+            variables: Variables, each with variable_name, variable_type and optionally is_exposed
+            functions: Functions, each with function_name and optionally inputs, outputs
+                (lists of {"name", "type"}), is_pure, category
+            all_or_nothing: Leave the Blueprint unchanged unless every addition succeeds
+
+        Returns:
+            Dict containing:
+            - components, variables, functions: Per-member entries with name, success, and error on failure
+            - succeeded, failed
+            - rolled_back: True if all_or_nothing undid the additions that had succeeded
+            - success: True if every addition was made
+
+        Examples:
+            add_blueprint_members_batch(
+                ctx,
+                blueprint_name="BP_Player",
+                components=[{"component_name": "Mesh", "component_type": "StaticMeshComponent"}],
+                variables=[
+                    {"variable_name": "Health", "variable_type": "Float", "is_exposed": True},
+                    {"variable_name": "Inventory", "variable_type": "String[]"}
+                ],
+                functions=[{"function_name": "TakeDamage", "inputs": [{"name": "Amount", "type": "Float"}]}]
+            )
+        """
+        return add_blueprint_members_batch_impl(ctx, blueprint_name, components, variables, functions, all_or_nothing)
+    
     @mcp.tool()
     def set_static_mesh_properties(
         ctx: Context,
@@ -366,18 +415,26 @@ def register_blueprint_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_blueprint(
         ctx: Context,
-        blueprint_name: str
+        blueprint_name: str,
+        force: bool = False,
+        skeleton_only: bool = False
     ) -> Dict[str, Any]:
         """
         Compile a Blueprint.
         
+        A Blueprint that is up to date and unchanged since its last compile is not
+        compiled again; its last status and warnings are returned with cached=True.
+        
         Args:
             blueprint_name: Name of the target Blueprint
+            force: Compile even if nothing changed since the last compile
+            skeleton_only: Only regenerate the skeleton class, to quickly check variables,
+                components and function signatures after structural changes
             
         Returns:
             Response indicating success or failure with detailed compilation messages
         """
-        result = compile_blueprint_impl(ctx, blueprint_name)
+        result = compile_blueprint_impl(ctx, blueprint_name, force, skeleton_only)
         return result
 
     @mcp.tool()
@@ -450,6 +507,51 @@ def register_blueprint_tools(mcp: FastMCP):
         """
         return call_blueprint_function_impl(ctx, target_name, function_name, string_params)
     
+    @mcp.tool()
+    def call_blueprint_function_batch(
+        ctx: Context,
+        function_name: str,
+        target_names: list = None,
+        tag: str = None,
+        class_name: str = None,
+        params: dict = None,
+        string_params: list = None,
+        world: str = "auto",
+        include_return_values: bool = False
+    ) -> dict:
+        """
+        Call one BlueprintCallable function on many actors in a single request.
+        
+        Targets are the union of target_names, the actors with tag and the actors of
+        class_name (subclasses included); an actor matched several ways is called once.
+        Parameters are converted once and passed to every call, which is much faster
+        than calling call_blueprint_function per actor.
+        
+        Args:
+            function_name: Name of the BlueprintCallable function
+            target_names: Actor names or labels
+            tag: Actor tag
+            class_name: Actor class name or path, e.g. "BP_Enemy_C"
+            params: Function parameters by name, e.g. {"Damage": 10}
+            string_params: String parameters in order, as call_blueprint_function takes them
+            world: "auto" (PIE while playing, else the editor world), "pie" or "editor"
+            include_return_values: Add each call's return value and output parameters
+            
+        Returns:
+            Dictionary with per-target results, missing_targets, called and failed counts
+            
+        Example:
+            call_blueprint_function_batch(
+                function_name="ApplyDamage",
+                class_name="BP_Enemy_C",
+                params={"Damage": 25.0},
+                world="pie"
+            )
+        """
+        return call_blueprint_function_batch_impl(
+            ctx, function_name, target_names, tag, class_name, params, string_params, world, include_return_values
+        )
+    
     @mcp.tool()
     def add_interface_to_blueprint(
         ctx: Context,
@@ -563,7 +665,11 @@ def register_blueprint_tools(mcp: FastMCP):
         graph_name: str = None,
         node_type: str = None,
         event_type: str = None,
-        detail_level: str = None
+        detail_level: str = None,
+        max_nodes: int = None,
+        cursor: str = None,
+        compact_pins: bool = None,
+        if_graph_hash: str = None
     ) -> Dict[str, Any]:
         """
         Get comprehensive metadata about a Blueprint with selective field querying.
@@ -574,18 +680,22 @@ def register_blueprint_tools(mcp: FastMCP):
         Args:
             blueprint_name: Name or path of the Blueprint
             fields: REQUIRED list of metadata fields to retrieve. At least one must be specified.
+                    "*" selects every section except orphaned_nodes, graph_warnings and graph_nodes,
+                    which are expensive and only built when named. "section.key" keeps only that
+                    key of the section's entries, e.g. ["variables.name", "variables.type"].
                     Options:
                     - "parent_class": Parent class name and path
                     - "interfaces": Implemented interfaces and their functions
                     - "variables": Blueprint variables with types and default values
                     - "functions": Custom Blueprint functions
                     - "components": All components with names and types
-                    - "graphs": Event graphs and function graphs (names and node counts only)
+                    - "graphs": Event graphs and function graphs (names, node counts and graph_hash)
                     - "status": Compilation status and error state
                     - "metadata": Asset metadata and tags
                     - "timelines": Timeline components
                     - "asset_info": Asset path, size, and modification date
                     - "orphaned_nodes": Detects disconnected nodes in all graphs
+                    - "graph_warnings": Cast nodes with disconnected exec pins
                     - "graph_nodes": Detailed node info (REQUIRES graph_name parameter)
             graph_name: REQUIRED when using "graph_nodes" field. Specifies which graph to query.
                        Use fields=["graphs"] first to discover available graph names.
@@ -598,6 +708,14 @@ def register_blueprint_tools(mcp: FastMCP):
                          - "flow": Node IDs, titles, and exec pin connections only (DEFAULT)
                          - "full": Everything including all data pin connections and default values
 
+            max_nodes: Optional page size for "graph_nodes". Nodes come in node GUID order; when
+                      more remain, the section has has_more=true and a next_cursor.
+            cursor: next_cursor of the previous "graph_nodes" page, to get the next one.
+            compact_pins: Encode each "graph_nodes" pin as one string, e.g. "then->NodeId.execute"
+                         or "Value=5", instead of an object with linked node titles.
+            if_graph_hash: graph_hash of a "graph_nodes" response already held. If the graph is
+                          unchanged, it comes back with unchanged=true and no nodes.
+
         Returns:
             Dictionary containing requested metadata fields
 
@@ -660,7 +778,8 @@ def register_blueprint_tools(mcp: FastMCP):
                 event_type="BeginPlay"
             )
         """
-        return get_blueprint_metadata_impl(ctx, blueprint_name, fields, graph_name, node_type, event_type, detail_level)
+        return get_blueprint_metadata_impl(ctx, blueprint_name, fields, graph_name, node_type, event_type, detail_level,
+                                           max_nodes, cursor, compact_pins, if_graph_hash)
 
     @mcp.tool()
     def modify_blueprint_function_properties(
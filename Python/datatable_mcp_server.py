@@ -42,15 +42,19 @@ if __name__ == "__main__":
         description="Table containing all game items"
     )
 
-- **get_datatable_rows(datatable_path, row_names=None)**
+- **get_datatable_rows(datatable_path, row_names=None, offset=0, limit=0, fields=None, filters=None)**
   
-  Get rows from a DataTable.
+  Get rows from a DataTable, optionally one page at a time.
   
   Args:
     - datatable_path (str): Path to the target DataTable
     - row_names (list, optional): List of specific row names to retrieve
+    - offset (int, optional): Matching rows to skip before the page
+    - limit (int, optional): Most rows to return; 0 returns every matching row
+    - fields (list, optional): Field names to return per row
+    - filters (list, optional): {"field", "op", "value"} predicates a row must all pass
   
-  Returns: Dict containing the requested rows.
+  Returns: Dict containing the requested rows; metadata.next_offset is set while more rows match.
 
 
 - **get_datatable_row_names(datatable_path)**
@@ -122,6 +126,61 @@ if __name__ == "__main__":
         }]
     )
 
+- **upsert_datatable_rows(datatable_path, rows)**
+  
+  Add rows that do not exist and update only the changed fields of the ones that do.
+  
+  Args:
+    - datatable_path (str): Path to the target DataTable
+    - rows (list): List of dicts, each with 'row_name' and 'row_data'
+  
+  Returns: Dict containing added/updated/failed rows and added, updated, unchanged and changed field counts.
+
+- **get_datatable_fingerprint(datatable_path, include_rows=False, known_root="")**
+  
+  Get a Merkle root over the row content hashes of a DataTable, and optionally each row's hash.
+  
+  Args:
+    - datatable_path (str): Path to the target DataTable
+    - include_rows (bool): Also return each row's hash
+    - known_root (str): Root from an earlier call; when it matches, changed is false and rows are left out
+  
+  Returns: Dict containing root_hash, row_count, cached, changed and optionally rows.
+
+- **get_composite_datatable_stack(datatable_path, row_names=None, offset=0, limit=0)**
+  
+  Inspect the parent tables of a composite DataTable and which parent each row comes from.
+  
+  Args:
+    - datatable_path (str): Path to the composite DataTable
+    - row_names (list, optional): Rows to describe
+    - offset (int): Rows skipped before the page
+    - limit (int): Most rows returned; 0 for no limit
+  
+  Returns: Dict containing parents, rows with source_table and overridden_tables, and paging fields.
+
+- **get_curve_table_rows(curve_table_path, row_names=None, offset=0, limit=0)**
+  
+  Read CurveTable rows as packed times and values arrays.
+  
+  Args:
+    - curve_table_path (str): Path to the target CurveTable
+    - row_names (list, optional): Rows to read
+    - offset (int): Rows skipped before the page
+    - limit (int): Most rows returned; 0 for no limit
+  
+  Returns: Dict containing curve_table_mode, rows and paging fields.
+
+- **write_curve_table_rows(curve_table_path, rows)**
+  
+  Replace the keys of CurveTable rows, adding rows that do not exist.
+  
+  Args:
+    - curve_table_path (str): Path to the target CurveTable
+    - rows (list): List of dicts with 'row_name', 'times', 'values' and optional 'interp_mode'
+  
+  Returns: Dict containing added/updated/failed rows and counts.
+
 - **delete_datatable_rows(datatable_path, row_names)**
   
   Delete multiple rows from a DataTable.
@@ -131,4 +190,27 @@ if __name__ == "__main__":
     - row_names (list): List of row names to delete
   
   Returns: Dict containing success status and updated DataTable info.
+
+- **import_datatable_from_file(datatable_path, file_path, format="", max_reported_failures=100)**
+  
+  Import rows from a CSV or JSON Lines file on disk, streamed by the editor.
+  
+  Args:
+    - datatable_path (str): Path to the target DataTable
+    - file_path (str): File to import, absolute or relative to the project directory
+    - format (str): "csv" or "jsonl"; empty picks by file extension
+    - max_reported_failures (int): Most failed rows listed in the response
+  
+  Returns: Dict containing counts, unknown columns and the first failed rows, not the imported rows.
+
+- **export_datatable_to_file(datatable_path, file_path, fields=None)**
+  
+  Export a DataTable to a packed column file on disk, written from the row memory.
+  
+  Args:
+    - datatable_path (str): Path to the source DataTable
+    - file_path (str): File to write, absolute or relative to the project directory
+    - fields (list, optional): Field names to export; all fields if omitted
+  
+  Returns: Dict containing row and column counts, the column types and the file size.
 """ 
\ No newline at end of file
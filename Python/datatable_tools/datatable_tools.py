@@ -11,7 +11,14 @@ from utils.datatable.datatable_utils import (
     get_datatable_row_names_impl,
     add_rows_to_datatable_impl,
     update_rows_in_datatable_impl,
-    delete_datatable_rows_impl
+    delete_datatable_rows_impl,
+    import_datatable_from_file_impl,
+    export_datatable_to_file_impl,
+    upsert_datatable_rows_impl,
+    get_datatable_fingerprint_impl,
+    get_composite_datatable_stack_impl,
+    get_curve_table_rows_impl,
+    write_curve_table_rows_impl
 )
 
 def register_datatable_tools(mcp: 'FastMCP'):
@@ -70,18 +77,29 @@ def register_datatable_tools(mcp: 'FastMCP'):
     @mcp.tool()
     def get_datatable_rows(
         datatable_path: str,
-        row_names: Optional[List[str]] = None
+        row_names: List[str] = None,
+        offset: int = 0,
+        limit: int = 0,
+        fields: List[str] = None,
+        filters: List[Dict[str, Any]] = None
     ) -> Dict[str, Any]:
-        """Get rows from a DataTable.
+        """Get rows from a DataTable, optionally one page at a time.
         
         Args:
             datatable_path: Path to the target DataTable
             row_names: Optional list of specific row names to retrieve
+            offset: Matching rows to skip before the page
+            limit: Most rows to return; 0 returns every matching row
+            fields: Optional list of field names to return per row; all fields if omitted
+            filters: Optional predicates a row must all pass, each
+                {"field": name, "op": "eq"|"ne"|"lt"|"le"|"gt"|"ge"|"contains", "value": v};
+                "row_name" as the field tests the row name
             
         Returns:
-            Dict containing the requested rows
+            Dict containing the requested rows; metadata has total_rows, matched_count,
+            has_more and, when more rows match, next_offset for the next call
         """
-        return get_datatable_rows_impl(datatable_path, row_names)
+        return get_datatable_rows_impl(datatable_path, row_names, offset, limit, fields, filters)
     
 
     
@@ -103,7 +121,8 @@ def register_datatable_tools(mcp: 'FastMCP'):
     @mcp.tool()
     def add_rows_to_datatable(
         datatable_path: str,
-        rows: list[dict]
+        rows: list[dict],
+        bulk: bool = False
     ) -> Dict[str, Any]:
         """Add multiple rows to an existing DataTable.
         Args:
@@ -115,6 +134,10 @@ def register_datatable_tools(mcp: 'FastMCP'):
                 - 'row_data': Dict of property values using the internal GUID-based property names
                              You must first call get_datatable_row_names() to get the correct
                              property names, as they include auto-generated GUIDs.
+            bulk: Use the bulk import path for large batches (thousands of rows). Field names
+                  are mapped once per row struct, rows are written directly into the table and
+                  nothing is logged per row. Fields a row omits keep the struct defaults, and a
+                  row whose name already exists is replaced. Default: False
         Returns:
             Dict containing success status and list of added row names
 
@@ -138,7 +161,7 @@ def register_datatable_tools(mcp: 'FastMCP'):
                 }]
             )
         """
-        return add_rows_to_datatable_impl(datatable_path, rows)
+        return add_rows_to_datatable_impl(datatable_path, rows, bulk)
     
     @mcp.tool()
     def update_rows_in_datatable(
@@ -180,6 +203,120 @@ def register_datatable_tools(mcp: 'FastMCP'):
         """
         return update_rows_in_datatable_impl(datatable_path, rows)
     
+    @mcp.tool()
+    def upsert_datatable_rows(
+        datatable_path: str,
+        rows: list[dict]
+    ) -> Dict[str, Any]:
+        """Add or update rows in a DataTable, writing only the fields that changed.
+        
+        Rows that do not exist are added; for existing rows, fields left out of row_data keep
+        their current values and only fields whose value differs are written. The table is
+        saved and refreshed once, and not at all if nothing changed, so syncing a table from an
+        external source is one call instead of get + delete + add.
+        
+        Args:
+            datatable_path: Path to the target DataTable
+            rows: List of dicts, each with:
+                - 'row_name': Name of the row to add or update
+                - 'row_data': Dict of field values (GUID-based or friendly names)
+        Returns:
+            Dict containing added_rows, updated_rows, failed_rows and metadata with
+            added_count, updated_count, unchanged_count, failed_count and changed_field_count
+        """
+        return upsert_datatable_rows_impl(datatable_path, rows)
+    
+    @mcp.tool()
+    def get_datatable_fingerprint(
+        datatable_path: str,
+        include_rows: bool = False,
+        known_root: str = ""
+    ) -> Dict[str, Any]:
+        """Get a content hash of a DataTable and optionally of each row, for change detection.
+        
+        The root hash is a Merkle root over the row hashes in row order, so equal roots mean
+        equal tables. Hashes are kept until the table is modified, so polling an unchanged table
+        is cheap.
+        
+        Args:
+            datatable_path: Path to the target DataTable
+            include_rows: Also return each row's hash, to find which rows changed
+            known_root: Root hash from an earlier call; when it still matches, "changed" is false
+                and no row hashes are returned
+        Returns:
+            Dict containing root_hash, row_count, cached, changed (when known_root is given) and,
+            with include_rows, rows as [{row_name, hash}]
+        """
+        return get_datatable_fingerprint_impl(datatable_path, include_rows, known_root)
+    
+    @mcp.tool()
+    def get_composite_datatable_stack(
+        datatable_path: str,
+        row_names: List[str] = None,
+        offset: int = 0,
+        limit: int = 0
+    ) -> Dict[str, Any]:
+        """Inspect the parent tables of a composite DataTable and where each row comes from.
+        
+        Parents are listed in merge order; a later parent overrides the rows of earlier ones.
+        
+        Args:
+            datatable_path: Path to the composite DataTable
+            row_names: Optional list of rows to describe; omit for every row
+            offset: Rows skipped before the returned page
+            limit: Most rows returned; 0 returns every row
+        Returns:
+            Dict containing parents as [{index, path, row_struct, row_count, is_composite}], rows as
+            [{row_name, source_table, source_index, overridden_tables}], overridden_count and
+            total_rows, matched_count, has_more and next_offset for paging
+        """
+        return get_composite_datatable_stack_impl(datatable_path, row_names, offset, limit)
+    
+    @mcp.tool()
+    def get_curve_table_rows(
+        curve_table_path: str,
+        row_names: List[str] = None,
+        offset: int = 0,
+        limit: int = 0
+    ) -> Dict[str, Any]:
+        """Read CurveTable rows as packed key arrays, one page at a time.
+        
+        Args:
+            curve_table_path: Path to the target CurveTable
+            row_names: Optional list of rows to read; omit for every row
+            offset: Rows skipped before the returned page
+            limit: Most rows returned; 0 returns every row
+        Returns:
+            Dict containing curve_table_mode ("simple" or "rich"), rows as
+            [{row_name, interp_mode, times, values}] and total_rows, has_more and next_offset
+        """
+        return get_curve_table_rows_impl(curve_table_path, row_names, offset, limit)
+    
+    @mcp.tool()
+    def write_curve_table_rows(
+        curve_table_path: str,
+        rows: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """Replace the keys of CurveTable rows, adding rows that do not exist.
+        
+        Args:
+            curve_table_path: Path to the target CurveTable
+            rows: List of dicts, each with:
+                - row_name: Name of the row
+                - times: Key times
+                - values: Key values, one per time
+                - interp_mode: Optional "linear", "constant" or "cubic"
+        Returns:
+            Dict containing added_rows, updated_rows, failed_rows and counts in metadata
+            
+        Example:
+            write_curve_table_rows(
+                curve_table_path="/Game/Data/CT_Scaling",
+                rows=[{"row_name": "Damage", "times": [1, 10, 20], "values": [5.0, 40.0, 95.0]}]
+            )
+        """
+        return write_curve_table_rows_impl(curve_table_path, rows)
+    
     @mcp.tool()
     def delete_datatable_rows(
         datatable_path: str,
@@ -192,4 +329,55 @@ def register_datatable_tools(mcp: 'FastMCP'):
         Returns:
             Dict containing success status and updated DataTable info
         """
-        return delete_datatable_rows_impl(datatable_path, row_names) 
\ No newline at end of file
+        return delete_datatable_rows_impl(datatable_path, row_names)
+    
+    @mcp.tool()
+    def import_datatable_from_file(
+        datatable_path: str,
+        file_path: str,
+        format: str = "",
+        max_reported_failures: int = 100
+    ) -> Dict[str, Any]:
+        """Import rows into a DataTable from a CSV or JSON Lines file on disk.
+        
+        The editor streams the file itself, so large tables never pass through the socket.
+        Rows whose name already exists are replaced; fields a row leaves out keep the struct defaults.
+        
+        Args:
+            datatable_path: Path to the target DataTable
+            file_path: File to import, absolute or relative to the project directory
+            format: "csv" or "jsonl"; empty picks by extension (.json/.jsonl/.ndjson are JSON Lines)
+                - csv: first line is the header; the "Name", "row_name" or "---" column (else the
+                  first column) holds row names, other columns are field names (GUID or friendly)
+                  and cells use Unreal property text, as in the editor's CSV import
+                - jsonl: one object per line, {"row_name": ..., "row_data": {...}} or the fields
+                  themselves with a "row_name" or "Name" field
+            max_reported_failures: Most failed rows listed in the response (default: 100)
+        Returns:
+            Dict containing records_read, imported_count, failed_count, failures (line, row_name,
+            error), failures_truncated, unknown_columns (csv), bytes_read, file_size and
+            elapsed_seconds. The imported rows themselves are not returned.
+        """
+        return import_datatable_from_file_impl(datatable_path, file_path, format, max_reported_failures)
+
+    @mcp.tool()
+    def export_datatable_to_file(
+        datatable_path: str,
+        file_path: str,
+        fields: List[str] = None
+    ) -> Dict[str, Any]:
+        """Export a whole DataTable to a packed column file on disk, for analytics and diffing.
+        
+        The editor writes the rows from memory without converting them to JSON. The file holds
+        a "row_name" column and one column per field: numeric and bool fields as raw
+        little-endian values aligned to 8 bytes, everything else as UTF-8 text with offsets.
+        
+        Args:
+            datatable_path: Path to the source DataTable
+            file_path: File to write, absolute or relative to the project directory; replaced if it exists
+            fields: Optional list of field names to export; all fields if omitted
+        Returns:
+            Dict containing row_count, column_count, columns (name, type), file_size and
+            elapsed_seconds. The rows themselves are not returned.
+        """
+        return export_datatable_to_file_impl(datatable_path, file_path, fields)
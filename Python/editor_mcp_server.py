@@ -72,6 +72,7 @@ See tool docstrings for full argument details, or use get_mcp_help(tool_name="..
 """
 from mcp.server.fastmcp import FastMCP
 from editor_tools.editor_tools import register_editor_tools
+from editor_tools.metrics_tools import register_metrics_tools
 
 mcp = FastMCP(
     "editorMCP",
@@ -79,6 +80,7 @@ mcp = FastMCP(
 )
 
 register_editor_tools(mcp)
+register_metrics_tools(mcp)
 
 if __name__ == "__main__":
     mcp.run(transport='stdio') 
\ No newline at end of file
@@ -19,7 +19,14 @@ from utils.editor.editor_operations import (
     spawn_blueprint_actor as spawn_blueprint_actor_impl,
     get_level_metadata as get_level_metadata_impl,
     batch_delete_actors as batch_delete_actors_impl,
-    batch_spawn_actors as batch_spawn_actors_impl
+    batch_spawn_actors as batch_spawn_actors_impl,
+    convert_actors_to_instances as convert_actors_to_instances_impl,
+    set_actor_transforms_batch as set_actor_transforms_batch_impl,
+    set_actor_properties_batch as set_actor_properties_batch_impl,
+    execute_batch as execute_batch_impl,
+    wait_for_compile as wait_for_compile_impl,
+    flush_saves as flush_saves_impl,
+    get_level_changes as get_level_changes_impl
 )
 from utils.mcp_help import get_help_registry, get_mcp_help as get_mcp_help_impl
 
@@ -427,7 +434,14 @@ def register_editor_tools(mcp: FastMCP):
     def get_level_metadata(
         ctx: Context,
         fields: List[str] = None,
-        actor_filter: str = None
+        actor_filter: str = None,
+        spatial: Dict[str, Any] = None,
+        class_filter: str = None,
+        tag_filter: str = None,
+        folder_filter: str = None,
+        actor_fields: List[str] = None,
+        limit: int = 0,
+        cursor: str = None
     ) -> Dict[str, Any]:
         """
         Get level metadata with selective field querying.
@@ -440,6 +454,24 @@ def register_editor_tools(mcp: FastMCP):
                 - "*": All available fields
             actor_filter: Optional pattern for actor name filtering (supports wildcards *)
                          When provided, only actors matching the pattern are returned.
+            spatial: Optional region; only actors whose bounds overlap it are returned. Answered
+                from a spatial index, so it is much cheaper than listing every actor. One of:
+                - {"shape": "box", "min": [X, Y, Z], "max": [X, Y, Z]}
+                - {"shape": "sphere", "center": [X, Y, Z], "radius": R}
+                - {"shape": "frustum", "origin": [X, Y, Z], "rotation": [Pitch, Yaw, Roll],
+                   "fov": 90, "aspect_ratio": 1.777, "near_distance": 10, "far_distance": 10000}
+                - {"shape": "nearest", "point": [X, Y, Z], "count": 5, "max_distance": 0}
+                  (0 = unlimited); actors come nearest first with a "distance" to their bounds
+            class_filter: Optional actor class (spawn_actor type such as "PointLight", or a class
+                name such as "BP_Door_C"); subclasses match too
+            tag_filter: Optional actor tag
+            folder_filter: Optional outliner folder (e.g. "Lighting/Interior"); subfolders match too
+            actor_fields: Per-actor fields to return, from name, class, location, rotation, scale,
+                label, path, folder, tags (default: name, class, location, rotation, scale).
+                Ask for ["name", "class"] on large maps to keep responses small
+            limit: Maximum number of actors to return (default 0 = all). With a limit, actors are
+                ordered by path and the result has "total", "has_more" and "next_cursor"
+            cursor: "next_cursor" of the previous page, to fetch the next one
 
         Returns:
             Dictionary with requested level metadata
@@ -456,8 +488,23 @@ def register_editor_tools(mcp: FastMCP):
 
             # Get all actors with "Player" in the name
             get_level_metadata(fields=["actors"], actor_filter="Player*")
+
+            # Lights within 1000 units of the origin
+            get_level_metadata(actor_filter="*Light*",
+                               spatial={"shape": "sphere", "center": [0, 0, 0], "radius": 1000})
+
+            # The 3 actors closest to a point
+            get_level_metadata(spatial={"shape": "nearest", "point": [500, 200, 0], "count": 3})
+
+            # Page through every static mesh actor, names only
+            page = get_level_metadata(class_filter="StaticMeshActor", actor_fields=["name"], limit=500)
+            page = get_level_metadata(class_filter="StaticMeshActor", actor_fields=["name"], limit=500,
+                                      cursor=page["actors"]["next_cursor"])
         """
-        return get_level_metadata_impl(ctx, fields, actor_filter)
+        return get_level_metadata_impl(
+            ctx, fields, actor_filter, spatial, class_filter, tag_filter, folder_filter,
+            actor_fields, limit, cursor
+        )
 
     @mcp.tool()
     def get_mcp_help(
@@ -505,16 +552,19 @@ def register_editor_tools(mcp: FastMCP):
         return get_mcp_help_impl(tool_name, include_full_docstring)
 
     @mcp.tool()
-    def delete_actors(ctx: Context, names: List[str]) -> Dict[str, Any]:
+    def delete_actors(ctx: Context, names: List[str], collect_garbage: bool = False) -> Dict[str, Any]:
         """
         Delete multiple actors by name in a single operation.
 
         This is more efficient than calling delete_actor() multiple times,
         especially for large batch operations like clearing test actors or
-        resetting level sections.
+        resetting level sections. All actors are deleted in one editor call
+        and one undo transaction.
 
         Args:
             names: List of actor names to delete
+            collect_garbage: Free the deleted actors' memory with one garbage
+                collection on the next editor tick (default False)
 
         Returns:
             Dict containing:
@@ -538,10 +588,17 @@ def register_editor_tools(mcp: FastMCP):
             result = delete_actors(names=arena_actors)
             print(f"Deleted {result['succeeded']} of {result['total']} actors")
         """
-        return batch_delete_actors_impl(ctx, names)
+        return batch_delete_actors_impl(ctx, names, collect_garbage)
 
     @mcp.tool()
-    def spawn_actors(ctx: Context, actors: List[Dict[str, Any]]) -> Dict[str, Any]:
+    def spawn_actors(
+        ctx: Context,
+        actors: List[Dict[str, Any]],
+        deferred: bool = False,
+        include_details: bool = False,
+        instancing: str = "",
+        instanced_actor_name: str = ""
+    ) -> Dict[str, Any]:
         """
         Spawn multiple actors in a single operation.
 
@@ -569,10 +626,19 @@ def register_editor_tools(mcp: FastMCP):
                 - player_start_tag: (PlayerStart) Tag for spawn selection
                 - decal_size: (DecalActor) [X,Y,Z] dimensions
                 - decal_material: (DecalActor) Material path
+            deferred: Spawn every actor with deferred construction inside one undo transaction and
+                refresh the viewport and outliner once at the end; use for layouts of thousands of actors
+            include_details: Return full actor details per result instead of only the actor path
+                (default: False)
+            instancing: "ism" or "hism" to place every StaticMeshActor config with a mesh_path as an
+                instance on one actor (one instanced component per mesh) instead of one actor each;
+                other configs spawn normally. Use for many copies of the same mesh (rocks, props)
+            instanced_actor_name: Name of the actor holding the instances (default "InstancedMeshes")
 
         Returns:
             Dict containing:
-            - results: Array of per-actor results with name, success, actor details, or error
+            - results: Array of per-actor results with name, success, actor details (or path), or error;
+              instanced configs report instanced_in, component and instance_index instead
             - total: Total number of actors processed
             - succeeded: Number of successfully spawned actors
             - failed: Number of failed spawns
@@ -624,7 +690,255 @@ def register_editor_tools(mcp: FastMCP):
                 {"name": "Portal2", "type": "Blueprint:/Game/Actors/BP_Portal", "location": [1000, 0, 0]}
             ])
         """
-        return batch_spawn_actors_impl(ctx, actors)
+        return batch_spawn_actors_impl(ctx, actors, deferred, include_details, instancing, instanced_actor_name)
+
+    @mcp.tool()
+    def convert_actors_to_instances(
+        ctx: Context,
+        actor_names: List[str],
+        instanced_actor_name: str = "",
+        hierarchical: bool = True,
+        delete_source_actors: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Replace StaticMeshActors with instances on a single actor.
+
+        Actors sharing a mesh and materials become instances of one instanced static
+        mesh component, which renders them in far fewer draw calls. The conversion
+        and the deletion of the source actors are one undo step.
+
+        Args:
+            actor_names: Names of the StaticMeshActors to convert; others are skipped
+            instanced_actor_name: Name of the new actor (default "InstancedMeshes")
+            hierarchical: Use HierarchicalInstancedStaticMeshComponents (HISM), which cull
+                and LOD per cluster; False uses plain InstancedStaticMeshComponents (ISM)
+            delete_source_actors: Delete the converted actors (default True)
+
+        Returns:
+            Dict containing:
+            - instanced_actor: Details of the new actor
+            - converted: Names of the converted actors
+            - skipped: "<name>: <reason>" for each actor that was not converted
+            - source_actors_deleted: Whether the converted actors were deleted
+            - success: Overall operation success
+
+        Examples:
+            rocks = [f"Rock{i}" for i in range(200)]
+            convert_actors_to_instances(actor_names=rocks, instanced_actor_name="Rocks")
+        """
+        return convert_actors_to_instances_impl(
+            ctx, actor_names, instanced_actor_name, hierarchical, delete_source_actors
+        )
+
+    @mcp.tool()
+    def set_actor_transforms_batch(
+        ctx: Context,
+        updates: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Move, rotate or scale many actors in one operation.
+
+        Much faster than calling set_actor_transform() per actor when re-laying-out
+        or animating hundreds of actors: every move is one undo step, each actor gets
+        one move notification and the viewports redraw once at the end.
+
+        Args:
+            updates: List of updates, each a dict with:
+                - name: Actor name (required)
+                - location: [X, Y, Z] world location (optional)
+                - rotation: [Pitch, Yaw, Roll] in degrees (optional)
+                - scale: [X, Y, Z] scale (optional)
+                Each update must set at least one of location, rotation or scale.
+
+        Returns:
+            Dict containing:
+            - results: List of {name, success, error?} per update
+            - total, succeeded, failed: Counts
+            - success: Overall operation success
+
+        Examples:
+            set_actor_transforms_batch(updates=[
+                {"name": f"Pillar{i}", "location": [i * 300, 0, 0]} for i in range(100)
+            ])
+        """
+        return set_actor_transforms_batch_impl(ctx, updates)
+
+    @mcp.tool()
+    def set_actor_properties_batch(
+        ctx: Context,
+        updates: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Set properties on many actors in one operation.
+
+        All changes are one undo step and each actor gets one change notification
+        (so construction scripts rerun once per actor), however many of its
+        properties change.
+
+        Args:
+            updates: List of updates, each a dict with:
+                - name: Actor name (required)
+                - properties: Dict of property name to value (required), using the
+                  same values as set_actor_property()
+
+        Returns:
+            Dict containing:
+            - results: List of {name, success, error?} per update; properties that
+              were set stay set when another property of the same actor fails
+            - total, succeeded, failed: Counts
+            - success: Overall operation success
+
+        Examples:
+            set_actor_properties_batch(updates=[
+                {"name": "Lamp1", "properties": {"bHidden": True}},
+                {"name": "Lamp2", "properties": {"bHidden": True, "Tags": ["Broken"]}}
+            ])
+        """
+        return set_actor_properties_batch_impl(ctx, updates)
+
+    @mcp.tool()
+    def execute_batch(
+        ctx: Context,
+        operations: List[Dict[str, Any]],
+        stop_on_failure: bool = False,
+        rollback_on_failure: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Run several MCP commands in one request instead of one round trip each.
+
+        Any registered command can be batched (except execute_batch itself). The
+        whole batch runs in one visit to the editor's game thread, so building a
+        Blueprint graph node by node takes a single call.
+
+        Results of earlier operations can be fed into later ones: a string
+        parameter "$<id>.<field>" is replaced by that field of the operation's
+        result, keeping its type ("$<id>" alone is the whole result, array
+        elements are addressed by index, e.g. "$spawn.results.0.name"). An
+        operation automatically waits for every operation it references. Start a
+        string with "$$" to pass a literal "$".
+
+        Operations run in list order unless a dependency forces otherwise; one
+        whose dependency failed is skipped. Consecutive read-only queries (e.g.
+        asset searches) run concurrently.
+
+        Args:
+            operations: List of operations. Each dict contains:
+                - id: Operation id for references (optional, default "op<index>")
+                - command: Command name, e.g. "add_blueprint_event_node" (required)
+                - params: Command parameters (optional)
+                - depends_on: Ids of operations that must succeed first (optional)
+            stop_on_failure: Skip every remaining operation once one fails
+            rollback_on_failure: If any operation fails or is skipped, undo the
+                whole batch as one editor undo step
+
+        Returns:
+            Dict containing:
+            - results: Per-operation entries in list order with id, success, and
+              result or error (skipped operations also have skipped=true)
+            - total, succeeded, failed, skipped: Operation counts
+            - rolled_back: True if the batch was undone because of a failure
+            - success: True if the batch was accepted and run
+
+        Examples:
+            # Add two nodes and wire them together in one call
+            execute_batch(operations=[
+                {"id": "begin", "command": "add_blueprint_event_node",
+                 "params": {"blueprint_name": "BP_Door", "event_type": "ReceiveBeginPlay"}},
+                {"id": "print", "command": "add_blueprint_function_node",
+                 "params": {"blueprint_name": "BP_Door", "class_name": "KismetSystemLibrary",
+                            "function_name": "PrintString"}},
+                {"command": "connect_blueprint_nodes",
+                 "params": {"blueprint_name": "BP_Door", "connections": [
+                     {"source_node_id": "$begin.node_id", "source_pin": "then",
+                      "target_node_id": "$print.node_id", "target_pin": "execute"}]}},
+                {"command": "compile_blueprint", "params": {"blueprint_name": "BP_Door"}}
+            ])
+        """
+        return execute_batch_impl(ctx, operations, stop_on_failure, rollback_on_failure)
+
+    @mcp.tool()
+    def wait_for_compile(
+        ctx: Context,
+        tickets: List[int],
+        wait: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Get the results of deferred compiles.
+
+        Compile commands (compile_blueprint, compile_material, compile_state_tree,
+        compile_niagara_asset, compile_metasound, compile_sound_cue) accept
+        "deferred": true. They then queue the compile and return a ticket, and
+        repeated requests for the same asset share one compile. Queued compiles
+        run at the end of an execute_batch or after a short idle period.
+
+        Args:
+            tickets: Tickets returned by deferred compile commands
+            wait: Compile tickets that are still queued now (default) instead of
+                only reporting that they are pending
+
+        Returns:
+            Dict containing:
+            - tickets: Per-ticket entries with ticket, state ("finished", "pending"
+              or "unknown") and, once finished, the compile command's result
+            - pending_compiles: Number of compiles still queued
+            - success: True if the command ran
+
+        Examples:
+            # Queue compiles while editing, then collect them once
+            first = compile_blueprint(blueprint_name="BP_Door", deferred=True)
+            ...
+            wait_for_compile(tickets=[first["ticket"]])
+        """
+        return wait_for_compile_impl(ctx, tickets, wait)
+
+    @mcp.tool()
+    def flush_saves(ctx: Context) -> Dict[str, Any]:
+        """
+        Write all asset saves that MCP commands have queued.
+
+        Commands that modify assets (DataTable rows, StateTree, Niagara, sound and
+        widget edits) queue their package saves and write them together shortly
+        after the last edit or at the end of an execute_batch. Call this to make
+        sure everything is on disk right now, e.g. before source control operations.
+
+        Returns:
+            Dict containing:
+            - saved: Number of packages written
+            - failed_packages: Packages that could not be saved
+            - success: True if every queued package was saved
+        """
+        return flush_saves_impl(ctx)
+
+    @mcp.tool()
+    def get_level_changes(ctx: Context, min_interval_ms: int = 250) -> Dict[str, Any]:
+        """
+        Get the actors added, moved/relabeled and removed in the level since the last call.
+
+        Instead of polling get_level_metadata to notice what the user changed, the
+        first call subscribes to change events the editor pushes over a dedicated
+        connection; later calls return what accumulated in between, already merged
+        per actor. No request is sent to the editor after the first call.
+
+        Args:
+            min_interval_ms: Shortest time between two events pushed by the editor
+                (50-60000, default 250); only used by the call that subscribes
+
+        Returns:
+            Dict containing:
+            - resync: True when the changes are incomplete (first call, undo/redo,
+              map change, lost connection); re-read the level with get_level_metadata
+            - added: Actors added, with name, label, class, location, rotation, scale
+            - updated: Actors moved or relabeled, with the same fields
+            - removed: Names of removed actors
+            - events: Number of editor events merged into this result
+
+        Examples:
+            # Take a baseline, then follow the user's edits
+            get_level_changes()
+            level = get_level_metadata(fields=["actors"])
+            changes = get_level_changes()
+        """
+        return get_level_changes_impl(ctx, min_interval_ms)
 
     @mcp.tool()
     def delete_asset(ctx: Context, asset_path: str) -> Dict[str, Any]:
@@ -0,0 +1,144 @@
+"""
+Metrics Tools for Unreal MCP.
+
+This module provides tools for measuring the MCP server in the editor: latency metrics,
+cache statistics, and recording and replaying request sessions.
+"""
+
+import logging
+from typing import Dict, Any
+from mcp.server.fastmcp import FastMCP, Context
+from utils.editor.editor_operations import (
+    get_mcp_metrics as get_mcp_metrics_impl,
+    get_cache_stats as get_cache_stats_impl,
+    record_requests as record_requests_impl,
+    replay_requests as replay_requests_impl
+)
+
+# Get logger
+logger = logging.getLogger("UnrealMCP")
+
+def register_metrics_tools(mcp: FastMCP):
+    """Register metrics tools with the MCP server."""
+
+    @mcp.tool()
+    def get_mcp_metrics(
+        ctx: Context,
+        command: str = "",
+        format: str = "json",
+        reset: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Get latency percentiles and counters of the MCP server, per command.
+
+        Every request records how long it waited to run (queue_wait), ran (execute),
+        took to serialize (serialize) and took to send (send), plus request, error,
+        response cache hit and byte counts. Use it to find which commands are slow
+        and in which stage. Setting the mcp.MetricsPort console variable at editor
+        startup also serves the Prometheus text at http://localhost:<port>/metrics.
+
+        Args:
+            command: Only report this command (JSON format only)
+            format: "json" (default) or "prometheus" for the text exposition format
+            reset: Drop everything recorded after reporting it, to measure a fresh window
+
+        Returns:
+            Dict containing:
+            - uptime_seconds: Time since the metrics started or were last reset
+            - memory: Editor physical memory use and, when the editor runs with -llm,
+              bytes tracked under each UnrealMCP LLM tag (llm_tags)
+            - commands: Per-command entries, busiest first, with requests, errors,
+              cache_hits, send_failures, bytes_received, bytes_sent, stages
+              (count, mean_ms, p50_ms, p90_ms, p99_ms, max_ms per stage) and memory
+              (net_bytes, growth_bytes, growths, max_growth_bytes of physical memory
+              while the command ran), to find commands that make memory grow
+            - text: The Prometheus text, for format="prometheus"
+            - success: True if the metrics were read
+        """
+        return get_mcp_metrics_impl(ctx, command, format, reset)
+
+    @mcp.tool()
+    def get_cache_stats(ctx: Context, name: str = "", reset: bool = False, trim: bool = False) -> Dict[str, Any]:
+        """
+        Get hit, miss and invalidation counts of every cache, object pool and index in the editor.
+
+        Use it to see whether a cache is worth its memory or is invalidated too often:
+        a low hit_ratio on a busy source means it is rebuilt or missed on most lookups.
+
+        Args:
+            name: Only report sources whose name contains this, e.g. "pool" or "blueprint"
+            reset: Reset the reported sources' counters after reporting them
+            trim: Evict every entry of the memory-budgeted caches first
+
+        Returns:
+            Dict containing:
+            - sources: Per-source entries sorted by name, with name, kind ("cache", "pool"
+              or "index"), hits, misses, requests, hit_ratio and, where the source tracks
+              them, invalidations, entries and source-specific details
+            - totals: hits, misses, requests and hit_ratio over the reported sources
+            - memory_budget: budget_bytes, used_bytes, evicted_entries, evicted_bytes,
+              trims and the estimated bytes of each budgeted cache
+            - reset_sources: Number of sources reset, when reset is True
+            - success: True if the statistics were read
+        """
+        return get_cache_stats_impl(ctx, name, reset, trim)
+
+    @mcp.tool()
+    def record_requests(ctx: Context, action: str = "status", path: str = "") -> Dict[str, Any]:
+        """
+        Record the requests the editor receives, to replay them later with replay_requests.
+
+        Each request is written with its connection, its time and its parameters, so a
+        session can be replayed to measure a change against the same workload. Requests
+        from replays are not recorded. Setting mcp.RecordRequests at editor startup
+        records from the start.
+
+        Args:
+            action: "start", "stop" or "status" (default)
+            path: File to record to, for "start"; defaults to a timestamped file in
+                Saved/UnrealMCP/Recordings
+
+        Returns:
+            Dict containing:
+            - recording: True while a recording is running
+            - path: File being (or last) recorded to
+            - requests: Number of requests recorded
+            - elapsed_seconds: Time since the recording started
+            - success: True if the action succeeded
+        """
+        return record_requests_impl(ctx, action, path)
+
+    @mcp.tool()
+    def replay_requests(
+        ctx: Context,
+        action: str = "status",
+        path: str = "",
+        speed: float = 1.0,
+        max_requests: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Replay a recording made by record_requests through the editor, in the background.
+
+        Requests keep their recorded pacing (scaled by speed) and each connection's
+        requests are sent in order, one after the previous one's response. Poll with
+        action="status" until state is "finished", then compare get_mcp_metrics with
+        the recorded session's (reset the metrics before starting).
+
+        Args:
+            action: "start", "stop" or "status" (default)
+            path: Recording to replay, for "start"
+            speed: Pace relative to the recording, e.g. 2 for twice as fast; 0 for as
+                fast as possible
+            max_requests: Replay at most this many requests; 0 (default) for all
+
+        Returns:
+            Dict containing:
+            - state: "idle", "running", "finished" or "stopped"
+            - requests_total, requests_sent, responses, errors, busy: Progress counts
+            - recorded_seconds, elapsed_seconds: Recorded and replayed durations
+            - latency: count, mean_ms, p50_ms, p90_ms, p99_ms, max_ms of replayed requests
+            - success: True if the action succeeded
+        """
+        return replay_requests_impl(ctx, action, path, speed, max_requests)
+
+    logger.info("Metrics tools registered successfully")
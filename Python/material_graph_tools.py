@@ -0,0 +1,512 @@
+"""
+Material graph tools for the Material MCP Server.
+Includes: expression metadata and editing, graph builds, compilation, edit sessions
+and palette search.
+"""
+
+from typing import Any, Awaitable, Callable, Dict, List
+
+
+def register_material_graph_tools(app, send: Callable[[str, Dict[str, Any]], Awaitable[Dict[str, Any]]]):
+    """Register the material graph tools on the server's app; send delivers a command to Unreal."""
+
+    # ============================================================================
+    # Material Expression Tools
+    # ============================================================================
+
+    @app.tool()
+    async def get_material_graph_metadata(
+        material_path: str,
+        fields: List[str] = None
+    ) -> Dict[str, Any]:
+        """
+        Get comprehensive metadata about a material's expression graph.
+
+        Retrieves all expressions, connections, material outputs, orphan nodes, and
+        data flow paths from a base Material (not Material Instance). Essential for
+        understanding material structure before modifying expressions.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            fields: Optional list to filter which fields to return. Available fields:
+                - "expressions": All expression nodes with id, type, position, inputs, outputs
+                - "connections": All connections between expressions
+                - "material_outputs": Which expressions connect to BaseColor, Emissive, etc.
+                - "orphans": Expressions with no connected outputs (cleanup candidates)
+                - "flow": Traced data flow from sources to material outputs
+
+        Returns:
+            Dictionary containing:
+            - success: Whether retrieval was successful
+            - expressions: Array of expression objects with:
+                - expression_id: GUID for the expression
+                - expression_type: Type name (e.g., "Constant", "Multiply", "TextureSample")
+                - position: [X, Y] position in graph
+                - description: Human-readable description
+                - inputs: Array of input pins
+                - outputs: Array of output pins with connections
+            - connections: Array of connection objects
+            - material_outputs: Object mapping property names to connected expressions
+            - orphans: Array of expressions with unused outputs
+            - flow: Traced paths from sources to outputs
+
+        Example:
+            # Get full graph metadata
+            get_material_graph_metadata(material_path="/Game/VFX/Fireball/M_FireballProjectile_v2")
+
+            # Get only expressions and outputs
+            get_material_graph_metadata(
+                material_path="/Game/Materials/M_Crystal",
+                fields=["expressions", "material_outputs"]
+            )
+        """
+        params = {"material_path": material_path}
+        if fields:
+            params["fields"] = fields
+
+        return await send("get_material_expression_metadata", params)
+
+
+    @app.tool()
+    async def set_material_expression_property(
+        material_path: str,
+        expression_id: str,
+        property_name: str,
+        property_value: str
+    ) -> Dict[str, Any]:
+        """
+        Set a property on an existing material expression node.
+
+        Allows modifying properties of expressions already in a material graph,
+        such as changing the texture on a TextureSample node or the value of a Constant.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            expression_id: GUID of the expression to modify (from get_material_graph_metadata)
+            property_name: Name of the property to set. Common properties:
+                - For TextureSample: "Texture" (texture path)
+                - For Constant: "R" (float value)
+                - For Constant3Vector: "Constant" (color as "R,G,B")
+                - For Constant4Vector: "Constant" (color as "R,G,B,A")
+                - For TextureCoordinate: "UTiling", "VTiling"
+                - For ScalarParameter: "DefaultValue", "ParameterName"
+            property_value: Value to set (as string, number, or path depending on property type)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the property was set successfully
+            - property_name: Name of the property that was modified
+            - message: Success/error message
+
+        Example:
+            # Change texture on a TextureSample node
+            set_material_expression_property(
+                material_path="/Game/VFX/Fireball/M_FireballProjectile_v2",
+                expression_id="A1B2C3D4E5F6G7H8I9J0K1L2M3N4O5P6",
+                property_name="Texture",
+                property_value="/Game/VFX/Fireball/T_Fireball_density"
+            )
+
+            # Change a constant value
+            set_material_expression_property(
+                material_path="/Game/Materials/M_Glow",
+                expression_id="X1Y2Z3...",
+                property_name="R",
+                property_value=2.5
+            )
+        """
+        params = {
+            "material_path": material_path,
+            "expression_id": expression_id,
+            "property_name": property_name,
+            "property_value": property_value
+        }
+
+        return await send("set_material_expression_property", params)
+
+
+    @app.tool()
+    async def add_material_expression(
+        material_path: str,
+        expression_type: str,
+        position: List[int] = None,
+        properties: dict = None
+    ) -> Dict[str, Any]:
+        """
+        Add a material expression node to a material graph.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            expression_type: Type of expression (e.g., "Constant", "Multiply", "ParticleColor",
+                            "RadialGradientExponential", "VertexColor", "TextureCoordinate")
+            position: [X, Y] position in the graph (optional)
+            properties: Dictionary of expression properties (optional)
+
+        Returns:
+            Dictionary with expression_id, name, and other info
+
+        Example:
+            add_material_expression(
+                material_path="/Game/Materials/M_Ember",
+                expression_type="Constant",
+                properties={"R": 1.0}
+            )
+        """
+        params = {
+            "material_path": material_path,
+            "expression_type": expression_type
+        }
+        if position:
+            params["position"] = position
+        if properties:
+            params["properties"] = properties
+
+        return await send("add_material_expression", params)
+
+
+    @app.tool()
+    async def build_material_graph(
+        material_path: str,
+        expressions: List[Dict[str, Any]],
+        connections: List[Dict[str, Any]] = None,
+        outputs: List[Dict[str, Any]] = None,
+        auto_layout: bool = True,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build a whole material graph in one call: create the expressions, wire them, bind them to
+        the material outputs, lay them out and compile once.
+
+        Much faster than add_material_expression/connect_material_expressions per node. If any part
+        of the spec is invalid, nothing is added to the material.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            expressions: Expressions to create, each {"id", "expression_type", "position" (optional [X, Y]),
+                         "properties" (optional)}; "id" is any name unique within the spec
+            connections: Wires between expressions, each {"source_id", "source_output_index" (default 0),
+                         "target_id", "target_input_name"}; ids are spec ids or GUIDs of existing expressions
+            outputs: Material output bindings, each {"source_id", "output_index" (default 0), "material_property"}
+            auto_layout: Place expressions without a position in columns by distance from the outputs
+            compile: Compile the material once the graph is built (deferred inside an edit session)
+
+        Returns:
+            Dictionary with expression_ids (spec id -> expression GUID), expression_count,
+            connection_count, output_count, compiled and the compile_material result under "compile"
+
+        Example:
+            build_material_graph(
+                material_path="/Game/Materials/M_Ember",
+                expressions=[
+                    {"id": "color", "expression_type": "Constant3Vector", "properties": {"constant": [1, 0.3, 0]}},
+                    {"id": "strength", "expression_type": "Constant", "properties": {"R": 5.0}},
+                    {"id": "mul", "expression_type": "Multiply"}
+                ],
+                connections=[
+                    {"source_id": "color", "target_id": "mul", "target_input_name": "A"},
+                    {"source_id": "strength", "target_id": "mul", "target_input_name": "B"}
+                ],
+                outputs=[{"source_id": "mul", "material_property": "EmissiveColor"}]
+            )
+        """
+        params = {
+            "material_path": material_path,
+            "expressions": expressions,
+            "connections": connections or [],
+            "outputs": outputs or [],
+            "auto_layout": auto_layout,
+            "compile": compile
+        }
+
+        return await send("build_material_graph", params)
+
+
+    @app.tool()
+    async def connect_material_expressions(
+        material_path: str,
+        source_expression_id: str,
+        target_expression_id: str,
+        target_input_name: str,
+        source_output_index: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Connect two material expressions.
+
+        Args:
+            material_path: Path to the material
+            source_expression_id: GUID of the source expression
+            target_expression_id: GUID of the target expression
+            target_input_name: Name of the input on the target (e.g., "A", "B", "Base")
+            source_output_index: Output index on source (default 0)
+
+        Returns:
+            Success/error message
+        """
+        params = {
+            "material_path": material_path,
+            "source_expression_id": source_expression_id,
+            "target_expression_id": target_expression_id,
+            "target_input_name": target_input_name,
+            "source_output_index": source_output_index
+        }
+
+        return await send("connect_material_expressions", params)
+
+
+    @app.tool()
+    async def connect_expression_to_material_output(
+        material_path: str,
+        expression_id: str,
+        material_property: str,
+        output_index: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Connect a material expression to a material output (EmissiveColor, Opacity, etc.).
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            expression_id: GUID of the source expression
+            material_property: Target material property - one of:
+                - "BaseColor": Surface color
+                - "Metallic": Metallic value
+                - "Specular": Specular value
+                - "Roughness": Roughness value
+                - "Normal": Normal map
+                - "EmissiveColor": Emissive/glow color
+                - "Opacity": Opacity for translucent materials
+                - "OpacityMask": Opacity mask for masked materials
+                - "WorldPositionOffset": Vertex offset
+                - "AmbientOcclusion": AO value
+                - "Refraction": Refraction for translucent materials
+                - "SubsurfaceColor": Subsurface scattering color
+            output_index: Output index on source expression (default 0)
+
+        Returns:
+            Success/error message with connected property
+
+        Example:
+            connect_expression_to_material_output(
+                material_path="/Game/Materials/M_Ember",
+                expression_id="43E2F0AD4A059DB305340EAB5A873C46",
+                material_property="EmissiveColor"
+            )
+        """
+        params = {
+            "material_path": material_path,
+            "expression_id": expression_id,
+            "material_property": material_property,
+            "output_index": output_index
+        }
+
+        return await send("connect_expression_to_material_output", params)
+
+
+    # ============================================================================
+    # Compilation and Edit Sessions
+    # ============================================================================
+
+    @app.tool()
+    async def compile_material(
+        material_path: str,
+        async_compile: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Compile a material to apply changes and trigger shader recompilation.
+
+        Use this after creating a material with usage flags (like used_with_niagara_sprites)
+        to ensure shaders are compiled with the correct permutations.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            async_compile: Return a job_id at once instead of waiting for the result; poll
+                           get_material_compile_status until its status is "finished"
+
+        Returns:
+            Dictionary containing:
+            - success: Whether compilation was successful
+            - compile_errors / expression_errors: Shader errors, and the expressions that raised them
+            - message: Success/error message
+            - job_id, status: Instead of the above when async_compile is set
+
+        Example:
+            compile_material(material_path="/Game/Materials/M_FireEmber")
+        """
+        params = {"material_path": material_path}
+        if async_compile:
+            params["async"] = True
+        return await send("compile_material", params)
+
+
+    @app.tool()
+    async def get_material_compile_status(
+        job_id: int
+    ) -> Dict[str, Any]:
+        """
+        Poll a material compile started with compile_material(async_compile=True).
+
+        Args:
+            job_id: Job id returned by compile_material
+
+        Returns:
+            Dictionary containing:
+            - status: "compiling" or "finished"
+            - elapsed_seconds: Time since the compile started
+            - compiling_resources, outstanding_shader_jobs: While compiling (the job count is editor-wide)
+            - success, compile_errors, expression_errors: Once finished
+
+        Example:
+            get_material_compile_status(job_id=12)
+        """
+        params = {"job_id": job_id}
+        return await send("get_material_compile_status", params)
+
+
+    @app.tool()
+    async def begin_material_edit_session(
+        material_path: str
+    ) -> Dict[str, Any]:
+        """
+        Start a batch of expression edits on a material without recompiling after each one.
+
+        Until the session ends, delete_material_expression and set_material_expression_property
+        only update the graph; the shader recompile and the save happen once, when
+        end_material_edit_session is called (or compile_material, which recompiles but leaves
+        the save to the session end). A session left idle for mcp.MaterialEditSessionIdleSeconds
+        (300 by default) ends on its own.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the session was opened
+            - material_path: The material the session is for
+
+        Example:
+            begin_material_edit_session(material_path="/Game/Materials/M_FireEmber")
+        """
+        params = {"material_path": material_path}
+        return await send("begin_material_edit_session", params)
+
+
+    @app.tool()
+    async def end_material_edit_session(
+        material_path: str
+    ) -> Dict[str, Any]:
+        """
+        End a material edit session, recompiling and saving the material once for all its edits.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the session ended cleanly
+            - recompiled: Whether the material was recompiled
+            - deferred_edits: Number of edits made since the session began (or since the last compile_material)
+            - saved: Whether the material package was saved
+            - The compile_material validation fields when the material was recompiled
+
+        Example:
+            end_material_edit_session(material_path="/Game/Materials/M_FireEmber")
+        """
+        params = {"material_path": material_path}
+        return await send("end_material_edit_session", params)
+
+
+    @app.tool()
+    async def delete_material_expression(
+        material_path: str,
+        expression_id: str
+    ) -> Dict[str, Any]:
+        """
+        Delete a material expression from a material graph.
+
+        Use this to remove orphan expressions or clean up unused nodes from materials.
+
+        Args:
+            material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
+            expression_id: GUID of the expression to delete
+
+        Returns:
+            Dictionary containing:
+            - success: Whether deletion was successful
+            - message: Success/error message
+
+        Example:
+            delete_material_expression(
+                material_path="/Game/Materials/M_Ember",
+                expression_id="E880D7F146304B1CC5ECF2AA1697DF33"
+            )
+        """
+        params = {
+            "material_path": material_path,
+            "expression_id": expression_id
+        }
+
+        return await send("delete_material_expression", params)
+
+
+    # ============================================================================
+    # Material Palette Search
+    # ============================================================================
+
+    @app.tool()
+    async def search_material_palette(
+        search_query: str = "",
+        category_filter: str = "",
+        type_filter: str = "All",
+        max_results: int = 50,
+        offset: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Search the Material Palette for expressions and functions.
+
+        Searches an in-editor palette of expression classes and library material
+        functions, kept current as assets change. Results are ranked, best match first.
+
+        Args:
+            search_query: Text to search in names (case-insensitive). Leave empty to list all.
+            category_filter: Filter by category name (e.g., "Math", "Texture", "Utility")
+            type_filter: Filter by type - "Expression", "Function", or "All" (default)
+            max_results: Maximum results to return (default: 50)
+            offset: Number of ranked results to skip, for paging (default: 0)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether search was successful
+            - results: Array of items with:
+                - type: "Expression" or "Function"
+                - name: Display name
+                - category: Category name(s)
+                - class_name: For expressions, the UClass name (use for add_material_expression)
+                - path: For functions, the asset path (use for MaterialFunctionCall)
+                - description: Tooltip/description if available
+            - total_count: Total results before limit
+            - returned_count: Number of results returned
+            - offset: Offset of the first returned result
+            - has_more: Whether results follow this page
+            - categories: List of available categories
+
+        Examples:
+            # Search for radial gradient related nodes
+            search_material_palette(search_query="radial")
+
+            # List all texture-related expressions
+            search_material_palette(category_filter="Texture", type_filter="Expression")
+
+            # Find all available material functions
+            search_material_palette(type_filter="Function", max_results=100)
+
+            # List all categories (empty search, low limit)
+            search_material_palette(max_results=1)
+        """
+        params = {
+            "search_query": search_query,
+            "category_filter": category_filter,
+            "type_filter": type_filter,
+            "max_results": max_results,
+            "offset": offset
+        }
+
+        return await send("search_material_palette", params)
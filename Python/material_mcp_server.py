@@ -10,6 +10,8 @@ from typing import Any, Dict, List
 
 from fastmcp import FastMCP
 
+from material_graph_tools import register_material_graph_tools
+
 # Initialize FastMCP app
 app = FastMCP("Material MCP Server")
 
@@ -375,22 +377,36 @@ async def set_material_texture_param(
 
 @app.tool()
 async def batch_set_material_params(
-    material_instance: str,
+    material_instance: str = None,
     scalar_params: dict = None,
     vector_params: dict = None,
-    texture_params: dict = None
+    texture_params: dict = None,
+    material_instances: List[str] = None,
+    folder: str = None,
+    parent_material: str = None,
+    recursive: bool = True,
+    save: bool = True
 ) -> Dict[str, Any]:
     """
-    Set multiple parameters on a Material Instance in a single operation.
+    Set multiple parameters on one or many Material Instances in a single operation.
 
     This is more efficient than setting parameters one at a time when
     configuring multiple values. All parameter types can be mixed in one call.
 
+    To update many instances, pass material_instances and/or folder / parent_material instead
+    of material_instance. Each instance then gets one update for all its parameters, and the
+    saves are written together at the end.
+
     Args:
-        material_instance: Path or name of the Material Instance
+        material_instance: Path or name of a single Material Instance
         scalar_params: Dictionary of scalar parameters {"ParamName": 0.5, ...}
         vector_params: Dictionary of vector parameters {"ParamName": [R, G, B, A], ...}
         texture_params: Dictionary of texture parameters {"ParamName": "/Game/Textures/T_Name", ...}
+        material_instances: Paths of the instances to update
+        folder: Update the Material Instance Constants in this content folder
+        parent_material: Only instances derived from this material, directly or through other instances
+        recursive: Include subfolders of folder
+        save: Save the updated instances (many-instance form only)
 
     Returns:
         Dictionary containing:
@@ -398,6 +414,8 @@ async def batch_set_material_params(
         - material_instance: Name of the Material Instance
         - results: Object with scalar, vector, texture arrays showing what was set
         - message: Success/error message
+        Many-instance form: instance_count, updated_count, saved, and results as a list of
+        {material_instance, success, scalar, vector, texture, missing, error}
 
     Example:
         batch_set_material_params(
@@ -406,17 +424,31 @@ async def batch_set_material_params(
             vector_params={"BaseColor": [0.8, 0.0, 0.0, 1.0], "EmissiveColor": [1.0, 0.3, 0.0, 1.0]},
             texture_params={"NormalMap": "/Game/Textures/T_Crystal_N"}
         )
+        batch_set_material_params(
+            folder="/Game/Environment/Materials",
+            parent_material="/Game/Environment/Materials/M_Rock_Master",
+            scalar_params={"Roughness": 0.7}
+        )
     """
-    params = {
-        "material_instance": material_instance
-    }
-    # Convert dict to JSON string for C++ side (which expects JSON strings)
+    params = {}
+    if material_instance:
+        params["material_instance"] = material_instance
+    if material_instances:
+        params["material_instances"] = material_instances
+    if folder:
+        params["folder"] = folder
+    if parent_material:
+        params["parent_material"] = parent_material
+    if folder or parent_material:
+        params["recursive"] = recursive
+    if material_instances or folder or parent_material:
+        params["save"] = save
     if scalar_params:
-        params["scalar_params"] = json.dumps(scalar_params) if isinstance(scalar_params, dict) else scalar_params
+        params["scalar_params"] = scalar_params
     if vector_params:
-        params["vector_params"] = json.dumps(vector_params) if isinstance(vector_params, dict) else vector_params
+        params["vector_params"] = vector_params
     if texture_params:
-        params["texture_params"] = json.dumps(texture_params) if isinstance(texture_params, dict) else texture_params
+        params["texture_params"] = texture_params
 
     return await send_tcp_command("batch_set_material_params", params)
 
@@ -490,356 +522,12 @@ async def get_material_parameters(
     return await send_tcp_command("get_material_parameters", params)
 
 
-# ============================================================================
-# Material Expression Tools
-# ============================================================================
-
-@app.tool()
-async def get_material_graph_metadata(
-    material_path: str,
-    fields: List[str] = None
-) -> Dict[str, Any]:
-    """
-    Get comprehensive metadata about a material's expression graph.
-
-    Retrieves all expressions, connections, material outputs, orphan nodes, and
-    data flow paths from a base Material (not Material Instance). Essential for
-    understanding material structure before modifying expressions.
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-        fields: Optional list to filter which fields to return. Available fields:
-            - "expressions": All expression nodes with id, type, position, inputs, outputs
-            - "connections": All connections between expressions
-            - "material_outputs": Which expressions connect to BaseColor, Emissive, etc.
-            - "orphans": Expressions with no connected outputs (cleanup candidates)
-            - "flow": Traced data flow from sources to material outputs
-
-    Returns:
-        Dictionary containing:
-        - success: Whether retrieval was successful
-        - expressions: Array of expression objects with:
-            - expression_id: GUID for the expression
-            - expression_type: Type name (e.g., "Constant", "Multiply", "TextureSample")
-            - position: [X, Y] position in graph
-            - description: Human-readable description
-            - inputs: Array of input pins
-            - outputs: Array of output pins with connections
-        - connections: Array of connection objects
-        - material_outputs: Object mapping property names to connected expressions
-        - orphans: Array of expressions with unused outputs
-        - flow: Traced paths from sources to outputs
-
-    Example:
-        # Get full graph metadata
-        get_material_graph_metadata(material_path="/Game/VFX/Fireball/M_FireballProjectile_v2")
-
-        # Get only expressions and outputs
-        get_material_graph_metadata(
-            material_path="/Game/Materials/M_Crystal",
-            fields=["expressions", "material_outputs"]
-        )
-    """
-    params = {"material_path": material_path}
-    if fields:
-        params["fields"] = fields
-
-    return await send_tcp_command("get_material_expression_metadata", params)
-
-
-@app.tool()
-async def set_material_expression_property(
-    material_path: str,
-    expression_id: str,
-    property_name: str,
-    property_value: str
-) -> Dict[str, Any]:
-    """
-    Set a property on an existing material expression node.
-
-    Allows modifying properties of expressions already in a material graph,
-    such as changing the texture on a TextureSample node or the value of a Constant.
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-        expression_id: GUID of the expression to modify (from get_material_graph_metadata)
-        property_name: Name of the property to set. Common properties:
-            - For TextureSample: "Texture" (texture path)
-            - For Constant: "R" (float value)
-            - For Constant3Vector: "Constant" (color as "R,G,B")
-            - For Constant4Vector: "Constant" (color as "R,G,B,A")
-            - For TextureCoordinate: "UTiling", "VTiling"
-            - For ScalarParameter: "DefaultValue", "ParameterName"
-        property_value: Value to set (as string, number, or path depending on property type)
-
-    Returns:
-        Dictionary containing:
-        - success: Whether the property was set successfully
-        - property_name: Name of the property that was modified
-        - message: Success/error message
-
-    Example:
-        # Change texture on a TextureSample node
-        set_material_expression_property(
-            material_path="/Game/VFX/Fireball/M_FireballProjectile_v2",
-            expression_id="A1B2C3D4E5F6G7H8I9J0K1L2M3N4O5P6",
-            property_name="Texture",
-            property_value="/Game/VFX/Fireball/T_Fireball_density"
-        )
-
-        # Change a constant value
-        set_material_expression_property(
-            material_path="/Game/Materials/M_Glow",
-            expression_id="X1Y2Z3...",
-            property_name="R",
-            property_value=2.5
-        )
-    """
-    params = {
-        "material_path": material_path,
-        "expression_id": expression_id,
-        "property_name": property_name,
-        "property_value": property_value
-    }
-
-    return await send_tcp_command("set_material_expression_property", params)
-
-
-@app.tool()
-async def add_material_expression(
-    material_path: str,
-    expression_type: str,
-    position: List[int] = None,
-    properties: dict = None
-) -> Dict[str, Any]:
-    """
-    Add a material expression node to a material graph.
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-        expression_type: Type of expression (e.g., "Constant", "Multiply", "ParticleColor",
-                        "RadialGradientExponential", "VertexColor", "TextureCoordinate")
-        position: [X, Y] position in the graph (optional)
-        properties: Dictionary of expression properties (optional)
-
-    Returns:
-        Dictionary with expression_id, name, and other info
-
-    Example:
-        add_material_expression(
-            material_path="/Game/Materials/M_Ember",
-            expression_type="Constant",
-            properties={"R": 1.0}
-        )
-    """
-    params = {
-        "material_path": material_path,
-        "expression_type": expression_type
-    }
-    if position:
-        params["position"] = position
-    if properties:
-        params["properties"] = properties
-
-    return await send_tcp_command("add_material_expression", params)
-
-
-@app.tool()
-async def connect_material_expressions(
-    material_path: str,
-    source_expression_id: str,
-    target_expression_id: str,
-    target_input_name: str,
-    source_output_index: int = 0
-) -> Dict[str, Any]:
-    """
-    Connect two material expressions.
+async def _send_command(command_type: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    # Looks send_tcp_command up on every call, so the gateway's shared connection applies to these tools too
+    return await send_tcp_command(command_type, params)
 
-    Args:
-        material_path: Path to the material
-        source_expression_id: GUID of the source expression
-        target_expression_id: GUID of the target expression
-        target_input_name: Name of the input on the target (e.g., "A", "B", "Base")
-        source_output_index: Output index on source (default 0)
-
-    Returns:
-        Success/error message
-    """
-    params = {
-        "material_path": material_path,
-        "source_expression_id": source_expression_id,
-        "target_expression_id": target_expression_id,
-        "target_input_name": target_input_name,
-        "source_output_index": source_output_index
-    }
-
-    return await send_tcp_command("connect_material_expressions", params)
-
-
-@app.tool()
-async def connect_expression_to_material_output(
-    material_path: str,
-    expression_id: str,
-    material_property: str,
-    output_index: int = 0
-) -> Dict[str, Any]:
-    """
-    Connect a material expression to a material output (EmissiveColor, Opacity, etc.).
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-        expression_id: GUID of the source expression
-        material_property: Target material property - one of:
-            - "BaseColor": Surface color
-            - "Metallic": Metallic value
-            - "Specular": Specular value
-            - "Roughness": Roughness value
-            - "Normal": Normal map
-            - "EmissiveColor": Emissive/glow color
-            - "Opacity": Opacity for translucent materials
-            - "OpacityMask": Opacity mask for masked materials
-            - "WorldPositionOffset": Vertex offset
-            - "AmbientOcclusion": AO value
-            - "Refraction": Refraction for translucent materials
-            - "SubsurfaceColor": Subsurface scattering color
-        output_index: Output index on source expression (default 0)
-
-    Returns:
-        Success/error message with connected property
-
-    Example:
-        connect_expression_to_material_output(
-            material_path="/Game/Materials/M_Ember",
-            expression_id="43E2F0AD4A059DB305340EAB5A873C46",
-            material_property="EmissiveColor"
-        )
-    """
-    params = {
-        "material_path": material_path,
-        "expression_id": expression_id,
-        "material_property": material_property,
-        "output_index": output_index
-    }
-
-    return await send_tcp_command("connect_expression_to_material_output", params)
-
-
-# ============================================================================
-# Material Palette Search
-# ============================================================================
-
-@app.tool()
-async def compile_material(
-    material_path: str
-) -> Dict[str, Any]:
-    """
-    Compile a material to apply changes and trigger shader recompilation.
-
-    Use this after creating a material with usage flags (like used_with_niagara_sprites)
-    to ensure shaders are compiled with the correct permutations.
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-
-    Returns:
-        Dictionary containing:
-        - success: Whether compilation was successful
-        - message: Success/error message
-
-    Example:
-        compile_material(material_path="/Game/Materials/M_FireEmber")
-    """
-    params = {"material_path": material_path}
-    return await send_tcp_command("compile_material", params)
-
-
-@app.tool()
-async def delete_material_expression(
-    material_path: str,
-    expression_id: str
-) -> Dict[str, Any]:
-    """
-    Delete a material expression from a material graph.
-
-    Use this to remove orphan expressions or clean up unused nodes from materials.
-
-    Args:
-        material_path: Path to the material (e.g., "/Game/Materials/M_MyMaterial")
-        expression_id: GUID of the expression to delete
-
-    Returns:
-        Dictionary containing:
-        - success: Whether deletion was successful
-        - message: Success/error message
-
-    Example:
-        delete_material_expression(
-            material_path="/Game/Materials/M_Ember",
-            expression_id="E880D7F146304B1CC5ECF2AA1697DF33"
-        )
-    """
-    params = {
-        "material_path": material_path,
-        "expression_id": expression_id
-    }
-
-    return await send_tcp_command("delete_material_expression", params)
-
-
-@app.tool()
-async def search_material_palette(
-    search_query: str = "",
-    category_filter: str = "",
-    type_filter: str = "All",
-    max_results: int = 50
-) -> Dict[str, Any]:
-    """
-    Search the Material Palette for expressions and functions.
-
-    Uses UE's built-in MaterialExpressionClasses and Asset Registry to find
-    available material nodes that can be added to materials.
-
-    Args:
-        search_query: Text to search in names (case-insensitive). Leave empty to list all.
-        category_filter: Filter by category name (e.g., "Math", "Texture", "Utility")
-        type_filter: Filter by type - "Expression", "Function", or "All" (default)
-        max_results: Maximum results to return (default: 50)
-
-    Returns:
-        Dictionary containing:
-        - success: Whether search was successful
-        - results: Array of items with:
-            - type: "Expression" or "Function"
-            - name: Display name
-            - category: Category name(s)
-            - class_name: For expressions, the UClass name (use for add_material_expression)
-            - path: For functions, the asset path (use for MaterialFunctionCall)
-            - description: Tooltip/description if available
-        - total_count: Total results before limit
-        - returned_count: Number of results returned
-        - categories: List of available categories
-
-    Examples:
-        # Search for radial gradient related nodes
-        search_material_palette(search_query="radial")
-
-        # List all texture-related expressions
-        search_material_palette(category_filter="Texture", type_filter="Expression")
-
-        # Find all available material functions
-        search_material_palette(type_filter="Function", max_results=100)
-
-        # List all categories (empty search, low limit)
-        search_material_palette(max_results=1)
-    """
-    params = {
-        "search_query": search_query,
-        "category_filter": category_filter,
-        "type_filter": type_filter,
-        "max_results": max_results
-    }
 
-    return await send_tcp_command("search_material_palette", params)
+register_material_graph_tools(app, _send_command)
 
 
 # ============================================================================
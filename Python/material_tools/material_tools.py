@@ -16,7 +16,11 @@ from utils.materials.material_operations import (
     get_material_graph_metadata as get_material_graph_metadata_impl,
     delete_material_expression as delete_material_expression_impl,
     set_material_expression_property as set_material_expression_property_impl,
-    compile_material as compile_material_impl
+    compile_material as compile_material_impl,
+    get_material_compile_status as get_material_compile_status_impl,
+    build_material_graph as build_material_graph_impl,
+    begin_material_edit_session as begin_material_edit_session_impl,
+    end_material_edit_session as end_material_edit_session_impl
 )
 
 logger = logging.getLogger("UnrealMCP")
@@ -290,10 +294,59 @@ def register_material_tools(mcp: FastMCP):
             ctx, material_path, expression_id, property_name, property_value
         )
 
+    @mcp.tool()
+    def build_material_graph(
+        ctx: Context,
+        material_path: str,
+        expressions: List[Dict[str, Any]],
+        connections: List[Dict[str, Any]] = None,
+        outputs: List[Dict[str, Any]] = None,
+        auto_layout: bool = True,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Create, wire, lay out and compile a set of material expressions in one call.
+
+        If any part of the spec is invalid, nothing is added to the material.
+
+        Args:
+            material_path: Path to material
+            expressions: Expressions to create, each {"id", "expression_type", "position" (optional [X, Y]),
+                         "properties" (optional)}; "id" is any name unique within the spec
+            connections: Wires between expressions, each {"source_id", "source_output_index" (default 0),
+                         "target_id", "target_input_name"}; ids are spec ids or GUIDs of existing expressions
+            outputs: Material output bindings, each {"source_id", "output_index" (default 0), "material_property"}
+            auto_layout: Place expressions without a position in columns by distance from the outputs
+            compile: Compile the material once the graph is built (deferred inside an edit session)
+
+        Returns:
+            Dict with: success, expression_ids (spec id -> GUID), expression_count,
+            connection_count, output_count, compiled, compile (compile_material result)
+
+        Example:
+            build_material_graph(
+                "/Game/VFX/Materials/M_Fire",
+                expressions=[
+                    {"id": "tint", "expression_type": "VectorParameter", "properties": {"parameter_name": "Tint"}},
+                    {"id": "noise", "expression_type": "Noise"},
+                    {"id": "mul", "expression_type": "Multiply"}
+                ],
+                connections=[
+                    {"source_id": "tint", "target_id": "mul", "target_input_name": "A"},
+                    {"source_id": "noise", "target_id": "mul", "target_input_name": "B"}
+                ],
+                outputs=[{"source_id": "mul", "material_property": "EmissiveColor"}]
+            )
+        """
+        return build_material_graph_impl(
+            ctx, material_path, expressions, connections, outputs, auto_layout, compile
+        )
+
     @mcp.tool()
     def compile_material(
         ctx: Context,
-        material_path: str
+        material_path: str,
+        async_compile: bool = False
     ) -> Dict[str, Any]:
         """
         Compile/apply a material and return validation info including orphan detection.
@@ -303,14 +356,83 @@ def register_material_tools(mcp: FastMCP):
 
         Args:
             material_path: Path to material
+            async_compile: Return a job_id at once instead of the result; poll
+                           get_material_compile_status until its status is "finished"
 
         Returns:
             Dict with: success, material_path, has_orphans, orphan_count, expression_count,
-            orphans[] (expression_id, expression_type, description), message
+            orphans[] (expression_id, expression_type, description), compile_errors[],
+            expression_errors[] (expression_id, expression_type, error), message.
+            With async_compile: success, job_id, status ("compiling")
 
         Example:
             compile_material("/Game/VFX/Materials/M_Fire")
         """
-        return compile_material_impl(ctx, material_path)
+        return compile_material_impl(ctx, material_path, async_compile)
+
+    @mcp.tool()
+    def get_material_compile_status(
+        ctx: Context,
+        job_id: int
+    ) -> Dict[str, Any]:
+        """
+        Poll a material compile started with compile_material(async_compile=True).
+
+        Args:
+            job_id: Job id returned by compile_material
+
+        Returns:
+            Dict with: job_id, status ("compiling" or "finished"), elapsed_seconds.
+            While compiling: compiling_resources, outstanding_shader_jobs (editor-wide).
+            Once finished: success, compile_errors[], expression_errors[]
+            (expression_id, expression_type, error), has_compile_errors, message
+
+        Example:
+            get_material_compile_status(12)
+        """
+        return get_material_compile_status_impl(ctx, job_id)
+
+    @mcp.tool()
+    def begin_material_edit_session(
+        ctx: Context,
+        material_path: str
+    ) -> Dict[str, Any]:
+        """
+        Start a batch of expression edits without recompiling the material after each one.
+
+        Until end_material_edit_session, expression deletes and property edits only update
+        the graph; the material recompiles and saves once when the session ends. Sessions
+        idle for mcp.MaterialEditSessionIdleSeconds (300 by default) end on their own.
+
+        Args:
+            material_path: Path to material
+
+        Returns:
+            Dict with: success, material_path
+
+        Example:
+            begin_material_edit_session("/Game/VFX/Materials/M_Fire")
+        """
+        return begin_material_edit_session_impl(ctx, material_path)
+
+    @mcp.tool()
+    def end_material_edit_session(
+        ctx: Context,
+        material_path: str
+    ) -> Dict[str, Any]:
+        """
+        End a material edit session, recompiling and saving the material once.
+
+        Args:
+            material_path: Path to material
+
+        Returns:
+            Dict with: success, recompiled, deferred_edits, saved, plus the compile_material
+            validation fields when the material was recompiled
+
+        Example:
+            end_material_edit_session("/Game/VFX/Materials/M_Fire")
+        """
+        return end_material_edit_session_impl(ctx, material_path)
 
     logger.info("Material tools registered successfully")
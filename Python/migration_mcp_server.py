@@ -50,7 +50,8 @@ async def export_blueprint_graph(
     blueprint_path: str,
     graph_name: str = "",
     include_components: bool = True,
-    include_defaults: bool = False
+    include_defaults: bool = False,
+    compress: bool = False
 ) -> Dict[str, Any]:
     """
     Export a complete Blueprint graph to a JSON file.
@@ -64,6 +65,7 @@ async def export_blueprint_graph(
         graph_name: Optional graph name filter (exports all if omitted)
         include_components: Include component hierarchy in export
         include_defaults: Include default values for all properties
+        compress: Write a gzip-compressed .json.gz file, for very large Blueprints
 
     Returns:
         Dict with:
@@ -80,10 +82,89 @@ async def export_blueprint_graph(
 
     if graph_name:
         params["graph_name"] = graph_name
+    if compress:
+        params["compress"] = True
 
     return await send_tcp_command("export_blueprint_graph", params)
 
 
+@app.tool()
+async def batch_export_blueprint_graphs(
+    folder_path: str,
+    recursive: bool = True,
+    include_components: bool = True,
+    compress: bool = False
+) -> Dict[str, Any]:
+    """
+    Export every Blueprint in a content folder, one JSON file per asset.
+
+    Packages are loaded in parallel and written on worker threads, which is much
+    faster than one export_blueprint_graph per asset for migration audits.
+
+    Args:
+        folder_path: Content folder, e.g. "/Game/Blueprints"
+        recursive: Include subfolders
+        include_components: Include component hierarchy in each export
+        compress: Write gzip-compressed .json.gz files
+
+    Returns:
+        Dict with:
+        - output_directory: Saved/UnrealMCP/Exports/bulk_<timestamp>/, mirroring the package paths
+        - manifest_path: manifest.json listing each asset with its file or error
+        - asset_count, exported_count, failed_count
+        - cancelled: Whether the export stopped early
+    """
+    params = {
+        "folder_path": folder_path,
+        "recursive": recursive,
+        "include_components": include_components
+    }
+    if compress:
+        params["compress"] = True
+
+    return await send_tcp_command("batch_export_blueprint_graphs", params)
+
+
+@app.tool()
+async def diff_blueprint_graphs(
+    blueprint_path: str,
+    export_path: str = "",
+    graph_name: str = "",
+    ignore_positions: bool = False
+) -> Dict[str, Any]:
+    """
+    Compare a Blueprint's graphs with an earlier export or with the saved package.
+
+    Use this to review changes made to a Blueprint: nodes are matched by GUID and
+    compared by hash in the editor, so only the differences are returned.
+
+    Args:
+        blueprint_path: Path to the Blueprint to compare
+        export_path: File written by export_blueprint_graph (.json or .json.gz); a bare
+                     file name is looked up in Saved/UnrealMCP/Exports/. Compares with
+                     the package as saved on disk if omitted
+        graph_name: Optional graph name filter
+        ignore_positions: Do not report nodes that only moved
+
+    Returns:
+        Dict with:
+        - identical: Whether no graph changed
+        - graphs: Each changed graph with added_nodes, removed_nodes, modified_nodes
+          (changes lists header, position, comment, pins, defaults), added_links, removed_links
+        - summary: Totals of the above
+    """
+    params = {
+        "blueprint_path": blueprint_path,
+        "ignore_positions": ignore_positions
+    }
+    if export_path:
+        params["export_path"] = export_path
+    if graph_name:
+        params["graph_name"] = graph_name
+
+    return await send_tcp_command("diff_blueprint_graphs", params)
+
+
 @app.tool()
 async def get_blueprint_dependencies(
     blueprint_path: str,
@@ -35,7 +35,8 @@ def register_migration_tools(mcp: FastMCP, send_command_func):
         blueprint_path: str,
         graph_name: str = "",
         include_components: bool = True,
-        include_defaults: bool = False
+        include_defaults: bool = False,
+        compress: bool = False
     ) -> Dict[str, Any]:
         """
         Export a complete Blueprint graph to a JSON file.
@@ -48,6 +49,7 @@ def register_migration_tools(mcp: FastMCP, send_command_func):
             graph_name: Optional graph name filter (exports all if omitted)
             include_components: Include component hierarchy in export
             include_defaults: Include default values for all properties
+            compress: Write a gzip-compressed .json.gz file, for very large Blueprints
 
         Returns:
             Dict with file_path, graph_count, node_count
@@ -60,10 +62,47 @@ def register_migration_tools(mcp: FastMCP, send_command_func):
 
         if graph_name:
             params["graph_name"] = graph_name
+        if compress:
+            params["compress"] = True
 
         logger.info(f"Exporting Blueprint graph: {blueprint_path}")
         return await send_command_func("export_blueprint_graph", params)
 
+    @mcp.tool()
+    async def batch_export_blueprint_graphs(
+        folder_path: str,
+        recursive: bool = True,
+        include_components: bool = True,
+        compress: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Export every Blueprint in a content folder, one JSON file per asset.
+
+        Packages are loaded in parallel and written on worker threads. Files go to
+        Saved/UnrealMCP/Exports/bulk_<timestamp>/, mirroring the package paths, next to
+        a manifest.json that lists each asset with its file or error.
+
+        Args:
+            folder_path: Content folder, e.g. "/Game/Blueprints"
+            recursive: Include subfolders
+            include_components: Include component hierarchy in each export
+            compress: Write gzip-compressed .json.gz files
+
+        Returns:
+            Dict with output_directory, manifest_path, asset_count, exported_count, failed_count
+        """
+        params = {
+            "folder_path": folder_path,
+            "recursive": recursive,
+            "include_components": include_components
+        }
+
+        if compress:
+            params["compress"] = True
+
+        logger.info(f"Batch exporting Blueprint graphs: {folder_path}")
+        return await send_command_func("batch_export_blueprint_graphs", params)
+
     @mcp.tool()
     async def get_blueprint_dependencies(
         blueprint_path: str,
@@ -239,4 +278,42 @@ def register_migration_tools(mcp: FastMCP, send_command_func):
         logger.info(f"Getting functions for Blueprint: {blueprint_path}")
         return await send_command_func("get_blueprint_functions", params)
 
+    @mcp.tool()
+    async def diff_blueprint_graphs(
+        blueprint_path: str,
+        export_path: str = "",
+        graph_name: str = "",
+        ignore_positions: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Compare a Blueprint's graphs with an earlier export or with the saved package.
+
+        Nodes are matched by GUID and compared by hash in the editor, so only the
+        changes come back instead of two full exports.
+
+        Args:
+            blueprint_path: Path to the Blueprint to compare
+            export_path: File written by export_blueprint_graph (.json or .json.gz); a bare
+                         file name is looked up in Saved/UnrealMCP/Exports/. Compares with
+                         the package as saved on disk if omitted
+            graph_name: Optional graph name filter
+            ignore_positions: Do not report nodes that only moved
+
+        Returns:
+            Dict with identical, summary and per changed graph: added_nodes, removed_nodes,
+            modified_nodes (with the changed parts), added_links, removed_links
+        """
+        params = {
+            "blueprint_path": blueprint_path,
+            "ignore_positions": ignore_positions
+        }
+
+        if export_path:
+            params["export_path"] = export_path
+        if graph_name:
+            params["graph_name"] = graph_name
+
+        logger.info(f"Diffing Blueprint graphs: {blueprint_path}")
+        return await send_command_func("diff_blueprint_graphs", params)
+
     logger.info("Blueprint migration tools registered successfully")
@@ -13,6 +13,8 @@ from typing import Any, Dict, List
 
 from fastmcp import FastMCP
 
+from niagara_tools.niagara_bulk_tools import register_niagara_bulk_tools
+
 # Initialize FastMCP app
 app = FastMCP("Niagara MCP Server")
 
@@ -184,7 +186,8 @@ async def get_niagara_system_metadata(
 
 @app.tool()
 async def compile_niagara_system(
-    system: str
+    system: str,
+    async_compile: bool = False
 ) -> Dict[str, Any]:
     """
     Compile and save a Niagara System.
@@ -194,17 +197,22 @@ async def compile_niagara_system(
 
     Args:
         system: Path or name of the Niagara System to compile
+        async_compile: Start the compile and return a job_id immediately instead
+            of waiting; poll get_compile_status for progress and the result
 
     Returns:
         Dictionary containing:
         - success: Whether compilation was successful
         - system: Name of the compiled system
         - message: Success/error message
+        - job_id: Compile job to poll (async_compile only)
 
     Example:
         compile_niagara_system(system="NS_FireExplosion")
     """
     params = {"system": system}
+    if async_compile:
+        params["async"] = True
     return await send_tcp_command("compile_niagara_system", params)
 
 
@@ -886,17 +894,20 @@ async def search_niagara_modules(
     max_results: int = 50
 ) -> Dict[str, Any]:
     """
-    Search available Niagara modules in the asset registry.
+    Search available Niagara modules, best match first.
 
     Args:
-        search_query: Text to search in module names (e.g., "Spawn", "Velocity", "Color")
-        stage_filter: Filter by stage - "Spawn", "Update", "Event", or "" for all
+        search_query: Words to find in module names, keywords, categories or
+            descriptions; every word must match (e.g., "Velocity", "add velocity")
+        stage_filter: Only modules usable in a stage - "Spawn", "Update", "Event",
+            "EmitterSpawn", "EmitterUpdate", or "" for all
         max_results: Maximum results to return (default: 50)
 
     Returns:
         Dictionary containing:
         - success: Whether search was successful
-        - modules: Array of module info with path, name, description
+        - modules: Array of module info with name, path, category, description,
+          stages (stages the module may be added to), deprecated and score
         - count: Number of modules found
 
     Example:
@@ -1129,7 +1140,11 @@ async def set_module_curve_input(
     module_name: str,
     stage: str,
     input_name: str,
-    keyframes: List[Dict[str, float]]
+    keyframes: List[Dict[str, float]] = None,
+    times: List[float] = None,
+    values: List[float] = None,
+    times_base64: str = "",
+    values_base64: str = ""
 ) -> Dict[str, Any]:
     """
     Set a float curve input on a module.
@@ -1146,6 +1161,10 @@ async def set_module_curve_input(
         keyframes: List of keyframe dictionaries, each containing:
             - time: Normalized time (0.0 to 1.0)
             - value: Float value at this time
+        times: Packed alternative to keyframes for dense curves: key times as a list of floats
+        values: Key values matching times
+        times_base64: times as a base64 string of little-endian float32 values, instead of times
+        values_base64: values as a base64 string of little-endian float32 values, instead of values
 
     Returns:
         Dictionary containing:
@@ -1175,9 +1194,13 @@ async def set_module_curve_input(
         "emitter_name": emitter_name,
         "module_name": module_name,
         "stage": stage,
-        "input_name": input_name,
-        "keyframes": keyframes
+        "input_name": input_name
     }
+    if keyframes is not None:
+        params["keyframes"] = keyframes
+    else:
+        params["times"] = times if times is not None else times_base64
+        params["values"] = values if values is not None else values_base64
     return await send_tcp_command("set_module_curve_input", params)
 
 
@@ -1188,7 +1211,11 @@ async def set_module_color_curve_input(
     module_name: str,
     stage: str,
     input_name: str,
-    keyframes: List[Dict[str, float]]
+    keyframes: List[Dict[str, float]] = None,
+    times: List[float] = None,
+    colors: List[float] = None,
+    times_base64: str = "",
+    colors_base64: str = ""
 ) -> Dict[str, Any]:
     """
     Set a color curve (gradient) input on a module.
@@ -1208,6 +1235,10 @@ async def set_module_color_curve_input(
             - g: Green component
             - b: Blue component
             - a: Alpha component (default: 1.0)
+        times: Packed alternative to keyframes for dense curves: key times as a list of floats
+        colors: RGBA of each key interleaved (4 floats per entry of times)
+        times_base64: times as a base64 string of little-endian float32 values, instead of times
+        colors_base64: colors as a base64 string of little-endian float32 values, instead of colors
 
     Returns:
         Dictionary containing:
@@ -1238,9 +1269,13 @@ async def set_module_color_curve_input(
         "emitter_name": emitter_name,
         "module_name": module_name,
         "stage": stage,
-        "input_name": input_name,
-        "keyframes": keyframes
+        "input_name": input_name
     }
+    if keyframes is not None:
+        params["keyframes"] = keyframes
+    else:
+        params["times"] = times if times is not None else times_base64
+        params["colors"] = colors if colors is not None else colors_base64
     return await send_tcp_command("set_module_color_curve_input", params)
 
 
@@ -1482,7 +1517,8 @@ async def get_module_inputs(
     system_path: str,
     emitter_name: str,
     module_name: str,
-    stage: str
+    stage: str,
+    curve_format: str = ""
 ) -> Dict[str, Any]:
     """
     Get all inputs (parameters) for a module with their types and current values.
@@ -1495,6 +1531,10 @@ async def get_module_inputs(
         emitter_name: Emitter name within the system (e.g., "NE_Sparks")
         module_name: Name of the module to query (e.g., "InitializeParticle", "Color")
         stage: Stage containing the module - "Spawn", "Update", "EmitterSpawn", or "EmitterUpdate"
+        curve_format: How curve input keys are returned:
+            - "keyframes" (default): "keyframes" list of {time, value} or {time, r, g, b, a}
+            - "arrays": parallel "times" and "values" (or interleaved RGBA "colors") lists
+            - "base64": the same arrays as base64 strings of little-endian float32 values
 
     Returns:
         Dictionary containing:
@@ -1533,6 +1573,8 @@ async def get_module_inputs(
         "module_name": module_name,
         "stage": stage
     }
+    if curve_format:
+        params["curve_format"] = curve_format
     return await send_tcp_command("get_module_inputs", params)
 
 
@@ -1614,72 +1656,6 @@ async def get_emitter_modules(
     return await send_tcp_command("get_emitter_modules", params)
 
 
-# ============================================================================
-# Diagnostics
-# ============================================================================
-
-@app.tool()
-async def get_niagara_diagnostics(
-    system: str
-) -> Dict[str, Any]:
-    """
-    Get diagnostics and validation results from a Niagara System.
-
-    Uses Unreal Engine's built-in NiagaraValidation system to run all validation
-    rules against the system and report any issues. This includes checks for:
-    - GPU simulation bounds requirements
-    - Banned/deprecated modules
-    - Material compatibility
-    - Large World Coordinates (LWC) issues
-    - Missing or invalid bindings
-    - Performance warnings
-    - And 20+ other built-in validation rules
-
-    Args:
-        system: Path or name of the Niagara System to validate
-
-    Returns:
-        Dictionary containing:
-        - success: Whether validation ran successfully
-        - system: Name of the system
-        - path: Full asset path
-        - diagnostics: Array of diagnostic results, each with:
-            - severity: "Info", "Warning", or "Error"
-            - summary: Short description of the issue
-            - description: Detailed explanation
-            - source: Name of the source object (if applicable)
-            - fixes: Array of suggested fix descriptions (if available)
-        - info_count: Number of info-level diagnostics
-        - warning_count: Number of warning-level diagnostics
-        - error_count: Number of error-level diagnostics
-        - total_count: Total number of diagnostics
-
-    Example:
-        get_niagara_diagnostics(system="NS_FireExplosion")
-        # Returns:
-        # {
-        #   "success": true,
-        #   "system": "NS_FireExplosion",
-        #   "path": "/Game/Effects/NS_FireExplosion",
-        #   "diagnostics": [
-        #     {
-        #       "severity": "Warning",
-        #       "summary": "GPU simulation without fixed bounds",
-        #       "description": "GPU emitters require fixed bounds for culling...",
-        #       "source": "NE_Sparks",
-        #       "fixes": ["Set CalculateBoundsMode to Fixed"]
-        #     }
-        #   ],
-        #   "info_count": 0,
-        #   "warning_count": 1,
-        #   "error_count": 0,
-        #   "total_count": 1
-        # }
-    """
-    params = {"system": system}
-    return await send_tcp_command("get_niagara_diagnostics", params)
-
-
 # ============================================================================
 # Renderer Operations
 # ============================================================================
@@ -1826,6 +1802,14 @@ async def spawn_niagara_actor(
     return await send_tcp_command("spawn_niagara_actor", params)
 
 
+async def _send_command(command_type: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    # Looks send_tcp_command up on every call, so the gateway's shared connection applies to these tools too
+    return await send_tcp_command(command_type, params)
+
+
+register_niagara_bulk_tools(app, _send_command)
+
+
 # ============================================================================
 # Run Server
 # ============================================================================
@@ -0,0 +1,419 @@
+"""
+Niagara spec, snapshot, batch and diagnostics tools for the Niagara MCP Server.
+Includes: system builds from a spec, system snapshots, batched module inputs and
+component parameters, compile status and single and bulk diagnostics.
+"""
+
+from typing import Any, Awaitable, Callable, Dict, List
+
+
+def register_niagara_bulk_tools(app, send: Callable[[str, Dict[str, Any]], Awaitable[Dict[str, Any]]]):
+    """Register the Niagara spec, batch and diagnostics tools on the server's app; send delivers a command to Unreal."""
+
+    # ============================================================================
+    # System Specs, Snapshots and Batched Inputs
+    # ============================================================================
+
+    @app.tool()
+    async def instantiate_niagara_system_from_spec(
+        name: str,
+        folder_path: str = "",
+        template: str = "",
+        parameters: List[Dict[str, Any]] = None,
+        emitters: List[Dict[str, Any]] = None,
+        all_or_nothing: bool = False,
+        save: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build a complete Niagara System from a declarative spec in one call.
+
+        Creates the system, then adds its user parameters, emitters, renderers,
+        modules with their inputs, and data interfaces. Everything is one undo
+        step, and the system compiles once at the end. Without this tool, each
+        add_emitter_to_system / add_renderer / set_renderer_property call would
+        compile it. Steps run in order and stop at the first failure.
+
+        Args:
+            name: Name of the Niagara System (e.g., "NS_Sparks")
+            folder_path: Folder for the asset (e.g., "/Game/Effects")
+            template: Optional system whose emitters are copied first
+            parameters: User parameters, each as in add_niagara_parameter:
+                {"parameter_name", "parameter_type", "default_value", "scope"}
+            emitters: Emitters to add, each a dict with:
+                - emitter_path: Emitter asset to add (required)
+                - emitter_name: Name in the system
+                - enabled: False to add it disabled
+                - renderers: [{"renderer_type", "renderer_name", "properties": {name: value}}]
+                - modules: [{"module_path", "stage", "index", "module_name",
+                             "inputs": [entries as in set_module_inputs_batch]}]
+                  Inputs target the module added; module_name defaults to the script name
+                - data_interfaces: [{"interface_type", "interface_name", "properties": {name: value}}]
+            all_or_nothing: Undo every step after the system was created if one fails
+                            (the new, empty system asset is kept)
+            save: Save the system after it compiles (default: True)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every step succeeded
+            - system_path: Path of the created system
+            - emitters: Names the emitters got in the system
+            - steps: One {command, step, success, error} per step run
+            - rolled_back: Whether the steps were undone
+            - error: First failed step, if any
+
+        Example:
+            instantiate_niagara_system_from_spec(
+                name="NS_Sparks",
+                folder_path="/Game/Effects",
+                emitters=[{
+                    "emitter_path": "/Niagara/DefaultAssets/Templates/Emitters/Fountain",
+                    "emitter_name": "Sparks",
+                    "renderers": [{"renderer_type": "Sprite"}],
+                    "modules": [{
+                        "module_path": "/Niagara/Modules/Update/Size/ScaleSpriteSize",
+                        "stage": "Update",
+                        "inputs": [{"type": "curve", "input_name": "ScaleFactor",
+                                    "times": [0.0, 1.0], "values": [1.0, 0.0]}]
+                    }]
+                }]
+            )
+        """
+        params = {
+            "name": name,
+            "all_or_nothing": all_or_nothing,
+            "save": save
+        }
+        if folder_path:
+            params["path"] = folder_path
+        if template:
+            params["template"] = template
+        if parameters:
+            params["parameters"] = parameters
+        if emitters:
+            params["emitters"] = emitters
+        return await send("instantiate_niagara_system_from_spec", params)
+
+    @app.tool()
+    async def get_niagara_system_snapshot(
+        system_path: str,
+        fields: List[str] = None,
+        emitter_name: str = "",
+        curve_format: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Get a whole Niagara System in one call: every emitter's modules by stage,
+        their inputs, renderers and data interfaces.
+
+        Use this instead of walking the system with get_emitter_modules and
+        get_module_inputs per module; each emitter's scripts are read once.
+
+        Args:
+            system_path: Path to the Niagara System (e.g., "/Game/Effects/NS_Fire")
+            fields: Sections to include; all default sections when omitted:
+                - "modules": Modules per stage (name, index, enabled, script_path)
+                - "inputs": Module inputs as in get_module_inputs (implies "modules")
+                - "renderers": Renderer name, type and enabled state
+                - "data_interfaces": Data interface inputs per emitter, and user parameters
+                - "status": System compile status, as in get_niagara_metadata
+                - "parameters": User parameters, as in get_niagara_metadata
+                Opt-in only (not part of the defaults, they make the result large):
+                - "input_options": Enum and static switch options on inputs
+                - "renderer_properties": Renderer properties and bindings (implies "renderers")
+            emitter_name: Restrict the snapshot to one emitter
+            curve_format: How curve input keys are returned, as in get_module_inputs
+
+        Returns:
+            Dictionary containing:
+            - success: Whether query was successful
+            - system_path, system_name
+            - emitters: Array of {name, enabled, stages, renderers, data_interfaces}
+            - emitter_count, module_count, input_count
+            - user_data_interfaces: Data interfaces exposed as user parameters
+            - status / parameters sections when requested
+
+        Example:
+            get_niagara_system_snapshot(
+                system_path="/Game/Effects/NS_Fire",
+                fields=["modules", "renderers"]
+            )
+        """
+        params = {"system_path": system_path}
+        if fields:
+            params["fields"] = fields
+        if emitter_name:
+            params["emitter_name"] = emitter_name
+        if curve_format:
+            params["curve_format"] = curve_format
+        return await send("get_niagara_system_snapshot", params)
+
+    @app.tool()
+    async def set_module_inputs_batch(
+        inputs: List[Dict[str, Any]],
+        system_path: str = "",
+        emitter_name: str = "",
+        stage: str = "",
+        all_or_nothing: bool = False,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Set many module inputs, curves, random ranges, links and static switches in one call.
+
+        The whole batch is one undo step, and each touched system is compiled once
+        at the end instead of after every input. Use this instead of dozens of
+        individual set_module_* calls when tuning an effect.
+
+        Args:
+            inputs: Entries with a "type" and the parameters of the matching command:
+                - "value" (default): set_module_input (module_name, input_name, value)
+                - "curve": set_module_curve_input (module_name, input_name, keyframes)
+                - "color_curve": set_module_color_curve_input (module_name, input_name, keyframes)
+                - "random": set_module_random_input (module_name, input_name, min_value, max_value)
+                - "linked": set_module_linked_input (module_name, input_name, linked_value)
+                - "static_switch": set_module_static_switch (module_name, switch_name, value)
+            system_path: Default system for entries that do not set their own
+            emitter_name: Default emitter for entries that do not set their own
+            stage: Default stage for entries that do not set their own
+            all_or_nothing: Stop at the first failing entry and undo the entries already applied
+            compile: Compile each touched system once at the end (default True)
+
+        Returns:
+            Dictionary containing:
+            - success: True if every entry was applied
+            - results: Per-entry index, type, success and result or error
+            - succeeded / failed: Entry counts
+            - rolled_back: True if all_or_nothing undid the batch
+            - compiled_systems: Systems compiled at the end
+
+        Example:
+            set_module_inputs_batch(
+                system_path="/Game/Effects/NS_Fire",
+                emitter_name="NE_Sparks",
+                inputs=[
+                    {"module_name": "Initialize Particle", "stage": "Spawn", "input_name": "Lifetime", "value": "2.0"},
+                    {"type": "random", "module_name": "Initialize Particle", "stage": "Spawn",
+                     "input_name": "Sprite Size", "min_value": "5", "max_value": "15"},
+                    {"type": "static_switch", "module_name": "Scale Color", "stage": "Update",
+                     "switch_name": "ScaleA", "value": "true"}
+                ]
+            )
+        """
+        params: Dict[str, Any] = {
+            "inputs": inputs,
+            "all_or_nothing": all_or_nothing,
+            "compile": compile
+        }
+        if system_path:
+            params["system_path"] = system_path
+        if emitter_name:
+            params["emitter_name"] = emitter_name
+        if stage:
+            params["stage"] = stage
+        return await send("set_module_inputs_batch", params)
+
+    @app.tool()
+    async def set_niagara_component_parameters(
+        parameters: Dict[str, Any],
+        actors: List[str] = None,
+        tag: str = "",
+        actor_class: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Set many user parameters on the Niagara components of many placed actors in one call.
+
+        Use this to live-tune placed effects instead of one set_niagara_*_param call per
+        parameter. Each value is converted to the type its system declares. Every component
+        is refreshed once, and the whole change is one undo step.
+
+        Args:
+            parameters: User parameter values by name, with or without "User." prefix:
+                numbers, booleans, number lists ([x, y, z], [r, g, b, a]) or "x,y,z" strings
+            actors: Actor names or outliner labels to target
+            tag: Target every actor with this tag
+            actor_class: Target every actor of this class (e.g. "NiagaraActor",
+                         or a Blueprint class path)
+            At least one of actors, tag or actor_class is required; an actor matching any of
+            them is targeted once.
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every parameter was set on every component and every named actor was found
+            - components: Per component {actor, component, system, parameters_set, errors}
+            - actor_count, component_count, parameters_set, parameters_failed
+            - missing_actors: Named actors that were not found
+
+        Example:
+            set_niagara_component_parameters(
+                tag="Torches",
+                parameters={"SpawnRate": 40, "FlameColor": [1.0, 0.4, 0.1]}
+            )
+        """
+        params = {"parameters": parameters}
+        if actors:
+            params["actors"] = actors
+        if tag:
+            params["tag"] = tag
+        if actor_class:
+            params["class"] = actor_class
+        return await send("set_niagara_component_parameters", params)
+
+    # ============================================================================
+    # Compilation and Diagnostics
+    # ============================================================================
+
+    @app.tool()
+    async def get_compile_status(
+        job_id: int
+    ) -> Dict[str, Any]:
+        """
+        Get the progress of a Niagara compile started with async_compile=True.
+
+        Args:
+            job_id: Job returned by compile_niagara_system or compile_niagara_asset
+
+        Returns:
+            Dictionary containing:
+            - state: "compiling", "succeeded" or "failed"
+            - progress: Fraction of scripts compiled (0.0 - 1.0)
+            - scripts_total / scripts_pending: Script counts over the whole system
+            - system_scripts: System spawn/update scripts with their usage and state
+            - emitters: Per-emitter script counts and per-script state
+            - elapsed_seconds: Time since the compile started
+            - message / error: Once finished, the same warnings or errors a
+              synchronous compile reports
+
+        Example:
+            job = compile_niagara_system(system="NS_FireExplosion", async_compile=True)
+            get_compile_status(job_id=job["job_id"])
+        """
+        params = {"job_id": job_id}
+        return await send("get_compile_status", params)
+
+    @app.tool()
+    async def get_niagara_diagnostics(
+        system: str
+    ) -> Dict[str, Any]:
+        """
+        Get diagnostics and validation results from a Niagara System.
+
+        Uses Unreal Engine's built-in NiagaraValidation system to run all validation
+        rules against the system and report any issues. This includes checks for:
+        - GPU simulation bounds requirements
+        - Banned/deprecated modules
+        - Material compatibility
+        - Large World Coordinates (LWC) issues
+        - Missing or invalid bindings
+        - Performance warnings
+        - And 20+ other built-in validation rules
+
+        Args:
+            system: Path or name of the Niagara System to validate
+
+        Returns:
+            Dictionary containing:
+            - success: Whether validation ran successfully
+            - system: Name of the system
+            - path: Full asset path
+            - diagnostics: Array of diagnostic results, each with:
+                - severity: "Info", "Warning", or "Error"
+                - summary: Short description of the issue
+                - description: Detailed explanation
+                - source: Name of the source object (if applicable)
+                - fixes: Array of suggested fix descriptions (if available)
+            - info_count: Number of info-level diagnostics
+            - warning_count: Number of warning-level diagnostics
+            - error_count: Number of error-level diagnostics
+            - total_count: Total number of diagnostics
+
+        Example:
+            get_niagara_diagnostics(system="NS_FireExplosion")
+            # Returns:
+            # {
+            #   "success": true,
+            #   "system": "NS_FireExplosion",
+            #   "path": "/Game/Effects/NS_FireExplosion",
+            #   "diagnostics": [
+            #     {
+            #       "severity": "Warning",
+            #       "summary": "GPU simulation without fixed bounds",
+            #       "description": "GPU emitters require fixed bounds for culling...",
+            #       "source": "NE_Sparks",
+            #       "fixes": ["Set CalculateBoundsMode to Fixed"]
+            #     }
+            #   ],
+            #   "info_count": 0,
+            #   "warning_count": 1,
+            #   "error_count": 0,
+            #   "total_count": 1
+            # }
+        """
+        params = {"system": system}
+        return await send("get_niagara_diagnostics", params)
+
+    @app.tool()
+    async def start_bulk_niagara_diagnostics(
+        systems: List[str] = None,
+        path: str = "",
+        compile: bool = False,
+        max_in_flight: int = 8
+    ) -> Dict[str, Any]:
+        """
+        Start collecting compile diagnostics for many Niagara Systems at once.
+
+        Systems are loaded asynchronously, several at a time, and checked as soon as
+        their compile settles. Each result reports the compile errors and warnings,
+        renderer feedback, and deprecated/experimental module warnings that
+        compile_niagara_asset reports. Read the results with
+        get_bulk_niagara_diagnostics while the job runs.
+
+        Args:
+            systems: System paths or names to check
+            path: Folder whose systems are all checked, recursively (e.g., "/Game/Effects")
+            compile: Request a compile of every system instead of reporting its last compile
+            max_in_flight: Most systems loading or compiling at once (1-64, default: 8)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job was started
+            - job_id: Job to pass to get_bulk_niagara_diagnostics
+            - systems_total: Number of systems the job checks
+
+        Example:
+            start_bulk_niagara_diagnostics(path="/Game/Effects", max_in_flight=16)
+        """
+        params = {"compile": compile, "max_in_flight": max_in_flight}
+        if systems:
+            params["systems"] = systems
+        if path:
+            params["path"] = path
+        return await send("start_bulk_niagara_diagnostics", params)
+
+    @app.tool()
+    async def get_bulk_niagara_diagnostics(
+        job_id: int,
+        cursor: int = 0,
+        max_results: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Read the results of start_bulk_niagara_diagnostics as systems complete.
+
+        Results are kept in completion order; pass the returned next_cursor back as
+        cursor to receive only the systems finished since the previous call.
+
+        Args:
+            job_id: Job returned by start_bulk_niagara_diagnostics
+            cursor: Number of results already read (default: 0)
+            max_results: Most results returned per call (default: 100)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job was found
+            - state: "running" or "finished"
+            - systems_total, systems_completed, systems_loading, systems_compiling, systems_failed
+            - progress: Fraction of systems completed (0.0 to 1.0)
+            - results: Per system: system_path, loaded, valid, compile_messages,
+              module_warnings, elapsed_seconds (or error if it could not be loaded)
+            - next_cursor: Cursor for the next call
+            - has_more: Whether more results are available or still to come
+        """
+        params = {"job_id": job_id, "cursor": cursor, "max_results": max_results}
+        return await send("get_bulk_niagara_diagnostics", params)
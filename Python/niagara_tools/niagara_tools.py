@@ -143,18 +143,40 @@ def register_niagara_tools(mcp: FastMCP):
     @mcp.tool()
     def compile_niagara_asset(
         ctx: Context,
-        asset_path: str
+        asset_path: str,
+        async_compile: bool = False
     ) -> Dict[str, Any]:
         """
         Compile a Niagara System or Emitter.
 
         Args:
             asset_path: Path to the Niagara asset
+            async_compile: Start compiling and return a job_id immediately;
+                poll get_compile_status for progress and the result (systems only)
         """
         params = {"asset_path": asset_path}
+        if async_compile:
+            params["async"] = True
         logger.info(f"Compiling Niagara asset '{asset_path}'")
         return send_unreal_command("compile_niagara_asset", params)
 
+    @mcp.tool()
+    def get_compile_status(
+        ctx: Context,
+        job_id: int
+    ) -> Dict[str, Any]:
+        """
+        Poll a Niagara compile started with async_compile=True.
+
+        Args:
+            job_id: Job returned by compile_niagara_asset
+
+        Returns state ("compiling", "succeeded", "failed"), progress, per-emitter
+        script states and, once finished, the compile's message or error.
+        """
+        params = {"job_id": job_id}
+        return send_unreal_command("get_compile_status", params)
+
     @mcp.tool()
     def add_module_to_emitter(
         ctx: Context,
@@ -192,15 +214,15 @@ def register_niagara_tools(mcp: FastMCP):
         max_results: int = 50
     ) -> Dict[str, Any]:
         """
-        Search available Niagara modules in the asset registry.
+        Search available Niagara modules, best match first.
 
         Args:
-            search_query: Text to search in module names
-            stage_filter: "Spawn"|"Update"|"Event"|"" (all)
+            search_query: Words to find in module names, keywords, categories or descriptions
+            stage_filter: "Spawn"|"Update"|"Event"|"EmitterSpawn"|"EmitterUpdate"|"" (all)
             max_results: Maximum results to return
 
         Returns:
-            Dict with: modules[] (path, name, description), count
+            Dict with: modules[] (name, path, category, description, stages, score), count
 
         Example:
             search_niagara_modules("Location", stage_filter="Spawn")
@@ -428,18 +428,24 @@ def register_blueprint_node_tools(mcp: FastMCP):
     def auto_arrange_nodes(
         ctx: Context,
         blueprint_name: str,
-        graph_name: str = "EventGraph"
+        graph_name: str = "EventGraph",
+        node_ids: List[str] = None
     ) -> Dict[str, Any]:
         """
         Auto-arrange nodes in a Blueprint graph for better readability.
-        Uses connection-aware horizontal flow layout:
+        Uses a layered left-to-right layout:
         - Event/entry nodes placed on the left
-        - Connected nodes flow left-to-right following execution order
-        - Pure nodes (getters, math) positioned near their consumers
+        - Connected nodes flow left-to-right following execution order, ordered to reduce wire crossings
+        - Pure nodes (getters, math) placed in the column before their consumers
+        - Node sizes are estimated from titles and pins, so nodes do not overlap
+        - Unconnected chains are stacked top to bottom; comment boxes are not moved
 
         Args:
             blueprint_name: Name or path of the Blueprint
             graph_name: Name of the graph to arrange (default: "EventGraph")
+            node_ids: Only place these nodes (e.g. ones just added), next to the nodes they
+                are wired to and clear of the others; every other node stays where it is.
+                Allowed on EventGraph.
 
         Returns:
             Dict containing:
@@ -453,19 +459,24 @@ def register_blueprint_node_tools(mcp: FastMCP):
 
             # Arrange a specific function graph
             auto_arrange_nodes(ctx, blueprint_name="BP_MyActor", graph_name="UpdateHealth")
+
+            # Place two freshly added nodes without touching the rest of the EventGraph
+            auto_arrange_nodes(ctx, blueprint_name="BP_MyActor", node_ids=["<node_id>", "<node_id>"])
         """
         try:
-            # Prohibit auto-arrange on EventGraph - too disruptive
-            if graph_name.lower() == "eventgraph":
+            # Prohibit a full auto-arrange on EventGraph - too disruptive
+            if graph_name.lower() == "eventgraph" and not node_ids:
                 return {
                     "success": False,
-                    "error": "auto_arrange_nodes is prohibited on EventGraph. Use on specific function graphs only."
+                    "error": "auto_arrange_nodes is prohibited on EventGraph. Use on specific function graphs, or pass node_ids."
                 }
 
             params = {
                 "blueprint_name": blueprint_name,
                 "graph_name": graph_name
             }
+            if node_ids:
+                params["node_ids"] = node_ids
 
             result = send_unreal_command("auto_arrange_nodes", params)
             return result
@@ -475,4 +486,291 @@ def register_blueprint_node_tools(mcp: FastMCP):
             return {
                 "success": False,
                 "message": f"Failed to auto-arrange nodes: {str(e)}"
-            }
\ No newline at end of file
+            }
+
+    @mcp.tool()
+    def connect_pins_batch(
+        ctx: Context,
+        blueprint_name: str,
+        wires: List[Dict[str, str]],
+        target_graph: str = "EventGraph",
+        all_or_nothing: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Connect many pin pairs of one graph in a single call.
+
+        Faster than connect_blueprint_nodes for large wiring jobs: node ids are
+        resolved once, every wire is validated by the graph schema before any is
+        made, and the graph is refreshed once. Mismatched types get the conversion
+        node the schema offers; exec outputs replace their previous link.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint
+            wires: List of wires, each with source_node_id, source_pin (output),
+                target_node_id, target_pin (input)
+            target_graph: Graph the nodes are in
+            all_or_nothing: Make no wire unless every wire is valid
+
+        Returns:
+            Dict containing:
+            - results: Per-wire entries with the wire, success, and error on failure
+            - succeeded, failed
+            - auto_inserted_nodes: Conversion nodes created, if any
+            - success: True if every wire was made
+
+        Examples:
+            connect_pins_batch(ctx, blueprint_name="BP_Door", wires=[
+                {"source_node_id": "A1B2...", "source_pin": "then",
+                 "target_node_id": "C3D4...", "target_pin": "execute"}
+            ])
+        """
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "wires": wires,
+                "target_graph": target_graph,
+                "all_or_nothing": all_or_nothing
+            }
+            return send_unreal_command("connect_pins_batch", params)
+
+        except Exception as e:
+            logger.error(f"Error connecting pins: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to connect pins: {str(e)}"
+            }
+
+    @mcp.tool()
+    def disconnect_pins_batch(
+        ctx: Context,
+        blueprint_name: str,
+        wires: List[Dict[str, str]],
+        target_graph: str = "EventGraph",
+        all_or_nothing: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Break many specific wires of one graph in a single call.
+
+        Unlike disconnect_node, only the listed links are broken. Every wire is
+        checked to exist before any is broken, and the graph is refreshed once.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint
+            wires: List of wires, each with source_node_id, source_pin (output),
+                target_node_id, target_pin (input)
+            target_graph: Graph the nodes are in
+            all_or_nothing: Break no wire unless every wire exists
+
+        Returns:
+            Dict containing:
+            - results: Per-wire entries with the wire, success, and error on failure
+            - succeeded, failed
+            - success: True if every wire was broken
+        """
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "wires": wires,
+                "target_graph": target_graph,
+                "all_or_nothing": all_or_nothing
+            }
+            return send_unreal_command("disconnect_pins_batch", params)
+
+        except Exception as e:
+            logger.error(f"Error disconnecting pins: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to disconnect pins: {str(e)}"
+            }
+
+    @mcp.tool()
+    def build_blueprint_graph(
+        ctx: Context,
+        blueprint_name: str,
+        nodes: List[Dict[str, Any]],
+        connections: List[Dict[str, Any]] = None,
+        target_graph: str = "EventGraph",
+        auto_arrange: bool = None
+    ) -> Dict[str, Any]:
+        """
+        Build a Blueprint graph from a node and wire spec in a single call.
+
+        Much faster than one create_node_by_action_name per node plus one
+        connect_blueprint_nodes per wire: the action database is searched once
+        for all nodes, every node is created before wiring, and the graph is laid
+        out and refreshed once.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint
+            nodes: List of nodes, each containing:
+                - id: Spec id used by connections (required)
+                - action: Action/function name as for create_node_by_action_name (required)
+                - class_name: Class to disambiguate the function (optional)
+                - position: [x, y] (optional)
+                - params: Extra node parameters such as pin_values or kwargs (optional)
+            connections: List of wires with source, source_pin, target, target_pin.
+                source/target are spec ids, or node ids of nodes already in the graph
+            target_graph: Graph to build in; created if it does not exist
+            auto_arrange: Lay the graph out afterwards (default: True except for EventGraph);
+                otherwise nodes without a position are placed next to their neighbours
+
+        Returns:
+            Dict containing:
+            - nodes: Per-node entries with id, success, node_id or error
+            - connections: Per-wire entries with source, target, success or error
+            - nodes_created, connections_made, failed, arranged_count
+
+        Examples:
+            build_blueprint_graph(ctx, blueprint_name="BP_Door", target_graph="OpenDoor", nodes=[
+                {"id": "print", "action": "PrintString", "class_name": "KismetSystemLibrary",
+                 "params": {"pin_values": {"InString": "Opening"}}},
+                {"id": "delay", "action": "Delay", "params": {"pin_values": {"Duration": "0.5"}}}
+            ], connections=[
+                {"source": "print", "source_pin": "then", "target": "delay", "target_pin": "execute"}
+            ])
+        """
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "nodes": nodes,
+                "connections": connections or [],
+                "target_graph": target_graph
+            }
+            if auto_arrange is not None:
+                params["auto_arrange"] = auto_arrange
+
+            return send_unreal_command("build_blueprint_graph", params)
+
+        except Exception as e:
+            logger.error(f"Error building blueprint graph: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to build blueprint graph: {str(e)}"
+            }
+
+    @mcp.tool()
+    def save_graph_snippet(
+        ctx: Context,
+        blueprint_name: str,
+        snippet_name: str,
+        node_ids: List[str],
+        graph_name: str = "EventGraph",
+        keys: List[str] = None,
+        description: str = "",
+        overwrite: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Save a group of nodes and the wires between them as a reusable snippet.
+
+        The nodes are copied as the editor's Copy does, and the snippet is kept
+        under Saved/UnrealMCP/Snippets so it survives editor restarts. Paste it
+        with paste_graph_snippet to recreate the whole pattern in one call.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint
+            snippet_name: Snippet name (letters, digits, '_' and '-')
+            node_ids: Ids of the nodes to save
+            graph_name: Graph the nodes are in
+            keys: Name for each node, used by paste overrides and results
+                (default "node0", "node1", ...)
+            description: Listed with the snippet
+            overwrite: Replace a snippet of the same name
+
+        Returns:
+            Dict containing:
+            - snippet: name, description, schema and nodes (key, title, class)
+            - success
+        """
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "snippet_name": snippet_name,
+                "node_ids": node_ids,
+                "graph_name": graph_name,
+                "description": description,
+                "overwrite": overwrite
+            }
+            if keys is not None:
+                params["keys"] = keys
+            return send_unreal_command("save_graph_snippet", params)
+
+        except Exception as e:
+            logger.error(f"Error saving graph snippet: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to save graph snippet: {str(e)}"
+            }
+
+    @mcp.tool()
+    def paste_graph_snippet(
+        ctx: Context,
+        blueprint_name: str,
+        snippet_name: str,
+        graph_name: str = "EventGraph",
+        position: List[float] = None,
+        overrides: Dict[str, Dict[str, Any]] = None
+    ) -> Dict[str, Any]:
+        """
+        Paste a snippet saved with save_graph_snippet into a graph.
+
+        All nodes and the wires between them are imported at once, with new ids.
+        Wires to nodes outside the snippet are not kept.
+
+        Args:
+            blueprint_name: Name or path of the Blueprint
+            snippet_name: Snippet to paste
+            graph_name: Graph to paste into
+            position: [x, y] of the snippet's top left node (default [0, 0])
+            overrides: Changes by node key, each with
+                - pins: {pin name: default value}
+                - variable: Member variable a variable get/set node uses instead
+
+        Returns:
+            Dict containing:
+            - nodes: key, node_id and title of each pasted node
+            - warnings: Overrides that could not be applied, if any
+            - success
+
+        Examples:
+            paste_graph_snippet(ctx, blueprint_name="BP_Door", snippet_name="DelayedPrint",
+                position=[400, 200],
+                overrides={"node1": {"pins": {"InString": "Opened"}}})
+        """
+        try:
+            params = {
+                "blueprint_name": blueprint_name,
+                "snippet_name": snippet_name,
+                "graph_name": graph_name
+            }
+            if position is not None:
+                params["position"] = position
+            if overrides is not None:
+                params["overrides"] = overrides
+            return send_unreal_command("paste_graph_snippet", params)
+
+        except Exception as e:
+            logger.error(f"Error pasting graph snippet: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to paste graph snippet: {str(e)}"
+            }
+
+    @mcp.tool()
+    def list_graph_snippets(ctx: Context) -> Dict[str, Any]:
+        """
+        List the snippets saved with save_graph_snippet.
+
+        Returns:
+            Dict containing:
+            - snippets: name, description, schema and nodes (key, title, class) of each
+            - count
+        """
+        try:
+            return send_unreal_command("list_graph_snippets", {})
+
+        except Exception as e:
+            logger.error(f"Error listing graph snippets: {e}")
+            return {
+                "success": False,
+                "message": f"Failed to list graph snippets: {str(e)}"
+            }
@@ -0,0 +1,240 @@
+"""Bulk Asset Tools for Unreal MCP."""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def register_asset_batch_tools(mcp: FastMCP):
+    """Register bulk asset tools with the MCP server."""
+
+    @mcp.tool()
+    def batch_create_data_assets(
+        ctx: Context,
+        asset_class: str,
+        rows: List[Dict[str, Any]],
+        folder_path: str = "/Game/Data",
+        save: bool = True,
+        parallel_save: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Create many DataAssets of one class, with their property values, in one call.
+
+        Meant for item databases and other sets of hundreds or thousands of assets: one
+        create_data_asset call per asset saves each one separately, while this creates and
+        populates every row in one pass and saves the packages together at the end.
+
+        Args:
+            asset_class: Class name of every DataAsset (e.g. "ItemDefinition", "/Script/MyGame.ItemDefinition")
+            rows: List of dicts with:
+                - name: Asset name
+                - folder_path: Optional folder (default: folder_path)
+                - properties: Optional dict of property paths ("Damage", "Stats.MaxHealth") to values
+            folder_path: Folder of the rows that name none (default: "/Game/Data")
+            save: Whether the created assets are saved (default: True)
+            parallel_save: Serialize the packages on worker threads (default: False)
+
+        Returns:
+            Dictionary containing:
+            - rows: Per row: name, asset_path, created, error, property_errors
+            - created, failed, property_errors
+            - unsaved_packages: Packages that could not be saved
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "asset_class": asset_class,
+                "rows": rows,
+                "folder_path": folder_path,
+                "save": save,
+                "parallel_save": parallel_save
+            }
+
+            logger.info(f"Creating {len(rows)} DataAsset(s) of class '{asset_class}'")
+            response = unreal.send_command("batch_create_data_assets", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Batch create DataAssets: {response.get('created')} created, {response.get('failed')} failed")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating DataAssets: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_property_on_objects(
+        ctx: Context,
+        property_name: str,
+        property_value: Any,
+        asset_paths: List[str] = None,
+        components: List[Dict[str, str]] = None,
+        save: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Set one property to the same value on many DataAssets and/or Blueprint components at once.
+
+        The property is resolved once per class and the value converted once, then copied into
+        every target. All changes are one undo step and modified assets are saved together, so
+        this is much faster than calling set_data_asset_property or
+        modify_blueprint_component_properties once per object.
+
+        Args:
+            property_name: Property name, or dot-separated path through struct members
+                           (e.g., "MaxHealth", "RelativeScale3D", "BodyInstance.MassScale")
+            property_value: Value to set (type must match property type)
+            asset_paths: Asset paths to modify (e.g., ["/Game/Data/DA_Goblin", "/Game/Data/DA_Orc"])
+            components: Blueprint components to modify, each
+                        {"blueprint_name": "BP_Enemy", "component_name": "Mesh"}
+            save: Whether to save the modified assets and Blueprints (default True)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the command ran
+            - targets: One {kind, name, success, error} entry per requested object
+            - total, succeeded, failed: Target counts
+
+        Examples:
+            # Same health on every enemy config
+            set_property_on_objects(
+                property_name="MaxHealth",
+                property_value=500.0,
+                asset_paths=["/Game/Data/DA_Goblin", "/Game/Data/DA_Orc"]
+            )
+
+            # Hide the mesh of several Blueprints
+            set_property_on_objects(
+                property_name="bVisible",
+                property_value=False,
+                components=[
+                    {"blueprint_name": "BP_EnemyA", "component_name": "Mesh"},
+                    {"blueprint_name": "BP_EnemyB", "component_name": "Mesh"}
+                ]
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "property_name": property_name,
+                "property_value": property_value,
+                "save": save
+            }
+            if asset_paths:
+                params["asset_paths"] = asset_paths
+            if components:
+                params["components"] = components
+
+            target_count = len(asset_paths or []) + len(components or [])
+            logger.info(f"Setting property '{property_name}' on {target_count} objects")
+            response = unreal.send_command("set_property_on_objects", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Set property on objects response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error setting property on objects: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def batch_asset_operation(
+        ctx: Context,
+        operation: str,
+        assets: List[Any],
+        destination_folder: str = None,
+        fixup_redirectors: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Move, rename, duplicate or delete many assets in one call.
+
+        Much faster than one move_asset/rename_asset call per asset when reorganizing
+        folders: references to the whole set are updated once and the redirectors left
+        behind are fixed up in a single pass at the end.
+
+        Args:
+            operation: One of "move", "rename", "duplicate", "delete"
+            assets: List of asset paths, or of dicts with:
+                - asset_path: Full path to the asset
+                - destination_folder: Folder to move or copy it to
+                - new_name: Name it gets (required for "rename")
+            destination_folder: Folder for the assets that name none ("move", "duplicate")
+            fixup_redirectors: Whether moves and renames fix up referencers and delete the
+                redirectors left behind (default: True)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the batch ran
+            - results: Per asset: asset_path, new_asset_path, success, error
+            - total, succeeded, failed
+            - redirectors_fixed: Redirectors fixed up ("move" and "rename")
+
+        Examples:
+            # Move a set of Blueprints into a new folder
+            batch_asset_operation(
+                operation="move",
+                assets=["/Game/Blueprints/BP_Enemy", "/Game/Blueprints/BP_Boss"],
+                destination_folder="/Game/Enemies/Blueprints"
+            )
+
+            # Rename several assets
+            batch_asset_operation(
+                operation="rename",
+                assets=[
+                    {"asset_path": "/Game/Data/Goblin", "new_name": "DA_Goblin"},
+                    {"asset_path": "/Game/Data/Orc", "new_name": "DA_Orc"}
+                ]
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "operation": operation,
+                "assets": assets,
+                "fixup_redirectors": fixup_redirectors
+            }
+            if destination_folder:
+                params["destination_folder"] = destination_folder
+
+            logger.info(f"Batch {operation} of {len(assets)} asset(s)")
+            response = unreal.send_command("batch_asset_operation", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Batch asset operation response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error in batch asset operation: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    logger.info("Asset batch tools registered successfully")
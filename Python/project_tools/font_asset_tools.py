@@ -0,0 +1,619 @@
+"""Font Asset Tools for Unreal MCP."""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def register_font_asset_tools(mcp: FastMCP):
+    """Register font asset tools with the MCP server."""
+
+    @mcp.tool()
+    def create_font_face(
+        ctx: Context,
+        font_name: str,
+        source_texture: str,
+        path: str = "/Game/Fonts",
+        use_sdf: bool = True,
+        distance_field_spread: int = 4,
+        font_metrics: Dict[str, Any] = None
+    ) -> Dict[str, Any]:
+        """
+        Create a new FontFace asset from an SDF texture.
+
+        FontFace assets are required to use custom fonts in UMG widgets. This tool creates
+        a FontFace that references an SDF (Signed Distance Field) texture for high-quality
+        text rendering at any scale.
+
+        Args:
+            font_name: Name of the FontFace asset to create (e.g., "FF_DarkFantasy_Regular")
+            source_texture: Path to the source SDF texture (e.g., "/Game/Fonts/DarkFantasy_Regular_sdf")
+            path: Path where to create the FontFace asset (default: "/Game/Fonts")
+            use_sdf: Whether this font uses SDF rendering (default: True)
+            distance_field_spread: SDF spread value in pixels (default: 4)
+            font_metrics: Optional font metrics dict with keys:
+                - ascender: Font ascender value
+                - descender: Font descender value
+                - line_height: Line height value
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the FontFace was created
+            - font_path: Full path to the created FontFace asset
+            - message: Status message
+
+        Examples:
+            # Create a basic SDF FontFace
+            create_font_face(
+                font_name="FF_DarkFantasy_Regular",
+                source_texture="/Game/Fonts/DarkFantasy_Regular_sdf"
+            )
+
+            # Create FontFace with custom metrics
+            create_font_face(
+                font_name="FF_DarkFantasy_Bold",
+                source_texture="/Game/Fonts/DarkFantasy_Bold_sdf",
+                path="/Game/UI/Fonts",
+                distance_field_spread=6,
+                font_metrics={
+                    "ascender": 0.8,
+                    "descender": -0.2,
+                    "line_height": 1.2
+                }
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "font_name": font_name,
+                "source_texture": source_texture,
+                "path": path,
+                "use_sdf": use_sdf,
+                "distance_field_spread": distance_field_spread
+            }
+
+            if font_metrics:
+                params["font_metrics"] = font_metrics
+
+            logger.info(f"Creating FontFace '{font_name}' from texture '{source_texture}'")
+            response = unreal.send_command("create_font_face", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Create FontFace response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating FontFace: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def set_font_face_properties(
+        ctx: Context,
+        font_path: str,
+        properties: Dict[str, Any]
+    ) -> Dict[str, Any]:
+        """
+        Set properties on an existing FontFace asset.
+
+        Args:
+            font_path: Path to the FontFace asset (e.g., "/Game/Fonts/FF_DarkFantasy_Regular")
+            properties: Dictionary of properties to set. Supported properties:
+                - Hinting: Font hinting mode ("Default", "Auto", "AutoLight", "Monochrome", "None")
+                - LoadingPolicy: Font loading policy ("LazyLoad", "Stream", "Inline")
+                - Ascender: Font ascender value (float)
+                - Descender: Font descender value (float)
+                - SubFaceIndex: Sub-face index for multi-face fonts (int)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether properties were set
+            - font_path: Path to the modified FontFace
+            - success_properties: List of properties that were set successfully
+            - failed_properties: List of properties that failed to set
+            - message: Status message
+
+        Examples:
+            # Set hinting mode
+            set_font_face_properties(
+                font_path="/Game/Fonts/FF_DarkFantasy_Regular",
+                properties={"Hinting": "None"}
+            )
+
+            # Set multiple properties
+            set_font_face_properties(
+                font_path="/Game/Fonts/FF_DarkFantasy_Regular",
+                properties={
+                    "Hinting": "AutoLight",
+                    "LoadingPolicy": "Inline",
+                    "Ascender": 0.85
+                }
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "font_path": font_path,
+                "properties": properties
+            }
+
+            logger.info(f"Setting properties on FontFace '{font_path}'")
+            response = unreal.send_command("set_font_face_properties", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Set FontFace properties response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error setting FontFace properties: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_font_face_metadata(
+        ctx: Context,
+        font_path: str
+    ) -> Dict[str, Any]:
+        """
+        Get metadata about an existing FontFace asset.
+
+        Args:
+            font_path: Path to the FontFace asset (e.g., "/Game/Fonts/FF_DarkFantasy_Regular")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the FontFace was found
+            - font_path: Path to the FontFace asset
+            - font_name: Name of the FontFace
+            - source_filename: Original source file (if available)
+            - hinting: Current hinting mode
+            - loading_policy: Current loading policy
+            - ascender: Font ascender value
+            - descender: Font descender value
+            - sub_face_index: Sub-face index
+            - message: Status message
+
+        Examples:
+            # Get FontFace metadata
+            get_font_face_metadata(font_path="/Game/Fonts/FF_DarkFantasy_Regular")
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "font_path": font_path
+            }
+
+            logger.info(f"Getting metadata for FontFace '{font_path}'")
+            response = unreal.send_command("get_font_face_metadata", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Get FontFace metadata response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error getting FontFace metadata: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_offline_font(
+        ctx: Context,
+        font_name: str,
+        texture_path: str,
+        metrics_file_path: str,
+        path: str = "/Game/Fonts"
+    ) -> Dict[str, Any]:
+        """
+        Create an offline (bitmap/SDF atlas) font from a texture and metrics JSON file.
+
+        This tool creates a UFont asset with offline caching that uses a pre-rendered
+        texture atlas (like SDF fonts) instead of TTF font data. The metrics JSON file
+        (on disk, NOT an Unreal asset) provides character positions and font metrics.
+
+        Args:
+            font_name: Name of the font asset to create (e.g., "Font_DarkFantasy_Regular")
+            texture_path: Path to the SDF texture atlas (e.g., "/Game/Fonts/DarkFantasy_Regular_sdf")
+            metrics_file_path: Absolute file path to the metrics JSON file on disk (NOT an Unreal asset path).
+                The JSON file should have the following structure:
+                - atlasWidth: Width of the texture atlas in pixels
+                - atlasHeight: Height of the texture atlas in pixels
+                - lineHeight: Line height in pixels
+                - baseline: Baseline position from top in pixels
+                - characters: Object mapping character codes to glyph data:
+                    - u, v: Normalized UV coordinates (0-1)
+                    - width, height: Glyph dimensions in pixels
+                    - xOffset, yOffset: Positioning offsets
+                    - xAdvance: Horizontal advance for cursor
+            path: Path where to create the font asset (default: "/Game/Fonts")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the font was created
+            - font_name: Name of the created font
+            - font_path: Full path to the created font asset
+            - message: Status message
+
+        Examples:
+            # Create font from SDF texture and metrics file
+            create_offline_font(
+                font_name="Font_DarkFantasy_Regular",
+                texture_path="/Game/Fonts/DarkFantasy_Regular_sdf",
+                metrics_file_path="E:/code/unreal-mcp/Docs/fonts/DarkFantasy_Regular_metrics.json"
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "font_name": font_name,
+                "texture_path": texture_path,
+                "metrics_file_path": metrics_file_path,
+                "path": path
+            }
+
+            logger.info(f"Creating offline font '{font_name}' from texture '{texture_path}' with metrics from '{metrics_file_path}'")
+            response = unreal.send_command("create_offline_font", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Create offline font response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating offline font: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_font_metadata(
+        ctx: Context,
+        font_path: str
+    ) -> Dict[str, Any]:
+        """
+        Get metadata about an existing UFont asset.
+
+        Args:
+            font_path: Path to the font asset (e.g., "/Game/Fonts/Font_DarkFantasy_Regular")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the font was found
+            - font_path: Path to the font asset
+            - font_name: Name of the font
+            - cache_type: "Offline" or "Runtime"
+            - em_scale: Em scale factor
+            - ascent: Font ascent
+            - descent: Font descent
+            - leading: Line leading
+            - kerning: Default kerning
+            - scaling_factor: Scaling factor
+            - legacy_font_size: Legacy font size
+            - character_count: Number of characters
+            - texture_count: Number of textures
+            - is_remapped: Whether character remapping is used
+
+        Examples:
+            # Get font metadata
+            get_font_metadata(font_path="/Game/Fonts/Font_DarkFantasy_Regular")
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "font_path": font_path
+            }
+
+            logger.info(f"Getting metadata for font '{font_path}'")
+            response = unreal.send_command("get_font_metadata", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Get font metadata response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error getting font metadata: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_font(
+        ctx: Context,
+        font_name: str,
+        source_type: str,
+        ttf_file_path: str = None,
+        sdf_texture: str = None,
+        atlas_texture: str = None,
+        metrics_file: str = None,
+        path: str = "/Game/Fonts",
+        use_sdf: bool = True,
+        distance_field_spread: int = 32,
+        font_metrics: Dict[str, Any] = None
+    ) -> Dict[str, Any]:
+        """
+        Unified font creation command supporting multiple source types.
+
+        This is the recommended tool for creating font assets in Unreal Engine.
+        It consolidates TTF import, SDF texture, and offline bitmap font workflows.
+
+        Args:
+            font_name: Name of the font asset to create (e.g., "Font_CinzelTorn")
+            source_type: Type of font source. One of:
+                - "ttf": Import an external TTF file as a FontFace asset
+                - "sdf_texture": Create a FontFace from an SDF texture
+                - "offline": Create a UFont from a texture atlas and metrics JSON
+            ttf_file_path: (Required for "ttf") Absolute path to the TTF file on disk
+                Example: "E:/code/unreal-mcp/Python/font_generation/Cinzel-Torn.ttf"
+            sdf_texture: (Optional for "sdf_texture") Path to the SDF texture in UE
+                Example: "/Game/Fonts/DarkFantasy_sdf"
+            atlas_texture: (Required for "offline") Path to the texture atlas in UE
+                Example: "/Game/Fonts/DarkFantasy_atlas"
+            metrics_file: (Required for "offline") Absolute path to metrics JSON on disk
+                Example: "E:/fonts/DarkFantasy_metrics.json"
+            path: Path where to create the font asset (default: "/Game/Fonts")
+            use_sdf: (For "sdf_texture") Whether to use SDF rendering (default: True)
+            distance_field_spread: (For "sdf_texture") SDF spread value (default: 32)
+            font_metrics: Optional font metrics dict with keys:
+                - ascender: Font ascender value
+                - descender: Font descender value
+                - line_height: Line height value
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the font was created
+            - font_name: Name of the created font
+            - source_type: The source type used
+            - asset_path: Full path to the created font asset
+            - message: Status message
+
+        Examples:
+            # Import a TTF file (most common use case)
+            create_font(
+                font_name="Font_CinzelTorn",
+                source_type="ttf",
+                ttf_file_path="E:/code/unreal-mcp/Python/font_generation/Cinzel-Torn.ttf"
+            )
+
+            # Create from SDF texture
+            create_font(
+                font_name="FF_DarkFantasy",
+                source_type="sdf_texture",
+                sdf_texture="/Game/Fonts/DarkFantasy_sdf",
+                distance_field_spread=6
+            )
+
+            # Create offline/bitmap font from atlas
+            create_font(
+                font_name="Font_Bitmap",
+                source_type="offline",
+                atlas_texture="/Game/Fonts/Bitmap_atlas",
+                metrics_file="E:/fonts/bitmap_metrics.json"
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            # Validate source_type
+            valid_source_types = ["ttf", "sdf_texture", "offline"]
+            if source_type not in valid_source_types:
+                return {
+                    "success": False,
+                    "message": f"Invalid source_type '{source_type}'. Must be one of: {valid_source_types}"
+                }
+
+            # Build params based on source_type
+            params = {
+                "font_name": font_name,
+                "source_type": source_type,
+                "path": path
+            }
+
+            if source_type == "ttf":
+                if not ttf_file_path:
+                    return {"success": False, "message": "ttf_file_path is required for source_type='ttf'"}
+                params["ttf_file_path"] = ttf_file_path
+                if font_metrics:
+                    params["font_metrics"] = font_metrics
+
+            elif source_type == "sdf_texture":
+                if sdf_texture:
+                    params["sdf_texture"] = sdf_texture
+                params["use_sdf"] = use_sdf
+                params["distance_field_spread"] = distance_field_spread
+                if font_metrics:
+                    params["font_metrics"] = font_metrics
+
+            elif source_type == "offline":
+                if not atlas_texture:
+                    return {"success": False, "message": "atlas_texture is required for source_type='offline'"}
+                if not metrics_file:
+                    return {"success": False, "message": "metrics_file is required for source_type='offline'"}
+                params["atlas_texture"] = atlas_texture
+                params["metrics_file"] = metrics_file
+
+            logger.info(f"Creating font '{font_name}' with source_type='{source_type}'")
+            response = unreal.send_command("create_font", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Create font response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating font: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def start_bulk_font_import(
+        ctx: Context,
+        fonts: List[Dict[str, Any]],
+        path: str = "/Game/Fonts",
+        save: bool = True,
+        max_in_flight: int = 8
+    ) -> Dict[str, Any]:
+        """
+        Start creating many fonts in one run.
+
+        Font files and offline metrics files are read on worker threads while the editor
+        keeps running; the assets are created as their data arrives and saved together
+        at the end. Poll get_bulk_font_import with the returned job_id.
+
+        Args:
+            fonts: List of fonts, each a dict with the create_font fields:
+                - font_name: Name of the font asset
+                - source_type: "ttf" (default) or "offline"
+                - ttf_file_path: (For "ttf") Absolute path to the TTF/OTF file on disk
+                - font_metrics: (For "ttf") Optional dict with ascender/descender
+                - atlas_texture: (For "offline") Path to the texture atlas in UE
+                - metrics_file: (For "offline") Absolute path to metrics JSON on disk
+                - path: Optional folder of this font (default: the path argument)
+            path: Folder of the fonts that name none (default: "/Game/Fonts")
+            save: Whether the created assets are saved when the run finishes (default: True)
+            max_in_flight: Most fonts read on worker threads at once (default: 8)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the run was started
+            - job_id: Id to pass to get_bulk_font_import
+            - fonts_total: Number of fonts the run reports on
+
+        Example:
+            start_bulk_font_import(fonts=[
+                {"font_name": "Font_Cinzel", "ttf_file_path": "E:/fonts/Cinzel-Regular.ttf"},
+                {"font_name": "Font_CinzelBold", "ttf_file_path": "E:/fonts/Cinzel-Bold.ttf"},
+                {"font_name": "Font_Bitmap", "source_type": "offline",
+                 "atlas_texture": "/Game/Fonts/Bitmap_atlas", "metrics_file": "E:/fonts/bitmap_metrics.json"}
+            ])
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "fonts": fonts,
+                "path": path,
+                "save": save,
+                "max_in_flight": max_in_flight
+            }
+
+            logger.info(f"Starting bulk font import of {len(fonts)} font(s)")
+            response = unreal.send_command("start_bulk_font_import", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Start bulk font import response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error starting bulk font import: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def get_bulk_font_import(
+        ctx: Context,
+        job_id: int,
+        cursor: int = 0,
+        max_results: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Get the progress and per-font results of a bulk font import.
+
+        Args:
+            job_id: Id returned by start_bulk_font_import
+            cursor: Index of the first result to return; pass next_cursor of the previous call
+            max_results: Most results to return (default: 100)
+
+        Returns:
+            Dictionary containing:
+            - state: "running" or "finished"
+            - fonts_total, fonts_completed, fonts_created, fonts_failed, progress
+            - results: Per font: font_name, source_type, created, asset_path or error
+            - unsaved_packages: Packages the final save could not write (once finished)
+            - next_cursor, has_more
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "job_id": job_id,
+                "cursor": cursor,
+                "max_results": max_results
+            }
+
+            response = unreal.send_command("get_bulk_font_import", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            return response
+
+        except Exception as e:
+            error_msg = f"Error getting bulk font import: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    logger.info("Font asset tools registered successfully")
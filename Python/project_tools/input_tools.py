@@ -0,0 +1,312 @@
+"""Enhanced Input Tools for Unreal MCP."""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def register_input_tools(mcp: FastMCP):
+    """Register Enhanced Input tools with the MCP server."""
+
+    @mcp.tool()
+    def create_input_mapping(
+        ctx: Context,
+        action_name: str,
+        key: str,
+        input_type: str = "Action"
+    ) -> Dict[str, Any]:
+        """
+        Create an input mapping for the project.
+
+        Args:
+            action_name: Name of the input action
+            key: Key to bind (SpaceBar, LeftMouseButton, etc.)
+            input_type: Type of input mapping (Action or Axis)
+
+        Example:
+            create_input_mapping(action_name="Jump", key="SpaceBar")
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "action_name": action_name,
+                "key": key,
+                "input_type": input_type
+            }
+
+            logger.info(f"Creating input mapping '{action_name}' with key '{key}'")
+            response = unreal.send_command("create_input_mapping", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Input mapping creation response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating input mapping: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_enhanced_input_action(
+        ctx: Context,
+        action_name: str,
+        path: str = "/Game/Input/Actions",
+        description: str = "",
+        value_type: str = "Digital"
+    ) -> Dict[str, Any]:
+        """
+        Create an Enhanced Input Action asset.
+
+        Args:
+            action_name: Name of the input action (will add IA_ prefix if not present)
+            path: Path where to create the action asset
+            description: Optional description for the action
+            value_type: "Digital"|"Analog"|"Axis2D"|"Axis3D"
+
+        Example:
+            create_enhanced_input_action(action_name="Jump", value_type="Digital")
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "action_name": action_name,
+                "path": path,
+                "description": description,
+                "value_type": value_type
+            }
+
+            logger.info(f"Creating Enhanced Input Action '{action_name}' with value type '{value_type}'")
+            response = unreal.send_command("create_enhanced_input_action", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Enhanced Input Action creation response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating Enhanced Input Action: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_input_mapping_context(
+        ctx: Context,
+        context_name: str,
+        path: str = "/Game/Input",
+        description: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Create an Input Mapping Context asset.
+
+        Args:
+            context_name: Name of the mapping context (will add IMC_ prefix if not present)
+            path: Path where to create the context asset
+            description: Optional description for the context
+
+        Example:
+            create_input_mapping_context(context_name="Default")
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "context_name": context_name,
+                "path": path,
+                "description": description
+            }
+
+            logger.info(f"Creating Input Mapping Context '{context_name}'")
+            response = unreal.send_command("create_input_mapping_context", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Input Mapping Context creation response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating Input Mapping Context: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def add_mapping_to_context(
+        ctx: Context,
+        context_path: str,
+        action_path: str,
+        key: str,
+        shift: bool = False,
+        ctrl: bool = False,
+        alt: bool = False,
+        cmd: bool = False
+    ) -> Dict[str, Any]:
+        """
+        Add a key mapping to an Input Mapping Context.
+
+        Args:
+            context_path: Full path to the Input Mapping Context asset
+            action_path: Full path to the Input Action asset
+            key: Key to bind (SpaceBar, LeftMouseButton, etc.)
+            shift: Whether Shift modifier is required
+            ctrl: Whether Ctrl modifier is required
+            alt: Whether Alt modifier is required
+            cmd: Whether Cmd modifier is required
+
+        Example:
+            add_mapping_to_context(
+                context_path="/Game/Input/IMC_Default",
+                action_path="/Game/Input/Actions/IA_Jump",
+                key="SpaceBar"
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "context_path": context_path,
+                "action_path": action_path,
+                "key": key,
+                "shift": shift,
+                "ctrl": ctrl,
+                "alt": alt,
+                "cmd": cmd
+            }
+
+            logger.info(f"Adding mapping for '{key}' to context '{context_path}' -> action '{action_path}'")
+            response = unreal.send_command("add_mapping_to_context", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Add mapping to context response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error adding mapping to context: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def create_input_setup(
+        ctx: Context,
+        actions: List[Dict[str, Any]] = None,
+        contexts: List[Dict[str, Any]] = None,
+        action_path: str = "/Game/Input/Actions",
+        context_path: str = "/Game/Input",
+        save: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Create a whole Enhanced Input setup - actions, mapping contexts and key mappings - in one call.
+
+        Much faster than one create_enhanced_input_action, create_input_mapping_context and
+        add_mapping_to_context call per asset and key: everything is created in one pass and
+        the new packages are saved once at the end.
+
+        Args:
+            actions: List of dicts with:
+                - name: Action name (IA_ prefix added if missing)
+                - path: Folder (default: action_path)
+                - value_type: "Digital", "Analog", "Axis2D" or "Axis3D" (default: "Digital")
+                - description: Optional description
+                - modifiers, triggers: Optional, applied to every mapping of the action
+            contexts: List of dicts with:
+                - name: Context name (IMC_ prefix added if missing)
+                - path: Folder (default: context_path)
+                - description: Optional description
+                - mappings: List of {"action", "key", "modifiers", "triggers"}; "action" is the
+                  name of an action in this setup or an existing action's asset path
+            action_path: Folder of the actions that name none
+            context_path: Folder of the contexts that name none
+            save: Whether the created assets are saved (default: True)
+
+            Modifiers and triggers are class names ("Negate", "SwizzleAxis", "Hold", "Pressed")
+            or {"type": "DeadZone", "properties": {"LowerThreshold": 0.25}}.
+
+        Returns:
+            Dictionary containing:
+            - actions, contexts: Per asset: name, asset_path, created, error; contexts also
+              mappings_added and mapping_errors
+            - created, failed, mappings_added
+            - unsaved_packages: Packages that could not be saved
+
+        Examples:
+            create_input_setup(
+                actions=[
+                    {"name": "Jump"},
+                    {"name": "Move", "value_type": "Axis2D"}
+                ],
+                contexts=[{
+                    "name": "Default",
+                    "mappings": [
+                        {"action": "Jump", "key": "SpaceBar"},
+                        {"action": "Move", "key": "W", "modifiers": ["SwizzleAxis"]},
+                        {"action": "Move", "key": "S", "modifiers": ["SwizzleAxis", "Negate"]},
+                        {"action": "Move", "key": "D"},
+                        {"action": "Move", "key": "A", "modifiers": ["Negate"]}
+                    ]
+                }]
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "actions": actions or [],
+                "contexts": contexts or [],
+                "action_path": action_path,
+                "context_path": context_path,
+                "save": save
+            }
+
+            logger.info(f"Creating input setup: {len(params['actions'])} action(s), {len(params['contexts'])} context(s)")
+            response = unreal.send_command("create_input_setup", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Create input setup response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating input setup: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    logger.info("Input tools registered successfully")
@@ -0,0 +1,230 @@
+"""Struct and Enum Tools for Unreal MCP."""
+
+import logging
+from typing import Dict, Any, List
+from mcp.server.fastmcp import FastMCP, Context
+from utils.project.struct_operations import create_struct as create_struct_impl
+from utils.project.struct_operations import update_struct as update_struct_impl
+
+logger = logging.getLogger("UnrealMCP")
+
+
+def register_schema_tools(mcp: FastMCP):
+    """Register struct and enum tools with the MCP server."""
+
+    @mcp.tool()
+    def create_struct(
+        ctx: Context,
+        struct_name: str,
+        properties: List[Dict[str, str]],
+        path: str = "/Game/Blueprints",
+        description: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Create a new Unreal struct.
+
+        Args:
+            struct_name: Name of the struct to create
+            properties: List of property dictionaries, each containing:
+                        - name: Property name
+                        - type: Property type (e.g., "Boolean", "Integer", "Float", "String", "Vector", etc.)
+                        - description: (Optional) Property description
+            path: Path where to create the struct
+            description: Optional description for the struct
+
+        Examples:
+            # Create a simple Item struct
+            create_struct(
+                struct_name="Item",
+                properties=[
+                    {"name": "Name", "type": "String"},
+                    {"name": "Value", "type": "Integer"},
+                    {"name": "IsRare", "type": "Boolean"}
+                ],
+                path="/Game/DataStructures"
+            )
+        """
+        return create_struct_impl(ctx, struct_name, properties, path, description)
+
+    @mcp.tool()
+    def update_struct(
+        ctx: Context,
+        struct_name: str,
+        properties: List[Dict[str, str]],
+        path: str = "/Game/Blueprints",
+        description: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Update an existing Unreal struct.
+        Args:
+            struct_name: Name of the struct to update
+            properties: List of property dictionaries, each containing:
+                        - name: Property name
+                        - type: Property type (e.g., "Boolean", "Integer", "Float", "String", "Vector", etc.)
+                        - description: (Optional) Property description
+            path: Path where the struct exists
+            description: Optional description for the struct
+        """
+        return update_struct_impl(ctx, struct_name, properties, path, description)
+
+    @mcp.tool()
+    def create_enum(
+        ctx: Context,
+        enum_name: str,
+        values: List[Dict[str, str]],
+        path: str = "/Game/Blueprints",
+        description: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Create a new Unreal user-defined enum.
+
+        Args:
+            enum_name: Name of the enum to create (e.g., "E_ItemType")
+            values: List of enum values. Can be either:
+                    - Simple strings: ["Weapon", "Armor", "Consumable"]
+                    - Objects with name and description: [{"name": "Weapon", "description": "Melee or ranged weapons"}]
+            path: Path where to create the enum asset
+            description: Optional description for the enum (shown in Enum Description field)
+
+        Example:
+            create_enum(
+                enum_name="E_ItemType",
+                values=["Weapon", "Armor", "Consumable", "Material", "QuestItem"],
+                path="/Game/Inventory/Data",
+                description="Categories for inventory items"
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "enum_name": enum_name,
+                "values": values,
+                "path": path,
+                "description": description
+            }
+
+            logger.info(f"Creating enum '{enum_name}' with {len(values)} values at '{path}'")
+            response = unreal.send_command("create_enum", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Enum creation response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error creating enum: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    @mcp.tool()
+    def update_enum(
+        ctx: Context,
+        enum_name: str,
+        values: List[Dict[str, str]],
+        path: str = "/Game/Blueprints",
+        description: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Update an existing Unreal user-defined enum.
+
+        Args:
+            enum_name: Name of the enum to update
+            values: List of enum values
+            path: Path where the enum exists
+            description: Optional new description
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "enum_name": enum_name,
+                "values": values,
+                "path": path,
+                "description": description
+            }
+
+            response = unreal.send_command("update_enum", params)
+            return response if response else {"success": False, "message": "No response from Unreal Engine"}
+
+        except Exception as e:
+            return {"success": False, "message": f"Error updating enum: {e}"}
+
+    @mcp.tool()
+    def batch_schema_changes(
+        ctx: Context,
+        asset_path: str,
+        changes: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Apply many member changes to a user-defined struct or enum in one call.
+
+        The asset is recompiled once after all changes, so the Blueprints and DataTables
+        that use it are regenerated once instead of after every add, remove or rename.
+
+        Args:
+            asset_path: Path to the struct or enum asset
+            changes: List of changes, applied in order, each a dict with:
+                - operation: "add", "remove", "rename", "set_type" (structs only) or "set_description"
+                - name: Member (or enumerator display name) the change applies to; the new one for "add"
+                - new_name: New name, for "rename"
+                - type: Property type for struct "add" and "set_type" (e.g. "Float", "Vector", "String[]")
+                - description: Tooltip, for "add" and "set_description"
+
+        Returns:
+            Dictionary containing:
+            - success: Whether any change was applied
+            - asset_kind: "struct" or "enum"
+            - results: Per change: operation, name, success, error
+            - total, succeeded, failed
+
+        Examples:
+            batch_schema_changes(
+                asset_path="/Game/Data/S_Weapon",
+                changes=[
+                    {"operation": "add", "name": "Damage", "type": "Float"},
+                    {"operation": "rename", "name": "Rate", "new_name": "FireRate"},
+                    {"operation": "remove", "name": "Legacy"}
+                ]
+            )
+        """
+        from utils.unreal_connection_utils import get_unreal_engine_connection as get_unreal_connection
+
+        try:
+            unreal = get_unreal_connection()
+            if not unreal:
+                logger.error("Failed to connect to Unreal Engine")
+                return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+            params = {
+                "asset_path": asset_path,
+                "changes": changes
+            }
+
+            logger.info(f"Applying {len(changes)} schema change(s) to {asset_path}")
+            response = unreal.send_command("batch_schema_changes", params)
+
+            if not response:
+                logger.error("No response from Unreal Engine")
+                return {"success": False, "message": "No response from Unreal Engine"}
+
+            logger.info(f"Batch schema changes response: {response}")
+            return response
+
+        except Exception as e:
+            error_msg = f"Error in batch schema changes: {e}"
+            logger.error(error_msg)
+            return {"success": False, "message": error_msg}
+
+    logger.info("Schema tools registered successfully")
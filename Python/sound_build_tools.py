@@ -0,0 +1,374 @@
+"""
+Sound import and graph build tools for the Sound MCP Server.
+Includes: single and bulk sound file imports, Sound Cue and MetaSound builds
+from a spec and MetaSound palette search.
+"""
+
+from typing import Any, Awaitable, Callable, Dict, List
+
+
+def register_sound_build_tools(app, send: Callable[[str, Dict[str, Any]], Awaitable[Dict[str, Any]]]):
+    """Register the sound import and graph build tools on the server's app; send delivers a command to Unreal."""
+
+    # ============================================================================
+    # Sound Wave Imports
+    # ============================================================================
+
+    @app.tool()
+    async def import_sound_file(
+        source_file_path: str,
+        asset_name: str,
+        folder_path: str = "/Game/Audio"
+    ) -> Dict[str, Any]:
+        """
+        Import an audio file from disk into the Unreal Engine project.
+
+        Supports common audio formats: WAV, MP3, OGG, FLAC, AIFF.
+
+        Args:
+            source_file_path: Absolute path to the audio file on disk
+                (e.g., "C:/Users/User/Downloads/sound.mp3")
+            asset_name: Name for the imported sound wave asset (e.g., "SW_RainLoop")
+            folder_path: Content folder path for the imported asset (default: "/Game/Audio")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the import was successful
+            - path: Full asset path of the imported sound wave
+            - name: Name of the imported asset
+            - message: Success/error message
+
+        Example:
+            import_sound_file(
+                source_file_path="C:/Users/User/Downloads/rain-loop.mp3",
+                asset_name="SW_RainLoop",
+                folder_path="/Game/Audio/Ambient"
+            )
+        """
+        params = {
+            "source_file_path": source_file_path,
+            "asset_name": asset_name,
+            "folder_path": folder_path
+        }
+        return await send("import_sound_file", params)
+
+    @app.tool()
+    async def start_bulk_sound_import(
+        source_file_paths: List[str] = None,
+        source_directory: str = "",
+        recursive: bool = True,
+        folder_path: str = "/Game/Audio",
+        asset_prefix: str = "",
+        replace_existing: bool = True,
+        save: bool = True,
+        batch_size: int = 32,
+        max_in_flight: int = 16
+    ) -> Dict[str, Any]:
+        """
+        Start importing many audio files as sound waves at once.
+
+        Files are read and validated on worker threads, imported batch_size at a
+        time with one import call per batch, and all imported packages are saved
+        together at the end, so the editor stays responsive during large sound bank
+        imports. Asset names are the file names (with asset_prefix); files whose
+        names collide get a numeric suffix. Poll the progress with
+        get_bulk_sound_import.
+
+        Args:
+            source_file_paths: Absolute paths of audio files to import
+            source_directory: Directory whose audio files (wav, mp3, ogg, flac, aiff)
+                are imported too
+            recursive: Whether source_directory is searched recursively
+            folder_path: Content folder for the sound waves (default: "/Game/Audio")
+            asset_prefix: Prefix for the asset names (e.g. "SW_")
+            replace_existing: Whether existing assets of the same name are replaced
+            save: Whether the imported packages are saved when the import finishes
+            batch_size: Files imported per import call (1-1024)
+            max_in_flight: Most files validated on worker threads at once (1-64)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job started
+            - job_id: Id to poll the job with
+            - files_total: Number of files in the job
+        """
+        params: Dict[str, Any] = {
+            "recursive": recursive,
+            "folder_path": folder_path,
+            "asset_prefix": asset_prefix,
+            "replace_existing": replace_existing,
+            "save": save,
+            "batch_size": batch_size,
+            "max_in_flight": max_in_flight
+        }
+        if source_file_paths:
+            params["source_file_paths"] = source_file_paths
+        if source_directory:
+            params["source_directory"] = source_directory
+        return await send("start_bulk_sound_import", params)
+
+    @app.tool()
+    async def get_bulk_sound_import(
+        job_id: int,
+        cursor: int = 0,
+        max_results: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Read the progress and results of a bulk sound import.
+
+        Results are returned in the order the files finish; pass next_cursor back as
+        cursor to read the ones that arrived since the previous call.
+
+        Args:
+            job_id: Id returned by start_bulk_sound_import
+            cursor: Index of the first result to return
+            max_results: Most results returned by this call
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job was found
+            - state: "running" or "finished"
+            - files_total, files_completed, files_validating, files_waiting_for_batch,
+              files_imported, files_failed, batches_imported
+            - progress: Fraction of files completed
+            - unsaved_packages: Packages the final save could not write (when finished)
+            - results: Per-file {source_file_path, asset_name, imported, asset_path,
+              duration, num_channels, sample_rate, batch} or
+              {source_file_path, asset_name, imported, error}
+            - next_cursor: Cursor for the next call
+            - has_more: Whether more results are available or still to come
+        """
+        params = {"job_id": job_id, "cursor": cursor, "max_results": max_results}
+        return await send("get_bulk_sound_import", params)
+
+    # ============================================================================
+    # Sound Cue and MetaSound Builds
+    # ============================================================================
+
+    @app.tool()
+    async def build_sound_cue_from_spec(
+        sound_cue_path: str = "",
+        asset_name: str = "",
+        folder_path: str = "/Game/Audio",
+        initial_sound_wave: str = "",
+        nodes: List[Dict[str, Any]] = None,
+        connections: List[Dict[str, Any]] = None,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build a whole Sound Cue graph from one spec in a single call.
+
+        Creates every node, sets their properties and makes every connection, then
+        links the editor graph, compiles and saves the cue once. Prefer this over
+        chains of add_sound_cue_node / connect_sound_cue_nodes /
+        set_sound_cue_node_property calls, which each relink and save the cue.
+
+        Args:
+            sound_cue_path: Existing Sound Cue to build into. If empty, a new one is
+                created from asset_name/folder_path/initial_sound_wave.
+            asset_name: Name of the Sound Cue to create
+            folder_path: Folder for the new Sound Cue
+            initial_sound_wave: Optional sound wave for the new cue's first WavePlayer
+            nodes: Nodes, each with a spec-local key the connections refer to, the
+                add_sound_cue_node fields, and optional properties as
+                set_sound_cue_node_property takes them:
+                [{"key": "mod", "node_type": "Modulator", "pos_x": -200, "pos_y": 0,
+                  "properties": {"pitch_min": 0.9, "pitch_max": 1.1}}]
+            connections: Connections. source_node/target_node is a node key or an
+                existing node ID; target_node may be "Output" for the cue's root.
+                [{"source_node": "wave", "target_node": "mod", "target_pin_index": 0},
+                 {"source_node": "mod", "target_node": "Output"}]
+            compile: Whether to compile the cue at the end
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every element was added
+            - sound_cue_path: Path to the Sound Cue
+            - created: Whether the Sound Cue was created by this call
+            - node_ids: Node ID of each node, by key
+            - element_count / failed_count: Elements applied and how many failed
+            - elements: Per element kind (node/property/connection), name, success and error
+            - has_output: Whether the cue's output is connected
+            - duration / max_distance: Aggregate values when compiled
+            - message: Summary
+
+        Example:
+            build_sound_cue_from_spec(
+                asset_name="SC_Footsteps",
+                nodes=[
+                    {"key": "step1", "node_type": "WavePlayer", "sound_wave_path": "/Game/Audio/SW_Step1"},
+                    {"key": "step2", "node_type": "WavePlayer", "sound_wave_path": "/Game/Audio/SW_Step2"},
+                    {"key": "rand", "node_type": "Random"}
+                ],
+                connections=[
+                    {"source_node": "step1", "target_node": "rand", "target_pin_index": 0},
+                    {"source_node": "step2", "target_node": "rand", "target_pin_index": 1},
+                    {"source_node": "rand", "target_node": "Output"}
+                ]
+            )
+        """
+        params: Dict[str, Any] = {
+            "folder_path": folder_path,
+            "nodes": nodes or [],
+            "connections": connections or [],
+            "compile": compile
+        }
+        if sound_cue_path:
+            params["sound_cue_path"] = sound_cue_path
+        if asset_name:
+            params["asset_name"] = asset_name
+        if initial_sound_wave:
+            params["initial_sound_wave"] = initial_sound_wave
+
+        return await send("build_sound_cue_from_spec", params)
+
+    @app.tool()
+    async def build_metasound_from_spec(
+        metasound_path: str = "",
+        asset_name: str = "",
+        folder_path: str = "/Game/Audio/MetaSounds",
+        output_format: str = "Stereo",
+        is_one_shot: bool = True,
+        inputs: List[Dict[str, Any]] = None,
+        outputs: List[Dict[str, Any]] = None,
+        nodes: List[Dict[str, Any]] = None,
+        edges: List[Dict[str, Any]] = None,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build a whole MetaSound graph from one spec in a single call.
+
+        Adds graph inputs and outputs, nodes, node input defaults and connections
+        with one document builder, then synchronizes, compiles and saves the
+        MetaSound once. Prefer this over chains of add_metasound_node /
+        connect_metasound_nodes / set_metasound_input calls, which each rebuild
+        and save the graph.
+
+        Args:
+            metasound_path: Existing MetaSound to build into. If empty, a new one is
+                created from asset_name/folder_path/output_format/is_one_shot, or
+                reused if it already exists.
+            asset_name: Name of the MetaSound to create
+            folder_path: Folder for the new MetaSound
+            output_format: "Mono", "Stereo" or "Quad" for a new MetaSound
+            is_one_shot: Whether a new MetaSound finishes on its own
+            inputs: Graph inputs, as add_metasound_input takes them:
+                [{"input_name": "Frequency", "data_type": "Float", "default_value": "440"}]
+            outputs: Graph outputs, as add_metasound_output takes them:
+                [{"output_name": "Out", "data_type": "Audio"}]
+            nodes: Nodes, each with a spec-local key the edges refer to, the
+                add_metasound_node fields, and optional input defaults:
+                [{"key": "osc", "node_class_name": "Sine", "node_variant": "Audio",
+                  "pos_x": 0, "pos_y": 0, "inputs": {"Frequency": 440}}]
+            edges: Connections. from_node/to_node is a node key, a graph input
+                (from) or output (to) name, a graph input/output node name already in
+                the MetaSound, or a node GUID. The pin may be omitted for graph
+                inputs and outputs.
+                [{"from_node": "osc", "from_pin": "Audio", "to_node": "Out", "to_pin": ""}]
+            compile: Whether to register the graph for playback at the end
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every element was added and the graph compiled
+            - metasound_path: Path to the MetaSound
+            - created: Whether the MetaSound was created by this call
+            - node_ids: GUID of each node, by key
+            - element_count / failed_count: Elements applied and how many failed
+            - elements: Per element kind, name, success and error
+            - compiled / compile_error: Compile result when requested
+            - message: Summary
+
+        Example:
+            build_metasound_from_spec(
+                asset_name="MS_Tone",
+                inputs=[{"input_name": "Frequency", "data_type": "Float", "default_value": "440"}],
+                outputs=[{"output_name": "Out", "data_type": "Audio"}],
+                nodes=[{"key": "osc", "node_class_name": "Sine", "node_variant": "Audio"}],
+                edges=[
+                    {"from_node": "Frequency", "to_node": "osc", "to_pin": "Frequency"},
+                    {"from_node": "osc", "from_pin": "Audio", "to_node": "Out"}
+                ]
+            )
+        """
+        params = {
+            "folder_path": folder_path,
+            "output_format": output_format,
+            "is_one_shot": is_one_shot,
+            "inputs": inputs or [],
+            "outputs": outputs or [],
+            "nodes": nodes or [],
+            "edges": edges or [],
+            "compile": compile
+        }
+        if metasound_path:
+            params["metasound_path"] = metasound_path
+        if asset_name:
+            params["asset_name"] = asset_name
+
+        return await send("build_metasound_from_spec", params)
+
+    @app.tool()
+    async def search_metasound_palette(
+        search_query: str = "",
+        max_results: int = 50,
+        offset: int = 0,
+        input_types: List[str] = None,
+        output_types: List[str] = None
+    ) -> Dict[str, Any]:
+        """
+        Search the MetaSound node palette for available node classes.
+
+        Use this tool to discover available MetaSound nodes before adding them.
+        Returns the exact namespace, name, and variant needed for add_metasound_node.
+        Results are ranked (name matches first) and paged.
+
+        Args:
+            search_query: Search words, all of which must match a node (name,
+                         display name, namespace, keywords, category, description).
+                         Empty string returns all nodes.
+            max_results: Maximum number of results to return (default: 50)
+            offset: Index of the first result to return, for paging
+            input_types: Only nodes with an input of each of these data types,
+                         e.g. ["Float"]
+            output_types: Only nodes with an output of each of these data types,
+                          e.g. ["Trigger"]
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the search was successful
+            - count: Number of results in this page
+            - total_count: Number of matching nodes
+            - offset: Index of the first result
+            - has_more: Whether more results follow this page
+            - results: Array of node class info with:
+                - namespace: Node namespace (e.g., "UE")
+                - name: Node name (e.g., "Sine")
+                - variant: Node variant (e.g., "Audio" for oscillators)
+                - display_name: Human-readable name
+                - description: Node description
+                - category: Category path
+                - full_name: Full class name for reference
+                - score: Match score
+                - inputs: Array of input pins with name and type
+                - outputs: Array of output pins with name and type
+
+        Example:
+            # Search for oscillator nodes
+            search_metasound_palette(search_query="sine")
+
+            # Search for envelope nodes
+            search_metasound_palette(search_query="envelope")
+
+            # Nodes taking a Float and producing a Trigger
+            search_metasound_palette(input_types=["Float"], output_types=["Trigger"])
+        """
+        params = {
+            "search_query": search_query,
+            "max_results": max_results,
+            "offset": offset
+        }
+        if input_types:
+            params["input_types"] = input_types
+        if output_types:
+            params["output_types"] = output_types
+        return await send("search_metasound_palette", params)
@@ -12,6 +12,8 @@ from typing import Any, Dict, List
 
 from fastmcp import FastMCP
 
+from sound_build_tools import register_sound_build_tools
+
 # Initialize FastMCP app
 app = FastMCP("Sound MCP Server")
 
@@ -66,73 +68,59 @@ async def send_tcp_command(command_type: str, params: Dict[str, Any]) -> Dict[st
 # ============================================================================
 
 @app.tool()
-async def import_sound_file(
-    source_file_path: str,
-    asset_name: str,
-    folder_path: str = "/Game/Audio"
+async def get_sound_wave_metadata(
+    sound_wave_path: str = "",
+    sound_wave_paths: List[str] = None,
+    allow_load: bool = True,
+    include_envelope: bool = False
 ) -> Dict[str, Any]:
     """
-    Import an audio file from disk into the Unreal Engine project.
+    Get metadata about a sound wave asset, or about many in one call.
 
-    Supports common audio formats: WAV, MP3, OGG, FLAC, AIFF.
-
-    Args:
-        source_file_path: Absolute path to the audio file on disk
-            (e.g., "C:/Users/User/Downloads/sound.mp3")
-        asset_name: Name for the imported sound wave asset (e.g., "SW_RainLoop")
-        folder_path: Content folder path for the imported asset (default: "/Game/Audio")
-
-    Returns:
-        Dictionary containing:
-        - success: Whether the import was successful
-        - path: Full asset path of the imported sound wave
-        - name: Name of the imported asset
-        - message: Success/error message
-
-    Example:
-        import_sound_file(
-            source_file_path="C:/Users/User/Downloads/rain-loop.mp3",
-            asset_name="SW_RainLoop",
-            folder_path="/Game/Audio/Ambient"
-        )
-    """
-    params = {
-        "source_file_path": source_file_path,
-        "asset_name": asset_name,
-        "folder_path": folder_path
-    }
-    return await send_tcp_command("import_sound_file", params)
-
-
-@app.tool()
-async def get_sound_wave_metadata(sound_wave_path: str) -> Dict[str, Any]:
-    """
-    Get metadata about a sound wave asset.
-
-    Returns duration, sample rate, channels, volume, pitch, and streaming info.
+    Returns duration, sample rate, channels, volume, pitch, streaming info and the
+    peak/RMS level of the imported audio. Each wave's answer is kept in a summary
+    cache that persists across editor sessions (Saved/UnrealMCP/SoundWaveSummaries.json)
+    and is checked against the package file, so repeated queries do not load the wave.
 
     Args:
         sound_wave_path: Full path to the sound wave asset (e.g., "/Game/Audio/Sounds/SW_Explosion")
+        sound_wave_paths: Several sound wave paths; used instead of sound_wave_path
+        allow_load: Whether a wave with no kept summary may be loaded to compute one.
+                    If False, such waves are described from their asset registry tags
+                    only (source "registry", no levels), which suits browsing large catalogs.
+        include_envelope: Whether to add the 64-bucket peak envelope of each wave
 
     Returns:
         Dictionary containing:
         - success: Whether the operation was successful
         - name: Name of the sound wave
         - path: Asset path
+        - source: "cache", "loaded" or "registry"
         - duration: Duration in seconds
         - sample_rate: Sample rate in Hz
         - num_channels: Number of audio channels
         - is_looping: Whether the sound loops
-        - volume: Base volume multiplier
-        - pitch: Base pitch multiplier
-        - is_streaming: Whether the sound uses streaming
+        - volume: Base volume multiplier (not reported from the registry)
+        - pitch: Base pitch multiplier (not reported from the registry)
+        - is_streaming: Whether the sound uses streaming (not reported from the registry)
+        - has_levels: Whether peak/rms are known
+        - peak, peak_db, rms, rms_db: Sample peak and RMS, linear (0-1) and in dBFS
+        - envelope: Peak per time slice, 0-1 (only with include_envelope)
+        With sound_wave_paths, the response instead holds requested_count, found_count
+        and sound_waves: one such object per path, each with its own success/error.
 
     Example:
         get_sound_wave_metadata(sound_wave_path="/Game/Audio/Sounds/SW_Explosion")
+        get_sound_wave_metadata(sound_wave_paths=["/Game/Audio/SW_A", "/Game/Audio/SW_B"], allow_load=False)
     """
-    params = {
-        "sound_wave_path": sound_wave_path
+    params: Dict[str, Any] = {
+        "allow_load": allow_load,
+        "include_envelope": include_envelope
     }
+    if sound_wave_paths:
+        params["sound_wave_paths"] = sound_wave_paths
+    else:
+        params["sound_wave_path"] = sound_wave_path
     return await send_tcp_command("get_sound_wave_metadata", params)
 
 
@@ -1102,52 +1090,12 @@ async def compile_metasound(metasound_path: str) -> Dict[str, Any]:
     return await send_tcp_command("compile_metasound", params)
 
 
-@app.tool()
-async def search_metasound_palette(
-    search_query: str = "",
-    max_results: int = 50
-) -> Dict[str, Any]:
-    """
-    Search the MetaSound node palette for available node classes.
+async def _send_command(command_type: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    # Looks send_tcp_command up on every call, so the gateway's shared connection applies to these tools too
+    return await send_tcp_command(command_type, params)
 
-    Use this tool to discover available MetaSound nodes before adding them.
-    Returns the exact namespace, name, and variant needed for add_metasound_node.
-
-    Args:
-        search_query: Search term to filter nodes (searches name, namespace,
-                     keywords, category). Empty string returns all nodes.
-        max_results: Maximum number of results to return (default: 50)
 
-    Returns:
-        Dictionary containing:
-        - success: Whether the search was successful
-        - count: Number of results
-        - results: Array of node class info with:
-            - namespace: Node namespace (e.g., "UE")
-            - name: Node name (e.g., "Sine")
-            - variant: Node variant (e.g., "Audio" for oscillators)
-            - display_name: Human-readable name
-            - description: Node description
-            - category: Category path
-            - full_name: Full class name for reference
-            - inputs: Array of input pins with name and type
-            - outputs: Array of output pins with name and type
-
-    Example:
-        # Search for oscillator nodes
-        search_metasound_palette(search_query="sine")
-
-        # Search for envelope nodes
-        search_metasound_palette(search_query="envelope")
-
-        # List all trigger nodes
-        search_metasound_palette(search_query="trigger")
-    """
-    params = {
-        "search_query": search_query,
-        "max_results": max_results
-    }
-    return await send_tcp_command("search_metasound_palette", params)
+register_sound_build_tools(app, _send_command)
 
 
 if __name__ == "__main__":
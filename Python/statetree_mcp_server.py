@@ -13,6 +13,8 @@ from typing import Any, Dict, List
 
 from fastmcp import FastMCP
 
+from statetree_tools import register_statetree_tools
+
 # Initialize FastMCP app
 app = FastMCP("StateTree MCP Server")
 
@@ -248,33 +250,63 @@ async def add_task_to_state(
 
 
 @app.tool()
-async def compile_state_tree(state_tree_path: str) -> Dict[str, Any]:
+async def compile_state_tree(
+    state_tree_path: str,
+    validate_only: bool = False,
+    force: bool = False
+) -> Dict[str, Any]:
     """
     Compile a StateTree for runtime use.
 
     This validates the StateTree structure and prepares it for execution.
     Should be called after making changes to ensure the tree is valid.
+    A compile is skipped when nothing changed since the last successful compile.
 
     Args:
         state_tree_path: Path to the StateTree asset
+        validate_only: Only check schema, bindings and node data; the asset's compiled
+            data is left as it is and nothing is saved (default: False)
+        force: Compile even if the StateTree is unchanged since its last compile (default: False)
 
     Returns:
         Dictionary containing:
-        - success: Whether compilation was successful
+        - success: Whether compilation (or validation) was successful
         - state_tree_name: Name of the compiled StateTree
+        - validate_only: Whether only validation ran
+        - up_to_date: Whether the StateTree was unchanged since its last compile
+        - messages: Compiler warnings (validate_only)
         - message: Success/error message
     """
     params = {"state_tree_path": state_tree_path}
+    if validate_only:
+        params["validate_only"] = True
+    if force:
+        params["force"] = True
     return await send_tcp_command("compile_state_tree", params)
 
 
 @app.tool()
-async def get_state_tree_metadata(state_tree_path: str) -> Dict[str, Any]:
+async def get_state_tree_metadata(
+    state_tree_path: str,
+    state_name: str = "",
+    max_depth: int = -1,
+    fields: List[str] = None,
+    since_revision: int = -1
+) -> Dict[str, Any]:
     """
     Get metadata from a StateTree including its structure, states, tasks, and transitions.
 
+    Every result carries a revision. Pass it back as since_revision to receive only
+    the states that changed since that read instead of the whole tree.
+
     Args:
         state_tree_path: Path to the StateTree asset
+        state_name: State (name or ID) whose subtree is returned; empty for the whole tree
+        max_depth: Levels of children returned below the starting states; -1 for all
+        fields: Fields to return, e.g. ["tasks", "children"]. State fields: enabled, type,
+            selection_behavior, tasks, transitions, enter_condition_count, children.
+            Tree fields: schema, evaluators. name and id are always returned. Empty for all.
+        since_revision: Revision of an earlier read; -1 for a full read
 
     Returns:
         Dictionary containing:
@@ -282,9 +314,11 @@ async def get_state_tree_metadata(state_tree_path: str) -> Dict[str, Any]:
         - metadata: Object containing:
             - name: StateTree name
             - path: Full asset path
+            - revision: Revision of this read
+            - full: False when only changes since since_revision are returned
             - schema: Schema class name
             - evaluators: Array of global evaluators
-            - states: Hierarchical array of states, each with:
+            - states (full reads): Hierarchical array of states, each with:
                 - name: State name
                 - id: State GUID
                 - enabled: Whether state is enabled
@@ -292,9 +326,22 @@ async def get_state_tree_metadata(state_tree_path: str) -> Dict[str, Any]:
                 - selection_behavior: Child selection behavior
                 - tasks: Array of tasks in this state
                 - transitions: Array of transitions from this state
-                - children: Nested child states
-    """
-    params = {"state_tree_path": state_tree_path}
+                - children: Nested child states (child_count below max_depth)
+            - changed_states (change reads): Flat array of changed states with
+              parent_id, depth and child_ids instead of children
+            - removed_state_ids (change reads): IDs of states removed since since_revision
+            - globals_changed (change reads): Whether schema/evaluators changed; they are
+              only included when they did
+    """
+    params: Dict[str, Any] = {
+        "state_tree_path": state_tree_path,
+        "max_depth": max_depth,
+        "since_revision": since_revision
+    }
+    if state_name:
+        params["state_name"] = state_name
+    if fields:
+        params["fields"] = fields
     return await send_tcp_command("get_state_tree_metadata", params)
 
 
@@ -568,6 +615,7 @@ async def get_state_tree_diagnostics(state_tree_path: str) -> Dict[str, Any]:
             - name: StateTree name
             - is_valid: Whether the tree compiles successfully
             - messages: Array of diagnostic messages
+            - revision: Metadata revision the counts were taken at (see get_state_tree_metadata)
             - state_count: Number of states
             - task_count: Number of tasks
             - transition_count: Number of transitions
@@ -577,64 +625,6 @@ async def get_state_tree_diagnostics(state_tree_path: str) -> Dict[str, Any]:
     return await send_tcp_command("get_state_tree_diagnostics", params)
 
 
-@app.tool()
-async def get_available_tasks() -> Dict[str, Any]:
-    """
-    Get a list of all available StateTree task types.
-
-    Use this to discover what tasks can be added to states. The returned
-    struct paths can be used with add_task_to_state.
-
-    Returns:
-        Dictionary containing:
-        - success: Whether retrieval was successful
-        - tasks: Array of available tasks, each with:
-            - path: Full struct path (use this with add_task_to_state)
-            - name: Display name
-        - count: Total number of available tasks
-    """
-    return await send_tcp_command("get_available_tasks", {})
-
-
-@app.tool()
-async def get_available_conditions() -> Dict[str, Any]:
-    """
-    Get a list of all available StateTree condition types.
-
-    Use this to discover what conditions can be added to transitions and states.
-    The returned struct paths can be used with add_condition_to_transition
-    and add_enter_condition.
-
-    Returns:
-        Dictionary containing:
-        - success: Whether retrieval was successful
-        - conditions: Array of available conditions, each with:
-            - path: Full struct path
-            - name: Display name
-        - count: Total number of available conditions
-    """
-    return await send_tcp_command("get_available_conditions", {})
-
-
-@app.tool()
-async def get_available_evaluators() -> Dict[str, Any]:
-    """
-    Get a list of all available StateTree evaluator types.
-
-    Use this to discover what evaluators can be added to the StateTree.
-    The returned struct paths can be used with add_evaluator.
-
-    Returns:
-        Dictionary containing:
-        - success: Whether retrieval was successful
-        - evaluators: Array of available evaluators, each with:
-            - path: Full struct path
-            - name: Display name
-        - count: Total number of available evaluators
-    """
-    return await send_tcp_command("get_available_evaluators", {})
-
-
 # ============================================================================
 # Section 1 - Property Binding Commands
 # ============================================================================
@@ -848,12 +838,23 @@ async def set_context_requirements(
 # ============================================================================
 
 @app.tool()
-async def get_blueprint_state_tree_types() -> Dict[str, Any]:
+async def get_blueprint_state_tree_types(
+    filter: str = "",
+    offset: int = 0,
+    limit: int = 0
+) -> Dict[str, Any]:
     """
     Get Blueprint-based StateTree types (tasks, conditions, evaluators) in the project.
 
     Use this to discover custom Blueprint tasks/conditions/evaluators that can be used
-    in addition to the built-in C++ types.
+    in addition to the built-in C++ types. Blueprints are classified by their native
+    parent class without being loaded, and the result is cached until a Blueprint
+    asset changes or compiles.
+
+    Args:
+        filter: Optional case-insensitive text the type name or path must contain
+        offset: Number of matching types to skip, per category
+        limit: Maximum number of types to return per category (0 = all)
 
     Returns:
         Dictionary containing:
@@ -862,8 +863,13 @@ async def get_blueprint_state_tree_types() -> Dict[str, Any]:
             - blueprint_tasks: Array of Blueprint task types
             - blueprint_conditions: Array of Blueprint condition types
             - blueprint_evaluators: Array of Blueprint evaluator types
+            - total_counts: Matching types per category before paging
+            - has_more: Whether any category has more matching types after this page
     """
-    return await send_tcp_command("get_blueprint_state_tree_types", {})
+    params = {"offset": offset, "limit": limit}
+    if filter:
+        params["filter"] = filter
+    return await send_tcp_command("get_blueprint_state_tree_types", params)
 
 
 # ============================================================================
@@ -1123,28 +1129,36 @@ async def add_gameplay_tag_to_state(
 async def query_states_by_tag(
     state_tree_path: str,
     gameplay_tag: str,
-    exact_match: bool = False
+    exact_match: bool = False,
+    include_linked: bool = True
 ) -> Dict[str, Any]:
     """
     Query states by gameplay tag.
 
-    Find all states that have a specific tag or match a tag hierarchy.
+    Find all states that have a specific tag or match a tag hierarchy. Answered from a
+    per-tree tag index kept current as tags and states change.
 
     Args:
         state_tree_path: Path to the StateTree asset
         gameplay_tag: Gameplay tag to search for
         exact_match: If True, only match exact tag; if False, include child tags (default: False)
+        include_linked: If True, also search the StateTrees run by LinkedAsset states,
+            recursively (default: True)
 
     Returns:
         Dictionary containing:
         - success: Whether query was successful
-        - states: Array of state names matching the tag
+        - states: Array of state names matching the tag, in tree order
         - count: Number of matching states
+        - linked_states: With include_linked, matches in linked StateTrees as
+          {state_tree_path, state_name, state_id}
+        - linked_count: Number of linked matches
     """
     params = {
         "state_tree_path": state_tree_path,
         "gameplay_tag": gameplay_tag,
-        "exact_match": exact_match
+        "exact_match": exact_match,
+        "include_linked": include_linked
     }
     return await send_tcp_command("query_states_by_tag", params)
 
@@ -1192,6 +1206,8 @@ async def get_current_active_states(
     Get currently active states during PIE.
 
     Use this to see which states are currently being executed in a running StateTree.
+    The states are replayed from the events recorded by start_state_tree_recording,
+    so a recording must be active while the tree runs.
 
     Args:
         state_tree_path: Path to the StateTree asset
@@ -1299,7 +1315,8 @@ async def set_task_properties(
         state_tree_path: Path to the StateTree asset
         state_name: Name of the state containing the task
         task_index: Index of the task to modify (0-based)
-        properties: Dict of properties to set on the task
+        properties: Dict of property paths to values, e.g. {"Duration": 2.0, "Settings.Radius": 300};
+            paths are looked up in the task's instance data, then in the task itself
 
     Returns:
         Dictionary containing:
@@ -1354,7 +1371,8 @@ async def set_evaluator_properties(
     Args:
         state_tree_path: Path to the StateTree asset
         evaluator_index: Index of the evaluator to modify (0-based)
-        properties: Dict of properties to set on the evaluator
+        properties: Dict of property paths to values, e.g. {"Duration": 2.0, "Settings.Radius": 300};
+            paths are looked up in the evaluator's instance data, then in the evaluator itself
 
     Returns:
         Dictionary containing:
@@ -1727,139 +1745,14 @@ async def set_state_selection_weight(
     return await send_tcp_command("set_state_selection_weight", params)
 
 
-# ============================================================================
-# Section 15 - Batch Operations Commands
-# ============================================================================
-
-@app.tool()
-async def batch_add_states(
-    state_tree_path: str,
-    states: List[Dict[str, Any]]
-) -> Dict[str, Any]:
-    """
-    Add multiple states to a StateTree in a single operation.
-
-    Use this to efficiently create complex state hierarchies.
-
-    Args:
-        state_tree_path: Path to the StateTree asset
-        states: Array of state definitions, each containing:
-            - state_name: Name of the state (required)
-            - parent_state_name: Parent state name (optional, empty for root)
-            - state_type: Type of state (optional, default: "State")
-            - selection_behavior: Child selection behavior (optional)
-            - enabled: Whether state is enabled (optional, default: True)
-
-    Returns:
-        Dictionary containing:
-        - success: Whether batch operation was successful
-        - states_added: Number of states successfully added
-        - message: Success/error message
-    """
-    params = {
-        "state_tree_path": state_tree_path,
-        "states": states
-    }
-    return await send_tcp_command("batch_add_states", params)
-
-
-@app.tool()
-async def batch_add_transitions(
-    state_tree_path: str,
-    transitions: List[Dict[str, Any]]
-) -> Dict[str, Any]:
-    """
-    Add multiple transitions to a StateTree in a single operation.
-
-    Use this to efficiently set up complex transition networks.
-
-    Args:
-        state_tree_path: Path to the StateTree asset
-        transitions: Array of transition definitions, each containing:
-            - source_state_name: Source state name (required)
-            - target_state_name: Target state name (optional, for GotoState)
-            - trigger: Trigger type (optional, default: "OnStateCompleted")
-            - transition_type: Transition type (optional, default: "GotoState")
-            - priority: Priority level (optional, default: "Normal")
-
-    Returns:
-        Dictionary containing:
-        - success: Whether batch operation was successful
-        - transitions_added: Number of transitions successfully added
-        - message: Success/error message
-    """
-    params = {
-        "state_tree_path": state_tree_path,
-        "transitions": transitions
-    }
-    return await send_tcp_command("batch_add_transitions", params)
-
-
-# ============================================================================
-# Section 16 - Validation and Debugging Commands
-# ============================================================================
-
-@app.tool()
-async def validate_all_bindings(state_tree_path: str) -> Dict[str, Any]:
-    """
-    Validate all property bindings in a StateTree.
-
-    Use this to check for broken or invalid bindings that could cause runtime errors.
-
-    Args:
-        state_tree_path: Path to the StateTree asset
 
-    Returns:
-        Dictionary containing:
-        - success: Whether validation completed
-        - validation_results: Object containing:
-            - total_bindings: Total number of bindings checked
-            - valid_bindings: Number of valid bindings
-            - invalid_bindings: Number of invalid bindings
-            - errors: Array of binding error details
-            - warnings: Array of binding warnings
-    """
-    params = {"state_tree_path": state_tree_path}
-    return await send_tcp_command("validate_all_bindings", params)
 
+async def _send_command(command_type: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    # Looks send_tcp_command up on every call, so the gateway's shared connection applies to these tools too
+    return await send_tcp_command(command_type, params)
 
-@app.tool()
-async def get_state_execution_history(
-    state_tree_path: str,
-    actor_path: str = "",
-    max_entries: int = 100
-) -> Dict[str, Any]:
-    """
-    Get state execution history from a running StateTree (PIE debugging).
-
-    Use this to inspect the sequence of states that have been executed during
-    a play session for debugging AI behavior.
-
-    Args:
-        state_tree_path: Path to the StateTree asset
-        actor_path: Path to the actor running the StateTree (optional)
-        max_entries: Maximum number of history entries to return (default: 100)
-
-    Returns:
-        Dictionary containing:
-        - success: Whether retrieval was successful
-        - execution_history: Object containing:
-            - state_tree_path: Path to the StateTree
-            - actor_path: Actor running the tree
-            - entries: Array of execution entries, each with:
-                - state_name: Name of executed state
-                - timestamp: When state was entered
-                - duration: How long state was active (if exited)
-                - exit_reason: Why state was exited (if applicable)
-    """
-    params = {
-        "state_tree_path": state_tree_path,
-        "max_entries": max_entries
-    }
-    if actor_path:
-        params["actor_path"] = actor_path
 
-    return await send_tcp_command("get_state_execution_history", params)
+register_statetree_tools(app, _send_command)
 
 
 # ============================================================================
@@ -0,0 +1,501 @@
+"""
+StateTree catalog, batch and debugging tools for the StateTree MCP Server.
+Includes: task, condition and evaluator type listings, batch edits, spec builds,
+binding validation and PIE execution recording.
+"""
+
+from typing import Any, Awaitable, Callable, Dict, List
+
+
+def register_statetree_tools(app, send: Callable[[str, Dict[str, Any]], Awaitable[Dict[str, Any]]]):
+    """Register the StateTree catalog, batch and debugging tools on the server's app; send delivers a command to Unreal."""
+
+    # ============================================================================
+    # Node Type Catalog Commands
+    # ============================================================================
+
+    @app.tool()
+    async def get_available_tasks(
+        filter: str = "",
+        schema_class: str = "",
+        state_tree_path: str = "",
+        offset: int = 0,
+        limit: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Get a list of all available StateTree task types.
+
+        Use this to discover what tasks can be added to states. The returned
+        struct paths can be used with add_task_to_state.
+
+        The list is cached per schema and refreshed when modules load, so repeated
+        calls are cheap; narrow it with filter and page through it with offset/limit.
+
+        Args:
+            filter: Optional case-insensitive text the task name or path must contain
+            schema_class: Optional schema class; only tasks it allows are listed
+            state_tree_path: Optional StateTree whose schema filters the list (when schema_class is empty)
+            offset: Number of matching tasks to skip
+            limit: Maximum number of tasks to return (0 = all)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether retrieval was successful
+            - tasks: Array of available tasks, sorted by name, each with:
+                - path: Full struct path (use this with add_task_to_state)
+                - name: Display name
+            - count: Number of tasks returned
+            - total_count: Number of matching tasks before paging
+            - offset: Offset of the returned page
+            - has_more: Whether more matching tasks follow this page
+        """
+        params = {"offset": offset, "limit": limit}
+        if filter:
+            params["filter"] = filter
+        if schema_class:
+            params["schema_class"] = schema_class
+        if state_tree_path:
+            params["state_tree_path"] = state_tree_path
+        return await send("get_available_tasks", params)
+
+
+    @app.tool()
+    async def get_available_conditions(
+        filter: str = "",
+        schema_class: str = "",
+        state_tree_path: str = "",
+        offset: int = 0,
+        limit: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Get a list of all available StateTree condition types.
+
+        Use this to discover what conditions can be added to transitions and states.
+        The returned struct paths can be used with add_condition_to_transition
+        and add_enter_condition.
+
+        The list is cached per schema and refreshed when modules load, so repeated
+        calls are cheap; narrow it with filter and page through it with offset/limit.
+
+        Args:
+            filter: Optional case-insensitive text the condition name or path must contain
+            schema_class: Optional schema class; only conditions it allows are listed
+            state_tree_path: Optional StateTree whose schema filters the list (when schema_class is empty)
+            offset: Number of matching conditions to skip
+            limit: Maximum number of conditions to return (0 = all)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether retrieval was successful
+            - conditions: Array of available conditions, sorted by name, each with:
+                - path: Full struct path
+                - name: Display name
+            - count: Number of conditions returned
+            - total_count: Number of matching conditions before paging
+            - offset: Offset of the returned page
+            - has_more: Whether more matching conditions follow this page
+        """
+        params = {"offset": offset, "limit": limit}
+        if filter:
+            params["filter"] = filter
+        if schema_class:
+            params["schema_class"] = schema_class
+        if state_tree_path:
+            params["state_tree_path"] = state_tree_path
+        return await send("get_available_conditions", params)
+
+
+    @app.tool()
+    async def get_available_evaluators(
+        filter: str = "",
+        schema_class: str = "",
+        state_tree_path: str = "",
+        offset: int = 0,
+        limit: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Get a list of all available StateTree evaluator types.
+
+        Use this to discover what evaluators can be added to the StateTree.
+        The returned struct paths can be used with add_evaluator.
+
+        The list is cached per schema and refreshed when modules load, so repeated
+        calls are cheap; narrow it with filter and page through it with offset/limit.
+
+        Args:
+            filter: Optional case-insensitive text the evaluator name or path must contain
+            schema_class: Optional schema class; only evaluators it allows are listed
+            state_tree_path: Optional StateTree whose schema filters the list (when schema_class is empty)
+            offset: Number of matching evaluators to skip
+            limit: Maximum number of evaluators to return (0 = all)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether retrieval was successful
+            - evaluators: Array of available evaluators, sorted by name, each with:
+                - path: Full struct path
+                - name: Display name
+            - count: Number of evaluators returned
+            - total_count: Number of matching evaluators before paging
+            - offset: Offset of the returned page
+            - has_more: Whether more matching evaluators follow this page
+        """
+        params = {"offset": offset, "limit": limit}
+        if filter:
+            params["filter"] = filter
+        if schema_class:
+            params["schema_class"] = schema_class
+        if state_tree_path:
+            params["state_tree_path"] = state_tree_path
+        return await send("get_available_evaluators", params)
+
+    # ============================================================================
+    # Section 15 - Batch Operations Commands
+    # ============================================================================
+
+    @app.tool()
+    async def batch_add_states(
+        state_tree_path: str,
+        states: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Add multiple states to a StateTree in a single operation.
+
+        Use this to efficiently create complex state hierarchies.
+
+        Args:
+            state_tree_path: Path to the StateTree asset
+            states: Array of state definitions, each containing:
+                - state_name: Name of the state (required)
+                - parent_state_name: Parent state name (optional, empty for root)
+                - state_type: Type of state (optional, default: "State")
+                - selection_behavior: Child selection behavior (optional)
+                - enabled: Whether state is enabled (optional, default: True)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether batch operation was successful
+            - states_added: Number of states successfully added
+            - message: Success/error message
+        """
+        params = {
+            "state_tree_path": state_tree_path,
+            "states": states
+        }
+        return await send("batch_add_states", params)
+
+
+    @app.tool()
+    async def batch_add_transitions(
+        state_tree_path: str,
+        transitions: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Add multiple transitions to a StateTree in a single operation.
+
+        Use this to efficiently set up complex transition networks.
+
+        Args:
+            state_tree_path: Path to the StateTree asset
+            transitions: Array of transition definitions, each containing:
+                - source_state_name: Source state name (required)
+                - target_state_name: Target state name (optional, for GotoState)
+                - trigger: Trigger type (optional, default: "OnStateCompleted")
+                - transition_type: Transition type (optional, default: "GotoState")
+                - priority: Priority level (optional, default: "Normal")
+
+        Returns:
+            Dictionary containing:
+            - success: Whether batch operation was successful
+            - transitions_added: Number of transitions successfully added
+            - message: Success/error message
+        """
+        params = {
+            "state_tree_path": state_tree_path,
+            "transitions": transitions
+        }
+        return await send("batch_add_transitions", params)
+
+
+    @app.tool()
+    async def build_state_tree_from_spec(
+        states: List[Dict[str, Any]],
+        state_tree_path: str = "",
+        name: str = "",
+        path: str = "/Game/AI/StateTrees",
+        schema_class: str = "StateTreeComponentSchema",
+        evaluators: List[Dict[str, Any]] = None,
+        global_tasks: List[Dict[str, Any]] = None,
+        bindings: List[Dict[str, Any]] = None,
+        compile: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Build a whole StateTree from one declarative spec.
+
+        Replaces the long series of add_state, add_task_to_state, add_transition,
+        add_condition_to_transition, add_evaluator, add_global_task and bind_property calls.
+        Everything is built in one pass as one undo step, saved once and compiled once at the end.
+        States are added first, so transitions may target states that appear later in the spec,
+        and bindings are applied last. A failing element is reported and skipped.
+
+        Args:
+            states: Root states, each containing:
+                - state_name: State name (required)
+                - state_type, selection_behavior, enabled: As in add_state (optional)
+                - children: Nested child states, same format (optional)
+                - tasks: Array of {task_struct_path, task_name, properties} (optional)
+                - enter_conditions: Array of {condition_struct_path, properties} (optional)
+                - transitions: Array of {trigger, target_state_name, transition_type, event_tag,
+                  priority, delay_transition, delay_duration, conditions} (optional), where
+                  conditions is an array of {condition_struct_path, combine_mode, properties}
+            state_tree_path: Existing StateTree to build into (leave empty to create one)
+            name: Name of the StateTree to create when state_tree_path is empty
+            path: Folder of the StateTree to create (default: "/Game/AI/StateTrees")
+            schema_class: Schema of the StateTree to create (default: "StateTreeComponentSchema")
+            evaluators: Array of {evaluator_struct_path, evaluator_name, properties} (optional)
+            global_tasks: Array of {task_struct_path, task_name, properties} (optional)
+            bindings: Array of bind_property entries: {source_node_name, source_property_name,
+                target_node_name, target_property_name, task_index, transition_index, condition_index}
+            compile: Whether to compile the StateTree once it is built (default: True)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every element was added and the tree compiled
+            - state_tree_path: Path of the built StateTree
+            - created: Whether the StateTree was created by this call
+            - elements: Per-element results, each with kind, state, name, success and error
+            - element_count / failed_count: Number of elements and failed elements
+            - compiled / compile_error: Compile result when compile was requested
+        """
+        params = {
+            "states": states,
+            "compile": compile
+        }
+        if state_tree_path:
+            params["state_tree_path"] = state_tree_path
+        else:
+            params["name"] = name
+            params["path"] = path
+            params["schema_class"] = schema_class
+        if evaluators:
+            params["evaluators"] = evaluators
+        if global_tasks:
+            params["global_tasks"] = global_tasks
+        if bindings:
+            params["bindings"] = bindings
+        return await send("build_state_tree_from_spec", params)
+
+
+    @app.tool()
+    async def batch_set_node_properties(
+        state_tree_path: str,
+        edits: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Set properties on many tasks, global tasks and evaluators in one call.
+
+        All edits are one undo step with one save, and each property path is
+        reflected once per node type, so this is much faster than many
+        set_task_properties / set_evaluator_properties calls.
+
+        Args:
+            state_tree_path: Path to the StateTree asset
+            edits: Array of edits, each:
+                - node_type: "task" (default), "global_task" or "evaluator"
+                - state_name: State containing the task (tasks only)
+                - node_index: Index of the node (task_index / evaluator_index also accepted)
+                - node: Node ID, node name or struct name, instead of node_index (optional)
+                - properties: Dict of property paths ("Duration", "Settings.Radius") to values
+
+        Returns:
+            Dictionary containing:
+            - success: Whether every property of every edit was set
+            - property_count: Number of properties set
+            - failed_count: Number of edits with a failure
+            - edits: Per-edit {index, node_type, node_index, node_id, set, failed, success, error}
+        """
+        params = {"state_tree_path": state_tree_path, "edits": edits}
+        return await send("batch_set_node_properties", params)
+
+
+    # ============================================================================
+    # Section 16 - Validation and Debugging Commands
+    # ============================================================================
+
+    @app.tool()
+    async def validate_all_bindings(state_tree_path: str) -> Dict[str, Any]:
+        """
+        Validate all property bindings in a StateTree.
+
+        Use this to check for broken or invalid bindings that could cause runtime errors.
+
+        Args:
+            state_tree_path: Path to the StateTree asset
+
+        Returns:
+            Dictionary containing:
+            - success: Whether validation completed
+            - validation_results: Object containing:
+                - state_tree: Name of the StateTree
+                - has_valid_structure: Whether the StateTree has a root state
+                - binding_count: Number of bindings checked
+                - issues: Array of {type ("error" or "warning"), message, source_path, target_path}
+                - issue_count: Number of issues
+        """
+        params = {"state_tree_path": state_tree_path}
+        return await send("validate_all_bindings", params)
+
+
+    @app.tool()
+    async def start_bulk_state_tree_binding_validation(
+        state_trees: List[str] = None,
+        path: str = "",
+        max_in_flight: int = 8
+    ) -> Dict[str, Any]:
+        """
+        Start validating the property bindings of many StateTrees at once.
+
+        The StateTrees load asynchronously and their bindings are checked on worker
+        threads, so the editor stays responsive. Poll the results with
+        get_bulk_state_tree_binding_validation.
+
+        Args:
+            state_trees: StateTree names or paths to validate
+            path: Content folder whose StateTrees are validated, recursively (e.g. "/Game/AI")
+            max_in_flight: Most StateTrees loading or being checked at once (1-64)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job started
+            - job_id: Id to poll the job with
+            - trees_total: Number of StateTrees in the job
+        """
+        params: Dict[str, Any] = {"max_in_flight": max_in_flight}
+        if state_trees:
+            params["state_trees"] = state_trees
+        if path:
+            params["path"] = path
+        return await send("start_bulk_state_tree_binding_validation", params)
+
+
+    @app.tool()
+    async def get_bulk_state_tree_binding_validation(
+        job_id: int,
+        cursor: int = 0,
+        max_results: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Read the progress and results of a bulk StateTree binding validation.
+
+        Results are returned in the order the trees finish; pass next_cursor back as
+        cursor to read the ones that arrived since the previous call.
+
+        Args:
+            job_id: Id returned by start_bulk_state_tree_binding_validation
+            cursor: Index of the first result to return
+            max_results: Most results returned by this call
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the job was found
+            - state: "running" or "finished"
+            - trees_total, trees_completed, trees_loading, trees_validating, trees_failed
+            - progress: Fraction of trees completed
+            - results: Per-tree {state_tree_path, loaded, valid, binding_count,
+              error_count, warning_count, issues} or {state_tree_path, loaded, error}
+            - next_cursor: Cursor for the next call
+            - has_more: Whether more results are available or still to come
+        """
+        params = {"job_id": job_id, "cursor": cursor, "max_results": max_results}
+        return await send("get_bulk_state_tree_binding_validation", params)
+
+
+    @app.tool()
+    async def get_state_execution_history(
+        state_tree_path: str,
+        actor_path: str = "",
+        max_entries: int = 100
+    ) -> Dict[str, Any]:
+        """
+        Get state execution history from a running StateTree (PIE debugging).
+
+        Use this to inspect the sequence of states that have been executed during
+        a play session for debugging AI behavior. Events are only recorded while
+        start_state_tree_recording is active; every enter, exit and transition is
+        kept in order, so nothing between two calls is missed.
+
+        Args:
+            state_tree_path: Path to the StateTree asset
+            actor_path: Path or name of the actor running the StateTree (optional)
+            max_entries: Maximum number of most recent events per instance (default: 100)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether retrieval was successful
+            - execution_history: Object containing:
+                - state_tree_path: Path to the StateTree
+                - actor_path: Actor filter that was applied
+                - recording: Whether recording is still active
+                - capacity: Events kept per instance before the oldest are dropped
+                - history: Array of events in order, each with:
+                    - event: "enter", "exit" or "transition"
+                    - actor: Actor running the tree
+                    - state_name: Entered or exited state, or transition source
+                    - target_state: Transition target (transitions only)
+                    - timestamp: World time of the event
+                    - frame: Engine frame of the event
+                    - duration: How long the state was active (exits only)
+                - instances: Recorded instances with recorded_count and dropped_count
+        """
+        params = {
+            "state_tree_path": state_tree_path,
+            "max_entries": max_entries
+        }
+        if actor_path:
+            params["actor_path"] = actor_path
+
+        return await send("get_state_execution_history", params)
+
+
+    @app.tool()
+    async def start_state_tree_recording(
+        state_tree_path: str = "",
+        capacity: int = 0
+    ) -> Dict[str, Any]:
+        """
+        Start recording StateTree execution events during PIE.
+
+        While recording, the state enter, exit and transition events of StateTrees
+        running in PIE are appended to a ring buffer per actor, which
+        get_state_execution_history and get_current_active_states read. Starting
+        a new recording drops the events of the previous one.
+
+        Args:
+            state_tree_path: Only record this StateTree (optional; default records all)
+            capacity: Events kept per actor before the oldest are overwritten (0 = default of 1024)
+
+        Returns:
+            Dictionary containing:
+            - success: Whether recording started
+            - recording: True once recording is active
+        """
+        params = {"capacity": capacity}
+        if state_tree_path:
+            params["state_tree_path"] = state_tree_path
+        return await send("start_state_tree_recording", params)
+
+
+    @app.tool()
+    async def stop_state_tree_recording() -> Dict[str, Any]:
+        """
+        Stop recording StateTree execution events.
+
+        The recorded events stay available to get_state_execution_history until the
+        next recording starts.
+
+        Returns:
+            Dictionary containing:
+            - success: Whether the call succeeded
+            - was_recording: Whether a recording was active
+        """
+        return await send("stop_state_tree_recording", {})
@@ -102,6 +102,19 @@ Exposes UMG (Widget Blueprint) tools for Unreal Engine via MCP.
   Example:
     set_widget_component_placement(widget_name="MainMenu", component_name="TitleText", position=[350.0, 75.0])
 
+- **batch_update_widgets(widget_name, updates)**
+
+  Update the slot, placement and properties of many widgets at once; one compile, save and designer refresh.
+
+  Args:
+    - widget_name: Name of the target Widget Blueprint
+    - updates: List of {component_name, properties, slot, position, size, alignment}
+
+  Returns: Dict containing the properties that could or could not be set per widget
+
+  Example:
+    batch_update_widgets(widget_name="MainMenu", updates=[{"component_name": "TitleText", "position": [350.0, 75.0]}, {"component_name": "PlayButton", "slot": {"Padding": 8}}])
+
 - **add_widget_component_to_widget(widget_name, component_name, component_type, position=None, size=None, **kwargs)**
 
   Unified function to add any type of widget component to a UMG Widget Blueprint.
@@ -159,7 +172,7 @@ Exposes UMG (Widget Blueprint) tools for Unreal Engine via MCP.
     # Set slot properties for CanvasPanel children (stretch to fill parent)
     set_widget_component_property("WBP_AnswerButton", "MainButton", **{"Slot.Anchors": {"Minimum": {"X": 0, "Y": 0}, "Maximum": {"X": 1, "Y": 1}}, "Slot.Offsets": {"Left": 0, "Top": 0, "Right": 0, "Bottom": 0}})
 
-- **get_widget_blueprint_metadata(widget_name, fields=None, container_name="CanvasPanel_0")**
+- **get_widget_blueprint_metadata(widget_name, fields=None, container_name="CanvasPanel_0", root_widget=None, depth=None, width=None, height=None)**
 
   Get comprehensive metadata about a Widget Blueprint. This consolidated tool replaces
   check_widget_component_exists, get_widget_component_layout, and get_widget_container_component_dimensions.
@@ -167,8 +180,13 @@ Exposes UMG (Widget Blueprint) tools for Unreal Engine via MCP.
   Args:
     - widget_name: Name of the target Widget Blueprint (e.g., "WBP_MainMenu", "/Game/UI/MyWidget")
     - fields: List of fields to include. Options: "components", "layout", "dimensions", "hierarchy",
-              "bindings", "events", "variables", "functions", "*" (all). Default: all fields.
+              "bindings", "events", "variables", "functions", "measured_layout", "*" (all but
+              measured_layout). Default: all fields.
+              "section.key" keeps one key of each entry, e.g. "components.name".
     - container_name: Container name for dimensions field (default: "CanvasPanel_0")
+    - root_widget: Widget the components/layout/measured_layout/hierarchy/bindings fields start at (default: root)
+    - depth: Levels below the start widget to include (default: all)
+    - width, height: Layout size for measured_layout (default: 800x600)
 
   Returns: Dict containing:
     - success (bool): True if the operation succeeded
@@ -183,6 +201,7 @@ Exposes UMG (Widget Blueprint) tools for Unreal Engine via MCP.
     - events (dict): Event bindings (if requested)
     - variables (dict): Blueprint variables (if requested)
     - functions (dict): Blueprint functions (if requested)
+    - measured_layout (dict): Desired size, position and size per widget, measured without rendering (if requested)
 
   Examples:
     # Get all metadata
@@ -19,11 +19,11 @@ from utils.widgets.widget_components import (
     get_widget_blueprint_metadata_impl,
     create_widget_input_handler as create_widget_input_handler_impl,
     remove_widget_function_graph as remove_widget_function_graph_impl,
-    reorder_widget_children as reorder_widget_children_impl,
     # Widget configuration functions
     set_widget_design_size_mode as set_widget_design_size_mode_impl,
     set_widget_parent_class as set_widget_parent_class_impl
 )
+from umg_tools.widget_layout_tools import register_widget_layout_tools
 from utils.widgets.widget_screenshot import (
     capture_widget_screenshot_impl
 )
@@ -454,7 +454,11 @@ def register_umg_tools(mcp: FastMCP):
         ctx: Context,
         widget_name: str,
         fields: List[str] = None,
-        container_name: str = "CanvasPanel_0"
+        container_name: str = "CanvasPanel_0",
+        root_widget: str = None,
+        depth: int = None,
+        width: int = None,
+        height: int = None
     ) -> Dict[str, Any]:
         """
         Get comprehensive metadata about a Widget Blueprint.
@@ -475,8 +479,19 @@ def register_umg_tools(mcp: FastMCP):
                 - "events" - Bound events and delegates
                 - "variables" - Blueprint variables
                 - "functions" - Blueprint functions with inputs/outputs
-                - "*" - Return all fields (default)
+                - "measured_layout" - Desired size, position and size of every widget as laid
+                  out at width x height, without rendering; much cheaper than a screenshot.
+                  Not included in "*"
+                - "*" - Return all fields except measured_layout (default)
+                "section.key" keeps only that key of each entry, e.g. "components.name"; tree
+                entries keep their children. Unknown fields are listed in unknown_fields.
             container_name: Container name for dimensions field (default: "CanvasPanel_0")
+            root_widget: Start the components, layout, measured_layout, hierarchy and bindings
+                fields at this widget
+            depth: Levels below the start widget to include; panels cut off report child_count
+                and children_truncated instead of children
+            width: Layout width for measured_layout in pixels (default: 800)
+            height: Layout height for measured_layout in pixels (default: 600)
 
         Returns:
             Dict containing:
@@ -492,6 +507,8 @@ def register_umg_tools(mcp: FastMCP):
                 - events (dict): Event bindings (if requested)
                 - variables (dict): Blueprint variables (if requested)
                 - functions (dict): Blueprint functions (if requested)
+                - measured_layout (dict): width, height and a root widget tree whose entries
+                  hold desired_size, arranged, position and size (if requested)
                 - error (str): Error message if failed
 
         Examples:
@@ -526,8 +543,25 @@ def register_umg_tools(mcp: FastMCP):
                 widget_name="WBP_MainMenu",
                 fields=["components", "variables", "bindings"]
             )
+
+            # Names and types of one panel's direct children
+            metadata = get_widget_blueprint_metadata(
+                widget_name="WBP_MainMenu",
+                fields=["hierarchy"],
+                root_widget="ButtonRow",
+                depth=1
+            )
+
+            # Check that text fits its button at 1280x720 without taking a screenshot
+            metadata = get_widget_blueprint_metadata(
+                widget_name="WBP_MainMenu",
+                fields=["measured_layout"],
+                root_widget="ButtonRow",
+                width=1280,
+                height=720
+            )
         """
-        return get_widget_blueprint_metadata_impl(ctx, widget_name, fields, container_name)
+        return get_widget_blueprint_metadata_impl(ctx, widget_name, fields, container_name, root_widget, depth, width, height)
 
     @mcp.tool()
     def capture_widget_screenshot(
@@ -535,7 +569,10 @@ def register_umg_tools(mcp: FastMCP):
         widget_name: str,
         width: int = 800,
         height: int = 600,
-        format: str = "png"
+        format: str = "png",
+        quality: int = 85,
+        scale: float = 1.0,
+        region: List[int] = None
     ) -> Dict[str, Any]:
         """
         Capture a screenshot of a UMG Widget Blueprint preview.
@@ -545,9 +582,13 @@ def register_umg_tools(mcp: FastMCP):
 
         Args:
             widget_name: Name of the widget blueprint to capture
-            width: Screenshot width in pixels (default: 800, range: 1-8192)
-            height: Screenshot height in pixels (default: 600, range: 1-8192)
+            width: Layout width in pixels (default: 800, range: 1-8192)
+            height: Layout height in pixels (default: 600, range: 1-8192)
             format: Image format - "png" (default) or "jpg"
+            quality: JPEG quality 1-100 (default: 85); ignored for PNG
+            scale: Output size as a fraction of the layout size, in (0, 1] (default: 1.0).
+                   The widget is laid out at width x height and rendered at the scaled size.
+            region: Optional [x, y, width, height] crop in layout pixels
 
         Returns:
             Dict containing:
@@ -581,8 +622,19 @@ def register_umg_tools(mcp: FastMCP):
                 height=768,
                 format="jpg"
             )
+
+            # Quick look for a vision loop: half size JPEG of the top-left panel
+            result = capture_widget_screenshot(
+                widget_name="WBP_HUD",
+                width=1920,
+                height=1080,
+                format="jpg",
+                quality=60,
+                scale=0.5,
+                region=[0, 0, 960, 540]
+            )
         """
-        return capture_widget_screenshot_impl(ctx, widget_name, width, height, format)
+        return capture_widget_screenshot_impl(ctx, widget_name, width, height, format, quality, scale, region)
 
     @mcp.tool()
     def create_widget_input_handler(
@@ -722,44 +774,6 @@ def register_umg_tools(mcp: FastMCP):
         """
         return remove_widget_function_graph_impl(ctx, widget_name, function_name)
 
-    @mcp.tool()
-    def reorder_widget_children(
-        ctx: Context,
-        widget_name: str,
-        container_name: str,
-        child_order: List[str]
-    ) -> Dict[str, object]:
-        """
-        Reorder children within a container widget (HorizontalBox, VerticalBox, etc.).
-
-        Use this when components are in wrong visual order within a container.
-        Children will be arranged in the order specified in child_order list.
-
-        Args:
-            widget_name: Name of the target Widget Blueprint
-            container_name: Name of the container component (e.g., "ContentBox", "ButtonsContainer")
-            child_order: List of child component names in desired left-to-right (or top-to-bottom) order
-
-        Returns:
-            Dict containing success status and updated child order
-
-        Examples:
-            # Fix order in HorizontalBox: put KeyBadge before PromptText
-            reorder_widget_children(
-                widget_name="WBP_InteractionIndicator",
-                container_name="ContentBox",
-                child_order=["KeyBadgeOuter", "PromptText"]
-            )
-
-            # Reorder buttons in a VerticalBox
-            reorder_widget_children(
-                widget_name="WBP_MainMenu",
-                container_name="ButtonsContainer",
-                child_order=["PlayButton", "SettingsButton", "QuitButton"]
-            )
-        """
-        return reorder_widget_children_impl(ctx, widget_name, container_name, child_order)
-
     # ============================================================================
     # Widget Configuration Tools
     # Tools for configuring widget blueprint settings
@@ -879,6 +893,8 @@ def register_umg_tools(mcp: FastMCP):
         """
         return set_widget_parent_class_impl(ctx, widget_name, new_parent_class)
 
+    register_widget_layout_tools(mcp)
+
     logger.info("UMG tools registered successfully")
 
 # Moved outside the function
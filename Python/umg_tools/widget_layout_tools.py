@@ -0,0 +1,143 @@
+"""
+Widget Layout Tools for Unreal MCP.
+
+This module provides tools for arranging UMG widget hierarchies in few requests: reordering
+children, building a whole tree from a spec and updating many widgets at once.
+"""
+
+import logging
+from typing import Any, Dict, List
+from mcp.server.fastmcp import FastMCP, Context
+from utils.widgets.widget_components import (
+    reorder_widget_children as reorder_widget_children_impl,
+    build_widget_tree as build_widget_tree_impl,
+    batch_update_widgets as batch_update_widgets_impl
+)
+
+# Get logger
+logger = logging.getLogger("UnrealMCP")
+
+def register_widget_layout_tools(mcp: FastMCP):
+    """Register widget layout tools with the MCP server."""
+
+    @mcp.tool()
+    def reorder_widget_children(
+        ctx: Context,
+        widget_name: str,
+        container_name: str,
+        child_order: List[str]
+    ) -> Dict[str, object]:
+        """
+        Reorder children within a container widget (HorizontalBox, VerticalBox, etc.).
+
+        Use this when components are in wrong visual order within a container.
+        Children will be arranged in the order specified in child_order list.
+
+        Args:
+            widget_name: Name of the target Widget Blueprint
+            container_name: Name of the container component (e.g., "ContentBox", "ButtonsContainer")
+            child_order: List of child component names in desired left-to-right (or top-to-bottom) order
+
+        Returns:
+            Dict containing success status and updated child order
+
+        Examples:
+            # Fix order in HorizontalBox: put KeyBadge before PromptText
+            reorder_widget_children(
+                widget_name="WBP_InteractionIndicator",
+                container_name="ContentBox",
+                child_order=["KeyBadgeOuter", "PromptText"]
+            )
+
+            # Reorder buttons in a VerticalBox
+            reorder_widget_children(
+                widget_name="WBP_MainMenu",
+                container_name="ButtonsContainer",
+                child_order=["PlayButton", "SettingsButton", "QuitButton"]
+            )
+        """
+        return reorder_widget_children_impl(ctx, widget_name, container_name, child_order)
+
+    @mcp.tool()
+    def build_widget_tree(
+        ctx: Context,
+        widget_name: str,
+        root: Dict[str, Any],
+        parent_name: str = ""
+    ) -> Dict[str, Any]:
+        """
+        Build a whole widget hierarchy from a nested spec in one request.
+
+        Much faster than adding, parenting and configuring widgets one call at a time: the
+        blueprint is compiled and saved once, and the whole tree is a single undo step.
+        If any widget cannot be created, nothing is added.
+
+        Args:
+            widget_name: Name of the target Widget Blueprint
+            root: Widget spec for the root of the new hierarchy. Each spec contains:
+                - name: Widget name, unique in the blueprint (required)
+                - type: Component type, as for add_widget_component_to_widget (required)
+                - kwargs: Creation parameters, e.g. {"text": "Play"} (optional)
+                - properties: Widget properties, as for set_widget_component_property (optional)
+                - slot: Slot properties, e.g. {"Padding": ..., "HorizontalAlignment": "HAlign_Center"} (optional)
+                - position / size / alignment: Canvas slot placement as [x, y] (optional)
+                - is_variable: Expose as a blueprint variable (optional, default True)
+                - children: List of child specs (optional)
+            parent_name: Existing widget to add the hierarchy to (default: the root widget)
+
+        Returns:
+            Dict containing the created widgets with their properties that could or could not be set
+
+        Examples:
+            build_widget_tree(
+                widget_name="WBP_MainMenu",
+                root={
+                    "name": "MenuBox", "type": "VerticalBox",
+                    "position": [100, 100], "size": [300, 400],
+                    "children": [
+                        {"name": "PlayButton", "type": "Button", "slot": {"Padding": 8}},
+                        {"name": "QuitButton", "type": "Button", "slot": {"Padding": 8}}
+                    ]
+                }
+            )
+        """
+        return build_widget_tree_impl(ctx, widget_name, root, parent_name)
+
+    @mcp.tool()
+    def batch_update_widgets(
+        ctx: Context,
+        widget_name: str,
+        updates: List[Dict[str, Any]]
+    ) -> Dict[str, Any]:
+        """
+        Update the slot, placement and properties of many widgets in one request.
+
+        Much faster than one set_widget_component_property or set_widget_placement call per
+        widget: the blueprint is compiled and saved once, the designer refreshes once, and the
+        whole batch is a single undo step. If any named widget does not exist, nothing is changed.
+
+        Args:
+            widget_name: Name of the target Widget Blueprint
+            updates: List of widget updates. Each update contains:
+                - component_name: Widget to update (required)
+                - properties: Widget properties, as for set_widget_component_property;
+                  "Slot."-prefixed keys set slot properties (optional)
+                - slot: Slot properties, e.g. {"Padding": ..., "HorizontalAlignment": "HAlign_Center"} (optional)
+                - position / size / alignment: Canvas slot placement as [x, y] (optional)
+
+        Returns:
+            Dict containing, per widget, the properties that could or could not be set
+
+        Examples:
+            batch_update_widgets(
+                widget_name="WBP_MainMenu",
+                updates=[
+                    {"component_name": "Title", "properties": {"Text": "Main Menu"}, "position": [100, 40]},
+                    {"component_name": "PlayButton", "slot": {"Padding": 8}},
+                    {"component_name": "QuitButton", "slot": {"Padding": 8}, "properties": {"IsEnabled": False}}
+                ]
+            )
+        """
+        return batch_update_widgets_impl(ctx, widget_name, updates)
+
+    logger.info("Widget layout tools registered successfully")
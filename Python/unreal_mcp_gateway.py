@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""
+Unreal MCP Gateway - every tool group in one MCP server process
+
+Configuring the tool groups as separate servers (blueprint_mcp_server.py,
+niagara_mcp_server.py, umg_mcp_server.py, ...) starts one Python process per
+group, each importing its own dependencies and talking to the editor over
+connections of its own. The gateway hosts the tools of all of them:
+
+- Groups are imported when the client first lists or calls tools, not at
+  startup, and only those named in UNREAL_MCP_GROUPS (comma separated group
+  names, see GROUPS; default all).
+- Every tool goes through utils.unreal_connection_utils, so the whole fleet
+  shares one pooled, multiplexed connection to the editor. The async group
+  servers' own send_tcp_command (a new socket per call, responses cut at 48 KB)
+  is replaced by it.
+- Identical reads made at the same time share one request (set
+  UNREAL_DEDUPLICATE_READS=0 to turn this off).
+
+Tools keep the names their group servers give them. When two groups define the
+same name, the group listed first in GROUPS keeps it and the other is logged.
+
+Usage:
+    uv run unreal_mcp_gateway.py
+"""
+
+import contextlib
+import importlib
+import inspect
+import logging
+import os
+import sys
+import threading
+import types
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+from mcp.server.fastmcp import FastMCP
+import mcp.server.fastmcp as mcp_fastmcp
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from utils.unreal_connection_utils import send_unreal_command_async, set_read_deduplication
+
+logging.basicConfig(level=logging.INFO)
+logger = logging.getLogger("UnrealMCP")
+
+# Group name -> the server module that defines its tools, in precedence order
+GROUPS: List[Tuple[str, str]] = [
+    ("unreal", "unreal_mcp_server"),
+    ("blueprint", "blueprint_mcp_server"),
+    ("blueprint_action", "blueprint_action_mcp_server"),
+    ("node", "node_mcp_server"),
+    ("editor", "editor_mcp_server"),
+    ("umg", "umg_mcp_server"),
+    ("datatable", "datatable_mcp_server"),
+    ("project", "project_mcp_server"),
+    ("font", "font_mcp_server"),
+    ("material", "material_mcp_server"),
+    ("migration", "migration_mcp_server"),
+    ("niagara", "niagara_mcp_server"),
+    ("sound", "sound_mcp_server"),
+    ("statetree", "statetree_mcp_server"),
+    ("animation", "animation_mcp_server"),
+]
+
+
+class _ToolCollector:
+    """Stands in for FastMCP while a group server is imported, recording the tools it defines."""
+
+    instances: List["_ToolCollector"] = []
+
+    def __init__(self, *args, **kwargs):
+        self.tools: List[Tuple[Callable, Optional[str], Optional[str]]] = []
+        _ToolCollector.instances.append(self)
+
+    def tool(self, name: Any = None, description: Optional[str] = None, **kwargs):
+        if callable(name):
+            # Used as a bare @tool decorator
+            self.tools.append((name, None, None))
+            return name
+
+        def decorator(fn: Callable) -> Callable:
+            self.tools.append((fn, name, description))
+            return fn
+        return decorator
+
+    def run(self, *args, **kwargs):
+        pass
+
+
+@contextlib.contextmanager
+def _collecting_tools():
+    """Have both FastMCP flavours the group servers use create _ToolCollectors instead of servers."""
+    saved_class = mcp_fastmcp.FastMCP
+    saved_module = sys.modules.get("fastmcp")
+    stub = types.ModuleType("fastmcp")
+    stub.FastMCP = _ToolCollector
+    mcp_fastmcp.FastMCP = _ToolCollector
+    sys.modules["fastmcp"] = stub
+    _ToolCollector.instances = []
+    try:
+        yield
+    finally:
+        mcp_fastmcp.FastMCP = saved_class
+        if saved_module is not None:
+            sys.modules["fastmcp"] = saved_module
+        else:
+            sys.modules.pop("fastmcp", None)
+
+
+def _enabled_groups() -> List[Tuple[str, str]]:
+    selected = os.environ.get("UNREAL_MCP_GROUPS", "").strip()
+    if not selected:
+        return list(GROUPS)
+    names = {name.strip().lower() for name in selected.split(",") if name.strip()}
+    unknown = names - {name for name, _ in GROUPS}
+    if unknown:
+        logger.warning(f"Ignoring unknown tool groups: {', '.join(sorted(unknown))}")
+    return [(name, module) for name, module in GROUPS if name in names]
+
+
+class UnrealMCPGateway(FastMCP):
+    """FastMCP server that imports its tool groups on the first tools request."""
+
+    def __init__(self, *args, **kwargs):
+        super().__init__(*args, **kwargs)
+        self._groups_loaded = False
+        self._load_lock = threading.Lock()
+        self._tool_groups: Dict[str, str] = {}
+
+    def _ensure_groups_loaded(self):
+        with self._load_lock:
+            if self._groups_loaded:
+                return
+            for group, module_name in _enabled_groups():
+                self._load_group(group, module_name)
+            self._groups_loaded = True
+            logger.info(f"Gateway serving {len(self._tool_groups)} tools")
+
+    def _load_group(self, group: str, module_name: str):
+        try:
+            with _collecting_tools():
+                module = importlib.import_module(module_name)
+                collectors = list(_ToolCollector.instances)
+        except Exception as e:
+            logger.error(f"Tool group '{group}' failed to load: {e}")
+            return
+
+        # The async group servers open a socket per call; route them through the shared connection
+        if inspect.iscoroutinefunction(getattr(module, "send_tcp_command", None)):
+            module.send_tcp_command = send_unreal_command_async
+
+        added = 0
+        for collector in collectors:
+            for fn, name, description in collector.tools:
+                tool_name = name or fn.__name__
+                owner = self._tool_groups.get(tool_name)
+                if owner is not None:
+                    if owner != group:
+                        logger.info(f"Tool '{tool_name}' of group '{group}' is already provided by '{owner}'")
+                    continue
+                self.add_tool(fn, name=tool_name, description=description)
+                self._tool_groups[tool_name] = group
+                added += 1
+        logger.info(f"Loaded tool group '{group}' ({added} tools)")
+
+    async def list_tools(self):
+        self._ensure_groups_loaded()
+        return await super().list_tools()
+
+    async def call_tool(self, name: str, arguments: Dict[str, Any]):
+        self._ensure_groups_loaded()
+        return await super().call_tool(name, arguments)
+
+
+mcp = UnrealMCPGateway(
+    "unrealMCPGateway",
+    description="All Unreal Engine MCP tool groups in one server"
+)
+
+# Concurrent tool calls from the groups often read the same thing
+set_read_deduplication(os.environ.get("UNREAL_DEDUPLICATE_READS", "1") != "0")
+
+if __name__ == "__main__":
+    mcp.run(transport='stdio')
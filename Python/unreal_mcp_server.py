@@ -202,23 +202,73 @@ def export_blueprint_graph(
     blueprint_path: str,
     graph_name: str = "",
     include_components: bool = True,
-    include_defaults: bool = False
+    include_defaults: bool = False,
+    compress: bool = False
 ) -> dict:
     """
     Export a complete Blueprint graph to a JSON file.
 
-    The JSON is written to Saved/UnrealMCP/Exports/.
+    The JSON is written to Saved/UnrealMCP/Exports/ (gzip-compressed as .json.gz with compress=True).
     """
     params = {
         "blueprint_path": blueprint_path,
         "include_components": include_components,
         "include_defaults": include_defaults
     }
+    if compress:
+        params["compress"] = True
     if graph_name:
         params["graph_name"] = graph_name
     return send_unreal_command("export_blueprint_graph", params)
 
 
+@mcp.tool()
+def batch_export_blueprint_graphs(
+    ctx: Context,
+    folder_path: str,
+    recursive: bool = True,
+    include_components: bool = True,
+    compress: bool = False
+) -> dict:
+    """
+    Export every Blueprint in a content folder, one JSON file per asset plus a manifest.
+
+    The files are written to Saved/UnrealMCP/Exports/bulk_<timestamp>/.
+    """
+    params = {
+        "folder_path": folder_path,
+        "recursive": recursive,
+        "include_components": include_components
+    }
+    if compress:
+        params["compress"] = True
+    return send_unreal_command("batch_export_blueprint_graphs", params)
+
+
+@mcp.tool()
+def diff_blueprint_graphs(
+    ctx: Context,
+    blueprint_path: str,
+    export_path: str = "",
+    graph_name: str = "",
+    ignore_positions: bool = False
+) -> dict:
+    """
+    Compare a Blueprint's graphs with an export_blueprint_graph file, or with the saved package if export_path is omitted.
+
+    Returns only the added, removed and modified nodes and links of each changed graph.
+    """
+    params = {
+        "blueprint_path": blueprint_path,
+        "ignore_positions": ignore_positions
+    }
+    if export_path:
+        params["export_path"] = export_path
+    if graph_name:
+        params["graph_name"] = graph_name
+    return send_unreal_command("diff_blueprint_graphs", params)
+
+
 @mcp.tool()
 def get_blueprint_dependencies(
     ctx: Context,
@@ -406,6 +456,19 @@ def delete_blueprint_variable(
     })
 
 
+@mcp.tool()
+def get_blueprint_changes_since(
+    ctx: Context,
+    blueprint_name: str,
+    since_revision: int = 0
+) -> dict:
+    """List Blueprint node, graph, variable and component changes after a journal revision."""
+    return send_unreal_command("get_blueprint_changes_since", {
+        "blueprint_name": blueprint_name,
+        "since_revision": since_revision
+    })
+
+
 # ============================================================================
 # EDITOR TOOLS - Actor and level management
 # ============================================================================
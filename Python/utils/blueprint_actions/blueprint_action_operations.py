@@ -301,9 +301,10 @@ def search_blueprint_actions(
 
 def get_node_pin_info(
     ctx: Context,
-    node_name: str,
-    pin_name: str,
-    class_name: str = ""
+    node_name: str = "",
+    pin_name: str = "",
+    class_name: str = "",
+    queries: List[Dict[str, str]] = None
 ) -> Dict[str, Any]:
     """
     Implementation for inspecting Blueprint node pin connection details and compatibility.
@@ -316,10 +317,16 @@ def get_node_pin_info(
         node_name: Name of the node (e.g., "Map Add", "Array Add")
         pin_name: Name of the pin (e.g., "TargetMap", "Key", "Value")
         class_name: Optional class name for disambiguation (e.g., "BlueprintMapLibrary")
+        queries: Optional list of {"node_name", "pin_name", "class_name"} lookups answered in one
+            request instead of node_name/pin_name/class_name
 
     Returns:
-        Dict containing pin info including is_wildcard, is_reference for container functions.
+        Dict containing pin info including is_wildcard, is_reference for container functions,
+        or a "results" list with one such dict per query.
     """
+    if queries:
+        return send_unreal_command("get_node_pin_info", {"queries": queries})
+
     params = {
         "node_name": node_name,
         "pin_name": pin_name
@@ -444,6 +451,8 @@ def find_in_blueprints(
             - search_query: The search query used
             - search_type: The type filter applied
             - blueprints_searched: Number of blueprints searched
+            - blueprints_loaded: Number of blueprints loaded because they were not indexed yet
+            - truncated: True if the search stopped at max_results
             - match_count: Number of matches found
             - matches: Array of match objects with:
                 - blueprint_path: Full path to the blueprint
@@ -54,11 +54,20 @@ def create_blank_blueprint(
     }
     return send_unreal_command("create_blank_blueprint", params)
 
-def compile_blueprint(ctx: Context, blueprint_name: str) -> Dict[str, Any]:
+def compile_blueprint(
+    ctx: Context,
+    blueprint_name: str,
+    force: bool = False,
+    skeleton_only: bool = False
+) -> Dict[str, Any]:
     """Implementation for compiling a blueprint."""
     # The C++ side will handle finding the path from the name, 
     # assuming it expects the 'blueprint_name' key.
     params = {"blueprint_name": blueprint_name} 
+    if force:
+        params["force"] = True
+    if skeleton_only:
+        params["skeleton_only"] = True
     return send_unreal_command("compile_blueprint", params)
 
 def save_blueprint(ctx: Context, blueprint_path: str) -> Dict[str, Any]:
@@ -199,6 +208,31 @@ def add_component_to_blueprint(
         
     return send_unreal_command("add_component_to_blueprint", params)
 
+def add_blueprint_members_batch(
+    ctx: Context,
+    blueprint_name: str,
+    components: List[Dict[str, Any]] = None,
+    variables: List[Dict[str, Any]] = None,
+    functions: List[Dict[str, Any]] = None,
+    all_or_nothing: bool = False
+) -> Dict[str, Any]:
+    """Implementation for adding many components, variables and functions to a Blueprint at once."""
+    params = {
+        "blueprint_name": blueprint_name,
+        "all_or_nothing": all_or_nothing
+    }
+
+    if components:
+        params["components"] = components
+
+    if variables:
+        params["variables"] = variables
+
+    if functions:
+        params["functions"] = functions
+
+    return send_unreal_command("add_blueprint_members_batch", params)
+
 def set_static_mesh_properties(
     ctx: Context,
     blueprint_name: str,
@@ -433,6 +467,34 @@ def call_blueprint_function(
 
     return send_unreal_command("call_blueprint_function", params)
 
+def call_blueprint_function_batch(
+    ctx: Context,
+    function_name: str,
+    target_names: List[str] = None,
+    tag: str = None,
+    class_name: str = None,
+    params: Dict[str, Any] = None,
+    string_params: List[str] = None,
+    world: str = "auto",
+    include_return_values: bool = False
+) -> Dict[str, Any]:
+    """Implementation for calling one BlueprintCallable function on many actors."""
+    command_params: Dict[str, Any] = {"function_name": function_name, "world": world}
+    if target_names:
+        command_params["target_names"] = target_names
+    if tag:
+        command_params["tag"] = tag
+    if class_name:
+        command_params["class_name"] = class_name
+    if params:
+        command_params["params"] = params
+    if string_params:
+        command_params["string_params"] = string_params
+    if include_return_values:
+        command_params["include_return_values"] = True
+
+    return send_unreal_command("call_blueprint_function_batch", command_params)
+
 def get_blueprint_metadata(
     ctx: Context,
     blueprint_name: str,
@@ -440,7 +502,11 @@ def get_blueprint_metadata(
     graph_name: str = None,
     node_type: str = None,
     event_type: str = None,
-    detail_level: str = None
+    detail_level: str = None,
+    max_nodes: int = None,
+    cursor: str = None,
+    compact_pins: bool = None,
+    if_graph_hash: str = None
 ) -> Dict[str, Any]:
     """Implementation for getting comprehensive metadata about a Blueprint.
 
@@ -460,6 +526,10 @@ def get_blueprint_metadata(
                      - "summary": Node IDs and titles only (minimal output)
                      - "flow": Node IDs, titles, and exec pin connections only (DEFAULT)
                      - "full": Everything including all data pin connections and default values
+        max_nodes: Optional page size for "graph_nodes"; see next_cursor in the response.
+        cursor: next_cursor of the previous "graph_nodes" page.
+        compact_pins: Encode each "graph_nodes" pin as one string.
+        if_graph_hash: graph_hash already held; an unchanged graph comes back without nodes.
 
     Returns:
         Dictionary containing requested metadata fields
@@ -495,6 +565,18 @@ def get_blueprint_metadata(
     if detail_level is not None:
         params["detail_level"] = detail_level
 
+    if max_nodes is not None:
+        params["max_nodes"] = max_nodes
+
+    if cursor is not None:
+        params["cursor"] = cursor
+
+    if compact_pins is not None:
+        params["compact_pins"] = compact_pins
+
+    if if_graph_hash is not None:
+        params["if_graph_hash"] = if_graph_hash
+
     return send_unreal_command("get_blueprint_metadata", params)
 
 
@@ -0,0 +1,134 @@
+"""
+Minimal CBOR (RFC 8949) codec for the Unreal bridge protocol.
+
+Covers the subset the editor side (FMCPCborCodec) speaks: maps with text keys,
+arrays, text strings, integers, floats, booleans and null, definite lengths
+only. Kept dependency-free so the binary encoding works without extra packages.
+"""
+
+import struct
+from typing import Any, Tuple
+
+_MAX_DEPTH = 128
+
+
+def _head(major: int, value: int) -> bytes:
+    major <<= 5
+    if value < 24:
+        return bytes([major | value])
+    if value <= 0xFF:
+        return bytes([major | 24, value])
+    if value <= 0xFFFF:
+        return bytes([major | 25]) + struct.pack(">H", value)
+    if value <= 0xFFFFFFFF:
+        return bytes([major | 26]) + struct.pack(">I", value)
+    return bytes([major | 27]) + struct.pack(">Q", value)
+
+
+def _encode_into(out: bytearray, value: Any) -> None:
+    if value is None:
+        out.append(0xF6)
+    elif value is True:
+        out.append(0xF5)
+    elif value is False:
+        out.append(0xF4)
+    elif isinstance(value, int):
+        if value >= 0:
+            out += _head(0, value)
+        else:
+            out += _head(1, -1 - value)
+    elif isinstance(value, float):
+        if value.is_integer() and abs(value) <= 2 ** 53:
+            _encode_into(out, int(value))
+        else:
+            out += b"\xfb" + struct.pack(">d", value)
+    elif isinstance(value, str):
+        data = value.encode("utf-8")
+        out += _head(3, len(data))
+        out += data
+    elif isinstance(value, (list, tuple)):
+        out += _head(4, len(value))
+        for item in value:
+            _encode_into(out, item)
+    elif isinstance(value, dict):
+        out += _head(5, len(value))
+        for key, item in value.items():
+            _encode_into(out, str(key))
+            _encode_into(out, item)
+    else:
+        raise TypeError(f"Cannot CBOR-encode value of type {type(value).__name__}")
+
+
+def dumps(value: Any) -> bytes:
+    """Encode a JSON-compatible value as CBOR."""
+    out = bytearray()
+    _encode_into(out, value)
+    return bytes(out)
+
+
+def _read_head(data: bytes, offset: int) -> Tuple[int, int, int, int]:
+    if offset >= len(data):
+        raise ValueError("Invalid CBOR: unexpected end of document")
+    initial = data[offset]
+    offset += 1
+    major, additional = initial >> 5, initial & 0x1F
+    if additional < 24:
+        return major, additional, additional, offset
+    sizes = {24: 1, 25: 2, 26: 4, 27: 8}
+    if additional not in sizes:
+        raise ValueError("Invalid CBOR: indefinite-length or reserved item")
+    size = sizes[additional]
+    if offset + size > len(data):
+        raise ValueError("Invalid CBOR: truncated item header")
+    return major, additional, int.from_bytes(data[offset:offset + size], "big"), offset + size
+
+
+def _decode(data: bytes, offset: int, depth: int) -> Tuple[Any, int]:
+    if depth > _MAX_DEPTH:
+        raise ValueError("Invalid CBOR: document nested too deeply")
+    major, additional, argument, offset = _read_head(data, offset)
+    if major == 0:
+        return argument, offset
+    if major == 1:
+        return -1 - argument, offset
+    if major == 3:
+        end = offset + argument
+        if end > len(data):
+            raise ValueError("Invalid CBOR: string length exceeds document size")
+        return data[offset:end].decode("utf-8"), end
+    if major == 4:
+        items = []
+        for _ in range(argument):
+            item, offset = _decode(data, offset, depth + 1)
+            items.append(item)
+        return items, offset
+    if major == 5:
+        result = {}
+        for _ in range(argument):
+            key, offset = _decode(data, offset, depth + 1)
+            if not isinstance(key, str):
+                raise ValueError("Invalid CBOR: map key is not a text string")
+            result[key], offset = _decode(data, offset, depth + 1)
+        return result, offset
+    if major == 7:
+        if additional == 20:
+            return False, offset
+        if additional == 21:
+            return True, offset
+        if additional == 22:
+            return None, offset
+        if additional == 25:
+            return struct.unpack(">e", argument.to_bytes(2, "big"))[0], offset
+        if additional == 26:
+            return struct.unpack(">f", argument.to_bytes(4, "big"))[0], offset
+        if additional == 27:
+            return struct.unpack(">d", argument.to_bytes(8, "big"))[0], offset
+    raise ValueError(f"Invalid CBOR: unsupported item (major type {major}, value {additional})")
+
+
+def loads(data: bytes) -> Any:
+    """Decode a single CBOR document."""
+    value, offset = _decode(data, 0, 0)
+    if offset != len(data):
+        raise ValueError("Invalid CBOR: trailing bytes after document")
+    return value
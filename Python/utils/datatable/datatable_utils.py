@@ -40,13 +40,21 @@ def create_datatable_impl(
 
 def get_datatable_rows_impl(
     datatable_path: str,
-    row_names: Optional[List[str]] = None
+    row_names: Optional[List[str]] = None,
+    offset: int = 0,
+    limit: int = 0,
+    fields: Optional[List[str]] = None,
+    filters: Optional[List[Dict[str, Any]]] = None
 ) -> Dict[str, Any]:
     """Get rows from a DataTable in Unreal Engine.
     
     Args:
         datatable_path: Path to the target DataTable
         row_names: Optional list of specific row names to retrieve
+        offset: Matching rows to skip before the page
+        limit: Most rows to return; 0 returns every matching row
+        fields: Optional list of field names to return per row
+        filters: Optional list of {"field", "op", "value"} predicates
         
     Returns:
         Dict containing the requested rows
@@ -55,6 +63,14 @@ def get_datatable_rows_impl(
         "datatable_path": datatable_path,
         "row_names": row_names
     }
+    if offset:
+        params["offset"] = offset
+    if limit:
+        params["limit"] = limit
+    if fields:
+        params["fields"] = fields
+    if filters:
+        params["filters"] = filters
     
     return send_unreal_command("get_datatable_rows", params)
 
@@ -79,15 +95,26 @@ def get_datatable_row_names_impl(
 
 def add_rows_to_datatable_impl(
     datatable_path: str,
-    rows: list[dict]
+    rows: list[dict],
+    bulk: bool = False
 ) -> Dict[str, Any]:
     """Add multiple rows to an existing DataTable in Unreal Engine.
     Args:
         datatable_path: Path to the target DataTable
         rows: List of dicts, each with 'row_name' and 'row_data'
+        bulk: Use the plugin's bulk import path; rows are sent as given
     Returns:
         Dict containing success status and list of added row names
     """
+    if bulk:
+        # The bulk path keeps struct defaults for omitted fields, so rows need no filling
+        params = {
+            "datatable_path": datatable_path,
+            "rows": rows,
+            "bulk": True
+        }
+        return send_unreal_command("add_rows_to_datatable", params)
+
     # Auto-fill missing fields for better user experience
     processed_rows = []
     for row in rows:
@@ -143,6 +170,109 @@ def update_rows_in_datatable_impl(
     }
     return send_unreal_command("update_rows_in_datatable", params)
 
+def upsert_datatable_rows_impl(
+    datatable_path: str,
+    rows: list[dict]
+) -> Dict[str, Any]:
+    """Add or update rows in a DataTable in Unreal Engine, writing only changed fields.
+    Args:
+        datatable_path: Path to the target DataTable
+        rows: List of dicts, each with 'row_name' and 'row_data'
+    Returns:
+        Dict containing added/updated/failed row names and per-outcome counts
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "rows": rows
+    }
+    return send_unreal_command("upsert_datatable_rows", params)
+
+def get_datatable_fingerprint_impl(
+    datatable_path: str,
+    include_rows: bool = False,
+    known_root: str = ""
+) -> Dict[str, Any]:
+    """Get the content fingerprint of a DataTable in Unreal Engine.
+    Args:
+        datatable_path: Path to the target DataTable
+        include_rows: Also return each row's hash
+        known_root: Root hash from an earlier call
+    Returns:
+        Dict containing the root hash and optionally the row hashes
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "include_rows": include_rows
+    }
+    if known_root:
+        params["known_root"] = known_root
+    return send_unreal_command("get_datatable_fingerprint", params)
+
+def get_composite_datatable_stack_impl(
+    datatable_path: str,
+    row_names: Optional[List[str]] = None,
+    offset: int = 0,
+    limit: int = 0
+) -> Dict[str, Any]:
+    """Get the parent tables of a composite DataTable and the source of each row.
+    Args:
+        datatable_path: Path to the composite DataTable
+        row_names: Optional list of rows to describe
+        offset: Rows skipped before the page
+        limit: Most rows returned; 0 for no limit
+    Returns:
+        Dict containing the parents and one page of row sources
+    """
+    params = {"datatable_path": datatable_path}
+    if row_names:
+        params["row_names"] = row_names
+    if offset:
+        params["offset"] = offset
+    if limit:
+        params["limit"] = limit
+    return send_unreal_command("get_composite_datatable_stack", params)
+
+def get_curve_table_rows_impl(
+    curve_table_path: str,
+    row_names: Optional[List[str]] = None,
+    offset: int = 0,
+    limit: int = 0
+) -> Dict[str, Any]:
+    """Get one page of CurveTable rows from Unreal Engine.
+    Args:
+        curve_table_path: Path to the target CurveTable
+        row_names: Optional list of rows to read
+        offset: Rows skipped before the page
+        limit: Most rows returned; 0 for no limit
+    Returns:
+        Dict containing the rows as packed time and value arrays
+    """
+    params = {"curve_table_path": curve_table_path}
+    if row_names:
+        params["row_names"] = row_names
+    if offset:
+        params["offset"] = offset
+    if limit:
+        params["limit"] = limit
+    return send_unreal_command("get_curve_table_rows", params)
+
+def write_curve_table_rows_impl(
+    curve_table_path: str,
+    rows: List[Dict[str, Any]]
+) -> Dict[str, Any]:
+    """Write the keys of CurveTable rows in Unreal Engine.
+    Args:
+        curve_table_path: Path to the target CurveTable
+        rows: List of dicts, each with 'row_name', 'times', 'values' and optionally 'interp_mode'
+    Returns:
+        Dict containing added, updated and failed rows
+    """
+    params = {
+        "curve_table_path": curve_table_path,
+        "rows": rows
+    }
+    return send_unreal_command("write_curve_table_rows", params)
+
 def delete_datatable_rows_impl(
     datatable_path: str,
     row_names: List[str]
@@ -158,4 +288,50 @@ def delete_datatable_rows_impl(
         "datatable_path": datatable_path,
         "row_names": row_names
     }
-    return send_unreal_command("delete_datatable_rows", params) 
\ No newline at end of file
+    return send_unreal_command("delete_datatable_rows", params) 
+
+def import_datatable_from_file_impl(
+    datatable_path: str,
+    file_path: str,
+    format: str = "",
+    max_reported_failures: int = 100
+) -> Dict[str, Any]:
+    """Import rows into a DataTable from a CSV or JSON Lines file the editor can read.
+    Args:
+        datatable_path: Path to the target DataTable
+        file_path: File to import, absolute or relative to the project directory
+        format: "csv" or "jsonl"; empty picks by file extension
+        max_reported_failures: Most failed rows listed in the response
+    Returns:
+        Dict containing counts, unknown columns and the first failed rows
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "file_path": file_path,
+        "max_reported_failures": max_reported_failures
+    }
+    if format:
+        params["format"] = format
+    return send_unreal_command("import_datatable_from_file", params)
+
+
+def export_datatable_to_file_impl(
+    datatable_path: str,
+    file_path: str,
+    fields: Optional[List[str]] = None
+) -> Dict[str, Any]:
+    """Export a DataTable to a packed column file the editor writes.
+    Args:
+        datatable_path: Path to the source DataTable
+        file_path: File to write, absolute or relative to the project directory
+        fields: Optional list of field names to export
+    Returns:
+        Dict containing counts, the column layout and the file size
+    """
+    params = {
+        "datatable_path": datatable_path,
+        "file_path": file_path
+    }
+    if fields:
+        params["fields"] = fields
+    return send_unreal_command("export_datatable_to_file", params)
@@ -5,13 +5,18 @@ This module provides utilities for working with the Unreal Editor.
 """
 
 import logging
-from typing import Dict, List, Any
+import threading
+from typing import Dict, List, Any, Optional
 from mcp.server.fastmcp import Context
-from utils.unreal_connection_utils import send_unreal_command
+from utils.unreal_connection_utils import send_unreal_command, LevelEventListener
 
 # Get logger
 logger = logging.getLogger("UnrealMCP")
 
+# Level event subscription shared by get_level_changes calls
+_level_listener: Optional[LevelEventListener] = None
+_level_listener_lock = threading.Lock()
+
 def get_editor_state(ctx: Context) -> Dict[str, Any]:
     """Implementation for getting the current state of the Unreal Editor."""
     return send_unreal_command("get_editor_state", {})
@@ -344,7 +349,14 @@ def set_light_property(
 def get_level_metadata(
     ctx: Context,
     fields: List[str] = None,
-    actor_filter: str = None
+    actor_filter: str = None,
+    spatial: Dict[str, Any] = None,
+    class_filter: str = None,
+    tag_filter: str = None,
+    folder_filter: str = None,
+    actor_fields: List[str] = None,
+    limit: int = 0,
+    cursor: str = None
 ) -> Dict[str, Any]:
     """Get level metadata with selective field querying.
 
@@ -356,6 +368,13 @@ def get_level_metadata(
             - "actors": All actors in the level
             - "*": All fields (default if None)
         actor_filter: Optional pattern for actor name filtering (supports wildcards *)
+        spatial: Optional region (box, sphere, frustum or nearest) the actors must overlap
+        class_filter: Optional actor class; subclasses match too
+        tag_filter: Optional actor tag
+        folder_filter: Optional outliner folder; subfolders match too
+        actor_fields: Per-actor fields to return (default name, class, location, rotation, scale)
+        limit: Maximum number of actors per page (0 = all)
+        cursor: next_cursor of the previous page
 
     Returns:
         Dictionary with requested level metadata
@@ -368,16 +387,31 @@ def get_level_metadata(
     if actor_filter:
         params["actor_filter"] = actor_filter
 
+    if spatial:
+        params["spatial"] = spatial
+
+    for key, value in (("class_filter", class_filter), ("tag_filter", tag_filter),
+                       ("folder_filter", folder_filter), ("actor_fields", actor_fields),
+                       ("cursor", cursor)):
+        if value:
+            params[key] = value
+
+    if limit:
+        params["limit"] = limit
+
     logger.info(f"Getting level metadata with fields: {fields}, filter: {actor_filter}")
     return send_unreal_command("get_level_metadata", params)
 
 
-def batch_delete_actors(ctx: Context, names: List[str]) -> Dict[str, Any]:
+def batch_delete_actors(ctx: Context, names: List[str], collect_garbage: bool = False) -> Dict[str, Any]:
     """Delete multiple actors by name in a single operation.
 
+    The actors are deleted in one editor call and one undo transaction.
+
     Args:
         ctx: The MCP context
         names: List of actor names to delete
+        collect_garbage: Request one full garbage collection on the next editor tick
 
     Returns:
         Dict containing results for each actor:
@@ -393,11 +427,20 @@ def batch_delete_actors(ctx: Context, names: List[str]) -> Dict[str, Any]:
         }
     """
     params = {"names": names}
-    logger.info(f"Batch deleting {len(names)} actors: {names}")
+    if collect_garbage:
+        params["collect_garbage"] = True
+    logger.info(f"Batch deleting {len(names)} actors")
     return send_unreal_command("batch_delete_actors", params)
 
 
-def batch_spawn_actors(ctx: Context, actors: List[Dict[str, Any]]) -> Dict[str, Any]:
+def batch_spawn_actors(
+    ctx: Context,
+    actors: List[Dict[str, Any]],
+    deferred: bool = False,
+    include_details: Optional[bool] = None,
+    instancing: str = "",
+    instanced_actor_name: str = ""
+) -> Dict[str, Any]:
     """Spawn multiple actors in a single operation.
 
     Args:
@@ -409,6 +452,10 @@ def batch_spawn_actors(ctx: Context, actors: List[Dict[str, Any]]) -> Dict[str,
             - rotation: [Pitch, Yaw, Roll] spawn rotation (optional)
             - scale: [X, Y, Z] scale (optional)
             - (type-specific params like mesh_path, text_content, box_extent, etc.)
+        deferred: Spawn with deferred construction in one transaction, refreshing the editor once
+        include_details: Return full actor details per result; defaults to not deferred
+        instancing: "ism" or "hism" to place StaticMeshActor configs as instances on one actor
+        instanced_actor_name: Name of the actor holding the instances (default "InstancedMeshes")
 
     Returns:
         Dict containing results for each actor:
@@ -424,5 +471,325 @@ def batch_spawn_actors(ctx: Context, actors: List[Dict[str, Any]]) -> Dict[str,
         }
     """
     params = {"actors": actors}
-    logger.info(f"Batch spawning {len(actors)} actors")
-    return send_unreal_command("batch_spawn_actors", params)
\ No newline at end of file
+    if deferred:
+        params["deferred"] = True
+    if include_details is not None:
+        params["include_details"] = include_details
+    if instancing:
+        params["instancing"] = instancing
+    if instanced_actor_name:
+        params["instanced_actor_name"] = instanced_actor_name
+    logger.info(f"Batch spawning {len(actors)} actors{' (deferred)' if deferred else ''}")
+    return send_unreal_command("batch_spawn_actors", params)
+
+
+def convert_actors_to_instances(
+    ctx: Context,
+    actor_names: List[str],
+    instanced_actor_name: str = "",
+    hierarchical: bool = True,
+    delete_source_actors: bool = True
+) -> Dict[str, Any]:
+    """Replace StaticMeshActors with instances on a single actor.
+
+    Args:
+        ctx: The MCP context
+        actor_names: Names of the StaticMeshActors to convert
+        instanced_actor_name: Name of the new actor (default "InstancedMeshes")
+        hierarchical: Use hierarchical instanced components (HISM) instead of ISM
+        delete_source_actors: Delete the converted actors
+
+    Returns:
+        Dict containing the instanced actor, the converted and skipped actor names
+    """
+    params = {
+        "actor_names": actor_names,
+        "hierarchical": hierarchical,
+        "delete_source_actors": delete_source_actors
+    }
+    if instanced_actor_name:
+        params["instanced_actor_name"] = instanced_actor_name
+    logger.info(f"Converting {len(actor_names)} actors to instances")
+    return send_unreal_command("convert_actors_to_instances", params)
+
+def set_actor_transforms_batch(ctx: Context, updates: List[Dict[str, Any]]) -> Dict[str, Any]:
+    """Move many actors in a single operation and undo step.
+
+    Args:
+        ctx: The MCP context
+        updates: List of updates, each containing:
+            - name: Actor name (required)
+            - location: [X, Y, Z] (optional)
+            - rotation: [Pitch, Yaw, Roll] (optional)
+            - scale: [X, Y, Z] (optional)
+
+    Returns:
+        Dict containing a result per update, plus total, succeeded and failed counts
+    """
+    logger.info(f"Batch setting transforms on {len(updates)} actors")
+    return send_unreal_command("set_actor_transforms_batch", {"updates": updates})
+
+
+def set_actor_properties_batch(ctx: Context, updates: List[Dict[str, Any]]) -> Dict[str, Any]:
+    """Set properties on many actors in a single operation and undo step.
+
+    Args:
+        ctx: The MCP context
+        updates: List of updates, each containing:
+            - name: Actor name (required)
+            - properties: Dict of property name to value (required)
+
+    Returns:
+        Dict containing a result per update, plus total, succeeded and failed counts
+    """
+    logger.info(f"Batch setting properties on {len(updates)} actors")
+    return send_unreal_command("set_actor_properties_batch", {"updates": updates})
+
+
+def execute_batch(
+    ctx: Context,
+    operations: List[Dict[str, Any]],
+    stop_on_failure: bool = False,
+    rollback_on_failure: bool = False
+) -> Dict[str, Any]:
+    """Run several registered commands in a single request.
+
+    Args:
+        ctx: The MCP context
+        operations: List of operations, each containing:
+            - id: Operation id for references (optional, default "op<index>")
+            - command: Command name (required)
+            - params: Command parameters (optional); a string "$<id>.<field>" is
+              replaced by that field of an earlier operation's result
+            - depends_on: Ids of operations that must succeed first (optional)
+        stop_on_failure: Skip the remaining operations once one fails
+        rollback_on_failure: Undo the whole batch if any operation fails
+
+    Returns:
+        Dict containing results for each operation:
+        {
+            "results": [
+                {"id": "op0", "success": true, "result": {...}},
+                {"id": "op1", "success": false, "error": "..."},
+                {"id": "op2", "success": false, "skipped": true, "error": "..."}
+            ],
+            "total": 3,
+            "succeeded": 1,
+            "failed": 1,
+            "skipped": 1,
+            "rolled_back": false,
+            "success": true
+        }
+    """
+    params = {
+        "operations": operations,
+        "stop_on_failure": stop_on_failure,
+        "rollback_on_failure": rollback_on_failure
+    }
+    logger.info(f"Executing batch of {len(operations)} operations")
+    return send_unreal_command("execute_batch", params)
+
+
+def wait_for_compile(ctx: Context, tickets: List[int], wait: bool = True) -> Dict[str, Any]:
+    """Collect the results of deferred compiles.
+
+    Args:
+        ctx: The MCP context
+        tickets: Tickets returned by compile commands called with deferred=True
+        wait: Compile tickets that are still queued now instead of only reporting them
+
+    Returns:
+        Dict containing one entry per ticket:
+        {
+            "tickets": [
+                {"ticket": 3, "state": "finished", "result": {...}},
+                {"ticket": 4, "state": "pending"}
+            ],
+            "pending_compiles": 1,
+            "success": true
+        }
+    """
+    params = {"tickets": tickets, "wait": wait}
+    logger.info(f"Waiting for compile tickets: {tickets}")
+    return send_unreal_command("wait_for_compile", params)
+
+
+def flush_saves(ctx: Context) -> Dict[str, Any]:
+    """Write every package whose save MCP commands have queued.
+
+    Args:
+        ctx: The MCP context
+
+    Returns:
+        Dict containing:
+        {
+            "saved": 3,
+            "failed_packages": [],
+            "success": true
+        }
+    """
+    logger.info("Flushing queued package saves")
+    return send_unreal_command("flush_saves", {})
+
+
+def get_mcp_metrics(
+    ctx: Context,
+    command: str = "",
+    format: str = "json",
+    reset: bool = False
+) -> Dict[str, Any]:
+    """Read the server's per-command latency histograms and counters.
+
+    Args:
+        ctx: The MCP context
+        command: Only report this command (JSON format only)
+        format: "json" or "prometheus"
+        reset: Drop everything recorded after reporting it
+
+    Returns:
+        Dict containing:
+        {
+            "uptime_seconds": 812.4,
+            "commands": [{"command": "get_blueprint_metadata", "requests": 42, "errors": 1,
+                          "cache_hits": 30, "send_failures": 0, "bytes_received": 5120,
+                          "bytes_sent": 1048576,
+                          "stages": {"execute": {"count": 12, "mean_ms": 8.1, "p50_ms": 6.0,
+                                                 "p90_ms": 14.2, "p99_ms": 31.0, "max_ms": 33.5}}}],
+            "success": true
+        }
+    """
+    params = {"format": format, "reset": reset}
+    if command:
+        params["command"] = command
+    logger.info(f"Reading MCP metrics (format={format}, reset={reset})")
+    return send_unreal_command("get_mcp_metrics", params)
+
+
+def get_cache_stats(ctx: Context, name: str = "", reset: bool = False, trim: bool = False) -> Dict[str, Any]:
+    """Read the hit and miss statistics of the server's caches, object pools and indexes.
+
+    Args:
+        ctx: The MCP context
+        name: Only report sources whose name contains this
+        reset: Reset the reported sources' statistics after reporting them
+        trim: Evict every entry of the memory-budgeted caches before reporting
+
+    Returns:
+        Dict containing:
+        {
+            "sources": [{"name": "asset_search_index", "kind": "index", "hits": 120, "misses": 1,
+                         "requests": 121, "hit_ratio": 0.99, "invalidations": 0, "entries": 5230}],
+            "totals": {"hits": 120, "misses": 1, "requests": 121, "hit_ratio": 0.99},
+            "memory_budget": {"budget_bytes": 268435456, "used_bytes": 1048576, "evicted_entries": 0,
+                              "evicted_bytes": 0, "trims": 0, "caches": {"graph_reachability_cache": 524288}},
+            "success": true
+        }
+    """
+    params = {"reset": reset}
+    if trim:
+        params["trim"] = True
+    if name:
+        params["name"] = name
+    logger.info(f"Reading cache stats (name={name}, reset={reset})")
+    return send_unreal_command("get_cache_stats", params)
+
+
+def record_requests(ctx: Context, action: str = "status", path: str = "") -> Dict[str, Any]:
+    """Start, stop or inspect the record of requests the editor receives.
+
+    Args:
+        ctx: The MCP context
+        action: "start", "stop" or "status"
+        path: File to record to, for "start"; a timestamped file in Saved/UnrealMCP/Recordings if empty
+
+    Returns:
+        Dict containing:
+        {
+            "recording": true,
+            "path": "D:/Project/Saved/UnrealMCP/Recordings/Requests_20250101_120000.jsonl",
+            "requests": 128,
+            "elapsed_seconds": 95.2,
+            "success": true
+        }
+    """
+    params = {"action": action}
+    if path:
+        params["path"] = path
+    logger.info(f"Request recording: {action}")
+    return send_unreal_command("record_requests", params)
+
+
+def replay_requests(
+    ctx: Context,
+    action: str = "status",
+    path: str = "",
+    speed: float = 1.0,
+    max_requests: int = 0
+) -> Dict[str, Any]:
+    """Start, stop or inspect the replay of a request recording through the editor.
+
+    Args:
+        ctx: The MCP context
+        action: "start", "stop" or "status"
+        path: Recording made by record_requests, for "start"
+        speed: Pace relative to the recording; 0 for as fast as possible
+        max_requests: Replay at most this many requests; 0 for all
+
+    Returns:
+        Dict containing:
+        {
+            "state": "running",
+            "requests_total": 128, "requests_sent": 40, "responses": 39, "errors": 1, "busy": 0,
+            "recorded_seconds": 95.2, "elapsed_seconds": 7.9,
+            "latency": {"count": 39, "mean_ms": 12.5, "p50_ms": 4.1, "p90_ms": 30.2,
+                        "p99_ms": 88.0, "max_ms": 91.3},
+            "success": true
+        }
+    """
+    params = {"action": action}
+    if action == "start":
+        params.update({"path": path, "speed": speed, "max_requests": max_requests})
+    logger.info(f"Request replay: {action}")
+    return send_unreal_command("replay_requests", params)
+
+
+def get_level_changes(ctx: Context, min_interval_ms: int = 250) -> Dict[str, Any]:
+    """Return the actors added, updated and removed in the level since the last call.
+
+    The first call subscribes to the editor's level events on a dedicated
+    connection and reports resync=True: read the level once with
+    get_level_metadata, then call this to keep that view current.
+
+    Args:
+        ctx: The MCP context
+        min_interval_ms: Shortest time between two events pushed by the editor, used when subscribing
+
+    Returns:
+        Dict containing:
+        {
+            "resync": false,
+            "added": [{"name": "Cube_3", "label": "Cube", "class": "StaticMeshActor",
+                       "location": [0, 0, 0], "rotation": [0, 0, 0], "scale": [1, 1, 1]}],
+            "updated": [],
+            "removed": ["PointLight_1"],
+            "events": 2,
+            "success": true
+        }
+    """
+    global _level_listener
+    with _level_listener_lock:
+        if _level_listener is not None and not _level_listener.running:
+            # Keep its resync flag: changes were missed while it was down
+            _level_listener = None
+        if _level_listener is None:
+            listener = LevelEventListener(min_interval_ms)
+            try:
+                listener.start()
+            except Exception as e:
+                logger.error(f"Failed to subscribe to level events: {e}")
+                return {"success": False, "error": f"Failed to subscribe to level events: {e}"}
+            _level_listener = listener
+            logger.info(f"Subscribed to level events every {min_interval_ms} ms")
+        changes = _level_listener.take_changes()
+    changes["success"] = True
+    return changes
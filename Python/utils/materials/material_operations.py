@@ -250,14 +250,78 @@ def set_material_expression_property(
     return send_unreal_command("set_material_expression_property", params)
 
 
+def build_material_graph(
+    ctx: Context,
+    material_path: str,
+    expressions: List[Dict[str, Any]],
+    connections: List[Dict[str, Any]] = None,
+    outputs: List[Dict[str, Any]] = None,
+    auto_layout: bool = True,
+    compile: bool = True
+) -> Dict[str, Any]:
+    """Implementation for building a material graph from one declarative spec."""
+    params = {
+        "material_path": material_path,
+        "expressions": expressions,
+        "connections": connections or [],
+        "outputs": outputs or [],
+        "auto_layout": auto_layout,
+        "compile": compile
+    }
+
+    logger.info(f"Building {len(expressions)} expressions into material '{material_path}'")
+    return send_unreal_command("build_material_graph", params)
+
+
 def compile_material(
     ctx: Context,
-    material_path: str
+    material_path: str,
+    async_compile: bool = False
 ) -> Dict[str, Any]:
     """Implementation for compiling a material and getting validation info."""
     params = {
         "material_path": material_path
     }
+    if async_compile:
+        params["async"] = True
 
     logger.info(f"Compiling material '{material_path}'")
     return send_unreal_command("compile_material", params)
+
+
+def get_material_compile_status(
+    ctx: Context,
+    job_id: int
+) -> Dict[str, Any]:
+    """Implementation for polling an asynchronous material compile."""
+    params = {
+        "job_id": job_id
+    }
+
+    return send_unreal_command("get_material_compile_status", params)
+
+
+def begin_material_edit_session(
+    ctx: Context,
+    material_path: str
+) -> Dict[str, Any]:
+    """Implementation for opening an edit session that defers material recompiles."""
+    params = {
+        "material_path": material_path
+    }
+
+    logger.info(f"Beginning edit session on material '{material_path}'")
+    return send_unreal_command("begin_material_edit_session", params)
+
+
+def end_material_edit_session(
+    ctx: Context,
+    material_path: str
+) -> Dict[str, Any]:
+    """Implementation for ending an edit session, recompiling and saving the material once."""
+    params = {
+        "material_path": material_path
+    }
+
+    logger.info(f"Ending edit session on material '{material_path}'")
+    return send_unreal_command("end_material_edit_session", params)
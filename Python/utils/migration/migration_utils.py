@@ -13,6 +13,7 @@ IMPORTANT: The goal is to replace Blueprint LOGIC with C++, NOT delete the Bluep
 See BlueprintExports/BLUEPRINT_TO_CPP_WORKFLOW.md for detailed patterns.
 """
 
+import gzip
 import json
 import os
 from datetime import datetime
@@ -93,9 +94,9 @@ def get_migrations_dir() -> Path:
 def find_latest_export(blueprint_name: str) -> Optional[Path]:
     """Find the most recent export file for a blueprint."""
     exports_dir = get_exports_dir()
-    pattern = f"export_{blueprint_name}_*.json"
-
-    matching_files = list(exports_dir.glob(pattern))
+    # Compressed exports are written as .json.gz
+    matching_files = list(exports_dir.glob(f"export_{blueprint_name}_*.json"))
+    matching_files += list(exports_dir.glob(f"export_{blueprint_name}_*.json.gz"))
     if not matching_files:
         return None
 
@@ -110,6 +111,10 @@ def load_blueprint_export(blueprint_name: str) -> Optional[Dict[str, Any]]:
     if not export_path:
         return None
 
+    if export_path.suffix == ".gz":
+        with gzip.open(export_path, 'rt', encoding='utf-8') as f:
+            return json.load(f)
+
     with open(export_path, 'r', encoding='utf-8') as f:
         return json.load(f)
 
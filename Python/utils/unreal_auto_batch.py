@@ -0,0 +1,162 @@
+"""
+Client-side batching of mutating calls on one asset into execute_batch requests.
+
+unreal_connection_utils owns the batcher (UNREAL_AUTO_BATCH_MS, or
+set_auto_batch_window()) and hands it the function that sends a command.
+"""
+
+import os
+import threading
+from typing import Callable, Dict, Any, Optional, List, Tuple
+from utils.unreal_transport import _debug
+
+# Opt-in client-side batching (UNREAL_AUTO_BATCH_MS, or set_auto_batch_window()).
+# Mutating calls on the same asset that arrive within the window, from any thread,
+# are sent as one execute_batch; each caller still gets its own response.
+UNREAL_AUTO_BATCH_MS = max(0, int(os.environ.get("UNREAL_AUTO_BATCH_MS", "0")))
+_AUTO_BATCH_MAX_OPERATIONS = 200
+
+# Registered commands that edit one asset, named by the first of these parameters it has
+_AUTO_BATCH_ASSET_PARAMS = ("blueprint_name", "widget_name")
+_AUTO_BATCH_COMMANDS = frozenset({
+    "add_blueprint_variable",
+    "add_blueprint_event_node",
+    "add_blueprint_custom_event_node",
+    "add_blueprint_function_node",
+    "add_component_to_blueprint",
+    "add_interface_to_blueprint",
+    "add_widget_component_to_widget",
+    "connect_blueprint_nodes",
+    "create_custom_blueprint_function",
+    "create_node_by_action_name",
+    "delete_node",
+    "disconnect_node",
+    "modify_blueprint_component_properties",
+    "modify_blueprint_function_properties",
+    "replace_node",
+    "set_blueprint_property",
+    "set_physics_properties",
+    "set_static_mesh_properties",
+    "set_widget_component_placement",
+    "set_widget_component_property",
+})
+
+
+def _auto_batch_asset(params: Optional[Dict[str, Any]]) -> Optional[str]:
+    """Key of the asset a call works on, or None when it names none."""
+    for name in _AUTO_BATCH_ASSET_PARAMS:
+        value = (params or {}).get(name)
+        if isinstance(value, str) and value:
+            # Asset names are case-insensitive in the editor
+            return value.lower()
+    return None
+
+
+def _escape_batch_references(value: Any) -> Any:
+    """Keep strings starting with "$" literal; execute_batch reads them as references to other operations."""
+    if isinstance(value, str):
+        return "$" + value if value.startswith("$") else value
+    if isinstance(value, dict):
+        return {key: _escape_batch_references(item) for key, item in value.items()}
+    if isinstance(value, list):
+        return [_escape_batch_references(item) for item in value]
+    return value
+
+
+def _batch_entry_response(entry: Dict[str, Any]) -> Dict[str, Any]:
+    """Turn one execute_batch result into the response the command would have had on its own."""
+    if entry.get("success"):
+        return {"status": "success", "result": entry.get("result", {})}
+    error = entry.get("error", "Unknown error")
+    if isinstance(error, dict):
+        error = (error.get("errorMessage") or error.get("errorDetails") or
+                 error.get("message") or "Unknown error")
+    return {"status": "error", "error": error}
+
+
+class _PendingBatch:
+    """Calls on one asset collected during a batching window."""
+
+    def __init__(self):
+        self.commands: List[Tuple[str, Dict[str, Any]]] = []
+        self.responses: List[Dict[str, Any]] = []
+        # Set to send before the window ends: the batch is full, or a call reads the asset
+        self.flush = threading.Event()
+        self.done = threading.Event()
+
+
+class _AutoBatcher:
+    """
+    Groups mutating calls on the same asset into execute_batch requests.
+
+    The first call on an asset opens a batch and waits out the window (or until
+    the batch is full); calls on that asset arriving meanwhile join it and wait
+    for it to be sent. Any other call naming the asset sends the open batch
+    first and waits for it, so reads still see every edit made before them and
+    calls on an asset run in the order they were made. A batch that ends up with
+    a single call is sent as that command.
+
+    `send` sends one command right away and returns its response.
+    """
+
+    def __init__(self, window_ms: int, send: Callable[[str, Dict[str, Any]], Dict[str, Any]]):
+        self.window_ms = window_ms
+        self._send_command = send
+        self._lock = threading.Lock()
+        self._open: Dict[str, _PendingBatch] = {}
+
+    def submit(self, asset: str, command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+        with self._lock:
+            batch = self._open.get(asset)
+            leader = batch is None
+            if leader:
+                batch = self._open[asset] = _PendingBatch()
+            index = len(batch.commands)
+            batch.commands.append((command_name, params))
+            if len(batch.commands) >= _AUTO_BATCH_MAX_OPERATIONS:
+                # Later calls open the next batch
+                del self._open[asset]
+                batch.flush.set()
+
+        if leader:
+            batch.flush.wait(self.window_ms / 1000.0)
+            with self._lock:
+                if self._open.get(asset) is batch:
+                    del self._open[asset]
+            self._send(batch)
+        else:
+            batch.done.wait()
+        return batch.responses[index]
+
+    def wait_for(self, asset: str):
+        """Send the open batch on the asset, if any, and wait until it has been answered."""
+        with self._lock:
+            batch = self._open.get(asset)
+        if batch is not None:
+            batch.flush.set()
+            batch.done.wait()
+
+    def _send(self, batch: _PendingBatch):
+        try:
+            if len(batch.commands) == 1:
+                batch.responses = [self._send_command(*batch.commands[0])]
+                return
+            _debug(f"QUEUE [execute_batch] Coalesced {len(batch.commands)} calls")
+            response = self._send_command("execute_batch", {
+                "operations": [
+                    {"id": f"op{index}", "command": name, "params": _escape_batch_references(params or {})}
+                    for index, (name, params) in enumerate(batch.commands)
+                ],
+            })
+            entries = response.get("result", {}).get("results") if response.get("status") == "success" else None
+            if not isinstance(entries, list) or len(entries) != len(batch.commands):
+                # The batch as a whole failed; every call reports why
+                failure = response if response.get("status") == "error" else \
+                    {"status": "error", "error": "Unexpected execute_batch response"}
+                batch.responses = [dict(failure) for _ in batch.commands]
+                return
+            batch.responses = [_batch_entry_response(entry) for entry in entries]
+        except Exception as e:
+            batch.responses = [{"status": "error", "error": str(e)} for _ in batch.commands]
+        finally:
+            batch.done.set()
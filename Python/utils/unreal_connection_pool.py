@@ -0,0 +1,214 @@
+"""
+Keep-alive connections to the editor shared by every thread of the process.
+
+Each instance has a pool of up to UNREAL_POOL_SIZE multiplexed connections.
+Requests are tagged with an id, and a reader thread per connection hands each
+response to the request it answers.
+"""
+
+import itertools
+import os
+import select
+import socket
+import threading
+import time
+from typing import Dict, Any, Optional, List, Tuple
+from utils.unreal_transport import (
+    UNREAL_INSTANCES, UNREAL_SOCKET_TIMEOUT, UnrealInstance, WireOptions,
+    _close_socket, _connection_error, _debug, _envelope, _negotiate_wire, _open_socket, _pack,
+    _recv_framed_response,
+)
+
+# Number of keep-alive connections each process keeps to the editor. Requests are
+# multiplexed over them by id, so one is enough for concurrency; the editor serves
+# a limited number of connections, shared by every MCP server process.
+UNREAL_POOL_SIZE = max(1, int(os.environ.get("UNREAL_POOL_SIZE", "1")))
+
+# Source of request ids on multiplexed connections
+_request_ids = itertools.count(1)
+
+_KEEP_ALIVE_CLOSED = {"status": "error", "error": "Connection refused - keep-alive connection was closed"}
+
+
+class _PendingRequest:
+    """A request sent on a multiplexed connection, completed by its reader thread."""
+    __slots__ = ("event", "response")
+
+    def __init__(self):
+        self.event = threading.Event()
+        self.response: Optional[Dict[str, Any]] = None
+
+    def complete(self, response: Dict[str, Any]):
+        self.response = response
+        self.event.set()
+
+
+class _MultiplexedConnection:
+    """
+    A keep-alive connection shared by every thread of the process.
+
+    Requests are tagged with an id and written under a send lock; a reader
+    thread matches each response to its request by id, so any number of
+    requests can be in flight at once and a slow command does not hold up the
+    ones behind it. When the connection closes (the editor's idle timeout, an
+    editor restart), every request still waiting fails with a "refused" error,
+    which send_unreal_command retries on a new connection.
+    """
+
+    def __init__(self, sock: socket.socket, wire: WireOptions):
+        self.sock = sock
+        self.wire = wire
+        self.closed = False
+        self._lock = threading.Lock()
+        self._send_lock = threading.Lock()
+        self._pending: Dict[int, _PendingRequest] = {}
+        self._reader = threading.Thread(target=self._read_loop, name="UnrealMCPReader", daemon=True)
+        self._reader.start()
+
+    @property
+    def in_flight(self) -> int:
+        return len(self._pending)
+
+    def submit(self, requests: List[Tuple[int, Dict[str, Any]]]) -> List[_PendingRequest]:
+        """Send requests, already tagged with their ids, in one write; raises ConnectionError if closed."""
+        pending = [_PendingRequest() for _ in requests]
+        with self._lock:
+            if self.closed:
+                raise ConnectionError(_KEEP_ALIVE_CLOSED["error"])
+            for (request_id, _), entry in zip(requests, pending):
+                self._pending[request_id] = entry
+        payload = b''.join(_pack(command_obj, self.wire) for _, command_obj in requests)
+        try:
+            with self._send_lock:
+                self.sock.sendall(payload)
+        except OSError as e:
+            _debug(f"TCP [shared] Send failed ({e}), closing connection")
+            self.close()
+            raise ConnectionError(_KEEP_ALIVE_CLOSED["error"]) from e
+        return pending
+
+    def abandon(self, request_ids: List[int]):
+        """Stop waiting for requests and ask the editor to drop them."""
+        with self._lock:
+            request_ids = [request_id for request_id in request_ids if self._pending.pop(request_id, None)]
+            if self.closed or not request_ids:
+                return
+        try:
+            with self._send_lock:
+                self.sock.sendall(b''.join(
+                    _pack({"type": "cancel", "params": {"id": request_id}, "keep_alive": True}, self.wire)
+                    for request_id in request_ids
+                ))
+            _debug(f"TCP [shared] Sent cancel for {len(request_ids)} request(s)")
+        except OSError:
+            pass
+
+    def close(self):
+        """Close the connection and fail every request still waiting."""
+        with self._lock:
+            if self.closed:
+                return
+            self.closed = True
+            pending, self._pending = self._pending, {}
+        _close_socket(self.sock)
+        for entry in pending.values():
+            entry.complete(dict(_KEEP_ALIVE_CLOSED))
+
+    def _read_loop(self):
+        try:
+            while not self.closed:
+                # Poll so close() from another thread ends the loop; frames are read with the socket timeout
+                if not select.select([self.sock], [], [], 1.0)[0]:
+                    continue
+                response = _recv_framed_response(self.sock, "shared", self.wire)
+                if response is None:
+                    _debug("TCP [shared] Connection closed by server")
+                    break
+                request_id = response.pop("id", None)
+                with self._lock:
+                    entry = self._pending.pop(request_id, None)
+                if entry is None:
+                    _debug(f"TCP [shared] Ignoring response with unexpected id {request_id}")
+                    continue
+                entry.complete(response)
+        except Exception as e:
+            if not self.closed:
+                _debug(f"TCP [shared] Reader stopped: {e}")
+        finally:
+            self.close()
+
+
+class _ConnectionPool:
+    """Up to UNREAL_POOL_SIZE multiplexed connections to one instance; each request goes to the least busy one."""
+
+    def __init__(self, size: int, instance: UnrealInstance):
+        self._size = size
+        self._instance = instance
+        self._lock = threading.Lock()
+        # Held while opening, so concurrent first requests share one new connection
+        self._connect_lock = threading.Lock()
+        self._connections: List[_MultiplexedConnection] = []
+
+    def _pick(self) -> Optional[_MultiplexedConnection]:
+        with self._lock:
+            self._connections = [connection for connection in self._connections if not connection.closed]
+            least_busy = min(self._connections, key=lambda connection: connection.in_flight, default=None)
+            if least_busy is not None and (least_busy.in_flight == 0 or len(self._connections) >= self._size):
+                return least_busy
+            return None
+
+    def acquire(self, command_name: str) -> _MultiplexedConnection:
+        connection = self._pick()
+        if connection is not None:
+            return connection
+        with self._connect_lock:
+            connection = self._pick()
+            if connection is not None:
+                return connection
+            sock = _open_socket(command_name, self._instance)
+            try:
+                wire = _negotiate_wire(sock)
+            except Exception:
+                _close_socket(sock)
+                raise
+            connection = _MultiplexedConnection(sock, wire)
+            with self._lock:
+                self._connections.append(connection)
+            return connection
+
+    def reset(self):
+        with self._lock:
+            connections, self._connections = self._connections, []
+        for connection in connections:
+            connection.close()
+
+
+_pools = [_ConnectionPool(UNREAL_POOL_SIZE, instance) for instance in UNREAL_INSTANCES]
+
+
+def _send_multiplexed(commands: List[Tuple[str, Dict[str, Any]]], instance_index: int = 0) -> List[Dict[str, Any]]:
+    """Send commands on a pooled connection to one instance and wait for their responses, in the order of commands."""
+    label = commands[0][0] if len(commands) == 1 else "pipelined"
+    try:
+        connection = _pools[instance_index].acquire(label)
+        ids = [next(_request_ids) for _ in commands]
+        _debug(f"TCP [{label}] Sending {len(commands)} request(s), ids {ids[0]}..{ids[-1]}")
+        pending = connection.submit([
+            (request_id, _envelope(name, params, request_id))
+            for request_id, (name, params) in zip(ids, commands)
+        ])
+    except Exception as e:
+        return [_connection_error(label, e)] * len(commands)
+
+    deadline = time.monotonic() + UNREAL_SOCKET_TIMEOUT
+    for entry in pending:
+        if not entry.event.wait(max(0.0, deadline - time.monotonic())):
+            break
+    timed_out = [request_id for request_id, entry in zip(ids, pending) if not entry.event.is_set()]
+    if timed_out:
+        _debug(f"TCP [{label}] TIMEOUT! {len(timed_out)} request(s) unanswered")
+        connection.abandon(timed_out)
+
+    timeout = {"status": "error", "error": "Connection timeout"}
+    return [entry.response if entry.event.is_set() and entry.response is not None else dict(timeout)
+            for entry in pending]
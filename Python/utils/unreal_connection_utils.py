@@ -1,181 +1,453 @@
 """
 Utilities for working with Unreal Engine connections.
 
-SIMPLIFIED VERSION: All requests are serialized with a global lock.
-One request at a time - no concurrency, no race conditions.
+Requests from every thread share a small pool of keep-alive connections
+("keep_alive": true in the request envelope; UNREAL_POOL_SIZE, default 1).
+Each request is tagged with an "id", and a reader thread per connection hands
+each response to the request it answers, so concurrent callers are in flight
+together instead of queueing behind one another. Set UNREAL_KEEP_ALIVE=0 to
+fall back to one connection per request.
+
+Messages are length-prefixed: a 4-byte big-endian payload length followed by
+the UTF-8 JSON payload, in both directions, so payloads of any size are read
+in one pass. Set UNREAL_FRAMED=0 to send bare JSON like older clients did.
+
+Set UNREAL_ENCODING=cbor to negotiate CBOR payloads in a handshake when a
+keep-alive connection is opened; numbers then travel as binary values instead
+of decimal text. Set UNREAL_COMPRESSION=zlib to also have frames above the
+server's threshold (16 KB) zlib-compressed in both directions, which helps
+with metadata dumps over slow links. The server falls back to plain JSON for
+anything it doesn't support.
+
+The handshake also asks for attachment frames (UNREAL_ATTACHMENTS=0 turns this
+off): screenshots then arrive as raw bytes after the JSON in the same frame
+rather than as base64 text, and are put back into the result as the base64
+strings the tools expect.
+
+send_unreal_commands_pipelined() writes several requests in one go on a pooled
+connection; the server answers each as soon as it finishes, and responses are
+matched back by id.
+
+When the editor runs on the same machine, requests go over its local domain
+socket (unreal-mcp-<port>.sock in the temp directory, or UNREAL_MCP_SOCKET_PATH)
+instead of TCP loopback. The local socket is not supported on Windows, where
+every request uses TCP.
+UNREAL_TRANSPORT=tcp forces TCP, =unix requires the local socket; the default
+(auto) falls back to TCP when it isn't available.
+
+Every request carries "deadline_ms" (UNREAL_DEADLINE_MS, default just under the
+socket timeout; 0 disables it), so the editor drops commands this client has
+already given up on instead of running them on the game thread. Requests
+still outstanding at a timeout are cancelled with "cancel" messages.
+
+UNREAL_AUTO_BATCH_MS=<window> (or set_auto_batch_window()) turns on client-side
+batching: mutating calls on the same asset made within the window, e.g. by
+parallel tool calls, are sent as one execute_batch and each caller gets its own
+result back. Off by default.
+
+UNREAL_DEDUPLICATE_READS=1 (or set_read_deduplication()) lets a get_/list_/
+search_/find_ command share the response of an identical one already in
+flight, as the gateway server does for the tool groups it hosts.
+
+Debug messages go to mcp_debug.log through a background writer thread
+(UNREAL_MCP_DEBUG_LOG=0 turns the log off).
+
+UNREAL_INSTANCES="host:port,host:port,..." (or just ports) spreads requests over
+several editor or headless commandlet instances (-run=UnrealMCP -MCPPort=N),
+each with its own pool. A command that names an asset (blueprint_name,
+material_path, ..., or "name" for create_ commands) always goes to the same
+instance, picked from a stable hash of the asset name, so every job on a
+package runs where that package is loaded and edited. Commands that name no
+asset, such as level and actor commands, go to the first instance.
+
+The layers live in their own modules: unreal_transport (settings, sockets,
+framing), unreal_connection_pool (multiplexed connections and their reader
+threads), unreal_routing (instance selection) and unreal_auto_batch.
+
+LevelEventListener subscribes to the editor's level_actors events on a
+connection of its own (the shared one never receives unprompted messages)
+and accumulates the actors added, updated and removed since it was last read.
 """
 
-import logging
-import socket
+import asyncio
+import copy
 import json
-import threading
 import os
-import datetime
-from typing import Dict, Any, Optional
-
-# Get logger
-logger = logging.getLogger("UnrealMCP")
-
-# Configuration
-UNREAL_HOST = "127.0.0.1"
-UNREAL_PORT = 55557
-
-# Debug log file
-_debug_log_path = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "mcp_debug.log")
-
-def _debug(msg: str):
-    """Write debug message to file with timestamp."""
-    try:
-        with open(_debug_log_path, "a", encoding="utf-8") as f:
-            f.write(f"[{datetime.datetime.now()}] {msg}\n")
-            f.flush()
-    except:
-        pass
-
-# Global lock - only ONE request can be in-flight at a time
-_request_lock = threading.Lock()
-
-
-def _send_tcp_command(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+import socket
+import threading
+import time
+from typing import Dict, Any, Optional, List, Tuple
+# The settings and instance list stay importable from here
+from utils.unreal_transport import (
+    UNREAL_HOST, UNREAL_PORT, UNREAL_KEEP_ALIVE, UNREAL_FRAMED, UNREAL_ENCODING, UNREAL_COMPRESSION,
+    UNREAL_ATTACHMENTS, UNREAL_TRANSPORT, UNREAL_SOCKET_TIMEOUT, UNREAL_DEADLINE_MS, UNREAL_SOCKET_PATH,
+    UNREAL_INSTANCES, UnrealInstance, WireOptions, logger, _PLAIN_WIRE,
+    _close_socket, _connection_error, _debug, _envelope, _negotiate_wire, _open_socket, _pack,
+    _recv_framed_response,
+)
+from utils.unreal_connection_pool import UNREAL_POOL_SIZE, _pools, _send_multiplexed
+from utils.unreal_routing import get_instance_for, _instance_index
+from utils.unreal_auto_batch import (
+    UNREAL_AUTO_BATCH_MS, _AUTO_BATCH_COMMANDS, _AutoBatcher, _auto_batch_asset,
+)
+
+
+def _send_one_shot_command(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
     """
-    Send a single TCP command to Unreal and wait for response.
-    This is the core function - no retries, no complexity.
+    Send a command on a connection of its own and close it after the response.
+
+    Used when keep-alive or framing is turned off, since requests can only be
+    multiplexed on framed keep-alive connections.
     """
     sock = None
     try:
-        _debug(f"TCP [{command_name}] Creating socket...")
-        sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-        sock.settimeout(30)  # 30 second timeout for everything
-        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
-        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
-
-        _debug(f"TCP [{command_name}] Connecting to {UNREAL_HOST}:{UNREAL_PORT}...")
-        sock.connect((UNREAL_HOST, UNREAL_PORT))
-        _debug(f"TCP [{command_name}] Connected!")
-
-        # Send command
-        command_obj = {"type": command_name, "params": params or {}}
-        command_json = json.dumps(command_obj)
-        _debug(f"TCP [{command_name}] Sending {len(command_json)} bytes...")
-        sock.sendall(command_json.encode('utf-8'))
-        _debug(f"TCP [{command_name}] Sent! Waiting for response...")
-
-        # Receive response - simple blocking recv until we get complete JSON
+        sock = _open_socket(command_name, get_instance_for(command_name, params))
+        command_bytes = _pack(_envelope(command_name, params), _PLAIN_WIRE)
+        _debug(f"TCP [{command_name}] Sending {len(command_bytes)} bytes...")
+        sock.sendall(command_bytes)
+
+        if UNREAL_FRAMED:
+            response = _recv_framed_response(sock, command_name)
+            if response is not None:
+                return response
+            _debug(f"TCP [{command_name}] FAILED - connection closed before response")
+            return {"status": "error", "error": "Connection closed before complete response"}
+
+        # Unframed: read until the data parses as complete JSON or the server closes
         chunks = []
-        recv_count = 0
         while True:
-            recv_count += 1
-            _debug(f"TCP [{command_name}] recv() call #{recv_count}...")
             chunk = sock.recv(8192)
-            _debug(f"TCP [{command_name}] recv() returned {len(chunk) if chunk else 0} bytes")
-
             if not chunk:
-                _debug(f"TCP [{command_name}] Connection closed by server")
                 break
             chunks.append(chunk)
-
-            # Try to parse as JSON - if successful, we have complete response
-            data = b''.join(chunks)
             try:
-                response = json.loads(data.decode('utf-8'))
-                _debug(f"TCP [{command_name}] SUCCESS! Got complete JSON ({len(data)} bytes)")
-                return response
+                return json.loads(b''.join(chunks).decode('utf-8'))
             except json.JSONDecodeError:
-                _debug(f"TCP [{command_name}] Partial JSON ({len(data)} bytes), continuing...")
                 continue
 
-        # If we get here, connection closed before complete JSON
-        _debug(f"TCP [{command_name}] Connection closed, checking if we have complete data...")
-        if chunks:
-            data = b''.join(chunks)
-            try:
-                response = json.loads(data.decode('utf-8'))
-                _debug(f"TCP [{command_name}] SUCCESS after close ({len(data)} bytes)")
-                return response
-            except:
-                _debug(f"TCP [{command_name}] FAILED - incomplete JSON after close")
-                pass
-
         _debug(f"TCP [{command_name}] FAILED - no complete response")
         return {"status": "error", "error": "Connection closed before complete response"}
 
-    except socket.timeout:
-        _debug(f"TCP [{command_name}] TIMEOUT!")
-        return {"status": "error", "error": "Connection timeout"}
-    except ConnectionRefusedError:
-        _debug(f"TCP [{command_name}] CONNECTION REFUSED!")
-        return {"status": "error", "error": "Connection refused - is Unreal Engine running?"}
     except Exception as e:
-        _debug(f"TCP [{command_name}] EXCEPTION: {e}")
-        return {"status": "error", "error": str(e)}
+        return _connection_error(command_name, e)
     finally:
-        _debug(f"TCP [{command_name}] Closing socket...")
-        if sock:
-            try:
-                sock.close()
-            except:
-                pass
-        _debug(f"TCP [{command_name}] Socket closed")
+        _close_socket(sock)
+
+
+def _send_tcp_command(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    """Send a single command to Unreal and wait for its response. No retries."""
+    if UNREAL_FRAMED and UNREAL_KEEP_ALIVE:
+        return _send_multiplexed([(command_name, params)], _instance_index(command_name, params))[0]
+    return _send_one_shot_command(command_name, params)
 
 
 def send_unreal_command(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
     """
     Send a command to Unreal Engine.
 
-    IMPORTANT: This function is serialized - only one request at a time.
-    If multiple threads call this, they will queue up and execute one by one.
+    Safe to call from several threads at once: their requests are in flight
+    together on the shared connection, and each call returns its own response.
+    With auto-batching on, mutating calls on the same asset may be sent
+    together as one execute_batch (see set_auto_batch_window), and with read
+    de-duplication on, identical concurrent reads share one request (see
+    set_read_deduplication).
     """
-    _debug(f"QUEUE [{command_name}] Entered send_unreal_command")
-    _debug(f"QUEUE [{command_name}] Waiting for lock...")
+    is_shared_read = _read_coalescer.enabled and _read_coalescer.is_read(command_name)
+    if _read_coalescer.enabled and not is_shared_read:
+        _read_coalescer.note_other_command()
+    if _auto_batcher.window_ms > 0 and command_name != "execute_batch":
+        asset = _auto_batch_asset(params)
+        if asset is not None:
+            if command_name in _AUTO_BATCH_COMMANDS:
+                return _auto_batcher.submit(asset, command_name, params)
+            _auto_batcher.wait_for(asset)
+    if is_shared_read:
+        return _read_coalescer.send(command_name, params)
+    return _send_unreal_command_now(command_name, params)
+
+
+def _send_unreal_command_now(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    """Send a command right away, retrying once on retryable errors."""
+    _debug(f"QUEUE [{command_name}] Sending")
+
+    # Simple retry: try up to 2 times
+    for attempt in range(2):
+        response = _send_tcp_command(command_name, params)
+
+        # Check if it's an error we should retry
+        if response.get("status") == "error":
+            error = response.get("error", "")
+            if attempt == 0 and response.get("busy"):
+                # The editor is saturated; wait as long as it asks before trying once more
+                retry_after_ms = min(float(response.get("retry_after_ms", 500)), 5000.0)
+                logger.warning(f"Unreal busy, retrying after {retry_after_ms:.0f} ms")
+                time.sleep(retry_after_ms / 1000.0)
+                continue
+            if attempt == 0 and response.get("warming_up"):
+                # The editor is still scanning assets at startup; wait as it suggests and try once more
+                retry_after_ms = min(float(response.get("retry_after_ms", 1000)), 5000.0)
+                logger.warning(f"Unreal warming up (eta {response.get('eta_ms', 0)} ms), retrying after {retry_after_ms:.0f} ms")
+                time.sleep(retry_after_ms / 1000.0)
+                continue
+            if attempt == 0 and ("timeout" in error.lower() or "refused" in error.lower()):
+                logger.warning(f"Retrying after error: {error}")
+                time.sleep(0.5)
+                continue
 
-    # Try to acquire lock with timeout to detect deadlocks
-    acquired = _request_lock.acquire(timeout=60)
-    if not acquired:
-        _debug(f"QUEUE [{command_name}] DEADLOCK! Could not acquire lock after 60s")
-        return {"status": "error", "error": "Request queue deadlock - lock not released by previous request"}
+        # Success or non-retryable error
+        break
 
-    _debug(f"QUEUE [{command_name}] Got lock!")
+    # Handle nested error format from C++ MCPErrorHandler
+    if response.get("success") is False:
+        error_field = response.get("error")
+        if isinstance(error_field, dict):
+            error_message = (error_field.get("errorMessage") or
+                           error_field.get("errorDetails") or
+                           error_field.get("message") or
+                           "Unknown error")
+            return {"status": "error", "error": error_message}
+        elif isinstance(error_field, str):
+            return {"status": "error", "error": error_field}
+        else:
+            return {"status": "error", "error": response.get("message", "Unknown error")}
 
-    try:
-        _debug(f"QUEUE [{command_name}] Calling _send_tcp_command...")
-
-        # Simple retry: try up to 2 times
-        for attempt in range(2):
-            response = _send_tcp_command(command_name, params)
-
-            # Check if it's an error we should retry
-            if response.get("status") == "error":
-                error = response.get("error", "")
-                if attempt == 0 and ("timeout" in error.lower() or "refused" in error.lower()):
-                    logger.warning(f"Retrying after error: {error}")
-                    import time
-                    time.sleep(0.5)
-                    continue
-
-            # Success or non-retryable error
-            break
-
-        # Handle nested error format from C++ MCPErrorHandler
-        if response.get("success") is False:
-            error_field = response.get("error")
-            if isinstance(error_field, dict):
-                error_message = (error_field.get("errorMessage") or
-                               error_field.get("errorDetails") or
-                               error_field.get("message") or
-                               "Unknown error")
-                return {"status": "error", "error": error_message}
-            elif isinstance(error_field, str):
-                return {"status": "error", "error": error_field}
-            else:
-                return {"status": "error", "error": response.get("message", "Unknown error")}
-
-        _debug(f"QUEUE [{command_name}] Done, returning response")
-        return response
+    _debug(f"QUEUE [{command_name}] Done, returning response")
+    return response
 
-    finally:
-        # ALWAYS release the lock, even if an exception occurred
-        _request_lock.release()
-        _debug(f"QUEUE [{command_name}] Released lock")
+
+def send_unreal_commands_pipelined(commands: List[Tuple[str, Dict[str, Any]]]) -> List[Dict[str, Any]]:
+    """
+    Send several commands at once and collect their responses.
+
+    All requests are written before any response is read, so the editor can run
+    them back to back without a round trip in between. Responses may arrive in
+    any order; they are matched by id and returned in the order of `commands`.
+    Requests still unanswered at the timeout are cancelled in the editor.
+    Requires framing and keep-alive; otherwise the commands are sent one by one.
+    With several instances, each is sent the commands routed to it, all at once.
+    """
+    if not commands:
+        return []
+    if not (UNREAL_FRAMED and UNREAL_KEEP_ALIVE):
+        return [send_unreal_command(name, params) for name, params in commands]
+
+    groups: Dict[int, List[int]] = {}
+    for position, (name, params) in enumerate(commands):
+        groups.setdefault(_instance_index(name, params), []).append(position)
+    if len(groups) == 1:
+        return _send_multiplexed(commands, next(iter(groups)))
+
+    responses: List[Optional[Dict[str, Any]]] = [None] * len(commands)
+
+    def send_group(instance_index: int, positions: List[int]):
+        group_responses = _send_multiplexed([commands[position] for position in positions], instance_index)
+        for position, response in zip(positions, group_responses):
+            responses[position] = response
+
+    threads = [threading.Thread(target=send_group, args=item, daemon=True) for item in groups.items()]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return responses
+
+
+_auto_batcher = _AutoBatcher(UNREAL_AUTO_BATCH_MS, _send_unreal_command_now)
+
+
+def set_auto_batch_window(window_ms: int):
+    """
+    Turn client-side batching on with the given window, or off with 0.
+
+    It pays off when calls arrive concurrently, e.g. parallel tool calls; a
+    strictly sequential caller only gets the window added to each mutating call.
+    """
+    _auto_batcher.window_ms = max(0, int(window_ms))
+
+
+# Opt-in de-duplication of reads (UNREAL_DEDUPLICATE_READS=1, or set_read_deduplication()).
+# A read made while an identical one is in flight waits for it and shares its response,
+# unless this process sent another command since the first read went out.
+UNREAL_DEDUPLICATE_READS = os.environ.get("UNREAL_DEDUPLICATE_READS", "0") != "0"
+_READ_COMMAND_PREFIXES = ("get_", "list_", "search_", "find_")
+
+
+class _InflightRead:
+    __slots__ = ("generation", "response", "done")
+
+    def __init__(self, generation: int):
+        self.generation = generation
+        self.response: Optional[Dict[str, Any]] = None
+        self.done = threading.Event()
+
+
+class _ReadCoalescer:
+    """Shares the response of an in-flight read with identical reads made meanwhile."""
+
+    def __init__(self, enabled: bool):
+        self.enabled = enabled
+        self._lock = threading.Lock()
+        self._inflight: Dict[str, _InflightRead] = {}
+        # Bumped by every other command, so a read never joins one sent before an edit
+        self._generation = 0
+
+    @staticmethod
+    def is_read(command_name: str) -> bool:
+        return command_name.startswith(_READ_COMMAND_PREFIXES)
+
+    def note_other_command(self):
+        with self._lock:
+            self._generation += 1
+
+    def send(self, command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+        try:
+            key = command_name + "\0" + json.dumps(params or {}, sort_keys=True, default=str)
+        except (TypeError, ValueError):
+            return _send_unreal_command_now(command_name, params)
+
+        with self._lock:
+            entry = self._inflight.get(key)
+            owner = entry is None or entry.generation != self._generation
+            if owner:
+                entry = self._inflight[key] = _InflightRead(self._generation)
+
+        if not owner:
+            _debug(f"QUEUE [{command_name}] Sharing the response of an identical read in flight")
+            entry.done.wait()
+            # Callers may modify what they get back
+            return copy.deepcopy(entry.response)
+
+        try:
+            entry.response = _send_unreal_command_now(command_name, params)
+        except Exception as e:
+            entry.response = {"status": "error", "error": str(e)}
+        finally:
+            with self._lock:
+                if self._inflight.get(key) is entry:
+                    del self._inflight[key]
+            entry.done.set()
+        return entry.response
+
+
+_read_coalescer = _ReadCoalescer(UNREAL_DEDUPLICATE_READS)
+
+
+def set_read_deduplication(enabled: bool):
+    """Turn sharing of responses between concurrent identical reads on or off."""
+    _read_coalescer.enabled = bool(enabled)
+
+
+async def send_unreal_command_async(command_name: str, params: Dict[str, Any]) -> Dict[str, Any]:
+    """send_unreal_command for async tools; runs on a worker thread so the event loop keeps serving."""
+    return await asyncio.to_thread(send_unreal_command, command_name, params)
+
+
+class LevelEventListener:
+    """
+    Follows actor changes in the editor level through a "subscribe" connection.
+
+    The editor coalesces changes and pushes at most one event per min_interval_ms;
+    the listener merges events further until take_changes() is called, using the
+    same rules: an update after an add stays an add, a remove after an add drops
+    the actor, and only the latest state of an actor is kept. A "resync" event
+    (undo/redo, map change, too many changes) or a lost connection means the
+    accumulated changes are incomplete and the level has to be re-read.
+    """
+
+    def __init__(self, min_interval_ms: int = 250):
+        self.min_interval_ms = min_interval_ms
+        self._lock = threading.Lock()
+        self._sock: Optional[socket.socket] = None
+        self._thread: Optional[threading.Thread] = None
+        self._added: Dict[str, Dict[str, Any]] = {}
+        self._updated: Dict[str, Dict[str, Any]] = {}
+        self._removed: set = set()
+        self._resync = True
+        self._events = 0
+
+    @property
+    def running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def start(self) -> None:
+        """Open the connection and subscribe; raises ConnectionError if the editor refuses."""
+        if not UNREAL_FRAMED:
+            raise ConnectionError("Level events need framed messages (UNREAL_FRAMED=1)")
+        sock = _open_socket("subscribe")
+        try:
+            wire = _negotiate_wire(sock)
+            sock.sendall(_pack({"type": "subscribe", "keep_alive": True,
+                                "params": {"topic": "level_actors", "min_interval_ms": self.min_interval_ms}}, wire))
+            response = _recv_framed_response(sock, "subscribe", wire)
+            if not response or response.get("status") != "success":
+                raise ConnectionError(f"Subscribe failed: {response}")
+        except Exception:
+            _close_socket(sock)
+            raise
+        # Events may be minutes apart; the reader thread blocks until one arrives
+        sock.settimeout(None)
+        self._sock = sock
+        self._thread = threading.Thread(target=self._run, args=(sock, wire), name="UnrealLevelEvents", daemon=True)
+        self._thread.start()
+
+    def stop(self) -> None:
+        """Close the subscription connection."""
+        sock, self._sock = self._sock, None
+        _close_socket(sock)
+
+    def take_changes(self) -> Dict[str, Any]:
+        """Return the changes accumulated since the last call and start over."""
+        with self._lock:
+            changes = {
+                "resync": self._resync,
+                "added": list(self._added.values()),
+                "updated": list(self._updated.values()),
+                "removed": sorted(self._removed),
+                "events": self._events,
+            }
+            self._added, self._updated, self._removed = {}, {}, set()
+            self._resync = False
+            self._events = 0
+        return changes
+
+    def _run(self, sock: socket.socket, wire: WireOptions) -> None:
+        try:
+            while True:
+                message = _recv_framed_response(sock, "level_events", wire)
+                if message is None:
+                    break
+                if message.get("type") == "event":
+                    self._apply(message)
+        except Exception as e:
+            _debug(f"TCP [level_events] Listener stopped: {e}")
+        finally:
+            _close_socket(sock)
+            with self._lock:
+                # Changes after this point are missed
+                self._resync = True
+
+    def _apply(self, event: Dict[str, Any]) -> None:
+        with self._lock:
+            self._events += 1
+            if event.get("resync"):
+                self._added, self._updated, self._removed = {}, {}, set()
+                self._resync = True
+                return
+            for actor in event.get("added", []):
+                name = actor.get("name")
+                self._removed.discard(name)
+                self._updated.pop(name, None)
+                self._added[name] = actor
+            for actor in event.get("updated", []):
+                name = actor.get("name")
+                if name in self._added:
+                    self._added[name] = actor
+                else:
+                    self._updated[name] = actor
+            for name in event.get("removed", []):
+                if self._added.pop(name, None) is None:
+                    self._updated.pop(name, None)
+                    self._removed.add(name)
 
 
 # Legacy compatibility
@@ -184,8 +456,9 @@ def get_unreal_engine_connection():
     return None
 
 def reset_connection():
-    """Legacy - not used in simplified version."""
-    pass
+    """Close the pooled keep-alive connections so the next request reconnects."""
+    for pool in _pools:
+        pool.reset()
 
 
 # Cache for project info
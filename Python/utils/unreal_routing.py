@@ -0,0 +1,51 @@
+"""
+Routing of commands over several editor instances (UNREAL_INSTANCES).
+
+A command that names an asset always goes to the same instance, picked from a
+stable hash of the asset name; commands that name no asset go to the first.
+"""
+
+import zlib
+from typing import Dict, Any, Optional
+from utils.unreal_transport import UNREAL_INSTANCES, UnrealInstance
+
+# Parameters that name the asset a command works on, in the order they are looked for
+_ROUTING_ASSET_PARAMS = (
+    "blueprint_name", "blueprint_path", "widget_name", "anim_blueprint_name", "state_tree_path",
+    "material_path", "system_path", "datatable_path", "datatable_name", "metasound_path",
+    "sound_cue_path", "sound_wave_path", "asset_path", "asset_name",
+)
+
+
+def _routing_asset(command_name: str, params: Optional[Dict[str, Any]]) -> Optional[str]:
+    """Asset name a command is routed by, lowercased, or None when it names none."""
+    params = params or {}
+    if command_name == "execute_batch":
+        # A batch stays together; it follows its operations when they all work on one asset
+        operations = params.get("operations")
+        assets = {_routing_asset(operation.get("command", ""), operation.get("params"))
+                  for operation in operations if isinstance(operation, dict)} if isinstance(operations, list) else set()
+        return assets.pop() if len(assets) == 1 else None
+    names = _ROUTING_ASSET_PARAMS + (("name",) if command_name.startswith("create_") else ())
+    for name in names:
+        value = params.get(name)
+        if isinstance(value, str) and value:
+            # "/Game/Path/BP_Foo.BP_Foo" and "BP_Foo" are the same asset to the commands
+            return value.rsplit("/", 1)[-1].split(".", 1)[0].lower()
+    return None
+
+
+def _instance_index(command_name: str, params: Optional[Dict[str, Any]]) -> int:
+    """Index in UNREAL_INSTANCES of the instance that runs the command."""
+    if len(UNREAL_INSTANCES) == 1:
+        return 0
+    asset = _routing_asset(command_name, params)
+    if asset is None:
+        return 0
+    # crc32 rather than hash(): every client process must send an asset to the same instance
+    return zlib.crc32(asset.encode("utf-8")) % len(UNREAL_INSTANCES)
+
+
+def get_instance_for(command_name: str, params: Optional[Dict[str, Any]] = None) -> UnrealInstance:
+    """The instance a command with these parameters is sent to."""
+    return UNREAL_INSTANCES[_instance_index(command_name, params)]
@@ -0,0 +1,337 @@
+"""
+Wire format and sockets of the Unreal bridge protocol.
+
+Configuration read from the environment, the editor instances requests may go
+to, the background debug log, opening the local domain socket or TCP
+connection of an instance, the handshake, and packing and reading frames
+(compression, CBOR, attachments). unreal_connection_utils documents the
+settings.
+"""
+
+import atexit
+import base64
+import datetime
+import json
+import logging
+import os
+import queue
+import socket
+import struct
+import sys
+import tempfile
+import threading
+import zlib
+from collections import namedtuple
+from typing import Dict, Any, Optional, List, Tuple
+from utils import cbor_codec
+
+# Get logger
+logger = logging.getLogger("UnrealMCP")
+
+# Configuration
+UNREAL_HOST = "127.0.0.1"
+UNREAL_PORT = int(os.environ.get("UNREAL_PORT", "55557"))
+UNREAL_KEEP_ALIVE = os.environ.get("UNREAL_KEEP_ALIVE", "1") != "0"
+UNREAL_FRAMED = os.environ.get("UNREAL_FRAMED", "1") != "0"
+UNREAL_ENCODING = os.environ.get("UNREAL_ENCODING", "json").lower()
+UNREAL_COMPRESSION = os.environ.get("UNREAL_COMPRESSION", "none").lower()
+UNREAL_ATTACHMENTS = os.environ.get("UNREAL_ATTACHMENTS", "1") != "0"
+UNREAL_TRANSPORT = os.environ.get("UNREAL_TRANSPORT", "auto").lower()
+UNREAL_SOCKET_TIMEOUT = 30
+# Slightly below the socket timeout so the editor's "deadline exceeded" answer arrives first
+UNREAL_DEADLINE_MS = int(os.environ.get("UNREAL_DEADLINE_MS", str((UNREAL_SOCKET_TIMEOUT - 2) * 1000)))
+UNREAL_SOCKET_PATH = os.environ.get("UNREAL_MCP_SOCKET_PATH") or os.path.join(tempfile.gettempdir(), f"unreal-mcp-{UNREAL_PORT}.sock")
+
+# An editor instance to send requests to; socket_path is its local socket, None when it isn't on this host
+UnrealInstance = namedtuple("UnrealInstance", ["host", "port", "socket_path"])
+_LOCAL_HOSTS = ("127.0.0.1", "localhost", "::1")
+
+
+def _parse_instances(spec: str) -> List[UnrealInstance]:
+    """Instances from UNREAL_INSTANCES ("host:port" or "port", comma separated); UNREAL_HOST:UNREAL_PORT if unset."""
+    instances = []
+    for entry in (part.strip() for part in spec.split(",")):
+        if not entry:
+            continue
+        host, _, port = entry.rpartition(":")
+        host = host.strip("[]") or UNREAL_HOST
+        socket_path = os.path.join(tempfile.gettempdir(), f"unreal-mcp-{int(port)}.sock") if host in _LOCAL_HOSTS else None
+        instances.append(UnrealInstance(host, int(port), socket_path))
+    return instances or [UnrealInstance(UNREAL_HOST, UNREAL_PORT, UNREAL_SOCKET_PATH)]
+
+
+UNREAL_INSTANCES = _parse_instances(os.environ.get("UNREAL_INSTANCES", ""))
+
+# Frame header: payload length as unsigned 32-bit big-endian
+_FRAME_HEADER = struct.Struct(">I")
+_MAX_FRAME_SIZE = 256 * 1024 * 1024
+# Top bit of the length marks a compressed frame: [uint32 uncompressed size][zlib stream]
+_COMPRESSED_FLAG = 0x80000000
+# Next bit marks a frame with attachments: [uint32 message size][message], then per attachment
+# [uint8 id length][id][uint32 data size][data]
+_ATTACHMENTS_FLAG = 0x40000000
+_DEFAULT_COMPRESSION_THRESHOLD = 16 * 1024
+
+# Per-connection wire options agreed in the handshake
+WireOptions = namedtuple("WireOptions", ["encoding", "compress", "threshold"])
+_PLAIN_WIRE = WireOptions("json", False, _DEFAULT_COMPRESSION_THRESHOLD)
+
+# Debug log file, written by a background thread so requests never wait on disk I/O.
+# UNREAL_MCP_DEBUG_LOG=0 turns it off.
+_debug_log_path = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "mcp_debug.log")
+_DEBUG_LOG_ENABLED = os.environ.get("UNREAL_MCP_DEBUG_LOG", "1") != "0"
+_debug_queue: "queue.SimpleQueue[str]" = queue.SimpleQueue()
+_debug_file = None
+_debug_file_lock = threading.Lock()
+_debug_writer: Optional[threading.Thread] = None
+_debug_writer_lock = threading.Lock()
+
+
+def _debug(msg: str):
+    """Queue a debug message with its timestamp; the writer thread appends it to the log."""
+    if not _DEBUG_LOG_ENABLED:
+        return
+    _debug_queue.put(f"[{datetime.datetime.now()}] {msg}\n")
+    if _debug_writer is None:
+        _start_debug_writer()
+
+
+def _start_debug_writer():
+    global _debug_writer
+    with _debug_writer_lock:
+        if _debug_writer is None:
+            _debug_writer = threading.Thread(target=_debug_writer_loop, name="UnrealMCPDebugLog", daemon=True)
+            _debug_writer.start()
+
+
+def _write_debug_lines(lines: List[str]):
+    """Append lines to the log file, opened once and kept open."""
+    global _debug_file
+    with _debug_file_lock:
+        try:
+            if _debug_file is None:
+                _debug_file = open(_debug_log_path, "a", encoding="utf-8")
+            _debug_file.write("".join(lines))
+            _debug_file.flush()
+        except OSError:
+            pass
+
+
+def _drain_debug_queue(lines: List[str]) -> List[str]:
+    while True:
+        try:
+            lines.append(_debug_queue.get_nowait())
+        except queue.Empty:
+            return lines
+
+
+def _debug_writer_loop():
+    while True:
+        # One write per burst of messages instead of one open/flush per message
+        _write_debug_lines(_drain_debug_queue([_debug_queue.get()]))
+
+
+@atexit.register
+def _flush_debug_log():
+    lines = _drain_debug_queue([])
+    if lines:
+        _write_debug_lines(lines)
+
+
+def _open_local_socket(command_name: str, instance: UnrealInstance) -> Optional[socket.socket]:
+    """Connect to the editor's local domain socket, or return None if it isn't available."""
+    if UNREAL_TRANSPORT == "tcp" or instance.socket_path is None:
+        return None
+    if sys.platform == "win32":
+        # The editor serves no local socket on Windows
+        if UNREAL_TRANSPORT == "unix":
+            raise OSError("UNREAL_TRANSPORT=unix is not supported on Windows")
+        return None
+    if UNREAL_TRANSPORT != "unix" and not os.path.exists(instance.socket_path):
+        return None
+
+    _debug(f"UNIX [{command_name}] Connecting to {instance.socket_path}...")
+    sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    sock.settimeout(UNREAL_SOCKET_TIMEOUT)
+    try:
+        sock.connect(instance.socket_path)
+    except OSError as e:
+        _close_socket(sock)
+        if UNREAL_TRANSPORT == "unix":
+            raise
+        # Stale socket file from an editor that exited uncleanly - use TCP
+        _debug(f"UNIX [{command_name}] Connect failed ({e}), falling back to TCP")
+        return None
+    _debug(f"UNIX [{command_name}] Connected!")
+    return sock
+
+
+def _open_socket(command_name: str, instance: Optional[UnrealInstance] = None) -> socket.socket:
+    """Create and connect a new socket to Unreal (the first instance by default), preferring the local socket on the same host."""
+    instance = instance or UNREAL_INSTANCES[0]
+    sock = _open_local_socket(command_name, instance)
+    if sock is not None:
+        return sock
+
+    _debug(f"TCP [{command_name}] Creating socket...")
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.settimeout(UNREAL_SOCKET_TIMEOUT)  # 30 second timeout for everything
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+
+    _debug(f"TCP [{command_name}] Connecting to {instance.host}:{instance.port}...")
+    sock.connect((instance.host, instance.port))
+    _debug(f"TCP [{command_name}] Connected!")
+    return sock
+
+
+def _close_socket(sock: Optional[socket.socket]):
+    """Close a socket, ignoring errors."""
+    if sock:
+        try:
+            sock.close()
+        except:
+            pass
+
+
+def _recv_exact(sock: socket.socket, size: int) -> Optional[bytes]:
+    """Receive exactly size bytes, or return None if the connection closes first."""
+    buffer = bytearray(size)
+    view = memoryview(buffer)
+    received = 0
+    while received < size:
+        count = sock.recv_into(view[received:], size - received)
+        if count == 0:
+            return None
+        received += count
+    return bytes(buffer)
+
+
+def _encode_message(payload: bytes) -> bytes:
+    """Prefix the payload with its length header when framing is enabled."""
+    if UNREAL_FRAMED:
+        return _FRAME_HEADER.pack(len(payload)) + payload
+    return payload
+
+
+def _pack(obj: Dict[str, Any], wire: WireOptions) -> bytes:
+    """Serialize and frame a message with the connection's negotiated wire options."""
+    if wire.encoding == "cbor":
+        payload = cbor_codec.dumps(obj)
+    else:
+        payload = json.dumps(obj).encode('utf-8')
+    if UNREAL_FRAMED and wire.compress and len(payload) >= wire.threshold:
+        body = _FRAME_HEADER.pack(len(payload)) + zlib.compress(payload)
+        if len(body) < len(payload):
+            return _FRAME_HEADER.pack(len(body) | _COMPRESSED_FLAG) + body
+    return _encode_message(payload)
+
+
+def _negotiate_wire(sock: socket.socket) -> WireOptions:
+    """Run the handshake on a fresh keep-alive connection and return the options the server agreed to."""
+    wants_handshake = UNREAL_ENCODING != "json" or UNREAL_COMPRESSION != "none" or UNREAL_ATTACHMENTS
+    if not wants_handshake or not (UNREAL_FRAMED and UNREAL_KEEP_ALIVE):
+        return _PLAIN_WIRE
+    params: Dict[str, Any] = {"encodings": [UNREAL_ENCODING, "json"]}
+    if UNREAL_COMPRESSION != "none":
+        params["compression"] = [UNREAL_COMPRESSION]
+    if UNREAL_ATTACHMENTS:
+        params["attachments"] = True
+    sock.sendall(_pack({"type": "handshake", "params": params, "keep_alive": True}, _PLAIN_WIRE))
+    response = _recv_framed_response(sock, "handshake")
+    if not response or response.get("status") != "success":
+        raise ConnectionError(f"Handshake failed: {response}")
+    result = response.get("result", {})
+    wire = WireOptions(result.get("encoding", "json"),
+                       result.get("compression", "none") == "zlib",
+                       int(result.get("compression_threshold", _DEFAULT_COMPRESSION_THRESHOLD)))
+    _debug(f"TCP [handshake] Negotiated {wire}")
+    return wire
+
+
+def _recv_framed_response(sock: socket.socket, command_name: str, wire: WireOptions = _PLAIN_WIRE) -> Optional[Dict[str, Any]]:
+    """Read one length-prefixed response. Returns None if the connection closed before a header arrived."""
+    header = _recv_exact(sock, _FRAME_HEADER.size)
+    if header is None:
+        return None
+    (size,) = _FRAME_HEADER.unpack(header)
+    compressed = bool(size & _COMPRESSED_FLAG)
+    has_attachments = bool(size & _ATTACHMENTS_FLAG)
+    size &= ~(_COMPRESSED_FLAG | _ATTACHMENTS_FLAG)
+    if size == 0 or size > _MAX_FRAME_SIZE:
+        raise ValueError(f"Invalid response frame length {size}")
+    payload = _recv_exact(sock, size)
+    if payload is None:
+        raise ConnectionError(f"Connection closed after {_FRAME_HEADER.size} of {size} frame bytes")
+    _debug(f"TCP [{command_name}] SUCCESS! Got framed response ({size} bytes, compressed={compressed}, attachments={has_attachments})")
+    attachments: Dict[str, bytes] = {}
+    if has_attachments:
+        payload, attachments = _split_attachments(payload)
+    elif compressed:
+        (original_size,) = _FRAME_HEADER.unpack(payload[:_FRAME_HEADER.size])
+        if original_size > _MAX_FRAME_SIZE:
+            raise ValueError(f"Invalid uncompressed frame length {original_size}")
+        payload = zlib.decompress(payload[_FRAME_HEADER.size:])
+    if wire.encoding == "cbor":
+        message = cbor_codec.loads(payload)
+    else:
+        message = json.loads(payload.decode('utf-8'))
+    return _resolve_attachments(message, attachments) if attachments else message
+
+
+def _split_attachments(body: bytes) -> Tuple[bytes, Dict[str, bytes]]:
+    """Split the body of an attachments frame into its message payload and its attachments by id."""
+    view = memoryview(body)
+    (message_size,) = _FRAME_HEADER.unpack(view[:_FRAME_HEADER.size])
+    offset = _FRAME_HEADER.size + message_size
+    if offset > len(body):
+        raise ValueError(f"Attachment frame message of {message_size} bytes exceeds the {len(body)} byte frame")
+    message = bytes(view[_FRAME_HEADER.size:offset])
+    attachments: Dict[str, bytes] = {}
+    while offset < len(body):
+        id_length = body[offset]
+        attachment_id = bytes(view[offset + 1:offset + 1 + id_length]).decode("utf-8")
+        offset += 1 + id_length
+        (data_size,) = _FRAME_HEADER.unpack(view[offset:offset + _FRAME_HEADER.size])
+        offset += _FRAME_HEADER.size
+        if offset + data_size > len(body):
+            raise ValueError(f"Attachment {attachment_id} of {data_size} bytes exceeds the frame")
+        attachments[attachment_id] = bytes(view[offset:offset + data_size])
+        offset += data_size
+    return message, attachments
+
+
+def _resolve_attachments(value: Any, attachments: Dict[str, bytes]) -> Any:
+    """Replace {"$attachment": id} references with the base64 string of the attachment, as the tools expect."""
+    if isinstance(value, dict):
+        if len(value) == 1 and "$attachment" in value:
+            data = attachments.get(value["$attachment"])
+            return base64.b64encode(data).decode("ascii") if data is not None else None
+        return {key: _resolve_attachments(item, attachments) for key, item in value.items()}
+    if isinstance(value, list):
+        return [_resolve_attachments(item, attachments) for item in value]
+    return value
+
+
+def _envelope(command_name: str, params: Dict[str, Any], request_id: Optional[int] = None) -> Dict[str, Any]:
+    """Build the request envelope sent for a command."""
+    command_obj: Dict[str, Any] = {"type": command_name, "params": params or {}}
+    if UNREAL_KEEP_ALIVE:
+        command_obj["keep_alive"] = True
+    if request_id is not None:
+        command_obj["id"] = request_id
+    if UNREAL_DEADLINE_MS > 0:
+        command_obj["deadline_ms"] = UNREAL_DEADLINE_MS
+    return command_obj
+
+
+def _connection_error(command_name: str, error: Exception) -> Dict[str, Any]:
+    """Turn a connect or send failure into the error response callers expect."""
+    if isinstance(error, socket.timeout):
+        _debug(f"TCP [{command_name}] TIMEOUT!")
+        return {"status": "error", "error": "Connection timeout"}
+    if isinstance(error, ConnectionRefusedError):
+        _debug(f"TCP [{command_name}] CONNECTION REFUSED!")
+        return {"status": "error", "error": "Connection refused - is Unreal Engine running?"}
+    _debug(f"TCP [{command_name}] EXCEPTION: {error}")
+    return {"status": "error", "error": str(error)}
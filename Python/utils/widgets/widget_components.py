@@ -422,7 +422,11 @@ def get_widget_blueprint_metadata_impl(
     ctx: Context,
     widget_name: str,
     fields: List[str] = None,
-    container_name: str = "CanvasPanel_0"
+    container_name: str = "CanvasPanel_0",
+    root_widget: str = None,
+    depth: int = None,
+    width: int = None,
+    height: int = None
 ) -> Dict[str, Any]:
     """Implementation for getting comprehensive metadata about a Widget Blueprint.
 
@@ -443,8 +447,13 @@ def get_widget_blueprint_metadata_impl(
             - "events" - Bound events and delegates
             - "variables" - Blueprint variables
             - "functions" - Blueprint functions
-            - "*" - Return all fields (default)
+            - "measured_layout" - Measured sizes and geometry, without rendering (not in "*")
+            - "*" - Return all fields except measured_layout (default)
         container_name: Container name for dimensions field (default: "CanvasPanel_0")
+        root_widget: Widget the tree fields start at (default: the root widget)
+        depth: Levels below the start widget to include (default: all)
+        width: Layout width for measured_layout (default: 800)
+        height: Layout height for measured_layout (default: 600)
 
     Returns:
         Dict containing the requested metadata fields
@@ -459,6 +468,18 @@ def get_widget_blueprint_metadata_impl(
     if container_name:
         params["container_name"] = container_name
 
+    if root_widget:
+        params["root_widget"] = root_widget
+
+    if depth is not None:
+        params["depth"] = depth
+
+    if width is not None:
+        params["width"] = width
+
+    if height is not None:
+        params["height"] = height
+
     logger.info(f"Getting widget blueprint metadata for: {widget_name}, fields: {fields}")
     return send_unreal_command("get_widget_blueprint_metadata", params)
 
@@ -490,6 +511,59 @@ def reorder_widget_children(
     return send_unreal_command("reorder_widget_children", params)
 
 
+def build_widget_tree(
+    ctx: Context,
+    widget_name: str,
+    root: Dict[str, Any],
+    parent_name: str = ""
+) -> Dict[str, Any]:
+    """Implementation for building a whole widget hierarchy in one request.
+
+    Args:
+        ctx: The current context
+        widget_name: Name of the target Widget Blueprint
+        root: Nested widget spec for the root of the new hierarchy
+        parent_name: Existing widget to add the hierarchy to (default: the root widget)
+
+    Returns:
+        Dict containing the created widgets
+    """
+    params = {
+        "widget_name": widget_name,
+        "root": root
+    }
+
+    if parent_name:
+        params["parent_name"] = parent_name
+
+    logger.info(f"Building widget tree '{root.get('name')}' in widget '{widget_name}'")
+    return send_unreal_command("build_widget_tree", params)
+
+
+def batch_update_widgets(
+    ctx: Context,
+    widget_name: str,
+    updates: List[Dict[str, Any]]
+) -> Dict[str, Any]:
+    """Implementation for updating many widgets of a Widget Blueprint in one request.
+
+    Args:
+        ctx: The current context
+        widget_name: Name of the target Widget Blueprint
+        updates: Widget updates, each with a component_name
+
+    Returns:
+        Dict containing the properties that could or could not be set per widget
+    """
+    params = {
+        "widget_name": widget_name,
+        "updates": updates
+    }
+
+    logger.info(f"Updating {len(updates)} widgets in widget '{widget_name}'")
+    return send_unreal_command("batch_update_widgets", params)
+
+
 # =============================================================================
 # WIDGET BLUEPRINT CONFIGURATION TOOLS
 # =============================================================================
@@ -5,7 +5,7 @@ This module provides utilities for capturing screenshots of UMG Widget Blueprint
 """
 
 import logging
-from typing import Any, Dict
+from typing import Any, Dict, List, Optional
 from mcp.server.fastmcp import Context
 from utils.unreal_connection_utils import send_unreal_command
 
@@ -17,7 +17,10 @@ def capture_widget_screenshot_impl(
     widget_name: str,
     width: int = 800,
     height: int = 600,
-    format: str = "png"
+    format: str = "png",
+    quality: int = 85,
+    scale: float = 1.0,
+    region: Optional[List[int]] = None
 ) -> Dict[str, Any]:
     """
     Capture a screenshot of a UMG Widget Blueprint preview.
@@ -27,16 +30,19 @@ def capture_widget_screenshot_impl(
 
     Args:
         widget_name: Name of the widget blueprint to capture
-        width: Screenshot width in pixels (default: 800, max: 8192)
-        height: Screenshot height in pixels (default: 600, max: 8192)
+        width: Layout width in pixels (default: 800, max: 8192)
+        height: Layout height in pixels (default: 600, max: 8192)
         format: Image format - "png" or "jpg" (default: "png")
+        quality: JPEG quality 1-100 (default: 85); ignored for PNG
+        scale: Output size as a fraction of the layout size, in (0, 1] (default: 1.0)
+        region: Optional [x, y, width, height] crop in layout pixels
 
     Returns:
         Dict containing:
         - success: bool - Whether the screenshot was captured successfully
         - image_base64: str - Base64-encoded image data (if successful)
-        - width: int - Actual image width
-        - height: int - Actual image height
+        - width: int - Actual image width, after cropping and scaling
+        - height: int - Actual image height, after cropping and scaling
         - format: str - Image format used
         - image_size_bytes: int - Size of the compressed image in bytes
         - message: str - Success or error message
@@ -84,14 +90,40 @@ def capture_widget_screenshot_impl(
             "message": f"Failed to capture screenshot: unsupported format '{format}'"
         }
 
+    if quality < 1 or quality > 100:
+        return {
+            "success": False,
+            "error": f"Invalid quality: {quality}. Must be between 1 and 100",
+            "message": f"Failed to capture screenshot: invalid quality {quality}"
+        }
+
+    if scale <= 0 or scale > 1:
+        return {
+            "success": False,
+            "error": f"Invalid scale: {scale}. Must be greater than 0 and at most 1",
+            "message": f"Failed to capture screenshot: invalid scale {scale}"
+        }
+
+    params = {
+        "widget_name": widget_name,
+        "width": width,
+        "height": height,
+        "format": format_lower,
+        "quality": quality,
+        "scale": scale
+    }
+    if region is not None:
+        if len(region) != 4:
+            return {
+                "success": False,
+                "error": "region must be [x, y, width, height]",
+                "message": "Failed to capture screenshot: invalid region"
+            }
+        params["region"] = list(region)
+
     try:
         # Send command to Unreal Engine
-        response = send_unreal_command("capture_widget_screenshot", {
-            "widget_name": widget_name,
-            "width": width,
-            "height": height,
-            "format": format_lower
-        })
+        response = send_unreal_command("capture_widget_screenshot", params)
 
         # Log result
         if response.get("success"):